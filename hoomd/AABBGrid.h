@@ -0,0 +1,277 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "HOOMDMath.h"
+#include "VectorMath.h"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "AABB.h"
+
+#ifndef __AABB_GRID_H__
+#define __AABB_GRID_H__
+
+/*! \file AABBGrid.h
+    \brief AABBGrid build, update, and query methods
+*/
+
+namespace hoomd
+    {
+namespace detail
+    {
+#ifndef __HIPCC__
+
+//! Uniform grid of AABBs
+/*! An AABBGrid bins particles into a uniform grid of cubic cells by the center of their AABBs. It
+   is an alternative to AABBTree for systems where all AABBs have similar sizes. The grid supports
+   the following operations:
+
+    - Query : Build a list of all particles whose AABBs may intersect with the query AABB. The list
+   may include particles that do not intersect the query, but never misses one that does. Runs in
+   O(1) time when the cell width is comparable to the AABB size.
+    - Update : Move a selected particle to the cell of its new AABB. Runs in O(1) time, so the grid
+   can be kept up to date over many moves without rebuilding it.
+    - buildGrid : Bin a complete set of AABBs, one for each particle.
+
+    **Implementation details**
+
+    Each cell stores the head of a doubly linked list of the particles in it, so that update() can
+   remove a particle from its old cell in constant time. The grid spans the centers of the AABBs
+   given to buildGrid(). Particles outside of that range (after update) are placed in the nearest
+   boundary cell and queries are clamped the same way, so queries remain correct. m_margin tracks
+   the largest AABB half width, which queries extend their range by. The total number of cells is
+   limited to a small multiple of the number of particles in dilute systems.
+*/
+class PYBIND11_EXPORT AABBGrid
+    {
+    public:
+    //! Construct an AABBGrid
+    AABBGrid() : m_inv_width(0), m_margin(0), m_dim(make_uint3(0, 0, 0)) { }
+
+    //! Build the grid from scratch
+    inline void buildGrid(const AABB* aabbs, unsigned int N, Scalar width);
+
+    //! Update the AABB of a particle
+    inline void update(unsigned int idx, const AABB& aabb);
+
+    //! Find all particles that may overlap a query AABB
+    inline void query(std::vector<unsigned int>& hits, const AABB& aabb) const;
+
+    //! Get the number of particles in the grid
+    unsigned int getNumParticles() const
+        {
+        return (unsigned int)m_cell.size();
+        }
+
+    //! Get the number of cells in the grid
+    unsigned int getNumCells() const
+        {
+        return (unsigned int)m_head.size();
+        }
+
+    private:
+    static constexpr unsigned int EMPTY = 0xffffffff; //!< Sentinel for the end of a cell list
+
+    vec3<Scalar> m_origin;          //!< Lower corner of the first cell
+    vec3<Scalar> m_extent_lower;    //!< Lower bound of all AABB centers in the grid
+    vec3<Scalar> m_extent_upper;    //!< Upper bound of all AABB centers in the grid
+    Scalar m_inv_width;             //!< Inverse of the cell width
+    Scalar m_margin;                //!< Largest half width of any AABB in the grid
+    uint3 m_dim;                    //!< Number of cells in each direction
+    std::vector<unsigned int> m_head; //!< First particle in each cell
+    std::vector<unsigned int> m_next; //!< Next particle in the same cell
+    std::vector<unsigned int> m_prev; //!< Previous particle in the same cell
+    std::vector<unsigned int> m_cell; //!< Cell containing each particle
+
+    //! Get the cell coordinates of a point, clamped to the grid
+    inline uint3 getCellCoord(const vec3<Scalar>& r) const;
+
+    //! Get the cell index of a point
+    inline unsigned int getCell(const vec3<Scalar>& r) const
+        {
+        uint3 c = getCellCoord(r);
+        return (c.z * m_dim.y + c.y) * m_dim.x + c.x;
+        }
+
+    //! Insert a particle at the head of a cell list
+    inline void insert(unsigned int idx, unsigned int cell);
+
+    //! Remove a particle from its cell list
+    inline void remove(unsigned int idx);
+
+    //! Include an AABB in the extent and margin of the grid
+    inline void extend(const AABB& aabb);
+    };
+
+/*! \param aabbs List of AABBs for each particle
+    \param N Number of AABBs in the list
+    \param width Nominal cell width
+
+    Builds the grid so that it covers the centers of all \a aabbs. Choose \a width no smaller than
+   the largest AABB to keep queries local to a few cells. The width is increased when needed to
+   limit the number of cells to 8 per particle.
+*/
+inline void AABBGrid::buildGrid(const AABB* aabbs, unsigned int N, Scalar width)
+    {
+    m_margin = 0;
+    m_extent_lower = vec3<Scalar>(0, 0, 0);
+    m_extent_upper = vec3<Scalar>(0, 0, 0);
+    if (N > 0)
+        {
+        m_extent_lower = m_extent_upper = aabbs[0].getPosition();
+        }
+    for (unsigned int i = 0; i < N; i++)
+        {
+        extend(aabbs[i]);
+        }
+
+    // size the grid to the extent of the centers
+    vec3<Scalar> L = m_extent_upper - m_extent_lower;
+    width = std::max(width, Scalar(1e-6) * std::max(L.x, std::max(L.y, L.z)));
+    if (width <= Scalar(0.0))
+        width = Scalar(1.0);
+
+    const double max_cells = std::max(64.0, 8.0 * double(N));
+    while (true)
+        {
+        m_dim = make_uint3((unsigned int)(L.x / width) + 1,
+                           (unsigned int)(L.y / width) + 1,
+                           (unsigned int)(L.z / width) + 1);
+        if (double(m_dim.x) * double(m_dim.y) * double(m_dim.z) <= max_cells)
+            break;
+        width *= Scalar(2.0);
+        }
+    m_inv_width = Scalar(1.0) / width;
+    m_origin = m_extent_lower;
+
+    m_head.assign(m_dim.x * m_dim.y * m_dim.z, EMPTY);
+    m_next.resize(N);
+    m_prev.resize(N);
+    m_cell.resize(N);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        insert(i, getCell(aabbs[i].getPosition()));
+        }
+    }
+
+/*! \param idx Particle to update
+    \param aabb New AABB for particle \a idx
+*/
+inline void AABBGrid::update(unsigned int idx, const AABB& aabb)
+    {
+    assert(idx < m_cell.size());
+
+    extend(aabb);
+
+    unsigned int cell = getCell(aabb.getPosition());
+    if (cell != m_cell[idx])
+        {
+        remove(idx);
+        insert(idx, cell);
+        }
+    }
+
+/*! \param hits Output vector of particle indices that may overlap the query (appended to)
+    \param aabb The AABB to query
+*/
+inline void AABBGrid::query(std::vector<unsigned int>& hits, const AABB& aabb) const
+    {
+    if (m_head.size() == 0)
+        return;
+
+    // the centers of all overlapping AABBs are within the query extended by the margin
+    vec3<Scalar> lower = aabb.getLower() - vec3<Scalar>(m_margin, m_margin, m_margin);
+    vec3<Scalar> upper = aabb.getUpper() + vec3<Scalar>(m_margin, m_margin, m_margin);
+
+    // skip queries outside of the grid entirely (e.g. most periodic images)
+    if (upper.x < m_extent_lower.x || lower.x > m_extent_upper.x || upper.y < m_extent_lower.y
+        || lower.y > m_extent_upper.y || upper.z < m_extent_lower.z
+        || lower.z > m_extent_upper.z)
+        return;
+
+    uint3 lo = getCellCoord(lower);
+    uint3 hi = getCellCoord(upper);
+    for (unsigned int k = lo.z; k <= hi.z; k++)
+        {
+        for (unsigned int j = lo.y; j <= hi.y; j++)
+            {
+            for (unsigned int i = lo.x; i <= hi.x; i++)
+                {
+                unsigned int cell = (k * m_dim.y + j) * m_dim.x + i;
+                for (unsigned int p = m_head[cell]; p != EMPTY; p = m_next[p])
+                    {
+                    hits.push_back(p);
+                    }
+                }
+            }
+        }
+    }
+
+/*! \param r Point to locate
+    \returns Coordinates of the cell containing \a r, clamped to the grid
+*/
+inline uint3 AABBGrid::getCellCoord(const vec3<Scalar>& r) const
+    {
+    vec3<Scalar> f = (r - m_origin) * m_inv_width;
+    int3 c = make_int3(int(slow::floor(f.x)), int(slow::floor(f.y)), int(slow::floor(f.z)));
+    c.x = std::max(0, std::min(c.x, int(m_dim.x) - 1));
+    c.y = std::max(0, std::min(c.y, int(m_dim.y) - 1));
+    c.z = std::max(0, std::min(c.z, int(m_dim.z) - 1));
+    return make_uint3(c.x, c.y, c.z);
+    }
+
+/*! \param idx Particle to insert
+    \param cell Cell to insert it into
+*/
+inline void AABBGrid::insert(unsigned int idx, unsigned int cell)
+    {
+    unsigned int head = m_head[cell];
+    m_next[idx] = head;
+    m_prev[idx] = EMPTY;
+    if (head != EMPTY)
+        m_prev[head] = idx;
+    m_head[cell] = idx;
+    m_cell[idx] = cell;
+    }
+
+/*! \param idx Particle to remove
+ */
+inline void AABBGrid::remove(unsigned int idx)
+    {
+    unsigned int next = m_next[idx];
+    unsigned int prev = m_prev[idx];
+    if (prev != EMPTY)
+        m_next[prev] = next;
+    else
+        m_head[m_cell[idx]] = next;
+    if (next != EMPTY)
+        m_prev[next] = prev;
+    }
+
+/*! \param aabb AABB to include
+
+    Queries compare against the extent and margin, so they only ever grow between builds.
+*/
+inline void AABBGrid::extend(const AABB& aabb)
+    {
+    vec3<Scalar> center = aabb.getPosition();
+    vec3<Scalar> half = (aabb.getUpper() - aabb.getLower()) * Scalar(0.5);
+    m_margin = std::max(m_margin, std::max(half.x, std::max(half.y, half.z)));
+
+    m_extent_lower.x = std::min(m_extent_lower.x, center.x);
+    m_extent_lower.y = std::min(m_extent_lower.y, center.y);
+    m_extent_lower.z = std::min(m_extent_lower.z, center.z);
+    m_extent_upper.x = std::max(m_extent_upper.x, center.x);
+    m_extent_upper.y = std::max(m_extent_upper.y, center.y);
+    m_extent_upper.z = std::max(m_extent_upper.z, center.z);
+    }
+
+#endif // __HIPCC__
+
+    }; // end namespace detail
+
+    }; // end namespace hoomd
+
+#endif //__AABB_GRID_H__
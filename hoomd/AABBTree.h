@@ -71,6 +71,9 @@ struct PYBIND11_EXPORT AABBNode
    as the tree topology is left unchanged. Runs in O(log N) time. AABBs are not saved for all
    particles, so an update will only increase the volume of nodes. The tree should be rebuilt
    periodically instead of continually updated.
+    - Refit : Recompute the AABBs of all nodes from a complete set of particle AABBs, keeping the
+   tree topology. Runs in O(N) time and also shrinks nodes. getCost() measures how much the refit
+   tree has degraded compared to a freshly built one.
     - buildTree : build an efficiently arranged tree given a complete set of AABBs, one for each
    particle.
 
@@ -161,6 +164,12 @@ class PYBIND11_EXPORT AABBTree
     //! Update the AABB of a particle
     inline void update(unsigned int idx, const AABB& aabb);
 
+    //! Recompute all node AABBs from a list of particle AABBs without changing the topology
+    inline bool refit(const AABB* aabbs, unsigned int N);
+
+    //! Get the summed surface area of all nodes
+    inline Scalar getCost() const;
+
     //! Get the height of a given particle's leaf node
     inline unsigned int height(unsigned int idx);
 
@@ -357,6 +366,56 @@ inline void AABBTree::update(unsigned int idx, const AABB& aabb)
         }
     }
 
+/*! \param aabbs List of AABBs for each particle, in the same index order as when the tree was built
+    \param N Number of AABBs in the list
+    \returns false when \a N does not match the number of particles in the tree (the tree is not
+             modified in that case)
+
+    Leaf nodes are set to the merged AABBs of their particles and internal nodes to the merged AABBs
+   of their children. buildNode() allocates every node before its children, so a single pass over
+   the nodes in reverse order visits children before their parents.
+*/
+inline bool AABBTree::refit(const AABB* aabbs, unsigned int N)
+    {
+    if (N != m_mapping.size())
+        return false;
+
+    for (unsigned int i = m_num_nodes; i > 0; i--)
+        {
+        AABBNode& node = m_nodes[i - 1];
+        if (node.left == INVALID_NODE)
+            {
+            AABB aabb = aabbs[node.particles[0]];
+            for (unsigned int j = 1; j < node.num_particles; j++)
+                aabb = merge(aabb, aabbs[node.particles[j]]);
+            node.aabb = aabb;
+            }
+        else
+            {
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+            }
+        }
+
+    return true;
+    }
+
+/*! \returns The sum of the surface areas of all node AABBs
+
+    Queries visit every node whose AABB overlaps the query, so the summed surface area estimates
+   the query cost. Compare the cost of a refit tree to its cost when it was built to decide when to
+   rebuild it.
+*/
+inline Scalar AABBTree::getCost() const
+    {
+    Scalar cost = 0;
+    for (unsigned int i = 0; i < m_num_nodes; i++)
+        {
+        vec3<Scalar> d = m_nodes[i].aabb.getUpper() - m_nodes[i].aabb.getLower();
+        cost += Scalar(2.0) * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+    return cost;
+    }
+
 /*! \param idx Particle to get height for
     \returns Height of the node
 */
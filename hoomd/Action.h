@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "Autotuned.h"
+#include "Profiler.h"
 #include "SharedSignal.h"
 #include "SystemDefinition.h"
 
@@ -34,6 +35,24 @@ class Action : public Autotuned
         {
         }
 
+    /// Get the wall clock time statistics of this action
+    ProfileTimer& getProfileTimer()
+        {
+        return m_profile_timer;
+        }
+
+    /// Set the MemoryTracker tag that owns the memory this action allocates
+    void setMemoryTag(unsigned int tag)
+        {
+        m_memory_tag = tag;
+        }
+
+    /// Get the MemoryTracker tag that owns the memory this action allocates
+    unsigned int getMemoryTag() const
+        {
+        return m_memory_tag;
+        }
+
     protected:
     /// The system definition this action is associated with.
     const std::shared_ptr<SystemDefinition> m_sysdef;
@@ -44,6 +63,12 @@ class Action : public Autotuned
     /// The simulation's execution configuration.
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf;
 
+    /// Wall clock time statistics, recorded when profiling is enabled
+    ProfileTimer m_profile_timer;
+
+    /// MemoryTracker tag made current while this action executes
+    unsigned int m_memory_tag = 0;
+
     /// Stored shared ptr to the system signals
     std::vector<std::shared_ptr<hoomd::detail::SignalSlot>> m_slots;
 
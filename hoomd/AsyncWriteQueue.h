@@ -0,0 +1,257 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file AsyncWriteQueue.h
+    \brief Declares the AsyncWriteQueue class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __ASYNC_WRITE_QUEUE_H__
+#define __ASYNC_WRITE_QUEUE_H__
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hoomd
+    {
+//! Bounded queue of frames written by a background I/O thread
+/*! Writers stage a frame in a buffer obtained from acquire() and pass it to the I/O thread with
+    push(). The I/O thread calls the write function on each frame in order and returns the buffer
+    to a free list, so later frames reuse the allocations of written frames. At most max_pending
+    frames are waiting or being written at any time: acquire() blocks until one of them is done.
+
+    The first exception raised by the write function is rethrown on the calling thread by the next
+    call to acquire(), wait(), or stop().
+
+    \tparam Frame Frame type, default constructible
+
+    \ingroup utils
+*/
+template<class Frame> class AsyncWriteQueue
+    {
+    public:
+    /// Write function: called on the I/O thread for each frame
+    typedef std::function<void(Frame&)> WriteFunction;
+
+    //! Construct a queue
+    /*! \param write Function that writes a frame
+        \param max_pending Maximum number of frames waiting or being written
+     */
+    AsyncWriteQueue(WriteFunction write, unsigned int max_pending)
+        : m_write(write), m_max_pending(max_pending)
+        {
+        }
+
+    //! Destructor
+    /*! Writes the pending frames and discards any error. Call stop() first to handle errors.
+     */
+    ~AsyncWriteQueue()
+        {
+        try
+            {
+            stop();
+            }
+        catch (...)
+            {
+            }
+        }
+
+    AsyncWriteQueue(const AsyncWriteQueue&) = delete;
+    AsyncWriteQueue& operator=(const AsyncWriteQueue&) = delete;
+
+    //! Start the I/O thread
+    void start()
+        {
+        if (m_thread.joinable())
+            {
+            return;
+            }
+
+        m_stop = false;
+        m_thread = std::thread(&AsyncWriteQueue::threadLoop, this);
+        }
+
+    //! Test if the I/O thread is running
+    bool isRunning() const
+        {
+        return m_thread.joinable();
+        }
+
+    //! Get a buffer to stage the next frame in
+    /*! \returns A written frame to reuse, or a new frame when there is none
+
+        Blocks while max_pending frames are already in flight.
+    */
+    std::unique_ptr<Frame> acquire()
+        {
+        std::unique_ptr<Frame> frame;
+
+            {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock,
+                      [this] { return m_exception || m_pending.size() + m_busy < m_max_pending; });
+
+            rethrow();
+
+            if (!m_free.empty())
+                {
+                frame = std::move(m_free.back());
+                m_free.pop_back();
+                }
+            }
+
+        if (!frame)
+            {
+            frame = std::make_unique<Frame>();
+            }
+
+        return frame;
+        }
+
+    //! Pass a staged frame to the I/O thread
+    /*! \param frame Frame from acquire()
+     */
+    void push(std::unique_ptr<Frame> frame)
+        {
+            {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.push_back(std::move(frame));
+            }
+        m_cv.notify_all();
+        }
+
+    //! Wait until the I/O thread writes all pending frames
+    /*! Acts as a barrier: when this method returns, every frame passed to push() has been written.
+     */
+    void wait()
+        {
+        if (!m_thread.joinable())
+            {
+            return;
+            }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_pending.empty() && !m_busy; });
+
+        rethrow();
+        }
+
+    //! Write all pending frames and stop the I/O thread
+    void stop()
+        {
+        if (!m_thread.joinable())
+            {
+            return;
+            }
+
+            {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+            }
+        m_cv.notify_all();
+        m_thread.join();
+
+        m_free.clear();
+
+        rethrow();
+        }
+
+    private:
+    /// Writes a frame
+    WriteFunction m_write;
+
+    /// Maximum number of frames waiting or being written
+    unsigned int m_max_pending;
+
+    /// The background I/O thread
+    std::thread m_thread;
+
+    /// Protects the queue and the I/O thread state
+    std::mutex m_mutex;
+
+    /// Signals changes to the queue
+    std::condition_variable m_cv;
+
+    /// Frames waiting to be written, oldest first
+    std::deque<std::unique_ptr<Frame>> m_pending;
+
+    /// Written frames kept to reuse their allocations
+    std::vector<std::unique_ptr<Frame>> m_free;
+
+    /// True while the I/O thread writes a frame
+    bool m_busy = false;
+
+    /// Set to true to stop the I/O thread
+    bool m_stop = false;
+
+    /// First error raised on the I/O thread
+    std::exception_ptr m_exception;
+
+    //! Rethrow and clear the first error raised on the I/O thread
+    /*! The caller must hold m_mutex, or the I/O thread must not be running.
+     */
+    void rethrow()
+        {
+        if (m_exception)
+            {
+            std::exception_ptr e = m_exception;
+            m_exception = nullptr;
+            std::rethrow_exception(e);
+            }
+        }
+
+    //! Main loop of the I/O thread
+    void threadLoop()
+        {
+        while (true)
+            {
+            std::unique_ptr<Frame> frame;
+
+                {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_pending.empty(); });
+
+                if (m_pending.empty())
+                    {
+                    return;
+                    }
+
+                frame = std::move(m_pending.front());
+                m_pending.pop_front();
+                m_busy = true;
+                }
+
+            try
+                {
+                m_write(*frame);
+                }
+            catch (...)
+                {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_exception)
+                    {
+                    m_exception = std::current_exception();
+                    }
+                }
+
+                {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_free.push_back(std::move(frame));
+                m_busy = false;
+                }
+            m_cv.notify_all();
+            }
+        }
+    };
+
+    } // end namespace hoomd
+#endif
@@ -14,6 +14,7 @@ void export_Autotuned(pybind11::module& m)
         .def(pybind11::init<>())
         .def("getAutotunerParameters", &Autotuned::getAutotunerParameters)
         .def("setAutotunerParameters", &Autotuned::setAutotunerParameters)
+        .def("getKernelTimes", &Autotuned::getKernelTimes)
         .def("startAutotuning", &Autotuned::startAutotuning)
         .def("isAutotuningComplete", &Autotuned::isAutotuningComplete);
     }
@@ -63,6 +63,18 @@ class PYBIND11_EXPORT Autotuned
             }
         }
 
+    /// Get the total GPU time of each autotuned kernel (in seconds).
+    pybind11::dict getKernelTimes()
+        {
+        pybind11::dict times;
+
+        for (const auto& tuner : m_autotuners)
+            {
+            times[tuner->getName().c_str()] = tuner->getKernelTime();
+            }
+        return times;
+        }
+
     /// Start an autotuning sequence.
     virtual void startAutotuning()
         {
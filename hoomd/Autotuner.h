@@ -10,6 +10,7 @@
 */
 
 #include "ExecutionConfiguration.h"
+#include "ProfileRange.h"
 
 #ifdef ENABLE_MPI
 #include "HOOMDMPI.h"
@@ -18,6 +19,7 @@
 #include <algorithm>
 #include <array>
 #include <cfloat>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <sstream>
@@ -68,6 +70,25 @@ class PYBIND11_EXPORT AutotunerBase
         return m_name;
         }
 
+    /// Get the total GPU time of the timed kernel launches (in seconds).
+    double getKernelTime() const
+        {
+        return m_kernel_time;
+        }
+
+    /// Get the number of timed kernel launches.
+    uint64_t getKernelCalls() const
+        {
+        return m_kernel_calls;
+        }
+
+    /// Clear the kernel timing statistics.
+    void resetKernelTime()
+        {
+        m_kernel_time = 0;
+        m_kernel_calls = 0;
+        }
+
 #ifndef __HIPCC__
     /// Get the autotuner parameters as a Python tuple.
     virtual pybind11::tuple getParameterPython()
@@ -132,6 +153,21 @@ class PYBIND11_EXPORT AutotunerBase
     protected:
     /// Descriptive name.
     std::string m_name;
+
+    /// Total GPU time of the timed kernel launches (in seconds).
+    double m_kernel_time = 0;
+
+    /// Number of timed kernel launches.
+    uint64_t m_kernel_calls = 0;
+
+    /// Add the GPU time of one kernel launch.
+    /*! \param time Kernel time in milliseconds.
+     */
+    void addKernelTime(float time)
+        {
+        m_kernel_time += double(time) / 1e3;
+        m_kernel_calls++;
+        }
     };
 
 //! Autotuner for low level GPU kernel parameters
@@ -165,6 +201,24 @@ class PYBIND11_EXPORT AutotunerBase
     scanning. This prevents the optional autotuners from flagging the whole class as not complete
     indefinitely. This is implemented with an INACTIVE state that goes to SCANNING on the first
     call to begin().
+
+    begin() and end() also bracket the launch in a named range for GPU profiling tools (see
+    ProfileRange.h). When ExecutionConfiguration enables kernel timing, every launch is timed with
+    the same events and accumulated in getKernelTime(). Outside of a scan, the time of a launch is
+    read at the next call to begin(), which usually does not have to wait for the GPU.
+
+    When ExecutionConfiguration sets a re-tune threshold, the IDLE state times one in every
+    m_monitor_period launches. The median of m_n_samples of these timings becomes the reference
+    time, and a later median that differs from the reference by more than the threshold restarts
+    the scan. This follows changes in the workload, such as the number of particles or neighbors,
+    at the cost of one synchronization every m_monitor_period launches. Autotuners that synchronize
+    over MPI do not monitor, as the ranks would have to agree to restart the scan.
+
+    The default exhaustive search samples every valid parameter, which takes a long time in
+    multi-dimensional parameter spaces. Call setSearch() to choose a coordinate descent instead.
+    Coordinate descent samples only the parameters that differ from the fastest parameter found so
+    far in one dimension, cycling through the dimensions until a full cycle finds no faster
+    parameter. m_candidates lists the indices in m_parameters sampled by the current sweep.
 */
 template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public AutotunerBase
     {
@@ -192,10 +246,25 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// Start a parameter scan.
     virtual void startScan()
         {
-        m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " starting scan." << std::endl;
         m_current_element = 0;
         m_current_sample = 0;
-        m_current_param = m_parameters[m_current_element];
+
+        // Skip the first scan when the autotuner cache holds a valid parameter.
+        if (!m_cache_checked)
+            {
+            m_cache_checked = true;
+            if (loadFromCache())
+                {
+                return;
+                }
+            }
+
+        m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " starting scan." << std::endl;
+        m_center = 0;
+        m_dimension = 0;
+        m_n_unchanged = 0;
+        initializeSweep();
+        m_current_param = m_parameters[m_candidates[m_current_element]];
 
         if (m_optional)
             {
@@ -216,14 +285,34 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
             }
 
 #ifdef ENABLE_HIP
-        // if we are scanning, record a cuda event - otherwise do nothing
-        if (m_state == SCANNING)
+        // the previous timed launch has usually completed by now
+        if (m_timing_pending)
+            {
+            m_timing_pending = false;
+            hipEventSynchronize(m_stop);
+            float time;
+            hipEventElapsedTime(&time, m_start, m_stop);
+            addKernelTime(time);
+            }
+        m_timing = m_exec_conf->isKernelTimingEnabled();
+
+        // when scanning, monitoring, or timing, record a cuda event - otherwise do nothing
+        if (m_state == IDLE && m_monitor && !m_sync
+            && m_exec_conf->getAutotunerRetuneThreshold() > 0)
+            {
+            m_n_idle_launches++;
+            m_monitoring = (m_n_idle_launches % m_monitor_period == 0);
+            }
+
+        if (m_state == SCANNING || m_monitoring || m_timing)
             {
             hipEventRecord(m_start, 0);
             if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
             }
 #endif
+
+        pushProfileRange(m_name.c_str());
         }
 
     /// Call after kernel launch.
@@ -282,6 +371,7 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         m_current_param = cpp_param;
         m_state = IDLE;
         m_current_sample = 0;
+        m_monitor = false;
 
         m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " setting user-defined parameter "
                                     << formatParam(cpp_param) << std::endl;
@@ -338,9 +428,92 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         m_mode = mode;
         }
 
+    /// Enumeration of search strategies.
+    enum search_Enum
+        {
+        search_exhaustive = 0,    //!< Sample all valid parameters
+        search_coordinate_descent //!< Sample one dimension at a time around the fastest parameter
+        };
+
+    /// Set search strategy
+    /*! \param search Strategy to use when choosing the parameters to sample.
+
+        Restarts a scan in progress.
+     */
+    void setSearch(search_Enum search)
+        {
+        m_search = search;
+        if (m_state != IDLE)
+            {
+            startScan();
+            }
+        }
+
     protected:
     size_t computeOptimalParameterIndex();
 
+    /// Get the key that identifies this autotuner in the autotuner cache.
+    std::string getCacheKey(const AutotunerCache& cache) const
+        {
+        // Hash the parameter space (FNV-1a) so that the cache invalidates entries when the
+        // valid parameters change.
+        uint64_t hash = 14695981039346656037ULL;
+        for (const auto& parameter : m_parameters)
+            {
+            for (auto v : parameter)
+                {
+                hash = (hash ^ v) * 1099511628211ULL;
+                }
+            }
+
+        std::ostringstream s;
+        s << n_dimensions << ":" << m_parameters.size() << ":" << std::hex << hash;
+        return cache.makeKey(m_name, s.str());
+        }
+
+    /// Set the current parameter from the autotuner cache.
+    /*! \returns true when the cache provided a valid parameter.
+     */
+    bool loadFromCache()
+        {
+        auto cache = m_exec_conf->getAutotunerCache();
+        if (!cache)
+            {
+            return false;
+            }
+
+        std::vector<unsigned int> cached;
+        if (!cache->lookup(getCacheKey(*cache), cached) || cached.size() != n_dimensions)
+            {
+            return false;
+            }
+
+        std::array<unsigned int, n_dimensions> parameter;
+        std::copy(cached.begin(), cached.end(), parameter.begin());
+        if (std::find(m_parameters.begin(), m_parameters.end(), parameter) == m_parameters.end())
+            {
+            return false;
+            }
+
+        m_current_param = parameter;
+        m_state = IDLE;
+        startMonitoring();
+        m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " using cached parameter "
+                                    << formatParam(parameter) << std::endl;
+        return true;
+        }
+
+    /// Store the current parameter in the autotuner cache.
+    void saveToCache()
+        {
+        auto cache = m_exec_conf->getAutotunerCache();
+        if (cache)
+            {
+            cache->store(getCacheKey(*cache),
+                         std::vector<unsigned int>(m_current_param.begin(), m_current_param.end()));
+            }
+        }
+
     /// State names
     enum State
         {
@@ -373,6 +546,89 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// Processed (avg, median, or max) time for each parameter.
     std::vector<float> m_sample_center;
 
+    /// Search strategy.
+    search_Enum m_search = search_exhaustive;
+
+    /// Indices of the parameters sampled in the current sweep.
+    std::vector<size_t> m_candidates;
+
+    /// Index of the fastest parameter found by the coordinate descent so far.
+    size_t m_center = 0;
+
+    /// Dimension varied in the current coordinate descent sweep.
+    size_t m_dimension = 0;
+
+    /// Number of consecutive coordinate descent sweeps that left m_center unchanged.
+    size_t m_n_unchanged = 0;
+
+    /// True when the current launch is timed for getKernelTime().
+    bool m_timing = false;
+
+    /// True when the time of the previous launch has not been read yet.
+    bool m_timing_pending = false;
+
+    /// True when the IDLE state monitors the kernel run time.
+    bool m_monitor = false;
+
+    /// True when the current launch is timed by the monitor.
+    bool m_monitoring = false;
+
+    /// Number of launches to skip between monitored launches.
+    unsigned int m_monitor_period = 500;
+
+    /// Number of launches in the IDLE state since the last scan.
+    uint64_t m_n_idle_launches = 0;
+
+    /// Times of the recent monitored launches.
+    std::vector<float> m_monitor_samples;
+
+    /// Median time of the first monitored launches after a scan (0 when not yet measured).
+    float m_reference_time = 0;
+
+    /// Start monitoring the kernel run time with new reference timings.
+    void startMonitoring()
+        {
+        m_monitor = true;
+        m_monitoring = false;
+        m_n_idle_launches = 0;
+        m_monitor_samples.clear();
+        m_reference_time = 0;
+        }
+
+    /// Add a monitored launch time and restart the scan when the run time has changed.
+    void monitor(float time)
+        {
+        m_monitor_samples.push_back(time);
+        if (m_monitor_samples.size() < m_n_samples)
+            {
+            return;
+            }
+
+        size_t n = m_monitor_samples.size() / 2;
+        std::nth_element(m_monitor_samples.begin(),
+                         m_monitor_samples.begin() + n,
+                         m_monitor_samples.end());
+        float median = m_monitor_samples[n];
+        m_monitor_samples.clear();
+
+        if (m_reference_time <= 0)
+            {
+            m_reference_time = median;
+            return;
+            }
+
+        float ratio = median / m_reference_time;
+        float threshold = 1.0f + m_exec_conf->getAutotunerRetuneThreshold();
+        if (ratio > threshold || ratio * threshold < 1.0f)
+            {
+            m_exec_conf->msg->notice(4)
+                << "Autotuner " << m_name << " restarting scan: run time changed from "
+                << m_reference_time << " to " << median << " ms." << std::endl;
+            m_monitor = false;
+            startScan();
+            }
+        }
+
     /// The Execution configuration.
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf;
 
@@ -390,6 +646,72 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// True when this is an optional tuner.
     bool m_optional;
 
+    /// True after the first scan has consulted the autotuner cache.
+    bool m_cache_checked = false;
+
+    /// Choose the candidates for the current sweep.
+    void initializeSweep()
+        {
+        m_candidates.clear();
+        for (size_t i = 0; i < m_parameters.size(); i++)
+            {
+            bool is_candidate = true;
+            if (m_search == search_coordinate_descent)
+                {
+                for (size_t d = 0; d < n_dimensions; d++)
+                    {
+                    if (d != m_dimension && m_parameters[i][d] != m_parameters[m_center][d])
+                        {
+                        is_candidate = false;
+                        }
+                    }
+                }
+
+            if (is_candidate)
+                {
+                m_candidates.push_back(i);
+                }
+            }
+        }
+
+    /// Choose the next sweep after a sweep completes.
+    /*! \param best Index of the fastest parameter in the completed sweep.
+        \returns true when another sweep is needed.
+    */
+    bool nextSweep(size_t best)
+        {
+        if (m_search == search_exhaustive || n_dimensions == 1)
+            {
+            return false;
+            }
+
+        // m_center is now optimal along m_dimension.
+        if (best == m_center)
+            {
+            m_n_unchanged++;
+            }
+        else
+            {
+            m_center = best;
+            m_n_unchanged = 1;
+            }
+
+        while (m_n_unchanged < n_dimensions)
+            {
+            m_dimension = (m_dimension + 1) % n_dimensions;
+            initializeSweep();
+            if (m_candidates.size() > 1)
+                {
+                m_exec_conf->msg->notice(5)
+                    << "Autotuner " << m_name << " sweeping dimension " << m_dimension << " around "
+                    << formatParam(m_parameters[m_center]) << std::endl;
+                return true;
+                }
+            m_n_unchanged++;
+            }
+        return false;
+        }
+
     /// Helper method to initialize multi-dimensional arrays recursively.
     void initializeParameters(
         const std::vector<std::vector<unsigned int>>& dimension_ranges,
@@ -502,22 +824,35 @@ Autotuner<n_dimensions>::Autotuner(
 
 template<size_t n_dimensions> void Autotuner<n_dimensions>::end()
     {
+    popProfileRange();
+
 #ifdef ENABLE_HIP
     // handle timing updates if scanning
     if (m_state == SCANNING)
         {
         hipEventRecord(m_stop, 0);
         hipEventSynchronize(m_stop);
-        hipEventElapsedTime(&m_samples[m_current_element][m_current_sample], m_start, m_stop);
+        float& sample = m_samples[m_candidates[m_current_element]][m_current_sample];
+        hipEventElapsedTime(&sample, m_start, m_stop);
+
+        m_exec_conf->msg->notice(9) << "Autotuner " << m_name << ": t["
+                                    << formatParam(m_current_param) << "," << m_current_sample
+                                    << "] = " << sample << std::endl;
 
-        m_exec_conf->msg->notice(9)
-            << "Autotuner " << m_name << ": t[" << formatParam(m_current_param) << ","
-            << m_current_sample << "] = " << m_samples[m_current_element][m_current_sample]
-            << std::endl;
+        if (m_timing)
+            {
+            addKernelTime(sample);
+            }
 
         if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         }
+    else if (m_timing && !m_monitoring)
+        {
+        // read the time at the next begin() to avoid waiting for the GPU here
+        hipEventRecord(m_stop, 0);
+        m_timing_pending = true;
+        }
 #endif
 
     // Handle state data updates and transitions.
@@ -527,36 +862,65 @@ template<size_t n_dimensions> void Autotuner<n_dimensions>::end()
         m_current_element++;
 
         // If we hit the end of the elements
-        if (m_current_element >= m_parameters.size())
+        if (m_current_element >= m_candidates.size())
             {
             // Move on to the next sample.
             m_current_sample++;
             m_current_element = 0;
 
-            // If this is the last sample, go to the idle state and compute the optimal parameter.
+            // If this is the last sample, start the next sweep or go to the idle state with the
+            // optimal parameter.
             if (m_current_sample >= m_n_samples)
                 {
-                m_state = IDLE;
                 m_current_sample = 0;
-                m_current_param = m_parameters[computeOptimalParameterIndex()];
+                size_t best = computeOptimalParameterIndex();
+                if (nextSweep(best))
+                    {
+                    m_current_param = m_parameters[m_candidates[m_current_element]];
+                    }
+                else
+                    {
+                    m_state = IDLE;
+                    m_current_param = m_parameters[best];
+                    saveToCache();
+                    startMonitoring();
+                    }
                 }
             else
                 {
-                m_current_param = m_parameters[m_current_element];
+                m_current_param = m_parameters[m_candidates[m_current_element]];
                 }
             }
         else
             {
-            m_current_param = m_parameters[m_current_element];
+            m_current_param = m_parameters[m_candidates[m_current_element]];
             }
         }
+
+#ifdef ENABLE_HIP
+    // Handle monitored launches after the state machine, as monitor() may start a new scan.
+    if (m_monitoring)
+        {
+        m_monitoring = false;
+        hipEventRecord(m_stop, 0);
+        hipEventSynchronize(m_stop);
+        float time;
+        hipEventElapsedTime(&time, m_start, m_stop);
+        if (m_timing)
+            {
+            addKernelTime(time);
+            }
+        monitor(time);
+        }
+#endif
     }
 
 /*! \returns The index of the optimal parameter given the current data in m_samples.
 
     computeOptimalParameter computes the median, average, or maximum time among all samples for all
-    elements. It then chooses the fastest time (with the lowest index breaking a tie) and returns
-    the index of the parameter that resulted in that time.
+    candidates in the current sweep. It then chooses the fastest time (with the lowest index
+    breaking a tie) and returns the index in m_parameters of the parameter that resulted in that
+    time.
 */
 template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalParameterIndex()
     {
@@ -573,7 +937,7 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
 
     // Start by computing the summary for each element.
     std::vector<float> v;
-    for (unsigned int i = 0; i < m_parameters.size(); i++)
+    for (size_t i : m_candidates)
         {
         v = m_samples[i];
 #ifdef ENABLE_MPI
@@ -630,10 +994,11 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
     if (is_root)
         {
         // Now find the minimum and maximum times in the medians.
-        float min_value = m_sample_center[0];
-        float max_value = m_sample_center[0];
+        min_idx = m_candidates[0];
+        float min_value = m_sample_center[min_idx];
+        float max_value = m_sample_center[min_idx];
 
-        for (size_t i = 1; i < m_parameters.size(); i++)
+        for (size_t i : m_candidates)
             {
             if (m_sample_center[i] < min_value)
                 {
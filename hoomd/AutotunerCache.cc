@@ -0,0 +1,184 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file AutotunerCache.cc
+    \brief Defines the AutotunerCache class
+*/
+
+#include "AutotunerCache.h"
+#include "Filesystem.h"
+#include "HOOMDVersion.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace hoomd
+    {
+/*! \param filename Name of the cache file
+    \param device Description of the active device
+    \param mpi_config MPI configuration
+    \param msg Messenger
+*/
+AutotunerCache::AutotunerCache(const std::string& filename,
+                               const std::string& device,
+                               std::shared_ptr<MPIConfiguration> mpi_config,
+                               std::shared_ptr<Messenger> msg)
+    : m_filename(filename), m_device(device), m_mpi_config(mpi_config), m_msg(msg)
+    {
+    std::string contents;
+    if (m_mpi_config->isRoot() && filesystem::exists(m_filename))
+        {
+        std::ifstream f(m_filename);
+        if (!f.good())
+            {
+            throw std::runtime_error("Unable to open autotuner cache: " + m_filename);
+            }
+        std::ostringstream s;
+        s << f.rdbuf();
+        contents = s.str();
+        }
+
+#ifdef ENABLE_MPI
+    bcast(contents, 0, m_mpi_config->getCommunicator());
+#endif
+
+    parse(contents);
+    m_msg->notice(3) << "Loaded " << m_entries.size() << " autotuner parameters from "
+                     << m_filename << std::endl;
+    }
+
+/*! \param name Autotuner name
+    \param signature Signature of the autotuner's parameter space
+*/
+std::string AutotunerCache::makeKey(const std::string& name, const std::string& signature) const
+    {
+    std::ostringstream s;
+    s << HOOMD_VERSION << "|" << m_device << "|" << name << "|" << signature << "|"
+      << m_problem_size_bucket;
+    return s.str();
+    }
+
+/*! \param key Cache key
+    \param parameter Set to the cached parameter when found
+    \returns true when the key is in the cache
+*/
+bool AutotunerCache::lookup(const std::string& key, std::vector<unsigned int>& parameter) const
+    {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        {
+        return false;
+        }
+
+    parameter = it->second;
+    return true;
+    }
+
+/*! \param key Cache key
+    \param parameter Parameter to store
+*/
+void AutotunerCache::store(const std::string& key, const std::vector<unsigned int>& parameter)
+    {
+    auto it = m_entries.find(key);
+    if (it != m_entries.end() && it->second == parameter)
+        {
+        return;
+        }
+
+    m_entries[key] = parameter;
+    save();
+    }
+
+void AutotunerCache::parse(const std::string& contents)
+    {
+    std::istringstream lines(contents);
+    std::string line;
+    while (std::getline(lines, line))
+        {
+        if (line.empty() || line[0] == '#')
+            {
+            continue;
+            }
+
+        size_t tab = line.rfind('\t');
+        if (tab == std::string::npos)
+            {
+            m_msg->warning() << "Ignoring invalid line in autotuner cache " << m_filename
+                             << std::endl;
+            continue;
+            }
+
+        std::vector<unsigned int> parameter;
+        std::istringstream values(line.substr(tab + 1));
+        std::string value;
+        bool valid = true;
+        while (std::getline(values, value, ','))
+            {
+            try
+                {
+                parameter.push_back((unsigned int)std::stoul(value));
+                }
+            catch (const std::exception&)
+                {
+                valid = false;
+                break;
+                }
+            }
+
+        if (valid && !parameter.empty())
+            {
+            m_entries[line.substr(0, tab)] = parameter;
+            }
+        else
+            {
+            m_msg->warning() << "Ignoring invalid line in autotuner cache " << m_filename
+                             << std::endl;
+            }
+        }
+    }
+
+void AutotunerCache::save()
+    {
+    if (!m_mpi_config->isRoot() || m_mpi_config->getPartition() != 0)
+        {
+        return;
+        }
+
+    std::string tmp_filename = m_filename + ".tmp";
+        {
+        std::ofstream f(tmp_filename);
+        if (!f.good())
+            {
+            m_msg->warning() << "Unable to write autotuner cache " << tmp_filename << std::endl;
+            return;
+            }
+
+        f << "# HOOMD-blue autotuner cache" << std::endl;
+        for (const auto& entry : m_entries)
+            {
+            f << entry.first << "\t";
+            for (size_t i = 0; i < entry.second.size(); i++)
+                {
+                if (i != 0)
+                    {
+                    f << ",";
+                    }
+                f << entry.second[i];
+                }
+            f << std::endl;
+            }
+        }
+
+    if (std::rename(tmp_filename.c_str(), m_filename.c_str()) != 0)
+        {
+        m_msg->warning() << "Unable to write autotuner cache " << m_filename << std::endl;
+        }
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,111 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file AutotunerCache.h
+    \brief Declares the AutotunerCache class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "MPIConfiguration.h"
+#include "Messenger.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+/// Persistent on-disk store of autotuner parameters
+/*! AutotunerCache maps a key to the optimal parameter found by a previous autotuner scan. The key
+    combines the HOOMD-blue version, the active device description, the autotuner name, a signature
+    of the autotuner's parameter space, and a problem size bucket. Autotuners look up their key in
+    startScan() and skip the scan when the cache holds a valid parameter. Autotuners store their
+    result when a scan completes.
+
+    The problem size bucket is the number of bits needed to represent the global number of
+    particles, so systems whose sizes differ by less than a factor of two usually share cache
+    entries. System sets the problem size when it is constructed and at the start of every run.
+
+    The cache file is a text file with one entry per line: the key, a tab, and a comma-separated
+    list of parameter values. The root rank of the partition reads the file on construction and
+    broadcasts its contents to all ranks, so all ranks make the same decisions. Only the root rank
+    of partition 0 writes to the file. It rewrites the whole file after each new entry by writing
+    to a temporary file and renaming it over the original.
+*/
+class PYBIND11_EXPORT AutotunerCache
+    {
+    public:
+    /// Construct the cache and load an existing file.
+    AutotunerCache(const std::string& filename,
+                   const std::string& device,
+                   std::shared_ptr<MPIConfiguration> mpi_config,
+                   std::shared_ptr<Messenger> msg);
+
+    /// Get the cache filename.
+    const std::string& getFilename() const
+        {
+        return m_filename;
+        }
+
+    /// Set the problem size used to compute the bucket in the key.
+    void setProblemSize(uint64_t problem_size)
+        {
+        m_problem_size_bucket = 0;
+        while (problem_size > 0)
+            {
+            m_problem_size_bucket++;
+            problem_size >>= 1;
+            }
+        }
+
+    /// Build the cache key for an autotuner.
+    std::string makeKey(const std::string& name, const std::string& signature) const;
+
+    /// Look up a cached parameter.
+    bool lookup(const std::string& key, std::vector<unsigned int>& parameter) const;
+
+    /// Store a parameter in the cache and write the cache file.
+    void store(const std::string& key, const std::vector<unsigned int>& parameter);
+
+    /// Get the number of entries in the cache.
+    size_t size() const
+        {
+        return m_entries.size();
+        }
+
+    private:
+    /// Parse the cache file contents.
+    void parse(const std::string& contents);
+
+    /// Write all entries to the cache file.
+    void save();
+
+    /// The cache filename.
+    std::string m_filename;
+
+    /// Description of the active device.
+    std::string m_device;
+
+    /// The MPI configuration.
+    std::shared_ptr<MPIConfiguration> m_mpi_config;
+
+    /// The messenger.
+    std::shared_ptr<Messenger> m_msg;
+
+    /// Current problem size bucket.
+    unsigned int m_problem_size_bucket = 0;
+
+    /// Cached entries.
+    std::map<std::string, std::vector<unsigned int>> m_entries;
+    };
+
+    } // end namespace hoomd
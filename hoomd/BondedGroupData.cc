@@ -11,6 +11,9 @@
 
 #include <pybind11/numpy.h>
 
+#include <algorithm>
+#include <numeric>
+
 #ifdef ENABLE_HIP
 #include "BondedGroupData.cuh"
 #include "CachedAllocator.h"
@@ -62,9 +65,9 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
 
     // connect to particle sort signal
     m_pdata->getParticleSortSignal()
-        .template connect<BondedGroupData<group_size, Group, name, has_type_mapping>,
-                          &BondedGroupData<group_size, Group, name, has_type_mapping>::setDirty>(
-            this);
+        .template connect<
+            BondedGroupData<group_size, Group, name, has_type_mapping>,
+            &BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort>(this);
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
@@ -104,9 +107,9 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
 
     // connect to particle sort signal
     m_pdata->getParticleSortSignal()
-        .template connect<BondedGroupData<group_size, Group, name, has_type_mapping>,
-                          &BondedGroupData<group_size, Group, name, has_type_mapping>::setDirty>(
-            this);
+        .template connect<
+            BondedGroupData<group_size, Group, name, has_type_mapping>,
+            &BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort>(this);
 
     // initialize from snapshot
     initializeFromSnapshot(snapshot);
@@ -128,9 +131,9 @@ template<unsigned int group_size, typename Group, const char* name, bool has_typ
 BondedGroupData<group_size, Group, name, has_type_mapping>::~BondedGroupData()
     {
     m_pdata->getParticleSortSignal()
-        .template disconnect<BondedGroupData<group_size, Group, name, has_type_mapping>,
-                             &BondedGroupData<group_size, Group, name, has_type_mapping>::setDirty>(
-            this);
+        .template disconnect<
+            BondedGroupData<group_size, Group, name, has_type_mapping>,
+            &BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort>(this);
 #ifdef ENABLE_MPI
     m_pdata->getSingleParticleMoveSignal()
         .template disconnect<
@@ -880,6 +883,198 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         }
     }
 
+/*! The local groups follow the new particle order (see sortGroups()), so that kernels that loop
+    over the groups access the particle data nearly sequentially. When the group order changes, the
+    table is rebuilt on the next access and the subscribers of the group reorder signal are
+    notified.
+
+    Otherwise, a sort that provides its permutation (see ParticleData::getSortOrder()) only moves
+    the rows of the table and renames the member indices, so a current table is remapped on the
+    host instead of rebuilt. The table is rebuilt on the next access after any other change.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort()
+    {
+    if (sortGroups())
+        {
+        notifyGroupReorder();
+        return;
+        }
+
+    const unsigned int* order = m_pdata->getSortOrder();
+    const unsigned int n_ptl = m_pdata->getN() + m_pdata->getNGhosts();
+    if (m_groups_dirty || order == nullptr || m_exec_conf->isCUDAEnabled()
+        || m_gpu_table_indexer.getW() != n_ptl || m_gpu_n_groups.getNumElements() != n_ptl)
+        {
+        m_groups_dirty = true;
+        return;
+        }
+
+    remapGPUTable(order);
+    }
+
+/*! Stable sort of the local groups by the index of their first member particle. Groups whose first
+    member is not local move to the end of the local groups, and the ghost groups keep their
+    positions.
+
+    \returns true when the order of the groups changed
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+bool BondedGroupData<group_size, Group, name, has_type_mapping>::sortGroups()
+    {
+    const unsigned int n_groups = m_n_groups;
+    if (n_groups < 2)
+        {
+        return false;
+        }
+
+    std::vector<unsigned int> key(n_groups);
+        {
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+
+        for (unsigned int group_idx = 0; group_idx < n_groups; group_idx++)
+            {
+            key[group_idx] = h_rtag.data[h_groups.data[group_idx].tag[0]];
+            }
+        }
+
+    // a static topology is already in order after the first sort
+    if (std::is_sorted(key.begin(), key.end()))
+        {
+        return false;
+        }
+
+    std::vector<unsigned int> order(n_groups);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&key](unsigned int a, unsigned int b) { return key[a] < key[b]; });
+
+        {
+        const size_t n_total = m_groups.size();
+
+        ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+        ArrayHandle<typeval_t> h_typeval(m_group_typeval, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_group_tag, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_group_rtag,
+                                         access_location::host,
+                                         access_mode::readwrite);
+
+        ArrayHandle<members_t> h_groups_alt(getAltMembersArray(),
+                                            access_location::host,
+                                            access_mode::overwrite);
+        ArrayHandle<typeval_t> h_typeval_alt(getAltTypeValArray(),
+                                             access_location::host,
+                                             access_mode::overwrite);
+        ArrayHandle<unsigned int> h_tag_alt(getAltTags(),
+                                            access_location::host,
+                                            access_mode::overwrite);
+
+        for (unsigned int group_idx = 0; group_idx < n_groups; group_idx++)
+            {
+            const unsigned int old_idx = order[group_idx];
+            h_groups_alt.data[group_idx] = h_groups.data[old_idx];
+            h_typeval_alt.data[group_idx] = h_typeval.data[old_idx];
+            h_tag_alt.data[group_idx] = h_tag.data[old_idx];
+            h_rtag.data[h_tag.data[old_idx]] = group_idx;
+            }
+
+        std::copy(h_groups.data + n_groups, h_groups.data + n_total, h_groups_alt.data + n_groups);
+        std::copy(h_typeval.data + n_groups,
+                  h_typeval.data + n_total,
+                  h_typeval_alt.data + n_groups);
+        std::copy(h_tag.data + n_groups, h_tag.data + n_total, h_tag_alt.data + n_groups);
+        }
+
+    swapMemberArrays();
+    swapTypeArrays();
+    swapTagArrays();
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+            {
+            const size_t n_total = m_group_ranks.size();
+
+            ArrayHandle<ranks_t> h_ranks(m_group_ranks, access_location::host, access_mode::read);
+            ArrayHandle<ranks_t> h_ranks_alt(getAltRanksArray(),
+                                             access_location::host,
+                                             access_mode::overwrite);
+
+            for (unsigned int group_idx = 0; group_idx < n_groups; group_idx++)
+                {
+                h_ranks_alt.data[group_idx] = h_ranks.data[order[group_idx]];
+                }
+
+            std::copy(h_ranks.data + n_groups, h_ranks.data + n_total, h_ranks_alt.data + n_groups);
+            }
+
+        swapRankArrays();
+        }
+#endif
+
+    return true;
+    }
+
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::remapGPUTable(
+    const unsigned int* order)
+    {
+    const unsigned int N = m_pdata->getN();
+    const unsigned int width = m_gpu_table_indexer.getW();
+
+    // new index of every local particle, ghosts keep their indices
+    std::vector<unsigned int> new_idx(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        new_idx[order[i]] = i;
+        }
+
+    ArrayHandle<unsigned int> h_n_groups(m_gpu_n_groups,
+                                         access_location::host,
+                                         access_mode::readwrite);
+    ArrayHandle<members_t> h_gpu_table(m_gpu_table, access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_gpu_pos_table(m_gpu_pos_table,
+                                              access_location::host,
+                                              access_mode::readwrite);
+
+    const std::vector<unsigned int> old_n_groups(h_n_groups.data, h_n_groups.data + width);
+    const std::vector<members_t> old_table(h_gpu_table.data,
+                                           h_gpu_table.data
+                                               + m_gpu_table_indexer.getNumElements());
+    const std::vector<unsigned int> old_pos_table(h_gpu_pos_table.data,
+                                                  h_gpu_pos_table.data
+                                                      + m_gpu_table_indexer.getNumElements());
+
+    for (unsigned int i = 0; i < width; i++)
+        {
+        const unsigned int old_i = (i < N) ? order[i] : i;
+        const unsigned int n = old_n_groups[old_i];
+        h_n_groups.data[i] = n;
+
+        for (unsigned int k = 0; k < n; k++)
+            {
+            members_t h = old_table[m_gpu_table_indexer(old_i, k)];
+
+            // the last element is the type or group index
+            for (unsigned int j = 0; j < group_size - 1; j++)
+                {
+                if (h.idx[j] < N)
+                    {
+                    h.idx[j] = new_idx[h.idx[j]];
+                    }
+                }
+
+            h_gpu_table.data[m_gpu_table_indexer(i, k)] = h;
+            h_gpu_pos_table.data[m_gpu_table_indexer(i, k)]
+                = old_pos_table[m_gpu_table_indexer(old_i, k)];
+            }
+        }
+    }
+
 #ifdef ENABLE_HIP
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTableGPU()
@@ -1134,6 +1329,99 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::takeSnapshot(Snapsho
     return index;
     }
 
+/*! \param checkpoint Checkpoint to write
+
+    Copies the local groups and the reverse tag lookup into \a checkpoint without communication.
+    Ghost groups are not stored, the communicator recreates them.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::takeCheckpoint(
+    Checkpoint& checkpoint) const
+    {
+    const unsigned int n_groups = getN();
+
+    ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_group_typeval, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_group_tag, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_group_rtag, access_location::host, access_mode::read);
+
+    checkpoint.groups.assign(h_groups.data, h_groups.data + n_groups);
+    checkpoint.typeval.assign(h_typeval.data, h_typeval.data + n_groups);
+    checkpoint.tag.assign(h_tag.data, h_tag.data + n_groups);
+    checkpoint.rtag.assign(h_rtag.data, h_rtag.data + m_group_rtag.size());
+
+#ifdef ENABLE_MPI
+    checkpoint.ranks.clear();
+    if (m_pdata->getDomainDecomposition())
+        {
+        ArrayHandle<ranks_t> h_ranks(m_group_ranks, access_location::host, access_mode::read);
+        checkpoint.ranks.assign(h_ranks.data, h_ranks.data + n_groups);
+        }
+#endif
+
+    checkpoint.n_groups = n_groups;
+    checkpoint.nglobal = getNGlobal();
+    checkpoint.valid = true;
+    }
+
+/*! \param checkpoint Checkpoint taken on this rank by takeCheckpoint()
+
+    Replaces the local groups with those in \a checkpoint. Groups must not be added or removed
+    between taking and restoring the checkpoint. Restore the particle data checkpoint taken at the
+    same time first, so that the groups are stored on the ranks that own their members.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::restoreCheckpoint(
+    const Checkpoint& checkpoint)
+    {
+    if (!checkpoint.valid)
+        {
+        throw runtime_error("Cannot restore a checkpoint that has not been taken.");
+        }
+
+    if (checkpoint.nglobal != getNGlobal() || checkpoint.rtag.size() != m_group_rtag.size())
+        {
+        std::ostringstream s;
+        s << "Cannot restore checkpoint, " << name << "s were added or removed since it was taken.";
+        throw runtime_error(s.str());
+        }
+
+    // the local number of groups changes, so remove ghosts
+    removeAllGhostGroups();
+
+    const unsigned int n_groups = checkpoint.n_groups;
+    reallocate(n_groups);
+    m_n_groups = n_groups;
+
+        {
+        ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::overwrite);
+        ArrayHandle<typeval_t> h_typeval(m_group_typeval,
+                                         access_location::host,
+                                         access_mode::overwrite);
+        ArrayHandle<unsigned int> h_tag(m_group_tag, access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_rtag(m_group_rtag,
+                                         access_location::host,
+                                         access_mode::overwrite);
+
+        std::copy(checkpoint.groups.begin(), checkpoint.groups.end(), h_groups.data);
+        std::copy(checkpoint.typeval.begin(), checkpoint.typeval.end(), h_typeval.data);
+        std::copy(checkpoint.tag.begin(), checkpoint.tag.end(), h_tag.data);
+        std::copy(checkpoint.rtag.begin(), checkpoint.rtag.end(), h_rtag.data);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        ArrayHandle<ranks_t> h_ranks(m_group_ranks, access_location::host, access_mode::overwrite);
+        std::copy(checkpoint.ranks.begin(), checkpoint.ranks.end(), h_ranks.data);
+        }
+#endif
+
+    // notify observers
+    m_group_num_change_signal.emit();
+    notifyGroupReorder();
+    }
+
 #ifdef ENABLE_MPI
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::moveParticleGroups(
@@ -254,6 +254,25 @@ class BondedGroupData
         unsigned int size;                     //!< Number of bonds in the snapshot
         };
 
+    //! Copy of the local groups of one rank used to roll back the group data
+    /*! See takeCheckpoint() and restoreCheckpoint(). Like ParticleDataCheckpoint, a checkpoint is
+        only valid on the rank that took it.
+     */
+    struct Checkpoint
+        {
+        unsigned int n_groups = 0; //!< Number of local groups
+        unsigned int nglobal = 0;  //!< Global number of groups
+        bool valid = false;        //!< True when the checkpoint holds group data
+
+        std::vector<members_t> groups;  //!< Members of the local groups
+        std::vector<typeval_t> typeval; //!< Types or constraint values of the local groups
+        std::vector<unsigned int> tag;  //!< Tags of the local groups
+        std::vector<unsigned int> rtag; //!< Reverse lookup of group tags
+#ifdef ENABLE_MPI
+        std::vector<ranks_t> ranks; //!< Ranks of the members of the local groups
+#endif
+        };
+
     //! Constructor for MeshGroupData
     BondedGroupData(std::shared_ptr<ParticleData> pdata);
 
@@ -274,6 +293,12 @@ class BondedGroupData
     //! Take a snapshot
     std::map<unsigned int, unsigned int> takeSnapshot(Snapshot& snapshot) const;
 
+    //! Copy the local groups into a checkpoint
+    void takeCheckpoint(Checkpoint& checkpoint) const;
+
+    //! Restore the local groups from a checkpoint
+    void restoreCheckpoint(const Checkpoint& checkpoint);
+
     //! Get local number of bonded groups
     unsigned int getN() const
         {
@@ -627,6 +652,12 @@ class BondedGroupData
         m_groups_dirty = true;
         }
 
+    //! Reorder the groups and remap the GPU table after a particle sort, or mark it for a rebuild
+    void slotParticleSort();
+
+    //! Sort the local groups by the particle index of their first member
+    bool sortGroups();
+
 #ifdef ENABLE_MPI
     //! Helper function to transfer bonded groups connected to a single particle
     /*! \param tag Tag of particle that moves between domains
@@ -693,6 +724,11 @@ class BondedGroupData
     //! Helper function to rebuild lookup by index table
     virtual void rebuildGPUTable();
 
+    //! Permute the lookup by index table with the order of a particle sort
+    /*! \param order Index i now holds the local particle that was at index order[i]
+     */
+    void remapGPUTable(const unsigned int* order);
+
     //! Resize internal tables
     /*! \param new_size New size of local group tables, new_size = n_local + n_ghost
      */
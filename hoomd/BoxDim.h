@@ -262,6 +262,15 @@ struct
         return m_yz;
         }
 
+    //! Test if all tilt factors are zero
+    /*! Kernels test this once and call the \a orthorhombic specializations of minImage() and
+        wrap(), which skip the tilt factor arithmetic.
+    */
+    HOSTDEVICE bool isOrthorhombic() const
+        {
+        return m_xy == Scalar(0.0) && m_xz == Scalar(0.0) && m_yz == Scalar(0.0);
+        }
+
     //! Compute fractional coordinates, allowing for a ghost layer
     /*! \param v Vector to scale
         \param ghost_width Width of extra ghost padding layer to take into account (along reciprocal
@@ -311,6 +320,17 @@ struct
         \note \a v must not extend more than 1 image beyond the box
     */
     HOSTDEVICE Scalar3 minImage(const Scalar3& v) const
+        {
+        return minImage<false>(v);
+        }
+
+    //! Compute minimum image, optionally without the tilt factor terms
+    /*! \tparam orthorhombic When true, assume that isOrthorhombic() is true
+        \param v Vector to compute
+        \return a vector that is the minimum image vector of \a v, obeying the periodic settings
+        \note \a v must not extend more than 1 image beyond the box
+    */
+    template<bool orthorhombic> HOSTDEVICE Scalar3 minImage(const Scalar3& v) const
         {
         Scalar3 w = v;
         Scalar3 L = getL();
@@ -320,15 +340,19 @@ struct
             {
             Scalar img = slow::rint(w.z * m_Linv.z);
             w.z -= L.z * img;
-            w.y -= L.z * m_yz * img;
-            w.x -= L.z * m_xz * img;
+            if (!orthorhombic)
+                {
+                w.y -= L.z * m_yz * img;
+                w.x -= L.z * m_xz * img;
+                }
             }
 
         if (m_periodic.y)
             {
             Scalar img = slow::rint(w.y * m_Linv.y);
             w.y -= L.y * img;
-            w.x -= L.y * m_xy * img;
+            if (!orthorhombic)
+                w.x -= L.y * m_xy * img;
             }
 
         if (m_periodic.x)
@@ -342,14 +366,20 @@ struct
             if (w.z >= m_hi.z)
                 {
                 w.z -= L.z;
-                w.y -= L.z * m_yz;
-                w.x -= L.z * m_xz;
+                if (!orthorhombic)
+                    {
+                    w.y -= L.z * m_yz;
+                    w.x -= L.z * m_xz;
+                    }
                 }
             else if (w.z < m_lo.z)
                 {
                 w.z += L.z;
-                w.y += L.z * m_yz;
-                w.x += L.z * m_xz;
+                if (!orthorhombic)
+                    {
+                    w.y += L.z * m_yz;
+                    w.x += L.z * m_xz;
+                    }
                 }
             }
 
@@ -359,13 +389,15 @@ struct
                 {
                 int i = int(w.y * m_Linv.y + Scalar(0.5));
                 w.y -= (Scalar)i * L.y;
-                w.x -= (Scalar)i * L.y * m_xy;
+                if (!orthorhombic)
+                    w.x -= (Scalar)i * L.y * m_xy;
                 }
             else if (w.y < m_lo.y)
                 {
                 int i = int(-w.y * m_Linv.y + Scalar(0.5));
                 w.y += (Scalar)i * L.y;
-                w.x += (Scalar)i * L.y * m_xy;
+                if (!orthorhombic)
+                    w.x += (Scalar)i * L.y * m_xy;
                 }
             }
 
@@ -393,6 +425,12 @@ struct
         return vec3<Scalar>(minImage(vec_to_scalar3(v)));
         }
 
+    //! Minimum image using vec3s, optionally without the tilt factor terms
+    template<bool orthorhombic> HOSTDEVICE vec3<Scalar> minImage(const vec3<Scalar>& v) const
+        {
+        return vec3<Scalar>(minImage<orthorhombic>(vec_to_scalar3(v)));
+        }
+
     //! Wrap a vector back into the box
     /*! \param w Vector to wrap, updated to the minimum image obeying the periodic settings
         \param img Image of the vector, updated to reflect the new image
@@ -400,6 +438,18 @@ struct
         \post \a img and \a v are updated appropriately
         \note \a v must not extend more than 1 image beyond the box
     */
+    HOSTDEVICE void wrap(Scalar3& w, int3& img, char3 flags = make_char3(0, 0, 0)) const
+        {
+        wrap<false>(w, img, flags);
+        }
+
+    //! Wrap a vector back into the box, optionally without the tilt factor terms
+    /*! \tparam orthorhombic When true, assume that isOrthorhombic() is true
+        \param w Vector to wrap, updated to the minimum image obeying the periodic settings
+        \param img Image of the vector, updated to reflect the new image
+        \param flags Vector of flags to force wrapping along certain directions
+    */
+    template<bool orthorhombic>
     HOSTDEVICE void wrap(Scalar3& w, int3& img, char3 flags = make_char3(0, 0, 0)) const
         {
         Scalar3 L = getL();
@@ -420,7 +470,9 @@ struct
 
         if (m_periodic.x)
             {
-            Scalar tilt_x = (m_xz - m_xy * m_yz) * (w.z - origin.z) + m_xy * (w.y - origin.y);
+            Scalar tilt_x = orthorhombic ? Scalar(0.0)
+                                         : (m_xz - m_xy * m_yz) * (w.z - origin.z)
+                                               + m_xy * (w.y - origin.y);
             if (((w.x >= m_hi.x + tilt_x) && !flags.x) || flags.x == 1)
                 {
                 w.x -= L.x;
@@ -435,17 +487,19 @@ struct
 
         if (m_periodic.y)
             {
-            Scalar tilt_y = m_yz * (w.z - origin.z);
+            Scalar tilt_y = orthorhombic ? Scalar(0.0) : m_yz * (w.z - origin.z);
             if (((w.y >= m_hi.y + tilt_y) && !flags.y) || flags.y == 1)
                 {
                 w.y -= L.y;
-                w.x -= L.y * m_xy;
+                if (!orthorhombic)
+                    w.x -= L.y * m_xy;
                 img.y++;
                 }
             else if (((w.y < m_lo.y + tilt_y) && !flags.y) || flags.y == -1)
                 {
                 w.y += L.y;
-                w.x += L.y * m_xy;
+                if (!orthorhombic)
+                    w.x += L.y * m_xy;
                 img.y--;
                 }
             }
@@ -455,15 +509,21 @@ struct
             if (((w.z >= m_hi.z) && !flags.z) || flags.z == 1)
                 {
                 w.z -= L.z;
-                w.y -= L.z * m_yz;
-                w.x -= L.z * m_xz;
+                if (!orthorhombic)
+                    {
+                    w.y -= L.z * m_yz;
+                    w.x -= L.z * m_xz;
+                    }
                 img.z++;
                 }
             else if (((w.z < m_lo.z) && !flags.z) || flags.z == -1)
                 {
                 w.z += L.z;
-                w.y += L.z * m_yz;
-                w.x += L.z * m_xz;
+                if (!orthorhombic)
+                    {
+                    w.y += L.z * m_yz;
+                    w.x += L.z * m_xz;
+                    }
                 img.z--;
                 }
             }
@@ -14,8 +14,10 @@
 #include <hip/hip_runtime.h>
 
 #include <cassert>
+#include <cstdint>
 #include <map>
 #include <stdexcept>
+#include <string>
 
 //! Need to define an error checking macro that can be used in .cu files
 #define CHECK_CUDA()                                                         \
@@ -34,24 +36,67 @@
             }                                                                \
         }
 
+//! Stream-ordered allocation requires CUDA 11.2 or HIP 5.2
+#if (defined(__HIP_PLATFORM_NVCC__) && CUDART_VERSION >= 11020)                                   \
+    || (defined(__HIP_PLATFORM_HCC__) && HIP_VERSION >= 50200000)
+#define HOOMD_STREAM_ORDERED_ALLOCATION
+#endif
+
 namespace hoomd
     {
 //! CachedAllocator: a simple allocator for caching allocation requests
+/*! Device, managed, and pinned host allocators keep freed blocks in a cache and reuse them for
+    later requests within a relative tolerance of the block size. Allocating a new block
+    synchronizes the device.
+
+    The stream-ordered allocator calls hipMallocAsync and hipFreeAsync on the given stream instead.
+    The device's default memory pool caches the freed blocks (up to max_cached_bytes), so temporary
+    allocations neither synchronize the device nor wait for kernels on other streams. Devices and
+    runtimes without memory pool support fall back to the cached device allocator.
+*/
 class __attribute__((visibility("default"))) CachedAllocator
     {
     public:
     // needed by thrust
     typedef char value_type;
 
+    //! Kinds of memory provided by the allocator
+    enum MemoryKind
+        {
+        DEVICE,        //!< Device memory from hipMalloc
+        MANAGED,       //!< Unified memory from hipMallocManaged
+        PINNED_HOST,   //!< Page-locked host memory from hipHostMalloc
+        STREAM_ORDERED //!< Device memory from hipMallocAsync
+        };
+
+    //! Constructor
+    /*  \param kind Kind of memory to allocate
+     *   \param max_cached_bytes Maximum size of cache
+     *   \param cache_reltol Relative tolerance for cache hits
+     *   \param stream Stream to order allocations on (STREAM_ORDERED only)
+     */
+    CachedAllocator(MemoryKind kind,
+                    size_t max_cached_bytes = 100u * 1024u * 1024u,
+                    float cache_reltol = 0.1f,
+                    hipStream_t stream = 0)
+        : m_kind(kind), m_num_bytes_tot(0), m_max_cached_bytes(max_cached_bytes),
+          m_cache_reltol(cache_reltol), m_stream(stream)
+        {
+        if (m_kind == STREAM_ORDERED && !initStreamOrdered())
+            {
+            m_kind = DEVICE;
+            }
+        }
+
     //! Constructor
-    /*  \param max_cached_bytes Maximum size of cache
+    /*  \param managed True to allocate unified memory, false to allocate device memory
+     *   \param max_cached_bytes Maximum size of cache
      *   \param cache_reltol Relative tolerance for cache hits
      */
     CachedAllocator(bool managed,
-                    unsigned int max_cached_bytes = 100u * 1024u * 1024u,
+                    size_t max_cached_bytes = 100u * 1024u * 1024u,
                     float cache_reltol = 0.1f)
-        : m_managed(managed), m_num_bytes_tot(0), m_max_cached_bytes(max_cached_bytes),
-          m_cache_reltol(cache_reltol)
+        : CachedAllocator(managed ? MANAGED : DEVICE, max_cached_bytes, cache_reltol)
         {
         }
 
@@ -62,9 +107,21 @@ class __attribute__((visibility("default"))) CachedAllocator
     CachedAllocator& operator=(const CachedAllocator&&) = delete;
 
     //! Set maximum cache size
-    void setMaxCachedBytes(unsigned int max_cached_bytes)
+    void setMaxCachedBytes(size_t max_cached_bytes)
         {
         m_max_cached_bytes = max_cached_bytes;
+        if (m_kind == STREAM_ORDERED)
+            {
+            setReleaseThreshold();
+            }
+        }
+
+    //! Get the kind of memory provided by the allocator
+    /*! STREAM_ORDERED allocators report DEVICE when the device does not support memory pools.
+     */
+    MemoryKind getMemoryKind() const
+        {
+        return m_kind;
         }
 
     //! Destructor
@@ -92,6 +149,15 @@ class __attribute__((visibility("default"))) CachedAllocator
         if (ptr == NULL)
             return;
 
+#ifdef HOOMD_STREAM_ORDERED_ALLOCATION
+        if (m_kind == STREAM_ORDERED)
+            {
+            // the memory pool reuses the block once the work queued on m_stream completes
+            hipFreeAsync(ptr, m_stream);
+            return;
+            }
+#endif
+
         // erase the allocated block from the allocated blocks map
         allocated_blocks_type::iterator iter = m_allocated_blocks.find(ptr);
         assert(iter != m_allocated_blocks.end());
@@ -106,15 +172,67 @@ class __attribute__((visibility("default"))) CachedAllocator
     typedef std::multimap<std::ptrdiff_t, char*> free_blocks_type;
     typedef std::map<char*, std::ptrdiff_t> allocated_blocks_type;
 
-    bool m_managed; //! True if we use unified memory
+    MemoryKind m_kind; //! Kind of memory to allocate
 
     size_t m_num_bytes_tot;
     size_t m_max_cached_bytes;
     float m_cache_reltol;
+    hipStream_t m_stream; //! Stream that orders STREAM_ORDERED allocations
 
     free_blocks_type m_free_blocks;
     allocated_blocks_type m_allocated_blocks;
 
+    //! Check for memory pool support and set the release threshold
+    /*! \returns true when stream-ordered allocation is available
+     */
+    bool initStreamOrdered()
+        {
+#ifdef HOOMD_STREAM_ORDERED_ALLOCATION
+        int device = 0;
+        int supported = 0;
+        if (hipGetDevice(&device) != hipSuccess
+            || hipDeviceGetAttribute(&supported, hipDeviceAttributeMemoryPoolsSupported, device)
+                   != hipSuccess)
+            {
+            // clear the error state
+            hipGetLastError();
+            return false;
+            }
+
+        if (!supported)
+            {
+            return false;
+            }
+
+        setReleaseThreshold();
+        return true;
+#else
+        return false;
+#endif
+        }
+
+    //! Let the default memory pool keep up to m_max_cached_bytes of freed memory
+    void setReleaseThreshold()
+        {
+#ifdef HOOMD_STREAM_ORDERED_ALLOCATION
+        int device = 0;
+        hipMemPool_t pool;
+        hipGetDevice(&device);
+        hipDeviceGetDefaultMemPool(&pool, device);
+        uint64_t threshold = m_max_cached_bytes;
+        hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold);
+#endif
+        }
+
+    //! Free a block with the deallocator that matches m_kind
+    void freeBlock(char* ptr)
+        {
+        if (m_kind == PINNED_HOST)
+            hipHostFree((void*)ptr);
+        else
+            hipFree((void*)ptr);
+        }
+
     //! Free all allocated blocks
     void free_all()
         {
@@ -124,14 +242,14 @@ class __attribute__((visibility("default"))) CachedAllocator
         // deallocate all outstanding blocks in both lists
         for (free_blocks_type::iterator i = m_free_blocks.begin(); i != m_free_blocks.end(); ++i)
             {
-            hipFree((void*)i->second);
+            freeBlock(i->second);
             }
 
         for (allocated_blocks_type::iterator i = m_allocated_blocks.begin();
              i != m_allocated_blocks.end();
              ++i)
             {
-            hipFree((void*)i->first);
+            freeBlock(i->first);
             }
         }
     };
@@ -172,6 +290,20 @@ template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
     if (!num_bytes)
         return (T*)NULL;
 
+#ifdef HOOMD_STREAM_ORDERED_ALLOCATION
+    if (m_kind == STREAM_ORDERED)
+        {
+        // allocate without synchronizing, the memory pool caches freed blocks
+        hipError_t err = hipMallocAsync((void**)&result, num_bytes, m_stream);
+        if (err != hipSuccess)
+            {
+            throw std::runtime_error("CUDA Error in CachedAllocator "
+                                     + std::string(hipGetErrorString(err)));
+            }
+        return (T*)result;
+        }
+#endif
+
     size_t num_allocated_bytes = num_bytes;
 
     // search the cache for a free block
@@ -199,8 +331,10 @@ template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
         //        m_exec_conf->msg->notice(10) << "CachedAllocator: no free block found;"
         //            << " allocating " << float(num_bytes)/1024.0f/1024.0f << " MB" << std::endl;
 
-        if (m_managed)
+        if (m_kind == MANAGED)
             hipMallocManaged((void**)&result, num_bytes);
+        else if (m_kind == PINNED_HOST)
+            hipHostMalloc((void**)&result, num_bytes, hipHostMallocDefault);
         else
             hipMalloc((void**)&result, num_bytes);
         CHECK_CUDA();
@@ -216,7 +350,7 @@ template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
             //                << "reached; removing unused block ("
             //                << float(i->first)/1024.0f/1024.0f << " MB)" << std::endl;
 
-            hipFree((void*)i->second);
+            freeBlock(i->second);
 
             CHECK_CUDA();
             m_num_bytes_tot -= i->first;
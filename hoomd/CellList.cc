@@ -19,7 +19,8 @@ namespace hoomd
 CellList::CellList(std::shared_ptr<SystemDefinition> sysdef)
     : Compute(sysdef), m_nominal_width(Scalar(1.0)), m_radius(1), m_compute_xyzf(true),
       m_compute_type_body(false), m_compute_orientation(false), m_compute_idx(false),
-      m_flag_charge(false), m_flag_type(false), m_sort_cell_list(false), m_compute_adj_list(true)
+      m_flag_charge(false), m_flag_type(false), m_sort_cell_list(false), m_compute_adj_list(true),
+      m_sparse(false), m_n_occupied_cells(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing CellList" << endl;
 
@@ -245,6 +246,36 @@ void CellList::initializeMemory()
 
     // initialize indexers
     m_cell_indexer = Index3D(m_dim.x, m_dim.y, m_dim.z);
+
+    if (m_sparse)
+        {
+        // the dense arrays are not needed, discard them
+        m_cell_list_indexer = Index2D();
+        m_cell_adj_indexer = Index2D();
+        GPUArray<unsigned int> cell_size;
+        m_cell_size.swap(cell_size);
+        GPUArray<unsigned int> cell_adj;
+        m_cell_adj.swap(cell_adj);
+        GPUArray<Scalar4> xyzf;
+        m_xyzf.swap(xyzf);
+        GPUArray<uint2> type_body;
+        m_type_body.swap(type_body);
+        GPUArray<Scalar4> orientation;
+        m_orientation.swap(orientation);
+        GPUArray<unsigned int> idx;
+        m_idx.swap(idx);
+
+        allocateSparse(m_pdata->getN() + m_pdata->getNGhosts());
+        return;
+        }
+
+    // the sparse arrays are not needed, discard them
+    GPUArray<unsigned int> occupied_cells;
+    m_occupied_cells.swap(occupied_cells);
+    GPUArray<unsigned int> occupied_cell_start;
+    m_occupied_cell_start.swap(occupied_cell_start);
+    m_n_occupied_cells = 0;
+
     m_cell_list_indexer = Index2D(m_Nmax, m_cell_indexer.getNumElements());
 
     // allocate memory
@@ -337,6 +368,47 @@ void CellList::initializeMemory()
         initializeCellAdj();
     }
 
+/*! \param n_entries Number of entries to allocate room for
+
+    The per particle arrays are sized for all local and ghost particles. They are only replaced
+    when they are too small, and are allocated with at least one element.
+*/
+void CellList::allocateSparse(unsigned int n_entries)
+    {
+    n_entries = std::max(n_entries, 1u);
+    if (!m_occupied_cells.isNull() && m_occupied_cells.getNumElements() >= n_entries)
+        return;
+
+    GPUArray<unsigned int> occupied_cells(n_entries, m_exec_conf);
+    m_occupied_cells.swap(occupied_cells);
+    GPUArray<unsigned int> occupied_cell_start(n_entries + 1, m_exec_conf);
+    m_occupied_cell_start.swap(occupied_cell_start);
+
+    if (m_compute_xyzf)
+        {
+        GPUArray<Scalar4> xyzf(n_entries, m_exec_conf);
+        m_xyzf.swap(xyzf);
+        }
+
+    if (m_compute_type_body)
+        {
+        GPUArray<uint2> type_body(n_entries, m_exec_conf);
+        m_type_body.swap(type_body);
+        }
+
+    if (m_compute_orientation)
+        {
+        GPUArray<Scalar4> orientation(n_entries, m_exec_conf);
+        m_orientation.swap(orientation);
+        }
+
+    if (m_compute_idx)
+        {
+        GPUArray<unsigned int> idx(n_entries, m_exec_conf);
+        m_idx.swap(idx);
+        }
+    }
+
 void CellList::initializeCellAdj()
     {
     ArrayHandle<unsigned int> h_cell_adj(m_cell_adj, access_location::host, access_mode::overwrite);
@@ -395,8 +467,22 @@ void CellList::initializeCellAdj()
                 }
     }
 
+/*! Binning runs on the thread pool in two passes over contiguous particle ranges. The first pass
+    finds the bin of each particle and counts the particles each thread puts in each cell. An
+    exclusive prefix sum over the threads gives each thread its first slot in every cell. The
+    second pass stores the entries. Cell members appear in particle index order, as in a serial
+    build, independent of the number of threads.
+
+    In sparse mode, the binning is serial: it sorts the keys (cell, particle index) of the binned
+    particles and stores the entries in key order, starting a new occupied cell at each change of
+    the cell index.
+*/
 void CellList::computeCellList()
     {
+    // the number of ghosts may have grown since the sparse arrays were allocated
+    if (m_sparse)
+        allocateSparse(m_pdata->getN() + m_pdata->getNGhosts());
+
     // acquire the particle data
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
@@ -418,32 +504,30 @@ void CellList::computeCellList()
                                             access_mode::overwrite);
     ArrayHandle<unsigned int> h_cell_idx(m_idx, access_location::host, access_mode::overwrite);
     ArrayHandle<uint2> h_type_body(m_type_body, access_location::host, access_mode::overwrite);
-    uint3 conditions = make_uint3(0, 0, 0);
 
     // shorthand copies of the indexers
     Index3D ci = m_cell_indexer;
     Index2D cli = m_cell_list_indexer;
 
-    // clear the bin sizes to 0
-    memset(h_cell_size.data, 0, sizeof(unsigned int) * m_cell_indexer.getNumElements());
-
     Scalar3 ghost_width = getGhostWidth();
 
     // get periodic flags
     uchar3 periodic = box.getPeriodic();
 
-    // for each particle
-    unsigned n_tot_particles = m_pdata->getN() + m_pdata->getNGhosts();
-
-    for (unsigned int n = 0; n < n_tot_particles; n++)
-        {
+    // find the bin particle n belongs in, returns NO_CELL when the particle is not binned
+    const unsigned int NO_CELL = 0xffffffff;
+    auto find_bin = [&](unsigned int n, uint3& conditions)
+    {
         Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
         if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z))
             {
             conditions.y = n + 1;
-            continue;
+            return NO_CELL;
             }
 
+        if (!m_bin_types.empty() && !m_bin_types[__scalar_as_int(h_pos.data[n].w)])
+            return NO_CELL;
+
         // find the bin each particle belongs in
         Scalar3 f = box.makeFraction(p, ghost_width);
         int ib = (int)(f.x * m_dim.x);
@@ -458,7 +542,7 @@ void CellList::computeCellList()
             // if a ghost particle is out of bounds, silently ignore it
             if (n < m_pdata->getN())
                 conditions.z = n + 1;
-            continue;
+            return NO_CELL;
             }
 
         // need to handle the case where the particle is exactly at the box hi
@@ -473,9 +557,6 @@ void CellList::computeCellList()
         assert((ib < (int)(m_dim.x) && jb < (int)(m_dim.y) && kb < (int)(m_dim.z))
                || n >= m_pdata->getN());
 
-        // record its bin
-        unsigned int bin = ci(ib, jb, kb);
-
         // all particles should be in a valid cell
         if (ib < 0 || ib >= (int)m_dim.x || jb < 0 || jb >= (int)m_dim.y || kb < 0
             || kb >= (int)m_dim.z)
@@ -483,9 +564,15 @@ void CellList::computeCellList()
             // but ghost particles that are out of range should not produce an error
             if (n < m_pdata->getN())
                 conditions.z = n + 1;
-            continue;
+            return NO_CELL;
             }
 
+        return ci(ib, jb, kb);
+    };
+
+    // write the entries of particle n to the given element of the cell list arrays
+    auto write_entry = [&](unsigned int n, unsigned int slot)
+    {
         // setup the flag value to store
         Scalar flag;
         if (m_flag_charge)
@@ -495,40 +582,162 @@ void CellList::computeCellList()
         else
             flag = __int_as_scalar(n);
 
-        // store the bin entries
-        unsigned int offset = h_cell_size.data[bin];
+        if (m_compute_xyzf)
+            {
+            h_xyzf.data[slot]
+                = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
+            }
 
-        if (offset < m_Nmax)
+        if (m_compute_type_body)
             {
-            if (m_compute_xyzf)
-                {
-                h_xyzf.data[cli(offset, bin)]
-                    = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
-                }
+            h_type_body.data[slot]
+                = make_uint2(__scalar_as_int(h_pos.data[n].w), h_body.data[n]);
+            }
 
-            if (m_compute_type_body)
-                {
-                h_type_body.data[cli(offset, bin)]
-                    = make_uint2(__scalar_as_int(h_pos.data[n].w), h_body.data[n]);
-                }
+        if (m_compute_orientation)
+            {
+            h_cell_orientation.data[slot] = h_orientation.data[n];
+            }
 
-            if (m_compute_orientation)
-                {
-                h_cell_orientation.data[cli(offset, bin)] = h_orientation.data[n];
-                }
+        if (m_compute_idx)
+            {
+            h_cell_idx.data[slot] = n;
+            }
+    };
+
+    // store the entries of particle n in slot offset of its bin
+    auto store = [&](unsigned int n, unsigned int bin, unsigned int offset, uint3& conditions)
+    {
+        if (offset >= m_Nmax)
+            {
+            conditions.x = max((unsigned int)conditions.x, offset + 1);
+            return;
+            }
+
+        write_entry(n, cli(offset, bin));
+    };
 
-            if (m_compute_idx)
+    // for each particle
+    unsigned n_tot_particles = m_pdata->getN() + m_pdata->getNGhosts();
+    const unsigned int n_cells = m_cell_indexer.getNumElements();
+
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    const unsigned int n_threads = pool.getNumThreads();
+    uint3 conditions = make_uint3(0, 0, 0);
+
+    if (m_sparse)
+        {
+        ArrayHandle<unsigned int> h_occupied_cells(m_occupied_cells,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+        ArrayHandle<unsigned int> h_occupied_cell_start(m_occupied_cell_start,
+                                                        access_location::host,
+                                                        access_mode::overwrite);
+
+        // sort the binned particles by cell, and by index within each cell
+        m_sparse_keys.clear();
+        for (unsigned int n = 0; n < n_tot_particles; n++)
+            {
+            unsigned int bin = find_bin(n, conditions);
+            if (bin != NO_CELL)
+                m_sparse_keys.push_back((uint64_t(bin) << 32) | uint64_t(n));
+            }
+        std::sort(m_sparse_keys.begin(), m_sparse_keys.end());
+
+        unsigned int n_occupied = 0;
+        const unsigned int n_entries = static_cast<unsigned int>(m_sparse_keys.size());
+        for (unsigned int slot = 0; slot < n_entries; slot++)
+            {
+            unsigned int bin = static_cast<unsigned int>(m_sparse_keys[slot] >> 32);
+            unsigned int n = static_cast<unsigned int>(m_sparse_keys[slot] & 0xffffffff);
+            if (n_occupied == 0 || h_occupied_cells.data[n_occupied - 1] != bin)
                 {
-                h_cell_idx.data[cli(offset, bin)] = n;
+                h_occupied_cells.data[n_occupied] = bin;
+                h_occupied_cell_start.data[n_occupied] = slot;
+                n_occupied++;
                 }
+            write_entry(n, slot);
             }
-        else
+        h_occupied_cell_start.data[n_occupied] = n_entries;
+        m_n_occupied_cells = n_occupied;
+        }
+    else if (n_threads == 1)
+        {
+        // clear the bin sizes to 0
+        memset(h_cell_size.data, 0, sizeof(unsigned int) * n_cells);
+
+        for (unsigned int n = 0; n < n_tot_particles; n++)
             {
-            conditions.x = max((unsigned int)conditions.x, offset + 1);
-            }
+            unsigned int bin = find_bin(n, conditions);
+            if (bin == NO_CELL)
+                continue;
 
-        // increment the cell occupancy counter
-        h_cell_size.data[bin]++;
+            // store the bin entries and increment the cell occupancy counter
+            store(n, bin, h_cell_size.data[bin], conditions);
+            h_cell_size.data[bin]++;
+            }
+        }
+    else
+        {
+        m_particle_bin.resize(n_tot_particles);
+        // zero the counts of all threads up front, every row is summed below
+        m_thread_cell_size.assign(size_t(n_threads) * n_cells, 0);
+        std::vector<uint3> thread_conditions(n_threads, make_uint3(0, 0, 0));
+
+        // count the members each thread adds to each cell
+        pool.parallelFor(
+            n_tot_particles,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+            {
+                unsigned int* cell_size = m_thread_cell_size.data() + size_t(thread_id) * n_cells;
+                for (unsigned int n = begin; n < end; n++)
+                    {
+                    unsigned int bin = find_bin(n, thread_conditions[thread_id]);
+                    m_particle_bin[n] = bin;
+                    if (bin != NO_CELL)
+                        cell_size[bin]++;
+                    }
+            });
+
+        // replace the counts with each thread's first slot in the cell
+        pool.parallelFor(
+            n_cells,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+            {
+                for (unsigned int cell = begin; cell < end; cell++)
+                    {
+                    unsigned int offset = 0;
+                    for (unsigned int t = 0; t < n_threads; t++)
+                        {
+                        unsigned int& count = m_thread_cell_size[size_t(t) * n_cells + cell];
+                        unsigned int thread_count = count;
+                        count = offset;
+                        offset += thread_count;
+                        }
+                    h_cell_size.data[cell] = offset;
+                    }
+            });
+
+        pool.parallelFor(
+            n_tot_particles,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+            {
+                unsigned int* offset = m_thread_cell_size.data() + size_t(thread_id) * n_cells;
+                for (unsigned int n = begin; n < end; n++)
+                    {
+                    unsigned int bin = m_particle_bin[n];
+                    if (bin != NO_CELL)
+                        store(n, bin, offset[bin]++, thread_conditions[thread_id]);
+                    }
+            });
+
+        // the serial loop keeps the largest overflow and the last particle index in error
+        for (const uint3& c : thread_conditions)
+            {
+            conditions.x = max(conditions.x, c.x);
+            conditions.y = max(conditions.y, c.y);
+            conditions.z = max(conditions.z, c.z);
+            }
         }
 
         {
@@ -7,7 +7,9 @@
 #include "Index1D.h"
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 /*! \file CellList.h
     \brief Declares the CellList class
@@ -93,6 +95,17 @@ namespace hoomd
     Condition flags are to be set during the computeCellList() call and will be checked by compute()
    which will then take the appropriate action. If possible, flags 1 and 2 should be set to the
    index of the particle causing the flag plus 1.
+
+    <b>Sparse storage:</b>
+    With setSparse(true), the dense Ncells x Nmax arrays are not allocated. Instead, the entries of
+   all binned particles are stored contiguously, grouped by cell in increasing cell index order and
+   in particle index order within a cell. getOccupiedCellArray() lists the indices of the
+   getNumOccupiedCells() cells that hold particles in increasing order, and the entries of occupied
+   cell \c c are <code>xyzf[cell_start[c]]</code> to <code>xyzf[cell_start[c+1]-1]</code> where
+   \c cell_start is getOccupiedCellStartArray(). findOccupiedCell() looks up a cell index with a
+   binary search. Memory scales with the number of particles instead of the number of cells, which
+   suits dilute systems and boxes that are mostly vacuum. The cell size and adjacency arrays are not
+   computed in sparse mode, and only the CPU implementation supports it.
 */
 class PYBIND11_EXPORT CellList : public Compute
     {
@@ -213,6 +226,29 @@ class PYBIND11_EXPORT CellList : public Compute
         m_params_changed = true;
         }
 
+    //! Bin only the particles of the given types
+    /*! \param bin_types Flag for each type, true when the particles of the type are binned. An
+       empty vector bins all particles.
+    */
+    void setBinTypes(const std::vector<bool>& bin_types)
+        {
+        m_bin_types = bin_types;
+        m_params_changed = true;
+        }
+
+    //! Store only the occupied cells
+    void setSparse(bool sparse)
+        {
+        m_sparse = sparse;
+        m_params_changed = true;
+        }
+
+    /// Get whether only the occupied cells are stored
+    bool getSparse() const
+        {
+        return m_sparse;
+        }
+
     // @}
     //! \name Get properties
     // @{
@@ -309,6 +345,43 @@ class PYBIND11_EXPORT CellList : public Compute
         return m_idx;
         }
 
+    //! Get the sorted indices of the occupied cells (sparse mode)
+    const GPUArray<unsigned int>& getOccupiedCellArray() const
+        {
+        return m_occupied_cells;
+        }
+
+    //! Get the first entry of each occupied cell, followed by the total number of entries (sparse
+    //! mode)
+    const GPUArray<unsigned int>& getOccupiedCellStartArray() const
+        {
+        return m_occupied_cell_start;
+        }
+
+    //! Get the number of occupied cells (sparse mode)
+    unsigned int getNumOccupiedCells() const
+        {
+        return m_n_occupied_cells;
+        }
+
+    //! Find the position of a cell in the occupied cell array
+    /*! \param occupied_cells Sorted indices of the occupied cells
+        \param n_occupied_cells Number of occupied cells
+        \param cell Cell index to find
+        \returns The position of \a cell in \a occupied_cells, or \a n_occupied_cells when the cell
+       is empty
+    */
+    static unsigned int findOccupiedCell(const unsigned int* occupied_cells,
+                                         unsigned int n_occupied_cells,
+                                         unsigned int cell)
+        {
+        const unsigned int* end = occupied_cells + n_occupied_cells;
+        const unsigned int* it = std::lower_bound(occupied_cells, end, cell);
+        if (it == end || *it != cell)
+            return n_occupied_cells;
+        return static_cast<unsigned int>(it - occupied_cells);
+        }
+
     //! Compute the cell list given the current particle positions
     void compute(uint64_t timestep);
 
@@ -360,8 +433,18 @@ class PYBIND11_EXPORT CellList : public Compute
     GPUArray<unsigned int> m_idx;       //!< Cell list with index
     GPUArray<uint3> m_conditions;       //!< Condition flags set during the computeCellList() call
 
-    bool m_sort_cell_list;   //!< If true, sort cell list
-    bool m_compute_adj_list; //!< If true, compute the cell adjacency lists
+    std::vector<unsigned int> m_particle_bin;     //!< Bin of each particle (threaded binning)
+    std::vector<unsigned int> m_thread_cell_size; //!< Per thread cell counts (threaded binning)
+
+    bool m_sort_cell_list;         //!< If true, sort cell list
+    bool m_compute_adj_list;       //!< If true, compute the cell adjacency lists
+    bool m_sparse;                 //!< If true, store only the occupied cells
+    std::vector<bool> m_bin_types; //!< Types to bin, all types when empty
+
+    GPUArray<unsigned int> m_occupied_cells;      //!< Sorted indices of the occupied cells
+    GPUArray<unsigned int> m_occupied_cell_start; //!< First entry of each occupied cell
+    unsigned int m_n_occupied_cells;              //!< Number of occupied cells
+    std::vector<uint64_t> m_sparse_keys;          //!< Cell and index of each binned particle
 
 #ifdef ENABLE_MPI
     /// The system's communicator.
@@ -383,6 +466,9 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Initializes values in the cell_adj array
     void initializeCellAdj();
 
+    //! Allocate the per particle arrays used in sparse mode
+    void allocateSparse(unsigned int n_entries);
+
     //! Compute the cell list
     virtual void computeCellList();
 
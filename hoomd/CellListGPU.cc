@@ -32,6 +32,15 @@ CellListGPU::CellListGPU(std::shared_ptr<SystemDefinition> sysdef) : CellList(sy
 
 void CellListGPU::computeCellList()
     {
+    if (m_sparse)
+        {
+        throw std::runtime_error("Sparse cell lists are not supported on the GPU.");
+        }
+    if (!m_bin_types.empty())
+        {
+        throw std::runtime_error("Binning a subset of the types is not supported on the GPU.");
+        }
+
     // acquire the particle data
     ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
     ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
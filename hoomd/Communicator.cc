@@ -8,11 +8,14 @@
 #ifdef ENABLE_MPI
 #include "Communicator.h"
 #include "HOOMDMPI.h"
+#include "ProfileRange.h"
 #include "System.h"
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <pybind11/stl.h>
+#include <type_traits>
 
 using namespace std;
 
@@ -39,11 +42,74 @@ template<class group_data>
 void Communicator::GroupCommunicator<group_data>::setGroupData(std::shared_ptr<group_data> gdata)
     {
     m_gdata = gdata;
+    m_member_table_valid = false;
 
     // the size of the bit field must be larger or equal the group size
     assert(sizeof(unsigned int) * 8 >= group_data::size);
     }
 
+template<class group_data> void Communicator::GroupCommunicator<group_data>::rebuildMemberTable()
+    {
+    ArrayHandle<typename group_data::members_t> h_members(m_gdata->getMembersArray(),
+                                                          access_location::host,
+                                                          access_mode::read);
+    ArrayHandle<unsigned int> h_group_tag(m_gdata->getTags(),
+                                          access_location::host,
+                                          access_mode::read);
+
+    m_member_groups.clear();
+    m_member_groups.reserve(m_gdata->getN() * group_data::size);
+    for (unsigned int group_idx = 0; group_idx < m_gdata->getN(); group_idx++)
+        {
+        for (unsigned int i = 0; i < group_data::size; i++)
+            {
+            m_member_groups.emplace(h_members.data[group_idx].tag[i], h_group_tag.data[group_idx]);
+            }
+        }
+
+    m_member_table_valid = true;
+    }
+
+/*! Particles with nonzero flags (those that migrate or are sent as ghosts) are usually a small
+    fraction of the local particles. Looking up their groups in the member table avoids scanning
+    all groups.
+*/
+template<class group_data>
+void Communicator::GroupCommunicator<group_data>::findFlaggedGroups(
+    const unsigned int* h_flags,
+    unsigned int n_particles,
+    std::vector<unsigned int>& groups)
+    {
+    ArrayHandle<unsigned int> h_tag(m_comm.m_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<unsigned int> h_group_rtag(m_gdata->getRTags(),
+                                           access_location::host,
+                                           access_mode::read);
+
+    groups.clear();
+    const unsigned int n_groups = m_gdata->getN();
+    for (unsigned int idx = 0; idx < n_particles; idx++)
+        {
+        if (!h_flags[idx])
+            continue;
+
+        auto range = m_member_groups.equal_range(h_tag.data[idx]);
+        for (auto it = range.first; it != range.second; ++it)
+            {
+            unsigned int group_idx = h_group_rtag.data[it->second];
+            if (group_idx < n_groups)
+                {
+                groups.push_back(group_idx);
+                }
+            }
+        }
+
+    // process groups in the same order as a scan over all groups
+    std::sort(groups.begin(), groups.end());
+    groups.erase(std::unique(groups.begin(), groups.end()), groups.end());
+    }
+
 template<class group_data>
 void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                                                                 bool local_multiple)
@@ -69,6 +135,29 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
         // remove ghost groups
         m_gdata->removeAllGhostGroups();
 
+        // find the groups with members that migrate
+        if (incomplete || !m_member_table_valid)
+            {
+            rebuildMemberTable();
+            }
+
+        if (incomplete)
+            {
+            // initially, update the rank information of all groups
+            m_flagged_groups.resize(m_gdata->getN());
+            for (unsigned int group_idx = 0; group_idx < m_gdata->getN(); group_idx++)
+                {
+                m_flagged_groups[group_idx] = group_idx;
+                }
+            }
+        else
+            {
+            ArrayHandle<unsigned int> h_comm_flags(m_comm.m_pdata->getCommFlags(),
+                                                   access_location::host,
+                                                   access_mode::read);
+            findFlaggedGroups(h_comm_flags.data, m_comm.m_pdata->getN(), m_flagged_groups);
+            }
+
         // send map for rank updates
         typedef std::multimap<unsigned int, rank_element_t> map_t;
         map_t send_map;
@@ -104,8 +193,7 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
             unsigned int my_rank = m_exec_conf->getRank();
 
             // mark groups whose member ranks need to be updated
-            unsigned int n_groups = m_gdata->getN();
-            for (unsigned int group_idx = 0; group_idx < n_groups; group_idx++)
+            for (unsigned int group_idx : m_flagged_groups)
                 {
                 typename group_data::members_t g = h_members.data[group_idx];
                 typename group_data::ranks_t r = h_group_ranks.data[group_idx];
@@ -422,9 +510,8 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                                                    access_location::host,
                                                    access_mode::read);
 
-            unsigned int ngroups = m_gdata->getN();
-
-            for (unsigned int group_idx = 0; group_idx < ngroups; group_idx++)
+            m_removed_groups.clear();
+            for (unsigned int group_idx : m_flagged_groups)
                 {
                 unsigned int mask = 0;
 
@@ -476,73 +563,64 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
 
                     // if group is no longer local, flag for removal
                     if (!is_local)
+                        {
                         h_group_rtag.data[el.group_tag] = GROUP_NOT_LOCAL;
+                        m_removed_groups.push_back(group_idx);
+
+                        for (unsigned int i = 0; i < group_size; ++i)
+                            {
+                            auto range = m_member_groups.equal_range(members.tag[i]);
+                            for (auto it = range.first; it != range.second; ++it)
+                                {
+                                if (it->second == el.group_tag)
+                                    {
+                                    m_member_groups.erase(it);
+                                    break;
+                                    }
+                                }
+                            }
+                        }
                     }
                 } // end loop over groups
             }
 
-        unsigned int new_ngroups;
+        unsigned int new_ngroups = m_gdata->getN();
             {
             ArrayHandle<typename group_data::members_t> h_groups(m_gdata->getMembersArray(),
                                                                  access_location::host,
-                                                                 access_mode::read);
+                                                                 access_mode::readwrite);
             ArrayHandle<typeval_t> h_group_typeval(m_gdata->getTypeValArray(),
                                                    access_location::host,
-                                                   access_mode::read);
+                                                   access_mode::readwrite);
             ArrayHandle<unsigned int> h_group_tag(m_gdata->getTags(),
                                                   access_location::host,
-                                                  access_mode::read);
+                                                  access_mode::readwrite);
             ArrayHandle<typename group_data::ranks_t> h_group_ranks(m_gdata->getRanksArray(),
                                                                     access_location::host,
-                                                                    access_mode::read);
-
-            // access alternate arrays to write to
-            ArrayHandle<typename group_data::members_t> h_groups_alt(m_gdata->getAltMembersArray(),
-                                                                     access_location::host,
-                                                                     access_mode::overwrite);
-            ArrayHandle<typeval_t> h_group_typeval_alt(m_gdata->getAltTypeValArray(),
-                                                       access_location::host,
-                                                       access_mode::overwrite);
-            ArrayHandle<unsigned int> h_group_tag_alt(m_gdata->getAltTags(),
-                                                      access_location::host,
-                                                      access_mode::overwrite);
-            ArrayHandle<typename group_data::ranks_t> h_group_ranks_alt(m_gdata->getAltRanksArray(),
-                                                                        access_location::host,
-                                                                        access_mode::overwrite);
-
-            // access rtags
+                                                                    access_mode::readwrite);
             ArrayHandle<unsigned int> h_group_rtag(m_gdata->getRTags(),
                                                    access_location::host,
                                                    access_mode::readwrite);
 
-            unsigned int ngroups = m_gdata->getN();
-            unsigned int n = 0;
-            for (unsigned int group_idx = 0; group_idx < ngroups; group_idx++)
+            // fill the holes left by removed groups with groups from the end of the arrays,
+            // starting with the last hole so that the moved groups are never removed ones
+            for (auto it = m_removed_groups.rbegin(); it != m_removed_groups.rend(); ++it)
                 {
-                unsigned int group_tag = h_group_tag.data[group_idx];
-                bool keep = h_group_rtag.data[group_tag] != GROUP_NOT_LOCAL;
-
-                if (keep)
+                unsigned int group_idx = *it;
+                unsigned int last_idx = --new_ngroups;
+                if (group_idx != last_idx)
                     {
-                    h_groups_alt.data[n] = h_groups.data[group_idx];
-                    h_group_typeval_alt.data[n] = h_group_typeval.data[group_idx];
-                    h_group_tag_alt.data[n] = group_tag;
-                    h_group_ranks_alt.data[n] = h_group_ranks.data[group_idx];
+                    h_groups.data[group_idx] = h_groups.data[last_idx];
+                    h_group_typeval.data[group_idx] = h_group_typeval.data[last_idx];
+                    h_group_tag.data[group_idx] = h_group_tag.data[last_idx];
+                    h_group_ranks.data[group_idx] = h_group_ranks.data[last_idx];
 
-                    // rebuild rtags
-                    h_group_rtag.data[group_tag] = n++;
+                    // update rtags
+                    h_group_rtag.data[h_group_tag.data[group_idx]] = group_idx;
                     }
                 }
-
-            new_ngroups = n;
             }
 
-        // make alternate arrays current
-        m_gdata->swapMemberArrays();
-        m_gdata->swapTypeArrays();
-        m_gdata->swapTagArrays();
-        m_gdata->swapRankArrays();
-
         assert(new_ngroups <= m_gdata->getN());
 
         // resize group arrays
@@ -769,6 +847,11 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
 
                         // update reverse-lookup table
                         h_group_rtag.data[tag] = add_idx++;
+
+                        for (unsigned int i = 0; i < group_size; ++i)
+                            {
+                            m_member_groups.emplace(el.tags.tag[i], tag);
+                            }
                         }
                     else
                         {
@@ -935,7 +1018,21 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
             unsigned int n_local = m_comm.m_pdata->getN();
             unsigned int max_local = n_local + m_comm.m_pdata->getNGhosts();
 
-            for (unsigned int group_idx = 0; group_idx < ngroups_local; group_idx++)
+            // only groups with a member that is sent as a ghost have a nonzero plan
+            if (m_member_table_valid)
+                {
+                findFlaggedGroups(h_plan.data, max_local, m_flagged_groups);
+                }
+            else
+                {
+                m_flagged_groups.resize(ngroups_local);
+                for (unsigned int group_idx = 0; group_idx < ngroups_local; group_idx++)
+                    {
+                    m_flagged_groups[group_idx] = group_idx;
+                    }
+                }
+
+            for (unsigned int group_idx : m_flagged_groups)
                 {
                 typename group_data::members_t members = h_groups.data[group_idx];
 
@@ -1188,7 +1285,8 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
       m_netvirial_recvbuf(m_exec_conf), m_plan(m_exec_conf), m_plan_reverse(m_exec_conf),
       m_tag_reverse(m_exec_conf), m_netforce_reverse_copybuf(m_exec_conf),
       m_netforce_reverse_recvbuf(m_exec_conf), m_r_ghost_max(Scalar(0.0)), m_ghosts_added(0),
-      m_has_ghost_particles(false), m_last_flags(0), m_comm_pending(false),
+      m_has_ghost_particles(false), m_last_flags(0), m_comm_pending(false), m_pending_dir(0),
+      m_pending_start_idx(0), m_n_pending_reqs(0),
       m_bond_comm(*this, m_sysdef->getBondData()), m_angle_comm(*this, m_sysdef->getAngleData()),
       m_dihedral_comm(*this, m_sysdef->getDihedralData()),
       m_improper_comm(*this, m_sysdef->getImproperData()),
@@ -1245,6 +1343,9 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
     GPUArray<Scalar> r_ghost_body(m_pdata->getNTypes(), m_exec_conf);
     m_r_ghost_body.swap(r_ghost_body);
 
+    GPUArray<Scalar> r_ghost_dir(6 * m_pdata->getNTypes(), m_exec_conf);
+    m_r_ghost_dir.swap(r_ghost_dir);
+
     /*
      * Bonded group communication
      */
@@ -1377,6 +1478,11 @@ Communicator::~Communicator()
             .disconnect<Communicator, &Communicator::setMeshtrianglesChanged>(this);
         }
 
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        freeGhostUpdateRequests(dir);
+        }
+
     MPI_Type_free(&m_mpi_pdata_element);
     }
 
@@ -1515,11 +1621,25 @@ void Communicator::communicate(uint64_t timestep)
     m_flags = CommFlags(0);
     m_requested_flags.emit_accumulate([&](CommFlags f) { m_flags |= f; }, timestep);
 
+    const Profiler& profiler = m_sysdef->getProfiler();
+
     if (!m_force_migrate && !m_compute_callbacks.empty() && m_has_ghost_particles)
         {
         // do an obligatory update before determining whether to migrate
-        beginUpdateGhosts(timestep);
-        finishUpdateGhosts(timestep);
+            {
+            ProfileScope profile(profiler, m_ghost_update_timer);
+            ProfileRange range("ghost update");
+            beginUpdateGhosts(timestep);
+            }
+
+        // compute on local particles while the ghost update is in flight
+        m_local_compute_callbacks.emit(timestep);
+
+            {
+            ProfileScope profile(profiler, m_ghost_update_timer);
+            ProfileRange range("ghost update");
+            finishUpdateGhosts(timestep);
+            }
 
         // call subscribers after ghost update, but before distance check
         m_compute_callbacks.emit(timestep);
@@ -1542,9 +1662,20 @@ void Communicator::communicate(uint64_t timestep)
     // Update ghosts if we are not migrating
     if (!migrate && m_compute_callbacks.empty())
         {
-        beginUpdateGhosts(timestep);
+            {
+            ProfileScope profile(profiler, m_ghost_update_timer);
+            ProfileRange range("ghost update");
+            beginUpdateGhosts(timestep);
+            }
 
-        finishUpdateGhosts(timestep);
+        // compute on local particles while the ghost update is in flight
+        m_local_compute_callbacks.emit(timestep);
+
+            {
+            ProfileScope profile(profiler, m_ghost_update_timer);
+            ProfileRange range("ghost update");
+            finishUpdateGhosts(timestep);
+            }
         }
 
     // Check if migration of particles is requested
@@ -1552,11 +1683,19 @@ void Communicator::communicate(uint64_t timestep)
         {
         m_force_migrate = false;
 
-        // If so, migrate atoms
-        migrateParticles();
+            {
+            // If so, migrate atoms
+            ProfileScope profile(profiler, m_migrate_timer);
+            ProfileRange range("migrate");
+            migrateParticles();
+            }
 
-        // Construct ghost send lists, exchange ghost atom data
-        exchangeGhosts();
+            {
+            // Construct ghost send lists, exchange ghost atom data
+            ProfileScope profile(profiler, m_ghost_exchange_timer);
+            ProfileRange range("ghost exchange");
+            exchangeGhosts();
+            }
 
         // update particle data now that ghosts are available
         m_compute_callbacks.emit(timestep);
@@ -1730,27 +1869,30 @@ void Communicator::migrateParticles()
 
 void Communicator::updateGhostWidth()
     {
+    const unsigned int ntypes = m_pdata->getNTypes();
         {
         // reset values (this may not be needed in most cases, but it doesn't harm to be safe
         ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::overwrite);
         ArrayHandle<Scalar> h_r_ghost_body(m_r_ghost_body,
                                            access_location::host,
                                            access_mode::overwrite);
-        for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
             {
             h_r_ghost.data[cur_type] = Scalar(0.0);
             h_r_ghost_body.data[cur_type] = Scalar(0.0);
             }
         }
+    m_r_ghost_type.assign(ntypes, Scalar(0.0));
+    m_r_ghost_pair.assign(ntypes * ntypes, Scalar(0.0));
 
     ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::readwrite);
-    if (!m_ghost_layer_width_requests.empty())
+    if (!m_ghost_layer_width_requests.empty() || !m_ghost_layer_pair_width_requests.empty())
         {
         // update the ghost layer width only if subscribers are available
 
         // reduce per type using the signals, and then overall
         Scalar r_ghost_max = 0.0;
-        for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
             {
             Scalar r_ghost_i = 0.0;
             m_ghost_layer_width_requests.emit_accumulate(
@@ -1760,6 +1902,25 @@ void Communicator::updateGhostWidth()
                         r_ghost_i = r;
                 },
                 cur_type);
+            m_r_ghost_type[cur_type] = r_ghost_i;
+
+            // the pair requests contribute their maximum over all partner types
+            for (unsigned int partner_type = 0; partner_type < ntypes; ++partner_type)
+                {
+                Scalar r_ghost_ij = 0.0;
+                m_ghost_layer_pair_width_requests.emit_accumulate(
+                    [&](Scalar r)
+                    {
+                        if (r > r_ghost_ij)
+                            r_ghost_ij = r;
+                    },
+                    cur_type,
+                    partner_type);
+                m_r_ghost_pair[cur_type * ntypes + partner_type] = r_ghost_ij;
+                if (r_ghost_ij > r_ghost_i)
+                    r_ghost_i = r_ghost_ij;
+                }
+
             h_r_ghost.data[cur_type] = r_ghost_i;
             if (r_ghost_i > r_ghost_max)
                 r_ghost_max = r_ghost_i;
@@ -1773,7 +1934,7 @@ void Communicator::updateGhostWidth()
                                            access_location::host,
                                            access_mode::readwrite);
 
-        for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
             {
             Scalar r_body_ghost_i = 0.0;
             m_body_ghost_layer_width_requests.emit_accumulate(
@@ -1790,6 +1951,137 @@ void Communicator::updateGhostWidth()
         }
     }
 
+/*! \param dir Direction of a face (0: east, 1: west, 2: north, 3: south, 4: up, 5: down)
+    \returns Adjacency mask of all neighbors that are offset by one domain across the face
+*/
+static unsigned int getFaceSlabMask(unsigned int dir)
+    {
+    const int sign = (dir % 2 == 0) ? 1 : -1;
+    unsigned int mask = 0;
+    for (int iz = -1; iz <= 1; iz++)
+        for (int iy = -1; iy <= 1; iy++)
+            for (int ix = -1; ix <= 1; ix++)
+                {
+                const int offset[3] = {ix, iy, iz};
+                if (offset[dir / 2] == sign)
+                    mask |= 1 << (((iz + 1) * 3 + (iy + 1)) * 3 + (ix + 1));
+                }
+    return mask;
+    }
+
+/*! The ghost layer of a type toward a face only needs to cover the cutoffs of the types that are
+    present on the neighbors across that face. These are the up to 9 neighbors offset by one
+    domain across the face, which includes the edge and corner neighbors that receive ghosts
+    forwarded through the face neighbor. Ranks exchange flags of the types they own with all of
+    their neighbors and take the maximum pair width over the present types. Widths requested per
+    type (without a partner type) apply in all directions.
+
+    Migration only happens before a ghost exchange, so the owned types do not change until the
+    next call.
+
+    \note All ranks must call updateGhostWidthByDirection() since it communicates with the
+    neighbors.
+*/
+void Communicator::updateGhostWidthByDirection()
+    {
+    const unsigned int ntypes = m_pdata->getNTypes();
+    if (m_r_ghost_dir.getNumElements() != 6 * ntypes)
+        {
+        GPUArray<Scalar> r_ghost_dir(6 * ntypes, m_exec_conf);
+        m_r_ghost_dir.swap(r_ghost_dir);
+        }
+
+    ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_ghost_dir(m_r_ghost_dir,
+                                      access_location::host,
+                                      access_mode::overwrite);
+
+    // without pair requests, every direction has the same width
+    if (m_ghost_layer_pair_width_requests.empty())
+        {
+        for (unsigned int dir = 0; dir < 6; dir++)
+            {
+            for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
+                {
+                h_r_ghost_dir.data[dir * ntypes + cur_type] = h_r_ghost.data[cur_type];
+                }
+            }
+        return;
+        }
+
+    // flag the types owned by this rank
+    std::vector<unsigned char> present(ntypes, 0);
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+            {
+            present[__scalar_as_int(h_pos.data[idx].w)] = 1;
+            }
+        }
+
+    // exchange the flags with all neighbors
+    ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                 access_location::host,
+                                                 access_mode::read);
+    ArrayHandle<unsigned int> h_adj_mask(m_adj_mask, access_location::host, access_mode::read);
+
+    std::vector<unsigned char> neigh_present(m_n_unique_neigh * ntypes, 0);
+    std::vector<MPI_Request> reqs(2 * m_n_unique_neigh);
+    std::vector<MPI_Status> stats(2 * m_n_unique_neigh);
+    for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+        {
+        const unsigned int neighbor = h_unique_neighbors.data[ineigh];
+        MPI_Isend(present.data(),
+                  ntypes,
+                  MPI_BYTE,
+                  neighbor,
+                  0,
+                  m_mpi_comm,
+                  &reqs[2 * ineigh]);
+        MPI_Irecv(neigh_present.data() + ineigh * ntypes,
+                  ntypes,
+                  MPI_BYTE,
+                  neighbor,
+                  0,
+                  m_mpi_comm,
+                  &reqs[2 * ineigh + 1]);
+        }
+    if (m_n_unique_neigh > 0)
+        MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &stats.front());
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        // collect the types present across this face
+        const unsigned int slab_mask = getFaceSlabMask(dir);
+        std::vector<unsigned char> slab_present(ntypes, 0);
+        for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+            {
+            if (!(h_adj_mask.data[ineigh] & slab_mask))
+                continue;
+            for (unsigned int partner_type = 0; partner_type < ntypes; ++partner_type)
+                {
+                slab_present[partner_type] |= neigh_present[ineigh * ntypes + partner_type];
+                }
+            }
+
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
+            {
+            Scalar r_ghost_i = m_r_ghost_type[cur_type];
+            for (unsigned int partner_type = 0; partner_type < ntypes; ++partner_type)
+                {
+                if (slab_present[partner_type])
+                    {
+                    r_ghost_i = std::max(r_ghost_i,
+                                         m_r_ghost_pair[cur_type * ntypes + partner_type]);
+                    }
+                }
+            h_r_ghost_dir.data[dir * ntypes + cur_type] = r_ghost_i;
+            }
+        }
+    }
+
 //! Build ghost particle list, exchange ghost particle data
 void Communicator::exchangeGhosts()
     {
@@ -1821,11 +2113,13 @@ void Communicator::exchangeGhosts()
      * Mark non-bonded atoms for sending
      */
     updateGhostWidth();
+    updateGhostWidthByDirection();
 
     // compute the ghost layer widths as fractions
-    ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_ghost_dir(m_r_ghost_dir, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_r_ghost_body(m_r_ghost_body, access_location::host, access_mode::read);
     const Scalar3 box_dist = box.getNearestPlaneDistance();
+    const unsigned int ntypes = m_pdata->getNTypes();
 
         {
         // scan all local atom positions if they are within r_ghost from a neighbor
@@ -1842,33 +2136,35 @@ void Communicator::exchangeGhosts()
             Scalar4 postype = h_pos.data[idx];
             Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
 
-            // get the ghost fraction for this particle type
+            // get the ghost widths for this particle type toward each direction
             const unsigned int type = __scalar_as_int(postype.w);
-            Scalar ghost_width = h_r_ghost.data[type];
-
-            if (h_body.data[idx] < MIN_FLOPPY)
+            Scalar ghost_width[6];
+            for (unsigned int dir = 0; dir < 6; dir++)
                 {
-                ghost_width = std::max(ghost_width, h_r_ghost_body.data[type]);
+                ghost_width[dir] = h_r_ghost_dir.data[dir * ntypes + type];
+                if (h_body.data[idx] < MIN_FLOPPY)
+                    {
+                    ghost_width[dir] = std::max(ghost_width[dir], h_r_ghost_body.data[type]);
+                    }
                 }
-            Scalar3 ghost_fraction = ghost_width / box_dist;
 
             Scalar3 f = box.makeFraction(pos);
-            if (f.x >= Scalar(1.0) - ghost_fraction.x)
+            if (f.x >= Scalar(1.0) - ghost_width[0] / box_dist.x)
                 h_plan.data[idx] |= send_east;
 
-            if (f.x < ghost_fraction.x)
+            if (f.x < ghost_width[1] / box_dist.x)
                 h_plan.data[idx] |= send_west;
 
-            if (f.y >= Scalar(1.0) - ghost_fraction.y)
+            if (f.y >= Scalar(1.0) - ghost_width[2] / box_dist.y)
                 h_plan.data[idx] |= send_north;
 
-            if (f.y < ghost_fraction.y)
+            if (f.y < ghost_width[3] / box_dist.y)
                 h_plan.data[idx] |= send_south;
 
-            if (f.z >= Scalar(1.0) - ghost_fraction.z)
+            if (f.z >= Scalar(1.0) - ghost_width[4] / box_dist.z)
                 h_plan.data[idx] |= send_up;
 
-            if (f.z < ghost_fraction.z)
+            if (f.z < ghost_width[5] / box_dist.z)
                 h_plan.data[idx] |= send_down;
             }
         }
@@ -2355,6 +2651,17 @@ void Communicator::exchangeGhosts()
             }
         } // end dir loop
 
+    // sort the ghosts before the reverse plans and ghost groups refer to their indices
+    m_sort_ghosts = m_exec_conf->isGhostSortingEnabled() && flags[comm_flag::position];
+    if (m_sort_ghosts)
+        {
+        sortGhosts();
+        }
+    else
+        {
+        m_ghost_arrival_idx.clear();
+        }
+
     m_ghosts_added = m_pdata->getNGhosts();
 
     // exchange ghost constraints along with ghost particles
@@ -2623,6 +2930,380 @@ void Communicator::exchangeGhosts()
 
             } // end dir loop
         }
+
+    // the full precision positions are the reference for compressed updates until the next exchange
+    m_compress_ghost_updates
+        = m_exec_conf->isGhostUpdateCompressionEnabled() && flags[comm_flag::position];
+    if (m_compress_ghost_updates)
+        {
+        storeGhostReferencePositions();
+        }
+    }
+
+/*! Ghost positions only change between ghost exchanges. Both the sending and the receiving rank
+    keep the positions from the last exchange so that updates only need to send the displacements.
+*/
+void Communicator::storeGhostReferencePositions()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        m_ghost_ref_pos_send[dir].resize(m_num_copy_ghosts[dir]);
+        if (!isCommunicating(dir))
+            continue;
+
+        ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            {
+            unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+            m_ghost_ref_pos_send[dir][ghost_idx] = h_pos.data[idx];
+            }
+        }
+
+    // the compressed updates are received in arrival order
+    const unsigned int N = m_pdata->getN();
+    m_ghost_ref_pos_recv.resize(m_pdata->getNGhosts());
+    for (unsigned int i = 0; i < m_pdata->getNGhosts(); i++)
+        {
+        m_ghost_ref_pos_recv[i] = h_pos.data[getGhostIndex(N + i)];
+        }
+    }
+
+/*! Ghosts are appended to the particle data in the order the messages arrive, so ghosts that are
+    close in space are far apart in memory. sortGhosts() orders them by the cells of a grid as
+    wide as the ghost layer that spans the local box and the ghost layer around it. The counting
+    sort is stable, so ghosts in the same cell keep their arrival order.
+
+    The ghost updates write the received data through m_ghost_arrival_idx until the next
+    exchange.
+*/
+void Communicator::sortGhosts()
+    {
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_ghosts = m_pdata->getNGhosts();
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar3 L = box.getNearestPlaneDistance();
+    const CommFlags flags = getFlags();
+
+    m_ghost_arrival_idx.resize(n_ghosts);
+    m_ghost_pos_recvbuf.resize(n_ghosts);
+    m_ghost_velocity_recvbuf.resize(n_ghosts);
+    m_ghost_orientation_recvbuf.resize(n_ghosts);
+    m_ghost_force_recvbuf.resize(n_ghosts);
+
+    // the cap bounds the cost of the counting sort when the ghost layer is thin
+    const unsigned int max_dim = 64;
+    const Scalar width = m_r_ghost_max;
+    auto n_cells = [&](Scalar length)
+    {
+        if (width <= Scalar(0.0))
+            return 1u;
+        return std::max(1u, std::min(max_dim, (unsigned int)((length + 2 * width) / width)));
+    };
+    uint3 dim = make_uint3(n_cells(L.x), n_cells(L.y), n_cells(L.z));
+    if (m_sysdef->getNDimensions() == 2)
+        {
+        dim.z = 1;
+        }
+    const unsigned int n_cells_total = dim.x * dim.y * dim.z;
+    const Scalar3 pad = (width > Scalar(0.0)) ? make_scalar3(width / L.x, width / L.y, width / L.z)
+                                              : make_scalar3(0, 0, 0);
+
+    auto cell_1d = [](Scalar f, Scalar pad_1d, unsigned int n)
+    {
+        const Scalar t = (f + pad_1d) / (Scalar(1.0) + 2 * pad_1d) * Scalar(n);
+        if (!(t > Scalar(0.0)))
+            return 0u;
+        return std::min((unsigned int)t, n - 1);
+    };
+
+    // order[k] is the arrival position of the ghost that is placed at N + k
+    std::vector<unsigned int> cell(n_ghosts);
+    std::vector<unsigned int> cell_start(n_cells_total + 1, 0);
+    std::vector<unsigned int> order(n_ghosts);
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int i = 0; i < n_ghosts; i++)
+            {
+            const Scalar4 postype = h_pos.data[N + i];
+            const Scalar3 f = box.makeFraction(make_scalar3(postype.x, postype.y, postype.z));
+            cell[i] = (cell_1d(f.z, pad.z, dim.z) * dim.y + cell_1d(f.y, pad.y, dim.y)) * dim.x
+                      + cell_1d(f.x, pad.x, dim.x);
+            cell_start[cell[i] + 1]++;
+            }
+        }
+    for (unsigned int c = 0; c < n_cells_total; c++)
+        {
+        cell_start[c + 1] += cell_start[c];
+        }
+    for (unsigned int i = 0; i < n_ghosts; i++)
+        {
+        const unsigned int k = cell_start[cell[i]]++;
+        order[k] = i;
+        m_ghost_arrival_idx[i] = N + k;
+        }
+
+    // apply the permutation to the ghost data sent by exchangeGhosts()
+    auto permute = [&](auto* data)
+    {
+        using T = std::remove_pointer_t<decltype(data)>;
+        std::vector<T> arrived(data + N, data + N + n_ghosts);
+        for (unsigned int k = 0; k < n_ghosts; k++)
+            {
+            data[N + k] = arrived[order[k]];
+            }
+    };
+
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::readwrite);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::readwrite);
+        ArrayHandle<unsigned int> h_plan(m_plan, access_location::host, access_mode::readwrite);
+
+        permute(h_tag.data);
+        permute(h_plan.data);
+        for (unsigned int idx = N; idx < N + n_ghosts; idx++)
+            {
+            h_rtag.data[h_tag.data[idx]] = idx;
+            }
+        }
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        permute(h_pos.data);
+        }
+
+    if (flags[comm_flag::charge])
+        {
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+        permute(h_charge.data);
+        }
+
+    if (flags[comm_flag::diameter])
+        {
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+        permute(h_diameter.data);
+        }
+
+    if (flags[comm_flag::body])
+        {
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::readwrite);
+        permute(h_body.data);
+        }
+
+    if (flags[comm_flag::image])
+        {
+        ArrayHandle<int3> h_image(m_pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+        permute(h_image.data);
+        }
+
+    if (flags[comm_flag::velocity])
+        {
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        permute(h_vel.data);
+        }
+
+    if (flags[comm_flag::orientation])
+        {
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+        permute(h_orientation.data);
+        }
+    }
+
+/*! \param dir Direction to send to
+
+    The send buffer holds a Scalar header followed by the payload. A non-negative header is the
+    fixed point scale: each ghost is sent as three int16_t displacements from its reference
+    position, in units of scale / 32767. The scale is the largest displacement component in the
+    message, so the quantization error is at most scale / 65534. Displacements are bounded by the
+    neighbor list buffer between ghost exchanges. When they exceed the ghost layer width (for
+    example, when the neighbor list is checked infrequently), the header is negative and the
+    payload holds the full Scalar4 positions.
+*/
+void Communicator::packGhostPositionDeltas(unsigned int dir)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const unsigned int n_send = m_num_copy_ghosts[dir];
+    const std::vector<Scalar4>& ref = m_ghost_ref_pos_send[dir];
+
+    // find the largest displacement component, accounting for periodic wrapping of local particles
+    Scalar scale = Scalar(0.0);
+    for (unsigned int ghost_idx = 0; ghost_idx < n_send; ghost_idx++)
+        {
+        const Scalar4 postype = h_pos.data[h_rtag.data[h_copy_ghosts.data[ghost_idx]]];
+        const Scalar3 delta = global_box.minImage(
+            make_scalar3(postype.x - ref[ghost_idx].x,
+                         postype.y - ref[ghost_idx].y,
+                         postype.z - ref[ghost_idx].z));
+        scale = std::max(scale, std::max(fabs(delta.x), std::max(fabs(delta.y), fabs(delta.z))));
+        }
+
+    if (scale > m_r_ghost_max)
+        {
+        m_pos_delta_sendbuf.resize(sizeof(Scalar) + n_send * sizeof(Scalar4));
+        const Scalar header = Scalar(-1.0);
+        std::memcpy(m_pos_delta_sendbuf.data(), &header, sizeof(Scalar));
+        char* payload = m_pos_delta_sendbuf.data() + sizeof(Scalar);
+        for (unsigned int ghost_idx = 0; ghost_idx < n_send; ghost_idx++)
+            {
+            const unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+            std::memcpy(payload + ghost_idx * sizeof(Scalar4), &h_pos.data[idx], sizeof(Scalar4));
+            }
+        return;
+        }
+
+    m_pos_delta_sendbuf.resize(sizeof(Scalar) + n_send * 3 * sizeof(int16_t));
+    std::memcpy(m_pos_delta_sendbuf.data(), &scale, sizeof(Scalar));
+    char* payload = m_pos_delta_sendbuf.data() + sizeof(Scalar);
+    const Scalar inv_step = (scale > Scalar(0.0)) ? Scalar(32767.0) / scale : Scalar(0.0);
+    for (unsigned int ghost_idx = 0; ghost_idx < n_send; ghost_idx++)
+        {
+        const Scalar4 postype = h_pos.data[h_rtag.data[h_copy_ghosts.data[ghost_idx]]];
+        const Scalar3 delta = global_box.minImage(
+            make_scalar3(postype.x - ref[ghost_idx].x,
+                         postype.y - ref[ghost_idx].y,
+                         postype.z - ref[ghost_idx].z));
+        const int16_t q[3] = {int16_t(lrint(delta.x * inv_step)),
+                              int16_t(lrint(delta.y * inv_step)),
+                              int16_t(lrint(delta.z * inv_step))};
+        std::memcpy(payload + ghost_idx * sizeof(q), q, sizeof(q));
+        }
+    }
+
+/*! \param start_idx Index of the first ghost received
+    \param n_recv Number of ghosts received
+
+    Decode the message packed by packGhostPositionDeltas() into the particle data. The received
+    positions are wrapped into the shifted box afterwards, like full precision updates.
+*/
+void Communicator::unpackGhostPositionDeltas(unsigned int start_idx, unsigned int n_recv)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+
+    Scalar scale;
+    std::memcpy(&scale, m_pos_delta_recvbuf.data(), sizeof(Scalar));
+    const char* payload = m_pos_delta_recvbuf.data() + sizeof(Scalar);
+
+    if (scale < Scalar(0.0))
+        {
+        if (m_sort_ghosts)
+            {
+            std::memcpy(m_ghost_pos_recvbuf.data(), payload, n_recv * sizeof(Scalar4));
+            scatterGhosts(h_pos.data, m_ghost_pos_recvbuf.data(), start_idx, n_recv);
+            }
+        else
+            {
+            std::memcpy(h_pos.data + start_idx, payload, n_recv * sizeof(Scalar4));
+            }
+        return;
+        }
+
+    const unsigned int ref_offset = start_idx - m_pdata->getN();
+    const Scalar step = scale / Scalar(32767.0);
+    for (unsigned int i = 0; i < n_recv; i++)
+        {
+        int16_t q[3];
+        std::memcpy(q, payload + i * sizeof(q), sizeof(q));
+        const Scalar4& ref = m_ghost_ref_pos_recv[ref_offset + i];
+        h_pos.data[getGhostIndex(start_idx + i)] = make_scalar4(ref.x + Scalar(q[0]) * step,
+                                                                ref.y + Scalar(q[1]) * step,
+                                                                ref.z + Scalar(q[2]) * step,
+                                                                ref.w);
+        }
+    }
+
+/*! \param dir Direction of the messages
+    \param messages Sends and receives of the ghost update in this direction
+    \param n_messages Number of messages
+
+    The ghost update messages only change at ghost exchanges (and when particle data arrays are
+    reallocated), so the requests are created once with MPI_Send_init and MPI_Recv_init and
+    restarted at every update. Compressed position messages change size at every update and are
+    posted as regular nonblocking requests.
+*/
+void Communicator::startGhostUpdateMessages(unsigned int dir,
+                                            const GhostUpdateMessage* messages,
+                                            unsigned int n_messages)
+    {
+    if (m_compress_ghost_updates)
+        {
+        m_reqs.resize(n_messages);
+        for (unsigned int i = 0; i < n_messages; i++)
+            {
+            const GhostUpdateMessage& m = messages[i];
+            if (m.send)
+                MPI_Isend(m.buf, m.bytes, MPI_BYTE, m.peer, m.tag, m_mpi_comm, &m_reqs[i]);
+            else
+                MPI_Irecv(m.buf, m.bytes, MPI_BYTE, m.peer, m.tag, m_mpi_comm, &m_reqs[i]);
+            }
+        m_pending_persistent = false;
+        return;
+        }
+
+    std::vector<GhostUpdateMessage>& cached = m_ghost_update_messages[dir];
+    std::vector<MPI_Request>& reqs = m_ghost_update_reqs[dir];
+    if (!std::equal(messages, messages + n_messages, cached.begin(), cached.end()))
+        {
+        freeGhostUpdateRequests(dir);
+
+        cached.assign(messages, messages + n_messages);
+        reqs.resize(n_messages);
+        for (unsigned int i = 0; i < n_messages; i++)
+            {
+            const GhostUpdateMessage& m = messages[i];
+            if (m.send)
+                MPI_Send_init(m.buf, m.bytes, MPI_BYTE, m.peer, m.tag, m_mpi_comm, &reqs[i]);
+            else
+                MPI_Recv_init(m.buf, m.bytes, MPI_BYTE, m.peer, m.tag, m_mpi_comm, &reqs[i]);
+            }
+        }
+
+    if (n_messages > 0)
+        MPI_Startall(n_messages, reqs.data());
+    m_pending_persistent = true;
+    }
+
+/*! \param dir Direction of the requests to free
+ */
+void Communicator::freeGhostUpdateRequests(unsigned int dir)
+    {
+    for (MPI_Request& req : m_ghost_update_reqs[dir])
+        {
+        MPI_Request_free(&req);
+        }
+    m_ghost_update_reqs[dir].clear();
+    m_ghost_update_messages[dir].clear();
     }
 
 //! update positions of ghost particles
@@ -2643,7 +3324,11 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
         CommFlags flags = getFlags();
 
-        if (flags[comm_flag::position])
+        if (flags[comm_flag::position] && m_compress_ghost_updates)
+            {
+            packGhostPositionDeltas(dir);
+            }
+        else if (flags[comm_flag::position])
             {
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
@@ -2741,11 +3426,27 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
         // only non-permanent fields (position, velocity, orientation) need to be considered here
         // charge, body, image and diameter are not updated between neighbor list builds
-        if (flags[comm_flag::position])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+        GhostUpdateMessage messages[6];
+        unsigned int n_messages = 0;
+        auto add_messages
+            = [&](void* send_buf, int send_bytes, void* recv_buf, int recv_bytes, int tag)
+        {
+            messages[n_messages++] = {send_buf, send_bytes, int(send_neighbor), tag, true};
+            messages[n_messages++] = {recv_buf, recv_bytes, int(recv_neighbor), tag, false};
+        };
 
+        if (flags[comm_flag::position] && m_compress_ghost_updates)
+            {
+            // the message size depends on the encoding, post a receive for the largest one
+            m_pos_delta_recvbuf.resize(sizeof(Scalar) + m_num_recv_ghosts[dir] * sizeof(Scalar4));
+            add_messages(m_pos_delta_sendbuf.data(),
+                         (int)m_pos_delta_sendbuf.size(),
+                         m_pos_delta_recvbuf.data(),
+                         (int)m_pos_delta_recvbuf.size(),
+                         1);
+            }
+        else if (flags[comm_flag::position])
+            {
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::readwrite);
@@ -2753,29 +3454,19 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                                access_location::host,
                                                access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            // exchange particle data, write directly to the particle data arrays unless sorted
+            Scalar4* recv_buf = m_sort_ghosts
+                                    ? m_ghost_pos_recvbuf.data() + (start_idx - m_pdata->getN())
+                                    : h_pos.data + start_idx;
+            add_messages(h_pos_copybuf.data,
+                         (int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
+                         recv_buf,
+                         (int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
+                         1);
             }
 
         if (flags[comm_flag::velocity])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
             ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
                                        access_location::host,
                                        access_mode::readwrite);
@@ -2783,29 +3474,19 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                                access_location::host,
                                                access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            // exchange particle data, write directly to the particle data arrays unless sorted
+            Scalar4* recv_buf
+                = m_sort_ghosts ? m_ghost_velocity_recvbuf.data() + (start_idx - m_pdata->getN())
+                                : h_vel.data + start_idx;
+            add_messages(h_vel_copybuf.data,
+                         (int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
+                         recv_buf,
+                         (int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
+                         2);
             }
 
         if (flags[comm_flag::orientation])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
             ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                                access_location::host,
                                                access_mode::readwrite);
@@ -2813,43 +3494,121 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                                        access_location::host,
                                                        access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            // exchange particle data, write directly to the particle data arrays unless sorted
+            Scalar4* recv_buf = m_sort_ghosts ? m_ghost_orientation_recvbuf.data()
+                                                    + (start_idx - m_pdata->getN())
+                                              : h_orientation.data + start_idx;
+            add_messages(h_orientation_copybuf.data,
+                         (int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
+                         recv_buf,
+                         (int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
+                         3);
             }
 
-        // wrap particle positions (only if copying positions)
-        if (flags[comm_flag::position])
+        startGhostUpdateMessages(dir, messages, n_messages);
+
+        m_pending_dir = dir;
+        m_pending_start_idx = start_idx;
+        m_n_pending_reqs = n_messages;
+        m_comm_pending = true;
+
+        // Later directions forward the ghosts received in this one. Leave the last direction in
+        // flight so that local computations overlap with it (see finishUpdateGhosts()).
+        bool last_dir = true;
+        for (unsigned int next_dir = dir + 1; next_dir < 6; next_dir++)
+            {
+            if (isCommunicating(next_dir))
+                {
+                last_dir = false;
+                }
+            }
+
+        if (!last_dir)
+            {
+            Communicator::finishUpdateGhosts(timestep);
+            }
+        } // end dir loop
+    }
+
+/*! Wait for the ghost data of the last direction exchanged by beginUpdateGhosts() and wrap the
+    received positions.
+
+    \param timestep The time step
+*/
+void Communicator::finishUpdateGhosts(uint64_t timestep)
+    {
+    if (!m_comm_pending)
+        {
+        return;
+        }
+
+    MPI_Request* reqs = m_pending_persistent ? m_ghost_update_reqs[m_pending_dir].data()
+                                             : m_reqs.data();
+    m_stats.resize(m_n_pending_reqs);
+    MPI_Waitall(m_n_pending_reqs, reqs, m_stats.data());
+    m_comm_pending = false;
+
+    const CommFlags flags = getFlags();
+    const unsigned int n_recv = m_num_recv_ghosts[m_pending_dir];
+
+    // move the data received in arrival order to the sorted ghosts
+    if (m_sort_ghosts)
+        {
+        const unsigned int offset = m_pending_start_idx - m_pdata->getN();
+        if (flags[comm_flag::position] && !m_compress_ghost_updates)
             {
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::readwrite);
+            scatterGhosts(h_pos.data,
+                          m_ghost_pos_recvbuf.data() + offset,
+                          m_pending_start_idx,
+                          n_recv);
+            }
+        if (flags[comm_flag::velocity])
+            {
+            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+            scatterGhosts(h_vel.data,
+                          m_ghost_velocity_recvbuf.data() + offset,
+                          m_pending_start_idx,
+                          n_recv);
+            }
+        if (flags[comm_flag::orientation])
+            {
+            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                               access_location::host,
+                                               access_mode::readwrite);
+            scatterGhosts(h_orientation.data,
+                          m_ghost_orientation_recvbuf.data() + offset,
+                          m_pending_start_idx,
+                          n_recv);
+            }
+        }
 
-            const BoxDim shifted_box = getShiftedBox();
-            for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
-                {
-                Scalar4& pos = h_pos.data[idx];
-
-                // wrap particles received across a global boundary
-                int3 img = make_int3(0, 0, 0);
-                shifted_box.wrap(pos, img);
-                }
+    // wrap particle positions (only if copying positions)
+    if (flags[comm_flag::position])
+        {
+        if (m_compress_ghost_updates)
+            {
+            unpackGhostPositionDeltas(m_pending_start_idx, n_recv);
             }
 
-        } // end dir loop
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+
+        const BoxDim shifted_box = getShiftedBox();
+        for (unsigned int idx = m_pending_start_idx; idx < m_pending_start_idx + n_recv; idx++)
+            {
+            Scalar4& pos = h_pos.data[getGhostIndex(idx)];
+
+            // wrap particles received across a global boundary
+            int3 img = make_int3(0, 0, 0);
+            shifted_box.wrap(pos, img);
+            }
+        }
     }
 
 void Communicator::updateNetForce(uint64_t timestep)
@@ -3098,7 +3857,7 @@ void Communicator::updateNetForce(uint64_t timestep)
                                                     access_location::host,
                                                     access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
+            // exchange particle data, write directly to the particle data arrays unless sorted
             MPI_Isend(h_netforce_copybuf.data,
                       (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
                       MPI_BYTE,
@@ -3106,7 +3865,7 @@ void Communicator::updateNetForce(uint64_t timestep)
                       1,
                       m_mpi_comm,
                       &m_reqs[0]);
-            MPI_Irecv(h_netforce.data + start_idx,
+            MPI_Irecv(m_sort_ghosts ? m_ghost_force_recvbuf.data() : h_netforce.data + start_idx,
                       (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
                       MPI_BYTE,
                       recv_neighbor,
@@ -3114,6 +3873,14 @@ void Communicator::updateNetForce(uint64_t timestep)
                       m_mpi_comm,
                       &m_reqs[1]);
             MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+
+            if (m_sort_ghosts)
+                {
+                scatterGhosts(h_netforce.data,
+                              m_ghost_force_recvbuf.data(),
+                              start_idx,
+                              m_num_recv_ghosts[dir]);
+                }
             }
 
         // We add new particle data for reverse ghosts after the particle data already received, so
@@ -3214,7 +3981,7 @@ void Communicator::updateNetForce(uint64_t timestep)
                       2,
                       m_mpi_comm,
                       &m_reqs[0]);
-            MPI_Irecv(h_nettorque.data + start_idx,
+            MPI_Irecv(m_sort_ghosts ? m_ghost_force_recvbuf.data() : h_nettorque.data + start_idx,
                       (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
                       MPI_BYTE,
                       recv_neighbor,
@@ -3222,6 +3989,14 @@ void Communicator::updateNetForce(uint64_t timestep)
                       m_mpi_comm,
                       &m_reqs[1]);
             MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+
+            if (m_sort_ghosts)
+                {
+                scatterGhosts(h_nettorque.data,
+                              m_ghost_force_recvbuf.data(),
+                              start_idx,
+                              m_num_recv_ghosts[dir]);
+                }
             }
 
         if (flags[comm_flag::net_virial])
@@ -3268,12 +4043,13 @@ void Communicator::updateNetForce(uint64_t timestep)
 
             for (unsigned int i = 0; i < m_num_recv_ghosts[dir]; ++i)
                 {
-                h_netvirial.data[0 * pitch + start_idx + i] = h_netvirial_recvbuf.data[6 * i + 0];
-                h_netvirial.data[1 * pitch + start_idx + i] = h_netvirial_recvbuf.data[6 * i + 1];
-                h_netvirial.data[2 * pitch + start_idx + i] = h_netvirial_recvbuf.data[6 * i + 2];
-                h_netvirial.data[3 * pitch + start_idx + i] = h_netvirial_recvbuf.data[6 * i + 3];
-                h_netvirial.data[4 * pitch + start_idx + i] = h_netvirial_recvbuf.data[6 * i + 4];
-                h_netvirial.data[5 * pitch + start_idx + i] = h_netvirial_recvbuf.data[6 * i + 5];
+                const unsigned int idx = getGhostIndex(start_idx + i);
+                h_netvirial.data[0 * pitch + idx] = h_netvirial_recvbuf.data[6 * i + 0];
+                h_netvirial.data[1 * pitch + idx] = h_netvirial_recvbuf.data[6 * i + 1];
+                h_netvirial.data[2 * pitch + idx] = h_netvirial_recvbuf.data[6 * i + 2];
+                h_netvirial.data[3 * pitch + idx] = h_netvirial_recvbuf.data[6 * i + 3];
+                h_netvirial.data[4 * pitch + idx] = h_netvirial_recvbuf.data[6 * i + 4];
+                h_netvirial.data[5 * pitch + idx] = h_netvirial_recvbuf.data[6 * i + 5];
                 }
             }
         } // end dir loop
@@ -3408,6 +4184,15 @@ void export_Communicator(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<DomainDecomposition>>())
         .def("addMeshDefinition", &Communicator::addMeshDefinition)
+        .def("getMigrateProfileTimer",
+             &Communicator::getMigrateProfileTimer,
+             pybind11::return_value_policy::reference_internal)
+        .def("getGhostExchangeProfileTimer",
+             &Communicator::getGhostExchangeProfileTimer,
+             pybind11::return_value_policy::reference_internal)
+        .def("getGhostUpdateProfileTimer",
+             &Communicator::getGhostUpdateProfileTimer,
+             pybind11::return_value_policy::reference_internal)
         .def_property_readonly("domain_decomposition", &Communicator::getDomainDecomposition);
     }
     } // end namespace detail
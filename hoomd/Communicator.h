@@ -17,9 +17,11 @@
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "ParticleData.h"
+#include "Profiler.h"
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <unordered_map>
 
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
@@ -177,6 +179,19 @@ class PYBIND11_EXPORT Communicator
         return m_ghost_layer_width_requests;
         }
 
+    //! Subscribe to list of functions that request a minimum ghost layer width for pairs of types
+    /*! Requests are made for the particles of \a type_i that interact with particles of \a type_j.
+     * A particle is only sent toward a neighboring domain when a type it interacts with is present
+     * across that face, so a rarely present type with a long cutoff does not widen the ghost layer
+     * of every rank.
+     * \return A connection to the present class
+     */
+    Nano::Signal<Scalar(unsigned int type_i, unsigned int type_j)>&
+    getGhostLayerPairWidthRequestSignal()
+        {
+        return m_ghost_layer_pair_width_requests;
+        }
+
     //! Subscribe to list of functions that request a minimum ghost layer width for rigid bodies.
     /*! This method keeps track of all functions that request a minimum ghost layer width.
      * The actual ghost layer width is chosen from the max over the inputs, which is a function
@@ -230,6 +245,19 @@ class PYBIND11_EXPORT Communicator
         return m_compute_callbacks;
         }
 
+    //! Subscribe to list of call-backs that compute while the ghost update is in flight
+    /*!
+     * Subscribers are called between beginUpdateGhosts() and finishUpdateGhosts(). They may read
+     * and write data of local particles only: ghost particle data is not valid until the ghost
+     * update completes.
+     *
+     * \return A Nano::Signal object reference to be used for connect and disconnect calls.
+     */
+    Nano::Signal<void(uint64_t timestep)>& getLocalComputeCallbackSignal()
+        {
+        return m_local_compute_callbacks;
+        }
+
     //! Get the ghost communication flags
     CommFlags getFlags()
         {
@@ -254,6 +282,15 @@ class PYBIND11_EXPORT Communicator
         return m_r_ghost;
         }
 
+    //! Get the current ghost layer width array of each type toward each direction
+    /*! The width of type \a i toward direction \a dir (0: east, 1: west, 2: north, 3: south,
+     * 4: up, 5: down) is the element dir * n_types + i.
+     */
+    const GPUArray<Scalar>& getGhostLayerWidthByDirection() const
+        {
+        return m_r_ghost_dir;
+        }
+
     //! Get the current maximum ghost layer width
     Scalar getGhostLayerMaxWidth() const
         {
@@ -294,6 +331,29 @@ class PYBIND11_EXPORT Communicator
 
     //@}
 
+    //! \name profiling
+    //@{
+
+    //! Get the wall clock time statistics of particle migration
+    ProfileTimer& getMigrateProfileTimer()
+        {
+        return m_migrate_timer;
+        }
+
+    //! Get the wall clock time statistics of ghost particle exchange
+    ProfileTimer& getGhostExchangeProfileTimer()
+        {
+        return m_ghost_exchange_timer;
+        }
+
+    //! Get the wall clock time statistics of ghost particle updates
+    ProfileTimer& getGhostUpdateProfileTimer()
+        {
+        return m_ghost_update_timer;
+        }
+
+    //@}
+
     //! Force particle migration
     void forceMigrate()
         {
@@ -321,11 +381,7 @@ class PYBIND11_EXPORT Communicator
      *
      * \param timestep The time step
      */
-    virtual void finishUpdateGhosts(uint64_t timestep)
-        {
-        // the base class implementation is currently empty
-        m_comm_pending = false;
-        }
+    virtual void finishUpdateGhosts(uint64_t timestep);
 
     /*! Communicate the net particle force
      * \parm timestep The time step
@@ -430,10 +486,31 @@ class PYBIND11_EXPORT Communicator
         void exchangeGhostGroups(const GPUArray<unsigned int>& plans, unsigned int mask);
 
         private:
+        //! Rebuild the table of local groups by member particle tag
+        void rebuildMemberTable();
+
+        //! Find the local groups that have a member with a nonzero flag
+        /*! \param h_flags Per-particle flags (indexed by particle index)
+         *  \param n_particles Number of particles to check
+         *  \param groups Output list of local group indices, in ascending order
+         */
+        void findFlaggedGroups(const unsigned int* h_flags,
+                               unsigned int n_particles,
+                               std::vector<unsigned int>& groups);
+
         Communicator& m_comm;                                      //!< The outer class
         std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //< The execution configuration
         std::shared_ptr<group_data> m_gdata;                       //!< The group data
 
+        /// Tags of the local groups that each particle (by tag) is a member of
+        std::unordered_multimap<unsigned int, unsigned int> m_member_groups;
+
+        /// True when m_member_groups lists all local groups
+        bool m_member_table_valid = false;
+
+        std::vector<unsigned int> m_flagged_groups; //!< Groups found by findFlaggedGroups()
+        std::vector<unsigned int> m_removed_groups; //!< Local groups removed during migration
+
         std::vector<rank_element_t> m_ranks_sendbuf; //!< Send buffer for rank elements
         std::vector<rank_element_t> m_ranks_recvbuf; //!< Receive buffer for rank elements
 
@@ -507,6 +584,29 @@ class PYBIND11_EXPORT Communicator
         m_num_copy_ghosts[6]; //!< Number of local particles that are sent to neighboring processors
     unsigned int m_num_recv_ghosts[6]; //!< Number of ghosts received per direction
 
+    /// True when ghost position updates are sent as quantized displacements
+    bool m_compress_ghost_updates = false;
+
+    /// Positions of the ghosts sent in each direction at the last ghost exchange
+    std::vector<Scalar4> m_ghost_ref_pos_send[6];
+
+    /// Positions of the ghosts received at the last ghost exchange
+    std::vector<Scalar4> m_ghost_ref_pos_recv;
+
+    std::vector<char> m_pos_delta_sendbuf; //!< Send buffer for compressed ghost positions
+    std::vector<char> m_pos_delta_recvbuf; //!< Receive buffer for compressed ghost positions
+
+    /// True when the ghosts of the last ghost exchange are sorted by cell
+    bool m_sort_ghosts = false;
+
+    /// Particle index of each ghost in the order the ghosts arrived at the last ghost exchange
+    std::vector<unsigned int> m_ghost_arrival_idx;
+
+    std::vector<Scalar4> m_ghost_pos_recvbuf;         //!< Ghost positions in arrival order
+    std::vector<Scalar4> m_ghost_velocity_recvbuf;    //!< Ghost velocities in arrival order
+    std::vector<Scalar4> m_ghost_orientation_recvbuf; //!< Ghost orientations in arrival order
+    std::vector<Scalar4> m_ghost_force_recvbuf;       //!< Ghost net forces or torques
+
     GPUVector<unsigned int>
         m_plan; //!< Array of per-direction flags that determine the sending route
 
@@ -557,14 +657,83 @@ class PYBIND11_EXPORT Communicator
     GPUArray<Scalar> m_r_ghost_body; //!< Extra ghost width for rigid bodies
     Scalar m_r_ghost_max;            //!< Maximum ghost layer width
 
+    GPUArray<Scalar> m_r_ghost_dir;     //!< Width of ghost layer of each type toward each direction
+    std::vector<Scalar> m_r_ghost_type; //!< Ghost width requested for each type
+    std::vector<Scalar> m_r_ghost_pair; //!< Ghost width requested for each pair of types
+
     unsigned int m_ghosts_added; //!< Number of ghosts added
     bool m_has_ghost_particles;  //!< True if we have a current copy of ghost particles
 
+    ProfileTimer m_migrate_timer;        //!< Time spent in migrateParticles()
+    ProfileTimer m_ghost_exchange_timer; //!< Time spent in exchangeGhosts()
+    ProfileTimer m_ghost_update_timer;   //!< Time spent in begin/finishUpdateGhosts()
+
     MPI_Datatype m_mpi_pdata_element; //!< A datatype for the (non-packed) pdata_element struct
 
     //! Update the ghost width array
     void updateGhostWidth();
 
+    //! Update the ghost width of each type toward each direction
+    void updateGhostWidthByDirection();
+
+    //! Buffer, size, and peer of one message of a ghost update
+    struct GhostUpdateMessage
+        {
+        void* buf;  //!< Send or receive buffer
+        int bytes;  //!< Size of the message
+        int peer;   //!< Rank to send to or receive from
+        int tag;    //!< Message tag
+        bool send;  //!< True for sends, false for receives
+
+        bool operator==(const GhostUpdateMessage& other) const
+            {
+            return buf == other.buf && bytes == other.bytes && peer == other.peer
+                   && tag == other.tag && send == other.send;
+            }
+        };
+
+    //! Start the messages of a ghost update in one direction
+    void startGhostUpdateMessages(unsigned int dir,
+                                  const GhostUpdateMessage* messages,
+                                  unsigned int n_messages);
+
+    //! Free the persistent ghost update requests of one direction
+    void freeGhostUpdateRequests(unsigned int dir);
+
+    //! Store the ghost positions sent and received by exchangeGhosts() for compressed updates
+    void storeGhostReferencePositions();
+
+    //! Pack the displacements of the ghosts sent in a direction into m_pos_delta_sendbuf
+    void packGhostPositionDeltas(unsigned int dir);
+
+    //! Unpack the ghost positions received in m_pos_delta_recvbuf
+    void unpackGhostPositionDeltas(unsigned int start_idx, unsigned int n_recv);
+
+    //! Sort the ghost particles received by exchangeGhosts() by cell
+    void sortGhosts();
+
+    //! Get the particle index of a ghost
+    /*! \param idx Index the ghost would have in arrival order (N + position in arrival order)
+        \returns The index of the ghost in the particle data
+    */
+    unsigned int getGhostIndex(unsigned int idx) const
+        {
+        return m_sort_ghosts ? m_ghost_arrival_idx[idx - m_pdata->getN()] : idx;
+        }
+
+    //! Write ghost data received in arrival order to the sorted ghosts
+    /*! \param data Particle data array
+        \param recv Received data of the ghosts start_idx to start_idx + n_recv - 1 in arrival order
+        \param start_idx Index of the first ghost in arrival order
+        \param n_recv Number of ghosts received
+    */
+    template<class T>
+    void scatterGhosts(T* data, const T* recv, unsigned int start_idx, unsigned int n_recv) const
+        {
+        for (unsigned int i = 0; i < n_recv; i++)
+            data[getGhostIndex(start_idx + i)] = recv[i];
+        }
+
     Nano::Signal<bool(uint64_t timestep)>
         m_migrate_requests; //!< List of functions that may request particle migration
 
@@ -575,21 +744,38 @@ class PYBIND11_EXPORT Communicator
         m_ghost_layer_width_requests; //!< List of functions that request a minimum ghost layer
                                       //!< width
 
+    /// List of functions that request a ghost layer width for pairs of types.
+    Nano::Signal<Scalar(unsigned int type_i, unsigned int type_j)>
+        m_ghost_layer_pair_width_requests;
+
     /// List of functions that compute the body ghost layer width.
     Nano::Signal<Scalar(unsigned int type, Scalar* h_r_ghost)> m_body_ghost_layer_width_requests;
 
     Nano::Signal<void(uint64_t timestep)>
         m_compute_callbacks; //!< List of functions that are called after ghost communication
 
+    /// List of functions that are called while the ghost update is in flight
+    Nano::Signal<void(uint64_t timestep)> m_local_compute_callbacks;
+
     Nano::Signal<void(const GPUArray<unsigned int>&)>
         m_comm_callbacks; //!< List of functions that are called after the compute callbacks
 
     CommFlags m_flags;      //!< The ghost communication flags
     CommFlags m_last_flags; //!< Flags of last ghost exchange
 
-    bool m_comm_pending;             //!< If true, a communication is in process
-    std::vector<MPI_Request> m_reqs; //!< Container for all MPI communication requests
-    std::vector<MPI_Status> m_stats; //!< Container for all MPI communication statuses
+    bool m_comm_pending;              //!< If true, a communication is in process
+    unsigned int m_pending_dir;       //!< Direction of the ghost update in process
+    unsigned int m_pending_start_idx; //!< First ghost index received in m_pending_dir
+    unsigned int m_n_pending_reqs;    //!< Number of requests in process
+    bool m_pending_persistent = false; //!< True when the requests in process are persistent
+
+    /// Persistent requests for the ghost updates in each direction
+    std::vector<MPI_Request> m_ghost_update_reqs[6];
+
+    /// Messages that the persistent requests in each direction were created for
+    std::vector<GhostUpdateMessage> m_ghost_update_messages[6];
+    std::vector<MPI_Request> m_reqs;  //!< Container for all MPI communication requests
+    std::vector<MPI_Status> m_stats;  //!< Container for all MPI communication statuses
 
     /* Bonds communication */
     bool m_bonds_changed; //!< True if bond information needs to be refreshed
@@ -1955,11 +1955,15 @@ void CommunicatorGPU::migrateParticles()
                                                          access_location::host,
                                                          access_mode::read);
             ArrayHandle<detail::pdata_element> gpu_sendbuf_handle(m_gpu_sendbuf,
-                                                                  access_location::host,
+                                                                  getMPIBufferLocation(),
                                                                   access_mode::read);
             ArrayHandle<detail::pdata_element> gpu_recvbuf_handle(m_gpu_recvbuf,
-                                                                  access_location::host,
+                                                                  getMPIBufferLocation(),
                                                                   access_mode::overwrite);
+
+            // the packing kernels must complete before MPI reads the device buffers
+            if (m_exec_conf->isGPUAwareMPIEnabled())
+                hipDeviceSynchronize();
             std::vector<MPI_Request> reqs;
             MPI_Request req;
 
@@ -2063,6 +2067,7 @@ void CommunicatorGPU::exchangeGhosts()
 
     // update the subscribed ghost layer width
     updateGhostWidth();
+    updateGhostWidthByDirection();
 
     // resize arrays
     m_n_send_ghosts.resize(m_num_stages);
@@ -2106,7 +2111,9 @@ void CommunicatorGPU::exchangeGhosts()
                                                    access_location::device,
                                                    access_mode::overwrite);
 
-            ArrayHandle<Scalar> d_r_ghost(m_r_ghost, access_location::device, access_mode::read);
+            ArrayHandle<Scalar> d_r_ghost_dir(m_r_ghost_dir,
+                                              access_location::device,
+                                              access_mode::read);
             ArrayHandle<Scalar> d_r_ghost_body(m_r_ghost_body,
                                                access_location::device,
                                                access_mode::read);
@@ -2116,7 +2123,7 @@ void CommunicatorGPU::exchangeGhosts()
                                          d_pos.data,
                                          d_body.data,
                                          m_pdata->getBox(),
-                                         d_r_ghost.data,
+                                         d_r_ghost_dir.data,
                                          d_r_ghost_body.data,
                                          m_r_ghost_max,
                                          m_pdata->getNTypes(),
@@ -2483,53 +2490,53 @@ void CommunicatorGPU::exchangeGhosts()
             unsigned int offs = 0;
             // recv buffers
             ArrayHandleAsync<unsigned int> tag_ghost_recvbuf_handle(m_tag_ghost_recvbuf,
-                                                                    access_location::host,
+                                                                    getMPIBufferLocation(),
                                                                     access_mode::overwrite);
             ArrayHandleAsync<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
-                                                               access_location::host,
+                                                               getMPIBufferLocation(),
                                                                access_mode::overwrite);
             ArrayHandleAsync<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
-                                                               access_location::host,
+                                                               getMPIBufferLocation(),
                                                                access_mode::overwrite);
             ArrayHandleAsync<Scalar> charge_ghost_recvbuf_handle(m_charge_ghost_recvbuf,
-                                                                 access_location::host,
+                                                                 getMPIBufferLocation(),
                                                                  access_mode::overwrite);
             ArrayHandleAsync<unsigned int> body_ghost_recvbuf_handle(m_body_ghost_recvbuf,
-                                                                     access_location::host,
+                                                                     getMPIBufferLocation(),
                                                                      access_mode::overwrite);
             ArrayHandleAsync<int3> image_ghost_recvbuf_handle(m_image_ghost_recvbuf,
-                                                              access_location::host,
+                                                              getMPIBufferLocation(),
                                                               access_mode::overwrite);
             ArrayHandleAsync<Scalar> diameter_ghost_recvbuf_handle(m_diameter_ghost_recvbuf,
-                                                                   access_location::host,
+                                                                   getMPIBufferLocation(),
                                                                    access_mode::overwrite);
             ArrayHandleAsync<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
-                                                                       access_location::host,
+                                                                       getMPIBufferLocation(),
                                                                        access_mode::overwrite);
             // send buffers
             ArrayHandleAsync<unsigned int> tag_ghost_sendbuf_handle(m_tag_ghost_sendbuf,
-                                                                    access_location::host,
+                                                                    getMPIBufferLocation(),
                                                                     access_mode::read);
             ArrayHandleAsync<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
-                                                               access_location::host,
+                                                               getMPIBufferLocation(),
                                                                access_mode::read);
             ArrayHandleAsync<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
-                                                               access_location::host,
+                                                               getMPIBufferLocation(),
                                                                access_mode::read);
             ArrayHandleAsync<Scalar> charge_ghost_sendbuf_handle(m_charge_ghost_sendbuf,
-                                                                 access_location::host,
+                                                                 getMPIBufferLocation(),
                                                                  access_mode::read);
             ArrayHandleAsync<unsigned int> body_ghost_sendbuf_handle(m_body_ghost_sendbuf,
-                                                                     access_location::host,
+                                                                     getMPIBufferLocation(),
                                                                      access_mode::read);
             ArrayHandleAsync<int3> image_ghost_sendbuf_handle(m_image_ghost_sendbuf,
-                                                              access_location::host,
+                                                              getMPIBufferLocation(),
                                                               access_mode::read);
             ArrayHandleAsync<Scalar> diameter_ghost_sendbuf_handle(m_diameter_ghost_sendbuf,
-                                                                   access_location::host,
+                                                                   getMPIBufferLocation(),
                                                                    access_mode::read);
             ArrayHandleAsync<Scalar4> orientation_ghost_sendbuf_handle(m_orientation_ghost_sendbuf,
-                                                                       access_location::host,
+                                                                       getMPIBufferLocation(),
                                                                        access_mode::read);
 
             // lump together into one synchronization call
@@ -3013,24 +3020,24 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             // access particle data
             // recv buffers
             ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
-                                                          access_location::host,
+                                                          getMPIBufferLocation(),
                                                           access_mode::overwrite);
             ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
-                                                          access_location::host,
+                                                          getMPIBufferLocation(),
                                                           access_mode::overwrite);
             ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
-                                                                  access_location::host,
+                                                                  getMPIBufferLocation(),
                                                                   access_mode::overwrite);
 
             // send buffers
             ArrayHandleAsync<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
-                                                               access_location::host,
+                                                               getMPIBufferLocation(),
                                                                access_mode::read);
             ArrayHandleAsync<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
-                                                               access_location::host,
+                                                               getMPIBufferLocation(),
                                                                access_mode::read);
             ArrayHandleAsync<Scalar4> orientation_ghost_sendbuf_handle(m_orientation_ghost_sendbuf,
-                                                                       access_location::host,
+                                                                       getMPIBufferLocation(),
                                                                        access_mode::read);
 
             ArrayHandleAsync<unsigned int> h_unique_neighbors(m_unique_neighbors,
@@ -3460,24 +3467,24 @@ void CommunicatorGPU::updateNetForce(uint64_t timestep)
             unsigned int offs = 0;
             // recv buffer
             ArrayHandle<Scalar4> h_netforce_ghost_recvbuf(m_netforce_ghost_recvbuf,
-                                                          access_location::host,
+                                                          getMPIBufferLocation(),
                                                           access_mode::overwrite);
             ArrayHandle<Scalar4> h_nettorque_ghost_recvbuf(m_nettorque_ghost_recvbuf,
-                                                           access_location::host,
+                                                           getMPIBufferLocation(),
                                                            access_mode::overwrite);
             ArrayHandle<Scalar> h_netvirial_ghost_recvbuf(m_netvirial_ghost_recvbuf,
-                                                          access_location::host,
+                                                          getMPIBufferLocation(),
                                                           access_mode::overwrite);
 
             // send buffer
             ArrayHandle<Scalar4> h_netforce_ghost_sendbuf(m_netforce_ghost_sendbuf,
-                                                          access_location::host,
+                                                          getMPIBufferLocation(),
                                                           access_mode::read);
             ArrayHandle<Scalar4> h_nettorque_ghost_sendbuf(m_nettorque_ghost_sendbuf,
-                                                           access_location::host,
+                                                           getMPIBufferLocation(),
                                                            access_mode::read);
             ArrayHandle<Scalar> h_netvirial_ghost_sendbuf(m_netvirial_ghost_sendbuf,
-                                                          access_location::host,
+                                                          getMPIBufferLocation(),
                                                           access_mode::read);
 
             ArrayHandleAsync<unsigned int> h_unique_neighbors(m_unique_neighbors,
@@ -3486,6 +3493,9 @@ void CommunicatorGPU::updateNetForce(uint64_t timestep)
             ArrayHandleAsync<unsigned int> h_ghost_begin(m_ghost_begin,
                                                          access_location::host,
                                                          access_mode::read);
+            // the packing kernels must complete before MPI reads the device buffers
+            if (m_exec_conf->isGPUAwareMPIEnabled())
+                hipDeviceSynchronize();
 
             // access send buffers
             m_reqs.clear();
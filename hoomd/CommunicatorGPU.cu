@@ -308,7 +308,7 @@ __global__ void gpu_make_ghost_exchange_plan_kernel(unsigned int N,
                                                     const unsigned int* d_body,
                                                     unsigned int* d_plan,
                                                     const BoxDim box,
-                                                    const Scalar* d_r_ghost,
+                                                    const Scalar* d_r_ghost_dir,
                                                     const Scalar* d_r_ghost_body,
                                                     Scalar r_ghost_max,
                                                     unsigned int ntypes,
@@ -324,31 +324,33 @@ __global__ void gpu_make_ghost_exchange_plan_kernel(unsigned int N,
     Scalar4 postype = d_postype[idx];
     Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
     const unsigned int type = __scalar_as_int(postype.w);
-    Scalar ghost_width = __ldg(d_r_ghost + type);
 
-    if (d_body[idx] < MIN_FLOPPY)
+    Scalar ghost_width[6];
+    for (unsigned int dir = 0; dir < 6; dir++)
         {
-        ghost_width = max(ghost_width, __ldg(d_r_ghost_body + type));
+        ghost_width[dir] = __ldg(d_r_ghost_dir + dir * ntypes + type);
+        if (d_body[idx] < MIN_FLOPPY)
+            {
+            ghost_width[dir] = max(ghost_width[dir], __ldg(d_r_ghost_body + type));
+            }
         }
 
-    Scalar3 ghost_fraction = ghost_width / npd;
-
     Scalar3 f = box.makeFraction(pos);
 
     unsigned int plan = 0;
 
     // is particle inside ghost layer? set plan accordingly.
-    if (f.x >= Scalar(1.0) - ghost_fraction.x)
+    if (f.x >= Scalar(1.0) - ghost_width[0] / npd.x)
         plan |= send_east;
-    if (f.x < ghost_fraction.x)
+    if (f.x < ghost_width[1] / npd.x)
         plan |= send_west;
-    if (f.y >= Scalar(1.0) - ghost_fraction.y)
+    if (f.y >= Scalar(1.0) - ghost_width[2] / npd.y)
         plan |= send_north;
-    if (f.y < ghost_fraction.y)
+    if (f.y < ghost_width[3] / npd.y)
         plan |= send_south;
-    if (f.z >= Scalar(1.0) - ghost_fraction.z)
+    if (f.z >= Scalar(1.0) - ghost_width[4] / npd.z)
         plan |= send_up;
-    if (f.z < ghost_fraction.z)
+    if (f.z < ghost_width[5] / npd.z)
         plan |= send_down;
 
     // filter out non-communicating directions
@@ -362,14 +364,15 @@ __global__ void gpu_make_ghost_exchange_plan_kernel(unsigned int N,
  * \param N number of particles to check
  * \param d_pos Array of particle positions
  * \param box Dimensions of local simulation box
- * \param r_ghost Width of boundary layer
+ * \param d_r_ghost_dir Width of boundary layer per direction and type (index dir*ntypes+type)
+ * \param d_r_ghost_body Width of boundary layer for rigid body constituents per type
  */
 void gpu_make_ghost_exchange_plan(unsigned int* d_plan,
                                   unsigned int N,
                                   const Scalar4* d_pos,
                                   const unsigned int* d_body,
                                   const BoxDim& box,
-                                  const Scalar* d_r_ghost,
+                                  const Scalar* d_r_ghost_dir,
                                   const Scalar* d_r_ghost_body,
                                   Scalar r_ghost_max,
                                   unsigned int ntypes,
@@ -378,7 +381,7 @@ void gpu_make_ghost_exchange_plan(unsigned int* d_plan,
     assert(d_plan);
     assert(d_pos);
     assert(d_body);
-    assert(d_r_ghost);
+    assert(d_r_ghost_dir);
     assert(d_r_ghost_body);
 
     unsigned int block_size = 256;
@@ -394,7 +397,7 @@ void gpu_make_ghost_exchange_plan(unsigned int* d_plan,
                        d_body,
                        d_plan,
                        box,
-                       d_r_ghost,
+                       d_r_ghost_dir,
                        d_r_ghost_body,
                        r_ghost_max,
                        ntypes,
@@ -83,7 +83,7 @@ void gpu_make_ghost_exchange_plan(unsigned int* d_plan,
                                   const Scalar4* d_pos,
                                   const unsigned int* d_body,
                                   const BoxDim& box,
-                                  const Scalar* d_r_ghost,
+                                  const Scalar* d_r_ghost_dir,
                                   const Scalar* d_r_ghost_body,
                                   Scalar r_ghost_max,
                                   unsigned int ntypes,
@@ -263,6 +263,16 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
 
     hipEvent_t m_event; //!< CUDA event for synchronization
 
+    //! Get the location of the buffers passed to MPI
+    /*! With GPU-aware MPI, the send and receive buffers remain in device memory. Otherwise, they
+        are staged through host memory.
+    */
+    access_location::Enum getMPIBufferLocation() const
+        {
+        return m_exec_conf->isGPUAwareMPIEnabled() ? access_location::device
+                                                   : access_location::host;
+        }
+
     //! Helper function to allocate various buffers
     void allocateBuffers();
 
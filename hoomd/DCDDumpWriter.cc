@@ -13,6 +13,7 @@
 #include "Communicator.h"
 #endif
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 
@@ -71,20 +72,26 @@ DCDDumpWriter::DCDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
     : Analyzer(sysdef, trigger), m_fname(fname), m_start_timestep(0), m_period(period),
       m_group(group), m_num_frames_written(0), m_last_written_step(0), m_appending(false),
       m_unwrap_full(false), m_unwrap_rigid(false), m_angle(false), m_overwrite(overwrite),
-      m_is_initialized(false)
+      m_is_initialized(false),
+      m_io_queue([this](DCDFrame& frame) { writeFrame(frame); }, max_pending_frames)
     {
     m_exec_conf->msg->notice(5) << "Constructing DCDDumpWriter: " << fname << " " << period << " "
                                 << overwrite << endl;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order = GatherTagOrder(m_exec_conf->getMPICommunicator());
+        m_gather_central_order = GatherTagOrder(m_exec_conf->getMPICommunicator());
+        }
+#endif
     }
 
 //! Initializes the output file for writing
 void DCDDumpWriter::initFileIO(uint64_t timestep)
     {
-    m_staging_buffer = new float[m_pdata->getNGlobal()];
     m_is_initialized = true;
 
-    m_nglobal = m_pdata->getNGlobal();
-
     // handle appending to an existing file if it is requested
     if (!m_overwrite && filesystem::exists(m_fname))
         {
@@ -134,10 +141,21 @@ DCDDumpWriter::~DCDDumpWriter()
     {
     m_exec_conf->msg->notice(5) << "Destroying DCDDumpWriter" << endl;
 
+    if (m_exec_conf->isRoot())
+        {
+        try
+            {
+            m_io_queue.stop();
+            }
+        catch (const std::exception& e)
+            {
+            m_exec_conf->msg->error() << "DCD: " << e.what() << endl;
+            }
+        }
+
     if (m_is_initialized)
         {
         m_file.close();
-        delete[] m_staging_buffer;
         }
     }
 
@@ -149,21 +167,13 @@ DCDDumpWriter::~DCDDumpWriter()
 void DCDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    // take particle data snapshot
-    SnapshotParticleData<Scalar> snapshot;
 
-    m_pdata->takeSnapshot(snapshot);
-
-#ifdef ENABLE_MPI
-    // if we are not the root processor, do not perform file I/O
-    if (m_sysdef->isDomainDecomposed() && !m_exec_conf->isRoot())
+    // all ranks check, as all ranks take part in the gather
+    if (m_num_analyzed == 0)
         {
-        return;
+        m_nglobal = m_pdata->getNGlobal();
         }
-#endif
-
-    if (!m_is_initialized)
-        initFileIO(timestep);
+    m_num_analyzed++;
 
     if (m_nglobal != m_pdata->getNGlobal())
         {
@@ -173,6 +183,18 @@ void DCDDumpWriter::analyze(uint64_t timestep)
         throw std::runtime_error("Error writing DCD file");
         }
 
+    populateLocalFrame();
+    stageFrame(timestep);
+
+    // only the root processor performs file I/O
+    if (!m_exec_conf->isRoot())
+        {
+        return;
+        }
+
+    if (!m_is_initialized)
+        initFileIO(timestep);
+
     if (m_appending && timestep <= m_last_written_step)
         {
         m_exec_conf->msg->warning()
@@ -189,14 +211,263 @@ void DCDDumpWriter::analyze(uint64_t timestep)
             << " which is not specified in the period of the DCD file: " << m_start_timestep
             << " + i * " << m_period << endl;
 
+    if (m_asynchronous && m_num_analyzed > 1)
+        {
+        enqueueFrame();
+        }
+    else
+        {
+        m_io_queue.wait();
+        writeFrame(m_frame);
+        }
+    }
+
+/*! Collect the group members owned by this rank in ascending tag order. Positions are wrapped
+    into the global box relative to the origin, as in a particle data snapshot, and unwrapped with
+    the particle's own image when unwrap_full is set. Rigid body unwrapping needs the image of the
+    central particle, which may be on another rank, so the images and bodies are staged and
+    stageFrame() applies it.
+*/
+void DCDDumpWriter::populateLocalFrame()
+    {
+    const BoxDim box = m_pdata->getGlobalBox();
+    const vec3<Scalar> origin(m_pdata->getOrigin());
+    const int3 origin_image = m_pdata->getOriginImage();
+    const unsigned int N = m_pdata->getN();
+    const bool unwrap_rigid = m_unwrap_rigid && !m_unwrap_full;
+
+    m_local_tag.clear();
+    m_local_pos.clear();
+    m_local_image.clear();
+    m_local_body.clear();
+    m_local_angle.clear();
+    m_central_tag.clear();
+    m_central_image.clear();
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+
+    const unsigned int n_members = m_group->getNumMembersGlobal();
+    for (unsigned int group_idx = 0; group_idx < n_members; group_idx++)
+        {
+        const unsigned int tag = m_group->getMemberTag(group_idx);
+        const unsigned int idx = h_rtag.data[tag];
+        if (idx >= N)
+            continue;
+
+        vec3<Scalar> pos = vec3<Scalar>(h_postype.data[idx]) - origin;
+        int3 image = h_image.data[idx];
+        image.x -= origin_image.x;
+        image.y -= origin_image.y;
+        image.z -= origin_image.z;
+        box.wrap(pos, image);
+
+        if (m_unwrap_full)
+            pos = box.shift(pos, image);
+
+        m_local_tag.push_back(tag);
+        m_local_pos.push_back(pos);
+
+        if (unwrap_rigid)
+            {
+            m_local_image.push_back(image);
+            m_local_body.push_back(h_body.data[idx]);
+            }
+
+        // m_angle set to True turns on a hack where the particle orientation angle is written out
+        // to the z component this only works in 2D simulations, obviously
+        if (m_angle)
+            {
+            quat<Scalar> orientation(h_orientation.data[idx]);
+            m_local_angle.push_back(float(atan2(orientation.v.z, orientation.s) * 2));
+            }
+        }
+
+    if (unwrap_rigid)
+        {
+        // central particles are their own body
+        std::vector<std::pair<unsigned int, int3>> centrals;
+        for (unsigned int idx = 0; idx < N; idx++)
+            {
+            if (h_body.data[idx] == h_tag.data[idx])
+                {
+                int3 image = h_image.data[idx];
+                vec3<Scalar> pos = vec3<Scalar>(h_postype.data[idx]) - origin;
+                image.x -= origin_image.x;
+                image.y -= origin_image.y;
+                image.z -= origin_image.z;
+                box.wrap(pos, image);
+                centrals.push_back(std::make_pair(h_tag.data[idx], image));
+                }
+            }
+
+        std::sort(centrals.begin(),
+                  centrals.end(),
+                  [](const std::pair<unsigned int, int3>& a, const std::pair<unsigned int, int3>& b)
+                  { return a.first < b.first; });
+
+        for (const auto& central : centrals)
+            {
+            m_central_tag.push_back(central.first);
+            m_central_image.push_back(central.second);
+            }
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Gathers the local arrays on the root rank (on MPI runs) and fills m_frame there.
+*/
+void DCDDumpWriter::stageFrame(uint64_t timestep)
+    {
+    const bool unwrap_rigid = m_unwrap_rigid && !m_unwrap_full;
+
+    const std::vector<vec3<Scalar>>* pos = &m_local_pos;
+    const std::vector<int3>* image = &m_local_image;
+    const std::vector<unsigned int>* body = &m_local_body;
+    const std::vector<float>* angle = &m_local_angle;
+    std::vector<unsigned int> central_tag_global;
+    std::vector<int3> central_image_global;
+    const std::vector<unsigned int>* central_tag = &m_central_tag;
+    const std::vector<int3>* central_image = &m_central_image;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order.setLocalTagsSorted(m_local_tag);
+        m_gather_tag_order.gatherArray(m_global_pos, m_local_pos);
+        pos = &m_global_pos;
+
+        if (unwrap_rigid)
+            {
+            m_gather_tag_order.gatherArray(m_global_image, m_local_image);
+            m_gather_tag_order.gatherArray(m_global_body, m_local_body);
+            image = &m_global_image;
+            body = &m_global_body;
+
+            m_gather_central_order.setLocalTagsSorted(m_central_tag);
+            m_gather_central_order.gatherArray(central_tag_global, m_central_tag);
+            m_gather_central_order.gatherArray(central_image_global, m_central_image);
+            central_tag = &central_tag_global;
+            central_image = &central_image_global;
+            }
+
+        if (m_angle)
+            {
+            m_gather_tag_order.gatherArray(m_global_angle, m_local_angle);
+            angle = &m_global_angle;
+            }
+        }
+#endif
+
+    if (!m_exec_conf->isRoot())
+        {
+        return;
+        }
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const size_t n_members = pos->size();
+
+    m_frame.timestep = timestep;
+    m_frame.box = box;
+    m_frame.x.resize(n_members);
+    m_frame.y.resize(n_members);
+    m_frame.z.resize(n_members);
+
+    for (size_t i = 0; i < n_members; i++)
+        {
+        vec3<Scalar> p = (*pos)[i];
+
+        if (unwrap_rigid && (*body)[i] < MIN_FLOPPY)
+            {
+            auto it = std::lower_bound(central_tag->begin(), central_tag->end(), (*body)[i]);
+            if (it != central_tag->end() && *it == (*body)[i])
+                {
+                const int3 body_image = (*central_image)[it - central_tag->begin()];
+                const int3 particle_image = (*image)[i];
+                int3 img_diff = make_int3(particle_image.x - body_image.x,
+                                          particle_image.y - body_image.y,
+                                          particle_image.z - body_image.z);
+                p = box.shift(p, img_diff);
+                }
+            }
+
+        m_frame.x[i] = float(p.x);
+        m_frame.y[i] = float(p.y);
+        m_frame.z[i] = m_angle ? (*angle)[i] : float(p.z);
+        }
+    }
+
+/*! \param frame Frame to write
+
+    Called on the root rank only, either on the main thread or on the I/O thread.
+*/
+void DCDDumpWriter::writeFrame(const DCDFrame& frame)
+    {
     // write the data for the current time step
     m_file.seekp(0, std::ios_base::end);
-    write_frame_header(m_file);
-    write_frame_data(m_file, snapshot);
+    write_frame_header(m_file, frame.box);
+    write_frame_data(m_file, frame);
 
     // update the header with the number of frames written
     m_num_frames_written++;
-    write_updated_header(m_file, timestep);
+    write_updated_header(m_file, frame.timestep);
+    }
+
+/*! \param asynchronous Set to true to write frames on a background I/O thread
+ */
+void DCDDumpWriter::setAsynchronous(bool asynchronous)
+    {
+    if (asynchronous == m_asynchronous)
+        {
+        return;
+        }
+
+    if (m_exec_conf->isRoot())
+        {
+        if (asynchronous)
+            {
+            m_io_queue.start();
+            }
+        else
+            {
+            m_io_queue.stop();
+            }
+        }
+
+    m_asynchronous = asynchronous;
+    }
+
+void DCDDumpWriter::flush()
+    {
+    if (m_exec_conf->isRoot())
+        {
+        m_io_queue.wait();
+        if (m_is_initialized)
+            {
+            m_file.flush();
+            }
+        }
+    }
+
+/*! Swaps m_frame with a free buffer, so the next frame is staged in the buffer of a frame that
+    has already been written. Blocks while max_pending_frames frames are already in flight.
+*/
+void DCDDumpWriter::enqueueFrame()
+    {
+    std::unique_ptr<DCDFrame> pending = m_io_queue.acquire();
+    std::swap(*pending, m_frame);
+    m_io_queue.push(std::move(pending));
     }
 
 /*! \param file File to write to
@@ -270,13 +541,13 @@ void DCDDumpWriter::write_file_header(std::fstream& file)
     }
 
 /*! \param file File to write to
+    \param box Global box of the frame
     Writes the header that precedes each snapshot in the file. This header
     includes information on the box size of the simulation.
 */
-void DCDDumpWriter::write_frame_header(std::fstream& file)
+void DCDDumpWriter::write_frame_header(std::fstream& file, const BoxDim& box)
     {
     double unitcell[6];
-    BoxDim box = m_pdata->getGlobalBox();
     // set box dimensions
     Scalar a, b, c, alpha, beta, gamma;
     Scalar3 va = box.getLatticeVector(0);
@@ -309,88 +580,21 @@ void DCDDumpWriter::write_frame_header(std::fstream& file)
     }
 
 /*! \param file File to write to
-    \param snapshot Snapshot to write
+    \param frame Coordinates to write, in tag order
     Writes the actual particle positions for all particles at the current time step
 */
-void DCDDumpWriter::write_frame_data(std::fstream& file,
-                                     const SnapshotParticleData<Scalar>& snapshot)
+void DCDDumpWriter::write_frame_data(std::fstream& file, const DCDFrame& frame)
     {
-    // we need to unsort the positions and write in tag order
-    assert(m_staging_buffer);
+    const unsigned int nparticles = (unsigned int)frame.x.size();
+    const unsigned int n_bytes = (unsigned int)(nparticles * sizeof(float));
 
-    BoxDim box = m_pdata->getGlobalBox();
-
-    unsigned int nparticles = m_group->getNumMembersGlobal();
-
-    // Create a tmp copy of the particle data and unwrap particles
-    std::vector<vec3<Scalar>> tmp_pos(snapshot.pos);
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
+    for (const std::vector<float>* coordinates : {&frame.x, &frame.y, &frame.z})
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
-
-        if (m_unwrap_full)
-            {
-            tmp_pos[i] = box.shift(tmp_pos[i], snapshot.image[i]);
-            }
-        else if (m_unwrap_rigid && snapshot.body[i] < MIN_FLOPPY)
-            {
-            unsigned int central_ptl_tag = snapshot.body[i];
-            int body_ix = snapshot.image[central_ptl_tag].x;
-            int body_iy = snapshot.image[central_ptl_tag].y;
-            int body_iz = snapshot.image[central_ptl_tag].z;
-            int3 particle_img = snapshot.image[i];
-            int3 img_diff = make_int3(particle_img.x - body_ix,
-                                      particle_img.y - body_iy,
-                                      particle_img.z - body_iz);
-
-            tmp_pos[i] = box.shift(tmp_pos[i], img_diff);
-            }
+        detail::write_int(file, n_bytes);
+        file.write((const char*)coordinates->data(), n_bytes);
+        detail::write_int(file, n_bytes);
         }
 
-    // prepare x coords for writing, looping in tag order
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].x);
-        }
-
-    // write x coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // prepare y coords for writing
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].y);
-        }
-
-    // write y coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // prepare z coords for writing
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].z);
-
-        // m_angle set to True turns on a hack where the particle orientation angle is written out
-        // to the z component this only works in 2D simulations, obviously
-        if (m_angle)
-            {
-            m_staging_buffer[group_idx]
-                = float(atan2(snapshot.orientation[i].v.z, snapshot.orientation[i].s) * 2);
-            }
-        }
-
-    // write z coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
     // check for errors
     if (!file.good())
         {
@@ -432,7 +636,11 @@ void export_DCDDumpWriter(pybind11::module& m)
                       &DCDDumpWriter::getUnwrapRigid,
                       &DCDDumpWriter::setUnwrapRigid)
         .def_property("angle_z", &DCDDumpWriter::getAngleZ, &DCDDumpWriter::setAngleZ)
-        .def_property_readonly("overwrite", &DCDDumpWriter::getOverwrite);
+        .def_property_readonly("overwrite", &DCDDumpWriter::getOverwrite)
+        .def_property("asynchronous",
+                      &DCDDumpWriter::getAsynchronous,
+                      &DCDDumpWriter::setAsynchronous)
+        .def("flush", &DCDDumpWriter::flush);
     }
     } // end namespace detail
 
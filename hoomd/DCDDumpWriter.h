@@ -5,11 +5,17 @@
 #define __DCDDUMPWRITER_H__
 
 #include "Analyzer.h"
+#include "AsyncWriteQueue.h"
 #include "ParticleGroup.h"
 
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 /*! \file DCDDumpWriter.h
     \brief Declares the DCDDumpWriter class
@@ -45,6 +51,15 @@ namespace hoomd
     Due to a limitation in the DCD format, the time step period between calls to
     analyze() \b must be specified up front. If analyze() detects that this period is
     not being maintained, it will print a warning but continue.
+
+    Each rank stages the positions of its local group members in tag order. On MPI runs, a
+    GatherTagOrder (the same helper GSDDumpWriter uses) merges them on the root rank, so only the
+    written coordinates are communicated instead of a full particle data snapshot.
+
+    In asynchronous mode, analyze() stages the frame and returns. A background I/O thread on the
+    root rank writes it to the file while the simulation continues. At most max_pending_frames
+    frames are waiting or being written. The first frame is always written synchronously.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
@@ -102,7 +117,32 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
         return m_overwrite;
         }
 
+    /// Set whether frames are written by a background I/O thread
+    void setAsynchronous(bool asynchronous);
+
+    /// Get whether frames are written by a background I/O thread
+    bool getAsynchronous()
+        {
+        return m_asynchronous;
+        }
+
+    /// Wait until all pending frames are written to the file
+    void flush();
+
+    /// Maximum number of frames waiting to be written in asynchronous mode
+    static const unsigned int max_pending_frames = 2;
+
     private:
+    /// Coordinates of the group members in tag order, ready to write
+    struct DCDFrame
+        {
+        uint64_t timestep;    //!< Time step of the frame
+        BoxDim box;           //!< Global box
+        std::vector<float> x; //!< x coordinates
+        std::vector<float> y; //!< y coordinates
+        std::vector<float> z; //!< z coordinates (or orientation angles)
+        };
+
     std::string m_fname;                    //!< The file name we are writing to
     uint64_t m_start_timestep;              //!< First time step written to the file
     unsigned int m_period;                  //!< Time step period between writes
@@ -118,21 +158,60 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     bool m_is_initialized;  //!< True if file IO has been initialized
     unsigned int m_nglobal; //!< Initial number of particles
 
-    float* m_staging_buffer; //!< Buffer for staging particle positions in tag order
-    std::fstream m_file;     //!< The file object
+    uint64_t m_num_analyzed = 0; //!< Number of calls to analyze()
+
+    std::fstream m_file; //!< The file object
+
+    std::vector<unsigned int> m_local_tag;  //!< Tags of the local group members, ascending
+    std::vector<vec3<Scalar>> m_local_pos;  //!< Wrapped (or unwrapped) local member positions
+    std::vector<int3> m_local_image;        //!< Images of the local members (unwrap_rigid)
+    std::vector<unsigned int> m_local_body; //!< Bodies of the local members (unwrap_rigid)
+    std::vector<float> m_local_angle;       //!< Orientation angles of the local members
+
+    std::vector<unsigned int> m_central_tag; //!< Tags of the central particles, ascending
+    std::vector<int3> m_central_image;       //!< Images of the central particles
+
+    std::vector<vec3<Scalar>> m_global_pos;  //!< Member positions in tag order (root rank)
+    std::vector<int3> m_global_image;        //!< Member images in tag order (root rank)
+    std::vector<unsigned int> m_global_body; //!< Member bodies in tag order (root rank)
+    std::vector<float> m_global_angle;       //!< Member angles in tag order (root rank)
+
+#ifdef ENABLE_MPI
+    GatherTagOrder m_gather_tag_order;     //!< Gathers the member arrays on the root rank
+    GatherTagOrder m_gather_central_order; //!< Gathers the central particle arrays
+#endif
+
+    /// Frame staged on the main thread
+    DCDFrame m_frame;
+
+    /// True when frames are written by the I/O thread
+    bool m_asynchronous = false;
+
+    /// Frames waiting for the I/O thread (root rank only)
+    AsyncWriteQueue<DCDFrame> m_io_queue;
 
     // helper functions
 
     //! Initializes the file header
     void write_file_header(std::fstream& file);
     //! Writes the frame header
-    void write_frame_header(std::fstream& file);
+    void write_frame_header(std::fstream& file, const BoxDim& box);
     //! Writes the particle positions for a frame
-    void write_frame_data(std::fstream& file, const SnapshotParticleData<Scalar>& snapshot);
+    void write_frame_data(std::fstream& file, const DCDFrame& frame);
     //! Updates the file header
     void write_updated_header(std::fstream& file, uint64_t timestep);
     //! Initializes the output file for writing
     void initFileIO(uint64_t timestep);
+
+    //! Stage the local group members
+    void populateLocalFrame();
+    //! Combine the local arrays of all ranks into the frame to write (root rank)
+    void stageFrame(uint64_t timestep);
+    //! Append a frame to the file and update the header
+    void writeFrame(const DCDFrame& frame);
+
+    //! Pass m_frame to the I/O thread
+    void enqueueFrame();
     };
 
 namespace detail
@@ -141,17 +141,26 @@ void DomainDecomposition::initializeDomainGrid(Scalar3 L,
             // every node has the same number of ranks, so nranks == num_nodes * num_ranks_per_node
             unsigned int n_nodes = (unsigned int)(m_nodes.size());
 
-            // subdivide the global grid
-            findDecomposition(nranks, L, nx, ny, nz);
-
-            // subdivide the local grid
-            subdivide(nranks / n_nodes, L, nx, ny, nz, nx_intra, ny_intra, nz_intra);
-
-            nx_node = nx / nx_intra;
-            ny_node = ny / ny_intra;
-            nz_node = nz / nz_intra;
+            // choose the global grid and the grid on each node together
+            m_twolevel = findTwoLevelDecomposition(nranks,
+                                                   nranks / n_nodes,
+                                                   L,
+                                                   nx,
+                                                   ny,
+                                                   nz,
+                                                   nx_intra,
+                                                   ny_intra,
+                                                   nz_intra);
+            if (m_twolevel)
+                {
+                nx_node = nx / nx_intra;
+                ny_node = ny / ny_intra;
+                nz_node = nz / nz_intra;
+                }
             }
-        else
+
+        // fall back to a single level decomposition when the nodes cannot share a grid
+        if (!m_twolevel)
             {
             bool found_decomposition = findDecomposition(nranks, L, nx, ny, nz);
             if (!found_decomposition)
@@ -166,6 +175,7 @@ void DomainDecomposition::initializeDomainGrid(Scalar3 L,
         }
 
     // broadcast grid dimensions
+    bcast(m_twolevel, 0, m_mpi_comm);
     bcast(m_nx, 0, m_mpi_comm);
     bcast(m_ny, 0, m_mpi_comm);
     bcast(m_nz, 0, m_mpi_comm);
@@ -407,41 +417,101 @@ bool DomainDecomposition::findDecomposition(unsigned int nranks,
     return found_decomposition;
     }
 
-//! Find a two-level decomposition of the global grid
-void DomainDecomposition::subdivide(unsigned int n_node_ranks,
-                                    Scalar3 L,
-                                    unsigned int nx,
-                                    unsigned int ny,
-                                    unsigned int nz,
-                                    unsigned int& nx_intra,
-                                    unsigned int& ny_intra,
-                                    unsigned int& nz_intra)
+//! Relative cost of exchanging ghosts between nodes instead of within a node
+static const double inter_node_cost = 4.0;
+
+/*! \param n Number of domains along a direction
+    \param n_node Number of nodes along the direction
+    \returns Modeled communication cost of the cut planes normal to the direction, in units of the
+              plane area
+*/
+static double cutPlaneCost(unsigned int n, unsigned int n_node)
+    {
+    // of the n - 1 cut planes between domains, n_node - 1 lie between two nodes
+    return double(n - n_node) + inter_node_cost * double(n_node - 1);
+    }
+
+/*!
+ * \param nranks Total number of ranks
+ * \param n_node_ranks Number of ranks on every node
+ * \param L Box lengths of global box to sub-divide
+ * \param nx Number of domains along the x direction (output)
+ * \param ny Number of domains along the y direction (output)
+ * \param nz Number of domains along the z direction (output)
+ * \param nx_intra Number of domains of a node along the x direction (output)
+ * \param ny_intra Number of domains of a node along the y direction (output)
+ * \param nz_intra Number of domains of a node along the z direction (output)
+ * \returns true if a decomposition was found
+ *
+ * The global grid and the grid of domains on each node are chosen together to minimize the
+ * communication cost. The ghost volume exchanged across a cut plane is proportional to its area,
+ * and planes between nodes are weighted by inter_node_cost because the interconnect is slower
+ * than communication within a node. The search fails when no global grid can be divided evenly
+ * among the nodes.
+ */
+bool DomainDecomposition::findTwoLevelDecomposition(unsigned int nranks,
+                                                    unsigned int n_node_ranks,
+                                                    const Scalar3 L,
+                                                    unsigned int& nx,
+                                                    unsigned int& ny,
+                                                    unsigned int& nz,
+                                                    unsigned int& nx_intra,
+                                                    unsigned int& ny_intra,
+                                                    unsigned int& nz_intra)
     {
     assert(L.x > 0);
     assert(L.y > 0);
-    assert(L.z > 0);
 
-    // initial guess
-    nx_intra = 1;
-    ny_intra = 1;
-    nz_intra = n_node_ranks;
-
-    for (unsigned int nx_intra_try = 1; nx_intra_try <= n_node_ranks; nx_intra_try++)
-        for (unsigned int ny_intra_try = 1; nx_intra_try * ny_intra_try <= n_node_ranks;
-             ny_intra_try++)
-            for (unsigned int nz_intra_try = 1;
-                 nx_intra_try * ny_intra_try * nz_intra_try <= n_node_ranks;
-                 nz_intra_try++)
+    // area of the cut planes normal to each direction (length in 2D)
+    bool is2D = L.z == 0.0;
+    const double area_x = is2D ? L.y : L.y * L.z;
+    const double area_y = is2D ? L.x : L.x * L.z;
+    const double area_z = L.x * L.y;
+
+    bool found_decomposition = false;
+    double min_cost = 0.0;
+
+    for (unsigned int nx_try = 1; nx_try <= nranks; nx_try++)
+        for (unsigned int ny_try = 1; nx_try * ny_try <= nranks; ny_try++)
+            for (unsigned int nz_try = 1; nx_try * ny_try * nz_try <= nranks; nz_try++)
                 {
-                if (nx_intra_try * ny_intra_try * nz_intra_try != n_node_ranks)
+                if (nx_try * ny_try * nz_try != nranks)
                     continue;
-                if (nx % nx_intra_try || ny % ny_intra_try || nz % nz_intra_try)
+                if (is2D && nz_try > 1)
                     continue;
 
-                nx_intra = nx_intra_try;
-                ny_intra = ny_intra_try;
-                nz_intra = nz_intra_try;
+                for (unsigned int nx_intra_try = 1; nx_intra_try <= n_node_ranks; nx_intra_try++)
+                    for (unsigned int ny_intra_try = 1;
+                         nx_intra_try * ny_intra_try <= n_node_ranks;
+                         ny_intra_try++)
+                        for (unsigned int nz_intra_try = 1;
+                             nx_intra_try * ny_intra_try * nz_intra_try <= n_node_ranks;
+                             nz_intra_try++)
+                            {
+                            if (nx_intra_try * ny_intra_try * nz_intra_try != n_node_ranks)
+                                continue;
+                            if (nx_try % nx_intra_try || ny_try % ny_intra_try
+                                || nz_try % nz_intra_try)
+                                continue;
+
+                            double cost = area_x * cutPlaneCost(nx_try, nx_try / nx_intra_try)
+                                          + area_y * cutPlaneCost(ny_try, ny_try / ny_intra_try)
+                                          + area_z * cutPlaneCost(nz_try, nz_try / nz_intra_try);
+                            if (cost < min_cost || !found_decomposition)
+                                {
+                                nx = nx_try;
+                                ny = ny_try;
+                                nz = nz_try;
+                                nx_intra = nx_intra_try;
+                                ny_intra = ny_intra_try;
+                                nz_intra = nz_intra_try;
+                                min_cost = cost;
+                                found_decomposition = true;
+                                }
+                            }
                 }
+
+    return found_decomposition;
     }
 
 /*! \param dir Spatial direction to find neighbor in
@@ -37,6 +37,10 @@ namespace hoomd
  * the global domain is sub-divided such as to minimize surface area between domains, while
  * utilizing all processors in the MPI communicator.
  *
+ *  In a two-level decomposition, the domains of the ranks on each node form a contiguous block of
+ * the grid. The global grid and the block are chosen together, weighting the surfaces between
+ * nodes more heavily than those within a node because the interconnect is slower.
+ *
  *  Alternatively, unequal sized cuts can be taken. This is advantageous for simulations with
  * non-homogeneous particle distributions, e.g., a vapor-liquid interface. The user can specify N-1
  * of the fractions at construction time, provided that the specified fractions must create a grid
@@ -194,15 +198,16 @@ class PYBIND11_EXPORT DomainDecomposition
                            unsigned int& ny,
                            unsigned int& nz);
 
-    //! Find a two-level decomposition of the global grid
-    void subdivide(unsigned int n_node_ranks,
-                   Scalar3 L,
-                   unsigned int nx,
-                   unsigned int ny,
-                   unsigned int nz,
-                   unsigned int& nx_intra,
-                   unsigned int& ny_intra,
-                   unsigned int& nz_intra);
+    //! Find a two-level decomposition that minimizes the modeled communication cost
+    bool findTwoLevelDecomposition(unsigned int nranks,
+                                   unsigned int n_node_ranks,
+                                   Scalar3 L,
+                                   unsigned int& nx,
+                                   unsigned int& ny,
+                                   unsigned int& nz,
+                                   unsigned int& nx_intra,
+                                   unsigned int& ny_intra,
+                                   unsigned int& nz_intra);
 
     //! Helper method to group ranks by nodes
     void findCommonNodes();
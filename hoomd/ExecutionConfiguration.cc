@@ -14,9 +14,15 @@
 
 #ifdef ENABLE_MPI
 #include "HOOMDMPI.h"
+
+// Open MPI declares its run time GPU support queries in mpi-ext.h
+#if defined(ENABLE_HIP) && __has_include(<mpi-ext.h>)
+#include <mpi-ext.h>
+#endif
 #endif
 
 #include <algorithm>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -133,6 +139,18 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
     exec_mode = CPU;
 #endif
 
+    m_thread_pool = std::make_unique<ThreadPool>(1);
+
+    // cache up to 1 GiB of freed GPUArray blocks
+    m_memory_pool = std::make_unique<MemoryPool>(size_t(1) << 30);
+    m_memory_tracker = std::make_unique<MemoryTracker>();
+
+    if (exec_mode == GPU && getNRanks() > 1 && isGPUAwareMPIAvailable())
+        {
+        msg->collectiveNoticeStr(3, "Passing device pointers directly to GPU-aware MPI.\n");
+        m_gpu_aware_mpi = true;
+        }
+
     setupStats();
 
     ostringstream s;
@@ -146,10 +164,18 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
         // Activate the GPU.
         setDevice();
         // initialize cached allocator, max allocation 0.5*global mem
+        size_t max_cached_bytes = dev_prop.totalGlobalMem / 2;
         m_cached_alloc.reset(
-            new CachedAllocator(false, (unsigned int)(0.5f * (float)dev_prop.totalGlobalMem)));
+            new CachedAllocator(CachedAllocator::STREAM_ORDERED, max_cached_bytes));
         m_cached_alloc_managed.reset(
-            new CachedAllocator(true, (unsigned int)(0.5f * (float)dev_prop.totalGlobalMem)));
+            new CachedAllocator(CachedAllocator::MANAGED, max_cached_bytes));
+        m_cached_alloc_pinned.reset(
+            new CachedAllocator(CachedAllocator::PINNED_HOST, 256u * 1024u * 1024u));
+
+        if (m_cached_alloc->getMemoryKind() == CachedAllocator::STREAM_ORDERED)
+            {
+            msg->notice(4) << "Using stream-ordered allocation for temporary buffers." << endl;
+            }
         }
 #endif
 
@@ -183,7 +209,108 @@ ExecutionConfiguration::~ExecutionConfiguration()
     // the destructors of these objects can issue hip calls, so free them before the device reset
     m_cached_alloc.reset();
     m_cached_alloc_managed.reset();
+    m_cached_alloc_pinned.reset();
 #endif
+
+    m_memory_pool.reset();
+    }
+
+/*! \param num_threads Number of CPU threads to use (including the main thread)
+
+    Threaded CPU code paths split their work over \a num_threads threads on each MPI rank. Set
+    num_threads to 1 to execute all CPU code serially.
+*/
+void ExecutionConfiguration::setNumThreads(unsigned int num_threads)
+    {
+    if (num_threads == 0)
+        {
+        throw runtime_error("The number of CPU threads must be at least 1.");
+        }
+
+    if (num_threads != m_thread_pool->getNumThreads())
+        {
+        msg->notice(3) << "Using " << num_threads << " CPU threads per rank." << endl;
+        m_thread_pool = std::make_unique<ThreadPool>(num_threads);
+        }
+    }
+
+/*! \param enable Set to true to pass device pointers directly to MPI
+
+    Enabling GPU-aware MPI when the MPI library does not report support for it is allowed, as not
+    all implementations provide a run time query. Such MPI libraries fail when given device
+    pointers.
+*/
+void ExecutionConfiguration::setGPUAwareMPI(bool enable)
+    {
+    if (enable && exec_mode != GPU)
+        {
+        throw runtime_error("GPU-aware MPI requires a GPU device.");
+        }
+
+    if (enable && !isGPUAwareMPIAvailable())
+        {
+        msg->warning() << "The MPI library does not report GPU support. Enabling GPU-aware MPI "
+                       << "anyway." << endl;
+        }
+
+    m_gpu_aware_mpi = enable;
+    }
+
+/*! Query the MPI implementation for device pointer support. Open MPI provides the
+    MPIX_Query_cuda_support() and MPIX_Query_rocm_support() extensions. Cray MPICH and MVAPICH2
+    enable device support with the MPICH_GPU_SUPPORT_ENABLED and MV2_USE_CUDA environment
+    variables.
+*/
+bool ExecutionConfiguration::isGPUAwareMPIAvailable()
+    {
+#if defined(ENABLE_MPI) && defined(ENABLE_HIP)
+#if defined(__HIP_PLATFORM_NVCC__) && defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+    if (MPIX_Query_cuda_support())
+        {
+        return true;
+        }
+#endif
+
+#if defined(__HIP_PLATFORM_HCC__) && defined(MPIX_ROCM_AWARE_SUPPORT) && MPIX_ROCM_AWARE_SUPPORT
+    if (MPIX_Query_rocm_support())
+        {
+        return true;
+        }
+#endif
+
+    for (const char* name : {"MPICH_GPU_SUPPORT_ENABLED", "MV2_USE_CUDA"})
+        {
+        const char* value = getenv(name);
+        if (value && string(value) == "1")
+            {
+            return true;
+            }
+        }
+#endif
+
+    return false;
+    }
+
+/*! \param filename Name of the autotuner cache file. Set to an empty string to disable the cache.
+
+    Autotuners read the cache when they start a scan, so set the filename before constructing
+    any autotuned objects.
+*/
+void ExecutionConfiguration::setAutotunerCacheFilename(const std::string& filename)
+    {
+    if (filename.empty())
+        {
+        m_autotuner_cache.reset();
+        return;
+        }
+
+    if (!m_autotuner_cache || m_autotuner_cache->getFilename() != filename)
+        {
+        m_autotuner_cache = std::make_shared<AutotunerCache>(filename,
+                                                             m_active_device_description,
+                                                             m_mpi_config,
+                                                             msg);
+        }
     }
 
 #if defined(ENABLE_HIP)
@@ -495,6 +622,59 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .def("getRank", &ExecutionConfiguration::getRank)
         .def("setMemoryTracing", &ExecutionConfiguration::setMemoryTracing)
         .def("memoryTracingEnabled", &ExecutionConfiguration::memoryTracingEnabled)
+        .def("setNumThreads", &ExecutionConfiguration::setNumThreads)
+        .def("getNumThreads", &ExecutionConfiguration::getNumThreads)
+        .def("isGPUAwareMPIEnabled", &ExecutionConfiguration::isGPUAwareMPIEnabled)
+        .def("setGPUAwareMPI", &ExecutionConfiguration::setGPUAwareMPI)
+        .def_static("isGPUAwareMPIAvailable", &ExecutionConfiguration::isGPUAwareMPIAvailable)
+        .def("isGhostUpdateCompressionEnabled",
+             &ExecutionConfiguration::isGhostUpdateCompressionEnabled)
+        .def("setGhostUpdateCompression", &ExecutionConfiguration::setGhostUpdateCompression)
+        .def("isGhostSortingEnabled", &ExecutionConfiguration::isGhostSortingEnabled)
+        .def("setGhostSorting", &ExecutionConfiguration::setGhostSorting)
+        .def("setAutotunerCacheFilename", &ExecutionConfiguration::setAutotunerCacheFilename)
+        .def("getAutotunerCacheFilename", &ExecutionConfiguration::getAutotunerCacheFilename)
+        .def("setAutotunerRetuneThreshold", &ExecutionConfiguration::setAutotunerRetuneThreshold)
+        .def("getAutotunerRetuneThreshold", &ExecutionConfiguration::getAutotunerRetuneThreshold)
+        .def("setKernelTiming", &ExecutionConfiguration::setKernelTiming)
+        .def("isKernelTimingEnabled", &ExecutionConfiguration::isKernelTimingEnabled)
+        .def("getMemoryPoolLimit",
+             [](const ExecutionConfiguration& exec_conf)
+             { return exec_conf.getMemoryPool().getMaxCachedBytes(); })
+        .def("setMemoryPoolLimit",
+             [](const ExecutionConfiguration& exec_conf, size_t max_cached_bytes)
+             { exec_conf.getMemoryPool().setMaxCachedBytes(max_cached_bytes); })
+        .def("getMemoryPoolStatistics",
+             [](const ExecutionConfiguration& exec_conf)
+             {
+                 MemoryPool::Statistics stats = exec_conf.getMemoryPool().getStatistics();
+                 pybind11::dict result;
+                 result["host_hits"] = stats.host_hits;
+                 result["host_misses"] = stats.host_misses;
+                 result["host_cached_bytes"] = stats.host_cached_bytes;
+                 result["device_hits"] = stats.device_hits;
+                 result["device_misses"] = stats.device_misses;
+                 result["device_cached_bytes"] = stats.device_cached_bytes;
+                 return result;
+             })
+        .def("addMemoryTag",
+             [](const ExecutionConfiguration& exec_conf, const std::string& name)
+             { return exec_conf.getMemoryTracker().addTag(name); })
+        .def("pushMemoryTag",
+             [](const ExecutionConfiguration& exec_conf, unsigned int tag)
+             { exec_conf.getMemoryTracker().push(tag); })
+        .def("popMemoryTag",
+             [](const ExecutionConfiguration& exec_conf) { exec_conf.getMemoryTracker().pop(); })
+        .def("getMemoryBytes",
+             [](const ExecutionConfiguration& exec_conf, unsigned int tag)
+             {
+                 const MemoryTracker& tracker = exec_conf.getMemoryTracker();
+                 return pybind11::make_tuple(tracker.getBytes(tag, MemoryTracker::host),
+                                             tracker.getBytes(tag, MemoryTracker::device));
+             })
+        .def("getMemoryUsage",
+             [](const ExecutionConfiguration& exec_conf)
+             { return exec_conf.getMemoryTracker().getUsage(); })
         .def_static("getCapableDevices", &ExecutionConfiguration::getCapableDevices)
         .def_static("getScanMessages", &ExecutionConfiguration::getScanMessages)
         .def("getActiveDevice", &ExecutionConfiguration::getActiveDevice);
@@ -26,7 +26,11 @@
 #endif
 #endif
 
+#include "AutotunerCache.h"
+#include "MemoryPool.h"
+#include "MemoryTracker.h"
 #include "Messenger.h"
+#include "ThreadPool.h"
 
 /*! \file ExecutionConfiguration.h
     \brief Declares ExecutionConfiguration and related classes
@@ -236,6 +240,8 @@ class PYBIND11_EXPORT ExecutionConfiguration
 
 #if defined(ENABLE_HIP)
     //! Returns the cached allocator for temporary allocations
+    /*! Allocations are stream-ordered on the default stream when the device supports memory pools.
+     */
     CachedAllocator& getCachedAllocator() const
         {
         return *m_cached_alloc;
@@ -246,6 +252,12 @@ class PYBIND11_EXPORT ExecutionConfiguration
         {
         return *m_cached_alloc_managed;
         }
+
+    //! Returns the cached allocator for pinned host staging buffers
+    CachedAllocator& getCachedAllocatorPinned() const
+        {
+        return *m_cached_alloc_pinned;
+        }
 #endif
 
     //! Set up memory tracing
@@ -259,6 +271,124 @@ class PYBIND11_EXPORT ExecutionConfiguration
         return m_memory_tracing;
         }
 
+    //! Set the number of CPU threads used by threaded CPU code paths
+    void setNumThreads(unsigned int num_threads);
+
+    //! Get the number of CPU threads used by threaded CPU code paths
+    unsigned int getNumThreads() const
+        {
+        return m_thread_pool->getNumThreads();
+        }
+
+    //! Get the thread pool for intra-rank CPU parallelism
+    ThreadPool& getThreadPool() const
+        {
+        return *m_thread_pool;
+        }
+
+    //! Get the pool that recycles GPUArray and GPUVector allocations
+    MemoryPool& getMemoryPool() const
+        {
+        return *m_memory_pool;
+        }
+
+    //! Get the per-owner accounting of GPUArray and GPUVector memory
+    MemoryTracker& getMemoryTracker() const
+        {
+        return *m_memory_tracker;
+        }
+
+    //! Returns true when device pointers are passed directly to MPI
+    /*! When false, GPU code paths stage communication buffers through host memory.
+     */
+    bool isGPUAwareMPIEnabled() const
+        {
+        return m_gpu_aware_mpi;
+        }
+
+    //! Enable or disable passing device pointers directly to MPI
+    void setGPUAwareMPI(bool enable);
+
+    //! Returns true when the MPI library reports support for device pointers
+    static bool isGPUAwareMPIAvailable();
+
+    //! Returns true when CPU ghost position updates are sent as quantized displacements
+    bool isGhostUpdateCompressionEnabled() const
+        {
+        return m_compress_ghost_updates;
+        }
+
+    //! Enable or disable quantized ghost position updates
+    /*! The setting takes effect at the next ghost exchange and must be the same on all ranks.
+     */
+    void setGhostUpdateCompression(bool enable)
+        {
+        m_compress_ghost_updates = enable;
+        }
+
+    //! Returns true when CPU ghost particles are sorted by cell after each ghost exchange
+    bool isGhostSortingEnabled() const
+        {
+        return m_sort_ghosts;
+        }
+
+    //! Enable or disable sorting the ghost particles by cell
+    /*! The setting takes effect at the next ghost exchange.
+     */
+    void setGhostSorting(bool enable)
+        {
+        m_sort_ghosts = enable;
+        }
+
+    //! Set the autotuner cache file
+    void setAutotunerCacheFilename(const std::string& filename);
+
+    //! Get the autotuner cache file
+    std::string getAutotunerCacheFilename() const
+        {
+        if (m_autotuner_cache)
+            {
+            return m_autotuner_cache->getFilename();
+            }
+        return std::string();
+        }
+
+    //! Get the autotuner cache (may be null)
+    std::shared_ptr<AutotunerCache> getAutotunerCache() const
+        {
+        return m_autotuner_cache;
+        }
+
+    //! Enable or disable GPU event timing of every autotuned kernel launch
+    void setKernelTiming(bool enable)
+        {
+        m_kernel_timing = enable;
+        }
+
+    //! Test if GPU event timing of autotuned kernel launches is enabled
+    bool isKernelTimingEnabled() const
+        {
+        return m_kernel_timing;
+        }
+
+    //! Set the relative change in kernel run time that restarts a completed autotuner scan
+    /*! \param threshold Relative change, 0 disables re-tuning
+     */
+    void setAutotunerRetuneThreshold(float threshold)
+        {
+        if (threshold < 0)
+            {
+            throw std::invalid_argument("The autotuner re-tune threshold must be non-negative.");
+            }
+        m_autotuner_retune_threshold = threshold;
+        }
+
+    //! Get the relative change in kernel run time that restarts a completed autotuner scan
+    float getAutotunerRetuneThreshold() const
+        {
+        return m_autotuner_retune_threshold;
+        }
+
     /// Get a list of the capable devices
     static std::vector<std::string> getCapableDevices()
         {
@@ -341,12 +471,41 @@ class PYBIND11_EXPORT ExecutionConfiguration
     std::unique_ptr<CachedAllocator> m_cached_alloc; //!< Cached allocator for temporary allocations
     std::unique_ptr<CachedAllocator>
         m_cached_alloc_managed; //!< Cached allocator for temporary allocations in managed memory
+    std::unique_ptr<CachedAllocator>
+        m_cached_alloc_pinned; //!< Cached allocator for staging buffers in pinned host memory
 #endif
 
     //! Setup and print out stats on the chosen CPUs/GPUs
     void setupStats();
 
     bool m_memory_tracing = false;
+
+    /// Thread pool for threaded CPU code paths
+    std::unique_ptr<ThreadPool> m_thread_pool;
+
+    /// Pool of freed GPUArray and GPUVector blocks
+    std::unique_ptr<MemoryPool> m_memory_pool;
+
+    /// Host and device bytes held by each owner
+    std::unique_ptr<MemoryTracker> m_memory_tracker;
+
+    /// True when device pointers are passed directly to MPI
+    bool m_gpu_aware_mpi = false;
+
+    /// True when CPU ghost position updates are sent as quantized displacements
+    bool m_compress_ghost_updates = false;
+
+    /// True when CPU ghost particles are sorted by cell after each ghost exchange
+    bool m_sort_ghosts = false;
+
+    /// Persistent autotuner parameter cache (null when disabled)
+    std::shared_ptr<AutotunerCache> m_autotuner_cache;
+
+    /// Relative change in kernel run time that restarts autotuning (0 when disabled)
+    float m_autotuner_retune_threshold = 0;
+
+    /// True when autotuners time every kernel launch with GPU events
+    bool m_kernel_timing = false;
     };
 
 #if defined(ENABLE_HIP)
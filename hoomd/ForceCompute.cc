@@ -461,17 +461,55 @@ pybind11::object ForceCompute::getVirialsPython()
 void ForceCompute::compute(uint64_t timestep)
     {
     Compute::compute(timestep);
+    MemoryTracker::Scope memory(m_exec_conf->getMemoryTracker(), m_memory_tag);
     // recompute forces if the particles were sorted, this is a new timestep, or the particle data
     // flags do not match
     if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
         {
-        computeForces(timestep);
+        ProfileScope profile(m_sysdef->getProfiler(), m_profile_timer);
+#ifdef ENABLE_MPI
+        if (m_interior_computed && m_interior_timestep == timestep && !m_particles_sorted
+            && m_pdata->getFlags() == m_computed_flags)
+            {
+            computeBoundaryForces(timestep);
+            }
+        else
+#endif
+            {
+            computeForces(timestep);
+            }
         }
 
+#ifdef ENABLE_MPI
+    m_interior_computed = false;
+#endif
     m_particles_sorted = false;
     m_computed_flags = m_pdata->getFlags();
     }
 
+#ifdef ENABLE_MPI
+/*! \param timestep Current time step
+
+    Called while the ghost particle update is in flight. Forces that support it compute the
+    contributions to particles that are farther than the ghost layer width from the domain
+    boundaries. The next compute() at the same timestep then only computes the remaining
+    particles.
+*/
+void ForceCompute::computeInterior(uint64_t timestep)
+    {
+    // skip when the forces are current or compute() would recompute all particles anyway
+    if (m_particles_sorted || !peekCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
+        {
+        return;
+        }
+
+    ProfileScope profile(m_sysdef->getProfiler(), m_profile_timer);
+    MemoryTracker::Scope memory(m_exec_conf->getMemoryTracker(), m_memory_tag);
+    m_interior_computed = computeInteriorForces(timestep);
+    m_interior_timestep = timestep;
+    }
+#endif
+
 /*! \param tag Global particle tag
     \returns Torque of particle referenced by tag
  */
@@ -589,7 +627,8 @@ void export_ForceCompute(pybind11::module& m)
         .def("getEnergies", &ForceCompute::getEnergiesPython)
         .def("getForces", &ForceCompute::getForcesPython)
         .def("getTorques", &ForceCompute::getTorquesPython)
-        .def("getVirials", &ForceCompute::getVirialsPython);
+        .def("getVirials", &ForceCompute::getVirialsPython)
+        .def_property("period", &ForceCompute::getPeriod, &ForceCompute::setPeriod);
     }
     } // end namespace detail
 
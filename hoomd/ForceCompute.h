@@ -64,12 +64,31 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         m_deltaT = dt;
         }
 
+    //! Set the number of steps between applications of this force by the integrator
+    void setPeriod(unsigned int period)
+        {
+        if (period == 0)
+            {
+            throw std::domain_error("period must be positive");
+            }
+        m_period = period;
+        }
+
+    //! Get the number of steps between applications of this force by the integrator
+    unsigned int getPeriod() const
+        {
+        return m_period;
+        }
+
 #ifdef ENABLE_MPI
     //! Pre-compute the forces
     /*! This method is called in MPI simulations BEFORE the particles are migrated
      * and can be used to overlap computation with communication
      */
     virtual void preCompute(uint64_t timestep) { }
+
+    //! Compute the forces on particles that do not interact with ghost particles
+    void computeInterior(uint64_t timestep);
 #endif
 
     //! Computes the forces
@@ -192,6 +211,29 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         m_particles_sorted = true;
         }
 
+#ifdef ENABLE_MPI
+    //! Compute the forces on interior particles while the ghost update is in flight
+    /*! \param timestep Current time step
+        \returns true when the interior forces were computed
+
+        Subclasses that override this method must also override computeBoundaryForces(). The
+        default implementation computes nothing.
+    */
+    virtual bool computeInteriorForces(uint64_t timestep)
+        {
+        return false;
+        }
+
+    //! Complete a computation started by computeInteriorForces()
+    virtual void computeBoundaryForces(uint64_t timestep)
+        {
+        computeForces(timestep);
+        }
+
+    bool m_interior_computed = false; //!< True when the interior forces are current
+    uint64_t m_interior_timestep = 0; //!< Timestep of the interior force computation
+#endif
+
     //! Reallocate internal arrays
     void reallocate();
 
@@ -211,6 +253,9 @@ class PYBIND11_EXPORT ForceCompute : public Compute
 
     Scalar m_deltaT; //!< timestep size (required for some types of non-conservative forces)
 
+    /// Number of steps between applications of this force by the integrator
+    unsigned int m_period = 1;
+
     GPUArray<Scalar4> m_force; //!< m_force.x,m_force.y,m_force.z are the x,y,z components of the
                                //!< force, m_force.u is the PE
 
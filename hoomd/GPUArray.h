@@ -71,6 +71,17 @@ struct access_mode
         };
     };
 
+//! Specify which memory a GPUArray allocates
+struct array_storage
+    {
+    //! The enum
+    enum Enum
+        {
+        host_device, //!< Allocate host memory and mirror it on the device
+        device_only  //!< Allocate only device memory when the device is used
+        };
+    };
+
 template<class T> class GPUArray;
 
 namespace detail
@@ -79,17 +90,22 @@ template<class T> class device_deleter
     {
     public:
     //! Default constructor
-    device_deleter() : m_use_device(false), m_N(0), m_mapped(false) { }
+    device_deleter() : m_use_device(false), m_N(0), m_mapped(false), m_memory_tag(0) { }
 
     //! Ctor
     /*! \param exec_conf Execution configuration
         \param use_device whether the array is managed or on the host
+        \param N Number of elements in the array
+        \param mapped True if the memory is mapped into the device address space
+        \param memory_tag MemoryTracker tag the allocation is accounted to
      */
     device_deleter(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                    bool use_device,
                    const size_t N,
-                   bool mapped)
-        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_mapped(mapped)
+                   bool mapped,
+                   unsigned int memory_tag = 0)
+        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_mapped(mapped),
+          m_memory_tag(memory_tag)
         {
         }
 
@@ -107,9 +123,10 @@ template<class T> class device_deleter
             this->m_exec_conf->msg->notice(10)
                 << "Freeing " << m_N * sizeof(T) << " bytes of CUDA memory." << std::endl;
 
-#ifdef ENABLE_HIP
-            hipFree(ptr);
-#endif
+            m_exec_conf->getMemoryPool().deallocate(MemoryPool::device, ptr, m_N * sizeof(T));
+            m_exec_conf->getMemoryTracker().freed(m_memory_tag,
+                                                  MemoryTracker::device,
+                                                  m_N * sizeof(T));
             }
         }
 
@@ -117,23 +134,30 @@ template<class T> class device_deleter
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
     bool m_use_device;                                         //!< Whether to use cudaMallocManaged
     size_t m_N;                                                //!< Number of elements in array
-    bool m_mapped; //!< True if this is host-mapped memory
+    bool m_mapped;             //!< True if this is host-mapped memory
+    unsigned int m_memory_tag; //!< MemoryTracker tag of the allocation
     };
 
 template<class T> class host_deleter
     {
     public:
     //! Default constructor
-    host_deleter() : m_use_device(false), m_N(0) { }
+    host_deleter() : m_use_device(false), m_N(0), m_mapped(false), m_memory_tag(0) { }
 
     //! Ctor
     /*! \param exec_conf Execution configuration
         \param use_device whether the array is managed or on the host
+        \param N Number of elements in the array
+        \param mapped True if the memory is mapped into the device address space
+        \param memory_tag MemoryTracker tag the allocation is accounted to
      */
     host_deleter(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                  bool use_device,
-                 const size_t N)
-        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N)
+                 const size_t N,
+                 bool mapped = false,
+                 unsigned int memory_tag = 0)
+        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_mapped(mapped),
+          m_memory_tag(memory_tag)
         {
         }
 
@@ -145,28 +169,32 @@ template<class T> class host_deleter
         if (ptr == nullptr)
             return;
 
-        if (m_exec_conf)
-            m_exec_conf->msg->notice(10)
-                << "Freeing " << m_N * sizeof(T) << " bytes of host memory." << std::endl;
+        if (!m_exec_conf)
+            {
+            // the array was allocated without a pool
+            free(ptr);
+            return;
+            }
+
+        m_exec_conf->msg->notice(10)
+            << "Freeing " << m_N * sizeof(T) << " bytes of host memory." << std::endl;
 
+        // return the registered or plain host block to the pool
+        MemoryPool::Kind kind = MemoryPool::host;
         if (m_use_device)
             {
-            assert(m_exec_conf);
-
-// unregister host memory from CUDA driver
-#if (ENABLE_HIP)
-            hipHostUnregister(ptr);
-#endif
+            kind = m_mapped ? MemoryPool::host_mapped : MemoryPool::host_registered;
             }
-
-        // free the allocation
-        free(ptr);
+        m_exec_conf->getMemoryPool().deallocate(kind, ptr, m_N * sizeof(T));
+        m_exec_conf->getMemoryTracker().freed(m_memory_tag, MemoryTracker::host, m_N * sizeof(T));
         }
 
     private:
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
     bool m_use_device;                                         //!< Whether to use hostMallocManaged
     size_t m_N;                                                //!< Number of elements in array
+    bool m_mapped;             //!< True if this is host-mapped memory
+    unsigned int m_memory_tag; //!< MemoryTracker tag of the allocation
     };
     } // end namespace detail
 
@@ -190,6 +218,11 @@ GPUArray<int> gpu_array(100);
 released. The pointer may in fact be re-allocated somewhere else after the handle is released and
 before the next handle is acquired.
 
+    A handle acquired with a range of elements may only access the elements in that range. Only
+those elements are copied between the host and device, and only those elements are marked as
+modified when the mode is readwrite or overwrite. Use a range when accessing a few elements of a
+large array, such as a single particle on the host after a kernel updated all of them.
+
     \ingroup data_structs
 */
 template<class T> class ArrayHandle
@@ -200,6 +233,13 @@ template<class T> class ArrayHandle
                        const access_location::Enum location = access_location::host,
                        const access_mode::Enum mode = access_mode::readwrite);
 
+    //! Aquires the data for access to the elements [first, first + count) only
+    inline ArrayHandle(const GPUArray<T>& gpu_array,
+                       const access_location::Enum location,
+                       const access_mode::Enum mode,
+                       size_t first,
+                       size_t count);
+
     //! Notifies the containing GPUArray that the handle has been released
     ~ArrayHandle()
         {
@@ -297,6 +337,13 @@ copies to the desired location before the data can be accessed and again before
 the data is to be completely overwritten \b without reading it first, then an expensive memory copy
 can be avoided by using the \a overwrite mode.
 
+GPUArray tracks the range of elements that differ between the host and device copies. An access
+in a new location copies only that range and writes through a handle acquired with a range of
+elements (see ArrayHandle) only add their range to it.
+
+1-D arrays constructed with array_storage::device_only allocate no host memory when the device is
+used. They cannot be accessed on the host and are meant for scratch space in GPU code paths.
+
 Data with both 1-D and 2-D representations can be allocated by using the appropriate constructor.
 2-D allocated data is still just a flat pointer, but the row width is rounded up to a multiple of
 16 elements to facilitate coalescing. The actual allocated width is accessible with getPitch(). Here
@@ -325,6 +372,10 @@ template<class T> class GPUArray
     GPUArray(size_t num_elements, std::shared_ptr<const ExecutionConfiguration> exec_conf);
     //! Constructs a 2-D GPUArray
     GPUArray(size_t width, size_t height, std::shared_ptr<const ExecutionConfiguration> exec_conf);
+    //! Constructs a 1-D GPUArray with the given storage
+    GPUArray(size_t num_elements,
+             std::shared_ptr<const ExecutionConfiguration> exec_conf,
+             array_storage::Enum storage);
     //! Frees memory
     ~GPUArray() { }
 
@@ -364,10 +415,34 @@ template<class T> class GPUArray
         return m_num_elements;
         }
 
+    //! Get the version of the data
+    /*! The version increases with every acquire that may write to the array, and when the array
+        is assigned or swapped. Equal versions at two points in time mean that the data did not
+        change in between.
+    */
+    uint64_t getVersion() const
+        {
+        return m_version;
+        }
+
     //! Test if the GPUArray is NULL
     bool isNull() const
         {
+#ifdef ENABLE_HIP
+        return !h_data && !d_data;
+#else
         return !h_data;
+#endif
+        }
+
+    //! Test if the GPUArray has no host memory
+    bool isDeviceOnly() const
+        {
+#ifdef ENABLE_HIP
+        return m_device_only;
+#else
+        return false;
+#endif
         }
 
     //! Get the width of the allocated rows in elements
@@ -452,6 +527,17 @@ template<class T> class GPUArray
 #endif
     ) const;
 
+    //! Acquires the data pointer for use of the elements [first, last)
+    inline T* acquireRange(const access_location::Enum location,
+                           const access_mode::Enum mode,
+                           size_t first,
+                           size_t last
+#ifdef ENABLE_HIP
+                           ,
+                           bool async = false
+#endif
+    ) const;
+
     //! Release the data pointer
     inline void release() const
         {
@@ -471,8 +557,17 @@ template<class T> class GPUArray
 
     mutable bool m_acquired;                     //!< Tracks whether the data has been acquired
     mutable data_location::Enum m_data_location; //!< Tracks the current location of the data
+    unsigned int m_memory_tag = 0;               //!< MemoryTracker tag of the allocations
+
+    //! First element that is out of date in the location not in m_data_location
+    mutable size_t m_dirty_begin = 0;
+    //! One past the last element that is out of date in the location not in m_data_location
+    mutable size_t m_dirty_end = 0;
+    //! Version of the data, see getVersion()
+    mutable uint64_t m_version = 0;
 #ifdef ENABLE_HIP
-    bool m_mapped; //!< True if we are using mapped memory
+    bool m_mapped;              //!< True if we are using mapped memory
+    bool m_device_only = false; //!< True if no host memory is allocated
 #endif
 
     // ok, this looks weird, but I want m_exec_conf to be protected and not have to go reorder all
@@ -492,13 +587,52 @@ template<class T> class GPUArray
     //! Helper function to allocate memory
     inline void allocate();
 
+    //! Add the elements [first, last) to the dirty range
+    inline void markDirty(size_t first, size_t last) const
+        {
+        if (m_dirty_begin >= m_dirty_end)
+            {
+            m_dirty_begin = first;
+            m_dirty_end = last;
+            }
+        else if (first < last)
+            {
+            m_dirty_begin = std::min(m_dirty_begin, first);
+            m_dirty_end = std::max(m_dirty_end, last);
+            }
+        }
+
+    //! Remove the elements [first, last) from the dirty range when they cover one end of it
+    inline void markClean(size_t first, size_t last) const
+        {
+        if (first <= m_dirty_begin && last > m_dirty_begin)
+            m_dirty_begin = std::min(last, m_dirty_end);
+        else if (last >= m_dirty_end && first < m_dirty_end)
+            m_dirty_end = std::max(first, m_dirty_begin);
+        }
+
+    //! Test if the dirty range is inside the elements [first, last)
+    inline bool isDirtyWithin(size_t first, size_t last) const
+        {
+        return m_dirty_begin >= m_dirty_end || (first <= m_dirty_begin && m_dirty_end <= last);
+        }
+
 #ifdef ENABLE_HIP
-    //! Helper function to copy memory from the device to host
-    inline void memcpyDeviceToHost(bool async) const;
-    //! Helper function to copy memory from the host to device
-    inline void memcpyHostToDevice(bool async) const;
+    //! Helper function to copy the elements [first, last) from the device to host
+    inline void memcpyDeviceToHost(bool async, size_t first, size_t last) const;
+    //! Helper function to copy the elements [first, last) from the host to device
+    inline void memcpyHostToDevice(bool async, size_t first, size_t last) const;
 #endif
 
+    //! Helper function to allocate (registered) host memory from the pool
+    inline T* allocateHostMemory(size_t num_elements);
+
+    //! Helper function to allocate device memory from the pool
+    inline T* allocateDeviceMemory(size_t num_elements);
+
+    //! Helper function to make the deleter for host memory
+    inline hoomd::detail::host_deleter<T> makeHostDeleter(size_t num_elements) const;
+
     //! Helper function to resize host array
     inline T* resizeHostArray(size_t num_elements);
 
@@ -534,6 +668,22 @@ ArrayHandle<T>::ArrayHandle(const GPUArray<T>& array,
     {
     }
 
+/*! \param gpu_array GPUArray host to the pointer data
+    \param location Desired location to access the data
+    \param mode Mode to access the data with
+    \param first First element to access
+    \param count Number of elements to access
+*/
+template<class T>
+ArrayHandle<T>::ArrayHandle(const GPUArray<T>& array,
+                            const access_location::Enum location,
+                            const access_mode::Enum mode,
+                            size_t first,
+                            size_t count)
+    : gpu_array(array), data(array.acquireRange(location, mode, first, first + count))
+    {
+    }
+
 #ifdef ENABLE_HIP
 template<class T>
 ArrayHandleAsync<T>::ArrayHandleAsync(const GPUArray<T>& array,
@@ -614,6 +764,30 @@ GPUArray<T>::GPUArray(size_t width,
     memclear();
     }
 
+/*! \param num_elements Number of elements to allocate in the array
+    \param exec_conf Shared pointer to the execution configuration for managing CUDA initialization
+   and shutdown
+    \param storage Memory to allocate. array_storage::device_only arrays allocate host memory only
+   when the execution configuration does not use the device.
+*/
+template<class T>
+GPUArray<T>::GPUArray(size_t num_elements,
+                      std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                      array_storage::Enum storage)
+    : m_num_elements(num_elements), m_pitch(num_elements), m_height(1), m_acquired(false),
+      m_data_location(data_location::host),
+#ifdef ENABLE_HIP
+      m_mapped(false),
+      m_device_only(storage == array_storage::device_only && exec_conf
+                    && exec_conf->isCUDAEnabled()),
+#endif
+      m_exec_conf(exec_conf)
+    {
+    // allocate and clear memory
+    allocate();
+    memclear();
+    }
+
 #ifdef ENABLE_HIP
 /*! \param num_elements Number of elements to allocate in the array
     \param exec_conf Shared pointer to the execution configuration for managing CUDA initialization
@@ -661,10 +835,13 @@ GPUArray<T>::GPUArray(const GPUArray& from) noexcept
     : m_num_elements(from.m_num_elements), m_pitch(from.m_pitch), m_height(from.m_height),
       m_acquired(false), m_data_location(data_location::host),
 #ifdef ENABLE_HIP
-      m_mapped(from.m_mapped),
+      m_mapped(from.m_mapped), m_device_only(from.m_device_only),
 #endif
       m_exec_conf(from.m_exec_conf)
     {
+    // account the copy to the same owner
+    m_memory_tag = from.m_memory_tag;
+
     // allocate and clear new memory the same size as the data in from
     allocate();
     memclear();
@@ -675,6 +852,13 @@ GPUArray<T>::GPUArray(const GPUArray& from) noexcept
         ArrayHandle<T> h_handle(from, access_location::host, access_mode::read);
         memcpy(h_data.get(), h_handle.data, sizeof(T) * m_num_elements);
         }
+#ifdef ENABLE_HIP
+    else if (from.isDeviceOnly() && from.d_data)
+        {
+        ArrayHandle<T> d_handle(from, access_location::device, access_mode::read);
+        hipMemcpy(d_data.get(), d_handle.data, sizeof(T) * m_num_elements, hipMemcpyDeviceToDevice);
+        }
+#endif
     }
 
 template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexcept
@@ -689,11 +873,14 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
         m_pitch = rhs.m_pitch;
         m_height = rhs.m_height;
         m_exec_conf = rhs.m_exec_conf;
+        m_memory_tag = rhs.m_memory_tag;
 #ifdef ENABLE_HIP
         m_mapped = rhs.m_mapped;
+        m_device_only = rhs.m_device_only;
 #endif
         // initialize state variables
         m_data_location = data_location::host;
+        m_version = std::max(m_version, rhs.m_version) + 1;
 
         // copy over the data to the new GPUArray
         if (rhs.h_data)
@@ -705,6 +892,19 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
             ArrayHandle<T> h_handle(rhs, access_location::host, access_mode::read);
             memcpy(h_data.get(), h_handle.data, sizeof(T) * m_num_elements);
             }
+#ifdef ENABLE_HIP
+        else if (rhs.isDeviceOnly() && rhs.d_data)
+            {
+            h_data.reset();
+            allocate();
+
+            ArrayHandle<T> d_handle(rhs, access_location::device, access_mode::read);
+            hipMemcpy(d_data.get(),
+                      d_handle.data,
+                      sizeof(T) * m_num_elements,
+                      hipMemcpyDeviceToDevice);
+            }
+#endif
         else
             {
             h_data.reset();
@@ -723,12 +923,15 @@ template<class T>
 GPUArray<T>::GPUArray(GPUArray&& from) noexcept
     : m_num_elements(std::move(from.m_num_elements)), m_pitch(std::move(from.m_pitch)),
       m_height(std::move(from.m_height)), m_acquired(std::move(from.m_acquired)),
-      m_data_location(std::move(from.m_data_location)),
+      m_data_location(std::move(from.m_data_location)), m_dirty_begin(from.m_dirty_begin),
+      m_dirty_end(from.m_dirty_end), m_version(from.m_version),
 #ifdef ENABLE_HIP
-      m_mapped(std::move(from.m_mapped)), d_data(std::move(from.d_data)),
+      m_mapped(std::move(from.m_mapped)), m_device_only(from.m_device_only),
+      d_data(std::move(from.d_data)),
 #endif
       h_data(std::move(from.h_data)), m_exec_conf(std::move(from.m_exec_conf))
     {
+    m_memory_tag = from.m_memory_tag;
     }
 
 //! Move assignment operator
@@ -740,12 +943,17 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(GPUArray&& rhs) noexcept
         m_pitch = std::move(rhs.m_pitch);
         m_height = std::move(rhs.m_height);
         m_exec_conf = std::move(rhs.m_exec_conf);
+        m_memory_tag = rhs.m_memory_tag;
 #ifdef ENABLE_HIP
         m_mapped = std::move(rhs.m_mapped);
+        m_device_only = rhs.m_device_only;
         d_data = std::move(rhs.d_data);
 #endif
         h_data = std::move(rhs.h_data);
         m_data_location = std::move(rhs.m_data_location);
+        m_dirty_begin = rhs.m_dirty_begin;
+        m_dirty_end = rhs.m_dirty_end;
+        m_version = std::max(m_version, rhs.m_version) + 1;
         m_acquired = std::move(rhs.m_acquired);
         }
 
@@ -776,10 +984,16 @@ template<class T> void GPUArray<T>::swap(GPUArray& from)
     std::swap(m_height, from.m_height);
     std::swap(m_acquired, from.m_acquired);
     std::swap(m_data_location, from.m_data_location);
+    std::swap(m_dirty_begin, from.m_dirty_begin);
+    std::swap(m_dirty_end, from.m_dirty_end);
+    // both arrays hold data that differs from what either one held before
+    m_version = from.m_version = std::max(m_version, from.m_version) + 1;
+    std::swap(m_memory_tag, from.m_memory_tag);
     std::swap(m_exec_conf, from.m_exec_conf);
 #ifdef ENABLE_HIP
     std::swap(d_data, from.d_data);
     std::swap(m_mapped, from.m_mapped);
+    std::swap(m_device_only, from.m_device_only);
 #endif
     std::swap(h_data, from.h_data);
     }
@@ -818,37 +1032,33 @@ template<class T> void GPUArray<T>::allocate()
             << "GPUArray: Allocating " << float(m_num_elements * sizeof(T)) / 1024.0f / 1024.0f
             << " MB" << std::endl;
 
-    void* host_ptr = nullptr;
+    // the host and device copies differ until the data is first copied
+    m_dirty_begin = 0;
+    m_dirty_end = m_num_elements;
 
-    // allocate host memory
-    // at minimum, alignment needs to be 32 bytes for AVX
-    int retval = posix_memalign(&host_ptr, 32, m_num_elements * sizeof(T));
-    if (retval != 0)
+    // allocate host memory (registered for DMA when using the device)
+    if (!isDeviceOnly())
         {
-        throw std::bad_alloc();
-        }
+        T* host_ptr = allocateHostMemory(m_num_elements);
 
-    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
+        // store in smart ptr with custom deleter
+        h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(
+            host_ptr,
+            makeHostDeleter(m_num_elements));
+        }
 
 #ifdef ENABLE_HIP
+    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
     void* device_ptr = nullptr;
-    if (use_device)
+
+    // device-only data lives on the device from the start
+    if (isDeviceOnly())
         {
-// register pointer for DMA
-#ifdef ENABLE_HIP
-        hipHostRegister(host_ptr,
-                        m_num_elements * sizeof(T),
-                        m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
-#endif
-        CHECK_CUDA_ERROR();
+        m_data_location = data_location::device;
+        m_dirty_end = 0;
         }
 #endif
 
-    // store in smart ptr with custom deleter
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, m_num_elements);
-    h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(reinterpret_cast<T*>(host_ptr),
-                                                                host_deleter);
-
 #if defined(ENABLE_HIP)
     if (m_exec_conf && m_exec_conf->isCUDAEnabled())
         {
@@ -872,24 +1082,15 @@ template<class T> void GPUArray<T>::allocate()
             }
         else
             {
-#ifdef ENABLE_HIP
-            hipError_t error = hipMalloc(&device_ptr, m_num_elements * sizeof(T));
-            if (error == hipErrorMemoryAllocation)
-                {
-                throw std::bad_alloc();
-                }
-            else if (error != hipSuccess)
-                {
-                throw std::runtime_error(hipGetErrorString(error));
-                }
-#endif
+            device_ptr = allocateDeviceMemory(m_num_elements);
             }
 
         // store in smart pointer with custom deleter
         hoomd::detail::device_deleter<T> device_deleter(m_exec_conf,
                                                         use_device,
                                                         m_num_elements,
-                                                        m_mapped);
+                                                        m_mapped,
+                                                        m_memory_tag);
         d_data
             = std::unique_ptr<T, hoomd::detail::device_deleter<T>>(reinterpret_cast<T*>(device_ptr),
                                                                    device_deleter);
@@ -903,14 +1104,14 @@ template<class T> void GPUArray<T>::allocate()
 template<class T> void GPUArray<T>::memclear(size_t first)
     {
     // don't do anything if there are no elements
-    if (!h_data.get())
+    if (isNull())
         return;
 
-    assert(h_data);
     assert(first < m_num_elements);
 
     // clear memory
-    memset((void*)(h_data.get() + first), 0, sizeof(T) * (m_num_elements - first));
+    if (h_data)
+        memset((void*)(h_data.get() + first), 0, sizeof(T) * (m_num_elements - first));
 
 #if defined(ENABLE_HIP)
     if (m_exec_conf && m_exec_conf->isCUDAEnabled())
@@ -925,9 +1126,13 @@ template<class T> void GPUArray<T>::memclear(size_t first)
     }
 
 #if defined(ENABLE_HIP)
-/*! \post All memory on the device is copied to the host array
+/*! \param async True if the copy should be asynchronous
+    \param first First element to copy
+    \param last One past the last element to copy
+    \post The elements [first, last) on the device are copied to the host array
  */
-template<class T> void GPUArray<T>::memcpyDeviceToHost(bool async) const
+template<class T>
+void GPUArray<T>::memcpyDeviceToHost(bool async, size_t first, size_t last) const
     {
     // don't do anything if there are no elements
     if (!h_data.get())
@@ -943,30 +1148,38 @@ template<class T> void GPUArray<T>::memcpyDeviceToHost(bool async) const
         return;
         }
 
+    if (first >= last)
+        return;
+
+    const size_t num_bytes = sizeof(T) * (last - first);
     if (m_exec_conf)
         m_exec_conf->msg->notice(10)
-            << "GPUArray: Copying " << float(m_num_elements * sizeof(T)) / 1024.0f / 1024.0f
-            << " MB device->host " << (async ? std::string("async") : std::string()) << std::endl;
+            << "GPUArray: Copying " << float(num_bytes) / 1024.0f / 1024.0f << " MB device->host "
+            << (async ? std::string("async") : std::string()) << std::endl;
 #ifdef ENABLE_HIP
     if (async)
         {
-        hipMemcpyAsync(h_data.get(),
-                       d_data.get(),
-                       sizeof(T) * m_num_elements,
+        hipMemcpyAsync(h_data.get() + first,
+                       d_data.get() + first,
+                       num_bytes,
                        hipMemcpyDeviceToHost);
         }
     else
         {
-        hipMemcpy(h_data.get(), d_data.get(), sizeof(T) * m_num_elements, hipMemcpyDeviceToHost);
+        hipMemcpy(h_data.get() + first, d_data.get() + first, num_bytes, hipMemcpyDeviceToHost);
         }
 #endif
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     }
 
-/*! \post All memory on the host is copied to the device array
+/*! \param async True if the copy should be asynchronous
+    \param first First element to copy
+    \param last One past the last element to copy
+    \post The elements [first, last) on the host are copied to the device array
  */
-template<class T> void GPUArray<T>::memcpyHostToDevice(bool async) const
+template<class T>
+void GPUArray<T>::memcpyHostToDevice(bool async, size_t first, size_t last) const
     {
     // don't do anything if there are no elements
     if (!h_data.get())
@@ -979,20 +1192,24 @@ template<class T> void GPUArray<T>::memcpyHostToDevice(bool async) const
         return;
         }
 
+    if (first >= last)
+        return;
+
+    const size_t num_bytes = sizeof(T) * (last - first);
     if (m_exec_conf)
         m_exec_conf->msg->notice(10)
-            << "GPUArray: Copying " << float(m_num_elements * sizeof(T)) / 1024.0f / 1024.0f
-            << " MB host->device " << (async ? std::string("async") : std::string()) << std::endl;
+            << "GPUArray: Copying " << float(num_bytes) / 1024.0f / 1024.0f << " MB host->device "
+            << (async ? std::string("async") : std::string()) << std::endl;
     if (async)
 #ifdef ENABLE_HIP
-        hipMemcpyAsync(d_data.get(),
-                       h_data.get(),
-                       sizeof(T) * m_num_elements,
+        hipMemcpyAsync(d_data.get() + first,
+                       h_data.get() + first,
+                       num_bytes,
                        hipMemcpyHostToDevice);
 #endif
     else
 #ifdef ENABLE_HIP
-        hipMemcpy(d_data.get(), h_data.get(), sizeof(T) * m_num_elements, hipMemcpyHostToDevice);
+        hipMemcpy(d_data.get() + first, h_data.get() + first, num_bytes, hipMemcpyHostToDevice);
 #endif
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -1003,9 +1220,7 @@ template<class T> void GPUArray<T>::memcpyHostToDevice(bool async) const
     \param mode Mode to access the data with
     \param async True if array copying should be done async
 
-    acquire() is the workhorse of GPUArray. It tracks the internal state variable \a data_location
-   and performs all host<->device memory copies as needed during the state changes given the
-    specified access mode and location where the data is to be acquired.
+    acquire() acquires all elements. See acquireRange().
 
     acquire() cannot be directly called by the user class. Data must be accessed through
    ArrayHandle.
@@ -1017,6 +1232,42 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
                         ,
                         bool async
 #endif
+) const
+    {
+#ifdef ENABLE_HIP
+    return acquireRange(location, mode, 0, m_num_elements, async);
+#else
+    return acquireRange(location, mode, 0, m_num_elements);
+#endif
+    }
+
+/*! \param location Desired location to access the data
+    \param mode Mode to access the data with
+    \param first First element that will be accessed
+    \param last One past the last element that will be accessed
+    \param async True if array copying should be done async
+
+    acquireRange() is the workhorse of GPUArray. It tracks the internal state variable \a
+   data_location and performs all host<->device memory copies as needed during the state changes
+   given the specified access mode and location where the data is to be acquired.
+
+    The dirty range holds the elements that are out of date in the location that was not written
+   last. Reads copy the part of the dirty range in [first, last) and writes add [first, last) to
+   it. When a write follows changes in the other location, the whole dirty range is copied first
+   so that only one location holds changes at a time.
+
+    acquireRange() cannot be directly called by the user class. Data must be accessed through
+   ArrayHandle.
+*/
+template<class T>
+T* GPUArray<T>::acquireRange(const access_location::Enum location,
+                             const access_mode::Enum mode,
+                             size_t first,
+                             size_t last
+#ifdef ENABLE_HIP
+                             ,
+                             bool async
+#endif
 ) const
     {
     if (m_acquired)
@@ -1025,18 +1276,34 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
         }
     m_acquired = true;
 
+    if (mode != access_mode::read)
+        m_version++;
+
     // base case - handle acquiring a NULL GPUArray by simply returning NULL to prevent any memcpys
     // from being attempted
     if (isNull())
         return nullptr;
 
+    last = std::min(last, m_num_elements);
+    first = std::min(first, last);
+
     // first, break down based on where the data is to be acquired
     if (location == access_location::host)
         {
+#ifdef ENABLE_HIP
+        if (isDeviceOnly())
+            {
+            m_acquired = false;
+            throw std::runtime_error("Cannot access a device-only array on the host.");
+            }
+#endif
+
         // then break down based on the current location of the data
         if (m_data_location == data_location::host)
             {
             // the state stays on the host regardles of the access mode
+            if (mode != access_mode::read)
+                markDirty(first, last);
             return h_data.get();
             }
 #ifdef ENABLE_HIP
@@ -1054,6 +1321,11 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
                 throw std::runtime_error("Invalid access mode requested.");
                 }
 
+            if (mode != access_mode::read)
+                {
+                m_dirty_begin = first;
+                m_dirty_end = last;
+                }
             return h_data.get();
             }
         else if (m_data_location == data_location::device)
@@ -1061,23 +1333,34 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
             // finally perform the action based on the access mode requested
             if (mode == access_mode::read)
                 {
-                // need to copy data from the device to the host
-                memcpyDeviceToHost(async);
-                // state goes to hostdevice
-                m_data_location = data_location::hostdevice;
+                // need to copy the accessed part of the dirty range from the device to the host
+                memcpyDeviceToHost(async,
+                                   std::max(first, m_dirty_begin),
+                                   std::min(last, m_dirty_end));
+                markClean(first, last);
+
+                // state goes to hostdevice when the host is up to date
+                if (m_dirty_begin >= m_dirty_end)
+                    m_data_location = data_location::hostdevice;
                 }
             else if (mode == access_mode::readwrite)
                 {
                 // need to copy data from the device to the host
-                memcpyDeviceToHost(async);
+                memcpyDeviceToHost(async, m_dirty_begin, m_dirty_end);
                 // state goes to host
                 m_data_location = data_location::host;
+                m_dirty_begin = first;
+                m_dirty_end = last;
                 }
             else if (mode == access_mode::overwrite)
                 {
-                // no need to copy data, it will be overwritten
+                // no need to copy data that will be overwritten
+                if (!isDirtyWithin(first, last))
+                    memcpyDeviceToHost(async, m_dirty_begin, m_dirty_end);
                 // state goes to host
                 m_data_location = data_location::host;
+                m_dirty_begin = first;
+                m_dirty_end = last;
                 }
             else
                 {
@@ -1116,23 +1399,34 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
             // finally perform the action based on the access mode requested
             if (mode == access_mode::read)
                 {
-                // need to copy data to the device
-                memcpyHostToDevice(async);
-                // state goes to hostdevice
-                m_data_location = data_location::hostdevice;
+                // need to copy the accessed part of the dirty range to the device
+                memcpyHostToDevice(async,
+                                   std::max(first, m_dirty_begin),
+                                   std::min(last, m_dirty_end));
+                markClean(first, last);
+
+                // state goes to hostdevice when the device is up to date
+                if (m_dirty_begin >= m_dirty_end)
+                    m_data_location = data_location::hostdevice;
                 }
             else if (mode == access_mode::readwrite)
                 {
                 // need to copy data to the device
-                memcpyHostToDevice(async);
+                memcpyHostToDevice(async, m_dirty_begin, m_dirty_end);
                 // state goes to device
                 m_data_location = data_location::device;
+                m_dirty_begin = first;
+                m_dirty_end = last;
                 }
             else if (mode == access_mode::overwrite)
                 {
-                // no need to copy data to the device, it is to be overwritten
+                // no need to copy data to the device that is to be overwritten
+                if (!isDirtyWithin(first, last))
+                    memcpyHostToDevice(async, m_dirty_begin, m_dirty_end);
                 // state goes to device
                 m_data_location = data_location::device;
+                m_dirty_begin = first;
+                m_dirty_end = last;
                 }
             else
                 {
@@ -1154,11 +1448,19 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
                 {
                 throw std::runtime_error("Invalid access mode requested.");
                 }
+
+            if (mode != access_mode::read)
+                {
+                m_dirty_begin = first;
+                m_dirty_end = last;
+                }
             return d_data.get();
             }
         else if (m_data_location == data_location::device)
             {
             // the stat stays on the device regardless of the access mode
+            if (mode != access_mode::read && !isDeviceOnly())
+                markDirty(first, last);
             return d_data.get();
             }
         else
@@ -1175,6 +1477,90 @@ T* GPUArray<T>::acquire(const access_location::Enum location,
         }
     }
 
+/*! \param num_elements Number of elements to allocate
+
+    Host memory is registered for DMA (and mapped when requested) when the execution configuration
+    uses the device. Arrays without an execution configuration allocate directly.
+
+    \returns a pointer to uninitialized host memory
+*/
+template<class T> T* GPUArray<T>::allocateHostMemory(size_t num_elements)
+    {
+    if (!m_exec_conf)
+        {
+        void* host_ptr = nullptr;
+
+        // at minimum, alignment needs to be 32 bytes for AVX
+        int retval = posix_memalign(&host_ptr, 32, num_elements * sizeof(T));
+        if (retval != 0)
+            {
+            throw std::bad_alloc();
+            }
+        return reinterpret_cast<T*>(host_ptr);
+        }
+
+    MemoryPool::Kind kind = MemoryPool::host;
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        // Check for pending errors.
+        CHECK_CUDA_ERROR();
+        kind = m_mapped ? MemoryPool::host_mapped : MemoryPool::host_registered;
+        }
+#endif
+
+    T* host_ptr = reinterpret_cast<T*>(
+        m_exec_conf->getMemoryPool().allocate(kind, num_elements * sizeof(T)));
+
+    // adopt the current owner unless the array already has one
+    MemoryTracker& tracker = m_exec_conf->getMemoryTracker();
+    if (m_memory_tag == 0)
+        {
+        m_memory_tag = tracker.getCurrentTag();
+        }
+    tracker.allocated(m_memory_tag, MemoryTracker::host, num_elements * sizeof(T));
+
+    return host_ptr;
+    }
+
+/*! \param num_elements Number of elements to allocate
+    \returns a pointer to uninitialized device memory
+*/
+template<class T> T* GPUArray<T>::allocateDeviceMemory(size_t num_elements)
+    {
+    assert(m_exec_conf);
+    T* device_ptr = reinterpret_cast<T*>(
+        m_exec_conf->getMemoryPool().allocate(MemoryPool::device, num_elements * sizeof(T)));
+
+    MemoryTracker& tracker = m_exec_conf->getMemoryTracker();
+    if (m_memory_tag == 0)
+        {
+        m_memory_tag = tracker.getCurrentTag();
+        }
+    tracker.allocated(m_memory_tag, MemoryTracker::device, num_elements * sizeof(T));
+
+    return device_ptr;
+    }
+
+/*! \param num_elements Number of elements in the host allocation
+    \returns a deleter that returns the allocation to the pool it came from
+*/
+template<class T>
+hoomd::detail::host_deleter<T> GPUArray<T>::makeHostDeleter(size_t num_elements) const
+    {
+    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
+#ifdef ENABLE_HIP
+    bool mapped = m_mapped;
+#else
+    bool mapped = false;
+#endif
+    return hoomd::detail::host_deleter<T>(m_exec_conf,
+                                          use_device,
+                                          num_elements,
+                                          mapped,
+                                          m_memory_tag);
+    }
+
 /*! \post Memory on the host is resized, the newly allocated part of the array
  *        is reset to zero
  *! \returns a pointer to the newly allocated memory area
@@ -1186,27 +1572,8 @@ template<class T> T* GPUArray<T>::resizeHostArray(size_t num_elements)
         return NULL;
 
     // allocate resized array
-    T* h_tmp = NULL;
+    T* h_tmp = allocateHostMemory(num_elements);
 
-    // allocate host memory
-    // at minimum, alignment needs to be 32 bytes for AVX
-    int retval = posix_memalign((void**)&h_tmp, 32, num_elements * sizeof(T));
-    if (retval != 0)
-        {
-        throw std::bad_alloc();
-        }
-
-#ifdef ENABLE_HIP
-    if (m_exec_conf && m_exec_conf->isCUDAEnabled())
-        {
-#ifdef ENABLE_HIP
-        hipHostRegister(h_tmp,
-                        num_elements * sizeof(T),
-                        m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
-#endif
-        CHECK_CUDA_ERROR();
-        }
-#endif
     // clear memory
     memset((void*)h_tmp, 0, sizeof(T) * num_elements);
 
@@ -1215,14 +1582,14 @@ template<class T> T* GPUArray<T>::resizeHostArray(size_t num_elements)
     memcpy((void*)h_tmp, (void*)h_data.get(), sizeof(T) * num_copy_elements);
 
     // update smart pointer
-    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, num_elements);
-    h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp, host_deleter);
+    h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp,
+                                                                makeHostDeleter(num_elements));
 
 #ifdef ENABLE_HIP
     // update device pointer
     if (m_mapped)
         {
+        bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
         void* dev_ptr = nullptr;
 #ifdef ENABLE_HIP
         hipHostGetDevicePointer(&dev_ptr, h_data.get(), 0);
@@ -1249,26 +1616,7 @@ template<class T>
 T* GPUArray<T>::resize2DHostArray(size_t pitch, size_t new_pitch, size_t height, size_t new_height)
     {
     // allocate resized array
-    T* h_tmp = NULL;
-
-    // allocate host memory
-    // at minimum, alignment needs to be 32 bytes for AVX
-    size_t size = new_pitch * new_height * sizeof(T);
-    int retval = posix_memalign((void**)&h_tmp, 32, size);
-    if (retval != 0)
-        {
-        throw std::bad_alloc();
-        }
-
-#ifdef ENABLE_HIP
-    if (m_exec_conf && m_exec_conf->isCUDAEnabled())
-        {
-#ifdef ENABLE_HIP
-        hipHostRegister(h_tmp, size, m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
-#endif
-        CHECK_CUDA_ERROR();
-        }
-#endif
+    T* h_tmp = allocateHostMemory(new_pitch * new_height);
 
     // clear memory
     memset((void*)h_tmp, 0, sizeof(T) * new_pitch * new_height);
@@ -1283,14 +1631,15 @@ T* GPUArray<T>::resize2DHostArray(size_t pitch, size_t new_pitch, size_t height,
                sizeof(T) * num_copy_columns);
 
     // update smart pointer
-    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, new_pitch * new_height);
-    h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp, host_deleter);
+    h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(
+        h_tmp,
+        makeHostDeleter(new_pitch * new_height));
 
 #ifdef ENABLE_HIP
     // update device pointer
     if (m_mapped)
         {
+        bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
         void* dev_ptr = nullptr;
 #ifdef ENABLE_HIP
         hipHostGetDevicePointer(&dev_ptr, h_data.get(), 0);
@@ -1324,18 +1673,7 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
         return NULL;
 
     // allocate resized array
-    T* d_tmp;
-#ifdef ENABLE_HIP
-    hipError_t error = hipMalloc(&d_tmp, num_elements * sizeof(T));
-    if (error == hipErrorMemoryAllocation)
-        {
-        throw std::bad_alloc();
-        }
-    else if (error != hipSuccess)
-        {
-        throw std::runtime_error(hipGetErrorString(error));
-        }
-#endif
+    T* d_tmp = allocateDeviceMemory(num_elements);
 
     assert(d_tmp);
 
@@ -1356,7 +1694,8 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
     hoomd::detail::device_deleter<T> device_deleter(m_exec_conf,
                                                     m_exec_conf->isCUDAEnabled(),
                                                     num_elements,
-                                                    m_mapped);
+                                                    m_mapped,
+                                                    m_memory_tag);
     d_data = std::unique_ptr<T, hoomd::detail::device_deleter<T>>(d_tmp, device_deleter);
 
     return d_data.get();
@@ -1383,18 +1722,7 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
         return NULL;
 
     // allocate resized array
-    T* d_tmp;
-#ifdef ENABLE_HIP
-    hipError_t error = hipMalloc(&d_tmp, new_pitch * new_height * sizeof(T));
-    if (error == hipErrorMemoryAllocation)
-        {
-        throw std::bad_alloc();
-        }
-    else if (error != hipSuccess)
-        {
-        throw std::runtime_error(hipGetErrorString(error));
-        }
-#endif
+    T* d_tmp = allocateDeviceMemory(new_pitch * new_height);
     assert(d_tmp);
 
 // clear memory
@@ -1423,7 +1751,8 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
     hoomd::detail::device_deleter<T> device_deleter(m_exec_conf,
                                                     m_exec_conf->isCUDAEnabled(),
                                                     new_pitch * new_height,
-                                                    m_mapped);
+                                                    m_mapped,
+                                                    m_memory_tag);
     d_data = std::unique_ptr<T, hoomd::detail::device_deleter<T>>(d_tmp, device_deleter);
 
     return d_data.get();
@@ -1463,13 +1792,18 @@ template<class T> void GPUArray<T>::resize(size_t num_elements)
             << "GPUArray: Resizing to " << float(num_elements * sizeof(T)) / 1024.0f / 1024.0f
             << " MB" << std::endl;
 
-    resizeHostArray(num_elements);
+    if (!isDeviceOnly())
+        resizeHostArray(num_elements);
 #ifdef ENABLE_HIP
     if (m_exec_conf && m_exec_conf->isCUDAEnabled())
         resizeDeviceArray(num_elements);
 #endif
     m_num_elements = num_elements;
     m_pitch = num_elements;
+
+    // both copies of the new elements are cleared
+    m_dirty_end = std::min(m_dirty_end, m_num_elements);
+    m_dirty_begin = std::min(m_dirty_begin, m_dirty_end);
     }
 
 /*! \param width new width of array
@@ -1506,7 +1840,8 @@ template<class T> void GPUArray<T>::resize(size_t width, size_t height)
             << "GPUArray is trying to allocate a very large (>4GB) amount of memory." << std::endl;
         }
 
-    resize2DHostArray(m_pitch, new_pitch, m_height, height);
+    if (!isDeviceOnly())
+        resize2DHostArray(m_pitch, new_pitch, m_height, height);
 #ifdef ENABLE_HIP
     if (m_exec_conf && m_exec_conf->isCUDAEnabled())
         resize2DDeviceArray(m_pitch, new_pitch, m_height, height);
@@ -1516,6 +1851,10 @@ template<class T> void GPUArray<T>::resize(size_t width, size_t height)
     m_height = height;
     m_pitch = new_pitch;
     m_num_elements = m_pitch * m_height;
+
+    // the rows move when the pitch changes
+    m_dirty_begin = 0;
+    m_dirty_end = isDeviceOnly() ? 0 : m_num_elements;
     }
 
     } // end namespace hoomd
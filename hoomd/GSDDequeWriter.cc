@@ -4,6 +4,8 @@
 #include "GSDDequeWriter.h"
 #include "hoomd/GSDDumpWriter.h"
 
+#include <algorithm>
+
 namespace hoomd
     {
 GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
@@ -52,19 +54,52 @@ GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
 
 void GSDDequeWriter::analyze(uint64_t timestep)
     {
-    m_frame_queue.emplace_front();
-    populateLocalFrame(m_frame_queue.front(), timestep);
-    m_log_queue.push_front(getLogData());
-    if (m_queue_size != -1 && m_frame_queue.size() > static_cast<size_t>(m_queue_size))
+    if (m_queue_size == 0)
+        {
+        // nothing is buffered, but the collective calls must still be made on every rank
+        populateLocalFrame(m_scratch_frame, timestep);
+        pybind11::gil_scoped_acquire acquire_gil;
+        getLogData();
+        return;
+        }
+
+    size_t capacity = m_frame_ring.size();
+    size_t index;
+    if (m_ring_size < capacity)
         {
-        m_frame_queue.pop_back();
-        m_log_queue.pop_back();
+        // reuse a slot freed by a previous dump
+        index = slot(m_ring_size);
+        m_ring_size++;
+        }
+    else if (m_queue_size != -1 && capacity >= static_cast<size_t>(m_queue_size))
+        {
+        // the buffer is full: overwrite the oldest frame
+        index = m_ring_begin;
+        m_ring_begin = (m_ring_begin + 1) % capacity;
+        }
+    else
+        {
+        linearize();
+        m_frame_ring.emplace_back();
+        m_log_ring.emplace_back();
+        index = m_ring_size;
+        m_ring_size++;
+        }
+
+    populateLocalFrame(m_frame_ring[index], timestep);
+
+    // the logger is implemented in Python
+    pybind11::gil_scoped_acquire acquire_gil;
+    pybind11::dict log_data = getLogData();
+    if (m_exec_conf->isRoot())
+        {
+        convertLogQuantities(log_data, m_log_ring[index]);
         }
     }
 
 void GSDDequeWriter::dump(long int start, long int end)
     {
-    auto buffer_length = static_cast<long int>(m_frame_queue.size());
+    auto buffer_length = static_cast<long int>(m_ring_size);
     if (end > buffer_length)
         {
         throw std::runtime_error("Burst.dump's end index is out of range.");
@@ -73,30 +108,53 @@ void GSDDequeWriter::dump(long int start, long int end)
         {
         throw std::runtime_error("Burst.dump's start index is out of range.");
         }
-    long int iterator_start, iterator_end;
     if (end < 0)
         {
-        iterator_end = buffer_length - start;
-        iterator_start = 0;
+        end = buffer_length;
+        }
+
+    // write from oldest to newest
+    for (auto j = start; j < end; ++j)
+        {
+        size_t index = slot(j);
+        write(m_frame_ring[index], m_log_ring[index]);
+        }
+
+    if (m_clear_whole_buffer_after_dump)
+        {
+        dropOldest(m_ring_size);
         }
     else
         {
-        iterator_end = buffer_length - start;
-        iterator_start = buffer_length - end;
+        dropOldest(std::max(end, 0L));
         }
-    for (auto i = iterator_end - 1; i >= iterator_start; --i)
+    }
+
+void GSDDequeWriter::dropOldest(size_t n)
+    {
+    n = std::min(n, m_ring_size);
+    if (n == 0)
         {
-        write(m_frame_queue[i], m_log_queue[i]);
+        return;
         }
-    if (m_clear_whole_buffer_after_dump)
+
+    m_ring_begin = slot(n);
+    m_ring_size -= n;
+    if (m_ring_size == 0)
         {
-        m_frame_queue.clear();
-        m_log_queue.clear();
+        m_ring_begin = 0;
         }
-    else
+    }
+
+void GSDDequeWriter::linearize()
+    {
+    if (m_ring_begin != 0)
         {
-        m_frame_queue.erase(m_frame_queue.begin() + iterator_start, m_frame_queue.end());
-        m_log_queue.erase(m_log_queue.begin() + iterator_start, m_log_queue.end());
+        std::rotate(m_frame_ring.begin(),
+                    m_frame_ring.begin() + m_ring_begin,
+                    m_frame_ring.end());
+        std::rotate(m_log_ring.begin(), m_log_ring.begin() + m_ring_begin, m_log_ring.end());
+        m_ring_begin = 0;
         }
     }
 
@@ -107,7 +165,7 @@ int GSDDequeWriter::getMaxQueueSize() const
 
 size_t GSDDequeWriter::getCurrentQueueSize() const
     {
-    return m_frame_queue.size();
+    return m_ring_size;
     }
 
 void GSDDequeWriter::setMaxQueueSize(int new_max_size)
@@ -117,10 +175,18 @@ void GSDDequeWriter::setMaxQueueSize(int new_max_size)
         {
         return;
         }
-    while (static_cast<size_t>(m_queue_size) < m_frame_queue.size())
+    auto max_size = static_cast<size_t>(m_queue_size);
+    if (m_ring_size > max_size)
+        {
+        dropOldest(m_ring_size - max_size);
+        }
+
+    // release the storage of slots beyond the new maximum
+    if (m_frame_ring.size() > max_size)
         {
-        m_frame_queue.pop_back();
-        m_log_queue.pop_back();
+        linearize();
+        m_frame_ring.resize(max_size);
+        m_log_ring.resize(max_size);
         }
     }
 
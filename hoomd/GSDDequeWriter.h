@@ -7,7 +7,7 @@
 #error This header cannot be compiled by nvcc
 #endif
 
-#include <deque>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 
@@ -15,6 +15,12 @@
 
 namespace hoomd
     {
+//! Buffer frames in memory and write them to a GSD file on demand
+/*! Frames are stored in a ring buffer of at most max_burst_size slots (unbounded when -1). Once the
+    buffer is full, each new frame overwrites the oldest slot in place so that the particle and
+    topology arrays allocated for earlier frames are reused. Logged quantities are stored as
+    converted buffers rather than Python objects.
+*/
 class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
     {
     public:
@@ -42,10 +48,28 @@ class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
     size_t getCurrentQueueSize() const;
 
     protected:
+    /// Get the ring buffer slot of the j-th oldest frame
+    size_t slot(size_t j) const
+        {
+        return (m_ring_begin + j) % m_frame_ring.size();
+        }
+
+    /// Drop the oldest n frames from the buffer
+    void dropOldest(size_t n);
+
+    /// Move the oldest frame to slot 0 so the ring can be resized
+    void linearize();
+
     int m_queue_size;
     bool m_clear_whole_buffer_after_dump;
-    std::deque<GSDDumpWriter::GSDFrame> m_frame_queue;
-    std::deque<pybind11::dict> m_log_queue;
+
+    std::vector<GSDDumpWriter::GSDFrame> m_frame_ring;            //!< Frame storage
+    std::vector<std::vector<GSDDumpWriter::LogChunk>> m_log_ring; //!< Log storage (root only)
+    size_t m_ring_begin = 0;                                      //!< Slot of the oldest frame
+    size_t m_ring_size = 0;                                       //!< Number of buffered frames
+
+    /// Scratch frame used when the buffer holds no frames
+    GSDDumpWriter::GSDFrame m_scratch_frame;
     };
 
 namespace detail
@@ -5,14 +5,22 @@
 #include "Filesystem.h"
 #include "GSD.h"
 #include "HOOMDVersion.h"
+#include "ProfileRange.h"
 
 #ifdef ENABLE_MPI
 #include "Communicator.h"
 #endif
 
+#ifdef ENABLE_HIP
+#include "GSDDumpWriterGPU.cuh"
+#endif
+
 #include <pybind11/numpy.h>
 #include <pybind11/stl_bind.h>
 
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <limits>
 #include <list>
 #include <sstream>
@@ -44,6 +52,8 @@ std::list<std::string> GSDDumpWriter::particle_chunks {"particles/position",
     \param mode File open mode ("wb", "xb", or "ab")
     \param truncate If true, truncate the file to 0 frames every time analyze() called, then write
    out one frame
+    \param staging_directory When not empty, write the file in this directory and copy each frame
+   to \a fname in the background (requires \a truncate)
 
     If the group does not include all particles, then topology information cannot be written to the
    file.
@@ -53,8 +63,13 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
                              const std::string& fname,
                              std::shared_ptr<ParticleGroup> group,
                              std::string mode,
-                             bool truncate)
-    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate), m_group(group)
+                             bool truncate,
+                             const std::string& staging_directory)
+    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate), m_group(group),
+      m_io_queue([this](PendingFrame& pending)
+                 { writeFrame(pending.frame, pending.frame, pending.log, pending.write_topology); },
+                 max_pending_frames),
+      m_staging_directory(staging_directory)
     {
     m_exec_conf->msg->notice(5) << "Constructing GSDDumpWriter: " << m_fname << " " << mode << " "
                                 << truncate << endl;
@@ -62,6 +77,23 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
         {
         throw std::invalid_argument("Invalid GSD file mode: " + mode);
         }
+
+    if (!m_staging_directory.empty())
+        {
+        if (!m_truncate)
+            {
+            throw std::invalid_argument("GSD can only stage files written with truncate=True.");
+            }
+
+        // write the file in the staging directory and drain each frame to the requested name.
+        // Partitions may share a node, so the staged name includes the partition index.
+        m_drain_fname = fname;
+        std::filesystem::path name = std::filesystem::path(fname).filename();
+        std::string staged_name = name.stem().string() + "."
+                                  + std::to_string(m_exec_conf->getPartition())
+                                  + name.extension().string();
+        m_fname = (std::filesystem::path(m_staging_directory) / staged_name).string();
+        }
     m_log_writer = pybind11::none();
 
 #ifdef ENABLE_MPI
@@ -222,9 +254,13 @@ void GSDDumpWriter::flush()
     {
     if (m_exec_conf->isRoot())
         {
+        m_io_queue.wait();
+
         m_exec_conf->msg->notice(5) << "GSD: flush gsd file " << m_fname << endl;
         int retval = gsd_flush(&m_handle);
         GSDUtils::checkError(retval, m_fname);
+
+        waitForDrain();
         }
     }
 
@@ -232,6 +268,8 @@ void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
     {
     if (m_exec_conf->isRoot())
         {
+        m_io_queue.wait();
+
         int retval = gsd_set_maximum_write_buffer_size(&m_handle, size);
         GSDUtils::checkError(retval, m_fname);
 
@@ -245,6 +283,7 @@ uint64_t GSDDumpWriter::getMaximumWriteBufferSize()
     {
     if (m_exec_conf->isRoot())
         {
+        m_io_queue.wait();
         return gsd_get_maximum_write_buffer_size(&m_handle);
         }
     else
@@ -310,6 +349,7 @@ void GSDDumpWriter::initFileIO()
             }
 
         m_nframes = gsd_get_nframes(&m_handle);
+        m_nframes_written = m_nframes;
         }
 
 #ifdef ENABLE_MPI
@@ -327,6 +367,24 @@ GSDDumpWriter::~GSDDumpWriter()
 
     if (m_exec_conf->isRoot())
         {
+        try
+            {
+            m_io_queue.stop();
+            }
+        catch (const std::exception& e)
+            {
+            m_exec_conf->msg->error() << "GSD: " << e.what() << endl;
+            }
+
+        try
+            {
+            waitForDrain();
+            }
+        catch (const std::exception& e)
+            {
+            m_exec_conf->msg->error() << "GSD: " << e.what() << endl;
+            }
+
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
         gsd_close(&m_handle);
         }
@@ -351,6 +409,7 @@ pybind11::dict GSDDumpWriter::getLogData() const
 void GSDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
+    ProfileRange range("GSD");
     int retval;
 
     // truncate the file if requested
@@ -358,67 +417,275 @@ void GSDDumpWriter::analyze(uint64_t timestep)
         {
         if (m_exec_conf->isRoot())
             {
+            m_io_queue.wait();
+
+            // the drain thread reads the staged file
+            waitForDrain();
+
             m_exec_conf->msg->notice(10) << "GSD: truncating file" << endl;
             retval = gsd_truncate(&m_handle);
             GSDUtils::checkError(retval, m_fname);
+            m_nframes_written = 0;
             }
 
         m_nframes = 0;
         }
 
     populateLocalFrame(m_local_frame, timestep);
-    auto log_data = getLogData();
-    write(m_local_frame, log_data);
+
+    std::vector<LogChunk> log;
+        {
+        // the logger is implemented in Python
+        pybind11::gil_scoped_acquire acquire_gil;
+        pybind11::dict log_data = getLogData();
+        if (m_exec_conf->isRoot())
+            {
+            convertLogQuantities(log_data, log);
+            }
+        }
+    write(m_local_frame, log);
+
+    if (m_exec_conf->isRoot() && !m_drain_fname.empty())
+        {
+        retval = gsd_flush(&m_handle);
+        GSDUtils::checkError(retval, m_fname);
+        startDrain();
+        }
     }
 
 void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
     {
+    // only the root rank writes logged quantities
+    std::vector<LogChunk> log;
+    if (m_exec_conf->isRoot())
+        {
+        convertLogQuantities(log_data, log);
+        }
+
+    write(frame, log);
+    }
+
+/*! \param frame Local frame to write
+    \param log Logged quantities (only used on the root rank)
+*/
+void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, const std::vector<LogChunk>& log)
+    {
+    // topology is only meaningful if this is the all group
+    const bool write_topology = m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
+                                && (m_write_topology || m_nframes == 0);
+
+    const GSDFrame* particle_frame = &frame;
 #ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed() && m_parallel_io)
+        {
+        writeParallel(frame, log, write_topology);
+        m_nframes++;
+        return;
+        }
+
     if (m_sysdef->isDomainDecomposed())
         {
         gatherGlobalFrame(frame);
+        particle_frame = &m_global_frame;
+        }
+#endif
 
-        if (m_exec_conf->isRoot())
+    if (m_exec_conf->isRoot())
+        {
+        if (m_asynchronous && m_nframes > 0)
+            {
+            enqueueFrame(*particle_frame, frame, log, write_topology);
+            }
+        else
             {
-            writeFrameHeader(m_global_frame);
-            writeAttributes(m_global_frame);
-            writeProperties(m_global_frame);
-            writeMomenta(m_global_frame);
-            writeLogQuantities(log_data);
+            m_io_queue.wait();
+            writeFrame(*particle_frame, frame, log, write_topology);
             }
         }
-    else
+
+#ifdef ENABLE_MPI
+    // frame 0 determines which chunks later frames must write on every rank
+    if (m_sysdef->isDomainDecomposed() && m_nframes == 0)
+        {
+        bcast(m_nondefault, 0, m_exec_conf->getMPICommunicator());
+        }
 #endif
+
+    m_nframes++;
+    }
+
+/*! \param particle_frame Frame with the particle data of all ranks
+    \param topology_frame Frame with the topology snapshots
+    \param log Logged quantities
+    \param write_topology Set to true to write the topology
+
+    Called on the root rank only, either on the main thread or on the I/O thread.
+*/
+void GSDDumpWriter::writeFrame(const GSDFrame& particle_frame,
+                               GSDFrame& topology_frame,
+                               const std::vector<LogChunk>& log,
+                               bool write_topology)
+    {
+    ProfileRange range("GSD write frame");
+    writeFrameHeader(particle_frame);
+    writeAttributes(particle_frame);
+    writeProperties(particle_frame);
+    writeMomenta(particle_frame);
+    writeLogChunks(log);
+
+    if (write_topology)
         {
-        writeFrameHeader(frame);
-        writeAttributes(frame);
-        writeProperties(frame);
-        writeMomenta(frame);
-        writeLogQuantities(log_data);
+        writeTopology(topology_frame.bond_data,
+                      topology_frame.angle_data,
+                      topology_frame.dihedral_data,
+                      topology_frame.improper_data,
+                      topology_frame.constraint_data,
+                      topology_frame.pair_data);
         }
-    // topology is only meaningful if this is the all group
-    if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
-        && (m_write_topology || m_nframes == 0))
+
+    m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
+    int retval = gsd_end_frame(&m_handle);
+    GSDUtils::checkError(retval, m_fname);
+
+    m_nframes_written++;
+    }
+
+/*! \param bits Number of bits per box dimension, 0 to write positions at full precision
+
+    Quantized positions are multiples of 1/2^bits in fractional box coordinates, so their low
+    mantissa bits are zero and the chunks compress well with transparent file system compression
+    and general purpose compressors. The file remains a standard GSD file.
+*/
+void GSDDumpWriter::setPositionQuantizationBits(unsigned int bits)
+    {
+    if (bits > 24)
         {
-        if (m_exec_conf->isRoot())
+        throw std::invalid_argument("Positions can be quantized with at most 24 bits.");
+        }
+    m_position_bits = bits;
+    }
+
+/*! \param box Global simulation box
+    \param position Position wrapped into the box
+
+    \returns The position rounded to the nearest point of the quantization grid in the box.
+*/
+vec3<Scalar> GSDDumpWriter::quantizePosition(const BoxDim& box, const vec3<Scalar>& position)
+    {
+    const Scalar n_cells = Scalar(uint32_t(1) << m_position_bits);
+    const Scalar max_cell = n_cells - Scalar(1.0);
+
+    vec3<Scalar> f = box.makeFraction(position);
+    f.x = std::min(std::round(f.x * n_cells), max_cell) / n_cells;
+    f.y = std::min(std::round(f.y * n_cells), max_cell) / n_cells;
+    if (m_sysdef->getNDimensions() == 3)
+        {
+        f.z = std::min(std::round(f.z * n_cells), max_cell) / n_cells;
+        }
+
+    return box.makeCoordinates(f);
+    }
+
+/*! \param asynchronous Set to true to write frames on a background I/O thread
+ */
+void GSDDumpWriter::setAsynchronous(bool asynchronous)
+    {
+    if (asynchronous == m_asynchronous)
+        {
+        return;
+        }
+
+    if (m_exec_conf->isRoot())
+        {
+        if (asynchronous)
             {
-            writeTopology(frame.bond_data,
-                          frame.angle_data,
-                          frame.dihedral_data,
-                          frame.improper_data,
-                          frame.constraint_data,
-                          frame.pair_data);
+            m_io_queue.start();
+            }
+        else
+            {
+            m_io_queue.stop();
             }
         }
 
-    if (m_exec_conf->isRoot())
+    m_asynchronous = asynchronous;
+    }
+
+/*! \param particle_frame Frame with the particle data of all ranks
+    \param topology_frame Frame with the topology snapshots
+    \param log Logged quantities
+    \param write_topology Set to true to write the topology
+
+    Blocks while max_pending_frames frames are already in flight.
+*/
+void GSDDumpWriter::enqueueFrame(const GSDFrame& particle_frame,
+                                 const GSDFrame& topology_frame,
+                                 const std::vector<LogChunk>& log,
+                                 bool write_topology)
+    {
+    std::unique_ptr<PendingFrame> pending = m_io_queue.acquire();
+
+    // copy into the reused buffers while the I/O thread writes the previous frame
+    pending->frame.timestep = particle_frame.timestep;
+    pending->frame.global_box = particle_frame.global_box;
+    pending->frame.group_size = particle_frame.group_size;
+    pending->frame.particle_data = particle_frame.particle_data;
+    pending->frame.particle_data_present = particle_frame.particle_data_present;
+
+    pending->write_topology = write_topology;
+    if (write_topology)
         {
-        m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
-        int retval = gsd_end_frame(&m_handle);
-        GSDUtils::checkError(retval, m_fname);
+        pending->frame.bond_data = topology_frame.bond_data;
+        pending->frame.angle_data = topology_frame.angle_data;
+        pending->frame.dihedral_data = topology_frame.dihedral_data;
+        pending->frame.improper_data = topology_frame.improper_data;
+        pending->frame.constraint_data = topology_frame.constraint_data;
+        pending->frame.pair_data = topology_frame.pair_data;
         }
 
-    m_nframes++;
+    pending->log = log;
+
+    m_io_queue.push(std::move(pending));
+    }
+
+/*! The staged file holds one complete frame after analyze(). Copy it to a temporary file next to
+    m_drain_fname and rename the copy over m_drain_fname, so that m_drain_fname always holds a
+    complete checkpoint even when the job ends during the copy.
+*/
+void GSDDumpWriter::startDrain()
+    {
+    waitForDrain();
+
+    m_drain_thread = std::thread(
+        [this]()
+        {
+            try
+                {
+                std::filesystem::path tmp(m_drain_fname + ".tmp");
+                std::filesystem::copy_file(m_fname,
+                                           tmp,
+                                           std::filesystem::copy_options::overwrite_existing);
+                std::filesystem::rename(tmp, m_drain_fname);
+                }
+            catch (...)
+                {
+                m_drain_exception = std::current_exception();
+                }
+        });
+    }
+
+void GSDDumpWriter::waitForDrain()
+    {
+    if (m_drain_thread.joinable())
+        {
+        m_drain_thread.join();
+        }
+
+    if (m_drain_exception)
+        {
+        std::exception_ptr e = m_drain_exception;
+        m_drain_exception = nullptr;
+        std::rethrow_exception(e);
+        }
     }
 
 void GSDDumpWriter::writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping)
@@ -462,7 +729,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
                              (void*)&frame.timestep);
     GSDUtils::checkError(retval, m_fname);
 
-    if (m_nframes == 0)
+    if (m_nframes_written == 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/dimensions" << endl;
         uint8_t dimensions = (uint8_t)m_sysdef->getNDimensions();
@@ -476,7 +743,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::configuration_box])
+    if (m_nframes_written == 0 || m_dynamic[gsd_flag::configuration_box])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/box" << endl;
         float box_a[6];
@@ -496,10 +763,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::particles_N])
+    if (m_nframes_written == 0 || m_dynamic[gsd_flag::particles_N])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing particles/N" << endl;
-        uint32_t N = m_group->getNumMembersGlobal();
+        uint32_t N = frame.group_size;
         retval = gsd_write_chunk(&m_handle, "particles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
         }
@@ -510,10 +777,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
 */
 void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.group_size;
     int retval;
 
-    if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
+    if (m_dynamic[gsd_flag::particles_types] || m_nframes_written == 0)
         {
         writeTypeMapping("particles/types", frame.particle_data.type_mapping);
         }
@@ -531,7 +798,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.type.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/typeid"] = true;
         }
 
@@ -548,7 +815,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.mass.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/mass"] = true;
         }
 
@@ -565,7 +832,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.charge.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/charge"] = true;
         }
 
@@ -584,7 +851,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                      0,
                                      (void*)frame.particle_data.diameter.data());
             GSDUtils::checkError(retval, m_fname);
-            if (m_nframes == 0)
+            if (m_nframes_written == 0)
                 m_nondefault["particles/diameter"] = true;
             }
         }
@@ -602,7 +869,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.body.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/body"] = true;
         }
 
@@ -619,7 +886,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.inertia.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/moment_inertia"] = true;
         }
     }
@@ -628,7 +895,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.group_size;
     int retval;
 
     if (frame.particle_data.pos.size() != 0)
@@ -644,7 +911,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.pos.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/position"] = true;
         }
 
@@ -661,7 +928,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.orientation.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/orientation"] = true;
         }
     }
@@ -670,7 +937,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.group_size;
     int retval;
 
     if (frame.particle_data.vel.size() != 0)
@@ -686,7 +953,7 @@ void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.vel.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/velocity"] = true;
         }
 
@@ -703,7 +970,7 @@ void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.angmom.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/angmom"] = true;
         }
 
@@ -720,7 +987,7 @@ void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
                                  0,
                                  (void*)frame.particle_data.image.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (m_nframes_written == 0)
             m_nondefault["particles/image"] = true;
         }
     }
@@ -927,10 +1194,24 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
 
 void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
     {
-    for (auto key_iter = dict.begin(); key_iter != dict.end(); ++key_iter)
+    std::vector<LogChunk> chunks;
+    convertLogQuantities(dict, chunks);
+    writeLogChunks(chunks);
+    }
+
+/*! \param dict Logged quantities
+    \param chunks Output chunks, resized to the number of quantities
+
+    Must be called on the main thread, which holds the Python interpreter.
+*/
+void GSDDumpWriter::convertLogQuantities(pybind11::dict dict, std::vector<LogChunk>& chunks)
+    {
+    chunks.resize(pybind11::len(dict));
+    unsigned int i = 0;
+
+    for (auto key_iter = dict.begin(); key_iter != dict.end(); ++key_iter, ++i)
         {
         std::string name = pybind11::cast<std::string>(key_iter->first);
-        m_exec_conf->msg->notice(10) << "GSD: writing " << name << endl;
 
         pybind11::array arr = pybind11::array::ensure(key_iter->second, pybind11::array::c_style);
         gsd_type type = GSD_TYPE_UINT8;
@@ -1012,14 +1293,58 @@ void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
             throw invalid_argument("Invalid numpy dimension in gsd log data [" + name + "]");
             }
 
-        int retval
-            = gsd_write_chunk(&m_handle, name.c_str(), type, N, (uint32_t)M, 0, (void*)arr.data());
+        LogChunk& chunk = chunks[i];
+        chunk.name = name;
+        chunk.type = type;
+        chunk.N = N;
+        chunk.M = (uint32_t)M;
+        const char* data = static_cast<const char*>(arr.data());
+        chunk.data.assign(data, data + arr.nbytes());
+        }
+    }
+
+/*! \param chunks Converted log quantities
+
+    Shape definitions are large and change only in shape alchemy runs. Readers fall back to frame 0
+    when a frame omits a chunk, so particles/type_shapes is omitted on frames 1+ when it matches the
+    value in frame 0.
+ */
+void GSDDumpWriter::writeLogChunks(const std::vector<LogChunk>& chunks)
+    {
+    for (const auto& chunk : chunks)
+        {
+        if (chunk.name == "particles/type_shapes")
+            {
+            if (m_nframes_written == 0)
+                {
+                m_frame0_type_shapes = chunk;
+                m_have_frame0_type_shapes = true;
+                }
+            else if (m_have_frame0_type_shapes && chunk.type == m_frame0_type_shapes.type
+                     && chunk.N == m_frame0_type_shapes.N && chunk.M == m_frame0_type_shapes.M
+                     && chunk.data == m_frame0_type_shapes.data)
+                {
+                m_exec_conf->msg->notice(10) << "GSD: type shapes match frame 0" << endl;
+                continue;
+                }
+            }
+
+        m_exec_conf->msg->notice(10) << "GSD: writing " << chunk.name << endl;
+
+        int retval = gsd_write_chunk(&m_handle,
+                                     chunk.name.c_str(),
+                                     chunk.type,
+                                     chunk.N,
+                                     chunk.M,
+                                     0,
+                                     (void*)chunk.data.data());
         GSDUtils::checkError(retval, m_fname);
         }
     }
 
 /*! Populate the m_nondefault map.
-    Set entries to true when they exist in frame 0 of the file, otherwise, set them to false.
+    Set entries to true when they exist in frame 0 of the file, otherwise, set them to false. Also
+    read the type shapes in frame 0.
 */
 void GSDDumpWriter::populateNonDefault()
     {
@@ -1050,10 +1375,63 @@ void GSDDumpWriter::populateNonDefault()
         m_nondefault[chunk] = (entry != nullptr);
         }
 
+    // cache the type shapes in frame 0 to omit them from appended frames when they do not change
+    const gsd_index_entry* entry = gsd_find_chunk(&m_handle, 0, "particles/type_shapes");
+    m_have_frame0_type_shapes = (entry != nullptr);
+    if (entry != nullptr)
+        {
+        m_frame0_type_shapes.name = "particles/type_shapes";
+        m_frame0_type_shapes.type = (gsd_type)entry->type;
+        m_frame0_type_shapes.N = entry->N;
+        m_frame0_type_shapes.M = entry->M;
+        m_frame0_type_shapes.data.resize(entry->N * entry->M
+                                         * gsd_sizeof_type(m_frame0_type_shapes.type));
+        retval = gsd_read_chunk(&m_handle, m_frame0_type_shapes.data.data(), entry);
+        GSDUtils::checkError(retval, m_fname);
+        }
+
     // close the file
     gsd_close(&m_handle);
     }
 
+/*! \param array Per-particle array
+    \param staging Staging array for the gathered values
+
+    On the GPU, gather the values of the particles in m_index into \a staging on the device, so
+    that only the selected values are copied to the host. Index the returned array with
+    m_gathered_index. On the CPU, return \a array, indexed with m_index.
+*/
+template<class T>
+const GPUArray<T>& GSDDumpWriter::selectParticles(const GPUArray<T>& array, GPUArray<T>& staging)
+    {
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        const unsigned int n = static_cast<unsigned int>(m_index.size());
+        if (staging.getNumElements() < n)
+            {
+            GPUArray<T> new_staging(n, m_exec_conf);
+            staging.swap(new_staging);
+            }
+
+        ArrayHandle<unsigned int> d_gather_index(m_gather_index,
+                                                 access_location::device,
+                                                 access_mode::read);
+        ArrayHandle<T> d_array(array, access_location::device, access_mode::read);
+        ArrayHandle<T> d_staging(staging, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_gather_particles(n, d_gather_index.data, d_array.data, d_staging.data);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        return staging;
+        }
+#endif
+
+    return array;
+    }
+
 void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t timestep)
     {
     frame.timestep = timestep;
@@ -1062,6 +1440,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
     frame.particle_data.type_mapping = m_pdata->getTypeMapping();
 
     uint32_t N = m_group->getNumMembersGlobal();
+    frame.group_size = N;
 
     // Assume values are all default to start, set flags to false when we find a non-default.
     std::bitset<n_gsd_flags> all_default;
@@ -1088,18 +1467,49 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                 }
 
             frame.particle_tags.push_back(h_tag.data[index]);
+            frame.particle_group_index.push_back(group_tag_index);
             m_index.push_back(index);
             }
         }
 
+    // the per-particle loops below read the arrays returned by selectParticles()
+    const std::vector<unsigned int>* selection = &m_index;
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        const unsigned int n = static_cast<unsigned int>(m_index.size());
+        if (m_gather_index.getNumElements() < n)
+            {
+            GPUArray<unsigned int> gather_index(n, m_exec_conf);
+            m_gather_index.swap(gather_index);
+            }
+
+            {
+            ArrayHandle<unsigned int> h_gather_index(m_gather_index,
+                                                     access_location::host,
+                                                     access_mode::overwrite);
+            std::copy(m_index.begin(), m_index.end(), h_gather_index.data);
+            }
+
+        while (m_gathered_index.size() < n)
+            {
+            m_gathered_index.push_back(static_cast<unsigned int>(m_gathered_index.size()));
+            }
+        m_gathered_index.resize(n);
+        selection = &m_gathered_index;
+        }
+#endif
+
     if (N > 0
         && (m_dynamic[gsd_flag::particles_position] || m_dynamic[gsd_flag::particles_type]
             || m_dynamic[gsd_flag::particles_image] || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+        ArrayHandle<Scalar4> h_postype(selectParticles(m_pdata->getPositions(), m_gather_scalar4),
                                        access_location::host,
                                        access_mode::read);
-        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<int3> h_image(selectParticles(m_pdata->getImages(), m_gather_int3),
+                                  access_location::host,
+                                  access_mode::read);
 
         if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
             {
@@ -1114,7 +1524,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             frame.particle_data_present[gsd_flag::particles_type] = true;
             }
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             vec3<Scalar> position
                 = vec3<Scalar>(h_postype.data[index]) - vec3<Scalar>(m_pdata->getOrigin());
@@ -1128,6 +1538,11 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
             frame.global_box.wrap(position, image);
 
+            if (m_position_bits > 0)
+                {
+                position = quantizePosition(frame.global_box, position);
+                }
+
             if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
                 {
                 if (position != vec3<Scalar>(0, 0, 0))
@@ -1162,12 +1577,13 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_orientation] || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                           access_location::host,
-                                           access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(
+            selectParticles(m_pdata->getOrientationArray(), m_gather_scalar4),
+            access_location::host,
+            access_mode::read);
         frame.particle_data_present[gsd_flag::particles_orientation] = true;
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             quat<Scalar> orientation(h_orientation.data[index]);
             if (orientation.s != Scalar(1.0) || orientation.v.x != Scalar(0.0)
@@ -1184,9 +1600,10 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
         && (m_dynamic[gsd_flag::particles_velocity] || m_dynamic[gsd_flag::particles_mass]
             || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_velocity_mass(m_pdata->getVelocities(),
-                                             access_location::host,
-                                             access_mode::read);
+        ArrayHandle<Scalar4> h_velocity_mass(
+            selectParticles(m_pdata->getVelocities(), m_gather_scalar4),
+            access_location::host,
+            access_mode::read);
 
         if (m_dynamic[gsd_flag::particles_mass] || m_nframes == 0)
             {
@@ -1197,7 +1614,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             frame.particle_data_present[gsd_flag::particles_velocity] = true;
             }
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             vec3<float> velocity = vec3<float>(static_cast<float>(h_velocity_mass.data[index].x),
                                                static_cast<float>(h_velocity_mass.data[index].y),
@@ -1228,13 +1645,13 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_charge] || m_nframes == 0))
         {
-        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+        ArrayHandle<Scalar> h_charge(selectParticles(m_pdata->getCharges(), m_gather_scalar),
                                      access_location::host,
                                      access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_charge] = true;
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             float charge = static_cast<float>(h_charge.data[index]);
             if (charge != 0.0f)
@@ -1248,13 +1665,13 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_diameter] || m_nframes == 0))
         {
-        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+        ArrayHandle<Scalar> h_diameter(selectParticles(m_pdata->getDiameters(), m_gather_scalar),
                                        access_location::host,
                                        access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_diameter] = true;
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             float diameter = static_cast<float>(h_diameter.data[index]);
 
@@ -1269,13 +1686,13 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_body] || m_nframes == 0))
         {
-        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+        ArrayHandle<unsigned int> h_body(selectParticles(m_pdata->getBodies(), m_gather_uint),
                                          access_location::host,
                                          access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_body] = true;
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             unsigned int body = h_body.data[index];
 
@@ -1290,13 +1707,14 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_inertia] || m_nframes == 0))
         {
-        ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
-                                       access_location::host,
-                                       access_mode::read);
+        ArrayHandle<Scalar3> h_inertia(
+            selectParticles(m_pdata->getMomentsOfInertiaArray(), m_gather_scalar3),
+            access_location::host,
+            access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_inertia] = true;
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             vec3<float> inertia = vec3<float>(h_inertia.data[index]);
 
@@ -1311,13 +1729,14 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
     if (N > 0 && (m_dynamic[gsd_flag::particles_angmom] || m_nframes == 0))
         {
-        ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
-                                      access_location::host,
-                                      access_mode::read);
+        ArrayHandle<Scalar4> h_angmom(
+            selectParticles(m_pdata->getAngularMomentumArray(), m_gather_scalar4),
+            access_location::host,
+            access_mode::read);
 
         frame.particle_data_present[gsd_flag::particles_angmom] = true;
 
-        for (unsigned int index : m_index)
+        for (unsigned int index : *selection)
             {
             quat<float> angmom = quat<float>(h_angmom.data[index]);
 
@@ -1459,6 +1878,7 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
 
     m_global_frame.timestep = local_frame.timestep;
     m_global_frame.global_box = local_frame.global_box;
+    m_global_frame.group_size = local_frame.group_size;
     m_global_frame.particle_data.type_mapping = local_frame.particle_data.type_mapping;
     m_global_frame.particle_data_present = local_frame.particle_data_present;
 
@@ -1522,6 +1942,222 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
         }
     }
 
+/*! \param frame Local frame
+    \param log Logged quantities (only used on the root rank)
+    \param write_topology Set to true to write the topology
+
+    Collective: call on all ranks.
+*/
+void GSDDumpWriter::writeParallel(GSDFrame& frame,
+                                  const std::vector<LogChunk>& log,
+                                  bool write_topology)
+    {
+    if (m_exec_conf->isRoot())
+        {
+        m_io_queue.wait();
+
+        // the root writes the chunks that hold global data
+        writeFrameHeader(frame);
+        if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
+            {
+            writeTypeMapping("particles/types", frame.particle_data.type_mapping);
+            }
+        }
+
+    MPI_File fh;
+    int retval = MPI_File_open(m_exec_conf->getMPICommunicator(),
+                               m_fname.c_str(),
+                               MPI_MODE_WRONLY,
+                               MPI_INFO_NULL,
+                               &fh);
+    if (retval != MPI_SUCCESS)
+        {
+        throw std::runtime_error("Unable to open " + m_fname + " for parallel output.");
+        }
+
+    const auto& present = frame.particle_data_present;
+    const auto& particle_data = frame.particle_data;
+
+    if (present[gsd_flag::particles_type])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/typeid",
+                                   GSD_TYPE_UINT32,
+                                   1,
+                                   particle_data.type.data());
+        }
+    if (present[gsd_flag::particles_mass])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/mass",
+                                   GSD_TYPE_FLOAT,
+                                   1,
+                                   particle_data.mass.data());
+        }
+    if (present[gsd_flag::particles_charge])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/charge",
+                                   GSD_TYPE_FLOAT,
+                                   1,
+                                   particle_data.charge.data());
+        }
+    if (m_write_diameter && present[gsd_flag::particles_diameter])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/diameter",
+                                   GSD_TYPE_FLOAT,
+                                   1,
+                                   particle_data.diameter.data());
+        }
+    if (present[gsd_flag::particles_body])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/body",
+                                   GSD_TYPE_INT32,
+                                   1,
+                                   particle_data.body.data());
+        }
+    if (present[gsd_flag::particles_inertia])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/moment_inertia",
+                                   GSD_TYPE_FLOAT,
+                                   3,
+                                   particle_data.inertia.data());
+        }
+    if (present[gsd_flag::particles_position])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/position",
+                                   GSD_TYPE_FLOAT,
+                                   3,
+                                   particle_data.pos.data());
+        }
+    if (present[gsd_flag::particles_orientation])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/orientation",
+                                   GSD_TYPE_FLOAT,
+                                   4,
+                                   particle_data.orientation.data());
+        }
+    if (present[gsd_flag::particles_velocity])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/velocity",
+                                   GSD_TYPE_FLOAT,
+                                   3,
+                                   particle_data.vel.data());
+        }
+    if (present[gsd_flag::particles_angmom])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/angmom",
+                                   GSD_TYPE_FLOAT,
+                                   4,
+                                   particle_data.angmom.data());
+        }
+    if (present[gsd_flag::particles_image])
+        {
+        writeParticleChunkParallel(fh,
+                                   frame,
+                                   "particles/image",
+                                   GSD_TYPE_INT32,
+                                   3,
+                                   particle_data.image.data());
+        }
+
+    // closing the file completes the writes before the root writes the frame index
+    MPI_File_close(&fh);
+
+    if (m_exec_conf->isRoot())
+        {
+        writeLogChunks(log);
+
+        if (write_topology)
+            {
+            writeTopology(frame.bond_data,
+                          frame.angle_data,
+                          frame.dihedral_data,
+                          frame.improper_data,
+                          frame.constraint_data,
+                          frame.pair_data);
+            }
+
+        m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
+        retval = gsd_end_frame(&m_handle);
+        GSDUtils::checkError(retval, m_fname);
+        m_nframes_written++;
+        }
+    }
+
+/*! \param fh File opened on all ranks
+    \param frame Local frame
+    \param name Chunk name
+    \param type Chunk data type
+    \param M Number of columns
+    \param data Local rows in ascending tag order
+
+    The root rank reserves the chunk in the file and broadcasts its location. Each rank then
+    writes its rows to their positions in the group with a collective write, which lets the MPI
+    library aggregate the scattered rows into large contiguous file accesses.
+*/
+void GSDDumpWriter::writeParticleChunkParallel(MPI_File fh,
+                                               const GSDFrame& frame,
+                                               const char* name,
+                                               gsd_type type,
+                                               uint32_t M,
+                                               const void* data)
+    {
+    int64_t location = 0;
+    if (m_exec_conf->isRoot())
+        {
+        m_exec_conf->msg->notice(10) << "GSD: writing " << name << " in parallel" << endl;
+        int retval = gsd_reserve_chunk(&m_handle, name, type, frame.group_size, M, 0, &location);
+        GSDUtils::checkError(retval, m_fname);
+        }
+    bcast(location, 0, m_exec_conf->getMPICommunicator());
+
+    const int row_size = int(M * gsd_sizeof_type(type));
+    const int n_local = int(frame.particle_group_index.size());
+    std::vector<int> displacements(frame.particle_group_index.begin(),
+                                   frame.particle_group_index.end());
+
+    MPI_Datatype row_type, file_type;
+    MPI_Type_contiguous(row_size, MPI_BYTE, &row_type);
+    MPI_Type_commit(&row_type);
+    MPI_Type_create_indexed_block(n_local, 1, displacements.data(), row_type, &file_type);
+    MPI_Type_commit(&file_type);
+
+    MPI_File_set_view(fh, MPI_Offset(location), row_type, file_type, "native", MPI_INFO_NULL);
+    MPI_Status status;
+    int retval = MPI_File_write_all(fh, data, n_local, row_type, &status);
+
+    MPI_Type_free(&file_type);
+    MPI_Type_free(&row_type);
+
+    if (retval != MPI_SUCCESS)
+        {
+        throw std::runtime_error("Error writing " + std::string(name) + " to " + m_fname + ".");
+        }
+
+    if (m_nframes == 0)
+        {
+        m_nondefault[name] = true;
+        }
+    }
+
 #endif
 
 namespace detail
@@ -1536,12 +2172,23 @@ void export_GSDDumpWriter(pybind11::module& m)
                             std::string,
                             std::shared_ptr<ParticleGroup>,
                             std::string,
-                            bool>())
+                            bool,
+                            std::string>())
         .def_property("log_writer", &GSDDumpWriter::getLogWriter, &GSDDumpWriter::setLogWriter)
         .def_property_readonly("filename", &GSDDumpWriter::getFilename)
         .def_property_readonly("mode", &GSDDumpWriter::getMode)
         .def_property("dynamic", &GSDDumpWriter::getDynamic, &GSDDumpWriter::setDynamic)
         .def_property_readonly("truncate", &GSDDumpWriter::getTruncate)
+        .def_property_readonly("staging_directory",
+                               [](const std::shared_ptr<GSDDumpWriter> gsd) -> pybind11::object
+                               {
+                                   std::string directory = gsd->getStagingDirectory();
+                                   if (directory.empty())
+                                       {
+                                       return pybind11::none();
+                                       }
+                                   return pybind11::str(directory);
+                               })
         .def_property_readonly("filter",
                                [](const std::shared_ptr<GSDDumpWriter> gsd)
                                { return gsd->getGroup()->getFilter(); })
@@ -1551,7 +2198,16 @@ void export_GSDDumpWriter(pybind11::module& m)
         .def("flush", &GSDDumpWriter::flush)
         .def_property("maximum_write_buffer_size",
                       &GSDDumpWriter::getMaximumWriteBufferSize,
-                      &GSDDumpWriter::setMaximumWriteBufferSize);
+                      &GSDDumpWriter::setMaximumWriteBufferSize)
+        .def_property("asynchronous",
+                      &GSDDumpWriter::getAsynchronous,
+                      &GSDDumpWriter::setAsynchronous)
+        .def_property("position_quantization_bits",
+                      &GSDDumpWriter::getPositionQuantizationBits,
+                      &GSDDumpWriter::setPositionQuantizationBits)
+        .def_property("parallel_io",
+                      &GSDDumpWriter::getParallelIO,
+                      &GSDDumpWriter::setParallelIO);
     }
 
     } // end namespace detail
@@ -4,12 +4,15 @@
 #pragma once
 
 #include "Analyzer.h"
+#include "AsyncWriteQueue.h"
 #include "ParticleGroup.h"
 #include "SharedSignal.h"
 
 #include "hoomd/extern/gsd.h"
+#include <exception>
 #include <memory>
 #include <string>
+#include <thread>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -30,6 +33,21 @@ namespace hoomd
 
     The file is not opened until the first call to analyze().
 
+    In parallel I/O mode (MPI runs only), the root rank writes the frame header, type names, log
+    quantities, and topology. All ranks write the per-particle chunks directly to their tag
+    ordered locations in the file with collective MPI-IO, so no rank holds the whole frame. The
+    file format is unchanged. Parallel writes are synchronous.
+
+    In asynchronous mode, analyze() copies the frame (and on MPI runs, gathers it to the root
+    rank) and then returns. A background I/O thread on the root rank writes the frame to the file.
+    At most max_pending_frames frames are waiting or being written at any time. analyze() blocks
+    when that limit is reached. flush() waits for all pending frames before flushing the file.
+    Frame 0 is always written synchronously because later frames depend on which chunks it
+    contains.
+
+    On the GPU, the values of the particles in the group are gathered on the device and only those
+    are copied to the host.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
@@ -41,7 +59,8 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
                   const std::string& fname,
                   std::shared_ptr<ParticleGroup> group,
                   std::string mode = "ab",
-                  bool truncate = false);
+                  bool truncate = false,
+                  const std::string& staging_directory = "");
 
     //! Control topology writes
     void setWriteTopology(bool b)
@@ -51,7 +70,13 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
 
     std::string getFilename()
         {
-        return m_fname;
+        return m_drain_fname.empty() ? m_fname : m_drain_fname;
+        }
+
+    /// Get the directory that stages checkpoints (empty when not staged)
+    std::string getStagingDirectory()
+        {
+        return m_staging_directory;
         }
 
     std::string getMode()
@@ -128,6 +153,43 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Get the maximum write buffer size (in bytes)
     uint64_t getMaximumWriteBufferSize();
 
+    /// Set whether frames are written by a background I/O thread
+    void setAsynchronous(bool asynchronous);
+
+    /// Get whether frames are written by a background I/O thread
+    bool getAsynchronous()
+        {
+        return m_asynchronous;
+        }
+
+    /// Maximum number of frames waiting to be written in asynchronous mode
+    static const unsigned int max_pending_frames = 2;
+
+    /// Set the number of bits used to quantize positions (0 disables quantization)
+    void setPositionQuantizationBits(unsigned int bits);
+
+    /// Get the number of bits used to quantize positions
+    unsigned int getPositionQuantizationBits()
+        {
+        return m_position_bits;
+        }
+
+    /// Set whether all ranks write per-particle chunks with collective MPI-IO
+    void setParallelIO(bool parallel_io)
+        {
+        if (parallel_io && !m_drain_fname.empty())
+            {
+            throw std::invalid_argument("GSD cannot write staged checkpoints with parallel I/O.");
+            }
+        m_parallel_io = parallel_io;
+        }
+
+    /// Get whether all ranks write per-particle chunks with collective MPI-IO
+    bool getParallelIO()
+        {
+        return m_parallel_io;
+        }
+
     protected:
     gsd_handle m_handle; //!< Handle to the file
 
@@ -172,8 +234,14 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         uint64_t timestep;
         BoxDim global_box;
 
+        /// Number of particles in the group on all ranks
+        uint32_t group_size = 0;
+
         std::vector<unsigned int> particle_tags;
 
+        /// Index of each local particle in the group, in the same order as particle_tags
+        std::vector<unsigned int> particle_group_index;
+
         SnapshotParticleData<float> particle_data;
         BondData::Snapshot bond_data;
         AngleData::Snapshot angle_data;
@@ -188,6 +256,7 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         void clear()
             {
             particle_tags.resize(0);
+            particle_group_index.resize(0);
             particle_data.resize(0);
             bond_data.resize(0);
             angle_data.resize(0);
@@ -206,9 +275,28 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     //! Get the current frame's logged data
     pybind11::dict getLogData() const;
 
+    /// A logged quantity converted to a buffer that can be written without the Python interpreter
+    struct LogChunk
+        {
+        std::string name;
+        gsd_type type;
+        uint64_t N;
+        uint32_t M;
+        std::vector<char> data;
+        };
+
     //! Write a frame to the GSD file buffer
     void write(GSDFrame& frame, pybind11::dict log_data);
 
+    //! Write a frame with converted log quantities to the GSD file buffer
+    void write(GSDFrame& frame, const std::vector<LogChunk>& log);
+
+    /// Convert logged quantities into chunks
+    void convertLogQuantities(pybind11::dict dict, std::vector<LogChunk>& chunks);
+
+    /// Write converted log quantities
+    void writeLogChunks(const std::vector<LogChunk>& chunks);
+
     //! Check and raise an exception if an error occurs
     void checkError(int retval);
 
@@ -218,12 +306,26 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Populate local frame with data.
     void populateLocalFrame(GSDFrame& frame, uint64_t timestep);
 
+    /// Round a position to the quantization grid
+    vec3<Scalar> quantizePosition(const BoxDim& box, const vec3<Scalar>& position);
+
 #ifdef ENABLE_MPI
     /// Copy of the state properties on all ranks, in ascending tag order globally.
     GSDFrame m_global_frame;
     GatherTagOrder m_gather_tag_order;
 
     void gatherGlobalFrame(const GSDFrame& local_frame);
+
+    /// Write a frame with each rank writing its own particles to the file
+    void writeParallel(GSDFrame& frame, const std::vector<LogChunk>& log, bool write_topology);
+
+    /// Write one per-particle chunk collectively
+    void writeParticleChunkParallel(MPI_File fh,
+                                    const GSDFrame& frame,
+                                    const char* name,
+                                    gsd_type type,
+                                    uint32_t M,
+                                    const void* data);
 #endif
 
     private:
@@ -232,6 +334,10 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     bool m_truncate = false;       //!< True if we should truncate the file on every analyze()
     bool m_write_topology = false; //!< True if topology should be written
     bool m_write_diameter = false; //!< True if the diameter attribute should be written
+    bool m_parallel_io = false;    //!< True if ranks write per-particle chunks with MPI-IO
+
+    /// Bits per box dimension used to quantize positions (0 disables quantization)
+    unsigned int m_position_bits = 0;
 
     /// Flags indicating which particle fields are dynamic.
     std::bitset<n_gsd_flags> m_dynamic;
@@ -239,6 +345,9 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Number of frames written to the file.
     uint64_t m_nframes = 0;
 
+    /// Number of frames completed in the file by writeFrame(), owned by the thread that writes
+    uint64_t m_nframes_written = 0;
+
     static std::list<std::string> particle_chunks;
 
     /// Callback to write log quantities to file
@@ -248,12 +357,84 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     std::unordered_map<std::string, bool>
         m_nondefault; //!< Map of quantities (true when non-default in frame 0)
 
+    /// Type shapes in frame 0 of the file, valid when m_have_frame0_type_shapes is set
+    LogChunk m_frame0_type_shapes;
+
+    /// True when frame 0 of the file holds particles/type_shapes
+    bool m_have_frame0_type_shapes = false;
+
     /// Copy of the state properties local to this rank, in ascending tag order.
     GSDFrame m_local_frame;
 
     /// Working array to sort local particles by tag
     std::vector<unsigned int> m_index;
 
+    /// Positions 0 to m_index.size() - 1, the indices into arrays gathered on the device
+    std::vector<unsigned int> m_gathered_index;
+
+    /// Device copy of m_index
+    GPUArray<unsigned int> m_gather_index;
+
+    /// Staging arrays for the values gathered on the device, one per element type
+    GPUArray<Scalar4> m_gather_scalar4;
+    GPUArray<Scalar3> m_gather_scalar3;
+    GPUArray<Scalar> m_gather_scalar;
+    GPUArray<unsigned int> m_gather_uint;
+    GPUArray<int3> m_gather_int3;
+
+    /// Select the values of the local particles in m_index
+    template<class T>
+    const GPUArray<T>& selectParticles(const GPUArray<T>& array, GPUArray<T>& staging);
+
+    /// A frame waiting for the I/O thread
+    struct PendingFrame
+        {
+        /// Particle data in ascending tag order, and topology when write_topology is set
+        GSDFrame frame;
+
+        /// Logged quantities
+        std::vector<LogChunk> log;
+
+        /// True when the topology should be written
+        bool write_topology;
+        };
+
+    /// True when frames are written by the I/O thread
+    bool m_asynchronous = false;
+
+    /// Frames waiting for the I/O thread (root rank only)
+    AsyncWriteQueue<PendingFrame> m_io_queue;
+
+    /// Directory that stages checkpoints (empty when not staged)
+    std::string m_staging_directory;
+
+    /// File that staged checkpoints drain to (empty when not staged)
+    std::string m_drain_fname;
+
+    /// The background thread that copies the staged checkpoint to m_drain_fname (root rank only)
+    std::thread m_drain_thread;
+
+    /// Error raised on the drain thread
+    std::exception_ptr m_drain_exception;
+
+    /// Copy the staged checkpoint to m_drain_fname on the drain thread
+    void startDrain();
+
+    /// Wait for the drain thread to finish and rethrow its error
+    void waitForDrain();
+
+    //! Write a complete frame to the file
+    void writeFrame(const GSDFrame& particle_frame,
+                    GSDFrame& topology_frame,
+                    const std::vector<LogChunk>& log,
+                    bool write_topology);
+
+    //! Copy a frame into the pending queue for the I/O thread
+    void enqueueFrame(const GSDFrame& particle_frame,
+                      const GSDFrame& topology_frame,
+                      const std::vector<LogChunk>& log,
+                      bool write_topology);
+
     //! Write a type mapping out to the file
     void writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping);
 
@@ -0,0 +1,80 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GSDDumpWriterGPU.cuh"
+
+/*! \file GSDDumpWriterGPU.cu
+    \brief Defines the GPU kernels used by GSDDumpWriter
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! GPU kernel to gather the values of the selected particles
+template<class T>
+__global__ void gpu_gather_particles_kernel(unsigned int n,
+                                            const unsigned int* d_index,
+                                            const T* d_in,
+                                            T* d_out)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= n)
+        return;
+
+    d_out[i] = d_in[d_index[i]];
+    }
+
+/*! \param n Number of selected particles
+    \param d_index Particle indices of the selected particles
+    \param d_in Per-particle array
+    \param d_out Values of the selected particles (output)
+*/
+template<class T>
+hipError_t gpu_gather_particles(unsigned int n,
+                                const unsigned int* d_index,
+                                const T* d_in,
+                                T* d_out)
+    {
+    if (n == 0)
+        return hipSuccess;
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n / block_size + 1;
+
+    hipLaunchKernelGGL((gpu_gather_particles_kernel<T>),
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n,
+                       d_index,
+                       d_in,
+                       d_out);
+    return hipSuccess;
+    }
+
+template hipError_t gpu_gather_particles<Scalar4>(unsigned int n,
+                                                  const unsigned int* d_index,
+                                                  const Scalar4* d_in,
+                                                  Scalar4* d_out);
+template hipError_t gpu_gather_particles<Scalar3>(unsigned int n,
+                                                  const unsigned int* d_index,
+                                                  const Scalar3* d_in,
+                                                  Scalar3* d_out);
+template hipError_t gpu_gather_particles<Scalar>(unsigned int n,
+                                                 const unsigned int* d_index,
+                                                 const Scalar* d_in,
+                                                 Scalar* d_out);
+template hipError_t gpu_gather_particles<unsigned int>(unsigned int n,
+                                                       const unsigned int* d_index,
+                                                       const unsigned int* d_in,
+                                                       unsigned int* d_out);
+template hipError_t gpu_gather_particles<int3>(unsigned int n,
+                                               const unsigned int* d_index,
+                                               const int3* d_in,
+                                               int3* d_out);
+
+    } // end namespace kernel
+    } // end namespace hoomd
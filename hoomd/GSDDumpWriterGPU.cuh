@@ -0,0 +1,26 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "HOOMDMath.h"
+
+#include <hip/hip_runtime.h>
+
+/*! \file GSDDumpWriterGPU.cuh
+    \brief Declares the GPU kernels used by GSDDumpWriter
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Gather the values of the selected particles into a contiguous array
+template<class T>
+hipError_t gpu_gather_particles(unsigned int n,
+                                const unsigned int* d_index,
+                                const T* d_in,
+                                T* d_out);
+
+    } // end namespace kernel
+    } // end namespace hoomd
@@ -19,42 +19,94 @@ namespace hoomd
     \param name File name to read
     \param frame Frame index to read from the file
     \param from_end Count frames back from the end of the file
+    \param distributed Set to true to read the per-particle data on all ranks
 
     The GSDReader constructor opens the GSD file, initializes an empty snapshot, and reads the file
-   into memory (on the root rank).
+   into memory (on the root rank). In distributed mode, every rank opens the file and reads only
+   its slice of the particle data.
 */
 GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                      const std::string& name,
                      const uint64_t frame,
-                     bool from_end)
-    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame)
+                     bool from_end,
+                     bool distributed)
+    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame),
+      m_distributed(distributed), m_n_global(0), m_tag_offset(0)
     {
     m_snapshot = std::shared_ptr<SnapshotSystemData<float>>(new SnapshotSystemData<float>);
+    m_local_particle_data = std::make_shared<SnapshotParticleData<float>>();
 
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_distributed)
         {
         return;
         }
 #endif
 
+    openFile(frame, from_end);
+
+    if (m_exec_conf->isRoot())
+        {
+        readHeader();
+        if (m_distributed)
+            {
+            // only the type mapping is stored globally
+            m_snapshot->particle_data.type_mapping = readTypes(m_frame, "particles/types");
+            m_local_particle_data->type_mapping = m_snapshot->particle_data.type_mapping;
+            }
+        else
+            {
+            readParticles();
+            }
+        readTopology();
+        }
+
+    if (m_distributed)
+        {
+#ifdef ENABLE_MPI
+        bcast(m_n_global, 0, m_exec_conf->getMPICommunicator());
+#endif
+        readLocalParticles();
+        }
+    }
+
+GSDReader::~GSDReader()
+    {
+#ifdef ENABLE_MPI
+    // if we are not the root processor, do not perform file I/O
+    if (!m_exec_conf->isRoot() && !m_distributed)
+        {
+        return;
+        }
+#endif
+
+    gsd_close(&m_handle);
+    }
+
+/*! \param frame Frame index to read from the file
+    \param from_end Count frames back from the end of the file
+
+    Open the file, validate the schema, and select the frame to read.
+*/
+void GSDReader::openFile(const uint64_t frame, bool from_end)
+    {
     // open the GSD file in read mode
-    m_exec_conf->msg->notice(3) << "data.gsd_snapshot: open gsd file " << name << endl;
-    int retval = gsd_open(&m_handle, name.c_str(), GSD_OPEN_READONLY);
+    m_exec_conf->msg->notice(3) << "data.gsd_snapshot: open gsd file " << m_name << endl;
+    int retval = gsd_open(&m_handle, m_name.c_str(), GSD_OPEN_READONLY);
     GSDUtils::checkError(retval, m_name);
 
     // validate schema
     if (string(m_handle.header.schema) != string("hoomd"))
         {
         std::ostringstream s;
-        s << "Invalid schema in " << name << endl;
+        s << "Invalid schema in " << m_name << endl;
         throw runtime_error(s.str());
         }
     if (m_handle.header.schema_version >= gsd_make_version(2, 1))
         {
         std::ostringstream s;
-        s << "Invalid schema version in " << name << endl;
+        s << "Invalid schema version in " << m_name << endl;
         throw runtime_error(s.str());
         }
 
@@ -67,27 +119,10 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
     if (m_frame >= nframes)
         {
         std::ostringstream s;
-        s << "Cannot read frame " << m_frame << " " << name << " only has "
+        s << "Cannot read frame " << m_frame << " " << m_name << " only has "
           << gsd_get_nframes(&m_handle) << " frames.";
         throw runtime_error(s.str());
         }
-
-    readHeader();
-    readParticles();
-    readTopology();
-    }
-
-GSDReader::~GSDReader()
-    {
-#ifdef ENABLE_MPI
-    // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
-        {
-        return;
-        }
-#endif
-
-    gsd_close(&m_handle);
     }
 
 /*! \param data Pointer to data to read into
@@ -137,6 +172,56 @@ bool GSDReader::readChunk(void* data,
         }
     }
 
+/*! \param data Pointer to data to read into
+    \param frame Frame index to read from
+    \param name Name of the data chunk
+    \param row_size Expected size of one row of the data chunk in bytes.
+    \param first First row to read
+    \param n Number of rows to read
+    \param cur_n N in the current frame.
+
+    Same as readChunk(), but reads only the rows [first, first + n) of the chunk.
+
+    Return true if the chunk is found in the file.
+*/
+bool GSDReader::readChunkRange(void* data,
+                               uint64_t frame,
+                               const char* name,
+                               size_t row_size,
+                               uint64_t first,
+                               uint64_t n,
+                               unsigned int cur_n)
+    {
+    const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, frame, name);
+    if (entry == NULL && frame != 0)
+        entry = gsd_find_chunk(&m_handle, 0, name);
+
+    if (entry == NULL || entry->N != cur_n)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading rows " << first << " to "
+                                << first + n << " of chunk " << name << endl;
+    size_t actual_size = entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (actual_size != row_size)
+        {
+        std::ostringstream s;
+        s << "Expecting " << row_size << " bytes per row in " << name << " but found "
+          << actual_size << ".";
+        throw runtime_error(s.str());
+        }
+
+    if (n > 0)
+        {
+        int retval = gsd_read_chunk_range(&m_handle, data, entry, first, n);
+        GSDUtils::checkError(retval, m_name);
+        }
+
+    return true;
+    }
+
 /*! \param frame Frame index to read from
     \param name Name of the data chunk
 
@@ -210,7 +295,11 @@ void GSDReader::readHeader()
         s << "Cannot read a file with 0 particles.";
         throw runtime_error(s.str());
         }
-    m_snapshot->particle_data.resize(N);
+    m_n_global = N;
+    if (!m_distributed)
+        {
+        m_snapshot->particle_data.resize(N);
+        }
     }
 
 /*! Read the same data chunks for particles
@@ -243,6 +332,50 @@ void GSDReader::readParticles()
     readChunk(m_snapshot->particle_data.image.data(), m_frame, "particles/image", N * 12, N);
     }
 
+/*! Read this rank's slice of the data chunks for particles
+
+    Rank r of P reads the particles [r * N / P, (r + 1) * N / P).
+*/
+void GSDReader::readLocalParticles()
+    {
+    uint64_t N = m_n_global;
+    uint64_t rank = m_exec_conf->getRank();
+    uint64_t n_ranks = m_exec_conf->getNRanks();
+    uint64_t first = N * rank / n_ranks;
+    uint64_t n = N * (rank + 1) / n_ranks - first;
+    unsigned int cur_n = m_n_global;
+
+    m_tag_offset = (unsigned int)first;
+    m_local_particle_data->resize((unsigned int)n);
+
+    // the snapshot already has default values, if a chunk is not found, the value
+    // is already at the default, and the failed read is not a problem
+    SnapshotParticleData<float>& pdata = *m_local_particle_data;
+    readChunkRange(pdata.type.data(), m_frame, "particles/typeid", 4, first, n, cur_n);
+    readChunkRange(pdata.mass.data(), m_frame, "particles/mass", 4, first, n, cur_n);
+    readChunkRange(pdata.charge.data(), m_frame, "particles/charge", 4, first, n, cur_n);
+    readChunkRange(pdata.diameter.data(), m_frame, "particles/diameter", 4, first, n, cur_n);
+    readChunkRange(pdata.body.data(), m_frame, "particles/body", 4, first, n, cur_n);
+    readChunkRange(pdata.inertia.data(),
+                   m_frame,
+                   "particles/moment_inertia",
+                   12,
+                   first,
+                   n,
+                   cur_n);
+    readChunkRange(pdata.pos.data(), m_frame, "particles/position", 12, first, n, cur_n);
+    readChunkRange(pdata.orientation.data(),
+                   m_frame,
+                   "particles/orientation",
+                   16,
+                   first,
+                   n,
+                   cur_n);
+    readChunkRange(pdata.vel.data(), m_frame, "particles/velocity", 12, first, n, cur_n);
+    readChunkRange(pdata.angmom.data(), m_frame, "particles/angmom", 16, first, n, cur_n);
+    readChunkRange(pdata.image.data(), m_frame, "particles/image", 12, first, n, cur_n);
+    }
+
 /*! Read the same data chunks for topology
  */
 void GSDReader::readTopology()
@@ -335,9 +468,13 @@ void export_GSDReader(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>,
                             const string&,
                             const uint64_t,
+                            bool,
                             bool>())
         .def("getTimeStep", &GSDReader::getTimeStep)
         .def("getSnapshot", &GSDReader::getSnapshot)
+        .def("getLocalParticleData", &GSDReader::getLocalParticleData)
+        .def("getTagOffset", &GSDReader::getTagOffset)
+        .def("getNGlobal", &GSDReader::getNGlobal)
         .def("clearSnapshot", &GSDReader::clearSnapshot)
         .def("readTypeShapesPy", &GSDReader::readTypeShapesPy);
     }
@@ -25,6 +25,11 @@ template<class Real> struct SnapshotSystemData;
     file into the snapshot. For information on the GSD specification, see
    https://gsd.readthedocs.io/
 
+    In distributed mode, the root rank reads only the global data (box, types, and topology) into
+    the snapshot. Every rank opens the file and reads its own contiguous slice of the per-particle
+    chunks into a local particle snapshot. Pass the slice to
+    ParticleData::initializeFromDistributedSnapshot() to place the particles on their owners.
+
     \ingroup data_structs
 */
 class PYBIND11_EXPORT GSDReader
@@ -34,7 +39,8 @@ class PYBIND11_EXPORT GSDReader
     GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
               const std::string& name,
               const uint64_t frame,
-              bool from_end);
+              bool from_end,
+              bool distributed = false);
 
     //! Destructor
     ~GSDReader();
@@ -59,6 +65,24 @@ class PYBIND11_EXPORT GSDReader
         return m_snapshot;
         }
 
+    //! Get the slice of the particle data read by this rank (distributed mode only)
+    std::shared_ptr<SnapshotParticleData<float>> getLocalParticleData() const
+        {
+        return m_local_particle_data;
+        }
+
+    //! Get the tag of the first particle in the local slice
+    unsigned int getTagOffset() const
+        {
+        return m_tag_offset;
+        }
+
+    //! Get the global number of particles in the frame
+    unsigned int getNGlobal() const
+        {
+        return m_n_global;
+        }
+
     //! initializes a snapshot with the particle data
     uint64_t getFrame() const
         {
@@ -72,10 +96,20 @@ class PYBIND11_EXPORT GSDReader
                    size_t expected_size,
                    unsigned int cur_n = 0);
 
+    //! Helper function to read a range of rows of a quantity from the file
+    bool readChunkRange(void* data,
+                        uint64_t frame,
+                        const char* name,
+                        size_t row_size,
+                        uint64_t first,
+                        uint64_t n,
+                        unsigned int cur_n);
+
     //! clears the snapshot object
     void clearSnapshot()
         {
         m_snapshot.reset();
+        m_local_particle_data.reset();
         }
 
     //! get handle
@@ -93,13 +127,21 @@ class PYBIND11_EXPORT GSDReader
     uint64_t m_frame;                                          //!< Cached frame
     std::shared_ptr<SnapshotSystemData<float>> m_snapshot;     //!< The snapshot to read
     gsd_handle m_handle;                                       //!< Handle to the file
+    bool m_distributed;                                        //!< True when all ranks read
+    unsigned int m_n_global;                                   //!< Number of particles in the frame
+
+    /// Particles read by this rank in distributed mode
+    std::shared_ptr<SnapshotParticleData<float>> m_local_particle_data;
+    unsigned int m_tag_offset; //!< Tag of the first particle in m_local_particle_data
 
     //! Helper function to read a type list from the file
     std::vector<std::string> readTypes(uint64_t frame, const char* name);
 
     // helper functions to read sections of the file
+    void openFile(const uint64_t frame, bool from_end);
     void readHeader();
     void readParticles();
+    void readLocalParticles();
     void readTopology();
     };
 
@@ -97,6 +97,23 @@ typedef double4 ShortReal4;
 #error HOOMD_SHORTREAL_SIZE must be 32 or 64.
 #endif
 
+// AccumReal is the type that GPU pair force kernels accumulate per-particle forces, energies, and
+// virials in. Set it wider than Scalar to sum many single precision pair terms without the
+// rounding error of single precision accumulation.
+#ifndef HOOMD_ACCUMREAL_SIZE
+#define HOOMD_ACCUMREAL_SIZE HOOMD_LONGREAL_SIZE
+#endif
+
+#if HOOMD_ACCUMREAL_SIZE == 32
+typedef float AccumReal;
+typedef float4 AccumReal4;
+#elif HOOMD_ACCUMREAL_SIZE == 64
+typedef double AccumReal;
+typedef double4 AccumReal4;
+#else
+#error HOOMD_ACCUMREAL_SIZE must be 32 or 64.
+#endif
+
 //! make a scalar2 value
 HOSTDEVICE inline Scalar2 make_scalar2(Scalar x, Scalar y)
     {
@@ -127,6 +144,17 @@ HOSTDEVICE inline Scalar4 make_scalar4(Scalar x, Scalar y, Scalar z, Scalar w)
     return retval;
     }
 
+//! make an accumreal4 value
+HOSTDEVICE inline AccumReal4 make_accumreal4(AccumReal x, AccumReal y, AccumReal z, AccumReal w)
+    {
+    AccumReal4 retval;
+    retval.x = x;
+    retval.y = y;
+    retval.z = z;
+    retval.w = w;
+    return retval;
+    }
+
 #ifndef __HIPCC__
 //! Stuff an integer inside a float
 HOSTDEVICE inline float __int_as_float(int a)
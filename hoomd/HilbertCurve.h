@@ -0,0 +1,116 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file HilbertCurve.h
+    \brief Compute indices along a Hilbert curve on the host or device
+*/
+
+#ifndef __HILBERT_CURVE_H__
+#define __HILBERT_CURVE_H__
+
+#include "HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+//! Number of bits per dimension in 3D Hilbert keys
+const unsigned int HILBERT_BITS_3D = 10;
+
+//! Number of bits per dimension in 2D Hilbert keys
+const unsigned int HILBERT_BITS_2D = 16;
+
+//! Compute the index of a grid cell along a Hilbert curve
+/*! \param x Cell coordinates, each less than 2**\a bits (overwritten)
+    \param bits Number of bits per dimension
+    \tparam n Number of dimensions
+    \returns Index of the cell along the Hilbert curve
+
+    Transforms the coordinates to the transposed Hilbert index with the algorithm of Skilling
+    (https://doi.org/10.1063/1.1751381) and interleaves their bits. The index has n * \a bits
+    significant bits.
+*/
+template<unsigned int n> HOSTDEVICE unsigned int hilbert_index(unsigned int x[n], unsigned int bits)
+    {
+    const unsigned int M = 1u << (bits - 1);
+
+    // inverse undo excess work
+    for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+        unsigned int P = Q - 1;
+        for (unsigned int i = 0; i < n; i++)
+            {
+            if (x[i] & Q)
+                {
+                x[0] ^= P;
+                }
+            else
+                {
+                unsigned int t = (x[0] ^ x[i]) & P;
+                x[0] ^= t;
+                x[i] ^= t;
+                }
+            }
+        }
+
+    // Gray encode
+    for (unsigned int i = 1; i < n; i++)
+        x[i] ^= x[i - 1];
+    unsigned int t = 0;
+    for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+        if (x[n - 1] & Q)
+            t ^= Q - 1;
+        }
+    for (unsigned int i = 0; i < n; i++)
+        x[i] ^= t;
+
+    // interleave the bits of the transposed index
+    unsigned int index = 0;
+    for (int b = int(bits) - 1; b >= 0; b--)
+        {
+        for (unsigned int i = 0; i < n; i++)
+            index = (index << 1) | ((x[i] >> b) & 1);
+        }
+    return index;
+    }
+
+//! Compute the Hilbert key of a point
+/*! \param f Fractional coordinates of the point in the box
+    \param twod Set to true to compute the key in the x-y plane
+
+    Points are binned on a grid of 2**HILBERT_BITS_3D cells per dimension in 3D and
+    2**HILBERT_BITS_2D in 2D. Points slightly outside the box are placed in the nearest cell.
+*/
+HOSTDEVICE unsigned int hilbert_key(const Scalar3& f, bool twod)
+    {
+    const unsigned int bits = twod ? HILBERT_BITS_2D : HILBERT_BITS_3D;
+    const Scalar n_grid = Scalar(1u << bits);
+    const int max_cell = int(1u << bits) - 1;
+
+    int ib = int(f.x * n_grid);
+    int jb = int(f.y * n_grid);
+    int kb = int(f.z * n_grid);
+    unsigned int x[3];
+    x[0] = (unsigned int)(ib < 0 ? 0 : (ib > max_cell ? max_cell : ib));
+    x[1] = (unsigned int)(jb < 0 ? 0 : (jb > max_cell ? max_cell : jb));
+    x[2] = (unsigned int)(kb < 0 ? 0 : (kb > max_cell ? max_cell : kb));
+
+    if (twod)
+        return hilbert_index<2>(x, bits);
+    else
+        return hilbert_index<3>(x, bits);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+#endif // __HILBERT_CURVE_H__
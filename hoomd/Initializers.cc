@@ -2,17 +2,23 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "Initializers.h"
+#include "RNGIdentifiers.h"
+#include "RandomNumbers.h"
 #include "SnapshotSystemData.h"
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 
 using namespace std;
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 /*! \file Initializers.cc
     \brief Defines a few initializers for setting up ParticleData instances
@@ -184,4 +190,295 @@ std::shared_ptr<SnapshotSystemData<Scalar>> RandomInitializer::getSnapshot() con
     return snapshot;
     }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////
+
+/*! \param box Global simulation box
+    \param n_x Number of unit cells along the first box vector
+    \param n_y Number of unit cells along the second box vector
+    \param n_z Number of unit cells along the third box vector (1 in 2D)
+    \param basis Fractional x, y, and z of each basis site in the unit cell
+    \param basis_type Type of each basis site
+    \param basis_mass Mass of each basis site
+    \param type_mapping Names of the particle types
+*/
+DistributedLatticeInitializer::DistributedLatticeInitializer(
+    const BoxDim& box,
+    unsigned int n_x,
+    unsigned int n_y,
+    unsigned int n_z,
+    const std::vector<Scalar>& basis,
+    const std::vector<unsigned int>& basis_type,
+    const std::vector<Scalar>& basis_mass,
+    const std::vector<std::string>& type_mapping)
+    : m_box(box), m_dimensions(box.getL().z == Scalar(0.0) ? 2 : 3),
+      m_n(make_uint3(n_x, n_y, n_z)), m_basis_type(basis_type), m_basis_mass(basis_mass),
+      m_type_mapping(type_mapping)
+    {
+    const size_t n_basis = basis_type.size();
+    if (n_x == 0 || n_y == 0 || n_z == 0)
+        {
+        throw runtime_error("DistributedLatticeInitializer: Cannot generate 0 unit cells");
+        }
+    if (n_basis == 0 || basis.size() != 3 * n_basis || basis_mass.size() != n_basis)
+        {
+        throw runtime_error("DistributedLatticeInitializer: Every basis site needs a position, "
+                            "type, and mass");
+        }
+    if (m_dimensions == 2 && n_z != 1)
+        {
+        throw runtime_error("DistributedLatticeInitializer: n_z must be 1 in 2D boxes");
+        }
+
+    const uint64_t n_global = uint64_t(n_x) * n_y * n_z * n_basis;
+    if (n_global > uint64_t(NOT_LOCAL))
+        {
+        throw runtime_error("DistributedLatticeInitializer: Too many particles");
+        }
+    m_n_global = (unsigned int)n_global;
+
+    for (size_t b = 0; b < n_basis; b++)
+        {
+        Scalar3 f = make_scalar3(basis[3 * b], basis[3 * b + 1], basis[3 * b + 2]);
+        if (f.x < 0 || f.x >= 1 || f.y < 0 || f.y >= 1 || f.z < 0 || f.z >= 1)
+            {
+            throw runtime_error("DistributedLatticeInitializer: Basis positions must be fractions "
+                                "of the unit cell in [0, 1)");
+            }
+        if (basis_type[b] >= type_mapping.size())
+            {
+            throw runtime_error("DistributedLatticeInitializer: Invalid basis type");
+            }
+        m_basis.push_back(f);
+        }
+    }
+
+/*! \param first Tag of the first particle to generate
+    \param count Number of particles to generate
+*/
+std::shared_ptr<SnapshotParticleData<double>>
+DistributedLatticeInitializer::getSlice(unsigned int first, unsigned int count) const
+    {
+    if (uint64_t(first) + count > m_n_global)
+        {
+        throw runtime_error("DistributedLatticeInitializer: Slice is out of range");
+        }
+
+    auto slice = std::make_shared<SnapshotParticleData<double>>(count);
+    slice->type_mapping = m_type_mapping;
+
+    const unsigned int n_basis = (unsigned int)m_basis.size();
+    for (unsigned int i = 0; i < count; i++)
+        {
+        const unsigned int tag = first + i;
+        const unsigned int b = tag % n_basis;
+        const unsigned int cell = tag / n_basis;
+        const unsigned int c_x = cell % m_n.x;
+        const unsigned int c_y = (cell / m_n.x) % m_n.y;
+        const unsigned int c_z = cell / (m_n.x * m_n.y);
+
+        const Scalar3 f = make_scalar3((Scalar(c_x) + m_basis[b].x) / Scalar(m_n.x),
+                                       (Scalar(c_y) + m_basis[b].y) / Scalar(m_n.y),
+                                       (Scalar(c_z) + m_basis[b].z) / Scalar(m_n.z));
+        slice->pos[i] = vec3<double>(m_box.makeCoordinates(f));
+        slice->type[i] = m_basis_type[b];
+        slice->mass[i] = m_basis_mass[b];
+        }
+
+    return slice;
+    }
+
+std::shared_ptr<SnapshotSystemData<double>> DistributedLatticeInitializer::getSnapshot() const
+    {
+    auto snapshot = std::make_shared<SnapshotSystemData<double>>();
+    snapshot->global_box = std::make_shared<BoxDim>(m_box);
+    snapshot->dimensions = m_dimensions;
+    snapshot->particle_data = *getSlice(0, m_n_global);
+    return snapshot;
+    }
+
+/////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////
+
+/*! \param box Global simulation box
+    \param N Number of particles to generate
+    \param min_dist Minimum distance between particles
+    \param type_fraction Fraction of the particles of each type
+    \param type_mass Mass of each type
+    \param type_mapping Names of the particle types
+    \param seed Random seed
+*/
+DistributedRandomInitializer::DistributedRandomInitializer(
+    const BoxDim& box,
+    unsigned int N,
+    Scalar min_dist,
+    const std::vector<Scalar>& type_fraction,
+    const std::vector<Scalar>& type_mass,
+    const std::vector<std::string>& type_mapping,
+    uint16_t seed)
+    : m_box(box), m_dimensions(box.getL().z == Scalar(0.0) ? 2 : 3), m_n_global(N),
+      m_type_mass(type_mass), m_type_mapping(type_mapping), m_seed(seed)
+    {
+    if (N == 0)
+        {
+        throw runtime_error("DistributedRandomInitializer: Cannot generate 0 particles");
+        }
+    if (min_dist < 0)
+        {
+        throw runtime_error("DistributedRandomInitializer: min_dist < 0 doesn't make sense");
+        }
+    if (type_fraction.empty() || type_fraction.size() != type_mapping.size()
+        || type_mass.size() != type_mapping.size())
+        {
+        throw runtime_error("DistributedRandomInitializer: Every type needs a fraction and a mass");
+        }
+
+    Scalar total = 0;
+    for (Scalar fraction : type_fraction)
+        {
+        if (fraction < 0)
+            {
+            throw runtime_error("DistributedRandomInitializer: Negative type fraction");
+            }
+        total += fraction;
+        m_type_cumulative.push_back(total);
+        }
+    if (total <= 0)
+        {
+        throw runtime_error("DistributedRandomInitializer: The type fractions sum to 0");
+        }
+    for (Scalar& cumulative : m_type_cumulative)
+        {
+        cumulative /= total;
+        }
+
+    // the fewest cells of about the same width that hold N particles
+    const bool twod = m_dimensions == 2;
+    const Scalar3 d = box.getNearestPlaneDistance();
+    const Scalar width = twod ? slow::sqrt(d.x * d.y / Scalar(N))
+                              : slow::pow(d.x * d.y * d.z / Scalar(N), Scalar(1.0 / 3.0));
+    m_n_cells = make_uint3((unsigned int)ceil(d.x / width),
+                           (unsigned int)ceil(d.y / width),
+                           twod ? 1 : (unsigned int)ceil(d.z / width));
+    m_n_cells.x = std::max(m_n_cells.x, 1u);
+    m_n_cells.y = std::max(m_n_cells.y, 1u);
+    m_n_cells.z = std::max(m_n_cells.z, 1u);
+    while (uint64_t(m_n_cells.x) * m_n_cells.y * m_n_cells.z < N)
+        {
+        m_n_cells.x++;
+        }
+
+    // particles in different cells are apart by at least (1 - 2 jitter) cell widths
+    Scalar min_width = std::min(d.x / Scalar(m_n_cells.x), d.y / Scalar(m_n_cells.y));
+    if (!twod)
+        {
+        min_width = std::min(min_width, d.z / Scalar(m_n_cells.z));
+        }
+    if (min_width < min_dist)
+        {
+        std::ostringstream s;
+        s << "DistributedRandomInitializer: " << N << " particles do not fit in the box with "
+          << "min_dist " << min_dist << ".";
+        throw runtime_error(s.str());
+        }
+    m_jitter = Scalar(0.5) * (Scalar(1.0) - min_dist / min_width);
+    }
+
+/*! \param first Tag of the first particle to generate
+    \param count Number of particles to generate
+*/
+std::shared_ptr<SnapshotParticleData<double>>
+DistributedRandomInitializer::getSlice(unsigned int first, unsigned int count) const
+    {
+    if (uint64_t(first) + count > m_n_global)
+        {
+        throw runtime_error("DistributedRandomInitializer: Slice is out of range");
+        }
+
+    auto slice = std::make_shared<SnapshotParticleData<double>>(count);
+    slice->type_mapping = m_type_mapping;
+
+    const uint64_t n_cells = uint64_t(m_n_cells.x) * m_n_cells.y * m_n_cells.z;
+    for (unsigned int i = 0; i < count; i++)
+        {
+        const unsigned int tag = first + i;
+        const uint64_t cell = uint64_t(double(tag) * double(n_cells) / double(m_n_global));
+        const unsigned int c_x = (unsigned int)(cell % m_n_cells.x);
+        const unsigned int c_y = (unsigned int)((cell / m_n_cells.x) % m_n_cells.y);
+        const unsigned int c_z = (unsigned int)(cell / (uint64_t(m_n_cells.x) * m_n_cells.y));
+
+        RandomGenerator rng(Seed(RNGIdentifier::DistributedRandomInitializer, 0, m_seed),
+                            Counter(tag));
+        UniformDistribution<Scalar> uniform(-m_jitter, m_jitter);
+        const Scalar u_x = uniform(rng);
+        const Scalar u_y = uniform(rng);
+        const Scalar u_z = uniform(rng);
+
+        Scalar3 f = make_scalar3((Scalar(c_x) + Scalar(0.5) + u_x) / Scalar(m_n_cells.x),
+                                 (Scalar(c_y) + Scalar(0.5) + u_y) / Scalar(m_n_cells.y),
+                                 (Scalar(c_z) + Scalar(0.5) + u_z) / Scalar(m_n_cells.z));
+        if (m_dimensions == 2)
+            {
+            f.z = Scalar(0.5);
+            }
+        slice->pos[i] = vec3<double>(m_box.makeCoordinates(f));
+
+        const Scalar u_type = UniformDistribution<Scalar>()(rng);
+        unsigned int type = 0;
+        while (type + 1 < m_type_cumulative.size() && u_type >= m_type_cumulative[type])
+            {
+            type++;
+            }
+        slice->type[i] = type;
+        slice->mass[i] = m_type_mass[type];
+        }
+
+    return slice;
+    }
+
+std::shared_ptr<SnapshotSystemData<double>> DistributedRandomInitializer::getSnapshot() const
+    {
+    auto snapshot = std::make_shared<SnapshotSystemData<double>>();
+    snapshot->global_box = std::make_shared<BoxDim>(m_box);
+    snapshot->dimensions = m_dimensions;
+    snapshot->particle_data = *getSlice(0, m_n_global);
+    return snapshot;
+    }
+
+namespace detail
+    {
+void export_DistributedInitializers(pybind11::module& m)
+    {
+    pybind11::class_<DistributedLatticeInitializer,
+                     std::shared_ptr<DistributedLatticeInitializer>>(
+        m,
+        "DistributedLatticeInitializer")
+        .def(pybind11::init<const BoxDim&,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            const std::vector<Scalar>&,
+                            const std::vector<unsigned int>&,
+                            const std::vector<Scalar>&,
+                            const std::vector<std::string>&>())
+        .def("getNGlobal", &DistributedLatticeInitializer::getNGlobal)
+        .def("getSlice", &DistributedLatticeInitializer::getSlice)
+        .def("getSnapshot", &DistributedLatticeInitializer::getSnapshot);
+
+    pybind11::class_<DistributedRandomInitializer, std::shared_ptr<DistributedRandomInitializer>>(
+        m,
+        "DistributedRandomInitializer")
+        .def(pybind11::init<const BoxDim&,
+                            unsigned int,
+                            Scalar,
+                            const std::vector<Scalar>&,
+                            const std::vector<Scalar>&,
+                            const std::vector<std::string>&,
+                            uint16_t>())
+        .def("getNGlobal", &DistributedRandomInitializer::getNGlobal)
+        .def("getSlice", &DistributedRandomInitializer::getSlice)
+        .def("getSnapshot", &DistributedRandomInitializer::getSnapshot);
+    }
+    } // end namespace detail
+
     } // end namespace hoomd
@@ -11,6 +11,9 @@
 
 #include "ParticleData.h"
 
+#include <string>
+#include <vector>
+
 #ifndef __INITIALIZERS_H__
 #define __INITIALIZERS_H__
 
@@ -69,6 +72,108 @@ class PYBIND11_EXPORT RandomInitializer
     std::string m_type_name;       //!< Name of the particle type created
     };
 
+//! Generates a lattice of particles in slices of consecutive tags
+/*! The global box is filled with n_x x n_y x n_z unit cells (n_z = 1 in 2D) that each hold the
+    particles of the basis at the given fractions of the cell. Lattice site
+    s = ((k * n_y + j) * n_x + i) * n_basis + b is the particle with tag s, and takes the type and
+    mass of basis site b.
+
+    getSlice() generates any range of tags. Each rank generates its own range and
+    ParticleData::initializeFromDistributedSnapshot() sends the particles to their domains, so
+    no rank ever holds the whole system.
+    \ingroup data_structs
+*/
+class PYBIND11_EXPORT DistributedLatticeInitializer
+    {
+    public:
+    //! Set the parameters
+    DistributedLatticeInitializer(const BoxDim& box,
+                                  unsigned int n_x,
+                                  unsigned int n_y,
+                                  unsigned int n_z,
+                                  const std::vector<Scalar>& basis,
+                                  const std::vector<unsigned int>& basis_type,
+                                  const std::vector<Scalar>& basis_mass,
+                                  const std::vector<std::string>& type_mapping);
+
+    //! Get the global number of particles
+    unsigned int getNGlobal() const
+        {
+        return m_n_global;
+        }
+
+    //! Generate the particles with tags first to first + count - 1
+    std::shared_ptr<SnapshotParticleData<double>> getSlice(unsigned int first,
+                                                           unsigned int count) const;
+
+    //! Generate a snapshot of the whole system
+    std::shared_ptr<SnapshotSystemData<double>> getSnapshot() const;
+
+    private:
+    BoxDim m_box;                            //!< Global box
+    unsigned int m_dimensions;               //!< Dimensionality of the box
+    uint3 m_n;                               //!< Number of unit cells along each box vector
+    std::vector<Scalar3> m_basis;            //!< Fractional positions of the basis in a cell
+    std::vector<unsigned int> m_basis_type;  //!< Type of each basis site
+    std::vector<Scalar> m_basis_mass;        //!< Mass of each basis site
+    std::vector<std::string> m_type_mapping; //!< Names of the particle types
+    unsigned int m_n_global;                 //!< Global number of particles
+    };
+
+//! Generates random non-overlapping particles in slices of consecutive tags
+/*! The box is divided into a grid of the fewest cells of equal shape that holds N particles,
+    giving particle t the cell floor(t * n_cells / N). Each particle is displaced from the center
+    of its cell by a uniform random fraction of the cell along each box vector, small enough that
+    particles in different cells stay min_dist apart. The displacement and type of a particle only
+    depend on its tag and the seed, so getSlice() generates any range of tags independently. The
+    type of each particle is drawn with the given fractions and its mass is that of its type.
+
+    Like DistributedLatticeInitializer, no rank ever holds the whole system.
+    \ingroup data_structs
+*/
+class PYBIND11_EXPORT DistributedRandomInitializer
+    {
+    public:
+    //! Set the parameters
+    DistributedRandomInitializer(const BoxDim& box,
+                                 unsigned int N,
+                                 Scalar min_dist,
+                                 const std::vector<Scalar>& type_fraction,
+                                 const std::vector<Scalar>& type_mass,
+                                 const std::vector<std::string>& type_mapping,
+                                 uint16_t seed);
+
+    //! Get the global number of particles
+    unsigned int getNGlobal() const
+        {
+        return m_n_global;
+        }
+
+    //! Generate the particles with tags first to first + count - 1
+    std::shared_ptr<SnapshotParticleData<double>> getSlice(unsigned int first,
+                                                           unsigned int count) const;
+
+    //! Generate a snapshot of the whole system
+    std::shared_ptr<SnapshotSystemData<double>> getSnapshot() const;
+
+    private:
+    BoxDim m_box;                            //!< Global box
+    unsigned int m_dimensions;               //!< Dimensionality of the box
+    unsigned int m_n_global;                 //!< Global number of particles
+    uint3 m_n_cells;                         //!< Number of cells along each box vector
+    Scalar m_jitter;                         //!< Largest displacement in units of the cell
+    std::vector<Scalar> m_type_cumulative;   //!< Cumulative type fractions
+    std::vector<Scalar> m_type_mass;         //!< Mass of each type
+    std::vector<std::string> m_type_mapping; //!< Names of the particle types
+    uint16_t m_seed;                         //!< Random seed
+    };
+
+namespace detail
+    {
+//! Exports the distributed initializers to python
+void export_DistributedInitializers(pybind11::module& m);
+    } // end namespace detail
+
     } // end namespace hoomd
 
 #endif
@@ -36,6 +36,9 @@ Integrator::Integrator(std::shared_ptr<SystemDefinition> sysdef, Scalar deltaT)
         m_comm->getCommFlagsRequestSignal().connect<Integrator, &Integrator::determineFlags>(this);
 
         m_comm->getComputeCallbackSignal().connect<Integrator, &Integrator::computeCallback>(this);
+
+        m_comm->getLocalComputeCallbackSignal()
+            .connect<Integrator, &Integrator::localComputeCallback>(this);
         }
 #endif
 
@@ -54,6 +57,9 @@ Integrator::~Integrator()
 
         m_comm->getComputeCallbackSignal().disconnect<Integrator, &Integrator::computeCallback>(
             this);
+
+        m_comm->getLocalComputeCallbackSignal()
+            .disconnect<Integrator, &Integrator::localComputeCallback>(this);
         }
 #endif
     }
@@ -167,7 +173,8 @@ void Integrator::computeNetForce(uint64_t timestep)
     {
     for (auto& force : m_forces)
         {
-        force->compute(timestep);
+        if (getForceWeight(*force, timestep) != Scalar(0.0))
+            force->compute(timestep);
         }
 
     Scalar external_virial[6];
@@ -195,6 +202,9 @@ void Integrator::computeNetForce(uint64_t timestep)
 
         // now, add up the net forces
         // also sum up forces for ghosts, in case they are needed by the communicator
+        // each thread sums a contiguous range of particles, so the result does not depend on the
+        // number of threads
+        ThreadPool& pool = m_exec_conf->getThreadPool();
         unsigned int nparticles = m_pdata->getN() + m_pdata->getNGhosts();
         size_t net_virial_pitch = net_virial.getPitch();
 
@@ -204,6 +214,10 @@ void Integrator::computeNetForce(uint64_t timestep)
 
         for (const auto& force : m_forces)
             {
+            const Scalar weight = getForceWeight(*force, timestep);
+            if (weight == Scalar(0.0))
+                continue;
+
             const GPUArray<Scalar4>& h_force_array = force->getForceArray();
             const GPUArray<Scalar>& h_virial_array = force->getVirialArray();
             const GPUArray<Scalar4>& h_torque_array = force->getTorqueArray();
@@ -217,24 +231,29 @@ void Integrator::computeNetForce(uint64_t timestep)
             ArrayHandle<Scalar4> h_torque(h_torque_array, access_location::host, access_mode::read);
 
             size_t virial_pitch = h_virial_array.getPitch();
-            for (unsigned int j = 0; j < nparticles; j++)
+            pool.parallelFor(
+                nparticles,
+                [&](unsigned int thread_id, unsigned int begin, unsigned int end)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
-                h_net_force.data[j].w += h_force.data[j].w;
-
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
-
-                for (unsigned int k = 0; k < 6; k++)
-                    {
-                    h_net_virial.data[k * net_virial_pitch + j]
-                        += h_virial.data[k * virial_pitch + j];
-                    }
-                }
+                    for (unsigned int j = begin; j < end; j++)
+                        {
+                        h_net_force.data[j].x += weight * h_force.data[j].x;
+                        h_net_force.data[j].y += weight * h_force.data[j].y;
+                        h_net_force.data[j].z += weight * h_force.data[j].z;
+                        h_net_force.data[j].w += h_force.data[j].w;
+
+                        h_net_torque.data[j].x += weight * h_torque.data[j].x;
+                        h_net_torque.data[j].y += weight * h_torque.data[j].y;
+                        h_net_torque.data[j].z += weight * h_torque.data[j].z;
+                        h_net_torque.data[j].w += h_torque.data[j].w;
+
+                        for (unsigned int k = 0; k < 6; k++)
+                            {
+                            h_net_virial.data[k * net_virial_pitch + j]
+                                += h_virial.data[k * virial_pitch + j];
+                            }
+                        }
+                });
 
             for (unsigned int k = 0; k < 6; k++)
                 {
@@ -284,6 +303,7 @@ void Integrator::computeNetForce(uint64_t timestep)
         size_t net_virial_pitch = net_virial.getPitch();
 
         // now, add up the net forces
+        ThreadPool& pool = m_exec_conf->getThreadPool();
         unsigned int nparticles = m_pdata->getN();
         assert(nparticles <= net_force.getNumElements());
         assert(6 * nparticles <= net_virial.getNumElements());
@@ -301,24 +321,29 @@ void Integrator::computeNetForce(uint64_t timestep)
             assert(6 * nparticles <= h_virial_array.getNumElements());
             assert(nparticles <= h_torque_array.getNumElements());
 
-            for (unsigned int j = 0; j < nparticles; j++)
+            pool.parallelFor(
+                nparticles,
+                [&](unsigned int thread_id, unsigned int begin, unsigned int end)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
-                h_net_force.data[j].w += h_force.data[j].w;
-
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
-
-                for (unsigned int k = 0; k < 6; k++)
-                    {
-                    h_net_virial.data[k * net_virial_pitch + j]
-                        += h_virial.data[k * virial_pitch + j];
-                    }
-                }
+                    for (unsigned int j = begin; j < end; j++)
+                        {
+                        h_net_force.data[j].x += h_force.data[j].x;
+                        h_net_force.data[j].y += h_force.data[j].y;
+                        h_net_force.data[j].z += h_force.data[j].z;
+                        h_net_force.data[j].w += h_force.data[j].w;
+
+                        h_net_torque.data[j].x += h_torque.data[j].x;
+                        h_net_torque.data[j].y += h_torque.data[j].y;
+                        h_net_torque.data[j].z += h_torque.data[j].z;
+                        h_net_torque.data[j].w += h_torque.data[j].w;
+
+                        for (unsigned int k = 0; k < 6; k++)
+                            {
+                            h_net_virial.data[k * net_virial_pitch + j]
+                                += h_virial.data[k * virial_pitch + j];
+                            }
+                        }
+                });
             for (unsigned int k = 0; k < 6; k++)
                 {
                 external_virial[k] += constraint_force->getExternalVirial(k);
@@ -348,208 +373,31 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         throw runtime_error("Cannot compute net force on the GPU if CUDA is disabled.");
         }
 
-    // compute all the normal forces first
-
+    // compute the forces that apply at this step first
+    std::vector<ForceCompute*> forces;
+    std::vector<Scalar> weights;
     for (auto& force : m_forces)
         {
+        const Scalar weight = getForceWeight(*force, timestep);
+        if (weight == Scalar(0.0))
+            continue;
+
         force->compute(timestep);
+        forces.push_back(force.get());
+        weights.push_back(weight);
         }
 
-    Scalar external_virial[6];
-    Scalar external_energy;
-
-        {
-        // access the net force and virial arrays
-        const GPUArray<Scalar4>& net_force = m_pdata->getNetForce();
-        const GPUArray<Scalar4>& net_torque = m_pdata->getNetTorqueArray();
-        const GPUArray<Scalar>& net_virial = m_pdata->getNetVirial();
-        size_t net_virial_pitch = net_virial.getPitch();
-
-        ArrayHandle<Scalar4> d_net_force(net_force,
-                                         access_location::device,
-                                         access_mode::overwrite);
-        ArrayHandle<Scalar> d_net_virial(net_virial,
-                                         access_location::device,
-                                         access_mode::overwrite);
-        ArrayHandle<Scalar4> d_net_torque(net_torque,
-                                          access_location::device,
-                                          access_mode::overwrite);
+    // also sum up forces for ghosts, in case they are needed by the communicator
+    // the first (and only) pass clears the net force, also when there are no forces
+    sumNetForceGPU(forces, weights, m_pdata->getN() + m_pdata->getNGhosts(), true);
 
-        // also sum up forces for ghosts, in case they are needed by the communicator
-        unsigned int nparticles = m_pdata->getN() + m_pdata->getNGhosts();
-        assert(nparticles <= net_force.getNumElements());
-        assert(nparticles * 6 <= net_virial.getNumElements());
-        assert(nparticles <= net_torque.getNumElements());
-
-        // zero external virial
-        for (unsigned int i = 0; i < 6; ++i)
-            external_virial[i] = Scalar(0.0);
-
-        external_energy = Scalar(0.0);
-
-        // there is no need to zero out the initial net force and virial here, the first call to the
-        // addition kernel will do that ahh!, but we do need to zer out the net force and virial if
-        // there are 0 forces!
-        if (m_forces.size() == 0)
-            {
-            // start by zeroing the net force and virial arrays
-            hipMemset(d_net_force.data, 0, sizeof(Scalar4) * net_force.getNumElements());
-            hipMemset(d_net_torque.data, 0, sizeof(Scalar4) * net_torque.getNumElements());
-            hipMemset(d_net_virial.data, 0, 6 * sizeof(Scalar) * net_virial_pitch);
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
-
-        // now, add up the accelerations
-        // sum all the forces into the net force
-        // perform the sum in groups of 6 to avoid kernel launch and memory access overheads
-        for (unsigned int cur_force = 0; cur_force < m_forces.size(); cur_force += 6)
-            {
-            // grab the device pointers for the current set
-            kernel::gpu_force_list force_list;
-
-            const GPUArray<Scalar4>& d_force_array0 = m_forces[cur_force]->getForceArray();
-            ArrayHandle<Scalar4> d_force0(d_force_array0,
-                                          access_location::device,
-                                          access_mode::read);
-            const GPUArray<Scalar>& d_virial_array0 = m_forces[cur_force]->getVirialArray();
-            ArrayHandle<Scalar> d_virial0(d_virial_array0,
-                                          access_location::device,
-                                          access_mode::read);
-            const GPUArray<Scalar4>& d_torque_array0 = m_forces[cur_force]->getTorqueArray();
-            ArrayHandle<Scalar4> d_torque0(d_torque_array0,
-                                           access_location::device,
-                                           access_mode::read);
-            force_list.f0 = d_force0.data;
-            force_list.v0 = d_virial0.data;
-            force_list.vpitch0 = d_virial_array0.getPitch();
-            force_list.t0 = d_torque0.data;
-
-            if (cur_force + 1 < m_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array1 = m_forces[cur_force + 1]->getForceArray();
-                ArrayHandle<Scalar4> d_force1(d_force_array1,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array1 = m_forces[cur_force + 1]->getVirialArray();
-                ArrayHandle<Scalar> d_virial1(d_virial_array1,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array1
-                    = m_forces[cur_force + 1]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque1(d_torque_array1,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f1 = d_force1.data;
-                force_list.v1 = d_virial1.data;
-                force_list.vpitch1 = d_virial_array1.getPitch();
-                force_list.t1 = d_torque1.data;
-                }
-            if (cur_force + 2 < m_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array2 = m_forces[cur_force + 2]->getForceArray();
-                ArrayHandle<Scalar4> d_force2(d_force_array2,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array2 = m_forces[cur_force + 2]->getVirialArray();
-                ArrayHandle<Scalar> d_virial2(d_virial_array2,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array2
-                    = m_forces[cur_force + 2]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque2(d_torque_array2,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f2 = d_force2.data;
-                force_list.v2 = d_virial2.data;
-                force_list.vpitch2 = d_virial_array2.getPitch();
-                force_list.t2 = d_torque2.data;
-                }
-            if (cur_force + 3 < m_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array3 = m_forces[cur_force + 3]->getForceArray();
-                ArrayHandle<Scalar4> d_force3(d_force_array3,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array3 = m_forces[cur_force + 3]->getVirialArray();
-                ArrayHandle<Scalar> d_virial3(d_virial_array3,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array3
-                    = m_forces[cur_force + 3]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque3(d_torque_array3,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f3 = d_force3.data;
-                force_list.v3 = d_virial3.data;
-                force_list.vpitch3 = d_virial_array3.getPitch();
-                force_list.t3 = d_torque3.data;
-                }
-            if (cur_force + 4 < m_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array4 = m_forces[cur_force + 4]->getForceArray();
-                ArrayHandle<Scalar4> d_force4(d_force_array4,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array4 = m_forces[cur_force + 4]->getVirialArray();
-                ArrayHandle<Scalar> d_virial4(d_virial_array4,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array4
-                    = m_forces[cur_force + 4]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque4(d_torque_array4,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f4 = d_force4.data;
-                force_list.v4 = d_virial4.data;
-                force_list.vpitch4 = d_virial_array4.getPitch();
-                force_list.t4 = d_torque4.data;
-                }
-            if (cur_force + 5 < m_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array5 = m_forces[cur_force + 5]->getForceArray();
-                ArrayHandle<Scalar4> d_force5(d_force_array5,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array5 = m_forces[cur_force + 5]->getVirialArray();
-                ArrayHandle<Scalar> d_virial5(d_virial_array5,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array5
-                    = m_forces[cur_force + 5]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque5(d_torque_array5,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f5 = d_force5.data;
-                force_list.v5 = d_virial5.data;
-                force_list.vpitch5 = d_virial_array5.getPitch();
-                force_list.t5 = d_torque5.data;
-                }
-
-            // clear on the first iteration only
-            bool clear = (cur_force == 0);
-
-            // access flags
-            PDataFlags flags = this->m_pdata->getFlags();
-
-            m_exec_conf->setDevice();
-
-            gpu_integrator_sum_net_force(d_net_force.data,
-                                         d_net_virial.data,
-                                         net_virial_pitch,
-                                         d_net_torque.data,
-                                         force_list,
-                                         nparticles,
-                                         clear,
-                                         flags[pdata_flag::pressure_tensor]);
-
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
-        }
+    Scalar external_virial[6];
+    Scalar external_energy = Scalar(0.0);
+    for (unsigned int k = 0; k < 6; ++k)
+        external_virial[k] = Scalar(0.0);
 
     // add up external virials and energies
-    for (const auto& force : m_forces)
+    for (const auto& force : forces)
         {
         for (unsigned int k = 0; k < 6; k++)
             external_virial[k] += force->getExternalVirial(k);
@@ -574,190 +422,16 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 #endif
 
     // compute all the constraint forces next
+    std::vector<ForceCompute*> constraint_forces;
     for (auto& constraint_force : m_constraint_forces)
         {
         constraint_force->compute(timestep);
+        constraint_forces.push_back(constraint_force.get());
         }
 
-        {
-        // access the net force and virial arrays
-        const GPUArray<Scalar4>& net_force = m_pdata->getNetForce();
-        const GPUArray<Scalar>& net_virial = m_pdata->getNetVirial();
-        const GPUArray<Scalar4>& net_torque = m_pdata->getNetTorqueArray();
-        ArrayHandle<Scalar4> d_net_force(net_force,
-                                         access_location::device,
-                                         access_mode::readwrite);
-        ArrayHandle<Scalar> d_net_virial(net_virial,
-                                         access_location::device,
-                                         access_mode::readwrite);
-        ArrayHandle<Scalar4> d_net_torque(net_torque,
-                                          access_location::device,
-                                          access_mode::readwrite);
-
-        unsigned int nparticles = m_pdata->getN();
-        assert(nparticles <= net_force.getNumElements());
-        assert(6 * nparticles <= net_virial.getNumElements());
-        assert(nparticles <= net_torque.getNumElements());
-
-        // now, add up the accelerations
-        // sum all the forces into the net force
-        // perform the sum in groups of 6 to avoid kernel launch and memory access overheads
-        for (unsigned int cur_force = 0; cur_force < m_constraint_forces.size(); cur_force += 6)
-            {
-            // grab the device pointers for the current set
-            kernel::gpu_force_list force_list;
-            const GPUArray<Scalar4>& d_force_array0
-                = m_constraint_forces[cur_force]->getForceArray();
-            ArrayHandle<Scalar4> d_force0(d_force_array0,
-                                          access_location::device,
-                                          access_mode::read);
-            const GPUArray<Scalar>& d_virial_array0
-                = m_constraint_forces[cur_force]->getVirialArray();
-            ArrayHandle<Scalar> d_virial0(d_virial_array0,
-                                          access_location::device,
-                                          access_mode::read);
-            const GPUArray<Scalar4>& d_torque_array0
-                = m_constraint_forces[cur_force]->getTorqueArray();
-            ArrayHandle<Scalar4> d_torque0(d_torque_array0,
-                                           access_location::device,
-                                           access_mode::read);
-            force_list.f0 = d_force0.data;
-            force_list.t0 = d_torque0.data;
-            force_list.v0 = d_virial0.data;
-            force_list.vpitch0 = d_virial_array0.getPitch();
-
-            if (cur_force + 1 < m_constraint_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array1
-                    = m_constraint_forces[cur_force + 1]->getForceArray();
-                ArrayHandle<Scalar4> d_force1(d_force_array1,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array1
-                    = m_constraint_forces[cur_force + 1]->getVirialArray();
-                ArrayHandle<Scalar> d_virial1(d_virial_array1,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array1
-                    = m_constraint_forces[cur_force + 1]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque1(d_torque_array1,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f1 = d_force1.data;
-                force_list.t1 = d_torque1.data;
-                force_list.v1 = d_virial1.data;
-                force_list.vpitch1 = d_virial_array1.getPitch();
-                }
-            if (cur_force + 2 < m_constraint_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array2
-                    = m_constraint_forces[cur_force + 2]->getForceArray();
-                ArrayHandle<Scalar4> d_force2(d_force_array2,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array2
-                    = m_constraint_forces[cur_force + 2]->getVirialArray();
-                ArrayHandle<Scalar> d_virial2(d_virial_array2,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array2
-                    = m_constraint_forces[cur_force + 2]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque2(d_torque_array2,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f2 = d_force2.data;
-                force_list.t2 = d_torque2.data;
-                force_list.v2 = d_virial2.data;
-                force_list.vpitch2 = d_virial_array2.getPitch();
-                }
-            if (cur_force + 3 < m_constraint_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array3
-                    = m_constraint_forces[cur_force + 3]->getForceArray();
-                ArrayHandle<Scalar4> d_force3(d_force_array3,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array3
-                    = m_constraint_forces[cur_force + 3]->getVirialArray();
-                ArrayHandle<Scalar> d_virial3(d_virial_array3,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array3
-                    = m_constraint_forces[cur_force + 3]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque3(d_torque_array3,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f3 = d_force3.data;
-                force_list.t3 = d_torque3.data;
-                force_list.v3 = d_virial3.data;
-                force_list.vpitch3 = d_virial_array3.getPitch();
-                }
-            if (cur_force + 4 < m_constraint_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array4
-                    = m_constraint_forces[cur_force + 4]->getForceArray();
-                ArrayHandle<Scalar4> d_force4(d_force_array4,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array4
-                    = m_constraint_forces[cur_force + 4]->getVirialArray();
-                ArrayHandle<Scalar> d_virial4(d_virial_array4,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array4
-                    = m_constraint_forces[cur_force + 4]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque4(d_torque_array4,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f4 = d_force4.data;
-                force_list.t4 = d_torque4.data;
-                force_list.v4 = d_virial4.data;
-                force_list.vpitch4 = d_virial_array4.getPitch();
-                }
-            if (cur_force + 5 < m_constraint_forces.size())
-                {
-                const GPUArray<Scalar4>& d_force_array5
-                    = m_constraint_forces[cur_force + 5]->getForceArray();
-                ArrayHandle<Scalar4> d_force5(d_force_array5,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar>& d_virial_array5
-                    = m_constraint_forces[cur_force + 5]->getVirialArray();
-                ArrayHandle<Scalar> d_virial5(d_virial_array5,
-                                              access_location::device,
-                                              access_mode::read);
-                const GPUArray<Scalar4>& d_torque_array5
-                    = m_constraint_forces[cur_force + 5]->getTorqueArray();
-                ArrayHandle<Scalar4> d_torque5(d_torque_array5,
-                                               access_location::device,
-                                               access_mode::read);
-                force_list.f5 = d_force5.data;
-                force_list.t5 = d_torque5.data;
-                force_list.v5 = d_virial5.data;
-                force_list.vpitch5 = d_virial_array5.getPitch();
-                }
-
-            // clear only on the first iteration AND if there are zero forces
-            bool clear = (cur_force == 0) && (m_forces.size() == 0);
-
-            // access flags
-            PDataFlags flags = this->m_pdata->getFlags();
-
-            m_exec_conf->setDevice();
-
-            gpu_integrator_sum_net_force(d_net_force.data,
-                                         d_net_virial.data,
-                                         net_virial.getPitch(),
-                                         d_net_torque.data,
-                                         force_list,
-                                         nparticles,
-                                         clear,
-                                         flags[pdata_flag::pressure_tensor]);
-
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
-        }
+    // constraint forces apply every step and are added to the net force of the local particles
+    std::vector<Scalar> constraint_weights(constraint_forces.size(), Scalar(1.0));
+    sumNetForceGPU(constraint_forces, constraint_weights, m_pdata->getN(), false);
 
     // add up external virials
     for (const auto& constraint_force : m_constraint_forces)
@@ -774,6 +448,105 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 
     m_pdata->setExternalEnergy(external_energy);
     }
+
+/** @param forces Force computes to sum
+    @param weights Weight of the forces and torques of each force compute
+    @param nparticles Number of particles to sum
+    @param clear When true, overwrite the net force. When false, add to it.
+
+    The pointers to the arrays of all force computes are uploaded in one table so that a single
+    kernel launch reads and writes each element of the net force, torque, and virial only once.
+*/
+void Integrator::sumNetForceGPU(const std::vector<ForceCompute*>& forces,
+                                const std::vector<Scalar>& weights,
+                                unsigned int nparticles,
+                                bool clear)
+    {
+    assert(forces.size() == weights.size());
+    const unsigned int n_forces = static_cast<unsigned int>(forces.size());
+
+    // nothing to add
+    if (n_forces == 0 && !clear)
+        return;
+
+    if (m_force_data.getNumElements() < std::max(n_forces, 1u))
+        {
+        GPUArray<kernel::gpu_force_data> force_data(std::max(n_forces, 1u), m_exec_conf);
+        m_force_data.swap(force_data);
+        }
+
+    const GPUArray<Scalar4>& net_force = m_pdata->getNetForce();
+    const GPUArray<Scalar4>& net_torque = m_pdata->getNetTorqueArray();
+    const GPUArray<Scalar>& net_virial = m_pdata->getNetVirial();
+
+    assert(nparticles <= net_force.getNumElements());
+    assert(nparticles * 6 <= net_virial.getNumElements());
+    assert(nparticles <= net_torque.getNumElements());
+
+    // hold the arrays of every force compute on the device while the kernel reads them
+    std::vector<std::unique_ptr<ArrayHandle<Scalar4>>> d_forces;
+    std::vector<std::unique_ptr<ArrayHandle<Scalar4>>> d_torques;
+    std::vector<std::unique_ptr<ArrayHandle<Scalar>>> d_virials;
+
+    if (n_forces > 0)
+        {
+        ArrayHandle<kernel::gpu_force_data> h_force_data(m_force_data,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+        for (unsigned int i = 0; i < n_forces; i++)
+            {
+            const GPUArray<Scalar4>& force_array = forces[i]->getForceArray();
+            const GPUArray<Scalar4>& torque_array = forces[i]->getTorqueArray();
+            const GPUArray<Scalar>& virial_array = forces[i]->getVirialArray();
+
+            assert(nparticles <= force_array.getNumElements());
+            assert(nparticles <= torque_array.getNumElements());
+            assert(nparticles * 6 <= virial_array.getNumElements());
+
+            d_forces.emplace_back(new ArrayHandle<Scalar4>(force_array,
+                                                           access_location::device,
+                                                           access_mode::read));
+            d_torques.emplace_back(new ArrayHandle<Scalar4>(torque_array,
+                                                            access_location::device,
+                                                            access_mode::read));
+            d_virials.emplace_back(new ArrayHandle<Scalar>(virial_array,
+                                                           access_location::device,
+                                                           access_mode::read));
+
+            h_force_data.data[i].f = d_forces.back()->data;
+            h_force_data.data[i].t = d_torques.back()->data;
+            h_force_data.data[i].v = d_virials.back()->data;
+            h_force_data.data[i].vpitch = virial_array.getPitch();
+            h_force_data.data[i].s = weights[i];
+            }
+        }
+
+    const access_mode::Enum mode = clear ? access_mode::overwrite : access_mode::readwrite;
+    ArrayHandle<Scalar4> d_net_force(net_force, access_location::device, mode);
+    ArrayHandle<Scalar> d_net_virial(net_virial, access_location::device, mode);
+    ArrayHandle<Scalar4> d_net_torque(net_torque, access_location::device, mode);
+    ArrayHandle<kernel::gpu_force_data> d_force_data(m_force_data,
+                                                     access_location::device,
+                                                     access_mode::read);
+
+    // access flags
+    PDataFlags flags = this->m_pdata->getFlags();
+
+    m_exec_conf->setDevice();
+
+    kernel::gpu_integrator_sum_net_force(d_net_force.data,
+                                         d_net_virial.data,
+                                         net_virial.getPitch(),
+                                         d_net_torque.data,
+                                         d_force_data.data,
+                                         n_forces,
+                                         nparticles,
+                                         clear,
+                                         flags[pdata_flag::pressure_tensor]);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
 #endif
 
 /** The base class integrator actually does nothing in update()
@@ -849,7 +622,25 @@ void Integrator::computeCallback(uint64_t timestep)
     // pre-compute all active forces
     for (auto& force : m_forces)
         {
-        force->preCompute(timestep);
+        if (getForceWeight(*force, timestep) != Scalar(0.0))
+            force->preCompute(timestep);
+        }
+    }
+
+/*! Constraint forces may move local particles after the ghost update completes, so the
+    interior computation is only performed in integrators without them.
+*/
+void Integrator::localComputeCallback(uint64_t timestep)
+    {
+    if (!canComputeDuringGhostUpdate())
+        {
+        return;
+        }
+
+    for (auto& force : m_forces)
+        {
+        if (getForceWeight(*force, timestep) != Scalar(0.0))
+            force->computeInterior(timestep);
         }
     }
 #endif
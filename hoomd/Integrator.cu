@@ -14,53 +14,21 @@ namespace hoomd
     {
 namespace kernel
     {
-//! helper to add a given force/virial pointer pair
-template<unsigned int compute_virial>
-__device__ void add_force_total(Scalar4& net_force,
-                                Scalar* net_virial,
-                                Scalar4& net_torque,
-                                Scalar4* d_f,
-                                Scalar* d_v,
-                                const size_t virial_pitch,
-                                Scalar4* d_t,
-                                int idx)
-    {
-    if (d_f != NULL && d_v != NULL && d_t != NULL)
-        {
-        Scalar4 f = d_f[idx];
-        Scalar4 t = d_t[idx];
-
-        net_force.x += f.x;
-        net_force.y += f.y;
-        net_force.z += f.z;
-        net_force.w += f.w;
-
-        if (compute_virial)
-            {
-            for (int i = 0; i < 6; i++)
-                net_virial[i] += d_v[i * virial_pitch + idx];
-            }
-
-        net_torque.x += t.x;
-        net_torque.y += t.y;
-        net_torque.z += t.z;
-        net_torque.w += t.w;
-        }
-    }
-
 //! Kernel for summing forces on the GPU
-/*! The specified forces and virials are summed for every particle into \a d_net_force and \a
-   d_net_virial
+/*! The forces, torques, and virials of all force computes in \a d_force_data are summed for every
+   particle into \a d_net_force, \a d_net_torque, and \a d_net_virial. Each thread adds the force
+   computes in order, so the result does not depend on the launch configuration, and the net
+   arrays are read (when not cleared) and written only once.
 
     \param d_net_force Output device array to hold the computed net force
     \param d_net_virial Output device array to hold the computed net virial
     \param net_virial_pitch The pitch of the 2D net_virial array
     \param d_net_torque Output device array to hold the computed net torque
-    \param force_list List of pointers to force data to sum
+    \param d_force_data Pointers to the arrays of each force compute
+    \param n_forces Number of force computes to sum
     \param nwork Number of particles this GPU processes
     \param clear When true, initializes the sums to 0 before adding. When false, reads in the
-   current \a d_net_force and \a d_net_virial and adds to that \param offset of this GPU in ptls
-   array
+   current \a d_net_force, \a d_net_torque, and \a d_net_virial and adds to that
 
     \tparam compute_virial When set to 0, the virial sum is not computed
 */
@@ -69,7 +37,8 @@ __global__ void gpu_integrator_sum_net_force_kernel(Scalar4* d_net_force,
                                                     Scalar* d_net_virial,
                                                     const size_t net_virial_pitch,
                                                     Scalar4* d_net_torque,
-                                                    const gpu_force_list force_list,
+                                                    const gpu_force_data* d_force_data,
+                                                    unsigned int n_forces,
                                                     unsigned int nwork,
                                                     bool clear)
     {
@@ -78,90 +47,75 @@ __global__ void gpu_integrator_sum_net_force_kernel(Scalar4* d_net_force,
 
     if (idx < nwork)
         {
-        // set the initial net_force and net_virial to sum into
-        Scalar4 net_force;
-        Scalar net_virial[6];
-        Scalar4 net_torque;
+        // set the initial net_force and net_virial to sum into, in AccumReal precision
+        AccumReal4 net_force;
+        AccumReal net_virial[6];
+        AccumReal4 net_torque;
         if (clear)
             {
-            net_force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+            net_force
+                = make_accumreal4(AccumReal(0.0), AccumReal(0.0), AccumReal(0.0), AccumReal(0.0));
             if (compute_virial)
                 {
                 for (int i = 0; i < 6; i++)
-                    net_virial[i] = Scalar(0.0);
+                    net_virial[i] = AccumReal(0.0);
                 }
-            net_torque = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+            net_torque
+                = make_accumreal4(AccumReal(0.0), AccumReal(0.0), AccumReal(0.0), AccumReal(0.0));
             }
         else
             {
             // if clear is false, initialize to the current d_net_force and d_net_virial
-            net_force = d_net_force[idx];
+            Scalar4 f = d_net_force[idx];
+            net_force = make_accumreal4(f.x, f.y, f.z, f.w);
             if (compute_virial)
                 {
                 for (int i = 0; i < 6; i++)
                     net_virial[i] = d_net_virial[i * net_virial_pitch + idx];
                 }
-            net_torque = d_net_torque[idx];
+            Scalar4 t = d_net_torque[idx];
+            net_torque = make_accumreal4(t.x, t.y, t.z, t.w);
             }
 
         // sum up the totals
-        add_force_total<compute_virial>(net_force,
-                                        net_virial,
-                                        net_torque,
-                                        force_list.f0,
-                                        force_list.v0,
-                                        force_list.vpitch0,
-                                        force_list.t0,
-                                        idx);
-        add_force_total<compute_virial>(net_force,
-                                        net_virial,
-                                        net_torque,
-                                        force_list.f1,
-                                        force_list.v1,
-                                        force_list.vpitch1,
-                                        force_list.t1,
-                                        idx);
-        add_force_total<compute_virial>(net_force,
-                                        net_virial,
-                                        net_torque,
-                                        force_list.f2,
-                                        force_list.v2,
-                                        force_list.vpitch2,
-                                        force_list.t2,
-                                        idx);
-        add_force_total<compute_virial>(net_force,
-                                        net_virial,
-                                        net_torque,
-                                        force_list.f3,
-                                        force_list.v3,
-                                        force_list.vpitch3,
-                                        force_list.t3,
-                                        idx);
-        add_force_total<compute_virial>(net_force,
-                                        net_virial,
-                                        net_torque,
-                                        force_list.f4,
-                                        force_list.v4,
-                                        force_list.vpitch4,
-                                        force_list.t4,
-                                        idx);
-        add_force_total<compute_virial>(net_force,
-                                        net_virial,
-                                        net_torque,
-                                        force_list.f5,
-                                        force_list.v5,
-                                        force_list.vpitch5,
-                                        force_list.t5,
-                                        idx);
+        for (unsigned int cur_force = 0; cur_force < n_forces; cur_force++)
+            {
+            const gpu_force_data force_data = d_force_data[cur_force];
+            const Scalar s = force_data.s;
+
+            Scalar4 f = force_data.f[idx];
+            net_force.x += s * f.x;
+            net_force.y += s * f.y;
+            net_force.z += s * f.z;
+            net_force.w += f.w;
+
+            if (compute_virial)
+                {
+                for (int i = 0; i < 6; i++)
+                    net_virial[i] += force_data.v[i * force_data.vpitch + idx];
+                }
+
+            Scalar4 t = force_data.t[idx];
+            net_torque.x += s * t.x;
+            net_torque.y += s * t.y;
+            net_torque.z += s * t.z;
+            net_torque.w += t.w;
+            }
 
         // write out the final result
-        d_net_force[idx] = net_force;
+        d_net_force[idx] = make_scalar4(Scalar(net_force.x),
+                                        Scalar(net_force.y),
+                                        Scalar(net_force.z),
+                                        Scalar(net_force.w));
         if (compute_virial)
             {
             for (int i = 0; i < 6; i++)
-                d_net_virial[i * net_virial_pitch + idx] = net_virial[i];
+                d_net_virial[i * net_virial_pitch + idx] = Scalar(net_virial[i]);
             }
-        d_net_torque[idx] = net_torque;
+        d_net_torque[idx] = make_scalar4(Scalar(net_torque.x),
+                                         Scalar(net_torque.y),
+                                         Scalar(net_torque.z),
+                                         Scalar(net_torque.w));
         }
     }
 
@@ -169,7 +123,8 @@ hipError_t gpu_integrator_sum_net_force(Scalar4* d_net_force,
                                         Scalar* d_net_virial,
                                         size_t net_virial_pitch,
                                         Scalar4* d_net_torque,
-                                        const gpu_force_list& force_list,
+                                        const gpu_force_data* d_force_data,
+                                        unsigned int n_forces,
                                         unsigned int nparticles,
                                         bool clear,
                                         bool compute_virial)
@@ -178,6 +133,7 @@ hipError_t gpu_integrator_sum_net_force(Scalar4* d_net_force,
     assert(d_net_force);
     assert(d_net_virial);
     assert(d_net_torque);
+    assert(d_force_data || n_forces == 0);
 
     const int block_size = 256;
 
@@ -194,7 +150,8 @@ hipError_t gpu_integrator_sum_net_force(Scalar4* d_net_force,
                            d_net_virial,
                            net_virial_pitch,
                            d_net_torque,
-                           force_list,
+                           d_force_data,
+                           n_forces,
                            nwork,
                            clear);
         }
@@ -209,7 +166,8 @@ hipError_t gpu_integrator_sum_net_force(Scalar4* d_net_force,
                            d_net_virial,
                            net_virial_pitch,
                            d_net_torque,
-                           force_list,
+                           d_force_data,
+                           n_forces,
                            nwork,
                            clear);
         }
@@ -17,6 +17,7 @@
 #include <vector>
 
 #ifdef ENABLE_HIP
+#include "Integrator.cuh"
 #include <hip/hip_runtime.h>
 #endif
 
@@ -45,6 +46,13 @@ namespace hoomd
     convenience in derived classes implementing correct counting in getTranslationalDOF() and
     getRotationalDOF().
 
+    Multiple time stepping: a force with ForceCompute::getPeriod() of k > 1 is only computed on
+    steps that are multiples of k, where its forces and torques enter the net force multiplied by k.
+    In velocity Verlet schemes, this applies the slow force as an impulse of k * deltaT split
+    across the two half steps around every k-th step, which is the impulse form of r-RESPA. The
+    energies and virials of the force are added unscaled on those steps and are absent on the
+    others. Constraint forces are computed every step.
+
     Integrators take "ownership" of the particle's accelerations. Any other updater that modifies
     the particles accelerations will produce undefined results. If accelerations are to be modified,
     they must be done through forces, and added to an Integrator via the m_forces std::vector.
@@ -139,6 +147,15 @@ class PYBIND11_EXPORT Integrator : public Updater
 #ifdef ENABLE_MPI
     /// Callback for pre-computing the forces
     void computeCallback(uint64_t timestep);
+
+    /// Callback for computing forces on interior particles during the ghost update
+    void localComputeCallback(uint64_t timestep);
+
+    /// Test whether forces may be computed while the ghost update is in flight
+    virtual bool canComputeDuringGhostUpdate()
+        {
+        return m_constraint_forces.empty();
+        }
 #endif
 
     /// Reset stats counters for children objects
@@ -192,12 +209,28 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// helper function to compute initial accelerations
     void computeAccelerations(uint64_t timestep);
 
+    /// Get the weight of a force in the net force at the given step (0 when it does not apply)
+    static Scalar getForceWeight(const ForceCompute& force, uint64_t timestep)
+        {
+        const unsigned int period = force.getPeriod();
+        return (timestep % period == 0) ? Scalar(period) : Scalar(0.0);
+        }
+
     /// helper function to compute net force/virial
     virtual void computeNetForce(uint64_t timestep);
 
 #ifdef ENABLE_HIP
     /// helper function to compute net force/virial on the GPU
     virtual void computeNetForceGPU(uint64_t timestep);
+
+    /// Sum the given force computes into the net force in one pass on the GPU
+    void sumNetForceGPU(const std::vector<ForceCompute*>& forces,
+                        const std::vector<Scalar>& weights,
+                        unsigned int nparticles,
+                        bool clear);
+
+    /// Pointers to the arrays of the force computes summed by sumNetForceGPU
+    GPUArray<kernel::gpu_force_data> m_force_data;
 #endif
 
 #ifdef ENABLE_MPI
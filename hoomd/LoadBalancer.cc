@@ -7,6 +7,7 @@
 
 #include "LoadBalancer.h"
 #include "Communicator.h"
+#include "System.h"
 
 #include "hoomd/extern/BVLSSolver.h"
 #include <Eigen/Dense>
@@ -34,8 +35,11 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 #endif
       m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true), m_needs_migrate(false),
       m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)),
-      m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
-      m_n_iterations(0), m_n_rebalances(0)
+      m_md_weight(Scalar(1.0)), m_mpcd_weight(Scalar(0.0)), m_volume_weight(Scalar(0.0)),
+      m_timing(false), m_damping(Scalar(0.5)), m_cost_factor(Scalar(1.0)), m_N_own(m_pdata->getN()),
+      m_N_mpcd_own(0), m_has_timer_sample(false), m_last_integrator_time(0.0),
+      m_last_comm_time(0.0), m_last_n_steps(0), m_max_max_imbalance(1.0),
+      m_total_max_imbalance(0.0), m_n_calls(0), m_n_iterations(0), m_n_rebalances(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing LoadBalancer" << endl;
 
@@ -84,6 +88,9 @@ void LoadBalancer::update(uint64_t timestep)
     // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
     resetNOwn(m_pdata->getN());
 
+    // measure the cost of the ranks over the steps since the last balancing
+    updateCostFactor();
+
     // figure out which rank is the reduction root for broadcasting
     const Index3D& di = m_decomposition->getDomainIndexer();
     unsigned int reduce_root(0);
@@ -139,17 +146,17 @@ void LoadBalancer::update(uint64_t timestep)
                 min_frac_i = min_domain_frac.z;
                 }
 
-            vector<unsigned int> N_i;
+            vector<Scalar> C_i;
             bool adjusted = false;
 
-            // reduce the number of particles in the slice along dim
-            bool active = reduce(N_i, dim, reduce_root);
+            // reduce the cost of the slices along dim
+            bool active = reduce(C_i, dim, reduce_root);
 
             // attempt an adjustment
             vector<Scalar> cum_frac = m_decomposition->getCumulativeFractions(dim);
             if (active)
                 {
-                adjusted = adjust(cum_frac, N_i, L_i, min_frac_i);
+                adjusted = adjust(cum_frac, C_i, L_i, min_frac_i);
                 }
 
             // broadcast if an adjustment has been made on the root
@@ -172,25 +179,60 @@ void LoadBalancer::update(uint64_t timestep)
             resetNOwn(m_pdata->getN());
             m_needs_migrate = false;
 
+            // MPCD particles are only migrated at their next communication, so count them
+            if (m_mpcd_weight > Scalar(0.0))
+                m_needs_recount = true;
+
             // increment the number of rebalances actually performed
             ++m_n_rebalances;
             }
         }
+
+    // read the timers after balancing so that its own communication is not measured
+    m_has_timer_sample = readTimers(m_last_integrator_time, m_last_comm_time, m_last_n_steps);
 #endif // ENABLE_MPI
     }
 
 #ifdef ENABLE_MPI
 
 /*!
- * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
+ * \returns Weighted sum of the MD particles, MPCD particles, and volume owned by the rank
+ */
+Scalar LoadBalancer::getModelCost()
+    {
+    computeOwnedParticles();
+    Scalar cost = m_md_weight * Scalar(m_N_own);
+    if (m_mpcd_weight > Scalar(0.0))
+        {
+        cost += m_mpcd_weight * Scalar(m_N_mpcd_own);
+        }
+    if (m_volume_weight > Scalar(0.0))
+        {
+        cost += m_volume_weight * m_pdata->getBox().getVolume(m_sysdef->getNDimensions() == 2);
+        }
+    return cost;
+    }
+
+/*!
+ * Computes the imbalance factor I = C / <C> for each rank, and computes the maximum among all
  * ranks.
  */
 Scalar LoadBalancer::getMaxImbalance()
     {
     if (m_recompute_max_imbalance)
         {
-        Scalar cur_imb = Scalar(getNOwn())
-                         / (Scalar(m_pdata->getNGlobal()) / Scalar(m_exec_conf->getNRanks()));
+        const Scalar cost = getCost();
+        Scalar total_cost = getTotalCost();
+        if (m_timing)
+            {
+            // the cost factors differ between ranks, so sum the costs
+            MPI_Allreduce(&cost, &total_cost, 1, MPI_HOOMD_SCALAR, MPI_SUM, m_mpi_comm);
+            }
+        Scalar cur_imb = Scalar(1.0);
+        if (total_cost > Scalar(0.0))
+            {
+            cur_imb = cost / (total_cost / Scalar(m_exec_conf->getNRanks()));
+            }
         Scalar max_imb(0.0);
         MPI_Allreduce(&cur_imb, &max_imb, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
 
@@ -205,37 +247,109 @@ Scalar LoadBalancer::getMaxImbalance()
     }
 
 /*!
- * \param N_i Vector holding the total number of particles in each slice (will be allocated on call)
+ * \param integrator_time Total time spent in the integrator (in seconds)
+ * \param comm_time Total time spent in the communicator (in seconds)
+ * \param n_steps Number of calls to the integrator
+ * \returns true if the timers were read
+ *
+ * The timers are only read when timing is enabled, profiling is active, and there is an
+ * integrator. These conditions are the same on all ranks.
+ */
+bool LoadBalancer::readTimers(double& integrator_time, double& comm_time, uint64_t& n_steps)
+    {
+    auto system = m_system.lock();
+    if (!m_timing || !m_sysdef->getProfiler().isEnabled() || !system)
+        return false;
+
+    auto integrator = system->getIntegrator();
+    if (!integrator)
+        return false;
+
+    const ProfileTimer& timer = integrator->getProfileTimer();
+    integrator_time = timer.getTotalTime();
+    n_steps = timer.getNumCalls();
+    comm_time = m_comm->getMigrateProfileTimer().getTotalTime()
+                + m_comm->getGhostExchangeProfileTimer().getTotalTime()
+                + m_comm->getGhostUpdateProfileTimer().getTotalTime();
+    return true;
+    }
+
+/*!
+ * The busy time of the rank is the time spent in the integrator minus the time spent in the
+ * communicator since the last balancing step. Ranks wait for their slower neighbors inside the
+ * communicator, so the busy time measures the work done by the rank. The measured cost factor is
+ * the busy time per unit of modeled cost, normalized by its mean over the ranks. The cost factor
+ * is the damped average of its previous value and the measured factor. Ranks that did no measured
+ * work (or whose timers were reset) keep their previous cost factor.
+ *
+ * \note All ranks must call updateCostFactor() since it performs a collective reduction.
+ */
+void LoadBalancer::updateCostFactor()
+    {
+    double integrator_time(0.0), comm_time(0.0);
+    uint64_t n_steps(0);
+    if (!readTimers(integrator_time, comm_time, n_steps) || !m_has_timer_sample
+        || n_steps <= m_last_n_steps)
+        return;
+
+    const double busy_time
+        = (integrator_time - m_last_integrator_time) - (comm_time - m_last_comm_time);
+    const Scalar model_cost = getModelCost();
+    Scalar factor(0.0);
+    if (busy_time > 0.0 && comm_time >= m_last_comm_time && model_cost > Scalar(0.0))
+        {
+        factor = Scalar(busy_time) / model_cost;
+        }
+
+    // sum of the measured factors and the number of ranks that measured one
+    Scalar sum[2] = {factor, factor > Scalar(0.0) ? Scalar(1.0) : Scalar(0.0)};
+    MPI_Allreduce(MPI_IN_PLACE, sum, 2, MPI_HOOMD_SCALAR, MPI_SUM, m_mpi_comm);
+
+    if (factor > Scalar(0.0))
+        {
+        const Scalar mean = sum[0] / sum[1];
+        m_cost_factor = m_damping * m_cost_factor + (Scalar(1.0) - m_damping) * factor / mean;
+        }
+    m_recompute_max_imbalance = true;
+    }
+
+/*!
+ * \param C_i Vector holding the total cost of each slice (will be allocated on call)
  * \param dim The dimension of the slices (x=0, y=1, z=2)
  * \param reduce_root The rank to perform the reduction on
- * \returns true if the current rank holds the active \a N_i
+ * \returns true if the current rank holds the active \a C_i
  *
- * \post \a N_i holds the number of particles in each slice along \a dim
+ * \post \a C_i holds the cost of each slice along \a dim
  *
  * \note reduce() relies on collective MPI calls, and so all ranks must call it. However, for
  * efficiency the data will be active only on Cartesian rank \a reduce_root, as indicated by the
- * return value. As a result, only \a reduce_root actually needs to allocate memory for \a N_i.
+ * return value. As a result, only \a reduce_root actually needs to allocate memory for \a C_i.
  *
  * The reduction is performed by performing an all-to-one gather, followed by summation on \a
  * reduce_root. This operation may be suboptimal for very large numbers of processors, and could be
  * replaced by cascading send operations down dimensions. Generally, load balancing should not be
  * performed too frequently, and so we do not pursue this optimization right now.
  */
-bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
-                          unsigned int dim,
-                          unsigned int reduce_root)
+bool LoadBalancer::reduce(std::vector<Scalar>& C_i, unsigned int dim, unsigned int reduce_root)
     {
     // do nothing if there is only one rank
-    if (N_i.size() == 1)
+    if (C_i.size() == 1)
         return false;
 
     const Index3D& di = m_decomposition->getDomainIndexer();
-    std::vector<unsigned int> N_per_rank(di.getNumElements());
+    std::vector<Scalar> C_per_rank(di.getNumElements());
 
-    // get the number of particles the current rank owns (the quantity to be reduced)
-    unsigned int N_own = getNOwn();
+    // get the cost of the current rank (the quantity to be reduced)
+    Scalar C_own = getCost();
 
-    MPI_Gather(&N_own, 1, MPI_UNSIGNED, &N_per_rank[0], 1, MPI_UNSIGNED, reduce_root, m_mpi_comm);
+    MPI_Gather(&C_own,
+               1,
+               MPI_HOOMD_SCALAR,
+               &C_per_rank[0],
+               1,
+               MPI_HOOMD_SCALAR,
+               reduce_root,
+               m_mpi_comm);
 
     // only the root rank performs the reduction
     if (m_exec_conf->getRank() != reduce_root)
@@ -245,57 +359,57 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
     ArrayHandle<unsigned int> h_cart_ranks_inv(m_decomposition->getInverseCartRanks(),
                                                access_location::host,
                                                access_mode::read);
-    std::vector<unsigned int> N_per_cart_rank(di.getNumElements());
+    std::vector<Scalar> C_per_cart_rank(di.getNumElements());
     for (unsigned int cur_rank = 0; cur_rank < di.getNumElements(); ++cur_rank)
         {
-        N_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = N_per_rank[cur_rank];
+        C_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = C_per_rank[cur_rank];
         }
 
     // perform the summation along dim in as cache friendly of a way as we can manage
     if (dim == 0) // to x
         {
-        N_i.clear();
-        N_i.resize(di.getW());
+        C_i.clear();
+        C_i.resize(di.getW());
         for (unsigned int i = 0; i < di.getW(); ++i)
             {
-            N_i[i] = 0;
+            C_i[i] = 0;
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int j = 0; j < di.getH(); ++j)
                     {
-                    N_i[i] += N_per_cart_rank[di(i, j, k)];
+                    C_i[i] += C_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 1) // to y
         {
-        N_i.clear();
-        N_i.resize(di.getH());
+        C_i.clear();
+        C_i.resize(di.getH());
         for (unsigned int j = 0; j < di.getH(); ++j)
             {
-            N_i[j] = 0;
+            C_i[j] = 0;
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[j] += N_per_cart_rank[di(i, j, k)];
+                    C_i[j] += C_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 2) // to z
         {
-        N_i.clear();
-        N_i.resize(di.getD());
+        C_i.clear();
+        C_i.resize(di.getD());
         for (unsigned int k = 0; k < di.getD(); ++k)
             {
-            N_i[k] = 0;
+            C_i[k] = 0;
             for (unsigned int j = 0; j < di.getH(); ++j)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[k] += N_per_cart_rank[di(i, j, k)];
+                    C_i[k] += C_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
@@ -310,7 +424,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
 
 /*!
  * \param cum_frac_i The cumulative fraction array to write output into
- * \param N_i The reduced number of particles along the dimension
+ * \param C_i The reduced cost along the dimension
  * \param L_i The global box length along the dimension
  * \param min_frac_i The minimum fractional width of a domain
  *
@@ -329,31 +443,33 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
  * minimization was successful, apply the adjustment to \a cum_frac_i.
  */
 bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
-                          const vector<unsigned int>& N_i,
+                          const vector<Scalar>& C_i,
                           Scalar L_i,
                           Scalar min_frac_i)
     {
-    if (N_i.size() == 1)
+    if (C_i.size() == 1)
         return false;
 
-    // target particles per rank is uniform distribution
-    const Scalar target = Scalar(m_pdata->getNGlobal()) / Scalar(N_i.size());
+    // target cost per slice is the average
+    const Scalar target = std::accumulate(C_i.begin(), C_i.end(), Scalar(0.0)) / Scalar(C_i.size());
+    if (!(target > Scalar(0.0)))
+        return false;
 
     // make the minimum domain slightly bigger so that the optimization won't fail at equality
     const Scalar min_domain_size = Scalar(1.00001) * min_frac_i * L_i;
     // if system is overconstrained (exactly decomposed) don't do any adjusting
-    if (min_domain_size * Scalar(N_i.size()) >= L_i)
+    if (min_domain_size * Scalar(C_i.size()) >= L_i)
         {
         return false;
         }
 
     // imbalance factors for each rank
-    vector<Scalar> new_widths(N_i.size());
-    for (unsigned int i = 0; i < N_i.size(); ++i)
+    vector<Scalar> new_widths(C_i.size());
+    for (unsigned int i = 0; i < C_i.size(); ++i)
         {
-        const Scalar imb_factor = Scalar(N_i[i]) / target;
+        const Scalar imb_factor = Scalar(C_i[i]) / target;
         Scalar scale_factor
-            = (N_i[i] > 0)
+            = (C_i[i] > 0)
                   ? Scalar(1.0) / imb_factor
                   : (Scalar(1.0)
                      + m_max_scale); // as in gromacs, use half the imbalance factor to scale
@@ -378,7 +494,7 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     // setup the augmented A matrix, with scale factor eps for the actual least squares part (to
     // enforce the inequality constraints correctly)
     const Scalar eps(0.001);
-    unsigned int m = (unsigned int)N_i.size();
+    unsigned int m = (unsigned int)C_i.size();
     unsigned int n = m - 1;
     Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2 * m, n + m);
     A(0, 0) = 1.0;
@@ -458,22 +574,27 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     }
 
 /*!
- * \param cnts Map holding result of number of particles on each rank that neighbors the local rank
+ * \param cnts Map holding the number of particles on each rank that neighbors the local rank
+ * \param pos Particle positions
+ * \param N Number of particles
+ * \param box Local box
+ * \param di Domain indexer
+ * \param rank_pos Position of the local rank in the processor grid
+ * \param cart_ranks Map from Cartesian index to rank
+ *
+ * Each particle outside the local box is counted towards the neighboring rank it has moved into.
  */
-void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts)
+static void countOffRank(std::map<unsigned int, unsigned int>& cnts,
+                         const Scalar4* pos,
+                         unsigned int N,
+                         const BoxDim& box,
+                         const Index3D& di,
+                         const uint3& rank_pos,
+                         const unsigned int* cart_ranks)
     {
-    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
-                                           access_location::host,
-                                           access_mode::read);
-
-    const BoxDim& box = m_pdata->getBox();
-    const Index3D& di = m_decomposition->getDomainIndexer();
-    const uint3 rank_pos = m_decomposition->getGridPos();
-
-    for (unsigned int cur_p = 0; cur_p < m_pdata->getN(); ++cur_p)
+    for (unsigned int cur_p = 0; cur_p < N; ++cur_p)
         {
-        const Scalar4 cur_postype = h_pos.data[cur_p];
+        const Scalar4 cur_postype = pos[cur_p];
         const Scalar3 cur_pos = make_scalar3(cur_postype.x, cur_postype.y, cur_postype.z);
         const Scalar3 f = box.makeFraction(cur_pos);
 
@@ -530,12 +651,59 @@ void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& c
             else if (grid_pos.z < 0)
                 grid_pos.z += di.getD();
 
-            unsigned int cur_rank = h_cart_ranks.data[di(grid_pos.x, grid_pos.y, grid_pos.z)];
+            unsigned int cur_rank = cart_ranks[di(grid_pos.x, grid_pos.y, grid_pos.z)];
             cnts[cur_rank]++;
             }
         }
     }
 
+/*!
+ * \param cnts Map holding result of number of particles on each rank that neighbors the local rank
+ */
+void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                           access_location::host,
+                                           access_mode::read);
+
+    countOffRank(cnts,
+                 h_pos.data,
+                 m_pdata->getN(),
+                 m_pdata->getBox(),
+                 m_decomposition->getDomainIndexer(),
+                 m_decomposition->getGridPos(),
+                 h_cart_ranks.data);
+    }
+
+#ifdef BUILD_MPCD
+/*!
+ * \param cnts Map holding result of number of MPCD particles on each rank that neighbors the local
+ *             rank
+ */
+void LoadBalancer::countMPCDParticlesOffRank(std::map<unsigned int, unsigned int>& cnts)
+    {
+    auto mpcd_pdata = m_sysdef->getMPCDParticleData();
+    if (!mpcd_pdata)
+        return;
+
+    ArrayHandle<Scalar4> h_pos(mpcd_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::read);
+    ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                           access_location::host,
+                                           access_mode::read);
+
+    countOffRank(cnts,
+                 h_pos.data,
+                 mpcd_pdata->getN(),
+                 m_pdata->getBox(),
+                 m_decomposition->getDomainIndexer(),
+                 m_decomposition->getGridPos(),
+                 h_cart_ranks.data);
+    }
+#endif // BUILD_MPCD
+
 /*!
  * Each rank calls countParticlesOffRank() to count the number of particles to send to other ranks.
  * Neighboring ranks then perform send/receive calls, and count the new number of particles they own
@@ -557,33 +725,41 @@ void LoadBalancer::computeOwnedParticles()
 
     // fill the map initially to zeros (not necessary since should be auto-initialized to zero, but
     // just playing it safe)
-    std::map<unsigned int, unsigned int> cnts;
+    std::map<unsigned int, unsigned int> cnts, mpcd_cnts;
     for (unsigned int i = 0; i < m_comm->getNUniqueNeighbors(); ++i)
         {
         cnts[h_unique_neigh.data[i]] = 0;
+        mpcd_cnts[h_unique_neigh.data[i]] = 0;
         }
     countParticlesOffRank(cnts);
+#ifdef BUILD_MPCD
+    if (m_mpcd_weight > Scalar(0.0))
+        {
+        countMPCDParticlesOffRank(mpcd_cnts);
+        }
+#endif // BUILD_MPCD
 
     std::vector<MPI_Request> req(2 * m_comm->getNUniqueNeighbors());
     std::vector<MPI_Status> stat(2 * m_comm->getNUniqueNeighbors());
     unsigned int nreq = 0;
 
-    std::vector<unsigned int> n_send_ptls(m_comm->getNUniqueNeighbors());
-    std::vector<unsigned int> n_recv_ptls(m_comm->getNUniqueNeighbors());
+    // the MD and MPCD counts are sent together
+    std::vector<uint2> n_send_ptls(m_comm->getNUniqueNeighbors());
+    std::vector<uint2> n_recv_ptls(m_comm->getNUniqueNeighbors());
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         unsigned int neigh_rank = h_unique_neigh.data[cur_neigh];
-        n_send_ptls[cur_neigh] = cnts[neigh_rank];
+        n_send_ptls[cur_neigh] = make_uint2(cnts[neigh_rank], mpcd_cnts[neigh_rank]);
 
         MPI_Isend(&n_send_ptls[cur_neigh],
-                  1,
+                  2,
                   MPI_UNSIGNED,
                   neigh_rank,
                   0,
                   m_mpi_comm,
                   &req[nreq++]);
         MPI_Irecv(&n_recv_ptls[cur_neigh],
-                  1,
+                  2,
                   MPI_UNSIGNED,
                   neigh_rank,
                   0,
@@ -594,18 +770,58 @@ void LoadBalancer::computeOwnedParticles()
 
     // reduce the particles sent to me
     int N_own = m_pdata->getN();
+    int N_mpcd_own = getNMPCDLocal();
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
-        N_own += n_recv_ptls[cur_neigh];
-        N_own -= n_send_ptls[cur_neigh];
+        N_own += n_recv_ptls[cur_neigh].x;
+        N_own -= n_send_ptls[cur_neigh].x;
+        N_mpcd_own += n_recv_ptls[cur_neigh].y;
+        N_mpcd_own -= n_send_ptls[cur_neigh].y;
         }
 
     // set the count
     resetNOwn(N_own);
+    m_N_mpcd_own = N_mpcd_own;
     }
 
 #endif // ENABLE_MPI
 
+/*!
+ * \returns Total cost of the system, which does not change when the domains are adjusted
+ */
+Scalar LoadBalancer::getTotalCost() const
+    {
+    Scalar cost = m_md_weight * Scalar(m_pdata->getNGlobal());
+#ifdef BUILD_MPCD
+    auto mpcd_pdata = m_sysdef->getMPCDParticleData();
+    if (mpcd_pdata && m_mpcd_weight > Scalar(0.0))
+        {
+        cost += m_mpcd_weight * Scalar(mpcd_pdata->getNGlobal());
+        }
+#endif // BUILD_MPCD
+    if (m_volume_weight > Scalar(0.0))
+        {
+        cost += m_volume_weight
+                * m_pdata->getGlobalBox().getVolume(m_sysdef->getNDimensions() == 2);
+        }
+    return cost;
+    }
+
+/*!
+ * \returns Number of MPCD particles on the rank, or 0 if there are none
+ */
+unsigned int LoadBalancer::getNMPCDLocal() const
+    {
+#ifdef BUILD_MPCD
+    auto mpcd_pdata = m_sysdef->getMPCDParticleData();
+    if (mpcd_pdata)
+        {
+        return mpcd_pdata->getN();
+        }
+#endif // BUILD_MPCD
+    return 0;
+    }
+
 /*!
  * Zero the counters.
  */
@@ -628,7 +844,19 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("md_particle_weight",
+                      &LoadBalancer::getMDParticleWeight,
+                      &LoadBalancer::setMDParticleWeight)
+        .def_property("mpcd_particle_weight",
+                      &LoadBalancer::getMPCDParticleWeight,
+                      &LoadBalancer::setMPCDParticleWeight)
+        .def_property("volume_weight",
+                      &LoadBalancer::getVolumeWeight,
+                      &LoadBalancer::setVolumeWeight)
+        .def_property("timing", &LoadBalancer::getTiming, &LoadBalancer::setTiming)
+        .def_property("damping", &LoadBalancer::getDamping, &LoadBalancer::setDamping)
+        .def("setSystem", &LoadBalancer::setSystem);
     }
 
     } // end namespace detail
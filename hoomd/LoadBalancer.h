@@ -16,16 +16,29 @@
 #include <map>
 #include <memory>
 #include <pybind11/pybind11.h>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace hoomd
     {
+class System;
+
 //! Updates domain decompositions to balance the load
 /*!
  * Adjusts the boundaries of the processor domains to distribute the load close to evenly between
- * them. The load imbalance is defined as the number of particles owned by a rank divided by the
- * average number of particles per rank if the particles had a uniform distribution.
+ * them. The load imbalance is defined as the cost of a rank divided by the average cost per rank.
+ * The cost of a rank is a weighted sum of the number of MD particles it owns, the number of MPCD
+ * particles it owns, and the volume of its domain. By default, only the MD particles are counted.
+ * The volume term models work that scales with the domain size rather than the particles, such as
+ * the MPCD collision cells.
+ *
+ * When timing is enabled and profiling is active, the cost of each rank is also scaled by a factor
+ * measured from the time the rank spends in the integrator, excluding the time in the
+ * communicator (which includes waiting for the slower neighbors). The factor is the busy time per
+ * unit of the modeled cost, normalized by its mean over the ranks and averaged with its previous
+ * value by the damping to avoid oscillations. This captures costs that the particle counts do not
+ * model, such as density-dependent neighbor counts.
  *
  * At each load balancing step, we attempt to rescale the domain size by the inverse of the load
  * balance, subject to the following constraints that are imposed to both maintain a stable
@@ -136,6 +149,89 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_enable_z;
         }
 
+    /// Get the cost of an MD particle
+    Scalar getMDParticleWeight() const
+        {
+        return m_md_weight;
+        }
+
+    /// Set the cost of an MD particle
+    void setMDParticleWeight(Scalar weight)
+        {
+        checkWeight(weight);
+        m_md_weight = weight;
+        m_recompute_max_imbalance = true;
+        }
+
+    /// Get the cost of an MPCD particle
+    Scalar getMPCDParticleWeight() const
+        {
+        return m_mpcd_weight;
+        }
+
+    /// Set the cost of an MPCD particle
+    void setMPCDParticleWeight(Scalar weight)
+        {
+        checkWeight(weight);
+        m_mpcd_weight = weight;
+        m_recompute_max_imbalance = true;
+        m_needs_recount = true;
+        }
+
+    /// Get the cost per unit volume of a domain
+    Scalar getVolumeWeight() const
+        {
+        return m_volume_weight;
+        }
+
+    /// Set the cost per unit volume of a domain
+    void setVolumeWeight(Scalar weight)
+        {
+        checkWeight(weight);
+        m_volume_weight = weight;
+        m_recompute_max_imbalance = true;
+        }
+
+    /// Get whether the cost is scaled by the measured time
+    bool getTiming() const
+        {
+        return m_timing;
+        }
+
+    /// Set whether the cost is scaled by the measured time
+    void setTiming(bool timing)
+        {
+        m_timing = timing;
+        m_cost_factor = Scalar(1.0);
+        m_has_timer_sample = false;
+        m_recompute_max_imbalance = true;
+        }
+
+    /// Get the damping of the measured cost factor
+    Scalar getDamping() const
+        {
+        return m_damping;
+        }
+
+    /// Set the damping of the measured cost factor
+    /*!
+     * \param damping Weight of the previous cost factor in the average with the new measurement
+     */
+    void setDamping(Scalar damping)
+        {
+        if (!(damping >= Scalar(0.0) && damping < Scalar(1.0)))
+            {
+            throw std::domain_error("LoadBalancer: damping must be in [0, 1)");
+            }
+        m_damping = damping;
+        }
+
+    /// Set the System whose integrator is timed
+    void setSystem(std::shared_ptr<System> system)
+        {
+        m_system = system;
+        }
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
@@ -155,8 +251,8 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Computes the maximum imbalance factor
     Scalar getMaxImbalance();
 
-    //! Reduce the particle numbers per rank down to one dimension
-    bool reduce(std::vector<unsigned int>& N_i, unsigned int dim, unsigned int reduce_root);
+    //! Reduce the costs per rank down to one dimension
+    bool reduce(std::vector<Scalar>& C_i, unsigned int dim, unsigned int reduce_root);
 
     //! Set flags within the class that a resize has been performed
     void signalResize()
@@ -168,7 +264,7 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     //! Adjust the partitioning along a single dimension
     bool adjust(std::vector<Scalar>& cum_frac_i,
-                const std::vector<unsigned int>& N_i,
+                const std::vector<Scalar>& C_i,
                 Scalar L_i,
                 Scalar min_domain_frac);
 
@@ -178,6 +274,11 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Count the number of particles that have gone off the rank
     virtual void countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts);
 
+#ifdef BUILD_MPCD
+    //! Count the number of MPCD particles that have gone off the rank
+    void countMPCDParticlesOffRank(std::map<unsigned int, unsigned int>& cnts);
+#endif // BUILD_MPCD
+
     //! Gets the number of owned particles, updating if necessary
     unsigned int getNOwn()
         {
@@ -188,15 +289,49 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Force a reset of the number of owned particles without counting
     /*!
      * \param N number of particles owned by the rank
+     *
+     * The number of owned MPCD particles is reset to the number on the rank, which is only correct
+     * if the MPCD particles have been migrated since the last adjustment.
      */
     void resetNOwn(unsigned int N)
         {
         m_N_own = N;
+        m_N_mpcd_own = getNMPCDLocal();
         m_recompute_max_imbalance = true;
         m_needs_recount = false;
         }
+
+    //! Get the modeled cost of the rank, updating the number of owned particles if necessary
+    Scalar getModelCost();
+
+    //! Get the cost of the rank, scaled by the measured cost factor
+    Scalar getCost()
+        {
+        return m_cost_factor * getModelCost();
+        }
+
+    //! Read the cumulative integrator and communicator timers
+    bool readTimers(double& integrator_time, double& comm_time, uint64_t& n_steps);
+
+    //! Update the cost factor from the time measured since the last balancing step
+    void updateCostFactor();
 #endif // ENABLE_MPI
 
+    //! Get the total cost of all ranks
+    Scalar getTotalCost() const;
+
+    //! Get the number of MPCD particles on the rank
+    unsigned int getNMPCDLocal() const;
+
+    //! Check that a cost weight is valid
+    static void checkWeight(Scalar weight)
+        {
+        if (weight < Scalar(0.0))
+            {
+            throw std::domain_error("LoadBalancer: weights must be nonnegative");
+            }
+        }
+
     Scalar m_max_imbalance;         //!< Maximum imbalance
     bool m_recompute_max_imbalance; //!< Flag if maximum imbalance needs to be computed
 
@@ -211,8 +346,23 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     const Scalar m_max_scale; //!< Maximum fraction to rescale either direction (5%)
 
+    Scalar m_md_weight;     //!< Cost of an MD particle
+    Scalar m_mpcd_weight;   //!< Cost of an MPCD particle
+    Scalar m_volume_weight; //!< Cost per unit volume of a domain
+
+    bool m_timing;                  //!< Flag to scale the cost by the measured time
+    Scalar m_damping;               //!< Weight of the previous cost factor in the average
+    Scalar m_cost_factor;           //!< Measured cost per unit of modeled cost
+    std::weak_ptr<System> m_system; //!< System whose integrator is timed
+
     private:
-    unsigned int m_N_own; //!< Number of particles owned by this rank
+    unsigned int m_N_own;      //!< Number of particles owned by this rank
+    unsigned int m_N_mpcd_own; //!< Number of MPCD particles owned by this rank
+
+    bool m_has_timer_sample;       //!< Flag if the timers were read at the last balancing step
+    double m_last_integrator_time; //!< Integrator time at the last balancing step
+    double m_last_comm_time;       //!< Communicator time at the last balancing step
+    uint64_t m_last_n_steps;       //!< Number of integrator calls at the last balancing step
 
     Scalar m_max_max_imbalance;   //!< The maximum imbalance of any check
     double m_total_max_imbalance; //!< The average imbalance over checks
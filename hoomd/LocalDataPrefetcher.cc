@@ -0,0 +1,341 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file LocalDataPrefetcher.cc
+    \brief Defines the LocalDataPrefetcher class
+*/
+
+#include "LocalDataPrefetcher.h"
+
+#include <pybind11/stl.h>
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace detail
+    {
+//! Names of the quantities
+static const char* prefetch_quantity_names[]
+    = {"position", "typeid", "velocity", "mass", "orientation", "image", "tag", "net_force"};
+
+//! Source array of each quantity
+static const unsigned int prefetch_quantity_source[]
+    = {LocalDataPrefetcher::source_position,
+       LocalDataPrefetcher::source_position,
+       LocalDataPrefetcher::source_velocity,
+       LocalDataPrefetcher::source_velocity,
+       LocalDataPrefetcher::source_orientation,
+       LocalDataPrefetcher::source_image,
+       LocalDataPrefetcher::source_tag,
+       LocalDataPrefetcher::source_net_force};
+
+static const unsigned int prefetch_n_quantities = 8;
+
+//! Copy the x, y, z components of Scalar4 values into a N by 3 numpy array
+static pybind11::array_t<Scalar> prefetch_xyz(const char* data, size_t N)
+    {
+    const Scalar4* values = reinterpret_cast<const Scalar4*>(data);
+    pybind11::array_t<Scalar> result({N, size_t(3)});
+    Scalar* out = result.mutable_data();
+    for (size_t i = 0; i < N; i++)
+        {
+        out[3 * i] = values[i].x;
+        out[3 * i + 1] = values[i].y;
+        out[3 * i + 2] = values[i].z;
+        }
+    return result;
+    }
+    } // end namespace detail
+
+/*! \param sysdef System definition
+    \param trigger Trigger selecting the timesteps to prefetch
+    \param quantities Names of the quantities to prefetch
+*/
+LocalDataPrefetcher::LocalDataPrefetcher(std::shared_ptr<SystemDefinition> sysdef,
+                                         std::shared_ptr<Trigger> trigger,
+                                         const std::vector<std::string>& quantities)
+    : Analyzer(sysdef, trigger)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing LocalDataPrefetcher" << endl;
+
+    for (const auto& quantity : quantities)
+        {
+        unsigned int i = 0;
+        while (i < detail::prefetch_n_quantities && quantity != detail::prefetch_quantity_names[i])
+            i++;
+
+        if (i == detail::prefetch_n_quantities)
+            {
+            throw std::invalid_argument("Unknown prefetch quantity: " + quantity);
+            }
+
+        m_quantities.push_back(i);
+        m_buffers[detail::prefetch_quantity_source[i]].active = true;
+        }
+
+    if (m_quantities.empty())
+        {
+        throw std::invalid_argument("LocalDataPrefetcher requires at least one quantity");
+        }
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipEventCreateWithFlags(&m_event, hipEventDisableTiming);
+        }
+#endif
+    }
+
+LocalDataPrefetcher::~LocalDataPrefetcher()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying LocalDataPrefetcher" << endl;
+
+    waitForCopy();
+
+    for (auto& buffer : m_buffers)
+        {
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled())
+            {
+            hipHostFree(buffer.data);
+            continue;
+            }
+#endif
+        delete[] buffer.data;
+        }
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipEventDestroy(m_event);
+        }
+#endif
+    }
+
+/*! The copies of the previous frame are complete when this method starts the next one, since the
+    buffers are reused.
+
+    \param timestep Current time step of the simulation
+*/
+void LocalDataPrefetcher::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    waitForCopy();
+
+    m_N = m_pdata->getN();
+    if (m_buffers[source_position].active)
+        copyArray(m_pdata->getPositions(), m_buffers[source_position]);
+    if (m_buffers[source_velocity].active)
+        copyArray(m_pdata->getVelocities(), m_buffers[source_velocity]);
+    if (m_buffers[source_orientation].active)
+        copyArray(m_pdata->getOrientationArray(), m_buffers[source_orientation]);
+    if (m_buffers[source_image].active)
+        copyArray(m_pdata->getImages(), m_buffers[source_image]);
+    if (m_buffers[source_tag].active)
+        copyArray(m_pdata->getTags(), m_buffers[source_tag]);
+    if (m_buffers[source_net_force].active)
+        copyArray(m_pdata->getNetForce(), m_buffers[source_net_force]);
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipEventRecord(m_event, 0);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+#endif
+
+    m_timestep = timestep;
+    m_n_frames++;
+    }
+
+std::vector<std::string> LocalDataPrefetcher::getQuantities()
+    {
+    std::vector<std::string> result;
+    for (unsigned int i : m_quantities)
+        {
+        result.push_back(detail::prefetch_quantity_names[i]);
+        }
+    return result;
+    }
+
+/*! \returns true when read() will not wait for the copies of the last frame
+ */
+bool LocalDataPrefetcher::isReady()
+    {
+    if (m_n_frames == 0)
+        return false;
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        if (hipEventQuery(m_event) == hipSuccess)
+            return true;
+
+        // clear the not ready status so that it is not reported by the next error check
+        hipGetLastError();
+        return false;
+        }
+#endif
+
+    return true;
+    }
+
+/*! \returns None before the first frame, otherwise a dict with the timestep of the last frame and
+    one numpy array per quantity with a row for each local particle
+*/
+pybind11::object LocalDataPrefetcher::read()
+    {
+    if (m_n_frames == 0)
+        return pybind11::none();
+
+    waitForCopy();
+
+    const size_t N = m_N;
+    pybind11::dict frame;
+    frame["timestep"] = m_timestep;
+    for (unsigned int i : m_quantities)
+        {
+        const char* data = m_buffers[detail::prefetch_quantity_source[i]].data;
+        const std::string name = detail::prefetch_quantity_names[i];
+        if (name == "position" || name == "velocity" || name == "net_force")
+            {
+            frame[name.c_str()] = detail::prefetch_xyz(data, N);
+            }
+        else if (name == "typeid" || name == "mass")
+            {
+            const Scalar4* values = reinterpret_cast<const Scalar4*>(data);
+            if (name == "typeid")
+                {
+                pybind11::array_t<unsigned int> result(N);
+                unsigned int* out = result.mutable_data();
+                for (size_t j = 0; j < N; j++)
+                    out[j] = __scalar_as_int(values[j].w);
+                frame[name.c_str()] = result;
+                }
+            else
+                {
+                pybind11::array_t<Scalar> result(N);
+                Scalar* out = result.mutable_data();
+                for (size_t j = 0; j < N; j++)
+                    out[j] = values[j].w;
+                frame[name.c_str()] = result;
+                }
+            }
+        else if (name == "orientation")
+            {
+            pybind11::array_t<Scalar> result({N, size_t(4)});
+            if (N > 0)
+                memcpy(result.mutable_data(), data, sizeof(Scalar4) * N);
+            frame[name.c_str()] = result;
+            }
+        else if (name == "image")
+            {
+            pybind11::array_t<int> result({N, size_t(3)});
+            if (N > 0)
+                memcpy(result.mutable_data(), data, sizeof(int3) * N);
+            frame[name.c_str()] = result;
+            }
+        else
+            {
+            pybind11::array_t<unsigned int> result(N);
+            if (N > 0)
+                memcpy(result.mutable_data(), data, sizeof(unsigned int) * N);
+            frame[name.c_str()] = result;
+            }
+        }
+
+    return frame;
+    }
+
+void LocalDataPrefetcher::waitForCopy()
+    {
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled() && m_n_frames > 0)
+        {
+        hipEventSynchronize(m_event);
+        }
+#endif
+    }
+
+/*! The buffer grows by an extra 1/8 so that the small changes of the number of local particles
+    on MPI runs do not reallocate the page-locked memory at every frame.
+
+    \param buffer Buffer to resize
+    \param bytes Number of bytes needed
+*/
+void LocalDataPrefetcher::reserve(HostBuffer& buffer, size_t bytes)
+    {
+    if (bytes <= buffer.capacity)
+        return;
+
+    const size_t capacity = bytes + bytes / 8;
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipHostFree(buffer.data);
+        void* data = nullptr;
+        if (hipHostMalloc(&data, capacity, hipHostMallocDefault) != hipSuccess)
+            {
+            throw std::runtime_error("Error allocating page-locked memory for LocalDataPrefetcher");
+            }
+        buffer.data = static_cast<char*>(data);
+        buffer.capacity = capacity;
+        return;
+        }
+#endif
+
+    delete[] buffer.data;
+    buffer.data = new char[capacity];
+    buffer.capacity = capacity;
+    }
+
+/*! \param array Array of the local particle data
+    \param buffer Host buffer to copy the first m_N elements into
+*/
+template<class T>
+void LocalDataPrefetcher::copyArray(const GPUArray<T>& array, HostBuffer& buffer)
+    {
+    const size_t bytes = sizeof(T) * m_N;
+    reserve(buffer, bytes);
+    if (bytes == 0)
+        return;
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        // the copy on the default stream is ordered after the kernels of this step and before
+        // those that modify the array in the next step
+        ArrayHandle<T> d_array(array, access_location::device, access_mode::read);
+        hipMemcpyAsync(buffer.data, d_array.data, bytes, hipMemcpyDeviceToHost, 0);
+        return;
+        }
+#endif
+
+    ArrayHandle<T> h_array(array, access_location::host, access_mode::read);
+    memcpy(buffer.data, h_array.data, bytes);
+    }
+
+namespace detail
+    {
+void export_LocalDataPrefetcher(pybind11::module& m)
+    {
+    pybind11::class_<LocalDataPrefetcher, Analyzer, std::shared_ptr<LocalDataPrefetcher>>(
+        m,
+        "LocalDataPrefetcher")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::vector<std::string>>())
+        .def("read", &LocalDataPrefetcher::read)
+        .def_property_readonly("quantities", &LocalDataPrefetcher::getQuantities)
+        .def_property_readonly("ready", &LocalDataPrefetcher::isReady)
+        .def_property_readonly("num_frames", &LocalDataPrefetcher::getNumFrames);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __LOCAL_DATA_PREFETCHER_H__
+#define __LOCAL_DATA_PREFETCHER_H__
+
+#include "Analyzer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*! \file LocalDataPrefetcher.h
+    \brief Declares the LocalDataPrefetcher class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Copy selected local particle arrays to host buffers without stalling the simulation
+/*! On each triggered timestep, LocalDataPrefetcher starts a copy of the selected arrays of the
+    local particles into page-locked host buffers and returns. On the GPU, the copies are queued on
+    the default stream after the kernels of the step, so the host does not wait for them and the
+    following kernels are ordered after them. read() waits for the last copy (which has typically
+    completed long before) and converts the buffers to numpy arrays. On the CPU, the copies are
+    made in analyze().
+
+    Several quantities share one source array (e.g. position and typeid are both read from the
+    positions). Each source array is copied once per frame.
+
+    The frame holds the local particles in their current order, as the local snapshots do, so the
+    tag quantity is needed to identify the particles across frames and ranks.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT LocalDataPrefetcher : public Analyzer
+    {
+    public:
+    //! Construct the prefetcher
+    LocalDataPrefetcher(std::shared_ptr<SystemDefinition> sysdef,
+                        std::shared_ptr<Trigger> trigger,
+                        const std::vector<std::string>& quantities);
+
+    //! Destructor
+    virtual ~LocalDataPrefetcher();
+
+    //! Start the copy of the current frame
+    virtual void analyze(uint64_t timestep);
+
+    //! Get the prefetched quantities
+    std::vector<std::string> getQuantities();
+
+    /// Get the number of frames started
+    uint64_t getNumFrames()
+        {
+        return m_n_frames;
+        }
+
+    //! Test whether the copy of the last frame has completed
+    bool isReady();
+
+    //! Wait for the last frame and convert it to a dict of numpy arrays
+    pybind11::object read();
+
+    /// Source arrays of the quantities
+    enum source
+        {
+        source_position = 0,
+        source_velocity,
+        source_orientation,
+        source_image,
+        source_tag,
+        source_net_force,
+        n_sources
+        };
+
+    protected:
+    //! Page-locked (on the GPU) host copy of one source array
+    struct HostBuffer
+        {
+        char* data = nullptr; //!< Host memory
+        size_t capacity = 0;  //!< Allocated size (bytes)
+        bool active = false;  //!< True when a quantity reads the source
+        };
+
+    std::vector<unsigned int> m_quantities; //!< Indices of the prefetched quantities
+    HostBuffer m_buffers[n_sources];        //!< Host copies of the source arrays
+    uint64_t m_n_frames = 0;                //!< Number of frames started
+    uint64_t m_timestep = 0;                //!< Timestep of the last frame
+    size_t m_N = 0;                         //!< Number of local particles in the last frame
+
+#ifdef ENABLE_HIP
+    hipEvent_t m_event; //!< Recorded after the copies of the last frame
+#endif
+
+    //! Wait for the copies of the last frame to complete
+    void waitForCopy();
+
+    //! Ensure that a buffer holds at least the given number of bytes
+    void reserve(HostBuffer& buffer, size_t bytes);
+
+    //! Queue the copy of a source array into its buffer
+    template<class T> void copyArray(const GPUArray<T>& array, HostBuffer& buffer);
+    };
+
+namespace detail
+    {
+//! Exports the LocalDataPrefetcher class to python
+void export_LocalDataPrefetcher(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+#endif
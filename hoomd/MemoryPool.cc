@@ -0,0 +1,250 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryPool.cc
+    \brief Defines the MemoryPool class
+*/
+
+#include "MemoryPool.h"
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+#include <new>
+#include <stdexcept>
+#include <stdlib.h>
+
+namespace hoomd
+    {
+MemoryPool::MemoryPool(size_t max_cached_bytes) : m_max_cached_bytes(max_cached_bytes) { }
+
+MemoryPool::~MemoryPool()
+    {
+    releaseCacheLocked();
+    }
+
+/*! \param bytes Requested size
+
+    Requests up to 256 bytes share one size class. Larger requests are rounded up to a multiple of
+    one quarter of the largest power of two smaller than the request.
+
+    \returns The size of the block that serves the request
+*/
+size_t MemoryPool::getBlockSize(size_t bytes)
+    {
+    const size_t min_block_size = 256;
+    if (bytes <= min_block_size)
+        {
+        return min_block_size;
+        }
+
+    unsigned int shift = 0;
+    for (size_t v = bytes - 1; v > 1; v >>= 1)
+        {
+        shift++;
+        }
+
+    size_t step = size_t(1) << (shift - 2);
+    return (bytes + step - 1) / step * step;
+    }
+
+/*! \param kind Kind of memory to allocate
+    \param bytes Requested size
+
+    Host blocks are aligned to 32 bytes (for AVX). The block contents are undefined.
+
+    \returns A pointer to a block of getBlockSize(bytes) bytes
+*/
+void* MemoryPool::allocate(Kind kind, size_t bytes)
+    {
+    size_t block_size = getBlockSize(bytes);
+
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_free_blocks[kind].find(block_size);
+        if (it != m_free_blocks[kind].end() && !it->second.empty())
+            {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            m_cached_bytes -= block_size;
+            m_kind_bytes[kind] -= block_size;
+            m_hits[kind]++;
+            return ptr;
+            }
+
+        m_misses[kind]++;
+        }
+
+    try
+        {
+        return allocateBlock(kind, block_size);
+        }
+    catch (const std::bad_alloc&)
+        {
+        // cached blocks of other sizes may be holding the memory we need
+        releaseCache();
+        return allocateBlock(kind, block_size);
+        }
+    }
+
+void MemoryPool::deallocate(Kind kind, void* ptr, size_t bytes)
+    {
+    if (ptr == nullptr)
+        {
+        return;
+        }
+
+    size_t block_size = getBlockSize(bytes);
+
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_cached_bytes + block_size <= m_max_cached_bytes)
+            {
+            m_free_blocks[kind][block_size].push_back(ptr);
+            m_cached_bytes += block_size;
+            m_kind_bytes[kind] += block_size;
+            return;
+            }
+        }
+
+    freeBlock(kind, ptr);
+    }
+
+void MemoryPool::releaseCache()
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    releaseCacheLocked();
+    }
+
+void MemoryPool::releaseCacheLocked()
+    {
+    for (unsigned int kind = 0; kind < n_kinds; kind++)
+        {
+        for (auto& size_and_blocks : m_free_blocks[kind])
+            {
+            for (void* ptr : size_and_blocks.second)
+                {
+                freeBlock(Kind(kind), ptr);
+                }
+            }
+        m_free_blocks[kind].clear();
+        m_kind_bytes[kind] = 0;
+        }
+    m_cached_bytes = 0;
+    }
+
+/*! \param max_cached_bytes Maximum number of bytes held in free blocks
+
+    Cached blocks are released when the new limit is smaller than the current cache size.
+*/
+void MemoryPool::setMaxCachedBytes(size_t max_cached_bytes)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_max_cached_bytes = max_cached_bytes;
+    if (m_cached_bytes > m_max_cached_bytes)
+        {
+        releaseCacheLocked();
+        }
+    }
+
+MemoryPool::Statistics MemoryPool::getStatistics() const
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics stats;
+    for (unsigned int kind = 0; kind < n_kinds; kind++)
+        {
+        if (kind == device)
+            {
+            stats.device_hits += m_hits[kind];
+            stats.device_misses += m_misses[kind];
+            stats.device_cached_bytes += m_kind_bytes[kind];
+            }
+        else
+            {
+            stats.host_hits += m_hits[kind];
+            stats.host_misses += m_misses[kind];
+            stats.host_cached_bytes += m_kind_bytes[kind];
+            }
+        }
+    return stats;
+    }
+
+void MemoryPool::resetStatistics()
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (unsigned int kind = 0; kind < n_kinds; kind++)
+        {
+        m_hits[kind] = 0;
+        m_misses[kind] = 0;
+        }
+    }
+
+void* MemoryPool::allocateBlock(Kind kind, size_t block_size)
+    {
+    void* ptr = nullptr;
+
+    if (kind == device)
+        {
+#ifdef ENABLE_HIP
+        hipError_t error = hipMalloc(&ptr, block_size);
+        if (error == hipErrorMemoryAllocation)
+            {
+            throw std::bad_alloc();
+            }
+        else if (error != hipSuccess)
+            {
+            throw std::runtime_error(hipGetErrorString(error));
+            }
+        return ptr;
+#else
+        throw std::runtime_error("This build of HOOMD does not include GPU support.");
+#endif
+        }
+
+    // at minimum, alignment needs to be 32 bytes for AVX
+    int retval = posix_memalign(&ptr, 32, block_size);
+    if (retval != 0)
+        {
+        throw std::bad_alloc();
+        }
+
+#ifdef ENABLE_HIP
+    if (kind == host_registered || kind == host_mapped)
+        {
+        hipError_t error = hipHostRegister(ptr,
+                                           block_size,
+                                           kind == host_mapped ? hipHostRegisterMapped
+                                                               : hipHostRegisterDefault);
+        if (error != hipSuccess)
+            {
+            free(ptr);
+            throw std::runtime_error(hipGetErrorString(error));
+            }
+        }
+#endif
+
+    return ptr;
+    }
+
+void MemoryPool::freeBlock(Kind kind, void* ptr)
+    {
+    if (kind == device)
+        {
+#ifdef ENABLE_HIP
+        hipFree(ptr);
+#endif
+        return;
+        }
+
+#ifdef ENABLE_HIP
+    if (kind == host_registered || kind == host_mapped)
+        {
+        hipHostUnregister(ptr);
+        }
+#endif
+
+    free(ptr);
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,133 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryPool.h
+    \brief Declares the MemoryPool class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Recycles host and device blocks freed by GPUArray and GPUVector
+/*! Particle migration, ghost exchange, and particle insertion change the number of particles on a
+    rank from step to step. The GPUArray and GPUVector buffers in ParticleData, BondedGroupData, and
+    the neighbor lists grow and shrink with it. Without pooling, every reallocation calls
+    hipMalloc/hipFree (which synchronize the device) and hipHostRegister/hipHostUnregister (which
+    are expensive driver calls).
+
+    MemoryPool rounds every request up to a size class and keeps freed blocks in a free list per
+    size class and kind. A later request of the same kind and size class reuses a free block
+    (a hit) instead of calling the allocator (a miss). Size classes split each power of two into 4
+    steps, so a block is at most 25% larger than the request.
+
+    The pool holds at most getMaxCachedBytes() bytes of free blocks. Blocks that would exceed the
+    limit are freed immediately. Set the limit to 0 to disable pooling. When an allocation fails,
+    the pool frees all cached blocks and retries once.
+
+    Recycled device blocks may be handed out while kernels that used the previous owner are still
+    queued. This is safe because all GPUArray work is issued on the default stream.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT MemoryPool
+    {
+    public:
+    //! Kinds of memory managed by the pool
+    enum Kind
+        {
+        host,            //!< Aligned host memory
+        host_registered, //!< Aligned host memory registered with the driver for DMA
+        host_mapped,     //!< Aligned host memory registered and mapped into the device space
+        device,          //!< Device memory
+        n_kinds
+        };
+
+    //! Hit and miss counts of the pool
+    struct Statistics
+        {
+        uint64_t host_hits = 0;         //!< Host requests served from a free block
+        uint64_t host_misses = 0;       //!< Host requests that called the allocator
+        uint64_t device_hits = 0;       //!< Device requests served from a free block
+        uint64_t device_misses = 0;     //!< Device requests that called the allocator
+        size_t host_cached_bytes = 0;   //!< Bytes held in free host blocks
+        size_t device_cached_bytes = 0; //!< Bytes held in free device blocks
+        };
+
+    //! Construct an empty pool
+    /*! \param max_cached_bytes Maximum number of bytes held in free blocks
+     */
+    explicit MemoryPool(size_t max_cached_bytes);
+
+    //! Free all cached blocks
+    ~MemoryPool();
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    //! Get the size of the block that serves a request of the given size
+    static size_t getBlockSize(size_t bytes);
+
+    //! Allocate a block of at least \a bytes bytes
+    void* allocate(Kind kind, size_t bytes);
+
+    //! Return a block to the pool
+    /*! \param kind Kind given to allocate()
+        \param ptr Pointer returned by allocate()
+        \param bytes Size given to allocate()
+     */
+    void deallocate(Kind kind, void* ptr, size_t bytes);
+
+    //! Free all cached blocks
+    void releaseCache();
+
+    //! Set the maximum number of bytes held in free blocks
+    void setMaxCachedBytes(size_t max_cached_bytes);
+
+    //! Get the maximum number of bytes held in free blocks
+    size_t getMaxCachedBytes() const
+        {
+        return m_max_cached_bytes;
+        }
+
+    //! Get the hit and miss counts
+    Statistics getStatistics() const;
+
+    //! Reset the hit and miss counts
+    void resetStatistics();
+
+    private:
+    //! Call the underlying allocator
+    static void* allocateBlock(Kind kind, size_t block_size);
+
+    //! Call the underlying deallocator
+    static void freeBlock(Kind kind, void* ptr);
+
+    //! Free all cached blocks (the caller holds m_mutex)
+    void releaseCacheLocked();
+
+    mutable std::mutex m_mutex; //!< Protects the free lists and counters
+    size_t m_max_cached_bytes;  //!< Maximum number of bytes held in free blocks
+    size_t m_cached_bytes = 0;  //!< Number of bytes held in free blocks
+
+    /// Free blocks of each kind, by block size
+    std::unordered_map<size_t, std::vector<void*>> m_free_blocks[n_kinds];
+
+    uint64_t m_hits[n_kinds] = {};     //!< Hit counts by kind
+    uint64_t m_misses[n_kinds] = {};   //!< Miss counts by kind
+    size_t m_kind_bytes[n_kinds] = {}; //!< Cached bytes by kind
+    };
+
+    } // end namespace hoomd
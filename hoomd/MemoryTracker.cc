@@ -0,0 +1,105 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryTracker.cc
+    \brief Defines the MemoryTracker class
+*/
+
+#include "MemoryTracker.h"
+
+#include <stdexcept>
+
+namespace hoomd
+    {
+MemoryTracker::MemoryTracker()
+    {
+    m_entries.emplace_back();
+    m_entries.back().name = "other";
+    }
+
+/*! \param name Name of the owner
+    \returns The new tag
+*/
+unsigned int MemoryTracker::addTag(const std::string& name)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.emplace_back();
+    m_entries.back().name = name;
+    return (unsigned int)(m_entries.size() - 1);
+    }
+
+void MemoryTracker::push(unsigned int tag)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (tag >= m_entries.size())
+        {
+        throw std::out_of_range("Invalid memory tag.");
+        }
+    m_stack.push_back(tag);
+    }
+
+void MemoryTracker::pop()
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stack.empty())
+        {
+        throw std::runtime_error("Memory tag stack is empty.");
+        }
+    m_stack.pop_back();
+    }
+
+unsigned int MemoryTracker::getCurrentTag() const
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stack.empty())
+        {
+        return 0;
+        }
+    return m_stack.back();
+    }
+
+void MemoryTracker::allocated(unsigned int tag, Location location, size_t bytes)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries.at(tag);
+    if (location == host)
+        {
+        entry.host_bytes += bytes;
+        }
+    else
+        {
+        entry.device_bytes += bytes;
+        }
+    }
+
+void MemoryTracker::freed(unsigned int tag, Location location, size_t bytes)
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries.at(tag);
+    size_t& count = location == host ? entry.host_bytes : entry.device_bytes;
+    count = bytes > count ? 0 : count - bytes;
+    }
+
+size_t MemoryTracker::getBytes(unsigned int tag, Location location) const
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Entry& entry = m_entries.at(tag);
+    return location == host ? entry.host_bytes : entry.device_bytes;
+    }
+
+/*! \returns A map from owner name to the pair (host bytes, device bytes)
+ */
+std::map<std::string, std::pair<size_t, size_t>> MemoryTracker::getUsage() const
+    {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<std::string, std::pair<size_t, size_t>> usage;
+    for (const Entry& entry : m_entries)
+        {
+        auto& bytes = usage[entry.name];
+        bytes.first += entry.host_bytes;
+        bytes.second += entry.device_bytes;
+        }
+    return usage;
+    }
+
+    } // end namespace hoomd
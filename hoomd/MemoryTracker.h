@@ -0,0 +1,110 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryTracker.h
+    \brief Declares the MemoryTracker class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Accounts the host and device memory held by GPUArray and GPUVector allocations per owner
+/*! Owners are identified by integer tags created with addTag(). Tag 0 ("other") collects memory
+    allocated outside of any owner scope.
+
+    A GPUArray takes the tag that is current when it first allocates memory and keeps that tag when
+    it is resized. Arrays allocated with tag 0 adopt the current tag on their next allocation. Open
+    a Scope to make a tag current: Python opens one while it attaches an object, and System, forces,
+    and neighbor lists open one around each call into an Action.
+
+    Mapped host memory is counted as host memory only.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT MemoryTracker
+    {
+    public:
+    //! Memory locations
+    enum Location
+        {
+        host,  //!< Host memory
+        device //!< Device memory
+        };
+
+    //! Make a tag current for the lifetime of the scope
+    class Scope
+        {
+        public:
+        Scope(MemoryTracker& tracker, unsigned int tag) : m_tracker(tracker)
+            {
+            m_tracker.push(tag);
+            }
+
+        ~Scope()
+            {
+            m_tracker.pop();
+            }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        private:
+        MemoryTracker& m_tracker; //!< The tracker
+        };
+
+    //! Construct a tracker with only the "other" tag
+    MemoryTracker();
+
+    //! Create a new tag
+    unsigned int addTag(const std::string& name);
+
+    //! Make a tag current
+    void push(unsigned int tag);
+
+    //! Restore the tag that was current before the last push()
+    void pop();
+
+    //! Get the current tag
+    unsigned int getCurrentTag() const;
+
+    //! Record an allocation
+    void allocated(unsigned int tag, Location location, size_t bytes);
+
+    //! Record a deallocation
+    void freed(unsigned int tag, Location location, size_t bytes);
+
+    //! Get the number of bytes held by a tag
+    size_t getBytes(unsigned int tag, Location location) const;
+
+    //! Get the host and device bytes held by all tags, combining tags with the same name
+    std::map<std::string, std::pair<size_t, size_t>> getUsage() const;
+
+    private:
+    //! Bytes held by one tag
+    struct Entry
+        {
+        std::string name;        //!< Name of the owner
+        size_t host_bytes = 0;   //!< Host bytes held by the owner
+        size_t device_bytes = 0; //!< Device bytes held by the owner
+        };
+
+    mutable std::mutex m_mutex;        //!< Protects the entries and the stack
+    std::vector<Entry> m_entries;      //!< Entries, indexed by tag
+    std::vector<unsigned int> m_stack; //!< Stack of current tags
+    };
+
+    } // end namespace hoomd
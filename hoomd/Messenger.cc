@@ -373,8 +373,10 @@ void Messenger::openPython()
 void Messenger::reopenPythonIfNeeded()
     {
     // only attempt to reopen python streams if we previously opened them
-    // and python is initialized
-    if (m_python_open && Py_IsInitialized())
+    // and python is initialized. Reading sys requires the GIL: skip the check on threads that
+    // do not hold it (e.g. during System::run), a later message on a thread that does will
+    // pick up the change.
+    if (m_python_open && Py_IsInitialized() && PyGILState_Check())
         {
         // flush and reopen the streams if sys.stdout or sys.stderr change
         pybind11::object new_pystdout = m_sys.attr("stdout");
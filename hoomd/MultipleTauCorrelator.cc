@@ -0,0 +1,755 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MultipleTauCorrelator.cc
+    \brief Defines the MultipleTauCorrelator class
+*/
+
+#include "MultipleTauCorrelator.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to sample
+    \param group Group of particles to correlate
+    \param points Number of values stored in each level
+    \param averaging Number of values averaged when passing values to the next level
+    \param levels Number of levels
+    \param msd Set to true to accumulate the mean squared displacement
+    \param vacf Set to true to accumulate the velocity autocorrelation
+*/
+MultipleTauCorrelator::MultipleTauCorrelator(std::shared_ptr<SystemDefinition> sysdef,
+                                             std::shared_ptr<Trigger> trigger,
+                                             std::shared_ptr<ParticleGroup> group,
+                                             unsigned int points,
+                                             unsigned int averaging,
+                                             unsigned int levels,
+                                             bool msd,
+                                             bool vacf)
+    : Analyzer(sysdef, trigger), m_group(group), m_points(points), m_averaging(averaging),
+      m_levels(levels), m_compute_msd(msd), m_compute_vacf(vacf),
+      m_position_history(m_exec_conf), m_velocity_history(m_exec_conf),
+      m_velocity_sum(m_exec_conf)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MultipleTauCorrelator" << endl;
+
+    if (m_averaging < 2)
+        {
+        throw std::domain_error("averaging must be at least 2");
+        }
+    if (m_levels == 0)
+        {
+        throw std::domain_error("levels must be positive");
+        }
+    if (m_points < m_averaging || m_points % m_averaging != 0)
+        {
+        throw std::domain_error("points must be a positive multiple of averaging");
+        }
+    if (!m_compute_msd && !m_compute_vacf)
+        {
+        throw std::invalid_argument("Select at least one of msd and vacf");
+        }
+
+    GPUArray<double> msd_sum(getNumLags(), m_exec_conf);
+    m_msd_sum.swap(msd_sum);
+    GPUArray<double> vacf_sum(getNumLags(), m_exec_conf);
+    m_vacf_sum.swap(vacf_sum);
+    GPUArray<uint2> level_state(m_levels, m_exec_conf);
+    m_level_state.swap(level_state);
+    GPUArray<unsigned int> slot_of_tag(m_pdata->getNGlobal(), m_exec_conf);
+    m_slot_of_tag.swap(slot_of_tag);
+
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .connect<MultipleTauCorrelator, &MultipleTauCorrelator::slotGlobalParticleNumberChange>(
+            this);
+
+    reset();
+    }
+
+MultipleTauCorrelator::~MultipleTauCorrelator()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MultipleTauCorrelator" << endl;
+
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .disconnect<MultipleTauCorrelator, &MultipleTauCorrelator::slotGlobalParticleNumberChange>(
+            this);
+    }
+
+/*! Discard the histories and the accumulated sums. The next sample is the first time origin.
+ */
+void MultipleTauCorrelator::reset()
+    {
+    const unsigned int n_lags = getNumLags();
+
+    m_n_samples = 0;
+    m_n_inserted.assign(m_levels, 0);
+    m_n_accumulated.assign(m_levels, 0);
+    m_lag_count.assign(n_lags, 0);
+
+        {
+        ArrayHandle<double> h_msd_sum(m_msd_sum, access_location::host, access_mode::overwrite);
+        ArrayHandle<double> h_vacf_sum(m_vacf_sum, access_location::host, access_mode::overwrite);
+        memset(h_msd_sum.data, 0, sizeof(double) * n_lags);
+        memset(h_vacf_sum.data, 0, sizeof(double) * n_lags);
+        }
+
+    const unsigned int n_global = m_pdata->getNGlobal();
+    if (m_slot_of_tag.getNumElements() != n_global)
+        {
+        m_slot_of_tag.resize(n_global);
+        }
+
+        {
+        ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                access_location::host,
+                                                access_mode::overwrite);
+        std::fill(h_slot_of_tag.data, h_slot_of_tag.data + n_global, NO_SLOT);
+        }
+
+    m_tag_of_slot.clear();
+    m_free_slots.clear();
+    m_position_history.clear();
+    m_velocity_history.clear();
+    m_velocity_sum.clear();
+
+    m_n_group_global = m_group->getNumMembersGlobal();
+    m_particles_changed = false;
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Insert the current sample into level 0 and into each higher level that receives a value on
+    this sample, then correlate the inserted values with the stored ones.
+*/
+void MultipleTauCorrelator::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    if (m_particles_changed || m_group->getNumMembersGlobal() != m_n_group_global)
+        {
+        m_exec_conf->msg->notice(2)
+            << "MultipleTauCorrelator: The number of particles changed, resetting." << endl;
+        reset();
+        }
+
+    assignSlots();
+
+    // level k + 1 receives a value on every m_averaging-th insertion into level k
+    unsigned int n_insert = 1;
+    while (n_insert < m_levels && m_n_accumulated[n_insert - 1] + 1 == m_averaging)
+        {
+        n_insert++;
+        }
+
+        {
+        ArrayHandle<uint2> h_level_state(m_level_state,
+                                         access_location::host,
+                                         access_mode::overwrite);
+        for (unsigned int k = 0; k < n_insert; k++)
+            {
+            const unsigned int index = (unsigned int)(m_n_inserted[k] % m_points);
+            const unsigned int n_valid
+                = (unsigned int)std::min(m_n_inserted[k] + 1, uint64_t(m_points));
+            h_level_state.data[k] = make_uint2(index, n_valid);
+
+            const unsigned int j_min = (k == 0) ? 0 : m_points / m_averaging;
+            for (unsigned int j = j_min; j < n_valid; j++)
+                {
+                m_lag_count[lagIndex(k, j)]++;
+                }
+            }
+        }
+
+    updateHistories(n_insert);
+
+    for (unsigned int k = 0; k < n_insert; k++)
+        {
+        m_n_inserted[k]++;
+        m_n_accumulated[k] = (m_n_accumulated[k] + 1) % m_averaging;
+        }
+    m_n_samples++;
+    }
+
+/*! \param n_insert Number of levels that receive a value on this sample
+
+    Store the unwrapped positions and velocities of the local group members at the insertion index
+    of each level and add the products with the stored values to the sums at each lag.
+*/
+void MultipleTauCorrelator::updateHistories(unsigned int n_insert)
+    {
+    const unsigned int n_lags = getNumLags();
+    const unsigned int p = m_points;
+    const unsigned int j_min_upper = m_points / m_averaging;
+    const size_t row_size = rowSize();
+    const BoxDim box = m_pdata->getGlobalBox();
+
+    std::vector<double> msd(n_lags, 0.0);
+    std::vector<double> vacf(n_lags, 0.0);
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<unsigned int> h_index(m_group->getIndexArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<uint2> h_level_state(m_level_state, access_location::host, access_mode::read);
+        ArrayHandle<Scalar3> h_position_history(m_position_history,
+                                                access_location::host,
+                                                access_mode::readwrite);
+        ArrayHandle<Scalar3> h_velocity_history(m_velocity_history,
+                                                access_location::host,
+                                                access_mode::readwrite);
+        ArrayHandle<Scalar3> h_velocity_sum(m_velocity_sum,
+                                            access_location::host,
+                                            access_mode::readwrite);
+
+        const unsigned int group_size = m_group->getNumMembers();
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+            {
+            const unsigned int idx = h_index.data[group_idx];
+            const unsigned int slot = h_slot_of_tag.data[h_tag.data[idx]];
+
+            Scalar3 r = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
+            r = box.shift(r, h_image.data[idx]);
+            Scalar3 v = make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z);
+
+            for (unsigned int k = 0; k < n_insert; k++)
+                {
+                const uint2 state = h_level_state.data[k];
+                const unsigned int j_min = (k == 0) ? 0 : j_min_upper;
+                const size_t offset = slot * row_size + size_t(k) * p;
+
+                if (m_compute_msd)
+                    {
+                    Scalar3* history = h_position_history.data + offset;
+                    history[state.x] = r;
+                    for (unsigned int j = j_min; j < state.y; j++)
+                        {
+                        Scalar3 dr = r - history[(state.x + p - j) % p];
+                        msd[lagIndex(k, j)] += double(dot(dr, dr));
+                        }
+                    }
+
+                if (m_compute_vacf)
+                    {
+                    Scalar3* history = h_velocity_history.data + offset;
+                    history[state.x] = v;
+                    for (unsigned int j = j_min; j < state.y; j++)
+                        {
+                        vacf[lagIndex(k, j)] += double(dot(v, history[(state.x + p - j) % p]));
+                        }
+
+                    // the next level receives the mean of the values accumulated in this one
+                    Scalar3& sum = h_velocity_sum.data[size_t(slot) * m_levels + k];
+                    sum += v;
+                    if (k + 1 < n_insert)
+                        {
+                        v = sum / Scalar(m_averaging);
+                        sum = make_scalar3(0, 0, 0);
+                        }
+                    }
+                }
+            }
+        }
+
+    ArrayHandle<double> h_msd_sum(m_msd_sum, access_location::host, access_mode::readwrite);
+    ArrayHandle<double> h_vacf_sum(m_vacf_sum, access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < n_lags; i++)
+        {
+        h_msd_sum.data[i] += msd[i];
+        h_vacf_sum.data[i] += vacf[i];
+        }
+    }
+
+/*! \param tag Particle tag
+    \param h_slot_of_tag Host pointer to m_slot_of_tag
+    \returns The slot
+*/
+unsigned int MultipleTauCorrelator::allocateSlot(unsigned int tag, unsigned int* h_slot_of_tag)
+    {
+    unsigned int slot;
+    if (m_free_slots.size() > 0)
+        {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+        m_tag_of_slot[slot] = tag;
+        }
+    else
+        {
+        slot = (unsigned int)m_tag_of_slot.size();
+        m_tag_of_slot.push_back(tag);
+        }
+
+    h_slot_of_tag[tag] = slot;
+    return slot;
+    }
+
+/*! \param tag Particle tag
+    \param h_slot_of_tag Host pointer to m_slot_of_tag
+*/
+void MultipleTauCorrelator::freeSlot(unsigned int tag, unsigned int* h_slot_of_tag)
+    {
+    const unsigned int slot = h_slot_of_tag[tag];
+    h_slot_of_tag[tag] = NO_SLOT;
+    m_tag_of_slot[slot] = NO_SLOT;
+    m_free_slots.push_back(slot);
+    }
+
+void MultipleTauCorrelator::resizeHistories()
+    {
+    const size_t n_slots = m_tag_of_slot.size();
+    if (m_compute_msd && m_position_history.size() < n_slots * rowSize())
+        {
+        m_position_history.resize(n_slots * rowSize());
+        }
+    if (m_compute_vacf && m_velocity_history.size() < n_slots * rowSize())
+        {
+        m_velocity_history.resize(n_slots * rowSize());
+        m_velocity_sum.resize(n_slots * m_levels);
+        }
+    }
+
+/*! Without domain decomposition, the local group members change only when the number of members
+    changes, which resets the correlator. Slots are assigned on the first sample after a reset.
+    With domain decomposition, assignSlots() checks for migrated particles on every sample.
+
+    The histories are only read at indices that have been written since the last reset, so new
+    slots need no initialization except for the partial velocity sums.
+*/
+void MultipleTauCorrelator::assignSlots()
+    {
+    if (!m_sysdef->isDomainDecomposed() && m_n_samples > 0)
+        {
+        return;
+        }
+
+    std::vector<unsigned int> arrived;
+    std::vector<unsigned int> departed;
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<unsigned int> h_index(m_group->getIndexArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                access_location::host,
+                                                access_mode::read);
+
+        std::vector<bool> present(m_tag_of_slot.size(), false);
+        const unsigned int group_size = m_group->getNumMembers();
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+            {
+            const unsigned int tag = h_tag.data[h_index.data[group_idx]];
+            const unsigned int slot = h_slot_of_tag.data[tag];
+            if (slot == NO_SLOT)
+                arrived.push_back(tag);
+            else
+                present[slot] = true;
+            }
+
+        for (size_t slot = 0; slot < m_tag_of_slot.size(); slot++)
+            {
+            if (m_tag_of_slot[slot] != NO_SLOT && !present[slot])
+                departed.push_back(m_tag_of_slot[slot]);
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed() && m_n_samples > 0)
+        {
+        migrateHistories(arrived, departed);
+        return;
+        }
+#endif
+
+    if (arrived.size() == 0 && departed.size() == 0)
+        {
+        return;
+        }
+
+    std::vector<unsigned int> new_slots;
+        {
+        ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                access_location::host,
+                                                access_mode::readwrite);
+        for (unsigned int tag : departed)
+            freeSlot(tag, h_slot_of_tag.data);
+        for (unsigned int tag : arrived)
+            new_slots.push_back(allocateSlot(tag, h_slot_of_tag.data));
+        }
+
+    resizeHistories();
+
+    if (m_compute_vacf)
+        {
+        ArrayHandle<Scalar3> h_velocity_sum(m_velocity_sum,
+                                            access_location::host,
+                                            access_mode::readwrite);
+        for (unsigned int slot : new_slots)
+            {
+            std::fill(h_velocity_sum.data + size_t(slot) * m_levels,
+                      h_velocity_sum.data + size_t(slot + 1) * m_levels,
+                      make_scalar3(0, 0, 0));
+            }
+        }
+    }
+
+#ifdef ENABLE_MPI
+/*! \param arrived Tags of the local group members without a slot on this rank
+    \param departed Tags with a slot on this rank that are no longer local
+
+    Every rank publishes the tags that arrived, the previous owners send the rows of those tags,
+    and the new owners store them in newly allocated slots. This is a collective call.
+*/
+void MultipleTauCorrelator::migrateHistories(const std::vector<unsigned int>& arrived,
+                                             const std::vector<unsigned int>& departed)
+    {
+    MPI_Comm comm = m_exec_conf->getMPICommunicator();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+    const unsigned int my_rank = m_exec_conf->getRank();
+
+    // share the arrived tags with all ranks
+    int n_arrived = int(arrived.size());
+    std::vector<int> n_arrived_rank(n_ranks);
+    MPI_Allgather(&n_arrived, 1, MPI_INT, n_arrived_rank.data(), 1, MPI_INT, comm);
+
+    std::vector<int> arrived_offset(n_ranks, 0);
+    for (unsigned int rank = 1; rank < n_ranks; rank++)
+        arrived_offset[rank] = arrived_offset[rank - 1] + n_arrived_rank[rank - 1];
+    const int n_arrived_total = arrived_offset[n_ranks - 1] + n_arrived_rank[n_ranks - 1];
+
+    // all ranks agree on the total, so they either all return here or all exchange rows
+    if (n_arrived_total == 0)
+        {
+        if (departed.size() > 0)
+            {
+            ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                    access_location::host,
+                                                    access_mode::readwrite);
+            for (unsigned int tag : departed)
+                freeSlot(tag, h_slot_of_tag.data);
+            }
+        return;
+        }
+
+    std::vector<unsigned int> arrived_all(n_arrived_total);
+    MPI_Allgatherv(arrived.data(),
+                   n_arrived,
+                   MPI_UNSIGNED,
+                   arrived_all.data(),
+                   n_arrived_rank.data(),
+                   arrived_offset.data(),
+                   MPI_UNSIGNED,
+                   comm);
+
+    // one row holds the position history, the velocity history, and the partial velocity sums
+    const size_t row_size = rowSize();
+    const size_t payload = (m_compute_msd ? row_size : 0)
+                           + (m_compute_vacf ? row_size + m_levels : 0);
+    const int payload_bytes = int(payload * sizeof(Scalar3));
+
+    // pack the rows requested by other ranks
+    std::vector<unsigned int> send_tags;
+    std::vector<Scalar3> send_rows;
+    std::vector<int> n_send(n_ranks, 0);
+        {
+        ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<Scalar3> h_position_history(m_position_history,
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<Scalar3> h_velocity_history(m_velocity_history,
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<Scalar3> h_velocity_sum(m_velocity_sum,
+                                            access_location::host,
+                                            access_mode::read);
+
+        for (unsigned int rank = 0; rank < n_ranks; rank++)
+            {
+            if (rank == my_rank)
+                continue;
+
+            for (int i = 0; i < n_arrived_rank[rank]; i++)
+                {
+                const unsigned int tag = arrived_all[arrived_offset[rank] + i];
+                const unsigned int slot = h_slot_of_tag.data[tag];
+                if (slot == NO_SLOT)
+                    continue;
+
+                // a tag that is local on another rank can only be a departed tag here
+                send_tags.push_back(tag);
+                n_send[rank]++;
+                if (m_compute_msd)
+                    {
+                    const Scalar3* row = h_position_history.data + slot * row_size;
+                    send_rows.insert(send_rows.end(), row, row + row_size);
+                    }
+                if (m_compute_vacf)
+                    {
+                    const Scalar3* row = h_velocity_history.data + slot * row_size;
+                    send_rows.insert(send_rows.end(), row, row + row_size);
+                    const Scalar3* sum = h_velocity_sum.data + size_t(slot) * m_levels;
+                    send_rows.insert(send_rows.end(), sum, sum + m_levels);
+                    }
+                }
+            }
+        }
+
+    std::vector<int> n_recv(n_ranks, 0);
+    MPI_Alltoall(n_send.data(), 1, MPI_INT, n_recv.data(), 1, MPI_INT, comm);
+
+    std::vector<int> send_offset(n_ranks, 0);
+    std::vector<int> recv_offset(n_ranks, 0);
+    for (unsigned int rank = 1; rank < n_ranks; rank++)
+        {
+        send_offset[rank] = send_offset[rank - 1] + n_send[rank - 1];
+        recv_offset[rank] = recv_offset[rank - 1] + n_recv[rank - 1];
+        }
+    const int n_recv_total = recv_offset[n_ranks - 1] + n_recv[n_ranks - 1];
+
+    std::vector<unsigned int> recv_tags(n_recv_total);
+    MPI_Alltoallv(send_tags.data(),
+                  n_send.data(),
+                  send_offset.data(),
+                  MPI_UNSIGNED,
+                  recv_tags.data(),
+                  n_recv.data(),
+                  recv_offset.data(),
+                  MPI_UNSIGNED,
+                  comm);
+
+    // exchange the rows as bytes
+    std::vector<int> n_send_bytes(n_ranks), send_offset_bytes(n_ranks);
+    std::vector<int> n_recv_bytes(n_ranks), recv_offset_bytes(n_ranks);
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        {
+        n_send_bytes[rank] = n_send[rank] * payload_bytes;
+        send_offset_bytes[rank] = send_offset[rank] * payload_bytes;
+        n_recv_bytes[rank] = n_recv[rank] * payload_bytes;
+        recv_offset_bytes[rank] = recv_offset[rank] * payload_bytes;
+        }
+
+    std::vector<Scalar3> recv_rows(n_recv_total * payload);
+    MPI_Alltoallv(send_rows.data(),
+                  n_send_bytes.data(),
+                  send_offset_bytes.data(),
+                  MPI_BYTE,
+                  recv_rows.data(),
+                  n_recv_bytes.data(),
+                  recv_offset_bytes.data(),
+                  MPI_BYTE,
+                  comm);
+
+    // release the departed slots and store the received rows
+    std::vector<unsigned int> recv_slots(n_recv_total);
+    std::vector<unsigned int> missing_slots;
+        {
+        ArrayHandle<unsigned int> h_slot_of_tag(m_slot_of_tag,
+                                                access_location::host,
+                                                access_mode::readwrite);
+        for (unsigned int tag : departed)
+            freeSlot(tag, h_slot_of_tag.data);
+        for (int i = 0; i < n_recv_total; i++)
+            recv_slots[i] = allocateSlot(recv_tags[i], h_slot_of_tag.data);
+
+        // members that joined without a history (not expected between resets) start empty
+        for (unsigned int tag : arrived)
+            {
+            if (h_slot_of_tag.data[tag] == NO_SLOT)
+                missing_slots.push_back(allocateSlot(tag, h_slot_of_tag.data));
+            }
+        }
+
+    if (missing_slots.size() > 0)
+        {
+        m_exec_conf->msg->warning()
+            << "MultipleTauCorrelator: " << missing_slots.size()
+            << " group members arrived without a history." << endl;
+        }
+
+    resizeHistories();
+
+    ArrayHandle<Scalar3> h_position_history(m_position_history,
+                                            access_location::host,
+                                            access_mode::readwrite);
+    ArrayHandle<Scalar3> h_velocity_history(m_velocity_history,
+                                            access_location::host,
+                                            access_mode::readwrite);
+    ArrayHandle<Scalar3> h_velocity_sum(m_velocity_sum,
+                                        access_location::host,
+                                        access_mode::readwrite);
+
+    for (int i = 0; i < n_recv_total; i++)
+        {
+        const unsigned int slot = recv_slots[i];
+        const Scalar3* row = recv_rows.data() + i * payload;
+        if (m_compute_msd)
+            {
+            std::copy(row, row + row_size, h_position_history.data + slot * row_size);
+            row += row_size;
+            }
+        if (m_compute_vacf)
+            {
+            std::copy(row, row + row_size, h_velocity_history.data + slot * row_size);
+            row += row_size;
+            std::copy(row, row + m_levels, h_velocity_sum.data + size_t(slot) * m_levels);
+            }
+        }
+
+    if (m_compute_vacf)
+        {
+        for (unsigned int slot : missing_slots)
+            {
+            std::fill(h_velocity_sum.data + size_t(slot) * m_levels,
+                      h_velocity_sum.data + size_t(slot + 1) * m_levels,
+                      make_scalar3(0, 0, 0));
+            }
+        }
+    }
+#endif
+
+/*! \returns The lag of each correlation in units of samples
+ */
+pybind11::object MultipleTauCorrelator::getLags()
+    {
+    std::vector<uint64_t> lags(getNumLags());
+    uint64_t scale = 1;
+    for (unsigned int k = 0; k < m_levels; k++)
+        {
+        const unsigned int j_min = (k == 0) ? 0 : m_points / m_averaging;
+        for (unsigned int j = j_min; j < m_points; j++)
+            {
+            lags[lagIndex(k, j)] = j * scale;
+            }
+        scale *= m_averaging;
+        }
+    return pybind11::array_t<uint64_t>(lags.size(), lags.data());
+    }
+
+/*! \param sum Sums over the local group members and time origins at each lag
+    \returns The averages over all group members and time origins on the root rank (NaN at lags
+    without time origins), None on other ranks
+*/
+static pybind11::object reduceCorrelation(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                                          bool domain_decomposed,
+                                          GPUArray<double>& sum,
+                                          const std::vector<uint64_t>& lag_count,
+                                          unsigned int n_group_global)
+    {
+    const size_t n_lags = lag_count.size();
+    std::vector<double> result(n_lags);
+        {
+        ArrayHandle<double> h_sum(sum, access_location::host, access_mode::read);
+        std::copy(h_sum.data, h_sum.data + n_lags, result.begin());
+        }
+
+#ifdef ENABLE_MPI
+    if (domain_decomposed)
+        {
+        MPI_Reduce(exec_conf->isRoot() ? MPI_IN_PLACE : result.data(),
+                   result.data(),
+                   int(n_lags),
+                   MPI_DOUBLE,
+                   MPI_SUM,
+                   0,
+                   exec_conf->getMPICommunicator());
+        }
+
+    if (!exec_conf->isRoot())
+        return pybind11::none();
+#endif
+
+    for (size_t i = 0; i < n_lags; i++)
+        {
+        if (lag_count[i] == 0 || n_group_global == 0)
+            result[i] = std::numeric_limits<double>::quiet_NaN();
+        else
+            result[i] /= double(lag_count[i]) * double(n_group_global);
+        }
+
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+/*! \returns The mean squared displacement at each lag on the root rank, None on other ranks
+ */
+pybind11::object MultipleTauCorrelator::getMSD()
+    {
+    if (!m_compute_msd)
+        return pybind11::none();
+
+    return reduceCorrelation(m_exec_conf,
+                             m_sysdef->isDomainDecomposed(),
+                             m_msd_sum,
+                             m_lag_count,
+                             m_n_group_global);
+    }
+
+/*! \returns The velocity autocorrelation at each lag on the root rank, None on other ranks
+ */
+pybind11::object MultipleTauCorrelator::getVACF()
+    {
+    if (!m_compute_vacf)
+        return pybind11::none();
+
+    return reduceCorrelation(m_exec_conf,
+                             m_sysdef->isDomainDecomposed(),
+                             m_vacf_sum,
+                             m_lag_count,
+                             m_n_group_global);
+    }
+
+namespace detail
+    {
+void export_MultipleTauCorrelator(pybind11::module& m)
+    {
+    pybind11::class_<MultipleTauCorrelator, Analyzer, std::shared_ptr<MultipleTauCorrelator>>(
+        m,
+        "MultipleTauCorrelator")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<ParticleGroup>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            bool,
+                            bool>())
+        .def("reset", &MultipleTauCorrelator::reset)
+        .def_property_readonly("points", &MultipleTauCorrelator::getPoints)
+        .def_property_readonly("averaging", &MultipleTauCorrelator::getAveraging)
+        .def_property_readonly("levels", &MultipleTauCorrelator::getLevels)
+        .def_property_readonly("num_samples", &MultipleTauCorrelator::getNumSamples)
+        .def_property_readonly("lags", &MultipleTauCorrelator::getLags)
+        .def_property_readonly("msd", &MultipleTauCorrelator::getMSD)
+        .def_property_readonly("vacf", &MultipleTauCorrelator::getVACF);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
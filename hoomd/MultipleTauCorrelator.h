@@ -0,0 +1,197 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __MULTIPLE_TAU_CORRELATOR_H__
+#define __MULTIPLE_TAU_CORRELATOR_H__
+
+#include "Analyzer.h"
+#include "GPUVector.h"
+#include "ParticleGroup.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file MultipleTauCorrelator.h
+    \brief Declares the MultipleTauCorrelator class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Accumulate the mean squared displacement and velocity autocorrelation of a group
+/*! MultipleTauCorrelator samples the unwrapped positions and the velocities of the group members
+    each time analyze() is called and accumulates the mean squared displacement
+    <|r(t0 + t) - r(t0)|^2> and velocity autocorrelation <v(t0 + t) . v(t0)> over all time
+    origins t0 and group members with the multiple-tau scheme of Ramirez et al.
+    (https://doi.org/10.1063/1.3491098).
+
+    The correlator has m_levels levels of m_points values each. Level 0 holds the latest samples.
+    Every m_averaging insertions into level k insert one value into level k + 1, so level k spans
+    lags of j * m_averaging**k samples. Velocities are averaged over the m_averaging values when
+    passed to the next level. Positions are passed unchanged, which keeps the mean squared
+    displacement exact at every lag. Each insertion into level k correlates the new value with
+    the values stored in the level: all of them at level 0 and those with j >= m_points /
+    m_averaging at higher levels (smaller lags are resolved by the level below). The lags form
+    one increasing sequence, see getLags().
+
+    The insertion schedule is the same for all particles, so the counters are kept once on the
+    host and only the per-particle value histories are stored in GPUVectors, slot-major: row
+    s holds the m_levels * m_points values (and m_velocity_sum the m_levels partial velocity sums)
+    of the particle in slot s. The sums over particles accumulate in m_msd_sum and m_vacf_sum,
+    which stay in device memory in MultipleTauCorrelatorGPU.
+
+    Each rank stores the histories of its local group members. m_slot_of_tag maps particle tags to
+    slots. When particles migrate between ranks, assignSlots() sends the histories of the departed
+    particles to the ranks that now own them. The correlator resets itself when the number of
+    particles or group members changes.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT MultipleTauCorrelator : public Analyzer
+    {
+    public:
+    //! Construct the correlator
+    MultipleTauCorrelator(std::shared_ptr<SystemDefinition> sysdef,
+                          std::shared_ptr<Trigger> trigger,
+                          std::shared_ptr<ParticleGroup> group,
+                          unsigned int points,
+                          unsigned int averaging,
+                          unsigned int levels,
+                          bool msd,
+                          bool vacf);
+
+    //! Destructor
+    virtual ~MultipleTauCorrelator();
+
+    //! Sample the group members
+    virtual void analyze(uint64_t timestep);
+
+    //! Discard all samples
+    void reset();
+
+    //! Get the lags in units of samples
+    pybind11::object getLags();
+
+    //! Get the mean squared displacement at each lag
+    pybind11::object getMSD();
+
+    //! Get the velocity autocorrelation at each lag
+    pybind11::object getVACF();
+
+    /// Get the number of samples since the last reset
+    uint64_t getNumSamples()
+        {
+        return m_n_samples;
+        }
+
+    /// Get the number of values per level
+    unsigned int getPoints()
+        {
+        return m_points;
+        }
+
+    /// Get the number of values averaged when passing values to the next level
+    unsigned int getAveraging()
+        {
+        return m_averaging;
+        }
+
+    /// Get the number of levels
+    unsigned int getLevels()
+        {
+        return m_levels;
+        }
+
+    /// Get the number of lags
+    unsigned int getNumLags()
+        {
+        return m_points + (m_levels - 1) * (m_points - m_points / m_averaging);
+        }
+
+    protected:
+    static constexpr unsigned int NO_SLOT = 0xffffffff; //!< Tags without a slot on this rank
+
+    std::shared_ptr<ParticleGroup> m_group; //!< Group to correlate
+    unsigned int m_points;                  //!< Number of values per level
+    unsigned int m_averaging;               //!< Number of values averaged into the next level
+    unsigned int m_levels;                  //!< Number of levels
+    bool m_compute_msd;                     //!< True when computing the mean squared displacement
+    bool m_compute_vacf;                    //!< True when computing the velocity autocorrelation
+
+    uint64_t m_n_samples = 0;                 //!< Number of samples since the last reset
+    std::vector<uint64_t> m_n_inserted;       //!< Number of values inserted into each level
+    std::vector<unsigned int> m_n_accumulated; //!< Values inserted since the last pass up
+    std::vector<uint64_t> m_lag_count;        //!< Number of time origins at each lag
+
+    GPUArray<double> m_msd_sum;  //!< Squared displacements summed over particles at each lag
+    GPUArray<double> m_vacf_sum; //!< Velocity products summed over particles at each lag
+
+    /// Insertion index (x) and number of stored values (y) of each level on this sample
+    GPUArray<uint2> m_level_state;
+
+    GPUVector<Scalar3> m_position_history; //!< Unwrapped positions of each slot
+    GPUVector<Scalar3> m_velocity_history; //!< Velocities of each slot
+    GPUVector<Scalar3> m_velocity_sum;     //!< Velocities not yet passed up, by slot and level
+
+    GPUArray<unsigned int> m_slot_of_tag;   //!< Slot of each tag on this rank
+    std::vector<unsigned int> m_tag_of_slot; //!< Tag in each slot (NO_SLOT when free)
+    std::vector<unsigned int> m_free_slots;  //!< Slots available for reuse
+    unsigned int m_n_group_global = 0;       //!< Number of group members at the last reset
+    bool m_particles_changed = false;        //!< Set when the number of particles changes
+
+    //! Get the index of the lag j of level k
+    unsigned int lagIndex(unsigned int k, unsigned int j)
+        {
+        if (k == 0)
+            return j;
+        return m_points + (k - 1) * (m_points - m_points / m_averaging) + j
+               - m_points / m_averaging;
+        }
+
+    //! Give every local group member a slot with its history
+    void assignSlots();
+
+    //! Allocate a slot for a tag
+    unsigned int allocateSlot(unsigned int tag, unsigned int* h_slot_of_tag);
+
+    //! Release the slot of a tag
+    void freeSlot(unsigned int tag, unsigned int* h_slot_of_tag);
+
+    //! Grow the histories to hold every allocated slot
+    void resizeHistories();
+
+    //! Insert the current sample into the histories of the first n_insert levels
+    virtual void updateHistories(unsigned int n_insert);
+
+    //! Reset on the next sample when the number of particles changes
+    void slotGlobalParticleNumberChange()
+        {
+        m_particles_changed = true;
+        }
+
+#ifdef ENABLE_MPI
+    //! Move the histories of migrated particles to their new ranks
+    void migrateHistories(const std::vector<unsigned int>& arrived,
+                          const std::vector<unsigned int>& departed);
+#endif
+
+    //! Number of Scalar3 values in one slot of the position or velocity history
+    size_t rowSize()
+        {
+        return size_t(m_levels) * m_points;
+        }
+    };
+
+namespace detail
+    {
+//! Exports the MultipleTauCorrelator class to python
+void export_MultipleTauCorrelator(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+#endif
@@ -0,0 +1,120 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MultipleTauCorrelatorGPU.cc
+    \brief Defines the MultipleTauCorrelatorGPU class
+*/
+
+#include "MultipleTauCorrelatorGPU.h"
+#include "MultipleTauCorrelatorGPU.cuh"
+
+using namespace std;
+
+namespace hoomd
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to sample
+    \param group Group of particles to correlate
+    \param points Number of values stored in each level
+    \param averaging Number of values averaged when passing values to the next level
+    \param levels Number of levels
+    \param msd Set to true to accumulate the mean squared displacement
+    \param vacf Set to true to accumulate the velocity autocorrelation
+*/
+MultipleTauCorrelatorGPU::MultipleTauCorrelatorGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                   std::shared_ptr<Trigger> trigger,
+                                                   std::shared_ptr<ParticleGroup> group,
+                                                   unsigned int points,
+                                                   unsigned int averaging,
+                                                   unsigned int levels,
+                                                   bool msd,
+                                                   bool vacf)
+    : MultipleTauCorrelator(sysdef, trigger, group, points, averaging, levels, msd, vacf)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Creating a MultipleTauCorrelatorGPU with no GPU in the execution "
+                                 "configuration");
+        }
+
+    m_block_size = 256;
+    }
+
+MultipleTauCorrelatorGPU::~MultipleTauCorrelatorGPU() { }
+
+/*! \param n_insert Number of levels that receive a value on this sample
+ */
+void MultipleTauCorrelatorGPU::updateHistories(unsigned int n_insert)
+    {
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<int3> d_image(m_pdata->getImages(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<unsigned int> d_tag(m_pdata->getTags(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_index(m_group->getIndexArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<unsigned int> d_slot_of_tag(m_slot_of_tag,
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<uint2> d_level_state(m_level_state, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_position_history(m_position_history,
+                                            access_location::device,
+                                            access_mode::readwrite);
+    ArrayHandle<Scalar3> d_velocity_history(m_velocity_history,
+                                            access_location::device,
+                                            access_mode::readwrite);
+    ArrayHandle<Scalar3> d_velocity_sum(m_velocity_sum,
+                                        access_location::device,
+                                        access_mode::readwrite);
+    ArrayHandle<double> d_msd_sum(m_msd_sum, access_location::device, access_mode::readwrite);
+    ArrayHandle<double> d_vacf_sum(m_vacf_sum, access_location::device, access_mode::readwrite);
+
+    kernel::gpu_correlator_update(d_position_history.data,
+                                  d_velocity_history.data,
+                                  d_velocity_sum.data,
+                                  d_msd_sum.data,
+                                  d_vacf_sum.data,
+                                  d_pos.data,
+                                  d_image.data,
+                                  d_vel.data,
+                                  d_tag.data,
+                                  d_index.data,
+                                  d_slot_of_tag.data,
+                                  d_level_state.data,
+                                  m_group->getNumMembers(),
+                                  m_pdata->getGlobalBox(),
+                                  m_points,
+                                  m_averaging,
+                                  m_levels,
+                                  n_insert,
+                                  getNumLags(),
+                                  m_compute_msd,
+                                  m_compute_vacf,
+                                  m_block_size);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+namespace detail
+    {
+void export_MultipleTauCorrelatorGPU(pybind11::module& m)
+    {
+    pybind11::class_<MultipleTauCorrelatorGPU,
+                     MultipleTauCorrelator,
+                     std::shared_ptr<MultipleTauCorrelatorGPU>>(m, "MultipleTauCorrelatorGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<ParticleGroup>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int,
+                            bool,
+                            bool>());
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
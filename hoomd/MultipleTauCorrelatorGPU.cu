@@ -0,0 +1,241 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MultipleTauCorrelatorGPU.cuh"
+
+/*! \file MultipleTauCorrelatorGPU.cu
+    \brief Defines GPU kernel code for the multiple-tau correlator. Used by
+   MultipleTauCorrelatorGPU.
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Largest number of lags that are accumulated in shared memory
+const unsigned int CORRELATOR_MAX_SHARED_LAGS = 2048;
+
+//! Get the index of the lag j of level k
+__device__ inline unsigned int
+correlator_lag_index(unsigned int k, unsigned int j, unsigned int points, unsigned int averaging)
+    {
+    if (k == 0)
+        return j;
+    return points + (k - 1) * (points - points / averaging) + j - points / averaging;
+    }
+
+//! Insert the current sample into the correlator histories and accumulate the sums at each lag
+/*! \param d_position_history Unwrapped positions of each slot
+    \param d_velocity_history Velocities of each slot
+    \param d_velocity_sum Velocities not yet passed up, by slot and level
+    \param d_msd_sum Squared displacements summed at each lag (accumulated)
+    \param d_vacf_sum Velocity products summed at each lag (accumulated)
+    \param d_pos Particle positions
+    \param d_image Particle images
+    \param d_vel Particle velocities
+    \param d_tag Particle tags
+    \param d_index Local indices of the group members
+    \param d_slot_of_tag Slot of each tag
+    \param d_level_state Insertion index (x) and number of stored values (y) of each level
+    \param group_size Number of local group members
+    \param box Global simulation box
+    \param points Number of values per level
+    \param averaging Number of values averaged into the next level
+    \param levels Number of levels
+    \param n_insert Number of levels that receive a value on this sample
+    \param n_lags Number of lags
+    \param msd Set to true to accumulate the mean squared displacement
+    \param vacf Set to true to accumulate the velocity autocorrelation
+    \param use_shared Set to true to accumulate the block's sums in shared memory
+
+    One thread is executed per group member. With \a use_shared, each block accumulates its sums in
+    shared memory (2 * n_lags doubles of dynamic shared memory) and adds them to \a d_msd_sum and
+    \a d_vacf_sum at the end.
+*/
+__global__ void gpu_correlator_update_kernel(Scalar3* d_position_history,
+                                             Scalar3* d_velocity_history,
+                                             Scalar3* d_velocity_sum,
+                                             double* d_msd_sum,
+                                             double* d_vacf_sum,
+                                             const Scalar4* d_pos,
+                                             const int3* d_image,
+                                             const Scalar4* d_vel,
+                                             const unsigned int* d_tag,
+                                             const unsigned int* d_index,
+                                             const unsigned int* d_slot_of_tag,
+                                             const uint2* d_level_state,
+                                             unsigned int group_size,
+                                             BoxDim box,
+                                             unsigned int points,
+                                             unsigned int averaging,
+                                             unsigned int levels,
+                                             unsigned int n_insert,
+                                             unsigned int n_lags,
+                                             bool msd,
+                                             bool vacf,
+                                             bool use_shared)
+    {
+    extern __shared__ double s_sums[];
+
+    if (use_shared)
+        {
+        for (unsigned int i = threadIdx.x; i < 2 * n_lags; i += blockDim.x)
+            s_sums[i] = 0.0;
+        __syncthreads();
+        }
+
+    double* msd_sum = use_shared ? s_sums : d_msd_sum;
+    double* vacf_sum = use_shared ? s_sums + n_lags : d_vacf_sum;
+
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (group_idx < group_size)
+        {
+        const unsigned int idx = d_index[group_idx];
+        const unsigned int slot = d_slot_of_tag[d_tag[idx]];
+        const size_t row_size = size_t(levels) * points;
+
+        Scalar4 postype = d_pos[idx];
+        Scalar3 r = box.shift(make_scalar3(postype.x, postype.y, postype.z), d_image[idx]);
+        Scalar4 velmass = d_vel[idx];
+        Scalar3 v = make_scalar3(velmass.x, velmass.y, velmass.z);
+
+        for (unsigned int k = 0; k < n_insert; k++)
+            {
+            const uint2 state = d_level_state[k];
+            const unsigned int j_min = (k == 0) ? 0 : points / averaging;
+            const size_t offset = slot * row_size + size_t(k) * points;
+
+            if (msd)
+                {
+                Scalar3* history = d_position_history + offset;
+                history[state.x] = r;
+                for (unsigned int j = j_min; j < state.y; j++)
+                    {
+                    Scalar3 dr = r - history[(state.x + points - j) % points];
+                    atomicAdd(&msd_sum[correlator_lag_index(k, j, points, averaging)],
+                              double(dot(dr, dr)));
+                    }
+                }
+
+            if (vacf)
+                {
+                Scalar3* history = d_velocity_history + offset;
+                history[state.x] = v;
+                for (unsigned int j = j_min; j < state.y; j++)
+                    {
+                    atomicAdd(&vacf_sum[correlator_lag_index(k, j, points, averaging)],
+                              double(dot(v, history[(state.x + points - j) % points])));
+                    }
+
+                Scalar3 sum = d_velocity_sum[size_t(slot) * levels + k] + v;
+                if (k + 1 < n_insert)
+                    {
+                    v = sum / Scalar(averaging);
+                    sum = make_scalar3(0, 0, 0);
+                    }
+                d_velocity_sum[size_t(slot) * levels + k] = sum;
+                }
+            }
+        }
+
+    if (use_shared)
+        {
+        __syncthreads();
+        for (unsigned int i = threadIdx.x; i < n_lags; i += blockDim.x)
+            {
+            if (s_sums[i] != 0.0)
+                atomicAdd(&d_msd_sum[i], s_sums[i]);
+            if (s_sums[n_lags + i] != 0.0)
+                atomicAdd(&d_vacf_sum[i], s_sums[n_lags + i]);
+            }
+        }
+    }
+
+/*! \param d_position_history Unwrapped positions of each slot
+    \param d_velocity_history Velocities of each slot
+    \param d_velocity_sum Velocities not yet passed up, by slot and level
+    \param d_msd_sum Squared displacements summed at each lag (accumulated)
+    \param d_vacf_sum Velocity products summed at each lag (accumulated)
+    \param d_pos Particle positions
+    \param d_image Particle images
+    \param d_vel Particle velocities
+    \param d_tag Particle tags
+    \param d_index Local indices of the group members
+    \param d_slot_of_tag Slot of each tag
+    \param d_level_state Insertion index (x) and number of stored values (y) of each level
+    \param group_size Number of local group members
+    \param box Global simulation box
+    \param points Number of values per level
+    \param averaging Number of values averaged into the next level
+    \param levels Number of levels
+    \param n_insert Number of levels that receive a value on this sample
+    \param n_lags Number of lags
+    \param msd Set to true to accumulate the mean squared displacement
+    \param vacf Set to true to accumulate the velocity autocorrelation
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_correlator_update(Scalar3* d_position_history,
+                                 Scalar3* d_velocity_history,
+                                 Scalar3* d_velocity_sum,
+                                 double* d_msd_sum,
+                                 double* d_vacf_sum,
+                                 const Scalar4* d_pos,
+                                 const int3* d_image,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_tag,
+                                 const unsigned int* d_index,
+                                 const unsigned int* d_slot_of_tag,
+                                 const uint2* d_level_state,
+                                 unsigned int group_size,
+                                 const BoxDim& box,
+                                 unsigned int points,
+                                 unsigned int averaging,
+                                 unsigned int levels,
+                                 unsigned int n_insert,
+                                 unsigned int n_lags,
+                                 bool msd,
+                                 bool vacf,
+                                 unsigned int block_size)
+    {
+    if (group_size == 0)
+        return hipSuccess;
+
+    const bool use_shared = n_lags <= CORRELATOR_MAX_SHARED_LAGS;
+    const size_t shared_bytes = use_shared ? 2 * sizeof(double) * n_lags : 0;
+
+    dim3 grid(group_size / block_size + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_correlator_update_kernel),
+                       dim3(grid),
+                       dim3(threads),
+                       shared_bytes,
+                       0,
+                       d_position_history,
+                       d_velocity_history,
+                       d_velocity_sum,
+                       d_msd_sum,
+                       d_vacf_sum,
+                       d_pos,
+                       d_image,
+                       d_vel,
+                       d_tag,
+                       d_index,
+                       d_slot_of_tag,
+                       d_level_state,
+                       group_size,
+                       box,
+                       points,
+                       averaging,
+                       levels,
+                       n_insert,
+                       n_lags,
+                       msd,
+                       vacf,
+                       use_shared);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace hoomd
@@ -0,0 +1,47 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _MULTIPLE_TAU_CORRELATOR_GPU_CUH_
+#define _MULTIPLE_TAU_CORRELATOR_GPU_CUH_
+
+#include <hip/hip_runtime.h>
+
+#include "BoxDim.h"
+#include "HOOMDMath.h"
+
+/*! \file MultipleTauCorrelatorGPU.cuh
+    \brief Kernel driver function declarations for MultipleTauCorrelatorGPU
+    */
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Insert the current sample into the correlator histories and accumulate the sums at each lag
+hipError_t gpu_correlator_update(Scalar3* d_position_history,
+                                 Scalar3* d_velocity_history,
+                                 Scalar3* d_velocity_sum,
+                                 double* d_msd_sum,
+                                 double* d_vacf_sum,
+                                 const Scalar4* d_pos,
+                                 const int3* d_image,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_tag,
+                                 const unsigned int* d_index,
+                                 const unsigned int* d_slot_of_tag,
+                                 const uint2* d_level_state,
+                                 unsigned int group_size,
+                                 const BoxDim& box,
+                                 unsigned int points,
+                                 unsigned int averaging,
+                                 unsigned int levels,
+                                 unsigned int n_insert,
+                                 unsigned int n_lags,
+                                 bool msd,
+                                 bool vacf,
+                                 unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace hoomd
+
+#endif
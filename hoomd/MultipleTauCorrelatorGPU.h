@@ -0,0 +1,61 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __MULTIPLE_TAU_CORRELATOR_GPU_H__
+#define __MULTIPLE_TAU_CORRELATOR_GPU_H__
+
+#include "MultipleTauCorrelator.h"
+
+/*! \file MultipleTauCorrelatorGPU.h
+    \brief Declares the MultipleTauCorrelatorGPU class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Accumulate the mean squared displacement and velocity autocorrelation on the GPU
+/*! MultipleTauCorrelatorGPU updates the histories and the sums at each lag on the device. Each
+    block accumulates its contributions in shared memory before adding them to the sums, and only
+    the level state (a few values per level) is copied to the device on each sample. The sums are
+    copied to the host when getMSD() or getVACF() is called.
+
+    Slot assignment and the migration of histories between ranks remain on the host.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT MultipleTauCorrelatorGPU : public MultipleTauCorrelator
+    {
+    public:
+    //! Construct the correlator
+    MultipleTauCorrelatorGPU(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<Trigger> trigger,
+                             std::shared_ptr<ParticleGroup> group,
+                             unsigned int points,
+                             unsigned int averaging,
+                             unsigned int levels,
+                             bool msd,
+                             bool vacf);
+
+    //! Destructor
+    virtual ~MultipleTauCorrelatorGPU();
+
+    protected:
+    unsigned int m_block_size; //!< Block size executed
+
+    //! Insert the current sample into the histories of the first n_insert levels
+    virtual void updateHistories(unsigned int n_insert);
+    };
+
+namespace detail
+    {
+//! Exports the MultipleTauCorrelatorGPU class to python
+void export_MultipleTauCorrelatorGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+#endif
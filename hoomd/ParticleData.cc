@@ -6,6 +6,7 @@
  */
 
 #include "ParticleData.h"
+#include "ParticleDataSoA.h"
 
 #ifdef ENABLE_MPI
 #include "HOOMDMPI.h"
@@ -46,6 +47,44 @@ std::string getDefaultTypeName(unsigned int id)
     return result;
     }
 
+//! Copy the first n elements of a particle array in the memory space used by the execution
+//! configuration
+template<class T>
+void copyLocalArray(const GPUArray<T>& src,
+                    GPUArray<T>& dst,
+                    unsigned int n,
+                    std::shared_ptr<const ExecutionConfiguration> exec_conf)
+    {
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        {
+        ArrayHandle<T> d_src(src, access_location::device, access_mode::read);
+        ArrayHandle<T> d_dst(dst, access_location::device, access_mode::overwrite);
+        hipMemcpy(d_dst.data, d_src.data, sizeof(T) * n, hipMemcpyDeviceToDevice);
+        return;
+        }
+#endif
+
+    ArrayHandle<T> h_src(src, access_location::host, access_mode::read);
+    ArrayHandle<T> h_dst(dst, access_location::host, access_mode::overwrite);
+    std::copy(h_src.data, h_src.data + n, h_dst.data);
+    }
+
+//! Copy the first n elements of a particle array into a checkpoint array, growing it as needed
+template<class T>
+void checkpointLocalArray(const GPUArray<T>& src,
+                          GPUArray<T>& dst,
+                          unsigned int n,
+                          std::shared_ptr<const ExecutionConfiguration> exec_conf)
+    {
+    if (dst.getNumElements() < n)
+        {
+        GPUArray<T> array(n, exec_conf);
+        dst.swap(array);
+        }
+    copyLocalArray(src, dst, n, exec_conf);
+    }
+
     } // end namespace detail
 
 ////////////////////////////////////////////////////////////////////////////
@@ -80,6 +119,9 @@ ParticleData::ParticleData(unsigned int N,
     {
     m_exec_conf->msg->notice(5) << "Constructing ParticleData" << endl;
 
+    // forces compute the potential energy unless the flags are set otherwise
+    m_flags[pdata_flag::potential_energy] = 1;
+
     // initialize snapshot with default values
     SnapshotParticleData<Scalar> snap(N);
 
@@ -133,6 +175,9 @@ ParticleData::ParticleData(const SnapshotParticleData<Real>& snapshot,
     {
     m_exec_conf->msg->notice(5) << "Constructing ParticleData" << endl;
 
+    // forces compute the potential energy unless the flags are set otherwise
+    m_flags[pdata_flag::potential_energy] = 1;
+
 #ifdef ENABLE_MPI
     // Set up domain decomposition information
     if (decomposition)
@@ -260,6 +305,30 @@ void ParticleData::notifyParticleSort()
     m_sort_signal.emit();
     }
 
+/*! \param order Index i now holds the local particle that was at index order[i]
+
+    The slots may call getSortOrder() to remap their per-particle data instead of recomputing it.
+    The ghost particles must keep their indices.
+*/
+void ParticleData::notifyParticleSort(const unsigned int* order)
+    {
+    m_sort_order = order;
+    m_sort_signal.emit();
+    m_sort_order = nullptr;
+    }
+
+/*! The mirror is created on the first call and kept for the lifetime of the ParticleData. Call
+    ParticleDataSoA::update() before reading it.
+*/
+ParticleDataSoA& ParticleData::getSoA()
+    {
+    if (!m_soa)
+        {
+        m_soa = std::make_unique<ParticleDataSoA>(*this);
+        }
+    return *m_soa;
+    }
+
 /*! This function is called any time the ghost particles are removed
  *
  * The rationale is that a subscriber (i.e. the Communicator) can perform clean-up for ghost
@@ -402,7 +471,8 @@ void ParticleData::allocate(unsigned int N)
     m_comm_flags.swap(comm_flags);
 
     // allocate alternate particle data arrays (for swapping in-out)
-    allocateAlternateArrays(N);
+    if (m_alt_arrays_resident)
+        allocateAlternateArrays(N);
 
     // notify observers
     m_max_particle_num_signal.emit();
@@ -627,6 +697,37 @@ void ParticleData::reallocate(unsigned int max_n)
     m_max_particle_num_signal.emit();
     }
 
+/*! The alternate arrays are allocated with the capacity of the particle data arrays.
+ */
+void ParticleData::acquireAltArrays()
+    {
+    if (m_arrays_allocated && m_pos_alt.isNull())
+        allocateAlternateArrays(m_max_nparticles);
+    }
+
+/*! The main arrays hold the current data after the swap, so the alternate arrays can be freed.
+ */
+void ParticleData::releaseAltArrays()
+    {
+    if (m_alt_arrays_resident || m_pos_alt.isNull())
+        return;
+
+    m_pos_alt = GPUArray<Scalar4>();
+    m_vel_alt = GPUArray<Scalar4>();
+    m_accel_alt = GPUArray<Scalar3>();
+    m_charge_alt = GPUArray<Scalar>();
+    m_diameter_alt = GPUArray<Scalar>();
+    m_image_alt = GPUArray<int3>();
+    m_tag_alt = GPUArray<unsigned int>();
+    m_body_alt = GPUArray<unsigned int>();
+    m_orientation_alt = GPUArray<Scalar4>();
+    m_angmom_alt = GPUArray<Scalar4>();
+    m_inertia_alt = GPUArray<Scalar3>();
+    m_net_force_alt = GPUArray<Scalar4>();
+    m_net_virial_alt = GPUArray<Scalar>();
+    m_net_torque_alt = GPUArray<Scalar4>();
+    }
+
 /*! Rebuild the cached vector of active tags, if necessary
  */
 void ParticleData::maybe_rebuild_tag_cache()
@@ -660,16 +761,17 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
         Scalar3 hi = m_global_box->getHi();
 
         const Scalar tol = Scalar(1e-5);
+        const vec3<Real>* snap_pos = snap.getPos();
 
         for (unsigned int i = 0; i < snap.size; i++)
             {
-            Scalar3 f = m_global_box->makeFraction(vec_to_scalar3(snap.pos[i]));
+            Scalar3 f = m_global_box->makeFraction(vec_to_scalar3(snap_pos[i]));
             if (f.x < -tol || f.x > Scalar(1.0) + tol || f.y < -tol || f.y > Scalar(1.0) + tol
                 || f.z < -tol || f.z > Scalar(1.0) + tol)
                 {
                 m_exec_conf->msg->warning()
-                    << "pos " << i << ":" << setprecision(12) << snap.pos[i].x << " "
-                    << snap.pos[i].y << " " << snap.pos[i].z << endl;
+                    << "pos " << i << ":" << setprecision(12) << snap_pos[i].x << " "
+                    << snap_pos[i].y << " " << snap_pos[i].z << endl;
                 m_exec_conf->msg->warning() << "fractional pos :" << setprecision(12) << f.x << " "
                                             << f.y << " " << f.z << endl;
                 m_exec_conf->msg->warning() << "lo: " << lo.x << " " << lo.y << " " << lo.z << endl;
@@ -688,6 +790,78 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
     return in_box;
     }
 
+#ifdef ENABLE_MPI
+/*! \param pos Position of the particle, wrapped on return if it lies on a domain boundary
+    \param img Image of the particle, updated consistently with \a pos
+    \param cart_ranks Map from cartesian domain index to rank
+    \param idx Index of the particle (used in error messages)
+    \returns The rank that owns the particle
+*/
+unsigned int ParticleData::placeSnapshotParticle(Scalar3& pos,
+                                                 int3& img,
+                                                 const unsigned int* cart_ranks,
+                                                 unsigned int idx) const
+    {
+    const Index3D& di = m_decomposition->getDomainIndexer();
+    unsigned int n_ranks = m_exec_conf->getNRanks();
+
+    BoxDim global_box = *m_global_box;
+
+    Scalar3 f = m_global_box->makeFraction(pos);
+    int i = int(f.x * ((Scalar)di.getW()));
+    int j = int(f.y * ((Scalar)di.getH()));
+    int k = int(f.z * ((Scalar)di.getD()));
+
+    // wrap particles that are exactly on a boundary
+    // we only need to wrap in the negative direction, since
+    // processor ids are rounded toward zero
+    char3 flags = make_char3(0, 0, 0);
+    if (i == (int)di.getW())
+        {
+        i = 0;
+        flags.x = 1;
+        }
+
+    if (j == (int)di.getH())
+        {
+        j = 0;
+        flags.y = 1;
+        }
+
+    if (k == (int)di.getD())
+        {
+        k = 0;
+        flags.z = 1;
+        }
+
+    // only wrap if the particles is on one of the boundaries
+    uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
+    global_box.setPeriodic(periodic);
+    global_box.wrap(pos, img, flags);
+
+    // place particle using actual domain fractions, not global box fraction
+    unsigned int rank = m_decomposition->placeParticle(global_box, pos, cart_ranks);
+
+    if (rank >= n_ranks)
+        {
+        ostringstream s;
+        s << "init.*: Particle " << idx << " out of bounds." << std::endl;
+        s << "Cartesian coordinates: " << std::endl;
+        s << "x: " << pos.x << " y: " << pos.y << " z: " << pos.z << std::endl;
+        s << "Fractional coordinates: " << std::endl;
+        s << "f.x: " << f.x << " f.y: " << f.y << " f.z: " << f.z << std::endl;
+        Scalar3 lo = m_global_box->getLo();
+        Scalar3 hi = m_global_box->getHi();
+        s << "Global box lo: (" << lo.x << ", " << lo.y << ", " << lo.z << ")" << std::endl;
+        s << "           hi: (" << hi.x << ", " << hi.y << ", " << hi.z << ")" << std::endl;
+
+        throw std::runtime_error(s.str());
+        }
+
+    return rank;
+    }
+#endif
+
 //! Initialize from a snapshot
 /*! \param snapshot the initial particle data
     \param ignore_bodies If True, ignore particles that have a body flag set
@@ -722,8 +896,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
     m_tag_set.clear();
 
     // clear reservoir of recycled tags
-    while (!m_recycled_tags.empty())
-        m_recycled_tags.pop();
+    m_recycled_tags.clear();
 
     // global number of particles
     unsigned int nglobal = 0;
@@ -778,18 +951,18 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                                                    access_location::host,
                                                    access_mode::read);
 
-            const Index3D& di = m_decomposition->getDomainIndexer();
-            unsigned int n_ranks = m_exec_conf->getNRanks();
-
-            BoxDim global_box = *m_global_box;
+            // read adopted fields in place
+            const vec3<Real>* snap_pos = snapshot.getPos();
+            const vec3<Real>* snap_vel = snapshot.getVel();
+            const unsigned int* snap_type = snapshot.getType();
+            const Real* snap_mass = snapshot.getMass();
+            const Real* snap_charge = snapshot.getCharge();
+            const Real* snap_diameter = snapshot.getDiameter();
+            const int3* snap_image = snapshot.getImage();
 
             // loop over particles in snapshot, place them into domains
-            for (typename std::vector<vec3<Real>>::const_iterator it = snapshot.pos.begin();
-                 it != snapshot.pos.end();
-                 it++)
+            for (unsigned int snap_idx = 0; snap_idx < snapshot.size; snap_idx++)
                 {
-                unsigned int snap_idx = (unsigned int)(it - snapshot.pos.begin());
-
                 // if requested, do not initialize constituent particles of bodies
                 if (ignore_bodies && snapshot.body[snap_idx] < MIN_FLOPPY
                     && snapshot.body[snap_idx] != snap_idx)
@@ -798,72 +971,19 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                     }
 
                 // determine domain the particle is placed into
-                Scalar3 pos = vec_to_scalar3(*it);
-                Scalar3 f = m_global_box->makeFraction(pos);
-                int i = int(f.x * ((Scalar)di.getW()));
-                int j = int(f.y * ((Scalar)di.getH()));
-                int k = int(f.z * ((Scalar)di.getD()));
-
-                // wrap particles that are exactly on a boundary
-                // we only need to wrap in the negative direction, since
-                // processor ids are rounded toward zero
-                char3 flags = make_char3(0, 0, 0);
-                if (i == (int)di.getW())
-                    {
-                    i = 0;
-                    flags.x = 1;
-                    }
-
-                if (j == (int)di.getH())
-                    {
-                    j = 0;
-                    flags.y = 1;
-                    }
-
-                if (k == (int)di.getD())
-                    {
-                    k = 0;
-                    flags.z = 1;
-                    }
-
-                int3 img = snapshot.image[snap_idx];
-
-                // only wrap if the particles is on one of the boundaries
-                uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
-                global_box.setPeriodic(periodic);
-                global_box.wrap(pos, img, flags);
-
-                // place particle using actual domain fractions, not global box fraction
-                unsigned int rank
-                    = m_decomposition->placeParticle(global_box, pos, h_cart_ranks.data);
-
-                if (rank >= n_ranks)
-                    {
-                    ostringstream s;
-                    s << "init.*: Particle " << snap_idx << " out of bounds." << std::endl;
-                    s << "Cartesian coordinates: " << std::endl;
-                    s << "x: " << pos.x << " y: " << pos.y << " z: " << pos.z << std::endl;
-                    s << "Fractional coordinates: " << std::endl;
-                    s << "f.x: " << f.x << " f.y: " << f.y << " f.z: " << f.z << std::endl;
-                    Scalar3 lo = m_global_box->getLo();
-                    Scalar3 hi = m_global_box->getHi();
-                    s << "Global box lo: (" << lo.x << ", " << lo.y << ", " << lo.z << ")"
-                      << std::endl;
-                    s << "           hi: (" << hi.x << ", " << hi.y << ", " << hi.z << ")"
-                      << std::endl;
-
-                    throw std::runtime_error(s.str());
-                    }
+                Scalar3 pos = vec_to_scalar3(snap_pos[snap_idx]);
+                int3 img = snap_image[snap_idx];
+                unsigned int rank = placeSnapshotParticle(pos, img, h_cart_ranks.data, snap_idx);
 
                 // fill up per-processor data structures
                 pos_proc[rank].push_back(pos);
                 image_proc[rank].push_back(img);
-                vel_proc[rank].push_back(vec_to_scalar3(snapshot.vel[snap_idx]));
+                vel_proc[rank].push_back(vec_to_scalar3(snap_vel[snap_idx]));
                 accel_proc[rank].push_back(vec_to_scalar3(snapshot.accel[snap_idx]));
-                type_proc[rank].push_back(snapshot.type[snap_idx]);
-                mass_proc[rank].push_back(snapshot.mass[snap_idx]);
-                charge_proc[rank].push_back(snapshot.charge[snap_idx]);
-                diameter_proc[rank].push_back(snapshot.diameter[snap_idx]);
+                type_proc[rank].push_back(snap_type[snap_idx]);
+                mass_proc[rank].push_back(snap_mass[snap_idx]);
+                charge_proc[rank].push_back(snap_charge[snap_idx]);
+                diameter_proc[rank].push_back(snap_diameter[snap_idx]);
                 body_proc[rank].push_back(snapshot.body[snap_idx]);
                 orientation_proc[rank].push_back(quat_to_scalar4(snapshot.orientation[snap_idx]));
                 angmom_proc[rank].push_back(quat_to_scalar4(snapshot.angmom[snap_idx]));
@@ -872,7 +992,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                 N_proc[rank]++;
 
                 // determine max typeid on root rank
-                max_typeid = std::max(max_typeid, snapshot.type[snap_idx]);
+                max_typeid = std::max(max_typeid, snap_type[snap_idx]);
                 }
             }
 
@@ -1015,6 +1135,15 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::overwrite);
         ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::readwrite);
 
+        // read adopted fields in place
+        const vec3<Real>* snap_pos = snapshot.getPos();
+        const vec3<Real>* snap_vel = snapshot.getVel();
+        const unsigned int* snap_type = snapshot.getType();
+        const Real* snap_mass = snapshot.getMass();
+        const Real* snap_charge = snapshot.getCharge();
+        const Real* snap_diameter = snapshot.getDiameter();
+        const int3* snap_image = snapshot.getImage();
+
         for (unsigned int snap_idx = 0; snap_idx < snapshot.size; snap_idx++)
             {
             // if requested, do not initialize constituent particles of rigid bodies
@@ -1023,20 +1152,20 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                 continue;
                 }
 
-            max_typeid = std::max(max_typeid, snapshot.type[snap_idx]);
+            max_typeid = std::max(max_typeid, snap_type[snap_idx]);
 
-            h_pos.data[nglobal] = make_scalar4(snapshot.pos[snap_idx].x,
-                                               snapshot.pos[snap_idx].y,
-                                               snapshot.pos[snap_idx].z,
-                                               __int_as_scalar(snapshot.type[snap_idx]));
-            h_vel.data[nglobal] = make_scalar4(snapshot.vel[snap_idx].x,
-                                               snapshot.vel[snap_idx].y,
-                                               snapshot.vel[snap_idx].z,
-                                               snapshot.mass[snap_idx]);
+            h_pos.data[nglobal] = make_scalar4(snap_pos[snap_idx].x,
+                                               snap_pos[snap_idx].y,
+                                               snap_pos[snap_idx].z,
+                                               __int_as_scalar(snap_type[snap_idx]));
+            h_vel.data[nglobal] = make_scalar4(snap_vel[snap_idx].x,
+                                               snap_vel[snap_idx].y,
+                                               snap_vel[snap_idx].z,
+                                               snap_mass[snap_idx]);
             h_accel.data[nglobal] = vec_to_scalar3(snapshot.accel[snap_idx]);
-            h_charge.data[nglobal] = snapshot.charge[snap_idx];
-            h_diameter.data[nglobal] = snapshot.diameter[snap_idx];
-            h_image.data[nglobal] = snapshot.image[snap_idx];
+            h_charge.data[nglobal] = snap_charge[snap_idx];
+            h_diameter.data[nglobal] = snap_diameter[snap_idx];
+            h_image.data[nglobal] = snap_image[snap_idx];
             h_tag.data[nglobal] = nglobal;
             h_rtag.data[nglobal] = nglobal;
             h_body.data[nglobal] = snapshot.body[snap_idx];
@@ -1097,6 +1226,188 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         }
     }
 
+//! Initialize from a snapshot that is distributed over the ranks
+/*! \param snapshot Slice of the global particle list held by this rank
+    \param tag_offset Tag of the first particle in \a snapshot
+    \param nglobal Global number of particles
+
+    Every rank passes a contiguous slice of the global particle list, such as the rows it read from
+    a file. Particle \a i of the slice is assigned the tag \a tag_offset + \a i. Each rank places
+    its particles into their domains and sends them directly to their owners, so no rank ever
+    holds more than its slice and its own local particles. The type mapping and the accel_set flag
+    are taken from the root rank.
+
+    Collective: call on all ranks.
+
+    \pre The local box size must be set before a call to initializeFromDistributedSnapshot().
+*/
+template<class Real>
+void ParticleData::initializeFromDistributedSnapshot(const SnapshotParticleData<Real>& snapshot,
+                                                     unsigned int tag_offset,
+                                                     unsigned int nglobal)
+    {
+#ifdef ENABLE_MPI
+    if (!m_decomposition)
+#endif
+        {
+        throw std::runtime_error("Distributed initialization requires domain decomposition.");
+        }
+
+#ifdef ENABLE_MPI
+    m_exec_conf->msg->notice(4) << "ParticleData: initializing from distributed snapshot"
+                                << std::endl;
+
+    // remove all ghost particles
+    removeAllGhostParticles();
+
+    // check that all fields in the local slice have correct length
+    snapshot.validate();
+
+    // clear set of active tags
+    m_tag_set.clear();
+
+    // clear reservoir of recycled tags
+    m_recycled_tags.clear();
+
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    unsigned int n_ranks = m_exec_conf->getNRanks();
+
+    // place the particles of the local slice into domains
+    std::vector<std::vector<detail::pdata_element>> send_proc(n_ranks);
+    unsigned int max_typeid = 0;
+        {
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+
+        // read adopted fields in place
+        const vec3<Real>* snap_pos = snapshot.getPos();
+        const vec3<Real>* snap_vel = snapshot.getVel();
+        const unsigned int* snap_type = snapshot.getType();
+        const Real* snap_mass = snapshot.getMass();
+        const Real* snap_charge = snapshot.getCharge();
+        const Real* snap_diameter = snapshot.getDiameter();
+        const int3* snap_image = snapshot.getImage();
+
+        for (unsigned int snap_idx = 0; snap_idx < snapshot.size; snap_idx++)
+            {
+            unsigned int tag = tag_offset + snap_idx;
+            Scalar3 pos = vec_to_scalar3(snap_pos[snap_idx]);
+            int3 img = snap_image[snap_idx];
+            unsigned int rank = placeSnapshotParticle(pos, img, h_cart_ranks.data, tag);
+
+            detail::pdata_element p = {};
+            p.pos = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(snap_type[snap_idx]));
+            p.vel = make_scalar4(snap_vel[snap_idx].x,
+                                 snap_vel[snap_idx].y,
+                                 snap_vel[snap_idx].z,
+                                 snap_mass[snap_idx]);
+            p.accel = vec_to_scalar3(snapshot.accel[snap_idx]);
+            p.charge = snap_charge[snap_idx];
+            p.diameter = snap_diameter[snap_idx];
+            p.image = img;
+            p.body = snapshot.body[snap_idx];
+            p.orientation = quat_to_scalar4(snapshot.orientation[snap_idx]);
+            p.angmom = quat_to_scalar4(snapshot.angmom[snap_idx]);
+            p.inertia = vec_to_scalar3(snapshot.inertia[snap_idx]);
+            p.tag = tag;
+            send_proc[rank].push_back(p);
+
+            max_typeid = std::max(max_typeid, snap_type[snap_idx]);
+            }
+        }
+
+    // exchange the particles with their owners
+    MPI_Datatype mpi_pdata_element;
+    MPI_Type_contiguous(sizeof(detail::pdata_element), MPI_BYTE, &mpi_pdata_element);
+    MPI_Type_commit(&mpi_pdata_element);
+
+    std::vector<int> send_counts(n_ranks), send_displs(n_ranks);
+    std::vector<int> recv_counts(n_ranks), recv_displs(n_ranks);
+    std::vector<detail::pdata_element> send_buf;
+    send_buf.reserve(snapshot.size);
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        {
+        send_counts[rank] = (int)send_proc[rank].size();
+        send_displs[rank] = (int)send_buf.size();
+        send_buf.insert(send_buf.end(), send_proc[rank].begin(), send_proc[rank].end());
+        std::vector<detail::pdata_element>().swap(send_proc[rank]);
+        }
+
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mpi_comm);
+
+    unsigned int n_recv = 0;
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        {
+        recv_displs[rank] = (int)n_recv;
+        n_recv += recv_counts[rank];
+        }
+
+    std::vector<detail::pdata_element> recv_buf(n_recv);
+    MPI_Alltoallv(send_buf.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  mpi_pdata_element,
+                  recv_buf.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  mpi_pdata_element,
+                  mpi_comm);
+    MPI_Type_free(&mpi_pdata_element);
+    std::vector<detail::pdata_element>().swap(send_buf);
+
+    // get type mapping and accel_set flag from the root rank
+    m_type_mapping = snapshot.type_mapping;
+    bcast(m_type_mapping, 0, mpi_comm);
+
+    m_accel_set = snapshot.is_accel_set;
+    bcast(m_accel_set, 0, mpi_comm);
+
+    // resize array for reverse-lookup tags
+    m_rtag.resize(nglobal);
+
+        {
+        // reset all reverse lookup tags to NOT_LOCAL flag
+        ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::overwrite);
+
+        // we have to reset all previous rtags, to remove 'leftover' ghosts
+        unsigned int max_tag = (unsigned int)m_rtag.size();
+        for (unsigned int tag = 0; tag < max_tag; tag++)
+            h_rtag.data[tag] = NOT_LOCAL;
+        }
+
+    // update list of active tags
+    for (unsigned int tag = 0; tag < nglobal; tag++)
+        {
+        m_tag_set.insert(tag);
+        }
+
+    // Now that active tag list has changed, invalidate the cache
+    m_invalid_cached_tags = true;
+
+    // load the received particles (this also notifies subscribers of the new particle order)
+    m_nparticles = 0;
+    addParticles(recv_buf);
+
+    // set global number of particles
+    setNGlobal(nglobal);
+
+    // zero the origin
+    m_origin = make_scalar3(0, 0, 0);
+    m_o_image = make_int3(0, 0, 0);
+
+    // raise an exception if there are any invalid type ids, consistently on all ranks
+    MPI_Allreduce(MPI_IN_PLACE, &max_typeid, 1, MPI_UNSIGNED, MPI_MAX, mpi_comm);
+    if (nglobal != 0 && max_typeid >= m_type_mapping.size())
+        {
+        std::ostringstream s;
+        s << "Particle typeid " << max_typeid << " is invalid in a system with "
+          << m_type_mapping.size() << " types.";
+        throw std::runtime_error(s.str());
+        }
+#endif
+    }
+
 //! take a particle data snapshot
 /* \param snapshot The snapshot to write to
    \returns a map to lookup the snapshot index from a particle tag
@@ -1413,11 +1724,11 @@ Scalar3 ParticleData::getPosition(unsigned int tag) const
     int3 img = make_int3(0, 0, 0);
     if (found)
         {
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read, idx, 1);
         result = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
         result = result - m_origin;
 
-        ArrayHandle<int3> h_img(m_image, access_location::host, access_mode::read);
+        ArrayHandle<int3> h_img(m_image, access_location::host, access_mode::read, idx, 1);
         img = make_int3(h_img.data[idx].x, h_img.data[idx].y, h_img.data[idx].z);
         img.x -= m_o_image.x;
         img.y -= m_o_image.y;
@@ -1450,7 +1761,7 @@ Scalar3 ParticleData::getVelocity(unsigned int tag) const
     Scalar3 result = make_scalar3(0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read, idx, 1);
         result = make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z);
         }
 #ifdef ENABLE_MPI
@@ -1475,7 +1786,7 @@ Scalar3 ParticleData::getAcceleration(unsigned int tag) const
     Scalar3 result = make_scalar3(0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar3> h_accel(m_accel, access_location::host, access_mode::read);
+        ArrayHandle<Scalar3> h_accel(m_accel, access_location::host, access_mode::read, idx, 1);
         result = make_scalar3(h_accel.data[idx].x, h_accel.data[idx].y, h_accel.data[idx].z);
         }
 #ifdef ENABLE_MPI
@@ -1501,8 +1812,8 @@ int3 ParticleData::getImage(unsigned int tag) const
     Scalar3 pos = make_scalar3(0, 0, 0);
     if (found)
         {
-        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::read);
-        ArrayHandle<Scalar4> h_postype(m_pos, access_location::host, access_mode::read);
+        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::read, idx, 1);
+        ArrayHandle<Scalar4> h_postype(m_pos, access_location::host, access_mode::read, idx, 1);
         result = make_int3(h_image.data[idx].x, h_image.data[idx].y, h_image.data[idx].z);
         pos = make_scalar3(h_postype.data[idx].x, h_postype.data[idx].y, h_postype.data[idx].z);
         pos = pos - m_origin;
@@ -1541,7 +1852,7 @@ Scalar ParticleData::getCharge(unsigned int tag) const
     Scalar result = 0.0;
     if (found)
         {
-        ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::read, idx, 1);
         result = h_charge.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1564,7 +1875,7 @@ Scalar ParticleData::getMass(unsigned int tag) const
     Scalar result = 0.0;
     if (found)
         {
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read, idx, 1);
         result = h_vel.data[idx].w;
         }
 #ifdef ENABLE_MPI
@@ -1587,7 +1898,11 @@ Scalar ParticleData::getDiameter(unsigned int tag) const
     Scalar result = 0.0;
     if (found)
         {
-        ArrayHandle<Scalar> h_diameter(m_diameter, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_diameter(m_diameter,
+                                       access_location::host,
+                                       access_mode::read,
+                                       idx,
+                                       1);
         result = h_diameter.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1610,7 +1925,7 @@ unsigned int ParticleData::getBody(unsigned int tag) const
     unsigned int result = 0;
     if (found)
         {
-        ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::read, idx, 1);
         result = h_body.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1633,7 +1948,7 @@ unsigned int ParticleData::getType(unsigned int tag) const
     unsigned int result = 0;
     if (found)
         {
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read, idx, 1);
         result = __scalar_as_int(h_pos.data[idx].w);
         }
 #ifdef ENABLE_MPI
@@ -1656,7 +1971,11 @@ Scalar4 ParticleData::getOrientation(unsigned int tag) const
     Scalar4 result = make_scalar4(0.0, 0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar4> h_orientation(m_orientation, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_orientation,
+                                           access_location::host,
+                                           access_mode::read,
+                                           idx,
+                                           1);
         result = h_orientation.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1682,7 +2001,7 @@ Scalar4 ParticleData::getAngularMomentum(unsigned int tag) const
     Scalar4 result = make_scalar4(0.0, 0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar4> h_angmom(m_angmom, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_angmom(m_angmom, access_location::host, access_mode::read, idx, 1);
         result = h_angmom.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1708,7 +2027,7 @@ Scalar3 ParticleData::getMomentsOfInertia(unsigned int tag) const
     Scalar3 result = make_scalar3(0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar3> h_inertia(m_inertia, access_location::host, access_mode::read);
+        ArrayHandle<Scalar3> h_inertia(m_inertia, access_location::host, access_mode::read, idx, 1);
         result = h_inertia.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1733,7 +2052,11 @@ Scalar4 ParticleData::getPNetForce(unsigned int tag) const
     Scalar4 result = make_scalar4(0.0, 0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar4> h_net_force(m_net_force, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_net_force(m_net_force,
+                                         access_location::host,
+                                         access_mode::read,
+                                         idx,
+                                         1);
         result = h_net_force.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1759,7 +2082,11 @@ Scalar4 ParticleData::getNetTorque(unsigned int tag) const
     Scalar4 result = make_scalar4(0.0, 0.0, 0.0, 0.0);
     if (found)
         {
-        ArrayHandle<Scalar4> h_net_torque(m_net_torque, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_net_torque(m_net_torque,
+                                          access_location::host,
+                                          access_mode::read,
+                                          idx,
+                                          1);
         result = h_net_torque.data[idx];
         }
 #ifdef ENABLE_MPI
@@ -1824,7 +2151,7 @@ void ParticleData::setPosition(unsigned int tag, const Scalar3& pos, bool move)
     int3 img;
     if (ptl_local)
         {
-        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::read);
+        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::read, idx, 1);
         img = h_image.data[idx];
         }
     else
@@ -1839,8 +2166,8 @@ void ParticleData::setPosition(unsigned int tag, const Scalar3& pos, bool move)
     // store position and image
     if (ptl_local)
         {
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::readwrite);
-        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::readwrite, idx, 1);
+        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::readwrite, idx, 1);
 
         h_pos.data[idx].x = tmp_pos.x;
         h_pos.data[idx].y = tmp_pos.y;
@@ -1955,7 +2282,7 @@ void ParticleData::setVelocity(unsigned int tag, const Scalar3& vel)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::readwrite, idx, 1);
         h_vel.data[idx].x = vel.x;
         h_vel.data[idx].y = vel.y;
         h_vel.data[idx].z = vel.z;
@@ -1975,7 +2302,7 @@ void ParticleData::setImage(unsigned int tag, const int3& image)
 #endif
     if (found)
         {
-        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::readwrite, idx, 1);
         h_image.data[idx].x = image.x + m_o_image.x;
         h_image.data[idx].y = image.y + m_o_image.y;
         h_image.data[idx].z = image.z + m_o_image.z;
@@ -1995,7 +2322,11 @@ void ParticleData::setCharge(unsigned int tag, Scalar charge)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar> h_charge(m_charge,
+                                     access_location::host,
+                                     access_mode::readwrite,
+                                     idx,
+                                     1);
         h_charge.data[idx] = charge;
         }
     }
@@ -2013,7 +2344,7 @@ void ParticleData::setMass(unsigned int tag, Scalar mass)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::readwrite, idx, 1);
         h_vel.data[idx].w = mass;
         }
     }
@@ -2031,7 +2362,11 @@ void ParticleData::setDiameter(unsigned int tag, Scalar diameter)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar> h_diameter(m_diameter, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar> h_diameter(m_diameter,
+                                       access_location::host,
+                                       access_mode::readwrite,
+                                       idx,
+                                       1);
         h_diameter.data[idx] = diameter;
         }
     }
@@ -2049,7 +2384,11 @@ void ParticleData::setBody(unsigned int tag, int body)
 #endif
     if (found)
         {
-        ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::readwrite);
+        ArrayHandle<unsigned int> h_body(m_body,
+                                         access_location::host,
+                                         access_mode::readwrite,
+                                         idx,
+                                         1);
         h_body.data[idx] = body;
         }
     }
@@ -2068,7 +2407,7 @@ void ParticleData::setType(unsigned int tag, unsigned int typ)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::readwrite, idx, 1);
         h_pos.data[idx].w = __int_as_scalar(typ);
         // signal that the types have changed
         notifyParticleSort();
@@ -2090,7 +2429,9 @@ void ParticleData::setOrientation(unsigned int tag, const Scalar4& orientation)
         {
         ArrayHandle<Scalar4> h_orientation(m_orientation,
                                            access_location::host,
-                                           access_mode::readwrite);
+                                           access_mode::readwrite,
+                                           idx,
+                                           1);
         h_orientation.data[idx] = orientation;
         }
     }
@@ -2108,7 +2449,11 @@ void ParticleData::setAngularMomentum(unsigned int tag, const Scalar4& angmom)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar4> h_angmom(m_angmom, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_angmom(m_angmom,
+                                      access_location::host,
+                                      access_mode::readwrite,
+                                      idx,
+                                      1);
         h_angmom.data[idx] = angmom;
         }
     }
@@ -2126,7 +2471,11 @@ void ParticleData::setMomentsOfInertia(unsigned int tag, const Scalar3& inertia)
 #endif
     if (found)
         {
-        ArrayHandle<Scalar3> h_inertia(m_inertia, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar3> h_inertia(m_inertia,
+                                       access_location::host,
+                                       access_mode::readwrite,
+                                       idx,
+                                       1);
         h_inertia.data[idx] = inertia;
         }
     }
@@ -2155,11 +2504,11 @@ unsigned int ParticleData::addParticle(unsigned int type)
     // the global tag of the newly created particle
     unsigned int tag;
 
-    // first check if we can recycle a deleted tag
+    // first check if we can recycle a deleted tag, reusing the smallest one keeps the tags compact
     if (m_recycled_tags.size())
         {
-        tag = m_recycled_tags.top();
-        m_recycled_tags.pop();
+        tag = *m_recycled_tags.begin();
+        m_recycled_tags.erase(m_recycled_tags.begin());
         }
     else
         {
@@ -2257,6 +2606,100 @@ unsigned int ParticleData::addParticle(unsigned int type)
     return tag;
     }
 
+/*! \param checkpoint Checkpoint to write
+
+    Copies the local particle arrays into \a checkpoint. Net forces, torques, and virials are not
+    stored, they are recomputed when the next run starts.
+*/
+void ParticleData::takeCheckpoint(ParticleDataCheckpoint& checkpoint)
+    {
+    unsigned int N = getN();
+
+    detail::checkpointLocalArray(m_pos, checkpoint.pos, N, m_exec_conf);
+    detail::checkpointLocalArray(m_vel, checkpoint.vel, N, m_exec_conf);
+    detail::checkpointLocalArray(m_accel, checkpoint.accel, N, m_exec_conf);
+    detail::checkpointLocalArray(m_charge, checkpoint.charge, N, m_exec_conf);
+    detail::checkpointLocalArray(m_diameter, checkpoint.diameter, N, m_exec_conf);
+    detail::checkpointLocalArray(m_image, checkpoint.image, N, m_exec_conf);
+    detail::checkpointLocalArray(m_tag, checkpoint.tag, N, m_exec_conf);
+    detail::checkpointLocalArray(m_body, checkpoint.body, N, m_exec_conf);
+    detail::checkpointLocalArray(m_orientation, checkpoint.orientation, N, m_exec_conf);
+    detail::checkpointLocalArray(m_angmom, checkpoint.angmom, N, m_exec_conf);
+    detail::checkpointLocalArray(m_inertia, checkpoint.inertia, N, m_exec_conf);
+
+    // the reverse lookup is indexed by tag and must match in size on restore
+    if (checkpoint.rtag.getNumElements() != m_rtag.size())
+        {
+        GPUArray<unsigned int> rtag(m_rtag.size(), m_exec_conf);
+        checkpoint.rtag.swap(rtag);
+        }
+    detail::copyLocalArray<unsigned int>(m_rtag,
+                                         checkpoint.rtag,
+                                         (unsigned int)m_rtag.size(),
+                                         m_exec_conf);
+
+    checkpoint.N = N;
+    checkpoint.nglobal = getNGlobal();
+    checkpoint.global_box = getGlobalBox();
+    checkpoint.valid = true;
+    }
+
+/*! \param checkpoint Checkpoint taken on this rank by takeCheckpoint()
+
+    Restores the local particles and the global box. The set of particle tags must not have changed
+    since the checkpoint was taken. In MPI simulations, all ranks must restore checkpoints taken at
+    the same time.
+*/
+void ParticleData::restoreCheckpoint(const ParticleDataCheckpoint& checkpoint)
+    {
+    if (!checkpoint.valid)
+        {
+        throw runtime_error("Cannot restore a checkpoint that has not been taken.");
+        }
+
+    if (checkpoint.nglobal != getNGlobal()
+        || checkpoint.rtag.getNumElements() != m_rtag.size())
+        {
+        throw runtime_error("Cannot restore checkpoint, particles were added or removed "
+                            "since it was taken.");
+        }
+
+    // the local number of particles changes, so remove ghosts
+    removeAllGhostParticles();
+
+    unsigned int N = checkpoint.N;
+    resize(N);
+
+    detail::copyLocalArray(checkpoint.pos, m_pos, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.vel, m_vel, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.accel, m_accel, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.charge, m_charge, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.diameter, m_diameter, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.image, m_image, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.tag, m_tag, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.body, m_body, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.orientation, m_orientation, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.angmom, m_angmom, N, m_exec_conf);
+    detail::copyLocalArray(checkpoint.inertia, m_inertia, N, m_exec_conf);
+    detail::copyLocalArray<unsigned int>(checkpoint.rtag,
+                                         m_rtag,
+                                         (unsigned int)m_rtag.size(),
+                                         m_exec_conf);
+
+        {
+        // no particle is in transit right after the checkpoint is restored
+        ArrayHandle<unsigned int> h_comm_flags(m_comm_flags,
+                                               access_location::host,
+                                               access_mode::overwrite);
+        std::fill(h_comm_flags.data, h_comm_flags.data + N, 0);
+        }
+
+    setGlobalBox(checkpoint.global_box);
+
+    // the particle order has changed
+    notifyParticleSort();
+    }
+
 /*! \param tag Tag of particle to remove
  */
 void ParticleData::removeParticle(unsigned int tag)
@@ -2371,8 +2814,18 @@ void ParticleData::removeParticle(unsigned int tag)
     // remove from set of active tags
     m_tag_set.erase(tag);
 
-    // maintain a stack of deleted group tags for future recycling
-    m_recycled_tags.push(tag);
+    // maintain a set of deleted tags for future recycling
+    m_recycled_tags.insert(tag);
+
+    // When the maximum tag is removed, shrink the reverse lookup table to the new maximum tag and
+    // forget the free tags above it. Reusing the smallest free tags first keeps the size of m_rtag
+    // (and of every array indexed by tag) close to the number of particles in grand canonical runs.
+    if (tag + 1 == m_rtag.size())
+        {
+        unsigned int n_tags = m_tag_set.empty() ? 0 : getMaximumTag() + 1;
+        m_recycled_tags.erase(m_recycled_tags.lower_bound(n_tags), m_recycled_tags.end());
+        m_rtag.resize(n_tags);
+        }
 
     // invalidate active tag cache
     m_invalid_cached_tags = true;
@@ -2465,6 +2918,10 @@ template void
 ParticleData::initializeFromSnapshot<double>(const SnapshotParticleData<double>& snapshot,
                                              bool ignore_bodies);
 template void ParticleData::takeSnapshot<double>(SnapshotParticleData<double>& snapshot);
+template void ParticleData::initializeFromDistributedSnapshot<double>(
+    const SnapshotParticleData<double>& snapshot,
+    unsigned int tag_offset,
+    unsigned int nglobal);
 
 template ParticleData::ParticleData(const SnapshotParticleData<float>& snapshot,
                                     const std::shared_ptr<const BoxDim> global_box,
@@ -2474,6 +2931,10 @@ template void
 ParticleData::initializeFromSnapshot<float>(const SnapshotParticleData<float>& snapshot,
                                             bool ignore_bodies);
 template void ParticleData::takeSnapshot<float>(SnapshotParticleData<float>& snapshot);
+template void ParticleData::initializeFromDistributedSnapshot<float>(
+    const SnapshotParticleData<float>& snapshot,
+    unsigned int tag_offset,
+    unsigned int nglobal);
 
 namespace detail
     {
@@ -2529,15 +2990,26 @@ void export_ParticleData(pybind11::module& m)
         .def("setAngularMomentum", &ParticleData::setAngularMomentum)
         .def("setMomentsOfInertia", &ParticleData::setMomentsOfInertia)
         .def("setPressureFlag", &ParticleData::setPressureFlag)
+        .def("setEnergyFlag", &ParticleData::setEnergyFlag)
+        .def("setAltArraysResident", &ParticleData::setAltArraysResident)
+        .def("getAltArraysResident", &ParticleData::getAltArraysResident)
         .def("getMaximumTag", &ParticleData::getMaximumTag)
         .def("addParticle", &ParticleData::addParticle)
         .def("removeParticle", &ParticleData::removeParticle)
         .def("getNthTag", &ParticleData::getNthTag)
+        .def("takeCheckpoint", &ParticleData::takeCheckpoint)
+        .def("restoreCheckpoint", &ParticleData::restoreCheckpoint)
 #ifdef ENABLE_MPI
         .def("setDomainDecomposition", &ParticleData::setDomainDecomposition)
         .def("getDomainDecomposition", &ParticleData::getDomainDecomposition)
 #endif
         .def("getTypes", &ParticleData::getTypesPy);
+
+    pybind11::class_<ParticleDataCheckpoint, std::shared_ptr<ParticleDataCheckpoint>>(
+        m,
+        "ParticleDataCheckpoint")
+        .def(pybind11::init<>())
+        .def_readonly("valid", &ParticleDataCheckpoint::valid);
     }
 
     } // end namespace detail
@@ -2551,14 +3023,28 @@ SnapshotParticleData<Real>::SnapshotParticleData(unsigned int N) : size(N), is_a
 
 template<class Real> void SnapshotParticleData<Real>::resize(unsigned int N)
     {
-    pos.resize(N, vec3<Real>(0.0, 0.0, 0.0));
-    vel.resize(N, vec3<Real>(0.0, 0.0, 0.0));
+    // adopted arrays have a fixed size
+    if (N != size)
+        {
+        materialize();
+        }
+
+    // leave the storage of adopted fields empty
+    if (!m_adopted_pos.data)
+        pos.resize(N, vec3<Real>(0.0, 0.0, 0.0));
+    if (!m_adopted_vel.data)
+        vel.resize(N, vec3<Real>(0.0, 0.0, 0.0));
     accel.resize(N, vec3<Real>(0.0, 0.0, 0.0));
-    type.resize(N, 0);
-    mass.resize(N, Scalar(1.0));
-    charge.resize(N, Scalar(0.0));
-    diameter.resize(N, Scalar(1.0));
-    image.resize(N, make_int3(0, 0, 0));
+    if (!m_adopted_type.data)
+        type.resize(N, 0);
+    if (!m_adopted_mass.data)
+        mass.resize(N, Scalar(1.0));
+    if (!m_adopted_charge.data)
+        charge.resize(N, Scalar(0.0));
+    if (!m_adopted_diameter.data)
+        diameter.resize(N, Scalar(1.0));
+    if (!m_adopted_image.data)
+        image.resize(N, make_int3(0, 0, 0));
     body.resize(N, NO_BODY);
     orientation.resize(N, quat<Real>(1.0, vec3<Real>(0.0, 0.0, 0.0)));
     angmom.resize(N, quat<Real>(0.0, vec3<Real>(0.0, 0.0, 0.0)));
@@ -2570,6 +3056,7 @@ template<class Real> void SnapshotParticleData<Real>::resize(unsigned int N)
 template<class Real> void SnapshotParticleData<Real>::insert(unsigned int i, unsigned int n)
     {
     assert(i <= size);
+    materialize();
     pos.insert(pos.begin() + i, n, vec3<Real>(0.0, 0.0, 0.0));
     vel.insert(vel.begin() + i, n, vec3<Real>(0.0, 0.0, 0.0));
     accel.insert(accel.begin() + i, n, vec3<Real>(0.0, 0.0, 0.0));
@@ -2588,11 +3075,14 @@ template<class Real> void SnapshotParticleData<Real>::insert(unsigned int i, uns
 
 template<class Real> void SnapshotParticleData<Real>::validate() const
     {
-    // Check if all other fields are of equal length==size
-    if (pos.size() != size || vel.size() != size || accel.size() != size || type.size() != size
-        || mass.size() != size || charge.size() != size || diameter.size() != size
-        || image.size() != size || body.size() != size || orientation.size() != size
-        || angmom.size() != size || inertia.size() != size)
+    // Check if all other fields are of equal length==size, adopted fields are checked in adopt()
+    if ((!m_adopted_pos.data && pos.size() != size) || (!m_adopted_vel.data && vel.size() != size)
+        || accel.size() != size || (!m_adopted_type.data && type.size() != size)
+        || (!m_adopted_mass.data && mass.size() != size)
+        || (!m_adopted_charge.data && charge.size() != size)
+        || (!m_adopted_diameter.data && diameter.size() != size)
+        || (!m_adopted_image.data && image.size() != size) || body.size() != size
+        || orientation.size() != size || angmom.size() != size || inertia.size() != size)
         {
         throw std::runtime_error("All array sizes must match.");
         }
@@ -2607,6 +3097,123 @@ template<class Real> void SnapshotParticleData<Real>::validate() const
         }
     }
 
+namespace detail
+    {
+//! Adopt a NumPy array into a snapshot field
+/*! \param adopted Adopted array of the field
+    \param storage Storage of the field, released when the array is adopted
+    \param array Array to adopt
+    \param size Number of particles in the snapshot, 0 to accept any length
+    \param width Number of elements of type T per particle
+    \param name Name of the field for error messages
+*/
+template<class T, class Element>
+static void adoptArray(AdoptedArray& adopted,
+                       std::vector<Element>& storage,
+                       pybind11::array array,
+                       unsigned int size,
+                       size_t width,
+                       const std::string& name)
+    {
+    static_assert(sizeof(Element) % sizeof(T) == 0, "Element must be an array of T");
+    if (!pybind11::isinstance<pybind11::array_t<T, pybind11::array::c_style>>(array))
+        {
+        throw std::invalid_argument(name + ": the array must be C-contiguous and have dtype "
+                                    + std::string(pybind11::str(pybind11::dtype::of<T>())));
+        }
+
+    size_t n = array.ndim() > 0 ? array.shape(0) : 0;
+    bool shape_ok = (width == 1 && array.ndim() == 1)
+                    || (width > 1 && array.ndim() == 2 && size_t(array.shape(1)) == width);
+    if (!shape_ok || (size != 0 && n != size))
+        {
+        std::ostringstream s;
+        s << name << ": the array must have the shape (" << (size != 0 ? size : n);
+        if (width > 1)
+            s << ", " << width;
+        s << ")";
+        throw std::invalid_argument(s.str());
+        }
+
+    adopted.data = array.data();
+    adopted.owner = array;
+    std::vector<Element>().swap(storage);
+    }
+
+//! Copy an adopted array into the field storage and release it
+template<class Element>
+static void
+materializeArray(AdoptedArray& adopted, std::vector<Element>& storage, unsigned int size)
+    {
+    if (!adopted.data)
+        return;
+
+    const Element* data = (const Element*)adopted.data;
+    storage.assign(data, data + size);
+    adopted.data = nullptr;
+    adopted.owner = pybind11::object();
+    }
+
+    } // end namespace detail
+
+template<class Real>
+void SnapshotParticleData<Real>::adopt(const std::string& field, pybind11::array array)
+    {
+    // an empty snapshot takes its size from the adopted array
+    unsigned int expected_size = size;
+    if (field == "position")
+        {
+        detail::adoptArray<Real>(m_adopted_pos, pos, array, expected_size, 3, field);
+        }
+    else if (field == "velocity")
+        {
+        detail::adoptArray<Real>(m_adopted_vel, vel, array, expected_size, 3, field);
+        }
+    else if (field == "typeid")
+        {
+        detail::adoptArray<unsigned int>(m_adopted_type, type, array, expected_size, 1, field);
+        }
+    else if (field == "mass")
+        {
+        detail::adoptArray<Real>(m_adopted_mass, mass, array, expected_size, 1, field);
+        }
+    else if (field == "charge")
+        {
+        detail::adoptArray<Real>(m_adopted_charge, charge, array, expected_size, 1, field);
+        }
+    else if (field == "diameter")
+        {
+        detail::adoptArray<Real>(m_adopted_diameter, diameter, array, expected_size, 1, field);
+        }
+    else if (field == "image")
+        {
+        detail::adoptArray<int>(m_adopted_image, image, array, expected_size, 3, field);
+        }
+    else
+        {
+        throw std::invalid_argument("Cannot adopt the field " + field);
+        }
+
+    if (expected_size == 0)
+        {
+        // allocate the remaining fields, the adopted one keeps its storage empty
+        size = (unsigned int)array.shape(0);
+        resize(size);
+        }
+    is_accel_set = false;
+    }
+
+template<class Real> void SnapshotParticleData<Real>::materialize()
+    {
+    detail::materializeArray(m_adopted_pos, pos, size);
+    detail::materializeArray(m_adopted_vel, vel, size);
+    detail::materializeArray(m_adopted_type, type, size);
+    detail::materializeArray(m_adopted_mass, mass, size);
+    detail::materializeArray(m_adopted_charge, charge, size);
+    detail::materializeArray(m_adopted_diameter, diameter, size);
+    detail::materializeArray(m_adopted_image, image, size);
+    }
+
 #ifdef ENABLE_MPI
 //! Select non-zero communication lags
 struct comm_flag_select
@@ -2656,6 +3263,8 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
     // resize particle data using amortized O(1) array resizing
     resize(new_nparticles);
 
+    acquireAltArrays();
+
         {
         // access particle data arrays
         ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
@@ -2811,6 +3420,8 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
     swapNetVirial();
     swapTags();
 
+    releaseAltArrays();
+
         {
         ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::read);
@@ -2950,6 +3561,8 @@ void ParticleData::removeParticlesGPU(GPUVector<detail::pdata_element>& out,
 
     bool done = false;
 
+    acquireAltArrays();
+
     // copy without writing past the end of the output array, resizing it as needed
     while (!done)
         {
@@ -3114,6 +3727,8 @@ void ParticleData::removeParticlesGPU(GPUVector<detail::pdata_element>& out,
     swapNetVirial();
     swapTags();
 
+    releaseAltArrays();
+
     // notify subscribers
     notifyParticleSort();
     }
@@ -3298,6 +3913,11 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getPosNP(pybin
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_pos.data)
+        {
+        return self_cpp->m_adopted_pos.owner;
+        }
+
     std::vector<size_t> dims(2);
     dims[0] = self_cpp->pos.size();
     dims[1] = 3;
@@ -3318,8 +3938,13 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getVelNP(pybin
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_vel.data)
+        {
+        return self_cpp->m_adopted_vel.owner;
+        }
+
     std::vector<size_t> dims(2);
-    dims[0] = self_cpp->pos.size();
+    dims[0] = self_cpp->vel.size();
     dims[1] = 3;
     if (dims[0] == 0)
         {
@@ -3339,7 +3964,7 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getAccelNP(pyb
     self_cpp->is_accel_set = false;
 
     std::vector<size_t> dims(2);
-    dims[0] = self_cpp->pos.size();
+    dims[0] = self_cpp->accel.size();
     dims[1] = 3;
     if (dims[0] == 0)
         {
@@ -3358,6 +3983,11 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getTypeNP(pybi
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_type.data)
+        {
+        return self_cpp->m_adopted_type.owner;
+        }
+
     if (self_cpp->type.size() == 0)
         {
         return pybind11::array(pybind11::dtype::of<unsigned int>(), 0, nullptr);
@@ -3375,6 +4005,11 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getMassNP(pybi
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_mass.data)
+        {
+        return self_cpp->m_adopted_mass.owner;
+        }
+
     if (self_cpp->mass.size() == 0)
         {
         return pybind11::array(pybind11::dtype::of<Real>(), 0, nullptr);
@@ -3392,6 +4027,11 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getChargeNP(py
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_charge.data)
+        {
+        return self_cpp->m_adopted_charge.owner;
+        }
+
     if (self_cpp->charge.size() == 0)
         {
         return pybind11::array(pybind11::dtype::of<Real>(), 0, nullptr);
@@ -3410,6 +4050,11 @@ pybind11::object SnapshotParticleData<Real>::getDiameterNP(pybind11::object self
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_diameter.data)
+        {
+        return self_cpp->m_adopted_diameter.owner;
+        }
+
     if (self_cpp->diameter.size() == 0)
         {
         return pybind11::array(pybind11::dtype::of<Real>(), 0, nullptr);
@@ -3427,8 +4072,13 @@ template<class Real> pybind11::object SnapshotParticleData<Real>::getImageNP(pyb
     // mark as dirty when accessing internal data
     self_cpp->is_accel_set = false;
 
+    if (self_cpp->m_adopted_image.data)
+        {
+        return self_cpp->m_adopted_image.owner;
+        }
+
     std::vector<size_t> dims(2);
-    dims[0] = self_cpp->pos.size();
+    dims[0] = self_cpp->image.size();
     dims[1] = 3;
 
     if (dims[0] == 0)
@@ -3467,7 +4117,7 @@ pybind11::object SnapshotParticleData<Real>::getOrientationNP(pybind11::object s
     self_cpp->is_accel_set = false;
 
     std::vector<size_t> dims(2);
-    dims[0] = self_cpp->pos.size();
+    dims[0] = self_cpp->orientation.size();
     dims[1] = 4;
 
     if (dims[0] == 0)
@@ -3548,6 +4198,8 @@ template<class Real> void SnapshotParticleData<Real>::setTypes(pybind11::list ty
 #ifdef ENABLE_MPI
 template<class Real> void SnapshotParticleData<Real>::bcast(unsigned int root, MPI_Comm mpi_comm)
     {
+    materialize();
+
     // broadcast all member quantities
     hoomd::bcast(pos, root, mpi_comm);
     hoomd::bcast(vel, root, mpi_comm);
@@ -3598,7 +4250,8 @@ void export_SnapshotParticleData(pybind11::module& m)
         .def_property("N",
                       &SnapshotParticleData<float>::getSize,
                       &SnapshotParticleData<float>::resize)
-        .def_readonly("is_accel_set", &SnapshotParticleData<float>::is_accel_set);
+        .def_readonly("is_accel_set", &SnapshotParticleData<float>::is_accel_set)
+        .def("adopt", &SnapshotParticleData<float>::adopt);
 
     pybind11::class_<SnapshotParticleData<double>, std::shared_ptr<SnapshotParticleData<double>>>(
         m,
@@ -3622,7 +4275,8 @@ void export_SnapshotParticleData(pybind11::module& m)
         .def_property("N",
                       &SnapshotParticleData<double>::getSize,
                       &SnapshotParticleData<double>::resize)
-        .def_readonly("is_accel_set", &SnapshotParticleData<double>::is_accel_set);
+        .def_readonly("is_accel_set", &SnapshotParticleData<double>::is_accel_set)
+        .def("adopt", &SnapshotParticleData<double>::adopt);
     }
 
     } // end namespace detail
@@ -40,7 +40,7 @@
 #include "DomainDecomposition.h"
 
 #include <bitset>
-#include <stack>
+#include <set>
 #include <stdlib.h>
 #include <string>
 #include <vector>
@@ -64,6 +64,8 @@
 
 namespace hoomd
     {
+class ParticleDataSoA;
+
 //! List of optional fields that can be enabled in ParticleData
 struct pdata_flag
     {
@@ -72,8 +74,9 @@ struct pdata_flag
         {
         pressure_tensor = 0,       //!< Bit id in PDataFlags for the full virial
         rotational_kinetic_energy, //!< Bit id in PDataFlags for the rotational kinetic energy
-        external_field_virial      //!< Bit id in PDataFlags for the external virial contribution of
+        external_field_virial,     //!< Bit id in PDataFlags for the external virial contribution of
                                    //!< volume change
+        potential_energy           //!< Bit id in PDataFlags for the potential energy
         };
     };
 
@@ -114,6 +117,20 @@ std::string getDefaultTypeName(unsigned int id);
 
     } // end namespace detail
 
+namespace detail
+    {
+//! Externally owned array adopted by a snapshot
+/*! The snapshot reads the adopted data in place and holds a reference to the Python object that
+    owns it, so the buffer lives as long as the snapshot uses it.
+*/
+struct AdoptedArray
+    {
+    const void* data = nullptr; //!< Adopted data, nullptr when the field is stored in the vector
+    pybind11::object owner;     //!< Python object that owns the data
+    };
+
+    } // end namespace detail
+
 //! Handy structure for passing around per-particle data
 /*! A snapshot is used for two purposes:
  * - Initializing the ParticleData
@@ -190,6 +207,62 @@ template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
                    const BoxDim& old_box,
                    const BoxDim& new_box);
 
+    //! Adopt an externally owned array as the data of a field
+    /*! \param field Name of the field: position, velocity, typeid, mass, charge, diameter, or image
+        \param array C-contiguous NumPy array (or any buffer) with the dtype and shape of the field
+
+        The snapshot reads the array in place instead of copying it into its own storage. Adopting
+        a field into an empty snapshot sets the number of particles to the length of the array.
+        Operations that modify the snapshot (resize, insert, replicate, wrap) first copy the
+        adopted arrays into the snapshot's own storage.
+    */
+    void adopt(const std::string& field, pybind11::array array);
+
+    //! Copy all adopted arrays into the snapshot's own storage and release them
+    void materialize();
+
+    //! Get the positions, adopted or owned
+    const vec3<Real>* getPos() const
+        {
+        return m_adopted_pos.data ? (const vec3<Real>*)m_adopted_pos.data : pos.data();
+        }
+
+    //! Get the velocities, adopted or owned
+    const vec3<Real>* getVel() const
+        {
+        return m_adopted_vel.data ? (const vec3<Real>*)m_adopted_vel.data : vel.data();
+        }
+
+    //! Get the type ids, adopted or owned
+    const unsigned int* getType() const
+        {
+        return m_adopted_type.data ? (const unsigned int*)m_adopted_type.data : type.data();
+        }
+
+    //! Get the masses, adopted or owned
+    const Real* getMass() const
+        {
+        return m_adopted_mass.data ? (const Real*)m_adopted_mass.data : mass.data();
+        }
+
+    //! Get the charges, adopted or owned
+    const Real* getCharge() const
+        {
+        return m_adopted_charge.data ? (const Real*)m_adopted_charge.data : charge.data();
+        }
+
+    //! Get the diameters, adopted or owned
+    const Real* getDiameter() const
+        {
+        return m_adopted_diameter.data ? (const Real*)m_adopted_diameter.data : diameter.data();
+        }
+
+    //! Get the images, adopted or owned
+    const int3* getImage() const
+        {
+        return m_adopted_image.data ? (const int3*)m_adopted_image.data : image.data();
+        }
+
     //! Get pos as a Python object
     static pybind11::object getPosNP(pybind11::object self);
     //! Get vel as a Python object
@@ -237,6 +310,15 @@ template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
     std::vector<std::string> type_mapping; //!< Mapping between particle type ids and names
 
     bool is_accel_set; //!< Flag indicating if accel is set
+
+    private:
+    detail::AdoptedArray m_adopted_pos;      //!< Adopted positions
+    detail::AdoptedArray m_adopted_vel;      //!< Adopted velocities
+    detail::AdoptedArray m_adopted_type;     //!< Adopted type ids
+    detail::AdoptedArray m_adopted_mass;     //!< Adopted masses
+    detail::AdoptedArray m_adopted_charge;   //!< Adopted charges
+    detail::AdoptedArray m_adopted_diameter; //!< Adopted diameters
+    detail::AdoptedArray m_adopted_image;    //!< Adopted images
     };
 
 namespace detail
@@ -264,6 +346,35 @@ struct pdata_element
 
     } // end namespace detail
 
+//! Copy of the local particles of one rank used to quickly roll back the particle data
+/*! A checkpoint holds copies of the local (non-ghost) particle arrays and the reverse tag lookup in
+    the memory space the particle data is used in. Taking and restoring a checkpoint does not gather
+    any data, so a checkpoint is only valid on the rank that took it. The arrays are reused when the
+    same checkpoint is taken again.
+
+    See ParticleData::takeCheckpoint() and ParticleData::restoreCheckpoint().
+*/
+struct PYBIND11_EXPORT ParticleDataCheckpoint
+    {
+    unsigned int N = 0;       //!< Number of local particles
+    unsigned int nglobal = 0; //!< Global number of particles
+    bool valid = false;       //!< True when the checkpoint holds particle data
+    BoxDim global_box;        //!< Global simulation box
+
+    GPUArray<Scalar4> pos;          //!< particle positions and types
+    GPUArray<Scalar4> vel;          //!< particle velocities and masses
+    GPUArray<Scalar3> accel;        //!< particle accelerations
+    GPUArray<Scalar> charge;        //!< particle charges
+    GPUArray<Scalar> diameter;      //!< particle diameters
+    GPUArray<int3> image;           //!< particle images
+    GPUArray<unsigned int> tag;     //!< particle tags
+    GPUArray<unsigned int> rtag;    //!< reverse lookup tags
+    GPUArray<unsigned int> body;    //!< rigid body ids
+    GPUArray<Scalar4> orientation;  //!< particle orientations
+    GPUArray<Scalar4> angmom;       //!< particle angular momenta
+    GPUArray<Scalar3> inertia;      //!< particle principal moments of inertia
+    };
+
 //! Manages all of the data arrays for the particles
 /*! <h1> General </h1>
     ParticleData stores and manages particle coordinates, velocities, accelerations, type,
@@ -312,6 +423,8 @@ struct pdata_element
     These fields are:
      - pdata_flag::pressure_tensor - specify that the full virial tensor is valid
      - pdata_flag::external_field_virial - specify that an external virial contribution is valid
+     - pdata_flag::potential_energy - specify that the per particle potential energy is valid (set
+       by default)
 
     If these flags are not set, these arrays can still be read but their values may be incorrect.
 
@@ -832,6 +945,36 @@ class PYBIND11_EXPORT ParticleData
         m_inertia.swap(m_inertia_alt);
         }
 
+    //! Set whether the alternate arrays stay allocated between reorders
+    /*! When \a resident is false, the alternate arrays are freed and only allocated for the
+        duration of each reorder (acquireAltArrays() to releaseAltArrays()). This trades an
+        allocation per reorder for the memory of a second copy of the per-particle data.
+    */
+    void setAltArraysResident(bool resident)
+        {
+        m_alt_arrays_resident = resident;
+        if (resident)
+            acquireAltArrays();
+        else
+            releaseAltArrays();
+        }
+
+    //! Get whether the alternate arrays stay allocated between reorders
+    bool getAltArraysResident() const
+        {
+        return m_alt_arrays_resident;
+        }
+
+    //! Allocate the alternate arrays if they are not allocated
+    /*! Call before writing to the alternate arrays.
+     */
+    void acquireAltArrays();
+
+    //! Free the alternate arrays unless they stay resident
+    /*! Call after swapping in the reordered data.
+     */
+    void releaseAltArrays();
+
     //! Connects a function to be called every time the particles are rearranged in memory
     Nano::Signal<void()>& getParticleSortSignal()
         {
@@ -841,6 +984,23 @@ class PYBIND11_EXPORT ParticleData
     //! Notify listeners that the particles have been rearranged in memory
     void notifyParticleSort();
 
+    //! Notify listeners that the local particles have been permuted in memory
+    /*! \param order Index i now holds the local particle that was at index order[i]
+     */
+    void notifyParticleSort(const unsigned int* order);
+
+    //! Get the permutation of the sort being notified
+    /*! \returns The order passed to notifyParticleSort(), or nullptr when the sort did not
+        provide one. Only valid in the slots connected to the particle sort signal.
+     */
+    const unsigned int* getSortOrder() const
+        {
+        return m_sort_order;
+        }
+
+    //! Get the structure-of-arrays mirror of the positions and types
+    ParticleDataSoA& getSoA();
+
     //! Connects a function to be called every time the box size is changed
     Nano::Signal<void()>& getBoxChangeSignal()
         {
@@ -980,7 +1140,7 @@ class PYBIND11_EXPORT ParticleData
     inline unsigned int getRTag(unsigned int tag) const
         {
         assert(tag < m_rtag.size());
-        ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::read, tag, 1);
         unsigned int idx = h_rtag.data[tag];
 #ifdef ENABLE_MPI
         assert(m_decomposition || idx < getN());
@@ -1091,6 +1251,12 @@ class PYBIND11_EXPORT ParticleData
         m_flags[pdata_flag::pressure_tensor] = 1;
         }
 
+    /// Enable potential energy computations
+    void setEnergyFlag()
+        {
+        m_flags[pdata_flag::potential_energy] = 1;
+        }
+
     //! Set the external contribution to the virial
     void setExternalVirial(unsigned int i, Scalar v)
         {
@@ -1128,9 +1294,21 @@ class PYBIND11_EXPORT ParticleData
     void initializeFromSnapshot(const SnapshotParticleData<Real>& snapshot,
                                 bool ignore_bodies = false);
 
+    //! Initialize from a snapshot that is distributed over the ranks
+    template<class Real>
+    void initializeFromDistributedSnapshot(const SnapshotParticleData<Real>& snapshot,
+                                           unsigned int tag_offset,
+                                           unsigned int nglobal);
+
     //! Take a snapshot
     template<class Real> void takeSnapshot(SnapshotParticleData<Real>& snapshot);
 
+    //! Copy the local particles into a checkpoint
+    void takeCheckpoint(ParticleDataCheckpoint& checkpoint);
+
+    //! Restore the local particles from a checkpoint
+    void restoreCheckpoint(const ParticleDataCheckpoint& checkpoint);
+
     //! Add ghost particles at the end of the local particle data
     void addGhostParticles(const unsigned int nghosts);
 
@@ -1252,6 +1430,7 @@ class PYBIND11_EXPORT ParticleData
 
     Nano::Signal<void()>
         m_sort_signal; //!< Signal that is triggered when particles are sorted in memory
+    const unsigned int* m_sort_order = nullptr; //!< Permutation of the sort being notified
     Nano::Signal<void()> m_boxchange_signal; //!< Signal that is triggered when the box size changes
     Nano::Signal<void()> m_max_particle_num_signal; //!< Signal that is triggered when the maximum
                                                     //!< particle number changes
@@ -1287,8 +1466,8 @@ class PYBIND11_EXPORT ParticleData
     GPUArray<Scalar3> m_inertia;         //!< Principal moments of inertia for each particle
     GPUArray<unsigned int> m_comm_flags; //!< Array of communication flags
 
-    std::stack<unsigned int> m_recycled_tags; //!< Global tags of removed particles
-    std::set<unsigned int> m_tag_set;         //!< Lookup table for tags by active index
+    std::set<unsigned int> m_recycled_tags; //!< Free global tags below the maximum tag
+    std::set<unsigned int> m_tag_set;       //!< Lookup table for tags by active index
     std::vector<unsigned int>
         m_cached_tag_set;       //!< Cached constant-time lookup table for tags by active index
     bool m_invalid_cached_tags; //!< true if m_cached_tag_set needs to be rebuilt
@@ -1316,6 +1495,7 @@ class PYBIND11_EXPORT ParticleData
     GPUArray<Scalar4> m_net_force_alt; //!< Net force (swap-in)
     GPUArray<Scalar> m_net_virial_alt; //!< Net virial (swap-in)
     GPUArray<Scalar4> m_net_torque_alt; //!< Net torque (swap-in)
+    bool m_alt_arrays_resident = true;  //!< True when the alternate arrays stay allocated
 
     GPUArray<Scalar4> m_net_force;  //!< Net force calculated for each particle
     GPUArray<Scalar> m_net_virial;  //!< Net virial calculated for each particle (2D GPU array of
@@ -1333,6 +1513,8 @@ class PYBIND11_EXPORT ParticleData
 
     bool m_arrays_allocated; //!< True if arrays have been initialized
 
+    std::unique_ptr<ParticleDataSoA> m_soa; //!< SoA mirror (created on first use)
+
     //! Helper function to allocate particle data
     void allocate(unsigned int N);
 
@@ -1348,6 +1530,14 @@ class PYBIND11_EXPORT ParticleData
     //! Helper function to rebuild the active tag cache if necessary
     void maybe_rebuild_tag_cache();
 
+#ifdef ENABLE_MPI
+    //! Helper function to determine the rank that owns a snapshot particle
+    unsigned int placeSnapshotParticle(Scalar3& pos,
+                                       int3& img,
+                                       const unsigned int* cart_ranks,
+                                       unsigned int idx) const;
+#endif
+
     //! Helper function to check that particles of a snapshot are in the box
     /*! \return true If and only if all particles are in the simulation box
      * \param Snapshot to check
@@ -0,0 +1,96 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ParticleDataSoA.cc
+    \brief Defines the ParticleDataSoA class
+*/
+
+#include "ParticleDataSoA.h"
+#include "ParticleData.h"
+
+namespace hoomd
+    {
+/*! \param pdata Particle data to mirror
+ */
+ParticleDataSoA::ParticleDataSoA(ParticleData& pdata)
+    : m_pdata(pdata), m_n_local(0), m_timestep(0), m_pos_version(0), m_local_valid(false),
+      m_ghosts_valid(false)
+    {
+    m_pdata.getParticleSortSignal().connect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    m_pdata.getMaxParticleNumberChangeSignal()
+        .connect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    m_pdata.getGhostParticlesRemovedSignal()
+        .connect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    m_pdata.getGlobalParticleNumberChangeSignal()
+        .connect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    }
+
+ParticleDataSoA::~ParticleDataSoA()
+    {
+    m_pdata.getParticleSortSignal().disconnect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    m_pdata.getMaxParticleNumberChangeSignal()
+        .disconnect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    m_pdata.getGhostParticlesRemovedSignal()
+        .disconnect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    m_pdata.getGlobalParticleNumberChangeSignal()
+        .disconnect<ParticleDataSoA, &ParticleDataSoA::invalidate>(this);
+    }
+
+/*! \param timestep Current timestep
+ */
+void ParticleDataSoA::update(uint64_t timestep)
+    {
+    updateLocal(timestep);
+
+    if (!m_ghosts_valid)
+        {
+        copyRange(m_n_local, getSize());
+        m_ghosts_valid = true;
+        }
+    }
+
+/*! \param timestep Current timestep
+ */
+void ParticleDataSoA::updateLocal(uint64_t timestep)
+    {
+    const unsigned int n_local = m_pdata.getN();
+    const unsigned int n = n_local + m_pdata.getNGhosts();
+    const uint64_t pos_version = m_pdata.getPositions().getVersion();
+    if (m_timestep != timestep || m_pos_version != pos_version || m_n_local != n_local
+        || n != m_x.size())
+        {
+        invalidate();
+        }
+
+    m_x.resize(n);
+    m_y.resize(n);
+    m_z.resize(n);
+    m_type.resize(n);
+    m_n_local = n_local;
+    m_timestep = timestep;
+    m_pos_version = pos_version;
+
+    if (!m_local_valid)
+        {
+        copyRange(0, n_local);
+        m_local_valid = true;
+        }
+    }
+
+/*! \param begin First element to copy
+    \param end One past the last element to copy
+*/
+void ParticleDataSoA::copyRange(unsigned int begin, unsigned int end)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata.getPositions(), access_location::host, access_mode::read);
+    for (unsigned int i = begin; i < end; i++)
+        {
+        const Scalar4 postype = h_pos.data[i];
+        m_x[i] = postype.x;
+        m_y[i] = postype.y;
+        m_z[i] = postype.z;
+        m_type[i] = __scalar_as_int(postype.w);
+        }
+    }
+
+    } // end namespace hoomd
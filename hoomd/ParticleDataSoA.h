@@ -0,0 +1,118 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ParticleDataSoA.h
+    \brief Declares the ParticleDataSoA class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __PARTICLE_DATA_SOA_H__
+#define __PARTICLE_DATA_SOA_H__
+
+#include "HOOMDMath.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+class ParticleData;
+
+//! Structure-of-arrays mirror of the particle positions and types
+/*! ParticleData stores positions and types interleaved in Scalar4 elements, which suits coalesced
+    access on the GPU. CPU kernels that process many particles at once vectorize better when they
+    read x, y, z, and the type from separate contiguous arrays. ParticleDataSoA holds such a copy of
+    the local and ghost particles.
+
+    Obtain the mirror with ParticleData::getSoA() and call update() with the current timestep
+    before reading the arrays. update() copies the data from ParticleData when the mirror is out of
+    date. The mirror is current after the first update() at a given timestep until the position
+    array is acquired for writing (GPUArray::getVersion() changes), the particles are sorted or
+    migrated, or the ghost particles are removed. invalidate() forces a copy at the next update().
+
+    updateLocal() refreshes only the local particles. Use it while a ghost update is in flight:
+    the ghost elements keep their previous values until the next update().
+
+    Elements with indices in [0, getN()) are the local particles and elements with indices in
+    [getN(), getN() + getNGhosts()) are the ghost particles, matching the order in ParticleData.
+
+    \ingroup data_structs
+*/
+class PYBIND11_EXPORT ParticleDataSoA
+    {
+    public:
+    //! Construct the mirror
+    explicit ParticleDataSoA(ParticleData& pdata);
+
+    //! Destructor
+    ~ParticleDataSoA();
+
+    ParticleDataSoA(const ParticleDataSoA&) = delete;
+    ParticleDataSoA& operator=(const ParticleDataSoA&) = delete;
+
+    //! Bring the mirror up to date with the particle data at the given timestep
+    void update(uint64_t timestep);
+
+    //! Bring the local particles in the mirror up to date at the given timestep
+    void updateLocal(uint64_t timestep);
+
+    //! Mark the mirror as out of date
+    void invalidate()
+        {
+        m_local_valid = false;
+        m_ghosts_valid = false;
+        }
+
+    //! Get the x coordinates
+    const Scalar* getX() const
+        {
+        return m_x.data();
+        }
+
+    //! Get the y coordinates
+    const Scalar* getY() const
+        {
+        return m_y.data();
+        }
+
+    //! Get the z coordinates
+    const Scalar* getZ() const
+        {
+        return m_z.data();
+        }
+
+    //! Get the type indices
+    const unsigned int* getTypes() const
+        {
+        return m_type.data();
+        }
+
+    //! Get the number of elements in the mirror (local and ghost particles)
+    unsigned int getSize() const
+        {
+        return (unsigned int)m_x.size();
+        }
+
+    private:
+    //! Copy elements [begin, end) from the particle data
+    void copyRange(unsigned int begin, unsigned int end);
+
+    ParticleData& m_pdata;            //!< Particle data to mirror
+    std::vector<Scalar> m_x;          //!< x coordinates
+    std::vector<Scalar> m_y;          //!< y coordinates
+    std::vector<Scalar> m_z;          //!< z coordinates
+    std::vector<unsigned int> m_type; //!< Type indices
+    unsigned int m_n_local;           //!< Number of local particles in the mirror
+    uint64_t m_timestep;              //!< Timestep of the last update
+    uint64_t m_pos_version;           //!< Version of the position array at the last update
+    bool m_local_valid;               //!< True when the local elements are current
+    bool m_ghosts_valid;              //!< True when the ghost elements are current
+    };
+
+    } // end namespace hoomd
+#endif
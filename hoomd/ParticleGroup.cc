@@ -173,7 +173,13 @@ void ParticleGroup::updateMemberTags(bool force_update)
 
         // assign all of the particles that belong to the group
         // for each particle in the (global) data
-        vector<unsigned int> member_tags = m_selector->getSelectedTags(m_sysdef);
+        vector<unsigned int> member_tags;
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled() && m_selector->canFlagMembers())
+            member_tags = getSelectedTagsGPU();
+        else
+#endif
+            member_tags = m_selector->getSelectedTags(m_sysdef);
 
 #ifdef ENABLE_MPI
         if (m_pdata->getDomainDecomposition())
@@ -184,17 +190,18 @@ void ParticleGroup::updateMemberTags(bool force_update)
 
             assert(member_tags_proc.size() == m_exec_conf->getNRanks());
 
-            // combine all tags into an ordered set
+            // combine all tags, filters may select the same tag on several ranks
             unsigned int n_ranks = m_exec_conf->getNRanks();
-            std::set<unsigned int> tag_set;
+            member_tags.clear();
             for (unsigned int irank = 0; irank < n_ranks; ++irank)
                 {
-                tag_set.insert(member_tags_proc[irank].begin(), member_tags_proc[irank].end());
+                member_tags.insert(member_tags.end(),
+                                   member_tags_proc[irank].begin(),
+                                   member_tags_proc[irank].end());
                 }
-
-            // construct list
-            member_tags.clear();
-            member_tags.insert(member_tags.begin(), tag_set.begin(), tag_set.end());
+            std::sort(member_tags.begin(), member_tags.end());
+            member_tags.erase(std::unique(member_tags.begin(), member_tags.end()),
+                              member_tags.end());
             }
 #endif
 
@@ -502,13 +509,18 @@ void ParticleGroup::buildTagHash()
         }
     }
 
-/*! \pre m_member_tags has been filled out, listing all particle tags in the group
+/*! \param incremental Set to true when only the particle order changed since the last rebuild
+    \pre m_member_tags has been filled out, listing all particle tags in the group
     \pre memory has been allocated for m_is_member and m_member_idx
     \post m_is_member is updated so that it reflects the current indices of the particles in the
    group \post m_member_idx is updated listing all particle indices belonging to the group, in index
    order
+
+    When \a incremental is true and the group is small compared to the number of local particles,
+    the index list is updated from the reverse tag lookup of the members (see
+    updateIndexListFromTags()) instead of scanning the tags of all local particles.
 */
-void ParticleGroup::rebuildIndexList()
+void ParticleGroup::rebuildIndexList(bool incremental)
     {
     // notice message
     m_pdata->getExecConf()->msg->notice(10) << "ParticleGroup: rebuilding index" << std::endl;
@@ -520,6 +532,11 @@ void ParticleGroup::rebuildIndexList()
         }
     else
 #endif
+        if (incremental && m_member_tags.getNumElements() * 4 < m_pdata->getN())
+        {
+        updateIndexListFromTags();
+        }
+    else
         {
         // rebuild the membership flags for the  indices in the group and construct member list
         ArrayHandle<unsigned int> h_is_member(m_is_member,
@@ -548,6 +565,11 @@ void ParticleGroup::rebuildIndexList()
                 }
             }
 
+        // clear the flags past the local particles so that only members are flagged
+        std::fill(h_is_member.data + nparticles,
+                  h_is_member.data + m_is_member.getNumElements(),
+                  0);
+
         m_num_local_members = cur_member;
         assert(m_num_local_members <= m_member_tags.getNumElements());
         }
@@ -556,6 +578,57 @@ void ParticleGroup::rebuildIndexList()
     m_particles_sorted = false;
     }
 
+/*! \pre m_is_member flags exactly the indices listed in the first m_num_local_members entries of
+         m_member_idx
+    \post m_is_member and m_member_idx reflect the current indices of the members
+
+    Sorting and migrating particles updates the reverse tag lookup table, so the current index of
+    each member is found directly from its tag. The old flags are cleared and the new ones set,
+    which costs time proportional to the number of members instead of the number of local
+    particles.
+*/
+void ParticleGroup::updateIndexListFromTags()
+    {
+    ArrayHandle<unsigned int> h_is_member(m_is_member,
+                                          access_location::host,
+                                          access_mode::readwrite);
+    ArrayHandle<unsigned int> h_member_idx(m_member_idx,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_member_tags(m_member_tags,
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    // clear the flags of the old indices
+    unsigned int n_flags = (unsigned int)m_is_member.getNumElements();
+    for (unsigned int i = 0; i < m_num_local_members; i++)
+        {
+        unsigned int idx = h_member_idx.data[i];
+        if (idx < n_flags)
+            h_is_member.data[idx] = 0;
+        }
+
+    // look up the current index of every member, skipping members that are not local
+    unsigned int nparticles = m_pdata->getN();
+    unsigned int cur_member = 0;
+    for (unsigned int i = 0; i < m_member_tags.getNumElements(); i++)
+        {
+        unsigned int idx = h_rtag.data[h_member_tags.data[i]];
+        if (idx < nparticles)
+            {
+            h_is_member.data[idx] = 1;
+            h_member_idx.data[cur_member] = idx;
+            cur_member++;
+            }
+        }
+
+    // the index list is kept in index order
+    std::sort(h_member_idx.data, h_member_idx.data + cur_member);
+
+    m_num_local_members = cur_member;
+    }
+
 #ifdef ENABLE_HIP
 //! rebuild index list on the GPU
 void ParticleGroup::rebuildIndexListGPU()
@@ -599,6 +672,67 @@ void ParticleGroup::rebuildIndexListGPU()
     }
 #endif
 
+#ifdef ENABLE_HIP
+/*! The selector flags the rank local members on the GPU and the flags are compacted to the member
+    tags there, so only the member tags are copied to the host.
+
+    \returns The tags of the rank local particles selected by the selector
+*/
+std::vector<unsigned int> ParticleGroup::getSelectedTagsGPU()
+    {
+    const unsigned int N = m_pdata->getN();
+    if (N == 0)
+        return std::vector<unsigned int>();
+
+    if (m_selected_flags.getNumElements() < N)
+        {
+        GPUArray<unsigned int> selected_flags(m_pdata->getMaxN(), m_exec_conf);
+        m_selected_flags.swap(selected_flags);
+        }
+
+    m_selector->flagMembers(m_sysdef, m_selected_flags);
+
+    unsigned int n_selected = 0;
+    CachedAllocator& alloc = m_exec_conf->getCachedAllocator();
+    ScopedAllocation<unsigned int> d_selected_idx(alloc, N);
+    ScopedAllocation<unsigned int> d_selected_tags(alloc, N);
+    ScopedAllocation<unsigned int> d_tmp(alloc, N);
+
+        {
+        ArrayHandle<unsigned int> d_flags(m_selected_flags,
+                                          access_location::device,
+                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+
+        kernel::gpu_compact_index_list(N,
+                                       d_flags.data,
+                                       d_selected_idx.data,
+                                       n_selected,
+                                       d_tmp.data,
+                                       alloc);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        kernel::gpu_gather_member_tags(n_selected,
+                                       d_selected_idx.data,
+                                       d_tag.data,
+                                       d_selected_tags.data);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    std::vector<unsigned int> member_tags(n_selected);
+    if (n_selected > 0)
+        hipMemcpy(member_tags.data(),
+                  d_selected_tags.data,
+                  sizeof(unsigned int) * n_selected,
+                  hipMemcpyDeviceToHost);
+    return member_tags;
+    }
+#endif
+
 unsigned int ParticleGroup::intersectionSize(std::shared_ptr<ParticleGroup> other)
     {
     unsigned int n = 0;
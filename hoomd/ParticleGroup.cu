@@ -50,6 +50,20 @@ __global__ void gpu_scatter_member_indices(unsigned int N,
         d_member_idx[d_scan[idx]] = idx;
     }
 
+//! GPU kernel to gather the tags of the group members
+__global__ void gpu_gather_member_tags_kernel(unsigned int n_members,
+                                              const unsigned int* d_member_idx,
+                                              const unsigned int* d_tag,
+                                              unsigned int* d_member_tags)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= n_members)
+        return;
+
+    d_member_tags[i] = d_tag[d_member_idx[i]];
+    }
+
 //! GPU method for rebuilding the index list of a ParticleGroup
 /*! \param N number of local particles
     \param d_is_member_tag Global lookup table for tag -> group membership
@@ -137,6 +151,34 @@ hipError_t gpu_compact_index_list(unsigned int N,
     return hipSuccess;
     }
 
+/*! \param n_members Number of members
+    \param d_member_idx Particle indices of the members
+    \param d_tag Array of tags
+    \param d_member_tags Tags of the members (output)
+*/
+hipError_t gpu_gather_member_tags(unsigned int n_members,
+                                  const unsigned int* d_member_idx,
+                                  const unsigned int* d_tag,
+                                  unsigned int* d_member_tags)
+    {
+    if (n_members == 0)
+        return hipSuccess;
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_members / block_size + 1;
+
+    hipLaunchKernelGGL(gpu_gather_member_tags_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_members,
+                       d_member_idx,
+                       d_tag,
+                       d_member_tags);
+    return hipSuccess;
+    }
+
     } // end namespace kernel
 
     } // end namespace hoomd
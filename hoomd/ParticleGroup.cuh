@@ -34,6 +34,12 @@ hipError_t gpu_compact_index_list(unsigned int N,
                                   unsigned int* d_tmp,
                                   CachedAllocator& alloc);
 
+//! GPU method for gathering the tags of the group members
+hipError_t gpu_gather_member_tags(unsigned int n_members,
+                                  const unsigned int* d_member_idx,
+                                  const unsigned int* d_tag,
+                                  unsigned int* d_member_tags);
+
     } // namespace kernel
 
     } // end namespace hoomd
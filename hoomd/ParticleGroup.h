@@ -286,6 +286,7 @@ class PYBIND11_EXPORT ParticleGroup
     mutable GPUArray<unsigned int>
         m_is_member_tag; //!< One byte per particle, == 1 if tag is a member of the group
     std::shared_ptr<ParticleFilter> m_selector; //!< The associated particle selector
+    GPUArray<unsigned int> m_selected_flags;    //!< Membership flags set by the selector
 
     bool m_update_tags; //!< True if tags should be updated when global number of particles changes
     mutable bool m_warning_printed; //!< True if warning about static groups has been printed
@@ -303,7 +304,10 @@ class PYBIND11_EXPORT ParticleGroup
     void reallocate();
 
     //! Helper function to rebuild the index lists after the particles have been sorted
-    void rebuildIndexList();
+    void rebuildIndexList(bool incremental = false);
+
+    //! Helper function to update the index lists of a small group from the reverse tag lookup
+    void updateIndexListFromTags();
 
     //! Helper function to rebuild internal arrays
     void checkRebuild()
@@ -321,7 +325,8 @@ class PYBIND11_EXPORT ParticleGroup
             }
         if (m_particles_sorted)
             {
-            rebuildIndexList();
+            // the member tags are unchanged, only their indices need to be updated
+            rebuildIndexList(!m_exec_conf->isCUDAEnabled());
             m_particles_sorted = false;
             }
         }
@@ -350,6 +355,9 @@ class PYBIND11_EXPORT ParticleGroup
 #ifdef ENABLE_HIP
     //! Helper function to rebuild the index lists after the particles have been sorted
     void rebuildIndexListGPU();
+
+    //! Get the tags of the rank local particles selected by the selector on the GPU
+    std::vector<unsigned int> getSelectedTagsGPU();
 #endif
     };
 
@@ -0,0 +1,66 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ProfileRange.h
+    \brief Declares the ProfileRange class and range annotation functions
+*/
+
+#ifndef __PROFILE_RANGE_H__
+#define __PROFILE_RANGE_H__
+
+#ifdef ENABLE_NVTOOLS
+#include <nvToolsExt.h>
+#endif
+
+#ifdef ENABLE_ROCTRACER
+#include <roctracer/roctx.h>
+#endif
+
+namespace hoomd
+    {
+//! Open a named range on the timelines of GPU profiling tools
+/*! Ranges appear in Nsight Systems when HOOMD is built with ENABLE_NVTOOLS and in rocprof when
+    built with ENABLE_ROCTRACER. Otherwise, this function does nothing. Ranges may nest and must be
+    closed with popProfileRange() on the same thread.
+*/
+inline void pushProfileRange(const char* name)
+    {
+#ifdef ENABLE_NVTOOLS
+    nvtxRangePushA(name);
+#endif
+#ifdef ENABLE_ROCTRACER
+    roctxRangePushA(name);
+#endif
+    }
+
+//! Close the most recently opened range on this thread
+inline void popProfileRange()
+    {
+#ifdef ENABLE_NVTOOLS
+    nvtxRangePop();
+#endif
+#ifdef ENABLE_ROCTRACER
+    roctxRangePop();
+#endif
+    }
+
+//! Annotate the enclosing scope as a named range for GPU profiling tools
+class ProfileRange
+    {
+    public:
+    ProfileRange(const char* name)
+        {
+        pushProfileRange(name);
+        }
+
+    ~ProfileRange()
+        {
+        popProfileRange();
+        }
+
+    ProfileRange(const ProfileRange&) = delete;
+    ProfileRange& operator=(const ProfileRange&) = delete;
+    };
+
+    } // end namespace hoomd
+#endif
@@ -0,0 +1,40 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Profiler.cc
+    \brief Defines the Profiler class
+*/
+
+#include "Profiler.h"
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+namespace hoomd
+    {
+int64_t Profiler::getTime() const
+    {
+#ifdef ENABLE_HIP
+    if (m_synchronize)
+        {
+        hipDeviceSynchronize();
+        }
+#endif
+
+    return m_clk.getTime();
+    }
+
+namespace detail
+    {
+void export_Profiler(pybind11::module& m)
+    {
+    pybind11::class_<ProfileTimer>(m, "ProfileTimer")
+        .def_property_readonly("total_time", &ProfileTimer::getTotalTime)
+        .def_property_readonly("last_time", &ProfileTimer::getLastTime)
+        .def_property_readonly("num_calls", &ProfileTimer::getNumCalls)
+        .def("reset", &ProfileTimer::reset);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
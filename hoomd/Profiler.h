@@ -0,0 +1,146 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Profiler.h
+    \brief Declares the Profiler, ProfileTimer, and ProfileScope classes
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include "ClockSource.h"
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Accumulated wall clock time statistics for one profiled region of code
+/*! ProfileTimer stores the total time, the time taken by the most recent call, and the number of
+    calls. Times are stored internally in nanoseconds and reported in seconds.
+*/
+class PYBIND11_EXPORT ProfileTimer
+    {
+    public:
+    //! Add the duration of one call
+    /*! \param elapsed Duration in nanoseconds
+     */
+    void addSample(int64_t elapsed)
+        {
+        m_total_time += elapsed;
+        m_last_time = elapsed;
+        m_n_calls++;
+        }
+
+    //! Clear all accumulated statistics
+    void reset()
+        {
+        m_total_time = 0;
+        m_last_time = 0;
+        m_n_calls = 0;
+        }
+
+    //! Get the total time spent in all calls (in seconds)
+    double getTotalTime() const
+        {
+        return double(m_total_time) / 1e9;
+        }
+
+    //! Get the time spent in the most recent call (in seconds)
+    double getLastTime() const
+        {
+        return double(m_last_time) / 1e9;
+        }
+
+    //! Get the number of calls
+    uint64_t getNumCalls() const
+        {
+        return m_n_calls;
+        }
+
+    private:
+    int64_t m_total_time = 0; //!< Total time (in nanoseconds)
+    int64_t m_last_time = 0;  //!< Time taken by the most recent call (in nanoseconds)
+    uint64_t m_n_calls = 0;   //!< Number of calls
+    };
+
+//! Opt-in wall clock profiler
+/*! Profiler provides the clock and the global enable flag for ProfileScope. One Profiler is owned
+    by each SystemDefinition. Profiling is disabled by default, in which case ProfileScope costs
+    one branch.
+
+    When \a synchronize is set, ProfileScope waits for the GPU to finish all queued work before
+    reading the clock so that the measured time includes asynchronously launched kernels. This
+    adds significant overhead to GPU simulations.
+*/
+class PYBIND11_EXPORT Profiler
+    {
+    public:
+    //! Enable or disable profiling
+    void setEnabled(bool enabled, bool synchronize)
+        {
+        m_enabled = enabled;
+        m_synchronize = synchronize;
+        }
+
+    //! Test if profiling is enabled
+    bool isEnabled() const
+        {
+        return m_enabled;
+        }
+
+    //! Get the current time in nanoseconds, synchronizing with the GPU if needed
+    int64_t getTime() const;
+
+    private:
+    ClockSource m_clk;          //!< Source of time measurements
+    bool m_enabled = false;     //!< True when profiling is enabled
+    bool m_synchronize = false; //!< True when the GPU must be synchronized before reading the clock
+    };
+
+//! Record the wall clock time spent in the enclosing scope
+/*! Construct a ProfileScope at the start of a region and the elapsed time is added to \a timer when
+    the scope exits. Nothing is recorded when profiling is disabled.
+*/
+class ProfileScope
+    {
+    public:
+    ProfileScope(const Profiler& profiler, ProfileTimer& timer)
+        : m_profiler(profiler), m_timer(timer), m_enabled(profiler.isEnabled()), m_start(0)
+        {
+        if (m_enabled)
+            {
+            m_start = m_profiler.getTime();
+            }
+        }
+
+    ~ProfileScope()
+        {
+        if (m_enabled)
+            {
+            m_timer.addSample(m_profiler.getTime() - m_start);
+            }
+        }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+    const Profiler& m_profiler; //!< The profiler
+    ProfileTimer& m_timer;      //!< Timer to accumulate into
+    bool m_enabled;             //!< Profiling state at construction
+    int64_t m_start;            //!< Start time
+    };
+
+namespace detail
+    {
+//! Exports the ProfileTimer class to python
+void export_Profiler(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
+#endif
@@ -3,11 +3,49 @@
 
 #include "PythonAnalyzer.h"
 
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
 #include <exception>
+#include <stdexcept>
 #include <string>
 
 namespace hoomd
     {
+namespace detail
+    {
+/// Names of the quantities that a batch can store, in the order of their bits
+static const char* batch_field_names[] = {"position", "typeid", "velocity", "image", "orientation"};
+
+static const unsigned int n_batch_fields = 5;
+
+enum batch_field
+    {
+    batch_position = 1,
+    batch_typeid = 2,
+    batch_velocity = 4,
+    batch_image = 8,
+    batch_orientation = 16,
+    };
+
+/// Copy an array of 3 or 4 component values into a (N, width) numpy array
+template<class Output, class Input>
+static pybind11::array_t<Output> toNumpy(const std::vector<Input>& values, size_t width)
+    {
+    static_assert(sizeof(Input) % sizeof(Output) == 0);
+    const size_t stride = sizeof(Input) / sizeof(Output);
+    pybind11::array_t<Output> result(std::vector<size_t> {values.size(), width});
+    Output* out = result.mutable_data();
+    const Output* in = reinterpret_cast<const Output*>(values.data());
+    for (size_t i = 0; i < values.size(); i++)
+        {
+        for (size_t j = 0; j < width; j++)
+            out[i * width + j] = in[i * stride + j];
+        }
+    return result;
+    }
+    } // end namespace detail
+
 PythonAnalyzer::PythonAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
                                std::shared_ptr<Trigger> trigger,
                                pybind11::object analyzer)
@@ -19,7 +57,19 @@ PythonAnalyzer::PythonAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
 void PythonAnalyzer::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    m_analyzer.attr("act")(timestep);
+
+    if (m_batch_size == 0)
+        {
+        pybind11::gil_scoped_acquire acquire_gil;
+        m_analyzer.attr("act")(timestep);
+        return;
+        }
+
+    stageFrame(timestep);
+    if (m_n_pending == m_batch_size)
+        {
+        flush();
+        }
     }
 
 void PythonAnalyzer::setAnalyzer(pybind11::object analyzer)
@@ -38,6 +88,145 @@ PDataFlags PythonAnalyzer::getRequestedPDataFlags()
     return m_flags;
     }
 
+void PythonAnalyzer::setBatchSize(unsigned int batch_size)
+    {
+    if (batch_size != m_batch_size)
+        {
+        flush();
+        }
+    m_batch_size = batch_size;
+    m_batch.resize(batch_size);
+    }
+
+std::vector<std::string> PythonAnalyzer::getBatchQuantities()
+    {
+    std::vector<std::string> result;
+    for (unsigned int i = 0; i < detail::n_batch_fields; i++)
+        {
+        if (m_batch_fields & (1 << i))
+            result.push_back(detail::batch_field_names[i]);
+        }
+    return result;
+    }
+
+void PythonAnalyzer::setBatchQuantities(const std::vector<std::string>& quantities)
+    {
+    unsigned int fields = 0;
+    for (const auto& quantity : quantities)
+        {
+        unsigned int i = 0;
+        while (i < detail::n_batch_fields && quantity != detail::batch_field_names[i])
+            i++;
+
+        if (i == detail::n_batch_fields)
+            {
+            throw std::invalid_argument("Unknown batch quantity: " + quantity);
+            }
+
+        fields |= 1 << i;
+        }
+
+    if (fields != m_batch_fields)
+        {
+        flush();
+        }
+    m_batch_fields = fields;
+    }
+
+/*! Copies the requested arrays of the local particles in index order, as in
+    ParticleData::takeCheckpoint(). No data is communicated and the GIL is not needed.
+*/
+void PythonAnalyzer::stageFrame(uint64_t timestep)
+    {
+    const unsigned int N = m_pdata->getN();
+    BatchFrame& frame = m_batch[m_n_pending];
+    frame.timestep = timestep;
+
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    frame.tag.assign(h_tag.data, h_tag.data + N);
+
+    if (m_batch_fields & (detail::batch_position | detail::batch_typeid))
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        frame.position.clear();
+        frame.type_id.clear();
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const Scalar4 postype = h_postype.data[i];
+            if (m_batch_fields & detail::batch_position)
+                frame.position.push_back(make_scalar3(postype.x, postype.y, postype.z));
+            if (m_batch_fields & detail::batch_typeid)
+                frame.type_id.push_back(__scalar_as_int(postype.w));
+            }
+        }
+
+    if (m_batch_fields & detail::batch_velocity)
+        {
+        ArrayHandle<Scalar4> h_velocity(m_pdata->getVelocities(),
+                                        access_location::host,
+                                        access_mode::read);
+        frame.velocity.clear();
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const Scalar4 v = h_velocity.data[i];
+            frame.velocity.push_back(make_scalar3(v.x, v.y, v.z));
+            }
+        }
+
+    if (m_batch_fields & detail::batch_image)
+        {
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        frame.image.assign(h_image.data, h_image.data + N);
+        }
+
+    if (m_batch_fields & detail::batch_orientation)
+        {
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        frame.orientation.assign(h_orientation.data, h_orientation.data + N);
+        }
+
+    m_n_pending++;
+    }
+
+/*! Calls ``act_batch`` with a list of one dict per pending frame. Each dict holds the timestep and
+    numpy arrays of the tags and requested quantities of the particles local to this rank.
+*/
+void PythonAnalyzer::flush()
+    {
+    if (m_n_pending == 0)
+        return;
+
+    pybind11::gil_scoped_acquire acquire_gil;
+    pybind11::list frames;
+    for (unsigned int i = 0; i < m_n_pending; i++)
+        {
+        const BatchFrame& frame = m_batch[i];
+        pybind11::dict d;
+        d["timestep"] = frame.timestep;
+        d["tag"] = pybind11::array_t<unsigned int>(frame.tag.size(), frame.tag.data());
+        if (m_batch_fields & detail::batch_position)
+            d["position"] = detail::toNumpy<Scalar>(frame.position, 3);
+        if (m_batch_fields & detail::batch_typeid)
+            d["typeid"] = pybind11::array_t<unsigned int>(frame.type_id.size(),
+                                                          frame.type_id.data());
+        if (m_batch_fields & detail::batch_velocity)
+            d["velocity"] = detail::toNumpy<Scalar>(frame.velocity, 3);
+        if (m_batch_fields & detail::batch_image)
+            d["image"] = detail::toNumpy<int>(frame.image, 3);
+        if (m_batch_fields & detail::batch_orientation)
+            d["orientation"] = detail::toNumpy<Scalar>(frame.orientation, 4);
+        frames.append(d);
+        }
+
+    // clear the pending frames first so an exception in the action does not deliver them again
+    m_n_pending = 0;
+    m_analyzer.attr("act_batch")(frames);
+    }
+
 namespace detail
     {
 void export_PythonAnalyzer(pybind11::module& m)
@@ -45,7 +234,12 @@ void export_PythonAnalyzer(pybind11::module& m)
     pybind11::class_<PythonAnalyzer, Analyzer, std::shared_ptr<PythonAnalyzer>>(m, "PythonAnalyzer")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<Trigger>,
-                            pybind11::object>());
+                            pybind11::object>())
+        .def_property("batch_size", &PythonAnalyzer::getBatchSize, &PythonAnalyzer::setBatchSize)
+        .def_property("batch_quantities",
+                      &PythonAnalyzer::getBatchQuantities,
+                      &PythonAnalyzer::setBatchQuantities)
+        .def("flush", &PythonAnalyzer::flush);
     }
 
     } // end namespace detail
@@ -7,8 +7,19 @@
 
 #include "Analyzer.h"
 
+#include <string>
+#include <vector>
+
 namespace hoomd
     {
+/** Call a Python action when the trigger fires.
+
+    By default, analyze() calls the action's ``act`` method every time the trigger fires. When
+    the batch size is set, analyze() copies the requested quantities of the local particles
+    without calling Python. After batch size frames, it passes them all to the action's
+    ``act_batch`` method in one call, so that actions that can process data late acquire the GIL
+    once per batch.
+*/
 class PYBIND11_EXPORT PythonAnalyzer : public Analyzer
     {
     public:
@@ -27,9 +38,60 @@ class PYBIND11_EXPORT PythonAnalyzer : public Analyzer
         return m_analyzer;
         }
 
+    /// Get the number of frames passed to act_batch (0 calls act every time)
+    unsigned int getBatchSize()
+        {
+        return m_batch_size;
+        }
+
+    /// Set the number of frames passed to act_batch (0 calls act every time)
+    void setBatchSize(unsigned int batch_size);
+
+    /// Get the quantities stored in each frame of a batch
+    std::vector<std::string> getBatchQuantities();
+
+    /// Set the quantities stored in each frame of a batch
+    void setBatchQuantities(const std::vector<std::string>& quantities);
+
+    /// Pass the pending frames to act_batch
+    void flush();
+
+    /// Deliver the pending frames before the action is detached
+    virtual void notifyDetach()
+        {
+        flush();
+        }
+
     protected:
     pybind11::object m_analyzer;
     PDataFlags m_flags;
+
+    /// Local particle data copied on one timestep
+    struct BatchFrame
+        {
+        uint64_t timestep = 0;
+        std::vector<unsigned int> tag;
+        std::vector<Scalar3> position;
+        std::vector<unsigned int> type_id;
+        std::vector<Scalar3> velocity;
+        std::vector<int3> image;
+        std::vector<Scalar4> orientation;
+        };
+
+    /// Number of frames passed to act_batch
+    unsigned int m_batch_size = 0;
+
+    /// Bit mask of the quantities stored in each frame
+    unsigned int m_batch_fields = 0;
+
+    /// Frames of the current batch (reused between batches)
+    std::vector<BatchFrame> m_batch;
+
+    /// Number of pending frames in m_batch
+    unsigned int m_n_pending = 0;
+
+    /// Copy the local particle data into the next frame
+    void stageFrame(uint64_t timestep);
     };
 
 namespace detail
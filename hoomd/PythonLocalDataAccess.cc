@@ -3,8 +3,214 @@
 
 #include "PythonLocalDataAccess.h"
 
+#include <memory>
+#include <stdexcept>
+
 namespace hoomd
     {
+namespace
+    {
+// Data structures defined by the DLPack C ABI (https://dmlc.github.io/dlpack).
+struct DLDevice
+    {
+    int32_t device_type;
+    int32_t device_id;
+    };
+
+struct DLDataType
+    {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+    };
+
+struct DLTensor
+    {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides;
+    uint64_t byte_offset;
+    };
+
+struct DLManagedTensor
+    {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self);
+    };
+
+// DLPack device types and type codes used by HOOMD-blue buffers.
+const int32_t dl_device_cpu = 1;
+const int32_t dl_device_cuda = 2;
+const int32_t dl_device_rocm = 10;
+
+const uint8_t dl_code_int = 0;
+const uint8_t dl_code_uint = 1;
+const uint8_t dl_code_float = 2;
+const uint8_t dl_code_bool = 6;
+
+/// Owns a DLManagedTensor and the shape and strides it points to.
+struct DLPackContext
+    {
+    DLManagedTensor tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    };
+
+void deleteDLManagedTensor(DLManagedTensor* self)
+    {
+    delete static_cast<DLPackContext*>(self->manager_ctx);
+    }
+
+void deleteDLPackCapsule(PyObject* capsule)
+    {
+    // Consumers rename the capsule to "used_dltensor" when they take ownership of the tensor.
+    if (PyCapsule_IsValid(capsule, "dltensor"))
+        {
+        auto tensor = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, "dltensor"));
+        tensor->deleter(tensor);
+        }
+    }
+
+/// Convert a buffer format descriptor to a DLPack data type.
+DLDataType getDLDataType(const std::string& typestr, size_t itemsize)
+    {
+    DLDataType dtype;
+    dtype.bits = (uint8_t)(itemsize * 8);
+    dtype.lanes = 1;
+
+    switch (typestr.empty() ? '\0' : typestr.back())
+        {
+    case 'e':
+    case 'f':
+    case 'd':
+        dtype.code = dl_code_float;
+        break;
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+        dtype.code = dl_code_int;
+        break;
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+        dtype.code = dl_code_uint;
+        break;
+    case '?':
+        dtype.code = dl_code_bool;
+        break;
+    default:
+        throw std::runtime_error("Data type " + typestr + " is not supported by DLPack.");
+        }
+
+    return dtype;
+    }
+    } // end anonymous namespace
+
+pybind11::capsule
+HOOMDBuffer::makeDLPackCapsule(size_t itemsize, int32_t device_type, int32_t device_id) const
+    {
+    DLDataType dtype = getDLDataType(m_typestr, itemsize);
+
+    std::unique_ptr<DLPackContext> context(new DLPackContext);
+    for (size_t i = 0; i < m_shape.size(); i++)
+        {
+        // DLPack strides are in elements, HOOMDBuffer strides are in bytes
+        if (m_strides[i] % itemsize != 0)
+            {
+            throw std::runtime_error("Buffer strides are not a multiple of the item size.");
+            }
+        context->shape.push_back((int64_t)m_shape[i]);
+        context->strides.push_back((int64_t)(m_strides[i] / itemsize));
+        }
+
+    DLTensor& tensor = context->tensor.dl_tensor;
+    tensor.data = m_data;
+    tensor.device.device_type = device_type;
+    tensor.device.device_id = device_id;
+    tensor.ndim = (int32_t)m_shape.size();
+    tensor.dtype = dtype;
+    tensor.shape = context->shape.data();
+    tensor.strides = context->strides.data();
+    tensor.byte_offset = 0;
+    context->tensor.manager_ctx = context.get();
+    context->tensor.deleter = deleteDLManagedTensor;
+
+    PyObject* capsule = PyCapsule_New(&context->tensor, "dltensor", deleteDLPackCapsule);
+    if (capsule == nullptr)
+        {
+        throw pybind11::error_already_set();
+        }
+
+    // the capsule now owns the context
+    context.release();
+    return pybind11::reinterpret_steal<pybind11::capsule>(capsule);
+    }
+
+pybind11::capsule HOOMDHostBuffer::getDLPack(pybind11::object stream) const
+    {
+    if (!stream.is_none())
+        {
+        throw std::invalid_argument("stream must be None for arrays in host memory.");
+        }
+    return makeDLPackCapsule(m_itemsize, dl_device_cpu, 0);
+    }
+
+pybind11::tuple HOOMDHostBuffer::getDLPackDevice() const
+    {
+    return pybind11::make_tuple(dl_device_cpu, 0);
+    }
+
+#if ENABLE_HIP
+/// Get the DLPack device type and id of the active GPU.
+static std::pair<int32_t, int32_t> getDLDevice()
+    {
+#ifdef __HIP_PLATFORM_NVCC__
+    int32_t device_type = dl_device_cuda;
+#else
+    int32_t device_type = dl_device_rocm;
+#endif
+    int device_id = 0;
+    hipGetDevice(&device_id);
+    return std::make_pair(device_type, (int32_t)device_id);
+    }
+
+pybind11::capsule HOOMDDeviceBuffer::getDLPack(pybind11::object stream) const
+    {
+    if (!stream.is_none())
+        {
+        intptr_t consumer_stream = stream.cast<intptr_t>();
+
+        // -1 requests no synchronization. 0 and 1 refer to the default stream, which already
+        // orders the consumer's work after HOOMD-blue's kernels.
+        if (consumer_stream != -1 && consumer_stream != 0 && consumer_stream != 1)
+            {
+            hipEvent_t event;
+            hipEventCreateWithFlags(&event, hipEventDisableTiming);
+            hipEventRecord(event, 0);
+            hipStreamWaitEvent((hipStream_t)consumer_stream, event, 0);
+            hipEventDestroy(event);
+            }
+        }
+
+    auto device = getDLDevice();
+    return makeDLPackCapsule(m_itemsize, device.first, device.second);
+    }
+
+pybind11::tuple HOOMDDeviceBuffer::getDLPackDevice() const
+    {
+    auto device = getDLDevice();
+    return pybind11::make_tuple(device.first, device.second);
+    }
+#endif
+
 namespace detail
     {
 void export_GhostDataFlag(pybind11::module& m)
@@ -19,6 +225,8 @@ void export_HOOMDHostBuffer(pybind11::module& m)
     {
     pybind11::class_<HOOMDHostBuffer>(m, "HOOMDHostBuffer", pybind11::buffer_protocol())
         .def_buffer([](HOOMDHostBuffer& b) -> pybind11::buffer_info { return b.new_buffer(); })
+        .def("__dlpack__", &HOOMDHostBuffer::getDLPack, pybind11::arg("stream") = pybind11::none())
+        .def("__dlpack_device__", &HOOMDHostBuffer::getDLPackDevice)
         .def_property_readonly("read_only", &HOOMDHostBuffer::getReadOnly);
     ;
     }
@@ -30,6 +238,10 @@ void export_HOOMDDeviceBuffer(pybind11::module& m)
     pybind11::class_<HOOMDDeviceBuffer>(m, "HOOMDDeviceBuffer")
         .def_property_readonly("__cuda_array_interface__",
                                &HOOMDDeviceBuffer::getCudaArrayInterface)
+        .def("__dlpack__",
+             &HOOMDDeviceBuffer::getDLPack,
+             pybind11::arg("stream") = pybind11::none())
+        .def("__dlpack_device__", &HOOMDDeviceBuffer::getDLPackDevice)
         .def_property_readonly("read_only", &HOOMDDeviceBuffer::getReadOnly);
     ;
     }
@@ -6,6 +6,7 @@
 
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <cstdint>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -50,6 +51,16 @@ struct HOOMDBuffer
         {
         return m_read_only;
         }
+
+    protected:
+    /// Create a DLPack capsule that refers to the buffer.
+    /** The capsule follows the Python specification of the DLPack protocol
+     *  (https://dmlc.github.io/dlpack/latest/python_spec.html). It does not own
+     *  the data, which is only valid while the buffer's ArrayHandle is held.
+     */
+    pybind11::capsule makeDLPackCapsule(size_t itemsize,
+                                        int32_t device_type,
+                                        int32_t device_id) const;
     };
 
 /// Represents the data required to specify a CPU buffer object in Python.
@@ -96,6 +107,12 @@ struct HOOMDHostBuffer : public HOOMDBuffer
                                      std::vector<size_t>(m_shape),
                                      std::vector<size_t>(m_strides));
         }
+
+    /// Implement __dlpack__ for host memory (stream must be None).
+    pybind11::capsule getDLPack(pybind11::object stream) const;
+
+    /// Implement __dlpack_device__.
+    pybind11::tuple getDLPackDevice() const;
     };
 
 #if ENABLE_HIP
@@ -106,13 +123,15 @@ struct HOOMDHostBuffer : public HOOMDBuffer
 struct HOOMDDeviceBuffer : public HOOMDBuffer
     {
     static const auto device = access_location::device;
+    size_t m_itemsize;
 
     HOOMDDeviceBuffer(void* data,
                       std::string typestr,
                       std::vector<size_t> shape,
                       std::vector<size_t> strides,
-                      bool read_only)
-        : HOOMDBuffer(data, typestr, shape, strides, read_only)
+                      bool read_only,
+                      size_t itemsize)
+        : HOOMDBuffer(data, typestr, shape, strides, read_only), m_itemsize(itemsize)
         {
         }
 
@@ -124,9 +143,21 @@ struct HOOMDDeviceBuffer : public HOOMDBuffer
                                  pybind11::format_descriptor<T>::format(),
                                  shape,
                                  strides,
-                                 read_only);
+                                 read_only,
+                                 sizeof(T));
         }
 
+    /// Implement __dlpack__ for device memory.
+    /** HOOMD-blue launches kernels on the default stream. When the consumer
+     *  passes a different stream, make that stream wait on an event recorded
+     *  on the default stream so that pending writes to the buffer are visible
+     *  without synchronizing the whole device.
+     */
+    pybind11::capsule getDLPack(pybind11::object stream) const;
+
+    /// Implement __dlpack_device__.
+    pybind11::tuple getDLPackDevice() const;
+
     /// Convert object to a __cuda_array_interface__ v2 compliant Python dict.
     /** We can't only add the existing values in the HOOMDDeviceBuffer because
      *  CuPy and potentially other packages that use the interface can't handle
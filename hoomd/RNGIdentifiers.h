@@ -70,6 +70,9 @@ struct RNGIdentifier
     static const uint8_t BussiThermostat = 45;
     static const uint8_t ConstantPressure = 46;
     static const uint8_t MPCDCellList = 47;
+    static const uint8_t DistributedRandomInitializer = 48;
+    static const uint8_t ReplicaExchange = 49;
+    static const uint8_t HPMCMonoCheckerboard = 50;
     };
 
     } // namespace hoomd
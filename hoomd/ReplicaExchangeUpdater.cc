@@ -0,0 +1,165 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ReplicaExchangeUpdater.h"
+#include "RNGIdentifiers.h"
+#include "RandomNumbers.h"
+
+#include <cmath>
+#include <pybind11/stl.h>
+#include <sstream>
+#include <stdexcept>
+
+/*! \file ReplicaExchangeUpdater.cc
+    \brief Defines the ReplicaExchangeUpdater class
+*/
+
+namespace hoomd
+    {
+ReplicaExchangeUpdater::ReplicaExchangeUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger,
+                                               std::shared_ptr<VariantConstant> parameter,
+                                               pybind11::object observable)
+    : Updater(sysdef, trigger), m_parameter(parameter), m_observable(observable),
+      m_rung(m_exec_conf->getMPIConfig()->getPartition())
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ReplicaExchangeUpdater" << std::endl;
+    }
+
+ReplicaExchangeUpdater::~ReplicaExchangeUpdater()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ReplicaExchangeUpdater" << std::endl;
+    }
+
+/*! \param values Parameter value of each rung
+
+    Each partition starts at the rung with its own index, so the number of values must match the
+    number of partitions.
+*/
+void ReplicaExchangeUpdater::setValues(const std::vector<Scalar>& values)
+    {
+    unsigned int n_partitions = m_exec_conf->getMPIConfig()->getNPartitions();
+    if (values.size() != n_partitions)
+        {
+        std::ostringstream s;
+        s << "ReplicaExchange needs one value per partition: found " << values.size()
+          << " values and " << n_partitions << " partitions.";
+        throw std::invalid_argument(s.str());
+        }
+
+    m_values = values;
+    if (m_accepted.size() != n_partitions - 1)
+        {
+        m_accepted.assign(n_partitions - 1, 0);
+        m_attempted.assign(n_partitions - 1, 0);
+        }
+    applyRung();
+    }
+
+/*! \param timestep Current time step
+
+    The message of each rank holds its rung, its observable and the seed of its simulation. The
+   ranks of a partition agree on all three, so only the first rank of each partition is read.
+*/
+void ReplicaExchangeUpdater::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+#ifdef ENABLE_MPI
+    std::shared_ptr<MPIConfiguration> mpi_conf = m_exec_conf->getMPIConfig();
+    unsigned int n_partitions = mpi_conf->getNPartitions();
+    if (n_partitions < 2)
+        return;
+
+    if (m_values.size() != n_partitions)
+        throw std::runtime_error("ReplicaExchange values are not set.");
+
+    // every rank calls the observable, which may reduce over the ranks of the partition
+    double observable;
+        {
+        pybind11::gil_scoped_acquire acquire_gil;
+        observable = pybind11::cast<double>(m_observable());
+        }
+
+    double message[3] = {double(m_rung), observable, double(m_sysdef->getSeed())};
+    std::vector<double> messages(3 * mpi_conf->getNRanksGlobal());
+    MPI_Allgather(message,
+                  3,
+                  MPI_DOUBLE,
+                  messages.data(),
+                  3,
+                  MPI_DOUBLE,
+                  mpi_conf->getHOOMDWorldCommunicator());
+
+    // the partition holding each rung, and the observable of each partition
+    unsigned int n_ranks = mpi_conf->getNRanks();
+    std::vector<unsigned int> partition_of_rung(n_partitions);
+    std::vector<double> partition_observable(n_partitions);
+    for (unsigned int p = 0; p < n_partitions; p++)
+        {
+        const double* m = &messages[3 * p * n_ranks];
+        partition_of_rung[(unsigned int)m[0]] = p;
+        partition_observable[p] = m[1];
+        }
+    uint16_t seed = uint16_t(messages[2]);
+
+    // all partitions evaluate the same tests in the same order
+    for (unsigned int k = (unsigned int)(m_n_attempts % 2); k + 1 < n_partitions; k += 2)
+        {
+        unsigned int a = partition_of_rung[k];
+        unsigned int b = partition_of_rung[k + 1];
+        double delta = (double(getCoupling(k + 1)) - double(getCoupling(k)))
+                       * (partition_observable[a] - partition_observable[b]);
+
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::ReplicaExchange, timestep, seed),
+            hoomd::Counter(k));
+        double u = hoomd::UniformDistribution<double>()(rng);
+
+        m_attempted[k]++;
+        if (delta <= 0 || u < exp(-delta))
+            {
+            m_accepted[k]++;
+            partition_of_rung[k] = b;
+            partition_of_rung[k + 1] = a;
+            }
+        }
+    m_n_attempts++;
+
+    for (unsigned int k = 0; k < n_partitions; k++)
+        {
+        if (partition_of_rung[k] == mpi_conf->getPartition())
+            m_rung = k;
+        }
+    applyRung();
+#endif
+    }
+
+namespace detail
+    {
+void export_ReplicaExchangeUpdater(pybind11::module& m)
+    {
+    pybind11::class_<ReplicaExchangeUpdater, Updater, std::shared_ptr<ReplicaExchangeUpdater>>(
+        m,
+        "ReplicaExchangeUpdater")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<VariantConstant>,
+                            pybind11::object>())
+        .def_property("values",
+                      &ReplicaExchangeUpdater::getValues,
+                      &ReplicaExchangeUpdater::setValues)
+        .def_property("inverse",
+                      &ReplicaExchangeUpdater::getInverse,
+                      &ReplicaExchangeUpdater::setInverse)
+        .def_property("parameter",
+                      &ReplicaExchangeUpdater::getParameter,
+                      &ReplicaExchangeUpdater::setParameter)
+        .def_property_readonly("rung", &ReplicaExchangeUpdater::getRung)
+        .def_property_readonly("accepted", &ReplicaExchangeUpdater::getAccepted)
+        .def_property_readonly("attempted", &ReplicaExchangeUpdater::getAttempted);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,138 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ReplicaExchangeUpdater.h
+    \brief Declares an updater that exchanges state parameters between MPI partitions
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#include "Updater.h"
+#include "Variant.h"
+
+#pragma once
+
+namespace hoomd
+    {
+/// Exchanges state parameters between replicas that run in the partitions of the MPI world
+/** Each partition runs one replica. The replicas share a ladder of parameter values (such as kT,
+    pressure or a coupling parameter) with one value per partition, and each partition holds one
+    rung of the ladder in a VariantConstant that its integrator or updaters read.
+
+    The reduced energy of a replica at rung k is u_k = c(lambda_k) A where A is the observable of
+    the replica and c(lambda) is lambda, or 1 / lambda when \a inverse is set (for example 1 / kT
+    with the potential energy as the observable). An exchange of the rungs k and k + 1 held by the
+    replicas a and b is accepted with probability min(1, exp(-(c_{k+1} - c_k)(A_a - A_b))).
+
+    Every update attempts exchanges between the neighboring rungs (k, k + 1) with k even on even
+    attempts and k odd on odd attempts. All ranks contribute their rung and observable to one
+    small MPI_Allgather over the HOOMD world communicator, then every partition evaluates the
+    same acceptance tests with random numbers seeded by partition 0 and updates its parameter.
+    Only the values of the parameters move between partitions, never the configurations.
+
+    All partitions must run the updater with the same trigger.
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT ReplicaExchangeUpdater : public Updater
+    {
+    public:
+    /// Constructor
+    ReplicaExchangeUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger,
+                           std::shared_ptr<VariantConstant> parameter,
+                           pybind11::object observable);
+
+    /// Destructor
+    virtual ~ReplicaExchangeUpdater();
+
+    /// Set the ladder of parameter values, one per partition
+    void setValues(const std::vector<Scalar>& values);
+
+    /// Get the ladder of parameter values
+    std::vector<Scalar> getValues() const
+        {
+        return m_values;
+        }
+
+    /// Set whether the reduced energy couples to the inverse of the parameter
+    void setInverse(bool inverse)
+        {
+        m_inverse = inverse;
+        }
+
+    /// Get whether the reduced energy couples to the inverse of the parameter
+    bool getInverse() const
+        {
+        return m_inverse;
+        }
+
+    /// Set the parameter that holds the rung of this partition
+    void setParameter(std::shared_ptr<VariantConstant> parameter)
+        {
+        m_parameter = parameter;
+        applyRung();
+        }
+
+    /// Get the parameter that holds the rung of this partition
+    std::shared_ptr<VariantConstant> getParameter() const
+        {
+        return m_parameter;
+        }
+
+    /// Get the rung of the ladder held by this partition
+    unsigned int getRung() const
+        {
+        return m_rung;
+        }
+
+    /// Get the number of accepted exchanges between the rungs k and k + 1
+    std::vector<uint64_t> getAccepted() const
+        {
+        return m_accepted;
+        }
+
+    /// Get the number of attempted exchanges between the rungs k and k + 1
+    std::vector<uint64_t> getAttempted() const
+        {
+        return m_attempted;
+        }
+
+    /// Attempt the exchanges
+    virtual void update(uint64_t timestep);
+
+    private:
+    std::shared_ptr<VariantConstant> m_parameter; //!< Parameter of the replica in this partition
+    pybind11::object m_observable;                //!< Callable that returns the observable
+    std::vector<Scalar> m_values;                 //!< Parameter value of each rung
+    bool m_inverse = false;                       //!< True when u_k = A / lambda_k
+    unsigned int m_rung;                          //!< Rung held by this partition
+    uint64_t m_n_attempts = 0;                    //!< Number of updates so far
+    std::vector<uint64_t> m_accepted;             //!< Accepted exchanges of each pair of rungs
+    std::vector<uint64_t> m_attempted;            //!< Attempted exchanges of each pair of rungs
+
+    /// Get the coupling c(lambda) of a rung
+    Scalar getCoupling(unsigned int rung) const
+        {
+        return m_inverse ? Scalar(1.0) / m_values[rung] : m_values[rung];
+        }
+
+    /// Set the parameter to the value of the rung held by this partition
+    void applyRung()
+        {
+        if (m_parameter && m_rung < m_values.size())
+            m_parameter->setValue(m_values[m_rung]);
+        }
+    };
+
+namespace detail
+    {
+/// Export the ReplicaExchangeUpdater to python
+void export_ReplicaExchangeUpdater(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace hoomd
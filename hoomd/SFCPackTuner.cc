@@ -7,6 +7,7 @@
 
 #include "SFCPackTuner.h"
 #include "Communicator.h"
+#include "HilbertCurve.h"
 
 #include <algorithm>
 #include <fstream>
@@ -81,6 +82,11 @@ SFCPackTuner::~SFCPackTuner()
 void SFCPackTuner::update(uint64_t timestep)
     {
     Updater::update(timestep);
+
+    // skip the sort while the particles remain ordered
+    if (m_max_disorder > Scalar(0.0) && computeDisorder() < m_max_disorder)
+        return;
+
     m_exec_conf->msg->notice(6) << "SFCPackTuner: particle sort" << std::endl;
 
 #ifdef ENABLE_MPI
@@ -104,8 +110,12 @@ void SFCPackTuner::update(uint64_t timestep)
     // apply that sort order to the particles
     applySortOrder();
 
-    // trigger sort signal (this also forces particle migration)
-    m_pdata->notifyParticleSort();
+    // trigger sort signal (this also forces particle migration), the host order is only
+    // current on the CPU
+    if (m_exec_conf->isCUDAEnabled())
+        m_pdata->notifyParticleSort();
+    else
+        m_pdata->notifyParticleSort(m_sort_order.data());
 
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
@@ -487,46 +497,18 @@ void SFCPackTuner::generateTraversalOrder(int i,
     }
 
 void SFCPackTuner::getSortedOrder2D()
+    {
+    // getSortedOrder3D handles both cases
+    getSortedOrder3D();
+    }
+
+void SFCPackTuner::getSortedOrder3D()
     {
     // start by checking the saneness of some member variables
     assert(m_pdata);
     assert(m_sort_order.size() >= m_pdata->getN());
 
-    // make even bin dimensions
-    const BoxDim& box = m_pdata->getBox();
-
-        // put the particles in the bins
-        {
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
-
-        // for each particle
-        for (unsigned int n = 0; n < m_pdata->getN(); n++)
-            {
-            // find the bin each particle belongs in
-            Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
-            Scalar3 f = box.makeFraction(p, make_scalar3(0.0, 0.0, 0.0));
-            int ib = (unsigned int)(f.x * m_grid) % m_grid;
-            int jb = (unsigned int)(f.y * m_grid) % m_grid;
-
-            // if the particle is slightly outside, move back into grid
-            if (ib < 0)
-                ib = 0;
-            if (ib >= (int)m_grid)
-                ib = m_grid - 1;
-
-            if (jb < 0)
-                jb = 0;
-            if (jb >= (int)m_grid)
-                jb = m_grid - 1;
-
-            // record its bin
-            unsigned int bin = ib * m_grid + jb;
-
-            m_particle_bins[n] = std::pair<unsigned int, unsigned int>(bin, n);
-            }
-        }
+    binParticles();
 
     // sort the tuples
     sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
@@ -538,67 +520,79 @@ void SFCPackTuner::getSortedOrder2D()
         }
     }
 
-void SFCPackTuner::getSortedOrder3D()
+/*! Regenerates m_traversal_order when the grid or the system dimension changed since the last
+    call.
+*/
+void SFCPackTuner::updateTraversalOrder()
     {
-    // start by checking the saneness of some member variables
-    assert(m_pdata);
-    assert(m_sort_order.size() >= m_pdata->getN());
+    if (m_last_grid == m_grid && m_last_dim == 3)
+        return;
 
-    // make even bin dimensions
-    const BoxDim& box = m_pdata->getBox();
-
-    // reallocate memory arrays if m_grid changed
-    // also regenerate the traversal order
-    if (m_last_grid != m_grid || m_last_dim != 3)
+    if (m_grid > 256)
         {
-        if (m_grid > 256)
-            {
-            unsigned int mb = m_grid * m_grid * m_grid * 4 / 1024 / 1024;
-            m_exec_conf->msg->warning()
-                << "sorter is about to allocate a very large amount of memory (" << mb << "MB)"
-                << " and may crash." << endl;
-            m_exec_conf->msg->warning() << "            Reduce the amount of memory allocated to "
-                                           "prevent this by decreasing the "
-                                        << endl;
-            m_exec_conf->msg->warning() << "            grid dimension (i.e. "
-                                           "sorter.set_params(grid=128) ) or by disabling it "
-                                        << endl;
-            m_exec_conf->msg->warning()
-                << "            ( sorter.disable() ) before beginning the run()." << endl;
-            }
+        unsigned int mb = m_grid * m_grid * m_grid * 4 / 1024 / 1024;
+        m_exec_conf->msg->warning()
+            << "sorter is about to allocate a very large amount of memory (" << mb << "MB)"
+            << " and may crash." << endl;
+        m_exec_conf->msg->warning() << "            Reduce the amount of memory allocated to "
+                                       "prevent this by decreasing the "
+                                    << endl;
+        m_exec_conf->msg->warning() << "            grid dimension (i.e. "
+                                       "sorter.set_params(grid=128) ) or by disabling it "
+                                    << endl;
+        m_exec_conf->msg->warning()
+            << "            ( sorter.disable() ) before beginning the run()." << endl;
+        }
+
+    // generate the traversal order
+    GPUArray<unsigned int> traversal_order(m_grid * m_grid * m_grid, m_exec_conf);
+    m_traversal_order.swap(traversal_order);
 
-        // generate the traversal order
-        GPUArray<unsigned int> traversal_order(m_grid * m_grid * m_grid, m_exec_conf);
-        m_traversal_order.swap(traversal_order);
+    vector<unsigned int> reverse_order(m_grid * m_grid * m_grid);
+    reverse_order.clear();
 
-        vector<unsigned int> reverse_order(m_grid * m_grid * m_grid);
-        reverse_order.clear();
+    // we need to start the hilbert curve with a seed order 0,1,2,3,4,5,6,7
+    unsigned int cell_order[8];
+    for (unsigned int i = 0; i < 8; i++)
+        cell_order[i] = i;
+    generateTraversalOrder(0, 0, 0, m_grid, m_grid, cell_order, reverse_order);
+
+    // access traversal order
+    ArrayHandle<unsigned int> h_traversal_order(m_traversal_order,
+                                                access_location::host,
+                                                access_mode::overwrite);
 
-        // we need to start the hilbert curve with a seed order 0,1,2,3,4,5,6,7
-        unsigned int cell_order[8];
-        for (unsigned int i = 0; i < 8; i++)
-            cell_order[i] = i;
-        generateTraversalOrder(0, 0, 0, m_grid, m_grid, cell_order, reverse_order);
+    for (unsigned int i = 0; i < m_grid * m_grid * m_grid; i++)
+        h_traversal_order.data[reverse_order[i]] = i;
 
-        // access traversal order
-        ArrayHandle<unsigned int> h_traversal_order(m_traversal_order,
-                                                    access_location::host,
-                                                    access_mode::overwrite);
+    // write the traversal order out to a file for testing/presentations
+    // writeTraversalOrder("hilbert.mol2", reverse_order);
 
-        for (unsigned int i = 0; i < m_grid * m_grid * m_grid; i++)
-            h_traversal_order.data[reverse_order[i]] = i;
+    m_last_grid = m_grid;
+    // store the last system dimension computed so we can be mindful if that ever changes
+    m_last_dim = m_sysdef->getNDimensions();
+    }
 
-        // write the traversal order out to a file for testing/presentations
-        // writeTraversalOrder("hilbert.mol2", reverse_order);
+/*! The key of each particle is the bin index on the grid in 2D and the index of the bin along the
+    hilbert curve in 3D. In high resolution mode, keys are computed directly along the hilbert curve
+    in both cases.
+*/
+void SFCPackTuner::binParticles()
+    {
+    // make even bin dimensions
+    const BoxDim& box = m_pdata->getBox();
+    const bool twod = m_sysdef->getNDimensions() == 2;
 
-        m_last_grid = m_grid;
-        // store the last system dimension computed so we can be mindful if that ever changes
-        m_last_dim = m_sysdef->getNDimensions();
+    // reallocate memory arrays if m_grid changed
+    // also regenerate the traversal order
+    if (!twod && !m_high_resolution)
+        {
+        updateTraversalOrder();
+        assert(m_traversal_order.getNumElements() == m_grid * m_grid * m_grid);
         }
 
     // sanity checks
     assert(m_particle_bins.size() >= m_pdata->getN());
-    assert(m_traversal_order.getNumElements() == m_grid * m_grid * m_grid);
 
     // put the particles in the bins
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
@@ -613,6 +607,14 @@ void SFCPackTuner::getSortedOrder3D()
         {
         Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
         Scalar3 f = box.makeFraction(p, make_scalar3(0.0, 0.0, 0.0));
+
+        if (m_high_resolution)
+            {
+            m_particle_bins[n]
+                = std::pair<unsigned int, unsigned int>(detail::hilbert_key(f, twod), n);
+            continue;
+            }
+
         int ib = (unsigned int)(f.x * m_grid) % m_grid;
         int jb = (unsigned int)(f.y * m_grid) % m_grid;
         int kb = (unsigned int)(f.z * m_grid) % m_grid;
@@ -634,19 +636,64 @@ void SFCPackTuner::getSortedOrder3D()
             kb = m_grid - 1;
 
         // record its bin
-        unsigned int bin = ib * (m_grid * m_grid) + jb * m_grid + kb;
+        if (twod)
+            {
+            unsigned int bin = ib * m_grid + jb;
+            m_particle_bins[n] = std::pair<unsigned int, unsigned int>(bin, n);
+            }
+        else
+            {
+            unsigned int bin = ib * (m_grid * m_grid) + jb * m_grid + kb;
+            m_particle_bins[n]
+                = std::pair<unsigned int, unsigned int>(h_traversal_order.data[bin], n);
+            }
+        }
+    }
 
-        m_particle_bins[n] = std::pair<unsigned int, unsigned int>(h_traversal_order.data[bin], n);
+/*! \returns The fraction of consecutive pairs of local particles whose keys decrease, over all
+    ranks. It is 0 right after a sort and approaches 1/2 as the particles mix.
+*/
+Scalar SFCPackTuner::computeDisorder()
+    {
+    binParticles();
+
+    unsigned long long n_inversions = 0;
+    for (unsigned int n = 1; n < m_pdata->getN(); n++)
+        {
+        if (m_particle_bins[n - 1].first > m_particle_bins[n].first)
+            n_inversions++;
         }
 
-    // sort the tuples
-    sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
+    return reduceDisorder(n_inversions);
+    }
 
-    // translate the sorted order
-    for (unsigned int j = 0; j < m_pdata->getN(); j++)
+/*! \param n_inversions Number of consecutive local particles whose keys decrease
+ */
+Scalar SFCPackTuner::reduceDisorder(unsigned long long n_inversions)
+    {
+    unsigned long long n_pairs = m_pdata->getN() > 0 ? m_pdata->getN() - 1 : 0;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
         {
-        m_sort_order[j] = m_particle_bins[j].second;
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &n_inversions,
+                      1,
+                      MPI_UNSIGNED_LONG_LONG,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &n_pairs,
+                      1,
+                      MPI_UNSIGNED_LONG_LONG,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
         }
+#endif
+
+    if (n_pairs == 0)
+        return Scalar(0.0);
+    return Scalar(double(n_inversions) / double(n_pairs));
     }
 
 void SFCPackTuner::writeTraversalOrder(const std::string& fname,
@@ -688,7 +735,14 @@ void export_SFCPackTuner(pybind11::module& m)
     {
     pybind11::class_<SFCPackTuner, Tuner, std::shared_ptr<SFCPackTuner>>(m, "SFCPackTuner")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
-        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython);
+        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython)
+        .def_property("high_resolution",
+                      &SFCPackTuner::getHighResolution,
+                      &SFCPackTuner::setHighResolution)
+        .def_property("max_disorder",
+                      &SFCPackTuner::getMaxDisorderPython,
+                      &SFCPackTuner::setMaxDisorderPython)
+        .def_property_readonly("disorder", &SFCPackTuner::computeDisorder);
     }
 
     } // end namespace detail
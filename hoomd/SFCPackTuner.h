@@ -43,6 +43,13 @@ namespace hoomd
    based on the order in which those bins appear along a hilbert curve. It is very efficient, even
    when the box size changes often as the grid dimension is kept constant.
 
+    In high resolution mode, the Hilbert curve index of each particle is computed directly from its
+   coordinates (see HilbertCurve.h) on a much finer grid, which needs no traversal order table.
+
+    When a maximum disorder is set, update() first measures the disorder: the fraction of
+   consecutive particles in memory whose keys are out of order. It sorts only when the disorder
+   reaches the maximum, so the trigger may be much more frequent than the typical sort period.
+
     \ingroup updaters
 */
 class PYBIND11_EXPORT SFCPackTuner : public Tuner
@@ -80,12 +87,62 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
         return m_grid;
         }
 
+    /// Set whether to compute Hilbert keys directly at high resolution
+    void setHighResolution(bool high_resolution)
+        {
+        m_high_resolution = high_resolution;
+        }
+
+    /// Get whether to compute Hilbert keys directly at high resolution
+    bool getHighResolution()
+        {
+        return m_high_resolution;
+        }
+
+    /// Set the disorder at which to sort (None sorts on every update)
+    void setMaxDisorderPython(pybind11::object max_disorder)
+        {
+        if (max_disorder.is(pybind11::none()))
+            {
+            m_max_disorder = Scalar(0.0);
+            }
+        else
+            {
+            m_max_disorder = max_disorder.cast<Scalar>();
+            }
+        }
+
+    /// Get the disorder at which to sort
+    pybind11::object getMaxDisorderPython()
+        {
+        if (m_max_disorder > Scalar(0.0))
+            {
+            return pybind11::cast(m_max_disorder);
+            }
+        return pybind11::none();
+        }
+
+    /// Measure the fraction of consecutive particles whose keys are out of order
+    virtual Scalar computeDisorder();
+
     protected:
     unsigned int m_grid;                      //!< Grid dimension to use
     unsigned int m_last_grid;                 //!< The last value of MMax
     unsigned int m_last_dim;                  //!< Check the last dimension we ran at
     GPUArray<unsigned int> m_traversal_order; //!< Generated traversal order of bins
 
+    /// Compute Hilbert keys directly instead of looking them up in m_traversal_order
+    bool m_high_resolution = false;
+
+    /// Sort only when the disorder reaches this value (0 sorts on every update)
+    Scalar m_max_disorder = 0;
+
+    //! Generate the traversal order table for the current grid
+    void updateTraversalOrder();
+
+    //! Sum the key inversions over all ranks and normalize them
+    Scalar reduceDisorder(unsigned long long n_inversions);
+
     //! Helper function that actually performs the sort
     virtual void getSortedOrder2D();
     //! Helper function that actually performs the sort
@@ -115,6 +172,9 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
     std::vector<std::pair<unsigned int, unsigned int>> m_particle_bins; //!< Binned particles
     std::shared_ptr<Trigger> m_trigger;
 
+    //! Compute the key of each particle in m_particle_bins
+    void binParticles();
+
 #ifdef ENABLE_MPI
     /// The systems's communicator.
     std::shared_ptr<Communicator> m_comm;
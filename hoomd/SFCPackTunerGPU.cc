@@ -71,49 +71,8 @@ void SFCPackTunerGPU::getSortedOrder3D()
 
     // reallocate memory arrays if m_grid changed
     // also regenerate the traversal order
-    if ((m_last_grid != m_grid || m_last_dim != 3) && m_sysdef->getNDimensions() == 3)
-        {
-        if (m_grid > 256)
-            {
-            unsigned int mb = m_grid * m_grid * m_grid * 4 / 1024 / 1024;
-            m_exec_conf->msg->warning()
-                << "sorter is about to allocate a very large amount of memory (" << mb << "MB)"
-                << " and may crash." << endl;
-            m_exec_conf->msg->warning() << "            Reduce the amount of memory allocated to "
-                                           "prevent this by decreasing the "
-                                        << endl;
-            m_exec_conf->msg->warning() << "            grid dimension (i.e. "
-                                           "sorter.set_params(grid=128) ) or by disabling it "
-                                        << endl;
-            m_exec_conf->msg->warning()
-                << "            ( sorter.disable() ) before beginning the run()." << endl;
-            }
-
-        // generate the traversal order
-        GPUArray<unsigned int> traversal_order(m_grid * m_grid * m_grid, m_exec_conf);
-        m_traversal_order.swap(traversal_order);
-
-        vector<unsigned int> reverse_order(m_grid * m_grid * m_grid);
-        reverse_order.clear();
-
-        // we need to start the hilbert curve with a seed order 0,1,2,3,4,5,6,7
-        unsigned int cell_order[8];
-        for (unsigned int i = 0; i < 8; i++)
-            cell_order[i] = i;
-        generateTraversalOrder(0, 0, 0, m_grid, m_grid, cell_order, reverse_order);
-
-        // access traversal order
-        ArrayHandle<unsigned int> h_traversal_order(m_traversal_order,
-                                                    access_location::host,
-                                                    access_mode::overwrite);
-
-        for (unsigned int i = 0; i < m_grid * m_grid * m_grid; i++)
-            h_traversal_order.data[reverse_order[i]] = i;
-
-        m_last_grid = m_grid;
-        // store the last system dimension computed so we can be mindful if that ever changes
-        m_last_dim = m_sysdef->getNDimensions();
-        }
+    if (m_sysdef->getNDimensions() == 3 && !m_high_resolution)
+        updateTraversalOrder();
 
     // sanity checks
     assert(m_gpu_particle_bins.getNumElements() >= m_pdata->getN());
@@ -139,17 +98,65 @@ void SFCPackTunerGPU::getSortedOrder3D()
                                       d_gpu_sort_order.data,
                                       box,
                                       m_sysdef->getNDimensions() == 2,
+                                      m_high_resolution,
                                       m_exec_conf->getCachedAllocator());
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     }
 
+Scalar SFCPackTunerGPU::computeDisorder()
+    {
+    assert(m_pdata);
+    assert(m_gpu_particle_bins.getNumElements() >= m_pdata->getN());
+
+    if (m_sysdef->getNDimensions() == 3 && !m_high_resolution)
+        updateTraversalOrder();
+
+    unsigned int n_inversions;
+        {
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_gpu_particle_bins(m_gpu_particle_bins,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+        ArrayHandle<unsigned int> d_gpu_sort_order(m_gpu_sort_order,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+        ArrayHandle<unsigned int> d_traversal_order(m_traversal_order,
+                                                    access_location::device,
+                                                    access_mode::read);
+
+        // compute the keys in the current order and count the inversions
+        kernel::gpu_sfc_bin_particles(m_pdata->getN(),
+                                      d_pos.data,
+                                      d_gpu_particle_bins.data,
+                                      d_traversal_order.data,
+                                      m_grid,
+                                      d_gpu_sort_order.data,
+                                      m_pdata->getBox(),
+                                      m_sysdef->getNDimensions() == 2,
+                                      m_high_resolution);
+
+        n_inversions = kernel::gpu_count_key_inversions(m_pdata->getN(),
+                                                        d_gpu_particle_bins.data,
+                                                        m_exec_conf->getCachedAllocator());
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    return reduceDisorder(n_inversions);
+    }
+
 void SFCPackTunerGPU::applySortOrder()
     {
     assert(m_pdata);
     assert(m_gpu_sort_order.getNumElements() >= m_pdata->getN());
 
+    m_pdata->acquireAltArrays();
+
         {
         // access alternate arrays to write to
         ArrayHandle<Scalar4> d_pos_alt(m_pdata->getAltPositions(),
@@ -303,6 +310,8 @@ void SFCPackTunerGPU::applySortOrder()
     m_pdata->swapNetVirial();
     m_pdata->swapNetForce();
     m_pdata->swapNetTorque();
+
+    m_pdata->releaseAltArrays();
     }
 
 namespace detail
@@ -12,9 +12,12 @@
 #pragma GCC diagnostic ignored "-Wconversion"
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/inner_product.h>
 #include <thrust/sort.h>
 #pragma GCC diagnostic pop
 
+#include "HilbertCurve.h"
 #include "SFCPackTunerGPU.cuh"
 
 namespace hoomd
@@ -29,7 +32,8 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
                                              const unsigned int* d_traversal_order,
                                              unsigned int n_grid,
                                              unsigned int* d_sorted_order,
-                                             const BoxDim box)
+                                             const BoxDim box,
+                                             bool high_resolution)
     {
     unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
 
@@ -41,6 +45,16 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
     Scalar3 p = make_scalar3(postype.x, postype.y, postype.z);
 
     Scalar3 f = box.makeFraction(p);
+
+    // store index of ptl
+    d_sorted_order[idx] = idx;
+
+    if (high_resolution)
+        {
+        d_particle_bins[idx] = detail::hilbert_key(f, twod);
+        return;
+        }
+
     int ib = (unsigned int)(f.x * n_grid) % n_grid;
     int jb = (unsigned int)(f.y * n_grid) % n_grid;
     int kb = (unsigned int)(f.z * n_grid) % n_grid;
@@ -74,9 +88,6 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
         bin = ib * (n_grid * n_grid) + jb * n_grid + kb;
         d_particle_bins[idx] = d_traversal_order[bin];
         }
-
-    // store index of ptl
-    d_sorted_order[idx] = idx;
     }
 
 /*! \param N number of local particles
@@ -84,19 +95,20 @@ __global__ void gpu_sfc_bin_particles_kernel(unsigned int N,
     \param d_particle_bins Device array of particle bins
     \param d_traversal_order Device array of Hilbert-curve bins
     \param n_grid Number of grid elements along one edge
-    \param d_sorted_order Sorted order of particles
+    \param d_sorted_order Identity order of particles (output)
     \param box Box dimensions
     \param twod If true, bin particles in two dimensions
+    \param high_resolution If true, compute Hilbert keys directly instead of using the table
     */
-void gpu_generate_sorted_order(unsigned int N,
-                               const Scalar4* d_pos,
-                               unsigned int* d_particle_bins,
-                               unsigned int* d_traversal_order,
-                               unsigned int n_grid,
-                               unsigned int* d_sorted_order,
-                               const BoxDim& box,
-                               bool twod,
-                               CachedAllocator& alloc)
+void gpu_sfc_bin_particles(unsigned int N,
+                           const Scalar4* d_pos,
+                           unsigned int* d_particle_bins,
+                           const unsigned int* d_traversal_order,
+                           unsigned int n_grid,
+                           unsigned int* d_sorted_order,
+                           const BoxDim& box,
+                           bool twod,
+                           bool high_resolution)
     {
     // maybe need to autotune, but SFCPackTuner is called infrequently
     unsigned int block_size = 256;
@@ -114,7 +126,8 @@ void gpu_generate_sorted_order(unsigned int N,
                            d_traversal_order,
                            n_grid,
                            d_sorted_order,
-                           box);
+                           box,
+                           high_resolution);
     else
         hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_sfc_bin_particles_kernel<false>),
                            dim3(n_blocks),
@@ -127,7 +140,42 @@ void gpu_generate_sorted_order(unsigned int N,
                            d_traversal_order,
                            n_grid,
                            d_sorted_order,
-                           box);
+                           box,
+                           high_resolution);
+    }
+
+/*! \param N number of local particles
+    \param d_pos Device array of positions
+    \param d_particle_bins Device array of particle bins
+    \param d_traversal_order Device array of Hilbert-curve bins
+    \param n_grid Number of grid elements along one edge
+    \param d_sorted_order Sorted order of particles
+    \param box Box dimensions
+    \param twod If true, bin particles in two dimensions
+    \param high_resolution If true, compute Hilbert keys directly instead of using the table
+
+    The keys are unsigned integers, so thrust sorts them with a device radix sort.
+    */
+void gpu_generate_sorted_order(unsigned int N,
+                               const Scalar4* d_pos,
+                               unsigned int* d_particle_bins,
+                               unsigned int* d_traversal_order,
+                               unsigned int n_grid,
+                               unsigned int* d_sorted_order,
+                               const BoxDim& box,
+                               bool twod,
+                               bool high_resolution,
+                               CachedAllocator& alloc)
+    {
+    gpu_sfc_bin_particles(N,
+                          d_pos,
+                          d_particle_bins,
+                          d_traversal_order,
+                          n_grid,
+                          d_sorted_order,
+                          box,
+                          twod,
+                          high_resolution);
 
     // Sort particles
     if (N)
@@ -145,6 +193,31 @@ void gpu_generate_sorted_order(unsigned int N,
         }
     }
 
+/*! \param N Number of keys
+    \param d_keys Device array of keys
+    \param alloc Caching allocator for temporary storage
+    \returns Number of keys that are larger than the key following them
+*/
+unsigned int
+gpu_count_key_inversions(unsigned int N, const unsigned int* d_keys, CachedAllocator& alloc)
+    {
+    if (N < 2)
+        return 0;
+
+    thrust::device_ptr<const unsigned int> keys(d_keys);
+#ifdef __HIP_PLATFORM_HCC__
+    return thrust::inner_product(thrust::hip::par(alloc),
+#else
+    return thrust::inner_product(thrust::cuda::par(alloc),
+#endif
+                                 keys,
+                                 keys + N - 1,
+                                 keys + 1,
+                                 0u,
+                                 thrust::plus<unsigned int>(),
+                                 thrust::greater<unsigned int>());
+    }
+
 //! Kernel to apply sorted order
 __global__ void gpu_apply_sorted_order_kernel(unsigned int N,
                                               unsigned int n_ghost,
@@ -17,6 +17,17 @@ namespace hoomd
     {
 namespace kernel
     {
+//! Compute the key of each particle on the GPU
+void gpu_sfc_bin_particles(unsigned int N,
+                           const Scalar4* d_pos,
+                           unsigned int* d_particle_bins,
+                           const unsigned int* d_traversal_order,
+                           unsigned int n_grid,
+                           unsigned int* d_sorted_order,
+                           const BoxDim& box,
+                           bool twod,
+                           bool high_resolution);
+
 //! Generate sorted order on GPU
 void gpu_generate_sorted_order(unsigned int N,
                                const Scalar4* d_pos,
@@ -26,8 +37,13 @@ void gpu_generate_sorted_order(unsigned int N,
                                unsigned int* d_sorted_order,
                                const BoxDim& box,
                                bool twod,
+                               bool high_resolution,
                                CachedAllocator& alloc);
 
+//! Count the consecutive keys that are out of order
+unsigned int
+gpu_count_key_inversions(unsigned int N, const unsigned int* d_keys, CachedAllocator& alloc);
+
 //! Reorder particle data (GPU driver function)
 void gpu_apply_sorted_order(unsigned int N,
                             unsigned int n_ghost,
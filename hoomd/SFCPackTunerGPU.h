@@ -41,6 +41,9 @@ class PYBIND11_EXPORT SFCPackTunerGPU : public SFCPackTuner
     //! Destructor
     virtual ~SFCPackTunerGPU();
 
+    /// Measure the fraction of consecutive particles whose keys are out of order
+    virtual Scalar computeDisorder();
+
     protected:
     // reallocate internal data structure
     virtual void reallocate();
@@ -0,0 +1,398 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file SharedMemoryWriter.cc
+    \brief Defines the SharedMemoryWriter class
+*/
+
+#include "SharedMemoryWriter.h"
+
+#include <pybind11/stl.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace detail
+    {
+//! Names of the quantities in the order of their bits and their storage in a slot
+static const char* shm_field_names[] = {"position", "orientation", "typeid", "image", "velocity"};
+
+//! Number of 4 byte values per particle of each quantity
+static const unsigned int shm_field_width[] = {3, 4, 1, 3, 3};
+
+static const unsigned int shm_n_fields = 5;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "The shared memory sequence numbers require lock-free 64-bit atomics");
+
+//! Get the atomic 64-bit value at an offset in the mapping
+static std::atomic<uint64_t>* shm_atomic(char* base, size_t offset)
+    {
+    return reinterpret_cast<std::atomic<uint64_t>*>(base + offset);
+    }
+    } // end namespace detail
+
+/*! \param sysdef System definition
+    \param trigger Trigger selecting the timesteps to publish
+    \param name Name of the shared memory object (without the leading /)
+    \param group Group of particles to publish
+    \param quantities Names of the per-particle quantities to publish
+    \param n_slots Number of slots in the ring
+*/
+SharedMemoryWriter::SharedMemoryWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                       std::shared_ptr<Trigger> trigger,
+                                       const std::string& name,
+                                       std::shared_ptr<ParticleGroup> group,
+                                       const std::vector<std::string>& quantities,
+                                       unsigned int n_slots)
+    : Analyzer(sysdef, trigger), m_name(name), m_group(group), m_n_slots(n_slots)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing SharedMemoryWriter: " << name << endl;
+
+    if (name.empty() || name.find('/') != std::string::npos)
+        {
+        throw std::invalid_argument("Shared memory name must be non-empty and may not contain /");
+        }
+
+    if (n_slots < 2)
+        {
+        throw std::invalid_argument("SharedMemoryWriter requires at least 2 slots");
+        }
+
+    for (const auto& quantity : quantities)
+        {
+        unsigned int i = 0;
+        while (i < detail::shm_n_fields && quantity != detail::shm_field_names[i])
+            i++;
+
+        if (i == detail::shm_n_fields)
+            {
+            throw std::invalid_argument("Unknown shared memory quantity: " + quantity);
+            }
+
+        m_fields |= 1 << i;
+        }
+
+    if (m_fields == 0)
+        {
+        throw std::invalid_argument("SharedMemoryWriter requires at least one quantity");
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order = GatherTagOrder(m_exec_conf->getMPICommunicator());
+        }
+#endif
+    }
+
+SharedMemoryWriter::~SharedMemoryWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying SharedMemoryWriter" << endl;
+    closeSharedMemory();
+    }
+
+std::vector<std::string> SharedMemoryWriter::getQuantities()
+    {
+    std::vector<std::string> result;
+    for (unsigned int i = 0; i < detail::shm_n_fields; i++)
+        {
+        if (m_fields & (1 << i))
+            result.push_back(detail::shm_field_names[i]);
+        }
+    return result;
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Stages the local group members, gathers them on the root rank, and copies them into the next
+    slot of the ring.
+*/
+void SharedMemoryWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+    populateLocalFrame();
+
+    const std::vector<vec3<float>>* position = &m_local_position;
+    const std::vector<quat<float>>* orientation = &m_local_orientation;
+    const std::vector<unsigned int>* type_id = &m_local_typeid;
+    const std::vector<int3>* image = &m_local_image;
+    const std::vector<vec3<float>>* velocity = &m_local_velocity;
+    size_t N = m_local_tag.size();
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order.setLocalTagsSorted(m_local_tag);
+        if (m_fields & field_position)
+            m_gather_tag_order.gatherArray(m_global_position, m_local_position);
+        if (m_fields & field_orientation)
+            m_gather_tag_order.gatherArray(m_global_orientation, m_local_orientation);
+        if (m_fields & field_typeid)
+            m_gather_tag_order.gatherArray(m_global_typeid, m_local_typeid);
+        if (m_fields & field_image)
+            m_gather_tag_order.gatherArray(m_global_image, m_local_image);
+        if (m_fields & field_velocity)
+            m_gather_tag_order.gatherArray(m_global_velocity, m_local_velocity);
+
+        position = &m_global_position;
+        orientation = &m_global_orientation;
+        type_id = &m_global_typeid;
+        image = &m_global_image;
+        velocity = &m_global_velocity;
+        N = m_group->getNumMembersGlobal();
+        }
+#endif
+
+    if (!m_exec_conf->isRoot())
+        {
+        m_n_frames++;
+        return;
+        }
+
+    if (m_map == nullptr)
+        openSharedMemory(N);
+
+    if (N > m_capacity)
+        {
+        std::ostringstream s;
+        s << "SharedMemoryWriter: " << N << " particles exceed the capacity of " << m_capacity
+          << " set by the first frame.";
+        throw std::runtime_error(s.str());
+        }
+
+    publish(timestep, N, *position, *orientation, *type_id, *image, *velocity);
+    m_n_frames++;
+    }
+
+/*! Collect the requested quantities of the group members owned by this rank in ascending tag
+    order. Positions and images are wrapped into the global box relative to the origin, as in a
+    particle data snapshot.
+*/
+void SharedMemoryWriter::populateLocalFrame()
+    {
+    const BoxDim box = m_pdata->getGlobalBox();
+    const vec3<Scalar> origin(m_pdata->getOrigin());
+    const int3 origin_image = m_pdata->getOriginImage();
+    const unsigned int N = m_pdata->getN();
+
+    m_local_tag.clear();
+    m_local_position.clear();
+    m_local_orientation.clear();
+    m_local_typeid.clear();
+    m_local_image.clear();
+    m_local_velocity.clear();
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_velocity(m_pdata->getVelocities(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    const unsigned int n_members = m_group->getNumMembersGlobal();
+    for (unsigned int group_idx = 0; group_idx < n_members; group_idx++)
+        {
+        const unsigned int tag = m_group->getMemberTag(group_idx);
+        const unsigned int idx = h_rtag.data[tag];
+        if (idx >= N)
+            continue;
+
+        m_local_tag.push_back(tag);
+
+        if (m_fields & (field_position | field_image))
+            {
+            vec3<Scalar> pos = vec3<Scalar>(h_postype.data[idx]) - origin;
+            int3 image = h_image.data[idx];
+            image.x -= origin_image.x;
+            image.y -= origin_image.y;
+            image.z -= origin_image.z;
+            box.wrap(pos, image);
+
+            if (m_fields & field_position)
+                m_local_position.push_back(vec3<float>(pos));
+            if (m_fields & field_image)
+                m_local_image.push_back(image);
+            }
+
+        if (m_fields & field_orientation)
+            m_local_orientation.push_back(quat<float>(quat<Scalar>(h_orientation.data[idx])));
+
+        if (m_fields & field_typeid)
+            m_local_typeid.push_back(__scalar_as_int(h_postype.data[idx].w));
+
+        if (m_fields & field_velocity)
+            m_local_velocity.push_back(vec3<float>(vec3<Scalar>(h_velocity.data[idx])));
+        }
+    }
+
+/*! \param capacity Number of particles each slot holds
+
+    Creates the shared memory object (replacing a stale one with the same name), sizes it, maps it,
+    and writes the header.
+*/
+void SharedMemoryWriter::openSharedMemory(size_t capacity)
+    {
+    m_capacity = capacity;
+    m_slot_bytes = slot_header_bytes;
+    for (unsigned int i = 0; i < detail::shm_n_fields; i++)
+        {
+        if (m_fields & (1 << i))
+            m_slot_bytes += m_capacity * detail::shm_field_width[i] * 4;
+        }
+    // keep the sequence numbers of every slot 8 byte aligned
+    m_slot_bytes = (m_slot_bytes + 7) / 8 * 8;
+    m_map_bytes = header_bytes + m_slot_bytes * m_n_slots;
+
+    const std::string path = "/" + m_name;
+    m_fd = shm_open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if (m_fd == -1)
+        {
+        throw std::runtime_error("Could not create shared memory " + path + ": "
+                                 + std::strerror(errno));
+        }
+
+    if (ftruncate(m_fd, static_cast<off_t>(m_map_bytes)) == -1)
+        {
+        const std::string error = std::strerror(errno);
+        closeSharedMemory();
+        throw std::runtime_error("Could not resize shared memory " + path + ": " + error);
+        }
+
+    void* map = mmap(nullptr, m_map_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (map == MAP_FAILED)
+        {
+        const std::string error = std::strerror(errno);
+        closeSharedMemory();
+        throw std::runtime_error("Could not map shared memory " + path + ": " + error);
+        }
+    m_map = static_cast<char*>(map);
+
+    // ftruncate zero fills the object, so every slot starts with an even (empty) sequence number
+    std::memcpy(m_map, "HOOMDSHM", 8);
+    const uint32_t version = layout_version;
+    const uint32_t n_slots = m_n_slots;
+    const uint64_t slot_bytes = m_slot_bytes;
+    const uint64_t capacity_u64 = m_capacity;
+    const uint32_t fields = m_fields;
+    std::memcpy(m_map + 8, &version, sizeof(version));
+    std::memcpy(m_map + 12, &n_slots, sizeof(n_slots));
+    std::memcpy(m_map + 16, &slot_bytes, sizeof(slot_bytes));
+    std::memcpy(m_map + 24, &capacity_u64, sizeof(capacity_u64));
+    std::memcpy(m_map + 40, &fields, sizeof(fields));
+    detail::shm_atomic(m_map, 32)->store(0, std::memory_order_release);
+
+    m_exec_conf->msg->notice(3) << "SharedMemoryWriter: mapped " << m_map_bytes << " bytes at "
+                                << path << endl;
+    }
+
+void SharedMemoryWriter::closeSharedMemory()
+    {
+    if (m_map != nullptr)
+        {
+        munmap(m_map, m_map_bytes);
+        m_map = nullptr;
+        }
+
+    if (m_fd != -1)
+        {
+        close(m_fd);
+        m_fd = -1;
+        const std::string path = "/" + m_name;
+        shm_unlink(path.c_str());
+        }
+    }
+
+/*! Write the frame with the seqlock protocol: mark the slot odd, copy the data, mark it even, and
+    then advance the published frame count. Readers that observe the same even sequence number
+    before and after copying a slot have a consistent frame.
+*/
+void SharedMemoryWriter::publish(uint64_t timestep,
+                                 size_t N,
+                                 const std::vector<vec3<float>>& position,
+                                 const std::vector<quat<float>>& orientation,
+                                 const std::vector<unsigned int>& type_id,
+                                 const std::vector<int3>& image,
+                                 const std::vector<vec3<float>>& velocity)
+    {
+    char* slot = m_map + header_bytes + (m_n_frames % m_n_slots) * m_slot_bytes;
+    std::atomic<uint64_t>* sequence = detail::shm_atomic(slot, 0);
+
+    const uint64_t old_sequence = sequence->load(std::memory_order_relaxed);
+    sequence->store(old_sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const Scalar3 L = box.getL();
+    const double box_values[6] = {L.x,
+                                  L.y,
+                                  L.z,
+                                  box.getTiltFactorXY(),
+                                  box.getTiltFactorXZ(),
+                                  box.getTiltFactorYZ()};
+    const uint64_t timestep_u64 = timestep;
+    const uint64_t N_u64 = N;
+    std::memcpy(slot + 8, &timestep_u64, sizeof(timestep_u64));
+    std::memcpy(slot + 16, &N_u64, sizeof(N_u64));
+    std::memcpy(slot + 24, box_values, sizeof(box_values));
+
+    // vec3<float>, quat<float> (s first), and int3 are tightly packed 4 byte values
+    const void* data[] = {position.data(),
+                          orientation.data(),
+                          type_id.data(),
+                          image.data(),
+                          velocity.data()};
+    char* field = slot + slot_header_bytes;
+    for (unsigned int i = 0; i < detail::shm_n_fields; i++)
+        {
+        if (!(m_fields & (1 << i)))
+            continue;
+
+        const size_t row_bytes = detail::shm_field_width[i] * 4;
+        if (N > 0)
+            std::memcpy(field, data[i], N * row_bytes);
+        field += m_capacity * row_bytes;
+        }
+
+    sequence->store(old_sequence + 2, std::memory_order_release);
+    detail::shm_atomic(m_map, 32)->store(m_n_frames + 1, std::memory_order_release);
+    }
+
+namespace detail
+    {
+void export_SharedMemoryWriter(pybind11::module& m)
+    {
+    pybind11::class_<SharedMemoryWriter, Analyzer, std::shared_ptr<SharedMemoryWriter>>(
+        m,
+        "SharedMemoryWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::string,
+                            std::shared_ptr<ParticleGroup>,
+                            std::vector<std::string>,
+                            unsigned int>())
+        .def_property_readonly("name", &SharedMemoryWriter::getName)
+        .def_property_readonly("slots", &SharedMemoryWriter::getNumSlots)
+        .def_property_readonly("quantities", &SharedMemoryWriter::getQuantities)
+        .def_property_readonly("num_frames", &SharedMemoryWriter::getNumFrames);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,177 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __SHARED_MEMORY_WRITER_H__
+#define __SHARED_MEMORY_WRITER_H__
+
+#include "Analyzer.h"
+#include "ParticleGroup.h"
+#include "VectorMath.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*! \file SharedMemoryWriter.h
+    \brief Declares the SharedMemoryWriter class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Publish frames to a ring of slots in POSIX shared memory
+/*! SharedMemoryWriter copies selected per-particle quantities of a group, in ascending tag order,
+    to a shared memory object that other processes on the same node can map, so they can follow
+    the simulation without going through the file system. The root rank creates the object on
+    the first call to analyze() and removes it in the destructor.
+
+    The object starts with a header of header_bytes bytes followed by n_slots slots. Frame k
+    (counting from 1) is written to slot (k - 1) % n_slots. All values are little-endian.
+
+    Header:
+    - 0: char[8] magic ("HOOMDSHM")
+    - 8: uint32 layout version
+    - 12: uint32 number of slots
+    - 16: uint64 bytes per slot
+    - 24: uint64 particle capacity of each slot
+    - 32: uint64 number of frames published (updated after each frame is complete)
+    - 40: uint32 bit mask of the quantities in each slot (see field)
+
+    Slot:
+    - 0: uint64 sequence number, odd while the slot is written
+    - 8: uint64 timestep
+    - 16: uint64 number of particles N
+    - 24: float64[6] box (Lx, Ly, Lz, xy, xz, yz)
+    - slot_header_bytes: for each quantity in the mask, capacity * width values of 4 bytes. The
+      first N rows are valid.
+
+    Readers retry when the sequence number is odd or changes while they copy a slot. The capacity
+    is the number of group members on the first frame. A larger group raises an error.
+
+    On MPI runs, GatherTagOrder collects the local members on the root rank.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT SharedMemoryWriter : public Analyzer
+    {
+    public:
+    //! Construct the writer
+    SharedMemoryWriter(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<Trigger> trigger,
+                       const std::string& name,
+                       std::shared_ptr<ParticleGroup> group,
+                       const std::vector<std::string>& quantities,
+                       unsigned int n_slots);
+
+    //! Destructor
+    virtual ~SharedMemoryWriter();
+
+    //! Publish the current frame
+    virtual void analyze(uint64_t timestep);
+
+    /// Get the name of the shared memory object
+    std::string getName()
+        {
+        return m_name;
+        }
+
+    /// Get the number of slots
+    unsigned int getNumSlots()
+        {
+        return m_n_slots;
+        }
+
+    /// Get the number of frames published
+    uint64_t getNumFrames()
+        {
+        return m_n_frames;
+        }
+
+    //! Get the published quantities
+    std::vector<std::string> getQuantities();
+
+    /// Size of the header (bytes)
+    static const unsigned int header_bytes = 128;
+
+    /// Size of the header of each slot (bytes)
+    static const unsigned int slot_header_bytes = 128;
+
+    /// Layout version written to the header
+    static const unsigned int layout_version = 1;
+
+    /// Bits of the quantity mask
+    enum field
+        {
+        field_position = 1,
+        field_orientation = 2,
+        field_typeid = 4,
+        field_image = 8,
+        field_velocity = 16,
+        };
+
+    protected:
+    std::string m_name;                     //!< Name of the shared memory object
+    std::shared_ptr<ParticleGroup> m_group; //!< Group of particles to publish
+    unsigned int m_fields = 0;              //!< Bit mask of the published quantities
+    unsigned int m_n_slots;                 //!< Number of slots in the ring
+    uint64_t m_n_frames = 0;                //!< Number of frames published
+
+    int m_fd = -1;           //!< File descriptor of the shared memory object (root rank)
+    char* m_map = nullptr;   //!< Mapping of the shared memory object (root rank)
+    size_t m_map_bytes = 0;  //!< Size of the mapping
+    size_t m_capacity = 0;   //!< Particle capacity of each slot
+    size_t m_slot_bytes = 0; //!< Size of each slot
+
+    std::vector<unsigned int> m_local_tag;        //!< Tags of the local members, ascending
+    std::vector<vec3<float>> m_local_position;    //!< Positions of the local members
+    std::vector<quat<float>> m_local_orientation; //!< Orientations of the local members
+    std::vector<unsigned int> m_local_typeid;     //!< Types of the local members
+    std::vector<int3> m_local_image;              //!< Images of the local members
+    std::vector<vec3<float>> m_local_velocity;    //!< Velocities of the local members
+
+    std::vector<vec3<float>> m_global_position;    //!< Positions in tag order (root rank)
+    std::vector<quat<float>> m_global_orientation; //!< Orientations in tag order (root rank)
+    std::vector<unsigned int> m_global_typeid;     //!< Types in tag order (root rank)
+    std::vector<int3> m_global_image;              //!< Images in tag order (root rank)
+    std::vector<vec3<float>> m_global_velocity;    //!< Velocities in tag order (root rank)
+
+#ifdef ENABLE_MPI
+    GatherTagOrder m_gather_tag_order; //!< Gathers the member arrays on the root rank
+#endif
+
+    //! Stage the quantities of the local group members
+    void populateLocalFrame();
+
+    //! Create and map the shared memory object
+    void openSharedMemory(size_t capacity);
+
+    //! Close and remove the shared memory object
+    void closeSharedMemory();
+
+    //! Copy a frame into the next slot
+    void publish(uint64_t timestep,
+                 size_t N,
+                 const std::vector<vec3<float>>& position,
+                 const std::vector<quat<float>>& orientation,
+                 const std::vector<unsigned int>& type_id,
+                 const std::vector<int3>& image,
+                 const std::vector<vec3<float>>& velocity);
+    };
+
+namespace detail
+    {
+//! Exports the SharedMemoryWriter class to python
+void export_SharedMemoryWriter(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+#endif
@@ -43,7 +43,8 @@ void SnapshotSystemData<Real>::replicate(unsigned int nx, unsigned int ny, unsig
 
 template<class Real> void SnapshotSystemData<Real>::wrap()
     {
-    // HOOMD particles
+    // HOOMD particles, wrapped in the snapshot's own storage
+    particle_data.materialize();
     for (unsigned int i = 0; i < particle_data.size; i++)
         {
         auto const frac = global_box->makeFraction(particle_data.pos[i]);
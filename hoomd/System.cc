@@ -14,6 +14,7 @@
 #include <pybind11/cast.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl_bind.h>
+#include <optional>
 #include <stdexcept>
 #include <time.h>
 
@@ -41,6 +42,9 @@ System::System(std::shared_ptr<SystemDefinition> sysdef, uint64_t initial_tstep)
     assert(m_sysdef);
     m_exec_conf = m_sysdef->getParticleData()->getExecConf();
 
+    // compute the potential energy on every step unless the user opts out
+    m_default_flags[pdata_flag::potential_energy] = 1;
+
 #ifdef ENABLE_MPI
     // the initial time step is defined on the root processor
     if (m_sysdef->getParticleData()->getDomainDecomposition())
@@ -49,6 +53,12 @@ System::System(std::shared_ptr<SystemDefinition> sysdef, uint64_t initial_tstep)
         bcast(m_cur_tstep, 0, m_exec_conf->getMPICommunicator());
         }
 #endif
+
+    // autotuners constructed for this system look up cache entries for its size
+    if (auto cache = m_exec_conf->getAutotunerCache())
+        {
+        cache->setProblemSize(m_sysdef->getParticleData()->getNGlobal());
+        }
     }
 
 // -------------- Integrator methods
@@ -82,13 +92,26 @@ void System::run(uint64_t nsteps, bool write_at_start)
     m_start_tstep = m_cur_tstep;
     m_end_tstep = m_cur_tstep + nsteps;
 
+    // let other Python threads run during the C++ work, operations that call Python acquire the GIL
+    std::optional<pybind11::gil_scoped_release> release_gil;
+    if (PyGILState_Check())
+        {
+        release_gil.emplace();
+        }
+
     // initialize the last status time
     m_initial_time = m_clk.getTime();
     m_last_walltime = 0.0;
+    m_last_signal_check = 0.0;
     m_last_TPS = 0.0;
 
     resetStats();
 
+    if (auto cache = m_exec_conf->getAutotunerCache())
+        {
+        cache->setProblemSize(m_sysdef->getParticleData()->getNGlobal());
+        }
+
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -117,31 +140,49 @@ void System::run(uint64_t nsteps, bool write_at_start)
     // cannot generate on the first step
     m_sysdef->getParticleData()->setFlags(determineFlags(m_cur_tstep));
 
+    const Profiler& profiler = m_sysdef->getProfiler();
+    MemoryTracker& memory_tracker = m_exec_conf->getMemoryTracker();
+
     // execute analyzers on initial step if requested
     if (write_at_start)
         {
-        for (auto& analyzer : m_analyzers)
+        for (size_t i = 0; i < m_analyzers.size(); i++)
             {
-            if ((*analyzer->getTrigger())(m_cur_tstep))
+            auto& analyzer = m_analyzers[i];
+            if (isTriggered(m_analyzer_schedule, i, analyzer->getTrigger(), m_cur_tstep))
+                {
+                ProfileScope profile(profiler, analyzer->getProfileTimer());
+                MemoryTracker::Scope memory(memory_tracker, analyzer->getMemoryTag());
                 analyzer->analyze(m_cur_tstep);
+                }
             }
         }
 
     // run the steps
     for (uint64_t count = 0; count < nsteps; count++)
         {
-        for (auto& tuner : m_tuners)
+        for (size_t i = 0; i < m_tuners.size(); i++)
             {
-            if ((*tuner->getTrigger())(m_cur_tstep))
+            auto& tuner = m_tuners[i];
+            if (isTriggered(m_tuner_schedule, i, tuner->getTrigger(), m_cur_tstep))
+                {
+                ProfileScope profile(profiler, tuner->getProfileTimer());
+                MemoryTracker::Scope memory(memory_tracker, tuner->getMemoryTag());
                 tuner->update(m_cur_tstep);
+                }
             }
 
         // execute updaters
-        for (auto& updater : m_updaters)
+        for (size_t i = 0; i < m_updaters.size(); i++)
             {
-            if ((*updater->getTrigger())(m_cur_tstep))
+            auto& updater = m_updaters[i];
+            if (isTriggered(m_updater_schedule, i, updater->getTrigger(), m_cur_tstep))
                 {
-                updater->update(m_cur_tstep);
+                    {
+                    ProfileScope profile(profiler, updater->getProfileTimer());
+                    MemoryTracker::Scope memory(memory_tracker, updater->getMemoryTag());
+                    updater->update(m_cur_tstep);
+                    }
                 m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
                 }
             }
@@ -159,23 +200,38 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
         // execute the integrator
         if (m_integrator)
+            {
+            ProfileScope profile(profiler, m_integrator->getProfileTimer());
+            MemoryTracker::Scope memory(memory_tracker, m_integrator->getMemoryTag());
             m_integrator->update(m_cur_tstep);
+            }
 
         m_cur_tstep++;
 
         // execute analyzers after incrementing the step counter
-        for (auto& analyzer : m_analyzers)
+        for (size_t i = 0; i < m_analyzers.size(); i++)
             {
-            if ((*analyzer->getTrigger())(m_cur_tstep))
+            auto& analyzer = m_analyzers[i];
+            if (isTriggered(m_analyzer_schedule, i, analyzer->getTrigger(), m_cur_tstep))
+                {
+                ProfileScope profile(profiler, analyzer->getProfileTimer());
+                MemoryTracker::Scope memory(memory_tracker, analyzer->getMemoryTag());
                 analyzer->analyze(m_cur_tstep);
+                }
             }
 
         updateTPS();
 
-        // propagate Python exceptions related to signals
-        if (PyErr_CheckSignals() != 0)
+        // propagate Python exceptions related to signals, checking periodically to avoid contending
+        // for the GIL with other threads every step
+        if (m_last_walltime - m_last_signal_check >= signal_check_interval || count + 1 == nsteps)
             {
-            throw pybind11::error_already_set();
+            m_last_signal_check = m_last_walltime;
+            pybind11::gil_scoped_acquire acquire_gil;
+            if (PyErr_CheckSignals() != 0)
+                {
+                throw pybind11::error_already_set();
+                }
             }
         }
     }
@@ -219,27 +275,74 @@ PDataFlags System::determineFlags(uint64_t tstep)
     if (m_integrator)
         flags |= m_integrator->getRequestedPDataFlags();
 
-    for (auto& analyzer : m_analyzers)
+    for (size_t i = 0; i < m_analyzers.size(); i++)
         {
-        if ((*analyzer->getTrigger())(tstep))
-            flags |= analyzer->getRequestedPDataFlags();
+        if (isTriggered(m_analyzer_schedule, i, m_analyzers[i]->getTrigger(), tstep))
+            flags |= m_analyzers[i]->getRequestedPDataFlags();
         }
 
-    for (auto& updater : m_updaters)
+    for (size_t i = 0; i < m_updaters.size(); i++)
         {
-        if ((*updater->getTrigger())(tstep))
-            flags |= updater->getRequestedPDataFlags();
+        if (isTriggered(m_updater_schedule, i, m_updaters[i]->getTrigger(), tstep))
+            flags |= m_updaters[i]->getRequestedPDataFlags();
         }
 
-    for (auto& tuner : m_tuners)
+    for (size_t i = 0; i < m_tuners.size(); i++)
         {
-        if ((*tuner->getTrigger())(tstep))
-            flags |= tuner->getRequestedPDataFlags();
+        if (isTriggered(m_tuner_schedule, i, m_tuners[i]->getTrigger(), tstep))
+            flags |= m_tuners[i]->getRequestedPDataFlags();
         }
 
     return flags;
     }
 
+/*! \param schedule Activation bounds of the operations in one list
+    \param i Index of the operation in the list
+    \param trigger The operation's trigger
+    \param timestep Time step to query
+
+    The trigger is evaluated only when \a timestep lies outside the range on which it is known to
+    be inactive. After each evaluation, the range is extended with Trigger::nextActivation() so
+    that triggers with closed forms (and Python triggers nested in them) are not called on every
+    step. Bounds are discarded when the operation's trigger is replaced or any trigger changes.
+
+    \returns true when the operation should run on \a timestep
+*/
+bool System::isTriggered(std::vector<TriggerScheduleEntry>& schedule,
+                         size_t i,
+                         const std::shared_ptr<Trigger>& trigger,
+                         uint64_t timestep)
+    {
+    if (schedule.size() <= i)
+        {
+        schedule.resize(i + 1);
+        }
+
+    TriggerScheduleEntry& entry = schedule[i];
+    uint64_t generation = Trigger::getGeneration();
+    if (entry.trigger == trigger.get() && entry.generation == generation && timestep >= entry.begin
+        && timestep < entry.end)
+        {
+        return false;
+        }
+
+    bool result = (*trigger)(timestep);
+
+    entry.trigger = trigger.get();
+    entry.generation = generation;
+    if (timestep != Trigger::never)
+        {
+        entry.begin = timestep + 1;
+        entry.end = trigger->nextActivation(timestep + 1);
+        }
+    else
+        {
+        entry.begin = entry.end = 0;
+        }
+
+    return result;
+    }
+
 /*! Apply the degrees of freedom given by the integrator to all groups in the cache.
  */
 void System::updateGroupDOF()
@@ -279,6 +382,8 @@ void export_System(pybind11::module& m)
         .def("getCurrentTimeStep", &System::getCurrentTimeStep)
         .def("setPressureFlag", &System::setPressureFlag)
         .def("getPressureFlag", &System::getPressureFlag)
+        .def("setEnergyFlag", &System::setEnergyFlag)
+        .def("getEnergyFlag", &System::getEnergyFlag)
         .def_property_readonly("walltime", &System::getCurrentWalltime)
         .def_property_readonly("final_timestep", &System::getEndStep)
         .def_property_readonly("initial_timestep", &System::getStartStep)
@@ -89,6 +89,10 @@ class PYBIND11_EXPORT System
         @param nsteps Number of steps to advance the simulation
         @param write_at_start Set to true to evaluate writers before the
             loop
+
+        run() releases the GIL so that other Python threads can execute while
+        the simulation runs. Operations that call into Python must acquire it
+        with pybind11::gil_scoped_acquire.
     */
     void run(uint64_t nsteps, bool write_at_start = false);
 
@@ -176,6 +180,18 @@ class PYBIND11_EXPORT System
         return m_default_flags[pdata_flag::pressure_tensor];
         }
 
+    /// Set potential energy computation particle data flag
+    void setEnergyFlag(bool flag)
+        {
+        m_default_flags[pdata_flag::potential_energy] = flag;
+        }
+
+    /// Get the potential energy computation particle data flag
+    bool getEnergyFlag()
+        {
+        return m_default_flags[pdata_flag::potential_energy];
+        }
+
     /// Get the particle group cache.
     std::vector<std::shared_ptr<ParticleGroup>>& getGroupCache()
         {
@@ -189,6 +205,21 @@ class PYBIND11_EXPORT System
         }
 
     private:
+    /// Cached activation bound of one operation's trigger
+    struct TriggerScheduleEntry
+        {
+        const Trigger* trigger = nullptr; //!< Trigger the bound was computed for
+        uint64_t generation = 0;          //!< Trigger::getGeneration() when computed
+        uint64_t begin = 0;               //!< The trigger is inactive on [begin, end)
+        uint64_t end = 0;                 //!< Next step on which the trigger may be active
+        };
+
+    /// Evaluate the trigger of an operation, skipping steps on which it cannot be active
+    bool isTriggered(std::vector<TriggerScheduleEntry>& schedule,
+                     size_t i,
+                     const std::shared_ptr<Trigger>& trigger,
+                     uint64_t timestep);
+
     /// Update the number of degrees of freedom in cached groups
     void updateGroupDOF();
 
@@ -201,6 +232,11 @@ class PYBIND11_EXPORT System
 
     std::vector<std::shared_ptr<Compute>> m_computes; //!< list of Computes belonging to this System
 
+    /// Trigger activation bounds of the analyzers, updaters, and tuners (by list index)
+    std::vector<TriggerScheduleEntry> m_analyzer_schedule;
+    std::vector<TriggerScheduleEntry> m_updater_schedule;
+    std::vector<TriggerScheduleEntry> m_tuner_schedule;
+
     std::shared_ptr<Integrator> m_integrator;   //!< Integrator that advances time in this System
     std::shared_ptr<SystemDefinition> m_sysdef; //!< SystemDefinition for this System
 
@@ -234,6 +270,12 @@ class PYBIND11_EXPORT System
     /// Store the last recorded walltime
     double m_last_walltime = 0;
 
+    /// Walltime of the last check for pending Python signals
+    double m_last_signal_check = 0;
+
+    /// Seconds between checks for pending Python signals
+    static constexpr double signal_check_interval = 0.05;
+
     /// Update the TPS average
     void updateTPS();
 
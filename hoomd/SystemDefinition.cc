@@ -121,6 +121,52 @@ SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> sna
         bcast(m_n_dimensions, 0, exec_conf->getMPICommunicator());
 #endif
 
+    constructTopology(snapshot, exec_conf, decomposition);
+    }
+
+/*! \param snapshot Snapshot with the global box, types, and topology (particle data is empty)
+    \param local_particle_data Slice of the particle data held by this rank
+    \param tag_offset Tag of the first particle in \a local_particle_data
+    \param n_global Global number of particles
+    \param exec_conf Execution configuration to run on
+    \param decomposition The domain decomposition layout
+
+    The root rank never holds the full particle data. See
+    ParticleData::initializeFromDistributedSnapshot().
+*/
+template<class Real>
+SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
+                                   std::shared_ptr<SnapshotParticleData<Real>> local_particle_data,
+                                   unsigned int tag_offset,
+                                   unsigned int n_global,
+                                   std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                   std::shared_ptr<DomainDecomposition> decomposition)
+    {
+    setNDimensions(snapshot->dimensions);
+
+    m_particle_data = std::shared_ptr<ParticleData>(
+        new ParticleData(snapshot->particle_data, snapshot->global_box, exec_conf, decomposition));
+    m_particle_data->initializeFromDistributedSnapshot(*local_particle_data, tag_offset, n_global);
+
+#ifdef ENABLE_MPI
+    // in MPI simulations, broadcast dimensionality from rank zero
+    bcast(m_n_dimensions, 0, exec_conf->getMPICommunicator());
+#endif
+
+    constructTopology(snapshot, exec_conf, decomposition);
+    }
+
+/*! \param snapshot Snapshot to use
+    \param exec_conf Execution configuration to run on
+    \param decomposition (optional) The domain decomposition layout
+
+    \pre m_particle_data is initialized.
+*/
+template<class Real>
+void SystemDefinition::constructTopology(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
+                                         std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                         std::shared_ptr<DomainDecomposition> decomposition)
+    {
     m_bond_data = std::shared_ptr<BondData>(new BondData(m_particle_data, snapshot->bond_data));
 
     m_angle_data = std::shared_ptr<AngleData>(new AngleData(m_particle_data, snapshot->angle_data));
@@ -235,10 +281,49 @@ void SystemDefinition::initializeFromSnapshot(std::shared_ptr<SnapshotSystemData
 #endif
     }
 
+/*! \param checkpoint Checkpoint to write
+
+    Copies the local particles and bonded groups. MPCD particles are not stored.
+*/
+void SystemDefinition::takeCheckpoint(SystemDefinitionCheckpoint& checkpoint)
+    {
+    m_particle_data->takeCheckpoint(checkpoint.particle_data);
+    m_bond_data->takeCheckpoint(checkpoint.bond_data);
+    m_angle_data->takeCheckpoint(checkpoint.angle_data);
+    m_dihedral_data->takeCheckpoint(checkpoint.dihedral_data);
+    m_improper_data->takeCheckpoint(checkpoint.improper_data);
+    m_constraint_data->takeCheckpoint(checkpoint.constraint_data);
+    m_pair_data->takeCheckpoint(checkpoint.pair_data);
+    }
+
+/*! \param checkpoint Checkpoint taken on this rank by takeCheckpoint()
+
+    In MPI simulations, all ranks must restore checkpoints taken at the same time with the same
+    domain decomposition.
+*/
+void SystemDefinition::restoreCheckpoint(const SystemDefinitionCheckpoint& checkpoint)
+    {
+    // restore the particles first, the groups are stored on the ranks that own their members
+    m_particle_data->restoreCheckpoint(checkpoint.particle_data);
+    m_bond_data->restoreCheckpoint(checkpoint.bond_data);
+    m_angle_data->restoreCheckpoint(checkpoint.angle_data);
+    m_dihedral_data->restoreCheckpoint(checkpoint.dihedral_data);
+    m_improper_data->restoreCheckpoint(checkpoint.improper_data);
+    m_constraint_data->restoreCheckpoint(checkpoint.constraint_data);
+    m_pair_data->restoreCheckpoint(checkpoint.pair_data);
+    }
+
 // instantiate both float and double methods
 template SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<float>> snapshot,
                                             std::shared_ptr<ExecutionConfiguration> exec_conf,
                                             std::shared_ptr<DomainDecomposition> decomposition);
+template SystemDefinition::SystemDefinition(
+    std::shared_ptr<SnapshotSystemData<float>> snapshot,
+    std::shared_ptr<SnapshotParticleData<float>> local_particle_data,
+    unsigned int tag_offset,
+    unsigned int n_global,
+    std::shared_ptr<ExecutionConfiguration> exec_conf,
+    std::shared_ptr<DomainDecomposition> decomposition);
 template std::shared_ptr<SnapshotSystemData<float>> SystemDefinition::takeSnapshot<float>();
 template void SystemDefinition::initializeFromSnapshot<float>(
     std::shared_ptr<SnapshotSystemData<float>> snapshot);
@@ -246,6 +331,13 @@ template void SystemDefinition::initializeFromSnapshot<float>(
 template SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<double>> snapshot,
                                             std::shared_ptr<ExecutionConfiguration> exec_conf,
                                             std::shared_ptr<DomainDecomposition> decomposition);
+template SystemDefinition::SystemDefinition(
+    std::shared_ptr<SnapshotSystemData<double>> snapshot,
+    std::shared_ptr<SnapshotParticleData<double>> local_particle_data,
+    unsigned int tag_offset,
+    unsigned int n_global,
+    std::shared_ptr<ExecutionConfiguration> exec_conf,
+    std::shared_ptr<DomainDecomposition> decomposition);
 template std::shared_ptr<SnapshotSystemData<double>> SystemDefinition::takeSnapshot<double>();
 template void SystemDefinition::initializeFromSnapshot<double>(
     std::shared_ptr<SnapshotSystemData<double>> snapshot);
@@ -283,6 +375,18 @@ void export_SystemDefinition(pybind11::module& m)
                             std::shared_ptr<DomainDecomposition>>())
         .def(pybind11::init<std::shared_ptr<SnapshotSystemData<double>>,
                             std::shared_ptr<ExecutionConfiguration>>())
+        .def(pybind11::init<std::shared_ptr<SnapshotSystemData<float>>,
+                            std::shared_ptr<SnapshotParticleData<float>>,
+                            unsigned int,
+                            unsigned int,
+                            std::shared_ptr<ExecutionConfiguration>,
+                            std::shared_ptr<DomainDecomposition>>())
+        .def(pybind11::init<std::shared_ptr<SnapshotSystemData<double>>,
+                            std::shared_ptr<SnapshotParticleData<double>>,
+                            unsigned int,
+                            unsigned int,
+                            std::shared_ptr<ExecutionConfiguration>,
+                            std::shared_ptr<DomainDecomposition>>())
         .def("setNDimensions", &SystemDefinition::setNDimensions)
         .def("getNDimensions", &SystemDefinition::getNDimensions)
         .def("getParticleData", &SystemDefinition::getParticleData)
@@ -299,12 +403,27 @@ void export_SystemDefinition(pybind11::module& m)
         .def("takeSnapshot_double", &SystemDefinition::takeSnapshot<double>)
         .def("initializeFromSnapshot", &SystemDefinition::initializeFromSnapshot<float>)
         .def("initializeFromSnapshot", &SystemDefinition::initializeFromSnapshot<double>)
+        .def("takeCheckpoint", &SystemDefinition::takeCheckpoint)
+        .def("restoreCheckpoint", &SystemDefinition::restoreCheckpoint)
         .def("getSeed", &SystemDefinition::getSeed)
         .def("setSeed", &SystemDefinition::setSeed)
+        .def("setProfilingEnabled", &SystemDefinition::setProfilingEnabled)
+        .def("isProfilingEnabled", &SystemDefinition::isProfilingEnabled)
 #ifdef ENABLE_MPI
         .def("setCommunicator", &SystemDefinition::setCommunicator)
 #endif
         ;
+
+    pybind11::class_<SystemDefinitionCheckpoint, std::shared_ptr<SystemDefinitionCheckpoint>>(
+        m,
+        "SystemDefinitionCheckpoint")
+        .def(pybind11::init<>())
+        .def_property_readonly("valid",
+                               [](const SystemDefinitionCheckpoint& checkpoint)
+                               { return checkpoint.particle_data.valid; })
+        .def_property_readonly("N",
+                               [](const SystemDefinitionCheckpoint& checkpoint)
+                               { return checkpoint.particle_data.N; });
     }
 
     } // end namespace detail
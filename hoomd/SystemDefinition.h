@@ -11,6 +11,7 @@
 
 #include "BondedGroupData.h"
 #include "ParticleData.h"
+#include "Profiler.h"
 #ifdef BUILD_MPCD
 #include "hoomd/mpcd/ParticleData.h"
 #endif
@@ -31,6 +32,24 @@ class Communicator;
 //! Forward declaration of SnapshotSystemData
 template<class Real> struct SnapshotSystemData;
 
+//! Copy of the local particles and bonded groups of one rank
+/*! Taking and restoring a checkpoint costs O(N_local) and does not communicate, unlike
+    SystemDefinition::takeSnapshot(), which gathers the system in tag order on the root rank. A
+    checkpoint is only valid on the rank that took it.
+
+    See SystemDefinition::takeCheckpoint() and SystemDefinition::restoreCheckpoint().
+*/
+struct PYBIND11_EXPORT SystemDefinitionCheckpoint
+    {
+    ParticleDataCheckpoint particle_data;       //!< Local particles
+    BondData::Checkpoint bond_data;             //!< Local bonds
+    AngleData::Checkpoint angle_data;           //!< Local angles
+    DihedralData::Checkpoint dihedral_data;     //!< Local dihedrals
+    ImproperData::Checkpoint improper_data;     //!< Local impropers
+    ConstraintData::Checkpoint constraint_data; //!< Local constraints
+    PairData::Checkpoint pair_data;             //!< Local special pairs
+    };
+
 //! Container class for all data needed to define the MD system
 /*! SystemDefinition is a big bucket where all of the data defining the MD system goes.
     Everything is stored as a shared pointer for quick and easy access from within C++
@@ -110,6 +129,15 @@ class PYBIND11_EXPORT SystemDefinition
                      std::shared_ptr<DomainDecomposition> decomposition
                      = std::shared_ptr<DomainDecomposition>());
 
+    //! Construct from a snapshot with the particle data distributed over the ranks
+    template<class Real>
+    SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
+                     std::shared_ptr<SnapshotParticleData<Real>> local_particle_data,
+                     unsigned int tag_offset,
+                     unsigned int n_global,
+                     std::shared_ptr<ExecutionConfiguration> exec_conf,
+                     std::shared_ptr<DomainDecomposition> decomposition);
+
     //! Set the dimensionality of the system
     void setNDimensions(unsigned int);
 
@@ -164,6 +192,24 @@ class PYBIND11_EXPORT SystemDefinition
         return m_seed;
         }
 
+    /// Enable or disable the wall clock profiler
+    void setProfilingEnabled(bool enabled)
+        {
+        m_profiler.setEnabled(enabled, m_particle_data->getExecConf()->isCUDAEnabled());
+        }
+
+    /// Test if the wall clock profiler is enabled
+    bool isProfilingEnabled() const
+        {
+        return m_profiler.isEnabled();
+        }
+
+    /// Get the wall clock profiler
+    const Profiler& getProfiler() const
+        {
+        return m_profiler;
+        }
+
     //! Get the particle data
     std::shared_ptr<ParticleData> getParticleData() const
         {
@@ -223,9 +269,22 @@ class PYBIND11_EXPORT SystemDefinition
     template<class Real>
     void initializeFromSnapshot(std::shared_ptr<SnapshotSystemData<Real>> snapshot);
 
+    //! Copy the local particles and bonded groups into a checkpoint
+    void takeCheckpoint(SystemDefinitionCheckpoint& checkpoint);
+
+    //! Restore the local particles and bonded groups from a checkpoint
+    void restoreCheckpoint(const SystemDefinitionCheckpoint& checkpoint);
+
     private:
+    //! Construct the bonded group data (and MPCD data) from a snapshot
+    template<class Real>
+    void constructTopology(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
+                           std::shared_ptr<ExecutionConfiguration> exec_conf,
+                           std::shared_ptr<DomainDecomposition> decomposition);
+
     unsigned int m_n_dimensions;                       //!< Dimensionality of the system
     uint16_t m_seed = 0;                               //!< Random number seed
+    Profiler m_profiler;                               //!< Wall clock profiler
     std::shared_ptr<ParticleData> m_particle_data;     //!< Particle data for the system
     std::shared_ptr<BondData> m_bond_data;             //!< Bond data for the system
     std::shared_ptr<AngleData> m_angle_data;           //!< Angle data for the system
@@ -0,0 +1,207 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TableWriter.cc
+    \brief Defines the TableWriter class
+*/
+
+#include "TableWriter.h"
+
+#include <pybind11/stl.h>
+
+#include <cstdio>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to write
+    \param filename File to write (overwritten)
+    \param delimiter String to place between columns
+    \param precision Number of significant digits for floating point values
+    \param flush_period Number of rows to buffer before writing them to the file
+*/
+TableWriter::TableWriter(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<Trigger> trigger,
+                         const std::string& filename,
+                         const std::string& delimiter,
+                         unsigned int precision,
+                         unsigned int flush_period)
+    : Analyzer(sysdef, trigger), m_filename(filename), m_delimiter(delimiter),
+      m_precision(precision), m_flush_period(flush_period)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing TableWriter: " << filename << endl;
+
+    if (m_exec_conf->isRoot())
+        {
+        m_file.open(m_filename.c_str(), ios::trunc | ios::out);
+        if (!m_file.good())
+            {
+            throw runtime_error("Error opening table file " + m_filename);
+            }
+        }
+    }
+
+TableWriter::~TableWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying TableWriter" << endl;
+
+    // write the remaining rows without throwing from the destructor
+    if (m_file.is_open() && !m_buffer.empty())
+        {
+        m_file.write(m_buffer.data(), m_buffer.size());
+        }
+    }
+
+/*! \param name Column name written in the header
+    \param getter Callable that takes no arguments and returns a (value, category) tuple, such as
+           an entry of a hoomd.logging.Logger
+
+    Columns must be added before the first row is written.
+*/
+void TableWriter::addColumn(const std::string& name, pybind11::object getter)
+    {
+    if (m_header_written)
+        {
+        throw runtime_error("Cannot add columns to a table after writing rows");
+        }
+
+    m_names.push_back(name);
+    m_getters.push_back(getter);
+    }
+
+PDataFlags TableWriter::getRequestedPDataFlags()
+    {
+    PDataFlags flags;
+    flags[pdata_flag::rotational_kinetic_energy] = 1;
+    flags[pdata_flag::pressure_tensor] = 1;
+    flags[pdata_flag::external_field_virial] = 1;
+    flags[pdata_flag::potential_energy] = 1;
+    return flags;
+    }
+
+/*! \param value Value to format
+ */
+void TableWriter::appendValue(const pybind11::object& value)
+    {
+    if (pybind11::isinstance<pybind11::str>(value))
+        {
+        m_buffer += value.cast<std::string>();
+        return;
+        }
+
+    if (pybind11::isinstance<pybind11::int_>(value))
+        {
+        m_buffer += std::to_string(value.cast<long long>());
+        return;
+        }
+
+    double v;
+    try
+        {
+        v = value.cast<double>();
+        }
+    catch (const pybind11::cast_error&)
+        {
+        m_buffer += "nan";
+        return;
+        }
+
+    char s[64];
+    snprintf(s, sizeof(s), "%.*g", int(m_precision), v);
+    m_buffer += s;
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void TableWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    // the column getters are implemented in Python
+    pybind11::gil_scoped_acquire acquire_gil;
+
+    const bool root = m_exec_conf->isRoot();
+
+    if (!m_header_written)
+        {
+        if (root)
+            {
+            for (size_t i = 0; i < m_names.size(); i++)
+                {
+                if (i > 0)
+                    m_buffer += m_delimiter;
+                m_buffer += m_names[i];
+                }
+            m_buffer += '\n';
+            }
+        m_header_written = true;
+        }
+
+    // evaluate every column on all ranks: some quantities reduce over MPI
+    for (size_t i = 0; i < m_getters.size(); i++)
+        {
+        pybind11::object entry = m_getters[i]();
+        if (!root)
+            continue;
+
+        if (i > 0)
+            m_buffer += m_delimiter;
+
+        // the entry is not a tuple when the logged object no longer exists
+        if (pybind11::isinstance<pybind11::tuple>(entry))
+            appendValue(pybind11::object(entry.cast<pybind11::tuple>()[0]));
+        else
+            appendValue(pybind11::none());
+        }
+
+    if (!root)
+        return;
+
+    m_buffer += '\n';
+    m_n_buffered++;
+
+    if (m_n_buffered >= m_flush_period)
+        flush();
+    }
+
+void TableWriter::flush()
+    {
+    if (!m_file.is_open() || m_buffer.empty())
+        return;
+
+    m_file.write(m_buffer.data(), m_buffer.size());
+    m_file.flush();
+    m_buffer.clear();
+    m_n_buffered = 0;
+
+    if (!m_file.good())
+        {
+        throw runtime_error("Error writing table file " + m_filename);
+        }
+    }
+
+namespace detail
+    {
+void export_TableWriter(pybind11::module& m)
+    {
+    pybind11::class_<TableWriter, Analyzer, std::shared_ptr<TableWriter>>(m, "TableWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::string,
+                            std::string,
+                            unsigned int,
+                            unsigned int>())
+        .def("addColumn", &TableWriter::addColumn)
+        .def("flush", &TableWriter::flush)
+        .def_property_readonly("filename", &TableWriter::getFilename)
+        .def_property_readonly("delimiter", &TableWriter::getDelimiter)
+        .def_property_readonly("precision", &TableWriter::getPrecision)
+        .def_property("flush_period", &TableWriter::getFlushPeriod, &TableWriter::setFlushPeriod)
+        .def_property_readonly("column_names", &TableWriter::getColumnNames);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
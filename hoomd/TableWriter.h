@@ -0,0 +1,130 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __TABLE_WRITER_H__
+#define __TABLE_WRITER_H__
+
+#include "Analyzer.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*! \file TableWriter.h
+    \brief Declares the TableWriter class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Write scalar quantities to a delimited text file
+/*! TableWriter evaluates a fixed list of columns each time analyze() is called and appends one row
+    of delimited values to an in-memory buffer. The buffer is written to the file every
+    flush_period rows, on flush(), and on destruction.
+
+    Each column is a Python callable set up once with addColumn() that returns a (value, category)
+    tuple, such as an entry of a hoomd.logging.Logger. On each row, TableWriter calls the columns
+    directly, so the per-row cost is one call per column with no dictionaries or Python
+    formatting. Strings are written as is, integers in decimal, and other values as floating point
+    numbers with the given precision. Values that cannot be converted to a number are written as
+    nan.
+
+    All ranks evaluate the columns, because some quantities require collective communication.
+    Only the root rank writes the file.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT TableWriter : public Analyzer
+    {
+    public:
+    //! Construct the writer
+    TableWriter(std::shared_ptr<SystemDefinition> sysdef,
+                std::shared_ptr<Trigger> trigger,
+                const std::string& filename,
+                const std::string& delimiter,
+                unsigned int precision,
+                unsigned int flush_period);
+
+    //! Destructor
+    virtual ~TableWriter();
+
+    //! Add a column
+    void addColumn(const std::string& name, pybind11::object getter);
+
+    //! Write a row
+    virtual void analyze(uint64_t timestep);
+
+    //! Write all buffered rows to the file
+    void flush();
+
+    /// Get the file name
+    std::string getFilename()
+        {
+        return m_filename;
+        }
+
+    /// Get the column delimiter
+    std::string getDelimiter()
+        {
+        return m_delimiter;
+        }
+
+    /// Get the number of significant digits for floating point values
+    unsigned int getPrecision()
+        {
+        return m_precision;
+        }
+
+    /// Get the number of rows to buffer before writing them to the file
+    unsigned int getFlushPeriod()
+        {
+        return m_flush_period;
+        }
+
+    /// Set the number of rows to buffer before writing them to the file
+    void setFlushPeriod(unsigned int flush_period)
+        {
+        m_flush_period = flush_period;
+        }
+
+    /// Get the names of the columns
+    std::vector<std::string> getColumnNames()
+        {
+        return m_names;
+        }
+
+    //! Request the optional quantities that loggers commonly read
+    virtual PDataFlags getRequestedPDataFlags();
+
+    private:
+    std::string m_filename;      //!< File to write
+    std::string m_delimiter;     //!< Column delimiter
+    unsigned int m_precision;    //!< Significant digits for floating point values
+    unsigned int m_flush_period; //!< Number of rows to buffer
+
+    std::vector<std::string> m_names;        //!< Column names
+    std::vector<pybind11::object> m_getters; //!< Callables that return the column values
+
+    std::ofstream m_file;          //!< Output file (only open on the root rank)
+    std::string m_buffer;          //!< Rows not yet written to the file
+    unsigned int m_n_buffered = 0; //!< Number of rows in m_buffer
+    bool m_header_written = false; //!< True when the header is in m_buffer or the file
+
+    //! Append a value to the row buffer
+    void appendValue(const pybind11::object& value);
+    };
+
+namespace detail
+    {
+//! Exports the TableWriter class to python
+void export_TableWriter(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+#endif
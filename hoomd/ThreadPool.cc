@@ -0,0 +1,145 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ThreadPool.cc
+    \brief Defines the ThreadPool class
+*/
+
+#include "ThreadPool.h"
+
+#include <stdexcept>
+
+namespace hoomd
+    {
+ThreadPool::ThreadPool(unsigned int n_threads)
+    : m_n_threads(n_threads), m_task(nullptr), m_n_items(0), m_generation(0), m_n_running(0),
+      m_shutdown(false)
+    {
+    if (m_n_threads == 0)
+        {
+        throw std::runtime_error("ThreadPool requires at least one thread.");
+        }
+
+    m_workers.reserve(m_n_threads - 1);
+    for (unsigned int thread_id = 1; thread_id < m_n_threads; thread_id++)
+        {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, thread_id);
+        }
+    }
+
+ThreadPool::~ThreadPool()
+    {
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        }
+    m_start_cv.notify_all();
+
+    for (auto& worker : m_workers)
+        {
+        worker.join();
+        }
+    }
+
+/*! \param n Number of items in the range
+    \param f Function to call on each chunk
+
+    Blocks until every chunk has been processed. When any call to \a f throws, the first exception
+    is rethrown on the calling thread after all chunks complete.
+
+    \a f is called for every thread id, also when its chunk is empty, so that callers may reset
+    their per-thread buffers inside the loop body.
+*/
+void ThreadPool::parallelFor(unsigned int n, const RangeFunction& f)
+    {
+    if (m_n_threads == 1 || n < m_n_threads)
+        {
+        // not worth waking the workers, run the chunks in order on the calling thread
+        for (unsigned int thread_id = 0; thread_id < m_n_threads; thread_id++)
+            {
+            f(thread_id, chunkBegin(n, thread_id), chunkBegin(n, thread_id + 1));
+            }
+        return;
+        }
+
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &f;
+        m_n_items = n;
+        m_n_running = m_n_threads - 1;
+        m_exception = nullptr;
+        m_generation++;
+        }
+    m_start_cv.notify_all();
+
+    // the calling thread processes the first chunk
+    runChunk(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [this] { return m_n_running == 0; });
+    m_task = nullptr;
+
+    if (m_exception)
+        {
+        std::exception_ptr e = m_exception;
+        m_exception = nullptr;
+        std::rethrow_exception(e);
+        }
+    }
+
+void ThreadPool::runChunk(unsigned int thread_id)
+    {
+    unsigned int begin = chunkBegin(m_n_items, thread_id);
+    unsigned int end = chunkBegin(m_n_items, thread_id + 1);
+
+    try
+        {
+        (*m_task)(thread_id, begin, end);
+        }
+    catch (...)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_exception)
+            {
+            m_exception = std::current_exception();
+            }
+        }
+    }
+
+void ThreadPool::workerLoop(unsigned int thread_id)
+    {
+    uint64_t last_generation = 0;
+
+    while (true)
+        {
+            {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start_cv.wait(lock,
+                            [this, last_generation]
+                            { return m_shutdown || m_generation != last_generation; });
+
+            if (m_shutdown)
+                {
+                return;
+                }
+
+            last_generation = m_generation;
+            }
+
+        runChunk(thread_id);
+
+        bool last = false;
+            {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_n_running--;
+            last = (m_n_running == 0);
+            }
+
+        if (last)
+            {
+            m_done_cv.notify_one();
+            }
+        }
+    }
+
+    } // end namespace hoomd
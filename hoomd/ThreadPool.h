@@ -0,0 +1,96 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ThreadPool.h
+    \brief Declares the ThreadPool class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Persistent pool of worker threads for intra-rank CPU parallelism
+/*! ThreadPool executes fork-join parallel loops over a contiguous index range. The range is split
+    into getNumThreads() contiguous chunks: the calling thread processes chunk 0 and each worker
+    thread processes one of the remaining chunks. parallelFor() returns after all chunks complete.
+    The loop body is called for every chunk, including empty ones. Ranges shorter than the number
+    of threads are processed chunk by chunk on the calling thread.
+
+    Chunks are assigned to threads deterministically, so callers that accumulate results in
+    per-thread buffers and reduce them in thread order obtain reproducible results for a given
+    number of threads.
+
+    A pool with one thread spawns no workers and executes the loop body directly on the calling
+    thread.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT ThreadPool
+    {
+    public:
+    /// Loop body: called as f(thread_id, begin, end) for the chunk [begin, end)
+    typedef std::function<void(unsigned int, unsigned int, unsigned int)> RangeFunction;
+
+    //! Construct a thread pool
+    /*! \param n_threads Total number of threads, including the calling thread
+     */
+    explicit ThreadPool(unsigned int n_threads);
+
+    //! Destructor
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Get the number of threads in the pool (including the calling thread)
+    unsigned int getNumThreads() const
+        {
+        return m_n_threads;
+        }
+
+    //! Execute f over the range [0, n) in parallel
+    void parallelFor(unsigned int n, const RangeFunction& f);
+
+    //! Get the first index of the given thread's chunk when splitting [0, n)
+    unsigned int chunkBegin(unsigned int n, unsigned int thread_id) const
+        {
+        return (unsigned int)(uint64_t(n) * thread_id / m_n_threads);
+        }
+
+    private:
+    //! Main loop run by each worker thread
+    void workerLoop(unsigned int thread_id);
+
+    //! Run the chunk of the current task that belongs to thread_id
+    void runChunk(unsigned int thread_id);
+
+    unsigned int m_n_threads;            //!< Number of threads, including the caller
+    std::vector<std::thread> m_workers;  //!< Worker threads (m_n_threads - 1 of them)
+    std::mutex m_mutex;                  //!< Protects the task state
+    std::condition_variable m_start_cv;  //!< Signals workers that a new task is available
+    std::condition_variable m_done_cv;   //!< Signals the caller that all workers finished
+    const RangeFunction* m_task;         //!< Current task
+    unsigned int m_n_items;              //!< Size of the current range
+    uint64_t m_generation;               //!< Incremented for every new task
+    unsigned int m_n_running;            //!< Number of workers still running the current task
+    bool m_shutdown;                     //!< Set to true to stop the workers
+    std::exception_ptr m_exception;      //!< First exception raised by a worker
+    };
+
+    } // end namespace hoomd
+#endif
@@ -25,6 +25,8 @@ class TriggerPy : public Trigger
         }
     };
 
+std::atomic<uint64_t> Trigger::s_generation {0};
+
 namespace detail
     {
 //* Method to enable unit testing of C++ trigger calls from pytest
@@ -38,7 +40,9 @@ void export_Trigger(pybind11::module& m)
     pybind11::class_<Trigger, TriggerPy, std::shared_ptr<Trigger>>(m, "Trigger")
         .def(pybind11::init<>())
         .def("__call__", &Trigger::operator())
-        .def("compute", &Trigger::compute);
+        .def("compute", &Trigger::compute)
+        .def("_next_activation", &Trigger::nextActivation)
+        .def("_next_deactivation", &Trigger::nextDeactivation);
 
     pybind11::class_<PeriodicTrigger, Trigger, std::shared_ptr<PeriodicTrigger>>(m,
                                                                                  "PeriodicTrigger")
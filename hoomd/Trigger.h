@@ -4,7 +4,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <pybind11/iostream.h>
 #include <pybind11/pybind11.h>
@@ -20,12 +22,22 @@ namespace hoomd
  *  (in python) to implement custom behavior.
  *
  *  A Trigger may store internal staten and perform complex calculations to determine when it
+ *
+ *  Subclasses with a closed form may override nextActivation() and nextDeactivation() so that
+ *  System can skip evaluating the trigger on time steps where it cannot be active. The default
+ *  implementations return the queried time step, which requests evaluation on every step.
  */
 class PYBIND11_EXPORT Trigger
     {
     public:
+    /// Returned by nextActivation() and nextDeactivation() when the state never changes.
+    static constexpr uint64_t never = std::numeric_limits<uint64_t>::max();
+
     /// Construct a Trigger
-    Trigger() : m_last_timestep(-1), m_last_trigger(false) { }
+    Trigger() : m_last_timestep(-1), m_last_trigger(false)
+        {
+        notifyChange();
+        }
 
     virtual ~Trigger() { }
 
@@ -50,7 +62,45 @@ class PYBIND11_EXPORT Trigger
 
     virtual bool compute(uint64_t timestep) = 0;
 
+    /** Bound the next time step on which the trigger may be active
+     *
+     *  @param timestep First time step to consider
+     *  @returns A time step `t >= timestep` such that the trigger is not active on any time step
+     *      in `[timestep, t)`, or `never` when the trigger is never active again.
+     */
+    virtual uint64_t nextActivation(uint64_t timestep)
+        {
+        return timestep;
+        }
+
+    /** Bound the next time step on which the trigger may be inactive
+     *
+     *  @param timestep First time step to consider
+     *  @returns A time step `t >= timestep` such that the trigger is active on every time step in
+     *      `[timestep, t)`, or `never` when the trigger is always active from now on.
+     */
+    virtual uint64_t nextDeactivation(uint64_t timestep)
+        {
+        return timestep;
+        }
+
+    /// Get a counter that changes whenever any trigger is created or modified
+    static uint64_t getGeneration()
+        {
+        return s_generation;
+        }
+
+    protected:
+    /// Invalidate activation bounds cached by the caller (call after changing parameters)
+    static void notifyChange()
+        {
+        s_generation++;
+        }
+
     private:
+    /// Counts trigger creations and parameter changes, from any thread
+    static std::atomic<uint64_t> s_generation;
+
     /// Caches the last time step at which the trigger was computed
     uint64_t m_last_timestep;
     /// Caches whether the trigger was activated on m_last_timestep
@@ -83,10 +133,41 @@ class PYBIND11_EXPORT PeriodicTrigger : public Trigger
         return (timestep - m_phase) % m_period == 0;
         }
 
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        uint64_t remainder = (timestep - m_phase) % m_period;
+        if (remainder == 0)
+            {
+            return timestep;
+            }
+
+        uint64_t distance = m_period - remainder;
+        if (timestep < m_phase && m_phase - timestep < distance)
+            {
+            // (timestep - m_phase) wraps around, but m_phase is always active
+            return m_phase;
+            }
+        if (never - timestep < distance)
+            {
+            return never;
+            }
+        return timestep + distance;
+        }
+
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        if (m_period == 1)
+            {
+            return never;
+            }
+        return compute(timestep) ? timestep + 1 : timestep;
+        }
+
     /// Set the period
     void setPeriod(uint64_t period)
         {
         m_period = period;
+        notifyChange();
         }
 
     /// Get the period
@@ -99,6 +180,7 @@ class PYBIND11_EXPORT PeriodicTrigger : public Trigger
     void setPhase(uint64_t phase)
         {
         m_phase = phase;
+        notifyChange();
         }
 
     /// Get the phase
@@ -128,6 +210,16 @@ class PYBIND11_EXPORT BeforeTrigger : public Trigger
         return timestep < m_timestep;
         }
 
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        return timestep < m_timestep ? timestep : never;
+        }
+
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        return std::max(timestep, m_timestep);
+        }
+
     /// Get the timestep before which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -140,6 +232,7 @@ class PYBIND11_EXPORT BeforeTrigger : public Trigger
         setTimestep(uint64_t timestep)
         {
         m_timestep = timestep;
+        notifyChange();
         }
 
     protected:
@@ -160,6 +253,16 @@ class PYBIND11_EXPORT OnTrigger : public Trigger
         return timestep == m_timestep;
         }
 
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        return timestep <= m_timestep ? m_timestep : never;
+        }
+
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        return timestep == m_timestep ? timestep + 1 : timestep;
+        }
+
     /// Get the timestep when the trigger is active.
     uint64_t getTimestep() const
         {
@@ -172,6 +275,7 @@ class PYBIND11_EXPORT OnTrigger : public Trigger
         setTimestep(uint64_t timestep)
         {
         m_timestep = timestep;
+        notifyChange();
         }
 
     protected:
@@ -192,6 +296,20 @@ class PYBIND11_EXPORT AfterTrigger : public Trigger
         return timestep > m_timestep;
         }
 
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        if (timestep > m_timestep)
+            {
+            return timestep;
+            }
+        return m_timestep == never ? never : m_timestep + 1;
+        }
+
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        return timestep > m_timestep ? never : timestep;
+        }
+
     /// Get the timestep after which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -204,6 +322,7 @@ class PYBIND11_EXPORT AfterTrigger : public Trigger
         setTimestep(uint64_t timestep)
         {
         m_timestep = timestep;
+        notifyChange();
         }
 
     protected:
@@ -224,6 +343,16 @@ class PYBIND11_EXPORT NotTrigger : public Trigger
         return !(m_trigger->operator()(timestep));
         }
 
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        return m_trigger->nextDeactivation(timestep);
+        }
+
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        return m_trigger->nextActivation(timestep);
+        }
+
     /// Get the trigger that is negated
     std::shared_ptr<Trigger> getTrigger() const
         {
@@ -234,6 +363,7 @@ class PYBIND11_EXPORT NotTrigger : public Trigger
     void setTrigger(std::shared_ptr<Trigger> trigger)
         {
         m_trigger = trigger;
+        notifyChange();
         }
 
     protected:
@@ -266,6 +396,28 @@ class PYBIND11_EXPORT AndTrigger : public Trigger
                            { return t->operator()(timestep); });
         }
 
+    /// All triggers must be active, so no activation can occur before the latest bound.
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        uint64_t result = timestep;
+        for (auto& t : m_triggers)
+            {
+            result = std::max(result, t->nextActivation(timestep));
+            }
+        return result;
+        }
+
+    /// Any inactive trigger deactivates the AND.
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        uint64_t result = never;
+        for (auto& t : m_triggers)
+            {
+            result = std::min(result, t->nextDeactivation(timestep));
+            }
+        return result;
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
@@ -302,6 +454,28 @@ class PYBIND11_EXPORT OrTrigger : public Trigger
                            { return t->operator()(timestep); });
         }
 
+    /// Any active trigger activates the OR.
+    uint64_t nextActivation(uint64_t timestep)
+        {
+        uint64_t result = never;
+        for (auto& t : m_triggers)
+            {
+            result = std::min(result, t->nextActivation(timestep));
+            }
+        return result;
+        }
+
+    /// All triggers must be inactive, so no deactivation can occur before the latest bound.
+    uint64_t nextDeactivation(uint64_t timestep)
+        {
+        uint64_t result = timestep;
+        for (auto& t : m_triggers)
+            {
+            result = std::max(result, t->nextDeactivation(timestep));
+            }
+        return result;
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
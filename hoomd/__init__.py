@@ -89,6 +89,7 @@ from hoomd import _hoomd
 from hoomd import tune
 from hoomd import logging
 from hoomd import custom
+from hoomd import benchmark
 
 if version.md_built:
     from hoomd import md
@@ -130,6 +131,7 @@ __all__ = [
     "Simulation",
     "Snapshot",
     "State",
+    "benchmark",
     "box",
     "communicator",
     "custom",
@@ -0,0 +1,53 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Standard end-to-end benchmarks.
+
+Use the benchmarks in `hoomd.benchmark` to qualify new hardware and HOOMD-blue
+releases with reproducible whole-simulation workloads:
+
+* `LJLiquid` - Lennard-Jones liquid.
+* `KremerGrestMelt` - Bead-spring polymer melt with FENE bonds.
+* `PPPMElectrolyte` - Charged particles with PPPM electrostatics.
+* `RigidDumbbells` - Rigid bodies.
+* `HardSpheres` and `HardCubes` - Hard particle Monte Carlo.
+* `MPCDSolvent` - Multiparticle collision dynamics solvent.
+
+`run` measures the time steps per second of one workload at one size, the HPMC
+sweeps per second, the time spent in each operation, and the memory use, and
+records the build and hardware. Run all workloads at their default sizes and
+write one JSON object per line with::
+
+    python3 -m hoomd.benchmark --output=results.json
+
+Execute ``python3 -m hoomd.benchmark --help`` for the full list of options.
+Run under ``mpirun`` to measure domain decomposed simulations.
+
+Note:
+    The C++ micro-benchmarks of individual kernels are built with
+    ``-DBUILD_BENCHMARKS=on`` and the ``benchmark_all`` target.
+"""
+
+from hoomd.benchmark.workload import (
+    Workload,
+    LJLiquid,
+    KremerGrestMelt,
+    PPPMElectrolyte,
+    RigidDumbbells,
+    HardSpheres,
+    HardCubes,
+    MPCDSolvent,
+)
+from hoomd.benchmark.runner import run
+
+__all__ = [
+    "HardCubes",
+    "HardSpheres",
+    "KremerGrestMelt",
+    "LJLiquid",
+    "MPCDSolvent",
+    "PPPMElectrolyte",
+    "RigidDumbbells",
+    "Workload",
+    "run",
+]
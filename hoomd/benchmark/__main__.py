@@ -0,0 +1,97 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Run the standard benchmarks from the command line."""
+
+import argparse
+import json
+
+import hoomd
+from hoomd import benchmark
+
+
+def _available_workloads():
+    """Map the names of the workloads in this build to their classes."""
+    classes = []
+    if hoomd.version.md_built:
+        classes += [
+            benchmark.LJLiquid,
+            benchmark.KremerGrestMelt,
+            benchmark.PPPMElectrolyte,
+            benchmark.RigidDumbbells,
+        ]
+    if hoomd.version.hpmc_built:
+        classes += [benchmark.HardSpheres, benchmark.HardCubes]
+    if hoomd.version.mpcd_built:
+        classes += [benchmark.MPCDSolvent]
+    return {cls.name: cls for cls in classes}
+
+
+def _int_list(text):
+    return [int(value) for value in text.split(",")]
+
+
+def main(args=None):
+    """Run the selected workloads and write one JSON object per result."""
+    workloads = _available_workloads()
+
+    parser = argparse.ArgumentParser(
+        prog="python3 -m hoomd.benchmark", description=__doc__
+    )
+    parser.add_argument(
+        "--workloads",
+        type=lambda text: text.split(","),
+        default=list(workloads),
+        help="Comma separated workloads to run (default: all). "
+        f"Choices: {', '.join(workloads)}.",
+    )
+    parser.add_argument(
+        "--N",
+        type=_int_list,
+        default=None,
+        help="Comma separated sizes (default: the sizes of each workload).",
+    )
+    parser.add_argument("--device", choices=["CPU", "GPU"], default="CPU")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--warmup-steps", type=int, default=1000)
+    parser.add_argument("--max-tuning-steps", type=int, default=20000)
+    parser.add_argument("--benchmark-steps", type=int, default=1000)
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--profile-steps", type=int, default=200)
+    parser.add_argument(
+        "--output", default=None, help="Append the results to this file."
+    )
+    options = parser.parse_args(args)
+
+    unknown = set(options.workloads) - set(workloads)
+    if unknown:
+        parser.error(f"unknown workloads: {', '.join(sorted(unknown))}")
+
+    device = hoomd.device.GPU() if options.device == "GPU" else hoomd.device.CPU()
+
+    for name in options.workloads:
+        workload = workloads[name]()
+        for N in options.N if options.N is not None else workload.sizes:
+            result = benchmark.run(
+                workload,
+                device,
+                N,
+                seed=options.seed,
+                warmup_steps=options.warmup_steps,
+                max_tuning_steps=options.max_tuning_steps,
+                benchmark_steps=options.benchmark_steps,
+                repeat=options.repeat,
+                profile_steps=options.profile_steps,
+            )
+
+            if device.communicator.rank == 0:
+                line = json.dumps(result)
+                if options.output is None:
+                    print(line, flush=True)
+                else:
+                    with open(options.output, "a") as f:
+                        f.write(line + "\n")
+
+
+if __name__ == "__main__":
+    main()
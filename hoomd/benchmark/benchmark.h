@@ -0,0 +1,353 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file benchmark.h
+    \brief Helps micro-benchmarks time kernels and report the results
+    \details Each benchmark executable constructs a Runner from the command line, creates test
+        systems with makeSystem(), and calls Runner::run() once per case. Runner prints one JSON
+        object per case and line so that results from different builds and machines can be
+        collected and compared with standard tools.
+
+    Command line options (all optional):
+    - `--N=1000,8000` Numbers of particles.
+    - `--density=0.5,0.9` Number densities.
+    - `--min-time=0.5` Minimum time to spend timing each case (seconds).
+    - `--min-repeat=5` Minimum number of timed calls of each case.
+    - `--filter=text` Run only the cases whose name contains text.
+    - `--gpu` Run on the GPU.
+    - `--output=file` Append the results to file instead of writing them to stdout.
+
+    \note This file should be included only once and by a file that will compile into a
+        benchmark executable.
+*/
+
+#pragma once
+
+#include "HOOMDVersion.h"
+#include "hoomd/Autotuned.h"
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/HOOMDMPI.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/Communicator.h"
+#include "hoomd/DomainDecomposition.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+namespace benchmark
+    {
+//! Options shared by all benchmarks
+struct Options
+    {
+    std::vector<unsigned int> N = {1000, 8000, 64000}; //!< Numbers of particles
+    std::vector<double> density = {0.5, 0.9};          //!< Number densities
+    double min_time = 0.5;                             //!< Minimum time per case (seconds)
+    unsigned int min_repeat = 5;                       //!< Minimum number of calls per case
+    std::string filter;                                //!< Run cases that contain this text
+    bool gpu = false;                                  //!< Run on the GPU
+    std::string output;                                //!< Output file (empty for stdout)
+    };
+
+//! Split a comma separated list of values
+template<class T> std::vector<T> parseList(const std::string& text)
+    {
+    std::vector<T> result;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        {
+        std::stringstream item_stream(item);
+        T value;
+        if (!(item_stream >> value))
+            throw std::invalid_argument("Invalid value: " + item);
+        result.push_back(value);
+        }
+    return result;
+    }
+
+//! Parse the command line
+inline Options parseOptions(int argc, char** argv)
+    {
+    Options options;
+    for (int i = 1; i < argc; i++)
+        {
+        const std::string arg(argv[i]);
+        const size_t equals = arg.find('=');
+        const std::string key = arg.substr(0, equals);
+        const std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+
+        if (key == "--N")
+            options.N = parseList<unsigned int>(value);
+        else if (key == "--density")
+            options.density = parseList<double>(value);
+        else if (key == "--min-time")
+            options.min_time = std::stod(value);
+        else if (key == "--min-repeat")
+            options.min_repeat = (unsigned int)std::stoul(value);
+        else if (key == "--filter")
+            options.filter = value;
+        else if (key == "--gpu")
+            options.gpu = true;
+        else if (key == "--output")
+            options.output = value;
+        else
+            throw std::invalid_argument("Unknown option: " + arg);
+        }
+    return options;
+    }
+
+//! Create a cubic system of N particles at the given number density
+/*! Particles are placed on a simple cubic lattice with a random displacement of up to a tenth of
+    the lattice spacing, so that pair distances are realistic for dense liquids. Type ids cycle
+    through \a n_types types. On more than one rank, the particles are distributed with a
+    default domain decomposition and a Communicator is attached to the system.
+*/
+inline std::shared_ptr<SystemDefinition>
+makeSystem(unsigned int N,
+           double density,
+           std::shared_ptr<ExecutionConfiguration> exec_conf,
+           unsigned int n_types = 1,
+           unsigned int seed = 0)
+    {
+    const Scalar L = Scalar(std::cbrt(N / density));
+    const unsigned int n = (unsigned int)std::ceil(std::cbrt((double)N));
+    const Scalar a = L / Scalar(n);
+
+    auto snapshot = std::make_shared<SnapshotSystemData<Scalar>>();
+    snapshot->global_box = std::make_shared<BoxDim>(L);
+    auto& particles = snapshot->particle_data;
+    particles.resize(N);
+    for (unsigned int i = 0; i < n_types; i++)
+        particles.type_mapping.push_back(std::string(1, char('A' + i)));
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<Scalar> jitter(-Scalar(0.1) * a, Scalar(0.1) * a);
+    for (unsigned int tag = 0; tag < N; tag++)
+        {
+        const unsigned int i = tag % n;
+        const unsigned int j = (tag / n) % n;
+        const unsigned int k = tag / (n * n);
+        particles.pos[tag] = vec3<Scalar>(-L / Scalar(2.0) + (Scalar(i) + Scalar(0.5)) * a
+                                              + jitter(rng),
+                                          -L / Scalar(2.0) + (Scalar(j) + Scalar(0.5)) * a
+                                              + jitter(rng),
+                                          -L / Scalar(2.0) + (Scalar(k) + Scalar(0.5)) * a
+                                              + jitter(rng));
+        particles.type[tag] = tag % n_types;
+        }
+
+    std::shared_ptr<DomainDecomposition> decomposition;
+#ifdef ENABLE_MPI
+    if (exec_conf->getNRanks() > 1)
+        decomposition = std::make_shared<DomainDecomposition>(exec_conf, make_scalar3(L, L, L));
+#endif
+
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf, decomposition);
+
+#ifdef ENABLE_MPI
+    if (decomposition)
+        {
+        auto comm = std::make_shared<Communicator>(sysdef, decomposition);
+        sysdef->setCommunicator(comm);
+        }
+#endif
+
+    return sysdef;
+    }
+
+//! Time the cases of one benchmark and report the results
+class Runner
+    {
+    public:
+    //! Parse the command line and initialize the execution configuration
+    Runner(const std::string& benchmark, int argc, char** argv) : m_benchmark(benchmark)
+        {
+#ifdef ENABLE_MPI
+        MPI_Init(&argc, &argv);
+#endif
+        m_options = parseOptions(argc, argv);
+        m_exec_conf = std::make_shared<ExecutionConfiguration>(
+            m_options.gpu ? ExecutionConfiguration::GPU : ExecutionConfiguration::CPU);
+        }
+
+    //! Release the execution configuration
+    ~Runner()
+        {
+        m_exec_conf.reset();
+#ifdef ENABLE_MPI
+        MPI_Finalize();
+#endif
+        }
+
+    //! Get the command line options
+    const Options& getOptions() const
+        {
+        return m_options;
+        }
+
+    //! Get the execution configuration
+    std::shared_ptr<ExecutionConfiguration> getExecConf() const
+        {
+        return m_exec_conf;
+        }
+
+    //! Test whether a case is selected by the filter
+    bool selected(const std::string& name) const
+        {
+        return name.find(m_options.filter) != std::string::npos;
+        }
+
+    //! Time a case
+    /*! \param name Name of the case
+        \param N Number of particles
+        \param density Number density
+        \param f Function that performs one call of the timed kernel
+        \param tuned Objects whose autotuners must complete before the timing starts
+
+        run() calls \a f until the autotuners are complete, then times at least
+        Options::min_repeat calls of \a f that take at least Options::min_time seconds in total.
+        On MPI runs, the time of each call is the maximum over all ranks.
+    */
+    template<class Function>
+    void run(const std::string& name,
+             unsigned int N,
+             double density,
+             Function f,
+             const std::vector<std::shared_ptr<Autotuned>>& tuned = {})
+        {
+        if (!selected(name))
+            return;
+
+        f();
+        for (auto& t : tuned)
+            t->startAutotuning();
+        for (unsigned int i = 0; i < max_warmup_calls && !autotuningComplete(tuned); i++)
+            f();
+
+        std::vector<double> samples;
+        double total = 0;
+        while (samples.size() < m_options.min_repeat || total < m_options.min_time)
+            {
+            barrier();
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            synchronize();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            const double sample = maxOverRanks(elapsed.count());
+            samples.push_back(sample);
+            total += sample;
+            }
+
+        report(name, N, density, samples);
+        }
+
+    private:
+    std::string m_benchmark;                             //!< Name of the benchmark
+    Options m_options;                                   //!< Command line options
+    std::shared_ptr<ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+
+    //! Upper limit on the number of calls made to complete autotuning
+    static const unsigned int max_warmup_calls = 10000;
+
+    //! Test whether all autotuners are complete
+    static bool autotuningComplete(const std::vector<std::shared_ptr<Autotuned>>& tuned)
+        {
+        return std::all_of(tuned.begin(),
+                           tuned.end(),
+                           [](const std::shared_ptr<Autotuned>& t)
+                           { return t->isAutotuningComplete(); });
+        }
+
+    //! Wait for all ranks
+    void barrier()
+        {
+#ifdef ENABLE_MPI
+        MPI_Barrier(m_exec_conf->getMPICommunicator());
+#endif
+        }
+
+    //! Wait for the kernels launched by the timed call
+    void synchronize()
+        {
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled())
+            hipDeviceSynchronize();
+#endif
+        }
+
+    //! Reduce a time over the ranks
+    double maxOverRanks(double value)
+        {
+#ifdef ENABLE_MPI
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &value,
+                      1,
+                      MPI_DOUBLE,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+#endif
+        return value;
+        }
+
+    //! Write one result line on the root rank
+    void report(const std::string& name,
+                unsigned int N,
+                double density,
+                const std::vector<double>& samples)
+        {
+        if (!m_exec_conf->isRoot())
+            return;
+
+        double mean = 0;
+        for (double s : samples)
+            mean += s;
+        mean /= double(samples.size());
+
+        double variance = 0;
+        for (double s : samples)
+            variance += (s - mean) * (s - mean);
+        variance /= double(samples.size());
+
+        std::ostringstream line;
+        line << std::setprecision(9);
+        line << "{\"benchmark\": \"" << m_benchmark << "\", \"case\": \"" << name << "\""
+             << ", \"N\": " << N << ", \"density\": " << density << ", \"device\": \""
+             << (m_exec_conf->isCUDAEnabled() ? "GPU" : "CPU") << "\""
+             << ", \"ranks\": " << m_exec_conf->getNRanks() << ", \"precision\": \""
+             << (sizeof(Scalar) == sizeof(double) ? "double" : "single") << "\""
+             << ", \"version\": \"" << HOOMD_VERSION << "\""
+             << ", \"samples\": " << samples.size() << ", \"mean\": " << mean
+             << ", \"min\": " << *std::min_element(samples.begin(), samples.end())
+             << ", \"stddev\": " << std::sqrt(variance) << "}";
+
+        if (m_options.output.empty())
+            {
+            std::cout << line.str() << std::endl;
+            }
+        else
+            {
+            std::ofstream file(m_options.output, std::ios::app);
+            file << line.str() << std::endl;
+            }
+        }
+    };
+
+    } // end namespace benchmark
+    } // end namespace hoomd
@@ -0,0 +1,83 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/CellList.h"
+#include "hoomd/CellListStencil.h"
+#ifdef ENABLE_HIP
+#include "hoomd/CellListGPU.h"
+#endif
+
+#include "hoomd/benchmark/benchmark.h"
+
+/*! \file benchmark_cell_list.cc
+    \brief Times the cell list and cell list stencil builds
+*/
+
+using namespace hoomd;
+using namespace hoomd::benchmark;
+
+//! Time the cell list build with a nominal width of one
+template<class CL> void benchmark_cell_list(Runner& runner, const std::string& name)
+    {
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto cl = std::make_shared<CL>(sysdef);
+            cl->setNominalWidth(Scalar(1.0));
+            cl->setRadius(1);
+
+            uint64_t timestep = 0;
+            runner.run(
+                name,
+                N,
+                density,
+                [&]() { cl->compute(timestep++); },
+                {cl});
+            }
+    }
+
+//! Time the stencil construction for a cell list with a nominal width of one
+void benchmark_cell_list_stencil(Runner& runner)
+    {
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto cl = std::make_shared<CellList>(sysdef);
+            cl->setNominalWidth(Scalar(1.0));
+            cl->setRadius(1);
+            cl->compute(0);
+
+            auto stencil = std::make_shared<CellListStencil>(sysdef, cl);
+            std::vector<Scalar> rstencil(sysdef->getParticleData()->getNTypes(), Scalar(1.0));
+            stencil->setRStencil(rstencil);
+
+            uint64_t timestep = 0;
+            runner.run("cell_list_stencil",
+                       N,
+                       density,
+                       [&]()
+                       {
+                           stencil->requestCompute();
+                           stencil->compute(timestep++);
+                       });
+            }
+    }
+
+int main(int argc, char** argv)
+    {
+    Runner runner("cell_list", argc, argv);
+    if (runner.getExecConf()->getNRanks() > 1)
+        throw std::runtime_error("benchmark_cell_list runs on one rank");
+
+#ifdef ENABLE_HIP
+    if (runner.getExecConf()->isCUDAEnabled())
+        benchmark_cell_list<CellListGPU>(runner, "cell_list_gpu");
+    else
+#endif
+        benchmark_cell_list<CellList>(runner, "cell_list");
+
+    benchmark_cell_list_stencil(runner);
+    return 0;
+    }
@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/Communicator.h"
+#ifdef ENABLE_HIP
+#include "hoomd/CommunicatorGPU.h"
+#endif
+
+#include "hoomd/benchmark/benchmark.h"
+
+/*! \file benchmark_communicator.cc
+    \brief Times particle migration and ghost communication
+    \details Run this benchmark on more than one rank, e.g. `mpirun -n 8 benchmark_communicator`.
+*/
+
+using namespace hoomd;
+using namespace hoomd::benchmark;
+
+//! Ghost layer width typical of a Lennard-Jones pair potential with a neighbor list buffer
+const Scalar ghost_width = Scalar(2.5 + 0.4);
+
+//! Report the same ghost layer width for all types
+struct ghost_layer_width
+    {
+    Scalar get(unsigned int type)
+        {
+        return ghost_width;
+        }
+    };
+
+//! Time the communication steps of a timestep
+/*! The migration case displaces all particles by a small amount before each call, so the
+    particles near the domain boundaries are packed, sent, and unpacked as they would be during
+    a simulation.
+*/
+void benchmark_communicator(Runner& runner)
+    {
+    const std::string suffix = runner.getExecConf()->isCUDAEnabled() ? "_gpu" : "";
+
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto decomposition = sysdef->getParticleData()->getDomainDecomposition();
+
+            std::shared_ptr<Communicator> comm;
+#ifdef ENABLE_HIP
+            if (runner.getExecConf()->isCUDAEnabled())
+                comm = std::make_shared<CommunicatorGPU>(sysdef, decomposition);
+            else
+#endif
+                comm = std::make_shared<Communicator>(sysdef, decomposition);
+            sysdef->setCommunicator(comm);
+
+            ghost_layer_width g;
+            comm->getGhostLayerWidthRequestSignal()
+                .connect<ghost_layer_width, &ghost_layer_width::get>(g);
+
+            auto pdata = sysdef->getParticleData();
+            const BoxDim box = pdata->getGlobalBox();
+            const Scalar3 shift = box.getL() * Scalar(0.001);
+
+            auto displace = [&]()
+                {
+                ArrayHandle<Scalar4> h_pos(pdata->getPositions(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+                ArrayHandle<int3> h_image(pdata->getImages(),
+                                          access_location::host,
+                                          access_mode::readwrite);
+                for (unsigned int i = 0; i < pdata->getN(); i++)
+                    {
+                    h_pos.data[i].x += shift.x;
+                    h_pos.data[i].y += shift.y;
+                    h_pos.data[i].z += shift.z;
+                    box.wrap(h_pos.data[i], h_image.data[i]);
+                    }
+                };
+
+            comm->migrateParticles();
+            comm->exchangeGhosts();
+
+            runner.run("migrate_particles" + suffix,
+                       N,
+                       density,
+                       [&]()
+                       {
+                           displace();
+                           comm->migrateParticles();
+                       });
+
+            comm->migrateParticles();
+            runner.run("exchange_ghosts" + suffix,
+                       N,
+                       density,
+                       [&]() { comm->exchangeGhosts(); });
+
+            uint64_t timestep = 0;
+            runner.run("update_ghosts" + suffix,
+                       N,
+                       density,
+                       [&]()
+                       {
+                           comm->beginUpdateGhosts(timestep);
+                           comm->finishUpdateGhosts(timestep);
+                           timestep++;
+                       });
+            }
+    }
+
+int main(int argc, char** argv)
+    {
+    Runner runner("communicator", argc, argv);
+    if (runner.getExecConf()->getNRanks() < 2)
+        throw std::runtime_error("benchmark_communicator requires more than one rank");
+
+    benchmark_communicator(runner);
+    return 0;
+    }
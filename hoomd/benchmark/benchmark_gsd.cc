@@ -0,0 +1,69 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/GSDDumpWriter.h"
+#include "hoomd/Trigger.h"
+#include "hoomd/filter/ParticleFilterAll.h"
+
+#include "hoomd/benchmark/benchmark.h"
+
+#include <pybind11/embed.h>
+
+#include <filesystem>
+
+/*! \file benchmark_gsd.cc
+    \brief Times GSD frame writes
+*/
+
+using namespace hoomd;
+using namespace hoomd::benchmark;
+
+//! Time writing one frame per call to a file in the temporary directory
+/*! The synchronous case flushes every frame so that the time includes the file system. The
+    asynchronous case measures the time that the simulation waits for GSDDumpWriter::analyze().
+*/
+void benchmark_gsd(Runner& runner, const std::string& name, bool asynchronous)
+    {
+    const std::filesystem::path fname
+        = std::filesystem::temp_directory_path() / ("hoomd-benchmark-" + name + ".gsd");
+
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto group
+                = std::make_shared<ParticleGroup>(sysdef, std::make_shared<ParticleFilterAll>());
+            auto writer = std::make_shared<GSDDumpWriter>(sysdef,
+                                                          std::make_shared<PeriodicTrigger>(1),
+                                                          fname.string(),
+                                                          group,
+                                                          "wb");
+            writer->setAsynchronous(asynchronous);
+
+            uint64_t timestep = 0;
+            runner.run(name,
+                       N,
+                       density,
+                       [&]()
+                       {
+                           writer->analyze(timestep++);
+                           if (!asynchronous)
+                               writer->flush();
+                       });
+
+            writer.reset();
+            if (runner.getExecConf()->isRoot())
+                std::filesystem::remove(fname);
+            }
+    }
+
+int main(int argc, char** argv)
+    {
+    // GSDDumpWriter collects logged quantities with Python objects
+    pybind11::scoped_interpreter guard;
+
+    Runner runner("gsd", argc, argv);
+    benchmark_gsd(runner, "gsd_write", false);
+    benchmark_gsd(runner, "gsd_write_async", true);
+    return 0;
+    }
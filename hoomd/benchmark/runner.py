@@ -0,0 +1,206 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement run."""
+
+import os
+import platform
+import statistics
+
+import hoomd
+
+
+def _operations(simulation):
+    """List the operations of a simulation and the forces they own."""
+    operations = []
+    for operation in simulation.operations:
+        operations.append(operation)
+        for attribute in ("forces", "constraints", "methods"):
+            operations.extend(getattr(operation, attribute, []))
+        for attribute in (
+            "rigid",
+            "streaming_method",
+            "collision_method",
+            "mpcd_particle_sorter",
+        ):
+            child = getattr(operation, attribute, None)
+            if child is not None:
+                operations.append(child)
+
+    # forces share neighbor lists
+    for force in list(operations):
+        nlist = getattr(force, "nlist", None)
+        if nlist is not None and not any(nlist is op for op in operations):
+            operations.append(nlist)
+    return operations
+
+
+def _complete_autotuning(simulation, max_steps):
+    """Run until all kernel autotuners are complete."""
+    operations = [
+        op
+        for op in _operations(simulation)
+        if hasattr(getattr(op, "_cpp_obj", None), "isAutotuningComplete")
+    ]
+    steps = 0
+    while steps < max_steps and not all(op.is_tuning_complete for op in operations):
+        simulation.run(min(100, max_steps - steps))
+        steps += 100
+
+
+def _breakdown(simulation):
+    """Collect the measured wall clock time of each kind of operation."""
+    breakdown = {}
+    for operation in _operations(simulation):
+        cpp_obj = getattr(operation, "_cpp_obj", None)
+        if cpp_obj is None or not hasattr(cpp_obj, "getProfileTimer"):
+            continue
+
+        timer = cpp_obj.getProfileTimer()
+        entry = breakdown.setdefault(
+            type(operation).__name__, dict(walltime=0.0, num_calls=0)
+        )
+        entry["walltime"] += timer.total_time
+        entry["num_calls"] += timer.num_calls
+
+    total = simulation.walltime
+    for entry in breakdown.values():
+        entry["fraction"] = entry["walltime"] / total if total > 0 else 0.0
+    return breakdown
+
+
+def _metadata(device):
+    """Describe the build and the hardware."""
+    return dict(
+        hoomd_version=hoomd.version.version,
+        git_sha1=hoomd.version.git_sha1,
+        compile_flags=hoomd.version.compile_flags,
+        cxx_compiler=hoomd.version.cxx_compiler,
+        floating_point_precision=list(hoomd.version.floating_point_precision),
+        gpu_platform=hoomd.version.gpu_platform,
+        gpu_api_version=hoomd.version.gpu_api_version,
+        device=type(device).__name__,
+        device_description=device.device,
+        num_ranks=device.communicator.num_ranks,
+        hostname=platform.node(),
+        machine=platform.machine(),
+        processor=platform.processor(),
+        system=platform.platform(),
+        cpu_count=os.cpu_count(),
+        python_version=platform.python_version(),
+    )
+
+
+def run(
+    workload,
+    device,
+    N,
+    seed=1,
+    warmup_steps=1000,
+    max_tuning_steps=20000,
+    benchmark_steps=1000,
+    repeat=3,
+    profile_steps=200,
+):
+    """Measure the performance of a workload.
+
+    Args:
+        workload (hoomd.benchmark.Workload): Workload to measure.
+        device (hoomd.device.Device): Device to run on.
+        N (int): Size of the workload.
+        seed (int): Random number seed.
+        warmup_steps (int): Steps to run with `Workload.equilibrate` before
+            measuring.
+        max_tuning_steps (int): Maximum number of additional steps to run
+            while the kernel autotuners are incomplete.
+        benchmark_steps (int): Steps in each timed run.
+        repeat (int): Number of timed runs.
+        profile_steps (int): Steps to run with `hoomd.Simulation.profiling`
+            enabled after the timed runs. Set to 0 to skip the per-operation
+            breakdown.
+
+    `run` creates the simulation, runs the warm up steps, completes kernel
+    autotuning, and then times *repeat* calls to `hoomd.Simulation.run` of
+    *benchmark_steps* each with profiling disabled. Profiling synchronizes the
+    GPU, so `run` measures the per-operation breakdown in separate steps.
+
+    Returns:
+        dict: The results, which can be serialized to JSON:
+
+        * ``workload`` (`str`): Name of the workload.
+        * ``N`` (`int`): Size of the workload.
+        * ``num_particles`` (`int`): Number of particles in the state.
+        * ``benchmark_steps`` (`int`): Steps in each timed run.
+        * ``tps`` (`float`): Mean time steps per second over the timed runs.
+        * ``tps_samples`` (`list` [`float`]): Time steps per second of each
+          timed run.
+        * ``tps_stddev`` (`float`): Standard deviation of ``tps_samples``.
+        * ``sweeps_per_second`` (`float`): Trial moves per particle per second
+          (HPMC workloads only, otherwise `None`).
+        * ``breakdown`` (`dict`): Maps the class name of each kind of
+          operation to its ``walltime`` (s), ``num_calls``, and ``fraction`` of
+          the profiled wall time. Times are inclusive: the integrator time
+          includes the time its forces take to compute.
+        * ``communication_walltime`` (`list` [`float`]): Time spent migrating
+          particles, exchanging ghost particles, and updating ghost particles
+          in the profiled steps (s).
+        * ``memory`` (`dict`): `hoomd.Simulation.memory_usage` as host and
+          device bytes on the root rank.
+        * ``metadata`` (`dict`): The HOOMD-blue build and the hardware.
+
+    .. rubric:: Example:
+
+    .. skip: next
+
+    .. code-block:: python
+
+        result = hoomd.benchmark.run(
+            hoomd.benchmark.LJLiquid(), hoomd.device.CPU(), N=8000
+        )
+        tps = result["tps"]
+    """
+    simulation = workload.make_simulation(device, N, seed)
+    workload.equilibrate(simulation, warmup_steps)
+    _complete_autotuning(simulation, max_tuning_steps)
+
+    tps_samples = []
+    for _ in range(repeat):
+        simulation.run(benchmark_steps)
+        tps_samples.append(simulation.tps)
+    tps = statistics.fmean(tps_samples)
+
+    sweeps_per_second = None
+    integrator = simulation.operations.integrator
+    if hoomd.version.hpmc_built and isinstance(
+        integrator, hoomd.hpmc.integrate.HPMCIntegrator
+    ):
+        sweeps_per_second = tps * integrator.nselect
+
+    breakdown = {}
+    communication_walltime = [0.0, 0.0, 0.0]
+    if profile_steps > 0:
+        simulation.profiling = True
+        simulation.run(profile_steps)
+        breakdown = _breakdown(simulation)
+        communication_walltime = list(simulation.communication_walltime)
+        simulation.profiling = False
+
+    memory = {
+        name: dict(host=host, device=device_bytes)
+        for name, (host, device_bytes) in simulation.memory_usage.items()
+    }
+
+    return dict(
+        workload=workload.name,
+        N=N,
+        num_particles=simulation.state.N_particles,
+        benchmark_steps=benchmark_steps,
+        tps=tps,
+        tps_samples=tps_samples,
+        tps_stddev=statistics.pstdev(tps_samples),
+        sweeps_per_second=sweeps_per_second,
+        breakdown=breakdown,
+        communication_walltime=communication_walltime,
+        memory=memory,
+        metadata=_metadata(device),
+    )
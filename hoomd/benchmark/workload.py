@@ -0,0 +1,369 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement the standard benchmark workloads."""
+
+import math
+
+import numpy
+
+import hoomd
+
+
+def _lattice(N, spacing, row_multiple=1):
+    """Place N sites on a rectangular lattice.
+
+    Sites fill rows along x first. Each row holds a multiple of
+    *row_multiple* sites, so groups of *row_multiple* consecutive sites never
+    span two rows. The box is sized to the lattice, so the density is
+    slightly below ``1 / prod(spacing)`` when N does not fill the lattice.
+
+    Returns:
+        tuple[numpy.ndarray, list[float]]: The (N, 3) site positions and
+        the box lengths.
+    """
+    spacing = numpy.array(spacing, dtype=numpy.float64)
+    n_x = row_multiple * math.ceil(N ** (1 / 3) / row_multiple)
+    n_yz = math.ceil(math.sqrt(N / n_x))
+    shape = numpy.array([n_x, n_yz, n_yz])
+
+    index = numpy.arange(N)
+    site = numpy.stack(
+        [index % n_x, (index // n_x) % n_yz, index // (n_x * n_yz)], axis=1
+    )
+    L = shape * spacing
+    position = (site + 0.5) * spacing - L / 2
+    return position, list(L)
+
+
+def _velocities(rng, N, kT):
+    """Draw velocities with zero total momentum."""
+    velocity = rng.normal(scale=math.sqrt(kT), size=(N, 3))
+    return velocity - numpy.mean(velocity, axis=0)
+
+
+class Workload:
+    """Base class for benchmark workloads.
+
+    A `Workload` creates a `hoomd.Simulation` for a canonical model at a
+    requested size. Subclasses set `name` and `sizes` and implement
+    `make_simulation`. Pass a `Workload` to `hoomd.benchmark.run` to measure its
+    performance.
+
+    Attributes:
+        name (str): Name of the workload in benchmark results.
+        sizes (tuple[int]): Default sizes *N*.
+    """
+
+    name = None
+    sizes = (1000, 8000, 64000)
+
+    def make_simulation(self, device, N, seed):
+        """Create the simulation.
+
+        Args:
+            device (hoomd.device.Device): Device to run on.
+            N (int): Size of the workload. Each subclass documents the meaning
+                of *N*.
+            seed (int): Random number seed.
+
+        Returns:
+            hoomd.Simulation: The simulation with its state and operations.
+        """
+        raise NotImplementedError
+
+    def equilibrate(self, simulation, steps):
+        """Run the simulation before the measurement.
+
+        Args:
+            simulation (hoomd.Simulation): Simulation created by
+                `make_simulation`.
+            steps (int): Number of steps to run.
+        """
+        simulation.run(steps)
+
+
+class LJLiquid(Workload):
+    """Lennard-Jones liquid.
+
+    *N* particles at the number density 0.84 and :math:`kT = 1.2` interact
+    with the Lennard-Jones potential (cutoff 2.5). Langevin dynamics
+    integrates the equations of motion with the step size 0.005.
+    """
+
+    name = "lj_liquid"
+
+    def make_simulation(self, device, N, seed):  # noqa: D102
+        simulation = hoomd.Simulation(device=device, seed=seed)
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            position, L = _lattice(N, [0.84 ** (-1 / 3)] * 3)
+            snapshot.configuration.box = L + [0, 0, 0]
+            snapshot.particles.N = N
+            snapshot.particles.types = ["A"]
+            snapshot.particles.position[:] = position
+            rng = numpy.random.default_rng(seed)
+            snapshot.particles.velocity[:] = _velocities(rng, N, 1.2)
+        simulation.create_state_from_snapshot(snapshot)
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = dict(epsilon=1, sigma=1)
+        langevin = hoomd.md.methods.Langevin(filter=hoomd.filter.All(), kT=1.2)
+        simulation.operations.integrator = hoomd.md.Integrator(
+            dt=0.005, forces=[lj], methods=[langevin]
+        )
+        return simulation
+
+
+class KremerGrestMelt(Workload):
+    """Kremer-Grest polymer melt.
+
+    *N* beads in linear chains of 10 beads at the number density 0.85 and
+    :math:`kT = 1`. Bonded beads interact with the FENE and WCA bond potential
+    and all other pairs with the WCA potential. Langevin dynamics integrates
+    the equations of motion with the step size 0.005. *N* must be a multiple of
+    the chain length.
+    """
+
+    name = "kremer_grest_melt"
+    chain_length = 10
+
+    def make_simulation(self, device, N, seed):  # noqa: D102
+        if N % self.chain_length != 0:
+            raise ValueError(f"N must be a multiple of {self.chain_length}.")
+
+        simulation = hoomd.Simulation(device=device, seed=seed)
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            bond_length = 0.97
+            lateral = math.sqrt(1 / (0.85 * bond_length))
+            position, L = _lattice(
+                N, [bond_length, lateral, lateral], self.chain_length
+            )
+            snapshot.configuration.box = L + [0, 0, 0]
+            snapshot.particles.N = N
+            snapshot.particles.types = ["A"]
+            snapshot.particles.position[:] = position
+            rng = numpy.random.default_rng(seed)
+            snapshot.particles.velocity[:] = _velocities(rng, N, 1.0)
+
+            # chains lie along x and never span two lattice rows
+            first = numpy.arange(N).reshape(-1, self.chain_length)[:, :-1]
+            first = first.flatten()
+            snapshot.bonds.N = len(first)
+            snapshot.bonds.types = ["backbone"]
+            snapshot.bonds.group[:] = numpy.stack([first, first + 1], axis=1)
+        simulation.create_state_from_snapshot(snapshot)
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4, exclusions=["bond"])
+        wca = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2 ** (1 / 6), mode="shift")
+        wca.params[("A", "A")] = dict(epsilon=1, sigma=1)
+        fene = hoomd.md.bond.FENEWCA()
+        fene.params["backbone"] = dict(k=30, r0=1.5, epsilon=1, sigma=1, delta=0)
+        langevin = hoomd.md.methods.Langevin(filter=hoomd.filter.All(), kT=1.0)
+        simulation.operations.integrator = hoomd.md.Integrator(
+            dt=0.005, forces=[wca, fene], methods=[langevin]
+        )
+        return simulation
+
+
+class PPPMElectrolyte(Workload):
+    """Electrolyte with long range electrostatics.
+
+    *N* ions with charges :math:`\\pm 1` at the number density 0.84 and
+    :math:`kT = 1`. The ions interact with the WCA potential and the Coulomb
+    potential, which PPPM evaluates with about one mesh point per ion, order
+    5, and the real space cutoff 2.5. Langevin dynamics integrates the
+    equations of motion with the step size 0.005.
+    """
+
+    name = "pppm_electrolyte"
+
+    def make_simulation(self, device, N, seed):  # noqa: D102
+        simulation = hoomd.Simulation(device=device, seed=seed)
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            position, L = _lattice(N, [0.84 ** (-1 / 3)] * 3)
+            snapshot.configuration.box = L + [0, 0, 0]
+            snapshot.particles.N = N
+            snapshot.particles.types = ["A"]
+            snapshot.particles.position[:] = position
+            snapshot.particles.charge[:] = numpy.where(numpy.arange(N) % 2, -1, 1)
+            rng = numpy.random.default_rng(seed)
+            snapshot.particles.velocity[:] = _velocities(rng, N, 1.0)
+        simulation.create_state_from_snapshot(snapshot)
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        wca = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2 ** (1 / 6), mode="shift")
+        wca.params[("A", "A")] = dict(epsilon=1, sigma=1)
+        mesh = 2 * math.ceil(N ** (1 / 3) / 2)
+        pppm = hoomd.md.long_range.pppm
+        real_space, reciprocal_space = pppm.make_pppm_coulomb_forces(
+            nlist=nlist, resolution=(mesh, mesh, mesh), order=5, r_cut=2.5
+        )
+        langevin = hoomd.md.methods.Langevin(filter=hoomd.filter.All(), kT=1.0)
+        simulation.operations.integrator = hoomd.md.Integrator(
+            dt=0.005,
+            forces=[wca, real_space, reciprocal_space],
+            methods=[langevin],
+        )
+        return simulation
+
+
+class RigidDumbbells(Workload):
+    """Rigid dumbbells.
+
+    *N* rigid bodies, each made of two WCA spheres one diameter apart, at the
+    body number density 0.25 and :math:`kT = 1`. Langevin dynamics integrates
+    the translational and rotational equations of motion with the step size
+    0.005.
+    """
+
+    name = "rigid_dumbbells"
+
+    def make_simulation(self, device, N, seed):  # noqa: D102
+        simulation = hoomd.Simulation(device=device, seed=seed)
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            # bodies lie along x, so leave one diameter between the bodies
+            lateral = math.sqrt(1 / (0.25 * 2.0))
+            position, L = _lattice(N, [2.0, lateral, lateral])
+            snapshot.configuration.box = L + [0, 0, 0]
+            snapshot.particles.N = N
+            snapshot.particles.types = ["center", "bead"]
+            snapshot.particles.position[:] = position
+            snapshot.particles.mass[:] = 2
+            snapshot.particles.moment_inertia[:] = [0, 0.5, 0.5]
+            rng = numpy.random.default_rng(seed)
+            snapshot.particles.velocity[:] = _velocities(rng, N, 0.5)
+        simulation.create_state_from_snapshot(snapshot)
+
+        rigid = hoomd.md.constrain.Rigid()
+        rigid.body["center"] = {
+            "constituent_types": ["bead", "bead"],
+            "positions": [(-0.5, 0, 0), (0.5, 0, 0)],
+            "orientations": [(1, 0, 0, 0), (1, 0, 0, 0)],
+        }
+        rigid.create_bodies(simulation.state)
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4, exclusions=["body"])
+        wca = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2 ** (1 / 6), mode="shift")
+        wca.params[(["center", "bead"], ["center", "bead"])] = dict(epsilon=1, sigma=1)
+        wca.r_cut[("center", ["center", "bead"])] = 0
+        langevin = hoomd.md.methods.Langevin(
+            filter=hoomd.filter.Rigid(("center", "free")), kT=1.0
+        )
+        simulation.operations.integrator = hoomd.md.Integrator(
+            dt=0.005,
+            integrate_rotational_dof=True,
+            rigid=rigid,
+            forces=[wca],
+            methods=[langevin],
+        )
+        return simulation
+
+
+class _HardParticles(Workload):
+    """Common implementation of the HPMC workloads."""
+
+    spacing = None
+
+    def _make_integrator(self):
+        raise NotImplementedError
+
+    def make_simulation(self, device, N, seed):  # noqa: D102
+        simulation = hoomd.Simulation(device=device, seed=seed)
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            position, L = _lattice(N, [self.spacing] * 3)
+            snapshot.configuration.box = L + [0, 0, 0]
+            snapshot.particles.N = N
+            snapshot.particles.types = ["A"]
+            snapshot.particles.position[:] = position
+        simulation.create_state_from_snapshot(snapshot)
+        simulation.operations.integrator = self._make_integrator()
+        return simulation
+
+    def equilibrate(self, simulation, steps):
+        """Tune the move sizes to an acceptance ratio of 0.2 while running."""
+        integrator = simulation.operations.integrator
+        moves = ["a", "d"] if integrator.a["A"] > 0 else ["d"]
+        tuner = hoomd.hpmc.tune.MoveSize.scale_solver(
+            trigger=10, moves=moves, target=0.2
+        )
+        simulation.operations.tuners.append(tuner)
+        simulation.run(steps)
+        simulation.operations.tuners.remove(tuner)
+
+
+class HardSpheres(_HardParticles):
+    """Hard spheres.
+
+    *N* hard spheres of unit diameter at the packing fraction 0.45.
+    """
+
+    name = "hpmc_hard_spheres"
+    spacing = (math.pi / 6 / 0.45) ** (1 / 3)
+
+    def _make_integrator(self):
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.1, default_a=0)
+        mc.shape["A"] = dict(diameter=1)
+        return mc
+
+
+class HardCubes(_HardParticles):
+    """Hard cubes.
+
+    *N* hard cubes with unit edges at the packing fraction 0.6, simulated with
+    `hoomd.hpmc.integrate.ConvexPolyhedron`.
+    """
+
+    name = "hpmc_hard_cubes"
+    spacing = (1 / 0.6) ** (1 / 3)
+
+    def _make_integrator(self):
+        mc = hoomd.hpmc.integrate.ConvexPolyhedron(default_d=0.1, default_a=0.1)
+        mc.shape["A"] = dict(
+            vertices=[
+                (x, y, z) for x in (-0.5, 0.5) for y in (-0.5, 0.5) for z in (-0.5, 0.5)
+            ]
+        )
+        return mc
+
+
+class MPCDSolvent(Workload):
+    """MPCD solvent.
+
+    *N* MPCD particles at about 5 particles per collision cell of unit size and
+    :math:`kT = 1`. Stochastic rotation dynamics collides the particles every
+    step with the rotation angle 130 degrees and a thermostat. The step size is
+    0.1.
+    """
+
+    name = "mpcd_solvent"
+    sizes = (64000, 512000)
+
+    def make_simulation(self, device, N, seed):  # noqa: D102
+        simulation = hoomd.Simulation(device=device, seed=seed)
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            L = math.ceil((N / 5) ** (1 / 3))
+            snapshot.configuration.box = [L, L, L, 0, 0, 0]
+            snapshot.particles.types = ["A"]
+            rng = numpy.random.default_rng(seed)
+            snapshot.mpcd.N = N
+            snapshot.mpcd.types = ["A"]
+            snapshot.mpcd.position[:] = rng.uniform(-L / 2, L / 2, size=(N, 3))
+            snapshot.mpcd.velocity[:] = _velocities(rng, N, 1.0)
+        simulation.create_state_from_snapshot(snapshot)
+
+        simulation.operations.integrator = hoomd.mpcd.Integrator(
+            dt=0.1,
+            streaming_method=hoomd.mpcd.stream.Bulk(period=1),
+            collision_method=hoomd.mpcd.collide.StochasticRotationDynamics(
+                period=1, angle=130, kT=1.0
+            ),
+            mpcd_particle_sorter=hoomd.mpcd.tune.ParticleSorter(trigger=20),
+        )
+        return simulation
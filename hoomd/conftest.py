@@ -351,6 +351,26 @@ def rng():
     return numpy.random.default_rng(564)
 
 
+@pytest.fixture(scope="function")
+def num_cpu_threads(device):
+    """Iterate over numbers of CPU threads.
+
+    Returns a generator function that sets ``device.num_cpu_threads`` to each
+    of the given values in turn and yields it. The original number of threads
+    is restored at the end of the test.
+    """
+    original_num_threads = device.num_cpu_threads
+
+    def iterate(values=(1, 3)):
+        for value in values:
+            device.num_cpu_threads = value
+            yield value
+
+    yield iterate
+
+    device.num_cpu_threads = original_num_threads
+
+
 def pytest_configure(config):
     """Add markers to pytest configuration."""
     config.addinivalue_line(
@@ -43,8 +43,9 @@ class Action(metaclass=_AbstractLoggable):
                     self.com = snapshot.particles.position.mean(axis=0)
 
     To request that HOOMD-blue compute virials, pressure, the rotational kinetic
-    energy, or the external field virial, set the flags attribute with the
-    appropriate flags from the internal `Action.Flags` enumeration:
+    energy, the external field virial, or the potential energy, set the flags
+    attribute with the appropriate flags from the internal `Action.Flags`
+    enumeration:
 
     .. code-block:: python
 
@@ -53,6 +54,7 @@ class Action(metaclass=_AbstractLoggable):
                 Action.Flags.ROTATIONAL_KINETIC_ENERGY,
                 Action.Flags.PRESSURE_TENSOR,
                 Action.Flags.EXTERNAL_FIELD_VIRIAL,
+                Action.Flags.POTENTIAL_ENERGY,
             ]
 
             def act(self, timestep):
@@ -86,11 +88,13 @@ class Action(metaclass=_AbstractLoggable):
         * PRESSURE_TENSOR = 0
         * ROTATIONAL_KINETIC_ENERGY = 1
         * EXTERNAL_FIELD_VIRIAL = 2
+        * POTENTIAL_ENERGY = 3
         """
 
         PRESSURE_TENSOR = 0
         ROTATIONAL_KINETIC_ENERGY = 1
         EXTERNAL_FIELD_VIRIAL = 2
+        POTENTIAL_ENERGY = 3
 
     flags = []
     log_quantities = {}
@@ -475,6 +475,25 @@ class HOOMDArray(metaclass=_wrap_class_factory(_wrap_list)):
                 )
             )
 
+    def __dlpack__(self, stream=None):
+        """Export the buffer through the DLPack protocol without a copy.
+
+        The tensor refers to the internal buffer and is only valid inside the
+        context manager in which the array was created. Consumers must not
+        modify arrays that are `read_only`.
+        """
+        if not self._callback():
+            raise HOOMDArrayError(
+                "Cannot access {} outside context manager.".format(
+                    self.__class__.__name__
+                )
+            )
+        return self._buffer.__dlpack__(stream=stream)
+
+    def __dlpack_device__(self):
+        """tuple[int, int]: DLPack device type and id of the buffer."""
+        return self._buffer.__dlpack_device__()
+
     @property
     def shape(self):
         """tuple: Array shape."""
@@ -549,6 +568,24 @@ if hoomd.version.gpu_enabled:
         def __cuda_array_interface__(self):
             return deepcopy(self._buffer.__cuda_array_interface__)
 
+        def __dlpack__(self, stream=None):
+            """Export the buffer through the DLPack protocol without a copy.
+
+            When ``stream`` is given, the consumer's stream waits on the work
+            HOOMD-blue has already queued on the GPU, so the consumer does not
+            need to synchronize the device.
+            """
+            if not self._callback():
+                raise HOOMDArrayError(
+                    "Cannot access {} outside context manager.".format(
+                        self.__class__.__name__
+                    )
+                )
+            return self._buffer.__dlpack__(stream=stream)
+
+        def __dlpack_device__(self):
+            return self._buffer.__dlpack_device__()
+
         @property
         def read_only(self):
             return self._buffer.read_only
@@ -799,6 +836,12 @@ Note:
     <https://nvidia.github.io/numba-cuda/user/cuda_array_interface.html>`_
     should support the direct use of `HOOMDGPUArray` objects.
 
+Tip:
+    `HOOMDGPUArray` implements the `DLPack
+    <https://dmlc.github.io/dlpack/latest/python_spec.html>`_ protocol. Use
+    ``torch.from_dlpack`` or ``jax.dlpack.from_dlpack`` for zero-copy access
+    that synchronizes with the consumer's stream instead of the whole device.
+
 """
 
 HOOMDGPUArray.__doc__ = _gpu_array_docs
@@ -131,6 +131,26 @@ class Device:
         Descriptions of the active hardware device.
         `Read more... <hoomd.device.Device.device>`
 
+    .. py:property:: autotuner_cache
+
+        Filename of the persistent autotuner cache.
+        `Read more... <hoomd.device.Device.autotuner_cache>`
+
+    .. py:property:: autotuner_retune_threshold
+
+        Relative change in kernel run time that restarts autotuning.
+        `Read more... <hoomd.device.Device.autotuner_retune_threshold>`
+
+    .. py:property:: memory_pool_limit
+
+        Maximum number of bytes held in the memory pool.
+        `Read more... <hoomd.device.Device.memory_pool_limit>`
+
+    .. py:property:: memory_pool_statistics
+
+        Hit and miss counts of the memory pool.
+        `Read more... <hoomd.device.Device.memory_pool_statistics>`
+
     .. py:method:: notice
 
         Write a notice message.
@@ -236,6 +256,131 @@ class Device:
         """str: Descriptions of the active hardware device."""
         return self._cpp_exec_conf.getActiveDevice()
 
+    @property
+    def autotuner_cache(self):
+        """str: Filename of the persistent autotuner cache.
+
+        Autotuners scan many kernel launch parameters before settling on the
+        fastest. Set `autotuner_cache` to a filename to save the chosen
+        parameters to that file and reuse them in later simulations on the
+        same device with a similar number of particles. Autotuners that find a
+        valid entry in the cache skip their initial scan.
+
+        Set `autotuner_cache` to `None` to disable the cache.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            device.autotuner_cache = str(path / "autotuner_cache.txt")
+
+        Note:
+            Autotuners read the cache when they are created. Set
+            `autotuner_cache` before adding operations to the simulation and
+            before calling `hoomd.Simulation.run`.
+
+        Note:
+            The cache key includes the HOOMD-blue version, so upgrading
+            HOOMD-blue invalidates all cached entries.
+        """
+        filename = self._cpp_exec_conf.getAutotunerCacheFilename()
+        if filename == "":
+            return None
+        return filename
+
+    @autotuner_cache.setter
+    def autotuner_cache(self, filename):
+        if filename is None:
+            filename = ""
+        self._cpp_exec_conf.setAutotunerCacheFilename(str(filename))
+
+    @property
+    def autotuner_retune_threshold(self):
+        """float: Relative change in kernel run time that restarts autotuning.
+
+        The fastest kernel parameters change when the workload changes, such as
+        during a compression, nucleation, or any other large change in the
+        number of particles or neighbors. After an autotuner completes its
+        scan, it times one in every 500 kernel launches. When the median of
+        these timings differs from the timing after the scan by more than the
+        relative `autotuner_retune_threshold`, the autotuner starts a new scan.
+
+        Set `autotuner_retune_threshold` to 0 to keep the parameters fixed
+        after the scan completes.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            device.autotuner_retune_threshold = 0.5
+
+        Note:
+            Autotuners that synchronize the parameters over MPI ranks do not
+            re-tune. Neither do autotuners with parameters set by the user in
+            `hoomd.operation.AutotunedObject.kernel_parameters`.
+        """
+        return self._cpp_exec_conf.getAutotunerRetuneThreshold()
+
+    @autotuner_retune_threshold.setter
+    def autotuner_retune_threshold(self, threshold):
+        self._cpp_exec_conf.setAutotunerRetuneThreshold(float(threshold))
+
+    @property
+    def memory_pool_limit(self):
+        """int: Maximum number of free bytes held in the memory pool.
+
+        HOOMD-blue returns the memory of freed and resized internal arrays to a
+        pool and reuses it for later allocations of a similar size. This
+        avoids repeated host and device allocations when the number of
+        particles on a rank fluctuates (for example, from domain
+        decomposition migration). The pool holds at most `memory_pool_limit`
+        bytes of free memory on each MPI rank. Set `memory_pool_limit` to 0 to
+        disable the pool and release the memory it holds.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            device.memory_pool_limit = 256 * 1024**2
+        """
+        return self._cpp_exec_conf.getMemoryPoolLimit()
+
+    @memory_pool_limit.setter
+    def memory_pool_limit(self, limit):
+        self._cpp_exec_conf.setMemoryPoolLimit(int(limit))
+
+    @property
+    def memory_pool_statistics(self):
+        """dict: Hit and miss counts of the memory pool on this rank.
+
+        The dictionary contains:
+
+        * ``host_hits`` (`int`): Host allocations served from the pool.
+        * ``host_misses`` (`int`): Host allocations that allocated new memory.
+        * ``host_cached_bytes`` (`int`): Free host memory held by the pool.
+        * ``device_hits`` (`int`): Device allocations served from the pool.
+        * ``device_misses`` (`int`): Device allocations that allocated new
+          memory.
+        * ``device_cached_bytes`` (`int`): Free device memory held by the
+          pool.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            statistics = device.memory_pool_statistics
+        """
+        return self._cpp_exec_conf.getMemoryPoolStatistics()
+
+    @contextlib.contextmanager
+    def _memory_scope(self, tag):
+        """Account internal arrays allocated in the context to ``tag``."""
+        self._cpp_exec_conf.pushMemoryTag(tag)
+        try:
+            yield
+        finally:
+            self._cpp_exec_conf.popMemoryTag()
+
     def notice(self, message, level=1):
         """Write a notice message.
 
@@ -319,9 +464,10 @@ class GPU(Device):
     each rank.
 
     Note:
-        Not all features are optimized to use this code path, and it requires
-        that all GPUs support concurrent managed memory access and have high
-        bandwidth interconnects.
+        Each rank drives one GPU. To use several GPUs in one node, launch one
+        MPI rank per GPU. With `gpu_aware_mpi`, MPI libraries that support
+        CUDA IPC transfer the domain decomposition messages between GPUs in
+        the same node directly over NVLink or PCIe.
 
     .. rubric:: Example:
 
@@ -382,6 +528,38 @@ class GPU(Device):
     def gpu_error_checking(self, new_bool):
         self._cpp_exec_conf.setCUDAErrorChecking(new_bool)
 
+    @property
+    def gpu_aware_mpi(self):
+        """bool: Whether to pass device memory buffers directly to MPI.
+
+        When `True`, communication of ghost particles, particle migration, PPPM
+        grid halo exchanges, and the transposes of the distributed PPPM FFT
+        pass device pointers to MPI. When `False`, HOOMD copies the buffers to
+        host memory before calling MPI.
+
+        The default is `True` when the MPI library reports GPU support at run
+        time (Open MPI built with CUDA or ROCm support, Cray MPICH with
+        ``MPICH_GPU_SUPPORT_ENABLED=1``, or MVAPICH2 with ``MV2_USE_CUDA=1``)
+        and the simulation runs on more than one rank.
+
+        Warning:
+            Setting `gpu_aware_mpi` to `True` when the MPI library does not
+            support device buffers will crash the simulation.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.gpu_aware_mpi = False
+        """
+        return self._cpp_exec_conf.isGPUAwareMPIEnabled()
+
+    @gpu_aware_mpi.setter
+    def gpu_aware_mpi(self, enable):
+        self._cpp_exec_conf.setGPUAwareMPI(bool(enable))
+
     @property
     def compute_capability(self):
         """tuple(int, int): Compute capability of the device.
@@ -429,6 +607,11 @@ class GPU(Device):
         context manager and continue the simulation for a time. Profiling stops
         when the context manager closes.
 
+        When HOOMD-blue is built with ``ENABLE_NVTOOLS`` (CUDA) or
+        ``ENABLE_ROCTRACER`` (ROCm), the timelines show a named range for each
+        autotuned kernel launch, each phase of MPI communication, and each
+        frame written by `hoomd.write.GSD`.
+
         .. rubric:: Example:
 
         .. skip: next if(gpu_not_available)
@@ -459,6 +642,8 @@ class CPU(Device):
 
         notice_level (int): Minimum level of messages to print.
 
+        num_cpu_threads (int): Number of CPU threads to use on each MPI rank.
+
     .. rubric:: MPI
 
     In MPI execution environments, create a `CPU` device on every rank.
@@ -468,15 +653,22 @@ class CPU(Device):
     .. code-block:: python
 
         cpu = hoomd.device.CPU()
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `CPU`:
     """
 
-    __doc__ += Device._doc_inherited
+    __doc__ = __doc__.replace("{inherited}", Device._doc_inherited)
 
     def __init__(
         self,
         communicator=None,
         message_filename=None,
         notice_level=2,
+        num_cpu_threads=1,
     ):
         super().__init__(communicator, notice_level, message_filename)
 
@@ -486,6 +678,94 @@ class CPU(Device):
             self.communicator.cpp_mpi_conf,
             self._cpp_msg,
         )
+        self.num_cpu_threads = num_cpu_threads
+
+    @property
+    def num_cpu_threads(self):
+        """int: Number of CPU threads to use on each MPI rank.
+
+        Operations that implement threaded CPU code paths (such as
+        `hoomd.md.pair.Pair` potentials) split their work over
+        `num_cpu_threads` threads. Use this in combination with MPI to run one
+        rank per socket (or NUMA domain) and one thread per core. Operations
+        without threaded code paths execute serially.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            cpu.num_cpu_threads = 4
+        """
+        return self._cpp_exec_conf.getNumThreads()
+
+    @num_cpu_threads.setter
+    def num_cpu_threads(self, num_cpu_threads):
+        self._cpp_exec_conf.setNumThreads(int(num_cpu_threads))
+
+    @property
+    def compress_ghost_updates(self):
+        """bool: Whether to send ghost positions as quantized displacements.
+
+        Between neighbor list builds, MPI ranks send the positions of their
+        ghost particles to their neighbors at every step. When
+        `compress_ghost_updates` is `True`, ranks instead send the displacement
+        of each ghost since the last ghost exchange as three 16-bit fixed point
+        integers. The fixed point scale is the largest displacement in each
+        message, which the neighbor list buffer bounds. Messages with
+        displacements larger than the ghost layer width fall back to full
+        precision. Every ghost exchange (after particle migration) resends
+        positions at full precision.
+
+        This reduces the size of ghost position messages by a factor of 2.7
+        (single precision) or 5 (double precision) at the cost of a relative
+        position error of :math:`2^{-16}` of the largest displacement.
+
+        Set the same value on all ranks. Changes take effect at the next ghost
+        exchange.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            cpu.compress_ghost_updates = True
+        """
+        return self._cpp_exec_conf.isGhostUpdateCompressionEnabled()
+
+    @compress_ghost_updates.setter
+    def compress_ghost_updates(self, enable):
+        self._cpp_exec_conf.setGhostUpdateCompression(bool(enable))
+
+    @property
+    def sort_ghosts(self):
+        """bool: Whether to sort ghost particles by cell.
+
+        MPI ranks append the ghost particles they receive from their neighbors
+        to the local particles in the order the messages arrive, so ghosts that
+        are close in space are far apart in memory. When `sort_ghosts` is
+        `True`, each ghost exchange (after particle migration) sorts the ghosts
+        by the cells of a grid as wide as the ghost layer. The order is kept
+        until the next ghost exchange, and the ghost updates at every step
+        write the received data into the sorted order.
+
+        Sorting improves the memory locality of neighbor list and pair force
+        loops over ghost particles, which matters most in small domains where
+        ghosts make up a large fraction of the particles. It changes the order
+        in which ghost interactions are summed, so trajectories differ at the
+        level of floating point round off.
+
+        Changes take effect at the next ghost exchange.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            cpu.sort_ghosts = True
+        """
+        return self._cpp_exec_conf.isGhostSortingEnabled()
+
+    @sort_ghosts.setter
+    def sort_ghosts(self, enable):
+        self._cpp_exec_conf.setGhostSorting(bool(enable))
 
 
 def auto_select(
@@ -568,6 +568,7 @@ int dfft_create_plan_common(dfft_plan *p,
     #else
     p->check_cuda_errors = 0;
     #endif
+    p->gpu_aware_mpi = 0;
     #endif
 
     p->row_m = row_m;
@@ -69,6 +69,7 @@ typedef struct
     int device;           /* ==1 if this is a device plan */
     #ifdef ENABLE_HIP
     int check_cuda_errors; /* == 1 if we are checking errors */
+    int gpu_aware_mpi;     /* == 1 if MPI accepts device buffers */
     #endif
 
     int row_m;            /* ==1 If we are using row-major procesor id mapping */
@@ -275,17 +275,30 @@ void dfft_cuda_redistribute_nd( dfft_plan *plan,int stage, int size_in, int *emb
     MPI_Barrier(plan->comm);
 
     /* communicate */
-    // stage into host buf
-    hipMemcpy(plan->h_stage_in, plan->d_scratch, sizeof(cuda_cpx_t)*size_in,hipMemcpyDefault);
-    if (plan->check_cuda_errors) CHECK_CUDA();
+    if (plan->gpu_aware_mpi)
+        {
+        // the pack kernels must complete before MPI reads the device buffer
+        hipDeviceSynchronize();
+        if (plan->check_cuda_errors) CHECK_CUDA();
+
+        MPI_Alltoallv(plan->d_scratch,plan->nsend, plan->offset_send, MPI_BYTE,
+                      plan->d_scratch_2,plan->nrecv, plan->offset_recv, MPI_BYTE,
+                      plan->comm);
+        }
+    else
+        {
+        // stage into host buf
+        hipMemcpy(plan->h_stage_in, plan->d_scratch, sizeof(cuda_cpx_t)*size_in,hipMemcpyDefault);
+        if (plan->check_cuda_errors) CHECK_CUDA();
 
-    MPI_Alltoallv(plan->h_stage_in,plan->nsend, plan->offset_send, MPI_BYTE,
-                  plan->h_stage_out,plan->nrecv, plan->offset_recv, MPI_BYTE,
-                  plan->comm);
+        MPI_Alltoallv(plan->h_stage_in,plan->nsend, plan->offset_send, MPI_BYTE,
+                      plan->h_stage_out,plan->nrecv, plan->offset_recv, MPI_BYTE,
+                      plan->comm);
 
-    // copy back received data
-    hipMemcpy(plan->d_scratch_2,plan->h_stage_out, sizeof(cuda_cpx_t)*size_in,hipMemcpyDefault);
-    if (plan->check_cuda_errors) CHECK_CUDA();
+        // copy back received data
+        hipMemcpy(plan->d_scratch_2,plan->h_stage_out, sizeof(cuda_cpx_t)*size_in,hipMemcpyDefault);
+        if (plan->check_cuda_errors) CHECK_CUDA();
+        }
 
     /* unpack data */
     if (dir)
@@ -1236,3 +1249,8 @@ void dfft_cuda_check_errors(dfft_plan *plan, int check_err)
     {
     plan->check_cuda_errors = check_err;
     }
+
+void dfft_cuda_gpu_aware_mpi(dfft_plan *plan, int gpu_aware_mpi)
+    {
+    plan->gpu_aware_mpi = gpu_aware_mpi;
+    }
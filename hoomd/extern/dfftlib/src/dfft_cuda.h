@@ -40,6 +40,12 @@ EXTERN_DFFT void dfft_cuda_destroy_plan(dfft_plan plan);
  */
 EXTERN_DFFT void dfft_cuda_check_errors(dfft_plan *plan, int check_err);
 
+/*
+ * Pass device buffers to MPI directly instead of staging them through host memory
+ * (requires GPU-aware MPI)
+ */
+EXTERN_DFFT void dfft_cuda_gpu_aware_mpi(dfft_plan *plan, int gpu_aware_mpi);
+
 /*
  * Execute the parallel FFT on the device
  */
@@ -529,6 +529,40 @@ extern "C"
                         uint8_t flags,
                         const void* data);
 
+    /** Reserve space for a data chunk in the current frame.
+
+        @param handle Handle to an open GSD file.
+        @param name Name of the data chunk.
+        @param type type ID that identifies the type of data in the chunk.
+        @param N Number of rows in the data.
+        @param M Number of columns in the data.
+        @param flags set to 0, non-zero values reserved for future use.
+        @param location Output: byte offset of the reserved space in the file.
+
+        @pre *handle* was opened by gsd_open().
+        @pre *name* is a unique name for data chunks in the given frame.
+
+        @post The index entry is present in the buffer.
+        @post `N * M * gsd_sizeof_type(type)` bytes starting at *location* are reserved at the end
+              of the file. The caller must write the chunk data to this range (for example, with
+              parallel I/O) before the next call to gsd_flush() or gsd_close().
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *M* == 0, *type* is invalid, or
+            *flags* != 0.
+          - GSD_ERROR_FILE_MUST_BE_WRITABLE: The file was opened read-only.
+          - GSD_ERROR_NAMELIST_FULL: The file cannot store any additional unique chunk names.
+          - GSD_ERROR_MEMORY_ALLOCATION_FAILED: failed to allocate memory.
+    */
+    int gsd_reserve_chunk(struct gsd_handle* handle,
+                          const char* name,
+                          enum gsd_type type,
+                          uint64_t N,
+                          uint32_t M,
+                          uint8_t flags,
+                          int64_t* location);
+
     /** Find a chunk in the GSD file.
 
         @param handle Handle to an open GSD file
@@ -569,6 +603,38 @@ extern "C"
     */
     int gsd_read_chunk(struct gsd_handle* handle, void* data, const struct gsd_index_entry* chunk);
 
+    /** Read a range of rows of a chunk from the GSD file.
+
+        @param handle Handle to an open GSD file.
+        @param data Data buffer to read into.
+        @param chunk Chunk to read.
+        @param first First row to read.
+        @param n Number of rows to read.
+
+        @pre *handle* was opened in read or readwrite mode.
+        @pre *chunk* was found by gsd_find_chunk().
+        @pre *data* points to an allocated buffer with at least `n * M * gsd_sizeof_type(type)`
+       bytes.
+
+        Only rows `[first, first + n)` are read from the file, which allows many processes to
+        each read a slice of a large chunk.
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_IO: IO error (check errno).
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *data* is NULL, *chunk* is NULL, or
+            the range extends past the end of the chunk.
+          - GSD_ERROR_FILE_MUST_BE_READABLE: The file was opened in append mode.
+          - GSD_ERROR_FILE_CORRUPT: The GSD file is corrupt.
+
+        @note gsd_read_chunk_range() calls gsd_flush() when the file is writable.
+    */
+    int gsd_read_chunk_range(struct gsd_handle* handle,
+                             void* data,
+                             const struct gsd_index_entry* chunk,
+                             uint64_t first,
+                             uint64_t n);
+
     /** Get the number of frames in the GSD file.
 
         @param handle Handle to an open GSD file
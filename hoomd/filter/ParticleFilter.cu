@@ -0,0 +1,208 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ParticleFilter.cuh"
+#include "hoomd/ParticleData.cuh"
+
+/*! \file ParticleFilter.cu
+    \brief Defines the GPU kernels that flag the members of the built-in particle filters
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Flag the particles with a type in the type mask
+__global__ void gpu_filter_flag_types_kernel(unsigned int N,
+                                             const Scalar4* d_postype,
+                                             const unsigned int* d_type_mask,
+                                             unsigned int* d_flags)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    d_flags[idx] = d_type_mask[__scalar_as_int(d_postype[idx].w)];
+    }
+
+//! Flag the rigid body centers (1), constituents (2), and/or free particles (4)
+__global__ void gpu_filter_flag_rigid_kernel(unsigned int N,
+                                             const unsigned int* d_tag,
+                                             const unsigned int* d_body,
+                                             unsigned int selection,
+                                             unsigned int* d_flags)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    unsigned int tag = d_tag[idx];
+    unsigned int body = d_body[idx];
+
+    bool include_particle = ((selection & 1) && tag == body)
+                            || ((selection & 2) && body < MIN_FLOPPY && body != tag)
+                            || ((selection & 4) && body == NO_BODY);
+    d_flags[idx] = include_particle;
+    }
+
+//! Flag the local particles with the given tags
+__global__ void gpu_filter_flag_tags_kernel(unsigned int N,
+                                            unsigned int n_tags,
+                                            const unsigned int* d_tags,
+                                            const unsigned int* d_rtag,
+                                            unsigned int max_tag,
+                                            unsigned int* d_flags)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= n_tags)
+        return;
+
+    unsigned int tag = d_tags[i];
+    if (tag > max_tag)
+        return;
+
+    unsigned int idx = d_rtag[tag];
+    if (idx < N)
+        d_flags[idx] = 1;
+    }
+
+//! Combine the flags of two filters
+__global__ void gpu_filter_combine_flags_kernel(unsigned int N,
+                                                unsigned int* d_flags,
+                                                const unsigned int* d_other,
+                                                FlagOperation operation)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    unsigned int flag = d_flags[idx];
+    unsigned int other = d_other[idx];
+    if (operation == FlagOperation::Intersection)
+        d_flags[idx] = flag && other;
+    else if (operation == FlagOperation::Union)
+        d_flags[idx] = flag || other;
+    else
+        d_flags[idx] = flag && !other;
+    }
+
+/*! \param N Number of local particles
+    \param d_postype Particle positions and types
+    \param d_type_mask 1 for the selected types, 0 otherwise
+    \param d_flags Membership flags (output)
+*/
+hipError_t gpu_filter_flag_types(unsigned int N,
+                                 const Scalar4* d_postype,
+                                 const unsigned int* d_type_mask,
+                                 unsigned int* d_flags)
+    {
+    unsigned int block_size = 256;
+    unsigned int n_blocks = N / block_size + 1;
+
+    hipLaunchKernelGGL(gpu_filter_flag_types_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       N,
+                       d_postype,
+                       d_type_mask,
+                       d_flags);
+    return hipSuccess;
+    }
+
+/*! \param N Number of local particles
+    \param d_tag Particle tags
+    \param d_body Particle body ids
+    \param selection Bitwise or of RigidBodySelection values
+    \param d_flags Membership flags (output)
+*/
+hipError_t gpu_filter_flag_rigid(unsigned int N,
+                                 const unsigned int* d_tag,
+                                 const unsigned int* d_body,
+                                 unsigned int selection,
+                                 unsigned int* d_flags)
+    {
+    unsigned int block_size = 256;
+    unsigned int n_blocks = N / block_size + 1;
+
+    hipLaunchKernelGGL(gpu_filter_flag_rigid_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       N,
+                       d_tag,
+                       d_body,
+                       selection,
+                       d_flags);
+    return hipSuccess;
+    }
+
+/*! \param N Number of local particles
+    \param n_tags Number of tags to flag
+    \param d_tags Tags to flag
+    \param d_rtag Reverse tag lookup table
+    \param max_tag Largest entry in d_rtag
+    \param d_flags Membership flags (output)
+*/
+hipError_t gpu_filter_flag_tags(unsigned int N,
+                                unsigned int n_tags,
+                                const unsigned int* d_tags,
+                                const unsigned int* d_rtag,
+                                unsigned int max_tag,
+                                unsigned int* d_flags)
+    {
+    hipMemsetAsync(d_flags, 0, sizeof(unsigned int) * N);
+
+    if (n_tags == 0)
+        return hipSuccess;
+
+    unsigned int block_size = 256;
+    unsigned int n_blocks = n_tags / block_size + 1;
+
+    hipLaunchKernelGGL(gpu_filter_flag_tags_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       N,
+                       n_tags,
+                       d_tags,
+                       d_rtag,
+                       max_tag,
+                       d_flags);
+    return hipSuccess;
+    }
+
+/*! \param N Number of local particles
+    \param d_flags Membership flags of the first filter, replaced by the result
+    \param d_other Membership flags of the second filter
+    \param operation Set operation to apply
+*/
+hipError_t gpu_filter_combine_flags(unsigned int N,
+                                    unsigned int* d_flags,
+                                    const unsigned int* d_other,
+                                    FlagOperation operation)
+    {
+    unsigned int block_size = 256;
+    unsigned int n_blocks = N / block_size + 1;
+
+    hipLaunchKernelGGL(gpu_filter_combine_flags_kernel,
+                       dim3(n_blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       N,
+                       d_flags,
+                       d_other,
+                       operation);
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace hoomd
@@ -0,0 +1,58 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file ParticleFilter.cuh
+    \brief Declares the GPU kernels that flag the members of the built-in particle filters
+*/
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Set operations that combine the membership flags of two filters
+enum class FlagOperation
+    {
+    Intersection,
+    Union,
+    Difference
+    };
+
+#ifdef ENABLE_HIP
+//! Flag the particles with a type in the type mask
+hipError_t gpu_filter_flag_types(unsigned int N,
+                                 const Scalar4* d_postype,
+                                 const unsigned int* d_type_mask,
+                                 unsigned int* d_flags);
+
+//! Flag the rigid body centers, constituents, and/or free particles
+hipError_t gpu_filter_flag_rigid(unsigned int N,
+                                 const unsigned int* d_tag,
+                                 const unsigned int* d_body,
+                                 unsigned int selection,
+                                 unsigned int* d_flags);
+
+//! Flag the local particles with the given tags
+hipError_t gpu_filter_flag_tags(unsigned int N,
+                                unsigned int n_tags,
+                                const unsigned int* d_tags,
+                                const unsigned int* d_rtag,
+                                unsigned int max_tag,
+                                unsigned int* d_flags);
+
+//! Combine the flags of two filters
+hipError_t gpu_filter_combine_flags(unsigned int N,
+                                    unsigned int* d_flags,
+                                    const unsigned int* d_other,
+                                    FlagOperation operation);
+#endif
+
+    } // end namespace kernel
+    } // end namespace hoomd
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "../SystemDefinition.h"
+#include "ParticleFilter.cuh"
+#include <algorithm>
 #include <memory>
 #include <pybind11/pybind11.h>
 #include <vector>
@@ -31,6 +33,12 @@ namespace hoomd
     rank.
 
     The base class getSelectedTags() method returns an empty vector.
+
+    <b>Membership flags</b> ParticleGroup evaluates the filters that return
+    true from canFlagMembers() with flagMembers(), which sets a flag for each
+    rank local particle. The built-in filters flag their members on the GPU
+    when the execution configuration enables CUDA, which avoids copying the
+    particle data to the host.
 */
 class PYBIND11_EXPORT ParticleFilter
     {
@@ -47,6 +55,103 @@ class PYBIND11_EXPORT ParticleFilter
         {
         return std::vector<unsigned int>();
         }
+
+    /// Test if flagMembers() evaluates the filter without getSelectedTags()
+    virtual bool canFlagMembers() const
+        {
+        return false;
+        }
+
+    /** Flag the rank local particles that meet the selection criteria.
+     *  Args:
+     *  sysdef: system definition
+     *  flags: set to 1 for the selected particles and 0 for the others, by
+     *  particle index. Must hold at least N elements.
+     *
+     *  The base case flags the particles with the tags that
+     *  getSelectedTags() returns.
+     */
+    virtual void flagMembers(std::shared_ptr<SystemDefinition> sysdef,
+                             GPUArray<unsigned int>& flags) const
+        {
+        const auto pdata = sysdef->getParticleData();
+        const auto tags = getSelectedTags(sysdef);
+
+        ArrayHandle<unsigned int> h_flags(flags, access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_rtag(pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        const unsigned int N = pdata->getN();
+        std::fill(h_flags.data, h_flags.data + N, 0);
+        for (auto tag : tags)
+            {
+            if (tag > pdata->getMaximumTag())
+                continue;
+
+            unsigned int idx = h_rtag.data[tag];
+            if (idx < N)
+                h_flags.data[idx] = 1;
+            }
+        }
+
+    protected:
+    /** Flag the members of a set operation on two filters.
+     *  Args:
+     *  sysdef: system definition
+     *  f: first filter
+     *  g: second filter
+     *  flags: membership flags (output)
+     *  other: scratch space for the flags of g
+     *  operation: set operation
+     */
+    static void flagSetMembers(std::shared_ptr<SystemDefinition> sysdef,
+                               const ParticleFilter& f,
+                               const ParticleFilter& g,
+                               GPUArray<unsigned int>& flags,
+                               GPUArray<unsigned int>& other,
+                               kernel::FlagOperation operation)
+        {
+        const auto pdata = sysdef->getParticleData();
+        const unsigned int N = pdata->getN();
+        if (other.getNumElements() < N)
+            {
+            GPUArray<unsigned int> new_other(pdata->getMaxN(), pdata->getExecConf());
+            other.swap(new_other);
+            }
+
+        f.flagMembers(sysdef, flags);
+        g.flagMembers(sysdef, other);
+
+#ifdef ENABLE_HIP
+        const auto exec_conf = pdata->getExecConf();
+        if (exec_conf->isCUDAEnabled())
+            {
+            ArrayHandle<unsigned int> d_flags(flags,
+                                              access_location::device,
+                                              access_mode::readwrite);
+            ArrayHandle<unsigned int> d_other(other, access_location::device, access_mode::read);
+            kernel::gpu_filter_combine_flags(N, d_flags.data, d_other.data, operation);
+            if (exec_conf->isCUDAErrorCheckingEnabled())
+                exec_conf->handleHIPError(hipDeviceSynchronize(), __FILE__, __LINE__);
+            return;
+            }
+#endif
+
+        ArrayHandle<unsigned int> h_flags(flags, access_location::host, access_mode::readwrite);
+        ArrayHandle<unsigned int> h_other(other, access_location::host, access_mode::read);
+        for (unsigned int idx = 0; idx < N; idx++)
+            {
+            const unsigned int flag = h_flags.data[idx];
+            const unsigned int g_flag = h_other.data[idx];
+            if (operation == kernel::FlagOperation::Intersection)
+                h_flags.data[idx] = flag && g_flag;
+            else if (operation == kernel::FlagOperation::Union)
+                h_flags.data[idx] = flag || g_flag;
+            else
+                h_flags.data[idx] = flag && !g_flag;
+            }
+        }
     };
 
     } // end namespace hoomd
@@ -91,25 +91,7 @@ class PYBIND11_EXPORT ParticleFilterRigid : public ParticleFilter
             {
             unsigned int tag = h_tag.data[idx];
 
-            // get position of particle
-            unsigned int body = h_body.data[idx];
-
-            // see if it matches the criteria
-            bool include_particle = false;
-            if (toBool(m_current_selection & RigidBodySelection::CENTERS))
-                {
-                include_particle = include_particle || (tag == body);
-                }
-            if (toBool(m_current_selection & RigidBodySelection::CONSTITUENT))
-                {
-                include_particle = include_particle || (body < MIN_FLOPPY && body != tag);
-                }
-            if (toBool(m_current_selection & RigidBodySelection::FREE))
-                {
-                include_particle = include_particle || (body == NO_BODY);
-                }
-
-            if (include_particle)
+            if (isSelected(tag, h_body.data[idx]))
                 {
                 member_tags.push_back(tag);
                 }
@@ -117,7 +99,72 @@ class PYBIND11_EXPORT ParticleFilterRigid : public ParticleFilter
         return member_tags;
         }
 
+    /// Test if flagMembers() evaluates the filter without getSelectedTags()
+    virtual bool canFlagMembers() const
+        {
+        return true;
+        }
+
+    /// Flag the rank local particles that meet the selection criteria
+    virtual void flagMembers(std::shared_ptr<SystemDefinition> sysdef,
+                             GPUArray<unsigned int>& flags) const
+        {
+        auto pdata = sysdef->getParticleData();
+        const unsigned int N = pdata->getN();
+
+#ifdef ENABLE_HIP
+        const auto exec_conf = pdata->getExecConf();
+        if (exec_conf->isCUDAEnabled())
+            {
+            ArrayHandle<unsigned int> d_tag(pdata->getTags(),
+                                            access_location::device,
+                                            access_mode::read);
+            ArrayHandle<unsigned int> d_body(pdata->getBodies(),
+                                             access_location::device,
+                                             access_mode::read);
+            ArrayHandle<unsigned int> d_flags(flags,
+                                              access_location::device,
+                                              access_mode::overwrite);
+            kernel::gpu_filter_flag_rigid(N,
+                                          d_tag.data,
+                                          d_body.data,
+                                          static_cast<unsigned int>(m_current_selection),
+                                          d_flags.data);
+            if (exec_conf->isCUDAErrorCheckingEnabled())
+                exec_conf->handleHIPError(hipDeviceSynchronize(), __FILE__, __LINE__);
+            return;
+            }
+#endif
+
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_body(pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_flags(flags, access_location::host, access_mode::overwrite);
+        for (unsigned int idx = 0; idx < N; ++idx)
+            h_flags.data[idx] = isSelected(h_tag.data[idx], h_body.data[idx]);
+        }
+
     private:
+    /// Test if the particle with the given tag and body id meets the selection criteria
+    bool isSelected(unsigned int tag, unsigned int body) const
+        {
+        bool include_particle = false;
+        if (toBool(m_current_selection & RigidBodySelection::CENTERS))
+            {
+            include_particle = include_particle || (tag == body);
+            }
+        if (toBool(m_current_selection & RigidBodySelection::CONSTITUENT))
+            {
+            include_particle = include_particle || (body < MIN_FLOPPY && body != tag);
+            }
+        if (toBool(m_current_selection & RigidBodySelection::FREE))
+            {
+            include_particle = include_particle || (body == NO_BODY);
+            }
+        return include_particle;
+        }
+
     /// Current selection of particles to chose from rigid body center, constituent particles,
     /// and free bodies.
     RigidBodySelection m_current_selection;
@@ -51,9 +51,23 @@ class PYBIND11_EXPORT ParticleFilterSetDifference : public ParticleFilter
         return tags;
         }
 
+    /// Test if flagMembers() evaluates the filter without getSelectedTags()
+    virtual bool canFlagMembers() const
+        {
+        return m_f->canFlagMembers() && m_g->canFlagMembers();
+        }
+
+    /// Flag the rank local particles that meet the selection criteria
+    virtual void flagMembers(std::shared_ptr<SystemDefinition> sysdef,
+                             GPUArray<unsigned int>& flags) const
+        {
+        flagSetMembers(sysdef, *m_f, *m_g, flags, m_g_flags, kernel::FlagOperation::Difference);
+        }
+
     protected:
     std::shared_ptr<ParticleFilter> m_f;
     std::shared_ptr<ParticleFilter> m_g;
+    mutable GPUArray<unsigned int> m_g_flags; //< Membership flags of m_g
     };
 
     } // end namespace hoomd
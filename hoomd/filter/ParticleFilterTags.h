@@ -5,6 +5,7 @@
 #define __PARTICLE_FILTER_TAGS_H__
 
 #include "ParticleFilter.h"
+#include <algorithm>
 #include <pybind11/numpy.h>
 
 namespace hoomd
@@ -43,8 +44,60 @@ class PYBIND11_EXPORT ParticleFilterTags : public ParticleFilter
         return m_tags;
         }
 
+    /// Test if flagMembers() evaluates the filter without getSelectedTags()
+    virtual bool canFlagMembers() const
+        {
+        return true;
+        }
+
+    /// Flag the rank local particles with tags in m_tags
+    virtual void flagMembers(std::shared_ptr<SystemDefinition> sysdef,
+                             GPUArray<unsigned int>& flags) const
+        {
+#ifdef ENABLE_HIP
+        const auto pdata = sysdef->getParticleData();
+        const auto exec_conf = pdata->getExecConf();
+        if (exec_conf->isCUDAEnabled())
+            {
+            // the tags do not change, copy them to the GPU once
+            if (m_tags_array.getNumElements() != m_tags.size())
+                {
+                GPUArray<unsigned int> tags_array(m_tags.size(), exec_conf);
+                m_tags_array.swap(tags_array);
+
+                ArrayHandle<unsigned int> h_tags(m_tags_array,
+                                                 access_location::host,
+                                                 access_mode::overwrite);
+                std::copy(m_tags.begin(), m_tags.end(), h_tags.data);
+                }
+
+            ArrayHandle<unsigned int> d_tags(m_tags_array,
+                                             access_location::device,
+                                             access_mode::read);
+            ArrayHandle<unsigned int> d_rtag(pdata->getRTags(),
+                                             access_location::device,
+                                             access_mode::read);
+            ArrayHandle<unsigned int> d_flags(flags,
+                                              access_location::device,
+                                              access_mode::overwrite);
+            kernel::gpu_filter_flag_tags(pdata->getN(),
+                                         (unsigned int)m_tags.size(),
+                                         d_tags.data,
+                                         d_rtag.data,
+                                         pdata->getMaximumTag(),
+                                         d_flags.data);
+            if (exec_conf->isCUDAErrorCheckingEnabled())
+                exec_conf->handleHIPError(hipDeviceSynchronize(), __FILE__, __LINE__);
+            return;
+            }
+#endif
+
+        ParticleFilter::flagMembers(sysdef, flags);
+        }
+
     protected:
-    std::vector<unsigned int> m_tags; //< Tags to use for filter
+    std::vector<unsigned int> m_tags;            //< Tags to use for filter
+    mutable GPUArray<unsigned int> m_tags_array; //< m_tags on the GPU
     };
 
     } // end namespace hoomd
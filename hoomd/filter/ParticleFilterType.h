@@ -45,12 +45,7 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
                                              access_location::host,
                                              access_mode::read);
 
-        // Get types as unsigned ints
-        std::unordered_set<unsigned int> types(m_types.size());
-        for (auto type_str : m_types)
-            {
-            types.insert(pdata->getTypeByName(type_str));
-            }
+        const std::vector<unsigned int> type_mask = getTypeMask(*pdata);
 
         // Add correctly typed particles to vector
         const auto N = pdata->getN();
@@ -59,7 +54,7 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
         for (unsigned int idx = 0; idx < N; ++idx)
             {
             unsigned int typ = __scalar_as_int(h_postype.data[idx].w);
-            if (types.count(typ))
+            if (type_mask[typ])
                 {
                 *tag_it = h_tag.data[idx];
                 tag_it++;
@@ -69,8 +64,75 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
         return member_tags;
         }
 
+    /// Test if flagMembers() evaluates the filter without getSelectedTags()
+    virtual bool canFlagMembers() const
+        {
+        return true;
+        }
+
+    /// Flag the rank local particles of types in m_types
+    virtual void flagMembers(std::shared_ptr<SystemDefinition> sysdef,
+                             GPUArray<unsigned int>& flags) const
+        {
+        const auto pdata = sysdef->getParticleData();
+        const std::vector<unsigned int> type_mask = getTypeMask(*pdata);
+        const unsigned int N = pdata->getN();
+
+#ifdef ENABLE_HIP
+        const auto exec_conf = pdata->getExecConf();
+        if (exec_conf->isCUDAEnabled())
+            {
+            if (m_type_mask.getNumElements() < type_mask.size())
+                {
+                GPUArray<unsigned int> new_type_mask(type_mask.size(), exec_conf);
+                m_type_mask.swap(new_type_mask);
+                }
+
+                {
+                ArrayHandle<unsigned int> h_type_mask(m_type_mask,
+                                                      access_location::host,
+                                                      access_mode::overwrite);
+                std::copy(type_mask.begin(), type_mask.end(), h_type_mask.data);
+                }
+
+            ArrayHandle<Scalar4> d_postype(pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::read);
+            ArrayHandle<unsigned int> d_type_mask(m_type_mask,
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<unsigned int> d_flags(flags,
+                                              access_location::device,
+                                              access_mode::overwrite);
+            kernel::gpu_filter_flag_types(N, d_postype.data, d_type_mask.data, d_flags.data);
+            if (exec_conf->isCUDAErrorCheckingEnabled())
+                exec_conf->handleHIPError(hipDeviceSynchronize(), __FILE__, __LINE__);
+            return;
+            }
+#endif
+
+        ArrayHandle<Scalar4> h_postype(pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> h_flags(flags, access_location::host, access_mode::overwrite);
+        for (unsigned int idx = 0; idx < N; ++idx)
+            h_flags.data[idx] = type_mask[__scalar_as_int(h_postype.data[idx].w)];
+        }
+
     protected:
-    std::unordered_set<std::string> m_types; ///< Set of types to select
+    /// Get 1 for each type in m_types and 0 for the other types, by type id
+    std::vector<unsigned int> getTypeMask(const ParticleData& pdata) const
+        {
+        std::vector<unsigned int> type_mask(pdata.getNTypes(), 0);
+        for (auto type_str : m_types)
+            {
+            type_mask[pdata.getTypeByName(type_str)] = 1;
+            }
+        return type_mask;
+        }
+
+    std::unordered_set<std::string> m_types;    ///< Set of types to select
+    mutable GPUArray<unsigned int> m_type_mask; ///< Type mask on the GPU
     };
 
     } // end namespace hoomd
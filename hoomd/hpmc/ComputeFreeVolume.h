@@ -122,7 +122,6 @@ template<class Shape> void ComputeFreeVolume<Shape>::compute(uint64_t timestep)
 template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t timestep)
     {
     unsigned int overlap_count = 0;
-    unsigned int err_count = 0;
     unsigned int ndim = this->m_sysdef->getNDimensions();
 
     this->m_exec_conf->msg->notice(5) << "HPMC computing free volume " << timestep << std::endl;
@@ -164,98 +163,118 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
         n_sample /= this->m_exec_conf->getNRanks();
 #endif
 
-        for (unsigned int i = 0; i < n_sample; i++)
+        // the samples are independent, count the overlaps separately in each thread
+        ThreadPool& pool = m_exec_conf->getThreadPool();
+        std::vector<unsigned int> overlap_count_thread(pool.getNumThreads(), 0);
+
+        pool.parallelFor(
+            n_sample,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
             {
-            // select a random particle coordinate in the box
-            hoomd::RandomGenerator rng_i(
-                hoomd::Seed(hoomd::RNGIdentifier::ComputeFreeVolume, timestep, seed),
-                hoomd::Counter(m_exec_conf->getRank(), i));
-
-            Scalar xrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
-            Scalar yrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
-            Scalar zrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
-            if (this->m_sysdef->getNDimensions() == 2)
-                {
-                zrand = 0;
-                }
-            Scalar3 f = make_scalar3(xrand, yrand, zrand);
-            vec3<Scalar> pos_i = vec3<Scalar>(box.makeCoordinates(f));
-
-            Shape shape_i(quat<Scalar>(), params[m_type]);
-            if (shape_i.hasOrientation())
-                {
-                shape_i.orientation = generateRandomOrientation(rng_i, ndim);
-                }
-
-            // check for overlaps with particles in the system state
-            bool overlap = false;
-            hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
-
-            // All image boxes (including the primary)
-            const unsigned int n_images = (unsigned int)image_list.size();
-            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-                {
-                vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
-                hoomd::detail::AABB aabb = aabb_i_local;
-                aabb.translate(pos_i_image);
-
-                // stackless search
-                for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
-                     cur_node_idx++)
+                unsigned int n_overlap = 0;
+                unsigned int err_count = 0;
+
+                for (unsigned int i = begin; i < end; i++)
                     {
-                    if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
+                    // select a random particle coordinate in the box
+                    hoomd::RandomGenerator rng_i(
+                        hoomd::Seed(hoomd::RNGIdentifier::ComputeFreeVolume, timestep, seed),
+                        hoomd::Counter(m_exec_conf->getRank(), i));
+
+                    Scalar xrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
+                    Scalar yrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
+                    Scalar zrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
+                    if (this->m_sysdef->getNDimensions() == 2)
                         {
-                        if (aabb_tree.isNodeLeaf(cur_node_idx))
-                            {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
-                                 cur_p++)
-                                {
-                                // read in its position and orientation
-                                unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
-
-                                Scalar4 postype_j;
-                                Scalar4 orientation_j;
+                        zrand = 0;
+                        }
+                    Scalar3 f = make_scalar3(xrand, yrand, zrand);
+                    vec3<Scalar> pos_i = vec3<Scalar>(box.makeCoordinates(f));
 
-                                // load the position and orientation of the j particle
-                                postype_j = h_postype.data[j];
-                                orientation_j = h_orientation.data[j];
+                    Shape shape_i(quat<Scalar>(), params[m_type]);
+                    if (shape_i.hasOrientation())
+                        {
+                        shape_i.orientation = generateRandomOrientation(rng_i, ndim);
+                        }
 
-                                // put particles in coordinate system of particle i
-                                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                    // check for overlaps with particles in the system state
+                    bool overlap = false;
+                    hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
 
-                                unsigned int typ_j = __scalar_as_int(postype_j.w);
-                                Shape shape_j(quat<Scalar>(orientation_j), params[typ_j]);
+                    // All image boxes (including the primary)
+                    const unsigned int n_images = (unsigned int)image_list.size();
+                    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                        {
+                        vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
+                        hoomd::detail::AABB aabb = aabb_i_local;
+                        aabb.translate(pos_i_image);
 
-                                if (h_overlaps.data[overlap_idx(m_type, typ_j)]
-                                    && check_circumsphere_overlap(r_ij, shape_i, shape_j)
-                                    && test_overlap(r_ij, shape_i, shape_j, err_count))
+                        // stackless search
+                        for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
+                             cur_node_idx++)
+                            {
+                            if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
+                                {
+                                if (aabb_tree.isNodeLeaf(cur_node_idx))
                                     {
-                                    overlap = true;
-                                    break;
+                                    for (unsigned int cur_p = 0;
+                                         cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
+                                         cur_p++)
+                                        {
+                                        // read in its position and orientation
+                                        unsigned int j
+                                            = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                                        Scalar4 postype_j;
+                                        Scalar4 orientation_j;
+
+                                        // load the position and orientation of the j particle
+                                        postype_j = h_postype.data[j];
+                                        orientation_j = h_orientation.data[j];
+
+                                        // put particles in coordinate system of particle i
+                                        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+
+                                        unsigned int typ_j = __scalar_as_int(postype_j.w);
+                                        Shape shape_j(quat<Scalar>(orientation_j), params[typ_j]);
+
+                                        if (h_overlaps.data[overlap_idx(m_type, typ_j)]
+                                            && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                                            && test_overlap(r_ij, shape_i, shape_j, err_count))
+                                            {
+                                            overlap = true;
+                                            break;
+                                            }
+                                        }
                                     }
                                 }
-                            }
-                        }
-                    else
+                            else
+                                {
+                                // skip ahead
+                                cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                                }
+
+                            if (overlap)
+                                break;
+                            } // end loop over AABB nodes
+
+                        if (overlap)
+                            break;
+                        } // end loop over images
+
+                    if (overlap)
                         {
-                        // skip ahead
-                        cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                        n_overlap++;
                         }
+                    } // end loop through all particles
 
-                    if (overlap)
-                        break;
-                    } // end loop over AABB nodes
-
-                if (overlap)
-                    break;
-                } // end loop over images
-
-            if (overlap)
-                {
-                overlap_count++;
-                }
-            } // end loop through all particles
+                overlap_count_thread[thread_id] = n_overlap;
+            });
+
+        for (unsigned int n_overlap : overlap_count_thread)
+            {
+            overlap_count += n_overlap;
+            }
 
         } // end lexical scope
 
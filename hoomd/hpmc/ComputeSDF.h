@@ -24,7 +24,11 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include <exception>
+#include <memory>
 #include <pybind11/pybind11.h>
+#include <thread>
+#include <vector>
 
 namespace hoomd
     {
@@ -100,6 +104,16 @@ bool test_scaled_overlap(const vec3<Scalar>& r_ij,
     connection is also used to get the maximum particle diameter for an input into the cell list
     size.
 
+    \b Asynchronous mode <br>
+
+    In asynchronous mode, compute() copies the local and ghost particles, the box images and the
+    shape parameters, then counts the histogram on a background thread (with its own thread pool)
+    and returns. The simulation continues, so on the GPU the count overlaps the following time
+    steps. The next call to compute() waits for the count, reduces it, and starts the next one:
+    the reported sdf is one compute behind the current configuration. The first compute after
+    enabling the mode counts synchronously. Integrators with pair interactions always count
+    synchronously because the count evaluates the pair potentials owned by the integrator.
+
     \ingroup hpmc_computes
 */
 template<class Shape> class ComputeSDF : public Compute
@@ -115,7 +129,10 @@ template<class Shape> class ComputeSDF : public Compute
                double dx);
 
     //! Destructor
-    virtual ~ComputeSDF() { };
+    virtual ~ComputeSDF()
+        {
+        cancelHistogram();
+        }
 
     //! Get the maximum value in the rightmost histogram bin
     double getXMax()
@@ -127,6 +144,7 @@ template<class Shape> class ComputeSDF : public Compute
     //! \param xmax maximum value in the rightmost histogram bin
     void setXMax(double xmax)
         {
+        cancelHistogram();
         m_xmax = xmax;
         }
 
@@ -140,6 +158,7 @@ template<class Shape> class ComputeSDF : public Compute
     //! \param dx histogram bin width
     void setDx(double dx)
         {
+        cancelHistogram();
         m_dx = dx;
         }
 
@@ -150,6 +169,21 @@ template<class Shape> class ComputeSDF : public Compute
         return m_hist_compression.size();
         }
 
+    //! Set whether the histogram is counted on a background thread
+    void setAsynchronous(bool asynchronous)
+        {
+        cancelHistogram();
+        m_asynchronous = asynchronous;
+        if (!asynchronous)
+            m_async_pool.reset();
+        }
+
+    //! Get whether the histogram is counted on a background thread
+    bool getAsynchronous()
+        {
+        return m_asynchronous;
+        }
+
     //! Analyze the current configuration
     virtual void compute(uint64_t timestep);
 
@@ -172,13 +206,57 @@ template<class Shape> class ComputeSDF : public Compute
     Scalar getMaxInteractionDiameter();
     Scalar m_last_max_diam; //!< Last recorded maximum diameter
 
+    //! Particle data and search structures read by countHistogram()
+    struct HistogramInput
+        {
+        unsigned int N;                              //!< Number of local particles
+        const Scalar4* postype;                      //!< Positions and types (with ghosts)
+        const Scalar4* orientation;                  //!< Orientations (with ghosts)
+        const Scalar* diameter;                      //!< Diameters (with ghosts)
+        const Scalar* charge;                        //!< Charges (with ghosts)
+        const param_type* params;                    //!< Shape parameters of each type
+        const hoomd::detail::AABBTree* aabb_tree;    //!< Tree of the particle AABBs
+        const std::vector<vec3<Scalar>>* image_list; //!< Box images to search
+        const LongReal* pair_energy_search_radius;   //!< Pair search radius of each type
+        LongReal min_core_radius;                    //!< Smallest shape core radius
+        Scalar max_diam;                             //!< Maximum interaction diameter
+        Scalar kT;                                   //!< Temperature of the pair weights
+        bool pair_interactions;                      //!< True when the integrator has pairs
+        };
+
     //! Zero the histogram counts
     void zeroHistogram();
 
     //! Add to histogram counts
-    void countHistogram(uint64_t timestep);
-    void countHistogramBinarySearch(uint64_t timestep);
-    void countHistogramLinearSearch(uint64_t timestep);
+    void countHistogram(const HistogramInput& input, ThreadPool& pool);
+    void countHistogramBinarySearch(const HistogramInput& input, ThreadPool& pool);
+    void countHistogramLinearSearch(const HistogramInput& input, ThreadPool& pool);
+
+    //! Reduce the histogram counts over the ranks and normalize them into the sdf
+    void normalizeHistogram();
+
+    bool m_asynchronous = false;                    //!< True when counting on a background thread
+    std::unique_ptr<ThreadPool> m_async_pool;       //!< Thread pool of the background count
+    std::thread m_count_thread;                     //!< Background thread counting the histogram
+    std::exception_ptr m_count_exception;           //!< Error raised on the background thread
+    std::vector<Scalar4> m_async_postype;           //!< Copy of the positions and types
+    std::vector<Scalar4> m_async_orientation;       //!< Copy of the orientations
+    std::vector<Scalar> m_async_diameter;           //!< Copy of the diameters
+    std::vector<Scalar> m_async_charge;             //!< Copy of the charges
+    std::vector<param_type> m_async_params;         //!< Copy of the shape parameters
+    std::vector<vec3<Scalar>> m_async_image_list;   //!< Copy of the box images
+    std::vector<LongReal> m_async_search_radius;    //!< Copy of the pair search radii
+    std::vector<hoomd::detail::AABB> m_async_aabbs; //!< AABBs of the copied particles
+    hoomd::detail::AABBTree m_async_aabb_tree;      //!< Tree of the copied particles
+
+    //! Copy the configuration and start counting the histogram on the background thread
+    void startHistogram(uint64_t timestep);
+
+    //! Wait for the background count and normalize it into the sdf
+    void finishHistogram();
+
+    //! Wait for the background count and discard it
+    void cancelHistogram();
 
     //! Determine the s bin of a given particle pair; only used for the binary search
     size_t computeBin(const vec3<Scalar>& r_ij,
@@ -238,6 +316,18 @@ template<class Shape> void ComputeSDF<Shape>::compute(uint64_t timestep)
     // update ghost layers
     m_mc->communicate(false);
 
+    if (m_asynchronous && !m_mc->hasPairInteractions())
+        {
+        // report the previous count while the next one runs
+        bool have_previous = m_count_thread.joinable();
+        finishHistogram();
+        startHistogram(timestep);
+        if (!have_previous)
+            finishHistogram();
+        return;
+        }
+
+    cancelHistogram();
     this->computeSDF(timestep);
     }
 
@@ -247,8 +337,150 @@ template<class Shape> void ComputeSDF<Shape>::computeSDF(uint64_t timestep)
     {
     zeroHistogram();
 
-    countHistogram(timestep);
+    // build the tree before accessing the particle data
+    const hoomd::detail::AABBTree& aabb_tree = m_mc->buildAABBTree();
+    const std::vector<vec3<Scalar>>& image_list = m_mc->updateImageList();
+    const std::vector<LongReal>& pair_energy_search_radius = m_mc->getPairEnergySearchRadius();
 
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                     access_location::host,
+                                     access_mode::read);
+
+        HistogramInput input;
+        input.N = m_pdata->getN();
+        input.postype = h_postype.data;
+        input.orientation = h_orientation.data;
+        input.diameter = h_diameter.data;
+        input.charge = h_charge.data;
+        input.params = m_mc->getParams().data();
+        input.aabb_tree = &aabb_tree;
+        input.image_list = &image_list;
+        input.pair_energy_search_radius = pair_energy_search_radius.data();
+        input.min_core_radius = m_mc->getMinCoreDiameter() * LongReal(0.5);
+        input.max_diam = m_last_max_diam;
+        input.kT = (*m_mc->getKT())(timestep);
+        input.pair_interactions = m_mc->hasPairInteractions();
+        countHistogram(input, m_exec_conf->getThreadPool());
+        }
+
+    normalizeHistogram();
+    }
+
+/*! \param timestep Current time step
+
+    The copies hold the local and ghost particles. The background thread builds its own AABB tree
+    so that it never reads structures that the integrator modifies in the following steps.
+*/
+template<class Shape> void ComputeSDF<Shape>::startHistogram(uint64_t timestep)
+    {
+    zeroHistogram();
+
+    const unsigned int n_total = m_pdata->getN() + m_pdata->getNGhosts();
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                     access_location::host,
+                                     access_mode::read);
+        m_async_postype.assign(h_postype.data, h_postype.data + n_total);
+        m_async_orientation.assign(h_orientation.data, h_orientation.data + n_total);
+        m_async_diameter.assign(h_diameter.data, h_diameter.data + n_total);
+        m_async_charge.assign(h_charge.data, h_charge.data + n_total);
+        }
+
+    const auto& params = m_mc->getParams();
+    m_async_params.assign(params.begin(), params.end());
+    m_async_image_list = m_mc->updateImageList();
+    m_async_search_radius = m_mc->getPairEnergySearchRadius();
+
+    HistogramInput input;
+    input.N = m_pdata->getN();
+    input.postype = m_async_postype.data();
+    input.orientation = m_async_orientation.data();
+    input.diameter = m_async_diameter.data();
+    input.charge = m_async_charge.data();
+    input.params = m_async_params.data();
+    input.aabb_tree = &m_async_aabb_tree;
+    input.image_list = &m_async_image_list;
+    input.pair_energy_search_radius = m_async_search_radius.data();
+    input.min_core_radius = m_mc->getMinCoreDiameter() * LongReal(0.5);
+    input.max_diam = m_last_max_diam;
+    input.kT = (*m_mc->getKT())(timestep);
+    input.pair_interactions = false;
+
+    if (!m_async_pool)
+        m_async_pool = std::make_unique<ThreadPool>(m_exec_conf->getThreadPool().getNumThreads());
+
+    m_count_thread = std::thread(
+        [this, input, n_total]()
+        {
+            try
+                {
+                m_async_aabbs.resize(n_total);
+                for (unsigned int i = 0; i < n_total; i++)
+                    {
+                    Shape shape(quat<Scalar>(input.orientation[i]),
+                                input.params[__scalar_as_int(input.postype[i].w)]);
+                    m_async_aabbs[i] = shape.getAABB(vec3<Scalar>(input.postype[i]));
+                    }
+                if (n_total > 0)
+                    m_async_aabb_tree.buildTree(m_async_aabbs.data(), n_total);
+
+                countHistogram(input, *m_async_pool);
+                }
+            catch (...)
+                {
+                m_count_exception = std::current_exception();
+                }
+        });
+    }
+
+/*! Rethrows the error raised on the background thread.
+ */
+template<class Shape> void ComputeSDF<Shape>::finishHistogram()
+    {
+    if (!m_count_thread.joinable())
+        return;
+
+    m_count_thread.join();
+    if (m_count_exception)
+        {
+        std::exception_ptr e = m_count_exception;
+        m_count_exception = nullptr;
+        std::rethrow_exception(e);
+        }
+
+    normalizeHistogram();
+    }
+
+template<class Shape> void ComputeSDF<Shape>::cancelHistogram()
+    {
+    if (m_count_thread.joinable())
+        m_count_thread.join();
+    m_count_exception = nullptr;
+    }
+
+/*! Collective over the ranks of a domain decomposed simulation.
+ */
+template<class Shape> void ComputeSDF<Shape>::normalizeHistogram()
+    {
     std::vector<double> hist_total(m_hist_compression);
     std::vector<double> hist_total_expansion(m_hist_expansion);
 
@@ -349,144 +581,145 @@ template<class Shape> Scalar ComputeSDF<Shape>::getMaxInteractionDiameter()
     This function is a wrapper that calls the appropriate method depending on whether a binary or
     linear search is required.
 */
-template<class Shape> void ComputeSDF<Shape>::countHistogram(uint64_t timestep)
+template<class Shape>
+void ComputeSDF<Shape>::countHistogram(const HistogramInput& input, ThreadPool& pool)
     {
-    if (m_mc->hasPairInteractions() || m_shape_requires_expansion_moves)
+    if (input.pair_interactions || m_shape_requires_expansion_moves)
         {
-        countHistogramLinearSearch(timestep);
+        countHistogramLinearSearch(input, pool);
         }
     else
         {
-        countHistogramBinarySearch(timestep);
+        countHistogramBinarySearch(input, pool);
         }
     } // end countHistogram()
 
-template<class Shape> void ComputeSDF<Shape>::countHistogramBinarySearch(uint64_t timestep)
+template<class Shape>
+void ComputeSDF<Shape>::countHistogramBinarySearch(const HistogramInput& input, ThreadPool& pool)
     {
-    // update the aabb tree
-    const hoomd::detail::AABBTree& aabb_tree = m_mc->buildAABBTree();
+    const hoomd::detail::AABBTree& aabb_tree = *input.aabb_tree;
+    const std::vector<vec3<Scalar>>& image_list = *input.image_list;
 
-    // update the image list
-    const std::vector<vec3<Scalar>>& image_list = m_mc->updateImageList();
+    Scalar extra_width = m_xmax / (1 - m_xmax) * input.max_diam;
 
-    Scalar extra_width = m_xmax / (1 - m_xmax) * m_last_max_diam;
+    const Scalar4* h_postype = input.postype;
+    const Scalar4* h_orientation = input.orientation;
+    const param_type* params = input.params;
 
-    // access particle data and system box
-    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
-    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                       access_location::host,
-                                       access_mode::read);
-    const std::vector<param_type, hoomd::detail::managed_allocator<param_type>>& params
-        = m_mc->getParams();
+    // loop through N particles, each thread accumulates its own histogram
+    std::vector<std::vector<double>> hist(pool.getNumThreads(),
+                                          std::vector<double>(m_hist_compression.size(), 0.0));
 
-    // loop through N particles
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    pool.parallelFor(
+        input.N,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        size_t min_bin = m_hist_compression.size();
-        // read in the current position and orientation
-        Scalar4 postype_i = h_postype.data[i];
-        const quat<LongReal> orientation_i(h_orientation.data[i]);
-        Shape shape_i(orientation_i, params[__scalar_as_int(postype_i.w)]);
-        vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
-
-        // construct the AABB around the particle's circumsphere
-        // pad with enough extra width so that when scaled by xmax, found particles might touch
-        hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0, 0, 0),
-                                         shape_i.getCircumsphereDiameter() / Scalar(2)
-                                             + extra_width);
-
-        size_t n_images = image_list.size();
-        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-            {
-            vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
-            hoomd::detail::AABB aabb = aabb_i_local;
-            aabb.translate(pos_i_image);
-
-            // stackless search
-            for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
-                 cur_node_idx++)
+            for (unsigned int i = begin; i < end; i++)
                 {
-                if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
+                size_t min_bin = m_hist_compression.size();
+                // read in the current position and orientation
+                Scalar4 postype_i = h_postype[i];
+                const quat<LongReal> orientation_i(h_orientation[i]);
+                Shape shape_i(orientation_i, params[__scalar_as_int(postype_i.w)]);
+                vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+                // construct the AABB around the particle's circumsphere
+                // pad with enough extra width so that when scaled by xmax, found particles might
+                // touch
+                hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0, 0, 0),
+                                                 shape_i.getCircumsphereDiameter() / Scalar(2)
+                                                     + extra_width);
+
+                size_t n_images = image_list.size();
+                for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                     {
-                    if (aabb_tree.isNodeLeaf(cur_node_idx))
+                    vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
+                    hoomd::detail::AABB aabb = aabb_i_local;
+                    aabb.translate(pos_i_image);
+
+                    // stackless search
+                    for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
+                         cur_node_idx++)
                         {
-                        for (unsigned int cur_p = 0;
-                             cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
-                             cur_p++)
+                        if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
                             {
-                            // read in its position and orientation
-                            unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+                            if (aabb_tree.isNodeLeaf(cur_node_idx))
+                                {
+                                for (unsigned int cur_p = 0;
+                                     cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
+                                     cur_p++)
+                                    {
+                                    // read in its position and orientation
+                                    unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
-                            // skip i==j in the 0 image
-                            if (cur_image == 0 && i == j)
-                                continue;
+                                    // skip i==j in the 0 image
+                                    if (cur_image == 0 && i == j)
+                                        continue;
 
-                            Scalar4 postype_j = h_postype.data[j];
-                            const quat<LongReal> orientation_j(h_orientation.data[j]);
+                                    Scalar4 postype_j = h_postype[j];
+                                    const quat<LongReal> orientation_j(h_orientation[j]);
 
-                            // put particles in coordinate system of particle i
-                            vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                                    // put particles in coordinate system of particle i
+                                    vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
 
-                            size_t bin = computeBin(r_ij,
-                                                    orientation_i,
-                                                    orientation_j,
-                                                    params[__scalar_as_int(postype_i.w)],
-                                                    params[__scalar_as_int(postype_j.w)]);
+                                    size_t bin = computeBin(r_ij,
+                                                            orientation_i,
+                                                            orientation_j,
+                                                            params[__scalar_as_int(postype_i.w)],
+                                                            params[__scalar_as_int(postype_j.w)]);
 
-                            if (bin >= 0)
-                                {
-                                min_bin = std::min(min_bin, bin);
+                                    if (bin >= 0)
+                                        {
+                                        min_bin = std::min(min_bin, bin);
+                                        }
+                                    }
                                 }
                             }
-                        }
-                    }
-                else
+                        else
+                            {
+                            // skip ahead
+                            cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                            }
+                        } // end loop over AABB nodes
+                    } // end loop over images
+                if (min_bin < hist[thread_id].size())
                     {
-                    // skip ahead
-                    cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                    hist[thread_id][min_bin]++;
                     }
-                } // end loop over AABB nodes
-            } // end loop over images
-        if (min_bin < m_hist_compression.size())
+                } // end loop over all particles
+        });
+
+    // sum the per-thread histograms in a fixed order
+    for (const auto& hist_thread : hist)
+        {
+        for (size_t bin = 0; bin < m_hist_compression.size(); bin++)
             {
-            m_hist_compression[min_bin]++;
+            m_hist_compression[bin] += hist_thread[bin];
             }
-        } // end loop over all particles
+        }
     } // end countHistogramBinarySearch()
 
-template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_t timestep)
+template<class Shape>
+void ComputeSDF<Shape>::countHistogramLinearSearch(const HistogramInput& input, ThreadPool& pool)
     {
-    // update the aabb tree
-    const hoomd::detail::AABBTree& aabb_tree = m_mc->buildAABBTree();
-
-    // update the image list
-    const std::vector<vec3<Scalar>>& image_list = m_mc->updateImageList();
+    const hoomd::detail::AABBTree& aabb_tree = *input.aabb_tree;
+    const std::vector<vec3<Scalar>>& image_list = *input.image_list;
 
     // Note - If needed for future simulations with a large disparity in additive cutoffs, compute
     // extra_width_i with knowledge of the additive cutoff of type i and half the largest additive
     // cutoff.
-    Scalar extra_width = m_xmax / (1 - m_xmax) * m_last_max_diam;
+    Scalar extra_width = m_xmax / (1 - m_xmax) * input.max_diam;
 
-    // access particle data and system box
-    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
-    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                       access_location::host,
-                                       access_mode::read);
-    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
-                                   access_location::host,
-                                   access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
-    const auto& params = m_mc->getParams();
-
-    // precompute constants used many times in the loop
-    const LongReal min_core_radius = m_mc->getMinCoreDiameter() * LongReal(0.5);
-    const auto& pair_energy_search_radius = m_mc->getPairEnergySearchRadius();
+    const Scalar4* h_postype = input.postype;
+    const Scalar4* h_orientation = input.orientation;
+    const Scalar* h_diameter = input.diameter;
+    const Scalar* h_charge = input.charge;
+    const param_type* params = input.params;
 
-    const Scalar kT = (*m_mc->getKT())(timestep);
+    // constants used many times in the loop
+    const LongReal min_core_radius = input.min_core_radius;
+    const LongReal* pair_energy_search_radius = input.pair_energy_search_radius;
+    const Scalar kT = input.kT;
 
     // loop through N particles
     // At the top of this loop, we initialize min_bin to the size of the sdf histogram
@@ -495,212 +728,245 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_
     // up to the minimum bin that we've already found for particle i.
     // Then we add to m_hist_compression[min_bin] the negative Mayer-function corresponding to the
     // type of overlap corresponding to particle i's first overlap.
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    std::vector<std::vector<double>> hist_compression(
+        pool.getNumThreads(),
+        std::vector<double>(m_hist_compression.size(), 0.0));
+    std::vector<std::vector<double>> hist_expansion(
+        pool.getNumThreads(),
+        std::vector<double>(m_hist_expansion.size(), 0.0));
+
+    pool.parallelFor(
+        input.N,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        size_t min_bin_compression = m_hist_compression.size();
-        size_t min_bin_expansion = m_hist_expansion.size();
-        double hist_weight_ptl_i_compression = 2.0;
-        double hist_weight_ptl_i_expansion = 2.0;
-
-        // read in the current position and orientation
-        const Scalar4 postype_i = h_postype.data[i];
-        const quat<LongReal> orientation_i(h_orientation.data[i]);
-        const int typ_i = __scalar_as_int(postype_i.w);
-        const Shape shape_i(orientation_i, params[__scalar_as_int(postype_i.w)]);
-        const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
-
-        // construct the AABB around the particle's circumsphere
-        // pad with enough extra width so that when scaled by xmax, found particles might touch
-        const LongReal R_query = std::max(shape_i.getCircumsphereDiameter() * LongReal(0.5),
-                                          pair_energy_search_radius[typ_i] - min_core_radius);
-        hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0, 0, 0), R_query + extra_width);
-
-        const size_t n_images = image_list.size();
-        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-            {
-            vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
-            hoomd::detail::AABB aabb = aabb_i_local;
-            aabb.translate(pos_i_image);
-
-            // stackless search
-            for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
-                 cur_node_idx++)
+            for (unsigned int i = begin; i < end; i++)
                 {
-                if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
+                size_t min_bin_compression = m_hist_compression.size();
+                size_t min_bin_expansion = m_hist_expansion.size();
+                double hist_weight_ptl_i_compression = 2.0;
+                double hist_weight_ptl_i_expansion = 2.0;
+
+                // read in the current position and orientation
+                const Scalar4 postype_i = h_postype[i];
+                const quat<LongReal> orientation_i(h_orientation[i]);
+                const int typ_i = __scalar_as_int(postype_i.w);
+                const Shape shape_i(orientation_i, params[__scalar_as_int(postype_i.w)]);
+                const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+                // construct the AABB around the particle's circumsphere
+                // pad with enough extra width so that when scaled by xmax, found particles might
+                // touch
+                const LongReal R_query
+                    = std::max(shape_i.getCircumsphereDiameter() * LongReal(0.5),
+                               pair_energy_search_radius[typ_i] - min_core_radius);
+                hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0, 0, 0), R_query + extra_width);
+
+                const size_t n_images = image_list.size();
+                for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                     {
-                    if (aabb_tree.isNodeLeaf(cur_node_idx))
+                    vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
+                    hoomd::detail::AABB aabb = aabb_i_local;
+                    aabb.translate(pos_i_image);
+
+                    // stackless search
+                    for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
+                         cur_node_idx++)
                         {
-                        for (unsigned int cur_p = 0;
-                             cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
-                             cur_p++)
+                        if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
                             {
-                            // read in its position and orientation
-                            unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
-
-                            // skip i==j in the 0 image
-                            if (cur_image == 0 && i == j)
-                                {
-                                continue;
-                                }
-
-                            const Scalar4 postype_j = h_postype.data[j];
-                            const quat<LongReal> orientation_j(h_orientation.data[j]);
-                            const int typ_j = __scalar_as_int(postype_j.w);
-
-                            // put particles in coordinate system of particle i
-                            const vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
-
-                            double u_ij_0 = 0.0; // energy of pair interaction in unperturbed state
-                            u_ij_0 = m_mc->computeOnePairEnergy(dot(r_ij, r_ij),
-                                                                r_ij,
-                                                                typ_i,
-                                                                shape_i.orientation,
-                                                                h_diameter.data[i],
-                                                                h_charge.data[i],
-                                                                typ_j,
-                                                                orientation_j,
-                                                                h_diameter.data[j],
-                                                                h_charge.data[j]);
-
-                            // first do compressions
-                            for (size_t bin_to_sample = 0; bin_to_sample < min_bin_compression;
-                                 bin_to_sample++)
+                            if (aabb_tree.isNodeLeaf(cur_node_idx))
                                 {
-                                const double scale_factor
-                                    = m_dx * static_cast<double>(bin_to_sample + 1);
-
-                                // check for hard overlaps
-                                // if there is one for a given scale value, there is no need to
-                                // check for any soft overlaps from the pair potentials
-                                bool hard_overlap = detail::test_scaled_overlap<Shape>(
-                                    r_ij,
-                                    orientation_i,
-                                    orientation_j,
-                                    params[__scalar_as_int(postype_i.w)],
-                                    params[__scalar_as_int(postype_j.w)],
-                                    scale_factor);
-                                if (hard_overlap)
+                                for (unsigned int cur_p = 0;
+                                     cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
+                                     cur_p++)
                                     {
-                                    hist_weight_ptl_i_compression = 1.0; // = 1-e^(-\infty)
-                                    min_bin_compression = bin_to_sample;
-                                    } // end if (hard_overlap)
+                                    // read in its position and orientation
+                                    unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
-                                // if no hard overlap, check for a soft overlap if we have
-                                // patches
-                                if (!hard_overlap)
-                                    {
-                                    // compute the energy at this size of the perturbation and
-                                    // compare to the energy in the unperturbed state
-                                    const vec3<Scalar> r_ij_scaled
-                                        = r_ij * (Scalar(1.0) - scale_factor);
-                                    double u_ij_new
-                                        = m_mc->computeOnePairEnergy(dot(r_ij_scaled, r_ij_scaled),
-                                                                     r_ij_scaled,
-                                                                     typ_i,
-                                                                     shape_i.orientation,
-                                                                     h_diameter.data[i],
-                                                                     h_charge.data[i],
-                                                                     typ_j,
-                                                                     orientation_j,
-                                                                     h_diameter.data[j],
-                                                                     h_charge.data[j]);
-                                    // if energy has changed, there is a new soft overlap
-                                    // add the appropriate weight to the appropriate bin of the
-                                    // histogram and break out of the loop over bins
-                                    if (u_ij_new != u_ij_0)
+                                    // skip i==j in the 0 image
+                                    if (cur_image == 0 && i == j)
                                         {
-                                        min_bin_compression = bin_to_sample;
-                                        if (u_ij_new < u_ij_0)
-                                            {
-                                            hist_weight_ptl_i_compression = 0;
-                                            }
-                                        else
-                                            {
-                                            hist_weight_ptl_i_compression
-                                                = 1.0 - fast::exp(-(u_ij_new - u_ij_0) / kT);
-                                            }
+                                        continue;
                                         }
-                                    } // end if (!hard_overlap)
-                                } // end loop over bins for compression
 
-                            // do expansions
-                            for (size_t bin_to_sample = 0; bin_to_sample < min_bin_expansion;
-                                 bin_to_sample++)
-                                {
-                                const double scale_factor
-                                    = -m_dx * static_cast<double>(bin_to_sample + 1);
-
-                                // check for hard overlaps
-                                // if there is one for a given scale value, there is no need to
-                                // check for any soft overlaps from the pair potentials
-                                bool hard_overlap = detail::test_scaled_overlap<Shape>(
-                                    r_ij,
-                                    orientation_i,
-                                    orientation_j,
-                                    params[__scalar_as_int(postype_i.w)],
-                                    params[__scalar_as_int(postype_j.w)],
-                                    scale_factor);
-                                if (hard_overlap)
-                                    {
-                                    hist_weight_ptl_i_expansion = 1.0; // = 1-e^(-\infty)
-                                    min_bin_expansion = bin_to_sample;
-                                    } // end if (hard_overlap)
+                                    const Scalar4 postype_j = h_postype[j];
+                                    const quat<LongReal> orientation_j(h_orientation[j]);
+                                    const int typ_j = __scalar_as_int(postype_j.w);
+
+                                    // put particles in coordinate system of particle i
+                                    const vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+
+                                    // energy of pair interaction in unperturbed state
+                                    double u_ij_0 = 0.0;
+                                    u_ij_0 = m_mc->computeOnePairEnergy(dot(r_ij, r_ij),
+                                                                        r_ij,
+                                                                        typ_i,
+                                                                        shape_i.orientation,
+                                                                        h_diameter[i],
+                                                                        h_charge[i],
+                                                                        typ_j,
+                                                                        orientation_j,
+                                                                        h_diameter[j],
+                                                                        h_charge[j]);
+
+                                    // first do compressions
+                                    for (size_t bin_to_sample = 0;
+                                         bin_to_sample < min_bin_compression;
+                                         bin_to_sample++)
+                                        {
+                                        const double scale_factor
+                                            = m_dx * static_cast<double>(bin_to_sample + 1);
+
+                                        // check for hard overlaps
+                                        // if there is one for a given scale value, there is no need
+                                        // to check for any soft overlaps from the pair potentials
+                                        bool hard_overlap = detail::test_scaled_overlap<Shape>(
+                                            r_ij,
+                                            orientation_i,
+                                            orientation_j,
+                                            params[__scalar_as_int(postype_i.w)],
+                                            params[__scalar_as_int(postype_j.w)],
+                                            scale_factor);
+                                        if (hard_overlap)
+                                            {
+                                            hist_weight_ptl_i_compression = 1.0; // = 1-e^(-\infty)
+                                            min_bin_compression = bin_to_sample;
+                                            } // end if (hard_overlap)
 
-                                // if no hard overlap, check for a soft overlap if necessary
-                                if (!hard_overlap)
-                                    {
-                                    // compute the energy at this size of the perturbation and
-                                    // compare to the energy in the unperturbed state
-                                    const vec3<Scalar> r_ij_scaled
-                                        = r_ij * (Scalar(1.0) - scale_factor);
-                                    double u_ij_new
-                                        = m_mc->computeOnePairEnergy(dot(r_ij_scaled, r_ij_scaled),
-                                                                     r_ij_scaled,
-                                                                     typ_i,
-                                                                     shape_i.orientation,
-                                                                     h_diameter.data[i],
-                                                                     h_charge.data[i],
-                                                                     typ_j,
-                                                                     orientation_j,
-                                                                     h_diameter.data[j],
-                                                                     h_charge.data[j]);
-                                    // if energy has changed, there is a new soft overlap
-                                    // add the appropriate weight to the appropriate bin of the
-                                    // histogram and break out of the loop over bins
-                                    if (u_ij_new != u_ij_0)
+                                        // if no hard overlap, check for a soft overlap if we have
+                                        // patches
+                                        if (!hard_overlap)
+                                            {
+                                            // compute the energy at this size of the perturbation
+                                            // and compare to the energy in the unperturbed state
+                                            const vec3<Scalar> r_ij_scaled
+                                                = r_ij * (Scalar(1.0) - scale_factor);
+                                            double u_ij_new = m_mc->computeOnePairEnergy(
+                                                dot(r_ij_scaled, r_ij_scaled),
+                                                r_ij_scaled,
+                                                typ_i,
+                                                shape_i.orientation,
+                                                h_diameter[i],
+                                                h_charge[i],
+                                                typ_j,
+                                                orientation_j,
+                                                h_diameter[j],
+                                                h_charge[j]);
+                                            // if energy has changed, there is a new soft overlap
+                                            // add the appropriate weight to the appropriate bin of
+                                            // the histogram and break out of the loop over bins
+                                            if (u_ij_new != u_ij_0)
+                                                {
+                                                min_bin_compression = bin_to_sample;
+                                                if (u_ij_new < u_ij_0)
+                                                    {
+                                                    hist_weight_ptl_i_compression = 0;
+                                                    }
+                                                else
+                                                    {
+                                                    hist_weight_ptl_i_compression
+                                                        = 1.0
+                                                          - fast::exp(-(u_ij_new - u_ij_0) / kT);
+                                                    }
+                                                }
+                                            } // end if (!hard_overlap)
+                                        } // end loop over bins for compression
+
+                                    // do expansions
+                                    for (size_t bin_to_sample = 0;
+                                         bin_to_sample < min_bin_expansion;
+                                         bin_to_sample++)
                                         {
-                                        min_bin_expansion = bin_to_sample;
-                                        if (u_ij_new < u_ij_0)
+                                        const double scale_factor
+                                            = -m_dx * static_cast<double>(bin_to_sample + 1);
+
+                                        // check for hard overlaps
+                                        // if there is one for a given scale value, there is no need
+                                        // to check for any soft overlaps from the pair potentials
+                                        bool hard_overlap = detail::test_scaled_overlap<Shape>(
+                                            r_ij,
+                                            orientation_i,
+                                            orientation_j,
+                                            params[__scalar_as_int(postype_i.w)],
+                                            params[__scalar_as_int(postype_j.w)],
+                                            scale_factor);
+                                        if (hard_overlap)
                                             {
-                                            hist_weight_ptl_i_expansion = 0;
-                                            }
-                                        else
+                                            hist_weight_ptl_i_expansion = 1.0; // = 1-e^(-\infty)
+                                            min_bin_expansion = bin_to_sample;
+                                            } // end if (hard_overlap)
+
+                                        // if no hard overlap, check for a soft overlap if necessary
+                                        if (!hard_overlap)
                                             {
-                                            hist_weight_ptl_i_expansion
-                                                = 1.0 - fast::exp(-(u_ij_new - u_ij_0) / kT);
-                                            }
-                                        }
-                                    } // end if (!hard_overlap)
-                                } // end loop over histogram bins for expansions
+                                            // compute the energy at this size of the perturbation
+                                            // and compare to the energy in the unperturbed state
+                                            const vec3<Scalar> r_ij_scaled
+                                                = r_ij * (Scalar(1.0) - scale_factor);
+                                            double u_ij_new = m_mc->computeOnePairEnergy(
+                                                dot(r_ij_scaled, r_ij_scaled),
+                                                r_ij_scaled,
+                                                typ_i,
+                                                shape_i.orientation,
+                                                h_diameter[i],
+                                                h_charge[i],
+                                                typ_j,
+                                                orientation_j,
+                                                h_diameter[j],
+                                                h_charge[j]);
+                                            // if energy has changed, there is a new soft overlap
+                                            // add the appropriate weight to the appropriate bin of
+                                            // the histogram and break out of the loop over bins
+                                            if (u_ij_new != u_ij_0)
+                                                {
+                                                min_bin_expansion = bin_to_sample;
+                                                if (u_ij_new < u_ij_0)
+                                                    {
+                                                    hist_weight_ptl_i_expansion = 0;
+                                                    }
+                                                else
+                                                    {
+                                                    hist_weight_ptl_i_expansion
+                                                        = 1.0
+                                                          - fast::exp(-(u_ij_new - u_ij_0) / kT);
+                                                    }
+                                                }
+                                            } // end if (!hard_overlap)
+                                        } // end loop over histogram bins for expansions
+                                    }
+                                }
                             }
-                        }
+                        else
+                            {
+                            // skip ahead
+                            cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                            }
+                        } // end loop over AABB nodes
+                    } // end loop over images
+                if (min_bin_compression < m_hist_compression.size()
+                    && hist_weight_ptl_i_compression <= 1.0)
+                    {
+                    hist_compression[thread_id][min_bin_compression]
+                        += hist_weight_ptl_i_compression;
                     }
-                else
+                if (min_bin_expansion < m_hist_expansion.size()
+                    && hist_weight_ptl_i_expansion <= 1.0)
                     {
-                    // skip ahead
-                    cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                    hist_expansion[thread_id][min_bin_expansion] += hist_weight_ptl_i_expansion;
                     }
-                } // end loop over AABB nodes
-            } // end loop over images
-        if (min_bin_compression < m_hist_compression.size() && hist_weight_ptl_i_compression <= 1.0)
-            {
-            m_hist_compression[min_bin_compression] += hist_weight_ptl_i_compression;
-            }
-        if (min_bin_expansion < m_hist_expansion.size() && hist_weight_ptl_i_expansion <= 1.0)
+                } // end loop over all particles
+        });
+
+    // sum the per-thread histograms in a fixed order so that the result does not depend on the
+    // number of threads
+    for (unsigned int thread = 0; thread < pool.getNumThreads(); thread++)
+        {
+        for (size_t bin = 0; bin < m_hist_compression.size(); bin++)
             {
-            m_hist_expansion[min_bin_expansion] += hist_weight_ptl_i_expansion;
+            m_hist_compression[bin] += hist_compression[thread][bin];
+            m_hist_expansion[bin] += hist_expansion[thread][bin];
             }
-        } // end loop over all particles
+        }
     } // end countHistogramLinearSearch()
 
 /*! \param r_ij Vector pointing from particle i to j (already wrapped into the box)
@@ -781,6 +1047,9 @@ template<class Shape> void export_ComputeSDF(pybind11::module& m, const std::str
                             double>())
         .def_property("xmax", &ComputeSDF<Shape>::getXMax, &ComputeSDF<Shape>::setXMax)
         .def_property("dx", &ComputeSDF<Shape>::getDx, &ComputeSDF<Shape>::setDx)
+        .def_property("asynchronous",
+                      &ComputeSDF<Shape>::getAsynchronous,
+                      &ComputeSDF<Shape>::setAsynchronous)
         .def_property_readonly("sdf_compression", &ComputeSDF<Shape>::getSDFCompression)
         .def_property_readonly("sdf_expansion", &ComputeSDF<Shape>::getSDFExpansion)
         .def_property_readonly("num_bins", &ComputeSDF<Shape>::getNumBins);
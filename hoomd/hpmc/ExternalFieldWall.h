@@ -628,6 +628,25 @@ template<class Shape> class ExternalFieldWall : public ExternalPotential
         return 0.0;
         }
 
+    /// Evaluate the change in energy in a trial move, skipping the old configuration
+    virtual LongReal particleEnergyDifferenceImplementation(uint64_t timestep,
+                                                            unsigned int tag_i,
+                                                            unsigned int type_i,
+                                                            const vec3<LongReal>& r_old,
+                                                            const quat<LongReal>& q_old,
+                                                            const vec3<LongReal>& r_new,
+                                                            const quat<LongReal>& q_new,
+                                                            LongReal charge_i)
+        {
+        return -particleEnergyImplementation(timestep,
+                                             tag_i,
+                                             type_i,
+                                             r_new,
+                                             q_new,
+                                             charge_i,
+                                             Trial::New);
+        }
+
     std::vector<SphereWall>& GetSphereWalls()
         {
         return m_Spheres;
@@ -76,6 +76,51 @@ class ExternalPotential
                                             trial);
         }
 
+    /** Evaluate the change in energy of one particle in a trial move (translated box)
+
+        @param timestep The current timestep in the simulation
+        @param tag_i Tag of the particle
+        @param type_i Type index of the particle.
+        @param r_old Position of the particle in the old configuration (un-shifted local particle).
+        @param q_old Orientation of the particle in the old configuration.
+        @param r_new Position of the particle in the new configuration (un-shifted local particle).
+        @param q_new Orientation of the particle in the new configuration.
+        @param charge_i Charge of the particle.
+        @returns The energy of the old configuration minus the energy of the new configuration
+          (possibly -INFINITY).
+
+        Equivalent to particleEnergy(Trial::Old) - particleEnergy(Trial::New) with one virtual call
+        and one box lookup for both configurations.
+    */
+    LongReal particleEnergyDifference(uint64_t timestep,
+                                      unsigned int tag_i,
+                                      unsigned int type_i,
+                                      const vec3<LongReal>& r_old,
+                                      const quat<LongReal>& q_old,
+                                      const vec3<LongReal>& r_new,
+                                      const quat<LongReal>& q_new,
+                                      LongReal charge_i)
+        {
+        const auto& particle_data = m_sysdef->getParticleData();
+        auto box = particle_data->getGlobalBox();
+        auto origin = vec3<LongReal>(particle_data->getOrigin());
+
+        auto shifted_r_old = r_old - origin;
+        auto shifted_r_new = r_new - origin;
+        int3 tmp = make_int3(0, 0, 0);
+        box.wrap(shifted_r_old, tmp);
+        tmp = make_int3(0, 0, 0);
+        box.wrap(shifted_r_new, tmp);
+        return particleEnergyDifferenceImplementation(timestep,
+                                                      tag_i,
+                                                      type_i,
+                                                      shifted_r_old,
+                                                      q_old,
+                                                      shifted_r_new,
+                                                      q_new,
+                                                      charge_i);
+        }
+
     /// Evaluate the total external energy due to this potential.
     LongReal totalEnergy(uint64_t timestep, Trial trial = Trial::None);
 
@@ -116,6 +161,46 @@ class ExternalPotential
         {
         return 0;
         }
+
+    /** Implement the evaluation of the change in energy of one particle in a trial move.
+
+        @param timestep The current timestep in the simulation
+        @param tag_i Tag of the particle
+        @param type_i Type index of the particle.
+        @param r_old Position of the particle in the old configuration in the box.
+        @param q_old Orientation of the particle in the old configuration.
+        @param r_new Position of the particle in the new configuration in the box.
+        @param q_new Orientation of the particle in the new configuration.
+        @param charge_i Charge of the particle.
+        @returns The energy of the old configuration minus the energy of the new configuration.
+
+        The default implementation evaluates both configurations with particleEnergyImplementation.
+        Override it when one of the configurations does not need to be evaluated.
+    */
+    virtual LongReal particleEnergyDifferenceImplementation(uint64_t timestep,
+                                                            unsigned int tag_i,
+                                                            unsigned int type_i,
+                                                            const vec3<LongReal>& r_old,
+                                                            const quat<LongReal>& q_old,
+                                                            const vec3<LongReal>& r_new,
+                                                            const quat<LongReal>& q_new,
+                                                            LongReal charge_i)
+        {
+        return particleEnergyImplementation(timestep,
+                                            tag_i,
+                                            type_i,
+                                            r_old,
+                                            q_old,
+                                            charge_i,
+                                            Trial::Old)
+               - particleEnergyImplementation(timestep,
+                                              tag_i,
+                                              type_i,
+                                              r_new,
+                                              q_new,
+                                              charge_i,
+                                              Trial::New);
+        }
     };
 
 inline LongReal ExternalPotential::totalEnergy(uint64_t timestep, Trial trial)
@@ -22,7 +22,12 @@
 #endif
 
 #ifndef __HIPCC__
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 #endif
 
 #include "hoomd/ManagedArray.h"
@@ -363,6 +368,102 @@ class GPUTree
     unsigned int m_leaf_capacity; //!< Capacity of OBB leaf nodes
     };
 
+#ifndef __HIPCC__
+//! Serialized inputs of an OBBTree build
+/*! Two builds with equal keys produce identical trees. Append every input of the build, including
+    the leaf capacity and any flags, before the build modifies them.
+*/
+class OBBTreeKey
+    {
+    public:
+    //! Start a key for a kind of build
+    /*! \param kind Name of the build method, so that different methods never share keys
+     */
+    explicit OBBTreeKey(const std::string& kind) : m_key(kind + ":") { }
+
+    //! Append an OBB to the key
+    void append(const OBB& obb)
+        {
+        append(obb.lengths);
+        append(obb.center);
+        append(obb.rotation.s);
+        append(obb.rotation.v);
+        append(obb.mask);
+        append(obb.is_sphere);
+        }
+
+    //! Append a vector to the key
+    void append(const vec3<ShortReal>& v)
+        {
+        append(v.x);
+        append(v.y);
+        append(v.z);
+        }
+
+    //! Append a scalar to the key
+    void append(ShortReal v)
+        {
+        m_key.append(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+
+    //! Append an integer to the key
+    void append(unsigned int v)
+        {
+        m_key.append(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+
+    //! Get the serialized key
+    const std::string& str() const
+        {
+        return m_key;
+        }
+
+    private:
+    std::string m_key; //!< Serialized inputs
+    };
+
+//! Build a GPUTree, reusing the OBBTree of an earlier build with the same inputs
+/*! \param key Inputs of the build
+    \param build Function that builds the OBBTree from the inputs
+    \param managed True if we use CUDA managed memory
+
+    Shape parameters build their tree every time they are constructed from Python, for every type
+    and for every trial shape in UpdaterShape. Building the OBBTree dominates the cost for large
+    meshes and unions, while converting it to a GPUTree only copies the nodes. The cache keeps the
+    most recently built trees in host memory and is cleared when it holds too many.
+*/
+inline GPUTree buildCachedGPUTree(const OBBTreeKey& key,
+                                  const std::function<void(OBBTree&)>& build,
+                                  bool managed)
+    {
+    static const size_t max_cached_trees = 64;
+    static std::mutex cache_mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const OBBTree>> cache;
+
+    std::shared_ptr<const OBBTree> tree;
+        {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(key.str());
+        if (it != cache.end())
+            tree = it->second;
+        }
+
+    if (!tree)
+        {
+        std::shared_ptr<OBBTree> new_tree = std::make_shared<OBBTree>();
+        build(*new_tree);
+        tree = new_tree;
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (cache.size() >= max_cached_trees)
+            cache.clear();
+        cache[key.str()] = tree;
+        }
+
+    return GPUTree(*tree, managed);
+    }
+#endif
+
 // Tandem stack traversal routines
 // from: A Binary Stack Tandem Traversal and an Ancestor Counter Data Structure for GPU friendly
 // Bounding Volume Damkjær, Jesper and Erleben, Kenny Proceedings Workshop in Virtual Reality
@@ -5,6 +5,7 @@
 #define _HPMC_COUNTERS_H_
 
 #include "hoomd/HOOMDMath.h"
+#include <stdint.h>
 
 namespace hoomd
     {
@@ -100,6 +101,30 @@ DEVICE inline hpmc_counters_t operator+(const hpmc_counters_t& a, const hpmc_cou
     return result;
     }
 
+//! Wall clock time spent in each stage of the trial moves
+/*! \ingroup hpmc_data_structs
+
+    Times are in nanoseconds. trial_moves includes pair_energy and external_energy.
+*/
+struct hpmc_stage_times_t
+    {
+    int64_t broadphase;      //!< Time spent building the broadphase and image list
+    int64_t trial_moves;     //!< Time spent in the loop over trial moves
+    int64_t pair_energy;     //!< Time spent evaluating pair energies of the old configuration
+    int64_t external_energy; //!< Time spent evaluating external energies
+    int64_t communicate;     //!< Time spent migrating and exchanging particles
+
+    //! Construct a zero set of times
+    DEVICE hpmc_stage_times_t()
+        {
+        broadphase = 0;
+        trial_moves = 0;
+        pair_energy = 0;
+        external_energy = 0;
+        communicate = 0;
+        }
+    };
+
 //! Storage for NPT acceptance counters
 /*! \ingroup hpmc_data_structs */
 struct hpmc_boxmc_counters_t
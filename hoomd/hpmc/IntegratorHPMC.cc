@@ -22,7 +22,9 @@ namespace hpmc
     {
 IntegratorHPMC::IntegratorHPMC(std::shared_ptr<SystemDefinition> sysdef)
     : Integrator(sysdef, 0.005), m_translation_move_probability(32768), m_nselect(4),
-      m_nominal_width(1.0), m_extra_ghost_width(0), m_past_first_run(false)
+      m_broadphase(Broadphase::automatic), m_tune_target(0), m_tune_period(100),
+      m_tune_tolerance(0), m_tune_started(false), m_tune_last_step(0), m_nominal_width(1.0),
+      m_extra_ghost_width(0), m_past_first_run(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing IntegratorHPMC" << endl;
 
@@ -166,6 +168,11 @@ bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
     // we have moved particles, communicate those changes
     this->communicate(false);
 
+    // the pairs closest to contact overlap first in most rejected trials. Check them before
+    // building the AABB tree for the new box.
+    if (this->checkContactOverlaps())
+        return false;
+
     // check overlaps
     return !this->countOverlaps(true);
     }
@@ -237,6 +244,243 @@ hpmc_counters_t IntegratorHPMC::getCounters(unsigned int mode)
     return result;
     }
 
+/*! The counts are reset at the start of each run. Only the CPU integrators count moves by type,
+    the counts are zero on the GPU.
+*/
+std::vector<hpmc_counters_t> IntegratorHPMC::getTypeCounters()
+    {
+    std::vector<hpmc_counters_t> result(m_pdata->getNTypes());
+    for (unsigned int type = 0; type < result.size() && type < m_type_count.size(); type++)
+        result[type] = m_type_count[type];
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        std::vector<unsigned long long int> counts(result.size() * 4);
+        for (unsigned int type = 0; type < result.size(); type++)
+            {
+            counts[type * 4] = result[type].translate_accept_count;
+            counts[type * 4 + 1] = result[type].translate_reject_count;
+            counts[type * 4 + 2] = result[type].rotate_accept_count;
+            counts[type * 4 + 3] = result[type].rotate_reject_count;
+            }
+        MPI_Allreduce(MPI_IN_PLACE,
+                      counts.data(),
+                      (int)counts.size(),
+                      MPI_LONG_LONG_INT,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        for (unsigned int type = 0; type < result.size(); type++)
+            {
+            result[type].translate_accept_count = counts[type * 4];
+            result[type].translate_reject_count = counts[type * 4 + 1];
+            result[type].rotate_accept_count = counts[type * 4 + 2];
+            result[type].rotate_reject_count = counts[type * 4 + 3];
+            }
+        }
+#endif
+    return result;
+    }
+
+/*! \returns The time in seconds spent building the broadphase, in trial moves, evaluating pair
+    energies, evaluating external energies, and communicating since the start of the run.
+
+    The trial move time excludes the pair and external energy times. Only the pair energies of the
+    old configuration are timed separately, the new configuration is evaluated together with the
+    overlap checks. With MPI, each time is the maximum over all ranks.
+*/
+std::vector<double> IntegratorHPMC::getStageTimes()
+    {
+    std::vector<double> result
+        = {double(m_stage_times.broadphase),
+           double(m_stage_times.trial_moves - m_stage_times.pair_energy
+                  - m_stage_times.external_energy),
+           double(m_stage_times.pair_energy),
+           double(m_stage_times.external_energy),
+           double(m_stage_times.communicate)};
+    for (auto& t : result)
+        t *= 1e-9;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      result.data(),
+                      (int)result.size(),
+                      MPI_DOUBLE,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return result;
+    }
+
+/*! \param broadphase "tree" to use the AABBTree, "grid" to use the AABBGrid, or "auto" to choose
+    the grid when all particles have similar AABB sizes.
+*/
+void IntegratorHPMC::setBroadphase(const std::string& broadphase)
+    {
+    if (broadphase == "auto")
+        m_broadphase = Broadphase::automatic;
+    else if (broadphase == "tree")
+        m_broadphase = Broadphase::tree;
+    else if (broadphase == "grid")
+        m_broadphase = Broadphase::grid;
+    else
+        throw std::invalid_argument("Invalid broadphase: " + broadphase);
+    }
+
+std::string IntegratorHPMC::getBroadphase()
+    {
+    if (m_broadphase == Broadphase::tree)
+        return "tree";
+    else if (m_broadphase == Broadphase::grid)
+        return "grid";
+    return "auto";
+    }
+
+/*! \param convergence_batch Number of convergence passes to enqueue before the host reads back the
+    convergence flag (at least 1). Only the GPU implementation uses this value.
+*/
+void IntegratorHPMC::setConvergenceBatch(unsigned int convergence_batch)
+    {
+    if (convergence_batch == 0)
+        throw std::invalid_argument("convergence_batch must be at least 1");
+    m_convergence_batch = convergence_batch;
+    }
+
+/*! \param target Target acceptance ratio of translation and rotation moves, or None to disable
+    the tuner.
+*/
+void IntegratorHPMC::setTuneAcceptance(pybind11::object target)
+    {
+    Scalar new_target = 0;
+    if (!target.is_none())
+        {
+        new_target = target.cast<Scalar>();
+        if (!(new_target > 0 && new_target < 1))
+            {
+            throw std::domain_error("tune_acceptance must be between 0 and 1.");
+            }
+        }
+
+    // start measuring the acceptance again with the new target
+    m_tune_target = new_target;
+    m_tune_started = false;
+    }
+
+pybind11::object IntegratorHPMC::getTuneAcceptance()
+    {
+    if (m_tune_target == 0)
+        {
+        return pybind11::none();
+        }
+    return pybind11::cast(m_tune_target);
+    }
+
+void IntegratorHPMC::setTunePeriod(uint64_t period)
+    {
+    if (period == 0)
+        {
+        throw std::domain_error("tune_period must be positive.");
+        }
+    m_tune_period = period;
+    }
+
+void IntegratorHPMC::setTuneTolerance(Scalar tolerance)
+    {
+    if (tolerance < 0)
+        {
+        throw std::domain_error("tune_tolerance must be non-negative.");
+        }
+    m_tune_tolerance = tolerance;
+    }
+
+/*! \param timestep Current timestep
+
+    Every m_tune_period timesteps, scale the translation and rotation move sizes of all types by
+    the same solver that hoomd.tune.ScaleSolver uses for MoveSize (gamma = 2, at most a factor of 2
+    per adjustment), based on the acceptance ratios measured since the last adjustment. Move sizes
+    that are 0 stay fixed. When m_tune_tolerance is non-zero and both measured ratios are within
+    the tolerance of the target, the tuner disables itself so that the move sizes stay frozen for
+    the rest of the simulation.
+*/
+void IntegratorHPMC::tuneMoveSizes(uint64_t timestep)
+    {
+    if (m_tune_target == 0)
+        {
+        return;
+        }
+
+    if (!m_tune_started)
+        {
+        m_tune_count_start = getCounters(0);
+        m_tune_last_step = timestep;
+        m_tune_started = true;
+        return;
+        }
+
+    if (timestep < m_tune_last_step + m_tune_period)
+        {
+        return;
+        }
+
+    const hpmc_counters_t counters = getCounters(0);
+    const hpmc_counters_t delta = counters - m_tune_count_start;
+    m_tune_count_start = counters;
+    m_tune_last_step = timestep;
+
+    const Scalar gamma = 2.0;
+    const Scalar max_scale = 2.0;
+    bool converged = true;
+
+    // the acceptance ratio decreases with the move size
+    auto compute_scale = [&](unsigned long long int accept, unsigned long long int reject)
+    {
+        const unsigned long long int total = accept + reject;
+        if (total == 0)
+            {
+            return Scalar(1.0);
+            }
+
+        const Scalar acceptance = Scalar(accept) / Scalar(total);
+        if (std::abs(acceptance - m_tune_target) > m_tune_tolerance)
+            {
+            converged = false;
+            }
+        if (acceptance == 0)
+            {
+            return Scalar(0.1);
+            }
+        return std::min((acceptance + gamma) / (m_tune_target + gamma), max_scale);
+    };
+
+    const Scalar scale_d
+        = compute_scale(delta.translate_accept_count, delta.translate_reject_count);
+    const Scalar scale_a = compute_scale(delta.rotate_accept_count, delta.rotate_reject_count);
+
+        {
+        ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::readwrite);
+        for (unsigned int typ = 0; typ < m_pdata->getNTypes(); typ++)
+            {
+            h_d.data[typ] *= scale_d;
+            // limit rotations to a full turn
+            h_a.data[typ] = std::min(h_a.data[typ] * scale_a, Scalar(2.0 * M_PI));
+            }
+        }
+
+    // the move size enters the image list and cell widths
+    updateCellWidth();
+
+    if (m_tune_tolerance > 0 && converged)
+        {
+        m_exec_conf->msg->notice(2) << "HPMC move sizes converged at timestep " << timestep
+                                    << ", freezing them." << std::endl;
+        m_tune_target = 0;
+        }
+    }
+
 namespace detail
     {
 void export_IntegratorHPMC(pybind11::module& m)
@@ -257,9 +501,22 @@ void export_IntegratorHPMC(pybind11::module& m)
         .def("checkParticleOrientations", &IntegratorHPMC::checkParticleOrientations)
         .def("getMPS", &IntegratorHPMC::getMPS)
         .def("getCounters", &IntegratorHPMC::getCounters)
+        .def("getTypeCounters", &IntegratorHPMC::getTypeCounters)
+        .def("getStageTimes", &IntegratorHPMC::getStageTimes)
         .def("communicate", &IntegratorHPMC::communicate)
         .def_property("kT", &IntegratorHPMC::getKT, &IntegratorHPMC::setKT)
         .def_property("nselect", &IntegratorHPMC::getNSelect, &IntegratorHPMC::setNSelect)
+        .def_property("broadphase", &IntegratorHPMC::getBroadphase, &IntegratorHPMC::setBroadphase)
+        .def_property("convergence_batch",
+                      &IntegratorHPMC::getConvergenceBatch,
+                      &IntegratorHPMC::setConvergenceBatch)
+        .def_property("tune_acceptance",
+                      &IntegratorHPMC::getTuneAcceptance,
+                      &IntegratorHPMC::setTuneAcceptance)
+        .def_property("tune_period", &IntegratorHPMC::getTunePeriod, &IntegratorHPMC::setTunePeriod)
+        .def_property("tune_tolerance",
+                      &IntegratorHPMC::getTuneTolerance,
+                      &IntegratorHPMC::setTuneTolerance)
         .def_property("translation_move_probability",
                       &IntegratorHPMC::getTranslationMoveProbability,
                       &IntegratorHPMC::setTranslationMoveProbability)
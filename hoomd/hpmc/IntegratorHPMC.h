@@ -133,6 +133,8 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     //! Take one timestep forward
     virtual void update(uint64_t timestep)
         {
+        tuneMoveSizes(timestep);
+
         ArrayHandle<hpmc_counters_t> h_counters(m_count_total,
                                                 access_location::host,
                                                 access_mode::read);
@@ -257,6 +259,45 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return m_nselect;
         }
 
+    //! Set the target acceptance ratio of the online move size tuner (None disables it)
+    void setTuneAcceptance(pybind11::object target);
+
+    //! Get the target acceptance ratio of the online move size tuner
+    pybind11::object getTuneAcceptance();
+
+    //! Set the number of timesteps between move size adjustments
+    void setTunePeriod(uint64_t period);
+
+    //! Get the number of timesteps between move size adjustments
+    uint64_t getTunePeriod()
+        {
+        return m_tune_period;
+        }
+
+    //! Set the tolerance at which the tuner freezes the move sizes (0 never freezes)
+    void setTuneTolerance(Scalar tolerance);
+
+    //! Get the tolerance at which the tuner freezes the move sizes
+    Scalar getTuneTolerance()
+        {
+        return m_tune_tolerance;
+        }
+
+    //! Set the broadphase used to find overlap candidates on the CPU
+    void setBroadphase(const std::string& broadphase);
+
+    //! Get the broadphase used to find overlap candidates on the CPU
+    std::string getBroadphase();
+
+    //! Set the number of convergence passes the GPU runs between host synchronizations
+    void setConvergenceBatch(unsigned int convergence_batch);
+
+    //! Get the number of convergence passes the GPU runs between host synchronizations
+    unsigned int getConvergenceBatch()
+        {
+        return m_convergence_batch;
+        }
+
     //! Set kT variant
     /*! \param kT new k_BT variant to set
      */
@@ -286,6 +327,8 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
                                                 access_mode::read);
         m_count_run_start = h_counters.data[0];
         m_clock = ClockSource();
+        m_type_count.assign(m_pdata->getNTypes(), hpmc_counters_t());
+        m_stage_times = hpmc_stage_times_t();
         }
 
     //! Get the diameter of the largest circumscribing sphere for objects handled by this integrator
@@ -304,6 +347,31 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return 0;
         }
 
+    //! Check the particle pairs closest to contact for overlaps
+    /*! \returns true when one of the pairs closest to contact in the last overlap free
+        countOverlaps() overlaps.
+
+        This check is much cheaper than countOverlaps(). It only reports true overlaps, but may miss
+        overlaps between other pairs.
+    */
+    virtual bool checkContactOverlaps()
+        {
+        return false;
+        }
+
+    //! Get the smallest distance between neighbors relative to their circumsphere contact distance
+    /*! \returns The minimum of r_ij / (R_i + R_j) over the neighboring pairs found by the last
+        countOverlaps(), where R is the circumsphere radius. Returns 0 when that call found overlaps
+        or has not been made and the largest Scalar when it found no neighbors.
+
+        Scaling all distances by a factor larger than the inverse of this ratio does not bring the
+        circumspheres of these pairs into contact.
+    */
+    virtual Scalar getMinContactRatio()
+        {
+        return 0;
+        }
+
     //! Get the number of degrees of freedom granted to a given group
     /*! \param group Group over which to count degrees of freedom.
         \return a non-zero dummy value to suppress warnings.
@@ -321,6 +389,12 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     //! Get the current counter values
     hpmc_counters_t getCounters(unsigned int mode = 0);
 
+    //! Get the counter values of each type since the start of the run
+    std::vector<hpmc_counters_t> getTypeCounters();
+
+    //! Get the time spent in each stage of the trial moves since the start of the run
+    std::vector<double> getStageTimes();
+
     //! Communicate particles
     /*! \param migrate Set to true to both migrate and exchange, set to false to only exchange
 
@@ -423,8 +497,14 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
             {
             if (r_squared < pair->getRCutSquaredTotal(type_i, type_j))
                 {
-                energy
-                    += pair->energy(r_squared, r_ij, type_i, q_i, charge_i, type_j, q_j, charge_j);
+                energy += pair->evaluate(r_squared,
+                                         r_ij,
+                                         type_i,
+                                         q_i,
+                                         charge_i,
+                                         type_j,
+                                         q_j,
+                                         charge_j);
                 }
             }
 
@@ -465,6 +545,35 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return energy;
         }
 
+    /// Compute the change in external energy of one particle in a trial move
+    /*! \returns The energy of the old configuration minus the energy of the new configuration,
+        summed over all external potentials.
+    */
+    inline LongReal computeOneExternalEnergyDifference(uint64_t timestep,
+                                                       unsigned int tag_i,
+                                                       unsigned int type_i,
+                                                       const vec3<LongReal>& r_old,
+                                                       const quat<LongReal>& q_old,
+                                                       const vec3<LongReal>& r_new,
+                                                       const quat<LongReal>& q_new,
+                                                       LongReal charge_i)
+        {
+        LongReal energy = 0;
+        for (const auto& external : m_external_potentials)
+            {
+            energy += external->particleEnergyDifference(timestep,
+                                                         tag_i,
+                                                         type_i,
+                                                         r_old,
+                                                         q_old,
+                                                         r_new,
+                                                         q_new,
+                                                         charge_i);
+            }
+
+        return energy;
+        }
+
     /// Get the list of pair potentials.
     std::vector<std::shared_ptr<PairPotential>>& getPairPotentials()
         {
@@ -498,10 +607,30 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     unsigned int m_translation_move_probability; //!< Fraction of moves that are translation moves.
     unsigned int m_nselect;                      //!< Number of particles to select for trial moves
 
+    //! Methods to find overlap candidates in trial moves
+    enum class Broadphase
+        {
+        automatic, //!< Choose the grid or the tree based on the particle sizes
+        tree,      //!< Bounding volume hierarchy (AABBTree)
+        grid       //!< Uniform grid (AABBGrid)
+        };
+    Broadphase m_broadphase; //!< Broadphase used in the CPU trial moves
+
+    unsigned int m_convergence_batch = 1; //!< GPU convergence passes per host synchronization
+
+    Scalar m_tune_target;               //!< Target acceptance of the move size tuner (0 disables)
+    uint64_t m_tune_period;             //!< Number of timesteps between move size adjustments
+    Scalar m_tune_tolerance;            //!< Acceptance tolerance at which the move sizes freeze
+    bool m_tune_started;                //!< True after the tuner recorded its first counters
+    uint64_t m_tune_last_step;          //!< Timestep of the last move size adjustment
+    hpmc_counters_t m_tune_count_start; //!< Counters at the last move size adjustment
+
     GPUVector<Scalar> m_d; //!< Maximum move displacement by type
     GPUVector<Scalar> m_a; //!< Maximum angular displacement by type
 
-    GPUArray<hpmc_counters_t> m_count_total; //!< Accept/reject total count
+    GPUArray<hpmc_counters_t> m_count_total;   //!< Accept/reject total count
+    std::vector<hpmc_counters_t> m_type_count; //!< Accept/reject count by type since run() start
+    hpmc_stage_times_t m_stage_times;          //!< Time spent in each stage since run() start
 
     Scalar m_nominal_width;     //!< nominal cell width
     Scalar m_extra_ghost_width; //!< extra ghost width to add
@@ -523,6 +652,9 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     /// Cached pair energy search radius.
     std::vector<LongReal> m_pair_energy_search_radius;
 
+    //! Adjust the move sizes toward the target acceptance ratio
+    void tuneMoveSizes(uint64_t timestep);
+
     //! Update the nominal width of the cells
     /*! This method is virtual so that derived classes can set appropriate widths
         (for example, some may want max diameter while others may want a buffer distance).
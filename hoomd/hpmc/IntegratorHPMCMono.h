@@ -3,12 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <unordered_map>
 
 #include "GSDHPMCSchema.h"
 #include "IntegratorHPMC.h"
 #include "Moves.h"
 #include "ShapeSpheropolyhedron.h"
+#include "SupportExtentTable.h"
+#include "hoomd/AABBGrid.h"
 #include "hoomd/AABBTree.h"
 #include "hoomd/Index1D.h"
 #include "hoomd/Integrator.h"
@@ -122,6 +127,8 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
         {
         if (m_aabbs != NULL)
             free(m_aabbs);
+        if (m_hard_aabbs != NULL)
+            free(m_hard_aabbs);
         m_pdata->getBoxChangeSignal()
             .template disconnect<IntegratorHPMCMono<Shape>,
                                  &IntegratorHPMCMono<Shape>::slotBoxChanged>(this);
@@ -180,6 +187,12 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
     //! Count overlaps with the option to exit early at the first detected overlap
     virtual unsigned int countOverlaps(bool early_exit);
 
+    //! Check the particle pairs closest to contact for overlaps
+    virtual bool checkContactOverlaps();
+
+    //! Get the smallest distance between neighbors relative to their circumsphere contact distance
+    virtual Scalar getMinContactRatio();
+
     //! Return a vector that is an unwrapped overlap map
     virtual std::vector<std::pair<unsigned int, unsigned int>> mapOverlaps();
 
@@ -291,6 +304,9 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
     //! Build the AABB tree (if needed)
     const hoomd::detail::AABBTree& buildAABBTree();
 
+    //! Build the AABB grid for the trial moves when the broadphase selects it
+    bool buildAABBGrid();
+
     //! Make list of image indices for boxes to check in small-box mode
     const std::vector<vec3<Scalar>>& updateImageList();
 
@@ -306,6 +322,57 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
         m_aabb_tree_invalid = true;
         }
 
+    //! Set whether trial moves cache separating axes between pairs of particles
+    void setSeparatingAxisCache(bool enable)
+        {
+        m_separating_axis_cache = enable;
+        m_separating_axes.clear();
+        }
+
+    //! Get whether trial moves cache separating axes between pairs of particles
+    bool getSeparatingAxisCache()
+        {
+        return m_separating_axis_cache;
+        }
+
+    //! Set whether trial moves reject disjoint pairs with tabulated shape extents
+    void setSupportExtentTables(bool enable)
+        {
+        m_support_extent_tables = enable;
+        m_support_extent_tables_valid = false;
+        }
+
+    //! Get whether trial moves reject disjoint pairs with tabulated shape extents
+    bool getSupportExtentTables()
+        {
+        return m_support_extent_tables;
+        }
+
+    //! Set whether trial moves cache the pair energy of each particle
+    void setPairEnergyCache(bool enable)
+        {
+        m_pair_energy_cache = enable;
+        }
+
+    //! Get whether trial moves cache the pair energy of each particle
+    bool getPairEnergyCache()
+        {
+        return m_pair_energy_cache;
+        }
+
+    //! Set whether trial moves sweep a checkerboard of cells on the thread pool
+    void setCheckerboard(bool enable)
+        {
+        m_checkerboard = enable;
+        m_checkerboard_warning_issued = false;
+        }
+
+    //! Get whether trial moves sweep a checkerboard of cells on the thread pool
+    bool getCheckerboard()
+        {
+        return m_checkerboard;
+        }
+
     std::vector<std::string> getTypeShapeMapping(
         const std::vector<param_type, hoomd::detail::managed_allocator<param_type>>& params) const
         {
@@ -340,15 +407,92 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
         m_image_list; //!< List of potentially interacting simulation box images
     std::vector<int3>
         m_image_hkl; //!< List of potentially interacting simulation box images (integer shifts)
+    std::vector<unsigned char>
+        m_image_active; //!< True for the images that the current trial move queries
     unsigned int m_image_list_rebuilds; //!< Number of times the image list has been rebuilt
     bool m_image_list_warning_issued;   //!< True if the image list warning has been issued
     bool m_hkl_max_warning_issued;      //!< True if the image list size warning has been issued
     bool m_hasOrientation; //!< true if there are any orientable particles in the system
 
+    std::vector<std::pair<unsigned int, unsigned int>>
+        m_contact_pairs; //!< Tags of the pairs closest to contact, closest first
+    Scalar m_min_contact_ratio; //!< Smallest contact ratio found by the last countOverlaps()
+
     hoomd::detail::AABBTree m_aabb_tree; //!< Bounding volume hierarchy for overlap checks
     hoomd::detail::AABB* m_aabbs;        //!< list of AABBs, one per particle
     unsigned int m_aabbs_capacity;       //!< Capacity of m_aabbs list
     bool m_aabb_tree_invalid;            //!< Flag if the aabb tree has been invalidated
+    bool m_aabb_tree_moved; //!< Flag if particles moved since the tree was built (same particles)
+    Scalar m_aabb_tree_build_cost; //!< Cost of the aabb tree when it was last built
+    uint64_t m_aabb_tree_version = 0;       //!< Incremented when buildAABBTree() changes the tree
+    uint64_t m_aabb_tree_build_version = 0; //!< Incremented when buildAABBTree() rebuilds the tree
+
+    //! Bounding volume hierarchy of the shape AABBs for the overlap checks of trial moves
+    /*! With pair interactions, the leaves of m_aabb_tree are padded by the pair cutoff. Trial moves
+        check overlaps in this tree and evaluate the pair energy in m_aabb_tree.
+    */
+    hoomd::detail::AABBTree m_hard_aabb_tree;
+    hoomd::detail::AABB* m_hard_aabbs = NULL;  //!< Shape AABBs, one per particle
+    unsigned int m_hard_aabbs_capacity = 0;    //!< Capacity of m_hard_aabbs
+    Scalar m_hard_aabb_tree_build_cost = 0;    //!< Cost of m_hard_aabb_tree when it was last built
+    uint64_t m_hard_aabb_tree_version = UINT64_MAX; //!< m_aabb_tree_version of m_hard_aabb_tree
+    uint64_t m_hard_aabb_tree_build_version
+        = UINT64_MAX; //!< m_aabb_tree_build_version of m_hard_aabb_tree
+
+    hoomd::detail::AABBGrid m_aabb_grid;  //!< Uniform grid for overlap checks of similar shapes
+    std::vector<unsigned int> m_grid_hits; //!< Overlap candidates found in the AABB grid
+    std::vector<Scalar> m_batch_dx;        //!< x separations of the overlap candidates
+    std::vector<Scalar> m_batch_dy;        //!< y separations of the overlap candidates
+    std::vector<Scalar> m_batch_dz;        //!< z separations of the overlap candidates
+    std::vector<LongReal> m_batch_r_cut_sq; //!< Squared circumsphere cutoffs (negative to skip)
+    std::vector<unsigned char> m_batch_candidate; //!< Candidates that pass the circumsphere test
+
+    bool m_separating_axis_cache; //!< True when trial moves cache separating axes
+    std::unordered_map<uint64_t, vec3<ShortReal>>
+        m_separating_axes; //!< Last separating axis of each pair of tags (lower tag first)
+
+    bool m_support_extent_tables; //!< True when trial moves use the extent tables
+    bool m_support_extent_tables_valid; //!< True when m_extent_tables match m_params
+    std::vector<detail::SupportExtentTable> m_extent_tables; //!< Extent table of each type
+
+    bool m_pair_energy_cache; //!< True when trial moves cache the pair energy of each particle
+    std::vector<LongReal> m_pair_energy; //!< Cached pair energy of each local particle
+    std::vector<unsigned char> m_pair_energy_valid; //!< True when m_pair_energy is up to date
+    std::vector<std::pair<unsigned int, LongReal>>
+        m_pair_energy_old; //!< Pair energies of the trial particle with local particles (old)
+    std::vector<std::pair<unsigned int, LongReal>>
+        m_pair_energy_new; //!< Pair energies of the trial particle with local particles (new)
+
+    bool m_checkerboard = false; //!< True when trial moves sweep a checkerboard of cells
+    bool m_checkerboard_warning_issued = false; //!< True when the serial fallback was reported
+    std::vector<unsigned int> m_checkerboard_cell;       //!< Cell of each local particle
+    std::vector<unsigned int> m_checkerboard_cell_start; //!< First particle of each cell
+    std::vector<unsigned int> m_checkerboard_particles;  //!< Local particles sorted by cell
+
+    //! Compute the pair energy of a particle with all of its neighbors
+    LongReal computeOneParticlePairEnergy(unsigned int i,
+                                          const vec3<Scalar>& pos_i,
+                                          const quat<LongReal>& orientation_i,
+                                          const hoomd::detail::AABB& aabb_i_local,
+                                          const Scalar4* postype,
+                                          const Scalar4* orientation,
+                                          const Scalar* diameter,
+                                          const Scalar* charge,
+                                          std::vector<std::pair<unsigned int, LongReal>>* pairs);
+
+    //! Test for overlap between a trial particle and a neighbor using the separating axis cache
+    bool testOverlapCached(const vec3<Scalar>& r_ij,
+                           const Shape& shape_i,
+                           const Shape& shape_j,
+                           unsigned int typ_i,
+                           unsigned int typ_j,
+                           unsigned int tag_i,
+                           unsigned int tag_j,
+                           unsigned int& err_count,
+                           bool use_axis_cache = true);
+
+    //! Perform the trial moves of one timestep on a checkerboard of cells
+    bool updateCheckerboard(uint64_t timestep);
 
     Index2D m_overlap_idx; //!!< Indexer for interaction matrix
 
@@ -364,6 +508,9 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
     //! Grow the m_aabbs list
     virtual void growAABBList(unsigned int N);
 
+    //! Build the tree of the shape AABBs for the trial moves with pair interactions (if needed)
+    void buildHardAABBTree();
+
     //! Limit the maximum move distances
     virtual void limitMoveDistances();
 
@@ -387,7 +534,7 @@ template<class Shape> class IntegratorHPMCMono : public IntegratorHPMC
 template<class Shape>
 IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition> sysdef)
     : IntegratorHPMC(sysdef), m_update_order(m_pdata->getN()), m_image_list_is_initialized(false),
-      m_image_list_valid(false), m_hasOrientation(true)
+      m_image_list_valid(false), m_hasOrientation(true), m_min_contact_ratio(0)
     {
     // allocate the parameter storage, setting the managed flag
     m_params = std::vector<param_type, hoomd::detail::managed_allocator<param_type>>(
@@ -418,6 +565,12 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
     m_aabbs = NULL;
     m_aabbs_capacity = 0;
     m_aabb_tree_invalid = true;
+    m_aabb_tree_moved = false;
+    m_aabb_tree_build_cost = 0;
+    m_separating_axis_cache = false;
+    m_support_extent_tables = false;
+    m_support_extent_tables_valid = false;
+    m_pair_energy_cache = false;
     }
 
 template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
@@ -436,17 +589,58 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     Scalar3 ghost_fraction = m_nominal_width / npd;
 #endif
 
+    // stale separating axes are harmless, limit the size of the cache instead of tracking them
+    if (m_separating_axes.size() > 32 * size_t(m_pdata->getN() + m_pdata->getNGhosts()))
+        m_separating_axes.clear();
+
     // Shuffle the order of particles for this step
     m_update_order.resize(m_pdata->getN());
     m_update_order.shuffle(timestep, m_sysdef->getSeed(), m_exec_conf->getRank());
 
-    // update the AABB Tree
-    buildAABBTree();
+    m_max_pair_additive_cutoff.clear();
+    m_shape_circumsphere_radius.clear();
+    for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+        {
+        quat<LongReal> q;
+        Shape shape(q, m_params[type]);
+        m_shape_circumsphere_radius.push_back(LongReal(0.5) * shape.getCircumsphereDiameter());
+        m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
+        }
+
+    if (HasSupportExtent<Shape>::value && m_support_extent_tables
+        && (!m_support_extent_tables_valid || m_extent_tables.size() != m_pdata->getNTypes()))
+        {
+        m_extent_tables.resize(m_pdata->getNTypes());
+        for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+            {
+            quat<LongReal> q;
+            Shape shape(q, m_params[type]);
+            m_extent_tables[type].build(shape, 16);
+            }
+        m_support_extent_tables_valid = true;
+        }
+
+    if (m_type_count.size() != m_pdata->getNTypes())
+        m_type_count.resize(m_pdata->getNTypes());
+
+    if (m_checkerboard && updateCheckerboard(timestep))
+        return;
+
+    // update the AABB grid, or the AABB Tree when the grid is not used
+    int64_t t_stage = m_clock.getTime();
+    bool use_grid = buildAABBGrid();
+    // with pair interactions, trial moves check overlaps in a tree of the unpadded shape AABBs
+    const bool use_hard_tree = !use_grid && hasPairInteractions();
+    if (!use_grid)
+        buildAABBTree();
+    if (use_hard_tree)
+        buildHardAABBTree();
     // limit m_d entries so that particles cannot possibly wander more than one box image in one
     // time step
     limitMoveDistances();
     // update the image list
     updateImageList();
+    m_stage_times.broadphase += m_clock.getTime() - t_stage;
 
     uint16_t seed = m_sysdef->getSeed();
 
@@ -459,15 +653,55 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
 
     const Scalar kT = this->getKT()->operator()(timestep);
 
-    m_max_pair_additive_cutoff.clear();
-    m_shape_circumsphere_radius.clear();
+    // Cached energies are only kept for the duration of one update. Other updaters, box changes,
+    // parameter changes and ghost communication all take place between updates.
+    const bool use_pair_energy_cache = m_pair_energy_cache && hasPairInteractions();
+    if (use_pair_energy_cache)
+        {
+        m_pair_energy.assign(m_pdata->getN(), 0);
+        m_pair_energy_valid.assign(m_pdata->getN(), 0);
+        }
+
+    // The periodic images of a query are culled against the extent of the particles in the
+    // broadphase in fractional coordinates of the global box, which stays tight in tilted boxes.
+    // Interactions are spherical, so a neighbor j in an image lies within the query radius plus
+    // the largest broadphase radius, which bounds its offset along each reciprocal direction.
+    const BoxDim global_box = m_pdata->getGlobalBox();
+    const Scalar3 global_npd = global_box.getNearestPlaneDistance();
+    LongReal max_broadphase_radius = 0;
     for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
         {
-        quat<LongReal> q;
-        Shape shape(q, m_params[type]);
-        m_shape_circumsphere_radius.push_back(LongReal(0.5) * shape.getCircumsphereDiameter());
-        m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
+        max_broadphase_radius
+            = std::max(max_broadphase_radius,
+                       std::max(m_shape_circumsphere_radius[type],
+                                LongReal(0.5) * m_max_pair_additive_cutoff[type]));
         }
+    vec3<Scalar> f_lower(0, 0, 0);
+    vec3<Scalar> f_upper(0, 0, 0);
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        const unsigned int n_broadphase = m_pdata->getN() + m_pdata->getNGhosts();
+        for (unsigned int i = 0; i < n_broadphase; i++)
+            {
+            vec3<Scalar> f = global_box.makeFraction(vec3<Scalar>(h_postype.data[i]));
+            if (i == 0)
+                f_lower = f_upper = f;
+            f_lower = vec3<Scalar>(std::min(f_lower.x, f.x),
+                                   std::min(f_lower.y, f.y),
+                                   std::min(f_lower.z, f.z));
+            f_upper = vec3<Scalar>(std::max(f_upper.x, f.x),
+                                   std::max(f_upper.y, f.y),
+                                   std::max(f_upper.z, f.z));
+            }
+        }
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+    m_image_active.resize(n_images);
+
+    // the energy evaluations are timed only when there are energies to evaluate
+    const bool has_external_potentials = m_external_potentials.size() > 0;
+    t_stage = m_clock.getTime();
 
     // loop over local particles nselect times
     for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
@@ -526,6 +760,7 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoTrialMove, timestep, seed),
                 hoomd::Counter(i, m_exec_conf->getRank(), i_nselect));
             int typ_i = __scalar_as_int(postype_i.w);
+            hpmc_counters_t& type_counters = m_type_count[typ_i];
             Shape shape_i(quat<LongReal>(h_orientation.data[i]), m_params[typ_i]);
             unsigned int move_type_select = hoomd::UniformIntDistribution(0xffff)(rng_i);
             bool move_type_translate
@@ -540,7 +775,10 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 if (h_d.data[typ_i] == 0.0)
                     {
                     if (!shape_i.ignoreStatistics())
+                        {
                         counters.translate_accept_count++;
+                        type_counters.translate_accept_count++;
+                        }
                     continue;
                     }
 
@@ -560,7 +798,10 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 if (h_a.data[typ_i] == 0.0)
                     {
                     if (!shape_i.ignoreStatistics())
+                        {
                         counters.rotate_accept_count++;
+                        type_counters.rotate_accept_count++;
+                        }
                     continue;
                     }
 
@@ -584,135 +825,156 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
 
             hoomd::detail::AABB aabb_i_local = hoomd::detail::AABB(vec3<Scalar>(0, 0, 0), R_query);
 
+            // flag the images whose shifted query reaches the extent of the particles
+                {
+                vec3<Scalar> f_i = global_box.makeFraction(pos_i);
+                Scalar reach = R_query + max_broadphase_radius;
+                vec3<Scalar> f_reach(reach / global_npd.x,
+                                     reach / global_npd.y,
+                                     reach / global_npd.z);
+                for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                    {
+                    const int3& hkl = m_image_hkl[cur_image];
+                    vec3<Scalar> f = f_i + vec3<Scalar>(hkl.x, hkl.y, hkl.z);
+                    bool active = f.x + f_reach.x >= f_lower.x && f.x - f_reach.x <= f_upper.x
+                                  && f.y + f_reach.y >= f_lower.y && f.y - f_reach.y <= f_upper.y;
+                    if (ndim == 3)
+                        active = active && f.z + f_reach.z >= f_lower.z
+                                 && f.z - f_reach.z <= f_upper.z;
+                    m_image_active[cur_image] = active;
+                    }
+                }
+
             // patch + field interaction deltaU
             double patch_field_energy_diff = 0;
 
+            // pair energy of the new configuration
+            LongReal pair_energy_new = 0;
+            if (use_pair_energy_cache)
+                m_pair_energy_new.clear();
+
             // check for overlaps with neighboring particle's positions (also calculate the new
-            // energy) All image boxes (including the primary)
-            const unsigned int n_images = (unsigned int)m_image_list.size();
-            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            // energy) All image boxes (including the primary). With the hard tree, the first stage
+            // checks overlaps in the tight tree and the second stage, reached only without an
+            // overlap, evaluates the pair energy in the padded tree.
+            const unsigned int n_stages = use_hard_tree ? 2 : 1;
+            for (unsigned int stage = 0; stage < n_stages && !overlap; stage++)
                 {
-                vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
-                hoomd::detail::AABB aabb = aabb_i_local;
-                aabb.translate(pos_i_image);
+                const bool check_overlaps = !use_hard_tree || stage == 0;
+                const bool compute_energy = !use_hard_tree || stage == 1;
+                const hoomd::detail::AABBTree& tree
+                    = use_hard_tree && stage == 0 ? m_hard_aabb_tree : m_aabb_tree;
+                const hoomd::detail::AABB aabb_stage_local
+                    = use_hard_tree && stage == 0
+                          ? hoomd::detail::AABB(vec3<Scalar>(0, 0, 0),
+                                                m_shape_circumsphere_radius[typ_i])
+                          : aabb_i_local;
 
-                // stackless search
-                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes();
-                     cur_node_idx++)
+                for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                     {
-                    if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
-                        {
-                        if (m_aabb_tree.isNodeLeaf(cur_node_idx))
-                            {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx);
-                                 cur_p++)
-                                {
-                                // read in its position and orientation
-                                unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
-
-                                Scalar4 postype_j;
-                                quat<LongReal> orientation_j;
-
-                                // handle j==i situations
-                                if (j != i)
-                                    {
-                                    // load the position and orientation of the j particle
-                                    postype_j = h_postype.data[j];
-                                    orientation_j = quat<LongReal>(h_orientation.data[j]);
-                                    }
-                                else
-                                    {
-                                    if (cur_image == 0)
-                                        {
-                                        // in the first image, skip i == j
-                                        continue;
-                                        }
-                                    else
-                                        {
-                                        // If this is particle i and we are in an outside image, use
-                                        // the translated position and orientation
-                                        postype_j
-                                            = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
-                                        orientation_j = shape_i.orientation;
-                                        }
-                                    }
-
-                                // put particles in coordinate system of particle i
-                                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                    if (!m_image_active[cur_image])
+                        continue;
 
-                                unsigned int typ_j = __scalar_as_int(postype_j.w);
-                                Shape shape_j(orientation_j, m_params[typ_j]);
+                    vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+                    hoomd::detail::AABB aabb = aabb_stage_local;
+                    aabb.translate(pos_i_image);
 
-                                LongReal r_squared = dot(r_ij, r_ij);
-                                LongReal max_overlap_distance
-                                    = m_shape_circumsphere_radius[typ_i]
-                                      + m_shape_circumsphere_radius[typ_j];
+                    if (use_grid)
+                        {
+                        // the grid is only used without pair interactions, check overlaps only
+                        m_grid_hits.clear();
+                        m_aabb_grid.query(m_grid_hits, aabb);
+                        const unsigned int n_hits = (unsigned int)m_grid_hits.size();
+                        m_batch_dx.resize(n_hits);
+                        m_batch_dy.resize(n_hits);
+                        m_batch_dz.resize(n_hits);
+                        m_batch_r_cut_sq.resize(n_hits);
+                        m_batch_candidate.resize(n_hits);
+
+                        // gather the separations and circumsphere cutoffs of all candidates
+                        for (unsigned int cur_hit = 0; cur_hit < n_hits; cur_hit++)
+                            {
+                            unsigned int j = m_grid_hits[cur_hit];
 
+                            // particle i interacts with its own images at the trial position
+                            Scalar4 postype_j = h_postype.data[j];
+                            if (j == i)
+                                postype_j = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
+                            unsigned int typ_j = __scalar_as_int(postype_j.w);
+                            m_batch_dx[cur_hit] = postype_j.x - pos_i_image.x;
+                            m_batch_dy[cur_hit] = postype_j.y - pos_i_image.y;
+                            m_batch_dz[cur_hit] = postype_j.z - pos_i_image.z;
+
+                            LongReal max_overlap_distance = m_shape_circumsphere_radius[typ_i]
+                                                            + m_shape_circumsphere_radius[typ_j];
+                            bool check = h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                                         && (j != i || cur_image != 0);
+                            m_batch_r_cut_sq[cur_hit] = check
+                                                            ? max_overlap_distance
+                                                                  * max_overlap_distance
+                                                            : LongReal(-1.0);
+                            if (j != i || cur_image != 0)
                                 counters.overlap_checks++;
-                                if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
-                                    && r_squared < max_overlap_distance * max_overlap_distance
-                                    && test_overlap(r_ij,
-                                                    shape_i,
-                                                    shape_j,
-                                                    counters.overlap_err_count))
-                                    {
-                                    overlap = true;
-                                    break;
-                                    }
+                            }
 
-                                // deltaU = U_old - U_new: subtract energy of new configuration
-                                patch_field_energy_diff -= computeOnePairEnergy(r_squared,
-                                                                                r_ij,
-                                                                                typ_i,
-                                                                                shape_i.orientation,
-                                                                                h_diameter.data[i],
-                                                                                h_charge.data[i],
-                                                                                typ_j,
-                                                                                shape_j.orientation,
-                                                                                h_diameter.data[j],
-                                                                                h_charge.data[j]);
-                                }
+                        // circumsphere tests of all candidates in one branch free loop
+                        for (unsigned int cur_hit = 0; cur_hit < n_hits; cur_hit++)
+                            {
+                            LongReal r_squared = m_batch_dx[cur_hit] * m_batch_dx[cur_hit]
+                                                 + m_batch_dy[cur_hit] * m_batch_dy[cur_hit]
+                                                 + m_batch_dz[cur_hit] * m_batch_dz[cur_hit];
+                            m_batch_candidate[cur_hit] = r_squared < m_batch_r_cut_sq[cur_hit];
                             }
-                        }
-                    else
-                        {
-                        // skip ahead
-                        cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
-                        }
 
-                    if (overlap)
-                        break;
-                    } // end loop over AABB nodes
+                        // exact tests of the remaining candidates, stopping at the first overlap
+                        for (unsigned int cur_hit = 0; cur_hit < n_hits; cur_hit++)
+                            {
+                            if (!m_batch_candidate[cur_hit])
+                                continue;
 
-                if (overlap)
-                    break;
-                } // end loop over images
+                            unsigned int j = m_grid_hits[cur_hit];
+                            quat<LongReal> orientation_j
+                                = (j != i) ? quat<LongReal>(h_orientation.data[j])
+                                           : shape_i.orientation;
+                            unsigned int typ_j = __scalar_as_int(h_postype.data[j].w);
+                            Shape shape_j(orientation_j, m_params[typ_j]);
+
+                            vec3<Scalar> r_ij(m_batch_dx[cur_hit],
+                                              m_batch_dy[cur_hit],
+                                              m_batch_dz[cur_hit]);
+                            if (testOverlapCached(r_ij,
+                                                  shape_i,
+                                                  shape_j,
+                                                  typ_i,
+                                                  typ_j,
+                                                  h_tag.data[i],
+                                                  h_tag.data[j],
+                                                  counters.overlap_err_count))
+                                {
+                                overlap = true;
+                                break;
+                                }
+                            }
 
-            // Calculate old pair energy only when there are pair energies to calculate.
-            if (hasPairInteractions() && !overlap)
-                {
-                for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-                    {
-                    vec3<Scalar> pos_i_image = pos_old + m_image_list[cur_image];
-                    hoomd::detail::AABB aabb = aabb_i_local;
-                    aabb.translate(pos_i_image);
+                        if (overlap)
+                            break;
+                        continue;
+                        }
 
                     // stackless search
-                    for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes();
+                    for (unsigned int cur_node_idx = 0; cur_node_idx < tree.getNumNodes();
                          cur_node_idx++)
                         {
-                        if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                        if (aabb.overlaps(tree.getNodeAABB(cur_node_idx)))
                             {
-                            if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                            if (tree.isNodeLeaf(cur_node_idx))
                                 {
                                 for (unsigned int cur_p = 0;
-                                     cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx);
+                                     cur_p < tree.getNodeNumParticles(cur_node_idx);
                                      cur_p++)
                                     {
                                     // read in its position and orientation
-                                    unsigned int j
-                                        = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+                                    unsigned int j = tree.getNodeParticle(cur_node_idx, cur_p);
 
                                     Scalar4 postype_j;
                                     quat<LongReal> orientation_j;
@@ -733,64 +995,136 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                             }
                                         else
                                             {
-                                            // If this is particle i and we are in an outside image,
-                                            // use the translated position and orientation
-                                            postype_j = make_scalar4(pos_old.x,
-                                                                     pos_old.y,
-                                                                     pos_old.z,
+                                            // If this is particle i and we are in an outside
+                                            // image, use the translated position and orientation
+                                            postype_j = make_scalar4(pos_i.x,
+                                                                     pos_i.y,
+                                                                     pos_i.z,
                                                                      postype_i.w);
-                                            orientation_j = shape_old.orientation;
+                                            orientation_j = shape_i.orientation;
                                             }
                                         }
 
                                     // put particles in coordinate system of particle i
                                     vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+
                                     unsigned int typ_j = __scalar_as_int(postype_j.w);
                                     Shape shape_j(orientation_j, m_params[typ_j]);
 
-                                    // deltaU = U_old - U_new: add energy of old configuration
-                                    patch_field_energy_diff
-                                        += computeOnePairEnergy(dot(r_ij, r_ij),
-                                                                r_ij,
-                                                                typ_i,
-                                                                shape_old.orientation,
-                                                                h_diameter.data[i],
-                                                                h_charge.data[i],
-                                                                typ_j,
-                                                                shape_j.orientation,
-                                                                h_diameter.data[j],
-                                                                h_charge.data[j]);
+                                    LongReal r_squared = dot(r_ij, r_ij);
+                                    LongReal max_overlap_distance
+                                        = m_shape_circumsphere_radius[typ_i]
+                                          + m_shape_circumsphere_radius[typ_j];
+
+                                    if (check_overlaps)
+                                        counters.overlap_checks++;
+                                    if (check_overlaps
+                                        && h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                                        && r_squared < max_overlap_distance * max_overlap_distance
+                                        && testOverlapCached(r_ij,
+                                                             shape_i,
+                                                             shape_j,
+                                                             typ_i,
+                                                             typ_j,
+                                                             h_tag.data[i],
+                                                             h_tag.data[j],
+                                                             counters.overlap_err_count))
+                                        {
+                                        overlap = true;
+                                        break;
+                                        }
+
+                                    if (!compute_energy)
+                                        continue;
+
+                                    // deltaU = U_old - U_new: subtract energy of new configuration
+                                    LongReal u_ij = computeOnePairEnergy(r_squared,
+                                                                         r_ij,
+                                                                         typ_i,
+                                                                         shape_i.orientation,
+                                                                         h_diameter.data[i],
+                                                                         h_charge.data[i],
+                                                                         typ_j,
+                                                                         shape_j.orientation,
+                                                                         h_diameter.data[j],
+                                                                         h_charge.data[j]);
+                                    pair_energy_new += u_ij;
+                                    if (use_pair_energy_cache && j != i && j < m_pdata->getN()
+                                        && u_ij != 0)
+                                        {
+                                        m_pair_energy_new.push_back(std::make_pair(j, u_ij));
+                                        }
                                     }
                                 }
                             }
                         else
                             {
                             // skip ahead
-                            cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                            cur_node_idx += tree.getNodeSkip(cur_node_idx);
                             }
+
+                        if (overlap)
+                            break;
                         } // end loop over AABB nodes
+
+                    if (overlap)
+                        break;
                     } // end loop over images
+                } // end loop over stages
+
+            patch_field_energy_diff -= pair_energy_new;
+
+            // Calculate old pair energy only when there are pair energies to calculate.
+            bool pair_energy_old_recorded = false;
+            if (hasPairInteractions() && !overlap)
+                {
+                if (use_pair_energy_cache && m_pair_energy_valid[i])
+                    {
+                    patch_field_energy_diff += m_pair_energy[i];
+                    }
+                else
+                    {
+                    int64_t t_pair = m_clock.getTime();
+
+                    // deltaU = U_old - U_new: add energy of old configuration
+                    LongReal pair_energy_old = computeOneParticlePairEnergy(
+                        i,
+                        pos_old,
+                        shape_old.orientation,
+                        aabb_i_local,
+                        h_postype.data,
+                        h_orientation.data,
+                        h_diameter.data,
+                        h_charge.data,
+                        use_pair_energy_cache ? &m_pair_energy_old : nullptr);
+                    patch_field_energy_diff += pair_energy_old;
+                    m_stage_times.pair_energy += m_clock.getTime() - t_pair;
+
+                    if (use_pair_energy_cache)
+                        {
+                        m_pair_energy[i] = pair_energy_old;
+                        m_pair_energy_valid[i] = 1;
+                        pair_energy_old_recorded = true;
+                        }
+                    }
                 }
 
             // Add external energetic contribution if there are no overlaps
-            if (!overlap)
+            if (!overlap && has_external_potentials)
                 {
+                int64_t t_external = m_clock.getTime();
+
                 // U_old - U_new
                 patch_field_energy_diff
-                    += this->computeOneExternalEnergy(timestep,
-                                                      h_tag.data[i],
-                                                      typ_i,
-                                                      pos_old,
-                                                      shape_old.orientation,
-                                                      h_charge.data[i],
-                                                      ExternalPotential::Trial::Old)
-                       - this->computeOneExternalEnergy(timestep,
-                                                        h_tag.data[i],
-                                                        typ_i,
-                                                        pos_i,
-                                                        shape_i.orientation,
-                                                        h_charge.data[i],
-                                                        ExternalPotential::Trial::New);
+                    += this->computeOneExternalEnergyDifference(timestep,
+                                                                h_tag.data[i],
+                                                                typ_i,
+                                                                pos_old,
+                                                                shape_old.orientation,
+                                                                pos_i,
+                                                                shape_i.orientation,
+                                                                h_charge.data[i]);
+                m_stage_times.external_energy += m_clock.getTime() - t_external;
                 }
 
             bool accept = !overlap
@@ -805,12 +1139,18 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 if (!shape_i.ignoreStatistics())
                     {
                     if (move_type_translate)
+                        {
                         counters.translate_accept_count++;
+                        type_counters.translate_accept_count++;
+                        }
                     else
+                        {
                         counters.rotate_accept_count++;
+                        type_counters.rotate_accept_count++;
+                        }
                     }
 
-                // update the position of the particle in the tree for future updates
+                // update the position of the particle in the broadphase for future updates
                 hoomd::detail::AABB aabb;
                 if (!hasPairInteractions())
                     {
@@ -823,47 +1163,577 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     aabb = hoomd::detail::AABB(pos_i, radius);
                     }
 
-                m_aabb_tree.update(i, aabb);
+                if (use_grid)
+                    m_aabb_grid.update(i, aabb);
+                else
+                    m_aabb_tree.update(i, aabb);
+                if (use_hard_tree)
+                    m_hard_aabb_tree.update(i, shape_i.getAABB(pos_i));
+
+                // later queries cull their images against the new position too
+                vec3<Scalar> f_i = global_box.makeFraction(pos_i);
+                f_lower = vec3<Scalar>(std::min(f_lower.x, f_i.x),
+                                       std::min(f_lower.y, f_i.y),
+                                       std::min(f_lower.z, f_i.z));
+                f_upper = vec3<Scalar>(std::max(f_upper.x, f_i.x),
+                                       std::max(f_upper.y, f_i.y),
+                                       std::max(f_upper.z, f_i.z));
+
+                // move the pair energies of i with its neighbors from the old to the new
+                // configuration (i is still at its old position in h_postype)
+                if (use_pair_energy_cache)
+                    {
+                    if (!pair_energy_old_recorded)
+                        {
+                        int64_t t_pair = m_clock.getTime();
+                        computeOneParticlePairEnergy(i,
+                                                     pos_old,
+                                                     shape_old.orientation,
+                                                     aabb_i_local,
+                                                     h_postype.data,
+                                                     h_orientation.data,
+                                                     h_diameter.data,
+                                                     h_charge.data,
+                                                     &m_pair_energy_old);
+                        m_stage_times.pair_energy += m_clock.getTime() - t_pair;
+                        }
+                    for (const auto& pair : m_pair_energy_old)
+                        m_pair_energy[pair.first] -= pair.second;
+                    for (const auto& pair : m_pair_energy_new)
+                        m_pair_energy[pair.first] += pair.second;
+                    m_pair_energy[i] = pair_energy_new;
+                    }
 
                 // update position of particle
                 h_postype.data[i] = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
 
-                if (shape_i.hasOrientation())
-                    {
-                    h_orientation.data[i] = quat_to_scalar4(shape_i.orientation);
-                    }
-                }
-            else
-                {
-                if (!shape_i.ignoreStatistics())
-                    {
-                    // increment reject counter
-                    if (move_type_translate)
-                        counters.translate_reject_count++;
-                    else
-                        counters.rotate_reject_count++;
-                    }
-                }
-            } // end loop over all particles
-        } // end loop over nselect
+                if (shape_i.hasOrientation())
+                    {
+                    h_orientation.data[i] = quat_to_scalar4(shape_i.orientation);
+                    }
+                }
+            else
+                {
+                if (!shape_i.ignoreStatistics())
+                    {
+                    // increment reject counter
+                    if (move_type_translate)
+                        {
+                        counters.translate_reject_count++;
+                        type_counters.translate_reject_count++;
+                        }
+                    else
+                        {
+                        counters.rotate_reject_count++;
+                        type_counters.rotate_reject_count++;
+                        }
+                    }
+                }
+            } // end loop over all particles
+        } // end loop over nselect
+    m_stage_times.trial_moves += m_clock.getTime() - t_stage;
+
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+        // wrap particles back into box
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            box.wrap(h_postype.data[i], h_image.data[i]);
+            }
+        }
+
+// perform the grid shift
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+
+        // precalculate the grid shift
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoShift, timestep, this->m_sysdef->getSeed()),
+            hoomd::Counter());
+        Scalar3 shift = make_scalar3(0, 0, 0);
+        hoomd::UniformDistribution<Scalar> uniform(-m_nominal_width / Scalar(2.0),
+                                                   m_nominal_width / Scalar(2.0));
+        shift.x = uniform(rng);
+        shift.y = uniform(rng);
+        if (this->m_sysdef->getNDimensions() == 3)
+            {
+            shift.z = uniform(rng);
+            }
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            // read in the current position and orientation
+            Scalar4 postype_i = h_postype.data[i];
+            vec3<Scalar> r_i
+                = vec3<Scalar>(postype_i); // translation from local to global coordinates
+            r_i += vec3<Scalar>(shift);
+            h_postype.data[i] = vec_to_scalar4(r_i, postype_i.w);
+            box.wrap(h_postype.data[i], h_image.data[i]);
+            }
+        this->m_pdata->translateOrigin(shift);
+        }
+#endif
+
+    // migrate and exchange particles
+    t_stage = m_clock.getTime();
+    communicate(true);
+    m_stage_times.communicate += m_clock.getTime() - t_stage;
+
+    // all particle have been moved, the aabb tree needs to be refit (communicate() invalidates it
+    // when particles migrate). The tree was not updated with the moves when the grid was used.
+    m_aabb_tree_moved = true;
+    if (use_grid)
+        m_aabb_tree_invalid = true;
+
+    // set current MPS value
+    hpmc_counters_t run_counters = getCounters(1);
+    double cur_time = double(m_clock.getTime()) / Scalar(1e9);
+    m_mps = double(run_counters.getNMoves()) / cur_time;
+    }
+
+/*! \param timestep Current time step
+    \returns false, without changing the system, when the checkerboard does not apply
+
+    The box is divided into a grid of cells that are at least as wide as the longest interaction,
+    with an even number of cells in each direction. The grid is shifted randomly at every timestep.
+    The cells form 4 (2D) or 8 (3D) sets in a checkerboard pattern, like the cell sets of the GPU
+    implementation. The cells of one set share no neighbors, so the thread pool sweeps them
+    concurrently while the particles of the other sets stay in place. Each thread moves the
+    particles of its cells in the shuffled update order.
+
+    Trial moves that would take a particle out of its cell are skipped and not counted, as are moves
+    into the ghost layer in the serial sweep. Each particle draws the same random numbers as in the
+    serial sweep, so the result does not depend on the number of threads.
+
+    The checkerboard requires a single domain and at least 2 cells in each direction. Otherwise,
+    update() falls back to the serial sweep.
+*/
+template<class Shape> bool IntegratorHPMCMono<Shape>::updateCheckerboard(uint64_t timestep)
+    {
+    const BoxDim box = m_pdata->getBox();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_types = m_pdata->getNTypes();
+
+    // particles in different cells of one set are at least one cell width apart
+    Scalar width = getMaxCoreDiameter();
+    if (hasPairInteractions())
+        {
+        LongReal max_additive_cutoff = 0;
+        for (unsigned int type = 0; type < n_types; type++)
+            max_additive_cutoff = std::max(max_additive_cutoff, m_max_pair_additive_cutoff[type]);
+        width = std::max(width, Scalar(getMaxPairEnergyRCutNonAdditive() + max_additive_cutoff));
+        }
+
+    // limit the number of cells to about the number of particles
+    width = std::max(width,
+                     slow::pow(box.getVolume(ndim == 2) / Scalar(std::max(N, 1u)),
+                               Scalar(1.0) / Scalar(ndim)));
+
+    // an even number of cells keeps the checkerboard consistent across the periodic boundaries
+    const Scalar3 npd = box.getNearestPlaneDistance();
+    uint3 dim = make_uint3((unsigned int)(npd.x / width),
+                           (unsigned int)(npd.y / width),
+                           ndim == 3 ? (unsigned int)(npd.z / width) : 1);
+    dim.x -= dim.x % 2;
+    dim.y -= dim.y % 2;
+    if (ndim == 3)
+        dim.z -= dim.z % 2;
+
+    bool applies = dim.x >= 2 && dim.y >= 2 && dim.z >= ndim - 1;
+#ifdef ENABLE_MPI
+    applies = applies && !m_sysdef->isDomainDecomposed();
+#endif
+    if (!applies)
+        {
+        if (!m_checkerboard_warning_issued)
+            {
+            m_exec_conf->msg->warning()
+                << "hpmc: The checkerboard sweep requires a single domain and 2 cells of width "
+                << width << " in each direction of the box, using the serial sweep." << std::endl;
+            m_checkerboard_warning_issued = true;
+            }
+        return false;
+        }
+
+    int64_t t_stage = m_clock.getTime();
+    limitMoveDistances();
+
+    const uint16_t seed = m_sysdef->getSeed();
+    hoomd::RandomGenerator rng_grid(
+        hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoCheckerboard, timestep, seed),
+        hoomd::Counter());
+    Scalar3 offset = make_scalar3(0, 0, 0);
+    offset.x = hoomd::detail::generate_canonical<Scalar>(rng_grid);
+    offset.y = hoomd::detail::generate_canonical<Scalar>(rng_grid);
+    if (ndim == 3)
+        offset.z = hoomd::detail::generate_canonical<Scalar>(rng_grid);
+
+    // cell coordinates of a position, not wrapped into the grid
+    auto cell_coordinates = [&](const vec3<Scalar>& r)
+    {
+        const Scalar3 f = box.makeFraction(vec_to_scalar3(r));
+        return make_int3(int(slow::floor(f.x * Scalar(dim.x) + offset.x)),
+                         int(slow::floor(f.y * Scalar(dim.y) + offset.y)),
+                         ndim == 3 ? int(slow::floor(f.z * Scalar(dim.z) + offset.z)) : 0);
+    };
+
+    const Index3D cell_indexer(dim.x, dim.y, dim.z);
+    const unsigned int n_cells = cell_indexer.getNumElements();
+
+    // sort the particles by cell, keeping the shuffled order within each cell
+    m_checkerboard_cell.resize(N);
+    m_checkerboard_particles.resize(N);
+    m_checkerboard_cell_start.assign(n_cells + 1, 0);
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const int3 c = cell_coordinates(vec3<Scalar>(h_postype.data[i]));
+            const unsigned int cell
+                = cell_indexer((c.x % int(dim.x) + int(dim.x)) % int(dim.x),
+                               (c.y % int(dim.y) + int(dim.y)) % int(dim.y),
+                               (c.z % int(dim.z) + int(dim.z)) % int(dim.z));
+            m_checkerboard_cell[i] = cell;
+            m_checkerboard_cell_start[cell + 1]++;
+            }
+        }
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        m_checkerboard_cell_start[cell + 1] += m_checkerboard_cell_start[cell];
+    for (unsigned int cur_particle = 0; cur_particle < N; cur_particle++)
+        {
+        const unsigned int i = m_update_order[cur_particle];
+        m_checkerboard_particles[m_checkerboard_cell_start[m_checkerboard_cell[i]]++] = i;
+        }
+    // the fill advanced each start to the start of the next cell
+    for (unsigned int cell = n_cells; cell > 0; cell--)
+        m_checkerboard_cell_start[cell] = m_checkerboard_cell_start[cell - 1];
+    m_checkerboard_cell_start[0] = 0;
+
+    // the neighbors of a cell, visited once each also when there are only 2 cells in a direction
+    const int3 first_offset
+        = make_int3(dim.x > 2 ? -1 : 0, dim.y > 2 ? -1 : 0, dim.z > 2 ? -1 : 0);
+    const int3 last_offset = make_int3(1, 1, ndim == 3 ? 1 : 0);
+    auto for_each_neighbor = [&](const uint3& c, auto f)
+    {
+        for (int dz = first_offset.z; dz <= last_offset.z; dz++)
+            for (int dy = first_offset.y; dy <= last_offset.y; dy++)
+                for (int dx = first_offset.x; dx <= last_offset.x; dx++)
+                    {
+                    const unsigned int cell
+                        = cell_indexer((int(c.x) + dx + int(dim.x)) % int(dim.x),
+                                       (int(c.y) + dy + int(dim.y)) % int(dim.y),
+                                       (int(c.z) + dz + int(dim.z)) % int(dim.z));
+                    for (unsigned int p = m_checkerboard_cell_start[cell];
+                         p < m_checkerboard_cell_start[cell + 1];
+                         p++)
+                        {
+                        if (f(m_checkerboard_particles[p]))
+                            return;
+                        }
+                    }
+    };
+    m_stage_times.broadphase += m_clock.getTime() - t_stage;
+
+    const unsigned int n_sets = ndim == 3 ? 8 : 4;
+    const Index3D set_indexer(dim.x / 2, dim.y / 2, ndim == 3 ? dim.z / 2 : 1);
+    const unsigned int n_set_cells = set_indexer.getNumElements();
+
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    const unsigned int n_threads = pool.getNumThreads();
+    std::vector<hpmc_counters_t> thread_counters(n_threads);
+    std::vector<hpmc_counters_t> thread_type_counters(size_t(n_threads) * n_types);
+
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+    const Scalar kT = this->getKT()->operator()(timestep);
+    const bool has_external_potentials = m_external_potentials.size() > 0;
+    const bool has_pair_interactions = hasPairInteractions();
+
+    t_stage = m_clock.getTime();
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                     access_location::host,
+                                     access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
+
+        // pair energy of particle i at the given position and orientation with its neighbors
+        auto pair_energy = [&](unsigned int i,
+                               const uint3& c,
+                               const vec3<Scalar>& pos_i,
+                               const quat<LongReal>& orientation_i)
+        {
+            const unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
+            LongReal energy = 0;
+            for_each_neighbor(c,
+                              [&](unsigned int j)
+                              {
+                                  if (j == i)
+                                      return false;
+                                  const Scalar4 postype_j = h_postype.data[j];
+                                  const vec3<Scalar> r_ij
+                                      = box.minImage(vec3<Scalar>(postype_j) - pos_i);
+                                  energy += computeOnePairEnergy(
+                                      dot(r_ij, r_ij),
+                                      r_ij,
+                                      typ_i,
+                                      orientation_i,
+                                      h_diameter.data[i],
+                                      h_charge.data[i],
+                                      __scalar_as_int(postype_j.w),
+                                      quat<LongReal>(h_orientation.data[j]),
+                                      h_diameter.data[j],
+                                      h_charge.data[j]);
+                                  return false;
+                              });
+            return energy;
+        };
+
+        for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
+            {
+            // sweep the sets in a random order
+            unsigned int set_order[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+            for (unsigned int s = n_sets - 1; s > 0; s--)
+                std::swap(set_order[s], set_order[hoomd::UniformIntDistribution(s)(rng_grid)]);
+
+            for (unsigned int cur_set = 0; cur_set < n_sets; cur_set++)
+                {
+                const unsigned int set = set_order[cur_set];
+                pool.parallelFor(
+                    n_set_cells,
+                    [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+                    {
+                        hpmc_counters_t& counters = thread_counters[thread_id];
+                        for (unsigned int set_cell = begin; set_cell < end; set_cell++)
+                            {
+                            const uint3 t = set_indexer.getTriple(set_cell);
+                            const uint3 c = make_uint3(2 * t.x + (set & 1),
+                                                       2 * t.y + ((set >> 1) & 1),
+                                                       ndim == 3 ? 2 * t.z + ((set >> 2) & 1) : 0);
+                            const unsigned int cell = cell_indexer(c.x, c.y, c.z);
+                            for (unsigned int p = m_checkerboard_cell_start[cell];
+                                 p < m_checkerboard_cell_start[cell + 1];
+                                 p++)
+                                {
+                                const unsigned int i = m_checkerboard_particles[p];
+                                Scalar4 postype_i = h_postype.data[i];
+                                vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+                                // make a trial move for i
+                                hoomd::RandomGenerator rng_i(
+                                    hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoTrialMove,
+                                                timestep,
+                                                seed),
+                                    hoomd::Counter(i, m_exec_conf->getRank(), i_nselect));
+                                int typ_i = __scalar_as_int(postype_i.w);
+                                hpmc_counters_t& type_counters
+                                    = thread_type_counters[size_t(thread_id) * n_types + typ_i];
+                                Shape shape_i(quat<LongReal>(h_orientation.data[i]),
+                                              m_params[typ_i]);
+                                unsigned int move_type_select
+                                    = hoomd::UniformIntDistribution(0xffff)(rng_i);
+                                bool move_type_translate
+                                    = !shape_i.hasOrientation()
+                                      || (move_type_select < m_translation_move_probability);
+
+                                Shape shape_old(shape_i.orientation, m_params[typ_i]);
+                                vec3<Scalar> pos_old = pos_i;
+
+                                if (move_type_translate)
+                                    {
+                                    if (h_d.data[typ_i] == 0.0)
+                                        {
+                                        if (!shape_i.ignoreStatistics())
+                                            {
+                                            counters.translate_accept_count++;
+                                            type_counters.translate_accept_count++;
+                                            }
+                                        continue;
+                                        }
+
+                                    move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
+
+                                    // the particle must stay in its cell
+                                    const int3 c_old = cell_coordinates(pos_old);
+                                    const int3 c_new = cell_coordinates(pos_i);
+                                    if (c_old.x != c_new.x || c_old.y != c_new.y
+                                        || c_old.z != c_new.z)
+                                        continue;
+                                    }
+                                else
+                                    {
+                                    if (h_a.data[typ_i] == 0.0)
+                                        {
+                                        if (!shape_i.ignoreStatistics())
+                                            {
+                                            counters.rotate_accept_count++;
+                                            type_counters.rotate_accept_count++;
+                                            }
+                                        continue;
+                                        }
+
+                                    if (ndim == 2)
+                                        move_rotate<2>(shape_i.orientation,
+                                                       rng_i,
+                                                       h_a.data[typ_i]);
+                                    else
+                                        move_rotate<3>(shape_i.orientation,
+                                                       rng_i,
+                                                       h_a.data[typ_i]);
+                                    }
+
+                                // check for overlaps with the particles in the neighboring cells
+                                bool overlap = false;
+                                for_each_neighbor(
+                                    c,
+                                    [&](unsigned int j)
+                                    {
+                                        if (j == i)
+                                            return false;
+                                        const Scalar4 postype_j = h_postype.data[j];
+                                        const unsigned int typ_j = __scalar_as_int(postype_j.w);
+                                        const vec3<Scalar> r_ij
+                                            = box.minImage(vec3<Scalar>(postype_j) - pos_i);
+                                        const LongReal max_overlap_distance
+                                            = m_shape_circumsphere_radius[typ_i]
+                                              + m_shape_circumsphere_radius[typ_j];
+
+                                        counters.overlap_checks++;
+                                        if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                                            && dot(r_ij, r_ij)
+                                                   < max_overlap_distance * max_overlap_distance)
+                                            {
+                                            Shape shape_j(quat<LongReal>(h_orientation.data[j]),
+                                                          m_params[typ_j]);
+                                            overlap = testOverlapCached(r_ij,
+                                                                        shape_i,
+                                                                        shape_j,
+                                                                        typ_i,
+                                                                        typ_j,
+                                                                        h_tag.data[i],
+                                                                        h_tag.data[j],
+                                                                        counters.overlap_err_count,
+                                                                        false);
+                                            }
+                                        return overlap;
+                                    });
+
+                                // deltaU = U_old - U_new
+                                double patch_field_energy_diff = 0;
+                                if (has_pair_interactions && !overlap)
+                                    {
+                                    patch_field_energy_diff
+                                        += pair_energy(i, c, pos_old, shape_old.orientation)
+                                           - pair_energy(i, c, pos_i, shape_i.orientation);
+                                    }
+
+                                if (has_external_potentials && !overlap)
+                                    {
+                                    patch_field_energy_diff
+                                        += this->computeOneExternalEnergyDifference(
+                                            timestep,
+                                            h_tag.data[i],
+                                            typ_i,
+                                            pos_old,
+                                            shape_old.orientation,
+                                            pos_i,
+                                            shape_i.orientation,
+                                            h_charge.data[i]);
+                                    }
+
+                                bool accept = !overlap
+                                              && hoomd::detail::generate_canonical<double>(rng_i)
+                                                     < slow::exp(patch_field_energy_diff / kT);
+
+                                if (!shape_i.ignoreStatistics())
+                                    {
+                                    if (move_type_translate)
+                                        {
+                                        if (accept)
+                                            {
+                                            counters.translate_accept_count++;
+                                            type_counters.translate_accept_count++;
+                                            }
+                                        else
+                                            {
+                                            counters.translate_reject_count++;
+                                            type_counters.translate_reject_count++;
+                                            }
+                                        }
+                                    else
+                                        {
+                                        if (accept)
+                                            {
+                                            counters.rotate_accept_count++;
+                                            type_counters.rotate_accept_count++;
+                                            }
+                                        else
+                                            {
+                                            counters.rotate_reject_count++;
+                                            type_counters.rotate_reject_count++;
+                                            }
+                                        }
+                                    }
+
+                                if (accept)
+                                    {
+                                    h_postype.data[i]
+                                        = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
+                                    if (shape_i.hasOrientation())
+                                        {
+                                        h_orientation.data[i]
+                                            = quat_to_scalar4(shape_i.orientation);
+                                        }
+                                    }
+                                } // end loop over the particles of the cell
+                            }     // end loop over the cells of the set
+                    });
+                } // end loop over sets
+            }     // end loop over nselect
+        }
+    m_stage_times.trial_moves += m_clock.getTime() - t_stage;
 
+    // merge the counters in thread order
         {
-        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-        ArrayHandle<int3> h_image(m_pdata->getImages(),
-                                  access_location::host,
-                                  access_mode::readwrite);
-        // wrap particles back into box
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        ArrayHandle<hpmc_counters_t> h_counters(m_count_total,
+                                                access_location::host,
+                                                access_mode::readwrite);
+        for (unsigned int thread_id = 0; thread_id < n_threads; thread_id++)
             {
-            box.wrap(h_postype.data[i], h_image.data[i]);
+            h_counters.data[0] = h_counters.data[0] + thread_counters[thread_id];
+            for (unsigned int type = 0; type < n_types; type++)
+                {
+                m_type_count[type]
+                    = m_type_count[type] + thread_type_counters[size_t(thread_id) * n_types + type];
+                }
             }
         }
 
-// perform the grid shift
-#ifdef ENABLE_MPI
-    if (m_sysdef->isDomainDecomposed())
         {
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                        access_location::host,
@@ -871,44 +1741,25 @@ template<class Shape> void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
         ArrayHandle<int3> h_image(m_pdata->getImages(),
                                   access_location::host,
                                   access_mode::readwrite);
-
-        // precalculate the grid shift
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoShift, timestep, this->m_sysdef->getSeed()),
-            hoomd::Counter());
-        Scalar3 shift = make_scalar3(0, 0, 0);
-        hoomd::UniformDistribution<Scalar> uniform(-m_nominal_width / Scalar(2.0),
-                                                   m_nominal_width / Scalar(2.0));
-        shift.x = uniform(rng);
-        shift.y = uniform(rng);
-        if (this->m_sysdef->getNDimensions() == 3)
-            {
-            shift.z = uniform(rng);
-            }
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        // wrap particles back into box
+        for (unsigned int i = 0; i < N; i++)
             {
-            // read in the current position and orientation
-            Scalar4 postype_i = h_postype.data[i];
-            vec3<Scalar> r_i
-                = vec3<Scalar>(postype_i); // translation from local to global coordinates
-            r_i += vec3<Scalar>(shift);
-            h_postype.data[i] = vec_to_scalar4(r_i, postype_i.w);
             box.wrap(h_postype.data[i], h_image.data[i]);
             }
-        this->m_pdata->translateOrigin(shift);
         }
-#endif
 
-    // migrate and exchange particles
+    t_stage = m_clock.getTime();
     communicate(true);
+    m_stage_times.communicate += m_clock.getTime() - t_stage;
 
-    // all particle have been moved, the aabb tree is now invalid
+    // the tree was not updated with the moves
     m_aabb_tree_invalid = true;
 
     // set current MPS value
     hpmc_counters_t run_counters = getCounters(1);
     double cur_time = double(m_clock.getTime()) / Scalar(1e9);
     m_mps = double(run_counters.getNMoves()) / cur_time;
+    return true;
     }
 
 /*! \param timestep current step
@@ -937,6 +1788,10 @@ template<class Shape> unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool
     // access parameters and interaction matrix
     ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
 
+    // Record the closest neighbor of each particle, measured by the distance relative to the sum of
+    // the circumsphere radii. checkContactOverlaps() tests these pairs in later box moves.
+    std::vector<std::pair<Scalar, std::pair<unsigned int, unsigned int>>> contacts;
+
     // Loop over all particles
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         {
@@ -946,6 +1801,8 @@ template<class Shape> unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool
         unsigned int typ_i = __scalar_as_int(postype_i.w);
         Shape shape_i(quat<Scalar>(orientation_i), m_params[typ_i]);
         vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+        Scalar contact_i = std::numeric_limits<Scalar>::max();
+        unsigned int contact_tag_j = 0;
 
         // Check particle against AABB tree for neighbors
         hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
@@ -985,6 +1842,20 @@ template<class Shape> unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool
                             unsigned int typ_j = __scalar_as_int(postype_j.w);
                             Shape shape_j(quat<Scalar>(orientation_j), m_params[typ_j]);
 
+                            Scalar R_ij = Scalar(0.5)
+                                          * (shape_i.getCircumsphereDiameter()
+                                             + shape_j.getCircumsphereDiameter());
+                            if (h_tag.data[i] < h_tag.data[j]
+                                && h_overlaps.data[m_overlap_idx(typ_i, typ_j)] && R_ij > 0)
+                                {
+                                Scalar contact = dot(r_ij, r_ij) / (R_ij * R_ij);
+                                if (contact < contact_i)
+                                    {
+                                    contact_i = contact;
+                                    contact_tag_j = h_tag.data[j];
+                                    }
+                                }
+
                             if (h_tag.data[i] <= h_tag.data[j]
                                 && h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
                                 && check_circumsphere_overlap(r_ij, shape_i, shape_j)
@@ -1019,12 +1890,32 @@ template<class Shape> unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool
                 }
             } // end loop over images
 
+        if (contact_i < std::numeric_limits<Scalar>::max())
+            {
+            contacts.push_back(
+                std::make_pair(contact_i, std::make_pair(h_tag.data[i], contact_tag_j)));
+            }
+
         if (overlap_count && early_exit)
             {
             break;
             }
         } // end loop over particles
 
+    // the contacts are only meaningful in configurations without overlaps
+    m_min_contact_ratio = 0;
+    if (overlap_count == 0)
+        {
+        std::sort(contacts.begin(), contacts.end());
+        m_contact_pairs.resize(contacts.size());
+        for (size_t k = 0; k < contacts.size(); k++)
+            {
+            m_contact_pairs[k] = contacts[k].second;
+            }
+        m_min_contact_ratio = contacts.size() > 0 ? slow::sqrt(contacts[0].first)
+                                                  : std::numeric_limits<Scalar>::max();
+        }
+
 #ifdef ENABLE_MPI
     if (this->m_pdata->getDomainDecomposition())
         {
@@ -1042,6 +1933,96 @@ template<class Shape> unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool
     return overlap_count;
     }
 
+/*! The ratio is computed by countOverlaps() from the closest neighbor of each particle within its
+    AABB, so pairs further apart than their AABBs are not considered. In MPI simulations, the
+    result is the minimum over all ranks.
+*/
+template<class Shape> Scalar IntegratorHPMCMono<Shape>::getMinContactRatio()
+    {
+    Scalar result = m_min_contact_ratio;
+#ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &result,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_MIN,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return result;
+    }
+
+/*! \returns true if any of the pairs closest to contact overlap in the current configuration
+
+    Tests the pairs recorded by the last overlap free countOverlaps(), closest first, and stops at
+    the first overlap. The pairs are identified by tag, so the particles may have been sorted or
+    scaled since, but pairs with particles that are no longer present locally are skipped. The
+    minimum image of one particle is tested against the other, so every overlap found is a real
+    overlap.
+*/
+template<class Shape> bool IntegratorHPMCMono<Shape>::checkContactOverlaps()
+    {
+    bool overlap = false;
+    unsigned int err_count = 0;
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N_total = m_pdata->getN() + m_pdata->getNGhosts();
+    const unsigned int max_tag = m_pdata->getMaximumTag();
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    for (const auto& pair : m_contact_pairs)
+        {
+        if (pair.first > max_tag || pair.second > max_tag)
+            continue;
+
+        unsigned int i = h_rtag.data[pair.first];
+        unsigned int j = h_rtag.data[pair.second];
+        if (i >= N_total || j >= N_total)
+            continue;
+
+        Scalar4 postype_i = h_postype.data[i];
+        Scalar4 postype_j = h_postype.data[j];
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+        unsigned int typ_j = __scalar_as_int(postype_j.w);
+        Shape shape_i(quat<Scalar>(h_orientation.data[i]), m_params[typ_i]);
+        Shape shape_j(quat<Scalar>(h_orientation.data[j]), m_params[typ_j]);
+
+        vec3<Scalar> r_ij = vec3<Scalar>(
+            box.minImage(vec_to_scalar3(vec3<Scalar>(postype_j) - vec3<Scalar>(postype_i))));
+
+        if (check_circumsphere_overlap(r_ij, shape_i, shape_j)
+            && test_overlap(r_ij, shape_i, shape_j, err_count)
+            && test_overlap(-r_ij, shape_j, shape_i, err_count))
+            {
+            overlap = true;
+            break;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &overlap,
+                      1,
+                      MPI_CXX_BOOL,
+                      MPI_LOR,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return overlap;
+    }
+
 template<class Shape> double IntegratorHPMCMono<Shape>::computeTotalPairEnergy(uint64_t timestep)
     {
     return computePairEnergy(timestep);
@@ -1150,14 +2131,14 @@ double IntegratorHPMCMono<Shape>::computePairEnergy(uint64_t timestep,
                                     if (r_squared
                                         < selected_pair->getRCutSquaredTotal(typ_i, typ_j))
                                         {
-                                        energy += selected_pair->energy(r_squared,
-                                                                        r_ij,
-                                                                        typ_i,
-                                                                        orientation_i,
-                                                                        h_charge.data[i],
-                                                                        typ_j,
-                                                                        orientation_j,
-                                                                        h_charge.data[j]);
+                                        energy += selected_pair->evaluate(r_squared,
+                                                                          r_ij,
+                                                                          typ_i,
+                                                                          orientation_i,
+                                                                          h_charge.data[i],
+                                                                          typ_j,
+                                                                          orientation_j,
+                                                                          h_charge.data[j]);
                                         }
                                     }
                                 else
@@ -1286,6 +2267,7 @@ void IntegratorHPMCMono<Shape>::setParam(unsigned int typ, const param_type& par
         // update the parameter for this type
         m_exec_conf->msg->notice(7) << "setParam : " << typ << std::endl;
         m_params[typ] = param;
+        m_support_extent_tables_valid = false;
         }
 
     updateCellWidth();
@@ -1407,14 +2389,29 @@ inline const std::vector<vec3<Scalar>>& IntegratorHPMCMono<Shape>::updateImageLi
 
     m_exec_conf->msg->notice(6) << "Image list: range = " << range << std::endl;
 
+    // An image box that overlaps the swept central box has its center within range plus the
+    // box diameter of the origin. In tilted boxes, a shell of images may miss the swept box while
+    // an outer shell does not, so continue out to the shell that bounds this distance along each
+    // reciprocal lattice direction.
+    Scalar box_radius_sq = detail::max(detail::max(dot(e1 + e2 + e3, e1 + e2 + e3),
+                                                   dot(e1 + e2 - e3, e1 + e2 - e3)),
+                                       detail::max(dot(e1 - e2 + e3, e1 - e2 + e3),
+                                                   dot(-e1 + e2 + e3, -e1 + e2 + e3)))
+                           * Scalar(0.25);
+    Scalar reach = range + Scalar(2.0) * slow::sqrt(box_radius_sq);
+    Scalar3 npd = box.getNearestPlaneDistance();
+    int hkl_bound = int(reach / detail::min(npd.x, npd.y));
+    if (ndim == 3)
+        hkl_bound = detail::max(hkl_bound, int(reach / npd.z));
+
     // initialize loop
     // start in the middle and add image boxes going out, one index at a time until no more
-    // images are added to the list
+    // images are added to the list and all shells within reach have been checked
     int3 hkl;
     bool added_images = true;
     int hkl_max = 0;
     const int crazybig = 30;
-    while (added_images == true)
+    while (added_images == true || hkl_max <= hkl_bound)
         {
         added_images = false;
 
@@ -1586,6 +2583,10 @@ template<class Shape> void IntegratorHPMCMono<Shape>::growAABBList(unsigned int
    (i.e. NPT), the tree may need to be rebuilt several times in a single step because of box volume
    moves.
 
+    When only m_aabb_tree_moved is set (update() sets it after the trial moves), the particle list
+   is unchanged and the existing tree is refit to the current AABBs instead. The tree is rebuilt
+   when refitting has raised its cost well above the cost of the last built tree.
+
     Subclasses that override update() or other methods must be user to set m_aabb_tree_invalid
    appropriately, or erroneous simulations will result.
 
@@ -1593,7 +2594,10 @@ template<class Shape> void IntegratorHPMCMono<Shape>::growAABBList(unsigned int
 */
 template<class Shape> const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
     {
-    if (m_aabb_tree_invalid)
+    // rebuild the tree when refitting has raised its cost by this factor
+    const Scalar max_refit_cost_ratio = Scalar(1.5);
+
+    if (m_aabb_tree_invalid || m_aabb_tree_moved)
         {
         m_exec_conf->msg->notice(8) << "Building AABB tree: " << m_pdata->getN() << " ptls "
                                     << m_pdata->getNGhosts() << " ghosts" << std::endl;
@@ -1606,16 +2610,20 @@ template<class Shape> const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::
                                                access_location::host,
                                                access_mode::read);
 
-            // precompute constants used many times in the loop
-            m_max_pair_additive_cutoff.clear();
-            m_shape_circumsphere_radius.clear();
-            for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+            // precompute constants used many times in the loop (the shape parameters and pair
+            // interactions do not change without invalidating the tree)
+            if (m_aabb_tree_invalid)
                 {
-                quat<LongReal> q;
-                Shape shape(q, m_params[type]);
-                m_shape_circumsphere_radius.push_back(LongReal(0.5)
-                                                      * shape.getCircumsphereDiameter());
-                m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
+                m_max_pair_additive_cutoff.clear();
+                m_shape_circumsphere_radius.clear();
+                for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+                    {
+                    quat<LongReal> q;
+                    Shape shape(q, m_params[type]);
+                    m_shape_circumsphere_radius.push_back(LongReal(0.5)
+                                                          * shape.getCircumsphereDiameter());
+                    m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
+                    }
                 }
 
             // grow the AABB list to the needed size
@@ -1638,15 +2646,314 @@ template<class Shape> const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::
                         m_aabbs[i] = hoomd::detail::AABB(vec3<Scalar>(h_postype.data[i]), radius);
                         }
                     }
-                m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                bool rebuild = m_aabb_tree_invalid || !m_aabb_tree.refit(m_aabbs, n_aabb)
+                               || m_aabb_tree.getCost()
+                                      > max_refit_cost_ratio * m_aabb_tree_build_cost;
+                if (rebuild)
+                    {
+                    m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                    m_aabb_tree_build_cost = m_aabb_tree.getCost();
+                    }
                 }
             }
+
+        m_aabb_tree_version++;
+        if (m_aabb_tree_invalid)
+            m_aabb_tree_build_version++;
         }
 
     m_aabb_tree_invalid = false;
+    m_aabb_tree_moved = false;
     return m_aabb_tree;
     }
 
+/*! With pair interactions, the leaves of m_aabb_tree cover the pair cutoff of each particle. The
+   trial moves in update() check overlaps in m_hard_aabb_tree instead, whose leaves are the shape
+   AABBs, and only evaluate the pair energy in m_aabb_tree.
+
+    m_hard_aabb_tree follows m_aabb_tree: it is rebuilt when buildAABBTree() rebuilt m_aabb_tree and
+   refit when buildAABBTree() refit it, so it needs no invalidation flags of its own.
+*/
+template<class Shape> void IntegratorHPMCMono<Shape>::buildHardAABBTree()
+    {
+    // rebuild the tree when refitting has raised its cost by this factor
+    const Scalar max_refit_cost_ratio = Scalar(1.5);
+
+    buildAABBTree();
+    if (m_hard_aabb_tree_version == m_aabb_tree_version)
+        return;
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+
+    unsigned int n_aabb = m_pdata->getN() + m_pdata->getNGhosts();
+    if (n_aabb > m_hard_aabbs_capacity)
+        {
+        m_hard_aabbs_capacity = n_aabb;
+        if (m_hard_aabbs != NULL)
+            free(m_hard_aabbs);
+
+        int retval
+            = posix_memalign((void**)&m_hard_aabbs, 32, n_aabb * sizeof(hoomd::detail::AABB));
+        if (retval != 0)
+            {
+            throw std::runtime_error("Error allocating aligned memory.");
+            }
+        }
+
+    if (n_aabb > 0)
+        {
+        for (unsigned int i = 0; i < n_aabb; i++)
+            {
+            unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
+            Shape shape(quat<Scalar>(h_orientation.data[i]), m_params[typ_i]);
+            m_hard_aabbs[i] = shape.getAABB(vec3<Scalar>(h_postype.data[i]));
+            }
+
+        bool rebuild = m_hard_aabb_tree_build_version != m_aabb_tree_build_version
+                       || !m_hard_aabb_tree.refit(m_hard_aabbs, n_aabb)
+                       || m_hard_aabb_tree.getCost()
+                              > max_refit_cost_ratio * m_hard_aabb_tree_build_cost;
+        if (rebuild)
+            {
+            m_hard_aabb_tree.buildTree(m_hard_aabbs, n_aabb);
+            m_hard_aabb_tree_build_cost = m_hard_aabb_tree.getCost();
+            }
+        }
+
+    m_hard_aabb_tree_version = m_aabb_tree_version;
+    m_hard_aabb_tree_build_version = m_aabb_tree_build_version;
+    }
+
+/*! Bins the local and ghost particles into m_aabb_grid for the trial moves in update(). Binning
+   takes O(N) time, so the grid is rebuilt on every call and update() keeps it current by moving
+   particles between cells as trial moves are accepted.
+
+    The grid is only used for hard particle overlap checks (without pair interactions). The cell
+   width must cover the largest AABB, so the automatic broadphase only selects the grid when the
+   largest AABB edge is at most twice the smallest.
+
+    \returns true when update() should use the grid, false when it should use the tree.
+*/
+template<class Shape> bool IntegratorHPMCMono<Shape>::buildAABBGrid()
+    {
+    // largest ratio of AABB sizes for which the automatic broadphase selects the grid
+    const Scalar max_auto_size_ratio = Scalar(2.0);
+
+    if (m_broadphase == Broadphase::tree || hasPairInteractions())
+        return false;
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+
+    unsigned int n_aabb = m_pdata->getN() + m_pdata->getNGhosts();
+    Scalar min_size = std::numeric_limits<Scalar>::max();
+    Scalar max_size = 0;
+    if (n_aabb > 0)
+        {
+        growAABBList(n_aabb);
+        for (unsigned int i = 0; i < n_aabb; i++)
+            {
+            unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
+            Shape shape(quat<Scalar>(h_orientation.data[i]), m_params[typ_i]);
+            m_aabbs[i] = shape.getAABB(vec3<Scalar>(h_postype.data[i]));
+
+            vec3<Scalar> d = m_aabbs[i].getUpper() - m_aabbs[i].getLower();
+            Scalar size = std::max(d.x, std::max(d.y, d.z));
+            min_size = std::min(min_size, size);
+            max_size = std::max(max_size, size);
+            }
+        }
+
+    if (m_broadphase == Broadphase::automatic && max_size > max_auto_size_ratio * min_size)
+        return false;
+
+    m_exec_conf->msg->notice(8) << "Building AABB grid: " << m_pdata->getN() << " ptls "
+                                << m_pdata->getNGhosts() << " ghosts" << std::endl;
+    m_aabb_grid.buildGrid(m_aabbs, n_aabb, max_size);
+    return true;
+    }
+
+/*! \param i Index of the particle
+    \param pos_i Position of particle i
+    \param orientation_i Orientation of particle i
+    \param aabb_i_local AABB about the origin that covers the pair interaction range of i
+    \param postype Positions and types of all particles
+    \param orientation Orientations of all particles
+    \param diameter Diameters of all particles
+    \param charge Charges of all particles
+    \param pairs When not null, set to the non-zero pair energies of i with local particles
+    \returns Total pair energy of particle i at \a pos_i and \a orientation_i
+
+    Particle i interacts with its own periodic images at \a pos_i, regardless of its position in
+   \a postype.
+*/
+template<class Shape>
+LongReal IntegratorHPMCMono<Shape>::computeOneParticlePairEnergy(
+    unsigned int i,
+    const vec3<Scalar>& pos_i,
+    const quat<LongReal>& orientation_i,
+    const hoomd::detail::AABB& aabb_i_local,
+    const Scalar4* postype,
+    const Scalar4* orientation,
+    const Scalar* diameter,
+    const Scalar* charge,
+    std::vector<std::pair<unsigned int, LongReal>>* pairs)
+    {
+    if (pairs)
+        pairs->clear();
+
+    LongReal energy = 0;
+    unsigned int typ_i = __scalar_as_int(postype[i].w);
+
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+        {
+        vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+        hoomd::detail::AABB aabb = aabb_i_local;
+        aabb.translate(pos_i_image);
+
+        // stackless search
+        for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes();
+             cur_node_idx++)
+            {
+            if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                {
+                if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                    {
+                    for (unsigned int cur_p = 0;
+                         cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx);
+                         cur_p++)
+                        {
+                        // read in its position and orientation
+                        unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                        Scalar4 postype_j;
+                        quat<LongReal> orientation_j;
+
+                        // handle j==i situations
+                        if (j != i)
+                            {
+                            // load the position and orientation of the j particle
+                            postype_j = postype[j];
+                            orientation_j = quat<LongReal>(orientation[j]);
+                            }
+                        else
+                            {
+                            if (cur_image == 0)
+                                {
+                                // in the first image, skip i == j
+                                continue;
+                                }
+                            else
+                                {
+                                // If this is particle i and we are in an outside image, use the
+                                // translated position and orientation
+                                postype_j = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype[i].w);
+                                orientation_j = orientation_i;
+                                }
+                            }
+
+                        // put particles in coordinate system of particle i
+                        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                        unsigned int typ_j = __scalar_as_int(postype_j.w);
+
+                        LongReal u_ij = computeOnePairEnergy(dot(r_ij, r_ij),
+                                                             r_ij,
+                                                             typ_i,
+                                                             orientation_i,
+                                                             diameter[i],
+                                                             charge[i],
+                                                             typ_j,
+                                                             orientation_j,
+                                                             diameter[j],
+                                                             charge[j]);
+                        energy += u_ij;
+
+                        if (pairs && j != i && j < m_pdata->getN() && u_ij != 0)
+                            pairs->push_back(std::make_pair(j, u_ij));
+                        }
+                    }
+                }
+            else
+                {
+                // skip ahead
+                cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                }
+            } // end loop over AABB nodes
+        } // end loop over images
+
+    return energy;
+    }
+
+/*! \param r_ij Position of particle j relative to the trial position of particle i
+    \param shape_i Shape of particle i at its trial orientation
+    \param shape_j Shape of particle j
+    \param typ_i Type of particle i
+    \param typ_j Type of particle j
+    \param tag_i Tag of particle i
+    \param tag_j Tag of particle j
+    \param err_count Incremented when the overlap test fails to converge
+    \param use_axis_cache Set to false to skip the separating axis cache, which is not thread safe
+    \returns true when the particles overlap
+
+    In dense systems the same pairs are tested over and over. When enabled, the cache stores the
+   last separating axis of each pair, and the next test starts by checking whether it still
+   separates the shapes. The axis points from i to j, so it is flipped when the tags are in reverse
+   order.
+
+    When the extent tables are enabled, pairs whose extents along the line of centers do not reach
+   each other are disjoint and skip the narrow phase.
+*/
+template<class Shape>
+bool IntegratorHPMCMono<Shape>::testOverlapCached(const vec3<Scalar>& r_ij,
+                                                  const Shape& shape_i,
+                                                  const Shape& shape_j,
+                                                  unsigned int typ_i,
+                                                  unsigned int typ_j,
+                                                  unsigned int tag_i,
+                                                  unsigned int tag_j,
+                                                  unsigned int& err_count,
+                                                  bool use_axis_cache)
+    {
+    if (HasSupportExtent<Shape>::value && m_support_extent_tables)
+        {
+        vec3<ShortReal> dr(r_ij);
+        ShortReal r = fast::sqrt(dot(dr, dr));
+        if (r > ShortReal(0.0))
+            {
+            vec3<ShortReal> n = dr / r;
+            vec3<ShortReal> n_i = rotate(conj(quat<ShortReal>(shape_i.orientation)), n);
+            vec3<ShortReal> n_j = rotate(conj(quat<ShortReal>(shape_j.orientation)), -n);
+            if (m_extent_tables[typ_i].getBound(n_i) + m_extent_tables[typ_j].getBound(n_j) < r)
+                return false;
+            }
+        }
+
+    if (!UsesSeparatingAxis<Shape, Shape>::value || !m_separating_axis_cache || !use_axis_cache)
+        return test_overlap(r_ij, shape_i, shape_j, err_count);
+
+    uint64_t key = (tag_i < tag_j) ? (uint64_t(tag_i) << 32) | tag_j
+                                   : (uint64_t(tag_j) << 32) | tag_i;
+    ShortReal sign = (tag_i < tag_j) ? ShortReal(1.0) : ShortReal(-1.0);
+
+    vec3<ShortReal>& cached_axis = m_separating_axes[key];
+    vec3<ShortReal> axis = sign * cached_axis;
+    bool overlap = test_overlap_cached(r_ij, shape_i, shape_j, err_count, axis);
+    if (!overlap)
+        cached_axis = sign * axis;
+
+    return overlap;
+    }
+
 /*! Call to reduce the m_d values down to safe levels for the bvh tree + small box limitations. That
    code path will not work if particles can wander more than one image in a time step.
 
@@ -1809,7 +3116,19 @@ template<class Shape> void export_IntegratorHPMCMono(pybind11::module& m, const
         .def("getTypeShapesPy", &IntegratorHPMCMono<Shape>::getTypeShapesPy)
         .def("getShape", &IntegratorHPMCMono<Shape>::getShape)
         .def("setShape", &IntegratorHPMCMono<Shape>::setShape)
-        .def("computePairEnergy", &IntegratorHPMCMono<Shape>::computePairEnergy);
+        .def("computePairEnergy", &IntegratorHPMCMono<Shape>::computePairEnergy)
+        .def_property("separating_axis_cache",
+                      &IntegratorHPMCMono<Shape>::getSeparatingAxisCache,
+                      &IntegratorHPMCMono<Shape>::setSeparatingAxisCache)
+        .def_property("support_extent_tables",
+                      &IntegratorHPMCMono<Shape>::getSupportExtentTables,
+                      &IntegratorHPMCMono<Shape>::setSupportExtentTables)
+        .def_property("pair_energy_cache",
+                      &IntegratorHPMCMono<Shape>::getPairEnergyCache,
+                      &IntegratorHPMCMono<Shape>::setPairEnergyCache)
+        .def_property("checkerboard",
+                      &IntegratorHPMCMono<Shape>::getCheckerboard,
+                      &IntegratorHPMCMono<Shape>::setCheckerboard);
     }
 
     } // end namespace detail
@@ -3,6 +3,11 @@
 
 #include "IntegratorHPMCMonoGPUTypes.cuh"
 
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include "GPUHelpers.cuh"
+
 namespace hoomd
     {
 namespace hpmc
@@ -104,12 +109,132 @@ __global__ void hpmc_shift(Scalar4* d_postype,
     d_image[my_pidx] = image;
     }
 
+//! Evaluate the tabulated energy of one pair of particles
+/*! \param r_squared Squared distance between the particles
+    \param d_tables Tables of one potential, indexed by type pair
+    \param d_table_data Tabulated energies of all tables
+    \param type_pair Index of the type pair
+
+    Bin 0 is interpolated as well. Potentials that diverge at r = 0 have an infinite energy in bin
+   0.
+*/
+__device__ inline LongReal hpmc_pair_table_energy(const LongReal r_squared,
+                                                  const hpmc_pair_table_t* d_tables,
+                                                  const LongReal* d_table_data,
+                                                  const unsigned int type_pair)
+    {
+    const hpmc_pair_table_t table = d_tables[type_pair];
+    if (table.width == 0 || r_squared >= table.r_cut_squared)
+        return 0;
+
+    const LongReal x = r_squared * table.inverse_spacing;
+    const unsigned int bin = min(static_cast<unsigned int>(x), table.width - 1);
+    const LongReal u_0 = d_table_data[table.offset + bin];
+    if (isinf(u_0))
+        return u_0;
+    const LongReal u_1 = d_table_data[table.offset + bin + 1];
+    return u_0 + (x - LongReal(bin)) * (u_1 - u_0);
+    }
+
+//! Apply the Metropolis criterion to trial moves with isotropic pair potentials
+/*! hpmc_pair_energy executes one thread per particle, after the narrow phase. It sums the change in
+   the tabulated pair energy of the trial move with all particles in the expanded cell, using the
+   same configuration of each neighbor as the narrow phase: the trial configuration of particles
+   earlier in the update order that are accepted in the current iteration, and the old
+   configuration otherwise. Moves that fail the Metropolis criterion are rejected. The random
+   number depends only on the particle, so the iterations converge to the same result as a
+   sequential sweep in the update order.
+*/
+__global__ void hpmc_pair_energy(const Scalar4* d_postype,
+                                 const Scalar4* d_trial_postype,
+                                 const unsigned int* d_trial_move_type,
+                                 const unsigned int* d_excell_idx,
+                                 const unsigned int* d_excell_size,
+                                 const Index2D excli,
+                                 const BoxDim box,
+                                 const Scalar3 ghost_width,
+                                 const uint3 cell_dim,
+                                 const Index3D ci,
+                                 const unsigned int N_local,
+                                 const unsigned int* d_update_order_by_ptl,
+                                 const unsigned int* d_reject_in,
+                                 unsigned int* d_reject_out,
+                                 const unsigned int* d_reject_out_of_cell,
+                                 const hpmc_pair_table_t* d_tables,
+                                 const LongReal* d_table_data,
+                                 const unsigned int n_potentials,
+                                 const Index2D type_pair_idx,
+                                 const Scalar kT,
+                                 const uint16_t seed,
+                                 const uint64_t timestep,
+                                 const unsigned int rank,
+                                 const unsigned int select,
+                                 const unsigned int* d_skip)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= N_local)
+        return;
+
+    // an earlier pass of the batch already converged
+    if (d_skip && *d_skip == 0)
+        return;
+
+    // skip inactive moves and moves that are already rejected
+    if (!d_trial_move_type[i] || d_reject_out_of_cell[i] || d_reject_out[i])
+        return;
+
+    const Scalar4 postype_i_old = d_postype[i];
+    const vec3<Scalar> pos_i_old(postype_i_old);
+    const vec3<Scalar> pos_i_new(d_trial_postype[i]);
+    const unsigned int type_i = __scalar_as_int(postype_i_old.w);
+    const unsigned int update_order_i = d_update_order_by_ptl[i];
+    const unsigned int my_cell
+        = computeParticleCell(vec_to_scalar3(pos_i_old), box, ghost_width, cell_dim, ci, false);
+
+    // U_new - U_old
+    LongReal delta_u = 0;
+    const unsigned int excell_size = d_excell_size[my_cell];
+    for (unsigned int k = 0; k < excell_size; k++)
+        {
+        const unsigned int j = __ldg(&d_excell_idx[excli(k, my_cell)]);
+        if (j == i)
+            continue;
+
+        // has j been updated? ghost particles are not updated
+        bool j_has_been_updated = j < N_local && d_update_order_by_ptl[j] < update_order_i
+                                  && !d_reject_in[j] && d_trial_move_type[j];
+        const Scalar4 postype_j = j_has_been_updated ? d_trial_postype[j] : d_postype[j];
+        const vec3<Scalar> pos_j(postype_j);
+        const unsigned int type_pair = type_pair_idx(type_i, __scalar_as_int(postype_j.w));
+
+        const vec3<Scalar> r_ij_new = box.minImage(pos_j - pos_i_new);
+        const vec3<Scalar> r_ij_old = box.minImage(pos_j - pos_i_old);
+        const LongReal r_squared_new = dot(r_ij_new, r_ij_new);
+        const LongReal r_squared_old = dot(r_ij_old, r_ij_old);
+
+        for (unsigned int p = 0; p < n_potentials; p++)
+            {
+            const hpmc_pair_table_t* d_tables_p = d_tables + p * type_pair_idx.getNumElements();
+            delta_u += hpmc_pair_table_energy(r_squared_new, d_tables_p, d_table_data, type_pair)
+                       - hpmc_pair_table_energy(r_squared_old, d_tables_p, d_table_data, type_pair);
+            }
+        }
+
+    hoomd::RandomGenerator rng_i(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoPatch, timestep, seed),
+                                 hoomd::Counter(i, rank, select));
+    if (!(hoomd::detail::generate_canonical<double>(rng_i) < slow::exp(-delta_u / kT)))
+        {
+        d_reject_out[i] = 1;
+        }
+    }
+
 //!< Kernel to evaluate convergence
 __global__ void hpmc_check_convergence(const unsigned int* d_trial_move_type,
                                        const unsigned int* d_reject_out_of_cell,
                                        unsigned int* d_reject_in,
                                        unsigned int* d_reject_out,
                                        unsigned int* d_condition,
+                                       const unsigned int* d_skip,
                                        const unsigned int nwork)
     {
     // the particle we are handling
@@ -118,6 +243,13 @@ __global__ void hpmc_check_convergence(const unsigned int* d_trial_move_type,
         return;
     unsigned int i = work_idx;
 
+    // an earlier pass of the batch already converged: carry its reject flags over to the output
+    if (d_skip && *d_skip == 0)
+        {
+        d_reject_out[i] = d_reject_in[i];
+        return;
+        }
+
     // is this particle considered?
     bool move_active = d_trial_move_type[i] > 0;
 
@@ -215,12 +347,66 @@ void __attribute__((visibility("default"))) hpmc_shift(Scalar4* d_postype,
     hipDeviceSynchronize();
     }
 
+//! Kernel driver for kernel::hpmc_pair_energy()
+void __attribute__((visibility("default"))) hpmc_pair_energy(const hpmc_pair_args_t& pair_args)
+    {
+    const hpmc_args_t& args = pair_args.args;
+    assert(args.d_postype);
+    assert(args.d_trial_postype);
+    assert(args.d_reject_in);
+    assert(args.d_reject_out);
+    assert(pair_args.d_tables);
+    assert(pair_args.d_table_data);
+
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_pair_energy));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(pair_args.block_size, (unsigned int)max_block_size);
+    dim3 threads(run_block_size, 1, 1);
+    dim3 grid(args.N / run_block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL(kernel::hpmc_pair_energy,
+                       grid,
+                       threads,
+                       0,
+                       args.stream,
+                       args.d_postype,
+                       args.d_trial_postype,
+                       args.d_trial_move_type,
+                       args.d_excell_idx,
+                       args.d_excell_size,
+                       args.excli,
+                       args.box,
+                       args.ghost_width,
+                       args.cell_dim,
+                       args.ci,
+                       args.N,
+                       args.d_update_order_by_ptl,
+                       args.d_reject_in,
+                       args.d_reject_out,
+                       args.d_reject_out_of_cell,
+                       pair_args.d_tables,
+                       pair_args.d_table_data,
+                       pair_args.n_potentials,
+                       pair_args.type_pair_idx,
+                       pair_args.kT,
+                       args.seed,
+                       args.timestep,
+                       args.rank,
+                       args.select,
+                       args.d_skip);
+    }
+
 void __attribute__((visibility("default")))
 hpmc_check_convergence(const unsigned int* d_trial_move_type,
                        const unsigned int* d_reject_out_of_cell,
                        unsigned int* d_reject_in,
                        unsigned int* d_reject_out,
                        unsigned int* d_condition,
+                       const unsigned int* d_skip,
                        const unsigned int N,
                        const unsigned int block_size)
     {
@@ -249,6 +435,7 @@ hpmc_check_convergence(const unsigned int* d_trial_move_type,
                        d_reject_in,
                        d_reject_out,
                        d_condition,
+                       d_skip,
                        nwork);
     }
 
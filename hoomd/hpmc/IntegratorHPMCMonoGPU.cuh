@@ -69,8 +69,13 @@ __launch_bounds__(max_threads)
                                       const unsigned int* d_reject_out_of_cell,
                                       const unsigned int max_extra_bytes,
                                       const unsigned int max_queue_size,
-                                      const unsigned int nwork)
+                                      const unsigned int nwork,
+                                      const unsigned int* d_skip)
     {
+    // an earlier pass of the batch already converged
+    if (d_skip && *d_skip == 0)
+        return;
+
     __shared__ unsigned int s_overlap_checks;
     __shared__ unsigned int s_overlap_err_count;
     __shared__ unsigned int s_queue_size;
@@ -499,7 +504,8 @@ void narrow_phase_launcher(const hpmc_args_t& args,
                            args.d_reject_out_of_cell,
                            max_extra_bytes,
                            max_queue_size,
-                           nwork);
+                           nwork,
+                           args.d_skip);
         }
     else
         {
@@ -178,6 +178,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     /// Autotuner for convergence check.
     std::shared_ptr<Autotuner<1>> m_tuner_convergence;
 
+    /// Autotuner for the pair energy evaluation.
+    std::shared_ptr<Autotuner<1>> m_tuner_pair_energy;
+
     GPUArray<Scalar4> m_trial_postype;           //!< New positions (and type) of particles
     GPUArray<Scalar4> m_trial_orientation;       //!< New orientations
     GPUArray<Scalar4> m_trial_vel;               //!< New velocities (auxilliary variables)
@@ -194,6 +197,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     //! For energy evaluation
     GPUArray<Scalar> m_additive_cutoff; //!< Per-type additive cutoffs from patch potential
 
+    GPUArray<gpu::hpmc_pair_table_t> m_pair_tables; //!< Pair potential tables by type pair
+    GPUArray<LongReal> m_pair_table_data;           //!< Tabulated energies of all pair potentials
+
     hipStream_t m_narrow_phase_stream; //!< Stream for narrow phase kernel
 
 #ifdef ENABLE_MPI
@@ -207,6 +213,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
 
     //! Set the nominal width appropriate for looped moves
     virtual void updateCellWidth();
+
+    //! Copy the tables of the pair potentials to the GPU
+    void updatePairTables();
     };
 
 template<class Shape>
@@ -271,12 +280,18 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                          this->m_exec_conf,
                          "hpmc_convergence"));
 
+    m_tuner_pair_energy.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_pair_energy"));
+
     this->m_autotuners.insert(this->m_autotuners.end(),
                               {m_tuner_moves,
                                m_tuner_update_pdata,
                                m_tuner_excell_block_size,
                                m_tuner_convergence,
-                               m_tuner_narrow});
+                               m_tuner_narrow,
+                               m_tuner_pair_energy});
 
     // initialize memory
     GPUArray<Scalar4>(1, this->m_exec_conf).swap(m_trial_postype);
@@ -295,6 +310,10 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
 
     GPUArray<unsigned int>(1, this->m_exec_conf).swap(m_condition);
 
+    GPUArray<gpu::hpmc_pair_table_t>(1, this->m_exec_conf).swap(m_pair_tables);
+
+    GPUArray<LongReal>(1, this->m_exec_conf).swap(m_pair_table_data);
+
     GPUArray<unsigned int> excell_size(0, this->m_exec_conf);
     m_excell_size.swap(excell_size);
 
@@ -358,6 +377,12 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
         // update the cell list
         this->m_cl->compute(timestep);
 
+        // pair potentials are evaluated from their tables on the GPU
+        const bool has_pair_interactions = this->hasPairInteractions();
+        if (has_pair_interactions)
+            updatePairTables();
+        const Scalar kT = this->getKT()->operator()(timestep);
+
         // if the cell list is a different size than last time, reinitialize the expanded cell list
         uint3 cur_dim = this->m_cl->getDim();
         if (m_last_dim.x != cur_dim.x || m_last_dim.y != cur_dim.y || m_last_dim.z != cur_dim.z
@@ -390,6 +415,13 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
             m_trial_move_type.resize(this->m_pdata->getMaxN());
             }
 
+        // one convergence flag per pass in a batch
+        const unsigned int convergence_batch = this->m_convergence_batch;
+        if (m_condition.getNumElements() < convergence_batch)
+            {
+            m_condition.resize(convergence_batch);
+            }
+
         m_update_order.resize(this->m_pdata->getN());
 
         // access the cell list data
@@ -568,14 +600,29 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     CHECK_CUDA_ERROR();
                 }
 
+            // Enqueue convergence_batch passes before reading back their flags. Passes after the
+            // first converged pass in a batch exit early and only carry the reject flags over.
+            unsigned int batch_pass = 0;
             while (!converged)
                 {
+                if (batch_pass == convergence_batch)
+                    {
+                    ArrayHandle<unsigned int> h_condition(m_condition,
+                                                          access_location::host,
+                                                          access_mode::read);
+                    const unsigned int* end = h_condition.data + convergence_batch;
+                    converged = std::find(h_condition.data, end, 0u) != end;
+                    batch_pass = 0;
+                    continue;
+                    }
+
+                if (batch_pass == 0)
                     {
                     ArrayHandle<unsigned int> d_condition(m_condition,
                                                           access_location::device,
                                                           access_mode::overwrite);
-                    // reset condition flag
-                    hipMemsetAsync(d_condition.data, 0, sizeof(unsigned int));
+                    // reset the condition flags of all passes in the batch
+                    hipMemsetAsync(d_condition.data, 0, sizeof(unsigned int) * convergence_batch);
                     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                         CHECK_CUDA_ERROR();
                     }
@@ -627,6 +674,11 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                                         access_location::device,
                                                         access_mode::readwrite);
 
+                // convergence flags of the passes in the batch
+                ArrayHandle<unsigned int> d_condition(m_condition,
+                                                      access_location::device,
+                                                      access_mode::readwrite);
+
                 // fill the parameter structure for the GPU kernels
                 gpu::hpmc_args_t args(d_postype.data,
                                       d_orientation.data,
@@ -668,12 +720,18 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                       this->m_exec_conf->dev_prop,
                                       m_narrow_phase_stream);
 
+                // skip the pass when the previous pass in the batch converged. Only the first pass
+                // of a batch always does work, so only that pass is timed by the autotuners.
+                args.d_skip = batch_pass > 0 ? d_condition.data + batch_pass - 1 : nullptr;
+                const bool timed = batch_pass == 0;
+
                 /*
                  *  check overlaps, new configuration simultaneously against the old and the new
                  * configuration
                  */
 
-                m_tuner_narrow->begin();
+                if (timed)
+                    m_tuner_narrow->begin();
                 auto param = m_tuner_narrow->getParam();
                 args.block_size = param[0];
                 args.tpp = param[1];
@@ -681,36 +739,55 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                 gpu::hpmc_narrow_phase<Shape>(args, params.data());
                 if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                     CHECK_CUDA_ERROR();
-                m_tuner_narrow->end();
+                if (timed)
+                    m_tuner_narrow->end();
 
+                // reject moves that pass the narrow phase by the Metropolis criterion
+                if (has_pair_interactions)
                     {
-                    ArrayHandle<unsigned int> d_condition(m_condition,
-                                                          access_location::device,
-                                                          access_mode::readwrite);
-
-                    m_tuner_convergence->begin();
-                    gpu::hpmc_check_convergence(d_trial_move_type.data,
-                                                d_reject_out_of_cell.data,
-                                                d_reject.data,
-                                                d_reject_out.data,
-                                                d_condition.data,
-                                                this->m_pdata->getN(),
-                                                m_tuner_convergence->getParam()[0]);
+                    ArrayHandle<gpu::hpmc_pair_table_t> d_pair_tables(m_pair_tables,
+                                                                      access_location::device,
+                                                                      access_mode::read);
+                    ArrayHandle<LongReal> d_pair_table_data(m_pair_table_data,
+                                                            access_location::device,
+                                                            access_mode::read);
+                    const Index2D type_pair_idx(this->m_pdata->getNTypes());
+
+                    if (timed)
+                        m_tuner_pair_energy->begin();
+                    gpu::hpmc_pair_args_t pair_args(
+                        args,
+                        d_pair_tables.data,
+                        d_pair_table_data.data,
+                        (unsigned int)this->m_pair_potentials.size(),
+                        type_pair_idx,
+                        kT,
+                        m_tuner_pair_energy->getParam()[0]);
+                    gpu::hpmc_pair_energy(pair_args);
                     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                         CHECK_CUDA_ERROR();
-                    m_tuner_convergence->end();
+                    if (timed)
+                        m_tuner_pair_energy->end();
                     }
 
+                if (timed)
+                    m_tuner_convergence->begin();
+                gpu::hpmc_check_convergence(d_trial_move_type.data,
+                                            d_reject_out_of_cell.data,
+                                            d_reject.data,
+                                            d_reject_out.data,
+                                            d_condition.data + batch_pass,
+                                            args.d_skip,
+                                            this->m_pdata->getN(),
+                                            m_tuner_convergence->getParam()[0]);
+                if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                if (timed)
+                    m_tuner_convergence->end();
+
                 // flip reject flags
                 std::swap(m_reject, m_reject_out);
-
-                    {
-                    ArrayHandle<unsigned int> h_condition(m_condition,
-                                                          access_location::host,
-                                                          access_mode::read);
-                    if (*h_condition.data == 0)
-                        converged = true;
-                    }
+                batch_pass++;
                 } // end while (!converged)
 
                 {
@@ -860,6 +937,63 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateCellWidth()
         }
     }
 
+/*! The GPU kernels evaluate pair potentials only through their tables. Copy the current tables of
+    all pair potentials, which the potentials rebuild whenever their parameters change.
+*/
+template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updatePairTables()
+    {
+    const Index2D type_pair_idx(this->m_pdata->getNTypes());
+    const unsigned int n_type_pairs = type_pair_idx.getNumElements();
+    const unsigned int n_potentials = (unsigned int)this->m_pair_potentials.size();
+
+    size_t n_table_data = 0;
+    for (const auto& pair : this->m_pair_potentials)
+        {
+        if (pair->getTableWidth() == 0)
+            {
+            throw std::runtime_error("HPMC on the GPU requires pair potentials with a non-zero "
+                                     "table_width.");
+            }
+        n_table_data += pair->getTable().size();
+        }
+
+    if (m_pair_tables.getNumElements() < n_potentials * n_type_pairs)
+        m_pair_tables.resize(n_potentials * n_type_pairs);
+    if (m_pair_table_data.getNumElements() < n_table_data)
+        m_pair_table_data.resize(n_table_data);
+
+    ArrayHandle<gpu::hpmc_pair_table_t> h_pair_tables(m_pair_tables,
+                                                      access_location::host,
+                                                      access_mode::overwrite);
+    ArrayHandle<LongReal> h_pair_table_data(m_pair_table_data,
+                                            access_location::host,
+                                            access_mode::overwrite);
+
+    unsigned int offset = 0;
+    for (unsigned int p = 0; p < n_potentials; p++)
+        {
+        const auto& pair = this->m_pair_potentials[p];
+        const std::vector<LongReal>& table = pair->getTable();
+        const unsigned int width = pair->getTableWidth();
+        std::copy(table.begin(), table.end(), h_pair_table_data.data + offset);
+
+        for (unsigned int type_i = 0; type_i < this->m_pdata->getNTypes(); type_i++)
+            {
+            for (unsigned int type_j = 0; type_j < this->m_pdata->getNTypes(); type_j++)
+                {
+                const unsigned int type_pair = type_pair_idx(type_i, type_j);
+                gpu::hpmc_pair_table_t& entry = h_pair_tables.data[p * n_type_pairs + type_pair];
+                entry.r_cut_squared = pair->getRCutSquaredTotal(type_i, type_j);
+                entry.inverse_spacing = pair->getTableInverseSpacing(type_i, type_j);
+                entry.width = entry.r_cut_squared > 0 ? width : 0;
+                entry.offset = offset + type_pair * (width + 1);
+                }
+            }
+
+        offset += (unsigned int)table.size();
+        }
+    }
+
 namespace detail
     {
 //! Export this hpmc integrator to python
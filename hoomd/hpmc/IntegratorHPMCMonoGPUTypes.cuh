@@ -114,6 +114,7 @@ struct hpmc_args_t
     unsigned int* d_reject_out;                //!< Reject flags per particle (out)
     const hipDeviceProp_t& devprop;            //!< CUDA device properties
     const hipStream_t& stream;                 //!< kernel streams
+    const unsigned int* d_skip = nullptr;      //!< Skip the kernels when *d_skip is 0, may be null
     };
 
 //! Wraps arguments for hpmc_update_pdata
@@ -155,6 +156,41 @@ struct hpmc_update_args_t
     const unsigned int block_size;
     };
 
+//! Tabulated isotropic pair potential for one pair of types
+struct hpmc_pair_table_t
+    {
+    unsigned int offset;      //!< Offset of the first value in the table data
+    unsigned int width;       //!< Number of bins in the table (0 when the types do not interact)
+    LongReal r_cut_squared;   //!< Cutoff radius squared
+    LongReal inverse_spacing; //!< Inverse of the r_squared spacing of the table
+    };
+
+//! Wraps arguments for hpmc_pair_energy
+struct hpmc_pair_args_t
+    {
+    //! Construct a hpmc_pair_args_t
+    hpmc_pair_args_t(const hpmc_args_t& _args,
+                     const hpmc_pair_table_t* _d_tables,
+                     const LongReal* _d_table_data,
+                     const unsigned int _n_potentials,
+                     const Index2D& _type_pair_idx,
+                     const Scalar _kT,
+                     const unsigned int _block_size)
+        : args(_args), d_tables(_d_tables), d_table_data(_d_table_data),
+          n_potentials(_n_potentials), type_pair_idx(_type_pair_idx), kT(_kT),
+          block_size(_block_size)
+        {
+        }
+
+    const hpmc_args_t& args;            //!< Arguments shared with the narrow phase
+    const hpmc_pair_table_t* d_tables;  //!< Tables, indexed by potential and then by type pair
+    const LongReal* d_table_data;       //!< Tabulated energies of all tables
+    const unsigned int n_potentials;    //!< Number of pair potentials
+    const Index2D& type_pair_idx;       //!< Indexer of the type pairs
+    const Scalar kT;                    //!< Temperature
+    const unsigned int block_size;      //!< Block size to execute
+    };
+
 //! Driver for kernel::hpmc_narrow_phase()
 template<class Shape>
 void hpmc_narrow_phase(const hpmc_args_t& args, const typename Shape::param_type* params);
@@ -187,12 +223,16 @@ void hpmc_shift(Scalar4* d_postype,
                 const Scalar3 shift,
                 const unsigned int block_size);
 
+//! Kernel driver for kernel::hpmc_pair_energy()
+void hpmc_pair_energy(const hpmc_pair_args_t& pair_args);
+
 //! Kernel to evaluate convergence
 void hpmc_check_convergence(const unsigned int* d_trial_move_type,
                             const unsigned int* d_reject_out_of_cell,
                             unsigned int* d_reject_in,
                             unsigned int* d_reject_out,
                             unsigned int* d_condition,
+                            const unsigned int* d_skip,
                             const unsigned int N,
                             unsigned int block_size);
 
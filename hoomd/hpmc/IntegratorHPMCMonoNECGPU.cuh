@@ -0,0 +1,609 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/VectorMath.h"
+#include <hip/hip_runtime.h>
+
+#include "hoomd/hpmc/HPMCCounters.h"
+
+#ifdef __HIPCC__
+#include "hoomd/hpmc/Moves.h"
+#endif
+
+#include <cassert>
+
+/*! \file IntegratorHPMCMonoNECGPU.cuh
+    \brief Declares the GPU kernel driver for Newtonian event chains
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace gpu
+    {
+//! Wraps arguments to hpmc_nec_chains
+/*! \ingroup hpmc_data_structs */
+struct hpmc_nec_args_t
+    {
+    //! Construct a hpmc_nec_args_t
+    hpmc_nec_args_t(Scalar4* _d_postype,
+                    Scalar4* _d_orientation,
+                    Scalar4* _d_vel,
+                    const unsigned int* _d_cell_idx,
+                    const unsigned int* _d_cell_size,
+                    const unsigned int* _d_cell_adj,
+                    const Index3D& _ci,
+                    const Index2D& _cli,
+                    const Index2D& _cadji,
+                    const uint3& _cell_dim,
+                    const uint3& _cell_set,
+                    const Scalar3& _ghost_width,
+                    const BoxDim& _box,
+                    const unsigned int _dim,
+                    const unsigned int _num_types,
+                    const Scalar* _d_d,
+                    const Scalar* _d_a,
+                    const unsigned int* _d_check_overlaps,
+                    const Index2D& _overlap_idx,
+                    const Scalar _chain_time,
+                    const unsigned int _chain_probability,
+                    const Scalar _update_fraction,
+                    const uint16_t _seed,
+                    const unsigned int _rank,
+                    const unsigned int _select,
+                    const uint64_t _timestep,
+                    hpmc_counters_t* _d_counters,
+                    hpmc_nec_counters_t* _d_nec_counters,
+                    Scalar2* _d_virial,
+                    const unsigned int _block_size,
+                    const hipDeviceProp_t& _devprop)
+        : d_postype(_d_postype), d_orientation(_d_orientation), d_vel(_d_vel),
+          d_cell_idx(_d_cell_idx), d_cell_size(_d_cell_size), d_cell_adj(_d_cell_adj), ci(_ci),
+          cli(_cli), cadji(_cadji), cell_dim(_cell_dim), cell_set(_cell_set),
+          ghost_width(_ghost_width), box(_box), dim(_dim), num_types(_num_types), d_d(_d_d),
+          d_a(_d_a), d_check_overlaps(_d_check_overlaps), overlap_idx(_overlap_idx),
+          chain_time(_chain_time), chain_probability(_chain_probability),
+          update_fraction(_update_fraction), seed(_seed), rank(_rank), select(_select),
+          timestep(_timestep), d_counters(_d_counters), d_nec_counters(_d_nec_counters),
+          d_virial(_d_virial), block_size(_block_size), devprop(_devprop) { };
+
+    Scalar4* d_postype;                   //!< postype array
+    Scalar4* d_orientation;               //!< orientation array
+    Scalar4* d_vel;                       //!< velocities, which set the direction of the chains
+    const unsigned int* d_cell_idx;       //!< Index data for each cell
+    const unsigned int* d_cell_size;      //!< Number of particles in each cell
+    const unsigned int* d_cell_adj;       //!< Cell adjacency list
+    const Index3D ci;                     //!< Cell indexer
+    const Index2D cli;                    //!< Indexer for d_cell_idx
+    const Index2D cadji;                  //!< Indexer for d_cell_adj
+    const uint3 cell_dim;                 //!< Cell dimensions, even in each direction
+    const uint3 cell_set;                 //!< Parity of the cells that run chains in this launch
+    const Scalar3 ghost_width;            //!< Width of ghost layer
+    const BoxDim box;                     //!< Current simulation box
+    const unsigned int dim;               //!< Number of dimensions
+    const unsigned int num_types;         //!< Number of particle types
+    const Scalar* d_d;                    //!< Collision search distance per type
+    const Scalar* d_a;                    //!< Rotation move size per type
+    const unsigned int* d_check_overlaps; //!< Interaction matrix
+    const Index2D overlap_idx;            //!< Interaction matrix indexer
+    const Scalar chain_time;              //!< Duration of a chain
+    const unsigned int chain_probability; //!< Chain probability in units of 1/65536
+    const Scalar update_fraction;         //!< Chains per particle in a cell
+    const uint16_t seed;                  //!< RNG seed
+    const unsigned int rank;              //!< MPI rank
+    const unsigned int select;            //!< RNG select value
+    const uint64_t timestep;              //!< Current time step
+    hpmc_counters_t* d_counters;          //!< Move acceptance counters
+    hpmc_nec_counters_t* d_nec_counters;  //!< Chain counters
+    Scalar2* d_virial;                    //!< Virial and move length of the chains in each cell
+    const unsigned int block_size;        //!< Block size to execute
+    const hipDeviceProp_t& devprop;       //!< CUDA device properties
+    };
+
+//! Kernel driver for kernel::hpmc_nec_chains()
+template<class Shape>
+void hpmc_nec_chains(const hpmc_nec_args_t& args, const typename Shape::param_type* d_params);
+
+#ifdef __HIPCC__
+namespace kernel
+    {
+//! Distance a particle travels along a direction before its center leaves a cell
+/*! \param f Fractional coordinates of the particle
+    \param df Change of the fractional coordinates per unit length along the direction
+    \param lo Lower fractional coordinates of the cell
+    \param hi Upper fractional coordinates of the cell
+    \param dim Number of dimensions
+*/
+__device__ inline Scalar cell_exit_distance(const Scalar3& f,
+                                            const Scalar3& df,
+                                            const Scalar3& lo,
+                                            const Scalar3& hi,
+                                            const unsigned int dim)
+    {
+    Scalar exit_distance = Scalar(INFINITY);
+    const Scalar fs[3] = {f.x, f.y, f.z};
+    const Scalar dfs[3] = {df.x, df.y, df.z};
+    const Scalar los[3] = {lo.x, lo.y, lo.z};
+    const Scalar his[3] = {hi.x, hi.y, hi.z};
+    for (unsigned int a = 0; a < dim; a++)
+        {
+        if (dfs[a] > Scalar(0.0))
+            exit_distance = min(exit_distance, (his[a] - fs[a]) / dfs[a]);
+        else if (dfs[a] < Scalar(0.0))
+            exit_distance = min(exit_distance, (los[a] - fs[a]) / dfs[a]);
+        }
+    return max(exit_distance, Scalar(0.0));
+    }
+
+//! Run Newtonian event chains in one set of the cells
+/*! Each thread runs the chains of one cell of the set. Chains only move the particles of their own
+    cell and stop where a particle would leave the cell, and particles in the neighboring cells are
+    not moved by the launch. Cells of one set are separated by a cell of the other sets, so the
+    chains of the launch are independent of each other.
+
+    A chain that collides with a particle outside of its cell ends at the collision, because the
+    launch cannot move that particle.
+*/
+template<class Shape>
+__global__ void hpmc_nec_chains(Scalar4* d_postype,
+                                Scalar4* d_orientation,
+                                Scalar4* d_vel,
+                                const unsigned int* d_cell_idx,
+                                const unsigned int* d_cell_size,
+                                const unsigned int* d_cell_adj,
+                                const Index3D ci,
+                                const Index2D cli,
+                                const Index2D cadji,
+                                const uint3 cell_dim,
+                                const uint3 cell_set,
+                                const Scalar3 ghost_width,
+                                const BoxDim box,
+                                const unsigned int dim,
+                                const unsigned int num_types,
+                                const Scalar* d_d,
+                                const Scalar* d_a,
+                                const unsigned int* d_check_overlaps,
+                                const Index2D overlap_idx,
+                                const Scalar chain_time,
+                                const unsigned int chain_probability,
+                                const Scalar update_fraction,
+                                const uint16_t seed,
+                                const unsigned int rank,
+                                const unsigned int select,
+                                const uint64_t timestep,
+                                hpmc_counters_t* d_counters,
+                                hpmc_nec_counters_t* d_nec_counters,
+                                Scalar2* d_virial,
+                                const typename Shape::param_type* d_params,
+                                const unsigned int max_extra_bytes)
+    {
+    // load the per type pair parameters into shared memory
+    HIP_DYNAMIC_SHARED(char, s_data)
+    typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
+    unsigned int* s_check_overlaps = (unsigned int*)(s_params + num_types);
+    unsigned int ntyppairs = overlap_idx.getNumElements();
+
+        // copy over parameters one int per thread for fast loads
+        {
+        unsigned int tidx = threadIdx.x;
+        unsigned int block_size = blockDim.x;
+        unsigned int param_size = num_types * sizeof(typename Shape::param_type) / sizeof(int);
+
+        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < param_size)
+                {
+                ((int*)s_params)[cur_offset + tidx] = ((int*)d_params)[cur_offset + tidx];
+                }
+            }
+
+        for (unsigned int cur_offset = 0; cur_offset < ntyppairs; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < ntyppairs)
+                {
+                s_check_overlaps[cur_offset + tidx] = d_check_overlaps[cur_offset + tidx];
+                }
+            }
+        }
+
+    __syncthreads();
+
+    // initialize extra shared mem
+    char* s_extra = (char*)(s_check_overlaps + ntyppairs);
+
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int cur_type = 0; cur_type < num_types; ++cur_type)
+        s_params[cur_type].load_shared(s_extra, available_bytes);
+
+    __syncthreads();
+
+    // the cells of the set are every other cell in each direction
+    const uint3 n_set_cells
+        = make_uint3(cell_dim.x / 2, cell_dim.y / 2, dim == 3 ? cell_dim.z / 2 : 1);
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n_set_cells.x * n_set_cells.y * n_set_cells.z)
+        return;
+
+    const uint3 c = make_uint3(2 * (idx % n_set_cells.x) + cell_set.x,
+                               2 * ((idx / n_set_cells.x) % n_set_cells.y) + cell_set.y,
+                               (dim == 3 ? 2 : 1) * (idx / (n_set_cells.x * n_set_cells.y))
+                                   + cell_set.z);
+    const unsigned int my_cell = ci(c.x, c.y, c.z);
+    const unsigned int cell_size = d_cell_size[my_cell];
+    if (cell_size == 0)
+        return;
+
+    // fractional bounds of the cell
+    const Scalar3 lo = make_scalar3(Scalar(c.x) / Scalar(cell_dim.x),
+                                    Scalar(c.y) / Scalar(cell_dim.y),
+                                    Scalar(c.z) / Scalar(cell_dim.z));
+    const Scalar3 hi = make_scalar3(Scalar(c.x + 1) / Scalar(cell_dim.x),
+                                    Scalar(c.y + 1) / Scalar(cell_dim.y),
+                                    Scalar(c.z + 1) / Scalar(cell_dim.z));
+
+    hoomd::RandomGenerator rng_cell(
+        hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoChainMove, timestep, seed),
+        hoomd::Counter(my_cell, rank, select));
+
+    // chain statistics are accumulated per thread and added to the totals at the end
+    hpmc_counters_t counters;
+    hpmc_nec_counters_t nec_counters;
+    Scalar2 virial = make_scalar2(0, 0);
+
+    // start update_fraction chains per particle of the cell on average
+    const Scalar n_chains_mean = Scalar(cell_size) * update_fraction;
+    unsigned int n_chains = (unsigned int)n_chains_mean;
+    if (hoomd::detail::generate_canonical<Scalar>(rng_cell) < n_chains_mean - Scalar(n_chains))
+        n_chains++;
+
+    for (unsigned int cur_chain = 0; cur_chain < n_chains; cur_chain++)
+        {
+        const unsigned int i
+            = d_cell_idx[cli(hoomd::UniformIntDistribution(cell_size - 1)(rng_cell), my_cell)];
+
+        Scalar4 postype_i = d_postype[i];
+        int typ_i = __scalar_as_int(postype_i.w);
+        Shape shape_i(quat<Scalar>(d_orientation[i]), s_params[typ_i]);
+
+        unsigned int move_type_select = hoomd::UniformIntDistribution(0xffff)(rng_cell);
+        bool move_type_translate
+            = !shape_i.hasOrientation() || (move_type_select < chain_probability);
+
+        if (move_type_translate)
+            {
+            nec_counters.chain_start_count++;
+
+            // take the particle's velocity as direction
+            vec3<Scalar> direction = vec3<Scalar>(d_vel[i]);
+            Scalar velocity = fast::sqrt(dot(direction, direction));
+            if (velocity == Scalar(0.0))
+                continue;
+            direction /= velocity;
+
+            Scalar chain_time_left = chain_time;
+            unsigned int k = i;
+            const unsigned int max_chain = 100000;
+
+            for (unsigned int count_chain = 0; count_chain < max_chain; count_chain++)
+                {
+                Scalar4 postype_k = d_postype[k];
+                int typ_k = __scalar_as_int(postype_k.w);
+                vec3<Scalar> pos_k = vec3<Scalar>(postype_k);
+                Shape shape_k(quat<Scalar>(d_orientation[k]), s_params[typ_k]);
+
+                // search for the first collision within the search distance
+                Scalar sweep = d_d[typ_k];
+                int next = -1;
+                bool next_in_cell = false;
+                vec3<Scalar> collisionPlaneVector;
+                vec3<Scalar> newCollisionPlaneVector;
+
+                for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
+                    {
+                    const unsigned int neigh_cell = d_cell_adj[cadji(cur_adj, my_cell)];
+                    const unsigned int neigh_size = d_cell_size[neigh_cell];
+                    for (unsigned int cur_p = 0; cur_p < neigh_size; cur_p++)
+                        {
+                        const unsigned int j = d_cell_idx[cli(cur_p, neigh_cell)];
+                        if (j == k)
+                            continue;
+
+                        Scalar4 postype_j = d_postype[j];
+                        unsigned int typ_j = __scalar_as_int(postype_j.w);
+                        Shape shape_j(quat<Scalar>(d_orientation[j]), s_params[typ_j]);
+
+                        vec3<Scalar> r_kj = vec3<Scalar>(postype_j) - pos_k;
+                        r_kj = vec3<Scalar>(box.minImage(vec_to_scalar3(r_kj)));
+
+                        nec_counters.distance_queries++;
+
+                        if (!s_check_overlaps[overlap_idx(typ_k, typ_j)])
+                            continue;
+
+                        Scalar maxR = (shape_k.getCircumsphereDiameter()
+                                       + shape_j.getCircumsphereDiameter())
+                                          / Scalar(2.0)
+                                      + sweep;
+                        if (dot(r_kj, r_kj) >= maxR * maxR)
+                            continue;
+
+                        Scalar newDist = sweep_distance(r_kj,
+                                                        shape_k,
+                                                        shape_j,
+                                                        direction,
+                                                        nec_counters.overlap_err_count,
+                                                        newCollisionPlaneVector);
+
+                        if ((newDist >= Scalar(0.0) && newDist < sweep)
+                            || (newDist < Scalar(-3.5) && dot(r_kj, direction) > Scalar(0.0)))
+                            {
+                            collisionPlaneVector = newCollisionPlaneVector;
+                            sweep = max(newDist, Scalar(0.0));
+                            next = j;
+                            next_in_cell = neigh_cell == my_cell;
+                            }
+                        }
+                    }
+
+                // without a collision, the same particle continues after moving the full
+                // search distance
+                bool collision = next != -1;
+                bool end_chain = false;
+
+                // stop where the particle would leave the cell
+                const Scalar3 f = box.makeFraction(vec_to_scalar3(pos_k), ghost_width);
+                const Scalar3 f_ahead
+                    = box.makeFraction(vec_to_scalar3(pos_k + direction), ghost_width);
+                const Scalar exit_distance = cell_exit_distance(f, f_ahead - f, lo, hi, dim);
+                if (exit_distance < sweep)
+                    {
+                    sweep = exit_distance;
+                    collision = false;
+                    end_chain = true;
+                    }
+
+                // if we go further than what is left: stop
+                if (sweep > chain_time_left * velocity)
+                    {
+                    sweep = chain_time_left * velocity;
+                    collision = false;
+                    end_chain = true;
+                    }
+
+                // statistics for pressure  -1-
+                virial.y += sweep;
+
+                pos_k += sweep * direction;
+                chain_time_left -= sweep / velocity;
+
+                if (!shape_i.ignoreStatistics())
+                    {
+                    if (collision)
+                        {
+                        counters.translate_reject_count++;
+                        nec_counters.chain_at_collision_count++;
+                        }
+                    else
+                        {
+                        if (!end_chain)
+                            counters.translate_accept_count++;
+                        nec_counters.chain_no_collision_count++;
+                        }
+                    }
+
+                d_postype[k] = make_scalar4(pos_k.x, pos_k.y, pos_k.z, postype_k.w);
+
+                if (!collision)
+                    {
+                    if (end_chain)
+                        break;
+                    continue;
+                    }
+
+                vec3<Scalar> delta_pos = vec3<Scalar>(d_postype[next]) - pos_k;
+                delta_pos = vec3<Scalar>(box.minImage(vec_to_scalar3(delta_pos)));
+
+                // statistics for pressure  -2-
+                virial.x += dot(delta_pos, direction);
+
+                // the chain cannot continue with a particle of another cell
+                if (!next_in_cell)
+                    break;
+
+                // Update Velocities (fully elastic)
+                vec3<Scalar> vel_n = vec3<Scalar>(d_vel[next]);
+                vec3<Scalar> vel_k = vec3<Scalar>(d_vel[k]);
+                vec3<Scalar> delta_vel = vel_n - vel_k;
+                vec3<Scalar> vel_change
+                    = collisionPlaneVector
+                      * (dot(delta_vel, collisionPlaneVector)
+                         / dot(collisionPlaneVector, collisionPlaneVector));
+                vel_n -= vel_change;
+                vel_k += vel_change;
+
+                d_vel[next] = make_scalar4(vel_n.x, vel_n.y, vel_n.z, d_vel[next].w);
+                d_vel[k] = make_scalar4(vel_k.x, vel_k.y, vel_k.z, d_vel[k].w);
+
+                velocity = fast::sqrt(dot(vel_n, vel_n));
+                if (velocity == Scalar(0.0))
+                    break;
+                direction = vel_n / velocity;
+                k = next;
+                }
+            }
+        else
+            {
+            // rotation move
+            if (dim == 2)
+                move_rotate<2>(shape_i.orientation, rng_cell, d_a[typ_i]);
+            else
+                move_rotate<3>(shape_i.orientation, rng_cell, d_a[typ_i]);
+
+            vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+            bool overlap = false;
+
+            for (unsigned int cur_adj = 0; cur_adj < cadji.getW() && !overlap; cur_adj++)
+                {
+                const unsigned int neigh_cell = d_cell_adj[cadji(cur_adj, my_cell)];
+                const unsigned int neigh_size = d_cell_size[neigh_cell];
+                for (unsigned int cur_p = 0; cur_p < neigh_size; cur_p++)
+                    {
+                    const unsigned int j = d_cell_idx[cli(cur_p, neigh_cell)];
+                    if (j == i)
+                        continue;
+
+                    Scalar4 postype_j = d_postype[j];
+                    unsigned int typ_j = __scalar_as_int(postype_j.w);
+                    Shape shape_j(quat<Scalar>(d_orientation[j]), s_params[typ_j]);
+
+                    vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i;
+                    r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(r_ij)));
+
+                    counters.overlap_checks++;
+                    if (s_check_overlaps[overlap_idx(typ_i, typ_j)]
+                        && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                        && test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count))
+                        {
+                        overlap = true;
+                        break;
+                        }
+                    }
+                }
+
+            if (!overlap)
+                {
+                d_orientation[i] = quat_to_scalar4(shape_i.orientation);
+                if (!shape_i.ignoreStatistics())
+                    counters.rotate_accept_count++;
+                }
+            else if (!shape_i.ignoreStatistics())
+                {
+                counters.rotate_reject_count++;
+                }
+            }
+        }
+
+    // add the statistics of the cell to the totals
+    d_virial[my_cell].x += virial.x;
+    d_virial[my_cell].y += virial.y;
+
+    atomicAdd(&d_counters->translate_accept_count, counters.translate_accept_count);
+    atomicAdd(&d_counters->translate_reject_count, counters.translate_reject_count);
+    atomicAdd(&d_counters->rotate_accept_count, counters.rotate_accept_count);
+    atomicAdd(&d_counters->rotate_reject_count, counters.rotate_reject_count);
+    atomicAdd(&d_counters->overlap_checks, counters.overlap_checks);
+    atomicAdd(&d_counters->overlap_err_count, counters.overlap_err_count);
+
+    atomicAdd(&d_nec_counters->chain_start_count, nec_counters.chain_start_count);
+    atomicAdd(&d_nec_counters->chain_at_collision_count, nec_counters.chain_at_collision_count);
+    atomicAdd(&d_nec_counters->chain_no_collision_count, nec_counters.chain_no_collision_count);
+    atomicAdd(&d_nec_counters->distance_queries, nec_counters.distance_queries);
+    atomicAdd(&d_nec_counters->overlap_err_count, nec_counters.overlap_err_count);
+    }
+    } // end namespace kernel
+
+//! Kernel driver for kernel::hpmc_nec_chains()
+/*! \param args Bundled arguments
+    \param d_params Per-type shape parameters
+
+    This templatized method is the kernel driver for the chains of any shape with a sweep_distance
+    function. It is instantiated for each such shape in a kernel_nec_chains_*.cu file.
+
+    \ingroup hpmc_kernels
+*/
+template<class Shape>
+void hpmc_nec_chains(const hpmc_nec_args_t& args, const typename Shape::param_type* d_params)
+    {
+    assert(args.d_postype);
+    assert(args.d_orientation);
+    assert(args.d_vel);
+    assert(args.d_cell_size);
+    assert(args.cell_dim.x % 2 == 0 && args.cell_dim.y % 2 == 0);
+
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_nec_chains<Shape>));
+    max_block_size = attr.maxThreadsPerBlock;
+    unsigned int run_block_size = min(args.block_size, (unsigned int)max_block_size);
+
+    const unsigned int n_set_cells = (args.cell_dim.x / 2) * (args.cell_dim.y / 2)
+                                     * (args.dim == 3 ? args.cell_dim.z / 2 : 1);
+
+    size_t shared_bytes = args.num_types * sizeof(typename Shape::param_type)
+                          + args.overlap_idx.getNumElements() * sizeof(unsigned int);
+
+    if (shared_bytes + attr.sharedSizeBytes >= args.devprop.sharedMemPerBlock)
+        {
+        throw std::runtime_error("HPMC shape parameters exceed the available shared "
+                                 "memory per block.");
+        }
+
+    unsigned int max_extra_bytes = static_cast<unsigned int>(args.devprop.sharedMemPerBlock
+                                                             - attr.sharedSizeBytes - shared_bytes);
+
+    // determine dynamically requested shared memory
+    char* ptr = (char*)nullptr;
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int i = 0; i < args.num_types; ++i)
+        {
+        d_params[i].allocate_shared(ptr, available_bytes);
+        }
+    const unsigned int extra_bytes = max_extra_bytes - available_bytes;
+
+    shared_bytes += extra_bytes;
+
+    dim3 threads(run_block_size, 1, 1);
+    dim3 grid(n_set_cells / run_block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(kernel::hpmc_nec_chains<Shape>),
+                       grid,
+                       threads,
+                       shared_bytes,
+                       0,
+                       args.d_postype,
+                       args.d_orientation,
+                       args.d_vel,
+                       args.d_cell_idx,
+                       args.d_cell_size,
+                       args.d_cell_adj,
+                       args.ci,
+                       args.cli,
+                       args.cadji,
+                       args.cell_dim,
+                       args.cell_set,
+                       args.ghost_width,
+                       args.box,
+                       args.dim,
+                       args.num_types,
+                       args.d_d,
+                       args.d_a,
+                       args.d_check_overlaps,
+                       args.overlap_idx,
+                       args.chain_time,
+                       args.chain_probability,
+                       args.update_fraction,
+                       args.seed,
+                       args.rank,
+                       args.select,
+                       args.timestep,
+                       args.d_counters,
+                       args.d_nec_counters,
+                       args.d_virial,
+                       d_params,
+                       max_extra_bytes);
+    }
+#endif
+
+    } // namespace gpu
+    } // namespace hpmc
+
+    } // namespace hoomd
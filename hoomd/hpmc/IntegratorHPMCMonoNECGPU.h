@@ -0,0 +1,358 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef ENABLE_HIP
+
+#include "hoomd/hpmc/IntegratorHPMCMonoGPUTypes.cuh"
+#include "hoomd/hpmc/IntegratorHPMCMonoNEC.h"
+#include "hoomd/hpmc/IntegratorHPMCMonoNECGPU.cuh"
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/CellList.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <hip/hip_runtime.h>
+
+/*! \file IntegratorHPMCMonoNECGPU.h
+    \brief Defines the template class for HPMC with Newtonian event chains on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+//! Template class for HPMC update with Newtonian event chains on the GPU
+/*! The GPU runs many chains concurrently, one in each cell of a checkerboard set of the cell list.
+    Chains stay in their cell, so the cell width bounds both the shape size and the collision search
+    distance. The cell list origin shifts randomly after each step so that particles move between
+    cells.
+
+    \ingroup hpmc_integrators
+*/
+template<class Shape> class IntegratorHPMCMonoNECGPU : public IntegratorHPMCMonoNEC<Shape>
+    {
+    public:
+    //! Construct the integrator
+    IntegratorHPMCMonoNECGPU(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<CellList> cl);
+    //! Destructor
+    virtual ~IntegratorHPMCMonoNECGPU();
+
+    /// Start autotuning kernel launch parameters
+    virtual void startAutotuning()
+        {
+        IntegratorHPMCMonoNEC<Shape>::startAutotuning();
+
+        // Tune the cell list in addition to the kernels in `m_autotuners`.
+        m_cl->startAutotuning();
+        }
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+    protected:
+    std::shared_ptr<CellList> m_cl; //!< Cell list
+
+    GPUArray<Scalar2> m_virial; //!< Virial and move length of the chains in each cell
+
+    /// Autotuner for the chains.
+    std::shared_ptr<Autotuner<1>> m_tuner_chains;
+
+    //! Set the memory hints of the shape parameters
+    virtual void updateCellWidth();
+    };
+
+template<class Shape>
+IntegratorHPMCMonoNECGPU<Shape>::IntegratorHPMCMonoNECGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                          std::shared_ptr<CellList> cl)
+    : IntegratorHPMCMonoNEC<Shape>(sysdef), m_cl(cl)
+    {
+    this->m_cl->setRadius(1);
+    this->m_cl->setComputeTypeBody(false);
+    this->m_cl->setFlagType();
+    this->m_cl->setComputeIdx(true);
+    // the checkerboard needs an even number of cells in each direction
+    this->m_cl->setMultiple(2);
+
+    GPUArray<Scalar2> virial(0, this->m_exec_conf);
+    m_virial.swap(virial);
+
+    m_tuner_chains.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                          this->m_exec_conf,
+                                          "hpmc_nec_chains"));
+    this->m_autotuners.push_back(m_tuner_chains);
+    }
+
+template<class Shape> IntegratorHPMCMonoNECGPU<Shape>::~IntegratorHPMCMonoNECGPU() { }
+
+template<class Shape> void IntegratorHPMCMonoNECGPU<Shape>::update(uint64_t timestep)
+    {
+    this->m_exec_conf->msg->notice(10) << "HPMCMonoEC GPU update: " << timestep << std::endl;
+    IntegratorHPMC::update(timestep);
+
+        {
+        ArrayHandle<hpmc_nec_counters_t> h_nec_counters(this->m_nec_count_total,
+                                                        access_location::host,
+                                                        access_mode::read);
+        this->m_nec_count_step_start = h_nec_counters.data[0];
+        }
+
+    // reset pressure statistics
+    this->count_pressurevirial = 0.0;
+    this->count_movelength = 0.0;
+
+    const BoxDim box = this->m_pdata->getBox();
+    const unsigned int ndim = this->m_sysdef->getNDimensions();
+
+    // rng for the set order and the grid shift
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoShift, timestep, this->m_sysdef->getSeed()),
+        hoomd::Counter());
+
+    // chains search for collisions within the move size d, and stay in their cell
+    this->limitMoveDistances();
+    Scalar max_d = 0;
+        {
+        ArrayHandle<Scalar> h_d(this->m_d, access_location::host, access_mode::read);
+        for (unsigned int type = 0; type < this->m_pdata->getNTypes(); type++)
+            max_d = std::max(max_d, h_d.data[type]);
+        }
+    const Scalar nominal_width = this->m_nominal_width + max_d;
+    if (m_cl->getNominalWidth() != nominal_width)
+        m_cl->setNominalWidth(nominal_width);
+
+    if (this->m_pdata->getN() > 0)
+        {
+        // the checkerboard needs at least 2 cells in each direction
+        Scalar3 npd = box.getNearestPlaneDistance();
+        if ((box.getPeriodic().x && npd.x < nominal_width * 2)
+            || (box.getPeriodic().y && npd.y < nominal_width * 2)
+            || (ndim == 3 && box.getPeriodic().z && npd.z < nominal_width * 2))
+            {
+            std::ostringstream oss;
+            oss << "Simulation box too small for GPU accelerated NEC execution - increase it so "
+                   "that it is two cells of width "
+                << nominal_width << " wide in each direction." << std::endl;
+            throw std::runtime_error(oss.str());
+            }
+
+        // update the cell list, which stays valid as long as the chains keep particles in place
+        this->m_cl->compute(timestep);
+        const uint3 cell_dim = this->m_cl->getDim();
+        const unsigned int n_cells = this->m_cl->getCellIndexer().getNumElements();
+
+        if (m_virial.getNumElements() < n_cells)
+            m_virial.resize(n_cells);
+
+            {
+            ArrayHandle<Scalar2> d_virial(m_virial,
+                                          access_location::device,
+                                          access_mode::overwrite);
+            hipMemsetAsync(d_virial.data, 0, sizeof(Scalar2) * n_cells);
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+
+        // access the cell list data
+        ArrayHandle<unsigned int> d_cell_size(this->m_cl->getCellSizeArray(),
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> d_cell_idx(this->m_cl->getIndexArray(),
+                                             access_location::device,
+                                             access_mode::read);
+        ArrayHandle<unsigned int> d_cell_adj(this->m_cl->getCellAdjArray(),
+                                             access_location::device,
+                                             access_mode::read);
+
+        // access the particle data
+        ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+        ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::readwrite);
+        ArrayHandle<Scalar4> d_vel(this->m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::readwrite);
+
+        // access the parameters and interaction matrix
+        ArrayHandle<unsigned int> d_overlaps(this->m_overlaps,
+                                             access_location::device,
+                                             access_mode::read);
+        ArrayHandle<Scalar> d_d(this->m_d, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_a(this->m_a, access_location::device, access_mode::read);
+        auto& params = this->getParams();
+
+        // MC counters
+        ArrayHandle<hpmc_counters_t> d_counters(this->m_count_total,
+                                                access_location::device,
+                                                access_mode::readwrite);
+        ArrayHandle<hpmc_nec_counters_t> d_nec_counters(this->m_nec_count_total,
+                                                        access_location::device,
+                                                        access_mode::readwrite);
+        ArrayHandle<Scalar2> d_virial(m_virial, access_location::device, access_mode::readwrite);
+
+        // the cells of one set are every other cell in each direction
+        std::vector<uint3> cell_sets;
+        for (unsigned int z = 0; z < (ndim == 3 ? 2u : 1u); z++)
+            for (unsigned int y = 0; y < 2; y++)
+                for (unsigned int x = 0; x < 2; x++)
+                    cell_sets.push_back(make_uint3(x, y, z));
+
+        for (unsigned int i_nselect = 0; i_nselect < this->m_nselect; i_nselect++)
+            {
+            // visit the sets in a random order
+            for (unsigned int i = (unsigned int)cell_sets.size() - 1; i > 0; i--)
+                std::swap(cell_sets[i], cell_sets[hoomd::UniformIntDistribution(i)(rng)]);
+
+            for (const uint3& cell_set : cell_sets)
+                {
+                m_tuner_chains->begin();
+                gpu::hpmc_nec_args_t args(d_postype.data,
+                                          d_orientation.data,
+                                          d_vel.data,
+                                          d_cell_idx.data,
+                                          d_cell_size.data,
+                                          d_cell_adj.data,
+                                          this->m_cl->getCellIndexer(),
+                                          this->m_cl->getCellListIndexer(),
+                                          this->m_cl->getCellAdjIndexer(),
+                                          cell_dim,
+                                          cell_set,
+                                          this->m_cl->getGhostWidth(),
+                                          box,
+                                          ndim,
+                                          this->m_pdata->getNTypes(),
+                                          d_d.data,
+                                          d_a.data,
+                                          d_overlaps.data,
+                                          this->m_overlap_idx,
+                                          this->m_chain_time,
+                                          this->m_chain_probability,
+                                          this->m_update_fraction,
+                                          this->m_sysdef->getSeed(),
+                                          this->m_exec_conf->getRank(),
+                                          i_nselect,
+                                          timestep,
+                                          d_counters.data,
+                                          d_nec_counters.data,
+                                          d_virial.data,
+                                          m_tuner_chains->getParam()[0],
+                                          this->m_exec_conf->dev_prop);
+                gpu::hpmc_nec_chains<Shape>(args, params.data());
+                if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                m_tuner_chains->end();
+                }
+            }
+        }
+
+    // sum the pressure statistics of all cells
+    if (this->m_pdata->getN() > 0)
+        {
+        ArrayHandle<Scalar2> h_virial(m_virial, access_location::host, access_mode::read);
+        const unsigned int n_cells = this->m_cl->getCellIndexer().getNumElements();
+        for (unsigned int cell = 0; cell < n_cells; cell++)
+            {
+            this->count_pressurevirial += h_virial.data[cell].x;
+            this->count_movelength += h_virial.data[cell].y;
+            }
+        }
+
+    // shift particles so that the cell boundaries move
+    Scalar3 shift = make_scalar3(0, 0, 0);
+    hoomd::UniformDistribution<Scalar> uniform(-nominal_width / Scalar(2.0),
+                                               nominal_width / Scalar(2.0));
+    shift.x = uniform(rng);
+    shift.y = uniform(rng);
+    if (ndim == 3)
+        {
+        shift.z = uniform(rng);
+        }
+
+    if (this->m_pdata->getN() > 0)
+        {
+        ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+        ArrayHandle<int3> d_image(this->m_pdata->getImages(),
+                                  access_location::device,
+                                  access_mode::readwrite);
+
+        gpu::hpmc_shift(d_postype.data, d_image.data, this->m_pdata->getN(), box, shift, 128);
+        }
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    // update the particle data origin
+    this->m_pdata->translateOrigin(shift);
+
+    this->communicate(true);
+
+    // all particle have been moved, the aabb tree is now invalid
+    this->m_aabb_tree_invalid = true;
+
+    hpmc_counters_t run_counters = this->getCounters(1);
+    hpmc_nec_counters_t run_nec_counters = this->getNECCounters(1);
+    double cur_time = double(this->m_clock.getTime()) / Scalar(1e9);
+    unsigned long long sum_of_moves
+        = run_counters.rotate_accept_count + run_counters.rotate_reject_count
+          + run_nec_counters.chain_at_collision_count + run_nec_counters.chain_no_collision_count;
+    this->m_mps = double(sum_of_moves) / cur_time;
+    }
+
+template<class Shape> void IntegratorHPMCMonoNECGPU<Shape>::updateCellWidth()
+    {
+    // call base class method
+    IntegratorHPMCMonoNEC<Shape>::updateCellWidth();
+
+#ifdef __HIP_PLATFORM_NVCC__
+    // set memory hints
+    cudaMemAdvise(this->m_params.data(),
+                  this->m_params.size() * sizeof(typename Shape::param_type),
+                  cudaMemAdviseSetReadMostly,
+                  0);
+    CHECK_CUDA_ERROR();
+#endif
+
+    // sync up so we can access the parameters
+    hipDeviceSynchronize();
+
+    for (unsigned int i = 0; i < this->m_pdata->getNTypes(); ++i)
+        {
+        // attach nested memory regions
+        this->m_params[i].set_memory_hint();
+        CHECK_CUDA_ERROR();
+        }
+    }
+
+namespace detail
+    {
+//! Export this hpmc integrator to python
+/*! \param name Name of the class in the exported python module
+    \tparam Shape An instantiation of IntegratorHPMCMonoNECGPU<Shape> will be exported
+*/
+template<class Shape>
+void export_IntegratorHPMCMonoNECGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<IntegratorHPMCMonoNECGPU<Shape>,
+                     IntegratorHPMCMonoNEC<Shape>,
+                     std::shared_ptr<IntegratorHPMCMonoNECGPU<Shape>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<CellList>>());
+    }
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
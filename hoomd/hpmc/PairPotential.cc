@@ -11,6 +11,9 @@ void exportPairPotential(pybind11::module& m)
     {
     pybind11::class_<hpmc::PairPotential, std::shared_ptr<hpmc::PairPotential>>(m, "PairPotential")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
-        .def("setParent", &hpmc::PairPotential::setParent);
+        .def("setParent", &hpmc::PairPotential::setParent)
+        .def_property("table_width",
+                      &hpmc::PairPotential::getTableWidth,
+                      &hpmc::PairPotential::setTableWidth);
     }
     } // namespace hoomd::hpmc::detail
@@ -6,6 +6,10 @@
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/SystemDefinition.h"
 
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
 namespace hoomd
     {
 namespace hpmc
@@ -46,6 +50,14 @@ namespace hpmc
     Subclasses must call notifyRCutChanged whenever they would change the value of their computed
     r_cut values. The cached values ensure that we can use non-virtual inlined calls in the
     inner loops where the total r_cut values are checked.
+
+    Isotropic potentials (those that override isIsotropic to return true) may also be evaluated
+    from a table. When the table width is non-zero, the potential samples energy() at width + 1
+    points evenly spaced in r_squared from 0 to r_cut_squared for every type pair. evaluate() then
+    linearly interpolates the table with a non-virtual inlined lookup. The first bin
+    (where most potentials diverge) is always computed with energy(). Subclasses must call
+    notifyEnergyChanged whenever they change a parameter that affects the energy but not r_cut.
+    Callers in inner loops should call evaluate() in place of energy().
 */
 class PairPotential
     {
@@ -125,6 +137,71 @@ class PairPotential
         return 0;
         }
 
+    /*** Evaluate the energy of the pair interaction, using the table when enabled.
+
+        Takes the same arguments as energy() and returns the tabulated approximation to it.
+    */
+    inline LongReal evaluate(const LongReal r_squared,
+                             const vec3<LongReal>& r_ij,
+                             const unsigned int type_i,
+                             const quat<LongReal>& q_i,
+                             const LongReal charge_i,
+                             const unsigned int type_j,
+                             const quat<LongReal>& q_j,
+                             const LongReal charge_j) const
+        {
+        if (m_table_width > 0)
+            {
+            const unsigned int param_index = m_type_param_index(type_i, type_j);
+            const LongReal x = r_squared * m_table_inverse_spacing[param_index];
+            const unsigned int bin = static_cast<unsigned int>(x);
+            if (bin > 0 && bin < m_table_width)
+                {
+                const LongReal* table = &m_table[param_index * (m_table_width + 1)];
+                const LongReal f = x - LongReal(bin);
+                return table[bin] + f * (table[bin + 1] - table[bin]);
+                }
+            }
+
+        return energy(r_squared, r_ij, type_i, q_i, charge_i, type_j, q_j, charge_j);
+        }
+
+    /// Returns true when the energy depends only on the types and r_squared.
+    virtual bool isIsotropic() const
+        {
+        return false;
+        }
+
+    /// Set the number of bins in the energy table (0 disables the table).
+    void setTableWidth(unsigned int width)
+        {
+        if (width != 0 && !isIsotropic())
+            {
+            throw std::invalid_argument("Only isotropic pair potentials may be tabulated.");
+            }
+
+        m_table_width = width;
+        updateTable();
+        }
+
+    /// Get the number of bins in the energy table.
+    unsigned int getTableWidth() const
+        {
+        return m_table_width;
+        }
+
+    /// Get the tabulated energies (m_table_width + 1 values per type pair).
+    const std::vector<LongReal>& getTable() const
+        {
+        return m_table;
+        }
+
+    /// Get the inverse of the r_squared spacing of the table for a type pair.
+    inline LongReal getTableInverseSpacing(unsigned int type_i, unsigned int type_j) const
+        {
+        return m_table_inverse_spacing[m_type_param_index(type_i, type_j)];
+        }
+
     /// Compute the non-additive cuttoff radius
     virtual LongReal computeRCutNonAdditive(unsigned int type_i, unsigned int type_j) const
         {
@@ -153,6 +230,13 @@ class PairPotential
             }
 
         updateRCutCache();
+        updateTable();
+        }
+
+    /// Rebuild the energy table after a change to the parameters.
+    void notifyEnergyChanged()
+        {
+        updateTable();
         }
 
     private:
@@ -171,6 +255,68 @@ class PairPotential
     /// Parent potential
     std::weak_ptr<PairPotential> m_parent;
 
+    /// Number of bins in the energy table (0 when disabled).
+    unsigned int m_table_width = 0;
+
+    /// Tabulated energies, m_table_width + 1 values per type pair (indexed by m_type_param_index).
+    std::vector<LongReal> m_table;
+
+    /// Inverse of the r_squared spacing of each type pair's table.
+    std::vector<LongReal> m_table_inverse_spacing;
+
+    /// Sample energy() for every type pair.
+    void updateTable()
+        {
+        if (m_table_width == 0)
+            {
+            m_table.clear();
+            m_table_inverse_spacing.clear();
+            return;
+            }
+
+        const unsigned int n_pairs = m_type_param_index.getNumElements();
+        const unsigned int n_types = m_sysdef->getParticleData()->getNTypes();
+        m_table.assign(n_pairs * (m_table_width + 1), 0);
+        m_table_inverse_spacing.assign(n_pairs, 0);
+
+        for (unsigned int type_i = 0; type_i < n_types; type_i++)
+            {
+            for (unsigned int type_j = 0; type_j < n_types; type_j++)
+                {
+                const unsigned int param_index = m_type_param_index(type_i, type_j);
+                const LongReal r_cut_squared = m_r_cut_squared_total[param_index];
+                if (r_cut_squared <= 0)
+                    {
+                    continue;
+                    }
+
+                const LongReal spacing = r_cut_squared / LongReal(m_table_width);
+                m_table_inverse_spacing[param_index] = LongReal(1.0) / spacing;
+
+                // evaluate() computes bin 0 directly. Other callers (the GPU) treat a potential
+                // that diverges at r = 0 as a hard core in bin 0.
+                LongReal* table = &m_table[param_index * (m_table_width + 1)];
+                for (unsigned int bin = 0; bin <= m_table_width; bin++)
+                    {
+                    const LongReal r_squared = spacing * LongReal(bin);
+                    const vec3<LongReal> r_ij(slow::sqrt(r_squared), 0, 0);
+                    table[bin] = energy(r_squared,
+                                        r_ij,
+                                        type_i,
+                                        quat<LongReal>(),
+                                        0,
+                                        type_j,
+                                        quat<LongReal>(),
+                                        0);
+                    if (!std::isfinite(table[bin]))
+                        {
+                        table[bin] = std::numeric_limits<LongReal>::infinity();
+                        }
+                    }
+                }
+            }
+        }
+
     /// Update r_cut cache
     void updateRCutCache()
         {
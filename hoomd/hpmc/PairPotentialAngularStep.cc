@@ -108,7 +108,7 @@ LongReal PairPotentialAngularStep::energy(const LongReal r_squared,
     if (maskingFunction(r_squared, r_ij, type_i, q_i, type_j, q_j))
         {
         return m_isotropic_potential
-            ->energy(r_squared, r_ij, type_i, q_i, charge_i, type_j, q_j, charge_j);
+            ->evaluate(r_squared, r_ij, type_i, q_i, charge_i, type_j, q_j, charge_j);
         }
     return 0;
     }
@@ -29,6 +29,12 @@ class PairPotentialLJGauss : public hpmc::PairPotential
                             const quat<LongReal>& q_j,
                             const LongReal charge_j) const;
 
+    /// The energy depends only on the types and r_squared.
+    virtual bool isIsotropic() const
+        {
+        return true;
+        }
+
     /// Compute the non-additive cuttoff radius
     virtual LongReal computeRCutNonAdditive(unsigned int type_i, unsigned int type_j) const
         {
@@ -60,6 +66,8 @@ class PairPotentialLJGauss : public hpmc::PairPotential
             {
             throw std::domain_error("Invalid mode " + mode_str);
             }
+
+        notifyEnergyChanged();
         }
 
     std::string getMode()
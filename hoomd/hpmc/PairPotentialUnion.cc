@@ -267,14 +267,14 @@ LongReal PairPotentialUnion::compute_leaf_leaf_energy(vec3<LongReal> dr,
             LongReal rsq = dot(r_ij, r_ij);
             if (rsq < m_constituent_potential->getRCutSquaredTotal(type_i, type_j))
                 {
-                energy += m_constituent_potential->energy(rsq,
-                                                          r_ij,
-                                                          type_i,
-                                                          orientation_i,
-                                                          m_charge[type_a][ileaf],
-                                                          type_j,
-                                                          orientation_j,
-                                                          m_charge[type_b][jleaf]);
+                energy += m_constituent_potential->evaluate(rsq,
+                                                            r_ij,
+                                                            type_i,
+                                                            orientation_i,
+                                                            m_charge[type_a][ileaf],
+                                                            type_j,
+                                                            orientation_j,
+                                                            m_charge[type_b][jleaf]);
                 }
             }
         }
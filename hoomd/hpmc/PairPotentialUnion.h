@@ -152,14 +152,14 @@ class PairPotentialUnion : public hpmc::PairPotential
                 if (rsq < m_constituent_potential->getRCutSquaredTotal(constituent_type_i,
                                                                        constituent_type_j))
                     {
-                    energy += m_constituent_potential->energy(rsq,
-                                                              constituent_r_ij,
-                                                              constituent_type_i,
-                                                              constituent_orientation_i,
-                                                              m_charge[type_i][i],
-                                                              constituent_type_j,
-                                                              constituent_orientation_j,
-                                                              m_charge[type_j][j]);
+                    energy += m_constituent_potential->evaluate(rsq,
+                                                                constituent_r_ij,
+                                                                constituent_type_i,
+                                                                constituent_orientation_i,
+                                                                m_charge[type_i][i],
+                                                                constituent_type_j,
+                                                                constituent_orientation_j,
+                                                                m_charge[type_j][j]);
                     }
                 }
             }
@@ -823,6 +823,49 @@ DEVICE inline __attribute__((always_inline)) bool test_overlap(const vec3<Scalar
     */
     }
 
+template<> struct UsesSeparatingAxis<ShapeConvexPolyhedron, ShapeConvexPolyhedron>
+    {
+    static const bool value = true;
+    };
+
+//! Convex polyhedron overlap test starting from a separating axis
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \param err in/out variable incremented when error conditions occur in the overlap test
+    \param axis Separating axis in the global frame (in/out)
+    \returns true when *a* and *b* overlap, and false when they are disjoint
+
+    \ingroup shape
+*/
+template<>
+DEVICE inline bool test_overlap_cached(const vec3<Scalar>& r_ab,
+                                       const ShapeConvexPolyhedron& a,
+                                       const ShapeConvexPolyhedron& b,
+                                       unsigned int& err,
+                                       vec3<ShortReal>& axis)
+    {
+    vec3<ShortReal> dr(r_ab);
+    quat<ShortReal> q_a(a.orientation);
+
+    ShortReal DaDb = a.getCircumsphereDiameter() + b.getCircumsphereDiameter();
+
+    // xenocollide works in the frame of a
+    vec3<ShortReal> axis_a = rotate(conj(q_a), axis);
+    bool overlap
+        = detail::xenocollide_3d(detail::SupportFuncConvexPolyhedron(a.verts),
+                                 detail::SupportFuncConvexPolyhedron(b.verts),
+                                 rotate(conj(q_a), dr),
+                                 conj(q_a) * quat<ShortReal>(b.orientation),
+                                 DaDb / ShortReal(2.0),
+                                 err,
+                                 &axis_a);
+    if (!overlap)
+        axis = rotate(q_a, axis_a);
+
+    return overlap;
+    }
+
 //! Convex polyhedron sweep distance
 /*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
     \param a first shape
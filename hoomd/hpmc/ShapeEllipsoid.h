@@ -123,8 +123,8 @@ struct ShapeEllipsoid
     /// Get the in-sphere radius of the shape
     DEVICE ShortReal getInsphereRadius() const
         {
-        // not implemented
-        return ShortReal(0.0);
+        // the smallest semi-axis
+        return detail::min(axes.x, detail::min(axes.y, axes.z));
         }
 
     /** Support function of the shape (in local coordinates), used in getAABB
@@ -479,6 +479,23 @@ DEVICE inline bool test_overlap<ShapeEllipsoid, ShapeEllipsoid>(const vec3<Scala
     return ret_val == ELLIPSOID_OVERLAP_TRUE;
     }
 
+template<> struct HasSupportExtent<ShapeEllipsoid>
+    {
+    static const bool value = true;
+    };
+
+//! Extent of an ellipsoid along a direction
+/*! \param shape Shape (its orientation is ignored)
+    \param n Unit vector in the local frame of the shape
+    \returns sqrt(a^2 n_x^2 + b^2 n_y^2 + c^2 n_z^2)
+*/
+template<>
+DEVICE inline ShortReal support_extent(const ShapeEllipsoid& shape, const vec3<ShortReal>& n)
+    {
+    vec3<ShortReal> dvec(shape.axes.x * n.x, shape.axes.y * n.y, shape.axes.z * n.z);
+    return fast::sqrt(dot(dvec, dvec));
+    }
+
 #ifndef __HIPCC__
 template<> inline std::string getShapeSpec(const ShapeEllipsoid& ellipsoid)
     {
@@ -649,6 +649,22 @@ test_overlap<ShapeFacetedEllipsoid, ShapeFacetedEllipsoid>(const vec3<Scalar>& r
         err);
     }
 
+template<> struct HasSupportExtent<ShapeFacetedEllipsoid>
+    {
+    static const bool value = true;
+    };
+
+//! Extent of a faceted ellipsoid along a direction
+/*! \param shape Shape (its orientation is ignored)
+    \param n Unit vector in the local frame of the shape
+    \returns dot(s, n) where s is the supporting point in the direction n
+*/
+template<>
+DEVICE inline ShortReal support_extent(const ShapeFacetedEllipsoid& shape, const vec3<ShortReal>& n)
+    {
+    return dot(detail::SupportFuncFacetedEllipsoid(shape.params)(n), n);
+    }
+
     } // end namespace hpmc
     } // end namespace hoomd
 
@@ -184,9 +184,28 @@ struct TriangleMesh : ShapeParams
             internal_coordinates.push_back(face_vec);
             }
 
-        OBBTree tree_obb;
-        tree_obb.buildTree(obbs, internal_coordinates, sweep_radius, n_faces, leaf_capacity);
-        tree = GPUTree(tree_obb, managed);
+        // reuse the tree of an identical mesh, e.g. another type with the same shape
+        OBBTreeKey key("mesh");
+        key.append(leaf_capacity);
+        key.append(sweep_radius);
+        for (unsigned int i = 0; i < n_faces; ++i)
+            {
+            key.append(obbs[i]);
+            for (const auto& v : internal_coordinates[i])
+                key.append(v);
+            }
+
+        tree = buildCachedGPUTree(
+            key,
+            [&](OBBTree& tree_obb)
+            {
+                tree_obb.buildTree(obbs,
+                                   internal_coordinates,
+                                   sweep_radius,
+                                   n_faces,
+                                   leaf_capacity);
+            },
+            managed);
         delete[] obbs;
 
         // set the diameter
@@ -248,12 +248,31 @@ struct ShapeSphere
     \param b second shape
     \returns true if the circumspheres of both shapes overlap
 
+    Most pairs passed to this check are far from contact. A single precision test with a margin
+    well above its rounding error decides those pairs, and only the pairs near contact repeat the
+    test in LongReal precision. The result is the same as the LongReal test alone.
+
     \ingroup shape
 */
 template<class ShapeA, class ShapeB>
 DEVICE inline bool
 check_circumsphere_overlap(const vec3<LongReal>& r_ab, const ShapeA& a, const ShapeB& b)
     {
+    const ShortReal margin = ShortReal(1e-4);
+    const vec3<ShortReal> r_ab_short(r_ab);
+    const ShortReal r_squared_short = dot(r_ab_short, r_ab_short) * ShortReal(4.0);
+    const ShortReal diameter_sum_short
+        = ShortReal(a.getCircumsphereDiameter()) + ShortReal(b.getCircumsphereDiameter());
+    const ShortReal diameter_sum_squared_short = diameter_sum_short * diameter_sum_short;
+    if (r_squared_short > diameter_sum_squared_short * (ShortReal(1.0) + margin))
+        {
+        return false;
+        }
+    if (r_squared_short < diameter_sum_squared_short * (ShortReal(1.0) - margin))
+        {
+        return true;
+        }
+
     LongReal r_squared = dot(r_ab, r_ab);
     LongReal diameter_sum = a.getCircumsphereDiameter() + b.getCircumsphereDiameter();
     return (r_squared * LongReal(4.0) <= diameter_sum * diameter_sum);
@@ -275,6 +294,53 @@ test_overlap(const vec3<Scalar>& r_ab, const ShapeA& a, const ShapeB& b, unsigne
     return true;
     }
 
+//! Set to true for pairs of shapes whose test_overlap_cached() makes use of the separating axis
+template<class ShapeA, class ShapeB> struct UsesSeparatingAxis
+    {
+    static const bool value = false;
+    };
+
+//! Overlap test starting from a separating axis found by an earlier test of the same pair
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \param err Incremented if there is an error condition. Left unchanged otherwise.
+    \param axis Separating axis in the global frame (in/out), zero when not known. Set to a new
+           separating axis when the shapes are disjoint.
+    \returns true when *a* and *b* overlap, and false when they are disjoint
+
+    The default implementation ignores \a axis. Stale axes never change the result: they only speed
+   up the test when they still separate the shapes.
+*/
+template<class ShapeA, class ShapeB>
+DEVICE inline bool test_overlap_cached(const vec3<Scalar>& r_ab,
+                                       const ShapeA& a,
+                                       const ShapeB& b,
+                                       unsigned int& err,
+                                       vec3<ShortReal>& axis)
+    {
+    return test_overlap(r_ab, a, b, err);
+    }
+
+//! Set to true for convex shapes whose support_extent() is tighter than the circumsphere
+template<class Shape> struct HasSupportExtent
+    {
+    static const bool value = false;
+    };
+
+//! Extent of a convex shape along a direction
+/*! \param shape Shape (its orientation is ignored)
+    \param n Unit vector in the local frame of the shape
+    \returns An upper bound on dot(x, n) over all points x of the shape
+
+    The default implementation returns the circumsphere radius.
+*/
+template<class Shape>
+DEVICE inline ShortReal support_extent(const Shape& shape, const vec3<ShortReal>& n)
+    {
+    return ShortReal(0.5) * shape.getCircumsphereDiameter();
+    }
+
 //! Sphere-Sphere overlap
 /*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
     \param a first shape
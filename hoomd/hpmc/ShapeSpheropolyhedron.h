@@ -161,6 +161,68 @@ DEVICE inline bool test_overlap(const vec3<Scalar>& r_ab,
     */
     }
 
+template<> struct UsesSeparatingAxis<ShapeSpheropolyhedron, ShapeSpheropolyhedron>
+    {
+    static const bool value = true;
+    };
+
+//! Spheropolyhedron overlap test starting from a separating axis
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \param err in/out variable incremented when error conditions occur in the overlap test
+    \param axis Separating axis in the global frame (in/out)
+    \returns true when *a* and *b* overlap, and false when they are disjoint
+
+    \ingroup shape
+*/
+template<>
+DEVICE inline bool test_overlap_cached(const vec3<Scalar>& r_ab,
+                                       const ShapeSpheropolyhedron& a,
+                                       const ShapeSpheropolyhedron& b,
+                                       unsigned int& err,
+                                       vec3<ShortReal>& axis)
+    {
+    vec3<ShortReal> dr(r_ab);
+    quat<ShortReal> q_a(a.orientation);
+
+    ShortReal DaDb = a.getCircumsphereDiameter() + b.getCircumsphereDiameter();
+
+    // xenocollide works in the frame of a
+    vec3<ShortReal> axis_a = rotate(conj(q_a), axis);
+    bool overlap
+        = xenocollide_3d(detail::SupportFuncConvexPolyhedron(a.verts, a.verts.sweep_radius),
+                         detail::SupportFuncConvexPolyhedron(b.verts, b.verts.sweep_radius),
+                         rotate(conj(q_a), dr),
+                         conj(q_a) * quat<ShortReal>(b.orientation),
+                         DaDb / ShortReal(2.0),
+                         err,
+                         &axis_a);
+    if (!overlap)
+        axis = rotate(q_a, axis_a);
+
+    return overlap;
+    }
+
+template<> struct HasSupportExtent<ShapeSpheropolyhedron>
+    {
+    static const bool value = true;
+    };
+
+//! Extent of a spheropolyhedron along a direction
+/*! \param shape Shape (its orientation is ignored)
+    \param n Unit vector in the local frame of the shape
+    \returns The largest dot(v, n) over the vertices v, plus the sweep radius
+*/
+template<>
+DEVICE inline ShortReal support_extent(const ShapeSpheropolyhedron& shape, const vec3<ShortReal>& n)
+    {
+    if (shape.verts.N == 0)
+        return shape.verts.sweep_radius;
+
+    return dot(detail::SupportFuncConvexPolyhedron(shape.verts)(n), n) + shape.verts.sweep_radius;
+    }
+
 #ifndef __HIPCC__
 template<> inline std::string getShapeSpec(const ShapeSpheropolyhedron& spoly)
     {
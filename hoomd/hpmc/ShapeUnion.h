@@ -247,11 +247,18 @@ template<class Shape> struct ShapeUnionParams : ShapeParams
 
         // set the diameter
 
-        // build tree and store GPU accessible version in parameter structure
-        OBBTree tree_obb;
-        tree_obb.buildTree(obbs, N, leaf_capacity, false);
+        // build tree and store GPU accessible version in parameter structure, reusing the tree of
+        // a union with identical members
+        OBBTreeKey key("union");
+        key.append(leaf_capacity);
+        for (unsigned int i = 0; i < N; i++)
+            key.append(obbs[i]);
+
+        tree = buildCachedGPUTree(
+            key,
+            [&](OBBTree& tree_obb) { tree_obb.buildTree(obbs, N, leaf_capacity, false); },
+            managed);
         delete[] obbs;
-        tree = GPUTree(tree_obb, managed);
 
         // store local AABB
         lower = local_aabb.getLower();
@@ -506,12 +513,91 @@ DEVICE inline bool test_narrow_phase_overlap(vec3<ShortReal> dr,
     return false;
     }
 
+//! Set to true for member shapes whose small unions are tested pairwise on the GPU
+/*! The overlap test of two members must be cheap compared to a step of the tree traversal.
+ */
+template<class Shape> struct UnionTestsAllMembers
+    {
+    static const bool value = false;
+    };
+
+template<> struct UnionTestsAllMembers<ShapeSphere>
+    {
+    static const bool value = true;
+    };
+
+//! Largest number of members in the unions that are tested pairwise on the GPU
+const unsigned int union_max_all_members = 32;
+
+//! Test all pairs of members of two unions for overlap, without traversing the trees
+/*! \param r_ab Vector defining the position of shape b relative to shape a (r_b - r_a)
+    \param a first shape
+    \param b second shape
+    \param err in/out variable incremented when error conditions occur in the overlap test
+    \returns true when any member of *a* overlaps any member of *b*
+
+    The threads of the group split the pairs in row major order, as in
+    test_narrow_phase_overlap().
+*/
+template<class Shape>
+DEVICE inline bool test_overlap_all_members(const vec3<Scalar>& r_ab,
+                                            const ShapeUnion<Shape>& a,
+                                            const ShapeUnion<Shape>& b,
+                                            unsigned int& err)
+    {
+    // work in the frame of b
+    quat<ShortReal> q(conj(quat<ShortReal>(b.orientation)) * quat<ShortReal>(a.orientation));
+    vec3<ShortReal> dr(rotate(conj(quat<ShortReal>(b.orientation)), vec3<ShortReal>(r_ab)));
+
+    unsigned int nb = b.members.N;
+    unsigned int len = a.members.N * nb;
+
+#if defined(__HIP_DEVICE_COMPILE__)
+    unsigned int offset = threadIdx.x;
+    unsigned int incr = blockDim.x;
+#else
+    unsigned int offset = 0;
+    unsigned int incr = 1;
+#endif
+
+    for (unsigned int n = offset; n < len; n += incr)
+        {
+        unsigned int ishape = n / nb;
+        unsigned int jshape = n % nb;
+
+        if (!(a.members.moverlap[ishape] & b.members.moverlap[jshape]))
+            continue;
+
+        Shape shape_i(quat<Scalar>(), a.members.mparams[ishape]);
+        if (shape_i.hasOrientation())
+            shape_i.orientation = q * a.members.morientation[ishape];
+
+        Shape shape_j(quat<Scalar>(), b.members.mparams[jshape]);
+        if (shape_j.hasOrientation())
+            shape_j.orientation = b.members.morientation[jshape];
+
+        vec3<ShortReal> r_ij = b.members.mpos[jshape] - (rotate(q, a.members.mpos[ishape]) - dr);
+        if (test_overlap(r_ij, shape_i, shape_j, err))
+            return true;
+        }
+
+    return false;
+    }
+
 template<class Shape>
 DEVICE inline bool test_overlap(const vec3<Scalar>& r_ab,
                                 const ShapeUnion<Shape>& a,
                                 const ShapeUnion<Shape>& b,
                                 unsigned int& err)
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+    // the members are in shared memory and the pairs are spread over the threads of the group,
+    // which is faster than the tandem traversal for small unions
+    if (UnionTestsAllMembers<Shape>::value && a.members.N <= union_max_all_members
+        && b.members.N <= union_max_all_members)
+        return test_overlap_all_members(r_ab, a, b, err);
+#endif
+
     const detail::GPUTree& tree_a = a.members.tree;
     const detail::GPUTree& tree_b = b.members.tree;
 
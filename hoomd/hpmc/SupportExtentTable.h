@@ -0,0 +1,152 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+
+#include <vector>
+
+/*! \file SupportExtentTable.h
+    \brief Declares the SupportExtentTable class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Tabulated upper bound on the extent of a convex shape in every direction
+/*! The extent h(n) of a convex shape is the largest dot(x, n) over its points x. Two convex shapes
+    with centers separated by r are disjoint when h_a(n) + h_b(-n) < |r| along n = r / |r|, where
+    each extent is evaluated in the local frame of its shape.
+
+    The table divides the unit sphere into the cells of a cube map with \a resolution x
+    \a resolution cells per face, and stores the direction d at the center of each cell with h(d).
+    For any unit vector n, h(n) <= h(d) + R |n - d| where R is the circumsphere radius, so
+    getBound() returns an upper bound on the extent in every direction at the cost of one cell
+    lookup. The bound is tight near the cell centers and loosens by at most R times the cell size.
+*/
+class SupportExtentTable
+    {
+    public:
+    //! Construct an empty table
+    SupportExtentTable() { }
+
+    //! Tabulate the extent of a shape
+    /*! \param shape Shape to tabulate (its orientation is ignored)
+        \param resolution Number of cells along each edge of a cube face
+    */
+    template<class Shape> void build(const Shape& shape, unsigned int resolution)
+        {
+        m_resolution = resolution;
+        m_radius = ShortReal(0.5) * shape.getCircumsphereDiameter();
+        m_direction.resize(6 * resolution * resolution);
+        m_extent.resize(6 * resolution * resolution);
+
+        for (unsigned int face = 0; face < 6; face++)
+            {
+            for (unsigned int i = 0; i < resolution; i++)
+                {
+                for (unsigned int j = 0; j < resolution; j++)
+                    {
+                    ShortReal u = ShortReal(2 * i + 1) / ShortReal(resolution) - ShortReal(1.0);
+                    ShortReal v = ShortReal(2 * j + 1) / ShortReal(resolution) - ShortReal(1.0);
+                    vec3<ShortReal> d = faceDirection(face, u, v);
+                    d = d * fast::rsqrt(dot(d, d));
+
+                    // the support functions are evaluated with tolerances, pad them slightly
+                    unsigned int k = (face * resolution + i) * resolution + j;
+                    m_direction[k] = d;
+                    m_extent[k] = support_extent(shape, d) + ShortReal(1e-4) * m_radius;
+                    }
+                }
+            }
+        }
+
+    //! Check whether the table has been built
+    bool isBuilt() const
+        {
+        return m_resolution > 0;
+        }
+
+    //! Get an upper bound on the extent
+    /*! \param n Unit vector in the local frame of the shape
+        \returns Upper bound on dot(x, n) over all points x of the shape
+    */
+    ShortReal getBound(const vec3<ShortReal>& n) const
+        {
+        ShortReal ax = fabs(n.x);
+        ShortReal ay = fabs(n.y);
+        ShortReal az = fabs(n.z);
+
+        unsigned int face;
+        ShortReal u, v, major;
+        if (ax >= ay && ax >= az)
+            {
+            face = (n.x > 0) ? 0 : 1;
+            u = n.y;
+            v = n.z;
+            major = ax;
+            }
+        else if (ay >= az)
+            {
+            face = (n.y > 0) ? 2 : 3;
+            u = n.z;
+            v = n.x;
+            major = ay;
+            }
+        else
+            {
+            face = (n.z > 0) ? 4 : 5;
+            u = n.x;
+            v = n.y;
+            major = az;
+            }
+
+        unsigned int i = cellIndex(u / major);
+        unsigned int j = cellIndex(v / major);
+        unsigned int k = (face * m_resolution + i) * m_resolution + j;
+        vec3<ShortReal> delta = n - m_direction[k];
+        return m_extent[k] + m_radius * fast::sqrt(dot(delta, delta));
+        }
+
+    private:
+    unsigned int m_resolution = 0;            //!< Number of cells along each edge of a cube face
+    ShortReal m_radius = 0;                   //!< Circumsphere radius of the shape
+    std::vector<vec3<ShortReal>> m_direction; //!< Unit direction at the center of each cell
+    std::vector<ShortReal> m_extent;          //!< Padded extent of the shape along m_direction
+
+    //! Map a face and the coordinates (u, v) in [-1, 1] on it to a (not normalized) direction
+    static vec3<ShortReal> faceDirection(unsigned int face, ShortReal u, ShortReal v)
+        {
+        ShortReal sign = (face % 2 == 0) ? ShortReal(1.0) : ShortReal(-1.0);
+        if (face < 2)
+            return vec3<ShortReal>(sign, u, v);
+        else if (face < 4)
+            return vec3<ShortReal>(v, sign, u);
+        else
+            return vec3<ShortReal>(u, v, sign);
+        }
+
+    //! Find the cell along one edge of a face that contains the coordinate x in [-1, 1]
+    unsigned int cellIndex(ShortReal x) const
+        {
+        int i = int((x + ShortReal(1.0)) * ShortReal(0.5) * ShortReal(m_resolution));
+        if (i < 0)
+            return 0;
+        if (i >= int(m_resolution))
+            return m_resolution - 1;
+        return i;
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
@@ -7,8 +7,9 @@
 #include "hoomd/RandomNumbers.h"
 #include "hoomd/Updater.h"
 
+#include <atomic>
 #include <list>
-#include <set>
+#include <memory>
 
 #include "HPMCCounters.h"
 #include "IntegratorHPMCMono.h"
@@ -22,8 +23,13 @@ namespace hpmc
 
 namespace detail
     {
-// Graph class represents a undirected graph
-// using adjacency list representation
+//! Undirected graph that tracks its connected components with a lock-free union-find
+/*! addEdge() merges the components of the two vertices and may be called concurrently from many
+    threads. Components are linked by index so that the root of each component is always its
+    smallest vertex. The resulting components therefore do not depend on the order in which edges
+    are added. The callers synchronize (e.g. at the end of ThreadPool::parallelFor) before calling
+    connectedComponents().
+*/
 class Graph
     {
     public:
@@ -31,72 +37,97 @@ class Graph
 
     inline Graph(unsigned int V); // Constructor
 
+    //! Remove all edges and set the number of vertices
     inline void resize(unsigned int V);
 
+    //! Add an undirected edge
     inline void addEdge(unsigned int v, unsigned int w);
 
+    //! Gather the connected components, ordered by their smallest vertex
     inline void connectedComponents(std::vector<std::vector<unsigned int>>& cc);
 
     private:
-    std::multimap<unsigned int, unsigned int> adj;
+    std::unique_ptr<std::atomic<unsigned int>[]> m_parent; //!< Parent of each vertex
+    unsigned int m_n_vertices = 0;                         //!< Number of vertices
+    unsigned int m_capacity = 0;                           //!< Allocated size of m_parent
 
-    std::vector<unsigned int> visited;
+    std::vector<unsigned int> m_component; //!< Component index of each root vertex
 
-    inline void
-    DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc);
+    //! Find the root of a vertex, halving the path to it
+    inline unsigned int find(unsigned int v);
     };
 
 // Gather connected components in an undirected graph
 void Graph::connectedComponents(std::vector<std::vector<unsigned int>>& cc)
     {
-    std::fill(visited.begin(), visited.end(), 0);
+    m_component.resize(m_n_vertices);
 
-    // Depth first search
-    for (unsigned int v = 0; v < visited.size(); v++)
+    // the root of each component is its smallest vertex, so it is visited first
+    for (unsigned int v = 0; v < m_n_vertices; v++)
         {
-        if (visited[v] == false)
+        unsigned int root = find(v);
+        if (root == v)
             {
-            std::vector<unsigned int> cur_cc;
-            DFSUtil(v, visited, cur_cc);
-            cc.push_back(cur_cc);
+            m_component[v] = (unsigned int)cc.size();
+            cc.push_back(std::vector<unsigned int>(1, v));
+            }
+        else
+            {
+            cc[m_component[root]].push_back(v);
             }
         }
     }
 
-void Graph::DFSUtil(unsigned int v,
-                    std::vector<unsigned int>& visited,
-                    std::vector<unsigned int>& cur_cc)
+unsigned int Graph::find(unsigned int v)
     {
-    visited[v] = 1;
-    cur_cc.push_back(v);
-
-    // Recur for all the vertices
-    // adjacent to this vertex
-    auto begin = adj.equal_range(v).first;
-    auto end = adj.equal_range(v).second;
-    for (auto i = begin; i != end; ++i)
+    // parents only ever move towards the root, so a stale value is still an ancestor of v
+    unsigned int parent = m_parent[v].load(std::memory_order_relaxed);
+    while (parent != v)
         {
-        if (!visited[i->second])
-            DFSUtil(i->second, visited, cur_cc);
+        unsigned int grandparent = m_parent[parent].load(std::memory_order_relaxed);
+        if (grandparent != parent)
+            m_parent[v].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+        v = grandparent;
+        parent = m_parent[v].load(std::memory_order_relaxed);
         }
+    return v;
     }
 
 Graph::Graph(unsigned int V)
     {
-    visited.resize(V, 0);
+    resize(V);
     }
 
 void Graph::resize(unsigned int V)
     {
-    visited.resize(V, 0);
+    if (V > m_capacity)
+        {
+        m_parent.reset(new std::atomic<unsigned int>[V]);
+        m_capacity = V;
+        }
+    m_n_vertices = V;
 
-    adj.clear();
+    for (unsigned int v = 0; v < V; v++)
+        m_parent[v].store(v, std::memory_order_relaxed);
     }
 
-// method to add a directed edge
+// method to add an edge, safe to call concurrently
 void Graph::addEdge(unsigned int v, unsigned int w)
     {
-    adj.insert(std::make_pair(v, w));
+    while (true)
+        {
+        v = find(v);
+        w = find(w);
+        if (v == w)
+            return;
+
+        // link the larger root below the smaller one
+        if (v < w)
+            std::swap(v, w);
+        unsigned int expected = v;
+        if (m_parent[v].compare_exchange_strong(expected, w, std::memory_order_relaxed))
+            return;
+        }
     }
     } // end namespace detail
 
@@ -206,8 +237,6 @@ template<class Shape> class UpdaterGCA : public Updater
     GPUVector<Scalar4> m_orientation_backup; //!< Old local orientations
     GPUVector<int3> m_image_backup;          //!< Old local images
 
-    std::set<std::pair<unsigned int, unsigned int>>
-        m_overlap; //!< A local vector of particle pairs due to overlap
     std::map<std::pair<unsigned int, unsigned int>, LongReal>
         m_energy_old_old; //!< Energy of interaction old-old
     std::map<std::pair<unsigned int, unsigned int>, LongReal>
@@ -381,9 +410,6 @@ void UpdaterGCA<Shape>::findInteractions(uint64_t timestep,
                                          access_location::host,
                                          access_mode::read);
 
-    // clear the local bond and rejection lists
-    m_overlap.clear();
-
     Scalar r_cut_patch(0.0);
     if (m_mc->hasPairInteractions())
         {
@@ -415,281 +441,289 @@ void UpdaterGCA<Shape>::findInteractions(uint64_t timestep,
                                               access_location::host,
                                               access_mode::read);
 
-    if (m_mc->hasPairInteractions())
+    // the search for each particle i is independent. Overlaps are added to the graph directly,
+    // energies are collected per thread and merged below.
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    const unsigned int n_threads = pool.getNumThreads();
+    std::vector<std::map<std::pair<unsigned int, unsigned int>, LongReal>> energy_old_old(
+        n_threads);
+    std::vector<std::map<std::pair<unsigned int, unsigned int>, LongReal>> energy_new_old(
+        n_threads);
+
+    pool.parallelFor(
+        nptl,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        // test old configuration against itself
-        for (unsigned int i = 0; i < this->m_pdata->getN(); ++i)
-            {
-            unsigned int typ_i = __scalar_as_int(h_postype_backup.data[i].w);
+            for (unsigned int i = begin; i < end; ++i)
+                {
+                if (m_mc->hasPairInteractions())
+                    {
+                    // test old configuration against itself
+                    unsigned int typ_i = __scalar_as_int(h_postype_backup.data[i].w);
 
-            vec3<Scalar> pos_i(h_postype_backup.data[i]);
-            quat<Scalar> orientation_i(h_orientation_backup.data[i]);
+                    vec3<Scalar> pos_i(h_postype_backup.data[i]);
+                    quat<Scalar> orientation_i(h_orientation_backup.data[i]);
 
-            Scalar d_i(h_diameter.data[i]);
-            Scalar charge_i(h_charge.data[i]);
+                    Scalar d_i(h_diameter.data[i]);
+                    Scalar charge_i(h_charge.data[i]);
 
-            // subtract minimum AABB extent from search radius
-            Scalar extent_i = 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_i);
-            Scalar R_query
-                = std::max(0.0, r_cut_patch + extent_i - min_core_diameter / (ShortReal)2.0);
-            hoomd::detail::AABB aabb_local = hoomd::detail::AABB(vec3<Scalar>(0, 0, 0), R_query);
+                    // subtract minimum AABB extent from search radius
+                    Scalar extent_i = 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_i);
+                    Scalar R_query = std::max(0.0,
+                                              r_cut_patch + extent_i
+                                                  - min_core_diameter / (ShortReal)2.0);
+                    hoomd::detail::AABB aabb_local
+                        = hoomd::detail::AABB(vec3<Scalar>(0, 0, 0), R_query);
 
-            const unsigned int n_images = (unsigned int)image_list.size();
+                    const unsigned int n_images = (unsigned int)image_list.size();
 
-            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-                {
-                vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
+                    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                        {
+                        vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
 
-                hoomd::detail::AABB aabb_i_image = aabb_local;
-                aabb_i_image.translate(pos_i_image);
+                        hoomd::detail::AABB aabb_i_image = aabb_local;
+                        aabb_i_image.translate(pos_i_image);
 
-                // stackless search
-                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree_old.getNumNodes();
-                     cur_node_idx++)
-                    {
-                    if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
-                        {
-                        if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
+                        // stackless search
+                        for (unsigned int cur_node_idx = 0;
+                             cur_node_idx < m_aabb_tree_old.getNumNodes();
+                             cur_node_idx++)
                             {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx);
-                                 cur_p++)
+                            if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
                                 {
-                                // read in its position and orientation
-                                unsigned int j
-                                    = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
-
-                                if (i == j && cur_image == 0)
-                                    continue;
-
-                                // load the position and orientation of the j particle
-                                vec3<Scalar> pos_j = vec3<Scalar>(h_postype_backup.data[j]);
-                                unsigned int typ_j = __scalar_as_int(h_postype_backup.data[j].w);
-
-                                // put particles in coordinate system of particle i
-                                vec3<Scalar> r_ij = pos_j - pos_i_image;
-                                Scalar rsq_ij = dot(r_ij, r_ij);
-
-                                Scalar rcut_ij
-                                    = r_cut_patch + extent_i
-                                      + 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_j);
-
-                                if (rsq_ij <= rcut_ij * rcut_ij)
+                                if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
                                     {
-                                    // the particle pair
-                                    auto p = std::make_pair(i, j);
-
-                                    // if particle interacts in different image already, add to that
-                                    // energy
-                                    LongReal U = 0.0;
+                                    for (unsigned int cur_p = 0;
+                                         cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx);
+                                         cur_p++)
                                         {
-                                        auto it_energy = m_energy_old_old.find(p);
-                                        if (it_energy != m_energy_old_old.end())
-                                            U = it_energy->second;
-                                        }
-
-                                    U += m_mc->computeOnePairEnergy(
-                                        rsq_ij,
-                                        r_ij,
-                                        typ_i,
-                                        orientation_i,
-                                        d_i,
-                                        charge_i,
-                                        typ_j,
-                                        quat<LongReal>(h_orientation_backup.data[j]),
-                                        h_diameter.data[j],
-                                        h_charge.data[j]);
-
-                                    // update map
-                                    m_energy_old_old[p] = U;
-                                    } // end if overlap
-
-                                } // end loop over AABB tree leaf
-                            } // end is leaf
-                        } // end if overlap
-                    else
-                        {
-                        // skip ahead
-                        cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
-                        }
+                                        // read in its position and orientation
+                                        unsigned int j
+                                            = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
+
+                                        if (i == j && cur_image == 0)
+                                            continue;
+
+                                        // load the position and orientation of the j particle
+                                        vec3<Scalar> pos_j = vec3<Scalar>(h_postype_backup.data[j]);
+                                        unsigned int typ_j
+                                            = __scalar_as_int(h_postype_backup.data[j].w);
+
+                                        // put particles in coordinate system of particle i
+                                        vec3<Scalar> r_ij = pos_j - pos_i_image;
+                                        Scalar rsq_ij = dot(r_ij, r_ij);
+
+                                        Scalar extent_j
+                                            = 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_j);
+                                        Scalar rcut_ij = r_cut_patch + extent_i + extent_j;
+
+                                        if (rsq_ij <= rcut_ij * rcut_ij)
+                                            {
+                                            LongReal U = m_mc->computeOnePairEnergy(
+                                                rsq_ij,
+                                                r_ij,
+                                                typ_i,
+                                                orientation_i,
+                                                d_i,
+                                                charge_i,
+                                                typ_j,
+                                                quat<LongReal>(h_orientation_backup.data[j]),
+                                                h_diameter.data[j],
+                                                h_charge.data[j]);
+
+                                            // if particle interacts in different image
+                                            // already, add to that energy
+                                            energy_old_old[thread_id][std::make_pair(i, j)] += U;
+                                            } // end if overlap
+
+                                        } // end loop over AABB tree leaf
+                                    } // end is leaf
+                                } // end if overlap
+                            else
+                                {
+                                // skip ahead
+                                cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
+                                }
 
-                    } // end loop over nodes
+                            } // end loop over nodes
 
-                } // end loop over images
+                        } // end loop over images
 
-            } // end loop over old configuration
-        }
+                    }
 
-    // loop over new configuration
-    for (unsigned int i = 0; i < nptl; ++i)
-        {
-        unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
+                // test new configuration against old
+                unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
 
-        vec3<Scalar> pos_i_new(h_postype.data[i]);
-        quat<Scalar> orientation_i_new(h_orientation.data[i]);
+                vec3<Scalar> pos_i_new(h_postype.data[i]);
+                quat<Scalar> orientation_i_new(h_orientation.data[i]);
 
-        Shape shape_i(orientation_i_new, params[typ_i]);
-        Scalar r_excl_i = shape_i.getCircumsphereDiameter() / Scalar(2.0);
+                Shape shape_i(orientation_i_new, params[typ_i]);
+                Scalar r_excl_i = shape_i.getCircumsphereDiameter() / Scalar(2.0);
 
-        // check for overlap at mirrored position, with other particles in old configuration
-        hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
+                // check for overlap at mirrored position, with other particles in old configuration
+                hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
 
-        // All image boxes (including the primary)
-        const unsigned int n_images = (unsigned int)image_list.size();
+                // All image boxes (including the primary)
+                const unsigned int n_images = (unsigned int)image_list.size();
 
-        // check against old
-        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-            {
-            vec3<Scalar> pos_i_image = pos_i_new + image_list[cur_image];
+                // check against old
+                for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                    {
+                    vec3<Scalar> pos_i_image = pos_i_new + image_list[cur_image];
 
-            hoomd::detail::AABB aabb_i_image = aabb_i_local;
-            aabb_i_image.translate(pos_i_image);
+                    hoomd::detail::AABB aabb_i_image = aabb_i_local;
+                    aabb_i_image.translate(pos_i_image);
 
-            // stackless search
-            for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree_old.getNumNodes();
-                 cur_node_idx++)
-                {
-                if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
-                    {
-                    if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
+                    // stackless search
+                    for (unsigned int cur_node_idx = 0;
+                         cur_node_idx < m_aabb_tree_old.getNumNodes();
+                         cur_node_idx++)
                         {
-                        for (unsigned int cur_p = 0;
-                             cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx);
-                             cur_p++)
+                        if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
                             {
-                            // read in its position and orientation
-                            unsigned int j = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
-
-                            if (i == j && cur_image == 0)
-                                continue;
-
-                            // load the position and orientation of the j particle
-                            vec3<Scalar> pos_j = vec3<Scalar>(h_postype_backup.data[j]);
-                            unsigned int typ_j = __scalar_as_int(h_postype_backup.data[j].w);
-                            Shape shape_j(quat<Scalar>(h_orientation_backup.data[j]),
-                                          params[typ_j]);
-
-                            // put particles in coordinate system of particle i
-                            vec3<Scalar> r_ij = pos_j - pos_i_image;
-
-                            // check for circumsphere overlap
-                            Scalar r_excl_j = shape_j.getCircumsphereDiameter() / Scalar(2.0);
-                            Scalar RaRb = r_excl_i + r_excl_j;
-                            Scalar rsq_ij = dot(r_ij, r_ij);
-
-                            unsigned int err = 0;
-                            if (rsq_ij <= RaRb * RaRb)
+                            if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
                                 {
-                                if (h_overlaps.data[overlap_idx(typ_i, typ_j)]
-                                    && test_overlap(r_ij, shape_i, shape_j, err))
+                                for (unsigned int cur_p = 0;
+                                     cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx);
+                                     cur_p++)
                                     {
-                                    // add connection
-                                    m_overlap.insert(std::make_pair(i, j));
-                                    } // end if overlap
-                                }
-
-                            } // end loop over AABB tree leaf
-                        } // end is leaf
-                    } // end if overlap
-                else
-                    {
-                    // skip ahead
-                    cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
-                    }
-
-                } // end loop over nodes
-            } // end loop over images
+                                    // read in its position and orientation
+                                    unsigned int j
+                                        = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
+
+                                    if (i == j && cur_image == 0)
+                                        continue;
+
+                                    // load the position and orientation of the j particle
+                                    vec3<Scalar> pos_j = vec3<Scalar>(h_postype_backup.data[j]);
+                                    unsigned int typ_j
+                                        = __scalar_as_int(h_postype_backup.data[j].w);
+                                    Shape shape_j(quat<Scalar>(h_orientation_backup.data[j]),
+                                                  params[typ_j]);
+
+                                    // put particles in coordinate system of particle i
+                                    vec3<Scalar> r_ij = pos_j - pos_i_image;
+
+                                    // check for circumsphere overlap
+                                    Scalar r_excl_j
+                                        = shape_j.getCircumsphereDiameter() / Scalar(2.0);
+                                    Scalar RaRb = r_excl_i + r_excl_j;
+                                    Scalar rsq_ij = dot(r_ij, r_ij);
+
+                                    unsigned int err = 0;
+                                    if (rsq_ij <= RaRb * RaRb)
+                                        {
+                                        if (h_overlaps.data[overlap_idx(typ_i, typ_j)]
+                                            && test_overlap(r_ij, shape_i, shape_j, err))
+                                            {
+                                            // add connection
+                                            m_G.addEdge(i, j);
+                                            } // end if overlap
+                                        }
 
-        if (m_mc->hasPairInteractions())
-            {
-            // subtract minimum AABB extent from search radius
-            Scalar extent_i = 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_i);
-            Scalar R_query
-                = std::max(0.0, r_cut_patch + extent_i - min_core_diameter / (LongReal)2.0);
-            hoomd::detail::AABB aabb_local = hoomd::detail::AABB(vec3<Scalar>(0, 0, 0), R_query);
-
-            // compute V(r'-r)
-            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
-                {
-                vec3<Scalar> pos_i_image = pos_i_new + image_list[cur_image];
+                                    } // end loop over AABB tree leaf
+                                } // end is leaf
+                            } // end if overlap
+                        else
+                            {
+                            // skip ahead
+                            cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
+                            }
 
-                hoomd::detail::AABB aabb_i_image = aabb_local;
-                aabb_i_image.translate(pos_i_image);
+                        } // end loop over nodes
+                    } // end loop over images
 
-                // stackless search
-                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree_old.getNumNodes();
-                     cur_node_idx++)
+                if (m_mc->hasPairInteractions())
                     {
-                    if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
+                    // subtract minimum AABB extent from search radius
+                    Scalar extent_i = 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_i);
+                    Scalar R_query
+                        = std::max(0.0, r_cut_patch + extent_i - min_core_diameter / (LongReal)2.0);
+                    hoomd::detail::AABB aabb_local
+                        = hoomd::detail::AABB(vec3<Scalar>(0, 0, 0), R_query);
+
+                    // compute V(r'-r)
+                    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                         {
-                        if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
-                            {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx);
-                                 cur_p++)
-                                {
-                                // read in its position and orientation
-                                unsigned int j
-                                    = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
-
-                                if (i == j && cur_image == 0)
-                                    continue;
-
-                                vec3<Scalar> pos_j(h_postype_backup.data[j]);
-                                unsigned int typ_j = __scalar_as_int(h_postype_backup.data[j].w);
-
-                                // put particles in coordinate system of particle i
-                                vec3<Scalar> r_ij = pos_j - pos_i_image;
+                        vec3<Scalar> pos_i_image = pos_i_new + image_list[cur_image];
 
-                                // check for excluded volume sphere overlap
-                                Scalar rsq_ij = dot(r_ij, r_ij);
+                        hoomd::detail::AABB aabb_i_image = aabb_local;
+                        aabb_i_image.translate(pos_i_image);
 
-                                Scalar rcut_ij
-                                    = r_cut_patch + extent_i
-                                      + 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_j);
-
-                                if (rsq_ij <= rcut_ij * rcut_ij)
+                        // stackless search
+                        for (unsigned int cur_node_idx = 0;
+                             cur_node_idx < m_aabb_tree_old.getNumNodes();
+                             cur_node_idx++)
+                            {
+                            if (aabb_i_image.overlaps(m_aabb_tree_old.getNodeAABB(cur_node_idx)))
+                                {
+                                if (m_aabb_tree_old.isNodeLeaf(cur_node_idx))
                                     {
-                                    auto p = std::make_pair(i, j);
-
-                                    // if particle interacts in different image already, add to that
-                                    // energy
-                                    LongReal U = 0.0;
+                                    for (unsigned int cur_p = 0;
+                                         cur_p < m_aabb_tree_old.getNodeNumParticles(cur_node_idx);
+                                         cur_p++)
                                         {
-                                        auto it_energy = m_energy_new_old.find(p);
-                                        if (it_energy != m_energy_new_old.end())
-                                            U = it_energy->second;
-                                        }
+                                        // read in its position and orientation
+                                        unsigned int j
+                                            = m_aabb_tree_old.getNodeParticle(cur_node_idx, cur_p);
+
+                                        if (i == j && cur_image == 0)
+                                            continue;
+
+                                        vec3<Scalar> pos_j(h_postype_backup.data[j]);
+                                        unsigned int typ_j
+                                            = __scalar_as_int(h_postype_backup.data[j].w);
+
+                                        // put particles in coordinate system of particle i
+                                        vec3<Scalar> r_ij = pos_j - pos_i_image;
+
+                                        // check for excluded volume sphere overlap
+                                        Scalar rsq_ij = dot(r_ij, r_ij);
+
+                                        Scalar extent_j
+                                            = 0.5 * m_mc->getMaxPairInteractionAdditiveRCut(typ_j);
+                                        Scalar rcut_ij = r_cut_patch + extent_i + extent_j;
+
+                                        if (rsq_ij <= rcut_ij * rcut_ij)
+                                            {
+                                            LongReal U = m_mc->computeOnePairEnergy(
+                                                rsq_ij,
+                                                r_ij,
+                                                typ_i,
+                                                shape_i.orientation,
+                                                h_diameter.data[i],
+                                                h_charge.data[i],
+                                                typ_j,
+                                                quat<LongReal>(h_orientation_backup.data[j]),
+                                                h_diameter.data[j],
+                                                h_charge.data[j]);
+
+                                            // if particle interacts in different image
+                                            // already, add to that energy
+                                            energy_new_old[thread_id][std::make_pair(i, j)] += U;
+                                            }
+                                        } // end loop over AABB tree leaf
+                                    } // end is leaf
+                                } // end if overlap
+                            else
+                                {
+                                // skip ahead
+                                cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
+                                }
 
-                                    U += m_mc->computeOnePairEnergy(
-                                        rsq_ij,
-                                        r_ij,
-                                        typ_i,
-                                        shape_i.orientation,
-                                        h_diameter.data[i],
-                                        h_charge.data[i],
-                                        typ_j,
-                                        quat<LongReal>(h_orientation_backup.data[j]),
-                                        h_diameter.data[j],
-                                        h_charge.data[j]);
-
-                                    // update map
-                                    m_energy_new_old[p] = U;
-                                    }
-                                } // end loop over AABB tree leaf
-                            } // end is leaf
-                        } // end if overlap
-                    else
-                        {
-                        // skip ahead
-                        cur_node_idx += m_aabb_tree_old.getNodeSkip(cur_node_idx);
-                        }
+                            } // end loop over nodes
 
-                    } // end loop over nodes
+                        } // end loop over images
+                    } // end if patch
+                } // end loop over local particles
+        });
 
-                } // end loop over images
-            } // end if patch
-        } // end loop over local particles
+    for (unsigned int thread_id = 0; thread_id < n_threads; thread_id++)
+        {
+        // each pair (i, j) is only found by the thread that owns particle i
+        m_energy_old_old.insert(energy_old_old[thread_id].begin(), energy_old_old[thread_id].end());
+        m_energy_new_old.insert(energy_new_old[thread_id].begin(), energy_new_old[thread_id].end());
+        }
     }
 
 template<class Shape> void UpdaterGCA<Shape>::backupState()
@@ -824,24 +858,11 @@ template<class Shape> void UpdaterGCA<Shape>::update(uint64_t timestep)
     // signal that AABB tree is invalid
     m_mc->invalidateAABBTree();
 
-    // determine which particles interact
-    findInteractions(timestep, q, pivot, line);
-
     // resize the number of graph nodes in place
     m_G.resize(this->m_pdata->getN());
 
-    auto& r = m_overlap;
-        {
-        for (auto it = r.begin(); it != r.end(); ++it)
-            {
-            unsigned int i = it->first;
-            unsigned int j = it->second;
-
-            // we're adding a directed edge, but the actual graph will be undirected
-            // if the symmetry operation is self-inverse
-            m_G.addEdge(i, j);
-            }
-        }
+    // determine which particles interact, adding the overlaps to the graph
+    findInteractions(timestep, q, pivot, line);
 
     if (m_mc->hasPairInteractions())
         {
@@ -89,6 +89,22 @@ template<class Shape> class UpdaterMuVT : public Updater
         return m_volume_move_probability;
         }
 
+    //! Set the nominal width of the cells of the cavity grid (0 disables cavity biased insertion)
+    void setCavityWidth(Scalar cavity_width)
+        {
+        if (cavity_width < Scalar(0.0))
+            {
+            throw std::domain_error("cavity_width must be non-negative.");
+            }
+        m_cavity_width = cavity_width;
+        }
+
+    //! Get the nominal width of the cells of the cavity grid
+    Scalar getCavityWidth()
+        {
+        return m_cavity_width;
+        }
+
     //! List of types that are inserted/removed/transferred
     void setTransferTypes(const std::vector<std::string>& transfer_types)
         {
@@ -167,6 +183,21 @@ template<class Shape> class UpdaterMuVT : public Updater
 
     unsigned int m_n_trial;
 
+    Scalar m_cavity_width;                    //!< Nominal width of the cavity grid cells
+    Index3D m_cavity_indexer;                 //!< Indexes the cells of the cavity grid
+    std::vector<unsigned int> m_cavity_cells; //!< Cells in which insertions may succeed
+    std::vector<unsigned char> m_cavity_free; //!< Flags the cells in m_cavity_cells
+
+    //! Find the cells of the cavity grid where an inserted particle does not surely overlap
+    /*! \param type Type of the inserted particle
+        \param exclude Local index of a particle to ignore (UINT_MAX to consider all particles)
+        \returns The free volume, sum of the volumes of all cells in m_cavity_cells
+    */
+    virtual Scalar updateCavities(unsigned int type, unsigned int exclude);
+
+    //! Get the cell of the cavity grid that contains a position
+    unsigned int getCavityCell(const vec3<Scalar>& pos);
+
     /*! Check for overlaps of a fictitious particle
      * \param timestep Current time step
      * \param type Type of particle to test
@@ -239,7 +270,8 @@ UpdaterMuVT<Shape>::UpdaterMuVT(std::shared_ptr<SystemDefinition> sysdef,
                                 std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
                                 unsigned int npartition)
     : Updater(sysdef, trigger), m_mc(mc), m_npartition(npartition), m_gibbs(false),
-      m_max_vol_rescale(0.1), m_volume_move_probability(0.5), m_gibbs_other(0), m_n_trial(1)
+      m_max_vol_rescale(0.1), m_volume_move_probability(0.5), m_gibbs_other(0), m_n_trial(1),
+      m_cavity_width(0.0)
     {
     m_fugacity.resize(m_pdata->getNTypes(), std::shared_ptr<Variant>(new VariantConstant(0.0)));
     m_type_map.resize(m_pdata->getNTypes());
@@ -508,6 +540,14 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
 
     m_exec_conf->msg->notice(10) << "UpdaterMuVT update: " << timestep << std::endl;
 
+    const bool cavity_bias = m_cavity_width > Scalar(0.0);
+#ifdef ENABLE_MPI
+    if (cavity_bias && m_sysdef->isDomainDecomposed())
+        {
+        throw std::runtime_error("Cavity biased insertion does not support domain decomposition.");
+        }
+#endif
+
     // initialize random number generator
     unsigned int group = (m_exec_conf->getPartition() / m_npartition);
     unsigned int partition = (m_exec_conf->getPartition() % m_npartition);
@@ -708,6 +748,25 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
                     {
                     f.z = hoomd::detail::generate_canonical<Scalar>(rng_insert_remove);
                     }
+
+                // or uniformly in the free cells of the cavity grid
+                Scalar V_insert = V;
+                if (cavity_bias)
+                    {
+                    V_insert = updateCavities(type, UINT_MAX);
+                    if (m_cavity_cells.size() > 0)
+                        {
+                        unsigned int cell = m_cavity_cells[hoomd::UniformIntDistribution(
+                            (unsigned int)(m_cavity_cells.size() - 1))(rng_insert_remove)];
+                        uint3 c = m_cavity_indexer.getTriple(cell);
+                        f.x = (Scalar(c.x) + f.x) / Scalar(m_cavity_indexer.getW());
+                        f.y = (Scalar(c.y) + f.y) / Scalar(m_cavity_indexer.getH());
+                        if (m_sysdef->getNDimensions() == 3)
+                            {
+                            f.z = (Scalar(c.z) + f.z) / Scalar(m_cavity_indexer.getD());
+                            }
+                        }
+                    }
                 vec3<Scalar> pos_test = vec3<Scalar>(m_pdata->getGlobalBox().makeCoordinates(f));
 
                 Shape shape_test(quat<Scalar>(), param);
@@ -720,7 +779,7 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
                 if (m_gibbs)
                     {
                     // acceptance probability
-                    lnboltzmann = log((Scalar)V / (Scalar)(nptl_type + 1));
+                    lnboltzmann = log((Scalar)V_insert / (Scalar)(nptl_type + 1));
                     }
                 else
                     {
@@ -736,13 +795,20 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
                         }
 
                     // acceptance probability
-                    lnboltzmann = log(fugacity * V / ((Scalar)(nptl_type + 1) * kT));
+                    lnboltzmann = log(fugacity * V_insert / ((Scalar)(nptl_type + 1) * kT));
                     }
 
                 // check if particle can be inserted without overlaps
                 Scalar delta_u(0.0);
-                unsigned int nonzero
-                    = tryInsertParticle(timestep, type, pos_test, shape_test.orientation, delta_u);
+                unsigned int nonzero = 0;
+                if (V_insert > Scalar(0.0))
+                    {
+                    nonzero = tryInsertParticle(timestep,
+                                                type,
+                                                pos_test,
+                                                shape_test.orientation,
+                                                delta_u);
+                    }
 
                 if (nonzero)
                     {
@@ -908,9 +974,21 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
 
             // acceptance probability
             unsigned int nonzero = 1;
-            if (nptl_type)
+            Scalar V_remove = V;
+            if (nptl_type && cavity_bias)
                 {
-                lnboltzmann += log((Scalar)nptl_type / V);
+                // the reverse insertion samples the free cells of the system without the particle
+                Scalar3 p = m_pdata->getPosition(tag) + m_pdata->getOrigin();
+                int3 tmp = make_int3(0, 0, 0);
+                m_pdata->getGlobalBox().wrap(p, tmp);
+
+                V_remove = updateCavities(type, m_pdata->getRTag(tag));
+                nonzero = m_cavity_free[getCavityCell(vec3<Scalar>(p))];
+                }
+
+            if (nptl_type && nonzero)
+                {
+                lnboltzmann += log((Scalar)nptl_type / V_remove);
                 }
             else
                 {
@@ -1702,6 +1780,170 @@ bool UpdaterMuVT<Shape>::tryInsertParticle(uint64_t timestep,
     return nonzero;
     }
 
+/*! A particle j surely overlaps any particle of the given type inserted within the sum of their
+    insphere radii. A cell of the cavity grid is blocked when all of its corners are within that
+    distance of the same particle j, otherwise it is free. Insertions that sample positions
+    uniformly in the free cells and use the free volume in place of the box volume satisfy detailed
+    balance with removals that evaluate the free cells without the removed particle.
+
+    Shapes that do not implement getInsphereRadius() block no cells.
+*/
+template<class Shape>
+Scalar UpdaterMuVT<Shape>::updateCavities(unsigned int type, unsigned int exclude)
+    {
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const Scalar3 L = box.getNearestPlaneDistance();
+    m_cavity_indexer = Index3D(std::max(1u, (unsigned int)(L.x / m_cavity_width)),
+                               std::max(1u, (unsigned int)(L.y / m_cavity_width)),
+                               ndim == 2 ? 1u : std::max(1u, (unsigned int)(L.z / m_cavity_width)));
+    const unsigned int n_cells = m_cavity_indexer.getNumElements();
+    m_cavity_free.assign(n_cells, 1);
+
+    // corners of a cell relative to its center
+    vec3<Scalar> a[3];
+    a[0] = vec3<Scalar>(box.getLatticeVector(0)) / Scalar(m_cavity_indexer.getW());
+    a[1] = vec3<Scalar>(box.getLatticeVector(1)) / Scalar(m_cavity_indexer.getH());
+    a[2] = ndim == 2 ? vec3<Scalar>(0, 0, 0)
+                     : vec3<Scalar>(box.getLatticeVector(2)) / Scalar(m_cavity_indexer.getD());
+    vec3<Scalar> corners[8];
+    for (unsigned int m = 0; m < 8; m++)
+        {
+        corners[m] = Scalar((m & 1) ? 0.5 : -0.5) * a[0] + Scalar((m & 2) ? 0.5 : -0.5) * a[1]
+                     + Scalar((m & 4) ? 0.5 : -0.5) * a[2];
+        }
+
+    auto& params = m_mc->getParams();
+    const Index2D& overlap_idx = m_mc->getOverlapIndexer();
+
+    const Scalar r_type = Shape(quat<Scalar>(), params[type]).getInsphereRadius();
+    Scalar r_max = 0;
+        {
+        ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(),
+                                             access_location::host,
+                                             access_mode::read);
+        for (unsigned int typ_j = 0; typ_j < m_pdata->getNTypes(); typ_j++)
+            {
+            if (h_overlaps.data[overlap_idx(type, typ_j)])
+                {
+                r_max = std::max(r_max,
+                                 Scalar(Shape(quat<Scalar>(), params[typ_j]).getInsphereRadius()));
+                }
+            }
+        }
+
+    if (r_type + r_max > Scalar(0.0) && m_pdata->getN() > 0)
+        {
+        const hoomd::detail::AABBTree& aabb_tree = m_mc->buildAABBTree();
+        auto& image_list = m_mc->updateImageList();
+        const unsigned int n_images = (unsigned int)image_list.size();
+
+        ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(),
+                                             access_location::host,
+                                             access_mode::read);
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+
+        // the cells are independent
+        m_exec_conf->getThreadPool().parallelFor(
+            n_cells,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+            {
+                for (unsigned int cell = begin; cell < end; cell++)
+                    {
+                    uint3 c = m_cavity_indexer.getTriple(cell);
+                    Scalar3 f = make_scalar3(
+                        (Scalar(c.x) + Scalar(0.5)) / Scalar(m_cavity_indexer.getW()),
+                        (Scalar(c.y) + Scalar(0.5)) / Scalar(m_cavity_indexer.getH()),
+                        (Scalar(c.z) + Scalar(0.5)) / Scalar(m_cavity_indexer.getD()));
+                    vec3<Scalar> center(box.makeCoordinates(f));
+
+                    // particles that block the cell have their centers within r_type + r_max
+                    hoomd::detail::AABB aabb_local(vec3<Scalar>(0, 0, 0), r_type + r_max);
+
+                    bool blocked = false;
+                    for (unsigned int cur_image = 0; cur_image < n_images && !blocked; cur_image++)
+                        {
+                        vec3<Scalar> center_image = center + image_list[cur_image];
+                        hoomd::detail::AABB aabb = aabb_local;
+                        aabb.translate(center_image);
+
+                        // stackless search
+                        for (unsigned int cur_node_idx = 0;
+                             cur_node_idx < aabb_tree.getNumNodes() && !blocked;
+                             cur_node_idx++)
+                            {
+                            if (!aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
+                                {
+                                // skip ahead
+                                cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                                continue;
+                                }
+
+                            if (!aabb_tree.isNodeLeaf(cur_node_idx))
+                                continue;
+
+                            for (unsigned int cur_p = 0;
+                                 cur_p < aabb_tree.getNodeNumParticles(cur_node_idx) && !blocked;
+                                 cur_p++)
+                                {
+                                unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+                                unsigned int typ_j = __scalar_as_int(h_postype.data[j].w);
+                                if (j == exclude || !h_overlaps.data[overlap_idx(type, typ_j)])
+                                    continue;
+
+                                Shape shape_j(quat<Scalar>(h_orientation.data[j]), params[typ_j]);
+                                Scalar R = r_type + shape_j.getInsphereRadius();
+                                vec3<Scalar> r_ij = vec3<Scalar>(h_postype.data[j]) - center_image;
+
+                                blocked = true;
+                                for (unsigned int m = 0; m < 8; m++)
+                                    {
+                                    vec3<Scalar> d = r_ij - corners[m];
+                                    if (dot(d, d) > R * R)
+                                        {
+                                        blocked = false;
+                                        break;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                    m_cavity_free[cell] = !blocked;
+                    }
+            });
+        }
+
+    m_cavity_cells.clear();
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        if (m_cavity_free[cell])
+            m_cavity_cells.push_back(cell);
+        }
+
+    return box.getVolume(ndim == 2) * Scalar(m_cavity_cells.size()) / Scalar(n_cells);
+    }
+
+/*! \param pos Position in the global box
+    \returns Index of the cavity grid cell that contains \a pos
+*/
+template<class Shape> unsigned int UpdaterMuVT<Shape>::getCavityCell(const vec3<Scalar>& pos)
+    {
+    Scalar3 f = m_pdata->getGlobalBox().makeFraction(vec_to_scalar3(pos));
+    int i = int(f.x * Scalar(m_cavity_indexer.getW()));
+    int j = int(f.y * Scalar(m_cavity_indexer.getH()));
+    int k = int(f.z * Scalar(m_cavity_indexer.getD()));
+    i = std::max(0, std::min(i, int(m_cavity_indexer.getW()) - 1));
+    j = std::max(0, std::min(j, int(m_cavity_indexer.getH()) - 1));
+    k = std::max(0, std::min(k, int(m_cavity_indexer.getD()) - 1));
+    return m_cavity_indexer(i, j, k);
+    }
+
 /*! \param mode 0 -> Absolute count, 1 -> relative to the start of the run, 2 -> relative to the
    last executed step \return The current state of the acceptance counters
 
@@ -1750,6 +1992,9 @@ template<class Shape> void export_UpdaterMuVT(pybind11::module& m, const std::st
         .def_property("transfer_types",
                       &UpdaterMuVT<Shape>::getTransferTypes,
                       &UpdaterMuVT<Shape>::setTransferTypes)
+        .def_property("cavity_width",
+                      &UpdaterMuVT<Shape>::getCavityWidth,
+                      &UpdaterMuVT<Shape>::setCavityWidth)
         .def_property_readonly("N", &UpdaterMuVT<Shape>::getN)
         .def("getCounters", &UpdaterMuVT<Shape>::getCounters);
     }
@@ -86,6 +86,8 @@ void UpdaterQuickCompress::performBoxScale(uint64_t timestep, const BoxDim& targ
     auto n_overlaps = m_mc->countOverlaps(false);
     if (n_overlaps > m_max_overlaps_per_particle * m_pdata->getNGlobal())
         {
+        m_gap_move_rejected = m_scale_from_gap;
+
             {
             // the box move generated too many overlaps, undo the move
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
@@ -187,6 +189,27 @@ BoxDim UpdaterQuickCompress::getNewBox(uint64_t timestep, const BoxDim& target_b
     hoomd::UniformDistribution<double> uniform(min_scale, 1.0);
     double scale = uniform(rng);
 
+    // When the closest neighbors are far apart, compress until their circumspheres would touch.
+    // update() counted the overlaps, which measured the gaps in the current configuration. The gap
+    // only accounts for neighbors within each particle's AABB, so boxes that end up with too many
+    // overlaps are still rejected in performBoxScale and the next move falls back to the random
+    // scale.
+    m_scale_from_gap = false;
+    if (m_use_contact_gap && !m_gap_move_rejected)
+        {
+        double contact_ratio = m_mc->getMinContactRatio();
+        if (contact_ratio > 1.0)
+            {
+            double gap_scale = std::max(m_min_scale, 1.0 / contact_ratio);
+            if (gap_scale < scale)
+                {
+                scale = gap_scale;
+                m_scale_from_gap = true;
+                }
+            }
+        }
+    m_gap_move_rejected = false;
+
     // construct the scaled box
     BoxDim current_box = m_pdata->getGlobalBox();
     Scalar3 new_L;
@@ -246,7 +269,10 @@ void export_UpdaterQuickCompress(pybind11::module& m)
                       &UpdaterQuickCompress::setInstance)
         .def_property("allow_unsafe_resize",
                       &UpdaterQuickCompress::getAllowUnsafeResize,
-                      &UpdaterQuickCompress::setAllowUnsafeResize);
+                      &UpdaterQuickCompress::setAllowUnsafeResize)
+        .def_property("use_contact_gap",
+                      &UpdaterQuickCompress::getUseContactGap,
+                      &UpdaterQuickCompress::setUseContactGap);
     }
     } // end namespace detail
     } // end namespace hpmc
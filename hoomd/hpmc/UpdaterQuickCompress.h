@@ -73,6 +73,18 @@ class UpdaterQuickCompress : public Updater
         m_allow_unsafe_resize = allow_unsafe_resize;
         }
 
+    /// Get whether the scale is chosen from the gaps between neighboring particles
+    bool getUseContactGap()
+        {
+        return m_use_contact_gap;
+        }
+
+    /// Set whether the scale is chosen from the gaps between neighboring particles
+    void setUseContactGap(bool use_contact_gap)
+        {
+        m_use_contact_gap = use_contact_gap;
+        }
+
     /// Get the maximum number of overlaps allowed per particle
     double getMaxOverlapsPerParticle()
         {
@@ -153,6 +165,15 @@ class UpdaterQuickCompress : public Updater
     /// Flag whether unsafe box resizes are allowed
     bool m_allow_unsafe_resize = false;
 
+    /// Flag whether to compress up to the contact of the closest neighbors
+    bool m_use_contact_gap = false;
+
+    /// True when the scale of the last proposed box was set by the contact gap
+    bool m_scale_from_gap = false;
+
+    /// True when the last box move set by the contact gap was rejected
+    bool m_gap_move_rejected = false;
+
     /// Perform the box scale move
     void performBoxScale(uint64_t timestep, const BoxDim& target_box);
 
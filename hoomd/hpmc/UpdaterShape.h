@@ -172,6 +172,20 @@ template<typename Shape> class UpdaterShape : public Updater
     void countParticlesPerType();
 
     private:
+    /// Pair of particles that may overlap after a shape move
+    struct CandidatePair
+        {
+        unsigned int i;    // index of the first particle
+        unsigned int j;    // index of the second particle (may be a ghost or periodic image)
+        vec3<Scalar> r_ij; // vector from particle i to the image of particle j
+        };
+
+    /// Build the lists of candidate pairs for each type from the AABB tree
+    void buildCandidatePairs();
+
+    /// Check the candidate pairs that involve a type for overlaps
+    bool checkCandidateOverlaps(unsigned int type);
+
     std::shared_ptr<IntegratorHPMCMono<Shape>> m_mc; // hpmc particle integrator
     std::shared_ptr<ShapeMoveBase<Shape>>
         m_move_function;        // shape move function to apply in the updater
@@ -191,6 +205,10 @@ template<typename Shape> class UpdaterShape : public Updater
         m_box_total; // number of attempted moves between boxes in multi-phase simulations
     detail::UpdateOrder m_update_order; // order of particle types to apply the updater to
     unsigned int m_instance = 0;        //!< Unique ID for RNG seeding
+    std::vector<std::vector<CandidatePair>>
+        m_candidate_pairs; // pairs that may overlap, listed for the type of each particle
+    std::vector<Scalar>
+        m_candidate_radius; // largest circumsphere radius of each type covered by the pair lists
     };
 
 template<class Shape>
@@ -240,6 +258,9 @@ template<class Shape> void UpdaterShape<Shape>::update(uint64_t timestep)
                            this->m_sysdef->getSeed(),
                            RNGIdentifier::HPMCShapeMoveUpdateOrder);
 
+    // particles do not move during shape moves, find the pairs that may overlap once per update
+    buildCandidatePairs();
+
     Scalar log_boltz;
     for (unsigned int i_sweep = 0; i_sweep < m_nsweeps; i_sweep++)
         {
@@ -319,7 +340,7 @@ template<class Shape> void UpdaterShape<Shape>::update(uint64_t timestep)
             m_mc->setParam(typ_i, shape_param_new);
 
             // check if at least one overlap was caused
-            bool overlaps = static_cast<bool>(m_mc->countOverlaps(true));
+            bool overlaps = checkCandidateOverlaps(typ_i);
             // automatically reject if there are overlaps
             if (overlaps)
                 {
@@ -389,6 +410,168 @@ template<class Shape> void UpdaterShape<Shape>::update(uint64_t timestep)
     m_exec_conf->msg->notice(4) << "UpdaterShape update done" << std::endl;
     } // end UpdaterShape<Shape>::update(unsigned int timestep)
 
+/*! Each list holds the pairs within the sum of the circumsphere radii of the two types, enlarged
+    by a growth margin so that shape moves can be checked without querying the tree again. Shapes
+    that grow beyond the margin trigger a rebuild in checkCandidateOverlaps(). Pairs are listed for
+    both types and are ordered the same way as in IntegratorHPMCMono::countOverlaps().
+*/
+template<class Shape> void UpdaterShape<Shape>::buildCandidatePairs()
+    {
+    // allow the circumsphere of each type to grow by this factor before rebuilding
+    const Scalar growth = Scalar(1.1);
+
+    const hoomd::detail::AABBTree& aabb_tree = m_mc->buildAABBTree();
+    const std::vector<vec3<Scalar>>& image_list = m_mc->updateImageList();
+    const auto& params = m_mc->getParams();
+    const unsigned int n_types = m_pdata->getNTypes();
+
+    m_candidate_radius.resize(n_types);
+    Scalar max_radius = 0;
+    for (unsigned int type = 0; type < n_types; type++)
+        {
+        Shape shape(quat<Scalar>(), params[type]);
+        m_candidate_radius[type] = growth * Scalar(0.5) * shape.getCircumsphereDiameter();
+        max_radius = std::max(max_radius, m_candidate_radius[type]);
+        }
+
+    m_candidate_pairs.resize(n_types);
+    for (auto& pairs : m_candidate_pairs)
+        {
+        pairs.clear();
+        }
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        const Scalar4 postype_i = h_postype.data[i];
+        const unsigned int typ_i = __scalar_as_int(postype_i.w);
+        const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+        // the query finds all particles whose centers are within reach of the enlarged shapes
+        hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0, 0, 0),
+                                         m_candidate_radius[typ_i] + max_radius);
+
+        const unsigned int n_images = (unsigned int)image_list.size();
+        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            {
+            vec3<Scalar> pos_i_image = pos_i + image_list[cur_image];
+            hoomd::detail::AABB aabb = aabb_i_local;
+            aabb.translate(pos_i_image);
+
+            // stackless search
+            for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree.getNumNodes();
+                 cur_node_idx++)
+                {
+                if (aabb.overlaps(aabb_tree.getNodeAABB(cur_node_idx)))
+                    {
+                    if (aabb_tree.isNodeLeaf(cur_node_idx))
+                        {
+                        for (unsigned int cur_p = 0;
+                             cur_p < aabb_tree.getNodeNumParticles(cur_node_idx);
+                             cur_p++)
+                            {
+                            unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                            // skip i==j in the 0 image and count each pair once
+                            if ((cur_image == 0 && i == j) || h_tag.data[i] > h_tag.data[j])
+                                continue;
+
+                            const Scalar4 postype_j = h_postype.data[j];
+                            const unsigned int typ_j = __scalar_as_int(postype_j.w);
+                            const vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+
+                            const Scalar R_ij
+                                = m_candidate_radius[typ_i] + m_candidate_radius[typ_j];
+                            if (dot(r_ij, r_ij) > R_ij * R_ij)
+                                continue;
+
+                            m_candidate_pairs[typ_i].push_back(CandidatePair {i, j, r_ij});
+                            if (typ_j != typ_i)
+                                {
+                                m_candidate_pairs[typ_j].push_back(CandidatePair {i, j, r_ij});
+                                }
+                            }
+                        }
+                    }
+                else
+                    {
+                    // skip ahead
+                    cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
+                    }
+                } // end loop over AABB nodes
+            } // end loop over images
+        } // end loop over particles
+    }
+
+/*! \param type Type whose shape was changed
+    \returns true if any particle of \a type overlaps with another particle
+
+    Equivalent to IntegratorHPMCMono::countOverlaps(true) when the rest of the system is free of
+    overlaps, but only performs the narrow phase checks on the cached candidate pairs.
+*/
+template<class Shape> bool UpdaterShape<Shape>::checkCandidateOverlaps(unsigned int type)
+    {
+    const auto& params = m_mc->getParams();
+
+    // the lists do not cover shapes beyond the growth margin
+    Shape shape(quat<Scalar>(), params[type]);
+    if (Scalar(0.5) * shape.getCircumsphereDiameter() > m_candidate_radius[type])
+        {
+        m_exec_conf->msg->notice(6) << "UpdaterShape rebuilding candidate pairs" << std::endl;
+        buildCandidatePairs();
+        }
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(),
+                                         access_location::host,
+                                         access_mode::read);
+    const Index2D& overlap_idx = m_mc->getOverlapIndexer();
+
+    bool overlap = false;
+    unsigned int err_count = 0;
+    for (const auto& pair : m_candidate_pairs[type])
+        {
+        const unsigned int typ_i = __scalar_as_int(h_postype.data[pair.i].w);
+        const unsigned int typ_j = __scalar_as_int(h_postype.data[pair.j].w);
+        if (!h_overlaps.data[overlap_idx(typ_i, typ_j)])
+            continue;
+
+        Shape shape_i(quat<Scalar>(h_orientation.data[pair.i]), params[typ_i]);
+        Shape shape_j(quat<Scalar>(h_orientation.data[pair.j]), params[typ_j]);
+
+        if (check_circumsphere_overlap(pair.r_ij, shape_i, shape_j)
+            && test_overlap(pair.r_ij, shape_i, shape_j, err_count)
+            && test_overlap(-pair.r_ij, shape_j, shape_i, err_count))
+            {
+            overlap = true;
+            break;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &overlap,
+                      1,
+                      MPI_CXX_BOOL,
+                      MPI_LOR,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return overlap;
+    }
+
 template<typename Shape> void UpdaterShape<Shape>::initializeDeterminatsInertiaTensor()
     {
     ArrayHandle<unsigned int> h_ntypes(m_ntypes, access_location::host, access_mode::readwrite);
@@ -0,0 +1,122 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/hpmc/ShapeConvexPolyhedron.h"
+#include "hoomd/hpmc/ShapeEllipsoid.h"
+#include "hoomd/hpmc/ShapeSphere.h"
+#include "hoomd/hpmc/ShapeSpheropolyhedron.h"
+
+#include "hoomd/benchmark/benchmark.h"
+
+/*! \file benchmark_overlap.cc
+    \brief Times the HPMC pair overlap checks of each shape
+*/
+
+using namespace hoomd;
+using namespace hoomd::hpmc;
+using namespace hoomd::benchmark;
+
+//! Receives the overlap results so that the compiler cannot remove the timed loop
+volatile unsigned int sink = 0;
+
+//! Random relative positions and orientations of shape pairs
+struct PairConfigurations
+    {
+    std::vector<vec3<Scalar>> r_ab;
+    std::vector<quat<Scalar>> orientation_a;
+    std::vector<quat<Scalar>> orientation_b;
+    };
+
+//! Generate N pair configurations
+/*! The separations are uniform in a cube with the side cbrt(1 / density) times the circumsphere
+    diameter, so higher densities test more overlapping pairs.
+*/
+PairConfigurations makePairs(unsigned int N, double density, Scalar diameter)
+    {
+    std::mt19937 rng(N);
+    const Scalar half_side = Scalar(0.5) * diameter * Scalar(std::cbrt(1.0 / density));
+    std::uniform_real_distribution<Scalar> position(-half_side, half_side);
+    std::normal_distribution<Scalar> normal;
+
+    auto random_orientation = [&]()
+    {
+        quat<Scalar> q(normal(rng), vec3<Scalar>(normal(rng), normal(rng), normal(rng)));
+        return q * (Scalar(1.0) / fast::sqrt(norm2(q)));
+    };
+
+    PairConfigurations pairs;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        pairs.r_ab.push_back(vec3<Scalar>(position(rng), position(rng), position(rng)));
+        pairs.orientation_a.push_back(random_orientation());
+        pairs.orientation_b.push_back(random_orientation());
+        }
+    return pairs;
+    }
+
+//! Time test_overlap() on N random pairs of one shape
+template<class Shape>
+void benchmark_overlap(Runner& runner,
+                       const std::string& name,
+                       const typename Shape::param_type& param)
+    {
+    const Scalar diameter = Shape(quat<Scalar>(), param).getCircumsphereDiameter();
+
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            const PairConfigurations pairs = makePairs(N, density, diameter);
+
+            runner.run(name,
+                       N,
+                       density,
+                       [&]()
+                       {
+                           unsigned int err = 0;
+                           unsigned int overlaps = 0;
+                           for (unsigned int i = 0; i < N; i++)
+                               {
+                               Shape a(pairs.orientation_a[i], param);
+                               Shape b(pairs.orientation_b[i], param);
+                               overlaps += test_overlap(pairs.r_ab[i], a, b, err);
+                               }
+                           sink = overlaps;
+                       });
+            }
+    }
+
+//! Make the vertices of a cube with unit edges
+std::vector<vec3<ShortReal>> cubeVertices()
+    {
+    std::vector<vec3<ShortReal>> vertices;
+    for (int i = 0; i < 8; i++)
+        vertices.push_back(vec3<ShortReal>(i & 1 ? 0.5 : -0.5,
+                                           i & 2 ? 0.5 : -0.5,
+                                           i & 4 ? 0.5 : -0.5));
+    return vertices;
+    }
+
+int main(int argc, char** argv)
+    {
+    Runner runner("overlap", argc, argv);
+
+    SphereParams sphere;
+    sphere.radius = ShortReal(0.5);
+    sphere.ignore = 0;
+    sphere.isOriented = false;
+    benchmark_overlap<ShapeSphere>(runner, "sphere", sphere);
+
+    EllipsoidParams ellipsoid;
+    ellipsoid.x = ShortReal(0.5);
+    ellipsoid.y = ShortReal(0.25);
+    ellipsoid.z = ShortReal(0.75);
+    ellipsoid.ignore = 0;
+    benchmark_overlap<ShapeEllipsoid>(runner, "ellipsoid", ellipsoid);
+
+    hpmc::detail::PolyhedronVertices cube(cubeVertices(), 0, 0);
+    benchmark_overlap<ShapeConvexPolyhedron>(runner, "convex_polyhedron", cube);
+
+    hpmc::detail::PolyhedronVertices rounded_cube(cubeVertices(), ShortReal(0.1), 0);
+    benchmark_overlap<ShapeSpheropolyhedron>(runner, "convex_spheropolyhedron", rounded_cube);
+    return 0;
+    }
@@ -11,7 +11,6 @@ from __future__ import print_function
 
 from hoomd import _hoomd
 from hoomd.operation import Compute
-from hoomd.hpmc import _hpmc
 from hoomd.hpmc import integrate
 from hoomd.data.parameterdicts import ParameterDict
 from hoomd.logging import log
@@ -120,11 +119,11 @@ class FreeVolume(Compute):
 
         # Extract 'Shape' from '<hoomd.hpmc.integrate.Shape object>'
         integrator_name = integrator.__class__.__name__
+        cpp_cls_name = "ComputeFreeVolume" + integrator_name
+        if not isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_cls_name += "GPU"
         try:
-            if isinstance(self._simulation.device, hoomd.device.CPU):
-                cpp_cls = getattr(_hpmc, "ComputeFreeVolume" + integrator_name)
-            else:
-                cpp_cls = getattr(_hpmc, "ComputeFreeVolume" + integrator_name + "GPU")
+            cpp_cls = getattr(integrator._ext_module, cpp_cls_name)
         except AttributeError:
             raise RuntimeError("Unsupported integrator.")
 
@@ -310,6 +309,18 @@ class SDF(Compute):
     Note:
         `SDF` always runs on the CPU.
 
+    .. rubric:: Asynchronous computation
+
+    Set `asynchronous` to `True` to hide the cost of `SDF` in GPU simulations.
+    `SDF` then copies the configuration and counts the histograms on a
+    background CPU thread while the simulation continues on the GPU. Each
+    access to the computed quantities at a new timestep waits for the
+    previous count and starts the next one, so `sdf_compression`,
+    `sdf_expansion` and `betaP` report the configuration at the *previous*
+    timestep that `SDF` computed. This lag does not bias averages over many
+    timesteps. `SDF` computes synchronously when the integrator has pair
+    potentials.
+
     .. rubric:: Mixed precision
 
     `SDF` uses reduced precision floating point arithmetic when checking
@@ -332,6 +343,10 @@ class SDF(Compute):
             bin :math:`[\mathrm{length}]`.
 
         dx (float): Bin width :math:`[\mathrm{length}]`.
+
+        asynchronous (bool): When `True`, count the histograms on a background
+            thread and report the result of the previous computation. Defaults
+            to `False`.
     """
 
     __doc__ = __doc__.replace("{inherited}", Compute._doc_inherited)
@@ -341,6 +356,7 @@ class SDF(Compute):
         param_dict = ParameterDict(
             xmax=float(xmax),
             dx=float(dx),
+            asynchronous=False,
         )
         self._param_dict.update(param_dict)
 
@@ -352,7 +368,7 @@ class SDF(Compute):
         # Extract 'Shape' from '<hoomd.hpmc.integrate.Shape object>'
         integrator_name = integrator.__class__.__name__
 
-        cpp_cls = getattr(_hpmc, "ComputeSDF" + integrator_name)
+        cpp_cls = getattr(integrator._ext_module, "ComputeSDF" + integrator_name)
 
         self._cpp_obj = cpp_cls(
             self._simulation.state._cpp_sys_def,
@@ -173,7 +173,7 @@ class WallPotential(External):
         integrator = self._simulation.operations.integrator
         cpp_cls_name = "Wall"
         cpp_cls_name += integrator.__class__.__name__
-        cpp_cls = getattr(hoomd.hpmc._hpmc, cpp_cls_name)
+        cpp_cls = getattr(integrator._ext_module, cpp_cls_name)
 
         cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def, integrator._cpp_obj)
         self._walls._sync(
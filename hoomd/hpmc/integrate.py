@@ -102,6 +102,14 @@ moves per particle when using the parallel code paths. Monitor the number of
 trial moves performed with `HPMCIntegrator.translate_moves` and
 `HPMCIntegrator.rotate_moves`.
 
+With MPI domain decomposition, `HPMCIntegrator` exchanges ghost particles once
+per timestep. All ``nselect`` sweeps of a timestep run between exchanges: the
+particles within the ghost layer width of the upper domain boundaries stay
+fixed, and the origin of the domains shifts by a random vector each timestep so
+that every particle is eventually active. Increase `nselect
+<HPMCIntegrator.nselect>` to perform more sweeps per exchange when
+communication limits the scaling.
+
 .. rubric:: Random numbers
 
 `HPMCIntegrator` uses a pseudorandom number stream to generate the trial moves.
@@ -257,12 +265,13 @@ Note:
 
 from hoomd import _hoomd
 from hoomd.data.parameterdicts import TypeParameterDict, ParameterDict
-from hoomd.data.typeconverter import OnlyIf, to_type_converter
+from hoomd.data.typeconverter import OnlyFrom, OnlyIf, OnlyTypes, to_type_converter
 from hoomd.data.typeparam import TypeParameter
 from hoomd.error import DataAccessError
 from hoomd.hpmc import _hpmc
 from hoomd.operation import Integrator
 from hoomd.logging import log
+from hoomd.util import _LazyModule
 import hoomd
 import json
 
@@ -302,6 +311,86 @@ class HPMCIntegrator(Integrator):
     All HPMC integrators use reduced precision floating point arithmetic when
     checking for particle overlaps in the local particle reference frame.
 
+    .. rubric:: Many small systems on one GPU
+
+    A system with a few thousand particles does not fill a GPU, and the GPU
+    integrators spend most of each sweep launching kernels. To scan many state
+    points, run one small system in each MPI partition
+    (``hoomd.communicator.Communicator(ranks_per_partition=1)``) and select the
+    same GPU in all partitions. With the CUDA Multi-Process Service enabled,
+    kernels launched by the partitions run concurrently. Each partition keeps
+    its own counters and output files. Use `hoomd.update.ReplicaExchange` to
+    exchange temperatures or pressures between the partitions.
+
+    .. rubric:: Broadphase
+
+    The CPU implementation finds the particles that a trial move may overlap
+    with a bounding volume hierarchy (``"tree"``) or a uniform grid of cells
+    (``"grid"``). The grid is faster when all particles have a similar size
+    and the tree is faster for polydisperse or elongated particles. Set
+    `broadphase` to ``"auto"`` to use the grid when no bounding box edge is
+    more than twice the size of any other. HPMC uses the tree when there are
+    pair potentials. The broadphase does not change the accepted trial moves.
+
+    .. rubric:: Pair energy cache
+
+    With pair potentials, each trial move evaluates the energy of the particle
+    with its neighbors in both the old and the new configuration. Set
+    `pair_energy_cache` to `True` to store the energy of each particle and
+    update it when neighboring moves are accepted, so that the old
+    configuration is evaluated only for the first trial move of each particle
+    in a timestep and for accepted moves. The cache is most effective with
+    large values of `nselect` and low acceptance ratios. Accepted trial moves
+    differ from those without the cache only by floating point round off.
+
+    .. rubric:: Checkerboard
+
+    The CPU implementation performs the trial moves one particle at a time. Set
+    `checkerboard` to `True` to perform them on `hoomd.device.CPU.num_cpu_threads`
+    threads. Like the GPU implementation, the checkerboard sweep divides the
+    box into cells at least as wide as the largest interaction and moves the
+    particles in alternating sets of cells concurrently. The cell grid is
+    shifted randomly every timestep. Trial moves that would move a particle
+    out of its cell are not performed and are not counted. The checkerboard
+    samples the same ensemble as the serial sweep, but generates a different
+    sequence of trial moves. The result does not depend on the number of
+    threads. HPMC uses the serial sweep when the simulation is domain
+    decomposed or when the box is less than two cells wide in any direction.
+
+    .. rubric:: GPU convergence batches
+
+    The GPU implementation proposes trial moves for a whole set of cells at
+    once and repeats the overlap checks until the accepted moves converge to
+    those of a sequential sweep. By default, the host waits for the result of
+    each pass before it launches the next. Set `convergence_batch` to launch
+    that many passes before each wait. Passes after the first converged pass
+    in a batch exit immediately, so the accepted trial moves do not depend on
+    `convergence_batch`. Larger batches hide the launch and synchronization
+    latency that dominates small and medium systems, at the cost of the empty
+    passes launched after convergence.
+
+    .. rubric:: Online move size tuning
+
+    Set `tune_acceptance` to a target acceptance ratio to adjust the move
+    sizes during the run. Every `tune_period` timesteps, `HPMCIntegrator`
+    scales `d` and `a` of all types by the same factor that
+    `hoomd.tune.ScaleSolver` would compute from the translation and rotation
+    acceptance ratios measured since the last adjustment. Move sizes that are
+    0 remain fixed. When `tune_tolerance` is non-zero and both acceptance
+    ratios are within `tune_tolerance` of the target, tuning stops, the move
+    sizes are frozen, and `tune_acceptance` is reset to ``None``. Unlike
+    `hoomd.hpmc.tune.MoveSize`, the online tuner does not require short
+    `Simulation.run` calls.
+
+    .. rubric:: Instrumentation
+
+    On the CPU, `HPMCIntegrator` counts the trial moves of each particle type
+    (`type_translate_moves` and `type_rotate_moves`) and measures the time
+    spent in each stage of the update (`stage_times`). Log these quantities to
+    find which particle types and stages limit the performance of a
+    simulation. The instrumentation is always enabled and has a negligible
+    cost.
+
     {inherited}
 
     ----------
@@ -332,6 +421,28 @@ class HPMCIntegrator(Integrator):
 
         kT (hoomd.variant.Variant): Temperature set point
             :math:`[\\mathrm{energy}]`.
+
+        broadphase (str): Method used to find overlap candidates on the CPU:
+            ``"auto"``, ``"tree"``, or ``"grid"`` (**default:** ``"auto"``).
+
+        pair_energy_cache (bool): When `True`, the CPU trial moves cache the
+            pair energy of each particle (**default:** `False`).
+
+        checkerboard (bool): When `True`, the CPU trial moves sweep a
+            checkerboard of cells on multiple threads (**default:** `False`).
+
+        convergence_batch (int): Number of convergence passes the GPU launches
+            before it reads back their results (**default:** 1).
+
+        tune_acceptance (float): Target acceptance ratio of the online move
+            size tuner, or ``None`` to disable it (**default:** ``None``).
+
+        tune_period (int): Number of timesteps between move size adjustments
+            of the online tuner (**default:** 100).
+
+        tune_tolerance (float): Freeze the move sizes once both acceptance
+            ratios are this close to `tune_acceptance`. Set to 0 to tune
+            indefinitely (**default:** 0).
     """
 
     _ext_module = _hpmc
@@ -377,6 +488,42 @@ class HPMCIntegrator(Integrator):
         Temperature set point.
         `Read more... <HPMCIntegrator.kT>`
 
+    .. py:attribute:: broadphase
+
+        Method used to find overlap candidates on the CPU.
+        `Read more... <HPMCIntegrator.broadphase>`
+
+    .. py:attribute:: pair_energy_cache
+
+        Cache the pair energy of each particle in CPU trial moves.
+        `Read more... <HPMCIntegrator.pair_energy_cache>`
+
+    .. py:attribute:: checkerboard
+
+        Sweep a checkerboard of cells on multiple threads in CPU trial moves.
+        `Read more... <HPMCIntegrator.checkerboard>`
+
+    .. py:attribute:: convergence_batch
+
+        Number of convergence passes the GPU launches before it reads back
+        their results.
+        `Read more... <HPMCIntegrator.convergence_batch>`
+
+    .. py:attribute:: tune_acceptance
+
+        Target acceptance ratio of the online move size tuner.
+        `Read more... <HPMCIntegrator.tune_acceptance>`
+
+    .. py:attribute:: tune_period
+
+        Number of timesteps between move size adjustments.
+        `Read more... <HPMCIntegrator.tune_period>`
+
+    .. py:attribute:: tune_tolerance
+
+        Tolerance at which the online tuner freezes the move sizes.
+        `Read more... <HPMCIntegrator.tune_tolerance>`
+
     .. py:property:: counters
 
         Trial move counters.
@@ -422,10 +569,25 @@ class HPMCIntegrator(Integrator):
         Count of the accepted and rejected rotate moves.
         `Read more... <HPMCIntegrator.rotate_moves>`
 
+    .. py:property:: stage_times
+
+        Time spent in each stage of the trial moves.
+        `Read more... <HPMCIntegrator.stage_times>`
+
     .. py:property:: translate_moves
 
         Count of the accepted and rejected translate moves.
         `Read more... <HPMCIntegrator.translate_moves>`
+
+    .. py:property:: type_rotate_moves
+
+        Count of the accepted and rejected rotate moves of each type.
+        `Read more... <HPMCIntegrator.type_rotate_moves>`
+
+    .. py:property:: type_translate_moves
+
+        Count of the accepted and rejected translate moves of each type.
+        `Read more... <HPMCIntegrator.type_translate_moves>`
     """
     )
 
@@ -437,9 +599,18 @@ class HPMCIntegrator(Integrator):
             translation_move_probability=float(translation_move_probability),
             nselect=int(nselect),
             kT=hoomd.variant.Variant,
+            broadphase=OnlyFrom(["auto", "tree", "grid"]),
+            pair_energy_cache=False,
+            checkerboard=False,
+            convergence_batch=int(1),
+            tune_acceptance=OnlyTypes(float, allow_none=True),
+            tune_period=int(100),
+            tune_tolerance=float(0.0),
+            _defaults={"tune_acceptance": None},
         )
         self._param_dict.update(param_dict)
         self.kT = kT
+        self.broadphase = "auto"
 
         # Set standard typeparameters for hpmc integrators
         typeparam_d = TypeParameter(
@@ -479,7 +650,7 @@ class HPMCIntegrator(Integrator):
         sys_def = self._simulation.state._cpp_sys_def
         if (
             isinstance(self._simulation.device, hoomd.device.GPU)
-            and (self._cpp_cls + "GPU") in _hpmc.__dict__
+            and hasattr(self._ext_module, self._cpp_cls + "GPU")
         ):
             self._cpp_cell = _hoomd.CellListGPU(sys_def)
             self._cpp_obj = getattr(self._ext_module, self._cpp_cls + "GPU")(
@@ -609,6 +780,57 @@ class HPMCIntegrator(Integrator):
         """
         return self._cpp_obj.getCounters(1).rotate
 
+    @log(category="sequence", requires_run=True)
+    def type_translate_moves(self):
+        """list[tuple[int, int]]: Count of the accepted and rejected translate \
+        moves of each type.
+
+        The list is indexed by the particle type id.
+
+        Note:
+            The counts are reset to 0 at the start of each
+            `hoomd.Simulation.run`. The GPU implementation does not count moves
+            by type and reports 0.
+        """
+        return [c.translate for c in self._cpp_obj.getTypeCounters()]
+
+    @log(category="sequence", requires_run=True)
+    def type_rotate_moves(self):
+        """list[tuple[int, int]]: Count of the accepted and rejected rotate \
+        moves of each type.
+
+        The list is indexed by the particle type id.
+
+        Note:
+            The counts are reset to 0 at the start of each
+            `hoomd.Simulation.run`. The GPU implementation does not count moves
+            by type and reports 0.
+        """
+        return [c.rotate for c in self._cpp_obj.getTypeCounters()]
+
+    @log(category="sequence", requires_run=True)
+    def stage_times(self):
+        """tuple[float, float, float, float, float]: Time spent in each stage \
+        of the trial moves :math:`[\\mathrm{s}]`.
+
+        The elements are the time spent:
+
+        * building the broadphase (the tree or grid and the list of periodic
+          images),
+        * in trial moves: generating moves, overlap checks, and the pair
+          energy of the new configuration,
+        * evaluating the pair energy of the old configuration,
+        * evaluating external potentials,
+        * migrating and exchanging particles between MPI ranks.
+
+        With MPI, each element is the maximum over all ranks.
+
+        Note:
+            The times are reset to 0 at the start of each
+            `hoomd.Simulation.run`. The GPU implementation reports 0.
+        """
+        return tuple(self._cpp_obj.getStageTimes())
+
     @log(requires_run=True)
     def mps(self):
         """float: Number of trial moves performed per second.
@@ -723,6 +945,7 @@ class Sphere(HPMCIntegrator):
               allow rotation moves on this particle type.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_sphere")
     _cpp_cls = "IntegratorHPMCMonoSphere"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -840,6 +1063,7 @@ class ConvexPolygon(HPMCIntegrator):
 
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_convex_polygon")
     _cpp_cls = "IntegratorHPMCMonoConvexPolygon"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -971,6 +1195,7 @@ class ConvexSpheropolygon(HPMCIntegrator):
                 Undefined behavior will result when they are violated.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_spheropolygon")
     _cpp_cls = "IntegratorHPMCMonoSpheropolygon"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1089,6 +1314,7 @@ class SimplePolygon(HPMCIntegrator):
                 Undefined behavior will result when they are violated.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_simple_polygon")
     _cpp_cls = "IntegratorHPMCMonoSimplePolygon"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1245,6 +1471,7 @@ class Polyhedron(HPMCIntegrator):
                 Undefined behavior will result when they are violated.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_polyhedron")
     _cpp_cls = "IntegratorHPMCMonoPolyhedron"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1363,8 +1590,15 @@ class ConvexPolyhedron(HPMCIntegrator):
             Warning:
                 HPMC does not check that all vertex requirements are met.
                 Undefined behavior will result when they are violated.
+
+        separating_axis_cache (bool): When `True`, the CPU trial moves store
+            the last separating axis found for each pair of particles and
+            test it first the next time the pair is checked. This speeds up
+            overlap checks in dense systems at the cost of memory for one
+            axis per nearby pair (**default:** `False`).
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_convex_polyhedron")
     _cpp_cls = "IntegratorHPMCMonoConvexPolyhedron"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1393,6 +1627,8 @@ class ConvexPolyhedron(HPMCIntegrator):
         )
         self._add_typeparam(typeparam_shape)
 
+        self._param_dict.update(ParameterDict(separating_axis_cache=False))
+
     @log(category="object", requires_run=True)
     def type_shapes(self):
         """list[dict]: Description of shapes in ``type_shapes`` format.
@@ -1520,8 +1756,15 @@ class FacetedEllipsoid(HPMCIntegrator):
                 specified, the half-space intersection of the normals must match
                 the convex polyhedron defined by the vertices (if non-empty),
                 the half-space intersection is **not** calculated automatically.
+
+        support_extent_tables (bool): When `True`, the CPU trial moves
+            tabulate the extent of each shape over a grid of directions and
+            skip the exact overlap check of pairs whose extents along the line
+            between their centers do not reach each other. This speeds up
+            overlap checks of elongated shapes (**default:** `False`).
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_faceted_ellipsoid")
     _cpp_cls = "IntegratorHPMCMonoFacetedEllipsoid"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1558,6 +1801,8 @@ class FacetedEllipsoid(HPMCIntegrator):
         )
         self._add_typeparam(typeparam_shape)
 
+        self._param_dict.update(ParameterDict(support_extent_tables=False))
+
 
 class Sphinx(HPMCIntegrator):
     """Sphinx hard particle Monte Carlo integrator.
@@ -1620,6 +1865,7 @@ class Sphinx(HPMCIntegrator):
               `True` to ignore tracked statistics.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_sphinx")
     _cpp_cls = "IntegratorHPMCMonoSphinx"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1720,8 +1966,21 @@ class ConvexSpheropolyhedron(HPMCIntegrator):
             Warning:
                 HPMC does not check that all vertex requirements are met.
                 Undefined behavior will result when they are violated.
+
+        separating_axis_cache (bool): When `True`, the CPU trial moves store
+            the last separating axis found for each pair of particles and
+            test it first the next time the pair is checked. This speeds up
+            overlap checks in dense systems at the cost of memory for one
+            axis per nearby pair (**default:** `False`).
+
+        support_extent_tables (bool): When `True`, the CPU trial moves
+            tabulate the extent of each shape over a grid of directions and
+            skip the exact overlap check of pairs whose extents along the line
+            between their centers do not reach each other. This speeds up
+            overlap checks of elongated shapes (**default:** `False`).
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_convex_spheropolyhedron")
     _cpp_cls = "IntegratorHPMCMonoSpheropolyhedron"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1750,6 +2009,10 @@ class ConvexSpheropolyhedron(HPMCIntegrator):
         )
         self._add_typeparam(typeparam_shape)
 
+        self._param_dict.update(
+            ParameterDict(separating_axis_cache=False, support_extent_tables=False)
+        )
+
     @log(category="object", requires_run=True)
     def type_shapes(self):
         """list[dict]: Description of shapes in ``type_shapes`` format.
@@ -1825,8 +2088,15 @@ class Ellipsoid(HPMCIntegrator):
               direction :math:`[\\mathrm{length}]`
             * ``ignore_statistics`` (`bool`, **default:** `False`) - set to
               `True` to ignore tracked statistics.
+
+        support_extent_tables (bool): When `True`, the CPU trial moves
+            tabulate the extent of each shape over a grid of directions and
+            skip the exact overlap check of pairs whose extents along the line
+            between their centers do not reach each other. This speeds up
+            overlap checks of elongated shapes (**default:** `False`).
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_ellipsoid")
     _cpp_cls = "IntegratorHPMCMonoEllipsoid"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -1853,6 +2123,8 @@ class Ellipsoid(HPMCIntegrator):
 
         self._extend_typeparam([typeparam_shape])
 
+        self._param_dict.update(ParameterDict(support_extent_tables=False))
+
     @log(category="object", requires_run=True)
     def type_shapes(self):
         """list[dict]: Description of shapes in ``type_shapes`` format.
@@ -1948,6 +2220,7 @@ class SphereUnion(HPMCIntegrator):
               `True` to ignore tracked statistics.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_union_sphere")
     _cpp_cls = "IntegratorHPMCMonoSphereUnion"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -2096,6 +2369,7 @@ class ConvexSpheropolyhedronUnion(HPMCIntegrator):
               `True` to ignore tracked statistics.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_union_convex_polyhedron")
     _cpp_cls = "IntegratorHPMCMonoConvexPolyhedronUnion"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -2257,6 +2531,7 @@ class FacetedEllipsoidUnion(HPMCIntegrator):
               `True` to ignore tracked statistics.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_union_faceted_ellipsoid")
     _cpp_cls = "IntegratorHPMCMonoFacetedEllipsoidUnion"
     __doc__ = __doc__.replace("{inherited}", HPMCIntegrator._doc_inherited)
 
@@ -30,8 +30,6 @@
 #include "IntegratorHPMCMonoGPU.h"
 #endif
 
-#include "modules.h"
-
 namespace hoomd
     {
 namespace hpmc
@@ -81,30 +79,8 @@ PYBIND11_MODULE(_hpmc, m)
     export_wall_list(m);
     export_MassPropertiesBase(m);
 
-    export_sphere(m);
-    export_convex_polygon(m);
-
-    export_simple_polygon(m);
-
-    export_spheropolygon(m);
-
-    export_polyhedron(m);
-
-    export_ellipsoid(m);
-
-    export_faceted_ellipsoid(m);
-
-    export_sphinx(m);
-
-    export_union_convex_polyhedron(m);
-
-    export_union_faceted_ellipsoid(m);
-
-    export_union_sphere(m);
-
-    export_convex_polyhedron(m);
-
-    export_convex_spheropolyhedron(m);
+    // The shape specific classes are in the _hpmc_<shape> modules (see modules.h), which Python
+    // imports on demand.
 
     pybind11::class_<SphereParams, std::shared_ptr<SphereParams>>(m, "SphereParams")
         .def(pybind11::init<pybind11::dict>())
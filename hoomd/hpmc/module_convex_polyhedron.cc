@@ -21,6 +21,7 @@
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
+#include "IntegratorHPMCMonoNECGPU.h"
 #include "UpdaterGCAGPU.h"
 #endif
 
@@ -54,6 +55,9 @@ void export_convex_polyhedron(pybind11::module& m)
 #ifdef ENABLE_HIP
 
     export_IntegratorHPMCMonoGPU<ShapeConvexPolyhedron>(m, "IntegratorHPMCMonoConvexPolyhedronGPU");
+    export_IntegratorHPMCMonoNECGPU<ShapeConvexPolyhedron>(
+        m,
+        "IntegratorHPMCMonoNECConvexPolyhedronGPU");
     export_ComputeFreeVolumeGPU<ShapeConvexPolyhedron>(m, "ComputeFreeVolumeConvexPolyhedronGPU");
     export_UpdaterGCAGPU<ShapeConvexPolyhedron>(m, "UpdaterGCAConvexPolyhedronGPU");
 
@@ -63,3 +67,12 @@ void export_convex_polyhedron(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_convex_polyhedron python module exports
+PYBIND11_MODULE(_hpmc_convex_polyhedron, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_convex_polyhedron(m);
+    }
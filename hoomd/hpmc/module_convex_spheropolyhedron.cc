@@ -56,3 +56,12 @@ void export_convex_spheropolyhedron(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_convex_spheropolyhedron python module exports
+PYBIND11_MODULE(_hpmc_convex_spheropolyhedron, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_convex_spheropolyhedron(m);
+    }
@@ -56,3 +56,12 @@ void export_ellipsoid(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_ellipsoid python module exports
+PYBIND11_MODULE(_hpmc_ellipsoid, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_ellipsoid(m);
+    }
@@ -46,3 +46,12 @@ void export_simple_polygon(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_simple_polygon python module exports
+PYBIND11_MODULE(_hpmc_simple_polygon, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_simple_polygon(m);
+    }
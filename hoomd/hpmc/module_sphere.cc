@@ -17,6 +17,7 @@
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
+#include "IntegratorHPMCMonoNECGPU.h"
 #include "UpdaterGCAGPU.h"
 #endif
 
@@ -40,6 +41,7 @@ void export_sphere(pybind11::module& m)
 
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeSphere>(m, "IntegratorHPMCMonoSphereGPU");
+    export_IntegratorHPMCMonoNECGPU<ShapeSphere>(m, "IntegratorHPMCMonoNECSphereGPU");
     export_ComputeFreeVolumeGPU<ShapeSphere>(m, "ComputeFreeVolumeSphereGPU");
     export_UpdaterGCAGPU<ShapeSphere>(m, "UpdaterGCASphereGPU");
 #endif
@@ -48,3 +50,12 @@ void export_sphere(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_sphere python module exports
+PYBIND11_MODULE(_hpmc_sphere, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_sphere(m);
+    }
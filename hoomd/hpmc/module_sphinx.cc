@@ -50,3 +50,12 @@ void export_sphinx(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_sphinx python module exports
+PYBIND11_MODULE(_hpmc_sphinx, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_sphinx(m);
+    }
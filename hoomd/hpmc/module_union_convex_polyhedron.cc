@@ -63,3 +63,12 @@ void export_union_convex_polyhedron(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_union_convex_polyhedron python module exports
+PYBIND11_MODULE(_hpmc_union_convex_polyhedron, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_union_convex_polyhedron(m);
+    }
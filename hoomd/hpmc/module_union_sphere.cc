@@ -48,3 +48,12 @@ void export_union_sphere(pybind11::module& m)
     } // namespace detail
     } // namespace hpmc
     } // namespace hoomd
+
+//! Define the _hpmc_union_sphere python module exports
+PYBIND11_MODULE(_hpmc_union_sphere, m)
+    {
+    // register the base classes and shape parameters
+    pybind11::module::import("hoomd.hpmc._hpmc");
+
+    hoomd::hpmc::detail::export_union_sphere(m);
+    }
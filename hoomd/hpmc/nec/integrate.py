@@ -9,6 +9,7 @@ from hoomd.data.typeparam import TypeParameter
 from hoomd.data.typeconverter import OnlyTypes
 
 from hoomd.logging import log
+from hoomd.util import _LazyModule
 
 
 class HPMCNECIntegrator(HPMCIntegrator):
@@ -22,6 +23,18 @@ class HPMCNECIntegrator(HPMCIntegrator):
         This class should not be instantiated by users. The class can be used
         for `isinstance` or `issubclass` checks.
 
+    .. rubric:: GPU execution
+
+    On the GPU, the integrator runs many chains at the same time, one in each
+    cell of a checkerboard of cells at least as wide as the largest shape plus
+    the largest collision search distance ``d``. A chain only moves the
+    particles of its own cell: it ends where a particle would leave the cell
+    or collide with a particle of another cell. The grid shifts randomly
+    after each step so that particles move between cells. Each cell starts
+    ``update_fraction`` chains per particle in the cell on average, so the
+    trajectories differ from those of the CPU implementation. The box must be
+    at least two cells wide in each direction.
+
     {inherited}
 
     ----------
@@ -191,8 +204,8 @@ class Sphere(HPMCNECIntegrator):
 
     `Sphere` does not support ``pair_potential`` or ``external_potential``.
 
-    Attention:
-        `Sphere` does not support execution on GPUs.
+    Note:
+        See `HPMCNECIntegrator` for how the chains run on GPUs.
 
     Attention:
         `Sphere` does not support MPI parallel simulations.
@@ -225,6 +238,7 @@ class Sphere(HPMCNECIntegrator):
               allow rotation moves on this particle type.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_sphere")
     _cpp_cls = "IntegratorHPMCMonoNECSphere"
     __doc__ = __doc__.replace("{inherited}", HPMCNECIntegrator._doc_inherited)
 
@@ -290,8 +304,8 @@ class ConvexPolyhedron(HPMCNECIntegrator):
     `ConvexPolyhedron` does not support ``pair_potential`` or
     ``external_potential``.
 
-    Attention:
-        `ConvexPolyhedron` does not support execution on GPUs.
+    Note:
+        See `HPMCNECIntegrator` for how the chains run on GPUs.
 
     Attention:
         `ConvexPolyhedron` does not support MPI parallel simulations.
@@ -351,6 +365,7 @@ class ConvexPolyhedron(HPMCNECIntegrator):
                 Undefined behavior will result when they are violated.
     """
 
+    _ext_module = _LazyModule("hoomd.hpmc._hpmc_convex_polyhedron")
     _cpp_cls = "IntegratorHPMCMonoNECConvexPolyhedron"
     __doc__ = __doc__.replace("{inherited}", HPMCNECIntegrator._doc_inherited)
 
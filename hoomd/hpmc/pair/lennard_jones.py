@@ -25,6 +25,8 @@ class LennardJones(Pair):
         default_r_on (float): Default XPLOR on radius
           :math:`[\\mathrm{length}]`.
         mode (str): Energy shifting/smoothing mode.
+        table_width (int): Number of bins in the energy table (0 disables
+          the table).
 
     `LennardJones` computes the Lennard-Jones pair potential between every pair
     of particles in the simulation state. The functional form of the potential,
@@ -79,12 +81,19 @@ class LennardJones(Pair):
             lennard_jones.mode = "shift"
 
         Type: `str`
+
+    {table_width}
     """
 
     _cpp_class_name = "PairPotentialLennardJones"
-    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
-
-    def __init__(self, default_r_cut=None, default_r_on=0.0, mode="none"):
+    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited).replace(
+        "{table_width}",
+        Pair._doc_table_width.strip().replace("{name}", "lennard_jones"),
+    )
+
+    def __init__(
+        self, default_r_cut=None, default_r_on=0.0, mode="none", table_width=0
+    ):
         if default_r_cut is None:
             default_r_cut = float
         else:
@@ -105,7 +114,11 @@ class LennardJones(Pair):
 
         self._param_dict.update(
             hoomd.data.parameterdicts.ParameterDict(
-                mode=hoomd.data.typeconverter.OnlyFrom(("none", "shift", "xplor"))
+                mode=hoomd.data.typeconverter.OnlyFrom(("none", "shift", "xplor")),
+                table_width=hoomd.data.typeconverter.OnlyTypes(
+                    int, preprocess=hoomd.data.typeconverter.nonnegative_real
+                ),
             )
         )
         self.mode = mode
+        self.table_width = table_width
@@ -26,6 +26,8 @@ class LJGauss(Pair):
         default_r_on (float): Default XPLOR on radius
           :math:`[\\mathrm{length}]`.
         mode (str): Energy shifting/smoothing mode.
+        table_width (int): Number of bins in the energy table (0 disables
+          the table).
 
     `LJGauss` computes the Lennard-Jones-Gauss pair potential between every pair
     of particles in the simulation state. The functional form of the potential,
@@ -85,12 +87,18 @@ class LJGauss(Pair):
             lj_gauss.mode = "shift"
 
         Type: `str`
+
+    {table_width}
     """
 
     _cpp_class_name = "PairPotentialLJGauss"
-    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
+    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited).replace(
+        "{table_width}", Pair._doc_table_width.strip().replace("{name}", "lj_gauss")
+    )
 
-    def __init__(self, default_r_cut=None, default_r_on=0.0, mode="none"):
+    def __init__(
+        self, default_r_cut=None, default_r_on=0.0, mode="none", table_width=0
+    ):
         if default_r_cut is None:
             default_r_cut = float
         else:
@@ -112,7 +120,11 @@ class LJGauss(Pair):
 
         self._param_dict.update(
             hoomd.data.parameterdicts.ParameterDict(
-                mode=hoomd.data.typeconverter.OnlyFrom(("none", "shift", "xplor"))
+                mode=hoomd.data.typeconverter.OnlyFrom(("none", "shift", "xplor")),
+                table_width=hoomd.data.typeconverter.OnlyTypes(
+                    int, preprocess=hoomd.data.typeconverter.nonnegative_real
+                ),
             )
         )
         self.mode = mode
+        self.table_width = table_width
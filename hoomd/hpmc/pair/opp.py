@@ -25,6 +25,8 @@ class OPP(Pair):
         default_r_on (float): Default XPLOR on radius
           :math:`[\\mathrm{length}]`.
         mode (str): Energy shifting/smoothing mode.
+        table_width (int): Number of bins in the energy table (0 disables
+          the table).
 
     `OPP` computes the oscillating pair potential between every pair
     of particles in the simulation state. The functional form of the potential,
@@ -98,12 +100,18 @@ class OPP(Pair):
             opp.mode = "shift"
 
         Type: `str`
+
+    {table_width}
     """
 
     _cpp_class_name = "PairPotentialOPP"
-    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
+    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited).replace(
+        "{table_width}", Pair._doc_table_width.strip().replace("{name}", "opp")
+    )
 
-    def __init__(self, default_r_cut=None, default_r_on=0.0, mode="none"):
+    def __init__(
+        self, default_r_cut=None, default_r_on=0.0, mode="none", table_width=0
+    ):
         if default_r_cut is None:
             default_r_cut = float
         else:
@@ -128,7 +136,11 @@ class OPP(Pair):
 
         self._param_dict.update(
             hoomd.data.parameterdicts.ParameterDict(
-                mode=hoomd.data.typeconverter.OnlyFrom(("none", "shift", "xplor"))
+                mode=hoomd.data.typeconverter.OnlyFrom(("none", "shift", "xplor")),
+                table_width=hoomd.data.typeconverter.OnlyTypes(
+                    int, preprocess=hoomd.data.typeconverter.nonnegative_real
+                ),
             )
         )
         self.mode = mode
+        self.table_width = table_width
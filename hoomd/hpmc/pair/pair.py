@@ -48,6 +48,31 @@ class Pair(hoomd.operation._HOOMDBaseObject):
         `Read more... <hoomd.hpmc.pair.Pair.energy>`
     """
 
+    _doc_table_width = """
+    .. py:attribute:: table_width
+
+        Number of bins in the energy table. When non-zero, the potential is
+        sampled at ``table_width + 1`` points evenly spaced in :math:`r^2`
+        from 0 to :math:`r_{\\mathrm{cut}}^2` and HPMC linearly interpolates
+        the tabulated values in place of evaluating the potential. The
+        tabulated energy is an approximation; choose a width large enough
+        that the interpolation error is acceptable. The table is rebuilt
+        whenever the parameters change. Set to 0 to evaluate the potential
+        directly.
+
+        HPMC on the GPU requires a non-zero `table_width`. The GPU treats a
+        potential that diverges at :math:`r = 0` as a hard core in the first
+        bin of the table.
+
+        .. rubric:: Example
+
+        .. code-block:: python
+
+            {name}.table_width = 4096
+
+        Type: `int`
+    """
+
     def _make_cpp_obj(self):
         cpp_sys_def = self._simulation.state._cpp_sys_def
         cls = getattr(self._ext_module, self._cpp_class_name)
@@ -64,7 +89,10 @@ class Pair(hoomd.operation._HOOMDBaseObject):
         device = self._simulation.device
 
         if isinstance(device, hoomd.device.GPU):
-            raise RuntimeError("Not implemented on the GPU")
+            if not hasattr(self, "table_width"):
+                raise RuntimeError("Not implemented on the GPU")
+            if self.table_width == 0:
+                raise RuntimeError("table_width must be non-zero on the GPU.")
 
         self._cpp_obj = self._make_cpp_obj()
 
@@ -91,6 +91,31 @@ def test_logging():
     )
 
 
+@pytest.mark.cpu
+@pytest.mark.serial
+def test_threads(num_cpu_threads, simulation_factory, lattice_snapshot_factory):
+    """Test that the threaded free volume matches the serial one."""
+    results = []
+    for _ in num_cpu_threads():
+        sim = simulation_factory(
+            lattice_snapshot_factory(dimensions=3, a=1.5, n=4, r=0.1)
+        )
+
+        mc = hoomd.hpmc.integrate.Sphere()
+        mc.shape["A"] = dict(diameter=1.0)
+        sim.operations.integrator = mc
+
+        free_volume = hoomd.hpmc.compute.FreeVolume(
+            test_particle_type="A", num_samples=10000
+        )
+        sim.operations.computes.append(free_volume)
+        sim.run(0)
+
+        results.append(free_volume.free_volume)
+
+    assert results[0] == results[1]
+
+
 def test_2d_free_volume(simulation_factory):
     snapshot = hoomd.Snapshot()
     if snapshot.communicator.rank == 0:
@@ -696,6 +696,56 @@ def test_sdf_expansion(simulation_factory, two_particle_snapshot_factory):
     assert sdf_expansion[-1] != 0
 
 
+@pytest.mark.cpu
+@pytest.mark.serial
+def test_threads(num_cpu_threads, simulation_factory, lattice_snapshot_factory):
+    """Test that the threaded histogram matches the serial one."""
+    results = []
+    for _ in num_cpu_threads():
+        sim = simulation_factory(
+            lattice_snapshot_factory(dimensions=3, a=1.1, n=6, r=0.02)
+        )
+
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0)
+        mc.shape["A"] = dict(diameter=1.0)
+        sim.operations.integrator = mc
+
+        sdf = hoomd.hpmc.compute.SDF(xmax=0.1, dx=1e-3)
+        sim.operations.computes.append(sdf)
+        sim.run(0)
+
+        assert numpy.count_nonzero(sdf.sdf_compression) > 0
+        results.append(sdf.sdf_compression)
+
+    numpy.testing.assert_allclose(results[0], results[1])
+
+
+def test_asynchronous(simulation_factory, lattice_snapshot_factory):
+    """Test that the background count matches the synchronous one."""
+    sim = simulation_factory(lattice_snapshot_factory(dimensions=3, a=1.1, n=6, r=0.02))
+
+    # with d=0 the configuration does not change, so the lagged result matches
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0)
+    mc.shape["A"] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    sdf = hoomd.hpmc.compute.SDF(xmax=0.1, dx=1e-3)
+    sdf_async = hoomd.hpmc.compute.SDF(xmax=0.1, dx=1e-3)
+    sdf_async.asynchronous = True
+    assert sdf_async.asynchronous
+    sim.operations.computes.extend([sdf, sdf_async])
+    sim.run(0)
+    assert sdf_async.asynchronous
+
+    for _ in range(3):
+        reference = sdf.sdf_compression
+        result = sdf_async.sdf_compression
+        if sim.device.communicator.rank == 0:
+            assert numpy.count_nonzero(result) > 0
+            numpy.testing.assert_allclose(result, reference)
+        sim.run(1)
+
+
 def test_logging():
     logging_check(
         hoomd.hpmc.compute.SDF,
@@ -177,6 +177,30 @@ def test_pivot_moves(device, simulation_factory, lattice_snapshot_factory):
     assert avg > 0
 
 
+@pytest.mark.serial
+@pytest.mark.cpu
+def test_threads(num_cpu_threads, simulation_factory, lattice_snapshot_factory):
+    """Test that threaded cluster moves match serial cluster moves."""
+    positions = []
+    for _ in num_cpu_threads():
+        sim = simulation_factory(
+            lattice_snapshot_factory(dimensions=3, a=1.3, n=6, r=0.1)
+        )
+
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+        mc.shape["A"] = dict(diameter=1.0)
+        sim.operations.integrator = mc
+
+        cl = hoomd.hpmc.update.GCA(trigger=hoomd.trigger.Periodic(1))
+        sim.operations.updaters.append(cl)
+        sim.run(5)
+
+        assert cl.avg_cluster_size > 0
+        positions.append(sim.state.get_snapshot().particles.position)
+
+    assert (positions[0] == positions[1]).all()
+
+
 def test_pickling(simulation_factory, two_particle_snapshot_factory):
     """Test that Cluster objects are picklable."""
     sim = simulation_factory(two_particle_snapshot_factory())
@@ -205,3 +205,28 @@ class TestMoveSize:
 
     def test_pickling(self, move_size_tuner, simulation):
         operation_pickling_check(move_size_tuner, simulation)
+
+
+def test_online_tuning(simulation):
+    """Test that the integrator tunes and then freezes its move sizes."""
+    integrator = simulation.operations.integrator
+    integrator.tune_acceptance = 0.3
+    integrator.tune_period = 100
+    integrator.tune_tolerance = 0.05
+    assert integrator.tune_acceptance == 0.3
+
+    cnt = 0
+    simulation.run(0)
+    while integrator.tune_acceptance is not None and cnt < 20:
+        simulation.run(1000)
+        cnt += 1
+    assert integrator.tune_acceptance is None
+    assert integrator.d["A"] > 0.01
+
+    # the move sizes stay frozen once converged
+    d = integrator.d["A"]
+    simulation.run(1000)
+    assert integrator.d["A"] == d
+
+    with pytest.raises(ValueError):
+        integrator.tune_acceptance = 1.5
@@ -29,6 +29,7 @@ valid_attrs = [
     ("transfer_types", ["A"]),
     ("transfer_types", ["B"]),
     ("transfer_types", ["A", "B"]),
+    ("cavity_width", 0.25),
 ]
 
 
@@ -174,6 +175,32 @@ def test_insertion_removal(device, simulation_factory, lattice_snapshot_factory)
     assert muvt.N["B"] > 0
 
 
+@pytest.mark.serial
+@pytest.mark.cpu
+def test_cavity_bias(device, simulation_factory, lattice_snapshot_factory):
+    """Test that MuVT inserts and removes particles in the cavities."""
+    sim = simulation_factory(lattice_snapshot_factory(dimensions=3, a=1.3, n=5, r=0.05))
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    mc.shape["A"] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    muvt = hoomd.hpmc.update.MuVT(
+        trigger=hoomd.trigger.Periodic(1), transfer_types=["A"], cavity_width=0.2
+    )
+    muvt.fugacity["A"] = 10
+    sim.operations.updaters.append(muvt)
+    assert muvt.cavity_width == 0.2
+
+    sim.run(200)
+    assert muvt.insert_moves[0] > 0
+    assert muvt.remove_moves[0] > 0
+    assert mc.overlaps == 0
+
+    with pytest.raises(ValueError):
+        muvt.cavity_width = -1
+
+
 @pytest.mark.cpu
 def test_pair_remove_insert(device, simulation_factory, one_particle_snapshot_factory):
     """Test that MuVT considers pair potentials."""
@@ -0,0 +1,40 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Test hoomd.hpmc.nec.integrate."""
+
+import hoomd
+import hoomd.hpmc.nec
+import numpy as np
+import pytest
+
+
+@pytest.mark.serial
+def test_sphere_chains(simulation_factory, lattice_snapshot_factory):
+    """Check that the chains move the particles without overlaps."""
+    snapshot = lattice_snapshot_factory(a=1.5, n=8)
+    if snapshot.communicator.rank == 0:
+        rng = np.random.default_rng(1)
+        snapshot.particles.velocity[:] = rng.normal(size=(snapshot.particles.N, 3))
+        initial_position = np.array(snapshot.particles.position)
+
+    sim = simulation_factory(snapshot)
+    sim.seed = 3
+    mc = hoomd.hpmc.nec.integrate.Sphere(
+        default_d=0.3, chain_time=0.5, update_fraction=0.5
+    )
+    mc.shape["A"] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    sim.run(10)
+    assert mc.overlaps == 0
+
+    counters = mc.nec_counters
+    assert counters.chain_start_count > 0
+    assert counters.chain_at_collision_count > 0
+    assert counters.chain_no_collision_count > 0
+    assert mc.virial_pressure > 0
+
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        assert not np.allclose(snapshot.particles.position, initial_position)
@@ -4,6 +4,7 @@
 """Test hoomd.hpmc.pair.LennardJones and HPMC pair infrastructure."""
 
 import hoomd
+import numpy
 import pytest
 
 valid_constructor_args = [
@@ -218,6 +219,83 @@ def test_multiple_pair_potentials(mc_simulation_factory):
     assert lennard_jones_2.energy == pytest.approx(expected=0.0, abs=1e-5)
 
 
+@pytest.mark.parametrize("mode", ["none", "shift", "xplor"])
+@pytest.mark.parametrize("d", [0.95, 1.5, 2.3])
+@pytest.mark.cpu
+def test_table(mc_simulation_factory, mode, d):
+    """Test that the tabulated energy approximates the direct evaluation."""
+    lennard_jones = hoomd.hpmc.pair.LennardJones(mode=mode, table_width=4096)
+    lennard_jones.params[("A", "A")] = dict(epsilon=5.0, sigma=1.1, r_cut=2.5, r_on=2.0)
+
+    simulation = mc_simulation_factory(d=d)
+    simulation.operations.integrator.pair_potentials = [lennard_jones]
+    simulation.run(0)
+
+    assert lennard_jones.table_width == 4096
+    tabulated_energy = lennard_jones.energy
+
+    lennard_jones.table_width = 0
+    direct_energy = lennard_jones.energy
+    assert tabulated_energy == pytest.approx(expected=direct_energy, rel=1e-3, abs=1e-4)
+
+    # the table is rebuilt when the parameters change
+    lennard_jones.table_width = 4096
+    lennard_jones.params[("A", "A")] = dict(epsilon=2.0, sigma=1.1, r_cut=2.5, r_on=2.0)
+    assert lennard_jones.energy == pytest.approx(
+        expected=direct_energy * 2.0 / 5.0, rel=1e-3, abs=1e-4
+    )
+
+
+@pytest.mark.cpu
+def test_pair_energy_cache(simulation_factory, lattice_snapshot_factory):
+    """Test that the pair energy cache does not change the trial moves."""
+    positions = []
+    for pair_energy_cache in (False, True):
+        snapshot = lattice_snapshot_factory(dimensions=3, n=4, a=1.2)
+        simulation = simulation_factory(snapshot)
+
+        sphere = hoomd.hpmc.integrate.Sphere(nselect=8, default_d=0.3)
+        sphere.shape["A"] = dict(diameter=0)
+        sphere.pair_energy_cache = pair_energy_cache
+        simulation.operations.integrator = sphere
+
+        lennard_jones = hoomd.hpmc.pair.LennardJones()
+        lennard_jones.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0, r_cut=2.5)
+        sphere.pair_potentials = [lennard_jones]
+
+        simulation.run(10)
+        assert sphere.pair_energy_cache == pair_energy_cache
+
+        snapshot = simulation.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions.append(snapshot.particles.position)
+
+    if len(positions) == 2:
+        numpy.testing.assert_allclose(positions[0], positions[1], atol=1e-5)
+
+
+@pytest.mark.gpu
+def test_gpu_table(simulation_factory, lattice_snapshot_factory):
+    """Test that GPU HPMC samples tabulated pair potentials."""
+    snapshot = lattice_snapshot_factory(dimensions=3, n=4, a=1.2)
+    simulation = simulation_factory(snapshot)
+
+    sphere = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    sphere.shape["A"] = dict(diameter=0)
+    simulation.operations.integrator = sphere
+
+    lennard_jones = hoomd.hpmc.pair.LennardJones(table_width=4096)
+    lennard_jones.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0, r_cut=2.5)
+    sphere.pair_potentials = [lennard_jones]
+    simulation.run(100)
+
+    assert sphere.translate_moves[0] > 0
+    assert sphere.translate_moves[1] > 0
+
+    # moves into the repulsive core are rejected, so the energy stays negative
+    assert lennard_jones.energy < 0
+
+
 def test_logging():
     hoomd.conftest.logging_check(
         hoomd.hpmc.pair.LennardJones,
@@ -44,6 +44,12 @@ valid_constructor_args = [
         min_scale=0.999,
         allow_unsafe_resize=True,
     ),
+    dict(
+        trigger=hoomd.trigger.Periodic(1000),
+        target_box=hoomd.variant.box.Constant(hoomd.Box.from_box([50, 50])),
+        min_scale=0.5,
+        use_contact_gap=True,
+    ),
     dict(
         trigger=hoomd.trigger.Periodic(1000),
         target_box=hoomd.variant.box.Constant(
@@ -101,6 +107,7 @@ valid_attrs = [
     ("min_scale", 0.5),
     ("min_scale", 0.9999),
     ("allow_unsafe_resize", True),
+    ("use_contact_gap", True),
 ]
 
 
@@ -275,6 +282,35 @@ def test_sphere_compression(
     assert sim.state.box == target_box
 
 
+def test_contact_gap_compression(simulation_factory, lattice_snapshot_factory):
+    """Test that use_contact_gap compresses dilute systems in a single step."""
+    n = 4
+    snap = lattice_snapshot_factory(n=n, a=3)
+    target_box = hoomd.Box.cube(n * 1.5)
+
+    qc = hoomd.hpmc.update.QuickCompress(
+        trigger=hoomd.trigger.Periodic(1),
+        target_box=target_box,
+        min_scale=0.5,
+        use_contact_gap=True,
+    )
+    assert qc.use_contact_gap
+
+    sim = simulation_factory(snap)
+    sim.operations.updaters.append(qc)
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.05)
+    mc.shape["A"] = dict(diameter=1)
+    sim.operations.integrator = mc
+
+    # the closest neighbors are 3 diameters apart, so one box move of scale 0.5
+    # reaches the target without overlaps
+    sim.run(2)
+    assert sim.state.box == target_box
+    assert mc.overlaps == 0
+    assert qc.complete
+
+
 @pytest.mark.parametrize("phi", [0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8])
 @pytest.mark.validate
 def test_disk_compression(phi, simulation_factory, lattice_snapshot_factory):
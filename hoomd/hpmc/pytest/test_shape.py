@@ -2,6 +2,8 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 from collections.abc import Sequence
+import subprocess
+import sys
 
 import hoomd
 from hoomd.conftest import (
@@ -157,6 +159,248 @@ def test_moves(simulation_factory, lattice_snapshot_factory, test_moves_args):
         assert accepted_rejected_rot > 0
 
 
+@pytest.mark.parametrize("broadphase", ["auto", "grid"])
+def test_broadphase(simulation_factory, lattice_snapshot_factory, broadphase):
+    """Check that the broadphase does not change the trajectory."""
+    positions = {}
+    for method in ("tree", broadphase):
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.2)
+        mc.shape["A"] = dict(diameter=1.0)
+        mc.broadphase = method
+        assert mc.broadphase == method
+
+        sim = simulation_factory(lattice_snapshot_factory(a=1.1, n=6))
+        sim.seed = 5
+        sim.operations.integrator = mc
+        sim.run(10)
+        assert mc.broadphase == method
+        assert mc.overlaps == 0
+
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions[method] = snapshot.particles.position
+
+    if len(positions) > 0:
+        np.testing.assert_array_equal(positions["tree"], positions[broadphase])
+
+    with pytest.raises(ValueError):
+        mc.broadphase = "list"
+
+
+@pytest.mark.parametrize(
+    "cls",
+    [
+        hoomd.hpmc.integrate.ConvexPolyhedron,
+        hoomd.hpmc.integrate.ConvexSpheropolyhedron,
+    ],
+)
+def test_separating_axis_cache(simulation_factory, lattice_snapshot_factory, cls):
+    """Check that the separating axis cache does not change the trajectory."""
+    orientations = {}
+    for enable in (False, True):
+        mc = cls(default_d=0.1, default_a=0.1)
+        mc.shape["A"] = dict(
+            vertices=[
+                (0.5, 0.5, 0.5),
+                (0.5, -0.5, -0.5),
+                (-0.5, 0.5, -0.5),
+                (-0.5, -0.5, 0.5),
+            ]
+        )
+        mc.separating_axis_cache = enable
+
+        sim = simulation_factory(lattice_snapshot_factory(a=1.2, n=5))
+        sim.seed = 3
+        sim.operations.integrator = mc
+        sim.run(10)
+        assert mc.separating_axis_cache == enable
+        assert mc.overlaps == 0
+
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            orientations[enable] = snapshot.particles.orientation
+
+    if len(orientations) > 0:
+        np.testing.assert_array_equal(orientations[False], orientations[True])
+
+
+@pytest.mark.cpu
+@pytest.mark.serial
+def test_checkerboard(num_cpu_threads, simulation_factory, lattice_snapshot_factory):
+    """Check the threaded checkerboard sweep against the serial sweep."""
+
+    def run(checkerboard):
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+        mc.shape["A"] = dict(diameter=1.0)
+        mc.checkerboard = checkerboard
+        assert mc.checkerboard == checkerboard
+
+        sim = simulation_factory(lattice_snapshot_factory(a=1.1, n=8))
+        sim.seed = 7
+        sim.operations.integrator = mc
+        sim.run(20)
+        assert mc.checkerboard == checkerboard
+        assert mc.overlaps == 0
+
+        accepted, rejected = mc.translate_moves
+        return accepted / (accepted + rejected), sim.state.get_snapshot()
+
+    serial_acceptance, _ = run(False)
+
+    results = []
+    for _ in num_cpu_threads():
+        results.append(run(True))
+
+    # the trajectory does not depend on the number of threads
+    assert results[0][0] == results[1][0]
+    np.testing.assert_array_equal(
+        results[0][1].particles.position, results[1][1].particles.position
+    )
+
+    # the acceptance statistics match the serial sweep
+    assert results[0][0] == pytest.approx(serial_acceptance, abs=0.03)
+
+
+@pytest.mark.parametrize("convergence_batch", [2, 5])
+def test_convergence_batch(
+    simulation_factory, lattice_snapshot_factory, convergence_batch
+):
+    """Check that batched convergence passes do not change the trajectory."""
+    positions = {}
+    for batch in (1, convergence_batch):
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.2)
+        mc.shape["A"] = dict(diameter=1.0)
+        mc.convergence_batch = batch
+        assert mc.convergence_batch == batch
+
+        sim = simulation_factory(lattice_snapshot_factory(a=1.1, n=6))
+        sim.seed = 5
+        sim.operations.integrator = mc
+        sim.run(10)
+        assert mc.convergence_batch == batch
+        assert mc.overlaps == 0
+
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions[batch] = snapshot.particles.position
+
+    if len(positions) > 0:
+        np.testing.assert_array_equal(positions[1], positions[convergence_batch])
+
+    with pytest.raises(ValueError):
+        mc.convergence_batch = 0
+
+
+@pytest.mark.cpu
+@pytest.mark.parametrize(
+    "cls, shape",
+    [
+        (hoomd.hpmc.integrate.Ellipsoid, dict(a=0.55, b=0.3, c=0.15)),
+        (
+            hoomd.hpmc.integrate.ConvexSpheropolyhedron,
+            dict(vertices=[(0.4, 0, 0), (-0.4, 0, 0)], sweep_radius=0.15),
+        ),
+        (
+            hoomd.hpmc.integrate.FacetedEllipsoid,
+            dict(normals=[(1, 0, 0)], offsets=[-0.3], a=0.55, b=0.3, c=0.15),
+        ),
+    ],
+)
+def test_support_extent_tables(
+    simulation_factory, lattice_snapshot_factory, cls, shape
+):
+    """Check that the extent tables do not change the trajectory."""
+    positions = {}
+    for enable in (False, True):
+        mc = cls(default_d=0.1, default_a=0.1)
+        mc.shape["A"] = shape
+        mc.support_extent_tables = enable
+
+        sim = simulation_factory(lattice_snapshot_factory(a=1.2, n=5))
+        sim.seed = 5
+        sim.operations.integrator = mc
+        sim.run(10)
+        assert mc.support_extent_tables == enable
+        assert mc.overlaps == 0
+
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions[enable] = snapshot.particles.position
+
+    if len(positions) > 0:
+        np.testing.assert_array_equal(positions[False], positions[True])
+
+
+@pytest.mark.serial
+@pytest.mark.cpu
+def test_small_tilted_box(simulation_factory):
+    """Check that trial moves in a small, strongly tilted box find all images."""
+    snapshot = hoomd.Snapshot()
+    box = hoomd.Box(Lx=1.2, Ly=1.2, Lz=1.2, xy=0.9, xz=0.3, yz=0.6)
+    fractions = np.array(
+        [(x, y, z) for x in (0.25, 0.75) for y in (0.25, 0.75) for z in (0.25, 0.75)]
+    )
+    positions = fractions @ box.to_matrix().T - 0.5 * np.sum(box.to_matrix(), axis=1)
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = box
+        snapshot.particles.N = len(positions)
+        snapshot.particles.types = ["A"]
+        snapshot.particles.position[:] = positions
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.05)
+    mc.shape["A"] = dict(diameter=0.4)
+
+    sim = simulation_factory(snapshot)
+    sim.operations.integrator = mc
+    assert mc.overlaps == 0
+    sim.run(100)
+    assert mc.overlaps == 0
+    assert mc.translate_moves[0] > 0
+
+
+@pytest.mark.cpu
+def test_instrumentation(simulation_factory, lattice_snapshot_factory):
+    """Check that the per-type counts add up to the total counts."""
+    snapshot = lattice_snapshot_factory(particle_types=["A", "B"], a=1.2, n=5)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[::2] = 1
+
+    mc = hoomd.hpmc.integrate.ConvexPolyhedron(default_d=0.1, default_a=0.1)
+    vertices = [
+        (0.5, 0.5, 0.5),
+        (0.5, -0.5, -0.5),
+        (-0.5, 0.5, -0.5),
+        (-0.5, -0.5, 0.5),
+    ]
+    mc.shape["A"] = dict(vertices=vertices)
+    mc.shape["B"] = dict(vertices=vertices)
+    mc.d["B"] = 0.2
+
+    sim = simulation_factory(snapshot)
+    sim.operations.integrator = mc
+    sim.run(10)
+
+    type_translate_moves = mc.type_translate_moves
+    type_rotate_moves = mc.type_rotate_moves
+    assert len(type_translate_moves) == 2
+    assert len(type_rotate_moves) == 2
+    assert all(sum(counts) > 0 for counts in type_translate_moves)
+    assert all(sum(counts) > 0 for counts in type_rotate_moves)
+    assert tuple(np.sum(type_translate_moves, axis=0)) == mc.translate_moves
+    assert tuple(np.sum(type_rotate_moves, axis=0)) == mc.rotate_moves
+
+    stage_times = mc.stage_times
+    assert len(stage_times) == 5
+    assert stage_times[0] > 0
+    assert stage_times[1] > 0
+    assert all(t >= 0 for t in stage_times)
+
+    # the instrumentation is reset at the start of each run
+    sim.run(0)
+    assert all(sum(counts) == 0 for counts in mc.type_translate_moves)
+    assert all(t == 0 for t in mc.stage_times)
+
+
 def test_kernel_parameters(
     simulation_factory, lattice_snapshot_factory, test_moves_args
 ):
@@ -742,7 +986,16 @@ def test_logging():
             "mps": {"category": LoggerCategories.scalar, "default": True},
             "overlaps": {"category": LoggerCategories.scalar, "default": True},
             "rotate_moves": {"category": LoggerCategories.sequence, "default": True},
+            "stage_times": {"category": LoggerCategories.sequence, "default": True},
             "translate_moves": {"category": LoggerCategories.sequence, "default": True},
+            "type_rotate_moves": {
+                "category": LoggerCategories.sequence,
+                "default": True,
+            },
+            "type_translate_moves": {
+                "category": LoggerCategories.sequence,
+                "default": True,
+            },
         },
     )
 
@@ -763,3 +1016,15 @@ def test_logging():
 
     for integrator in integrators:
         logging_check(integrator, ("hpmc", "integrate"), type_shapes_check)
+
+
+@pytest.mark.serial
+def test_lazy_shape_modules():
+    code = (
+        "import sys, hoomd.hpmc\n"
+        "loaded = lambda: [m for m in sys.modules if '._hpmc_' in m]\n"
+        "assert loaded() == [], loaded()\n"
+        "hoomd.hpmc.integrate.Sphere()._ext_module.IntegratorHPMCMonoSphere\n"
+        "assert loaded() == ['hoomd.hpmc._hpmc_sphere'], loaded()\n"
+    )
+    subprocess.run([sys.executable, "-c", code], check=True)
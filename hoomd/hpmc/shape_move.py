@@ -11,7 +11,6 @@ See Also:
 
 import hoomd
 from hoomd.operation import _HOOMDBaseObject
-from . import _hpmc
 from hoomd.hpmc import integrate
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.data.typeparam import TypeParameter
@@ -73,7 +72,9 @@ class ShapeMove(_HOOMDBaseObject):
 
         integrator_name = integrator.__class__.__name__
         if integrator_name in self._supported_shapes:
-            self._move_cls = getattr(_hpmc, self.__class__.__name__ + integrator_name)
+            self._move_cls = getattr(
+                integrator._ext_module, self.__class__.__name__ + integrator_name
+            )
         else:
             raise RuntimeError("Integrator not supported")
         self._cpp_obj = self._move_cls(
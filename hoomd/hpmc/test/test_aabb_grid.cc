@@ -0,0 +1,122 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN();
+
+#include "hoomd/AABBGrid.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include <pybind11/pybind11.h>
+
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/VectorMath.h"
+
+using namespace hoomd;
+using namespace hoomd::detail;
+
+bool in(unsigned int i, const std::vector<unsigned int>& v)
+    {
+    std::vector<unsigned int>::const_iterator it;
+    it = std::find(v.begin(), v.end(), i);
+    return (it != v.end());
+    }
+
+UP_TEST(basic)
+    {
+    // build a simple test AABB grid
+    AABB aabbs[3];
+    aabbs[0] = AABB(vec3<Scalar>(1, 1, -1), vec3<Scalar>(3, 3, 1));
+    aabbs[1] = AABB(vec3<Scalar>(0, 1, -1), vec3<Scalar>(1, 5, 1));
+    aabbs[2] = AABB(vec3<Scalar>(0, 0, -1), vec3<Scalar>(1, 1, 1));
+
+    AABBGrid grid;
+    grid.buildGrid(aabbs, 3, Scalar(1.0));
+    UP_ASSERT_EQUAL(grid.getNumParticles(), 3);
+
+    // try some test queries
+    std::vector<unsigned int> hits;
+
+    hits.clear();
+    grid.query(hits, AABB(vec3<Scalar>(2, 2, 0), vec3<Scalar>(2.1, 2.1, 0.1)));
+    UP_ASSERT(in(0, hits));
+
+    hits.clear();
+    grid.query(hits, AABB(vec3<Scalar>(0.5, 3, 0), vec3<Scalar>(0.6, 3.1, 0.1)));
+    UP_ASSERT(in(1, hits));
+
+    hits.clear();
+    grid.query(hits, AABB(vec3<Scalar>(0.5, 0.5, 0), vec3<Scalar>(0.6, 0.6, 0.1)));
+    UP_ASSERT(in(2, hits));
+
+    hits.clear();
+    grid.query(hits, AABB(vec3<Scalar>(0.9, 0.9, 0), vec3<Scalar>(1.1, 1.1, 0.1)));
+    UP_ASSERT_EQUAL(hits.size(), 3);
+
+    // queries far from all particles find nothing
+    hits.clear();
+    grid.query(hits, AABB(vec3<Scalar>(100, 100, 0), vec3<Scalar>(101, 101, 0.1)));
+    UP_ASSERT_EQUAL(hits.size(), 0);
+    }
+
+UP_TEST(bigger)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 6));
+
+    // build a test AABB grid with many cells
+    std::vector<vec3<Scalar>> points(N);
+    AABB aabbs[N];
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(20);
+        aabbs[i] = AABB(points[i], Scalar(0.5));
+        }
+
+    AABBGrid grid;
+    grid.buildGrid(aabbs, N, Scalar(1.0));
+
+    // query each particle to ensure it can be found
+    std::vector<unsigned int> hits;
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        grid.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        }
+
+    // now move all the points with the update method (some out of the original grid range) and
+    // ensure that they are still found
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng))
+                     * Scalar(2);
+        aabbs[i] = AABB(points[i], Scalar(0.5));
+        grid.update(i, aabbs[i]);
+        }
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        grid.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+
+        // every overlapping particle is in the candidate list
+        hits.clear();
+        grid.query(hits, aabbs[i]);
+        for (unsigned int j = 0; j < N; j++)
+            {
+            if (aabbs[i].overlaps(aabbs[j]))
+                UP_ASSERT(in(j, hits));
+            }
+        }
+    }
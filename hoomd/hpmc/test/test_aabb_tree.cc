@@ -105,3 +105,47 @@ UP_TEST(bigger)
         UP_ASSERT(in(i, hits));
         }
     }
+
+UP_TEST(refit)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 6));
+
+    std::vector<vec3<Scalar>> points(N);
+    AABB aabbs[N];
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(1000);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+
+    AABBTree tree;
+    tree.buildTree(aabbs, N);
+    Scalar build_cost = tree.getCost();
+    UP_ASSERT(build_cost > Scalar(0.0));
+
+    // refitting with a different number of aabbs is rejected
+    UP_ASSERT(!tree.refit(aabbs, N - 1));
+
+    // move all the points without updating the tree, then refit it in one pass
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng))
+                     * Scalar(10);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+    UP_ASSERT(tree.refit(aabbs, N));
+
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        tree.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        }
+    }
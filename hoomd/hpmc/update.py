@@ -393,6 +393,9 @@ class MuVT(Updater):
           ensemble)
         move_ratio (float): (if set) Set the ratio between volume and
           exchange/transfer moves (applies to Gibbs ensemble)
+        cavity_width (float): Nominal width of the cells of the cavity grid
+          :math:`[\mathrm{length}]`. Set to 0 to insert particles uniformly in
+          the box.
 
     The muVT (or grand-canonical) ensemble simulates a system at constant
     fugacity.
@@ -403,6 +406,21 @@ class MuVT(Updater):
     ``ranks_per_partition`` argument of `hoomd.communicator.Communicator` to
     enable partitioned simulations.
 
+    .. rubric:: Cavity biased insertion
+
+    When `cavity_width` is non-zero, `MuVT` divides the box into a grid of
+    cells with approximately that width before each insertion or removal. A
+    cell is blocked when it lies entirely within the sum of the insphere radii
+    of the inserted particle and one existing particle, where any insertion
+    overlaps. Insertions sample positions uniformly in the remaining free cells
+    and the acceptance criteria use the free volume in place of the box volume,
+    which preserves detailed balance. This avoids most of the insertion attempts
+    that overlap immediately in dense systems. Choose a width smaller than the
+    insphere radius of the particles. Shapes that do not define an insphere
+    (all except `hoomd.hpmc.integrate.Sphere` and
+    `hoomd.hpmc.integrate.Ellipsoid`) block no cells. Cavity biased insertion
+    does not support domain decomposition.
+
     .. rubric:: Mixed precision
 
     `MuVT` uses reduced precision floating point arithmetic when checking
@@ -429,6 +447,8 @@ class MuVT(Updater):
           (applies to Gibbs ensemble)
         transfer_types (list): List of type names that are being transferred
           from/to the reservoir or between boxes
+        cavity_width (float): Nominal width of the cells of the cavity grid
+          :math:`[\mathrm{length}]`.
     """
 
     __doc__ = __doc__.replace("{inherited}", Updater._doc_inherited)
@@ -440,6 +460,7 @@ class MuVT(Updater):
         max_volume_rescale=0.1,
         volume_move_probability=0.5,
         trigger=1,
+        cavity_width=0.0,
     ):
         super().__init__(trigger)
 
@@ -449,8 +470,12 @@ class MuVT(Updater):
             transfer_types=list(transfer_types),
             max_volume_rescale=float(max_volume_rescale),
             volume_move_probability=float(volume_move_probability),
+            cavity_width=hoomd.data.typeconverter.OnlyTypes(
+                float, preprocess=hoomd.data.typeconverter.nonnegative_real
+            ),
         )
         self._param_dict.update(param_dict)
+        self.cavity_width = cavity_width
 
         typeparam_fugacity = TypeParameter(
             "fugacity",
@@ -468,7 +493,7 @@ class MuVT(Updater):
 
         cpp_cls_name = "UpdaterMuVT"
         cpp_cls_name += integrator.__class__.__name__
-        cpp_cls = getattr(_hpmc, cpp_cls_name)
+        cpp_cls = getattr(integrator._ext_module, cpp_cls_name)
 
         self._cpp_obj = cpp_cls(
             self._simulation.state._cpp_sys_def,
@@ -649,7 +674,7 @@ class Shape(Updater):
 
         # check for supported shapes is done in the shape move classes
         integrator_name = integrator.__class__.__name__
-        updater_cls = getattr(_hpmc, "UpdaterShape" + integrator_name)
+        updater_cls = getattr(integrator._ext_module, "UpdaterShape" + integrator_name)
 
         self.shape_move._attach(self._simulation)
         self._cpp_obj = updater_cls(
@@ -743,14 +768,12 @@ class GCA(Updater):
 
         cpp_cls_name = "UpdaterGCA"
         cpp_cls_name += integrator.__class__.__name__
-        cpp_cls = getattr(_hpmc, cpp_cls_name)
-        use_gpu = (
-            isinstance(self._simulation.device, hoomd.device.GPU)
-            and (cpp_cls_name + "GPU") in _hpmc.__dict__
+        use_gpu = isinstance(self._simulation.device, hoomd.device.GPU) and hasattr(
+            integrator._ext_module, cpp_cls_name + "GPU"
         )
         if use_gpu:
             cpp_cls_name += "GPU"
-        cpp_cls = getattr(_hpmc, cpp_cls_name)
+        cpp_cls = getattr(integrator._ext_module, cpp_cls_name)
 
         if not integrator._attached:
             raise RuntimeError("Integrator is not attached yet.")
@@ -799,6 +822,9 @@ class QuickCompress(Updater):
         allow_unsafe_resize (bool): When `True`, box moves are proposed
             independent of particle translational move sizes.
 
+        use_contact_gap (bool): When `True`, compress further when the closest
+            neighboring particles are far apart.
+
     Use `QuickCompress` in conjunction with an HPMC integrator to scale the
     system to a target box size. `QuickCompress` can typically compress dilute
     systems to near random close packing densities in tens of thousands of time
@@ -898,6 +924,20 @@ class QuickCompress(Updater):
     box move sizes will be uniformly distributed between ``min_scale`` and 1.0
     (with no consideration of ``min_move_size``).
 
+    When `use_contact_gap` is `True`, `QuickCompress` also measures the
+    smallest center to center distance between neighboring particles relative
+    to the sum of their circumsphere radii, :math:`g`, while it counts the
+    overlaps in the current state. When :math:`g > 1`, it sets
+    :math:`s` to ``max(min_scale, 1 / g)`` if that compresses more than the
+    random choice. The circumspheres of the closest neighbors remain apart in
+    the new box, so dilute systems compress quickly without waiting for trial
+    moves to relax overlaps. Combine `use_contact_gap` with a smaller
+    `min_scale` to take larger steps while the system is dilute. Once
+    neighboring circumspheres touch, :math:`s` is chosen as above. Only
+    neighbors with overlapping bounding boxes contribute to :math:`g`, so the
+    box move is still rejected when there are too many overlaps and the next
+    box move then uses the random choice.
+
     When using a `BoxVariant` for `target_box`, `complete` returns `True` if the
     current simulation box is equal to the box corresponding to `target_box`
     evaluated at the current timestep and there are no overlaps in the system.
@@ -957,6 +997,9 @@ class QuickCompress(Updater):
 
         allow_unsafe_resize (bool): When `True`, box moves are proposed
             independent of particle translational move sizes.
+
+        use_contact_gap (bool): When `True`, compress further when the closest
+            neighboring particles are far apart.
     """
 
     __doc__ = __doc__.replace("{inherited}", Updater._doc_inherited)
@@ -968,6 +1011,7 @@ class QuickCompress(Updater):
         max_overlaps_per_particle=0.25,
         min_scale=0.99,
         allow_unsafe_resize=False,
+        use_contact_gap=False,
     ):
         super().__init__(trigger)
 
@@ -977,6 +1021,7 @@ class QuickCompress(Updater):
             target_box=hoomd.variant.box.BoxVariant,
             instance=int,
             allow_unsafe_resize=bool,
+            use_contact_gap=bool,
         )
         if isinstance(target_box, hoomd.Box):
             target_box = hoomd.variant.box.Constant(target_box)
@@ -984,6 +1029,7 @@ class QuickCompress(Updater):
         param_dict["min_scale"] = min_scale
         param_dict["target_box"] = target_box
         param_dict["allow_unsafe_resize"] = allow_unsafe_resize
+        param_dict["use_contact_gap"] = use_contact_gap
 
         self._param_dict.update(param_dict)
 
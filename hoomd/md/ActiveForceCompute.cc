@@ -15,6 +15,55 @@ namespace md
     \brief Contains code for the ActiveForceCompute class
 */
 
+namespace
+    {
+/*! Rotate the orientation of an active particle by a random rotational diffusion step. The
+    orientation of any torque vector relative to the force vector is preserved.
+
+    \param quati Orientation of the particle
+    \param f_act Active force unit vector and magnitude of the particle type
+    \param is_2d Set when the simulation is 2D
+    \param rotation_constant Standard deviation of the rotation angle
+    \param rng Random number generator of the particle
+*/
+quat<Scalar> diffuseOrientation(quat<Scalar> quati,
+                                const Scalar4& f_act,
+                                bool is_2d,
+                                Scalar rotation_constant,
+                                hoomd::RandomGenerator& rng)
+    {
+    if (is_2d) // 2D
+        {
+        Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotation_constant)(rng);
+
+        vec3<Scalar> b(0, 0, 1.0);
+        quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(b, delta_theta);
+
+        quati = rot_quat * quati; // rotational diffusion quaternion applied to orientation
+        // In 2D, the only meaningful torque vector is out of plane and should not change
+        }
+    else // 3D: Following Stenhammar, Soft Matter, 2014
+        {
+        hoomd::SpherePointGenerator<Scalar> unit_vec;
+        vec3<Scalar> rand_vec;
+        unit_vec(rng, rand_vec);
+
+        vec3<Scalar> f(f_act.x, f_act.y, f_act.z);
+        vec3<Scalar> fi = rotate(quati, f); // rotate active force vector from local to global frame
+
+        vec3<Scalar> aux_vec = cross(fi, rand_vec); // rotation axis
+        Scalar aux_vec_mag = slow::rsqrt(dot(aux_vec, aux_vec));
+        aux_vec *= aux_vec_mag;
+
+        Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotation_constant)(rng);
+        quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(aux_vec, delta_theta);
+
+        quati = rot_quat * quati; // rotational diffusion quaternion applied to orientation
+        }
+    return quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
+    }
+    } // end anonymous namespace
+
 /*! \param rotation_diff rotational diffusion constant for all particles.
  */
 ActiveForceCompute::ActiveForceCompute(std::shared_ptr<SystemDefinition> sysdef,
@@ -232,6 +281,7 @@ void ActiveForceCompute::rotationalDiffusion(Scalar rotational_diffusion, uint64
     assert(h_orientation.data != NULL);
     assert(h_tag.data != NULL);
 
+    const bool is_2d = m_sysdef->getNDimensions() == 2;
     const auto rotation_constant = slow::sqrt(2.0 * rotational_diffusion * m_deltaT);
     for (unsigned int i = 0; i < num_members; i++)
         {
@@ -247,43 +297,66 @@ void ActiveForceCompute::rotationalDiffusion(Scalar rotational_diffusion, uint64
                                        hoomd::Counter(ptag));
 
             quat<Scalar> quati(h_orientation.data[idx]);
+            quati = diffuseOrientation(quati, h_f_actVec.data[type], is_2d, rotation_constant, rng);
+            h_orientation.data[idx] = quat_to_scalar4(quati);
+            }
+        }
+    }
+
+/*! This function applies rotational diffusion to the orientations of all active particles and then
+    sets their forces in the same pass over the group. It draws the same random numbers as
+    rotationalDiffusion(), so the result matches rotationalDiffusion() followed by setForces().
+    \param rotational_diffusion Rotational diffusion constant
+    \param timestep Time step that seeds the random numbers
+*/
+void ActiveForceCompute::setForcesWithRotationalDiffusion(Scalar rotational_diffusion,
+                                                          uint64_t timestep)
+    {
+    // getNumMembers might allocate the tag array handle. Access it first, then aquire the handles.
+    const unsigned int num_members = m_group->getNumMembers();
 
-            if (m_sysdef->getNDimensions() == 2) // 2D
-                {
-                Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotation_constant)(rng);
-
-                vec3<Scalar> b(0, 0, 1.0);
-                quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(b, delta_theta);
-
-                quati = rot_quat * quati; // rotational diffusion quaternion applied to orientation
-                quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
-                h_orientation.data[idx] = quat_to_scalar4(quati);
-                // In 2D, the only meaningful torque vector is out of plane and should not change
-                }
-            else // 3D: Following Stenhammar, Soft Matter, 2014
-                {
-                hoomd::SpherePointGenerator<Scalar> unit_vec;
-                vec3<Scalar> rand_vec;
-                unit_vec(rng, rand_vec);
-
-                vec3<Scalar> f(h_f_actVec.data[type].x,
-                               h_f_actVec.data[type].y,
-                               h_f_actVec.data[type].z);
-                vec3<Scalar> fi
-                    = rotate(quati, f); // rotate active force vector from local to global frame
-
-                vec3<Scalar> aux_vec = cross(fi, rand_vec); // rotation axis
-                Scalar aux_vec_mag = slow::rsqrt(dot(aux_vec, aux_vec));
-                aux_vec *= aux_vec_mag;
-
-                Scalar delta_theta = hoomd::NormalDistribution<Scalar>(rotation_constant)(rng);
-                quat<Scalar> rot_quat = quat<Scalar>::fromAxisAngle(aux_vec, delta_theta);
-
-                quati = rot_quat * quati; // rotational diffusion quaternion applied to orientation
-                quati = quati * (Scalar(1.0) / slow::sqrt(norm2(quati)));
-                h_orientation.data[idx] = quat_to_scalar4(quati);
-                }
+    //  array handles
+    ArrayHandle<Scalar4> h_f_actVec(m_f_activeVec, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_t_actVec(m_t_activeVec, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_torque(m_torque, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    // zero forces so we don't leave any forces set for indices that are no longer part of our group
+    memset(h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset(h_torque.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+
+    const bool is_2d = m_sysdef->getNDimensions() == 2;
+    const auto rotation_constant = slow::sqrt(2.0 * rotational_diffusion * m_deltaT);
+    for (unsigned int i = 0; i < num_members; i++)
+        {
+        unsigned int idx = m_group->getMemberIndex(i);
+        unsigned int type = __scalar_as_int(h_pos.data[idx].w);
+
+        quat<Scalar> quati(h_orientation.data[idx]);
+        if (h_f_actVec.data[type].w != 0)
+            {
+            hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::ActiveForceCompute,
+                                                   timestep,
+                                                   m_sysdef->getSeed()),
+                                       hoomd::Counter(h_tag.data[idx]));
+            quati = diffuseOrientation(quati, h_f_actVec.data[type], is_2d, rotation_constant, rng);
+            h_orientation.data[idx] = quat_to_scalar4(quati);
             }
+
+        vec3<Scalar> f(h_f_actVec.data[type].w * h_f_actVec.data[type].x,
+                       h_f_actVec.data[type].w * h_f_actVec.data[type].y,
+                       h_f_actVec.data[type].w * h_f_actVec.data[type].z);
+        h_force.data[idx] = vec_to_scalar4(rotate(quati, f), 0);
+
+        vec3<Scalar> t(h_t_actVec.data[type].w * h_t_actVec.data[type].x,
+                       h_t_actVec.data[type].w * h_t_actVec.data[type].y,
+                       h_t_actVec.data[type].w * h_t_actVec.data[type].z);
+        h_torque.data[idx] = vec_to_scalar4(rotate(quati, t), 0);
         }
     }
 
@@ -292,7 +365,17 @@ void ActiveForceCompute::rotationalDiffusion(Scalar rotational_diffusion, uint64
 */
 void ActiveForceCompute::computeForces(uint64_t timestep)
     {
-    setForces(); // set forces for particles
+    if (m_rotational_diffusion_pending)
+        {
+        // ActiveRotationalDiffusionUpdater deferred its diffusion to this pass
+        m_rotational_diffusion_pending = false;
+        setForcesWithRotationalDiffusion(m_pending_rotational_diffusion,
+                                         m_pending_rotational_diffusion_timestep);
+        }
+    else
+        {
+        setForces(); // set forces for particles
+        }
 
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -75,6 +75,9 @@ class PYBIND11_EXPORT ActiveForceCompute : public ForceCompute
     //! Orientational diffusion for spherical particles
     virtual void rotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
 
+    //! Apply orientational diffusion and set forces in one pass over the group
+    virtual void setForcesWithRotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
+
     std::shared_ptr<ParticleGroup> m_group; //!< Group of particles on which this force is applied
     GPUVector<Scalar4>
         m_f_activeVec; //! active force unit vectors and magnitudes for each particle type
@@ -82,10 +85,27 @@ class PYBIND11_EXPORT ActiveForceCompute : public ForceCompute
     GPUVector<Scalar4>
         m_t_activeVec; //! active torque unit vectors and magnitudes for each particle type
 
+    /// Set when the next force computation applies rotational diffusion
+    bool m_rotational_diffusion_pending = false;
+
+    /// Rotational diffusion to apply in the next force computation
+    Scalar m_pending_rotational_diffusion = 0;
+
+    /// Time step that seeds the pending rotational diffusion
+    uint64_t m_pending_rotational_diffusion_timestep = 0;
+
     private:
+    //! Apply orientational diffusion in the next force computation
+    void fuseRotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep)
+        {
+        m_rotational_diffusion_pending = true;
+        m_pending_rotational_diffusion = rotational_diffusion;
+        m_pending_rotational_diffusion_timestep = timestep;
+        }
+
     // Allow ActiveRotationalDiffusionUpdater to access internal methods and members of
     // ActiveForceCompute classes/subclasses. This is necessary to allow
-    // ActiveRotationalDiffusionUpdater to call rotationalDiffusion.
+    // ActiveRotationalDiffusionUpdater to call rotationalDiffusion and fuseRotationalDiffusion.
     friend class ActiveRotationalDiffusionUpdater;
     };
 
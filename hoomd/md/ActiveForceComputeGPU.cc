@@ -43,7 +43,10 @@ ActiveForceComputeGPU::ActiveForceComputeGPU(std::shared_ptr<SystemDefinition> s
     m_tuner_diffusion.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                              this->m_exec_conf,
                                              "active_diffusion"));
-    m_autotuners.insert(m_autotuners.end(), {m_tuner_force, m_tuner_diffusion});
+    m_tuner_fused.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         this->m_exec_conf,
+                                         "active_force_diffusion"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_force, m_tuner_diffusion, m_tuner_fused});
 
     // unsigned int N = m_pdata->getNGlobal();
     // unsigned int group_size = m_group->getNumMembersGlobal();
@@ -166,6 +169,64 @@ void ActiveForceComputeGPU::rotationalDiffusion(Scalar rotational_diffusion, uin
     m_tuner_diffusion->end();
     }
 
+/*! \param rotational_diffusion Rotational diffusion constant
+    \param timestep Timestep that seeds the random numbers of the diffusion
+
+    Launch one kernel that diffuses the orientations and sets the forces and torques from them.
+*/
+void ActiveForceComputeGPU::setForcesWithRotationalDiffusion(Scalar rotational_diffusion,
+                                                             uint64_t timestep)
+    {
+    //  array handles
+    ArrayHandle<Scalar4> d_f_actVec(m_f_activeVec, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
+
+    ArrayHandle<Scalar4> d_t_actVec(m_t_activeVec, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_torque(m_torque, access_location::device, access_mode::overwrite);
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_tag(m_pdata->getTags(), access_location::device, access_mode::read);
+
+    assert(d_force.data != NULL);
+    assert(d_pos.data != NULL);
+    assert(d_orientation.data != NULL);
+
+    bool is2D = (m_sysdef->getNDimensions() == 2);
+    unsigned int group_size = m_group->getNumMembers();
+    unsigned int N = m_pdata->getN();
+
+    const auto rotation_constant = slow::sqrt(2.0 * rotational_diffusion * m_deltaT);
+
+    m_tuner_fused->begin();
+
+    kernel::gpu_compute_active_force_set_forces_diffusion(group_size,
+                                                          d_tag.data,
+                                                          d_index_array.data,
+                                                          d_force.data,
+                                                          d_torque.data,
+                                                          d_pos.data,
+                                                          d_orientation.data,
+                                                          d_f_actVec.data,
+                                                          d_t_actVec.data,
+                                                          N,
+                                                          is2D,
+                                                          rotation_constant,
+                                                          timestep,
+                                                          m_sysdef->getSeed(),
+                                                          m_tuner_fused->getParam()[0]);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    m_tuner_fused->end();
+    }
+
 namespace detail
     {
 void export_ActiveForceComputeGPU(pybind11::module& m)
@@ -42,6 +42,22 @@ hipError_t gpu_compute_active_force_rotational_diffusion(const unsigned int grou
                                                          const uint16_t seed,
                                                          unsigned int block_size);
 
+hipError_t gpu_compute_active_force_set_forces_diffusion(const unsigned int group_size,
+                                                         const unsigned int* d_tag,
+                                                         unsigned int* d_index_array,
+                                                         Scalar4* d_force,
+                                                         Scalar4* d_torque,
+                                                         const Scalar4* d_pos,
+                                                         Scalar4* d_orientation,
+                                                         const Scalar4* d_f_act,
+                                                         const Scalar4* d_t_act,
+                                                         const unsigned int N,
+                                                         bool is2D,
+                                                         const Scalar rotationDiff,
+                                                         const uint64_t timestep,
+                                                         const uint16_t seed,
+                                                         unsigned int block_size);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -34,12 +34,16 @@ class PYBIND11_EXPORT ActiveForceComputeGPU : public ActiveForceCompute
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner_force;     //!< Autotuner for block size (force kernel)
     std::shared_ptr<Autotuner<1>> m_tuner_diffusion; //!< Autotuner for block size (diff kernel)
+    std::shared_ptr<Autotuner<1>> m_tuner_fused;     //!< Autotuner for block size (fused kernel)
 
     //! Set forces for particles
     virtual void setForces();
 
     //! Orientational diffusion for spherical particles
     virtual void rotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
+
+    //! Apply rotational diffusion and set forces for particles in one kernel
+    virtual void setForcesWithRotationalDiffusion(Scalar rotational_diffusion, uint64_t timestep);
     };
 
     } // end namespace md
@@ -205,6 +205,14 @@ void ActiveForceConstraintCompute<Manifold>::computeForces(uint64_t timestep)
         m_box_changed = false;
         }
 
+    if (m_rotational_diffusion_pending)
+        {
+        // diffusion on the manifold needs the constraint, so it remains a separate pass
+        m_rotational_diffusion_pending = false;
+        rotationalDiffusion(m_pending_rotational_diffusion,
+                            m_pending_rotational_diffusion_timestep);
+        }
+
     setConstraint(); // apply manifold constraints to active particles active force vectors
 
     setForces(); // set forces for particles
@@ -41,10 +41,22 @@ ActiveRotationalDiffusionUpdater::~ActiveRotationalDiffusionUpdater()
 
 /** Perform the needed calculations to update particle orientations
     \param timestep Current time step of the simulation
+
+    When fused, the active force applies the diffusion with the random numbers of this timestep
+    while it sets the forces in its next computation, which saves one pass over the particles.
 */
 void ActiveRotationalDiffusionUpdater::update(uint64_t timestep)
     {
-    m_active_force->rotationalDiffusion(m_rotational_diffusion->operator()(timestep), timestep);
+    if (m_fuse_with_force)
+        {
+        m_active_force->fuseRotationalDiffusion(m_rotational_diffusion->operator()(timestep),
+                                                timestep);
+        }
+    else
+        {
+        m_active_force->rotationalDiffusion(m_rotational_diffusion->operator()(timestep),
+                                            timestep);
+        }
     }
 
 namespace detail
@@ -62,7 +74,10 @@ void export_ActiveRotationalDiffusionUpdater(pybind11::module& m)
                             std::shared_ptr<ActiveForceCompute>>())
         .def_property("rotational_diffusion",
                       &ActiveRotationalDiffusionUpdater::getRotationalDiffusion,
-                      &ActiveRotationalDiffusionUpdater::setRotationalDiffusion);
+                      &ActiveRotationalDiffusionUpdater::setRotationalDiffusion)
+        .def_property("fuse_with_force",
+                      &ActiveRotationalDiffusionUpdater::getFuseWithForce,
+                      &ActiveRotationalDiffusionUpdater::setFuseWithForce);
     }
 
     } // end namespace detail
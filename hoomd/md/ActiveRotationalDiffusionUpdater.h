@@ -57,6 +57,18 @@ class PYBIND11_EXPORT ActiveRotationalDiffusionUpdater : public Updater
         m_rotational_diffusion = new_diffusion;
         }
 
+    /// Get whether the diffusion is deferred to the next active force computation
+    bool getFuseWithForce() const
+        {
+        return m_fuse_with_force;
+        }
+
+    /// Set whether the diffusion is deferred to the next active force computation
+    void setFuseWithForce(bool fuse_with_force)
+        {
+        m_fuse_with_force = fuse_with_force;
+        }
+
     /// Update box interpolation based on provided timestep
     virtual void update(uint64_t timestep);
 
@@ -64,7 +76,8 @@ class PYBIND11_EXPORT ActiveRotationalDiffusionUpdater : public Updater
     std::shared_ptr<Variant>
         m_rotational_diffusion; //!< Variant that determines the current rotational diffusion
     std::shared_ptr<ActiveForceCompute>
-        m_active_force; //!< Active force to call rotationalDiffusion on
+        m_active_force;             //!< Active force to call rotationalDiffusion on
+    bool m_fuse_with_force = false; //!< Apply the diffusion in the active force kernel
     };
 
     } // end namespace md
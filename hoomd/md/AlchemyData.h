@@ -86,6 +86,13 @@ struct AlchemicalMDParticle : AlchemicalParticle
         m_timestep_net_force.second = netForce;
         }
 
+    //! Set the net force from the sum of the per particle forces (computed on the GPU)
+    void setNetForce(uint64_t timestep, Scalar sum)
+        {
+        m_timestep_net_force.first = timestep;
+        m_timestep_net_force.second = sum / Scalar(m_alchemical_derivatives.getNumElements());
+        }
+
     Scalar getNetForce(uint64_t timestep)
         {
         assert(m_timestep_net_force.first == timestep);
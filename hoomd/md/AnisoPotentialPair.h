@@ -234,8 +234,14 @@ template<class aniso_evaluator> class AnisoPotentialPair : public ForceCompute
     /// r_cut (not squared) given to the neighbor list
     std::shared_ptr<GPUArray<Scalar>> m_r_cut_nlist;
 
+    /// Body to space frame rotation matrix of each local and ghost particle
+    GPUArray<rotmat3<Scalar>> m_rotation_matrices;
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
+
+    //! Grow the rotation matrix array to hold all local and ghost particles
+    void resizeRotationMatrices();
     };
 
 /*! \param sysdef System to compute forces on
@@ -282,6 +288,19 @@ template<class aniso_evaluator> AnisoPotentialPair<aniso_evaluator>::~AnisoPoten
         }
     }
 
+/*! The evaluators that need the orientation as a matrix read it from m_rotation_matrices so that
+    the conversion from the quaternion is done once per particle instead of once per pair.
+*/
+template<class aniso_evaluator> void AnisoPotentialPair<aniso_evaluator>::resizeRotationMatrices()
+    {
+    size_t n_particles = m_pdata->getN() + m_pdata->getNGhosts();
+    if (m_rotation_matrices.getNumElements() < n_particles)
+        {
+        GPUArray<rotmat3<Scalar>> rotation_matrices(n_particles, m_exec_conf);
+        m_rotation_matrices.swap(rotation_matrices);
+        }
+    }
+
 /*! \param typ1 First type index in the pair
     \param typ2 Second type index in the pair
     \param param Parameter to set
@@ -435,7 +454,7 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
     bool third_law = m_nlist->getStorageMode() == NeighborList::half;
 
     // access the neighbor list, particle data, and system box
-    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
                                         access_location::host,
                                         access_mode::read);
     ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
@@ -459,6 +478,20 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
 
     const BoxDim box = m_pdata->getBox();
     ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+
+    // convert each orientation to a rotation matrix once for all of the particle's pairs
+    if (aniso_evaluator::needsRotationMatrices())
+        {
+        resizeRotationMatrices();
+        ArrayHandle<rotmat3<Scalar>> h_rotation_matrices(m_rotation_matrices,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+        for (unsigned int i = 0; i < m_pdata->getN() + m_pdata->getNGhosts(); i++)
+            h_rotation_matrices.data[i] = rotmat3<Scalar>(quat<Scalar>(h_orientation.data[i]));
+        }
+    ArrayHandle<rotmat3<Scalar>> h_rotation_matrices(m_rotation_matrices,
+                                                     access_location::host,
+                                                     access_mode::read);
         {
         // need to start from a zero force, energy and virial
         memset(&h_force.data[0], 0, sizeof(Scalar4) * m_pdata->getN());
@@ -551,6 +584,9 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
                     eval.setShape(&m_shape_params[typei], &m_shape_params[typej]);
                 if (aniso_evaluator::needsTags())
                     eval.setTags(h_tag.data[i], h_tag.data[j]);
+                if (aniso_evaluator::needsRotationMatrices())
+                    eval.setRotationMatrices(&h_rotation_matrices.data[i],
+                                             &h_rotation_matrices.data[j]);
 
                 bool evaluated = eval.evaluate(force, pair_eng, energy_shift, torque_i, torque_j);
 
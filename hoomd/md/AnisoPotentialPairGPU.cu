@@ -0,0 +1,69 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "AnisoPotentialPairGPU.cuh"
+
+/*! \file AnisoPotentialPairGPU.cu
+    \brief Defines GPU kernel code for the per particle data shared by the anisotropic pair
+   potentials.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel that converts each particle orientation to a rotation matrix
+/*! \param d_rotation_matrices Output rotation matrix (body to space frame) of each particle
+    \param d_orientation Particle orientations
+    \param N Number of particles (local and ghost)
+*/
+__global__ void gpu_compute_rotation_matrices_kernel(rotmat3<Scalar>* d_rotation_matrices,
+                                                     const Scalar4* d_orientation,
+                                                     const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    d_rotation_matrices[idx] = rotmat3<Scalar>(quat<Scalar>(d_orientation[idx]));
+    }
+
+/*! \param d_rotation_matrices Output rotation matrix (body to space frame) of each particle
+    \param d_orientation Particle orientations
+    \param N Number of particles (local and ghost)
+    \param block_size Block size to execute
+*/
+hipError_t gpu_compute_rotation_matrices(rotmat3<Scalar>* d_rotation_matrices,
+                                         const Scalar4* d_orientation,
+                                         const unsigned int N,
+                                         const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_compute_rotation_matrices_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_rotation_matrices_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_rotation_matrices,
+                       d_orientation,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
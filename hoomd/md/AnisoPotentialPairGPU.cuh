@@ -9,6 +9,9 @@
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
 #include "hoomd/TextureTools.h"
+#include "hoomd/VectorMath.h"
+
+#include "PotentialPairGPU.cuh"
 
 #ifdef __HIPCC__
 #include "hoomd/WarpTools.cuh"
@@ -49,6 +52,7 @@ struct a_pair_args_t
                   const Scalar4* _d_pos,
                   const Scalar* _d_charge,
                   const Scalar4* _d_orientation,
+                  const rotmat3<Scalar>* _d_rotation_matrices,
                   const unsigned int* _d_tag,
                   const BoxDim& _box,
                   const unsigned int* _d_n_neigh,
@@ -61,14 +65,15 @@ struct a_pair_args_t
                   const unsigned int _compute_virial,
                   const unsigned int _threads_per_particle,
                   const hipDeviceProp_t& _devprop,
-                  bool _update_shape_param)
+                  bool _update_shape_param,
+                  const bool _half = false)
         : d_force(_d_force), d_torque(_d_torque), d_virial(_d_virial), virial_pitch(_virial_pitch),
           N(_N), n_max(_n_max), d_pos(_d_pos), d_charge(_d_charge), d_orientation(_d_orientation),
-          d_tag(_d_tag), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
-          d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), ntypes(_ntypes), block_size(_block_size),
-          shift_mode(_shift_mode), compute_virial(_compute_virial),
-          threads_per_particle(_threads_per_particle), devprop(_devprop),
-          update_shape_param(_update_shape_param) { };
+          d_rotation_matrices(_d_rotation_matrices), d_tag(_d_tag), box(_box),
+          d_n_neigh(_d_n_neigh), d_nlist(_d_nlist), d_head_list(_d_head_list), d_rcutsq(_d_rcutsq),
+          ntypes(_ntypes), block_size(_block_size), shift_mode(_shift_mode),
+          compute_virial(_compute_virial), threads_per_particle(_threads_per_particle),
+          devprop(_devprop), update_shape_param(_update_shape_param), half(_half) { };
 
     Scalar4* d_force;             //!< Force to write out
     Scalar4* d_torque;            //!< Torque to write out
@@ -79,6 +84,7 @@ struct a_pair_args_t
     const Scalar4* d_pos;         //!< particle positions
     const Scalar* d_charge;       //!< particle charges
     const Scalar4* d_orientation; //!< particle orientation to compute forces over
+    const rotmat3<Scalar>* d_rotation_matrices; //!< particle orientations as rotation matrices
     const unsigned int* d_tag;    //!< particle tags to compute forces over
     const BoxDim box;             //!< Simulation box in GPU format
     const unsigned int*
@@ -94,6 +100,7 @@ struct a_pair_args_t
     const hipDeviceProp_t& devprop;          //!< CUDA device properties
     bool update_shape_param; //!< If true, update size of shape param and synchronize GPU execution
                              //!< stream
+    const bool half;         //!< Evaluate each local pair once
     };
 
 #ifdef __HIPCC__
@@ -110,6 +117,7 @@ struct a_pair_args_t
     \param d_pos particle positions
     \param d_charge particle charges
     \param d_orientation Quaternion data on the GPU to calculate forces on
+    \param d_rotation_matrices Rotation matrix of each orientation (when the evaluator needs them)
     \param d_tag Tag data on the GPU to calculate forces on
     \param box Box dimensions used to implement periodic boundary conditions
     \param d_n_neigh Device memory array listing the number of neighbors for each particle
@@ -118,6 +126,8 @@ struct a_pair_args_t
     \param d_params Parameters for the potential, stored per type pair
     \param d_rcutsq rcut squared, stored per type pair
     \param ntypes Number of types in the simulation
+    \param max_extra_bytes Maximum number of extra bytes of shared memory for the parameters
+    \param half When true, evaluate each local pair once and scatter the reaction with atomics
     \param tpp Number of threads per particle
 
     \a d_params and \a d_rcutsq must be indexed with an Index2DUpperTriangular(typei, typej) to
@@ -136,6 +146,9 @@ struct a_pair_args_t
     Each block will calculate the forces on a block of particles.
     Each thread will calculate the total force on one particle.
     The neighborlist is arranged in columns so that reads are fully coalesced when doing this.
+
+    \a half mode follows gpu_compute_pair_forces_shared_kernel() and also scatters the torque on
+    particle j.
 */
 template<class evaluator, unsigned int shift_mode, unsigned int compute_virial, int tpp>
 __global__ void
@@ -147,6 +160,7 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                                      const Scalar4* d_pos,
                                      const Scalar* d_charge,
                                      const Scalar4* d_orientation,
+                                     const rotmat3<Scalar>* d_rotation_matrices,
                                      const unsigned int* d_tag,
                                      const BoxDim box,
                                      const unsigned int* d_n_neigh,
@@ -156,7 +170,8 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                                      const typename evaluator::shape_type* d_shape_params,
                                      const Scalar* d_rcutsq,
                                      const unsigned int ntypes,
-                                     unsigned int max_extra_bytes)
+                                     unsigned int max_extra_bytes,
+                                     const bool half)
     {
     Index2D typpair_idx(ntypes);
     const unsigned int num_typ_parameters = typpair_idx.getNumElements();
@@ -241,6 +256,9 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
         Scalar4 postypei = __ldg(d_pos + idx);
         Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
         Scalar4 quati = __ldg(d_orientation + idx);
+        rotmat3<Scalar> roti;
+        if (evaluator::needsRotationMatrices())
+            roti = d_rotation_matrices[idx];
 
         Scalar qi = Scalar(0);
         if (evaluator::needsCharge())
@@ -264,10 +282,17 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                     next_j = __ldg(d_nlist + my_head + neigh_idx + tpp);
                     }
 
+                // in half mode, the particle with the lower index evaluates each local pair
+                if (half && cur_j < idx)
+                    continue;
+
                 // get the neighbor's position
                 Scalar4 postypej = __ldg(d_pos + cur_j);
                 Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
                 Scalar4 quatj = __ldg(d_orientation + cur_j);
+                rotmat3<Scalar> rotj;
+                if (evaluator::needsRotationMatrices())
+                    rotj = d_rotation_matrices[cur_j];
 
                 Scalar qj = Scalar(0);
                 if (evaluator::needsCharge())
@@ -309,6 +334,8 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                                   &(s_shape_params[__scalar_as_int(postypej.w)]));
                 if (evaluator::needsTags())
                     eval.setTags(__ldg(d_tag + idx), __ldg(d_tag + cur_j));
+                if (evaluator::needsRotationMatrices())
+                    eval.setRotationMatrices(&roti, &rotj);
 
                 // call evaluator
                 eval.evaluate(jforce, pair_eng, energy_shift, torquei, torquej);
@@ -317,12 +344,21 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                 if (compute_virial)
                     {
                     Scalar3 jforce2 = Scalar(0.5) * jforce;
-                    virialxx += dx.x * jforce2.x;
-                    virialxy += dx.y * jforce2.x;
-                    virialxz += dx.z * jforce2.x;
-                    virialyy += dx.y * jforce2.y;
-                    virialyz += dx.z * jforce2.y;
-                    virialzz += dx.z * jforce2.z;
+                    Scalar pair_virial[6] = {dx.x * jforce2.x,
+                                             dx.y * jforce2.x,
+                                             dx.z * jforce2.x,
+                                             dx.y * jforce2.y,
+                                             dx.z * jforce2.y,
+                                             dx.z * jforce2.z};
+                    virialxx += pair_virial[0];
+                    virialxy += pair_virial[1];
+                    virialxz += pair_virial[2];
+                    virialyy += pair_virial[3];
+                    virialyz += pair_virial[4];
+                    virialzz += pair_virial[5];
+
+                    if (half && cur_j < N)
+                        atomic_add_virial(d_virial + cur_j, virial_pitch, pair_virial);
                     }
 
                 // add up the force vector components
@@ -334,6 +370,16 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                 torque.z += torquei.z;
 
                 force.w += pair_eng;
+
+                // scatter the reaction to the local neighbor
+                if (half && cur_j < N)
+                    {
+                    atomic_add_force(
+                        d_force + cur_j,
+                        make_scalar4(-jforce.x, -jforce.y, -jforce.z, Scalar(0.5) * pair_eng));
+                    atomic_add_force(d_torque + cur_j,
+                                     make_scalar4(torquej.x, torquej.y, torquej.z, Scalar(0)));
+                    }
                 }
             }
 
@@ -353,7 +399,12 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
     torque.z = reducer.Sum(torque.z);
 
     // now that the force calculation is complete, write out the result
-    if (active && threadIdx.x % tpp == 0)
+    if (active && threadIdx.x % tpp == 0 && half)
+        {
+        atomic_add_force(d_force + idx, force);
+        atomic_add_force(d_torque + idx, torque);
+        }
+    else if (active && threadIdx.x % tpp == 0)
         {
         d_force[idx] = force;
         d_torque[idx] = torque;
@@ -369,7 +420,12 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
         virialzz = reducer.Sum(virialzz);
 
         // if we are the first thread in the cta, write out virial to global mem
-        if (active && threadIdx.x % tpp == 0)
+        if (active && threadIdx.x % tpp == 0 && half)
+            {
+            Scalar virial[6] = {virialxx, virialxy, virialxz, virialyy, virialyz, virialzz};
+            atomic_add_virial(d_virial + idx, virial_pitch, virial);
+            }
+        else if (active && threadIdx.x % tpp == 0)
             {
             d_virial[0 * virial_pitch + idx] = virialxx;
             d_virial[1 * virial_pitch + idx] = virialxy;
@@ -473,6 +529,7 @@ struct AnisoPairForceComputeKernel
                 pair_args.d_pos,
                 pair_args.d_charge,
                 pair_args.d_orientation,
+                pair_args.d_rotation_matrices,
                 pair_args.d_tag,
                 pair_args.box,
                 pair_args.d_n_neigh,
@@ -482,7 +539,8 @@ struct AnisoPairForceComputeKernel
                 shape_params,
                 pair_args.d_rcutsq,
                 pair_args.ntypes,
-                max_extra_bytes);
+                max_extra_bytes,
+                pair_args.half);
             }
         else
             {
@@ -523,6 +581,22 @@ hipError_t gpu_compute_pair_aniso_forces(const a_pair_args_t& pair_args,
     assert(pair_args.d_rcutsq);
     assert(pair_args.ntypes > 0);
 
+    // in half mode, the kernel accumulates into the force, torque, and virial arrays
+    if (pair_args.half)
+        {
+        hipMemsetAsync(pair_args.d_force, 0, sizeof(Scalar4) * pair_args.N);
+        hipMemsetAsync(pair_args.d_torque, 0, sizeof(Scalar4) * pair_args.N);
+        if (pair_args.compute_virial)
+            {
+            for (unsigned int i = 0; i < 6; i++)
+                {
+                hipMemsetAsync(pair_args.d_virial + i * pair_args.virial_pitch,
+                               0,
+                               sizeof(Scalar) * pair_args.N);
+                }
+            }
+        }
+
     // run the kernel
     if (pair_args.compute_virial)
         {
@@ -589,6 +663,12 @@ hipError_t gpu_compute_pair_aniso_forces(const a_pair_args_t& pair_args,
                                          const typename evaluator::shape_type* d_shape_params);
 #endif
 
+//! Kernel driver that converts each particle orientation to a rotation matrix
+hipError_t gpu_compute_rotation_matrices(rotmat3<Scalar>* d_rotation_matrices,
+                                         const Scalar4* d_orientation,
+                                         const unsigned int N,
+                                         const unsigned int block_size);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
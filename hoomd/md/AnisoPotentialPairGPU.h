@@ -49,7 +49,8 @@ template<class evaluator> class AnisoPotentialPairGPU : public AnisoPotentialPai
     virtual void setShape(unsigned int typ, const typename evaluator::shape_type& shape_param);
 
     protected:
-    std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
+    /// Autotuner for block size, threads per particle, and half mode (see PotentialPairGPU)
+    std::shared_ptr<Autotuner<3>> m_tuner;
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
@@ -71,11 +72,15 @@ AnisoPotentialPairGPU<evaluator>::AnisoPotentialPairGPU(std::shared_ptr<SystemDe
         throw std::runtime_error("Error initializing AnisoPotentialPairGPU");
         }
 
-    // Initialize autotuner that tunes block sizes and threads per particle.
-    m_tuner.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
-                                    AutotunerBase::getTppListPow2(this->m_exec_conf)},
+    // Initialize autotuner that tunes block sizes, threads per particle, and half mode.
+    m_tuner.reset(new Autotuner<3>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                                    AutotunerBase::getTppListPow2(this->m_exec_conf),
+                                    {0, 1}},
                                    this->m_exec_conf,
                                    "aniso_pair_" + evaluator::getName()));
+
+    // Coordinate descent avoids sampling every combination in the 3 dimensional parameter space.
+    m_tuner->setSearch(Autotuner<3>::search_coordinate_descent);
     this->m_autotuners.push_back(m_tuner);
 
 #ifdef ENABLE_MPI
@@ -100,7 +105,7 @@ template<class evaluator> void AnisoPotentialPairGPU<evaluator>::computeForces(u
         }
 
     // access the neighbor list
-    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(this->m_r_cut_nlist),
                                         access_location::device,
                                         access_mode::read);
     ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
@@ -137,9 +142,29 @@ template<class evaluator> void AnisoPotentialPairGPU<evaluator>::computeForces(u
 
     this->m_exec_conf->setDevice();
 
+    // convert each orientation to a rotation matrix once for all of the particle's pairs
+    if (evaluator::needsRotationMatrices())
+        {
+        this->resizeRotationMatrices();
+        ArrayHandle<rotmat3<Scalar>> d_rotation_matrices(this->m_rotation_matrices,
+                                                         access_location::device,
+                                                         access_mode::overwrite);
+        kernel::gpu_compute_rotation_matrices(d_rotation_matrices.data,
+                                              d_orientation.data,
+                                              this->m_pdata->getN() + this->m_pdata->getNGhosts(),
+                                              256);
+
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    ArrayHandle<rotmat3<Scalar>> d_rotation_matrices(this->m_rotation_matrices,
+                                                     access_location::device,
+                                                     access_mode::read);
+
     this->m_tuner->begin();
     unsigned int block_size = this->m_tuner->getParam()[0];
     unsigned int threads_per_particle = this->m_tuner->getParam()[1];
+    bool half = this->m_tuner->getParam()[2];
 
     // On the first iteration, shape parameters are updated. For optimization,
     // could track this between calls to avoid extra copying.
@@ -155,6 +180,7 @@ template<class evaluator> void AnisoPotentialPairGPU<evaluator>::computeForces(u
                               d_pos.data,
                               d_charge.data,
                               d_orientation.data,
+                              d_rotation_matrices.data,
                               d_tag.data,
                               box,
                               d_n_neigh.data,
@@ -167,7 +193,8 @@ template<class evaluator> void AnisoPotentialPairGPU<evaluator>::computeForces(u
                               flags[pdata_flag::pressure_tensor],
                               threads_per_particle,
                               this->m_exec_conf->dev_prop,
-                              first),
+                              first,
+                              half),
         this->m_params.data(),
         this->m_shape_params.data());
 
@@ -131,11 +131,16 @@ template<typename T> void CommunicatorGridGPU<T>::communicate(const GPUArray<T>&
         }
 
         {
-        // access send and recv buffers
-        ArrayHandle<T> send_buf_handle(this->m_send_buf, access_location::host, access_mode::read);
-        ArrayHandle<T> recv_buf_handle(this->m_recv_buf,
-                                       access_location::host,
-                                       access_mode::overwrite);
+        // access send and recv buffers, staged through host memory unless MPI is GPU-aware
+        const access_location::Enum location = this->m_exec_conf->isGPUAwareMPIEnabled()
+                                                   ? access_location::device
+                                                   : access_location::host;
+        ArrayHandle<T> send_buf_handle(this->m_send_buf, location, access_mode::read);
+        ArrayHandle<T> recv_buf_handle(this->m_recv_buf, location, access_mode::overwrite);
+
+        // the scatter kernel must complete before MPI reads the device buffer
+        if (this->m_exec_conf->isGPUAwareMPIEnabled())
+            hipDeviceSynchronize();
         typedef std::map<unsigned int, unsigned int>::iterator it_t;
         std::vector<MPI_Request> reqs(2 * this->m_neighbors.size());
 
@@ -0,0 +1,204 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeRDF.cc
+    \brief Contains code for the ComputeRDF class
+*/
+
+#include "ComputeRDF.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute the radial distribution function of
+    \param nlist Neighbor list that provides the pairs
+    \param r_max Largest distance in the histogram
+    \param bins Number of bins in the histogram
+*/
+ComputeRDF::ComputeRDF(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<NeighborList> nlist,
+                       Scalar r_max,
+                       unsigned int bins)
+    : Compute(sysdef), m_nlist(nlist), m_r_max(r_max), m_bins(bins)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ComputeRDF" << endl;
+
+    if (r_max <= Scalar(0.0))
+        {
+        throw std::domain_error("r_max must be positive");
+        }
+    if (bins == 0)
+        {
+        throw std::domain_error("bins must be positive");
+        }
+
+    GPUArray<unsigned int> histogram(m_bins, m_exec_conf);
+    m_histogram.swap(histogram);
+
+    // include all pairs within r_max in the neighbor list
+    unsigned int n_types = m_pdata->getNTypes();
+    m_r_cut_nlist = std::make_shared<GPUArray<Scalar>>(n_types * n_types, m_exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut_nlist(*m_r_cut_nlist,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        std::fill(h_r_cut_nlist.data, h_r_cut_nlist.data + n_types * n_types, m_r_max);
+        }
+    m_nlist->addRCutMatrix(m_r_cut_nlist);
+    }
+
+ComputeRDF::~ComputeRDF()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ComputeRDF" << endl;
+
+    if (m_attached)
+        {
+        m_nlist->removeRCutMatrix(m_r_cut_nlist);
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ComputeRDF::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (shouldCompute(timestep))
+        {
+        m_nlist->compute(timestep);
+        computeHistogram();
+        }
+    }
+
+void ComputeRDF::computeHistogram()
+    {
+    const bool half = m_nlist->getStorageMode() == NeighborList::half;
+    const unsigned int N = m_pdata->getN();
+    const BoxDim box = m_pdata->getGlobalBox();
+    const Scalar r_max_sq = m_r_max * m_r_max;
+    const Scalar inv_dr = Scalar(m_bins) / m_r_max;
+
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_histogram(m_histogram,
+                                          access_location::host,
+                                          access_mode::overwrite);
+
+    memset(h_histogram.data, 0, sizeof(unsigned int) * m_bins);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        const size_t head = h_head_list.data[i];
+        const unsigned int n_neigh = h_n_neigh.data[i];
+
+        for (unsigned int k = 0; k < n_neigh; k++)
+            {
+            unsigned int j = h_nlist.data[head + k];
+            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            Scalar3 dx = box.minImage(pi - pj);
+            Scalar rsq = dot(dx, dx);
+            if (rsq >= r_max_sq)
+                continue;
+
+            unsigned int bin = std::min((unsigned int)(slow::sqrt(rsq) * inv_dr), m_bins - 1);
+
+            // the other rank counts local-ghost pairs from the ghost's side
+            h_histogram.data[bin] += (half && j < N) ? 2 : 1;
+            }
+        }
+    }
+
+/*! \returns The radial distribution function g(r) at the bin centers on the root rank, None on
+    other ranks
+
+    g(r) is the number of pairs in each bin divided by N^2 / V times the volume of the spherical
+    shell (or ring in 2D) spanned by the bin.
+*/
+pybind11::object ComputeRDF::getRDF()
+    {
+    std::vector<double> counts(m_bins);
+        {
+        ArrayHandle<unsigned int> h_histogram(m_histogram,
+                                              access_location::host,
+                                              access_mode::read);
+        std::copy(h_histogram.data, h_histogram.data + m_bins, counts.begin());
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Reduce(m_exec_conf->isRoot() ? MPI_IN_PLACE : counts.data(),
+                   counts.data(),
+                   m_bins,
+                   MPI_DOUBLE,
+                   MPI_SUM,
+                   0,
+                   m_exec_conf->getMPICommunicator());
+        }
+
+    if (!m_exec_conf->isRoot())
+        return pybind11::none();
+#endif
+
+    const bool twod = m_sysdef->getNDimensions() == 2;
+    const double volume = m_pdata->getGlobalBox().getVolume(twod);
+    const double n_global = double(m_pdata->getNGlobal());
+    const double pair_density = n_global * n_global / volume;
+    const double dr = double(m_r_max) / double(m_bins);
+
+    std::vector<double> rdf(m_bins);
+    for (unsigned int b = 0; b < m_bins; b++)
+        {
+        double r_lower = dr * b;
+        double r_upper = dr * (b + 1);
+        double shell;
+        if (twod)
+            shell = M_PI * (r_upper * r_upper - r_lower * r_lower);
+        else
+            shell = 4.0 / 3.0 * M_PI
+                    * (r_upper * r_upper * r_upper - r_lower * r_lower * r_lower);
+
+        rdf[b] = counts[b] / (pair_density * shell);
+        }
+
+    return pybind11::array_t<double>(rdf.size(), rdf.data());
+    }
+
+namespace detail
+    {
+void export_ComputeRDF(pybind11::module& m)
+    {
+    pybind11::class_<ComputeRDF, Compute, std::shared_ptr<ComputeRDF>>(m, "ComputeRDF")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            unsigned int>())
+        .def_property_readonly("r_max", &ComputeRDF::getRMax)
+        .def_property_readonly("bins", &ComputeRDF::getBins)
+        .def_property_readonly("rdf", &ComputeRDF::getRDF);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,111 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+#include "hoomd/Compute.h"
+#include "hoomd/GPUArray.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file ComputeRDF.h
+    \brief Declares a class for computing the radial distribution function
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_RDF_H__
+#define __COMPUTE_RDF_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes the radial distribution function from the neighbor list
+/*! ComputeRDF histograms the distances between all pairs of particles closer than r_max into a
+    GPUArray of counts, using the pairs in an existing NeighborList. It adds an r_cut matrix of
+    r_max to the neighbor list so that the list (and the ghost layer) includes every such pair, and
+    it calls NeighborList::compute() so that it shares the list built for the pair forces on the
+    same step instead of building its own.
+
+    The counts in m_histogram include every ordered pair (i, j) with local particle i. With half
+    storage, the neighbor list stores each local pair once and each local-ghost pair once on the
+    rank that owns i, so pairs between local particles are counted twice. Excluded pairs (e.g.
+    bonded particles) are not in the neighbor list and are not counted.
+
+    getRDF() normalizes the counts by the number of pairs expected in an ideal gas at the same
+    density.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeRDF : public Compute
+    {
+    public:
+    //! Constructs the compute
+    ComputeRDF(std::shared_ptr<SystemDefinition> sysdef,
+               std::shared_ptr<NeighborList> nlist,
+               Scalar r_max,
+               unsigned int bins);
+
+    //! Destructor
+    virtual ~ComputeRDF();
+
+    //! Compute the histogram
+    virtual void compute(uint64_t timestep);
+
+    //! Get the radial distribution function
+    pybind11::object getRDF();
+
+    /// Get the largest distance in the histogram
+    Scalar getRMax()
+        {
+        return m_r_max;
+        }
+
+    /// Get the number of bins in the histogram
+    unsigned int getBins()
+        {
+        return m_bins;
+        }
+
+    /// Stop using the neighbor list
+    virtual void notifyDetach()
+        {
+        if (m_attached)
+            {
+            m_nlist->removeRCutMatrix(m_r_cut_nlist);
+            }
+        m_attached = false;
+        }
+
+    protected:
+    std::shared_ptr<NeighborList> m_nlist; //!< Neighbor list that provides the pairs
+    Scalar m_r_max;                        //!< Largest distance in the histogram
+    unsigned int m_bins;                   //!< Number of bins in the histogram
+
+    GPUArray<unsigned int> m_histogram; //!< Pair counts in each bin
+
+    /// r_cut (not squared) given to the neighbor list
+    std::shared_ptr<GPUArray<Scalar>> m_r_cut_nlist;
+
+    /// Track whether we have attached to the Simulation object
+    bool m_attached = true;
+
+    //! Count the pairs in each bin
+    virtual void computeHistogram();
+    };
+
+namespace detail
+    {
+//! Exports the ComputeRDF class to python
+void export_ComputeRDF(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,85 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeRDFGPU.cc
+    \brief Contains code for the ComputeRDFGPU class
+*/
+
+#include "ComputeRDFGPU.h"
+#include "ComputeRDFGPU.cuh"
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute the radial distribution function of
+    \param nlist Neighbor list that provides the pairs
+    \param r_max Largest distance in the histogram
+    \param bins Number of bins in the histogram
+*/
+ComputeRDFGPU::ComputeRDFGPU(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<NeighborList> nlist,
+                             Scalar r_max,
+                             unsigned int bins)
+    : ComputeRDF(sysdef, nlist, r_max, bins)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Creating a ComputeRDFGPU with no GPU in the execution "
+                                 "configuration");
+        }
+
+    m_block_size = 256;
+    }
+
+ComputeRDFGPU::~ComputeRDFGPU() { }
+
+void ComputeRDFGPU::computeHistogram()
+    {
+    ArrayHandle<unsigned int> d_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist->getNListArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_nlist->getHeadList(),
+                                    access_location::device,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_histogram(m_histogram,
+                                          access_location::device,
+                                          access_mode::overwrite);
+
+    kernel::gpu_compute_rdf_histogram(d_histogram.data,
+                                      d_pos.data,
+                                      d_n_neigh.data,
+                                      d_nlist.data,
+                                      d_head_list.data,
+                                      m_pdata->getN(),
+                                      m_pdata->getGlobalBox(),
+                                      m_r_max,
+                                      m_bins,
+                                      m_nlist->getStorageMode() == NeighborList::half,
+                                      m_block_size);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+namespace detail
+    {
+void export_ComputeRDFGPU(pybind11::module& m)
+    {
+    pybind11::class_<ComputeRDFGPU, ComputeRDF, std::shared_ptr<ComputeRDFGPU>>(m,
+                                                                                "ComputeRDFGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            unsigned int>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
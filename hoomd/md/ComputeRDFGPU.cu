@@ -0,0 +1,153 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeRDFGPU.cuh"
+
+/*! \file ComputeRDFGPU.cu
+    \brief Defines GPU kernel code for histogramming the radial distribution function. Used by
+   ComputeRDFGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Largest histogram that is accumulated in shared memory
+const unsigned int RDF_MAX_SHARED_BINS = 4096;
+
+//! Count the pairs in each bin of the radial distribution function
+/*! \param d_histogram Pair counts in each bin (accumulated)
+    \param d_pos Particle positions
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Neighbor list
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param N Number of local particles
+    \param box Simulation box
+    \param r_max_sq Square of the largest distance in the histogram
+    \param inv_dr Inverse of the bin width
+    \param bins Number of bins in the histogram
+    \param half Set to true when the neighbor list stores each local pair once
+    \param use_shared Set to true to accumulate the block's counts in shared memory
+
+    One thread is executed per particle. With \a use_shared, each block accumulates its counts in
+    shared memory (bins unsigned ints of dynamic shared memory) and adds them to \a d_histogram
+    at the end, so the global atomic traffic is independent of the number of pairs.
+*/
+__global__ void gpu_compute_rdf_histogram_kernel(unsigned int* d_histogram,
+                                                 const Scalar4* d_pos,
+                                                 const unsigned int* d_n_neigh,
+                                                 const unsigned int* d_nlist,
+                                                 const size_t* d_head_list,
+                                                 unsigned int N,
+                                                 BoxDim box,
+                                                 Scalar r_max_sq,
+                                                 Scalar inv_dr,
+                                                 unsigned int bins,
+                                                 bool half,
+                                                 bool use_shared)
+    {
+    extern __shared__ unsigned int s_histogram[];
+
+    if (use_shared)
+        {
+        for (unsigned int b = threadIdx.x; b < bins; b += blockDim.x)
+            s_histogram[b] = 0;
+        __syncthreads();
+        }
+
+    unsigned int* histogram = use_shared ? s_histogram : d_histogram;
+
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < N)
+        {
+        Scalar4 postype_i = d_pos[i];
+        Scalar3 pi = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+        const size_t head = d_head_list[i];
+        const unsigned int n_neigh = d_n_neigh[i];
+
+        for (unsigned int k = 0; k < n_neigh; k++)
+            {
+            unsigned int j = d_nlist[head + k];
+            Scalar4 postype_j = d_pos[j];
+            Scalar3 dx = pi - make_scalar3(postype_j.x, postype_j.y, postype_j.z);
+            dx = box.minImage(dx);
+            Scalar rsq = dot(dx, dx);
+            if (rsq >= r_max_sq)
+                continue;
+
+            unsigned int bin = min((unsigned int)(fast::sqrt(rsq) * inv_dr), bins - 1);
+            atomicAdd(&histogram[bin], (half && j < N) ? 2u : 1u);
+            }
+        }
+
+    if (use_shared)
+        {
+        __syncthreads();
+        for (unsigned int b = threadIdx.x; b < bins; b += blockDim.x)
+            {
+            if (s_histogram[b] != 0)
+                atomicAdd(&d_histogram[b], s_histogram[b]);
+            }
+        }
+    }
+
+/*! \param d_histogram Pair counts in each bin (overwritten)
+    \param d_pos Particle positions
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Neighbor list
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param N Number of local particles
+    \param box Simulation box
+    \param r_max Largest distance in the histogram
+    \param bins Number of bins in the histogram
+    \param half Set to true when the neighbor list stores each local pair once
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_compute_rdf_histogram(unsigned int* d_histogram,
+                                     const Scalar4* d_pos,
+                                     const unsigned int* d_n_neigh,
+                                     const unsigned int* d_nlist,
+                                     const size_t* d_head_list,
+                                     unsigned int N,
+                                     const BoxDim& box,
+                                     Scalar r_max,
+                                     unsigned int bins,
+                                     bool half,
+                                     unsigned int block_size)
+    {
+    hipMemset(d_histogram, 0, sizeof(unsigned int) * bins);
+    if (N == 0)
+        return hipSuccess;
+
+    const bool use_shared = bins <= RDF_MAX_SHARED_BINS;
+    const size_t shared_bytes = use_shared ? sizeof(unsigned int) * bins : 0;
+
+    dim3 grid(N / block_size + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_rdf_histogram_kernel),
+                       dim3(grid),
+                       dim3(threads),
+                       shared_bytes,
+                       0,
+                       d_histogram,
+                       d_pos,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N,
+                       box,
+                       r_max * r_max,
+                       Scalar(bins) / r_max,
+                       bins,
+                       half,
+                       use_shared);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
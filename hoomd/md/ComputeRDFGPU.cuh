@@ -0,0 +1,39 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _COMPUTE_RDF_GPU_CUH_
+#define _COMPUTE_RDF_GPU_CUH_
+
+#include <hip/hip_runtime.h>
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+/*! \file ComputeRDFGPU.cuh
+    \brief Kernel driver function declarations for ComputeRDFGPU
+    */
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Count the pairs in each bin of the radial distribution function
+hipError_t gpu_compute_rdf_histogram(unsigned int* d_histogram,
+                                     const Scalar4* d_pos,
+                                     const unsigned int* d_n_neigh,
+                                     const unsigned int* d_nlist,
+                                     const size_t* d_head_list,
+                                     unsigned int N,
+                                     const BoxDim& box,
+                                     Scalar r_max,
+                                     unsigned int bins,
+                                     bool half,
+                                     unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,57 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeRDF.h"
+
+/*! \file ComputeRDFGPU.h
+    \brief Declares a class for computing the radial distribution function on the GPU
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_RDF_GPU_H__
+#define __COMPUTE_RDF_GPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes the radial distribution function on the GPU
+/*! ComputeRDFGPU is a GPU accelerated implementation of ComputeRDF. The histogram is accumulated
+    on the device and only the counts are copied to the host when getRDF() is called.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeRDFGPU : public ComputeRDF
+    {
+    public:
+    //! Constructs the compute
+    ComputeRDFGPU(std::shared_ptr<SystemDefinition> sysdef,
+                  std::shared_ptr<NeighborList> nlist,
+                  Scalar r_max,
+                  unsigned int bins);
+
+    //! Destructor
+    virtual ~ComputeRDFGPU();
+
+    protected:
+    unsigned int m_block_size; //!< Block size executed
+
+    //! Count the pairs in each bin
+    virtual void computeHistogram();
+    };
+
+namespace detail
+    {
+//! Exports the ComputeRDFGPU class to python
+void export_ComputeRDFGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,231 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeSteinhardt.cc
+    \brief Contains code for the ComputeSteinhardt class
+*/
+
+#include "ComputeSteinhardt.h"
+#include "SteinhardtOrder.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute the order parameters of
+    \param nlist Neighbor list that provides the bonds
+    \param r_max Largest bond length
+    \param l Spherical harmonic degrees to compute q_l for
+*/
+ComputeSteinhardt::ComputeSteinhardt(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<NeighborList> nlist,
+                                     Scalar r_max,
+                                     const std::vector<unsigned int>& l)
+    : Compute(sysdef), m_nlist(nlist), m_r_max(r_max), m_l(l)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ComputeSteinhardt" << endl;
+
+    if (r_max <= Scalar(0.0))
+        {
+        throw std::domain_error("r_max must be positive");
+        }
+    if (m_l.size() == 0)
+        {
+        throw std::invalid_argument("l must contain at least one degree");
+        }
+    for (unsigned int degree : m_l)
+        {
+        if (degree > detail::STEINHARDT_MAX_L)
+            {
+            throw std::domain_error("l must be no larger than "
+                                    + std::to_string(detail::STEINHARDT_MAX_L));
+            }
+        }
+
+    m_sums.resize(m_l.size() + 2, 0.0);
+
+    // include all bonds within r_max in the neighbor list
+    unsigned int n_types = m_pdata->getNTypes();
+    m_r_cut_nlist = std::make_shared<GPUArray<Scalar>>(n_types * n_types, m_exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut_nlist(*m_r_cut_nlist,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        std::fill(h_r_cut_nlist.data, h_r_cut_nlist.data + n_types * n_types, m_r_max);
+        }
+    m_nlist->addRCutMatrix(m_r_cut_nlist);
+    }
+
+ComputeSteinhardt::~ComputeSteinhardt()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ComputeSteinhardt" << endl;
+
+    if (m_attached)
+        {
+        m_nlist->removeRCutMatrix(m_r_cut_nlist);
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ComputeSteinhardt::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (shouldCompute(timestep))
+        {
+        m_nlist->compute(timestep);
+        computeOrder();
+
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            {
+            MPI_Allreduce(MPI_IN_PLACE,
+                          m_sums.data(),
+                          int(m_sums.size()),
+                          MPI_DOUBLE,
+                          MPI_SUM,
+                          m_exec_conf->getMPICommunicator());
+            }
+#endif
+        }
+    }
+
+void ComputeSteinhardt::computeOrder()
+    {
+    const bool half = m_nlist->getStorageMode() == NeighborList::half;
+    const unsigned int N = m_pdata->getN();
+    const BoxDim box = m_pdata->getGlobalBox();
+    const Scalar r_max_sq = m_r_max * m_r_max;
+
+    // each particle stores the sums for m = 0 ... l of every degree, one degree after the other
+    std::vector<size_t> offset(m_l.size());
+    size_t width = 0;
+    for (size_t li = 0; li < m_l.size(); li++)
+        {
+        offset[li] = width;
+        width += m_l[li] + 1;
+        }
+    std::vector<Scalar2> qlm(N * width, make_scalar2(0, 0));
+    std::vector<unsigned int> n_bonds(N, 0);
+
+        {
+        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const size_t head = h_head_list.data[i];
+            const unsigned int n_neigh = h_n_neigh.data[i];
+
+            for (unsigned int k = 0; k < n_neigh; k++)
+                {
+                unsigned int j = h_nlist.data[head + k];
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dr = box.minImage(pj - pi);
+                Scalar rsq = dot(dr, dr);
+                if (rsq >= r_max_sq || rsq == Scalar(0.0))
+                    continue;
+
+                n_bonds[i]++;
+                for (size_t li = 0; li < m_l.size(); li++)
+                    detail::steinhardt_accumulate(dr, m_l[li], &qlm[i * width + offset[li]]);
+
+                // add the reverse bond to local neighbors that do not list i
+                if (half && j < N)
+                    {
+                    Scalar3 dr_ji = -dr;
+                    n_bonds[j]++;
+                    for (size_t li = 0; li < m_l.size(); li++)
+                        detail::steinhardt_accumulate(dr_ji,
+                                                      m_l[li],
+                                                      &qlm[j * width + offset[li]]);
+                    }
+                }
+            }
+        }
+
+    std::fill(m_sums.begin(), m_sums.end(), 0.0);
+    const size_t n_l = m_l.size();
+    for (unsigned int i = 0; i < N; i++)
+        {
+        if (n_bonds[i] == 0)
+            continue;
+
+        for (size_t li = 0; li < n_l; li++)
+            m_sums[li] += detail::steinhardt_ql(&qlm[i * width + offset[li]], m_l[li], n_bonds[i]);
+
+        m_sums[n_l] += 1.0;
+        m_sums[n_l + 1] += double(n_bonds[i]);
+        }
+    }
+
+/*! \returns The mean of q_l over all particles with at least one bond for each degree in l (NaN
+    when no particle has bonds)
+*/
+pybind11::object ComputeSteinhardt::getOrder()
+    {
+    const size_t n_l = m_l.size();
+    const double n_centers = m_sums[n_l];
+    std::vector<double> order(n_l, std::numeric_limits<double>::quiet_NaN());
+    if (n_centers > 0)
+        {
+        for (size_t li = 0; li < n_l; li++)
+            order[li] = m_sums[li] / n_centers;
+        }
+    return pybind11::array_t<double>(order.size(), order.data());
+    }
+
+/*! \returns The mean number of bonds over all particles
+ */
+double ComputeSteinhardt::getCoordinationNumber()
+    {
+    const unsigned int n_global = m_pdata->getNGlobal();
+    if (n_global == 0)
+        return 0.0;
+    return m_sums[m_l.size() + 1] / double(n_global);
+    }
+
+namespace detail
+    {
+void export_ComputeSteinhardt(pybind11::module& m)
+    {
+    pybind11::class_<ComputeSteinhardt, Compute, std::shared_ptr<ComputeSteinhardt>>(
+        m,
+        "ComputeSteinhardt")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            const std::vector<unsigned int>&>())
+        .def_property_readonly("r_max", &ComputeSteinhardt::getRMax)
+        .def_property_readonly("l", &ComputeSteinhardt::getL)
+        .def_property_readonly("order", &ComputeSteinhardt::getOrder)
+        .def_property_readonly("coordination_number", &ComputeSteinhardt::getCoordinationNumber);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
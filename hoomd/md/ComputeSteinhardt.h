@@ -0,0 +1,114 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+#include "hoomd/Compute.h"
+#include "hoomd/GPUArray.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file ComputeSteinhardt.h
+    \brief Declares a class for computing Steinhardt bond order parameters
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_STEINHARDT_H__
+#define __COMPUTE_STEINHARDT_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes Steinhardt bond order parameters and coordination numbers from the neighbor list
+/*! The bonds of particle i are the vectors to all neighbors j closer than r_max. ComputeSteinhardt
+    evaluates the local order parameter q_l(i) of each particle for every degree l in a list
+    (see SteinhardtOrder.h) along with the number of bonds of each particle. It reports the mean
+    q_l over particles with at least one bond and the mean number of bonds (coordination number)
+    over all particles.
+
+    Like ComputeRDF, it adds an r_cut matrix of r_max to an existing NeighborList and calls
+    NeighborList::compute() to share the list with other consumers. With half storage, each bond
+    between local particles is added to both particles. Excluded pairs are not bonds.
+
+    The means are reduced over all ranks in compute() and are available on every rank.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeSteinhardt : public Compute
+    {
+    public:
+    //! Constructs the compute
+    ComputeSteinhardt(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<NeighborList> nlist,
+                      Scalar r_max,
+                      const std::vector<unsigned int>& l);
+
+    //! Destructor
+    virtual ~ComputeSteinhardt();
+
+    //! Compute the order parameters
+    virtual void compute(uint64_t timestep);
+
+    //! Get the mean order parameter for each degree
+    pybind11::object getOrder();
+
+    //! Get the mean number of bonds per particle
+    double getCoordinationNumber();
+
+    /// Get the largest bond length
+    Scalar getRMax()
+        {
+        return m_r_max;
+        }
+
+    /// Get the spherical harmonic degrees
+    std::vector<unsigned int> getL()
+        {
+        return m_l;
+        }
+
+    /// Stop using the neighbor list
+    virtual void notifyDetach()
+        {
+        if (m_attached)
+            {
+            m_nlist->removeRCutMatrix(m_r_cut_nlist);
+            }
+        m_attached = false;
+        }
+
+    protected:
+    std::shared_ptr<NeighborList> m_nlist; //!< Neighbor list that provides the bonds
+    Scalar m_r_max;                        //!< Largest bond length
+    std::vector<unsigned int> m_l;         //!< Spherical harmonic degrees
+
+    /// Sums of q_l over all particles for each degree, followed by the number of particles with
+    /// bonds and the total number of bonds
+    std::vector<double> m_sums;
+
+    /// r_cut (not squared) given to the neighbor list
+    std::shared_ptr<GPUArray<Scalar>> m_r_cut_nlist;
+
+    /// Track whether we have attached to the Simulation object
+    bool m_attached = true;
+
+    //! Compute the local sums in m_sums
+    virtual void computeOrder();
+    };
+
+namespace detail
+    {
+//! Exports the ComputeSteinhardt class to python
+void export_ComputeSteinhardt(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,121 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeSteinhardtGPU.cc
+    \brief Contains code for the ComputeSteinhardtGPU class
+*/
+
+#include "ComputeSteinhardtGPU.h"
+#include "ComputeSteinhardtGPU.cuh"
+
+#include <pybind11/stl.h>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute the order parameters of
+    \param nlist Neighbor list that provides the bonds
+    \param r_max Largest bond length
+    \param l Spherical harmonic degrees to compute q_l for
+*/
+ComputeSteinhardtGPU::ComputeSteinhardtGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<NeighborList> nlist,
+                                           Scalar r_max,
+                                           const std::vector<unsigned int>& l)
+    : ComputeSteinhardt(sysdef, nlist, r_max, l), m_ql(m_exec_conf), m_n_bonds(m_exec_conf)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Creating a ComputeSteinhardtGPU with no GPU in the execution "
+                                 "configuration");
+        }
+
+    GPUArray<unsigned int> l_device(m_l.size(), m_exec_conf);
+    m_l_device.swap(l_device);
+        {
+        ArrayHandle<unsigned int> h_l(m_l_device, access_location::host, access_mode::overwrite);
+        std::copy(m_l.begin(), m_l.end(), h_l.data);
+        }
+
+    m_block_size = 128;
+    }
+
+ComputeSteinhardtGPU::~ComputeSteinhardtGPU() { }
+
+void ComputeSteinhardtGPU::computeOrder()
+    {
+    if (m_nlist->getStorageMode() != NeighborList::full)
+        {
+        throw std::runtime_error("ComputeSteinhardtGPU requires a neighbor list with full storage");
+        }
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_l = (unsigned int)m_l.size();
+    m_ql.resize(size_t(N) * n_l);
+    m_n_bonds.resize(N);
+
+        {
+        ArrayHandle<unsigned int> d_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> d_nlist(m_nlist->getNListArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<size_t> d_head_list(m_nlist->getHeadList(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_l(m_l_device, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_ql(m_ql, access_location::device, access_mode::overwrite);
+        ArrayHandle<unsigned int> d_n_bonds(m_n_bonds,
+                                            access_location::device,
+                                            access_mode::overwrite);
+
+        kernel::gpu_compute_steinhardt(d_ql.data,
+                                       d_n_bonds.data,
+                                       d_pos.data,
+                                       d_n_neigh.data,
+                                       d_nlist.data,
+                                       d_head_list.data,
+                                       N,
+                                       m_pdata->getGlobalBox(),
+                                       m_r_max,
+                                       d_l.data,
+                                       n_l,
+                                       m_block_size);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    ArrayHandle<Scalar> d_ql(m_ql, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_n_bonds(m_n_bonds, access_location::device, access_mode::read);
+    kernel::gpu_reduce_steinhardt(m_sums.data(),
+                                  d_ql.data,
+                                  d_n_bonds.data,
+                                  N,
+                                  n_l,
+                                  m_exec_conf->getCachedAllocator());
+    }
+
+namespace detail
+    {
+void export_ComputeSteinhardtGPU(pybind11::module& m)
+    {
+    pybind11::class_<ComputeSteinhardtGPU,
+                     ComputeSteinhardt,
+                     std::shared_ptr<ComputeSteinhardtGPU>>(m, "ComputeSteinhardtGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            const std::vector<unsigned int>&>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
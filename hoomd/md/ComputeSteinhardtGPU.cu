@@ -0,0 +1,200 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeSteinhardtGPU.cuh"
+#include "SteinhardtOrder.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <thrust/count.h>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#pragma GCC diagnostic pop
+
+/*! \file ComputeSteinhardtGPU.cu
+    \brief Defines GPU kernel code for computing Steinhardt bond order parameters. Used by
+   ComputeSteinhardtGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Compute the Steinhardt order parameter and number of bonds of each particle
+/*! \param d_ql Order parameter of each particle for each degree (n_l * N elements, written as
+           d_ql[li * N + i], 0 for particles without bonds)
+    \param d_n_bonds Number of bonds of each particle
+    \param d_pos Particle positions
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Neighbor list (full storage)
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param N Number of local particles
+    \param box Simulation box
+    \param r_max_sq Square of the largest bond length
+    \param d_l Spherical harmonic degrees
+    \param n_l Number of degrees
+
+    One thread is executed per particle. The thread walks its neighbors once per degree and keeps
+    the sums for m = 0 ... l in registers.
+*/
+__global__ void gpu_compute_steinhardt_kernel(Scalar* d_ql,
+                                              unsigned int* d_n_bonds,
+                                              const Scalar4* d_pos,
+                                              const unsigned int* d_n_neigh,
+                                              const unsigned int* d_nlist,
+                                              const size_t* d_head_list,
+                                              unsigned int N,
+                                              BoxDim box,
+                                              Scalar r_max_sq,
+                                              const unsigned int* d_l,
+                                              unsigned int n_l)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= N)
+        return;
+
+    Scalar4 postype_i = d_pos[i];
+    Scalar3 pi = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+    const size_t head = d_head_list[i];
+    const unsigned int n_neigh = d_n_neigh[i];
+
+    unsigned int n_bonds = 0;
+    for (unsigned int li = 0; li < n_l; li++)
+        {
+        const unsigned int l = d_l[li];
+        Scalar2 qlm[detail::STEINHARDT_MAX_L + 1];
+        for (unsigned int m = 0; m <= l; m++)
+            qlm[m] = make_scalar2(0, 0);
+
+        n_bonds = 0;
+        for (unsigned int k = 0; k < n_neigh; k++)
+            {
+            unsigned int j = d_nlist[head + k];
+            Scalar4 postype_j = d_pos[j];
+            Scalar3 dr = make_scalar3(postype_j.x, postype_j.y, postype_j.z) - pi;
+            dr = box.minImage(dr);
+            Scalar rsq = dot(dr, dr);
+            if (rsq >= r_max_sq || rsq == Scalar(0.0))
+                continue;
+
+            n_bonds++;
+            detail::steinhardt_accumulate(dr, l, qlm);
+            }
+
+        d_ql[li * N + i] = (n_bonds > 0) ? detail::steinhardt_ql(qlm, l, n_bonds) : Scalar(0.0);
+        }
+
+    d_n_bonds[i] = n_bonds;
+    }
+
+/*! \param d_ql Order parameter of each particle for each degree (n_l * N elements)
+    \param d_n_bonds Number of bonds of each particle
+    \param d_pos Particle positions
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Neighbor list (full storage)
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param N Number of local particles
+    \param box Simulation box
+    \param r_max Largest bond length
+    \param d_l Spherical harmonic degrees
+    \param n_l Number of degrees
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_compute_steinhardt(Scalar* d_ql,
+                                  unsigned int* d_n_bonds,
+                                  const Scalar4* d_pos,
+                                  const unsigned int* d_n_neigh,
+                                  const unsigned int* d_nlist,
+                                  const size_t* d_head_list,
+                                  unsigned int N,
+                                  const BoxDim& box,
+                                  Scalar r_max,
+                                  const unsigned int* d_l,
+                                  unsigned int n_l,
+                                  unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    dim3 grid(N / block_size + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_steinhardt_kernel),
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       d_ql,
+                       d_n_bonds,
+                       d_pos,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N,
+                       box,
+                       r_max * r_max,
+                       d_l,
+                       n_l);
+
+    return hipSuccess;
+    }
+
+//! Predicate that selects particles with bonds
+struct has_bonds
+    {
+    __host__ __device__ bool operator()(unsigned int n_bonds) const
+        {
+        return n_bonds > 0;
+        }
+    };
+
+/*! \param sums Output: the sum of q_l for each degree, then the number of particles with bonds
+           and the total number of bonds (n_l + 2 elements)
+    \param d_ql Order parameter of each particle for each degree (n_l * N elements)
+    \param d_n_bonds Number of bonds of each particle
+    \param N Number of local particles
+    \param n_l Number of degrees
+    \param alloc Caching allocator for thrust temporary storage
+*/
+void gpu_reduce_steinhardt(double* sums,
+                           const Scalar* d_ql,
+                           const unsigned int* d_n_bonds,
+                           unsigned int N,
+                           unsigned int n_l,
+                           CachedAllocator& alloc)
+    {
+    for (unsigned int li = 0; li < n_l + 2; li++)
+        sums[li] = 0.0;
+
+    if (N == 0)
+        return;
+
+    thrust::device_ptr<const Scalar> ql(d_ql);
+    thrust::device_ptr<const unsigned int> n_bonds(d_n_bonds);
+
+#ifdef __HIP_PLATFORM_HCC__
+    auto policy = thrust::hip::par(alloc);
+#else
+    auto policy = thrust::cuda::par(alloc);
+#endif
+
+    for (unsigned int li = 0; li < n_l; li++)
+        {
+        sums[li]
+            = double(thrust::reduce(policy, ql + li * N, ql + (li + 1) * N, Scalar(0.0)));
+        }
+    sums[n_l] = double(thrust::count_if(policy, n_bonds, n_bonds + N, has_bonds()));
+    sums[n_l + 1] = double(thrust::reduce(policy,
+                                          n_bonds,
+                                          n_bonds + N,
+                                          (unsigned long long)0,
+                                          thrust::plus<unsigned long long>()));
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
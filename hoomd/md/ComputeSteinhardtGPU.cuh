@@ -0,0 +1,49 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _COMPUTE_STEINHARDT_GPU_CUH_
+#define _COMPUTE_STEINHARDT_GPU_CUH_
+
+#include <hip/hip_runtime.h>
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/HOOMDMath.h"
+
+/*! \file ComputeSteinhardtGPU.cuh
+    \brief Kernel driver function declarations for ComputeSteinhardtGPU
+    */
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Compute the Steinhardt order parameter and number of bonds of each particle
+hipError_t gpu_compute_steinhardt(Scalar* d_ql,
+                                  unsigned int* d_n_bonds,
+                                  const Scalar4* d_pos,
+                                  const unsigned int* d_n_neigh,
+                                  const unsigned int* d_nlist,
+                                  const size_t* d_head_list,
+                                  unsigned int N,
+                                  const BoxDim& box,
+                                  Scalar r_max,
+                                  const unsigned int* d_l,
+                                  unsigned int n_l,
+                                  unsigned int block_size);
+
+//! Sum the per-particle results of gpu_compute_steinhardt
+void gpu_reduce_steinhardt(double* sums,
+                           const Scalar* d_ql,
+                           const unsigned int* d_n_bonds,
+                           unsigned int N,
+                           unsigned int n_l,
+                           CachedAllocator& alloc);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
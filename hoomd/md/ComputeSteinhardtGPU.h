@@ -0,0 +1,62 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeSteinhardt.h"
+#include "hoomd/GPUVector.h"
+
+/*! \file ComputeSteinhardtGPU.h
+    \brief Declares a class for computing Steinhardt bond order parameters on the GPU
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_STEINHARDT_GPU_H__
+#define __COMPUTE_STEINHARDT_GPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes Steinhardt bond order parameters on the GPU
+/*! ComputeSteinhardtGPU is a GPU accelerated implementation of ComputeSteinhardt. The per-particle
+    values are computed and summed on the device and only the n_l + 2 sums are copied to the host.
+    It requires a neighbor list with full storage.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeSteinhardtGPU : public ComputeSteinhardt
+    {
+    public:
+    //! Constructs the compute
+    ComputeSteinhardtGPU(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<NeighborList> nlist,
+                         Scalar r_max,
+                         const std::vector<unsigned int>& l);
+
+    //! Destructor
+    virtual ~ComputeSteinhardtGPU();
+
+    protected:
+    GPUArray<unsigned int> m_l_device; //!< Spherical harmonic degrees
+    GPUVector<Scalar> m_ql;            //!< Order parameter of each particle for each degree
+    GPUVector<unsigned int> m_n_bonds; //!< Number of bonds of each particle
+    unsigned int m_block_size;         //!< Block size executed
+
+    //! Compute the local sums in m_sums
+    virtual void computeOrder();
+    };
+
+namespace detail
+    {
+//! Exports the ComputeSteinhardtGPU class to python
+void export_ComputeSteinhardtGPU(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
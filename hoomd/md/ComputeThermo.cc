@@ -43,6 +43,11 @@ ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
 ComputeThermo::~ComputeThermo()
     {
     m_exec_conf->msg->notice(5) << "Destroying ComputeThermo" << endl;
+
+#ifdef ENABLE_MPI
+    if (m_reduce_request != MPI_REQUEST_NULL)
+        MPI_Wait(&m_reduce_request, MPI_STATUS_IGNORE);
+#endif
     }
 
 /*! Calls computeProperties if the properties need updating
@@ -259,39 +264,68 @@ void ComputeThermo::computeProperties()
     Scalar pressure_yz = (pressure_kinetic_yz + virial_yz) / volume;
     Scalar pressure_zz = (pressure_kinetic_zz + virial_zz) / volume;
 
-    // fill out the GlobalArray
-    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::overwrite);
-    h_properties.data[thermo_index::translational_kinetic_energy] = Scalar(ke_trans_total);
-    h_properties.data[thermo_index::rotational_kinetic_energy] = Scalar(ke_rot_total);
-    h_properties.data[thermo_index::potential_energy] = Scalar(pe_total);
-    h_properties.data[thermo_index::pressure] = pressure;
-    h_properties.data[thermo_index::pressure_xx] = pressure_xx;
-    h_properties.data[thermo_index::pressure_xy] = pressure_xy;
-    h_properties.data[thermo_index::pressure_xz] = pressure_xz;
-    h_properties.data[thermo_index::pressure_yy] = pressure_yy;
-    h_properties.data[thermo_index::pressure_yz] = pressure_yz;
-    h_properties.data[thermo_index::pressure_zz] = pressure_zz;
+        // fill out the GlobalArray
+        {
+        ArrayHandle<Scalar> h_properties(m_properties,
+                                         access_location::host,
+                                         access_mode::overwrite);
+        h_properties.data[thermo_index::translational_kinetic_energy] = Scalar(ke_trans_total);
+        h_properties.data[thermo_index::rotational_kinetic_energy] = Scalar(ke_rot_total);
+        h_properties.data[thermo_index::potential_energy] = Scalar(pe_total);
+        h_properties.data[thermo_index::pressure] = pressure;
+        h_properties.data[thermo_index::pressure_xx] = pressure_xx;
+        h_properties.data[thermo_index::pressure_xy] = pressure_xy;
+        h_properties.data[thermo_index::pressure_xz] = pressure_xz;
+        h_properties.data[thermo_index::pressure_yy] = pressure_yy;
+        h_properties.data[thermo_index::pressure_yz] = pressure_yz;
+        h_properties.data[thermo_index::pressure_zz] = pressure_zz;
+        }
 
 #ifdef ENABLE_MPI
-    // in MPI, reduce extensive quantities only when they're needed
-    m_properties_reduced = !m_pdata->getDomainDecomposition();
+    // in MPI, reduce extensive quantities in the background until they're needed
+    startReduceProperties();
 #endif // ENABLE_MPI
     }
 
 #ifdef ENABLE_MPI
+/*! All properties are summed in a single non-blocking reduction. reduceProperties() completes it
+    the first time a property is read, so the reduction overlaps with the work in between and
+    ranks do not wait on each other until then.
+*/
+void ComputeThermo::startReduceProperties()
+    {
+    m_properties_reduced = !m_pdata->getDomainDecomposition();
+    if (m_properties_reduced)
+        return;
+
+    // the buffers may still be in use by a reduction whose results were never read
+    if (m_reduce_request != MPI_REQUEST_NULL)
+        MPI_Wait(&m_reduce_request, MPI_STATUS_IGNORE);
+
+    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::read);
+    std::copy(h_properties.data,
+              h_properties.data + thermo_index::num_quantities,
+              m_reduce_send_buf.begin());
+
+    MPI_Iallreduce(m_reduce_send_buf.data(),
+                   m_reduce_recv_buf.data(),
+                   thermo_index::num_quantities,
+                   MPI_HOOMD_SCALAR,
+                   MPI_SUM,
+                   m_exec_conf->getMPICommunicator(),
+                   &m_reduce_request);
+    }
+
 void ComputeThermo::reduceProperties()
     {
     if (m_properties_reduced)
         return;
 
-    // reduce properties
-    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::readwrite);
-    MPI_Allreduce(MPI_IN_PLACE,
-                  h_properties.data,
-                  thermo_index::num_quantities,
-                  MPI_HOOMD_SCALAR,
-                  MPI_SUM,
-                  m_exec_conf->getMPICommunicator());
+    // complete the reduction started by computeProperties
+    MPI_Wait(&m_reduce_request, MPI_STATUS_IGNORE);
+
+    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::overwrite);
+    std::copy(m_reduce_recv_buf.begin(), m_reduce_recv_buf.end(), h_properties.data);
 
     m_properties_reduced = true;
     }
@@ -5,9 +5,14 @@
 #include "hoomd/Compute.h"
 #include "hoomd/ParticleGroup.h"
 
+#include <array>
 #include <limits>
 #include <memory>
 
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
 /*! \file ComputeThermo.h
     \brief Declares a class for computing thermodynamic quantities
 */
@@ -341,6 +346,18 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
 #ifdef ENABLE_MPI
     bool m_properties_reduced; //!< True if properties have been reduced across MPI
 
+    /// Pending non-blocking reduction of the properties
+    MPI_Request m_reduce_request = MPI_REQUEST_NULL;
+
+    /// Local properties sent to the pending reduction
+    std::array<Scalar, thermo_index::num_quantities> m_reduce_send_buf;
+
+    /// Reduced properties received from the pending reduction
+    std::array<Scalar, thermo_index::num_quantities> m_reduce_recv_buf;
+
+    //! Start reducing the properties over MPI
+    void startReduceProperties();
+
     //! Reduce properties over MPI
     virtual void reduceProperties();
 #endif
@@ -181,8 +181,8 @@ void ComputeThermoGPU::computeProperties()
         }
 
 #ifdef ENABLE_MPI
-    // in MPI, reduce extensive quantities only when they're needed
-    m_properties_reduced = !m_pdata->getDomainDecomposition();
+    // in MPI, reduce extensive quantities in the background until they're needed
+    startReduceProperties();
 #endif // ENABLE_MPI
     }
 
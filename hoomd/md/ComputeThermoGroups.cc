@@ -0,0 +1,366 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeThermoGroups.cc
+    \brief Contains code for the ComputeThermoGroups class
+*/
+
+#include "ComputeThermoGroups.h"
+#include "hoomd/VectorMath.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <pybind11/stl.h>
+
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System for which to compute thermodynamic properties
+    \param groups Subsets of the system over which properties are calculated
+*/
+ComputeThermoGroups::ComputeThermoGroups(std::shared_ptr<SystemDefinition> sysdef,
+                                         std::vector<std::shared_ptr<ParticleGroup>> groups)
+    : Compute(sysdef), m_groups(groups)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ComputeThermoGroups" << endl;
+
+    if (m_groups.size() > 64)
+        {
+        throw std::invalid_argument("ComputeThermoGroups supports at most 64 groups.");
+        }
+
+    m_properties.resize(m_groups.size() * thermo_groups_index::num_quantities, 0.0);
+    m_computed_flags.reset();
+    }
+
+ComputeThermoGroups::~ComputeThermoGroups()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ComputeThermoGroups" << endl;
+    }
+
+/*! Calls computeProperties if the properties need updating
+    \param timestep Current time step of the simulation
+*/
+void ComputeThermoGroups::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (shouldCompute(timestep))
+        {
+        computeProperties();
+        m_computed_flags = m_pdata->getFlags();
+        }
+    }
+
+/*! Computes the properties of all groups in one pass over the local particles.
+ */
+void ComputeThermoGroups::computeProperties()
+    {
+    const unsigned int n_groups = static_cast<unsigned int>(m_groups.size());
+    const unsigned int n_quantities = thermo_groups_index::num_quantities;
+    const unsigned int N = m_pdata->getN();
+
+    // mark the groups of each particle, accessing the index arrays first because a rebuild of a
+    // group may access the tags
+    m_group_mask.assign(N, 0);
+    for (unsigned int g = 0; g < n_groups; g++)
+        {
+        const unsigned int group_size = m_groups[g]->getNumMembers();
+        ArrayHandle<unsigned int> h_index_array(m_groups[g]->getIndexArray(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+            {
+            m_group_mask[h_index_array.data[group_idx]] |= uint64_t(1) << g;
+            }
+        }
+
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    const GPUArray<Scalar>& net_virial = m_pdata->getNetVirial();
+    ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::read);
+    const size_t virial_pitch = net_virial.getPitch();
+
+    PDataFlags flags = m_pdata->getFlags();
+    const bool compute_pressure = flags[pdata_flag::pressure_tensor];
+    const bool compute_rotational = flags[pdata_flag::rotational_kinetic_energy];
+
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::host,
+                                  access_mode::read);
+    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                   access_location::host,
+                                   access_mode::read);
+
+    std::fill(m_properties.begin(), m_properties.end(), 0.0);
+    double terms[thermo_groups_index::num_quantities];
+
+    for (unsigned int j = 0; j < N; j++)
+        {
+        uint64_t mask = m_group_mask[j];
+        // ignore rigid body constituent particles in the sum
+        if (mask == 0 || (h_body.data[j] < MIN_FLOPPY && h_body.data[j] != h_tag.data[j]))
+            continue;
+
+        const double mass = h_vel.data[j].w;
+        const double vx = h_vel.data[j].x;
+        const double vy = h_vel.data[j].y;
+        const double vz = h_vel.data[j].z;
+
+        terms[thermo_groups_index::translational_kinetic_energy]
+            = 0.5 * mass * (vx * vx + vy * vy + vz * vz);
+        terms[thermo_groups_index::potential_energy] = h_net_force.data[j].w;
+        terms[thermo_groups_index::momentum_x] = mass * vx;
+        terms[thermo_groups_index::momentum_y] = mass * vy;
+        terms[thermo_groups_index::momentum_z] = mass * vz;
+
+        double ke_rot = 0.0;
+        if (compute_rotational)
+            {
+            Scalar3 I = h_inertia.data[j];
+            quat<Scalar> q(h_orientation.data[j]);
+            quat<Scalar> p(h_angmom.data[j]);
+            quat<Scalar> s(Scalar(0.5) * conj(q) * p);
+
+            // only if the moment of inertia along one principal axis is non-zero, that axis
+            // carries angular momentum
+            if (I.x > 0)
+                ke_rot += s.v.x * s.v.x / I.x;
+            if (I.y > 0)
+                ke_rot += s.v.y * s.v.y / I.y;
+            if (I.z > 0)
+                ke_rot += s.v.z * s.v.z / I.z;
+            ke_rot *= 0.5;
+            }
+        terms[thermo_groups_index::rotational_kinetic_energy] = ke_rot;
+
+        for (unsigned int k = 0; k < 6; k++)
+            terms[thermo_groups_index::pressure_xx + k] = 0.0;
+        if (compute_pressure)
+            {
+            terms[thermo_groups_index::pressure_xx]
+                = mass * vx * vx + h_net_virial.data[j + 0 * virial_pitch];
+            terms[thermo_groups_index::pressure_xy]
+                = mass * vx * vy + h_net_virial.data[j + 1 * virial_pitch];
+            terms[thermo_groups_index::pressure_xz]
+                = mass * vx * vz + h_net_virial.data[j + 2 * virial_pitch];
+            terms[thermo_groups_index::pressure_yy]
+                = mass * vy * vy + h_net_virial.data[j + 3 * virial_pitch];
+            terms[thermo_groups_index::pressure_yz]
+                = mass * vy * vz + h_net_virial.data[j + 4 * virial_pitch];
+            terms[thermo_groups_index::pressure_zz]
+                = mass * vz * vz + h_net_virial.data[j + 5 * virial_pitch];
+            }
+
+        for (unsigned int g = 0; mask != 0; g++, mask >>= 1)
+            {
+            if (mask & 1)
+                {
+                double* group_properties = m_properties.data() + g * n_quantities;
+                for (unsigned int k = 0; k < n_quantities; k++)
+                    group_properties[k] += terms[k];
+                }
+            }
+        }
+
+    // the additional energy and virial enter every group, as in ComputeThermo
+    for (unsigned int g = 0; g < n_groups; g++)
+        {
+        double* group_properties = m_properties.data() + g * n_quantities;
+        group_properties[thermo_groups_index::potential_energy] += m_pdata->getExternalEnergy();
+        for (unsigned int k = 0; k < 6; k++)
+            group_properties[thermo_groups_index::pressure_xx + k]
+                += m_pdata->getExternalVirial(k);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      m_properties.data(),
+                      static_cast<int>(m_properties.size()),
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    Scalar3 L = m_pdata->getGlobalBox().getL();
+    m_n_dimensions = m_sysdef->getNDimensions();
+    m_volume = m_n_dimensions == 2 ? L.x * L.y : L.x * L.y * L.z;
+    }
+
+/*! \param index Quantity to get
+    \returns The quantity of every group
+*/
+std::vector<double> ComputeThermoGroups::getProperty(thermo_groups_index::Enum index) const
+    {
+    std::vector<double> result(m_groups.size());
+    for (unsigned int g = 0; g < m_groups.size(); g++)
+        result[g] = m_properties[g * thermo_groups_index::num_quantities + index];
+    return result;
+    }
+
+std::vector<double> ComputeThermoGroups::getTemperature() const
+    {
+    std::vector<double> result(m_groups.size(), 0.0);
+    for (unsigned int g = 0; g < m_groups.size(); g++)
+        {
+        const double ndof = m_groups[g]->getTranslationalDOF() + m_groups[g]->getRotationalDOF();
+        const double* group_properties
+            = m_properties.data() + g * thermo_groups_index::num_quantities;
+        if (ndof > 0)
+            {
+            result[g] = 2.0 / ndof
+                        * (group_properties[thermo_groups_index::translational_kinetic_energy]
+                           + group_properties[thermo_groups_index::rotational_kinetic_energy]);
+            }
+        }
+    return result;
+    }
+
+pybind11::array_t<double> ComputeThermoGroups::getTranslationalKineticEnergyPython() const
+    {
+    std::vector<double> result = getProperty(thermo_groups_index::translational_kinetic_energy);
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::array_t<double> ComputeThermoGroups::getRotationalKineticEnergyPython() const
+    {
+    std::vector<double> result = getProperty(thermo_groups_index::rotational_kinetic_energy);
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::array_t<double> ComputeThermoGroups::getKineticEnergyPython() const
+    {
+    std::vector<double> result = getProperty(thermo_groups_index::translational_kinetic_energy);
+    std::vector<double> rotational = getProperty(thermo_groups_index::rotational_kinetic_energy);
+    for (unsigned int g = 0; g < result.size(); g++)
+        result[g] += rotational[g];
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::array_t<double> ComputeThermoGroups::getPotentialEnergyPython() const
+    {
+    std::vector<double> result = getProperty(thermo_groups_index::potential_energy);
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::array_t<double> ComputeThermoGroups::getTemperaturePython() const
+    {
+    std::vector<double> result = getTemperature();
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+/*! \returns The isotropic pressure of every group, or NaN when the virials were not computed
+ */
+pybind11::array_t<double> ComputeThermoGroups::getPressurePython() const
+    {
+    std::vector<double> result(m_groups.size(), std::numeric_limits<double>::quiet_NaN());
+    if (m_computed_flags[pdata_flag::pressure_tensor])
+        {
+        for (unsigned int g = 0; g < m_groups.size(); g++)
+            {
+            const double* group_properties
+                = m_properties.data() + g * thermo_groups_index::num_quantities;
+            // P = (2 K / D + W) / V, where the trace of the tensor sums 2 K and D W
+            result[g] = (group_properties[thermo_groups_index::pressure_xx]
+                         + group_properties[thermo_groups_index::pressure_yy]
+                         + group_properties[thermo_groups_index::pressure_zz])
+                        / (m_n_dimensions * m_volume);
+            }
+        }
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+/*! \param first Index of the first component
+    \param n_components Number of components
+    \param scale Factor to multiply the components with
+*/
+pybind11::array_t<double> ComputeThermoGroups::getTensorPython(thermo_groups_index::Enum first,
+                                                               unsigned int n_components,
+                                                               Scalar scale) const
+    {
+    pybind11::array_t<double> result(
+        std::vector<size_t> {m_groups.size(), static_cast<size_t>(n_components)});
+    double* data = result.mutable_data();
+    for (unsigned int g = 0; g < m_groups.size(); g++)
+        {
+        for (unsigned int k = 0; k < n_components; k++)
+            {
+            data[g * n_components + k]
+                = scale * m_properties[g * thermo_groups_index::num_quantities + first + k];
+            }
+        }
+    return result;
+    }
+
+/*! \returns The pressure tensor of every group, or NaN when the virials were not computed
+ */
+pybind11::array_t<double> ComputeThermoGroups::getPressureTensorPython() const
+    {
+    if (!m_computed_flags[pdata_flag::pressure_tensor])
+        {
+        return getTensorPython(thermo_groups_index::pressure_xx,
+                               6,
+                               std::numeric_limits<Scalar>::quiet_NaN());
+        }
+    return getTensorPython(thermo_groups_index::pressure_xx, 6, Scalar(1.0) / m_volume);
+    }
+
+pybind11::array_t<double> ComputeThermoGroups::getMomentumPython() const
+    {
+    return getTensorPython(thermo_groups_index::momentum_x, 3, Scalar(1.0));
+    }
+
+pybind11::array_t<unsigned int> ComputeThermoGroups::getNumParticlesPython() const
+    {
+    std::vector<unsigned int> result(m_groups.size());
+    for (unsigned int g = 0; g < m_groups.size(); g++)
+        result[g] = m_groups[g]->getNumMembersGlobal();
+    return pybind11::array_t<unsigned int>(result.size(), result.data());
+    }
+
+namespace detail
+    {
+void export_ComputeThermoGroups(pybind11::module& m)
+    {
+    pybind11::class_<ComputeThermoGroups, Compute, std::shared_ptr<ComputeThermoGroups>>(
+        m,
+        "ComputeThermoGroups")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::vector<std::shared_ptr<ParticleGroup>>>())
+        .def_property_readonly("kinetic_temperature", &ComputeThermoGroups::getTemperaturePython)
+        .def_property_readonly("pressure", &ComputeThermoGroups::getPressurePython)
+        .def_property_readonly("pressure_tensor", &ComputeThermoGroups::getPressureTensorPython)
+        .def_property_readonly("kinetic_energy", &ComputeThermoGroups::getKineticEnergyPython)
+        .def_property_readonly("translational_kinetic_energy",
+                               &ComputeThermoGroups::getTranslationalKineticEnergyPython)
+        .def_property_readonly("rotational_kinetic_energy",
+                               &ComputeThermoGroups::getRotationalKineticEnergyPython)
+        .def_property_readonly("potential_energy", &ComputeThermoGroups::getPotentialEnergyPython)
+        .def_property_readonly("momentum", &ComputeThermoGroups::getMomentumPython)
+        .def_property_readonly("num_particles", &ComputeThermoGroups::getNumParticlesPython);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,138 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/Compute.h"
+#include "hoomd/ParticleGroup.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file ComputeThermoGroups.h
+    \brief Declares a class for computing thermodynamic quantities of many groups at once
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_THERMO_GROUPS_H__
+#define __COMPUTE_THERMO_GROUPS_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Indices of the per group quantities computed by ComputeThermoGroups
+struct thermo_groups_index
+    {
+    enum Enum
+        {
+        translational_kinetic_energy = 0,
+        rotational_kinetic_energy,
+        potential_energy,
+        momentum_x,
+        momentum_y,
+        momentum_z,
+        pressure_xx, //!< Kinetic and virial terms, not yet divided by the volume
+        pressure_xy,
+        pressure_xz,
+        pressure_yy,
+        pressure_yz,
+        pressure_zz,
+        num_quantities
+        };
+    };
+
+//! Computes thermodynamic properties of many groups of particles in one pass
+/*! ComputeThermoGroups computes the same sums as ComputeThermo for each of its groups, plus the
+    linear momentum. It marks the groups that each local particle belongs to in a bitmask, then
+    reads the velocity, net force and net virial of each particle once and adds the particle's
+    terms to every group in its mask. The sums of all groups are reduced across the ranks in a
+    single allreduce.
+
+    The groups may overlap. The bitmask limits the number of groups to 64.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeThermoGroups : public Compute
+    {
+    public:
+    //! Constructs the compute
+    ComputeThermoGroups(std::shared_ptr<SystemDefinition> sysdef,
+                        std::vector<std::shared_ptr<ParticleGroup>> groups);
+
+    //! Destructor
+    virtual ~ComputeThermoGroups();
+
+    //! Compute the properties of all groups
+    virtual void compute(uint64_t timestep);
+
+    //! Get the number of groups
+    unsigned int getNumGroups() const
+        {
+        return static_cast<unsigned int>(m_groups.size());
+        }
+
+    //! Get a property of every group
+    std::vector<double> getProperty(thermo_groups_index::Enum index) const;
+
+    //! Get the kinetic temperature of every group
+    std::vector<double> getTemperature() const;
+
+    //! Get the translational kinetic energy of every group
+    pybind11::array_t<double> getTranslationalKineticEnergyPython() const;
+
+    //! Get the rotational kinetic energy of every group
+    pybind11::array_t<double> getRotationalKineticEnergyPython() const;
+
+    //! Get the kinetic energy of every group
+    pybind11::array_t<double> getKineticEnergyPython() const;
+
+    //! Get the potential energy of every group
+    pybind11::array_t<double> getPotentialEnergyPython() const;
+
+    //! Get the kinetic temperature of every group
+    pybind11::array_t<double> getTemperaturePython() const;
+
+    //! Get the isotropic pressure of every group
+    pybind11::array_t<double> getPressurePython() const;
+
+    //! Get the pressure tensor of every group, N_groups by 6
+    pybind11::array_t<double> getPressureTensorPython() const;
+
+    //! Get the linear momentum of every group, N_groups by 3
+    pybind11::array_t<double> getMomentumPython() const;
+
+    //! Get the number of particles in every group
+    pybind11::array_t<unsigned int> getNumParticlesPython() const;
+
+    protected:
+    std::vector<std::shared_ptr<ParticleGroup>> m_groups; //!< Groups to compute the properties of
+    std::vector<double> m_properties; //!< Sums of each group, num_quantities per group
+    std::vector<uint64_t> m_group_mask; //!< Groups of each local particle, one bit per group
+    Scalar m_volume = 0;                //!< Box volume (area in 2D) at the last computation
+    unsigned int m_n_dimensions = 3;    //!< Dimensionality at the last computation
+    PDataFlags m_computed_flags;        //!< Flags at the last computation
+
+    //! Compute the properties
+    virtual void computeProperties();
+
+    //! Copy a tensor quantity of every group into a numpy array
+    pybind11::array_t<double> getTensorPython(thermo_groups_index::Enum first,
+                                              unsigned int n_components,
+                                              Scalar scale) const;
+    };
+
+namespace detail
+    {
+//! Exports the ComputeThermoGroups class to python
+void export_ComputeThermoGroups(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
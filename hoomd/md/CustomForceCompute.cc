@@ -20,8 +20,9 @@ namespace md
  */
 CustomForceCompute::CustomForceCompute(std::shared_ptr<SystemDefinition> sysdef,
                                        pybind11::object py_setForces,
-                                       bool aniso)
-    : ForceCompute(sysdef), m_aniso(aniso)
+                                       bool aniso,
+                                       bool asynchronous)
+    : ForceCompute(sysdef), m_aniso(aniso), m_asynchronous(asynchronous)
     {
     m_exec_conf->msg->notice(5) << "Constructing ConstForceCompute" << endl;
     m_setForces = py_setForces;
@@ -38,24 +39,68 @@ CustomForceCompute::~CustomForceCompute()
 */
 void CustomForceCompute::computeForces(uint64_t timestep)
     {
-        // zero necessary arrays
+    bool compute_virial = m_pdata->getFlags()[pdata_flag::pressure_tensor];
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
         {
-        ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
-        memset(h_force.data, 0, sizeof(Scalar4) * m_pdata->getN());
+        // zero the arrays on the device so that no host to device copy precedes the callback
+        ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
+        hipMemsetAsync(d_force.data, 0, sizeof(Scalar4) * m_pdata->getN(), 0);
+        if (m_aniso)
+            {
+            ArrayHandle<Scalar4> d_torque(m_torque,
+                                          access_location::device,
+                                          access_mode::overwrite);
+            hipMemsetAsync(d_torque.data, 0, sizeof(Scalar4) * m_pdata->getN(), 0);
+            }
+        if (compute_virial)
+            {
+            ArrayHandle<Scalar> d_virial(m_virial,
+                                         access_location::device,
+                                         access_mode::overwrite);
+            hipMemsetAsync(d_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements(), 0);
+            }
         }
-    if (m_aniso)
+    else
+#endif
         {
-        ArrayHandle<Scalar4> h_torque(m_torque, access_location::host, access_mode::overwrite);
-        memset(h_torque.data, 0, sizeof(Scalar4) * m_pdata->getN());
+            // zero necessary arrays
+            {
+            ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+            memset(h_force.data, 0, sizeof(Scalar4) * m_pdata->getN());
+            }
+        if (m_aniso)
+            {
+            ArrayHandle<Scalar4> h_torque(m_torque,
+                                          access_location::host,
+                                          access_mode::overwrite);
+            memset(h_torque.data, 0, sizeof(Scalar4) * m_pdata->getN());
+            }
+
+        if (compute_virial)
+            {
+            ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+            memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+            }
         }
 
-    if (m_pdata->getFlags()[pdata_flag::pressure_tensor])
+    // execute python callback to update the forces, if present
+    pybind11::gil_scoped_acquire acquire_gil;
+    if (m_asynchronous)
         {
-        ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
-        memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        // HOOMD-blue launches all kernels on the default stream
+        pybind11::object stream = pybind11::none();
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled())
+            stream = pybind11::int_(0);
+#endif
+        m_setForces(timestep, stream);
+        }
+    else
+        {
+        m_setForces(timestep);
         }
-    // execute python callback to update the forces, if present
-    m_setForces(timestep);
     }
 
 namespace detail
@@ -65,7 +110,8 @@ void export_CustomForceCompute(py::module& m)
     py::class_<CustomForceCompute, ForceCompute, std::shared_ptr<CustomForceCompute>>(
         m,
         "CustomForceCompute")
-        .def(py::init<std::shared_ptr<SystemDefinition>, pybind11::object, bool>());
+        .def(py::init<std::shared_ptr<SystemDefinition>, pybind11::object, bool, bool>())
+        .def("isAsynchronous", &CustomForceCompute::isAsynchronous);
     }
 
     } // end namespace detail
@@ -24,7 +24,12 @@ namespace hoomd
 namespace md
     {
 //! Adds a custom force
-/*! \ingroup computes
+/*! When \a asynchronous is set, the python callback is also given the GPU stream that HOOMD-blue
+    launches its kernels on (None on the CPU). The callback may queue work on that stream and return
+    without synchronizing the device, and the kernels that consume the forces run after it in stream
+    order.
+
+    \ingroup computes
  */
 class PYBIND11_EXPORT CustomForceCompute : public ForceCompute
     {
@@ -32,7 +37,8 @@ class PYBIND11_EXPORT CustomForceCompute : public ForceCompute
     //! Constructs the compute
     CustomForceCompute(std::shared_ptr<hoomd::SystemDefinition> sysdef,
                        pybind11::object py_setForces,
-                       bool aniso);
+                       bool aniso,
+                       bool asynchronous = false);
 
     //! Destructor
     ~CustomForceCompute();
@@ -42,6 +48,11 @@ class PYBIND11_EXPORT CustomForceCompute : public ForceCompute
         return m_aniso;
         }
 
+    bool isAsynchronous()
+        {
+        return m_asynchronous;
+        }
+
     protected:
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
@@ -52,6 +63,9 @@ class PYBIND11_EXPORT CustomForceCompute : public ForceCompute
 
     //! flag for anisotropic python custom forces
     bool m_aniso;
+
+    //! flag to pass the GPU stream to the callback and skip device synchronization
+    bool m_asynchronous;
     };
 
     } // end namespace md
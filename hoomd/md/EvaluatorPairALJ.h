@@ -132,6 +132,24 @@ HOSTDEVICE inline void quat2mat(const quat<Scalar>& q, Scalar (&mat)[3][3])
         }
     }
 
+//! Copy a rotation matrix into the array form used by the ALJ potential.
+/*!
+ * \param rot The rotation matrix to copy.
+ * \param mat The output matrix (overwritten by reference).
+ */
+HOSTDEVICE inline void rotmat2mat(const rotmat3<Scalar>& rot, Scalar (&mat)[3][3])
+    {
+    mat[0][0] = rot.row0.x;
+    mat[0][1] = rot.row0.y;
+    mat[0][2] = rot.row0.z;
+    mat[1][0] = rot.row1.x;
+    mat[1][1] = rot.row1.y;
+    mat[1][2] = rot.row1.z;
+    mat[2][0] = rot.row2.x;
+    mat[2][1] = rot.row2.y;
+    mat[2][2] = rot.row2.z;
+    }
+
 //! Anisotropic LJ (ALJ) potential.
 /*! The ALJ potential is a generalization of Lennard-Jones potential for convex
  * anisotropic shapes. The potential is defined by a mean-field approximation
@@ -446,7 +464,8 @@ template<unsigned int ndim> class EvaluatorPairALJ
                                 Scalar4& _qj,
                                 Scalar _rcutsq,
                                 const param_type& _params)
-        : dr(_dr), rcutsq(_rcutsq), qi(_qi), qj(_qj), _params(_params)
+        : dr(_dr), rcutsq(_rcutsq), qi(_qi), qj(_qj), rot_i(nullptr), rot_j(nullptr),
+          _params(_params)
         {
         }
 
@@ -462,6 +481,12 @@ template<unsigned int ndim> class EvaluatorPairALJ
         return true;
         }
 
+    //! Whether the pair potential uses the per particle rotation matrices.
+    HOSTDEVICE static bool needsRotationMatrices()
+        {
+        return true;
+        }
+
     //! Whether pair potential requires charges
     HOSTDEVICE static bool needsCharge()
         {
@@ -494,6 +519,16 @@ template<unsigned int ndim> class EvaluatorPairALJ
         tag_j = tagj;
         }
 
+    //! Accept the optional rotation matrices
+    /*! \param roti Rotation matrix (body to space frame) of particle i
+        \param rotj Rotation matrix (body to space frame) of particle j
+    */
+    HOSTDEVICE void setRotationMatrices(const rotmat3<Scalar>* roti, const rotmat3<Scalar>* rotj)
+        {
+        rot_i = roti;
+        rot_j = rotj;
+        }
+
     //! Accept the optional charge values
     /*! \param qi Charge of particle i
         \param qj Charge of particle j
@@ -531,8 +566,17 @@ template<unsigned int ndim> class EvaluatorPairALJ
             // rotations. We create local scope for all the intermediate products to
             // avoid namespace pollution with unnecessary variables..
             Scalar mati[3][3], matj[3][3];
-            quat2mat(qi, mati);
-            quat2mat(qj, matj);
+            if (rot_i && rot_j)
+                {
+                // the matrices were computed once per particle by the caller
+                rotmat2mat(*rot_i, mati);
+                rotmat2mat(*rot_j, matj);
+                }
+            else
+                {
+                quat2mat(qi, mati);
+                quat2mat(qj, matj);
+                }
 
             // Call GJK. In order to ensure that Newton's third law is
             // obeyed, we must avoid any imbalance caused by numerical
@@ -834,15 +878,17 @@ template<unsigned int ndim> class EvaluatorPairALJ
             }
         }
 
-    vec3<Scalar> dr;           //!< Stored dr from the constructor
-    Scalar rcutsq;             //!< Stored rcutsq from the constructor
-    quat<Scalar> qi;           //!< Orientation quaternion for particle i
-    quat<Scalar> qj;           //!< Orientation quaternion for particle j
-    unsigned int tag_i;        //!< Tag of particle i.
-    unsigned int tag_j;        //!< Tag of particle j.
-    const shape_type* shape_i; //!< Shape parameters of particle i.
-    const shape_type* shape_j; //!< Shape parameters of particle j.
-    const param_type& _params; //!< Potential parameters for the pair of interest.
+    vec3<Scalar> dr;              //!< Stored dr from the constructor
+    Scalar rcutsq;                //!< Stored rcutsq from the constructor
+    quat<Scalar> qi;              //!< Orientation quaternion for particle i
+    quat<Scalar> qj;              //!< Orientation quaternion for particle j
+    const rotmat3<Scalar>* rot_i; //!< Cached rotation matrix of particle i (may be null)
+    const rotmat3<Scalar>* rot_j; //!< Cached rotation matrix of particle j (may be null)
+    unsigned int tag_i;           //!< Tag of particle i.
+    unsigned int tag_j;           //!< Tag of particle j.
+    const shape_type* shape_i;    //!< Shape parameters of particle i.
+    const shape_type* shape_j;    //!< Shape parameters of particle j.
+    const param_type& _params;    //!< Potential parameters for the pair of interest.
 
     constexpr static Scalar TWO_P_13 = 1.2599210498948732; // 2^(1/3)
     constexpr static Scalar SHIFT_RHO_DIFF = -0.25;        // (1/(2^(1/6)))**12 - (1/(2^(1/6)))**6
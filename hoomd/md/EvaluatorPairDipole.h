@@ -137,7 +137,8 @@ class EvaluatorPairDipole
                                    Scalar _rcutsq,
                                    const param_type& _params)
         : dr(_dr), rcutsq(_rcutsq), q_i(0), q_j(0), quat_i(_quat_i), quat_j(_quat_j),
-          mu_i {0, 0, 0}, mu_j {0, 0, 0}, A(_params.A), kappa(_params.kappa)
+          rot_i(nullptr), rot_j(nullptr), mu_i {0, 0, 0}, mu_j {0, 0, 0}, A(_params.A),
+          kappa(_params.kappa)
         {
         }
 
@@ -153,6 +154,12 @@ class EvaluatorPairDipole
         return false;
         }
 
+    //! Whether the pair potential uses the per particle rotation matrices.
+    HOSTDEVICE static bool needsRotationMatrices()
+        {
+        return true;
+        }
+
     //! whether pair potential requires charges
     HOSTDEVICE static bool needsCharge()
         {
@@ -181,6 +188,16 @@ class EvaluatorPairDipole
     */
     HOSTDEVICE void setTags(unsigned int tagi, unsigned int tagj) { }
 
+    //! Accept the optional rotation matrices
+    /*! \param roti Rotation matrix (body to space frame) of particle i
+        \param rotj Rotation matrix (body to space frame) of particle j
+    */
+    HOSTDEVICE void setRotationMatrices(const rotmat3<Scalar>* roti, const rotmat3<Scalar>* rotj)
+        {
+        rot_i = roti;
+        rot_j = rotj;
+        }
+
     //! Accept the optional charge values
     /*! \param qi Charge of particle i
         \param qj Charge of particle j
@@ -220,8 +237,17 @@ class EvaluatorPairDipole
 
         // convert dipole vector in the body frame of each particle to space
         // frame
-        vec3<Scalar> p_i = rotate(quat<Scalar>(quat_i), mu_i);
-        vec3<Scalar> p_j = rotate(quat<Scalar>(quat_j), mu_j);
+        vec3<Scalar> p_i, p_j;
+        if (rot_i && rot_j)
+            {
+            p_i = *rot_i * mu_i;
+            p_j = *rot_j * mu_j;
+            }
+        else
+            {
+            p_i = rotate(quat<Scalar>(quat_i), mu_i);
+            p_j = rotate(quat<Scalar>(quat_j), mu_j);
+            }
 
         vec3<Scalar> f;
         vec3<Scalar> t_i;
@@ -334,12 +360,14 @@ class EvaluatorPairDipole
 #endif
 
     protected:
-    Scalar3 dr;             //!< Stored vector pointing between particle centers of mass
-    Scalar rcutsq;          //!< Stored rcutsq from the constructor
-    Scalar q_i, q_j;        //!< Stored particle charges
-    Scalar4 quat_i, quat_j; //!< Stored quaternion of ith and jth particle from constructor
-    vec3<Scalar> mu_i;      /// Magnetic moment for ith particle
-    vec3<Scalar> mu_j;      /// Magnetic moment for jth particle
+    Scalar3 dr;                   //!< Stored vector pointing between particle centers of mass
+    Scalar rcutsq;                //!< Stored rcutsq from the constructor
+    Scalar q_i, q_j;              //!< Stored particle charges
+    Scalar4 quat_i, quat_j;       //!< Stored quaternion of ith and jth particle from constructor
+    const rotmat3<Scalar>* rot_i; //!< Cached rotation matrix of particle i (may be null)
+    const rotmat3<Scalar>* rot_j; //!< Cached rotation matrix of particle j (may be null)
+    vec3<Scalar> mu_i;            /// Magnetic moment for ith particle
+    vec3<Scalar> mu_j;            /// Magnetic moment for jth particle
     Scalar A;
     Scalar kappa;
     // const param_type &params;   //!< The pair potential parameters
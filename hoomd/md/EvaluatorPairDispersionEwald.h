@@ -0,0 +1,193 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_DISPERSION_EWALD_H__
+#define __PAIR_EVALUATOR_DISPERSION_EWALD_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file EvaluatorPairDispersionEwald.h
+    \brief Defines the pair evaluator class for the real space part of Ewald summed dispersion
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for evaluating the real space correction of Ewald summed dispersion
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>DispersionEwald specifics</b>
+
+    PPPMDispersionForceCompute evaluates the long range part
+    \f[ -C_6 \frac{1 - g(\beta r)}{r^6} \f]
+    of the dispersion interaction \f$ -C_6 / r^6 \f$ between all pairs of particles, where
+    \f[ g(x) = e^{-x^2} \left(1 + x^2 + \frac{x^4}{2} \right). \f]
+    EvaluatorPairDispersionEwald evaluates
+    \f[ V(r) = C_6 \frac{1 - g(\beta r)}{r^6} \f]
+    which removes the long range part inside the cutoff. Sum it with a short range potential that
+    includes the full dispersion term (see EvaluatorPairLJDispersionEwald).
+*/
+class EvaluatorPairDispersionEwald
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        Scalar c6;
+        Scalar beta;
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes) { }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const { }
+
+#ifdef ENABLE_HIP
+        // set CUDA memory hints
+        void set_memory_hint() const
+            {
+            // default implementation does nothing
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type()
+            {
+            c6 = 0;
+            beta = 0;
+            }
+
+        param_type(pybind11::dict v, bool managed = false)
+            {
+            c6 = v["c6"].cast<Scalar>();
+            beta = v["beta"].cast<Scalar>();
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v;
+            v["c6"] = c6;
+            v["beta"] = beta;
+            return v;
+            }
+#endif
+        }
+#if HOOMD_LONGREAL_SIZE == 32
+        __attribute__((aligned(8)));
+#else
+        __attribute__((aligned(16)));
+#endif
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairDispersionEwald(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : rsq(_rsq), rcutsq(_rcutsq), c6(_params.c6), beta(_params.beta)
+        {
+        }
+
+    //! DispersionEwald doesn't use charge
+    DEVICE static bool needsCharge()
+        {
+        return false;
+        }
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj) { }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at the
+       cutoff \note There is no need to check if rsq < rcutsq in this method. Cutoff tests are
+       performed in PotentialPair.
+
+        \return True if they are evaluated or false if they are not because we are beyond the cutoff
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        if (rsq < rcutsq && c6 != 0)
+            {
+            Scalar r2inv = Scalar(1.0) / rsq;
+            Scalar r6inv = r2inv * r2inv * r2inv;
+            Scalar x2 = beta * beta * rsq;
+            Scalar exp_val = fast::exp(-x2);
+            Scalar one_minus_g
+                = Scalar(1.0) - exp_val * (Scalar(1.0) + x2 + Scalar(0.5) * x2 * x2);
+
+            pair_eng = c6 * one_minus_g * r6inv;
+            force_divr = c6 * r6inv * r2inv
+                         * (Scalar(6.0) * one_minus_g - exp_val * x2 * x2 * x2);
+
+            if (energy_shift)
+                {
+                Scalar rcut6inv = Scalar(1.0) / (rcutsq * rcutsq * rcutsq);
+                Scalar x2_cut = beta * beta * rcutsq;
+                pair_eng
+                    -= c6 * rcut6inv
+                       * (Scalar(1.0)
+                          - fast::exp(-x2_cut)
+                                * (Scalar(1.0) + x2_cut + Scalar(0.5) * x2_cut * x2_cut));
+                }
+            return true;
+            }
+        else
+            return false;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return 0;
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return 0;
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return std::string("dispersion_ewald");
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    Scalar rsq;    //!< Stored rsq from the constructor
+    Scalar rcutsq; //!< Stored rcutsq from the constructor
+    Scalar c6;     //!< Dispersion coefficient handled by the mesh
+    Scalar beta;   //!< Splitting parameter
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_DISPERSION_EWALD_H__
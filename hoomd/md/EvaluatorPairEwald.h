@@ -42,6 +42,13 @@ namespace md
     V_{\mathrm{ewald}}(r)  = q_i q_j \left[\mathrm{erfc}\left(\kappa r +
    \frac{\alpha}{2\kappa}\right) \exp(\alpha r)+ \mathrm{erfc}\left(\kappa r - \frac{\alpha}{2
    \kappa}\right) \exp(-\alpha r)\right] \f]
+
+    Without screening (\f$ \alpha = 0 \f$, the real space term of PPPM) the two terms are equal and
+    the evaluator computes one erfc and one exp per pair.
+
+    When approximate_erfc is set, erfc is evaluated with the rational approximation of Abramowitz
+    and Stegun 7.1.26, which has an absolute error below 1.5e-7 and shares its Gaussian factor
+    with the force. The error of the energy is then below 1.5e-7 \f$ q_i q_j \exp(\alpha r) / r \f$.
 */
 class EvaluatorPairEwald
     {
@@ -51,6 +58,7 @@ class EvaluatorPairEwald
         {
         Scalar kappa;
         Scalar alpha;
+        bool approximate_erfc;
 
         DEVICE void load_shared(char*& ptr, unsigned int& available_bytes) { }
 
@@ -62,12 +70,13 @@ class EvaluatorPairEwald
 #endif
 
 #ifndef __HIPCC__
-        param_type() : kappa(0), alpha(0) { }
+        param_type() : kappa(0), alpha(0), approximate_erfc(false) { }
 
         param_type(pybind11::dict v, bool managed = false)
             {
             kappa = v["kappa"].cast<Scalar>();
             alpha = v["alpha"].cast<Scalar>();
+            approximate_erfc = v["approximate_erfc"].cast<bool>();
             }
 
         pybind11::dict asDict()
@@ -75,6 +84,7 @@ class EvaluatorPairEwald
             pybind11::dict v;
             v["kappa"] = kappa;
             v["alpha"] = alpha;
+            v["approximate_erfc"] = approximate_erfc;
             return v;
             }
 #endif
@@ -91,7 +101,8 @@ class EvaluatorPairEwald
         \param _params Per type pair parameters of this potential
     */
     DEVICE EvaluatorPairEwald(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
-        : rsq(_rsq), rcutsq(_rcutsq), kappa(_params.kappa), alpha(_params.alpha)
+        : rsq(_rsq), rcutsq(_rcutsq), kappa(_params.kappa), alpha(_params.alpha),
+          approximate_erfc(_params.approximate_erfc)
         {
         }
 
@@ -126,19 +137,35 @@ class EvaluatorPairEwald
             Scalar r = Scalar(1.0) / rinv;
             Scalar r2inv = Scalar(1.0) / rsq;
 
+            if (alpha == Scalar(0.0))
+                {
+                // both terms reduce to erfc(kappa r) / r
+                Scalar arg = kappa * r;
+                Scalar gauss;
+                Scalar erfc_val = evalErfc(arg, gauss);
+                Scalar val = erfc_val * rinv;
+
+                force_divr = qiqj * r2inv
+                             * (val + Scalar(2.0) * kappa * gauss / fast::sqrt(Scalar(M_PI)));
+                pair_eng = qiqj * val;
+
+                return true;
+                }
+
             Scalar arg1 = kappa * r + alpha / (Scalar(2.0) * kappa);
             Scalar arg2 = kappa * r - alpha / (Scalar(2.0) * kappa);
             Scalar expfac1 = fast::exp(alpha * r);
             Scalar expfac2 = fast::exp(-alpha * r);
-            Scalar val
-                = Scalar(0.5) * (fast::erfc(arg1) * expfac1 + fast::erfc(arg2) * expfac2) * rinv;
+            Scalar gauss1, gauss2;
+            Scalar erfc1 = evalErfc(arg1, gauss1);
+            Scalar erfc2 = evalErfc(arg2, gauss2);
+            Scalar val = Scalar(0.5) * (erfc1 * expfac1 + erfc2 * expfac2) * rinv;
 
             force_divr = qiqj * r2inv
                          * (val
-                            + expfac2 * Scalar(2.0) * kappa * fast::exp(-arg2 * arg2)
-                                  / fast::sqrt(Scalar(M_PI))
-                            + alpha * Scalar(0.5) * expfac2 * fast::erfc(arg2)
-                            - alpha * Scalar(0.5) * expfac1 * fast::erfc(arg1));
+                            + expfac2 * Scalar(2.0) * kappa * gauss2 / fast::sqrt(Scalar(M_PI))
+                            + alpha * Scalar(0.5) * expfac2 * erfc2
+                            - alpha * Scalar(0.5) * expfac1 * erfc1);
             pair_eng = qiqj * val;
 
             return true;
@@ -173,11 +200,44 @@ class EvaluatorPairEwald
 #endif
 
     protected:
-    Scalar rsq;    //!< Stored rsq from the constructor
-    Scalar rcutsq; //!< Stored rcutsq from the constructor
-    Scalar kappa;  //!< Splitting parameter
-    Scalar alpha;  //!< Debye screening parameter
-    Scalar qiqj;   //!< product of qi and qj
+    //! Evaluate erfc(x) and the Gaussian exp(-x^2)
+    /*! \param x Argument
+        \param gauss Output parameter to write exp(-x^2)
+
+        With approximate_erfc, erfc(|x|) = t P(t) exp(-x^2) where t = 1 / (1 + p |x|) and P is the
+        polynomial of Abramowitz and Stegun 7.1.26, and erfc(x) = 2 - erfc(-x) for negative x.
+
+        \returns erfc(x)
+    */
+    DEVICE Scalar evalErfc(Scalar x, Scalar& gauss) const
+        {
+        gauss = fast::exp(-x * x);
+
+        if (!approximate_erfc)
+            {
+            return fast::erfc(x);
+            }
+
+        const Scalar p = Scalar(0.3275911);
+        const Scalar a1 = Scalar(0.254829592);
+        const Scalar a2 = Scalar(-0.284496736);
+        const Scalar a3 = Scalar(1.421413741);
+        const Scalar a4 = Scalar(-1.453152027);
+        const Scalar a5 = Scalar(1.061405429);
+
+        Scalar abs_x = x < Scalar(0.0) ? -x : x;
+        Scalar t = Scalar(1.0) / (Scalar(1.0) + p * abs_x);
+        Scalar erfc_abs_x = t * (a1 + t * (a2 + t * (a3 + t * (a4 + t * a5)))) * gauss;
+
+        return x < Scalar(0.0) ? Scalar(2.0) - erfc_abs_x : erfc_abs_x;
+        }
+
+    Scalar rsq;            //!< Stored rsq from the constructor
+    Scalar rcutsq;         //!< Stored rcutsq from the constructor
+    Scalar kappa;          //!< Splitting parameter
+    Scalar alpha;          //!< Debye screening parameter
+    bool approximate_erfc; //!< True to approximate erfc with a polynomial
+    Scalar qiqj;           //!< product of qi and qj
     };
 
     } // end namespace md
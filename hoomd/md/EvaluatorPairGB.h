@@ -141,8 +141,8 @@ class EvaluatorPairGB
                                const Scalar4& _qj,
                                const Scalar _rcutsq,
                                const param_type& _params)
-        : dr(_dr), rcutsq(_rcutsq), qi(_qi), qj(_qj), epsilon(_params.epsilon),
-          lperp(_params.lperp), lpar(_params.lpar)
+        : dr(_dr), rcutsq(_rcutsq), qi(_qi), qj(_qj), rot_i(nullptr), rot_j(nullptr),
+          epsilon(_params.epsilon), lperp(_params.lperp), lpar(_params.lpar)
         {
         }
 
@@ -158,6 +158,12 @@ class EvaluatorPairGB
         return false;
         }
 
+    //! Whether the pair potential uses the per particle rotation matrices.
+    HOSTDEVICE static bool needsRotationMatrices()
+        {
+        return true;
+        }
+
     //! whether pair potential requires charges
     HOSTDEVICE static bool needsCharge()
         {
@@ -182,6 +188,16 @@ class EvaluatorPairGB
     */
     HOSTDEVICE void setTags(unsigned int tagi, unsigned int tagj) { }
 
+    //! Accept the optional rotation matrices
+    /*! \param roti Rotation matrix (body to space frame) of particle i
+        \param rotj Rotation matrix (body to space frame) of particle j
+    */
+    HOSTDEVICE void setRotationMatrices(const rotmat3<Scalar>* roti, const rotmat3<Scalar>* rotj)
+        {
+        rot_i = roti;
+        rot_j = rotj;
+        }
+
     //! Accept the optional charge values
     /*! \param qi Charge of particle i
         \param qj Charge of particle j
@@ -206,13 +222,24 @@ class EvaluatorPairGB
         Scalar r = fast::sqrt(rsq);
         vec3<Scalar> unitr = fast::rsqrt(dot(dr, dr)) * dr;
 
-        // obtain rotation matrices (space->body)
-        rotmat3<Scalar> rotA(conj(qi));
-        rotmat3<Scalar> rotB(conj(qj));
+        // body frame z axis of each particle in the space frame
+        vec3<Scalar> a3, b3;
+        if (rot_i && rot_j)
+            {
+            // last column of the cached body->space rotation matrices
+            a3 = vec3<Scalar>(rot_i->row0.z, rot_i->row1.z, rot_i->row2.z);
+            b3 = vec3<Scalar>(rot_j->row0.z, rot_j->row1.z, rot_j->row2.z);
+            }
+        else
+            {
+            // obtain rotation matrices (space->body)
+            rotmat3<Scalar> rotA(conj(qi));
+            rotmat3<Scalar> rotB(conj(qj));
 
-        // last row of rotation matrix
-        vec3<Scalar> a3 = rotA.row2;
-        vec3<Scalar> b3 = rotB.row2;
+            // last row of rotation matrix
+            a3 = rotA.row2;
+            b3 = rotB.row2;
+            }
 
         Scalar ca = dot(a3, unitr);
         Scalar cb = dot(b3, unitr);
@@ -311,10 +338,12 @@ class EvaluatorPairGB
 #endif
 
     protected:
-    vec3<Scalar> dr; //!< Stored dr from the constructor
-    Scalar rcutsq;   //!< Stored rcutsq from the constructor
-    quat<Scalar> qi; //!< Orientation quaternion for particle i
-    quat<Scalar> qj; //!< Orientation quaternion for particle j
+    vec3<Scalar> dr;              //!< Stored dr from the constructor
+    Scalar rcutsq;                //!< Stored rcutsq from the constructor
+    quat<Scalar> qi;              //!< Orientation quaternion for particle i
+    quat<Scalar> qj;              //!< Orientation quaternion for particle j
+    const rotmat3<Scalar>* rot_i; //!< Cached rotation matrix of particle i (may be null)
+    const rotmat3<Scalar>* rot_j; //!< Cached rotation matrix of particle j (may be null)
     Scalar epsilon;
     Scalar lperp;
     Scalar lpar;
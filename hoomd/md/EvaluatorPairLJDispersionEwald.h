@@ -0,0 +1,26 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_LJ_DISPERSION_EWALD_H__
+#define __PAIR_EVALUATOR_LJ_DISPERSION_EWALD_H__
+
+#include "EvaluatorPairDispersionEwald.h"
+#include "EvaluatorPairLJ.h"
+#include "EvaluatorPairSum.h"
+
+/*! \file EvaluatorPairLJDispersionEwald.h
+    \brief Defines the pair evaluator class for the LJ potential with Ewald summed dispersion
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Evaluates the real space part of the LJ potential with Ewald summed dispersion
+typedef EvaluatorPairSum<EvaluatorPairLJ, EvaluatorPairDispersionEwald>
+    EvaluatorPairLJDispersionEwald;
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_LJ_DISPERSION_EWALD_H__
@@ -189,9 +189,10 @@ class EvaluatorPairLJGauss
     /** Update parameters with alchemical degrees of freedom.
 
         Interoperate with PotentialPairAlchemical to modify the given potential parameters:
-        p -> p * alpha, where p is a parameter.
+        p -> p * alpha, where p is a parameter. \a alphas is a std::array on the host and a plain
+        array in GPU kernels.
     */
-    DEVICE void updateAlchemyParams(const std::array<Scalar, num_alchemical_parameters>& alphas)
+    template<class alpha_array_t> DEVICE void updateAlchemyParams(const alpha_array_t& alphas)
         {
         epsilon *= alphas[0];
         sigma *= alphas[1];
@@ -216,11 +217,12 @@ class EvaluatorPairLJGauss
 
     /** Calculate derivative of the alchemical potential with repsect to alpha.
 
-        Interoperate with PotentialPairAlchemical to compute dU/d alpha.
+        Interoperate with PotentialPairAlchemical to compute dU/d alpha. The arrays are std::array
+        on the host and plain arrays in GPU kernels.
     */
-    DEVICE void
-    evalAlchemyDerivatives(std::array<Scalar, num_alchemical_parameters>& alchemical_derivatives,
-                           const std::array<Scalar, num_alchemical_parameters>& alphas)
+    template<class alpha_array_t>
+    DEVICE void evalAlchemyDerivatives(alpha_array_t& alchemical_derivatives,
+                                       const alpha_array_t& alphas)
         {
             {
             Scalar r = fast::sqrt(rsq);
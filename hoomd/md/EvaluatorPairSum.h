@@ -0,0 +1,239 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_SUM_H__
+#define __PAIR_EVALUATOR_SUM_H__
+
+#ifndef __HIPCC__
+#include <pybind11/pybind11.h>
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file EvaluatorPairSum.h
+    \brief Defines the pair evaluator class that sums two pair evaluators
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+template<class EvaluatorA, class EvaluatorB> class EvaluatorPairSum;
+
+#ifndef __HIPCC__
+namespace detail
+    {
+//! Locate the parameters of one component of an EvaluatorPairSum in a Python dictionary
+/*! The parameters of a component evaluator are stored under the key getName(). The components of a
+    nested EvaluatorPairSum share the dictionary of the enclosing sum.
+*/
+template<class evaluator> struct PairSumParameters
+    {
+    static pybind11::dict get(pybind11::dict v)
+        {
+        return v[evaluator::getName().c_str()];
+        }
+
+    static void set(pybind11::dict v, pybind11::dict params)
+        {
+        v[evaluator::getName().c_str()] = params;
+        }
+    };
+
+template<class EvaluatorA, class EvaluatorB>
+struct PairSumParameters<EvaluatorPairSum<EvaluatorA, EvaluatorB>>
+    {
+    static pybind11::dict get(pybind11::dict v)
+        {
+        return v;
+        }
+
+    static void set(pybind11::dict v, pybind11::dict params)
+        {
+        for (auto item : params)
+            v[item.first] = item.second;
+        }
+    };
+    } // end namespace detail
+#endif
+
+//! Class for evaluating the sum of two pair potentials
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>Sum specifics</b>
+
+    EvaluatorPairSum evaluates
+    \f[ V(r) = V_A(r) + V_B(r) \f]
+    where \f$ V_A \f$ and \f$ V_B \f$ are computed by the pair evaluators \a EvaluatorA and
+    \a EvaluatorB. Nest EvaluatorPairSum in \a EvaluatorB to sum more than two potentials.
+
+    Use EvaluatorPairSum to compute several potentials that act between the same particles in a
+    single PotentialPair. All components are evaluated during one pass over the neighbor list and
+    accumulate into one force array, where separate PotentialPair instances each load the particle
+    data and neighbor list and write their own force arrays for computeNetForce to sum.
+
+    Both components share the cutoff and shift mode of the PotentialPair. The parameters of each
+    component are stored in a dictionary under the component's getName().
+*/
+template<class EvaluatorA, class EvaluatorB> class EvaluatorPairSum
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        typename EvaluatorA::param_type a; //!< Parameters of the first component
+        typename EvaluatorB::param_type b; //!< Parameters of the second component
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            a.load_shared(ptr, available_bytes);
+            b.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            a.allocate_shared(ptr, available_bytes);
+            b.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        // set CUDA memory hints
+        void set_memory_hint() const
+            {
+            a.set_memory_hint();
+            b.set_memory_hint();
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : a(), b() { }
+
+        param_type(pybind11::dict v, bool managed = false)
+            : a(detail::PairSumParameters<EvaluatorA>::get(v), managed),
+              b(detail::PairSumParameters<EvaluatorB>::get(v), managed)
+            {
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v;
+            detail::PairSumParameters<EvaluatorA>::set(v, a.asDict());
+            detail::PairSumParameters<EvaluatorB>::set(v, b.asDict());
+            return v;
+            }
+#endif
+        };
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairSum(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : eval_a(_rsq, _rcutsq, _params.a), eval_b(_rsq, _rcutsq, _params.b)
+        {
+        }
+
+    //! Sum needs charge when either component does
+    DEVICE static bool needsCharge()
+        {
+        return EvaluatorA::needsCharge() || EvaluatorB::needsCharge();
+        }
+
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj)
+        {
+        if (EvaluatorA::needsCharge())
+            eval_a.setCharge(qi, qj);
+        if (EvaluatorB::needsCharge())
+            eval_b.setCharge(qi, qj);
+        }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at the
+       cutoff \note There is no need to check if rsq < rcutsq in this method. Cutoff tests are
+       performed in PotentialPair.
+
+        \return True if either component is evaluated or false if neither is
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        Scalar force_divr_a = Scalar(0.0);
+        Scalar pair_eng_a = Scalar(0.0);
+        Scalar force_divr_b = Scalar(0.0);
+        Scalar pair_eng_b = Scalar(0.0);
+
+        bool evaluated_a = eval_a.evalForceAndEnergy(force_divr_a, pair_eng_a, energy_shift);
+        bool evaluated_b = eval_b.evalForceAndEnergy(force_divr_b, pair_eng_b, energy_shift);
+
+        if (!evaluated_a && !evaluated_b)
+            return false;
+
+        force_divr = Scalar(0.0);
+        pair_eng = Scalar(0.0);
+        if (evaluated_a)
+            {
+            force_divr += force_divr_a;
+            pair_eng += pair_eng_a;
+            }
+        if (evaluated_b)
+            {
+            force_divr += force_divr_b;
+            pair_eng += pair_eng_b;
+            }
+        return true;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return eval_a.evalPressureLRCIntegral() + eval_b.evalPressureLRCIntegral();
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return eval_a.evalEnergyLRCIntegral() + eval_b.evalEnergyLRCIntegral();
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return EvaluatorA::getName() + "_" + EvaluatorB::getName();
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    EvaluatorA eval_a; //!< Evaluator of the first component
+    EvaluatorB eval_b; //!< Evaluator of the second component
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_SUM_H__
@@ -1,8 +1,10 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/HOOMDMath.h"
 #include "hoomd/ManagedArray.h"
 #include <memory>
+#include <string>
 
 // need to declare these class methods with __device__ qualifiers when building in nvcc
 #ifdef __HIPCC__
@@ -36,7 +38,15 @@ namespace md
     of V at r=rmin + dr*i where i is chosen such that r >= rmin and r < rcut. V(r) and F(r) for
     r < rmin and r >= rcut is 0.
 
-    V and F Values are interpolated linearly between two points on either side of the given r.
+    By default, V and F values are interpolated linearly between two points on either side of the
+    given r. In cubic mode, V is interpolated by the cubic Hermite spline that matches V and
+    -F = dV/dr at both points, and F is computed from the derivative of the same spline. The spline
+    is accurate to third order in dr (linear interpolation is accurate to first order), so coarser
+    tables reach the same accuracy. The force is consistent with the interpolated energy, which
+    improves energy conservation.
+
+    The cubic table stores V(i), V(i+1), F(i), and F(i+1) in one Scalar4 per interval so that an
+    evaluation reads a single element. The table of the last interval ends at r=rcut with V=F=0.
 */
 class EvaluatorPairTable
     {
@@ -44,9 +54,10 @@ class EvaluatorPairTable
     //! Define the parameter type used by this pair potential evaluator
     struct param_type
         {
-        Scalar rmin;                  //!< the distance of the first index of the table potential
-        ManagedArray<Scalar> V_table; //!< the tabulated energy
-        ManagedArray<Scalar> F_table; //!< the tabulated force specifically - (dV / dr)
+        Scalar rmin;                       //!< the distance of the first index of the table
+        ManagedArray<Scalar> V_table;      //!< the tabulated energy (linear mode)
+        ManagedArray<Scalar> F_table;      //!< the tabulated force - (dV / dr) (linear mode)
+        ManagedArray<Scalar4> cubic_table; //!< V and F at the ends of each interval (cubic mode)
 
         //! Load dynamic data members into shared memory and increase pointer
         /*! \param ptr Pointer to load data to (will be incremented)
@@ -56,12 +67,14 @@ class EvaluatorPairTable
             {
             V_table.load_shared(ptr, available_bytes);
             F_table.load_shared(ptr, available_bytes);
+            cubic_table.load_shared(ptr, available_bytes);
             }
 
         HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
             {
             V_table.allocate_shared(ptr, available_bytes);
             F_table.allocate_shared(ptr, available_bytes);
+            cubic_table.allocate_shared(ptr, available_bytes);
             }
 
 #ifdef ENABLE_HIP
@@ -70,6 +83,7 @@ class EvaluatorPairTable
             {
             V_table.set_memory_hint();
             F_table.set_memory_hint();
+            cubic_table.set_memory_hint();
             }
 #endif
 
@@ -93,19 +107,61 @@ class EvaluatorPairTable
 
             size_t width = V_py.size();
             rmin = v["r_min"].cast<Scalar>();
-            V_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
-            F_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
-            std::copy(V_py.data(0), V_py.data(0) + width, V_table.get());
-            std::copy(F_py.data(0), F_py.data(0) + width, F_table.get());
+
+            std::string interpolation = "linear";
+            if (v.contains("interpolation"))
+                {
+                interpolation = v["interpolation"].cast<std::string>();
+                }
+
+            if (interpolation == "linear")
+                {
+                V_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
+                F_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
+                std::copy(V_py.data(0), V_py.data(0) + width, V_table.get());
+                std::copy(F_py.data(0), F_py.data(0) + width, F_table.get());
+                }
+            else if (interpolation == "cubic")
+                {
+                cubic_table = ManagedArray<Scalar4>(static_cast<unsigned int>(width), managed);
+                for (size_t i = 0; i < width; i++)
+                    {
+                    Scalar V1 = i + 1 < width ? V_py(i + 1) : Scalar(0.0);
+                    Scalar F1 = i + 1 < width ? F_py(i + 1) : Scalar(0.0);
+                    cubic_table[static_cast<unsigned int>(i)]
+                        = make_scalar4(V_py(i), V1, F_py(i), F1);
+                    }
+                }
+            else
+                {
+                throw std::runtime_error("Invalid interpolation: " + interpolation);
+                }
             }
 
         pybind11::dict asDict() const
             {
-            const auto V = pybind11::array_t<Scalar>(V_table.size(), V_table.get());
-            const auto F = pybind11::array_t<Scalar>(F_table.size(), F_table.get());
             auto params = pybind11::dict();
-            params["U"] = V;
-            params["F"] = F;
+            if (cubic_table.size() > 0)
+                {
+                auto V = pybind11::array_t<Scalar>(cubic_table.size());
+                auto F = pybind11::array_t<Scalar>(cubic_table.size());
+                auto V_access = V.mutable_unchecked<1>();
+                auto F_access = F.mutable_unchecked<1>();
+                for (unsigned int i = 0; i < cubic_table.size(); i++)
+                    {
+                    V_access(i) = cubic_table[i].x;
+                    F_access(i) = cubic_table[i].z;
+                    }
+                params["U"] = V;
+                params["F"] = F;
+                params["interpolation"] = "cubic";
+                }
+            else
+                {
+                params["U"] = pybind11::array_t<Scalar>(V_table.size(), V_table.get());
+                params["F"] = pybind11::array_t<Scalar>(F_table.size(), F_table.get());
+                params["interpolation"] = "linear";
+                }
             params["r_min"] = rmin;
             return params;
             }
@@ -124,7 +180,7 @@ class EvaluatorPairTable
     */
     DEVICE EvaluatorPairTable(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
         : rsq(_rsq), rcutsq(_rcutsq), rmin(_params.rmin), V_table(_params.V_table),
-          F_table(_params.F_table)
+          F_table(_params.F_table), cubic_table(_params.cubic_table)
         {
         }
 
@@ -151,7 +207,8 @@ class EvaluatorPairTable
     DEVICE bool
     evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, const bool energy_shift) const
         {
-        unsigned int width = V_table.size();
+        const bool cubic = cubic_table.size() > 0;
+        unsigned int width = cubic ? cubic_table.size() : V_table.size();
 
         const Scalar r = fast::sqrt(rsq);
         // compute the force divided by r in force_divr
@@ -166,6 +223,31 @@ class EvaluatorPairTable
 
         // compute index into the table and read in values
         unsigned int value_i = static_cast<unsigned int>(slow::floor(value_f));
+
+        if (cubic)
+            {
+            // V and F at both ends of the interval
+            const Scalar4 knots = cubic_table[value_i];
+            const Scalar t = value_f - Scalar(value_i);
+
+            // tangents of the Hermite spline in units of the interval
+            const Scalar dV = knots.y - knots.x;
+            const Scalar m0 = -knots.z * delta_r;
+            const Scalar m1 = -knots.w * delta_r;
+            const Scalar c2 = Scalar(3.0) * dV - Scalar(2.0) * m0 - m1;
+            const Scalar c3 = m0 + m1 - Scalar(2.0) * dV;
+
+            const Scalar V = knots.x + t * (m0 + t * (c2 + t * c3));
+            const Scalar dV_dt = m0 + t * (Scalar(2.0) * c2 + Scalar(3.0) * t * c3);
+
+            if (rsq > Scalar(0.0))
+                {
+                force_divr = -dV_dt / (delta_r * r);
+                }
+            pair_eng = V;
+            return true;
+            }
+
         // unpack the data
         const Scalar V0 = V_table[value_i];
         const Scalar F0 = F_table[value_i];
@@ -219,12 +301,13 @@ class EvaluatorPairTable
 #endif
 
     protected:
-    Scalar rsq;                          //!< distance squared
-    Scalar rcutsq;                       //!< the potential cuttoff distance squared
-    size_t width;                        //!< the distance between table indices
-    Scalar rmin;                         //!< the distance of the first index of the table potential
-    const ManagedArray<Scalar>& V_table; //!< the tabulated energy
-    const ManagedArray<Scalar>& F_table; //!< the tabulated force specifically - (dV / dr)
+    Scalar rsq;                               //!< distance squared
+    Scalar rcutsq;                            //!< the potential cuttoff distance squared
+    size_t width;                             //!< the distance between table indices
+    Scalar rmin;                              //!< the distance of the first index of the table
+    const ManagedArray<Scalar>& V_table;      //!< the tabulated energy
+    const ManagedArray<Scalar>& F_table;      //!< the tabulated force specifically - (dV / dr)
+    const ManagedArray<Scalar4>& cubic_table; //!< V and F at both ends of each interval
     };
 
     } // end namespace md
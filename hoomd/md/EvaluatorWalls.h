@@ -139,10 +139,31 @@ template<class evaluator> class EvaluatorWalls
                           const BoxDim& box,
                           const param_type& p,
                           const field_type& f)
-        : m_pos(pos), m_field(f), m_params(p)
+        : m_pos(pos), m_field(f), m_params(p), m_walls(nullptr), m_n_spheres(f.numSpheres),
+          m_n_cylinders(f.numCylinders), m_n_planes(f.numPlanes)
         {
         }
 
+    //! Evaluate only a subset of the walls
+    /*! \param walls Indices of the spheres, followed by the cylinders, followed by the planes
+        \param n_spheres Number of sphere indices
+        \param n_cylinders Number of cylinder indices
+        \param n_planes Number of plane indices
+
+        The walls that are not in the list must have no interaction with the particle (see
+        WallCellList).
+    */
+    DEVICE void setWallList(const unsigned char* walls,
+                            unsigned int n_spheres,
+                            unsigned int n_cylinders,
+                            unsigned int n_planes)
+        {
+        m_walls = walls;
+        m_n_spheres = n_spheres;
+        m_n_cylinders = n_cylinders;
+        m_n_planes = n_planes;
+        }
+
     DEVICE static bool isAnisotropic()
         {
         return false;
@@ -262,8 +283,9 @@ template<class evaluator> class EvaluatorWalls
             {
             Scalar rextrapsq = m_params.rextrap * m_params.rextrap;
             Scalar rsq;
-            for (unsigned int k = 0; k < m_field.numSpheres; k++)
+            for (unsigned int i = 0; i < m_n_spheres; i++)
                 {
+                const unsigned int k = m_walls ? m_walls[i] : i;
                 drv = distVectorWallToPoint(m_field.Spheres[k], position, in_active_space);
                 rsq = dot(drv, drv);
                 if (in_active_space && rsq >= rextrapsq)
@@ -291,8 +313,9 @@ template<class evaluator> class EvaluatorWalls
                     }
                 }
             vec3<Scalar> intermediate_distance_vector;
-            for (unsigned int k = 0; k < m_field.numCylinders; k++)
+            for (unsigned int i = 0; i < m_n_cylinders; i++)
                 {
+                const unsigned int k = m_walls ? m_walls[m_n_spheres + i] : i;
                 drv = distVectorWallToPoint(m_field.Cylinders[k], position, in_active_space);
                 rsq = dot(drv, drv);
                 if (in_active_space && rsq >= rextrapsq)
@@ -316,8 +339,9 @@ template<class evaluator> class EvaluatorWalls
                     extrapEvaluator(F, energy, drv, rextrapsq, r);
                     }
                 }
-            for (unsigned int k = 0; k < m_field.numPlanes; k++)
+            for (unsigned int i = 0; i < m_n_planes; i++)
                 {
+                const unsigned int k = m_walls ? m_walls[m_n_spheres + m_n_cylinders + i] : i;
                 drv = distVectorWallToPoint(m_field.Planes[k], position, in_active_space);
                 rsq = dot(drv, drv);
                 if (in_active_space && rsq >= rextrapsq)
@@ -344,24 +368,27 @@ template<class evaluator> class EvaluatorWalls
             }
         else // normal mode
             {
-            for (unsigned int k = 0; k < m_field.numSpheres; k++)
+            for (unsigned int i = 0; i < m_n_spheres; i++)
                 {
+                const unsigned int k = m_walls ? m_walls[i] : i;
                 drv = distVectorWallToPoint(m_field.Spheres[k], position, in_active_space);
                 if (in_active_space)
                     {
                     callEvaluator(F, energy, drv);
                     }
                 }
-            for (unsigned int k = 0; k < m_field.numCylinders; k++)
+            for (unsigned int i = 0; i < m_n_cylinders; i++)
                 {
+                const unsigned int k = m_walls ? m_walls[m_n_spheres + i] : i;
                 drv = distVectorWallToPoint(m_field.Cylinders[k], position, in_active_space);
                 if (in_active_space)
                     {
                     callEvaluator(F, energy, drv);
                     }
                 }
-            for (unsigned int k = 0; k < m_field.numPlanes; k++)
+            for (unsigned int i = 0; i < m_n_planes; i++)
                 {
+                const unsigned int k = m_walls ? m_walls[m_n_spheres + m_n_cylinders + i] : i;
                 drv = distVectorWallToPoint(m_field.Planes[k], position, in_active_space);
                 if (in_active_space)
                     {
@@ -394,6 +421,10 @@ template<class evaluator> class EvaluatorWalls
     const field_type& m_field; //!< contains all information about the walls.
     param_type m_params;
     Scalar qi;
+    const unsigned char* m_walls; //!< Indices of the walls to evaluate, nullptr evaluates all
+    unsigned int m_n_spheres;     //!< Number of spheres to evaluate
+    unsigned int m_n_cylinders;   //!< Number of cylinders to evaluate
+    unsigned int m_n_planes;      //!< Number of planes to evaluate
     };
 
     } // end namespace md
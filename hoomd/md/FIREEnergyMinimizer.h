@@ -40,6 +40,15 @@ class PYBIND11_EXPORT FIREEnergyMinimizer : public IntegratorTwoStep
     //! Perform one minimization iteration
     virtual void update(uint64_t timestep);
 
+    //! Get needed pdata flags
+    virtual PDataFlags getRequestedPDataFlags()
+        {
+        // the energy convergence test reads the potential energy on every step
+        PDataFlags flags = IntegratorTwoStep::getRequestedPDataFlags();
+        flags[pdata_flag::potential_energy] = 1;
+        return flags;
+        }
+
     //! Return whether or not the minimization has converged
     bool hasConverged() const
         {
@@ -314,7 +314,8 @@ void ForceCompositeGPU::updateCompositeParticles(uint64_t timestep)
                                      m_pdata->getBox(),
                                      m_pdata->getGlobalBox(),
                                      block_size,
-                                     d_flag.data);
+                                     d_flag.data,
+                                     m_exec_conf->dev_prop);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -651,8 +651,43 @@ __global__ void gpu_update_composite_kernel(unsigned int N,
                                             int3* d_image,
                                             const BoxDim box,
                                             const BoxDim global_box,
-                                            uint2* d_flag)
+                                            uint2* d_flag,
+                                            bool use_shared)
     {
+    extern __shared__ char s_data[];
+
+    // the body frame geometry of all body types
+    const Scalar3* body_pos = d_body_pos;
+    const Scalar4* body_orientation = d_body_orientation;
+    const unsigned int* body_types = d_body_types;
+
+    if (use_shared)
+        {
+        // stage the geometry in shared memory so that the constituents of all bodies of the same
+        // type in this block read it only once from global memory
+        unsigned int n_elem = body_indexer.getNumElements();
+        Scalar4* s_body_orientation = (Scalar4*)(&s_data[0]);
+        Scalar3* s_body_pos = (Scalar3*)(s_body_orientation + n_elem);
+        unsigned int* s_body_types = (unsigned int*)(s_body_pos + n_elem);
+
+        for (unsigned int cur_offset = 0; cur_offset < n_elem; cur_offset += blockDim.x)
+            {
+            if (cur_offset + threadIdx.x < n_elem)
+                {
+                s_body_orientation[cur_offset + threadIdx.x]
+                    = d_body_orientation[cur_offset + threadIdx.x];
+                s_body_pos[cur_offset + threadIdx.x] = d_body_pos[cur_offset + threadIdx.x];
+                s_body_types[cur_offset + threadIdx.x] = d_body_types[cur_offset + threadIdx.x];
+                }
+            }
+
+        __syncthreads();
+
+        body_pos = s_body_pos;
+        body_orientation = s_body_orientation;
+        body_types = s_body_types;
+        }
+
     unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
 
     if (idx >= nwork)
@@ -704,13 +739,13 @@ __global__ void gpu_update_composite_kernel(unsigned int N,
 
     unsigned int idx_in_body = d_molecule_order[idx] - 1;
 
-    vec3<Scalar> local_pos(d_body_pos[body_indexer(body_type, idx_in_body)]);
+    vec3<Scalar> local_pos(body_pos[body_indexer(body_type, idx_in_body)]);
     vec3<Scalar> dr_space = rotate(orientation, local_pos);
 
     vec3<Scalar> updated_pos(pos);
     updated_pos += dr_space;
 
-    quat<Scalar> local_orientation(d_body_orientation[body_indexer(body_type, idx_in_body)]);
+    quat<Scalar> local_orientation(body_orientation[body_indexer(body_type, idx_in_body)]);
     quat<Scalar> updated_orientation = orientation * local_orientation;
 
     // this runs before the ForceComputes,
@@ -725,7 +760,7 @@ __global__ void gpu_update_composite_kernel(unsigned int N,
         = make_scalar4(updated_pos.x,
                        updated_pos.y,
                        updated_pos.z,
-                       __int_as_scalar(d_body_types[body_indexer(body_type, idx_in_body)]));
+                       __int_as_scalar(body_types[body_indexer(body_type, idx_in_body)]));
     d_orientation[idx] = quat_to_scalar4(updated_orientation);
     d_image[idx] = img + imgi;
     }
@@ -747,7 +782,8 @@ void gpu_update_composite(unsigned int N,
                           const BoxDim box,
                           const BoxDim global_box,
                           unsigned int block_size,
-                          uint2* d_flag)
+                          uint2* d_flag,
+                          const hipDeviceProp_t& dev_prop)
     {
     unsigned int run_block_size = block_size;
 
@@ -761,13 +797,23 @@ void gpu_update_composite(unsigned int N,
         run_block_size = max_block_size;
         }
 
+    // stage the body frame geometry in shared memory when it fits
+    size_t shared_bytes = body_indexer.getNumElements()
+                          * (sizeof(Scalar4) + sizeof(Scalar3) + sizeof(unsigned int));
+    bool use_shared = true;
+    if (shared_bytes + attr.sharedSizeBytes >= dev_prop.sharedMemPerBlock)
+        {
+        use_shared = false;
+        shared_bytes = 0;
+        }
+
     unsigned int nwork = N + n_ghost;
 
     unsigned int n_blocks = nwork / run_block_size + 1;
     hipLaunchKernelGGL((gpu_update_composite_kernel),
                        dim3(n_blocks),
                        dim3(run_block_size),
-                       0,
+                       shared_bytes,
                        0,
                        N,
                        nwork,
@@ -786,7 +832,8 @@ void gpu_update_composite(unsigned int N,
                        d_image,
                        box,
                        global_box,
-                       d_flag);
+                       d_flag,
+                       use_shared);
     }
 
 struct is_center
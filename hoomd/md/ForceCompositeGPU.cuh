@@ -81,7 +81,8 @@ void gpu_update_composite(unsigned int N,
                           const BoxDim box,
                           const BoxDim global_box,
                           unsigned int block_size,
-                          uint2* d_flag);
+                          uint2* d_flag,
+                          const hipDeviceProp_t& dev_prop);
 
 hipError_t gpu_find_rigid_centers(const unsigned int* d_body,
                                   const unsigned int* d_tag,
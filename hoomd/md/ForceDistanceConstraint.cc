@@ -20,7 +20,8 @@ ForceDistanceConstraint::ForceDistanceConstraint(std::shared_ptr<SystemDefinitio
     : MolecularForceCompute(sysdef), m_cdata(m_sysdef->getConstraintData()), m_cmatrix(m_exec_conf),
       m_cvec(m_exec_conf), m_lagrange(m_exec_conf), m_rel_tol(1e-3),
       m_constraint_violated(m_exec_conf), m_condition(m_exec_conf), m_sparse_idxlookup(m_exec_conf),
-      m_constraint_reorder(true), m_constraints_added_removed(true), m_d_max(0.0)
+      m_iterative(false), m_solver_tol(1e-8), m_max_iterations(100), m_constraint_reorder(true),
+      m_constraints_added_removed(true), m_d_max(0.0)
     {
     m_constraint_violated.resetFlags(0);
 
@@ -106,6 +107,27 @@ Scalar ForceDistanceConstraint::getNDOFRemoved(std::shared_ptr<ParticleGroup> qu
     return half_dof_removed * 0.5;
     }
 
+/*! \param solver "direct" to solve with a sparse LU factorization, "iterative" to use BiCGSTAB
+ */
+void ForceDistanceConstraint::setSolver(const std::string& solver)
+    {
+    bool iterative;
+    if (solver == "direct")
+        iterative = false;
+    else if (solver == "iterative")
+        iterative = true;
+    else
+        throw std::invalid_argument("Invalid solver: " + solver);
+
+    if (iterative != m_iterative)
+        {
+        m_iterative = iterative;
+
+        // the solvers store the sparse matrix differently, rebuild the sparsity pattern
+        m_constraint_reorder = true;
+        }
+    }
+
 /*! Does nothing in the base class
     \param timestep Current timestep
 */
@@ -401,8 +423,25 @@ void ForceDistanceConstraint::solveConstraints(uint64_t timestep)
                 }
             }
 
-        // Compute the ordering permutation vector from the structural pattern of A
-        m_sparse_solver.analyzePattern(m_sparse);
+        if (m_iterative)
+            {
+            // the constraints may have been reordered, do not start from the previous solution
+            ArrayHandle<double> h_lagrange(m_lagrange,
+                                           access_location::host,
+                                           access_mode::overwrite);
+            memset(h_lagrange.data, 0, sizeof(double) * n_constraint);
+            }
+        else
+            {
+            // Compute the ordering permutation vector from the structural pattern of A
+            m_sparse_solver.analyzePattern(m_sparse);
+            }
+        }
+
+    if (m_iterative)
+        {
+        solveConstraintsIterative(timestep);
+        return;
         }
 
     // Compute the numerical factorization
@@ -423,6 +462,38 @@ void ForceDistanceConstraint::solveConstraints(uint64_t timestep)
     map_lagrange = m_sparse_solver.solve(map_vec);
     }
 
+/*! Solve the constraint equations with BiCGSTAB, starting from the Lagrange multipliers of the
+    previous step.
+*/
+void ForceDistanceConstraint::solveConstraintsIterative(uint64_t timestep)
+    {
+    typedef Matrix<double, Dynamic, 1> vec_t;
+    typedef Map<vec_t> vec_map_t;
+
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+
+    // the diagonal preconditioner only needs the current values of the matrix elements
+    m_iterative_solver.setTolerance(m_solver_tol);
+    m_iterative_solver.setMaxIterations(m_max_iterations);
+    m_iterative_solver.compute(m_sparse);
+
+    ArrayHandle<double> h_cvec(m_cvec, access_location::host, access_mode::read);
+    ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::readwrite);
+    vec_map_t map_vec(h_cvec.data, n_constraint, 1);
+    vec_map_t map_lagrange(h_lagrange.data, n_constraint, 1);
+
+    vec_t guess = map_lagrange;
+    map_lagrange = m_iterative_solver.solveWithGuess(map_vec, guess);
+
+    if (m_iterative_solver.info() != Eigen::Success)
+        {
+        m_exec_conf->msg->warning()
+            << "ForceDistanceConstraint: iterative solver did not converge in "
+            << m_max_iterations << " iterations on timestep " << timestep
+            << " (relative residual " << m_iterative_solver.error() << ")" << std::endl;
+        }
+    }
+
 void ForceDistanceConstraint::computeConstraintForces(uint64_t timestep)
     {
     ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::read);
@@ -658,7 +729,16 @@ void export_ForceDistanceConstraint(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
         .def_property("tolerance",
                       &ForceDistanceConstraint::getRelativeTolerance,
-                      &ForceDistanceConstraint::setRelativeTolerance);
+                      &ForceDistanceConstraint::setRelativeTolerance)
+        .def_property("solver",
+                      &ForceDistanceConstraint::getSolver,
+                      &ForceDistanceConstraint::setSolver)
+        .def_property("solver_tolerance",
+                      &ForceDistanceConstraint::getSolverTolerance,
+                      &ForceDistanceConstraint::setSolverTolerance)
+        .def_property("max_iterations",
+                      &ForceDistanceConstraint::getMaxIterations,
+                      &ForceDistanceConstraint::setMaxIterations);
     }
 
     } // end namespace detail
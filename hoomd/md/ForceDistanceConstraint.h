@@ -20,6 +20,7 @@
 #include "hoomd/GPUVector.h"
 
 #include <Eigen/Dense>
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/SparseLU>
 
 namespace hoomd
@@ -33,6 +34,12 @@ namespace md
    M. Yoneya, “A Generalized Non-iterative Matrix Method for Constraint Molecular Dynamics
    Simulations,” J. Comput. Phys., vol. 172, no. 1, pp. 188–197, Sep. 2001.
 
+    The linear system of equations for the Lagrange multipliers is solved either directly with a
+    sparse LU factorization or iteratively with the Jacobi preconditioned BiCGSTAB method. The
+    iterative solver starts from the Lagrange multipliers of the previous step, which are usually
+    close to the solution, and avoids the factorization that dominates the cost of the direct solver
+    for large constraint networks.
+
     See Integrator for detailed documentation on constraint force implementation.
     \ingroup computes
 */
@@ -63,6 +70,39 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
         return m_rel_tol;
         }
 
+    /// Set the method used to solve the constraint equations ("direct" or "iterative")
+    void setSolver(const std::string& solver);
+
+    /// Get the method used to solve the constraint equations
+    std::string getSolver()
+        {
+        return m_iterative ? "iterative" : "direct";
+        }
+
+    /// Set the relative residual at which the iterative solver stops
+    void setSolverTolerance(Scalar solver_tol)
+        {
+        m_solver_tol = solver_tol;
+        }
+
+    /// Get the relative residual at which the iterative solver stops
+    Scalar getSolverTolerance()
+        {
+        return m_solver_tol;
+        }
+
+    /// Set the maximum number of iterations of the iterative solver
+    void setMaxIterations(unsigned int max_iterations)
+        {
+        m_max_iterations = max_iterations;
+        }
+
+    /// Get the maximum number of iterations of the iterative solver
+    unsigned int getMaxIterations()
+        {
+        return m_max_iterations;
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
@@ -90,6 +130,13 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
     GPUVector<int>
         m_sparse_idxlookup; //!< Reverse lookup from column-major to sparse matrix element
 
+    bool m_iterative;              //!< True to solve the constraint equations iteratively
+    Scalar m_solver_tol;           //!< Relative residual at which the iterative solver stops
+    unsigned int m_max_iterations; //!< Maximum number of iterations of the iterative solver
+    Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::ColMajor>,
+                    Eigen::DiagonalPreconditioner<double>>
+        m_iterative_solver; //!< The iterative solver used on the CPU
+
     bool m_constraint_reorder;        //!< True if groups have changed
     bool m_constraints_added_removed; //!< True if global constraint topology has changed
 
@@ -107,6 +154,9 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
     //! Solve the constraint matrix equation
     virtual void solveConstraints(uint64_t timestep);
 
+    //! Solve the constraint matrix equation iteratively
+    virtual void solveConstraintsIterative(uint64_t timestep);
+
     //! Solve the linear matrix-vector equation
     virtual void computeConstraintForces(uint64_t timestep);
 
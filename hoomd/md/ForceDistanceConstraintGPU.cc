@@ -6,6 +6,7 @@
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
 #include <string.h>
 
 /*! \file ForceDistanceConstraintGPU.cc
@@ -19,7 +20,9 @@ namespace md
 /*! \param sysdef SystemDefinition containing the ParticleData to compute forces on
  */
 ForceDistanceConstraintGPU::ForceDistanceConstraintGPU(std::shared_ptr<SystemDefinition> sysdef)
-    : ForceDistanceConstraint(sysdef)
+    : ForceDistanceConstraint(sysdef), m_iterative_rowptr(m_exec_conf),
+      m_iterative_colind(m_exec_conf), m_iterative_diag(m_exec_conf),
+      m_iterative_work(m_exec_conf), m_iterative_status(m_exec_conf)
 #ifdef CUSOLVER_AVAILABLE
       ,
       m_cusolver_rf_initialized(false), m_nnz_L_tot(0), m_nnz_U_tot(0), m_csr_val_L(m_exec_conf),
@@ -199,6 +202,12 @@ void ForceDistanceConstraintGPU::fillMatrixVector(uint64_t timestep)
 
 void ForceDistanceConstraintGPU::solveConstraints(uint64_t timestep)
     {
+    if (m_iterative)
+        {
+        solveConstraintsIterative(timestep);
+        return;
+        }
+
     // ==1 if the sparsity pattern of the matrix changes (in particular if connectivity changes)
     unsigned int sparsity_pattern_changed = m_condition.readFlags();
 
@@ -717,6 +726,144 @@ void ForceDistanceConstraintGPU::solveConstraints(uint64_t timestep)
 #endif
     }
 
+/*! The iterative solver stores the sparse matrix in CSR format in m_sparse_val, which the fill
+    kernel updates each step through m_sparse_idxlookup. The solution starts from the Lagrange
+    multipliers of the previous step and stays on the device. The host only polls the convergence
+    flag every few iterations.
+*/
+void ForceDistanceConstraintGPU::solveConstraintsIterative(uint64_t timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+
+    // skip if zero constraints
+    if (n_constraint == 0)
+        return;
+
+    // reallocate array of constraint forces
+    m_lagrange.resize(n_constraint);
+
+    if (m_condition.readFlags())
+        {
+        m_exec_conf->msg->notice(6)
+            << "ForceDistanceConstraintGPU: sparsity pattern changed. Rebuilding on CPU"
+            << std::endl;
+
+        // reset flags
+        m_condition.resetFlags(0);
+
+        m_iterative_rowptr.resize(n_constraint + 1);
+        m_iterative_diag.resize(n_constraint);
+
+        std::vector<int> colind;
+        std::vector<double> val;
+
+            {
+            ArrayHandle<double> h_cmatrix(m_cmatrix, access_location::host, access_mode::read);
+            ArrayHandle<int> h_sparse_idxlookup(m_sparse_idxlookup,
+                                                access_location::host,
+                                                access_mode::overwrite);
+            ArrayHandle<int> h_rowptr(m_iterative_rowptr,
+                                      access_location::host,
+                                      access_mode::overwrite);
+            ArrayHandle<int> h_diag(m_iterative_diag,
+                                    access_location::host,
+                                    access_mode::overwrite);
+
+            // convert the column-major dense matrix to CSR and construct the lookup table
+            for (unsigned int i = 0; i < n_constraint; ++i)
+                {
+                h_rowptr.data[i] = (int)colind.size();
+                h_diag.data[i] = -1;
+                for (unsigned int j = 0; j < n_constraint; ++j)
+                    {
+                    double element = h_cmatrix.data[j * n_constraint + i];
+                    h_sparse_idxlookup.data[j * n_constraint + i] = -1;
+                    if (element != 0.0)
+                        {
+                        if (i == j)
+                            h_diag.data[i] = (int)colind.size();
+                        h_sparse_idxlookup.data[j * n_constraint + i] = (int)colind.size();
+                        colind.push_back(j);
+                        val.push_back(element);
+                        }
+                    }
+                }
+            h_rowptr.data[n_constraint] = (int)colind.size();
+            }
+
+        m_iterative_colind.resize(colind.size());
+        m_sparse_val.resize(val.size());
+
+        ArrayHandle<int> h_colind(m_iterative_colind,
+                                  access_location::host,
+                                  access_mode::overwrite);
+        ArrayHandle<double> h_sparse_val(m_sparse_val,
+                                         access_location::host,
+                                         access_mode::overwrite);
+        std::copy(colind.begin(), colind.end(), h_colind.data);
+        std::copy(val.begin(), val.end(), h_sparse_val.data);
+
+        // the constraints may have been reordered, do not start from the previous solution
+        ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::overwrite);
+        memset(h_lagrange.data, 0, sizeof(double) * n_constraint);
+        }
+
+    m_iterative_work.resize(kernel::gpu_bicgstab_n_vectors * n_constraint
+                            + kernel::gpu_bicgstab_n_scalars);
+
+    ArrayHandle<int> d_rowptr(m_iterative_rowptr, access_location::device, access_mode::read);
+    ArrayHandle<int> d_colind(m_iterative_colind, access_location::device, access_mode::read);
+    ArrayHandle<int> d_diag(m_iterative_diag, access_location::device, access_mode::read);
+    ArrayHandle<double> d_sparse_val(m_sparse_val, access_location::device, access_mode::read);
+    ArrayHandle<double> d_cvec(m_cvec, access_location::device, access_mode::read);
+    ArrayHandle<double> d_lagrange(m_lagrange, access_location::device, access_mode::readwrite);
+    ArrayHandle<double> d_work(m_iterative_work, access_location::device, access_mode::overwrite);
+
+    m_iterative_status.resetFlags(0);
+    kernel::gpu_bicgstab_init(n_constraint,
+                              d_rowptr.data,
+                              d_colind.data,
+                              d_sparse_val.data,
+                              d_diag.data,
+                              d_cvec.data,
+                              d_lagrange.data,
+                              d_work.data,
+                              m_iterative_status.getDeviceFlags(),
+                              m_solver_tol);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    // poll the convergence flag only every few iterations to keep the device busy
+    const unsigned int check_interval = 5;
+    unsigned int status = m_iterative_status.readFlags();
+    for (unsigned int i = 0; i < m_max_iterations && !status; i += check_interval)
+        {
+        kernel::gpu_bicgstab_iterate(n_constraint,
+                                     d_rowptr.data,
+                                     d_colind.data,
+                                     d_sparse_val.data,
+                                     d_diag.data,
+                                     d_lagrange.data,
+                                     d_work.data,
+                                     m_iterative_status.getDeviceFlags(),
+                                     m_solver_tol,
+                                     std::min(check_interval, m_max_iterations - i));
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        status = m_iterative_status.readFlags();
+        }
+
+    if (status != 1)
+        {
+        m_exec_conf->msg->warning()
+            << "ForceDistanceConstraintGPU: iterative solver did not converge in "
+            << m_max_iterations << " iterations on timestep " << timestep << std::endl;
+        }
+    }
+
 void ForceDistanceConstraintGPU::computeConstraintForces(uint64_t timestep)
     {
     // access solution vector
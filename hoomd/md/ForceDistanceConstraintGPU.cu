@@ -423,6 +423,456 @@ hipError_t gpu_compute_constraint_forces(const Scalar4* d_pos,
     return hipSuccess;
     }
 
+//! Block size of the iterative solver kernels (must be a power of two for the reductions)
+const unsigned int bicgstab_block_size = 256;
+
+//! Indices of the scalars of the BiCGSTAB iteration, stored after the work vectors
+enum bicgstab_scalar
+    {
+    bicgstab_rho = 0,
+    bicgstab_rho_new,
+    bicgstab_alpha,
+    bicgstab_omega,
+    bicgstab_r0v,
+    bicgstab_ts,
+    bicgstab_tt,
+    bicgstab_rr,
+    bicgstab_bb,
+    bicgstab_state
+    };
+
+//! Pointers to the work vectors of the BiCGSTAB iteration
+struct bicgstab_work
+    {
+    __host__ __device__ bicgstab_work(double* d_work, unsigned int n)
+        : r(d_work), r0(d_work + n), p(d_work + 2 * n), v(d_work + 3 * n), s(d_work + 4 * n),
+          t(d_work + 5 * n), phat(d_work + 6 * n), shat(d_work + 7 * n),
+          scalars(d_work + gpu_bicgstab_n_vectors * n)
+        {
+        }
+
+    double* r;       //!< Residual
+    double* r0;      //!< Shadow residual
+    double* p;       //!< Search direction
+    double* v;       //!< A * phat
+    double* s;       //!< Intermediate residual
+    double* t;       //!< A * shat
+    double* phat;    //!< Preconditioned search direction
+    double* shat;    //!< Preconditioned intermediate residual
+    double* scalars; //!< Scalars of the iteration (see bicgstab_scalar)
+    };
+
+//! Inverse of the Jacobi preconditioner for row i
+__device__ inline double bicgstab_inv_diag(const double* d_val, const int* d_diag, unsigned int i)
+    {
+    double diag = d_diag[i] >= 0 ? d_val[d_diag[i]] : 0.0;
+    return diag != 0.0 ? 1.0 / diag : 1.0;
+    }
+
+//! Kernel to compute the sparse matrix vector product y = A x
+__global__ void gpu_bicgstab_spmv_kernel(unsigned int n,
+                                         const int* d_rowptr,
+                                         const int* d_colind,
+                                         const double* d_val,
+                                         const double* d_x,
+                                         double* d_y)
+    {
+    unsigned int row = blockIdx.x * blockDim.x + threadIdx.x;
+    if (row >= n)
+        return;
+
+    double sum = 0.0;
+    for (int k = d_rowptr[row]; k < d_rowptr[row + 1]; ++k)
+        sum += d_val[k] * d_x[d_colind[k]];
+    d_y[row] = sum;
+    }
+
+//! Kernel to compute a dot product in a single block
+/*! \param n Length of the vectors
+    \param d_a First vector
+    \param d_b Second vector
+    \param d_scalars Scalars of the iteration
+    \param out Index of the scalar to write the dot product to
+
+    The kernel does nothing once the iteration has stopped.
+*/
+__global__ void gpu_bicgstab_dot_kernel(unsigned int n,
+                                        const double* d_a,
+                                        const double* d_b,
+                                        double* d_scalars,
+                                        unsigned int out)
+    {
+    if (d_scalars[bicgstab_state] != 0.0)
+        return;
+
+    HIP_DYNAMIC_SHARED(char, s_data)
+    double* sum_sdata = (double*)&s_data[0];
+
+    double sum = 0.0;
+    for (unsigned int i = threadIdx.x; i < n; i += blockDim.x)
+        sum += d_a[i] * d_b[i];
+
+    sum_sdata[threadIdx.x] = sum;
+    __syncthreads();
+
+    // reduce the sum in parallel
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
+            sum_sdata[threadIdx.x] += sum_sdata[threadIdx.x + offs];
+        offs >>= 1;
+        __syncthreads();
+        }
+
+    if (threadIdx.x == 0)
+        d_scalars[out] = sum_sdata[0];
+    }
+
+//! Kernel to set up the residual of the initial guess (t holds A x)
+__global__ void gpu_bicgstab_init_kernel(unsigned int n, const double* d_b, double* d_work)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    bicgstab_work w(d_work, n);
+
+    if (i == 0)
+        {
+        w.scalars[bicgstab_rho] = 1.0;
+        w.scalars[bicgstab_rho_new] = 1.0;
+        w.scalars[bicgstab_alpha] = 1.0;
+        w.scalars[bicgstab_omega] = 1.0;
+        w.scalars[bicgstab_state] = 0.0;
+        }
+
+    if (i >= n)
+        return;
+
+    double r = d_b[i] - w.t[i];
+    w.r[i] = r;
+    w.r0[i] = r;
+    w.p[i] = 0.0;
+    w.v[i] = 0.0;
+    }
+
+//! Kernel to update the search direction
+__global__ void gpu_bicgstab_update_p_kernel(unsigned int n,
+                                             const double* d_val,
+                                             const int* d_diag,
+                                             double* d_work)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    bicgstab_work w(d_work, n);
+
+    if (i >= n || w.scalars[bicgstab_state] != 0.0)
+        return;
+
+    double beta = (w.scalars[bicgstab_rho_new] / w.scalars[bicgstab_rho])
+                  * (w.scalars[bicgstab_alpha] / w.scalars[bicgstab_omega]);
+    double p = w.r[i] + beta * (w.p[i] - w.scalars[bicgstab_omega] * w.v[i]);
+    w.p[i] = p;
+    w.phat[i] = p * bicgstab_inv_diag(d_val, d_diag, i);
+    }
+
+//! Kernel to compute the intermediate residual
+__global__ void gpu_bicgstab_update_s_kernel(unsigned int n,
+                                             const double* d_val,
+                                             const int* d_diag,
+                                             double* d_work)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    bicgstab_work w(d_work, n);
+
+    if (i >= n || w.scalars[bicgstab_state] != 0.0)
+        return;
+
+    double r0v = w.scalars[bicgstab_r0v];
+    double alpha = r0v != 0.0 ? w.scalars[bicgstab_rho_new] / r0v : 0.0;
+    double s = w.r[i] - alpha * w.v[i];
+    w.s[i] = s;
+    w.shat[i] = s * bicgstab_inv_diag(d_val, d_diag, i);
+
+    // no other thread reads these scalars in this kernel
+    if (i == 0)
+        {
+        w.scalars[bicgstab_alpha] = alpha;
+        w.scalars[bicgstab_rho] = w.scalars[bicgstab_rho_new];
+        }
+    }
+
+//! Kernel to update the solution and the residual
+__global__ void gpu_bicgstab_update_x_kernel(unsigned int n, double* d_x, double* d_work)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    bicgstab_work w(d_work, n);
+
+    if (i >= n || w.scalars[bicgstab_state] != 0.0)
+        return;
+
+    double tt = w.scalars[bicgstab_tt];
+    double omega = tt > 0.0 ? w.scalars[bicgstab_ts] / tt : 0.0;
+    d_x[i] += w.scalars[bicgstab_alpha] * w.phat[i] + omega * w.shat[i];
+    w.r[i] = w.s[i] - omega * w.t[i];
+
+    // no other thread reads this scalar in this kernel
+    if (i == 0)
+        w.scalars[bicgstab_omega] = omega;
+    }
+
+//! Kernel to test for convergence or breakdown of the iteration
+/*! Sets the state to 1 when the relative residual is below \a tol, and to 2 when the iteration
+    breaks down. The state is also written to \a d_status so that the host can poll it.
+*/
+__global__ void gpu_bicgstab_check_kernel(double* d_scalars, unsigned int* d_status, double tol)
+    {
+    if (d_scalars[bicgstab_state] != 0.0)
+        return;
+
+    unsigned int state = 0;
+    if (sqrt(d_scalars[bicgstab_rr]) <= tol * sqrt(d_scalars[bicgstab_bb]))
+        state = 1;
+    else if (d_scalars[bicgstab_rho_new] == 0.0 || d_scalars[bicgstab_omega] == 0.0)
+        state = 2;
+
+    if (state)
+        {
+        d_scalars[bicgstab_state] = double(state);
+        *d_status = state;
+        }
+    }
+
+/*! \param n_constraint Number of rows of the matrix
+    \param d_rowptr Row offsets of the CSR matrix
+    \param d_colind Column indices of the CSR matrix
+    \param d_val Values of the CSR matrix
+    \param d_diag Index of the diagonal element of each row in \a d_val (-1 if none)
+    \param d_b Right hand side
+    \param d_x Initial guess
+    \param d_work Work array of gpu_bicgstab_n_vectors * n_constraint + gpu_bicgstab_n_scalars
+    \param d_status Set to 1 if the initial guess already solves the system
+    \param tol Relative residual at which the iteration stops
+*/
+hipError_t gpu_bicgstab_init(unsigned int n_constraint,
+                             const int* d_rowptr,
+                             const int* d_colind,
+                             const double* d_val,
+                             const int* d_diag,
+                             const double* d_b,
+                             const double* d_x,
+                             double* d_work,
+                             unsigned int* d_status,
+                             double tol)
+    {
+    bicgstab_work w(d_work, n_constraint);
+    unsigned int n_blocks = n_constraint / bicgstab_block_size + 1;
+    size_t shared_bytes = sizeof(double) * bicgstab_block_size;
+
+    hipLaunchKernelGGL((gpu_bicgstab_spmv_kernel),
+                       dim3(n_blocks),
+                       dim3(bicgstab_block_size),
+                       0,
+                       0,
+                       n_constraint,
+                       d_rowptr,
+                       d_colind,
+                       d_val,
+                       d_x,
+                       w.t);
+
+    hipLaunchKernelGGL((gpu_bicgstab_init_kernel),
+                       dim3(n_blocks),
+                       dim3(bicgstab_block_size),
+                       0,
+                       0,
+                       n_constraint,
+                       d_b,
+                       d_work);
+
+    hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                       dim3(1),
+                       dim3(bicgstab_block_size),
+                       shared_bytes,
+                       0,
+                       n_constraint,
+                       d_b,
+                       d_b,
+                       w.scalars,
+                       bicgstab_bb);
+
+    hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                       dim3(1),
+                       dim3(bicgstab_block_size),
+                       shared_bytes,
+                       0,
+                       n_constraint,
+                       w.r,
+                       w.r,
+                       w.scalars,
+                       bicgstab_rr);
+
+    hipLaunchKernelGGL((gpu_bicgstab_check_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       0,
+                       w.scalars,
+                       d_status,
+                       tol);
+
+    return hipSuccess;
+    }
+
+/*! \param n_constraint Number of rows of the matrix
+    \param d_rowptr Row offsets of the CSR matrix
+    \param d_colind Column indices of the CSR matrix
+    \param d_val Values of the CSR matrix
+    \param d_diag Index of the diagonal element of each row in \a d_val (-1 if none)
+    \param d_x Solution (updated in place)
+    \param d_work Work array set up by gpu_bicgstab_init()
+    \param d_status Set to 1 on convergence and 2 on breakdown
+    \param tol Relative residual at which the iteration stops
+    \param n_iterations Number of iterations to perform
+
+    All kernels return immediately once the iteration has stopped, so the host only needs to poll
+    \a d_status between calls.
+*/
+hipError_t gpu_bicgstab_iterate(unsigned int n_constraint,
+                                const int* d_rowptr,
+                                const int* d_colind,
+                                const double* d_val,
+                                const int* d_diag,
+                                double* d_x,
+                                double* d_work,
+                                unsigned int* d_status,
+                                double tol,
+                                unsigned int n_iterations)
+    {
+    bicgstab_work w(d_work, n_constraint);
+    unsigned int n_blocks = n_constraint / bicgstab_block_size + 1;
+    size_t shared_bytes = sizeof(double) * bicgstab_block_size;
+
+    for (unsigned int iteration = 0; iteration < n_iterations; ++iteration)
+        {
+        hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                           dim3(1),
+                           dim3(bicgstab_block_size),
+                           shared_bytes,
+                           0,
+                           n_constraint,
+                           w.r0,
+                           w.r,
+                           w.scalars,
+                           bicgstab_rho_new);
+
+        hipLaunchKernelGGL((gpu_bicgstab_update_p_kernel),
+                           dim3(n_blocks),
+                           dim3(bicgstab_block_size),
+                           0,
+                           0,
+                           n_constraint,
+                           d_val,
+                           d_diag,
+                           d_work);
+
+        hipLaunchKernelGGL((gpu_bicgstab_spmv_kernel),
+                           dim3(n_blocks),
+                           dim3(bicgstab_block_size),
+                           0,
+                           0,
+                           n_constraint,
+                           d_rowptr,
+                           d_colind,
+                           d_val,
+                           w.phat,
+                           w.v);
+
+        hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                           dim3(1),
+                           dim3(bicgstab_block_size),
+                           shared_bytes,
+                           0,
+                           n_constraint,
+                           w.r0,
+                           w.v,
+                           w.scalars,
+                           bicgstab_r0v);
+
+        hipLaunchKernelGGL((gpu_bicgstab_update_s_kernel),
+                           dim3(n_blocks),
+                           dim3(bicgstab_block_size),
+                           0,
+                           0,
+                           n_constraint,
+                           d_val,
+                           d_diag,
+                           d_work);
+
+        hipLaunchKernelGGL((gpu_bicgstab_spmv_kernel),
+                           dim3(n_blocks),
+                           dim3(bicgstab_block_size),
+                           0,
+                           0,
+                           n_constraint,
+                           d_rowptr,
+                           d_colind,
+                           d_val,
+                           w.shat,
+                           w.t);
+
+        hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                           dim3(1),
+                           dim3(bicgstab_block_size),
+                           shared_bytes,
+                           0,
+                           n_constraint,
+                           w.t,
+                           w.s,
+                           w.scalars,
+                           bicgstab_ts);
+
+        hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                           dim3(1),
+                           dim3(bicgstab_block_size),
+                           shared_bytes,
+                           0,
+                           n_constraint,
+                           w.t,
+                           w.t,
+                           w.scalars,
+                           bicgstab_tt);
+
+        hipLaunchKernelGGL((gpu_bicgstab_update_x_kernel),
+                           dim3(n_blocks),
+                           dim3(bicgstab_block_size),
+                           0,
+                           0,
+                           n_constraint,
+                           d_x,
+                           d_work);
+
+        hipLaunchKernelGGL((gpu_bicgstab_dot_kernel),
+                           dim3(1),
+                           dim3(bicgstab_block_size),
+                           shared_bytes,
+                           0,
+                           n_constraint,
+                           w.r,
+                           w.r,
+                           w.scalars,
+                           bicgstab_rr);
+
+        hipLaunchKernelGGL((gpu_bicgstab_check_kernel),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           0,
+                           w.scalars,
+                           d_status,
+                           tol);
+        }
+
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -72,6 +72,34 @@ hipError_t gpu_compute_constraint_forces(const Scalar4* d_pos,
                                          unsigned int nptl_local,
                                          unsigned int block_size,
                                          double* d_lagrange);
+
+//! Number of work vectors of length n_constraint used by the iterative solver
+const unsigned int gpu_bicgstab_n_vectors = 8;
+
+//! Number of scalars stored after the work vectors of the iterative solver
+const unsigned int gpu_bicgstab_n_scalars = 16;
+
+hipError_t gpu_bicgstab_init(unsigned int n_constraint,
+                             const int* d_rowptr,
+                             const int* d_colind,
+                             const double* d_val,
+                             const int* d_diag,
+                             const double* d_b,
+                             const double* d_x,
+                             double* d_work,
+                             unsigned int* d_status,
+                             double tol);
+
+hipError_t gpu_bicgstab_iterate(unsigned int n_constraint,
+                                const int* d_rowptr,
+                                const int* d_colind,
+                                const double* d_val,
+                                const int* d_diag,
+                                double* d_x,
+                                double* d_work,
+                                unsigned int* d_status,
+                                double tol,
+                                unsigned int n_iterations);
 #endif
 
     } // end namespace kernel
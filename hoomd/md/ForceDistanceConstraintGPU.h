@@ -99,12 +99,21 @@ class ForceDistanceConstraintGPU : public ForceDistanceConstraint
 
     GPUVector<double> m_sparse_val; //!< Sparse matrix value list
 
+    GPUVector<int> m_iterative_rowptr;         //!< CSR row offsets for the iterative solver
+    GPUVector<int> m_iterative_colind;         //!< CSR column indices for the iterative solver
+    GPUVector<int> m_iterative_diag;           //!< Index of the diagonal element of each row
+    GPUVector<double> m_iterative_work;        //!< Work vectors of the iterative solver
+    GPUFlags<unsigned int> m_iterative_status; //!< 1 if converged, 2 on breakdown
+
     //! Populate the quantities in the constraint-force equation
     virtual void fillMatrixVector(uint64_t timestep);
 
     //! Solve the matrix equation
     virtual void solveConstraints(uint64_t timestep);
 
+    //! Solve the matrix equation with BiCGSTAB on the GPU
+    virtual void solveConstraintsIterative(uint64_t timestep);
+
     //! Compute the constraint forces using the Lagrange multipliers
     virtual void computeConstraintForces(uint64_t timestep);
     };
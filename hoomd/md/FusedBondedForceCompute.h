@@ -0,0 +1,564 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "FusedBondedTerms.h"
+#include "HarmonicAngleForceCompute.h"
+#include "HarmonicDihedralForceCompute.h"
+
+#include "hoomd/BondedGroupData.h"
+#include "hoomd/ForceCompute.h"
+#include "hoomd/GPUArray.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+/*! \file FusedBondedForceCompute.h
+    \brief Declares FusedBondedForceCompute
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __FUSED_BONDED_FORCE_COMPUTE_H__
+#define __FUSED_BONDED_FORCE_COMPUTE_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes bond, angle, and dihedral forces in a single force compute
+/*! FusedBondedForceCompute evaluates the bond potential \a evaluator (see PotentialBond), harmonic
+    angles (see HarmonicAngleForceCompute), and periodic dihedrals (see
+    HarmonicDihedralForceCompute) and sums them into one force and virial array.
+
+    Polymer models typically apply several bonded terms with little work per group. Separate force
+    computes each zero, write, and sum (in computeNetForce) their own force arrays. On the GPU,
+    they also launch one kernel per term and load the particle data in each.
+    FusedBondedForceCompute processes all of the terms in one pass.
+
+    Bond, angle, and dihedral parameters are set per type. Set the parameters of unused angle
+    and dihedral types to zero.
+
+    \tparam evaluator EvaluatorBond class used to evaluate V(r) and F(r)/r
+
+    \ingroup computes
+*/
+template<class evaluator> class FusedBondedForceCompute : public ForceCompute
+    {
+    public:
+    //! Param type from evaluator
+    typedef typename evaluator::param_type param_type;
+
+    //! Constructs the compute
+    FusedBondedForceCompute(std::shared_ptr<SystemDefinition> sysdef);
+
+    //! Destructor
+    virtual ~FusedBondedForceCompute();
+
+    /// Set the bond parameters
+    virtual void setBondParams(unsigned int type, const param_type& param);
+    void setBondParamsPython(std::string type, pybind11::dict param);
+
+    /// Get the bond parameters
+    pybind11::dict getBondParams(std::string type);
+
+    /// Set the angle parameters
+    void setAngleParamsPython(std::string type, pybind11::dict param);
+
+    /// Get the angle parameters
+    pybind11::dict getAngleParams(std::string type);
+
+    /// Set the dihedral parameters
+    void setDihedralParamsPython(std::string type, pybind11::dict param);
+
+    /// Get the dihedral parameters
+    pybind11::dict getDihedralParams(std::string type);
+
+#ifdef ENABLE_MPI
+    //! Get ghost particle fields requested by this force
+    virtual CommFlags getRequestedCommFlags(uint64_t timestep);
+#endif
+
+    protected:
+    GPUArray<param_type> m_bond_params; //!< Bond parameters per type
+    GPUArray<Scalar2> m_angle_params;   //!< K and t_0 per angle type
+    GPUArray<Scalar4> m_dihedral_params; //!< K, sign, multiplicity, and phi_0 per dihedral type
+
+    std::shared_ptr<BondData> m_bond_data;         //!< Bond data to use in computing bonds
+    std::shared_ptr<AngleData> m_angle_data;       //!< Angle data to use in computing angles
+    std::shared_ptr<DihedralData> m_dihedral_data; //!< Dihedral data to use in computing dihedrals
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+
+    //! Add the bond forces
+    void computeBondForces(Scalar4* h_force, Scalar* h_virial, bool compute_virial);
+
+    //! Add the angle forces
+    void computeAngleForces(Scalar4* h_force, Scalar* h_virial, bool compute_virial);
+
+    //! Add the dihedral forces
+    void computeDihedralForces(Scalar4* h_force, Scalar* h_virial, bool compute_virial);
+    };
+
+template<class evaluator>
+FusedBondedForceCompute<evaluator>::FusedBondedForceCompute(
+    std::shared_ptr<SystemDefinition> sysdef)
+    : ForceCompute(sysdef)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing FusedBondedForceCompute<" << evaluator::getName()
+                                << ">" << std::endl;
+    assert(m_pdata);
+
+    // access the bonded group data for later use
+    m_bond_data = m_sysdef->getBondData();
+    m_angle_data = m_sysdef->getAngleData();
+    m_dihedral_data = m_sysdef->getDihedralData();
+
+    // allocate the parameters
+    GPUArray<param_type> bond_params(m_bond_data->getNTypes(), m_exec_conf);
+    m_bond_params.swap(bond_params);
+
+    GPUArray<Scalar2> angle_params(m_angle_data->getNTypes(), m_exec_conf);
+    m_angle_params.swap(angle_params);
+
+    GPUArray<Scalar4> dihedral_params(m_dihedral_data->getNTypes(), m_exec_conf);
+    m_dihedral_params.swap(dihedral_params);
+    }
+
+template<class evaluator> FusedBondedForceCompute<evaluator>::~FusedBondedForceCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying FusedBondedForceCompute<" << evaluator::getName()
+                                << ">" << std::endl;
+    }
+
+/*! \param type Type of the bond to set parameters for
+    \param param Parameter to set
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::setBondParams(unsigned int type, const param_type& param)
+    {
+    if (type >= m_bond_data->getNTypes())
+        {
+        throw std::runtime_error("Invalid bond type.");
+        }
+
+    ArrayHandle<param_type> h_params(m_bond_params, access_location::host, access_mode::readwrite);
+    h_params.data[type] = param;
+    }
+
+/*! \param type Name of the bond type to set parameters for
+    \param param Parameters to set
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::setBondParamsPython(std::string type,
+                                                             pybind11::dict param)
+    {
+    auto itype = m_bond_data->getTypeByName(type);
+    setBondParams(itype, param_type(param));
+    }
+
+/*! \param type Name of the bond type
+    \returns The parameters of the bond type
+*/
+template<class evaluator>
+pybind11::dict FusedBondedForceCompute<evaluator>::getBondParams(std::string type)
+    {
+    auto itype = m_bond_data->getTypeByName(type);
+    ArrayHandle<param_type> h_params(m_bond_params, access_location::host, access_mode::read);
+    return h_params.data[itype].asDict();
+    }
+
+/*! \param type Name of the angle type to set parameters for
+    \param param Parameters to set
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::setAngleParamsPython(std::string type,
+                                                              pybind11::dict param)
+    {
+    auto itype = m_angle_data->getTypeByName(type);
+    auto params = angle_harmonic_params(param);
+
+    ArrayHandle<Scalar2> h_params(m_angle_params, access_location::host, access_mode::readwrite);
+    h_params.data[itype] = make_scalar2(params.k, params.t_0);
+    }
+
+/*! \param type Name of the angle type
+    \returns The parameters of the angle type
+*/
+template<class evaluator>
+pybind11::dict FusedBondedForceCompute<evaluator>::getAngleParams(std::string type)
+    {
+    auto itype = m_angle_data->getTypeByName(type);
+    ArrayHandle<Scalar2> h_params(m_angle_params, access_location::host, access_mode::read);
+
+    pybind11::dict params;
+    params["k"] = h_params.data[itype].x;
+    params["t0"] = h_params.data[itype].y;
+    return params;
+    }
+
+/*! \param type Name of the dihedral type to set parameters for
+    \param param Parameters to set
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::setDihedralParamsPython(std::string type,
+                                                                 pybind11::dict param)
+    {
+    auto itype = m_dihedral_data->getTypeByName(type);
+    auto params = dihedral_harmonic_params(param);
+
+    if (params.n < 0)
+        {
+        throw std::invalid_argument("Dihedral multiplicity must be non-negative.");
+        }
+
+    ArrayHandle<Scalar4> h_params(m_dihedral_params,
+                                  access_location::host,
+                                  access_mode::readwrite);
+    h_params.data[itype] = make_scalar4(params.k, params.d, Scalar(params.n), params.phi_0);
+    }
+
+/*! \param type Name of the dihedral type
+    \returns The parameters of the dihedral type
+*/
+template<class evaluator>
+pybind11::dict FusedBondedForceCompute<evaluator>::getDihedralParams(std::string type)
+    {
+    auto itype = m_dihedral_data->getTypeByName(type);
+    ArrayHandle<Scalar4> h_params(m_dihedral_params, access_location::host, access_mode::read);
+
+    pybind11::dict params;
+    params["k"] = h_params.data[itype].x;
+    params["d"] = h_params.data[itype].y;
+    params["n"] = int(h_params.data[itype].z + Scalar(0.5));
+    params["phi0"] = h_params.data[itype].w;
+    return params;
+    }
+
+/*! Actually perform the force computation
+    \param timestep Current time step
+ */
+template<class evaluator> void FusedBondedForceCompute<evaluator>::computeForces(uint64_t timestep)
+    {
+    assert(m_pdata);
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+
+    // Zero data for force calculation
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    PDataFlags flags = m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    computeBondForces(h_force.data, h_virial.data, compute_virial);
+    computeAngleForces(h_force.data, h_virial.data, compute_virial);
+    computeDihedralForces(h_force.data, h_virial.data, compute_virial);
+    }
+
+/*! \param h_force Force array to add the bond forces to
+    \param h_virial Virial array to add the bond virials to
+    \param compute_virial Set to true to compute the virial
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::computeBondForces(Scalar4* h_force,
+                                                           Scalar* h_virial,
+                                                           bool compute_virial)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<param_type> h_params(m_bond_params, access_location::host, access_mode::read);
+
+    // we are using the minimum image of the global box here
+    // to ensure that ghosts are always correctly wrapped (even if a bond exceeds half the domain
+    // length)
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int max_local = N + m_pdata->getNGhosts();
+
+    Scalar bond_virial[6];
+    for (unsigned int i = 0; i < 6; i++)
+        bond_virial[i] = Scalar(0.0);
+
+    const unsigned int size = (unsigned int)m_bond_data->getN();
+    for (unsigned int i = 0; i < size; i++)
+        {
+        const BondData::members_t& bond = m_bond_data->getMembersByIndex(i);
+        assert(bond.tag[0] <= m_pdata->getMaximumTag());
+        assert(bond.tag[1] <= m_pdata->getMaximumTag());
+
+        unsigned int idx_a = h_rtag.data[bond.tag[0]];
+        unsigned int idx_b = h_rtag.data[bond.tag[1]];
+
+        // throw an error if this bond is incomplete
+        if (idx_a >= max_local || idx_b >= max_local)
+            {
+            std::ostringstream stream;
+            stream << "Error: bond " << bond.tag[0] << " " << bond.tag[1] << " is incomplete.";
+            throw std::runtime_error(stream.str());
+            }
+
+        Scalar3 posa = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
+        Scalar3 posb = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+        Scalar3 dx = box.minImage(posb - posa);
+        Scalar rsq = dot(dx, dx);
+
+        Scalar force_divr = Scalar(0.0);
+        Scalar bond_eng = Scalar(0.0);
+        evaluator eval(rsq, h_params.data[m_bond_data->getTypeByIndex(i)]);
+        if (evaluator::needsCharge())
+            eval.setCharge(h_charge.data[idx_a], h_charge.data[idx_b]);
+
+        if (!eval.evalForceAndEnergy(force_divr, bond_eng))
+            {
+            m_exec_conf->msg->error() << "bonded." << evaluator::getName()
+                                      << ": bond out of bounds" << std::endl
+                                      << std::endl;
+            throw std::runtime_error("Error in bond calculation");
+            }
+
+        // Bond energy must be halved
+        bond_eng *= Scalar(0.5);
+
+        if (compute_virial)
+            {
+            Scalar force_div2r = Scalar(0.5) * force_divr;
+            bond_virial[0] = dx.x * dx.x * force_div2r; // xx
+            bond_virial[1] = dx.x * dx.y * force_div2r; // xy
+            bond_virial[2] = dx.x * dx.z * force_div2r; // xz
+            bond_virial[3] = dx.y * dx.y * force_div2r; // yy
+            bond_virial[4] = dx.y * dx.z * force_div2r; // yz
+            bond_virial[5] = dx.z * dx.z * force_div2r; // zz
+            }
+
+        // add the force to the particles (only for non-ghost particles)
+        if (idx_b < N)
+            {
+            h_force[idx_b].x += force_divr * dx.x;
+            h_force[idx_b].y += force_divr * dx.y;
+            h_force[idx_b].z += force_divr * dx.z;
+            h_force[idx_b].w += bond_eng;
+            if (compute_virial)
+                for (unsigned int j = 0; j < 6; j++)
+                    h_virial[j * m_virial_pitch + idx_b] += bond_virial[j];
+            }
+
+        if (idx_a < N)
+            {
+            h_force[idx_a].x -= force_divr * dx.x;
+            h_force[idx_a].y -= force_divr * dx.y;
+            h_force[idx_a].z -= force_divr * dx.z;
+            h_force[idx_a].w += bond_eng;
+            if (compute_virial)
+                for (unsigned int j = 0; j < 6; j++)
+                    h_virial[j * m_virial_pitch + idx_a] += bond_virial[j];
+            }
+        }
+    }
+
+/*! \param h_force Force array to add the angle forces to
+    \param h_virial Virial array to add the angle virials to
+    \param compute_virial Set to true to compute the virial
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::computeAngleForces(Scalar4* h_force,
+                                                            Scalar* h_virial,
+                                                            bool compute_virial)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar2> h_params(m_angle_params, access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int max_local = N + m_pdata->getNGhosts();
+
+    const unsigned int size = (unsigned int)m_angle_data->getN();
+    for (unsigned int i = 0; i < size; i++)
+        {
+        const AngleData::members_t& angle = m_angle_data->getMembersByIndex(i);
+
+        unsigned int idx[3];
+        for (unsigned int j = 0; j < 3; j++)
+            {
+            assert(angle.tag[j] <= m_pdata->getMaximumTag());
+            idx[j] = h_rtag.data[angle.tag[j]];
+            }
+
+        // throw an error if this angle is incomplete
+        if (idx[0] >= max_local || idx[1] >= max_local || idx[2] >= max_local)
+            {
+            std::ostringstream stream;
+            stream << "Error: angle " << angle.tag[0] << " " << angle.tag[1] << " "
+                   << angle.tag[2] << " is incomplete.";
+            throw std::runtime_error(stream.str());
+            }
+
+        Scalar3 pos[3];
+        for (unsigned int j = 0; j < 3; j++)
+            pos[j] = make_scalar3(h_pos.data[idx[j]].x, h_pos.data[idx[j]].y, h_pos.data[idx[j]].z);
+
+        Scalar3 dab = box.minImage(pos[0] - pos[1]);
+        Scalar3 dcb = box.minImage(pos[2] - pos[1]);
+
+        Scalar3 f[3];
+        Scalar angle_eng;
+        Scalar angle_virial[6];
+        detail::evalHarmonicAngle(dab,
+                                  dcb,
+                                  h_params.data[m_angle_data->getTypeByIndex(i)],
+                                  f[0],
+                                  f[2],
+                                  angle_eng,
+                                  angle_virial);
+        f[1] = -(f[0] + f[2]);
+
+        // assign 1/3 of the energy and virial to each particle in the angle
+        for (unsigned int j = 0; j < 3; j++)
+            {
+            // do not update ghost particles
+            if (idx[j] < N)
+                {
+                h_force[idx[j]].x += f[j].x;
+                h_force[idx[j]].y += f[j].y;
+                h_force[idx[j]].z += f[j].z;
+                h_force[idx[j]].w += angle_eng * Scalar(1.0 / 3.0);
+                if (compute_virial)
+                    for (unsigned int k = 0; k < 6; k++)
+                        h_virial[k * m_virial_pitch + idx[j]]
+                            += angle_virial[k] * Scalar(1.0 / 3.0);
+                }
+            }
+        }
+    }
+
+/*! \param h_force Force array to add the dihedral forces to
+    \param h_virial Virial array to add the dihedral virials to
+    \param compute_virial Set to true to compute the virial
+*/
+template<class evaluator>
+void FusedBondedForceCompute<evaluator>::computeDihedralForces(Scalar4* h_force,
+                                                               Scalar* h_virial,
+                                                               bool compute_virial)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_params(m_dihedral_params, access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int max_local = N + m_pdata->getNGhosts();
+
+    const unsigned int size = (unsigned int)m_dihedral_data->getN();
+    for (unsigned int i = 0; i < size; i++)
+        {
+        const DihedralData::members_t& dihedral = m_dihedral_data->getMembersByIndex(i);
+
+        unsigned int idx[4];
+        for (unsigned int j = 0; j < 4; j++)
+            {
+            assert(dihedral.tag[j] <= m_pdata->getMaximumTag());
+            idx[j] = h_rtag.data[dihedral.tag[j]];
+            }
+
+        // throw an error if this dihedral is incomplete
+        if (idx[0] >= max_local || idx[1] >= max_local || idx[2] >= max_local
+            || idx[3] >= max_local)
+            {
+            std::ostringstream stream;
+            stream << "Error: dihedral " << dihedral.tag[0] << " " << dihedral.tag[1] << " "
+                   << dihedral.tag[2] << " " << dihedral.tag[3] << " is incomplete.";
+            throw std::runtime_error(stream.str());
+            }
+
+        Scalar3 pos[4];
+        for (unsigned int j = 0; j < 4; j++)
+            pos[j] = make_scalar3(h_pos.data[idx[j]].x, h_pos.data[idx[j]].y, h_pos.data[idx[j]].z);
+
+        Scalar3 dab = box.minImage(pos[0] - pos[1]);
+        Scalar3 dcb = box.minImage(pos[2] - pos[1]);
+        Scalar3 ddc = box.minImage(pos[3] - pos[2]);
+
+        Scalar3 f[4];
+        Scalar dihedral_eng;
+        Scalar dihedral_virial[6];
+        detail::evalPeriodicDihedral(dab,
+                                     dcb,
+                                     ddc,
+                                     h_params.data[m_dihedral_data->getTypeByIndex(i)],
+                                     f[0],
+                                     f[1],
+                                     f[2],
+                                     f[3],
+                                     dihedral_eng,
+                                     dihedral_virial);
+
+        // assign 1/4 of the energy and virial to each particle in the dihedral
+        for (unsigned int j = 0; j < 4; j++)
+            {
+            // do not update ghost particles
+            if (idx[j] < N)
+                {
+                h_force[idx[j]].x += f[j].x;
+                h_force[idx[j]].y += f[j].y;
+                h_force[idx[j]].z += f[j].z;
+                h_force[idx[j]].w += dihedral_eng * Scalar(0.25);
+                if (compute_virial)
+                    for (unsigned int k = 0; k < 6; k++)
+                        h_virial[k * m_virial_pitch + idx[j]] += dihedral_virial[k] * Scalar(0.25);
+                }
+            }
+        }
+    }
+
+#ifdef ENABLE_MPI
+/*! \param timestep Current time step
+ */
+template<class evaluator>
+CommFlags FusedBondedForceCompute<evaluator>::getRequestedCommFlags(uint64_t timestep)
+    {
+    CommFlags flags = CommFlags(0);
+
+    flags[comm_flag::tag] = 1;
+
+    if (evaluator::needsCharge())
+        flags[comm_flag::charge] = 1;
+
+    flags |= ForceCompute::getRequestedCommFlags(timestep);
+
+    return flags;
+    }
+#endif
+
+namespace detail
+    {
+//! Exports the FusedBondedForceCompute class to python
+/*! \param name Name of the class in the exported python module
+    \tparam T Evaluator type to export.
+*/
+template<class T> void export_FusedBondedForceCompute(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<FusedBondedForceCompute<T>,
+                     ForceCompute,
+                     std::shared_ptr<FusedBondedForceCompute<T>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+        .def("setBondParams", &FusedBondedForceCompute<T>::setBondParamsPython)
+        .def("getBondParams", &FusedBondedForceCompute<T>::getBondParams)
+        .def("setAngleParams", &FusedBondedForceCompute<T>::setAngleParamsPython)
+        .def("getAngleParams", &FusedBondedForceCompute<T>::getAngleParams)
+        .def("setDihedralParams", &FusedBondedForceCompute<T>::setDihedralParamsPython)
+        .def("getDihedralParams", &FusedBondedForceCompute<T>::getDihedralParams);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __FUSED_BONDED_FORCE_COMPUTE_H__
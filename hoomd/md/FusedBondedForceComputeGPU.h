@@ -0,0 +1,210 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __FUSED_BONDED_FORCE_COMPUTE_GPU_H__
+#define __FUSED_BONDED_FORCE_COMPUTE_GPU_H__
+
+#ifdef ENABLE_HIP
+
+#include "FusedBondedForceCompute.h"
+#include "FusedBondedForceGPU.cuh"
+#include "hoomd/Autotuner.h"
+
+/*! \file FusedBondedForceComputeGPU.h
+    \brief Defines the template class for fused bonded forces on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Template class for computing fused bonded forces on the GPU
+/*! FusedBondedForceComputeGPU launches a single kernel that computes the bond, angle, and dihedral
+    forces on each particle. Each thread reads the particle's entries in the bond, angle, and
+    dihedral GPU tables in turn and writes the total force, energy, and virial once.
+
+    \tparam evaluator EvaluatorBond class used to evaluate V(r) and F(r)/r
+
+    \sa export_FusedBondedForceComputeGPU()
+*/
+template<class evaluator>
+class FusedBondedForceComputeGPU : public FusedBondedForceCompute<evaluator>
+    {
+    public:
+    //! Construct the compute
+    FusedBondedForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef);
+
+    //! Destructor
+    virtual ~FusedBondedForceComputeGPU() { }
+
+    protected:
+    std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
+    GPUArray<unsigned int> m_flags;        //!< Flags set during the kernel execution
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+template<class evaluator>
+FusedBondedForceComputeGPU<evaluator>::FusedBondedForceComputeGPU(
+    std::shared_ptr<SystemDefinition> sysdef)
+    : FusedBondedForceCompute<evaluator>(sysdef)
+    {
+    // can't run on the GPU if there aren't any GPUs in the execution configuration
+    if (!this->m_exec_conf->isCUDAEnabled())
+        {
+        this->m_exec_conf->msg->error()
+            << "Creating a FusedBondedForceComputeGPU with no GPU in the execution configuration"
+            << std::endl;
+        throw std::runtime_error("Error initializing FusedBondedForceComputeGPU");
+        }
+
+    // allocate flags storage on the GPU
+    GPUArray<unsigned int> flags(1, this->m_exec_conf);
+    m_flags.swap(flags);
+
+    // reset flags
+    ArrayHandle<unsigned int> h_flags(m_flags, access_location::host, access_mode::overwrite);
+    h_flags.data[0] = 0;
+
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                   this->m_exec_conf,
+                                   "fused_bonded_" + evaluator::getName()));
+    this->m_autotuners.push_back(m_tuner);
+    }
+
+template<class evaluator>
+void FusedBondedForceComputeGPU<evaluator>::computeForces(uint64_t timestep)
+    {
+    // access the particle data
+    ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                 access_location::device,
+                                 access_mode::read);
+
+    // we are using the minimum image of the global box here
+    // to ensure that ghosts are always correctly wrapped (even if a bond exceeds half the domain
+    // length)
+    BoxDim box = this->m_pdata->getGlobalBox();
+
+    // access parameters
+    ArrayHandle<typename evaluator::param_type> d_bond_params(this->m_bond_params,
+                                                              access_location::device,
+                                                              access_mode::read);
+    ArrayHandle<Scalar2> d_angle_params(this->m_angle_params,
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<Scalar4> d_dihedral_params(this->m_dihedral_params,
+                                           access_location::device,
+                                           access_mode::read);
+
+    // access force & virial
+    ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::overwrite);
+
+        {
+        // access the GPU tables (the tables are rebuilt before the group counts are read)
+        ArrayHandle<BondData::members_t> d_bond_table(this->m_bond_data->getGPUTable(),
+                                                      access_location::device,
+                                                      access_mode::read);
+        ArrayHandle<unsigned int> d_n_bonds(this->m_bond_data->getNGroupsArray(),
+                                            access_location::device,
+                                            access_mode::read);
+
+        ArrayHandle<AngleData::members_t> d_angle_table(this->m_angle_data->getGPUTable(),
+                                                        access_location::device,
+                                                        access_mode::read);
+        ArrayHandle<unsigned int> d_angle_pos(this->m_angle_data->getGPUPosTable(),
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> d_n_angles(this->m_angle_data->getNGroupsArray(),
+                                             access_location::device,
+                                             access_mode::read);
+
+        ArrayHandle<DihedralData::members_t> d_dihedral_table(this->m_dihedral_data->getGPUTable(),
+                                                              access_location::device,
+                                                              access_mode::read);
+        ArrayHandle<unsigned int> d_dihedral_pos(this->m_dihedral_data->getGPUPosTable(),
+                                                 access_location::device,
+                                                 access_mode::read);
+        ArrayHandle<unsigned int> d_n_dihedrals(this->m_dihedral_data->getNGroupsArray(),
+                                                access_location::device,
+                                                access_mode::read);
+
+        // access the flags array for overwriting
+        ArrayHandle<unsigned int> d_flags(m_flags, access_location::device, access_mode::readwrite);
+
+        this->m_tuner->begin();
+        kernel::gpu_compute_fused_bonded_forces<evaluator>(
+            kernel::fused_bonded_args_t(d_force.data,
+                                        d_virial.data,
+                                        this->m_virial.getPitch(),
+                                        this->m_pdata->getN(),
+                                        d_pos.data,
+                                        d_charge.data,
+                                        box,
+                                        d_bond_table.data,
+                                        this->m_bond_data->getGPUTableIndexer(),
+                                        d_n_bonds.data,
+                                        d_angle_table.data,
+                                        d_angle_pos.data,
+                                        this->m_angle_data->getGPUTableIndexer(),
+                                        d_n_angles.data,
+                                        d_dihedral_table.data,
+                                        d_dihedral_pos.data,
+                                        this->m_dihedral_data->getGPUTableIndexer(),
+                                        d_n_dihedrals.data,
+                                        this->m_tuner->getParam()[0]),
+            d_bond_params.data,
+            d_angle_params.data,
+            d_dihedral_params.data,
+            d_flags.data);
+        }
+
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        {
+        CHECK_CUDA_ERROR();
+
+        // check the flags for any errors
+        ArrayHandle<unsigned int> h_flags(m_flags, access_location::host, access_mode::read);
+
+        if (h_flags.data[0] & 1)
+            {
+            this->m_exec_conf->msg->error()
+                << "bonded." << evaluator::getName() << ": bond out of bounds (" << h_flags.data[0]
+                << ")" << std::endl
+                << std::endl;
+            throw std::runtime_error("Error in bond calculation");
+            }
+        }
+    this->m_tuner->end();
+    }
+
+namespace detail
+    {
+//! Export this fused bonded force to python
+/*! \param name Name of the class in the exported python module
+    \tparam T Evaluator type to export.
+*/
+template<class T>
+void export_FusedBondedForceComputeGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<FusedBondedForceComputeGPU<T>,
+                     FusedBondedForceCompute<T>,
+                     std::shared_ptr<FusedBondedForceComputeGPU<T>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+#endif // __FUSED_BONDED_FORCE_COMPUTE_GPU_H__
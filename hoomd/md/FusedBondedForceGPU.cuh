@@ -0,0 +1,349 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+#include "hoomd/BondedGroupData.cuh"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/ParticleData.cuh"
+#include "hoomd/TextureTools.h"
+
+#include "FusedBondedTerms.h"
+
+#include <assert.h>
+
+/*! \file FusedBondedForceGPU.cuh
+    \brief Defines templated GPU kernel code for calculating bond, angle, and dihedral forces in one
+   pass.
+*/
+
+#ifndef __FUSED_BONDED_FORCE_GPU_CUH__
+#define __FUSED_BONDED_FORCE_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Wraps arguments to kernel driver
+struct fused_bonded_args_t
+    {
+    //! Construct a fused_bonded_args_t
+    fused_bonded_args_t(Scalar4* _d_force,
+                        Scalar* _d_virial,
+                        const size_t _virial_pitch,
+                        const unsigned int _N,
+                        const Scalar4* _d_pos,
+                        const Scalar* _d_charge,
+                        const BoxDim& _box,
+                        const group_storage<2>* _d_bond_table,
+                        const Index2D& _bond_table_indexer,
+                        const unsigned int* _d_n_bonds,
+                        const group_storage<3>* _d_angle_table,
+                        const unsigned int* _d_angle_pos,
+                        const Index2D& _angle_table_indexer,
+                        const unsigned int* _d_n_angles,
+                        const group_storage<4>* _d_dihedral_table,
+                        const unsigned int* _d_dihedral_pos,
+                        const Index2D& _dihedral_table_indexer,
+                        const unsigned int* _d_n_dihedrals,
+                        const unsigned int _block_size)
+        : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), d_pos(_d_pos),
+          d_charge(_d_charge), box(_box), d_bond_table(_d_bond_table),
+          bond_table_indexer(_bond_table_indexer), d_n_bonds(_d_n_bonds),
+          d_angle_table(_d_angle_table), d_angle_pos(_d_angle_pos),
+          angle_table_indexer(_angle_table_indexer), d_n_angles(_d_n_angles),
+          d_dihedral_table(_d_dihedral_table), d_dihedral_pos(_d_dihedral_pos),
+          dihedral_table_indexer(_dihedral_table_indexer), d_n_dihedrals(_d_n_dihedrals),
+          block_size(_block_size) { };
+
+    Scalar4* d_force;          //!< Force to write out
+    Scalar* d_virial;          //!< Virial to write out
+    const size_t virial_pitch; //!< pitch of 2D array of virial matrix elements
+    const unsigned int N;      //!< number of particles
+    const Scalar4* d_pos;      //!< particle positions
+    const Scalar* d_charge;    //!< particle charges
+    const BoxDim box;          //!< Simulation box in GPU format
+
+    const group_storage<2>* d_bond_table; //!< List of bonds stored on the GPU
+    const Index2D bond_table_indexer;     //!< Indexer of 2D bond list
+    const unsigned int* d_n_bonds;        //!< Number of bonds of each particle
+
+    const group_storage<3>* d_angle_table; //!< List of angles stored on the GPU
+    const unsigned int* d_angle_pos;       //!< Position of each particle in its angles
+    const Index2D angle_table_indexer;     //!< Indexer of 2D angle list
+    const unsigned int* d_n_angles;        //!< Number of angles of each particle
+
+    const group_storage<4>* d_dihedral_table; //!< List of dihedrals stored on the GPU
+    const unsigned int* d_dihedral_pos;       //!< Position of each particle in its dihedrals
+    const Index2D dihedral_table_indexer;     //!< Indexer of 2D dihedral list
+    const unsigned int* d_n_dihedrals;        //!< Number of dihedrals of each particle
+
+    const unsigned int block_size; //!< Block size to execute
+    };
+
+#ifdef __HIPCC__
+
+//! Kernel for calculating bond, angle, and dihedral forces
+/*! Each thread computes the total bonded force on one particle. It loops over the bonds, angles,
+    and dihedrals of the particle in the GPU group tables and writes the sum once.
+
+    \param args Arguments to the kernel
+    \param d_bond_params Bond parameters, stored per bond type
+    \param d_angle_params K and t_0 per angle type
+    \param d_dihedral_params K, sign, multiplicity, and phi_0 per dihedral type
+    \param d_flags Flag allocated on the device for use in checking for bonds that cannot be
+   evaluated
+
+    \tparam evaluator EvaluatorBond class to evaluate V(r) and -delta V(r)/r
+*/
+template<class evaluator>
+__global__ void
+gpu_compute_fused_bonded_forces_kernel(const fused_bonded_args_t args,
+                                       const typename evaluator::param_type* d_bond_params,
+                                       const Scalar2* d_angle_params,
+                                       const Scalar4* d_dihedral_params,
+                                       unsigned int* d_flags)
+    {
+    // start by identifying which particle we are to handle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= args.N)
+        return;
+
+    // read in the position of our particle. (MEM TRANSFER: 16 bytes)
+    Scalar4 postype = __ldg(args.d_pos + idx);
+    Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+
+    Scalar q(0);
+    if (evaluator::needsCharge())
+        {
+        q = __ldg(args.d_charge + idx);
+        }
+    else
+        q += 0; // Silence compiler warning.
+
+    // initialize the force and virial to 0
+    Scalar4 force = make_scalar4(0, 0, 0, 0);
+    Scalar virial[6];
+    for (unsigned int i = 0; i < 6; i++)
+        virial[i] = 0;
+
+    // bonds
+    unsigned int n_bonds = args.d_n_bonds[idx];
+    for (unsigned int bond_idx = 0; bond_idx < n_bonds; bond_idx++)
+        {
+        group_storage<2> cur_bond = args.d_bond_table[args.bond_table_indexer(idx, bond_idx)];
+
+        unsigned int cur_bond_idx = cur_bond.idx[0];
+        unsigned int cur_bond_type = cur_bond.idx[1];
+
+        Scalar4 neigh_postype = __ldg(args.d_pos + cur_bond_idx);
+        Scalar3 neigh_pos = make_scalar3(neigh_postype.x, neigh_postype.y, neigh_postype.z);
+
+        Scalar3 dx = args.box.minImage(pos - neigh_pos);
+        Scalar rsq = dot(dx, dx);
+
+        Scalar force_divr = Scalar(0.0);
+        Scalar bond_eng = Scalar(0.0);
+
+        evaluator eval(rsq, d_bond_params[cur_bond_type]);
+
+        if (evaluator::needsCharge())
+            {
+            Scalar neigh_q = __ldg(args.d_charge + cur_bond_idx);
+            eval.setCharge(q, neigh_q);
+            }
+
+        if (!eval.evalForceAndEnergy(force_divr, bond_eng))
+            {
+            *d_flags = 1;
+            return;
+            }
+
+        // the bond is shared by two particles: multiply the energy and virial by 0.5
+        Scalar force_div2r = force_divr * Scalar(0.5);
+        virial[0] += dx.x * dx.x * force_div2r; // xx
+        virial[1] += dx.x * dx.y * force_div2r; // xy
+        virial[2] += dx.x * dx.z * force_div2r; // xz
+        virial[3] += dx.y * dx.y * force_div2r; // yy
+        virial[4] += dx.y * dx.z * force_div2r; // yz
+        virial[5] += dx.z * dx.z * force_div2r; // zz
+
+        force.x += dx.x * force_divr;
+        force.y += dx.y * force_divr;
+        force.z += dx.z * force_divr;
+        force.w += bond_eng * Scalar(0.5);
+        }
+
+    // angles
+    unsigned int n_angles = args.d_n_angles[idx];
+    for (unsigned int angle_idx = 0; angle_idx < n_angles; angle_idx++)
+        {
+        unsigned int table_idx = args.angle_table_indexer(idx, angle_idx);
+        group_storage<3> cur_angle = args.d_angle_table[table_idx];
+        unsigned int cur_angle_abc = args.d_angle_pos[table_idx];
+
+        Scalar4 x_postype = __ldg(args.d_pos + cur_angle.idx[0]);
+        Scalar3 x_pos = make_scalar3(x_postype.x, x_postype.y, x_postype.z);
+        Scalar4 y_postype = __ldg(args.d_pos + cur_angle.idx[1]);
+        Scalar3 y_pos = make_scalar3(y_postype.x, y_postype.y, y_postype.z);
+
+        // the other members are stored in order, skipping this particle
+        Scalar3 a_pos = (cur_angle_abc == 0) ? pos : x_pos;
+        Scalar3 b_pos = (cur_angle_abc == 1) ? pos : ((cur_angle_abc == 0) ? x_pos : y_pos);
+        Scalar3 c_pos = (cur_angle_abc == 2) ? pos : y_pos;
+
+        Scalar3 dab = args.box.minImage(a_pos - b_pos);
+        Scalar3 dcb = args.box.minImage(c_pos - b_pos);
+
+        Scalar3 fab, fcb;
+        Scalar angle_eng;
+        Scalar angle_virial[6];
+        detail::evalHarmonicAngle(dab,
+                                  dcb,
+                                  __ldg(d_angle_params + cur_angle.idx[2]),
+                                  fab,
+                                  fcb,
+                                  angle_eng,
+                                  angle_virial);
+
+        Scalar3 f;
+        if (cur_angle_abc == 0)
+            f = fab;
+        else if (cur_angle_abc == 1)
+            f = -(fab + fcb);
+        else
+            f = fcb;
+
+        // assign 1/3 of the energy and virial to each particle in the angle
+        force.x += f.x;
+        force.y += f.y;
+        force.z += f.z;
+        force.w += angle_eng * Scalar(1.0 / 3.0);
+        for (unsigned int i = 0; i < 6; i++)
+            virial[i] += angle_virial[i] * Scalar(1.0 / 3.0);
+        }
+
+    // dihedrals
+    unsigned int n_dihedrals = args.d_n_dihedrals[idx];
+    for (unsigned int dihedral_idx = 0; dihedral_idx < n_dihedrals; dihedral_idx++)
+        {
+        unsigned int table_idx = args.dihedral_table_indexer(idx, dihedral_idx);
+        group_storage<4> cur_dihedral = args.d_dihedral_table[table_idx];
+        unsigned int cur_dihedral_abcd = args.d_dihedral_pos[table_idx];
+
+        // the other members are stored in order, skipping this particle
+        Scalar3 member_pos[4];
+        unsigned int j = 0;
+        for (unsigned int i = 0; i < 4; i++)
+            {
+            if (i == cur_dihedral_abcd)
+                {
+                member_pos[i] = pos;
+                }
+            else
+                {
+                Scalar4 postype_j = __ldg(args.d_pos + cur_dihedral.idx[j]);
+                member_pos[i] = make_scalar3(postype_j.x, postype_j.y, postype_j.z);
+                j++;
+                }
+            }
+
+        Scalar3 dab = args.box.minImage(member_pos[0] - member_pos[1]);
+        Scalar3 dcb = args.box.minImage(member_pos[2] - member_pos[1]);
+        Scalar3 ddc = args.box.minImage(member_pos[3] - member_pos[2]);
+
+        Scalar3 f[4];
+        Scalar dihedral_eng;
+        Scalar dihedral_virial[6];
+        detail::evalPeriodicDihedral(dab,
+                                     dcb,
+                                     ddc,
+                                     __ldg(d_dihedral_params + cur_dihedral.idx[3]),
+                                     f[0],
+                                     f[1],
+                                     f[2],
+                                     f[3],
+                                     dihedral_eng,
+                                     dihedral_virial);
+
+        // assign 1/4 of the energy and virial to each particle in the dihedral
+        force.x += f[cur_dihedral_abcd].x;
+        force.y += f[cur_dihedral_abcd].y;
+        force.z += f[cur_dihedral_abcd].z;
+        force.w += dihedral_eng * Scalar(0.25);
+        for (unsigned int i = 0; i < 6; i++)
+            virial[i] += dihedral_virial[i] * Scalar(0.25);
+        }
+
+    // now that the force calculation is complete, write out the result (MEM TRANSFER: 20 bytes)
+    args.d_force[idx] = force;
+
+    for (unsigned int i = 0; i < 6; i++)
+        args.d_virial[i * args.virial_pitch + idx] = virial[i];
+    }
+
+//! Kernel driver that computes the fused bonded forces on the GPU for FusedBondedForceComputeGPU
+/*! \param args Other arguments to pass onto the kernel
+    \param d_bond_params Bond parameters, stored per bond type
+    \param d_angle_params K and t_0 per angle type
+    \param d_dihedral_params K, sign, multiplicity, and phi_0 per dihedral type
+    \param d_flags flags on the device - a 1 will be written if evaluation
+                   of forces failed for any bond
+
+    This is just a driver function for gpu_compute_fused_bonded_forces_kernel(), see it for details.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_fused_bonded_forces(const kernel::fused_bonded_args_t& args,
+                                const typename evaluator::param_type* d_bond_params,
+                                const Scalar2* d_angle_params,
+                                const Scalar4* d_dihedral_params,
+                                unsigned int* d_flags)
+    {
+    // check that block_size is valid
+    assert(args.block_size != 0);
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr,
+                         reinterpret_cast<const void*>(
+                             &gpu_compute_fused_bonded_forces_kernel<evaluator>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(args.block_size, max_block_size);
+
+    // setup the grid to run the kernel
+    dim3 grid(args.N / run_block_size + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_fused_bonded_forces_kernel<evaluator>),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       args,
+                       d_bond_params,
+                       d_angle_params,
+                       d_dihedral_params,
+                       d_flags);
+
+    return hipSuccess;
+    }
+#else
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_fused_bonded_forces(const kernel::fused_bonded_args_t& args,
+                                const typename evaluator::param_type* d_bond_params,
+                                const Scalar2* d_angle_params,
+                                const Scalar4* d_dihedral_params,
+                                unsigned int* d_flags);
+#endif
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __FUSED_BONDED_FORCE_GPU_CUH__
@@ -0,0 +1,213 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __FUSED_BONDED_TERMS_H__
+#define __FUSED_BONDED_TERMS_H__
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file FusedBondedTerms.h
+    \brief Defines the angle and dihedral terms evaluated by FusedBondedForceCompute
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#else
+#define DEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Evaluate the harmonic angle term
+/*! \param dab Minimum image vector from b to a
+    \param dcb Minimum image vector from b to c
+    \param params K and t_0 packed in a Scalar2
+    \param fab Output parameter to write the force on a
+    \param fcb Output parameter to write the force on c. The force on b is -(fab + fcb).
+    \param energy Output parameter to write the energy of the angle
+    \param virial Output parameter to write the upper triangular virial of the angle
+
+    The force, energy, and virial are those computed by HarmonicAngleForceCompute.
+*/
+DEVICE inline void evalHarmonicAngle(const Scalar3& dab,
+                                     const Scalar3& dcb,
+                                     const Scalar2& params,
+                                     Scalar3& fab,
+                                     Scalar3& fcb,
+                                     Scalar& energy,
+                                     Scalar* virial)
+    {
+    Scalar K = params.x;
+    Scalar t_0 = params.y;
+
+    Scalar rsqab = dot(dab, dab);
+    Scalar rab = fast::sqrt(rsqab);
+    Scalar rsqcb = dot(dcb, dcb);
+    Scalar rcb = fast::sqrt(rsqcb);
+
+    Scalar c_abbc = dot(dab, dcb);
+    c_abbc /= rab * rcb;
+
+    if (c_abbc > Scalar(1.0))
+        c_abbc = Scalar(1.0);
+    if (c_abbc < -Scalar(1.0))
+        c_abbc = -Scalar(1.0);
+
+    Scalar s_abbc = fast::sqrt(Scalar(1.0) - c_abbc * c_abbc);
+    if (s_abbc < Scalar(0.001))
+        s_abbc = Scalar(0.001);
+    s_abbc = Scalar(1.0) / s_abbc;
+
+    // actually calculate the force
+    Scalar dth = fast::acos(c_abbc) - t_0;
+    Scalar tk = K * dth;
+
+    Scalar a = -Scalar(1.0) * tk * s_abbc;
+    Scalar a11 = a * c_abbc / rsqab;
+    Scalar a12 = -a / (rab * rcb);
+    Scalar a22 = a * c_abbc / rsqcb;
+
+    fab = a11 * dab + a12 * dcb;
+    fcb = a22 * dcb + a12 * dab;
+
+    energy = tk * dth * Scalar(0.5);
+
+    virial[0] = dab.x * fab.x + dcb.x * fcb.x;
+    virial[1] = dab.y * fab.x + dcb.y * fcb.x;
+    virial[2] = dab.z * fab.x + dcb.z * fcb.x;
+    virial[3] = dab.y * fab.y + dcb.y * fcb.y;
+    virial[4] = dab.z * fab.y + dcb.z * fcb.y;
+    virial[5] = dab.z * fab.z + dcb.z * fcb.z;
+    }
+
+//! Evaluate the periodic dihedral term
+/*! \param dab Minimum image vector from b to a
+    \param dcb Minimum image vector from b to c
+    \param ddc Minimum image vector from c to d
+    \param params K, sign, multiplicity, and phi_0 packed in a Scalar4
+    \param ffa Output parameter to write the force on a
+    \param ffb Output parameter to write the force on b
+    \param ffc Output parameter to write the force on c
+    \param ffd Output parameter to write the force on d
+    \param energy Output parameter to write the energy of the dihedral
+    \param virial Output parameter to write the upper triangular virial of the dihedral
+
+    The force, energy, and virial are those computed by HarmonicDihedralForceCompute.
+*/
+DEVICE inline void evalPeriodicDihedral(const Scalar3& dab,
+                                        const Scalar3& dcb,
+                                        const Scalar3& ddc,
+                                        const Scalar4& params,
+                                        Scalar3& ffa,
+                                        Scalar3& ffb,
+                                        Scalar3& ffc,
+                                        Scalar3& ffd,
+                                        Scalar& energy,
+                                        Scalar* virial)
+    {
+    Scalar K = params.x;
+    Scalar sign = params.y;
+    int multi = int(params.z + Scalar(0.5));
+    Scalar phi_0 = params.w;
+
+    Scalar3 dcbm = -dcb;
+
+    Scalar3 aa = make_scalar3(dab.y * dcbm.z - dab.z * dcbm.y,
+                              dab.z * dcbm.x - dab.x * dcbm.z,
+                              dab.x * dcbm.y - dab.y * dcbm.x);
+    Scalar3 bb = make_scalar3(ddc.y * dcbm.z - ddc.z * dcbm.y,
+                              ddc.z * dcbm.x - ddc.x * dcbm.z,
+                              ddc.x * dcbm.y - ddc.y * dcbm.x);
+
+    Scalar raasq = dot(aa, aa);
+    Scalar rbbsq = dot(bb, bb);
+    Scalar rgsq = dot(dcbm, dcbm);
+    Scalar rg = fast::sqrt(rgsq);
+
+    Scalar rginv, raa2inv, rbb2inv;
+    rginv = raa2inv = rbb2inv = Scalar(0.0);
+    if (rg > Scalar(0.0))
+        rginv = Scalar(1.0) / rg;
+    if (raasq > Scalar(0.0))
+        raa2inv = Scalar(1.0) / raasq;
+    if (rbbsq > Scalar(0.0))
+        rbb2inv = Scalar(1.0) / rbbsq;
+    Scalar rabinv = fast::sqrt(raa2inv * rbb2inv);
+
+    Scalar c_abcd = dot(aa, bb) * rabinv;
+    Scalar s_abcd = rg * rabinv * dot(aa, ddc);
+
+    if (c_abcd > Scalar(1.0))
+        c_abcd = Scalar(1.0);
+    if (c_abcd < -Scalar(1.0))
+        c_abcd = -Scalar(1.0);
+
+    Scalar p = Scalar(1.0);
+    Scalar ddfab = Scalar(0.0);
+    Scalar dfab = Scalar(0.0);
+
+    for (int j = 0; j < multi; j++)
+        {
+        ddfab = p * c_abcd - dfab * s_abcd;
+        dfab = p * s_abcd + dfab * c_abcd;
+        p = ddfab;
+        }
+
+    Scalar sin_phi_0 = fast::sin(phi_0);
+    Scalar cos_phi_0 = fast::cos(phi_0);
+    p = p * cos_phi_0 + dfab * sin_phi_0;
+    p *= sign;
+    dfab = dfab * cos_phi_0 - ddfab * sin_phi_0;
+    dfab *= sign;
+    dfab *= -Scalar(multi);
+    p += Scalar(1.0);
+
+    if (multi == 0)
+        {
+        p = Scalar(1.0) + sign;
+        dfab = Scalar(0.0);
+        }
+
+    Scalar fg = dot(dab, dcbm);
+    Scalar hg = dot(ddc, dcbm);
+
+    Scalar fga = fg * raa2inv * rginv;
+    Scalar hgb = hg * rbb2inv * rginv;
+    Scalar gaa = -raa2inv * rg;
+    Scalar gbb = rbb2inv * rg;
+
+    Scalar3 dtf = gaa * aa;
+    Scalar3 dtg = fga * aa - hgb * bb;
+    Scalar3 dth = gbb * bb;
+
+    // the 0.5 term is for 1/2K in the forces
+    Scalar df = -K * dfab * Scalar(0.5);
+
+    Scalar3 s2 = df * dtg;
+    ffa = df * dtf;
+    ffb = s2 - ffa;
+    ffd = df * dth;
+    ffc = -s2 - ffd;
+
+    energy = p * K * Scalar(0.5);
+
+    virial[0] = dab.x * ffa.x + dcb.x * ffc.x + (ddc.x + dcb.x) * ffd.x;
+    virial[1] = dab.y * ffa.x + dcb.y * ffc.x + (ddc.y + dcb.y) * ffd.x;
+    virial[2] = dab.z * ffa.x + dcb.z * ffc.x + (ddc.z + dcb.z) * ffd.x;
+    virial[3] = dab.y * ffa.y + dcb.y * ffc.y + (ddc.y + dcb.y) * ffd.y;
+    virial[4] = dab.z * ffa.y + dcb.z * ffc.y + (ddc.z + dcb.z) * ffd.y;
+    virial[5] = dab.z * ffa.z + dcb.z * ffc.z + (ddc.z + dcb.z) * ffd.z;
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __FUSED_BONDED_TERMS_H__
@@ -0,0 +1,922 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GradientEnergyMinimizer.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/Communicator.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+
+/*! \file GradientEnergyMinimizer.cc
+    \brief Contains code for the GradientEnergyMinimizer class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef SystemDefinition this method will act on. Must not be NULL.
+    \param max_step Maximum distance any particle moves in one step
+    \param conjugate_gradient Set to true to use conjugate gradient directions instead of L-BFGS
+
+    \post The method is constructed with the given particle data.
+*/
+GradientEnergyMinimizer::GradientEnergyMinimizer(std::shared_ptr<SystemDefinition> sysdef,
+                                                 Scalar max_step,
+                                                 bool conjugate_gradient)
+    : IntegratorTwoStep(sysdef, Scalar(0.0)), m_max_step(max_step),
+      m_max_rotation(Scalar(0.1)), m_history_size(10), m_conjugate_gradient(conjugate_gradient),
+      m_ftol(Scalar(1e-1)), m_ttol(Scalar(1e-1)), m_etol(Scalar(1e-5)), m_run_minsteps(10),
+      m_box_relax(false), m_pressure(Scalar(0.0)), m_energy(Scalar(0.0)),
+      m_energy_old(Scalar(0.0)), m_order_changed(false), m_n_members(0), m_n_vec(0),
+      m_n_history(0), m_history_head(0), m_step_valid(false), m_gg_old(Scalar(0.0)),
+      m_fsq_old(Scalar(0.0)), m_tsq_old(Scalar(0.0))
+    {
+    m_exec_conf->msg->notice(5) << "Constructing GradientEnergyMinimizer" << endl;
+
+    // sanity check
+    assert(m_sysdef);
+    assert(m_pdata);
+
+    setMaxStep(max_step);
+
+    m_pdata->getParticleSortSignal()
+        .connect<GradientEnergyMinimizer, &GradientEnergyMinimizer::slotParticlesSorted>(this);
+
+    reset();
+    }
+
+GradientEnergyMinimizer::~GradientEnergyMinimizer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying GradientEnergyMinimizer" << endl;
+
+    m_pdata->getParticleSortSignal()
+        .disconnect<GradientEnergyMinimizer, &GradientEnergyMinimizer::slotParticlesSorted>(this);
+    }
+
+/*! \param max_step is the new maximum displacement
+ */
+void GradientEnergyMinimizer::setMaxStep(Scalar max_step)
+    {
+    if (!(max_step > 0.0))
+        {
+        throw runtime_error("max_step must be positive.");
+        }
+    m_max_step = max_step;
+    }
+
+/*! \param max_rotation is the new maximum rotation angle
+ */
+void GradientEnergyMinimizer::setMaxRotation(Scalar max_rotation)
+    {
+    if (!(max_rotation > 0.0))
+        {
+        throw runtime_error("max_rotation must be positive.");
+        }
+    m_max_rotation = max_rotation;
+    }
+
+/*! \param history_size is the new number of step pairs to keep
+ */
+void GradientEnergyMinimizer::setHistorySize(unsigned int history_size)
+    {
+    if (history_size == 0)
+        {
+        throw runtime_error("history_size must be positive.");
+        }
+    m_history_size = history_size;
+    resetHistory();
+    }
+
+void GradientEnergyMinimizer::setPressure(pybind11::object pressure)
+    {
+    m_box_relax = !pressure.is_none();
+    if (m_box_relax)
+        {
+        m_pressure = pressure.cast<Scalar>();
+        }
+    resetHistory();
+    }
+
+pybind11::object GradientEnergyMinimizer::getPressure()
+    {
+    if (!m_box_relax)
+        {
+        return pybind11::none();
+        }
+    return pybind11::cast(m_pressure);
+    }
+
+PDataFlags GradientEnergyMinimizer::getRequestedPDataFlags()
+    {
+    PDataFlags flags = IntegratorTwoStep::getRequestedPDataFlags();
+
+    // the line search and the convergence test read the potential energy
+    flags[pdata_flag::potential_energy] = 1;
+
+    // the box gradient is computed from the virial
+    if (m_box_relax)
+        {
+        flags[pdata_flag::pressure_tensor] = 1;
+        }
+
+    return flags;
+    }
+
+void GradientEnergyMinimizer::reset()
+    {
+    m_converged = false;
+    m_was_reset = true;
+    m_n_since_start = 0;
+    m_energy = Scalar(0.0);
+    m_step_scale = Scalar(1.0);
+    resetHistory();
+    }
+
+void GradientEnergyMinimizer::updateMembers()
+    {
+    unsigned int n_members = 0;
+    for (auto& method : m_methods)
+        n_members += method->getGroup()->getNumMembers();
+
+    unsigned int n_vec = n_members * (m_integrate_rotational_dof ? 2 : 1) + (m_box_relax ? 2 : 0);
+    if (n_members != m_n_members || n_vec != m_n_vec)
+        {
+        resetHistory();
+        }
+    m_n_members = n_members;
+    m_n_vec = n_vec;
+
+    // conjugate gradient directions only need the last step
+    unsigned int n_slots = m_conjugate_gradient ? 1 : m_history_size;
+    if (m_members.getNumElements() < std::max(m_n_members, 1u))
+        {
+        GPUArray<unsigned int> members(std::max(m_n_members, 1u), m_exec_conf);
+        m_members.swap(members);
+        }
+    if (m_gradient.getNumElements() < std::max(m_n_vec, 1u))
+        {
+        GPUArray<Scalar3> gradient(std::max(m_n_vec, 1u), m_exec_conf);
+        m_gradient.swap(gradient);
+        GPUArray<Scalar3> gradient_old(std::max(m_n_vec, 1u), m_exec_conf);
+        m_gradient_old.swap(gradient_old);
+        GPUArray<Scalar3> direction(std::max(m_n_vec, 1u), m_exec_conf);
+        m_direction.swap(direction);
+        }
+    if (m_s.getNumElements() < size_t(std::max(m_n_vec, 1u)) * n_slots)
+        {
+        GPUArray<Scalar3> s(size_t(std::max(m_n_vec, 1u)) * n_slots, m_exec_conf);
+        m_s.swap(s);
+        GPUArray<Scalar3> y(size_t(std::max(m_n_vec, 1u)) * n_slots, m_exec_conf);
+        m_y.swap(y);
+        resetHistory();
+        }
+    m_rho.resize(n_slots);
+
+    packMembers();
+    }
+
+void GradientEnergyMinimizer::packMembers()
+    {
+    ArrayHandle<unsigned int> h_members(m_members, access_location::host, access_mode::overwrite);
+    unsigned int offset = 0;
+    for (auto& method : m_methods)
+        {
+        std::shared_ptr<ParticleGroup> group = method->getGroup();
+        unsigned int group_size = group->getNumMembers();
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+            h_members.data[offset + group_idx] = group->getMemberIndex(group_idx);
+        offset += group_size;
+        }
+    }
+
+GradientEnergyMinimizer::gradient_sums GradientEnergyMinimizer::computeGradient()
+    {
+    gradient_sums sums = {};
+    const bool twod = m_sysdef->getNDimensions() == 2;
+
+    ArrayHandle<unsigned int> h_members(m_members, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_gradient(m_gradient, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    for (unsigned int k = 0; k < m_n_members; k++)
+        {
+        unsigned int j = h_members.data[k];
+        Scalar4 f = h_net_force.data[j];
+        h_gradient.data[k] = make_scalar3(-f.x, -f.y, twod ? Scalar(0.0) : -f.z);
+        sums.fsq += f.x * f.x + f.y * f.y + (twod ? Scalar(0.0) : f.z * f.z);
+        }
+
+    if (m_integrate_rotational_dof)
+        {
+        ArrayHandle<Scalar4> h_net_torque(m_pdata->getNetTorqueArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                       access_location::host,
+                                       access_mode::read);
+
+        for (unsigned int k = 0; k < m_n_members; k++)
+            {
+            unsigned int j = h_members.data[k];
+            vec3<Scalar> t(h_net_torque.data[j]);
+            quat<Scalar> q(h_orientation.data[j]);
+            vec3<Scalar> I(h_inertia.data[j]);
+
+            // rotate torque into principal frame
+            t = rotate(conj(q), t);
+
+            // ignore torque component along an axis for which the moment of inertia zero
+            if (I.x == 0 || twod)
+                t.x = 0;
+            if (I.y == 0 || twod)
+                t.y = 0;
+            if (I.z == 0)
+                t.z = 0;
+
+            h_gradient.data[m_n_members + k] = make_scalar3(-t.x, -t.y, -t.z);
+            sums.tsq += hoomd::dot(t, t);
+            }
+        }
+
+    // total potential energy and virial, ignoring rigid body constituent particles
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_net_virial(m_pdata->getNetVirial(),
+                                     access_location::host,
+                                     access_mode::read);
+    size_t virial_pitch = m_pdata->getNetVirial().getPitch();
+
+    for (unsigned int j = 0; j < m_pdata->getN(); j++)
+        {
+        if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
+            {
+            sums.energy += h_net_force.data[j].w;
+            if (m_box_relax)
+                {
+                for (unsigned int i = 0; i < 6; i++)
+                    sums.virial[i] += h_net_virial.data[j + i * virial_pitch];
+                }
+            }
+        }
+
+    return sums;
+    }
+
+/*! \param x Packed vector to modify
+    \param diag Diagonal box strain entries
+    \param offdiag Off diagonal box strain entries
+*/
+void GradientEnergyMinimizer::setBoxEntries(GPUArray<Scalar3>& x,
+                                            const Scalar3& diag,
+                                            const Scalar3& offdiag)
+    {
+    ArrayHandle<Scalar3> h_x(x, access_location::host, access_mode::readwrite);
+    h_x.data[m_n_vec - 2] = diag;
+    h_x.data[m_n_vec - 1] = offdiag;
+    }
+
+/*! \param x Packed vector to read
+    \param diag Diagonal box strain entries
+    \param offdiag Off diagonal box strain entries
+*/
+void GradientEnergyMinimizer::getBoxEntries(const GPUArray<Scalar3>& x,
+                                            Scalar3& diag,
+                                            Scalar3& offdiag)
+    {
+    ArrayHandle<Scalar3> h_x(x, access_location::host, access_mode::read);
+    diag = h_x.data[m_n_vec - 2];
+    offdiag = h_x.data[m_n_vec - 1];
+    }
+
+Scalar GradientEnergyMinimizer::dotLocal(const GPUArray<Scalar3>& x,
+                                         unsigned int offset_x,
+                                         const GPUArray<Scalar3>& y,
+                                         unsigned int offset_y)
+    {
+    ArrayHandle<Scalar3> h_x(x, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_y(y, access_location::host, access_mode::read);
+
+    Scalar result(0.0);
+    for (unsigned int i = 0; i < m_n_vec; i++)
+        {
+        Scalar3 a = h_x.data[offset_x + i];
+        Scalar3 b = h_y.data[offset_y + i];
+        result += a.x * b.x + a.y * b.y + a.z * b.z;
+        }
+    return result;
+    }
+
+void GradientEnergyMinimizer::axpby(Scalar a,
+                                    const GPUArray<Scalar3>& x,
+                                    unsigned int offset_x,
+                                    Scalar b,
+                                    GPUArray<Scalar3>& y,
+                                    unsigned int offset_y)
+    {
+    ArrayHandle<Scalar3> h_x(x, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_y(y, access_location::host, access_mode::readwrite);
+
+    for (unsigned int i = 0; i < m_n_vec; i++)
+        {
+        Scalar3 u = h_x.data[offset_x + i];
+        Scalar3 v = h_y.data[offset_y + i];
+        if (b == Scalar(0.0))
+            v = make_scalar3(0, 0, 0);
+        h_y.data[offset_y + i]
+            = make_scalar3(a * u.x + b * v.x, a * u.y + b * v.y, a * u.z + b * v.z);
+        }
+    }
+
+/*! \param x Packed vector
+    \param translation Set to the largest norm of the translation entries
+    \param rotation Set to the largest norm of the rotation entries
+*/
+void GradientEnergyMinimizer::computeMaxNorms(const GPUArray<Scalar3>& x,
+                                              Scalar& translation,
+                                              Scalar& rotation)
+    {
+    ArrayHandle<Scalar3> h_x(x, access_location::host, access_mode::read);
+
+    Scalar max_tsq(0.0), max_rsq(0.0);
+    for (unsigned int k = 0; k < m_n_members; k++)
+        {
+        Scalar3 d = h_x.data[k];
+        max_tsq = std::max(max_tsq, d.x * d.x + d.y * d.y + d.z * d.z);
+        }
+    if (m_integrate_rotational_dof)
+        {
+        for (unsigned int k = 0; k < m_n_members; k++)
+            {
+            Scalar3 d = h_x.data[m_n_members + k];
+            max_rsq = std::max(max_rsq, d.x * d.x + d.y * d.y + d.z * d.z);
+            }
+        }
+
+    translation = sqrt(max_tsq);
+    rotation = sqrt(max_rsq);
+    }
+
+/*! \param a Step length along m_direction
+ */
+void GradientEnergyMinimizer::applyStep(Scalar a)
+    {
+    const BoxDim& box = m_pdata->getBox();
+
+    ArrayHandle<unsigned int> h_members(m_members, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_direction(m_direction, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
+
+    for (unsigned int k = 0; k < m_n_members; k++)
+        {
+        unsigned int j = h_members.data[k];
+        Scalar3 d = h_direction.data[k];
+        h_pos.data[j].x += a * d.x;
+        h_pos.data[j].y += a * d.y;
+        h_pos.data[j].z += a * d.z;
+        box.wrap(h_pos.data[j], h_image.data[j]);
+        }
+
+    if (m_integrate_rotational_dof)
+        {
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+
+        for (unsigned int k = 0; k < m_n_members; k++)
+            {
+            unsigned int j = h_members.data[k];
+            vec3<Scalar> theta(h_direction.data[m_n_members + k]);
+            theta = theta * a;
+
+            // rotate by theta in the body frame
+            Scalar angle = sqrt(hoomd::dot(theta, theta));
+            if (angle == Scalar(0.0))
+                continue;
+            quat<Scalar> dq(fast::cos(Scalar(0.5) * angle),
+                            theta * (fast::sin(Scalar(0.5) * angle) / angle));
+            quat<Scalar> q(h_orientation.data[j]);
+            q = q * dq;
+            q = q * (Scalar(1.0) / slow::sqrt(norm2(q)));
+            h_orientation.data[j] = quat_to_scalar4(q);
+            }
+        }
+    }
+
+void GradientEnergyMinimizer::saveState()
+    {
+    unsigned int N = m_pdata->getN();
+    if (m_pos_old.getNumElements() < N)
+        {
+        GPUArray<Scalar4> pos_old(N, m_exec_conf);
+        m_pos_old.swap(pos_old);
+        GPUArray<Scalar4> orientation_old(N, m_exec_conf);
+        m_orientation_old.swap(orientation_old);
+        GPUArray<int3> image_old(N, m_exec_conf);
+        m_image_old.swap(image_old);
+        }
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_pos_old(m_pos_old, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_orientation_old(m_orientation_old,
+                                           access_location::host,
+                                           access_mode::overwrite);
+    ArrayHandle<int3> h_image_old(m_image_old, access_location::host, access_mode::overwrite);
+
+    memcpy(h_pos_old.data, h_pos.data, sizeof(Scalar4) * N);
+    memcpy(h_orientation_old.data, h_orientation.data, sizeof(Scalar4) * N);
+    memcpy(h_image_old.data, h_image.data, sizeof(int3) * N);
+    m_box_old = m_pdata->getGlobalBox();
+    }
+
+void GradientEnergyMinimizer::restoreState()
+    {
+    unsigned int N = m_pdata->getN();
+    if (m_box_relax)
+        m_pdata->setGlobalBox(m_box_old);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::overwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::overwrite);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_pos_old(m_pos_old, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation_old(m_orientation_old,
+                                           access_location::host,
+                                           access_mode::read);
+    ArrayHandle<int3> h_image_old(m_image_old, access_location::host, access_mode::read);
+
+    memcpy(h_pos.data, h_pos_old.data, sizeof(Scalar4) * N);
+    memcpy(h_orientation.data, h_orientation_old.data, sizeof(Scalar4) * N);
+    memcpy(h_image.data, h_image_old.data, sizeof(int3) * N);
+    }
+
+Scalar GradientEnergyMinimizer::dot(const GPUArray<Scalar3>& x,
+                                    unsigned int offset_x,
+                                    const GPUArray<Scalar3>& y,
+                                    unsigned int offset_y)
+    {
+    Scalar result = dotLocal(x, offset_x, y, offset_y);
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &result,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return result;
+    }
+
+/*! Apply the two loop recursion to the gradient, using the scaled identity s.y / y.y of the
+    newest history entry as the initial inverse Hessian.
+*/
+void GradientEnergyMinimizer::computeLBFGSDirection()
+    {
+    std::vector<Scalar> alpha(m_n_history);
+
+    // q = g
+    axpby(Scalar(1.0), m_gradient, 0, Scalar(0.0), m_direction, 0);
+
+    // newest to oldest
+    for (unsigned int i = 0; i < m_n_history; i++)
+        {
+        unsigned int slot = (m_history_head + m_history_size - 1 - i) % m_history_size;
+        unsigned int offset = slot * m_n_vec;
+        alpha[i] = m_rho[slot] * dot(m_s, offset, m_direction, 0);
+        axpby(-alpha[i], m_y, offset, Scalar(1.0), m_direction, 0);
+        }
+
+    if (m_n_history > 0)
+        {
+        unsigned int slot = (m_history_head + m_history_size - 1) % m_history_size;
+        unsigned int offset = slot * m_n_vec;
+        Scalar yy = dot(m_y, offset, m_y, offset);
+        Scalar gamma = Scalar(1.0) / (m_rho[slot] * yy);
+        axpby(Scalar(0.0), m_direction, 0, gamma, m_direction, 0);
+        }
+
+    // oldest to newest
+    for (unsigned int i = m_n_history; i-- > 0;)
+        {
+        unsigned int slot = (m_history_head + m_history_size - 1 - i) % m_history_size;
+        unsigned int offset = slot * m_n_vec;
+        Scalar beta = m_rho[slot] * dot(m_y, offset, m_direction, 0);
+        axpby(alpha[i] - beta, m_s, offset, Scalar(1.0), m_direction, 0);
+        }
+
+    // d = -q
+    axpby(Scalar(0.0), m_direction, 0, Scalar(-1.0), m_direction, 0);
+    }
+
+/*! \param gg Squared norm of the current gradient
+
+    Compute d = -g + beta d_old with the Polak-Ribiere beta, restarting with steepest descent when
+    beta is negative or there is no previous direction.
+*/
+void GradientEnergyMinimizer::computeCGDirection(Scalar gg)
+    {
+    Scalar beta(0.0);
+    if (m_n_history > 0 && m_gg_old > Scalar(0.0))
+        {
+        beta = (gg - dot(m_gradient, 0, m_gradient_old, 0)) / m_gg_old;
+        beta = std::max(beta, Scalar(0.0));
+        }
+
+    axpby(Scalar(-1.0), m_gradient, 0, beta, m_direction, 0);
+    }
+
+/*! \param diag Diagonal strain (xx, yy, zz)
+    \param offdiag Off diagonal strain (xy, xz, yz)
+
+    Apply the upper triangular deformation (I + e) to the box vectors and local particles.
+*/
+void GradientEnergyMinimizer::deformBox(const Scalar3& diag, const Scalar3& offdiag)
+    {
+    BoxDim box = m_pdata->getGlobalBox();
+    Scalar3 L = box.getL();
+
+    Scalar Lx = (Scalar(1.0) + diag.x) * L.x;
+    Scalar Ly = (Scalar(1.0) + diag.y) * L.y;
+    Scalar Lz = (Scalar(1.0) + diag.z) * L.z;
+    Scalar xy = ((Scalar(1.0) + diag.x) * box.getTiltFactorXY() * L.y + offdiag.x * L.y) / Ly;
+    Scalar xz = ((Scalar(1.0) + diag.x) * box.getTiltFactorXZ() * L.z
+                 + offdiag.x * box.getTiltFactorYZ() * L.z + offdiag.y * L.z)
+                / Lz;
+    Scalar yz = ((Scalar(1.0) + diag.y) * box.getTiltFactorYZ() * L.z + offdiag.z * L.z) / Lz;
+
+    BoxDim new_box = box;
+    new_box.setL(make_scalar3(Lx, Ly, Lz));
+    new_box.setTiltFactors(xy, xz, yz);
+    m_pdata->setGlobalBox(new_box);
+
+    deformParticles(diag, offdiag);
+    }
+
+/*! \param diag Diagonal strain (xx, yy, zz)
+    \param offdiag Off diagonal strain (xy, xz, yz)
+*/
+void GradientEnergyMinimizer::deformParticles(const Scalar3& diag, const Scalar3& offdiag)
+    {
+    const BoxDim& local_box = m_pdata->getBox();
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
+
+    for (unsigned int j = 0; j < m_pdata->getN(); j++)
+        {
+        Scalar4 p = h_pos.data[j];
+        h_pos.data[j].x = (Scalar(1.0) + diag.x) * p.x + offdiag.x * p.y + offdiag.y * p.z;
+        h_pos.data[j].y = (Scalar(1.0) + diag.y) * p.y + offdiag.z * p.z;
+        h_pos.data[j].z = (Scalar(1.0) + diag.z) * p.z;
+        local_box.wrap(h_pos.data[j], h_image.data[j]);
+        }
+    }
+
+/*! \param timestep Current time step
+ */
+void GradientEnergyMinimizer::computeForcesAfterStep(uint64_t timestep)
+    {
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        // Update the rigid body consituent particles before communicating so that any such
+        // particles that move from one domain to another are migrated.
+        updateRigidBodies(timestep + 1);
+
+        // migrate particles and update the ghosts
+        m_comm->communicate(timestep + 1);
+        }
+    else
+#endif
+        {
+        updateRigidBodies(timestep + 1);
+        }
+
+    // compute the net force on all particles
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        computeNetForceGPU(timestep + 1);
+    else
+#endif
+        computeNetForce(timestep + 1);
+    }
+
+/*! \param timestep is the current timestep
+ */
+void GradientEnergyMinimizer::update(uint64_t timestep)
+    {
+    Integrator::update(timestep);
+    if (m_converged)
+        return;
+
+    // ensure that prepRun() has been called
+    assert(m_prepared);
+
+    // the packed vectors and the saved configuration no longer match the particle order
+    if (m_order_changed)
+        {
+        resetHistory();
+        m_order_changed = false;
+        }
+
+    updateMembers();
+
+    for (auto& method : m_methods)
+        method->setAnisotropic(m_integrate_rotational_dof);
+
+    // compute the gradient and the energy at the current configuration
+    gradient_sums sums = computeGradient();
+    sums.energy += m_pdata->getExternalEnergy();
+    for (unsigned int i = 0; i < 6; i++)
+        sums.virial[i] += m_pdata->getExternalVirial(i);
+
+    unsigned int n_members_global = m_n_members;
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &sums.energy,
+                      9,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &n_members_global,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    if (n_members_global == 0)
+        {
+        m_converged = true;
+        return;
+        }
+
+    const bool twod = m_sysdef->getNDimensions() == 2;
+
+    // the box strain degrees of freedom are scaled by the number of members to balance them
+    // with the particle degrees of freedom
+    const Scalar cell_factor = Scalar(n_members_global);
+    if (m_box_relax)
+        {
+        Scalar PV = m_pressure * m_pdata->getGlobalBox().getVolume(twod);
+        sums.energy += PV;
+
+        Scalar3 diag = make_scalar3(PV - sums.virial[0],
+                                    PV - sums.virial[3],
+                                    twod ? Scalar(0.0) : PV - sums.virial[5]);
+        Scalar3 offdiag = make_scalar3(-sums.virial[1],
+                                       twod ? Scalar(0.0) : -sums.virial[2],
+                                       twod ? Scalar(0.0) : -sums.virial[4]);
+        if (m_exec_conf->getRank() != 0)
+            {
+            diag = make_scalar3(0, 0, 0);
+            offdiag = make_scalar3(0, 0, 0);
+            }
+        setBoxEntries(m_gradient,
+                      diag * (Scalar(1.0) / cell_factor),
+                      offdiag * (Scalar(1.0) / cell_factor));
+        }
+
+    Scalar energy = sums.energy / Scalar(n_members_global);
+    if (m_was_reset)
+        {
+        m_was_reset = false;
+        m_energy_old = energy + Scalar(100000) * m_etol;
+        }
+
+    unsigned int ndof = m_sysdef->getNDimensions() * n_members_global;
+    Scalar fnorm = sqrt(sums.fsq);
+    Scalar tnorm = sqrt(sums.tsq);
+    m_exec_conf->msg->notice(10) << "Minimizer fnorm " << fnorm << " tnorm " << tnorm
+                                 << " delta_E " << energy - m_energy_old << std::endl;
+
+    if ((fnorm / sqrt(Scalar(ndof)) < m_ftol && tnorm / sqrt(Scalar(ndof)) < m_ttol
+         && fabs(energy - m_energy_old) < m_etol)
+        && m_n_since_start >= m_run_minsteps)
+        {
+        m_exec_conf->msg->notice(4)
+            << "Minimizer converged in timestep " << timestep << std::endl;
+        m_energy = energy;
+        m_converged = true;
+        return;
+        }
+
+    if (m_step_valid && energy > m_energy_old)
+        {
+        // undo the step that raised the energy and restart from steepest descent
+        m_exec_conf->msg->notice(6) << "Minimizer rejected step" << std::endl;
+        restoreState();
+        axpby(Scalar(1.0), m_gradient_old, 0, Scalar(0.0), m_gradient, 0);
+        energy = m_energy_old;
+        sums.fsq = m_fsq_old;
+        sums.tsq = m_tsq_old;
+        resetHistory();
+        m_step_scale *= Scalar(0.5);
+        }
+    else if (m_step_valid)
+        {
+        // add the last step to the history
+        unsigned int n_slots = m_conjugate_gradient ? 1 : m_history_size;
+        unsigned int offset = m_history_head * m_n_vec;
+        axpby(Scalar(1.0), m_gradient, 0, Scalar(0.0), m_y, offset);
+        axpby(Scalar(-1.0), m_gradient_old, 0, Scalar(1.0), m_y, offset);
+        Scalar sy = dot(m_s, offset, m_y, offset);
+        if (sy > Scalar(0.0))
+            {
+            m_rho[m_history_head] = Scalar(1.0) / sy;
+            m_history_head = (m_history_head + 1) % n_slots;
+            m_n_history = std::min(m_n_history + 1, n_slots);
+            }
+        else
+            {
+            // the curvature condition failed, restart the search
+            m_n_history = 0;
+            m_history_head = 0;
+            }
+        m_step_scale = std::min(m_step_scale * Scalar(1.1), Scalar(1.0));
+        }
+    m_energy = energy;
+
+    // compute the search direction
+    Scalar gg = dot(m_gradient, 0, m_gradient, 0);
+    if (m_conjugate_gradient)
+        computeCGDirection(gg);
+    else
+        computeLBFGSDirection();
+
+    Scalar gd = dot(m_gradient, 0, m_direction, 0);
+    if (!(gd < Scalar(0.0)))
+        {
+        // not a descent direction, use steepest descent
+        axpby(Scalar(-1.0), m_gradient, 0, Scalar(0.0), m_direction, 0);
+        gd = -gg;
+        m_n_history = 0;
+        m_history_head = 0;
+        }
+
+    // limit the largest displacement and rotation
+    Scalar max_translation, max_rotation;
+    computeMaxNorms(m_direction, max_translation, max_rotation);
+    if (m_box_relax)
+        {
+        Scalar3 diag, offdiag;
+        getBoxEntries(m_direction, diag, offdiag);
+        Scalar max_strain = std::max(std::max(std::max(fabs(diag.x), fabs(diag.y)), fabs(diag.z)),
+                                     std::max(std::max(fabs(offdiag.x), fabs(offdiag.y)),
+                                              fabs(offdiag.z)))
+                            / cell_factor;
+        Scalar3 L = m_pdata->getGlobalBox().getL();
+        Scalar L_max = std::max(std::max(L.x, L.y), twod ? Scalar(0.0) : L.z);
+        max_translation = std::max(max_translation, max_strain * L_max);
+        }
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &max_translation,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &max_rotation,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    Scalar limit = std::numeric_limits<Scalar>::infinity();
+    if (max_translation > Scalar(0.0))
+        limit = std::min(limit, m_max_step * m_step_scale / max_translation);
+    if (max_rotation > Scalar(0.0))
+        limit = std::min(limit, m_max_rotation * m_step_scale / max_rotation);
+
+    // step length
+    Scalar a = limit;
+    if (m_n_history > 0)
+        {
+        if (m_conjugate_gradient)
+            {
+            // Newton step along d using the curvature along the last step
+            unsigned int offset = 0;
+            Scalar ss = dot(m_s, offset, m_s, offset);
+            Scalar curvature = Scalar(1.0) / (m_rho[0] * ss);
+            Scalar dd = dot(m_direction, 0, m_direction, 0);
+            a = std::min(limit, -gd / (curvature * dd));
+            }
+        else
+            {
+            a = std::min(limit, Scalar(1.0));
+            }
+        }
+    if (!std::isfinite(a))
+        a = Scalar(0.0);
+
+    // keep the current configuration in case the step raises the energy
+    saveState();
+    axpby(Scalar(1.0), m_gradient, 0, Scalar(0.0), m_gradient_old, 0);
+    m_energy_old = energy;
+    m_gg_old = gg;
+    m_fsq_old = sums.fsq;
+    m_tsq_old = sums.tsq;
+
+    // record and take the step
+    axpby(a, m_direction, 0, Scalar(0.0), m_s, m_history_head * m_n_vec);
+    applyStep(a);
+
+    if (m_box_relax)
+        {
+        Scalar3 diag, offdiag;
+        getBoxEntries(m_direction, diag, offdiag);
+        Scalar strain[6] = {diag.x, diag.y, diag.z, offdiag.x, offdiag.y, offdiag.z};
+#ifdef ENABLE_MPI
+        if (m_pdata->getDomainDecomposition())
+            {
+            MPI_Bcast(strain, 6, MPI_HOOMD_SCALAR, 0, m_exec_conf->getMPICommunicator());
+            }
+#endif
+        Scalar factor = a / cell_factor;
+        deformBox(make_scalar3(strain[0], strain[1], strain[2]) * factor,
+                  make_scalar3(strain[3], strain[4], strain[5]) * factor);
+        }
+
+    m_step_valid = true;
+    m_n_since_start++;
+
+    computeForcesAfterStep(timestep);
+    }
+
+namespace detail
+    {
+void export_GradientEnergyMinimizer(pybind11::module& m)
+    {
+    pybind11::class_<GradientEnergyMinimizer,
+                     IntegratorTwoStep,
+                     std::shared_ptr<GradientEnergyMinimizer>>(m, "GradientEnergyMinimizer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar, bool>())
+        .def("reset", &GradientEnergyMinimizer::reset)
+        .def_property_readonly("converged", &GradientEnergyMinimizer::hasConverged)
+        .def_property_readonly("energy", &GradientEnergyMinimizer::getEnergy)
+        .def_property("max_step",
+                      &GradientEnergyMinimizer::getMaxStep,
+                      &GradientEnergyMinimizer::setMaxStep)
+        .def_property("max_rotation",
+                      &GradientEnergyMinimizer::getMaxRotation,
+                      &GradientEnergyMinimizer::setMaxRotation)
+        .def_property("history_size",
+                      &GradientEnergyMinimizer::getHistorySize,
+                      &GradientEnergyMinimizer::setHistorySize)
+        .def_property("force_tol",
+                      &GradientEnergyMinimizer::getFtol,
+                      &GradientEnergyMinimizer::setFtol)
+        .def_property("torque_tol",
+                      &GradientEnergyMinimizer::getTtol,
+                      &GradientEnergyMinimizer::setTtol)
+        .def_property("energy_tol",
+                      &GradientEnergyMinimizer::getEtol,
+                      &GradientEnergyMinimizer::setEtol)
+        .def_property("min_steps_conv",
+                      &GradientEnergyMinimizer::getMinSteps,
+                      &GradientEnergyMinimizer::setMinSteps)
+        .def_property("pressure",
+                      &GradientEnergyMinimizer::getPressure,
+                      &GradientEnergyMinimizer::setPressure);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
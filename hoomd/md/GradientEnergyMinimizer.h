@@ -0,0 +1,303 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "IntegratorTwoStep.h"
+
+#include <memory>
+#include <vector>
+
+#ifndef __GRADIENT_ENERGY_MINIMIZER_H__
+#define __GRADIENT_ENERGY_MINIMIZER_H__
+
+/*! \file GradientEnergyMinimizer.h
+    \brief Declares the L-BFGS and conjugate gradient energy minimizer class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Minimizes the potential energy with L-BFGS or nonlinear conjugate gradient steps
+/*! \b Overview
+
+    GradientEnergyMinimizer moves the members of its integration method groups directly along a
+    search direction computed from the gradient of the potential energy. The integration methods
+    only select the particles to minimize. Each update performs one force evaluation.
+
+    The degrees of freedom are stored in packed vectors of Scalar3 entries: the translations of
+    all members, then (when integrating rotational degrees of freedom) the body frame rotation
+    vectors of all members, then (when relaxing the box) two entries holding the diagonal and off
+    diagonal box strains. The box entries are non-zero only on the root rank so that MPI reduced
+    dot products count them once.
+
+    The L-BFGS direction uses the two loop recursion over the last history_size steps. The
+    conjugate gradient direction uses the Polak-Ribiere formula with automatic restarts. Neither
+    performs a line search: the step is limited so that no particle moves further than max_step
+    or rotates by more than max_rotation, and a step that raises the energy is undone, the
+    history is discarded, and the step limit is halved.
+
+    The history is discarded whenever the particles are reordered or migrate between ranks.
+
+    Vector operations are virtual so that GradientEnergyMinimizerGPU can perform them on the
+    device.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT GradientEnergyMinimizer : public IntegratorTwoStep
+    {
+    public:
+    //! Constructs the minimizer and associates it with the system
+    GradientEnergyMinimizer(std::shared_ptr<SystemDefinition> sysdef,
+                            Scalar max_step,
+                            bool conjugate_gradient);
+    virtual ~GradientEnergyMinimizer();
+
+    //! Reset the minimization
+    virtual void reset();
+
+    //! Perform one minimization iteration
+    virtual void update(uint64_t timestep);
+
+    //! Get needed pdata flags
+    virtual PDataFlags getRequestedPDataFlags();
+
+    //! Return whether or not the minimization has converged
+    bool hasConverged() const
+        {
+        return m_converged;
+        }
+
+    //! Return the potential energy (or enthalpy) per particle after the last iteration
+    Scalar getEnergy() const
+        {
+        if (m_was_reset)
+            {
+            m_exec_conf->msg->warning()
+                << "The minimizer has just been initialized. Return energy==0." << std::endl;
+            return Scalar(0.0);
+            }
+
+        return m_energy;
+        }
+
+    //! Set the maximum distance any particle moves in one step
+    void setMaxStep(Scalar max_step);
+
+    //! Get the maximum distance any particle moves in one step
+    Scalar getMaxStep()
+        {
+        return m_max_step;
+        }
+
+    //! Set the maximum angle any particle rotates by in one step
+    void setMaxRotation(Scalar max_rotation);
+
+    //! Get the maximum angle any particle rotates by in one step
+    Scalar getMaxRotation()
+        {
+        return m_max_rotation;
+        }
+
+    //! Set the number of previous steps used by L-BFGS
+    void setHistorySize(unsigned int history_size);
+
+    //! Get the number of previous steps used by L-BFGS
+    unsigned int getHistorySize()
+        {
+        return m_history_size;
+        }
+
+    //! Set the stopping criterion based on the total force on all particles in the system
+    void setFtol(Scalar ftol)
+        {
+        m_ftol = ftol;
+        }
+
+    //! Get the stopping criterion based on the total force on all particles in the system
+    Scalar getFtol()
+        {
+        return m_ftol;
+        }
+
+    //! Set the stopping criterion based on the total torque on all particles in the system
+    void setTtol(Scalar ttol)
+        {
+        m_ttol = ttol;
+        }
+
+    //! Get the stopping criterion based on the total torque on all particles in the system
+    Scalar getTtol()
+        {
+        return m_ttol;
+        }
+
+    //! Set the stopping criterion based on the change in energy between successive iterations
+    void setEtol(Scalar etol)
+        {
+        m_etol = etol;
+        }
+
+    //! Get the stopping criterion based on the change in energy between successive iterations
+    Scalar getEtol()
+        {
+        return m_etol;
+        }
+
+    //! Set the minimum number of steps before the other stopping criteria will be evaluated
+    void setMinSteps(unsigned int steps)
+        {
+        m_run_minsteps = steps;
+        }
+
+    //! Get the minimum number of steps before the other stopping criteria will be evaluated
+    unsigned int getMinSteps()
+        {
+        return m_run_minsteps;
+        }
+
+    //! Set the pressure to relax the box to
+    /*! \param pressure Pressure, or None to keep the box fixed
+     */
+    void setPressure(pybind11::object pressure);
+
+    //! Get the pressure to relax the box to (None when the box is fixed)
+    pybind11::object getPressure();
+
+    protected:
+    //! Local sums computed with the gradient
+    struct gradient_sums
+        {
+        Scalar energy;    //!< Potential energy of the local particles
+        Scalar fsq;       //!< Sum of the squared forces on the members
+        Scalar tsq;       //!< Sum of the squared body frame torques on the members
+        Scalar virial[6]; //!< Virial of the local particles
+        };
+
+    Scalar m_max_step;           //!< Maximum displacement in one step
+    Scalar m_max_rotation;       //!< Maximum rotation angle in one step
+    unsigned int m_history_size; //!< Number of step pairs kept by L-BFGS
+    bool m_conjugate_gradient;   //!< Use conjugate gradient directions instead of L-BFGS
+    Scalar m_ftol;               //!< stopping tolerance based on total force
+    Scalar m_ttol;               //!< stopping tolerance based on total torque
+    Scalar m_etol;               //!< stopping tolerance based on the change in energy
+    unsigned int m_run_minsteps; //!< A minimum number of search attempts the search will use
+    bool m_box_relax;            //!< Whether the box is relaxed
+    Scalar m_pressure;           //!< Pressure to relax the box to
+
+    bool m_converged;             //!< whether the minimization has converged
+    bool m_was_reset;             //!< whether or not the minimizer was reset
+    unsigned int m_n_since_start; //!< counts the number of search attempts
+    Scalar m_energy;              //!< Energy per member after the last iteration
+    Scalar m_energy_old;          //!< Energy per member before the last step
+    Scalar m_step_scale;          //!< Factor applied to the step limits after rejected steps
+    bool m_order_changed;         //!< Set when the particles were reordered
+
+    unsigned int m_n_members;      //!< Number of local members of all methods
+    unsigned int m_n_vec;          //!< Number of entries in the packed vectors
+    GPUArray<unsigned int> m_members; //!< Local indices of the members of all methods
+
+    GPUArray<Scalar3> m_gradient;     //!< Gradient at the current configuration
+    GPUArray<Scalar3> m_gradient_old; //!< Gradient before the last step
+    GPUArray<Scalar3> m_direction;    //!< Current search direction
+    GPUArray<Scalar3> m_s;            //!< L-BFGS history of steps
+    GPUArray<Scalar3> m_y;            //!< L-BFGS history of gradient changes
+    std::vector<Scalar> m_rho;        //!< 1 / (s . y) for each history entry
+    unsigned int m_n_history;         //!< Number of valid history entries
+    unsigned int m_history_head;      //!< Slot of the next history entry
+    bool m_step_valid;                //!< Whether the last step may be undone and used as history
+    Scalar m_gg_old;                  //!< Squared norm of the gradient before the last step
+    Scalar m_fsq_old;                 //!< Squared force norm before the last step
+    Scalar m_tsq_old;                 //!< Squared torque norm before the last step
+
+    GPUArray<Scalar4> m_pos_old;         //!< Positions before the last step
+    GPUArray<Scalar4> m_orientation_old; //!< Orientations before the last step
+    GPUArray<int3> m_image_old;          //!< Images before the last step
+    BoxDim m_box_old;                    //!< Box before the last step
+
+    //! Slot for particle sort signal
+    void slotParticlesSorted()
+        {
+        m_order_changed = true;
+        }
+
+    //! Discard the step history
+    void resetHistory()
+        {
+        m_n_history = 0;
+        m_history_head = 0;
+        m_step_valid = false;
+        }
+
+    //! Rebuild the list of members and resize the packed vectors
+    void updateMembers();
+
+    //! Concatenate the members of all methods into m_members
+    virtual void packMembers();
+
+    //! Pack the gradient of the current configuration into m_gradient
+    virtual gradient_sums computeGradient();
+
+    //! Set the box entries of a packed vector
+    virtual void setBoxEntries(GPUArray<Scalar3>& x, const Scalar3& diag, const Scalar3& offdiag);
+
+    //! Get the box entries of a packed vector
+    virtual void getBoxEntries(const GPUArray<Scalar3>& x, Scalar3& diag, Scalar3& offdiag);
+
+    //! Local dot product of two packed vectors
+    virtual Scalar dotLocal(const GPUArray<Scalar3>& x,
+                            unsigned int offset_x,
+                            const GPUArray<Scalar3>& y,
+                            unsigned int offset_y);
+
+    //! y = a * x + b * y for packed vectors
+    virtual void axpby(Scalar a,
+                       const GPUArray<Scalar3>& x,
+                       unsigned int offset_x,
+                       Scalar b,
+                       GPUArray<Scalar3>& y,
+                       unsigned int offset_y);
+
+    //! Compute the largest translation and rotation of the members in a packed vector
+    virtual void computeMaxNorms(const GPUArray<Scalar3>& x, Scalar& translation, Scalar& rotation);
+
+    //! Move the members by a * m_direction
+    virtual void applyStep(Scalar a);
+
+    //! Store the particle configuration
+    virtual void saveState();
+
+    //! Restore the particle configuration stored by saveState()
+    virtual void restoreState();
+
+    //! Global dot product of two packed vectors
+    Scalar dot(const GPUArray<Scalar3>& x,
+               unsigned int offset_x,
+               const GPUArray<Scalar3>& y,
+               unsigned int offset_y);
+
+    //! Compute the L-BFGS search direction
+    void computeLBFGSDirection();
+
+    //! Compute the conjugate gradient search direction
+    void computeCGDirection(Scalar gg);
+
+    //! Deform the local particles by the given strain and wrap them into the current box
+    virtual void deformParticles(const Scalar3& diag, const Scalar3& offdiag);
+
+    //! Deform the box and all local particles by the given strain
+    void deformBox(const Scalar3& diag, const Scalar3& offdiag);
+
+    //! Compute forces at the new configuration
+    void computeForcesAfterStep(uint64_t timestep);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // #ifndef __GRADIENT_ENERGY_MINIMIZER_H__
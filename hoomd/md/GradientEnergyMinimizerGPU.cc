@@ -0,0 +1,391 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GradientEnergyMinimizerGPU.h"
+#include "GradientEnergyMinimizerGPU.cuh"
+
+using namespace std;
+
+/*! \file GradientEnergyMinimizerGPU.cc
+    \brief Contains code for the GradientEnergyMinimizerGPU class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef SystemDefinition this method will act on. Must not be NULL.
+    \param max_step Maximum distance any particle moves in one step
+    \param conjugate_gradient Set to true to use conjugate gradient directions instead of L-BFGS
+*/
+GradientEnergyMinimizerGPU::GradientEnergyMinimizerGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                       Scalar max_step,
+                                                       bool conjugate_gradient)
+    : GradientEnergyMinimizer(sysdef, max_step, conjugate_gradient), m_block_size(256)
+    {
+    // only one GPU is supported
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("GradientEnergyMinimizerGPU requires a GPU device.");
+        }
+
+    // allocate the sum array
+    GPUArray<Scalar> sum(7, m_exec_conf);
+    m_sum.swap(sum);
+
+    // initialize the partial sum array
+    m_partial_sum = GPUVector<Scalar>(m_exec_conf);
+    }
+
+/*! \param n Number of elements to reduce
+    \param n_sums Number of quantities to reduce
+    \returns The number of blocks to execute
+*/
+unsigned int GradientEnergyMinimizerGPU::resizePartialSumArray(unsigned int n, unsigned int n_sums)
+    {
+    unsigned int num_blocks = n / m_block_size + 1;
+    if (num_blocks * n_sums > m_partial_sum.size())
+        {
+        m_partial_sum.resize(num_blocks * n_sums);
+        }
+    return num_blocks;
+    }
+
+void GradientEnergyMinimizerGPU::packMembers()
+    {
+    ArrayHandle<unsigned int> d_members(m_members, access_location::device, access_mode::overwrite);
+    unsigned int offset = 0;
+    for (auto& method : m_methods)
+        {
+        std::shared_ptr<ParticleGroup> group = method->getGroup();
+        unsigned int group_size = group->getNumMembers();
+        ArrayHandle<unsigned int> d_index_array(group->getIndexArray(),
+                                                access_location::device,
+                                                access_mode::read);
+        hipMemcpy(d_members.data + offset,
+                  d_index_array.data,
+                  sizeof(unsigned int) * group_size,
+                  hipMemcpyDeviceToDevice);
+        offset += group_size;
+        }
+    }
+
+GradientEnergyMinimizer::gradient_sums GradientEnergyMinimizerGPU::computeGradient()
+    {
+    gradient_sums sums = {};
+
+        {
+        unsigned int num_blocks = resizePartialSumArray(m_n_members, 2);
+
+        ArrayHandle<unsigned int> d_members(m_members, access_location::device, access_mode::read);
+        ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::read);
+        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<Scalar3> d_gradient(m_gradient,
+                                        access_location::device,
+                                        access_mode::readwrite);
+        ArrayHandle<Scalar> d_partial_sum(m_partial_sum,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar> d_sum(m_sum, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_gradient_compute_gradient(d_members.data,
+                                              m_n_members,
+                                              d_net_force.data,
+                                              d_net_torque.data,
+                                              d_orientation.data,
+                                              d_inertia.data,
+                                              m_integrate_rotational_dof,
+                                              m_sysdef->getNDimensions() == 2,
+                                              d_gradient.data,
+                                              d_sum.data,
+                                              d_partial_sum.data,
+                                              m_block_size,
+                                              num_blocks);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+        {
+        ArrayHandle<Scalar> h_sum(m_sum, access_location::host, access_mode::read);
+        sums.fsq = h_sum.data[0];
+        sums.tsq = h_sum.data[1];
+        }
+
+        {
+        unsigned int num_blocks = resizePartialSumArray(m_pdata->getN(), 7);
+
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar> d_net_virial(m_pdata->getNetVirial(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar> d_partial_sum(m_partial_sum,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar> d_sum(m_sum, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_gradient_compute_energy(m_pdata->getN(),
+                                            d_body.data,
+                                            d_tag.data,
+                                            d_net_force.data,
+                                            d_net_virial.data,
+                                            m_pdata->getNetVirial().getPitch(),
+                                            m_box_relax,
+                                            d_sum.data,
+                                            d_partial_sum.data,
+                                            m_block_size,
+                                            num_blocks);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    ArrayHandle<Scalar> h_sum(m_sum, access_location::host, access_mode::read);
+    sums.energy = h_sum.data[0];
+    if (m_box_relax)
+        {
+        for (unsigned int i = 0; i < 6; i++)
+            sums.virial[i] = h_sum.data[1 + i];
+        }
+
+    return sums;
+    }
+
+void GradientEnergyMinimizerGPU::setBoxEntries(GPUArray<Scalar3>& x,
+                                               const Scalar3& diag,
+                                               const Scalar3& offdiag)
+    {
+    Scalar3 entries[2] = {diag, offdiag};
+    ArrayHandle<Scalar3> d_x(x, access_location::device, access_mode::readwrite);
+    hipMemcpy(d_x.data + m_n_vec - 2, entries, sizeof(Scalar3) * 2, hipMemcpyHostToDevice);
+    }
+
+void GradientEnergyMinimizerGPU::getBoxEntries(const GPUArray<Scalar3>& x,
+                                               Scalar3& diag,
+                                               Scalar3& offdiag)
+    {
+    Scalar3 entries[2];
+    ArrayHandle<Scalar3> d_x(x, access_location::device, access_mode::read);
+    hipMemcpy(entries, d_x.data + m_n_vec - 2, sizeof(Scalar3) * 2, hipMemcpyDeviceToHost);
+    diag = entries[0];
+    offdiag = entries[1];
+    }
+
+Scalar GradientEnergyMinimizerGPU::dotLocal(const GPUArray<Scalar3>& x,
+                                            unsigned int offset_x,
+                                            const GPUArray<Scalar3>& y,
+                                            unsigned int offset_y)
+    {
+        {
+        unsigned int num_blocks = resizePartialSumArray(m_n_vec, 1);
+
+        ArrayHandle<Scalar3> d_x(x, access_location::device, access_mode::read);
+        ArrayHandle<Scalar3> d_y(y, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_partial_sum(m_partial_sum,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar> d_sum(m_sum, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_gradient_dot(m_n_vec,
+                                 d_x.data + offset_x,
+                                 d_y.data + offset_y,
+                                 d_sum.data,
+                                 d_partial_sum.data,
+                                 m_block_size,
+                                 num_blocks);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    ArrayHandle<Scalar> h_sum(m_sum, access_location::host, access_mode::read);
+    return h_sum.data[0];
+    }
+
+void GradientEnergyMinimizerGPU::axpby(Scalar a,
+                                       const GPUArray<Scalar3>& x,
+                                       unsigned int offset_x,
+                                       Scalar b,
+                                       GPUArray<Scalar3>& y,
+                                       unsigned int offset_y)
+    {
+    ArrayHandle<Scalar3> d_x(x, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_y(y, access_location::device, access_mode::readwrite);
+
+    kernel::gpu_gradient_axpby(m_n_vec, a, d_x.data + offset_x, b, d_y.data + offset_y);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+void GradientEnergyMinimizerGPU::computeMaxNorms(const GPUArray<Scalar3>& x,
+                                                 Scalar& translation,
+                                                 Scalar& rotation)
+    {
+        {
+        unsigned int num_blocks = resizePartialSumArray(m_n_members, 2);
+
+        ArrayHandle<Scalar3> d_x(x, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_partial_sum(m_partial_sum,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar> d_sum(m_sum, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_gradient_max_norms(m_n_members,
+                                       m_integrate_rotational_dof,
+                                       d_x.data,
+                                       d_sum.data,
+                                       d_partial_sum.data,
+                                       m_block_size,
+                                       num_blocks);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    ArrayHandle<Scalar> h_sum(m_sum, access_location::host, access_mode::read);
+    translation = sqrt(h_sum.data[0]);
+    rotation = sqrt(h_sum.data[1]);
+    }
+
+void GradientEnergyMinimizerGPU::applyStep(Scalar a)
+    {
+    ArrayHandle<unsigned int> d_members(m_members, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_direction(m_direction, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<int3> d_image(m_pdata->getImages(),
+                              access_location::device,
+                              access_mode::readwrite);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+
+    kernel::gpu_gradient_apply_step(d_members.data,
+                                    m_n_members,
+                                    a,
+                                    d_direction.data,
+                                    m_integrate_rotational_dof,
+                                    d_pos.data,
+                                    d_image.data,
+                                    d_orientation.data,
+                                    m_pdata->getBox());
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+void GradientEnergyMinimizerGPU::saveState()
+    {
+    unsigned int N = m_pdata->getN();
+    if (m_pos_old.getNumElements() < N)
+        {
+        GPUArray<Scalar4> pos_old(N, m_exec_conf);
+        m_pos_old.swap(pos_old);
+        GPUArray<Scalar4> orientation_old(N, m_exec_conf);
+        m_orientation_old.swap(orientation_old);
+        GPUArray<int3> image_old(N, m_exec_conf);
+        m_image_old.swap(image_old);
+        }
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::read);
+    ArrayHandle<int3> d_image(m_pdata->getImages(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_pos_old(m_pos_old, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_orientation_old(m_orientation_old,
+                                           access_location::device,
+                                           access_mode::overwrite);
+    ArrayHandle<int3> d_image_old(m_image_old, access_location::device, access_mode::overwrite);
+
+    hipMemcpy(d_pos_old.data, d_pos.data, sizeof(Scalar4) * N, hipMemcpyDeviceToDevice);
+    hipMemcpy(d_orientation_old.data,
+              d_orientation.data,
+              sizeof(Scalar4) * N,
+              hipMemcpyDeviceToDevice);
+    hipMemcpy(d_image_old.data, d_image.data, sizeof(int3) * N, hipMemcpyDeviceToDevice);
+    m_box_old = m_pdata->getGlobalBox();
+    }
+
+void GradientEnergyMinimizerGPU::restoreState()
+    {
+    unsigned int N = m_pdata->getN();
+    if (m_box_relax)
+        m_pdata->setGlobalBox(m_box_old);
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::overwrite);
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                       access_location::device,
+                                       access_mode::overwrite);
+    ArrayHandle<int3> d_image(m_pdata->getImages(),
+                              access_location::device,
+                              access_mode::overwrite);
+    ArrayHandle<Scalar4> d_pos_old(m_pos_old, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_orientation_old(m_orientation_old,
+                                           access_location::device,
+                                           access_mode::read);
+    ArrayHandle<int3> d_image_old(m_image_old, access_location::device, access_mode::read);
+
+    hipMemcpy(d_pos.data, d_pos_old.data, sizeof(Scalar4) * N, hipMemcpyDeviceToDevice);
+    hipMemcpy(d_orientation.data,
+              d_orientation_old.data,
+              sizeof(Scalar4) * N,
+              hipMemcpyDeviceToDevice);
+    hipMemcpy(d_image.data, d_image_old.data, sizeof(int3) * N, hipMemcpyDeviceToDevice);
+    }
+
+void GradientEnergyMinimizerGPU::deformParticles(const Scalar3& diag, const Scalar3& offdiag)
+    {
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<int3> d_image(m_pdata->getImages(),
+                              access_location::device,
+                              access_mode::readwrite);
+
+    kernel::gpu_gradient_deform_particles(m_pdata->getN(),
+                                          d_pos.data,
+                                          d_image.data,
+                                          diag,
+                                          offdiag,
+                                          m_pdata->getBox());
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+namespace detail
+    {
+void export_GradientEnergyMinimizerGPU(pybind11::module& m)
+    {
+    pybind11::class_<GradientEnergyMinimizerGPU,
+                     GradientEnergyMinimizer,
+                     std::shared_ptr<GradientEnergyMinimizerGPU>>(m, "GradientEnergyMinimizerGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar, bool>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,617 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+
+#include "GradientEnergyMinimizerGPU.cuh"
+#include "hoomd/VectorMath.h"
+
+#include <assert.h>
+
+/*! \file GradientEnergyMinimizerGPU.cu
+    \brief Defines GPU kernel code for the vector operations of one L-BFGS or conjugate gradient
+    energy minimization iteration on the GPU. Used by GradientEnergyMinimizerGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Sum the block_size values in shared memory into sdata[0]
+__device__ void gpu_gradient_block_sum(Scalar* sdata)
+    {
+    __syncthreads();
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
+            sdata[threadIdx.x] += sdata[threadIdx.x + offs];
+        offs >>= 1;
+        __syncthreads();
+        }
+    }
+
+//! Find the largest of the block_size values in shared memory and store it in sdata[0]
+__device__ void gpu_gradient_block_max(Scalar* sdata)
+    {
+    __syncthreads();
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
+            sdata[threadIdx.x] = max(sdata[threadIdx.x], sdata[threadIdx.x + offs]);
+        offs >>= 1;
+        __syncthreads();
+        }
+    }
+
+//! Kernel function for reducing partial sums to full sums
+/*! \param d_sum Array of sums, one per quantity
+    \param d_partial_sum Partial sums, num_blocks consecutive entries per quantity
+    \param num_blocks Number of partial sums of each quantity
+    \param use_max Set to true to reduce with max instead of sum
+
+    One block reduces each quantity.
+*/
+__global__ void gpu_gradient_reduce_partial_sum_kernel(Scalar* d_sum,
+                                                       const Scalar* d_partial_sum,
+                                                       unsigned int num_blocks,
+                                                       bool use_max)
+    {
+    extern __shared__ Scalar gradient_sdata[];
+
+    const Scalar* d_partial = d_partial_sum + blockIdx.x * num_blocks;
+    Scalar sum = Scalar(0.0);
+
+    // reduce the values in the partial sum via a sliding window
+    for (int start = 0; start < num_blocks; start += blockDim.x)
+        {
+        __syncthreads();
+        if (start + threadIdx.x < num_blocks)
+            gradient_sdata[threadIdx.x] = d_partial[start + threadIdx.x];
+        else
+            gradient_sdata[threadIdx.x] = Scalar(0.0);
+
+        if (use_max)
+            {
+            gpu_gradient_block_max(gradient_sdata);
+            sum = max(sum, gradient_sdata[0]);
+            }
+        else
+            {
+            gpu_gradient_block_sum(gradient_sdata);
+            sum += gradient_sdata[0];
+            }
+        }
+
+    if (threadIdx.x == 0)
+        d_sum[blockIdx.x] = sum;
+    }
+
+//! Launch the final reduction of n_sums quantities
+static void gpu_gradient_reduce_partial_sums(Scalar* d_sum,
+                                             const Scalar* d_partial_sum,
+                                             unsigned int n_sums,
+                                             unsigned int block_size,
+                                             unsigned int num_blocks,
+                                             bool use_max)
+    {
+    hipLaunchKernelGGL((gpu_gradient_reduce_partial_sum_kernel),
+                       dim3(n_sums, 1, 1),
+                       dim3(block_size, 1, 1),
+                       block_size * sizeof(Scalar),
+                       0,
+                       d_sum,
+                       d_partial_sum,
+                       num_blocks,
+                       use_max);
+    }
+
+//! Kernel function for packing the gradient and the partial sums of the squared forces and torques
+/*! See GradientEnergyMinimizer::computeGradient() for the layout of the gradient.
+ */
+__global__ void gpu_gradient_compute_gradient_kernel(const unsigned int* d_members,
+                                                     unsigned int n_members,
+                                                     const Scalar4* d_net_force,
+                                                     const Scalar4* d_net_torque,
+                                                     const Scalar4* d_orientation,
+                                                     const Scalar3* d_inertia,
+                                                     bool aniso,
+                                                     bool twod,
+                                                     Scalar3* d_gradient,
+                                                     Scalar* d_partial_sum)
+    {
+    extern __shared__ Scalar gradient_sdata[];
+    Scalar* s_fsq = gradient_sdata;
+    Scalar* s_tsq = gradient_sdata + blockDim.x;
+
+    unsigned int k = blockIdx.x * blockDim.x + threadIdx.x;
+
+    Scalar fsq(0.0), tsq(0.0);
+    if (k < n_members)
+        {
+        unsigned int j = d_members[k];
+        Scalar4 f = d_net_force[j];
+        if (twod)
+            f.z = Scalar(0.0);
+        d_gradient[k] = make_scalar3(-f.x, -f.y, -f.z);
+        fsq = f.x * f.x + f.y * f.y + f.z * f.z;
+
+        if (aniso)
+            {
+            vec3<Scalar> t(d_net_torque[j]);
+            quat<Scalar> q(d_orientation[j]);
+            vec3<Scalar> I(d_inertia[j]);
+
+            // rotate torque into principal frame
+            t = rotate(conj(q), t);
+
+            // ignore torque component along an axis for which the moment of inertia zero
+            if (I.x == 0 || twod)
+                t.x = 0;
+            if (I.y == 0 || twod)
+                t.y = 0;
+            if (I.z == 0)
+                t.z = 0;
+
+            d_gradient[n_members + k] = make_scalar3(-t.x, -t.y, -t.z);
+            tsq = dot(t, t);
+            }
+        }
+
+    s_fsq[threadIdx.x] = fsq;
+    s_tsq[threadIdx.x] = tsq;
+    gpu_gradient_block_sum(s_fsq);
+    gpu_gradient_block_sum(s_tsq);
+
+    if (threadIdx.x == 0)
+        {
+        d_partial_sum[blockIdx.x] = s_fsq[0];
+        d_partial_sum[gridDim.x + blockIdx.x] = s_tsq[0];
+        }
+    }
+
+/*! \param d_members Local indices of the members
+    \param n_members Number of members
+    \param d_net_force Net force on all particles
+    \param d_net_torque Net torque on all particles
+    \param d_orientation Particle orientations
+    \param d_inertia Particle moments of inertia
+    \param aniso Set to true to pack the rotational gradient
+    \param twod Set to true for 2D systems
+    \param d_gradient Packed gradient to write
+    \param d_sum Sums of the squared forces and torques (2 entries)
+    \param d_partial_sum Partial sums (2 * num_blocks entries)
+    \param block_size The size of one block
+    \param num_blocks Number of blocks to execute
+*/
+hipError_t gpu_gradient_compute_gradient(const unsigned int* d_members,
+                                         unsigned int n_members,
+                                         const Scalar4* d_net_force,
+                                         const Scalar4* d_net_torque,
+                                         const Scalar4* d_orientation,
+                                         const Scalar3* d_inertia,
+                                         bool aniso,
+                                         bool twod,
+                                         Scalar3* d_gradient,
+                                         Scalar* d_sum,
+                                         Scalar* d_partial_sum,
+                                         unsigned int block_size,
+                                         unsigned int num_blocks)
+    {
+    hipLaunchKernelGGL((gpu_gradient_compute_gradient_kernel),
+                       dim3(num_blocks, 1, 1),
+                       dim3(block_size, 1, 1),
+                       2 * block_size * sizeof(Scalar),
+                       0,
+                       d_members,
+                       n_members,
+                       d_net_force,
+                       d_net_torque,
+                       d_orientation,
+                       d_inertia,
+                       aniso,
+                       twod,
+                       d_gradient,
+                       d_partial_sum);
+
+    gpu_gradient_reduce_partial_sums(d_sum, d_partial_sum, 2, block_size, num_blocks, false);
+
+    return hipSuccess;
+    }
+
+//! Kernel function for the partial sums of the potential energy and the virial
+__global__ void gpu_gradient_compute_energy_kernel(unsigned int N,
+                                                   const unsigned int* d_body,
+                                                   const unsigned int* d_tag,
+                                                   const Scalar4* d_net_force,
+                                                   const Scalar* d_net_virial,
+                                                   size_t virial_pitch,
+                                                   bool compute_virial,
+                                                   Scalar* d_partial_sum)
+    {
+    extern __shared__ Scalar gradient_sdata[];
+
+    unsigned int j = blockIdx.x * blockDim.x + threadIdx.x;
+    unsigned int n_sums = compute_virial ? 7 : 1;
+
+    // ignore rigid body constituent particles
+    bool include = false;
+    if (j < N)
+        include = d_body[j] >= MIN_FLOPPY || d_body[j] == d_tag[j];
+
+    gradient_sdata[threadIdx.x] = include ? d_net_force[j].w : Scalar(0.0);
+    for (unsigned int i = 1; i < n_sums; i++)
+        {
+        gradient_sdata[i * blockDim.x + threadIdx.x]
+            = include ? d_net_virial[j + (i - 1) * virial_pitch] : Scalar(0.0);
+        }
+
+    for (unsigned int i = 0; i < n_sums; i++)
+        gpu_gradient_block_sum(gradient_sdata + i * blockDim.x);
+
+    if (threadIdx.x < n_sums)
+        {
+        d_partial_sum[threadIdx.x * gridDim.x + blockIdx.x]
+            = gradient_sdata[threadIdx.x * blockDim.x];
+        }
+    }
+
+/*! \param N Number of local particles
+    \param d_body Particle body ids
+    \param d_tag Particle tags
+    \param d_net_force Net force on all particles
+    \param d_net_virial Net virial on all particles
+    \param virial_pitch Pitch of the virial array
+    \param compute_virial Set to true to sum the virial
+    \param d_sum Sums of the energy and the 6 virial components
+    \param d_partial_sum Partial sums (7 * num_blocks entries)
+    \param block_size The size of one block
+    \param num_blocks Number of blocks to execute
+*/
+hipError_t gpu_gradient_compute_energy(unsigned int N,
+                                       const unsigned int* d_body,
+                                       const unsigned int* d_tag,
+                                       const Scalar4* d_net_force,
+                                       const Scalar* d_net_virial,
+                                       size_t virial_pitch,
+                                       bool compute_virial,
+                                       Scalar* d_sum,
+                                       Scalar* d_partial_sum,
+                                       unsigned int block_size,
+                                       unsigned int num_blocks)
+    {
+    unsigned int n_sums = compute_virial ? 7 : 1;
+    hipLaunchKernelGGL((gpu_gradient_compute_energy_kernel),
+                       dim3(num_blocks, 1, 1),
+                       dim3(block_size, 1, 1),
+                       n_sums * block_size * sizeof(Scalar),
+                       0,
+                       N,
+                       d_body,
+                       d_tag,
+                       d_net_force,
+                       d_net_virial,
+                       virial_pitch,
+                       compute_virial,
+                       d_partial_sum);
+
+    gpu_gradient_reduce_partial_sums(d_sum, d_partial_sum, n_sums, block_size, num_blocks, false);
+
+    return hipSuccess;
+    }
+
+//! Kernel function for the partial sums of a dot product
+__global__ void gpu_gradient_dot_kernel(unsigned int n,
+                                        const Scalar3* d_x,
+                                        const Scalar3* d_y,
+                                        Scalar* d_partial_sum)
+    {
+    extern __shared__ Scalar gradient_sdata[];
+
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    Scalar xy(0.0);
+    if (i < n)
+        {
+        Scalar3 x = d_x[i];
+        Scalar3 y = d_y[i];
+        xy = x.x * y.x + x.y * y.y + x.z * y.z;
+        }
+
+    gradient_sdata[threadIdx.x] = xy;
+    gpu_gradient_block_sum(gradient_sdata);
+
+    if (threadIdx.x == 0)
+        d_partial_sum[blockIdx.x] = gradient_sdata[0];
+    }
+
+/*! \param n Number of entries in the packed vectors
+    \param d_x First vector
+    \param d_y Second vector
+    \param d_sum Result
+    \param d_partial_sum Partial sums (num_blocks entries)
+    \param block_size The size of one block
+    \param num_blocks Number of blocks to execute
+*/
+hipError_t gpu_gradient_dot(unsigned int n,
+                            const Scalar3* d_x,
+                            const Scalar3* d_y,
+                            Scalar* d_sum,
+                            Scalar* d_partial_sum,
+                            unsigned int block_size,
+                            unsigned int num_blocks)
+    {
+    hipLaunchKernelGGL((gpu_gradient_dot_kernel),
+                       dim3(num_blocks, 1, 1),
+                       dim3(block_size, 1, 1),
+                       block_size * sizeof(Scalar),
+                       0,
+                       n,
+                       d_x,
+                       d_y,
+                       d_partial_sum);
+
+    gpu_gradient_reduce_partial_sums(d_sum, d_partial_sum, 1, block_size, num_blocks, false);
+
+    return hipSuccess;
+    }
+
+//! Kernel function for y = a * x + b * y
+__global__ void
+gpu_gradient_axpby_kernel(unsigned int n, Scalar a, const Scalar3* d_x, Scalar b, Scalar3* d_y)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i < n)
+        {
+        Scalar3 x = d_x[i];
+        // do not read y when it is overwritten, it may be uninitialized
+        Scalar3 y = b == Scalar(0.0) ? make_scalar3(0, 0, 0) : d_y[i];
+        d_y[i] = make_scalar3(a * x.x + b * y.x, a * x.y + b * y.y, a * x.z + b * y.z);
+        }
+    }
+
+/*! \param n Number of entries in the packed vectors
+    \param a Factor applied to x
+    \param d_x Input vector
+    \param b Factor applied to y
+    \param d_y Vector to update
+*/
+hipError_t gpu_gradient_axpby(unsigned int n, Scalar a, const Scalar3* d_x, Scalar b, Scalar3* d_y)
+    {
+    unsigned int block_size = 256;
+    dim3 grid((n / block_size) + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_gradient_axpby_kernel),
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       n,
+                       a,
+                       d_x,
+                       b,
+                       d_y);
+
+    return hipSuccess;
+    }
+
+//! Kernel function for the partial maxima of the translation and rotation norms
+__global__ void gpu_gradient_max_norms_kernel(unsigned int n_members,
+                                              bool aniso,
+                                              const Scalar3* d_x,
+                                              Scalar* d_partial_max)
+    {
+    extern __shared__ Scalar gradient_sdata[];
+    Scalar* s_translation = gradient_sdata;
+    Scalar* s_rotation = gradient_sdata + blockDim.x;
+
+    unsigned int k = blockIdx.x * blockDim.x + threadIdx.x;
+
+    Scalar tsq(0.0), rsq(0.0);
+    if (k < n_members)
+        {
+        Scalar3 t = d_x[k];
+        tsq = t.x * t.x + t.y * t.y + t.z * t.z;
+        if (aniso)
+            {
+            Scalar3 r = d_x[n_members + k];
+            rsq = r.x * r.x + r.y * r.y + r.z * r.z;
+            }
+        }
+
+    s_translation[threadIdx.x] = tsq;
+    s_rotation[threadIdx.x] = rsq;
+    gpu_gradient_block_max(s_translation);
+    gpu_gradient_block_max(s_rotation);
+
+    if (threadIdx.x == 0)
+        {
+        d_partial_max[blockIdx.x] = s_translation[0];
+        d_partial_max[gridDim.x + blockIdx.x] = s_rotation[0];
+        }
+    }
+
+/*! \param n_members Number of members
+    \param aniso Set to true when the vector contains rotations
+    \param d_x Packed vector
+    \param d_max Largest squared translation and rotation norms (2 entries)
+    \param d_partial_max Partial maxima (2 * num_blocks entries)
+    \param block_size The size of one block
+    \param num_blocks Number of blocks to execute
+*/
+hipError_t gpu_gradient_max_norms(unsigned int n_members,
+                                  bool aniso,
+                                  const Scalar3* d_x,
+                                  Scalar* d_max,
+                                  Scalar* d_partial_max,
+                                  unsigned int block_size,
+                                  unsigned int num_blocks)
+    {
+    hipLaunchKernelGGL((gpu_gradient_max_norms_kernel),
+                       dim3(num_blocks, 1, 1),
+                       dim3(block_size, 1, 1),
+                       2 * block_size * sizeof(Scalar),
+                       0,
+                       n_members,
+                       aniso,
+                       d_x,
+                       d_partial_max);
+
+    gpu_gradient_reduce_partial_sums(d_max, d_partial_max, 2, block_size, num_blocks, true);
+
+    return hipSuccess;
+    }
+
+//! Kernel function for moving the members along the search direction
+__global__ void gpu_gradient_apply_step_kernel(const unsigned int* d_members,
+                                               unsigned int n_members,
+                                               Scalar a,
+                                               const Scalar3* d_direction,
+                                               bool aniso,
+                                               Scalar4* d_pos,
+                                               int3* d_image,
+                                               Scalar4* d_orientation,
+                                               const BoxDim box)
+    {
+    unsigned int k = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (k < n_members)
+        {
+        unsigned int j = d_members[k];
+        Scalar3 d = d_direction[k];
+        Scalar4 pos = d_pos[j];
+        int3 image = d_image[j];
+        pos.x += a * d.x;
+        pos.y += a * d.y;
+        pos.z += a * d.z;
+        box.wrap(pos, image);
+        d_pos[j] = pos;
+        d_image[j] = image;
+
+        if (aniso)
+            {
+            vec3<Scalar> theta(d_direction[n_members + k]);
+            theta = theta * a;
+
+            // rotate by theta in the body frame
+            Scalar angle = sqrt(dot(theta, theta));
+            if (angle > Scalar(0.0))
+                {
+                quat<Scalar> dq(fast::cos(Scalar(0.5) * angle),
+                                theta * (fast::sin(Scalar(0.5) * angle) / angle));
+                quat<Scalar> q(d_orientation[j]);
+                q = q * dq;
+                q = q * (Scalar(1.0) / slow::sqrt(norm2(q)));
+                d_orientation[j] = quat_to_scalar4(q);
+                }
+            }
+        }
+    }
+
+/*! \param d_members Local indices of the members
+    \param n_members Number of members
+    \param a Step length
+    \param d_direction Packed search direction
+    \param aniso Set to true to rotate the members
+    \param d_pos Particle positions
+    \param d_image Particle images
+    \param d_orientation Particle orientations
+    \param box Local box
+*/
+hipError_t gpu_gradient_apply_step(const unsigned int* d_members,
+                                   unsigned int n_members,
+                                   Scalar a,
+                                   const Scalar3* d_direction,
+                                   bool aniso,
+                                   Scalar4* d_pos,
+                                   int3* d_image,
+                                   Scalar4* d_orientation,
+                                   const BoxDim& box)
+    {
+    unsigned int block_size = 256;
+    dim3 grid((n_members / block_size) + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_gradient_apply_step_kernel),
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       d_members,
+                       n_members,
+                       a,
+                       d_direction,
+                       aniso,
+                       d_pos,
+                       d_image,
+                       d_orientation,
+                       box);
+
+    return hipSuccess;
+    }
+
+//! Kernel function for deforming the particle positions by an upper triangular strain
+__global__ void gpu_gradient_deform_particles_kernel(unsigned int N,
+                                                     Scalar4* d_pos,
+                                                     int3* d_image,
+                                                     Scalar3 diag,
+                                                     Scalar3 offdiag,
+                                                     const BoxDim box)
+    {
+    unsigned int j = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (j < N)
+        {
+        Scalar4 pos = d_pos[j];
+        int3 image = d_image[j];
+        Scalar3 p = make_scalar3(pos.x, pos.y, pos.z);
+        pos.x = (Scalar(1.0) + diag.x) * p.x + offdiag.x * p.y + offdiag.y * p.z;
+        pos.y = (Scalar(1.0) + diag.y) * p.y + offdiag.z * p.z;
+        pos.z = (Scalar(1.0) + diag.z) * p.z;
+        box.wrap(pos, image);
+        d_pos[j] = pos;
+        d_image[j] = image;
+        }
+    }
+
+/*! \param N Number of local particles
+    \param d_pos Particle positions
+    \param d_image Particle images
+    \param diag Diagonal strain (xx, yy, zz)
+    \param offdiag Off diagonal strain (xy, xz, yz)
+    \param box Deformed local box
+*/
+hipError_t gpu_gradient_deform_particles(unsigned int N,
+                                         Scalar4* d_pos,
+                                         int3* d_image,
+                                         Scalar3 diag,
+                                         Scalar3 offdiag,
+                                         const BoxDim& box)
+    {
+    unsigned int block_size = 256;
+    dim3 grid((N / block_size) + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_gradient_deform_particles_kernel),
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       N,
+                       d_pos,
+                       d_image,
+                       diag,
+                       offdiag,
+                       box);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,93 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleData.cuh"
+
+#ifndef __GRADIENT_ENERGY_MINIMIZER_GPU_CUH__
+#define __GRADIENT_ENERGY_MINIMIZER_GPU_CUH__
+
+/*! \file GradientEnergyMinimizerGPU.cuh
+    \brief Defines the interface to GPU kernel drivers used by GradientEnergyMinimizerGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver for packing the gradient and summing the squared forces and torques
+hipError_t gpu_gradient_compute_gradient(const unsigned int* d_members,
+                                         unsigned int n_members,
+                                         const Scalar4* d_net_force,
+                                         const Scalar4* d_net_torque,
+                                         const Scalar4* d_orientation,
+                                         const Scalar3* d_inertia,
+                                         bool aniso,
+                                         bool twod,
+                                         Scalar3* d_gradient,
+                                         Scalar* d_sum,
+                                         Scalar* d_partial_sum,
+                                         unsigned int block_size,
+                                         unsigned int num_blocks);
+
+//! Kernel driver for summing the potential energy and the virial of the local particles
+hipError_t gpu_gradient_compute_energy(unsigned int N,
+                                       const unsigned int* d_body,
+                                       const unsigned int* d_tag,
+                                       const Scalar4* d_net_force,
+                                       const Scalar* d_net_virial,
+                                       size_t virial_pitch,
+                                       bool compute_virial,
+                                       Scalar* d_sum,
+                                       Scalar* d_partial_sum,
+                                       unsigned int block_size,
+                                       unsigned int num_blocks);
+
+//! Kernel driver for the dot product of two packed vectors
+hipError_t gpu_gradient_dot(unsigned int n,
+                            const Scalar3* d_x,
+                            const Scalar3* d_y,
+                            Scalar* d_sum,
+                            Scalar* d_partial_sum,
+                            unsigned int block_size,
+                            unsigned int num_blocks);
+
+//! Kernel driver for y = a * x + b * y on packed vectors
+hipError_t gpu_gradient_axpby(unsigned int n, Scalar a, const Scalar3* d_x, Scalar b, Scalar3* d_y);
+
+//! Kernel driver for the largest translation and rotation norms of a packed vector
+hipError_t gpu_gradient_max_norms(unsigned int n_members,
+                                  bool aniso,
+                                  const Scalar3* d_x,
+                                  Scalar* d_max,
+                                  Scalar* d_partial_max,
+                                  unsigned int block_size,
+                                  unsigned int num_blocks);
+
+//! Kernel driver for moving the members along the search direction
+hipError_t gpu_gradient_apply_step(const unsigned int* d_members,
+                                   unsigned int n_members,
+                                   Scalar a,
+                                   const Scalar3* d_direction,
+                                   bool aniso,
+                                   Scalar4* d_pos,
+                                   int3* d_image,
+                                   Scalar4* d_orientation,
+                                   const BoxDim& box);
+
+//! Kernel driver for deforming particle positions by an upper triangular strain
+hipError_t gpu_gradient_deform_particles(unsigned int N,
+                                         Scalar4* d_pos,
+                                         int3* d_image,
+                                         Scalar3 diag,
+                                         Scalar3 offdiag,
+                                         const BoxDim& box);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif //__GRADIENT_ENERGY_MINIMIZER_GPU_CUH__
@@ -0,0 +1,97 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GradientEnergyMinimizer.h"
+
+#include <memory>
+
+#ifndef __GRADIENT_ENERGY_MINIMIZER_GPU_H__
+#define __GRADIENT_ENERGY_MINIMIZER_GPU_H__
+
+/*! \file GradientEnergyMinimizerGPU.h
+    \brief Declares the GPU implementation of GradientEnergyMinimizer
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Minimizes the potential energy with L-BFGS or nonlinear conjugate gradient steps on the GPU
+/*! The packed vectors, the history, and the saved configuration stay on the device. Only the
+    reduced sums and the box entries are copied to the host.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT GradientEnergyMinimizerGPU : public GradientEnergyMinimizer
+    {
+    public:
+    //! Constructs the minimizer and associates it with the system
+    GradientEnergyMinimizerGPU(std::shared_ptr<SystemDefinition> sysdef,
+                               Scalar max_step,
+                               bool conjugate_gradient);
+
+    //! Destroys the minimizer
+    virtual ~GradientEnergyMinimizerGPU() { }
+
+    protected:
+    unsigned int m_block_size; //!< block size for partial sum memory
+
+    GPUVector<Scalar> m_partial_sum; //!< memory space for the partial sums
+    GPUArray<Scalar> m_sum;          //!< memory space for the reduced sums
+
+    //! Concatenate the members of all methods into m_members
+    virtual void packMembers();
+
+    //! Pack the gradient of the current configuration into m_gradient
+    virtual gradient_sums computeGradient();
+
+    //! Set the box entries of a packed vector
+    virtual void setBoxEntries(GPUArray<Scalar3>& x, const Scalar3& diag, const Scalar3& offdiag);
+
+    //! Get the box entries of a packed vector
+    virtual void getBoxEntries(const GPUArray<Scalar3>& x, Scalar3& diag, Scalar3& offdiag);
+
+    //! Local dot product of two packed vectors
+    virtual Scalar dotLocal(const GPUArray<Scalar3>& x,
+                            unsigned int offset_x,
+                            const GPUArray<Scalar3>& y,
+                            unsigned int offset_y);
+
+    //! y = a * x + b * y for packed vectors
+    virtual void axpby(Scalar a,
+                       const GPUArray<Scalar3>& x,
+                       unsigned int offset_x,
+                       Scalar b,
+                       GPUArray<Scalar3>& y,
+                       unsigned int offset_y);
+
+    //! Compute the largest translation and rotation of the members in a packed vector
+    virtual void computeMaxNorms(const GPUArray<Scalar3>& x, Scalar& translation, Scalar& rotation);
+
+    //! Move the members by a * m_direction
+    virtual void applyStep(Scalar a);
+
+    //! Store the particle configuration
+    virtual void saveState();
+
+    //! Restore the particle configuration stored by saveState()
+    virtual void restoreState();
+
+    //! Deform the local particles by the given strain and wrap them into the current box
+    virtual void deformParticles(const Scalar3& diag, const Scalar3& offdiag);
+
+    private:
+    //! Allocate the memory needed to store n_sums partial sums over n elements
+    unsigned int resizePartialSumArray(unsigned int n, unsigned int n_sums);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // #ifndef __GRADIENT_ENERGY_MINIMIZER_GPU_H__
@@ -6,6 +6,7 @@
 #include "hoomd/SystemDefinition.h"
 
 #include <memory>
+#include <vector>
 
 #ifndef __INTEGRATION_METHOD_TWO_STEP_H__
 #define __INTEGRATION_METHOD_TWO_STEP_H__
@@ -114,6 +115,43 @@ class PYBIND11_EXPORT IntegrationMethodTwoStep : public Autotuned
      */
     virtual void integrateStepTwo(uint64_t timestep) { }
 
+    //! Test whether this method and \a other can be integrated together in fused kernels
+    /*! \param other Method that follows this one (directly or in a run of fusable methods)
+
+        Methods that implement integrateStepOneFused() and integrateStepTwoFused() return true for
+        the methods those implementations support.
+    */
+    virtual bool canFuseWith(const IntegrationMethodTwoStep& other) const
+        {
+        return false;
+        }
+
+    //! Perform the first step of the integration for a run of fusable methods
+    /*! \param timestep Current time step
+        \param methods Methods to integrate. methods[0] is this method and canFuseWith() returns
+               true for all the others.
+    */
+    virtual void
+    integrateStepOneFused(uint64_t timestep,
+                          const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods)
+        {
+        for (auto& method : methods)
+            method->integrateStepOne(timestep);
+        }
+
+    //! Perform the second step of the integration for a run of fusable methods
+    /*! \param timestep Current time step
+        \param methods Methods to integrate. methods[0] is this method and canFuseWith() returns
+               true for all the others.
+    */
+    virtual void
+    integrateStepTwoFused(uint64_t timestep,
+                          const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods)
+        {
+        for (auto method = methods.rbegin(); method != methods.rend(); method++)
+            (*method)->integrateStepTwo(timestep);
+        }
+
     //! Calculates force which keeps particles on manifold in RATTLE integrators
     /*! \param timestep Current time step
      */
@@ -169,6 +207,37 @@ class PYBIND11_EXPORT IntegrationMethodTwoStep : public Autotuned
         return true;
         }
 
+    //! Test whether the method can remove the linear momentum within its integration steps
+    /*! Methods that return true apply the shift set by setMomentumShift() to the velocities in
+        the next integrateStepOne() and sum the momentum of the local group members in
+        integrateStepTwo() when requestMomentumSum() was called.
+    */
+    virtual bool canRemoveMomentum() const
+        {
+        return false;
+        }
+
+    //! Set the momentum to remove from every member in the next integrateStepOne()
+    /*! \param momentum Momentum per particle. Each member's velocity is reduced by momentum / mass.
+     */
+    void setMomentumShift(Scalar3 momentum)
+        {
+        m_momentum_shift = momentum;
+        m_remove_momentum = true;
+        }
+
+    //! Request the momentum sum of the local members in the next integrateStepTwo()
+    void requestMomentumSum()
+        {
+        m_sum_momentum = true;
+        }
+
+    //! Get the momentum of the local members summed in the last integrateStepTwo()
+    Scalar3 getMomentumSum() const
+        {
+        return m_momentum_sum;
+        }
+
     protected:
     const std::shared_ptr<SystemDefinition>
         m_sysdef; //!< The system definition this method is associated with
@@ -180,6 +249,11 @@ class PYBIND11_EXPORT IntegrationMethodTwoStep : public Autotuned
     bool m_aniso;    //!< True if anisotropic integration is requested
 
     Scalar m_deltaT; //!< The time step
+
+    Scalar3 m_momentum_shift = make_scalar3(0, 0, 0); //!< Momentum per particle to remove
+    bool m_remove_momentum = false; //!< True when step one should remove m_momentum_shift
+    bool m_sum_momentum = false;    //!< True when step two should sum the momentum
+    Scalar3 m_momentum_sum = make_scalar3(0, 0, 0); //!< Momentum summed in the last step two
     };
 
     } // end namespace md
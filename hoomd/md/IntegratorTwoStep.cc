@@ -62,7 +62,21 @@ void IntegratorTwoStep::update(uint64_t timestep)
         // files. Work around this by calling setDeltaT every timestep.
         method->setAnisotropic(m_integrate_rotational_dof);
         method->setDeltaT(m_deltaT);
-        method->integrateStepOne(timestep);
+        }
+
+    // remove the momentum requested by ZeroMomentumUpdater in the first step
+    if (m_remove_momentum_timestep == timestep)
+        {
+        setMomentumShift();
+        }
+
+    buildFusedRuns();
+    for (auto& run : m_fused_runs)
+        {
+        if (run.size() == 1)
+            run[0]->integrateStepOne(timestep);
+        else
+            run[0]->integrateStepOneFused(timestep, run);
         }
 
 #ifdef ENABLE_MPI
@@ -103,14 +117,40 @@ void IntegratorTwoStep::update(uint64_t timestep)
         m_half_step_hook->update(timestep + 1);
         }
 
+    // sum the momentum in the second step for removal in the next first step
+    const bool sum_momentum = m_sum_momentum && canRemoveMomentum();
+    if (sum_momentum)
+        {
+        for (auto& method : m_methods)
+            method->requestMomentumSum();
+        }
+
     // perform the second step of the integration on all groups
     // reversed for integrators so that the half steps will be performed symmetrically
-    for (auto method_ptr = m_methods.rbegin(); method_ptr != m_methods.rend(); method_ptr++)
+    for (auto run_ptr = m_fused_runs.rbegin(); run_ptr != m_fused_runs.rend(); run_ptr++)
+        {
+        auto& run = *run_ptr;
+        if (run.size() == 1)
+            run[0]->integrateStepTwo(timestep);
+        else
+            run[0]->integrateStepTwoFused(timestep, run);
+
+        for (auto method_ptr = run.rbegin(); method_ptr != run.rend(); method_ptr++)
+            (*method_ptr)->includeRATTLEForce(timestep + 1);
+        }
+
+    if (sum_momentum)
+        {
+        m_momentum_sum = make_scalar3(0, 0, 0);
+        for (auto& method : m_methods)
+            m_momentum_sum += method->getMomentumSum();
+        m_momentum_versions = getMomentumVersions();
+        }
+    else
         {
-        auto method = *method_ptr;
-        method->integrateStepTwo(timestep);
-        method->includeRATTLEForce(timestep + 1);
+        m_momentum_versions.clear();
         }
+    m_next_timestep = timestep + 1;
 
     /* NOTE: For composite particles, it is assumed that positions and orientations are not updated
        in the second step.
@@ -122,6 +162,109 @@ void IntegratorTwoStep::update(uint64_t timestep)
      */
     }
 
+bool IntegratorTwoStep::canRemoveMomentum() const
+    {
+    if (m_methods.empty())
+        return false;
+
+    for (auto& method : m_methods)
+        {
+        if (!method->canRemoveMomentum())
+            return false;
+        }
+    return true;
+    }
+
+/*! \param timestep Timestep of the next update
+
+    Only the integrator that performs the next update accepts the request. The momentum is then
+    removed from the members of the integration methods, particles outside of all methods keep
+    their momentum.
+*/
+bool IntegratorTwoStep::requestMomentumRemoval(uint64_t timestep)
+    {
+    if (!m_prepared || timestep != m_next_timestep || !canRemoveMomentum())
+        return false;
+
+    m_remove_momentum_timestep = timestep;
+    return true;
+    }
+
+std::vector<uint64_t> IntegratorTwoStep::getMomentumVersions()
+    {
+    std::vector<uint64_t> versions = {m_pdata->getVelocities().getVersion()};
+    for (auto& method : m_methods)
+        versions.push_back(method->getGroup()->getIndexArray().getVersion());
+    return versions;
+    }
+
+/*! The momentum summed in the last second step is used unless the velocities or the group members
+    changed since, for example when an updater modified the velocities. In that case it is summed
+    again over the local members.
+*/
+void IntegratorTwoStep::setMomentumShift()
+    {
+    if (m_momentum_versions.empty() || m_momentum_versions != getMomentumVersions())
+        {
+        m_momentum_sum = make_scalar3(0, 0, 0);
+
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (auto& method : m_methods)
+            {
+            auto group = method->getGroup();
+            for (unsigned int group_idx = 0; group_idx < group->getNumMembers(); group_idx++)
+                {
+                unsigned int j = group->getMemberIndex(group_idx);
+                Scalar3 v = make_scalar3(h_vel.data[j].x, h_vel.data[j].y, h_vel.data[j].z);
+                m_momentum_sum += h_vel.data[j].w * v;
+                }
+            }
+        }
+    m_momentum_versions.clear();
+
+    Scalar momentum[3] = {m_momentum_sum.x, m_momentum_sum.y, m_momentum_sum.z};
+    unsigned int n = 0;
+    for (auto& method : m_methods)
+        n += method->getGroup()->getNumMembersGlobal();
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      momentum,
+                      3,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    if (n == 0)
+        return;
+
+    Scalar3 average = make_scalar3(momentum[0], momentum[1], momentum[2]) / Scalar(n);
+    for (auto& method : m_methods)
+        method->setMomentumShift(average);
+    }
+
+/*! Consecutive methods are fused when the first method of the run accepts each of the following
+    methods (see IntegrationMethodTwoStep::canFuseWith). Methods act on disjoint groups, so fusing
+    only consecutive methods keeps the order in which the methods update the system.
+*/
+void IntegratorTwoStep::buildFusedRuns()
+    {
+    m_fused_runs.clear();
+    for (auto& method : m_methods)
+        {
+        if (!m_fused_runs.empty() && m_fused_runs.back()[0]->canFuseWith(*method))
+            m_fused_runs.back().push_back(method);
+        else
+            m_fused_runs.push_back({method});
+        }
+    }
+
 /*! \param deltaT new deltaT to set
     \post \a deltaT is also set on all contained integration methods
 */
@@ -277,6 +420,7 @@ void IntegratorTwoStep::prepRun(uint64_t timestep)
     for (auto& method : m_methods)
         method->includeRATTLEForce(timestep);
 
+    m_next_timestep = timestep;
     m_prepared = true;
     }
 
@@ -113,6 +113,35 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
     /// Validate method groups.
     void validateGroups();
 
+    /// Sum the momentum in every second step so that it can be removed in the next first step
+    /** @param sum_momentum True to sum the momentum.
+
+        ZeroMomentumUpdater enables the sums when it removes the momentum through the integrator.
+    */
+    void setSumMomentum(bool sum_momentum)
+        {
+        m_sum_momentum = sum_momentum;
+        }
+
+    /// Test whether all methods can remove the momentum within their integration steps
+    bool canRemoveMomentum() const;
+
+    /// Remove the momentum in the first step of the update at the given timestep
+    /** @param timestep Timestep of the next update.
+        @returns true when the next update removes the momentum, false when the caller must
+                 remove it.
+    */
+    bool requestMomentumRemoval(uint64_t timestep);
+
+#ifdef ENABLE_MPI
+    /// Test whether forces may be computed while the ghost update is in flight
+    virtual bool canComputeDuringGhostUpdate()
+        {
+        // the rigid body update moves constituent particles after the ghost update
+        return !m_rigid_bodies && Integrator::canComputeDuringGhostUpdate();
+        }
+#endif
+
     protected:
     std::vector<std::shared_ptr<IntegrationMethodTwoStep>>
         m_methods; //!< List of all the integration methods
@@ -121,8 +150,35 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
 
     bool m_prepared; //!< True if preprun has been called
 
+    /// Runs of consecutive methods that are integrated together, rebuilt every step
+    std::vector<std::vector<std::shared_ptr<IntegrationMethodTwoStep>>> m_fused_runs;
+
+    /// Group consecutive methods that can be integrated in fused kernels into m_fused_runs
+    void buildFusedRuns();
+
     /// True when orientation degrees of freedom should be integrated
     bool m_integrate_rotational_dof = false;
+
+    /// Timestep of the next update, set by prepRun() and update()
+    uint64_t m_next_timestep = 0;
+
+    /// True when the second step sums the momentum
+    bool m_sum_momentum = false;
+
+    /// Timestep at which the first step removes the momentum
+    uint64_t m_remove_momentum_timestep = UINT64_MAX;
+
+    /// Momentum of the local members of all methods summed in the last second step
+    Scalar3 m_momentum_sum = make_scalar3(0, 0, 0);
+
+    /// Versions of the velocities and the group indices when m_momentum_sum was summed
+    std::vector<uint64_t> m_momentum_versions;
+
+    /// Get the current versions of the arrays that m_momentum_sum depends on
+    std::vector<uint64_t> getMomentumVersions();
+
+    /// Set the momentum shift of all methods to remove the average momentum
+    void setMomentumShift();
     };
 
     } // end namespace md
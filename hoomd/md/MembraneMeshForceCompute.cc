@@ -0,0 +1,801 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MembraneMeshForceCompute.h"
+
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+// SMALL a relatively small number
+#define SMALL Scalar(0.001)
+
+/*! \file MembraneMeshForceCompute.cc
+    \brief Contains code for the MembraneMeshForceCompute class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param meshdef Mesh triangulation
+    \post Memory is allocated, and forces are zeroed.
+*/
+MembraneMeshForceCompute::MembraneMeshForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                                   std::shared_ptr<MeshDefinition> meshdef)
+    : ForceCompute(sysdef), m_mesh_data(meshdef)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MembraneMeshForceCompute" << endl;
+
+    unsigned int n_types = m_mesh_data->getMeshTriangleData()->getNTypes();
+
+    GPUArray<membrane_param_t> params(n_types, m_exec_conf);
+    m_params.swap(params);
+
+    GPUArray<Scalar> area(n_types, m_exec_conf);
+    m_area.swap(area);
+
+    GPUArray<Scalar> volume(n_types, m_exec_conf);
+    m_volume.swap(volume);
+    }
+
+MembraneMeshForceCompute::~MembraneMeshForceCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MembraneMeshForceCompute" << endl;
+    }
+
+/*! \param type Type of the mesh to set parameters for
+    \param params Parameters to set
+
+    Sets parameters for the potential of a particular mesh type
+*/
+void MembraneMeshForceCompute::setParams(unsigned int type, const membrane_param_t& params)
+    {
+    ArrayHandle<membrane_param_t> h_params(m_params, access_location::host, access_mode::readwrite);
+    h_params.data[type] = params;
+
+    if (params.k_helfrich < 0)
+        m_exec_conf->msg->warning() << "membrane: specified k_helfrich < 0" << endl;
+    if (params.k_bending < 0)
+        m_exec_conf->msg->warning() << "membrane: specified k_bending < 0" << endl;
+    if (params.k_area != 0 && params.A0 <= 0)
+        m_exec_conf->msg->warning() << "membrane: specified A0 <= 0" << endl;
+    if (params.k_triangle != 0 && params.A0_triangle <= 0)
+        m_exec_conf->msg->warning() << "membrane: specified A0_triangle <= 0" << endl;
+    if (params.k_volume != 0 && params.V0 <= 0)
+        m_exec_conf->msg->warning() << "membrane: specified V0 <= 0" << endl;
+    }
+
+void MembraneMeshForceCompute::setParamsPython(std::string type, pybind11::dict params)
+    {
+    auto typ = m_mesh_data->getMeshBondData()->getTypeByName(type);
+    setParams(typ, membrane_param_t(params));
+    }
+
+pybind11::dict MembraneMeshForceCompute::getParams(std::string type)
+    {
+    auto typ = m_mesh_data->getMeshBondData()->getTypeByName(type);
+    if (typ >= m_mesh_data->getMeshBondData()->getNTypes())
+        {
+        m_exec_conf->msg->error() << "mesh.membrane: Invalid mesh type specified" << endl;
+        throw runtime_error("Error setting parameters in MembraneMeshForceCompute");
+        }
+    ArrayHandle<membrane_param_t> h_params(m_params, access_location::host, access_mode::read);
+    return h_params.data[typ].asDict();
+    }
+
+//! Add a force, energy, and virial contribution to a local particle
+/*! \param h_force Force array
+    \param h_virial Virial array
+    \param virial_pitch Pitch of the virial array
+    \param idx Particle index
+    \param F Force to add
+    \param energy Energy to add
+    \param virial Virial to add
+*/
+static inline void addContribution(Scalar4* h_force,
+                                   Scalar* h_virial,
+                                   size_t virial_pitch,
+                                   unsigned int idx,
+                                   Scalar3 F,
+                                   Scalar energy,
+                                   const Scalar* virial)
+    {
+    h_force[idx].x += F.x;
+    h_force[idx].y += F.y;
+    h_force[idx].z += F.z;
+    h_force[idx].w += energy;
+    for (int j = 0; j < 6; j++)
+        h_virial[j * virial_pitch + idx] += virial[j];
+    }
+
+//! Compute the virial 1/2 * (sum_k r_k F_k) of a bonded contribution
+/*! \param virial Output virial
+    \param r Bond vectors
+    \param F Forces
+    \param n Number of bond vectors
+*/
+static inline void
+computeVirial(Scalar* virial, const Scalar3* r, const Scalar3* F, unsigned int n)
+    {
+    for (unsigned int j = 0; j < 6; j++)
+        virial[j] = Scalar(0.0);
+
+    for (unsigned int k = 0; k < n; k++)
+        {
+        virial[0] += Scalar(1. / 2.) * r[k].x * F[k].x; // xx
+        virial[1] += Scalar(1. / 2.) * r[k].y * F[k].x; // xy
+        virial[2] += Scalar(1. / 2.) * r[k].z * F[k].x; // xz
+        virial[3] += Scalar(1. / 2.) * r[k].y * F[k].y; // yy
+        virial[4] += Scalar(1. / 2.) * r[k].z * F[k].y; // yz
+        virial[5] += Scalar(1. / 2.) * r[k].z * F[k].z; // zz
+        }
+    }
+
+/*! Actually perform the force computation
+    \param timestep Current time step
+ */
+void MembraneMeshForceCompute::computeForces(uint64_t timestep)
+    {
+    const unsigned int n_types = m_mesh_data->getMeshTriangleData()->getNTypes();
+
+    // determine which terms are evaluated
+    bool compute_helfrich = false;
+    bool compute_bending = false;
+    bool compute_triangle_terms = false;
+        {
+        ArrayHandle<membrane_param_t> h_params(m_params, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < n_types; i++)
+            {
+            compute_helfrich = compute_helfrich || h_params.data[i].k_helfrich != 0;
+            compute_bending = compute_bending || h_params.data[i].k_bending != 0;
+            compute_triangle_terms = compute_triangle_terms || h_params.data[i].k_area != 0
+                                     || h_params.data[i].k_triangle != 0
+                                     || h_params.data[i].k_volume != 0;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (compute_helfrich && m_pdata->getDomainDecomposition())
+        {
+        m_exec_conf->msg->error()
+            << "mesh.membrane: The Helfrich term is not implemented for MPI" << endl;
+        throw runtime_error("Error computing forces in MembraneMeshForceCompute");
+        }
+#endif
+
+    computeGeometry(compute_helfrich);
+
+    assert(m_pdata);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    size_t virial_pitch = m_virial.getPitch();
+    ArrayHandle<membrane_param_t> h_params(m_params, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_area(m_area, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_volume(m_volume, access_location::host, access_mode::read);
+
+    ArrayHandle<unsigned int> h_pts(m_mesh_data->getPerTypeSize(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    assert(h_force.data);
+    assert(h_virial.data);
+    assert(h_pos.data);
+
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    PDataFlags flags = m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    const unsigned int N = m_pdata->getN();
+
+    Scalar membrane_virial[6];
+    for (unsigned int i = 0; i < 6; i++)
+        membrane_virial[i] = Scalar(0.0);
+
+    // area, triangle area, and volume terms
+    if (compute_triangle_terms)
+        {
+        for (const triangle_geometry& tri : m_triangle_geometry)
+            {
+            const membrane_param_t& param = h_params.data[tri.type];
+            unsigned int triN = h_pts.data[tri.type];
+
+            Scalar3 nab = tri.dab / tri.rab;
+            Scalar3 nac = tri.dac / tri.rac;
+
+            // the area and triangle area terms share the gradient of the triangle area
+            Scalar prefactor = 0;
+            Scalar energy = 0;
+
+            if (param.k_area != 0)
+                {
+                Scalar AreaDiff = h_area.data[tri.type] - param.A0;
+                energy += param.k_area * AreaDiff * AreaDiff / (6 * param.A0 * triN);
+                prefactor += param.k_area / param.A0 * AreaDiff / 2.0;
+                }
+
+            if (param.k_triangle != 0)
+                {
+                Scalar At = param.A0_triangle;
+                Scalar Ut = tri.rab * tri.rac * tri.s_baac / 2 - At;
+                energy += param.k_triangle / (6.0 * At) * Ut * Ut;
+                prefactor += param.k_triangle / (2 * At) * Ut;
+                }
+
+            if (param.k_area != 0 || param.k_triangle != 0)
+                {
+                Scalar inv_s_baac = 1.0 / tri.s_baac;
+
+                Scalar3 dc_drab, dc_drac; // dcos_baac / dr_a
+                dc_drab = -nac / tri.rab + tri.c_baac / tri.rab * nab;
+                dc_drac = -nab / tri.rac + tri.c_baac / tri.rac * nac;
+
+                Scalar3 ds_drab, ds_drac; // dsin_baac / dr_a
+                ds_drab = -tri.c_baac * inv_s_baac * dc_drab;
+                ds_drac = -tri.c_baac * inv_s_baac * dc_drac;
+
+                Scalar3 F[2];
+                F[0] = prefactor * (-nab * tri.rac * tri.s_baac + ds_drab * tri.rab * tri.rac);
+                F[1] = prefactor * (-nac * tri.rab * tri.s_baac + ds_drac * tri.rab * tri.rac);
+                Scalar3 r[2] = {tri.dab, tri.dac};
+
+                if (tri.idx_a < N)
+                    {
+                    if (compute_virial)
+                        computeVirial(membrane_virial, r, F, 2);
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    tri.idx_a,
+                                    F[0] + F[1],
+                                    energy,
+                                    membrane_virial);
+                    }
+
+                if (tri.idx_b < N)
+                    {
+                    if (compute_virial)
+                        computeVirial(membrane_virial, &r[0], &F[0], 1);
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    tri.idx_b,
+                                    -F[0],
+                                    energy,
+                                    membrane_virial);
+                    }
+
+                if (tri.idx_c < N)
+                    {
+                    if (compute_virial)
+                        computeVirial(membrane_virial, &r[1], &F[1], 1);
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    tri.idx_c,
+                                    -F[1],
+                                    energy,
+                                    membrane_virial);
+                    }
+                }
+
+            if (param.k_volume != 0)
+                {
+                Scalar VolDiff = h_volume.data[tri.type] - param.V0;
+                Scalar energy_volume
+                    = param.k_volume * VolDiff * VolDiff / (6 * param.V0 * triN);
+                VolDiff = -param.k_volume / param.V0 * VolDiff / 6.0;
+
+                const unsigned int idx[3] = {tri.idx_a, tri.idx_b, tri.idx_c};
+                const vec3<Scalar> dVol[3] = {tri.dVol_a, tri.dVol_b, tri.dVol_c};
+
+                for (unsigned int k = 0; k < 3; k++)
+                    {
+                    if (idx[k] >= N)
+                        continue;
+
+                    Scalar3 F = vec_to_scalar3(VolDiff * dVol[k]);
+                    Scalar3 r = make_scalar3(h_pos.data[idx[k]].x,
+                                             h_pos.data[idx[k]].y,
+                                             h_pos.data[idx[k]].z);
+                    if (compute_virial)
+                        computeVirial(membrane_virial, &r, &F, 1);
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    idx[k],
+                                    F,
+                                    energy_volume,
+                                    membrane_virial);
+                    }
+                }
+            }
+        }
+
+    // Helfrich and bending rigidity terms
+    if (compute_helfrich || compute_bending)
+        {
+        for (const bond_geometry& bond : m_bond_geometry)
+            {
+            const membrane_param_t& param = h_params.data[bond.type];
+
+            const Scalar3& dab = bond.dab;
+            const Scalar3& dac = bond.dac;
+            const Scalar3& dad = bond.dad;
+
+            if (param.k_helfrich != 0)
+                {
+                const Scalar3& dbc = bond.dbc;
+                const Scalar3& dbd = bond.dbd;
+
+                Scalar rsqab = dot(dab, dab);
+                Scalar rab = sqrt(rsqab);
+                Scalar rsqac = dot(dac, dac);
+                Scalar rac = sqrt(rsqac);
+                Scalar rsqad = dot(dad, dad);
+                Scalar rad = sqrt(rsqad);
+                Scalar rsqbc = dot(dbc, dbc);
+                Scalar rbc = sqrt(rsqbc);
+                Scalar rsqbd = dot(dbd, dbd);
+                Scalar rbd = sqrt(rsqbd);
+
+                Scalar3 nab, nac, nad, nbc, nbd;
+                nab = dab / rab;
+                nac = dac / rac;
+                nad = dad / rad;
+                nbc = dbc / rbc;
+                nbd = dbd / rbd;
+
+                Scalar c_accb = dot(nac, nbc);
+                c_accb = c_accb > 1.0 ? 1.0 : (c_accb < -1.0 ? -1.0 : c_accb);
+                Scalar c_addb = dot(nad, nbd);
+                c_addb = c_addb > 1.0 ? 1.0 : (c_addb < -1.0 ? -1.0 : c_addb);
+                Scalar c_abbc = -dot(nab, nbc);
+                c_abbc = c_abbc > 1.0 ? 1.0 : (c_abbc < -1.0 ? -1.0 : c_abbc);
+                Scalar c_abbd = -dot(nab, nbd);
+                c_abbd = c_abbd > 1.0 ? 1.0 : (c_abbd < -1.0 ? -1.0 : c_abbd);
+                Scalar c_baac = dot(nab, nac);
+                c_baac = c_baac > 1.0 ? 1.0 : (c_baac < -1.0 ? -1.0 : c_baac);
+                Scalar c_baad = dot(nab, nad);
+                c_baad = c_baad > 1.0 ? 1.0 : (c_baad < -1.0 ? -1.0 : c_baad);
+
+                Scalar inv_s_accb = Scalar(1.0) / std::max(sqrt(1.0 - c_accb * c_accb), SMALL);
+                Scalar inv_s_addb = Scalar(1.0) / std::max(sqrt(1.0 - c_addb * c_addb), SMALL);
+                Scalar inv_s_abbc = Scalar(1.0) / std::max(sqrt(1.0 - c_abbc * c_abbc), SMALL);
+                Scalar inv_s_abbd = Scalar(1.0) / std::max(sqrt(1.0 - c_abbd * c_abbd), SMALL);
+                Scalar inv_s_baac = Scalar(1.0) / std::max(sqrt(1.0 - c_baac * c_baac), SMALL);
+                Scalar inv_s_baad = Scalar(1.0) / std::max(sqrt(1.0 - c_baad * c_baad), SMALL);
+
+                Scalar cot_accb = c_accb * inv_s_accb;
+                Scalar cot_addb = c_addb * inv_s_addb;
+
+                Scalar sigma_hat_ab = (cot_accb + cot_addb) / 2;
+
+                Scalar3 sigma_dash_a = m_sigma_dash[bond.idx_a];
+                Scalar3 sigma_dash_b = m_sigma_dash[bond.idx_b];
+                Scalar3 sigma_dash_c = m_sigma_dash[bond.idx_c];
+                Scalar3 sigma_dash_d = m_sigma_dash[bond.idx_d];
+
+                Scalar sigma_a = m_sigma[bond.idx_a];
+                Scalar sigma_b = m_sigma[bond.idx_b];
+                Scalar sigma_c = m_sigma[bond.idx_c];
+                Scalar sigma_d = m_sigma[bond.idx_d];
+
+                Scalar3 dc_abbc, dc_abbd, dc_baac, dc_baad;
+                dc_abbc = -nbc / rab - c_abbc / rab * nab;
+                dc_abbd = -nbd / rab - c_abbd / rab * nab;
+                dc_baac = nac / rab - c_baac / rab * nab;
+                dc_baad = nad / rab - c_baad / rab * nab;
+
+                Scalar3 dsigma_hat_ac, dsigma_hat_ad, dsigma_hat_bc, dsigma_hat_bd;
+                dsigma_hat_ac = inv_s_abbc * inv_s_abbc * inv_s_abbc * dc_abbc / 2;
+                dsigma_hat_ad = inv_s_abbd * inv_s_abbd * inv_s_abbd * dc_abbd / 2;
+                dsigma_hat_bc = inv_s_baac * inv_s_baac * inv_s_baac * dc_baac / 2;
+                dsigma_hat_bd = inv_s_baad * inv_s_baad * inv_s_baad * dc_baad / 2;
+
+                Scalar3 dsigma_a, dsigma_b, dsigma_c, dsigma_d;
+                dsigma_a
+                    = (dsigma_hat_ac * rsqac + dsigma_hat_ad * rsqad + 2 * sigma_hat_ab * dab) / 4;
+                dsigma_b
+                    = (dsigma_hat_bc * rsqbc + dsigma_hat_bd * rsqbd + 2 * sigma_hat_ab * dab) / 4;
+                dsigma_c = (dsigma_hat_ac * rsqac + dsigma_hat_bc * rsqbc) / 4;
+                dsigma_d = (dsigma_hat_ad * rsqad + dsigma_hat_bd * rsqbd) / 4;
+
+                Scalar dsigma_dash_a
+                    = dot(dsigma_hat_ac, dac) + dot(dsigma_hat_ad, dad) + sigma_hat_ab;
+                Scalar dsigma_dash_b
+                    = dot(dsigma_hat_bc, dbc) + dot(dsigma_hat_bd, dbd) - sigma_hat_ab;
+                Scalar dsigma_dash_c = -dot(dsigma_hat_ac, dac) - dot(dsigma_hat_bc, dbc);
+                Scalar dsigma_dash_d = -dot(dsigma_hat_ad, dad) - dot(dsigma_hat_bd, dbd);
+
+                Scalar inv_sigma_a = 1.0 / sigma_a;
+                Scalar inv_sigma_b = 1.0 / sigma_b;
+                Scalar inv_sigma_c = 1.0 / sigma_c;
+                Scalar inv_sigma_d = 1.0 / sigma_d;
+
+                Scalar sigma_dash_a2
+                    = 0.5 * dot(sigma_dash_a, sigma_dash_a) * inv_sigma_a * inv_sigma_a;
+                Scalar sigma_dash_b2
+                    = 0.5 * dot(sigma_dash_b, sigma_dash_b) * inv_sigma_b * inv_sigma_b;
+                Scalar sigma_dash_c2
+                    = 0.5 * dot(sigma_dash_c, sigma_dash_c) * inv_sigma_c * inv_sigma_c;
+                Scalar sigma_dash_d2
+                    = 0.5 * dot(sigma_dash_d, sigma_dash_d) * inv_sigma_d * inv_sigma_d;
+
+                Scalar3 Fa = dsigma_dash_a * inv_sigma_a * sigma_dash_a - sigma_dash_a2 * dsigma_a;
+                Fa += dsigma_dash_b * inv_sigma_b * sigma_dash_b - sigma_dash_b2 * dsigma_b;
+                Fa += dsigma_dash_c * inv_sigma_c * sigma_dash_c - sigma_dash_c2 * dsigma_c;
+                Fa += dsigma_dash_d * inv_sigma_d * sigma_dash_d - sigma_dash_d2 * dsigma_d;
+
+                Fa *= param.k_helfrich;
+
+                if (compute_virial)
+                    computeVirial(membrane_virial, &dab, &Fa, 1);
+
+                if (bond.idx_a < N)
+                    {
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    bond.idx_a,
+                                    Fa,
+                                    param.k_helfrich * 0.5 * dot(sigma_dash_a, sigma_dash_a)
+                                        * inv_sigma_a,
+                                    membrane_virial);
+                    }
+
+                if (bond.idx_b < N)
+                    {
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    bond.idx_b,
+                                    -Fa,
+                                    param.k_helfrich * 0.5 * dot(sigma_dash_b, sigma_dash_b)
+                                        * inv_sigma_b,
+                                    membrane_virial);
+                    }
+                }
+
+            if (param.k_bending != 0)
+                {
+                Scalar3 z1;
+                z1.x = dab.y * dac.z - dab.z * dac.y;
+                z1.y = dab.z * dac.x - dab.x * dac.z;
+                z1.z = dab.x * dac.y - dab.y * dac.x;
+
+                Scalar3 z2;
+                z2.x = dad.y * dab.z - dad.z * dab.y;
+                z2.y = dad.z * dab.x - dad.x * dab.z;
+                z2.z = dad.x * dab.y - dad.y * dab.x;
+
+                Scalar n1 = fast::rsqrt(z1.x * z1.x + z1.y * z1.y + z1.z * z1.z);
+                Scalar n2 = fast::rsqrt(z2.x * z2.x + z2.y * z2.y + z2.z * z2.z);
+                Scalar z1z2 = z1.x * z2.x + z1.y * z2.y + z1.z * z2.z;
+
+                Scalar cosinus = z1z2 * n1 * n2;
+
+                Scalar3 A1 = n1 * n2 * z2 - cosinus * n1 * n1 * z1;
+                Scalar3 A2 = n1 * n2 * z1 - cosinus * n2 * n2 * z2;
+
+                Scalar3 F[3];
+                F[0].x = -A1.y * dac.z + A1.z * dac.y + A2.y * dad.z - A2.z * dad.y;
+                F[0].y = A1.x * dac.z - A1.z * dac.x - A2.x * dad.z + A2.z * dad.x;
+                F[0].z = -A1.x * dac.y + A1.y * dac.x + A2.x * dad.y - A2.y * dad.x;
+
+                F[1].x = A1.y * dab.z - A1.z * dab.y;
+                F[1].y = -A1.x * dab.z + A1.z * dab.x;
+                F[1].z = A1.x * dab.y - A1.y * dab.x;
+
+                F[2].x = -A2.y * dab.z + A2.z * dab.y;
+                F[2].y = A2.x * dab.z - A2.z * dab.x;
+                F[2].z = -A2.x * dab.y + A2.y * dab.x;
+
+                Scalar prefactor = 0.5 * param.k_bending;
+                for (unsigned int k = 0; k < 3; k++)
+                    F[k] = prefactor * F[k];
+
+                // the missing minus sign comes from the fact that we have to compare the normal
+                // directions
+                Scalar energy = 0.25 * prefactor * (1 - cosinus);
+
+                Scalar3 r[3] = {dab, dac, dad};
+
+                if (bond.idx_a < N)
+                    {
+                    if (compute_virial)
+                        computeVirial(membrane_virial, r, F, 3);
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    bond.idx_a,
+                                    F[0] + F[1] + F[2],
+                                    energy,
+                                    membrane_virial);
+                    }
+
+                const unsigned int idx[3] = {bond.idx_b, bond.idx_c, bond.idx_d};
+                for (unsigned int k = 0; k < 3; k++)
+                    {
+                    if (idx[k] >= N)
+                        continue;
+
+                    if (compute_virial)
+                        computeVirial(membrane_virial, &r[k], &F[k], 1);
+                    addContribution(h_force.data,
+                                    h_virial.data,
+                                    virial_pitch,
+                                    idx[k],
+                                    -F[k],
+                                    energy,
+                                    membrane_virial);
+                    }
+                }
+            }
+        }
+    }
+
+/*! \param compute_helfrich Compute the per vertex sums of the Helfrich term when true
+ */
+void MembraneMeshForceCompute::computeGeometry(bool compute_helfrich)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+
+    const unsigned int n_types = m_mesh_data->getMeshTriangleData()->getNTypes();
+
+    // the global areas are stored in the first n_types elements and the volumes in the rest so
+    // that both are reduced in one call
+    std::vector<Scalar> global_sums(2 * n_types, Scalar(0.0));
+
+    bool domain_decomposed = false;
+#ifdef ENABLE_MPI
+    domain_decomposed = bool(m_pdata->getDomainDecomposition());
+#endif
+
+        {
+        ArrayHandle<typename Angle::members_t> h_triangles(
+            m_mesh_data->getMeshTriangleData()->getMembersArray(),
+            access_location::host,
+            access_mode::read);
+
+        const unsigned int size = (unsigned int)m_mesh_data->getMeshTriangleData()->getN();
+        m_triangle_geometry.resize(size);
+
+        // loop over mesh triangles
+        for (unsigned int i = 0; i < size; i++)
+            {
+            const typename Angle::members_t& triangle = h_triangles.data[i];
+            assert(triangle.tag[0] < m_pdata->getMaximumTag() + 1);
+            assert(triangle.tag[1] < m_pdata->getMaximumTag() + 1);
+            assert(triangle.tag[2] < m_pdata->getMaximumTag() + 1);
+
+            triangle_geometry& tri = m_triangle_geometry[i];
+            tri.idx_a = h_rtag.data[triangle.tag[0]];
+            tri.idx_b = h_rtag.data[triangle.tag[1]];
+            tri.idx_c = h_rtag.data[triangle.tag[2]];
+            tri.type = m_mesh_data->getMeshTriangleData()->getTypeByIndex(i);
+
+            assert(tri.idx_a < m_pdata->getN() + m_pdata->getNGhosts());
+            assert(tri.idx_b < m_pdata->getN() + m_pdata->getNGhosts());
+            assert(tri.idx_c < m_pdata->getN() + m_pdata->getNGhosts());
+
+            vec3<Scalar> pos_a(h_pos.data[tri.idx_a]);
+            vec3<Scalar> pos_b(h_pos.data[tri.idx_b]);
+            vec3<Scalar> pos_c(h_pos.data[tri.idx_c]);
+
+            tri.dab = box.minImage(vec_to_scalar3(pos_a - pos_b));
+            tri.dac = box.minImage(vec_to_scalar3(pos_a - pos_c));
+
+            tri.rab = sqrt(dot(tri.dab, tri.dab));
+            tri.rac = sqrt(dot(tri.dac, tri.dac));
+
+            Scalar c_baac = dot(tri.dab, tri.dac) / (tri.rab * tri.rac);
+            if (c_baac > 1.0)
+                c_baac = 1.0;
+            if (c_baac < -1.0)
+                c_baac = -1.0;
+
+            tri.c_baac = c_baac;
+            tri.s_baac = sqrt(1.0 - c_baac * c_baac);
+
+            pos_a = box.shift(pos_a, h_image.data[tri.idx_a]);
+            pos_b = box.shift(pos_b, h_image.data[tri.idx_b]);
+            pos_c = box.shift(pos_c, h_image.data[tri.idx_c]);
+
+            tri.dVol_a = cross(pos_c, pos_b);
+            tri.dVol_b = cross(pos_a, pos_c);
+            tri.dVol_c = cross(pos_b, pos_a);
+
+            Scalar area_tri = tri.rab * tri.rac * tri.s_baac / 2.0;
+            Scalar volume_tri = dot(tri.dVol_a, pos_a) / 6.0;
+
+            if (domain_decomposed)
+                {
+                unsigned int n_local = (tri.idx_a < m_pdata->getN())
+                                       + (tri.idx_b < m_pdata->getN())
+                                       + (tri.idx_c < m_pdata->getN());
+                area_tri *= Scalar(n_local) / Scalar(3.0);
+                volume_tri *= Scalar(n_local) / Scalar(3.0);
+                }
+
+            global_sums[tri.type] += area_tri;
+            global_sums[n_types + tri.type] += volume_tri;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (domain_decomposed)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &global_sums[0],
+                      2 * n_types,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+        {
+        ArrayHandle<Scalar> h_area(m_area, access_location::host, access_mode::overwrite);
+        ArrayHandle<Scalar> h_volume(m_volume, access_location::host, access_mode::overwrite);
+        for (unsigned int i = 0; i < n_types; i++)
+            {
+            h_area.data[i] = global_sums[i];
+            h_volume.data[i] = global_sums[n_types + i];
+            }
+        }
+
+    ArrayHandle<typename MeshBond::members_t> h_bonds(
+        m_mesh_data->getMeshBondData()->getMembersArray(),
+        access_location::host,
+        access_mode::read);
+
+    const unsigned int size = (unsigned int)m_mesh_data->getMeshBondData()->getN();
+    m_bond_geometry.clear();
+    m_bond_geometry.reserve(size);
+
+    if (compute_helfrich)
+        {
+        m_sigma.assign(m_pdata->getN() + m_pdata->getNGhosts(), Scalar(0.0));
+        m_sigma_dash.assign(m_pdata->getN() + m_pdata->getNGhosts(),
+                            make_scalar3(Scalar(0.0), Scalar(0.0), Scalar(0.0)));
+        }
+
+    for (unsigned int i = 0; i < size; i++)
+        {
+        const typename MeshBond::members_t& mesh_bond = h_bonds.data[i];
+
+        unsigned int btag_a = mesh_bond.tag[0];
+        assert(btag_a < m_pdata->getMaximumTag() + 1);
+        unsigned int btag_b = mesh_bond.tag[1];
+        assert(btag_b < m_pdata->getMaximumTag() + 1);
+        unsigned int btag_c = mesh_bond.tag[2];
+        assert(btag_c < m_pdata->getMaximumTag() + 1);
+        unsigned int btag_d = mesh_bond.tag[3];
+        assert(btag_d < m_pdata->getMaximumTag() + 1);
+
+        // boundary bonds have only one triangle
+        if (btag_c == btag_d)
+            continue;
+
+        bond_geometry bond;
+        bond.idx_a = h_rtag.data[btag_a];
+        bond.idx_b = h_rtag.data[btag_b];
+        bond.idx_c = h_rtag.data[btag_c];
+        bond.idx_d = h_rtag.data[btag_d];
+        bond.type = m_mesh_data->getMeshBondData()->getTypeByIndex(i);
+
+        assert(bond.idx_a < m_pdata->getN() + m_pdata->getNGhosts());
+        assert(bond.idx_b < m_pdata->getN() + m_pdata->getNGhosts());
+        assert(bond.idx_c < m_pdata->getN() + m_pdata->getNGhosts());
+        assert(bond.idx_d < m_pdata->getN() + m_pdata->getNGhosts());
+
+        vec3<Scalar> pos_a(h_pos.data[bond.idx_a]);
+        vec3<Scalar> pos_b(h_pos.data[bond.idx_b]);
+        vec3<Scalar> pos_c(h_pos.data[bond.idx_c]);
+        vec3<Scalar> pos_d(h_pos.data[bond.idx_d]);
+
+        bond.dab = box.minImage(vec_to_scalar3(pos_a - pos_b));
+        bond.dac = box.minImage(vec_to_scalar3(pos_a - pos_c));
+        bond.dad = box.minImage(vec_to_scalar3(pos_a - pos_d));
+        bond.dbc = box.minImage(vec_to_scalar3(pos_b - pos_c));
+        bond.dbd = box.minImage(vec_to_scalar3(pos_b - pos_d));
+
+        m_bond_geometry.push_back(bond);
+
+        if (!compute_helfrich)
+            continue;
+
+        Scalar rsqab = dot(bond.dab, bond.dab);
+        Scalar rab = sqrt(rsqab);
+        Scalar rac = sqrt(dot(bond.dac, bond.dac));
+        Scalar rad = sqrt(dot(bond.dad, bond.dad));
+        Scalar rbc = sqrt(dot(bond.dbc, bond.dbc));
+        Scalar rbd = sqrt(dot(bond.dbd, bond.dbd));
+
+        Scalar3 nab, nac, nad, nbc, nbd;
+        nab = bond.dab / rab;
+        nac = bond.dac / rac;
+        nad = bond.dad / rad;
+        nbc = bond.dbc / rbc;
+        nbd = bond.dbd / rbd;
+
+        Scalar c_accb = dot(nac, nbc);
+        if (c_accb > 1.0)
+            c_accb = 1.0;
+        if (c_accb < -1.0)
+            c_accb = -1.0;
+
+        Scalar c_addb = dot(nad, nbd);
+        if (c_addb > 1.0)
+            c_addb = 1.0;
+        if (c_addb < -1.0)
+            c_addb = -1.0;
+
+        vec3<Scalar> nbac = cross(vec3<Scalar>(nab), vec3<Scalar>(nac));
+        Scalar inv_nbac = 1.0 / sqrt(dot(nbac, nbac));
+
+        vec3<Scalar> nbad = cross(vec3<Scalar>(nab), vec3<Scalar>(nad));
+        Scalar inv_nbad = 1.0 / sqrt(dot(nbad, nbad));
+
+        if (dot(nbac, nbad) * inv_nbad * inv_nbac > 0.9)
+            {
+            this->m_exec_conf->msg->error()
+                << "membrane calculations : triangles (" << bond.idx_a << "," << bond.idx_b << ","
+                << bond.idx_c << ") and (" << bond.idx_a << "," << bond.idx_b << ","
+                << bond.idx_d << ") overlap." << std::endl
+                << std::endl;
+            throw std::runtime_error("Error in bending energy calculation");
+            }
+
+        Scalar inv_s_accb = Scalar(1.0) / std::max(sqrt(1.0 - c_accb * c_accb), SMALL);
+        Scalar inv_s_addb = Scalar(1.0) / std::max(sqrt(1.0 - c_addb * c_addb), SMALL);
+
+        Scalar cot_accb = c_accb * inv_s_accb;
+        Scalar cot_addb = c_addb * inv_s_addb;
+
+        Scalar sigma_hat_ab = (cot_accb + cot_addb) / 2;
+
+        Scalar sigma_a = sigma_hat_ab * rsqab * 0.25;
+
+        if (bond.idx_a < m_pdata->getN())
+            {
+            m_sigma[bond.idx_a] += sigma_a;
+            m_sigma_dash[bond.idx_a] += sigma_hat_ab * bond.dab;
+            }
+
+        if (bond.idx_b < m_pdata->getN())
+            {
+            m_sigma[bond.idx_b] += sigma_a;
+            m_sigma_dash[bond.idx_b] -= sigma_hat_ab * bond.dab;
+            }
+        }
+    }
+
+namespace detail
+    {
+void export_MembraneMeshForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<MembraneMeshForceCompute,
+                     ForceCompute,
+                     std::shared_ptr<MembraneMeshForceCompute>>(m, "MembraneMeshForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<MeshDefinition>>())
+        .def("setParams", &MembraneMeshForceCompute::setParamsPython)
+        .def("getParams", &MembraneMeshForceCompute::getParams)
+        .def("getArea", &MembraneMeshForceCompute::getArea)
+        .def("getVolume", &MembraneMeshForceCompute::getVolume);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,133 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MembraneMeshParameters.h"
+#include "hoomd/ForceCompute.h"
+#include "hoomd/MeshDefinition.h"
+#include "hoomd/VectorMath.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file MembraneMeshForceCompute.h
+    \brief Declares a class for computing the combined membrane energy forces
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __MEMBRANEMESHFORCECOMPUTE_H__
+#define __MEMBRANEMESHFORCECOMPUTE_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes the Helfrich, bending rigidity, area, triangle area, and volume forces on the mesh
+/*! MembraneMeshForceCompute evaluates the energy terms of HelfrichMeshForceCompute,
+    BendingRigidityMeshForceCompute, AreaConservationMeshForceCompute,
+    TriangleAreaConservationMeshForceCompute, and VolumeConservationMeshForceCompute in a single
+    force compute. A geometry pass computes the bond vectors of every triangle and mesh bond once,
+    the per vertex Helfrich sums, and the global areas and volumes of all types, which are reduced
+    over all ranks in one call. The force pass then evaluates all selected terms from the stored
+    geometry in one loop over the triangles and one loop over the mesh bonds.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT MembraneMeshForceCompute : public ForceCompute
+    {
+    public:
+    //! Constructs the compute
+    MembraneMeshForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                             std::shared_ptr<MeshDefinition> meshdef);
+
+    //! Destructor
+    virtual ~MembraneMeshForceCompute();
+
+    //! Set the parameters
+    virtual void setParams(unsigned int type, const membrane_param_t& params);
+
+    virtual void setParamsPython(std::string type, pybind11::dict params);
+
+    /// Get the parameters for a type
+    pybind11::dict getParams(std::string type);
+
+    //! Get the global area of each mesh type
+    virtual pybind11::array_t<Scalar> getArea()
+        {
+        unsigned int n_types = m_mesh_data->getMeshTriangleData()->getNTypes();
+        ArrayHandle<Scalar> h_area(m_area, access_location::host, access_mode::read);
+        return pybind11::array(n_types, h_area.data);
+        };
+
+    //! Get the global volume of each mesh type
+    virtual pybind11::array_t<Scalar> getVolume()
+        {
+        unsigned int n_types = m_mesh_data->getMeshTriangleData()->getNTypes();
+        ArrayHandle<Scalar> h_volume(m_volume, access_location::host, access_mode::read);
+        return pybind11::array(n_types, h_volume.data);
+        };
+
+#ifdef ENABLE_MPI
+    //! Get ghost particle fields requested by this pair potential
+    /*! \param timestep Current time step
+     */
+    virtual CommFlags getRequestedCommFlags(uint64_t timestep)
+        {
+        CommFlags flags = CommFlags(0);
+        flags[comm_flag::tag] = 1;
+        flags |= ForceCompute::getRequestedCommFlags(timestep);
+        return flags;
+        }
+#endif
+
+    protected:
+    //! Geometry of a mesh triangle shared by the area, triangle area, and volume terms
+    struct triangle_geometry
+        {
+        unsigned int idx_a, idx_b, idx_c;    //!< Particle indices of the vertices
+        unsigned int type;                   //!< Triangle type
+        Scalar3 dab, dac;                    //!< Minimum image bond vectors a-b and a-c
+        Scalar rab, rac;                     //!< Bond lengths
+        Scalar c_baac, s_baac;               //!< Cosine and sine of the angle at vertex a
+        vec3<Scalar> dVol_a, dVol_b, dVol_c; //!< Volume gradients of the unwrapped vertices
+        };
+
+    //! Geometry of a mesh bond shared by the Helfrich and bending rigidity terms
+    struct bond_geometry
+        {
+        unsigned int idx_a, idx_b, idx_c, idx_d; //!< Particle indices of the bond and its wings
+        unsigned int type;                       //!< Mesh bond type
+        Scalar3 dab, dac, dad, dbc, dbd;         //!< Minimum image bond vectors
+        };
+
+    GPUArray<membrane_param_t> m_params;         //!< Parameters
+    std::shared_ptr<MeshDefinition> m_mesh_data; //!< Mesh data to use in computing energy
+    GPUArray<Scalar> m_area;                     //!< Global area of each type
+    GPUArray<Scalar> m_volume;                   //!< Global volume of each type
+
+    std::vector<triangle_geometry> m_triangle_geometry; //!< Geometry of all triangles
+    std::vector<bond_geometry> m_bond_geometry;         //!< Geometry of all mesh bonds
+    std::vector<Scalar> m_sigma;                        //!< Dual cell area of each vertex
+    std::vector<Scalar3> m_sigma_dash;                  //!< Weighted sum of the vertex bonds
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+
+    //! Compute the geometry of all triangles and bonds and the global areas and volumes
+    virtual void computeGeometry(bool compute_helfrich);
+    };
+
+namespace detail
+    {
+//! Exports the MembraneMeshForceCompute class to python
+void export_MembraneMeshForceCompute(pybind11::module& m);
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
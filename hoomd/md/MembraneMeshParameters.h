@@ -0,0 +1,68 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/HOOMDMath.h"
+
+#ifndef __HIPCC__
+#include <pybind11/pybind11.h>
+#endif
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Parameters of the membrane energy terms of one mesh type
+/*! A term is not evaluated when its stiffness is 0.
+ */
+struct membrane_param_t
+    {
+    Scalar k_helfrich;  //!< Helfrich bending stiffness
+    Scalar k_bending;   //!< Bending rigidity stiffness
+    Scalar k_area;      //!< Global area conservation stiffness
+    Scalar A0;          //!< Target global area
+    Scalar k_triangle;  //!< Triangle area conservation stiffness
+    Scalar A0_triangle; //!< Target area of a single triangle
+    Scalar k_volume;    //!< Volume conservation stiffness
+    Scalar V0;          //!< Target volume
+
+#ifndef __HIPCC__
+    membrane_param_t()
+        : k_helfrich(0), k_bending(0), k_area(0), A0(0), k_triangle(0), A0_triangle(0),
+          k_volume(0), V0(0)
+        {
+        }
+
+    membrane_param_t(pybind11::dict params)
+        : k_helfrich(params["k_helfrich"].cast<Scalar>()),
+          k_bending(params["k_bending"].cast<Scalar>()), k_area(params["k_area"].cast<Scalar>()),
+          A0(params["A0"].cast<Scalar>()), k_triangle(params["k_triangle"].cast<Scalar>()),
+          A0_triangle(params["A0_triangle"].cast<Scalar>()),
+          k_volume(params["k_volume"].cast<Scalar>()), V0(params["V0"].cast<Scalar>())
+        {
+        }
+
+    pybind11::dict asDict()
+        {
+        pybind11::dict v;
+        v["k_helfrich"] = k_helfrich;
+        v["k_bending"] = k_bending;
+        v["k_area"] = k_area;
+        v["A0"] = A0;
+        v["k_triangle"] = k_triangle;
+        v["A0_triangle"] = A0_triangle;
+        v["k_volume"] = k_volume;
+        v["V0"] = V0;
+        return v;
+        }
+#endif
+    }
+#if HOOMD_LONGREAL_SIZE == 32
+    __attribute__((aligned(4)));
+#else
+    __attribute__((aligned(8)));
+#endif
+
+    } // namespace md
+    } // namespace hoomd
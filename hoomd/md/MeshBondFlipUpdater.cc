@@ -0,0 +1,255 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MeshBondFlipUpdater.cc
+    \brief Defines the MeshBondFlipUpdater class
+*/
+
+#include "MeshBondFlipUpdater.h"
+#include "hoomd/VectorMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace
+    {
+//! Key of the edge between the vertices a and b, independent of their order
+uint64_t edgeKey(unsigned int a, unsigned int b)
+    {
+    if (a > b)
+        std::swap(a, b);
+    return (uint64_t(a) << 32) | uint64_t(b);
+    }
+
+//! Interior angle of a triangle at the vertex r_c
+Scalar vertexAngle(const BoxDim& box,
+                   const vec3<Scalar>& r_a,
+                   const vec3<Scalar>& r_b,
+                   const vec3<Scalar>& r_c)
+    {
+    vec3<Scalar> u = box.minImage(r_a - r_c);
+    vec3<Scalar> v = box.minImage(r_b - r_c);
+    vec3<Scalar> w = cross(u, v);
+    return atan2(sqrt(dot(w, w)), dot(u, v));
+    }
+
+//! Replace the opposite vertex old_tag of a mesh bond with new_tag
+void replaceOppositeVertex(MeshBondData& bond_data,
+                           unsigned int bond_idx,
+                           unsigned int old_tag,
+                           unsigned int new_tag)
+    {
+    MeshBondData::members_t bond = bond_data.getMembersByIndex(bond_idx);
+    if (bond.tag[2] == bond.tag[3])
+        {
+        // boundary bonds repeat their only opposite vertex
+        bond.tag[2] = new_tag;
+        bond.tag[3] = new_tag;
+        }
+    else if (bond.tag[2] == old_tag)
+        {
+        bond.tag[2] = new_tag;
+        }
+    else
+        {
+        bond.tag[3] = new_tag;
+        }
+    bond_data.setMemberByIndex(bond_idx, bond);
+    }
+    } // end anonymous namespace
+
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to flip bonds
+    \param mesh Mesh to flip the bonds of
+*/
+MeshBondFlipUpdater::MeshBondFlipUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                                         std::shared_ptr<Trigger> trigger,
+                                         std::shared_ptr<MeshDefinition> mesh)
+    : Updater(sysdef, trigger), m_mesh(mesh)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MeshBondFlipUpdater" << endl;
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        throw std::runtime_error("MeshBondFlip does not support domain decomposition.");
+        }
+#endif
+    }
+
+MeshBondFlipUpdater::~MeshBondFlipUpdater()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MeshBondFlipUpdater" << endl;
+    }
+
+/*! \param timestep Current time step
+
+    The edge maps are built once per update and kept current as bonds flip, so later bonds in the
+    sweep see the topology left by the earlier flips.
+*/
+void MeshBondFlipUpdater::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+    m_num_flips = 0;
+
+    MeshBondData& bond_data = *m_mesh->getMeshBondData();
+    TriangleData& triangle_data = *m_mesh->getMeshTriangleData();
+    const unsigned int n_bonds = bond_data.getN();
+    const unsigned int n_triangles = triangle_data.getN();
+
+    // the triangles that share each edge, and the bond on each edge
+    const unsigned int NO_TRIANGLE = 0xffffffff;
+    std::unordered_map<uint64_t, std::pair<unsigned int, unsigned int>> triangles_of_edge;
+    std::unordered_map<uint64_t, unsigned int> bond_of_edge;
+    triangles_of_edge.reserve(n_bonds);
+    bond_of_edge.reserve(n_bonds);
+
+    for (unsigned int i = 0; i < n_triangles; i++)
+        {
+        TriangleData::members_t triangle = triangle_data.getMembersByIndex(i);
+        for (unsigned int k = 0; k < 3; k++)
+            {
+            auto result = triangles_of_edge.emplace(
+                edgeKey(triangle.tag[k], triangle.tag[(k + 1) % 3]),
+                std::make_pair(i, NO_TRIANGLE));
+            if (!result.second)
+                result.first->second.second = i;
+            }
+        }
+
+    std::vector<unsigned int> n_neighbors(m_pdata->getRTags().size(), 0);
+    for (unsigned int i = 0; i < n_bonds; i++)
+        {
+        MeshBondData::members_t bond = bond_data.getMembersByIndex(i);
+        bond_of_edge[edgeKey(bond.tag[0], bond.tag[1])] = i;
+        n_neighbors[bond.tag[0]]++;
+        n_neighbors[bond.tag[1]]++;
+        }
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    const BoxDim box = m_pdata->getGlobalBox();
+
+    for (unsigned int i = 0; i < n_bonds; i++)
+        {
+        MeshBondData::members_t bond = bond_data.getMembersByIndex(i);
+        unsigned int a = bond.tag[0];
+        unsigned int b = bond.tag[1];
+        unsigned int c = bond.tag[2];
+        unsigned int d = bond.tag[3];
+
+        if (c == d || n_neighbors[a] <= 3 || n_neighbors[b] <= 3
+            || bond_of_edge.count(edgeKey(c, d)))
+            continue;
+
+        // t_c holds the vertex c, t_d the vertex d
+        std::pair<unsigned int, unsigned int> triangles = triangles_of_edge[edgeKey(a, b)];
+        unsigned int t_c = triangles.first;
+        unsigned int t_d = triangles.second;
+        TriangleData::members_t triangle_c = triangle_data.getMembersByIndex(t_c);
+        if (triangle_c.tag[0] != c && triangle_c.tag[1] != c && triangle_c.tag[2] != c)
+            std::swap(t_c, t_d);
+        triangle_c = triangle_data.getMembersByIndex(t_c);
+
+        if (triangle_data.getTypeByIndex(t_c) != triangle_data.getTypeByIndex(t_d))
+            continue;
+
+        vec3<Scalar> r_a(h_pos.data[h_rtag.data[a]]);
+        vec3<Scalar> r_b(h_pos.data[h_rtag.data[b]]);
+        vec3<Scalar> r_c(h_pos.data[h_rtag.data[c]]);
+        vec3<Scalar> r_d(h_pos.data[h_rtag.data[d]]);
+        if (vertexAngle(box, r_a, r_b, r_c) + vertexAngle(box, r_a, r_b, r_d) <= Scalar(M_PI))
+            continue;
+
+        // p -> q is the orientation of the flipped edge in t_c
+        unsigned int p = b;
+        unsigned int q = a;
+        for (unsigned int k = 0; k < 3; k++)
+            {
+            if (triangle_c.tag[k] == a && triangle_c.tag[(k + 1) % 3] == b)
+                {
+                p = a;
+                q = b;
+                }
+            }
+
+        // (p, q, c) and (q, p, d) become (p, d, c) and (d, q, c)
+        TriangleData::members_t new_triangle;
+        new_triangle.tag[0] = p;
+        new_triangle.tag[1] = d;
+        new_triangle.tag[2] = c;
+        triangle_data.setMemberByIndex(t_c, new_triangle);
+        new_triangle.tag[0] = d;
+        new_triangle.tag[1] = q;
+        new_triangle.tag[2] = c;
+        triangle_data.setMemberByIndex(t_d, new_triangle);
+
+        // the edges around the flipped bond now face c or d
+        replaceOppositeVertex(bond_data, bond_of_edge[edgeKey(a, c)], b, d);
+        replaceOppositeVertex(bond_data, bond_of_edge[edgeKey(b, c)], a, d);
+        replaceOppositeVertex(bond_data, bond_of_edge[edgeKey(a, d)], b, c);
+        replaceOppositeVertex(bond_data, bond_of_edge[edgeKey(b, d)], a, c);
+
+        MeshBondData::members_t new_bond;
+        new_bond.tag[0] = std::min(c, d);
+        new_bond.tag[1] = std::max(c, d);
+        new_bond.tag[2] = a;
+        new_bond.tag[3] = b;
+        bond_data.setMemberByIndex(i, new_bond);
+
+        // the edge p-d moves from t_d to t_c, and the edge q-c from t_c to t_d
+        std::pair<unsigned int, unsigned int>& triangles_pd = triangles_of_edge[edgeKey(p, d)];
+        if (triangles_pd.first == t_d)
+            triangles_pd.first = t_c;
+        else
+            triangles_pd.second = t_c;
+        std::pair<unsigned int, unsigned int>& triangles_qc = triangles_of_edge[edgeKey(q, c)];
+        if (triangles_qc.first == t_c)
+            triangles_qc.first = t_d;
+        else
+            triangles_qc.second = t_d;
+
+        triangles_of_edge.erase(edgeKey(a, b));
+        triangles_of_edge[edgeKey(c, d)] = std::make_pair(t_c, t_d);
+        bond_of_edge.erase(edgeKey(a, b));
+        bond_of_edge[edgeKey(c, d)] = i;
+
+        n_neighbors[a]--;
+        n_neighbors[b]--;
+        n_neighbors[c]++;
+        n_neighbors[d]++;
+        m_num_flips++;
+        }
+
+    if (m_num_flips > 0)
+        {
+        bond_data.setDirty();
+        triangle_data.setDirty();
+        }
+    }
+
+namespace detail
+    {
+void export_MeshBondFlipUpdater(pybind11::module& m)
+    {
+    pybind11::class_<MeshBondFlipUpdater, Updater, std::shared_ptr<MeshBondFlipUpdater>>(
+        m,
+        "MeshBondFlipUpdater")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<MeshDefinition>>())
+        .def_property_readonly("num_flips", &MeshBondFlipUpdater::getNumFlips);
+    }
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,74 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MeshBondFlipUpdater.h
+    \brief Declares an updater that flips the bonds of a mesh triangulation
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "hoomd/MeshDefinition.h"
+#include "hoomd/Updater.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+
+#ifndef __MESH_BOND_FLIP_UPDATER_H__
+#define __MESH_BOND_FLIP_UPDATER_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Flips the mesh bonds that violate the Delaunay condition
+/*! A mesh bond (a, b) with the opposite vertices c and d is the shared edge of the triangles
+    (a, b, c) and (b, a, d). When the angles at c and d sum to more than pi, the updater replaces
+    the bond with (c, d) and the two triangles with (a, d, c) and (d, b, c). The triangles keep
+    their orientation, and the updater rewrites the opposite vertices of the four edges around the
+    flipped bond.
+
+    The flips modify the mesh bond and triangle data in place: the group tags, types and the
+    number of groups do not change, so the updater only marks the GPU tables dirty instead of
+    rebuilding the mesh from a snapshot. Each update sweeps over all bonds once.
+
+    The updater does not flip boundary bonds, bonds whose flip would duplicate an existing bond,
+    bonds between triangles of different types, or bonds whose end points would be left with
+    fewer than three neighbors.
+*/
+class PYBIND11_EXPORT MeshBondFlipUpdater : public Updater
+    {
+    public:
+    //! Constructor
+    MeshBondFlipUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                        std::shared_ptr<Trigger> trigger,
+                        std::shared_ptr<MeshDefinition> mesh);
+
+    //! Destructor
+    virtual ~MeshBondFlipUpdater();
+
+    //! Flip the bonds of the mesh
+    virtual void update(uint64_t timestep);
+
+    //! Get the number of bonds flipped in the last update
+    unsigned int getNumFlips() const
+        {
+        return m_num_flips;
+        }
+
+    private:
+    std::shared_ptr<MeshDefinition> m_mesh; //!< Mesh to flip the bonds of
+    unsigned int m_num_flips = 0;           //!< Number of bonds flipped in the last update
+    };
+
+namespace detail
+    {
+//! Export the MeshBondFlipUpdater to python
+void export_MeshBondFlipUpdater(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
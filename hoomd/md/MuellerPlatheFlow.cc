@@ -16,6 +16,37 @@ namespace md
 const unsigned int INVALID_TAG = UINT_MAX;
 const Scalar INVALID_VEL = FLT_MAX; // should be ok, even for double.
 
+#ifdef ENABLE_MPI
+namespace
+    {
+//! Test if the candidate a is preferred over b, breaking ties by the smaller tag
+bool preferCandidate(const Scalar3& a, const Scalar3& b, bool larger)
+    {
+    if (a.x != b.x)
+        return larger ? a.x > b.x : a.x < b.x;
+    return static_cast<unsigned int>(__scalar_as_int(a.z))
+           < static_cast<unsigned int>(__scalar_as_int(b.z));
+    }
+
+//! MPI reduction of (max, min) candidate pairs
+/*! Each candidate holds the momentum, mass and tag of a particle. Ranks without the slab hold the
+    invalid candidates, which lose against every particle.
+*/
+void reduceMinMaxVelocity(void* in, void* inout, int* len, MPI_Datatype*)
+    {
+    const Scalar3* a = static_cast<const Scalar3*>(in);
+    Scalar3* b = static_cast<Scalar3*>(inout);
+    for (int i = 0; i < *len; i++)
+        {
+        if (preferCandidate(a[2 * i], b[2 * i], true))
+            b[2 * i] = a[2 * i];
+        if (preferCandidate(a[2 * i + 1], b[2 * i + 1], false))
+            b[2 * i + 1] = a[2 * i + 1];
+        }
+    }
+    } // end anonymous namespace
+#endif // ENABLE_MPI
+
 MuellerPlatheFlow::MuellerPlatheFlow(std::shared_ptr<SystemDefinition> sysdef,
                                      std::shared_ptr<Trigger> trigger,
                                      std::shared_ptr<ParticleGroup> group,
@@ -54,6 +85,11 @@ MuellerPlatheFlow::MuellerPlatheFlow(std::shared_ptr<SystemDefinition> sysdef,
     m_last_min_vel.z = __int_as_scalar(INVALID_TAG);
 
     m_exec_conf->msg->notice(5) << "Constructing MuellerPlatheFlow " << endl;
+#ifdef ENABLE_MPI
+    MPI_Type_contiguous(2 * sizeof(Scalar3), MPI_BYTE, &m_mpi_vel_pair);
+    MPI_Type_commit(&m_mpi_vel_pair);
+    MPI_Op_create(reduceMinMaxVelocity, 1, &m_mpi_vel_pair_op);
+#endif // ENABLE_MPI
     this->updateDomainDecomposition();
     // m_exec_conf->msg->notice(0)<<m_exec_conf->getRank()<<": "<< m_max_swap.gbl_rank<<"
     // "<<m_min_swap.gbl_rank<<endl;
@@ -68,6 +104,10 @@ MuellerPlatheFlow::~MuellerPlatheFlow(void)
     m_exec_conf->msg->notice(5) << "Destroying MuellerPlatheFlow " << endl;
     m_pdata->getBoxChangeSignal()
         .disconnect<MuellerPlatheFlow, &MuellerPlatheFlow::forceOrthorhombicBoxCheck>(this);
+#ifdef ENABLE_MPI
+    MPI_Op_free(&m_mpi_vel_pair_op);
+    MPI_Type_free(&m_mpi_vel_pair);
+#endif // ENABLE_MPI
     }
 
 void MuellerPlatheFlow::update(uint64_t timestep)
@@ -163,9 +203,6 @@ void MuellerPlatheFlow::swapMinMaxSlab(void)
 
     std::swap(m_has_max_slab, m_has_min_slab);
 
-#ifdef ENABLE_MPI
-    std::swap(m_max_swap, m_min_swap);
-#endif // ENABLE_MPI
     m_exec_conf->msg->notice(4) << "MuellerPlatheUpdater swapped min/max slab: "
                                 << this->getMinSlab() << " " << this->getMaxSlab() << endl;
     }
@@ -230,13 +267,6 @@ void MuellerPlatheFlow::updateDomainDecomposition(void)
         m_has_max_slab = false;
         if (my_pos == this->getMaxSlab() / (m_N_slabs / my_grid))
             m_has_max_slab = true;
-
-        // Create the communicator.
-        const int min_color = this->hasMinSlab() ? 0 : MPI_UNDEFINED;
-        initMPISwap(&m_min_swap, min_color);
-
-        const int max_color = this->hasMaxSlab() ? 0 : MPI_UNDEFINED;
-        initMPISwap(&m_max_swap, max_color);
         }
 #endif // ENABLE_MPI
     }
@@ -302,7 +332,7 @@ void MuellerPlatheFlow::searchMinMaxVelocity(void)
                 if (index == this->getMinSlab() && m_last_min_vel.x > vel && this->hasMinSlab())
                     {
                     m_last_min_vel.x = vel;
-                    m_last_max_vel.y = mass;
+                    m_last_min_vel.y = mass;
                     m_last_min_vel.z = __int_as_scalar(h_tag.data[j]);
                     }
                 }
@@ -377,88 +407,23 @@ void MuellerPlatheFlow::verifyOrthorhombicBox(void)
     }
 #ifdef ENABLE_MPI
 
-// Not performance optimized: could be slow. It is meant for init.
-void MuellerPlatheFlow::initMPISwap(struct MPI_SWAP* ms, const int color)
-    {
-    if (ms->initialized && ms->rank != MPI_UNDEFINED)
-        MPI_Comm_free(&(ms->comm));
-
-    MPI_Comm_split(m_exec_conf->getMPICommunicator(), color, m_exec_conf->getRank(), &(ms->comm));
-    if (color != MPI_UNDEFINED)
-        {
-        MPI_Comm_rank(ms->comm, &(ms->rank));
-        MPI_Comm_size(ms->comm, &(ms->size));
-        }
-    else
-        {
-        ms->rank = MPI_UNDEFINED;
-        ms->size = MPI_UNDEFINED;
-        }
-    int send = 0;
-    if (ms->rank == 0)
-        {
-        send = 1;
-        }
-    vector<int> recv;
-    all_gather_v(send, recv, m_exec_conf->getMPICommunicator());
-
-    // ARG_MAX;
-    ms->gbl_rank = -1;
-    for (unsigned int i = 0; i < recv.size(); i++)
-        {
-        if (recv[i] == 1)
-            {
-            assert(ms->gbl_rank == -1);
-            ms->gbl_rank = i;
-            }
-        }
-    assert(ms->gbl_rank > -1);
-    ms->initialized = true;
-    }
-
-void MuellerPlatheFlow::bcastVelToAll(struct MPI_SWAP* ms, Scalar3* vel, const MPI_Op op)
-    {
-    if (ms->rank != MPI_UNDEFINED)
-        {
-        Scalar_Int tmp;
-        tmp.s = vel->x;
-        tmp.i = ms->rank;
-        MPI_Allreduce(MPI_IN_PLACE, &tmp, 1, MPI_HOOMD_SCALAR_INT, op, ms->comm);
-        // Send to subset local rank
-        if (tmp.i != 0)
-            {
-            if (ms->rank == 0)
-                {
-                recv(vel->x, tmp.i, ms->comm);
-                recv(vel->y, tmp.i, ms->comm);
-                recv(vel->z, tmp.i, ms->comm);
-                }
-            if (ms->rank == tmp.i)
-                {
-                send(vel->x, 0, ms->comm);
-                send(vel->y, 0, ms->comm);
-                send(vel->z, 0, ms->comm);
-                }
-            }
-        // ms->rank == 0 has the definite answer
-        }
-    // Broadcast the result to every rank.
-    // This way, each rank can check, whether
-    // it needs to update and can determine the exchanged momentum.
-    bcast(vel->x, ms->gbl_rank, m_exec_conf->getMPICommunicator());
-    bcast(vel->y, ms->gbl_rank, m_exec_conf->getMPICommunicator());
-    bcast(vel->z, ms->gbl_rank, m_exec_conf->getMPICommunicator());
-    }
-
+/*! The candidates carry the tag, so every rank learns the momentum, mass and tag of the selected
+    particles from one allreduce and can update them without further communication.
+*/
 void MuellerPlatheFlow::mpiExchangeVelocity(void)
     {
-#ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        bcastVelToAll(&m_min_swap, &m_last_min_vel, MPI_MINLOC);
-        bcastVelToAll(&m_max_swap, &m_last_max_vel, MPI_MAXLOC);
+        Scalar3 vel_pair[2] = {m_last_max_vel, m_last_min_vel};
+        MPI_Allreduce(MPI_IN_PLACE,
+                      vel_pair,
+                      1,
+                      m_mpi_vel_pair,
+                      m_mpi_vel_pair_op,
+                      m_exec_conf->getMPICommunicator());
+        m_last_max_vel = vel_pair[0];
+        m_last_min_vel = vel_pair[1];
         }
-#endif // ENABLE_MPI
     }
 
 #endif // ENABLE_MPI
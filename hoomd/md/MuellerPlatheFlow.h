@@ -207,23 +207,11 @@ class PYBIND11_EXPORT MuellerPlatheFlow : public Updater
     //! Returns if box is orthorhombic, but throws a runtime_error, if the box is not orthorhombic.
     void verifyOrthorhombicBox(void);
 #ifdef ENABLE_MPI
-    struct MPI_SWAP
-        {
-        MPI_Comm comm;
-        int rank;
-        int size;
-        int gbl_rank;     //!< global rank of zero in the comm.
-        bool initialized; //!< initialized struct, manually set.
-        MPI_SWAP()
-            : comm(MPI_COMM_NULL), rank(MPI_UNDEFINED), size(MPI_UNDEFINED),
-              gbl_rank(MPI_UNDEFINED), initialized(false)
-            {
-            }
-        };
-    struct MPI_SWAP m_min_swap;
-    struct MPI_SWAP m_max_swap;
-    void initMPISwap(struct MPI_SWAP* ms, const int color);
-    void bcastVelToAll(struct MPI_SWAP* ms, Scalar3* vel, const MPI_Op op);
+    //! MPI type of the (max, min) candidate pair
+    MPI_Datatype m_mpi_vel_pair;
+    //! MPI operation that selects the global max and min candidates
+    MPI_Op m_mpi_vel_pair_op;
+    //! Reduce the max and min candidates of all ranks in a single allreduce
     void mpiExchangeVelocity(void);
 #endif // ENABLE_MPI
     };
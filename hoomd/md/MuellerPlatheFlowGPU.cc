@@ -75,9 +75,6 @@ void MuellerPlatheFlowGPU::searchMinMaxVelocity(void)
     const ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
                                           access_location::device,
                                           access_mode::read);
-    const ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
-                                           access_location::device,
-                                           access_mode::read);
     const GPUArray<unsigned int>& group_members = m_group->getIndexArray();
     const ArrayHandle<unsigned int> d_group_members(group_members,
                                                     access_location::device,
@@ -90,7 +87,6 @@ void MuellerPlatheFlowGPU::searchMinMaxVelocity(void)
                                         d_vel.data,
                                         d_pos.data,
                                         d_tag.data,
-                                        d_rtag.data,
                                         d_group_members.data,
                                         gl_box,
                                         this->getNSlabs(),
@@ -23,20 +23,71 @@ namespace md
     {
 namespace kernel
     {
-struct vel_search_un_opt : public thrust::unary_function<const unsigned int, Scalar3>
+//! Max and min velocity candidates, x: momentum y: mass z: tag as scalar.
+struct vel_search_pair
+    {
+    Scalar3 max_vel;
+    Scalar3 min_vel;
+    };
+
+//! Map a group member to its candidates for the max and min slab
+struct vel_search_un_opt : public thrust::unary_function<const unsigned int, vel_search_pair>
     {
     vel_search_un_opt(const Scalar4* const d_vel,
+                      const Scalar4* const d_pos,
                       const unsigned int* const d_tag,
-                      flow_enum::Direction flow_direction)
-        : m_vel(d_vel), m_tag(d_tag), m_flow_direction(flow_direction)
+                      const BoxDim gl_box,
+                      const unsigned int Nslabs,
+                      const unsigned int max_slab,
+                      const unsigned int min_slab,
+                      const vel_search_pair invalid,
+                      const bool has_max_slab,
+                      const bool has_min_slab,
+                      const flow_enum::Direction flow_direction,
+                      const flow_enum::Direction slab_direction)
+        : m_vel(d_vel), m_pos(d_pos), m_tag(d_tag), m_gl_box(gl_box), m_Nslabs(Nslabs),
+          m_max_slab(max_slab), m_min_slab(min_slab), m_invalid(invalid),
+          m_has_max_slab(has_max_slab), m_has_min_slab(has_min_slab),
+          m_flow_direction(flow_direction), m_slab_direction(slab_direction)
         {
         }
     const Scalar4* const m_vel;
+    const Scalar4* const m_pos;
     const unsigned int* const m_tag;
+    const BoxDim m_gl_box;
+    const unsigned int m_Nslabs;
+    const unsigned int m_max_slab;
+    const unsigned int m_min_slab;
+    const vel_search_pair m_invalid;
+    const bool m_has_max_slab;
+    const bool m_has_min_slab;
     const flow_enum::Direction m_flow_direction;
-    __host__ __device__ Scalar3 operator()(const unsigned int idx) const
+    const flow_enum::Direction m_slab_direction;
+
+    __host__ __device__ vel_search_pair operator()(const unsigned int idx) const
         {
-        const unsigned int tag = m_tag[idx];
+        vel_search_pair result = m_invalid;
+
+        unsigned int index;
+        switch (m_slab_direction)
+            {
+        case flow_enum::X:
+            index = (m_pos[idx].x / m_gl_box.getL().x + .5) * m_Nslabs;
+            break;
+        case flow_enum::Y:
+            index = (m_pos[idx].y / m_gl_box.getL().y + .5) * m_Nslabs;
+            break;
+        case flow_enum::Z:
+            index = (m_pos[idx].z / m_gl_box.getL().z + .5) * m_Nslabs;
+            break;
+            }
+        index %= m_Nslabs;
+
+        const bool in_max_slab = m_has_max_slab && index == m_max_slab;
+        const bool in_min_slab = m_has_min_slab && index == m_min_slab;
+        if (!in_max_slab && !in_min_slab)
+            return result;
+
         Scalar vel;
         switch (m_flow_direction)
             {
@@ -51,94 +102,49 @@ struct vel_search_un_opt : public thrust::unary_function<const unsigned int, Sca
             break;
             }
         const Scalar mass = m_vel[idx].w;
-        vel *= mass;
-        Scalar3 result;
-        result.x = vel;
-        result.y = mass;
-        result.z = __int_as_scalar(tag);
+        Scalar3 candidate;
+        candidate.x = vel * mass;
+        candidate.y = mass;
+        candidate.z = __int_as_scalar(m_tag[idx]);
+
+        if (in_max_slab)
+            result.max_vel = candidate;
+        if (in_min_slab)
+            result.min_vel = candidate;
         return result;
         }
     };
-template<typename CMP>
-struct vel_search_binary_opt : public thrust::binary_function<Scalar3, Scalar3, Scalar3>
+
+//! Select the larger max and the smaller min candidate, breaking ties by the smaller tag
+struct vel_search_binary_opt
+    : public thrust::binary_function<vel_search_pair, vel_search_pair, vel_search_pair>
     {
-    vel_search_binary_opt(const unsigned int* const d_rtag,
-                          const Scalar4* const d_pos,
-                          const BoxDim gl_box,
-                          const unsigned int Nslabs,
-                          const unsigned int slab_index,
-                          const Scalar3 invalid,
-                          const flow_enum::Direction slab_direction)
-        : m_rtag(d_rtag), m_pos(d_pos), m_gl_box(gl_box), m_Nslabs(Nslabs),
-          m_slab_index(slab_index), m_invalid(invalid), m_slab_direction(slab_direction)
+    __host__ __device__ static bool prefer(const Scalar3& a, const Scalar3& b, bool larger)
         {
+        if (a.x != b.x)
+            return larger ? a.x > b.x : a.x < b.x;
+        return static_cast<unsigned int>(__scalar_as_int(a.z))
+               < static_cast<unsigned int>(__scalar_as_int(b.z));
         }
-    const unsigned int* const m_rtag;
-    const Scalar4* const m_pos;
-    const BoxDim m_gl_box;
-    const unsigned int m_Nslabs;
-    const unsigned int m_slab_index;
-    const Scalar3 m_invalid;
-    const flow_enum::Direction m_slab_direction;
 
-    __host__ __device__ Scalar3 operator()(const Scalar3& a, const Scalar3& b) const
+    __host__ __device__ vel_search_pair operator()(const vel_search_pair& a,
+                                                   const vel_search_pair& b) const
         {
-        Scalar3 result = m_invalid;
-        // Early exit, if invalid args involved.
-        if (a.z == m_invalid.z)
-            return b;
-        if (b.z == m_invalid.z)
-            return a;
-
-        const unsigned int idx_a = m_rtag[__scalar_as_int(a.z)];
-        const unsigned int idx_b = m_rtag[__scalar_as_int(b.z)];
-
-        unsigned int index_a, index_b;
-        switch (m_slab_direction)
-            {
-        case flow_enum::X:
-            index_a = (m_pos[idx_a].x / m_gl_box.getL().x + .5) * m_Nslabs;
-            index_b = (m_pos[idx_b].x / m_gl_box.getL().x + .5) * m_Nslabs;
-            break;
-        case flow_enum::Y:
-            index_a = (m_pos[idx_a].y / m_gl_box.getL().y + .5) * m_Nslabs;
-            index_b = (m_pos[idx_b].y / m_gl_box.getL().y + .5) * m_Nslabs;
-            break;
-        case flow_enum::Z:
-            index_a = (m_pos[idx_a].z / m_gl_box.getL().z + .5) * m_Nslabs;
-            index_b = (m_pos[idx_b].z / m_gl_box.getL().z + .5) * m_Nslabs;
-            break;
-            }
-        index_a %= m_Nslabs;
-        index_b %= m_Nslabs;
-
-        if (index_a == index_b)
-            {
-            if (index_a == m_slab_index)
-                {
-                CMP cmp;
-                if (cmp(a.x, b.x))
-                    result = a;
-                else
-                    result = b;
-                }
-            }
-        else
-            {
-            if (index_a == m_slab_index)
-                result = a;
-            if (index_b == m_slab_index)
-                result = b;
-            }
+        vel_search_pair result;
+        result.max_vel = prefer(a.max_vel, b.max_vel, true) ? a.max_vel : b.max_vel;
+        result.min_vel = prefer(a.min_vel, b.min_vel, false) ? a.min_vel : b.min_vel;
         return result;
         }
     };
 
+/*! Both slabs are searched in one reduction. The candidates are computed once per particle in the
+    transform, so the reduction only compares values and does not gather positions through the
+    reverse tags.
+*/
 hipError_t gpu_search_min_max_velocity(const unsigned int group_size,
                                        const Scalar4* const d_vel,
                                        const Scalar4* const d_pos,
                                        const unsigned int* const d_tag,
-                                       const unsigned int* const d_rtag,
                                        const unsigned int* const d_group_members,
                                        const BoxDim gl_box,
                                        const unsigned int Nslabs,
@@ -154,31 +160,30 @@ hipError_t gpu_search_min_max_velocity(const unsigned int group_size,
     {
     thrust::device_ptr<const unsigned int> member_ptr(d_group_members);
 
-    vel_search_un_opt un_opt(d_vel, d_tag, flow_direction);
+    vel_search_pair init;
+    init.max_vel = *last_max_vel;
+    init.min_vel = *last_min_vel;
 
-    if (has_max_slab)
-        {
-        vel_search_binary_opt<thrust::greater<const Scalar>>
-            max_bin_opt(d_rtag, d_pos, gl_box, Nslabs, max_slab, *last_max_vel, slab_direction);
-        Scalar3 init = *last_max_vel;
-        *last_max_vel = thrust::transform_reduce(member_ptr,
-                                                 member_ptr + group_size,
-                                                 un_opt,
-                                                 init,
-                                                 max_bin_opt);
-        }
+    vel_search_un_opt un_opt(d_vel,
+                             d_pos,
+                             d_tag,
+                             gl_box,
+                             Nslabs,
+                             max_slab,
+                             min_slab,
+                             init,
+                             has_max_slab,
+                             has_min_slab,
+                             flow_direction,
+                             slab_direction);
 
-    if (has_min_slab)
-        {
-        vel_search_binary_opt<thrust::less<const Scalar>>
-            min_bin_opt(d_rtag, d_pos, gl_box, Nslabs, min_slab, *last_min_vel, slab_direction);
-        Scalar3 init = *last_min_vel;
-        *last_min_vel = thrust::transform_reduce(member_ptr,
-                                                 member_ptr + group_size,
-                                                 un_opt,
-                                                 init,
-                                                 min_bin_opt);
-        }
+    vel_search_pair result = thrust::transform_reduce(member_ptr,
+                                                      member_ptr + group_size,
+                                                      un_opt,
+                                                      init,
+                                                      vel_search_binary_opt());
+    *last_max_vel = result.max_vel;
+    *last_min_vel = result.min_vel;
 
     return hipPeekAtLastError();
     }
@@ -22,7 +22,6 @@ hipError_t gpu_search_min_max_velocity(const unsigned int group_size,
                                        const Scalar4* const d_vel,
                                        const Scalar4* const d_pos,
                                        const unsigned int* const d_tag,
-                                       const unsigned int* const d_rtag,
                                        const unsigned int* const d_group_members,
                                        const BoxDim gl_box,
                                        const unsigned int Nslabs,
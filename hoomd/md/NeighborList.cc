@@ -6,10 +6,20 @@
 #endif
 
 #include "NeighborList.h"
+#include "NeighborListCluster.h"
+#include "NeighborListCompression.h"
 #include "hoomd/BondedGroupData.h"
 
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <unordered_map>
 
 using namespace std;
 
@@ -33,7 +43,9 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
     : Compute(sysdef), m_typpair_idx(m_pdata->getNTypes()), m_rcut_max_max(0.0), m_rcut_min(0.0),
       m_r_buff(r_buff), m_filter_body(false), m_storage_mode(half), m_meshbond_data(NULL),
       m_rcut_changed(true), m_updates(0), m_forced_updates(0), m_dangerous_updates(0),
-      m_force_update(true), m_dist_check(true), m_has_been_updated_once(false)
+      m_force_update(true), m_dist_check(true), m_has_been_updated_once(false),
+      m_buffer_tuning(false), m_tune_period(0), m_tune_sampled(false), m_tune_last_build_start(0),
+      m_tune_last_build_time(0), m_tune_build_time(0.0), m_tune_step_time(0.0)
     {
     m_exec_conf->msg->notice(5) << "Constructing Neighborlist" << endl;
 
@@ -52,8 +64,8 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
 
     m_n_particles_changed = false;
 
-    // initialize box length at last update
-    m_last_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
+    // initialize box at last update
+    m_last_box = m_pdata->getGlobalBox();
     m_last_L_local = m_pdata->getBox().getNearestPlaneDistance();
 
     // allocate r_cut pairwise storage
@@ -68,6 +80,27 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
     GPUArray<Scalar> rcut_base(m_typpair_idx.getNumElements(), m_exec_conf);
     m_rcut_base.swap(rcut_base);
 
+    // the cutoffs passed to the builders account for the per type buffers
+    GPUArray<Scalar> r_cut_build(m_typpair_idx.getNumElements(), m_exec_conf);
+    m_r_cut_build.swap(r_cut_build);
+
+    // every type starts with the full buffer
+    GPUArray<Scalar> r_buff_type(m_pdata->getNTypes(), m_exec_conf);
+    m_r_buff_type.swap(r_buff_type);
+        {
+        ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            h_r_buff_type.data[i] = m_r_buff;
+            }
+        }
+
+    m_tune_rate.resize(m_pdata->getNTypes(), 0.0);
+    m_tune_sample.resize(m_pdata->getNTypes(), 0.0);
+    m_tune_count.resize(m_pdata->getNTypes(), 0.0);
+
     // allocate the r_listsq array which accelerates CPU calculations
     GPUArray<Scalar> r_listsq(m_typpair_idx.getNumElements(), m_exec_conf);
     m_r_listsq.swap(r_listsq);
@@ -187,8 +220,8 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
         m_comm->getMigrateSignal().connect<NeighborList, &NeighborList::peekUpdate>(this);
         m_comm->getCommFlagsRequestSignal()
             .connect<NeighborList, &NeighborList::getRequestedCommFlags>(this);
-        m_comm->getGhostLayerWidthRequestSignal()
-            .connect<NeighborList, &NeighborList::getGhostLayerWidth>(this);
+        m_comm->getGhostLayerPairWidthRequestSignal()
+            .connect<NeighborList, &NeighborList::getGhostLayerPairWidth>(this);
         }
 #endif
     }
@@ -261,8 +294,8 @@ NeighborList::~NeighborList()
         m_comm->getMigrateSignal().disconnect<NeighborList, &NeighborList::peekUpdate>(this);
         m_comm->getCommFlagsRequestSignal()
             .disconnect<NeighborList, &NeighborList::getRequestedCommFlags>(this);
-        m_comm->getGhostLayerWidthRequestSignal()
-            .disconnect<NeighborList, &NeighborList::getGhostLayerWidth>(this);
+        m_comm->getGhostLayerPairWidthRequestSignal()
+            .disconnect<NeighborList, &NeighborList::getGhostLayerPairWidth>(this);
         }
 #endif
 
@@ -275,6 +308,8 @@ NeighborList::~NeighborList()
 void NeighborList::compute(uint64_t timestep)
     {
     Compute::compute(timestep);
+    MemoryTracker::Scope memory(m_exec_conf->getMemoryTracker(), m_memory_tag);
+
     // check if the rcut array has changed and update it
     if (m_rcut_changed)
         {
@@ -317,9 +352,40 @@ void NeighborList::compute(uint64_t timestep)
     // check if the list needs to be updated and update it
     if (needsUpdating(timestep))
         {
+        // the profile timer of a neighbor list measures the time spent building the list
+        ProfileScope profile(m_sysdef->getProfiler(), m_profile_timer);
+
         // check simulation box size is OK
         checkBoxSize();
 
+        if (m_incremental && m_distance_triggered && tryIncrementalBuild(timestep))
+            {
+            // the patched rows are no longer ordered by tier
+            m_tiers_valid = false;
+
+            if (m_compress_indices)
+                compressNlist();
+
+            if (m_cluster_pairs)
+                buildClusterPairs();
+
+            return;
+            }
+
+        int64_t build_start = 0;
+        if (m_buffer_tuning)
+            {
+#ifdef ENABLE_HIP
+            if (m_exec_conf->isCUDAEnabled())
+                hipDeviceSynchronize();
+#endif
+            build_start = m_tune_clock.getTime();
+
+            // the new buffers must be in place before the build that relies on them
+            if (m_tune_sampled)
+                tuneBuffers(build_start);
+            }
+
         // rebuild the list until there is no overflow
         bool overflowed = false;
         do
@@ -338,11 +404,35 @@ void NeighborList::compute(uint64_t timestep)
                 }
             } while (overflowed);
 
-        if (m_exclusions_set)
+        if (m_exclusions_set && !m_exclusions_in_build)
             filterNlist();
 
+        m_tiers_valid = false;
+        if (m_tier_r_cut.size() > 1)
+            {
+            sortTiers();
+            m_tiers_valid = true;
+            }
+
+        if (m_compress_indices)
+            compressNlist();
+
+        if (m_cluster_pairs)
+            buildClusterPairs();
+
         setLastUpdatedPos();
         m_has_been_updated_once = true;
+        m_incremental_moved = 0;
+
+        if (m_buffer_tuning)
+            {
+#ifdef ENABLE_HIP
+            if (m_exec_conf->isCUDAEnabled())
+                hipDeviceSynchronize();
+#endif
+            m_tune_last_build_start = build_start;
+            m_tune_last_build_time = m_tune_clock.getTime() - build_start;
+            }
         }
     }
 
@@ -361,6 +451,46 @@ void NeighborList::setRBuff(Scalar r_buff)
     forceUpdate();
     }
 
+/*! \param buffer_tuning Set to true to tune the buffer width of each type
+
+    The buffer tuner starts from the full buffer radius on every type.
+*/
+void NeighborList::setBufferTuning(bool buffer_tuning)
+    {
+    if (buffer_tuning && !m_buffer_tuning)
+        {
+        ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            h_r_buff_type.data[i] = m_r_buff;
+            }
+        std::fill(m_tune_rate.begin(), m_tune_rate.end(), 0.0);
+        m_tune_sampled = false;
+        m_tune_last_build_time = 0;
+        m_tune_build_time = 0.0;
+        m_tune_step_time = 0.0;
+        }
+    m_buffer_tuning = buffer_tuning;
+    notifyRCutMatrixChange();
+    forceUpdate();
+    }
+
+pybind11::dict NeighborList::getTypeBufferPython()
+    {
+    if (m_rcut_changed)
+        updateRList();
+
+    ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type, access_location::host, access_mode::read);
+    pybind11::dict type_buffer;
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        type_buffer[m_pdata->getNameByType(i).c_str()] = h_r_buff_type.data[i];
+        }
+    return type_buffer;
+    }
+
 void NeighborList::updateRList()
     {
     // overwrite the new r_cut matrix
@@ -399,6 +529,18 @@ void NeighborList::updateRList()
     // now, update the r_list which includes r_buff we need to read and write on the r_list
     ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::overwrite);
 
+    ArrayHandle<Scalar> h_r_cut_build(m_r_cut_build,
+                                      access_location::host,
+                                      access_mode::overwrite);
+
+    // the type buffers never exceed r_buff, which sets the ghost layer and cell widths
+    ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type, access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        if (!m_buffer_tuning || h_r_buff_type.data[i] > m_r_buff)
+            h_r_buff_type.data[i] = m_r_buff;
+        }
+
     // update the maximum cutoff of all those set so far
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::readwrite);
 
@@ -414,8 +556,18 @@ void NeighborList::updateRList()
                 r_cut_max_i = r_cut_ij;
 
             // precompute rlistsq while we're at it
-            Scalar r_list = (r_cut_ij > Scalar(0.0)) ? r_cut_ij + m_r_buff : Scalar(0.0);
+            const Scalar r_buff_ij
+                = (h_r_buff_type.data[i] + h_r_buff_type.data[j]) / Scalar(2.0);
+            Scalar r_list = (r_cut_ij > Scalar(0.0)) ? r_cut_ij + r_buff_ij : Scalar(0.0);
             h_r_listsq.data[m_typpair_idx(i, j)] = r_list * r_list;
+
+            // the builders add r_buff back, keep active pairs positive
+            Scalar r_cut_build = Scalar(0.0);
+            if (r_cut_ij > Scalar(0.0))
+                {
+                r_cut_build = std::max(r_list - m_r_buff, std::numeric_limits<Scalar>::min());
+                }
+            h_r_cut_build.data[m_typpair_idx(i, j)] = r_cut_build;
             }
         h_rcut_max.data[i] = r_cut_max_i;
         if (r_cut_max_i > r_cut_max)
@@ -436,10 +588,126 @@ void NeighborList::updateRList()
         }
     m_rcut_min = r_cut_min;
 
+    // order the consumers by their largest cutoff to form the tiers
+    std::vector<std::pair<Scalar, std::shared_ptr<GPUArray<Scalar>>>> tiers;
+    if (m_consumer_r_cut.size() > 1)
+        {
+        for (const auto& consumer_r_cut : m_consumer_r_cut)
+            {
+            ArrayHandle<Scalar> h_consumer_r_cut(*consumer_r_cut,
+                                                 access_location::host,
+                                                 access_mode::read);
+            Scalar consumer_r_cut_max = 0.0;
+            for (unsigned int cur_pair = 0; cur_pair < m_typpair_idx.getNumElements(); ++cur_pair)
+                {
+                consumer_r_cut_max = std::max(consumer_r_cut_max, h_consumer_r_cut.data[cur_pair]);
+                }
+            tiers.emplace_back(consumer_r_cut_max, consumer_r_cut);
+            }
+        std::stable_sort(tiers.begin(),
+                         tiers.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        }
+
+    const unsigned int n_pairs = m_typpair_idx.getNumElements();
+    m_tier_r_cut.clear();
+    m_tier_n_neigh.resize(tiers.size());
+    if (m_r_tiersq.getNumElements() < tiers.size() * n_pairs)
+        {
+        GPUArray<Scalar> r_tiersq(tiers.size() * n_pairs, m_exec_conf);
+        m_r_tiersq.swap(r_tiersq);
+        }
+
+    ArrayHandle<Scalar> h_r_tiersq(m_r_tiersq, access_location::host, access_mode::readwrite);
+    for (unsigned int tier = 0; tier < tiers.size(); tier++)
+        {
+        m_tier_r_cut.push_back(tiers[tier].second);
+        if (!m_tier_n_neigh[tier])
+            {
+            m_tier_n_neigh[tier] = std::make_shared<GPUArray<unsigned int>>();
+            }
+
+        ArrayHandle<Scalar> h_consumer_r_cut(*tiers[tier].second,
+                                             access_location::host,
+                                             access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            for (unsigned int j = 0; j < m_pdata->getNTypes(); ++j)
+                {
+                const Scalar r_cut_ij = h_consumer_r_cut.data[m_typpair_idx(i, j)];
+                const Scalar r_buff_ij
+                    = (h_r_buff_type.data[i] + h_r_buff_type.data[j]) / Scalar(2.0);
+                const Scalar r_tier = r_cut_ij + r_buff_ij;
+                h_r_tiersq.data[tier * n_pairs + m_typpair_idx(i, j)]
+                    = (r_cut_ij > Scalar(0.0)) ? r_tier * r_tier : Scalar(-1.0);
+                }
+            }
+        }
+
     // rcut has been updated to the latest values now
     m_rcut_changed = false;
     }
 
+void NeighborList::sortTiers()
+    {
+    for (unsigned int tier = 0; tier < m_tier_r_cut.size(); tier++)
+        {
+        if (m_tier_n_neigh[tier]->getNumElements() < m_pdata->getMaxN())
+            {
+            GPUArray<unsigned int> tier_n_neigh(m_pdata->getMaxN(), m_exec_conf);
+            m_tier_n_neigh[tier]->swap(tier_n_neigh);
+            }
+
+        partitionTier(tier);
+        }
+    }
+
+void NeighborList::partitionTier(unsigned int tier)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_r_tiersq(m_r_tiersq, access_location::host, access_mode::read);
+
+    // a null array reads as 0 neighbors in the tiers before the first
+    GPUArray<unsigned int> no_tier;
+    ArrayHandle<unsigned int> h_tier_begin(tier > 0 ? *m_tier_n_neigh[tier - 1] : no_tier,
+                                           access_location::host,
+                                           access_mode::read);
+    ArrayHandle<unsigned int> h_tier_end(*m_tier_n_neigh[tier],
+                                         access_location::host,
+                                         access_mode::overwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar* r_tiersq = h_r_tiersq.data + tier * m_typpair_idx.getNumElements();
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        const Scalar3 pos_i = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+        unsigned int* row = h_nlist.data + h_head_list.data[i];
+
+        // swap the neighbors within the tier to the front
+        unsigned int end = h_tier_begin.data ? h_tier_begin.data[i] : 0;
+        for (unsigned int k = end; k < h_n_neigh.data[i]; k++)
+            {
+            const unsigned int j = row[k];
+            const Scalar3 pos_j = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            const Scalar3 dx = box.minImage(pos_i - pos_j);
+            const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+
+            if (dot(dx, dx) <= r_tiersq[m_typpair_idx(type_i, type_j)])
+                {
+                std::swap(row[end], row[k]);
+                end++;
+                }
+            }
+
+        h_tier_end.data[i] = end;
+        }
+    }
+
 /*!
  * Check that the largest neighbor search radius is not bigger than twice the shortest box size.
  * Raises an error if this condition is not met. Otherwise, nothing happens.
@@ -1128,6 +1396,10 @@ void NeighborList::addOneFourExclusionsFromTopology()
 
     Note: this method relies on data set by setLastUpdatedPos(), which must be called to set the
    previous data used in the next call to distanceCheck();
+
+    The displacements are measured relative to the last positions mapped affinely into the current
+   box, so box resizes (including tilt changes) only consume the buffer by the contraction of the
+   pair distances.
 */
 bool NeighborList::distanceCheck(uint64_t timestep)
     {
@@ -1141,17 +1413,14 @@ bool NeighborList::distanceCheck(uint64_t timestep)
 
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getBox();
+    const BoxDim& global_box = m_pdata->getGlobalBox();
 
-    // get current nearest plane distances
-    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
-
-    // Find direction of maximum box length contraction (smallest eigenvalue of deformation tensor)
-    Scalar3 lambda = L_g / m_last_L;
-    Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
-    lambda_min = (lambda_min < lambda.z) ? lambda_min : (Scalar)lambda.z;
+    // the largest contraction of any pair distance since the last update
+    const Scalar lambda_min = getMinStretch();
 
     ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type, access_location::host, access_mode::read);
 
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         {
@@ -1161,15 +1430,16 @@ bool NeighborList::distanceCheck(uint64_t timestep)
         Scalar old_rmin = h_rcut_max.data[type_i];
 
         // maximum value we have checked for neighbors, defined by the buffer layer
-        Scalar rmax = old_rmin + m_r_buff;
+        Scalar rmax = old_rmin + h_r_buff_type.data[type_i];
 
         // max displacement for each particle (after subtraction of homogeneous dilations)
         const Scalar delta_max = (rmax * lambda_min - old_rmin) / Scalar(2.0);
         Scalar maxsq = (delta_max > 0) ? delta_max * delta_max : 0;
 
-        Scalar3 dx = make_scalar3(h_pos.data[i].x - lambda.x * h_last_pos.data[i].x,
-                                  h_pos.data[i].y - lambda.y * h_last_pos.data[i].y,
-                                  h_pos.data[i].z - lambda.z * h_last_pos.data[i].z);
+        const Scalar3 last_pos
+            = make_scalar3(h_last_pos.data[i].x, h_last_pos.data[i].y, h_last_pos.data[i].z);
+        Scalar3 dx = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z)
+                     - global_box.makeCoordinates(m_last_box.makeFraction(last_pos));
 
         dx = box.minImage(dx);
 
@@ -1217,11 +1487,347 @@ void NeighborList::setLastUpdatedPos()
             = make_scalar4(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z, Scalar(0.0));
         }
 
-    // update last box nearest plane distance
-    m_last_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
+    // update last box
+    m_last_box = m_pdata->getGlobalBox();
     m_last_L_local = m_pdata->getBox().getNearestPlaneDistance();
     }
 
+/*! \returns The smallest factor by which the affine deformation of the global box since the last
+    update scales any vector.
+
+    All pair distances in the list shrink by at most this factor when the box is resized. It is the
+    smallest singular value of the deformation gradient F that maps the last box onto the current
+    one, which reduces to the smallest ratio of the box lengths for orthorhombic boxes.
+*/
+Scalar NeighborList::getMinStretch() const
+    {
+    const BoxDim& box = m_pdata->getGlobalBox();
+    const auto deform = [&](const Scalar3& v)
+    { return box.makeCoordinates(m_last_box.makeFraction(v)); };
+
+    // columns of F
+    const Scalar3 origin = deform(make_scalar3(0, 0, 0));
+    const Scalar3 f[3] = {deform(make_scalar3(1, 0, 0)) - origin,
+                          deform(make_scalar3(0, 1, 0)) - origin,
+                          deform(make_scalar3(0, 0, 1)) - origin};
+
+    // smallest eigenvalue of the symmetric matrix C = F^T F
+    double c[3][3];
+    for (unsigned int i = 0; i < 3; i++)
+        for (unsigned int j = 0; j < 3; j++)
+            c[i][j] = double(dot(f[i], f[j]));
+
+    double c_min;
+    if (m_sysdef->getNDimensions() == 2)
+        {
+        const double mean = 0.5 * (c[0][0] + c[1][1]);
+        const double half_difference = 0.5 * (c[0][0] - c[1][1]);
+        c_min = mean - std::sqrt(half_difference * half_difference + c[0][1] * c[0][1]);
+        }
+    else
+        {
+        const double off_diagonal = c[0][1] * c[0][1] + c[0][2] * c[0][2] + c[1][2] * c[1][2];
+        if (off_diagonal == 0.0)
+            {
+            c_min = std::min(c[0][0], std::min(c[1][1], c[2][2]));
+            }
+        else
+            {
+            // closed form eigenvalues of a symmetric 3x3 matrix
+            const double q = (c[0][0] + c[1][1] + c[2][2]) / 3.0;
+            const double p2 = (c[0][0] - q) * (c[0][0] - q) + (c[1][1] - q) * (c[1][1] - q)
+                              + (c[2][2] - q) * (c[2][2] - q) + 2.0 * off_diagonal;
+            const double p = std::sqrt(p2 / 6.0);
+
+            double b[3][3];
+            for (unsigned int i = 0; i < 3; i++)
+                for (unsigned int j = 0; j < 3; j++)
+                    b[i][j] = (c[i][j] - (i == j ? q : 0.0)) / p;
+
+            const double det_b = b[0][0] * (b[1][1] * b[2][2] - b[1][2] * b[2][1])
+                                 - b[0][1] * (b[1][0] * b[2][2] - b[1][2] * b[2][0])
+                                 + b[0][2] * (b[1][0] * b[2][1] - b[1][1] * b[2][0]);
+            const double r = std::max(-1.0, std::min(1.0, det_b / 2.0));
+            const double phi = std::acos(r) / 3.0;
+            c_min = q + 2.0 * p * std::cos(phi + 2.0 * M_PI / 3.0);
+            }
+        }
+
+    return Scalar(std::sqrt(std::max(c_min, 0.0)));
+    }
+
+/*! \param timestep Current time step
+
+    Records the maximum displacement of each particle type since the last build and the number of
+    particles of each type. Only checks that trigger a rebuild are sampled, so the max
+    displacement of the fastest type is close to half of its buffer.
+*/
+void NeighborList::sampleDisplacements(uint64_t timestep)
+    {
+    m_tune_sampled = false;
+    if (!m_has_been_updated_once || timestep <= m_last_updated_tstep)
+        return;
+
+    m_tune_period = timestep - m_last_updated_tstep;
+
+    const unsigned int n_types = m_pdata->getNTypes();
+    std::vector<double> max_dsq(n_types, 0.0);
+    std::fill(m_tune_count.begin(), m_tune_count.end(), 0.0);
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
+
+        const BoxDim& box = m_pdata->getBox();
+        const BoxDim& global_box = m_pdata->getGlobalBox();
+
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const Scalar3 last_pos
+                = make_scalar3(h_last_pos.data[i].x, h_last_pos.data[i].y, h_last_pos.data[i].z);
+            Scalar3 dx = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z)
+                         - global_box.makeCoordinates(m_last_box.makeFraction(last_pos));
+            dx = box.minImage(dx);
+
+            max_dsq[type_i] = std::max(max_dsq[type_i], double(dot(dx, dx)));
+            m_tune_count[type_i] += 1.0;
+            }
+        }
+
+    for (unsigned int i = 0; i < n_types; i++)
+        {
+        m_tune_sample[i] = std::sqrt(max_dsq[i]);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      m_tune_sample.data(),
+                      n_types,
+                      MPI_DOUBLE,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      m_tune_count.data(),
+                      n_types,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    m_tune_sampled = true;
+    }
+
+/*! \param build_start Wall time at the start of the upcoming build
+
+    The tuner predicts that the max displacement of type i grows linearly with the rate measured
+    by sampleDisplacements(). For a target period T between builds, it gives each type the buffer
+    that the type needs to last T steps. The types that reach their limit set the actual period.
+    The cost of T is the build time amortized over the actual period plus the time of a step
+    without a build, scaled by the volume of the neighbor shells of all type pairs relative to the
+    current buffers. The tuner selects the buffers of the T with the lowest cost.
+
+    All ranks reduce the same measurements, so they all select the same buffers.
+*/
+void NeighborList::tuneBuffers(int64_t build_start)
+    {
+    m_tune_sampled = false;
+    const unsigned int n_types = m_pdata->getNTypes();
+
+    // rising rates are adopted immediately so that the next build is not premature
+    const double alpha = 0.25;
+    for (unsigned int i = 0; i < n_types; i++)
+        {
+        const double rate = m_tune_sample[i] / double(m_tune_period);
+        m_tune_rate[i] = std::max(rate, (1.0 - alpha) * m_tune_rate[i] + alpha * rate);
+        }
+
+    // the timing needs a complete period since the last build
+    if (m_tune_last_build_time == 0)
+        return;
+
+    double times[2];
+    times[0] = double(m_tune_last_build_time) * 1e-9;
+    times[1] = double(build_start - m_tune_last_build_start - m_tune_last_build_time) * 1e-9
+               / double(m_tune_period);
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      times,
+                      2,
+                      MPI_DOUBLE,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    if (times[1] <= 0.0)
+        return;
+
+    if (m_tune_step_time == 0.0)
+        {
+        m_tune_build_time = times[0];
+        m_tune_step_time = times[1];
+        }
+    else
+        {
+        m_tune_build_time = (1.0 - alpha) * m_tune_build_time + alpha * times[0];
+        m_tune_step_time = (1.0 - alpha) * m_tune_step_time + alpha * times[1];
+        }
+
+        {
+        ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type,
+                                          access_location::host,
+                                          access_mode::readwrite);
+
+        // volume of the neighbor shells, weighted by the number of pairs of each type
+        auto shell_volume = [&](const std::vector<double>& r_buff_type)
+        {
+            double volume = 0.0;
+            for (unsigned int i = 0; i < n_types; i++)
+                {
+                for (unsigned int j = 0; j < n_types; j++)
+                    {
+                    const double r_cut_ij = h_r_cut.data[m_typpair_idx(i, j)];
+                    if (r_cut_ij <= 0.0)
+                        continue;
+
+                    const double r_list = r_cut_ij + (r_buff_type[i] + r_buff_type[j]) / 2.0;
+                    volume += m_tune_count[i] * m_tune_count[j] * r_list * r_list * r_list;
+                    }
+                }
+            return volume;
+        };
+
+        std::vector<double> current(h_r_buff_type.data, h_r_buff_type.data + n_types);
+        const double current_volume = shell_volume(current);
+        if (current_volume <= 0.0)
+            return;
+
+        // margin for fluctuations in the max displacement
+        const double safety = 1.2;
+        const double r_buff_min = 0.05 * m_r_buff;
+        const double period_min = std::max(1.0, double(m_rebuild_check_delay));
+        const double period_max = 1e4;
+
+        std::vector<double> best = current;
+        std::vector<double> trial(n_types);
+        double best_cost = std::numeric_limits<double>::max();
+        for (double period = period_min; period <= period_max; period *= 1.05)
+            {
+            double actual_period = period_max;
+            for (unsigned int i = 0; i < n_types; i++)
+                {
+                const double travel = 2.0 * safety * m_tune_rate[i];
+                trial[i] = std::min(std::max(travel * period, r_buff_min), double(m_r_buff));
+                if (m_tune_count[i] > 0.0 && travel > 0.0)
+                    {
+                    actual_period = std::min(actual_period, trial[i] / travel);
+                    }
+                }
+            actual_period = std::max(actual_period, period_min);
+
+            const double cost = m_tune_build_time / actual_period
+                                + m_tune_step_time * shell_volume(trial) / current_volume;
+            if (cost < best_cost)
+                {
+                best_cost = cost;
+                best = trial;
+                }
+            }
+
+        for (unsigned int i = 0; i < n_types; i++)
+            {
+            h_r_buff_type.data[i] = Scalar(best[i]);
+            }
+        }
+
+    updateRList();
+    }
+
+/*! \param timestep Current time step
+
+    Collects the particles that moved half of their type buffer and passes them to
+    buildIncremental(). Domain decomposed simulations always rebuild fully, because particle
+    migration and ghost exchange reorder the particles at every rebuild.
+
+    \returns true when the list was patched in place
+*/
+bool NeighborList::tryIncrementalBuild(uint64_t timestep)
+    {
+    // the GPU lists keep their last positions on the device and do not patch rows
+    if (!m_has_been_updated_once || m_exec_conf->isCUDAEnabled())
+        return false;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        return false;
+#endif
+
+    // the last positions are only comparable when the box has not changed
+    if (m_pdata->getGlobalBox() != m_last_box)
+        return false;
+
+    const unsigned int N = m_pdata->getN();
+    const uint64_t max_moved = uint64_t(m_incremental_max_fraction * Scalar(N));
+    std::vector<unsigned int> moved;
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_r_buff_type(m_r_buff_type, access_location::host, access_mode::read);
+        const BoxDim& box = m_pdata->getBox();
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const Scalar delta_max = h_r_buff_type.data[type_i] / Scalar(2.0);
+
+            Scalar3 dx = make_scalar3(h_pos.data[i].x - h_last_pos.data[i].x,
+                                      h_pos.data[i].y - h_last_pos.data[i].y,
+                                      h_pos.data[i].z - h_last_pos.data[i].z);
+            dx = box.minImage(dx);
+
+            if (dot(dx, dx) >= delta_max * delta_max)
+                {
+                moved.push_back(i);
+                if (m_incremental_moved + moved.size() > max_moved)
+                    return false;
+                }
+            }
+        }
+
+    if (moved.empty() || !buildIncremental(timestep, moved))
+        return false;
+
+    // only the moved particles start over, the others keep accumulating their displacement
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::readwrite);
+        for (unsigned int i : moved)
+            {
+            h_last_pos.data[i]
+                = make_scalar4(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z, Scalar(0.0));
+            }
+        }
+
+    m_incremental_moved += moved.size();
+    m_incremental_updates++;
+    return true;
+    }
+
 bool NeighborList::shouldCheckDistance(uint64_t timestep)
     {
     return !m_force_update && !(timestep < (m_last_updated_tstep + m_rebuild_check_delay));
@@ -1257,6 +1863,7 @@ bool NeighborList::needsUpdating(uint64_t timestep)
 
     // temporary storage for return result
     bool result = false;
+    m_distance_triggered = false;
 
     // check if this is a dangerous time
     // we are dangerous if m_rebuild_check_delay is greater than 1 and this is the first check after
@@ -1296,6 +1903,13 @@ bool NeighborList::needsUpdating(uint64_t timestep)
         else
             {
             result = distanceCheck(timestep);
+            m_distance_triggered = result;
+            }
+
+        if (result && m_buffer_tuning)
+            {
+            // sample before the communicator migrates particles away from m_last_pos
+            sampleDisplacements(timestep);
             }
 
         if (result)
@@ -1347,6 +1961,50 @@ unsigned int NeighborList::getSmallestRebuild()
     return (unsigned int)m_update_periods.size();
     }
 
+/*! \param n Number of particles
+    \param conditions Overflow conditions, by type
+    \param f Loop body
+
+    Each thread builds the lists of a contiguous range of particles. A particle writes only to its
+    own entries of m_nlist and m_n_neigh, so the threads share those arrays. The first thread
+    records overflows in \a conditions and the others in private copies that are combined with
+    max afterwards, so the result does not depend on the number of threads.
+*/
+void NeighborList::buildInParallel(unsigned int n,
+                                   unsigned int* conditions,
+                                   const BuildFunction& f)
+    {
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    const unsigned int n_threads = pool.getNumThreads();
+
+    if (n_threads == 1)
+        {
+        f(0, n, conditions);
+        return;
+        }
+
+    const unsigned int n_types = m_pdata->getNTypes();
+    m_thread_conditions.assign(size_t(n_threads - 1) * n_types, 0);
+
+    pool.parallelFor(
+        n,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+        {
+            unsigned int* thread_conditions
+                = thread_id == 0 ? conditions
+                                 : m_thread_conditions.data() + size_t(thread_id - 1) * n_types;
+            f(begin, end, thread_conditions);
+        });
+
+    for (unsigned int t = 0; t < n_threads - 1; t++)
+        {
+        for (unsigned int i = 0; i < n_types; i++)
+            {
+            conditions[i] = std::max(conditions[i], m_thread_conditions[t * n_types + i]);
+            }
+        }
+    }
+
 /*! This method is now deprecated, and deriving classes must supply it.
  */
 void NeighborList::buildNlist(uint64_t timestep)
@@ -1354,6 +2012,106 @@ void NeighborList::buildNlist(uint64_t timestep)
     throw runtime_error("Not implemented.");
     }
 
+/*! \param builder Neighbor list whose build algorithm this list uses
+
+    \a builder only builds the lists of this one, so it must not request a migration, ghost
+    particles, or ghost layer width of its own. The builder keeps its reference to the
+    communicator, which some build algorithms read.
+*/
+void NeighborList::adoptBuilder(NeighborList& builder)
+    {
+#ifdef ENABLE_MPI
+    if (builder.m_comm)
+        {
+        builder.m_comm->getMigrateSignal().disconnect<NeighborList, &NeighborList::peekUpdate>(
+            &builder);
+        builder.m_comm->getCommFlagsRequestSignal()
+            .disconnect<NeighborList, &NeighborList::getRequestedCommFlags>(&builder);
+        builder.m_comm->getGhostLayerPairWidthRequestSignal()
+            .disconnect<NeighborList, &NeighborList::getGhostLayerPairWidth>(&builder);
+        }
+#endif
+    }
+
+/*! \param builder Adopted neighbor list
+    \param timestep Current time step
+
+    The build reads the cutoffs, exclusions, and head list of this list and writes its neighbors
+    and overflow conditions. The state of \a builder specific to its algorithm (cell lists, trees,
+    and autotuners) persists between builds.
+*/
+void NeighborList::buildNlistWith(NeighborList& builder, uint64_t timestep)
+    {
+    swapBuildState(builder);
+    try
+        {
+        builder.buildNlist(timestep);
+        }
+    catch (...)
+        {
+        swapBuildState(builder);
+        throw;
+        }
+    swapBuildState(builder);
+
+    // compute() filters the exclusions that the algorithm does not apply itself
+    m_exclusions_in_build = builder.m_exclusions_in_build;
+    }
+
+/*! \param builder Adopted neighbor list
+    \param timestep Current time step
+    \param moved Local indices of the particles that moved more than half of their buffer
+
+    \returns false when \a builder requests a full build instead
+*/
+bool NeighborList::buildIncrementalWith(NeighborList& builder,
+                                        uint64_t timestep,
+                                        const std::vector<unsigned int>& moved)
+    {
+    swapBuildState(builder);
+    bool patched = false;
+    try
+        {
+        patched = builder.buildIncremental(timestep, moved);
+        }
+    catch (...)
+        {
+        swapBuildState(builder);
+        throw;
+        }
+    swapBuildState(builder);
+    return patched;
+    }
+
+/*! \param builder Neighbor list to exchange with
+
+    Calling this twice restores both lists.
+*/
+void NeighborList::swapBuildState(NeighborList& builder)
+    {
+    m_r_cut.swap(builder.m_r_cut);
+    m_r_listsq.swap(builder.m_r_listsq);
+    m_rcut_max.swap(builder.m_rcut_max);
+    m_r_cut_build.swap(builder.m_r_cut_build);
+    m_nlist.swap(builder.m_nlist);
+    m_n_neigh.swap(builder.m_n_neigh);
+    m_last_pos.swap(builder.m_last_pos);
+    m_head_list.swap(builder.m_head_list);
+    m_Nmax.swap(builder.m_Nmax);
+    m_conditions.swap(builder.m_conditions);
+    m_n_ex_idx.swap(builder.m_n_ex_idx);
+    m_ex_list_idx.swap(builder.m_ex_list_idx);
+
+    std::swap(m_typpair_idx, builder.m_typpair_idx);
+    std::swap(m_ex_list_indexer, builder.m_ex_list_indexer);
+    std::swap(m_rcut_max_max, builder.m_rcut_max_max);
+    std::swap(m_rcut_min, builder.m_rcut_min);
+    std::swap(m_r_buff, builder.m_r_buff);
+    std::swap(m_filter_body, builder.m_filter_body);
+    std::swap(m_storage_mode, builder.m_storage_mode);
+    std::swap(m_exclusions_set, builder.m_exclusions_set);
+    }
+
 /*! Translates the exclusions set in \c m_n_ex_tag and \c m_ex_list_tag to indices in \c m_n_ex_idx
  * and \c m_ex_list_idx
  */
@@ -1390,12 +2148,162 @@ void NeighborList::updateExListIdx()
             unsigned int ex_tag = h_ex_list_tag.data[m_ex_list_indexer_tag(tag, offset)];
             unsigned int ex_idx = h_rtag.data[ex_tag];
 
-            // store excluded particle idx
-            h_ex_list_idx.data[m_ex_list_indexer(idx, offset)] = ex_idx;
+            // store excluded particle idx, keeping the list sorted for isExcluded()
+            unsigned int pos = offset;
+            while (pos > 0 && h_ex_list_idx.data[m_ex_list_indexer(idx, pos - 1)] > ex_idx)
+                {
+                h_ex_list_idx.data[m_ex_list_indexer(idx, pos)]
+                    = h_ex_list_idx.data[m_ex_list_indexer(idx, pos - 1)];
+                pos--;
+                }
+            h_ex_list_idx.data[m_ex_list_indexer(idx, pos)] = ex_idx;
             }
         }
     }
 
+/*! \param compress_indices Set to true to keep the compressed neighbor offsets up to date
+
+    The offsets are first filled by the next build.
+*/
+void NeighborList::setCompressIndices(bool compress_indices)
+    {
+    if (!compress_indices)
+        {
+        GPUArray<int16_t> nlist_offsets;
+        m_nlist_offsets.swap(nlist_offsets);
+        }
+    m_compress_indices = compress_indices;
+    forceUpdate();
+    }
+
+/*! Encodes every entry of m_nlist as the offset from the owning particle, or NLIST_OFFSET_ESCAPE
+    when the offset does not fit in 16 bits.
+*/
+void NeighborList::compressNlist()
+    {
+    if (m_nlist_offsets.getNumElements() != m_nlist.getNumElements())
+        {
+        GPUArray<int16_t> nlist_offsets(m_nlist.getNumElements(), m_exec_conf);
+        m_nlist_offsets.swap(nlist_offsets);
+        }
+
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::read);
+    ArrayHandle<int16_t> h_nlist_offsets(m_nlist_offsets,
+                                         access_location::host,
+                                         access_mode::overwrite);
+
+    for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+        {
+        size_t myHead = h_head_list.data[idx];
+        for (unsigned int k = 0; k < h_n_neigh.data[idx]; k++)
+            {
+            h_nlist_offsets.data[myHead + k]
+                = encodeNeighborOffset(idx, h_nlist.data[myHead + k]);
+            }
+        }
+    }
+
+/*! \param cluster_pairs Set to true to keep the cluster pair list up to date
+
+    The cluster pair list is first filled by the next build.
+*/
+void NeighborList::setClusterPairs(bool cluster_pairs)
+    {
+    if (!cluster_pairs)
+        {
+        GPUArray<unsigned int> cluster_n_neigh;
+        m_cluster_n_neigh.swap(cluster_n_neigh);
+        GPUArray<unsigned int> cluster_nlist;
+        m_cluster_nlist.swap(cluster_nlist);
+        GPUArray<uint64_t> cluster_mask;
+        m_cluster_mask.swap(cluster_mask);
+        }
+    m_cluster_pairs = cluster_pairs;
+    forceUpdate();
+    }
+
+void NeighborList::allocateClusterPairs()
+    {
+    size_t n_clusters = (m_pdata->getN() + NLIST_CLUSTER_SIZE - 1) / NLIST_CLUSTER_SIZE;
+    if (m_cluster_n_neigh.getNumElements() < n_clusters)
+        {
+        GPUArray<unsigned int> cluster_n_neigh(n_clusters, m_exec_conf);
+        m_cluster_n_neigh.swap(cluster_n_neigh);
+        }
+
+    if (m_cluster_nlist.getNumElements() != m_nlist.getNumElements())
+        {
+        GPUArray<unsigned int> cluster_nlist(m_nlist.getNumElements(), m_exec_conf);
+        m_cluster_nlist.swap(cluster_nlist);
+        GPUArray<uint64_t> cluster_mask(m_nlist.getNumElements(), m_exec_conf);
+        m_cluster_mask.swap(cluster_mask);
+        }
+    }
+
+/*! Each i cluster collects the distinct clusters of the neighbors of its particles and sets the
+    mask bit of every neighbor.
+*/
+void NeighborList::buildClusterPairs()
+    {
+    allocateClusterPairs();
+
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_cluster_n_neigh(m_cluster_n_neigh,
+                                                access_location::host,
+                                                access_mode::overwrite);
+    ArrayHandle<unsigned int> h_cluster_nlist(m_cluster_nlist,
+                                              access_location::host,
+                                              access_mode::overwrite);
+    ArrayHandle<uint64_t> h_cluster_mask(m_cluster_mask,
+                                         access_location::host,
+                                         access_mode::overwrite);
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_clusters = (N + NLIST_CLUSTER_SIZE - 1) / NLIST_CLUSTER_SIZE;
+
+    // map from j cluster to its entry in the list of the current i cluster
+    std::unordered_map<unsigned int, unsigned int> cluster_entry;
+
+    for (unsigned int cluster_i = 0; cluster_i < n_clusters; cluster_i++)
+        {
+        const size_t cluster_head = h_head_list.data[cluster_i * NLIST_CLUSTER_SIZE];
+        unsigned int n_cluster_neigh = 0;
+        cluster_entry.clear();
+
+        for (unsigned int a = 0; a < NLIST_CLUSTER_SIZE; a++)
+            {
+            const unsigned int i = cluster_i * NLIST_CLUSTER_SIZE + a;
+            if (i >= N)
+                break;
+
+            const size_t myHead = h_head_list.data[i];
+            for (unsigned int k = 0; k < h_n_neigh.data[i]; k++)
+                {
+                const unsigned int j = h_nlist.data[myHead + k];
+                const unsigned int cluster_j = j / NLIST_CLUSTER_SIZE;
+
+                auto it = cluster_entry.find(cluster_j);
+                if (it == cluster_entry.end())
+                    {
+                    it = cluster_entry.emplace(cluster_j, n_cluster_neigh).first;
+                    h_cluster_nlist.data[cluster_head + n_cluster_neigh] = cluster_j;
+                    h_cluster_mask.data[cluster_head + n_cluster_neigh] = 0;
+                    n_cluster_neigh++;
+                    }
+
+                h_cluster_mask.data[cluster_head + it->second]
+                    |= clusterPairBit(a, j % NLIST_CLUSTER_SIZE);
+                }
+            }
+
+        h_cluster_n_neigh.data[cluster_i] = n_cluster_neigh;
+        }
+    }
+
 /*! Loops through the neighbor list and filters out any excluded pairs
  */
 void NeighborList::filterNlist()
@@ -1414,7 +2322,6 @@ void NeighborList::filterNlist()
         {
         size_t myHead = h_head_list.data[idx];
         unsigned int n_neigh = h_n_neigh.data[idx];
-        unsigned int n_ex = h_n_ex_idx.data[idx];
         unsigned int new_n_neigh = 0;
 
         // loop over the list, regenerating it as we go
@@ -1422,20 +2329,8 @@ void NeighborList::filterNlist()
             {
             unsigned int cur_neigh = h_nlist.data[myHead + cur_neigh_idx];
 
-            // test if excluded
-            bool excluded = false;
-            for (unsigned int cur_ex_idx = 0; cur_ex_idx < n_ex; cur_ex_idx++)
-                {
-                unsigned int cur_ex = h_ex_list_idx.data[m_ex_list_indexer(idx, cur_ex_idx)];
-                if (cur_ex == cur_neigh)
-                    {
-                    excluded = true;
-                    break;
-                    }
-                }
-
             // add it back to the list if it is not excluded
-            if (!excluded)
+            if (!isExcluded(h_n_ex_idx.data, h_ex_list_idx.data, idx, cur_neigh))
                 {
                 h_nlist.data[myHead + new_n_neigh] = cur_neigh;
                 new_n_neigh++;
@@ -1508,7 +2403,10 @@ void NeighborList::resizeNlist(size_t size)
  * \returns false if all particle types have enough memory for their neighbors
  *
  * The maximum number of neighbors per particle (rounded up to the nearest 4, min of 4) is
- * recomputed when an overflow happens.
+ * recomputed when an overflow happens. It grows to the overflowing count plus 1/8 of headroom, so
+ * a number of neighbors that grows slowly (as in a compression or nucleation) does not overflow
+ * and rebuild the list at every build. The maximum never shrinks, so the list is not reallocated
+ * when the number of neighbors fluctuates.
  */
 bool NeighborList::checkConditions()
     {
@@ -1520,7 +2418,8 @@ bool NeighborList::checkConditions()
         {
         if (h_conditions.data[i] > h_Nmax.data[i])
             {
-            h_Nmax.data[i] = (h_conditions.data[i] > 4) ? (h_conditions.data[i] + 3) & ~3 : 4;
+            const unsigned int n_max = h_conditions.data[i] + h_conditions.data[i] / 8;
+            h_Nmax.data[i] = (n_max > 4) ? (n_max + 3) & ~3 : 4;
             result = true;
             }
         }
@@ -1832,6 +2731,18 @@ void export_NeighborList(pybind11::module& m)
                       &NeighborList::getRebuildCheckDelay,
                       &NeighborList::setRebuildCheckDelay)
         .def_property("check_dist", &NeighborList::getDistCheck, &NeighborList::setDistCheck)
+        .def_property("auto_buffer",
+                      &NeighborList::getBufferTuning,
+                      &NeighborList::setBufferTuning)
+        .def("getTypeBuffer", &NeighborList::getTypeBufferPython)
+        .def_property("incremental", &NeighborList::getIncremental, &NeighborList::setIncremental)
+        .def("getNumIncrementalUpdates", &NeighborList::getNumIncrementalUpdates)
+        .def_property("compress_indices",
+                      &NeighborList::getCompressIndices,
+                      &NeighborList::setCompressIndices)
+        .def_property("cluster_pairs",
+                      &NeighborList::getClusterPairs,
+                      &NeighborList::setClusterPairs)
         .def("setStorageMode", &NeighborList::setStorageMode)
         .def_property("exclusions", &NeighborList::getExclusions, &NeighborList::setExclusions)
         .def("addMesh", &NeighborList::AddMesh)
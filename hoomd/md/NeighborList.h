@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/ClockSource.h"
 #include "hoomd/Compute.h"
 #include "hoomd/GPUFlags.h"
 #include "hoomd/GPUVector.h"
@@ -9,6 +10,7 @@
 #include "hoomd/PythonLocalDataAccess.h"
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
+#include <functional>
 #include <memory>
 #include <set>
 #include <vector>
@@ -95,6 +97,60 @@ namespace md
    dist_check=True, the above described behavior is followed. When dist_check is false, the nlist is
    built exactly m_rebuild_check_delay steps. This is intended for use in profiling only.
 
+    <b>Buffer tuning:</b>
+
+    Each particle type has its own buffer width (m_r_buff_type) and r_list(i,j) adds the mean of
+    the two type buffers to r_cut(i,j). A particle triggers a rebuild when it moves half of the
+    buffer of its type. Without tuning, every type uses r_buff. With setBufferTuning(), the type
+    buffers are selected at each build by tuneBuffers() from the measured displacement rates and
+    timings, and r_buff is the largest allowed buffer. r_buff alone still sets the ghost layer,
+    cell, and stencil widths, so tuning only needs to rewrite the per pair arrays. Builders find
+    r_list(i,j) in m_r_listsq or as m_r_cut_build(i,j) + r_buff.
+
+    <b>Compressed indices:</b>
+
+    After a particle sort, most neighbors of particle i have indices close to i. With
+    setCompressIndices(), compressNlist() stores each entry of m_nlist again in m_nlist_offsets as
+    the 16-bit offset j - i, or NLIST_OFFSET_ESCAPE when the offset does not fit. Pair force loops
+    read the offsets and fall back to m_nlist only for escaped entries, roughly halving the
+    neighbor list traffic. m_nlist remains complete, so other consumers are unaffected.
+
+    <b>Cluster pairs:</b>
+
+    With setClusterPairs(), buildClusterPairs() groups the particles into clusters of
+    NLIST_CLUSTER_SIZE consecutive indices after every build and lists, for each cluster, the
+    clusters that hold its neighbors along with a mask of the neighboring pairs (see
+    NeighborListCluster.h). The masks reproduce m_nlist exactly, including exclusions, so any
+    builder can produce a cluster pair list. PotentialPairGPU then evaluates the forces one cluster
+    pair at a time, so the threads of a cluster walk lists of the same length and read each j
+    cluster once.
+
+    <b>Incremental builds:</b>
+
+    With setIncremental(), a distance check that finds only a few moved particles (those that
+    moved half of their type buffer) patches the list in place with buildIncremental() instead of
+    calling buildNlist(). The rows of the moved particles are rebuilt, each moved particle is added
+    to the rows of the particles near it, and only the moved particles get new last positions.
+    Rows are never shortened, so entries of other particles stay valid. Because the other particles
+    may have already moved up to half of their buffer, a moved particle m is added to the row of i
+    when r_ij < r_list(i,m) + d_i, where d_i is the displacement of i since its last position.
+    A full build runs when the moved particles (summed since the last full build) exceed
+    m_incremental_max_fraction of the particles, when a row overflows, when the box changes, and
+    when the subclass does not implement buildIncremental().
+
+    <b>Cutoff tiers:</b>
+
+    When two or more consumers have added r_cut matrices, sortTiers() orders each row after the
+    build so that it starts with the neighbors that are within r_cut(i,j) + r_buff(i,j) of the
+    consumer with the smallest cutoffs, followed by the remaining neighbors within range of the
+    next consumer, and so on. Tiers are ordered by the largest cutoff of each consumer. Each tier
+    keeps a count array, and getNNeighArray(r_cut_matrix) returns the count of the consumer's own
+    tier, so the consumer reads only a prefix of each row. The prefix contains every neighbor the
+    consumer needs, but may also contain neighbors of other type pairs that are outside of its
+    r_cut, so consumers must still apply their cutoff. m_n_neigh always holds the full row length.
+    The tiers are disabled (and getNNeighArray(r_cut_matrix) returns m_n_neigh) after an
+    incremental build until the next full build.
+
     \b Exclusions:
 
     Exclusions are stored in \a ex_list, a data structure similar in structure to \a nlist, except
@@ -104,6 +160,11 @@ namespace md
    removes any particles that are excluded. This allows an arbitrary number of exclusions to be
    processed without slowing the performance of the buildNlist() step itself.
 
+    The CPU implementation sorts the indices of each particle's exclusion list, so isExcluded() can
+   binary search it. Derived classes that set \a m_exclusions_in_build apply the exclusions with
+   isExcluded() to each pair that passes the distance check in buildNlist(), and compute() skips
+   the separate filterNlist() pass.
+
     <b>Overflow handling:</b>
     For easy support of derived GPU classes to implement overflow detection the overflow condition
    is stored in the GlobalArray \a d_conditions.
@@ -113,7 +174,8 @@ namespace md
      - Further indices may be added to handle other conditions at a later time.
 
     Condition flags are to be set during the buildNlist() call and will be checked by compute()
-   which will then take the appropriate action.
+   which will then take the appropriate action. After an overflow, checkConditions() grows Nmax of
+   the overflowing types with headroom and compute() rebuilds the list. Nmax never shrinks.
 
     \ingroup computes
 */
@@ -220,6 +282,36 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_dist_check;
         }
 
+    //! Enable or disable buffer tuning
+    void setBufferTuning(bool buffer_tuning);
+
+    //! Test if buffer tuning is enabled
+    bool getBufferTuning()
+        {
+        return m_buffer_tuning;
+        }
+
+    //! Get the buffer width of each particle type, by type name
+    pybind11::dict getTypeBufferPython();
+
+    //! Enable or disable the compressed neighbor offsets
+    void setCompressIndices(bool compress_indices);
+
+    //! Enable or disable the cluster pair list
+    void setClusterPairs(bool cluster_pairs);
+
+    //! Test if the cluster pair list is enabled
+    bool getClusterPairs()
+        {
+        return m_cluster_pairs;
+        }
+
+    //! Test if the compressed neighbor offsets are enabled
+    bool getCompressIndices()
+        {
+        return m_compress_indices;
+        }
+
     //! Set the storage mode
     /*! \param mode Storage mode to set
         - half only stores neighbors where i < j
@@ -298,12 +390,58 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_n_neigh;
         }
 
+    //! Get the number of neighbors of each particle that a consumer needs to read
+    /*! \param r_cut_matrix r_cut matrix given to addRCutMatrix() by the consumer
+        \returns The count array of the consumer's cutoff tier, or the full number of neighbors
+     */
+    const GPUArray<unsigned int>&
+    getNNeighArray(const std::shared_ptr<GPUArray<Scalar>>& r_cut_matrix) const
+        {
+        if (m_tiers_valid)
+            {
+            for (unsigned int tier = 0; tier < m_tier_r_cut.size(); tier++)
+                {
+                if (m_tier_r_cut[tier] == r_cut_matrix)
+                    return *m_tier_n_neigh[tier];
+                }
+            }
+        return m_n_neigh;
+        }
+
     //! Get the neighbor list
     const GPUArray<unsigned int>& getNListArray() const
         {
         return m_nlist;
         }
 
+    //! Get the compressed neighbor offsets
+    /*! The array is null when compressed indices are disabled.
+     */
+    const GPUArray<int16_t>& getNListOffsets() const
+        {
+        return m_nlist_offsets;
+        }
+
+    //! Get the number of j clusters of each i cluster
+    /*! The cluster pair arrays are null when the cluster pair list is disabled.
+     */
+    const GPUArray<unsigned int>& getClusterNNeighArray() const
+        {
+        return m_cluster_n_neigh;
+        }
+
+    //! Get the j clusters of each i cluster
+    const GPUArray<unsigned int>& getClusterNListArray() const
+        {
+        return m_cluster_nlist;
+        }
+
+    //! Get the masks of the neighboring pairs in each cluster pair
+    const GPUArray<uint64_t>& getClusterMaskArray() const
+        {
+        return m_cluster_mask;
+        }
+
     //! Get the head list
     const GPUArray<size_t>& getHeadList() const
         {
@@ -395,6 +533,27 @@ class PYBIND11_EXPORT NeighborList : public Compute
             }
         }
 
+    //! Return the requested ghost layer width of type_i toward particles of type_j
+    virtual Scalar getGhostLayerPairWidth(unsigned int type_i, unsigned int type_j)
+        {
+        if (m_rcut_changed)
+            {
+            updateRList();
+            }
+
+        ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+        const Scalar r_cut_ij = h_r_cut.data[m_typpair_idx(type_i, type_j)];
+
+        if (r_cut_ij > Scalar(0.0)) // ensure communication is required
+            {
+            return r_cut_ij + m_r_buff;
+            }
+        else
+            {
+            return Scalar(0.0);
+            }
+        }
+
     // @}
 
     //! Computes the NeighborList if it needs updating
@@ -412,11 +571,41 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_updates + m_forced_updates;
         }
 
+    //! Enable or disable incremental builds
+    void setIncremental(bool incremental)
+        {
+        m_incremental = incremental;
+        }
+
+    //! Test if incremental builds are enabled
+    bool getIncremental()
+        {
+        return m_incremental;
+        }
+
+    //! Get the number of updates that were incremental builds
+    uint64_t getNumIncrementalUpdates()
+        {
+        return m_incremental_updates;
+        }
+
 #ifdef ENABLE_MPI
     //! Returns true if the particle migration criterion is fulfilled
     /*! \param timestep The current timestep
      */
     bool peekUpdate(uint64_t timestep);
+
+    //! Returns true if the current list is valid at the given timestep without a rebuild
+    /*! \param timestep The current timestep
+
+        Forces may compute with the neighbor list before the ghost update completes only when this
+        returns true: without a build, compute() reads no ghost particle data.
+    */
+    bool isValidWithoutRebuild(uint64_t timestep)
+        {
+        return m_has_been_updated_once && !m_rcut_changed && !m_force_update
+               && !m_n_particles_changed && !m_topology_changed && !needsUpdating(timestep);
+        }
 #endif
 
     //! Return true if the neighbor list has been updated this time step
@@ -475,20 +664,44 @@ class PYBIND11_EXPORT NeighborList : public Compute
     GPUArray<Scalar> m_rcut_max;  //!< The maximum value of rcut per particle type
     GPUArray<Scalar> m_rcut_base; //!< The base rcut values
 
+    /// Cutoffs passed to the builders: r_list(i,j) = r_cut_build(i,j) + r_buff
+    GPUArray<Scalar> m_r_cut_build;
+
+    /// Buffer width of each particle type, r_buff(i,j) is the mean of the two type buffers
+    GPUArray<Scalar> m_r_buff_type;
+
     /// List of r_cut matrices from neighborlist consumers
     std::vector<std::shared_ptr<GPUArray<Scalar>>> m_consumer_r_cut;
 
+    /// Consumer r_cut matrix of each cutoff tier, by ascending maximum cutoff
+    std::vector<std::shared_ptr<GPUArray<Scalar>>> m_tier_r_cut;
+
+    /// Number of neighbors of each particle within each tier and the tiers before it
+    std::vector<std::shared_ptr<GPUArray<unsigned int>>> m_tier_n_neigh;
+
+    /// Squared radius of each tier by type pair (negative for inactive pairs), indexed by
+    /// tier * m_typpair_idx.getNumElements() + type pair
+    GPUArray<Scalar> m_r_tiersq;
+
+    bool m_tiers_valid = false; //!< True when the rows are ordered by tier
+
     Scalar m_rcut_max_max;      //!< The maximum cutoff radius of any pair
     Scalar m_rcut_min;          //!< The smallest cutoff radius of any pair (that is > 0)
     Scalar m_r_buff;            //!< The buffer around the cutoff
     bool m_filter_body;         //!< Set to true if particles in the same body are to be filtered
     storageMode m_storage_mode; //!< The storage mode
 
-    GPUArray<unsigned int> m_nlist;   //!< Neighbor list data
-    GPUArray<unsigned int> m_n_neigh; //!< Number of neighbors for each particle
-    GPUArray<Scalar4> m_last_pos;     //!< coordinates of last updated particle positions
-    Scalar3 m_last_L;                 //!< Box lengths at last update
-    Scalar3 m_last_L_local;           //!< Local Box lengths at last update
+    GPUArray<unsigned int> m_nlist;           //!< Neighbor list data
+    GPUArray<unsigned int> m_n_neigh;         //!< Number of neighbors for each particle
+    GPUArray<int16_t> m_nlist_offsets;        //!< Compressed neighbor offsets (j - i)
+    bool m_compress_indices = false;          //!< True if m_nlist_offsets is kept up to date
+    GPUArray<unsigned int> m_cluster_n_neigh; //!< Number of j clusters of each i cluster
+    GPUArray<unsigned int> m_cluster_nlist;   //!< j clusters, indexed like m_nlist
+    GPUArray<uint64_t> m_cluster_mask;        //!< Masks of the neighboring pairs
+    bool m_cluster_pairs = false;             //!< True if the cluster pair list is kept up to date
+    GPUArray<Scalar4> m_last_pos;             //!< coordinates of last updated particle positions
+    BoxDim m_last_box;                        //!< Global box at last update
+    Scalar3 m_last_L_local;                   //!< Local Box lengths at last update
 
     GPUArray<size_t> m_head_list;  //!< Indexes for particles to read from the neighbor list
     GPUArray<unsigned int> m_Nmax; //!< Holds the maximum number of neighbors for each particle type
@@ -502,6 +715,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
     Index2D m_ex_list_indexer;            //!< Indexer for accessing the exclusion list
     Index2D m_ex_list_indexer_tag;        //!< Indexer for accessing the by-tag exclusion list
     bool m_exclusions_set;                //!< True if any exclusions have been set
+    bool m_exclusions_in_build = false;   //!< True if buildNlist() applies the exclusions
 
     std::shared_ptr<MeshBondData> m_meshbond_data;
 
@@ -525,6 +739,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Updates the previous position table for use in the next distance check
     virtual void setLastUpdatedPos();
 
+    //! Get the largest contraction of any pair distance by box resizes since the last update
+    Scalar getMinStretch() const;
+
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
 
@@ -540,12 +757,89 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    //! Test if particle j is in the sorted exclusion list of particle i
+    /*! \param h_n_ex_idx Host data of m_n_ex_idx
+        \param h_ex_list_idx Host data of m_ex_list_idx
+        \param i Index of the particle
+        \param j Index of the neighbor
+    */
+    bool isExcluded(const unsigned int* h_n_ex_idx,
+                    const unsigned int* h_ex_list_idx,
+                    unsigned int i,
+                    unsigned int j) const
+        {
+        unsigned int lo = 0;
+        unsigned int hi = h_n_ex_idx[i];
+        while (lo < hi)
+            {
+            const unsigned int mid = (lo + hi) / 2;
+            const unsigned int ex = h_ex_list_idx[m_ex_list_indexer(i, mid)];
+            if (ex == j)
+                return true;
+            if (ex < j)
+                lo = mid + 1;
+            else
+                hi = mid;
+            }
+        return false;
+        }
+
+    //! Order the neighbors of each particle by cutoff tier
+    void sortTiers();
+
+    //! Move the neighbors within one tier to the front of the remaining part of each row
+    /*! The remaining part of the row of particle i starts at (*m_tier_n_neigh[tier - 1])[i], or
+        at 0 for the first tier. Sets (*m_tier_n_neigh[tier])[i] to the end of the tier.
+    */
+    virtual void partitionTier(unsigned int tier);
+
+    //! Encode m_nlist into m_nlist_offsets
+    virtual void compressNlist();
+
+    //! Allocate the cluster pair arrays for the current number of particles and nlist size
+    void allocateClusterPairs();
+
+    //! Build the cluster pair list from m_nlist
+    virtual void buildClusterPairs();
+
     //! Build the head list to allocated memory
     virtual void buildHeadList();
 
+    //! Patch the neighbor list for the moved particles
+    /*! \param timestep Current time step
+        \param moved Indices of the particles that moved half of their buffer
+
+        Implementations rebuild the rows of the moved particles and add every moved particle m to
+        the row of each particle i with r_im < r_list(i,m) + d_i (see the class documentation).
+        They must not shorten the rows of other particles.
+
+        \returns false (leaving the list in any state) to request a full build instead
+    */
+    virtual bool buildIncremental(uint64_t timestep, const std::vector<unsigned int>& moved)
+        {
+        return false;
+        }
+
+    //! Use another neighbor list as a build algorithm for this one
+    void adoptBuilder(NeighborList& builder);
+
+    //! Build this list with the algorithm of an adopted neighbor list
+    void buildNlistWith(NeighborList& builder, uint64_t timestep);
+
+    //! Patch this list with the algorithm of an adopted neighbor list
+    bool buildIncrementalWith(NeighborList& builder,
+                              uint64_t timestep,
+                              const std::vector<unsigned int>& moved);
+
     //! Amortized resizing of the neighborlist
     void resizeNlist(size_t size);
 
+    /// Build loop body: f(begin, end, conditions) builds the lists of particles [begin, end)
+    typedef std::function<void(unsigned int, unsigned int, unsigned int*)> BuildFunction;
+
+    //! Run a build loop over the particles [0, n) on the thread pool
+    void buildInParallel(unsigned int n, unsigned int* conditions, const BuildFunction& f);
+
 #ifdef ENABLE_MPI
     CommFlags getRequestedCommFlags(uint64_t timestep)
         {
@@ -561,6 +855,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
 #endif
 
     private:
+    //! Exchange the data read and written by the build algorithms with another neighbor list
+    void swapBuildState(NeighborList& builder);
+
     Nano::Signal<void()> m_rcut_signal; //!< Signal that is triggered when the cutoff radius changes
 
     bool m_rcut_changed; //!< Flag if the rcut array has changed
@@ -586,9 +883,39 @@ class PYBIND11_EXPORT NeighborList : public Compute
     std::vector<uint64_t> m_update_periods; //!< Steps between updates
     std::set<std::string> m_exclusions;     //!< Exclusions that have been set
 
+    bool m_buffer_tuning;                   //!< True when the type buffers are tuned
+    ClockSource m_tune_clock;               //!< Times the builds for the buffer tuner
+    std::vector<double> m_tune_rate;        //!< Smoothed max displacement per step, by type
+    std::vector<double> m_tune_sample;      //!< Max displacement at the last check, by type
+    std::vector<double> m_tune_count;       //!< Number of particles at the last check, by type
+    uint64_t m_tune_period;                 //!< Steps between the last two builds
+    bool m_tune_sampled;                    //!< True when the last check took a sample
+    int64_t m_tune_last_build_start;        //!< Wall time at the start of the last build (ns)
+    int64_t m_tune_last_build_time;         //!< Wall time of the last build (ns)
+    double m_tune_build_time;               //!< Smoothed build time (s)
+    double m_tune_step_time;                //!< Smoothed time of a step without a build (s)
+
+    /// Overflow conditions of the threads after the first, by thread and type
+    std::vector<unsigned int> m_thread_conditions;
+
+    bool m_incremental = false;              //!< True when incremental builds are enabled
+    bool m_distance_triggered = false;       //!< True if the last update was a distance check
+    uint64_t m_incremental_moved = 0;        //!< Moved particles patched since the last full build
+    uint64_t m_incremental_updates = 0;      //!< Number of incremental builds
+    Scalar m_incremental_max_fraction = 0.1; //!< Largest fraction of particles to patch
+
     //! Test if the list needs updating
     bool needsUpdating(uint64_t timestep);
 
+    //! Record the maximum displacement of each type since the last build
+    void sampleDisplacements(uint64_t timestep);
+
+    //! Choose the type buffers for the next build
+    void tuneBuffers(int64_t build_start);
+
+    //! Patch the list in place when only a few particles moved
+    bool tryIncrementalBuild(uint64_t timestep);
+
     //! Reallocate internal neighbor list data structures
     void reallocate();
 
@@ -0,0 +1,23 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListAuto.cc
+    \brief Exports NeighborListAuto on the CPU
+*/
+
+#include "NeighborListAuto.h"
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+void export_NeighborListAuto(pybind11::module& m)
+    {
+    export_NeighborListAuto<NeighborList>(m, "NeighborListAuto");
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
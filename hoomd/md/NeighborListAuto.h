@@ -0,0 +1,253 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+#include "hoomd/ClockSource.h"
+
+/*! \file NeighborListAuto.h
+    \brief Declares the NeighborListAuto class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <limits>
+
+#ifndef __NEIGHBORLISTAUTO_H__
+#define __NEIGHBORLISTAUTO_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list that selects the fastest of several build algorithms
+/*! NeighborListAuto owns the list data and performs the distance checks, exclusions, tiers, and
+    buffer tuning like any other neighbor list. Each build runs the buildNlist() method of one of
+    the candidate neighbor lists on that data (see NeighborList::buildNlistWith()), so the pair
+    potentials never see the switch.
+
+    A selection times the builds of each candidate in turn. The candidates build the list
+    m_n_trials times each and the one with the shortest build is used until the next selection.
+    The trials are the list's regular rebuilds, so a selection costs only the extra time of the
+    slower candidates. The first builds start a selection, as does the first build m_period steps
+    after the last selection ended (when m_period > 0).
+
+    Each MPI rank selects the candidate that is fastest on its domain.
+
+    \tparam Base NeighborList on the CPU or NeighborListGPU on the GPU
+    \ingroup computes
+*/
+template<class Base> class PYBIND11_EXPORT NeighborListAuto : public Base
+    {
+    public:
+    //! Constructs the compute
+    /*! \param sysdef System definition
+        \param r_buff Buffer radius
+        \param candidates Neighbor lists that provide the build algorithms
+    */
+    NeighborListAuto(std::shared_ptr<SystemDefinition> sysdef,
+                     Scalar r_buff,
+                     std::vector<std::shared_ptr<NeighborList>> candidates)
+        : Base(sysdef, r_buff), m_candidates(candidates), m_trial_time(candidates.size())
+        {
+        this->m_exec_conf->msg->notice(5) << "Constructing NeighborListAuto" << std::endl;
+
+        if (m_candidates.empty())
+            throw std::invalid_argument("NeighborListAuto requires at least one candidate.");
+
+        for (auto& candidate : m_candidates)
+            this->adoptBuilder(*candidate);
+
+        startSelection();
+        }
+
+    //! Destructor
+    virtual ~NeighborListAuto()
+        {
+        this->m_exec_conf->msg->notice(5) << "Destroying NeighborListAuto" << std::endl;
+        }
+
+    /// Notify NeighborList that a r_cut matrix value has changed
+    virtual void notifyRCutMatrixChange()
+        {
+        // the candidates update their cell widths and stencils in their next build
+        for (auto& candidate : m_candidates)
+            candidate->notifyRCutMatrixChange();
+        Base::notifyRCutMatrixChange();
+        }
+
+    /// Start autotuning the kernel parameters of this list and the candidates
+    virtual void startAutotuning()
+        {
+        Base::startAutotuning();
+        for (auto& candidate : m_candidates)
+            candidate->startAutotuning();
+        }
+
+    /// Check if autotuning is complete
+    virtual bool isAutotuningComplete()
+        {
+        bool result = Base::isAutotuningComplete();
+        for (auto& candidate : m_candidates)
+            result = result && candidate->isAutotuningComplete();
+        return result;
+        }
+
+    //! Set the number of steps between selections (0 selects only once)
+    void setPeriod(uint64_t period)
+        {
+        m_period = period;
+        }
+
+    //! Get the number of steps between selections
+    uint64_t getPeriod()
+        {
+        return m_period;
+        }
+
+    //! Get the index of the candidate that builds the list
+    unsigned int getSelected()
+        {
+        return m_selected;
+        }
+
+    //! Test if a selection is in progress
+    bool isSelecting()
+        {
+        return m_selecting;
+        }
+
+    //! Get the shortest build time of each candidate in the last selection (s)
+    std::vector<double> getTrialTimes()
+        {
+        return m_trial_time;
+        }
+
+    protected:
+    //! Builds the neighbor list with the selected candidate or the next trial
+    virtual void buildNlist(uint64_t timestep);
+
+    //! Patch the neighbor list with the selected candidate
+    virtual bool buildIncremental(uint64_t timestep, const std::vector<unsigned int>& moved)
+        {
+        // trials time full builds only
+        if (m_selecting)
+            return false;
+        return this->buildIncrementalWith(*m_candidates[m_selected], timestep, moved);
+        }
+
+    private:
+    //! Start timing the candidates at the next build
+    void startSelection()
+        {
+        m_selecting = true;
+        m_trial = 0;
+        std::fill(m_trial_time.begin(),
+                  m_trial_time.end(),
+                  std::numeric_limits<double>::infinity());
+        }
+
+    //! Select the candidate with the shortest build
+    void finishSelection(uint64_t timestep);
+
+    /// Neighbor lists that provide the build algorithms
+    std::vector<std::shared_ptr<NeighborList>> m_candidates;
+
+    unsigned int m_selected = 0;       //!< Index of the candidate that builds the list
+    uint64_t m_period = 0;             //!< Steps between selections
+    const unsigned int m_n_trials = 3; //!< Number of builds timed for each candidate
+    bool m_selecting = false;          //!< True while the candidates are timed
+    unsigned int m_trial = 0;          //!< Number of trial builds started in this selection
+    uint64_t m_trial_timestep = 0;     //!< Time step of the last trial build
+    uint64_t m_selection_timestep = 0; //!< Time step at the end of the last selection
+    std::vector<double> m_trial_time;  //!< Shortest build time of each candidate (s)
+    ClockSource m_clock;               //!< Times the trial builds
+    };
+
+/*! \param timestep Current time step
+
+    compute() calls buildNlist() again in the same time step when the list overflows. The retry
+    uses the same candidate and counts as part of the same trial, so the trials stay in step on
+    all MPI ranks.
+*/
+template<class Base> void NeighborListAuto<Base>::buildNlist(uint64_t timestep)
+    {
+    if (!m_selecting && m_period > 0 && timestep >= m_selection_timestep + m_period)
+        startSelection();
+
+    if (m_selecting && (m_trial == 0 || timestep != m_trial_timestep))
+        {
+        if (m_trial == m_n_trials * m_candidates.size())
+            finishSelection(timestep);
+        else
+            {
+            m_trial++;
+            m_trial_timestep = timestep;
+            }
+        }
+
+    if (!m_selecting)
+        {
+        this->buildNlistWith(*m_candidates[m_selected], timestep);
+        return;
+        }
+
+    const unsigned int candidate = (m_trial - 1) % (unsigned int)m_candidates.size();
+
+#ifdef ENABLE_HIP
+    if (this->m_exec_conf->isCUDAEnabled())
+        hipDeviceSynchronize();
+#endif
+    const int64_t start = m_clock.getTime();
+
+    this->buildNlistWith(*m_candidates[candidate], timestep);
+
+#ifdef ENABLE_HIP
+    if (this->m_exec_conf->isCUDAEnabled())
+        hipDeviceSynchronize();
+#endif
+    const double elapsed = double(m_clock.getTime() - start) * 1e-9;
+    m_trial_time[candidate] = std::min(m_trial_time[candidate], elapsed);
+    }
+
+/*! \param timestep Current time step
+ */
+template<class Base> void NeighborListAuto<Base>::finishSelection(uint64_t timestep)
+    {
+    m_selected = (unsigned int)(std::min_element(m_trial_time.begin(), m_trial_time.end())
+                                - m_trial_time.begin());
+    m_selecting = false;
+    m_selection_timestep = timestep;
+
+    this->m_exec_conf->msg->notice(4)
+        << "NeighborListAuto: selected candidate " << m_selected << " at step " << timestep
+        << std::endl;
+    }
+
+namespace detail
+    {
+//! Exports NeighborListAuto to python
+template<class Base>
+void export_NeighborListAuto(pybind11::module& m, const std::string& name)
+    {
+    typedef NeighborListAuto<Base> T;
+    pybind11::class_<T, Base, std::shared_ptr<T>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            Scalar,
+                            std::vector<std::shared_ptr<NeighborList>>>())
+        .def_property("selection_period", &T::getPeriod, &T::setPeriod)
+        .def_property_readonly("selected", &T::getSelected)
+        .def_property_readonly("selecting", &T::isSelecting)
+        .def_property_readonly("trial_times", &T::getTrialTimes);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __NEIGHBORLISTAUTO_H__
@@ -7,6 +7,9 @@
 
 #include "NeighborListBinned.h"
 
+#include <algorithm>
+#include <vector>
+
 #ifdef ENABLE_MPI
 #include "hoomd/Communicator.h"
 #endif
@@ -26,6 +29,8 @@ NeighborListBinned::NeighborListBinned(std::shared_ptr<SystemDefinition> sysdef,
     m_cl->setComputeXYZF(true);
     m_cl->setComputeTypeBody(false);
     m_cl->setFlagIndex();
+
+    m_exclusions_in_build = true;
     }
 
 NeighborListBinned::~NeighborListBinned()
@@ -48,6 +53,7 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
 
     uint3 dim = m_cl->getDim();
     Scalar3 ghost_width = m_cl->getGhostWidth();
+    const bool sparse = m_cl->getSparse();
 
     // acquire the particle data and box dimension
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
@@ -71,6 +77,19 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     ArrayHandle<unsigned int> h_cell_adj(m_cl->getCellAdjArray(),
                                          access_location::host,
                                          access_mode::read);
+    ArrayHandle<unsigned int> h_occupied_cells(m_cl->getOccupiedCellArray(),
+                                               access_location::host,
+                                               access_mode::read);
+    ArrayHandle<unsigned int> h_occupied_cell_start(m_cl->getOccupiedCellStartArray(),
+                                                    access_location::host,
+                                                    access_mode::read);
+    const unsigned int n_occupied_cells = m_cl->getNumOccupiedCells();
+
+    // access the exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
 
     // access the neighbor list data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
@@ -89,93 +108,317 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // get periodic flags
     uchar3 periodic = box.getPeriodic();
 
+    // the sparse cell list has no adjacency list, neighboring cells are found for each particle
+    const int rk = m_sysdef->getNDimensions() == 2 ? 0 : 1;
+
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
+    buildInParallel(
+        nparticles,
+        h_conditions.data,
+        [&](unsigned int begin, unsigned int end, unsigned int* conditions)
         {
-        unsigned int cur_n_neigh = 0;
+            std::vector<unsigned int> neigh_cells;
+            for (int i = (int)begin; i < (int)end; i++)
+                {
+                unsigned int cur_n_neigh = 0;
+
+                const Scalar3 my_pos
+                    = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+                const unsigned int body_i = h_body.data[i];
+
+                const unsigned int Nmax_i = h_Nmax.data[type_i];
+                const size_t head_idx_i = h_head_list.data[i];
+
+                // find the bin each particle belongs in
+                Scalar3 f = box.makeFraction(my_pos, ghost_width);
+                int ib = (unsigned int)(f.x * dim.x);
+                int jb = (unsigned int)(f.y * dim.y);
+                int kb = (unsigned int)(f.z * dim.z);
+
+                // need to handle the case where the particle is exactly at the box hi
+                if (ib == (int)dim.x && periodic.x)
+                    ib = 0;
+                if (jb == (int)dim.y && periodic.y)
+                    jb = 0;
+                if (kb == (int)dim.z && periodic.z)
+                    kb = 0;
+
+                // identify the bin
+                unsigned int my_cell = ci(ib, jb, kb);
+
+                unsigned int n_adj = cadji.getW();
+                if (sparse)
+                    {
+                    // list each neighboring bin once, as initializeCellAdj() does
+                    neigh_cells.clear();
+                    for (int nk = kb - rk; nk <= kb + rk; nk++)
+                        for (int nj = jb - 1; nj <= jb + 1; nj++)
+                            for (int ni = ib - 1; ni <= ib + 1; ni++)
+                                {
+                                neigh_cells.push_back(ci((ni + dim.x) % dim.x,
+                                                         (nj + dim.y) % dim.y,
+                                                         (nk + dim.z) % dim.z));
+                                }
+                    std::sort(neigh_cells.begin(), neigh_cells.end());
+                    neigh_cells.erase(std::unique(neigh_cells.begin(), neigh_cells.end()),
+                                      neigh_cells.end());
+                    n_adj = static_cast<unsigned int>(neigh_cells.size());
+                    }
+
+                // loop through all neighboring bins
+                for (unsigned int cur_adj = 0; cur_adj < n_adj; cur_adj++)
+                    {
+                    // find the entries of the neighboring bin
+                    unsigned int first;
+                    unsigned int size;
+                    if (sparse)
+                        {
+                        unsigned int k = CellList::findOccupiedCell(h_occupied_cells.data,
+                                                                    n_occupied_cells,
+                                                                    neigh_cells[cur_adj]);
+                        if (k == n_occupied_cells)
+                            continue;
+                        first = h_occupied_cell_start.data[k];
+                        size = h_occupied_cell_start.data[k + 1] - first;
+                        }
+                    else
+                        {
+                        unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+                        first = cli(0, neigh_cell);
+                        size = h_cell_size.data[neigh_cell];
+                        }
+
+                    // check against all the particles in that neighboring bin to see if it is a
+                    // neighbor
+                    for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+                        {
+                        Scalar4& cur_xyzf = h_cell_xyzf.data[first + cur_offset];
+                        unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
+
+                        // get the current neighbor type from the position data (will use TypeBody
+                        // on the GPU)
+                        unsigned int cur_neigh_type = __scalar_as_int(h_pos.data[cur_neigh].w);
+                        Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
+
+                        // automatically exclude particles without a distance check when:
+                        // (1) they are the same particle, or
+                        // (2) the r_cut(i,j) indicates to skip, or
+                        // (3) they are in the same body
+                        bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
+                        if (m_filter_body && body_i != NO_BODY)
+                            excluded = excluded | (body_i == h_body.data[cur_neigh]);
+                        if (excluded)
+                            continue;
+
+                        Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
+                        Scalar3 dx = my_pos - neigh_pos;
+                        dx = box.minImage(dx);
+
+                        Scalar dr_sq = dot(dx, dx);
+
+                        Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
+                        if (dr_sq <= r_listsq && !excluded)
+                            {
+                            // apply the explicit exclusions only to pairs within range
+                            if (m_exclusions_set
+                                && isExcluded(h_n_ex_idx.data, h_ex_list_idx.data, i, cur_neigh))
+                                continue;
+
+                            // Add the neighbor index to the list.
+                            if (m_storage_mode == full || i < (int)cur_neigh)
+                                {
+                                // local neighbor
+                                if (cur_n_neigh < Nmax_i)
+                                    {
+                                    h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                    }
+                                else
+                                    conditions[type_i]
+                                        = max(conditions[type_i], cur_n_neigh + 1);
+
+                                cur_n_neigh++;
+                                }
+                            }
+                        }
+                    }
+
+                h_n_neigh.data[i] = cur_n_neigh;
+                }
+        });
+    }
+
+/*! \param timestep Current time step
+    \param moved Indices of the particles that moved half of their buffer
+
+    Searches the cells within two cells of each moved particle. The cells are at least r_list wide,
+    and the widened search radius r_list(i,m) + d_i is less than r_list + r_buff / 2, so two cells
+    cover it.
+
+    \returns false when the cell list is too small for the search, is sparse, or when a row would
+    overflow
+*/
+bool NeighborListBinned::buildIncremental(uint64_t timestep, const std::vector<unsigned int>& moved)
+    {
+    if (m_update_cell_size || m_cl->getSparse())
+        return false;
+
+    m_cl->compute(timestep);
+
+    // each cell may only be visited once by the 5x5x5 search
+    const uint3 dim = m_cl->getDim();
+    const bool is_2d = m_sysdef->getNDimensions() == 2;
+    if (dim.x < 5 || dim.y < 5 || (!is_2d && dim.z < 5))
+        return false;
+    const int search_z = is_2d ? 0 : 2;
+
+    Scalar3 ghost_width = m_cl->getGhostWidth();
+
+    // acquire the particle data and box dimension
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    // access the rlist data
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
 
-        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int body_i = h_body.data[i];
+    // access the cell list data arrays
+    ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    // access the exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
 
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
+    // access the neighbor list data
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::readwrite);
+
+    Index3D ci = m_cl->getCellIndexer();
+    Index2D cli = m_cl->getCellListIndexer();
+
+    const unsigned int N = m_pdata->getN();
+    std::vector<bool> is_moved(N, false);
+    for (unsigned int m : moved)
+        {
+        is_moved[m] = true;
+        h_n_neigh.data[m] = 0;
+        }
+
+    // append j to the row of i unless it is already there
+    auto add_neighbor = [&](unsigned int i, unsigned int j)
+    {
         const size_t head_idx_i = h_head_list.data[i];
+        const unsigned int n_neigh_i = h_n_neigh.data[i];
+        for (unsigned int k = 0; k < n_neigh_i; k++)
+            {
+            if (h_nlist.data[head_idx_i + k] == j)
+                return true;
+            }
+
+        if (n_neigh_i >= h_Nmax.data[__scalar_as_int(h_pos.data[i].w)])
+            return false;
+
+        h_nlist.data[head_idx_i + n_neigh_i] = j;
+        h_n_neigh.data[i] = n_neigh_i + 1;
+        return true;
+    };
 
-        // find the bin each particle belongs in
+    for (unsigned int m : moved)
+        {
+        const Scalar3 my_pos = make_scalar3(h_pos.data[m].x, h_pos.data[m].y, h_pos.data[m].z);
+        const unsigned int type_m = __scalar_as_int(h_pos.data[m].w);
+        const unsigned int body_m = h_body.data[m];
+
+        // find the bin the particle belongs in
         Scalar3 f = box.makeFraction(my_pos, ghost_width);
         int ib = (unsigned int)(f.x * dim.x);
         int jb = (unsigned int)(f.y * dim.y);
         int kb = (unsigned int)(f.z * dim.z);
+        ib = std::min(ib, (int)dim.x - 1);
+        jb = std::min(jb, (int)dim.y - 1);
+        kb = std::min(kb, (int)dim.z - 1);
 
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)dim.z && periodic.z)
-            kb = 0;
+        for (int dk = -search_z; dk <= search_z; dk++)
+            for (int dj = -2; dj <= 2; dj++)
+                for (int di = -2; di <= 2; di++)
+                    {
+                    unsigned int neigh_cell = ci((ib + di + dim.x) % dim.x,
+                                                 (jb + dj + dim.y) % dim.y,
+                                                 (kb + dk + dim.z) % dim.z);
 
-        // identify the bin
-        unsigned int my_cell = ci(ib, jb, kb);
+                    unsigned int size = h_cell_size.data[neigh_cell];
+                    for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+                        {
+                        Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
+                        unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
+                        unsigned int cur_neigh_type = __scalar_as_int(h_pos.data[cur_neigh].w);
+                        unsigned int typpair = m_typpair_idx(type_m, cur_neigh_type);
+
+                        // apply the same exclusions as buildNlist() and filterNlist()
+                        bool excluded = (m == cur_neigh) || (h_r_cut.data[typpair] <= Scalar(0.0));
+                        if (m_filter_body && body_m != NO_BODY)
+                            excluded = excluded | (body_m == h_body.data[cur_neigh]);
+                        if (m_exclusions_set && !excluded)
+                            excluded
+                                = isExcluded(h_n_ex_idx.data, h_ex_list_idx.data, m, cur_neigh);
+                        if (excluded)
+                            continue;
+
+                        // widen the radius by the displacement the neighbor has already used
+                        Scalar d_neigh = Scalar(0.0);
+                        if (!is_moved[cur_neigh])
+                            {
+                            Scalar3 d = make_scalar3(
+                                h_pos.data[cur_neigh].x - h_last_pos.data[cur_neigh].x,
+                                h_pos.data[cur_neigh].y - h_last_pos.data[cur_neigh].y,
+                                h_pos.data[cur_neigh].z - h_last_pos.data[cur_neigh].z);
+                            d = box.minImage(d);
+                            d_neigh = fast::sqrt(dot(d, d));
+                            }
+                        Scalar r_search = fast::sqrt(h_r_listsq.data[typpair]) + d_neigh;
 
-        // loop through all neighboring bins
-        for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
-            {
-            unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+                        Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
+                        Scalar3 dx = box.minImage(my_pos - neigh_pos);
+                        if (dot(dx, dx) > r_search * r_search)
+                            continue;
 
-            // check against all the particles in that neighboring bin to see if it is a neighbor
-            unsigned int size = h_cell_size.data[neigh_cell];
-            for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
-                {
-                Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
-
-                // get the current neighbor type from the position data (will use TypeBody on the
-                // GPU)
-                unsigned int cur_neigh_type = __scalar_as_int(h_pos.data[cur_neigh].w);
-                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
-
-                // automatically exclude particles without a distance check when:
-                // (1) they are the same particle, or
-                // (2) the r_cut(i,j) indicates to skip, or
-                // (3) they are in the same body
-                bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
-                if (m_filter_body && body_i != NO_BODY)
-                    excluded = excluded | (body_i == h_body.data[cur_neigh]);
-                if (excluded)
-                    continue;
-
-                Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
-                Scalar3 dx = my_pos - neigh_pos;
-                dx = box.minImage(dx);
-
-                Scalar dr_sq = dot(dx, dx);
-
-                Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
-                if (dr_sq <= r_listsq && !excluded)
-                    {
-                    // Add the neighbor index to the list.
-                    if (m_storage_mode == full || i < (int)cur_neigh)
-                        {
-                        // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        bool added = true;
+                        if (m_storage_mode == full)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            added = add_neighbor(m, cur_neigh) && add_neighbor(cur_neigh, m);
+                            }
+                        else if (m < cur_neigh)
+                            {
+                            added = add_neighbor(m, cur_neigh);
                             }
                         else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
+                            {
+                            added = add_neighbor(cur_neigh, m);
+                            }
 
-                        cur_n_neigh++;
+                        if (!added)
+                            return false;
                         }
                     }
-                }
-            }
-
-        h_n_neigh.data[i] = cur_n_neigh;
         }
+
+    return true;
     }
 
 namespace detail
@@ -189,6 +432,7 @@ void export_NeighborListBinned(pybind11::module& m)
         .def_property("deterministic",
                       &NeighborListBinned::getDeterministic,
                       &NeighborListBinned::setDeterministic)
+        .def_property("sparse", &NeighborListBinned::getSparse, &NeighborListBinned::setSparse)
         .def("getDim",
              &NeighborListBinned::getDim,
              pybind11::return_value_policy::reference_internal)
@@ -54,6 +54,18 @@ class PYBIND11_EXPORT NeighborListBinned : public NeighborList
         return m_cl->getSortCellList();
         }
 
+    /// Store only the occupied cells of the cell list
+    void setSparse(bool sparse)
+        {
+        m_cl->setSparse(sparse);
+        }
+
+    /// Get the sparse flag
+    bool getSparse() const
+        {
+        return m_cl->getSparse();
+        }
+
     /// Get the dimensions of the cell list
     const uint3& getDim() const
         {
@@ -74,6 +86,9 @@ class PYBIND11_EXPORT NeighborListBinned : public NeighborList
 
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
+
+    //! Patch the neighbor list for the moved particles
+    virtual bool buildIncremental(uint64_t timestep, const std::vector<unsigned int>& moved);
     };
 
     } // end namespace md
@@ -0,0 +1,436 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListBody.cc
+    \brief Defines NeighborListBody
+*/
+
+#include "NeighborListBody.h"
+#include "hoomd/ThreadPool.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListBody::NeighborListBody(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
+    : NeighborList(sysdef, r_buff)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListBody" << endl;
+
+    m_exclusions_in_build = true;
+    }
+
+NeighborListBody::~NeighborListBody()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListBody" << endl;
+    }
+
+/*! The members of a unit are at most half of the box apart (the rigid body constraint requires
+    this), so the minimum image offsets from the first member give the unwrapped positions of all
+    members.
+*/
+void NeighborListBody::buildUnits()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+    const unsigned int n_total = m_pdata->getN() + m_pdata->getNGhosts();
+
+    m_particle_unit.resize(n_total);
+    m_unit_start.clear();
+    m_unit_members.clear();
+    m_body_idx.clear();
+
+    // particles without a body are units by themselves
+    for (unsigned int idx = 0; idx < n_total; idx++)
+        {
+        if (m_filter_body && h_body.data[idx] != NO_BODY)
+            {
+            m_body_idx.push_back(std::make_pair(h_body.data[idx], idx));
+            continue;
+            }
+
+        m_particle_unit[idx] = (unsigned int)m_unit_start.size();
+        m_unit_start.push_back((unsigned int)m_unit_members.size());
+        m_unit_members.push_back(idx);
+        }
+
+    // the particles of each body form one unit
+    std::sort(m_body_idx.begin(), m_body_idx.end());
+    for (size_t k = 0; k < m_body_idx.size(); k++)
+        {
+        if (k == 0 || m_body_idx[k].first != m_body_idx[k - 1].first)
+            m_unit_start.push_back((unsigned int)m_unit_members.size());
+
+        m_particle_unit[m_body_idx[k].second] = (unsigned int)m_unit_start.size() - 1;
+        m_unit_members.push_back(m_body_idx[k].second);
+        }
+
+    const unsigned int n_units = (unsigned int)m_unit_start.size();
+    m_unit_start.push_back((unsigned int)m_unit_members.size());
+
+    // bound each unit by a sphere around the mean position of its members
+    m_unit_sphere.resize(n_units);
+    for (unsigned int u = 0; u < n_units; u++)
+        {
+        const unsigned int begin = m_unit_start[u];
+        const unsigned int end = m_unit_start[u + 1];
+
+        const Scalar4 p0 = h_pos.data[m_unit_members[begin]];
+        const Scalar3 ref = make_scalar3(p0.x, p0.y, p0.z);
+        Scalar3 center = ref;
+        if (end - begin > 1)
+            {
+            Scalar3 sum = make_scalar3(0, 0, 0);
+            for (unsigned int k = begin + 1; k < end; k++)
+                {
+                const Scalar4 p = h_pos.data[m_unit_members[k]];
+                sum += box.minImage(make_scalar3(p.x, p.y, p.z) - ref);
+                }
+            center = ref + sum / Scalar(end - begin);
+            }
+
+        Scalar radius_sq = Scalar(0.0);
+        for (unsigned int k = begin; k < end && end - begin > 1; k++)
+            {
+            const Scalar4 p = h_pos.data[m_unit_members[k]];
+            const Scalar3 dx = box.minImage(make_scalar3(p.x, p.y, p.z) - center);
+            radius_sq = std::max(radius_sq, dot(dx, dx));
+            }
+
+        m_unit_sphere[u] = make_scalar4(center.x, center.y, center.z, sqrt(radius_sq));
+        }
+    }
+
+/*! The unit centers are binned in fractional coordinates with bins at least r_list_max +
+    2 R_max wide, so all pairs of units within range are in the same or adjacent bins. The bins
+    span the box in periodic directions and the range of the centers in the others.
+*/
+void NeighborListBody::buildUnitNlist(Scalar r_list_max)
+    {
+    const BoxDim& box = m_pdata->getBox();
+    const uchar3 periodic = box.getPeriodic();
+    const Scalar3 L = box.getNearestPlaneDistance();
+    const unsigned int n_units = (unsigned int)m_unit_sphere.size();
+
+    Scalar radius_max = Scalar(0.0);
+    for (unsigned int u = 0; u < n_units; u++)
+        radius_max = std::max(radius_max, m_unit_sphere[u].w);
+    const Scalar width = r_list_max + Scalar(2.0) * radius_max;
+
+    // fractional coordinates of the centers, wrapped into the box in periodic directions
+    std::vector<Scalar3> f(n_units);
+    Scalar3 f_lo = make_scalar3(0, 0, 0);
+    Scalar3 f_hi = make_scalar3(1, 1, 1);
+    for (unsigned int u = 0; u < n_units; u++)
+        {
+        const Scalar4 s = m_unit_sphere[u];
+        Scalar3 f_u = box.makeFraction(make_scalar3(s.x, s.y, s.z));
+        if (periodic.x)
+            f_u.x -= floor(f_u.x);
+        if (periodic.y)
+            f_u.y -= floor(f_u.y);
+        if (periodic.z)
+            f_u.z -= floor(f_u.z);
+        f[u] = f_u;
+
+        if (u == 0)
+            {
+            f_lo = f_u;
+            f_hi = f_u;
+            }
+        f_lo = make_scalar3(std::min(f_lo.x, f_u.x),
+                            std::min(f_lo.y, f_u.y),
+                            std::min(f_lo.z, f_u.z));
+        f_hi = make_scalar3(std::max(f_hi.x, f_u.x),
+                            std::max(f_hi.y, f_u.y),
+                            std::max(f_hi.z, f_u.z));
+        }
+    if (periodic.x)
+        {
+        f_lo.x = 0;
+        f_hi.x = 1;
+        }
+    if (periodic.y)
+        {
+        f_lo.y = 0;
+        f_hi.y = 1;
+        }
+    if (periodic.z)
+        {
+        f_lo.z = 0;
+        f_hi.z = 1;
+        }
+
+    auto n_bins = [&](Scalar extent, Scalar length)
+    {
+        if (width <= Scalar(0.0))
+            return 1u;
+        return std::max(1u, (unsigned int)(extent * length / width));
+    };
+    uint3 dim = make_uint3(n_bins(f_hi.x - f_lo.x, L.x),
+                           n_bins(f_hi.y - f_lo.y, L.y),
+                           n_bins(f_hi.z - f_lo.z, L.z));
+    if (m_sysdef->getNDimensions() == 2)
+        dim.z = 1;
+    const unsigned int n_bins_total = dim.x * dim.y * dim.z;
+
+    auto bin_1d = [](Scalar f_u, Scalar lo, Scalar hi, unsigned int n)
+    {
+        if (hi <= lo)
+            return 0u;
+        return std::min((unsigned int)((f_u - lo) / (hi - lo) * Scalar(n)), n - 1);
+    };
+
+    // sort the units by bin
+    m_unit_bin.resize(n_units);
+    m_bin_start.assign(n_bins_total + 1, 0);
+    for (unsigned int u = 0; u < n_units; u++)
+        {
+        const unsigned int b = (bin_1d(f[u].z, f_lo.z, f_hi.z, dim.z) * dim.y
+                                + bin_1d(f[u].y, f_lo.y, f_hi.y, dim.y))
+                                   * dim.x
+                               + bin_1d(f[u].x, f_lo.x, f_hi.x, dim.x);
+        m_unit_bin[u] = b;
+        m_bin_start[b + 1]++;
+        }
+    for (unsigned int b = 0; b < n_bins_total; b++)
+        m_bin_start[b + 1] += m_bin_start[b];
+    m_bin_units.resize(n_units);
+    std::vector<unsigned int> bin_fill(m_bin_start.begin(), m_bin_start.end() - 1);
+    for (unsigned int u = 0; u < n_units; u++)
+        m_bin_units[bin_fill[m_unit_bin[u]]++] = u;
+
+    // the bins adjacent to b in one direction, each listed once
+    auto adjacent = [](unsigned int b, unsigned int n, bool is_periodic, unsigned int* out)
+    {
+        unsigned int count = 0;
+        if (n < 3)
+            {
+            for (unsigned int k = 0; k < n; k++)
+                out[count++] = k;
+            return count;
+            }
+        for (int d = -1; d <= 1; d++)
+            {
+            int c = int(b) + d;
+            if (is_periodic)
+                c = (c + int(n)) % int(n);
+            else if (c < 0 || c >= int(n))
+                continue;
+            out[count++] = (unsigned int)c;
+            }
+        return count;
+    };
+
+    // call visit(v) for each unit v within range of unit u
+    auto for_each_neighbor = [&](unsigned int u, auto&& visit)
+    {
+        const Scalar4 s_u = m_unit_sphere[u];
+        const Scalar3 c_u = make_scalar3(s_u.x, s_u.y, s_u.z);
+        const unsigned int b = m_unit_bin[u];
+        const unsigned int ib = b % dim.x;
+        const unsigned int jb = (b / dim.x) % dim.y;
+        const unsigned int kb = b / (dim.x * dim.y);
+
+        unsigned int adj_x[3], adj_y[3], adj_z[3];
+        const unsigned int n_x = adjacent(ib, dim.x, periodic.x, adj_x);
+        const unsigned int n_y = adjacent(jb, dim.y, periodic.y, adj_y);
+        const unsigned int n_z = adjacent(kb, dim.z, periodic.z, adj_z);
+
+        for (unsigned int z = 0; z < n_z; z++)
+            for (unsigned int y = 0; y < n_y; y++)
+                for (unsigned int x = 0; x < n_x; x++)
+                    {
+                    const unsigned int neigh_bin = (adj_z[z] * dim.y + adj_y[y]) * dim.x + adj_x[x];
+                    for (unsigned int k = m_bin_start[neigh_bin]; k < m_bin_start[neigh_bin + 1];
+                         k++)
+                        {
+                        const unsigned int v = m_bin_units[k];
+                        if (v == u)
+                            continue;
+
+                        const Scalar4 s_v = m_unit_sphere[v];
+                        const Scalar3 dx
+                            = box.minImage(c_u - make_scalar3(s_v.x, s_v.y, s_v.z));
+                        const Scalar r = s_u.w + s_v.w + r_list_max;
+                        if (dot(dx, dx) <= r * r)
+                            visit(v);
+                        }
+                    }
+    };
+
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+
+    // count the neighbors of each unit, then fill the lists
+    m_unit_nlist_start.assign(n_units + 1, 0);
+    pool.parallelFor(n_units,
+                     [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+                     {
+                         for (unsigned int u = begin; u < end; u++)
+                             {
+                             unsigned int count = 0;
+                             for_each_neighbor(u, [&](unsigned int v) { count++; });
+                             m_unit_nlist_start[u + 1] = count;
+                             }
+                     });
+    for (unsigned int u = 0; u < n_units; u++)
+        m_unit_nlist_start[u + 1] += m_unit_nlist_start[u];
+
+    m_unit_nlist.resize(m_unit_nlist_start[n_units]);
+    pool.parallelFor(n_units,
+                     [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+                     {
+                         for (unsigned int u = begin; u < end; u++)
+                             {
+                             unsigned int k = m_unit_nlist_start[u];
+                             for_each_neighbor(u, [&](unsigned int v) { m_unit_nlist[k++] = v; });
+                             }
+                     });
+    }
+
+void NeighborListBody::buildNlist(uint64_t timestep)
+    {
+    const unsigned int n_types = m_pdata->getNTypes();
+
+    // largest r_list of each type
+    std::vector<Scalar> r_list_type(n_types, Scalar(0.0));
+    Scalar r_list_max = Scalar(0.0);
+        {
+        ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < n_types; i++)
+            {
+            for (unsigned int j = 0; j < n_types; j++)
+                {
+                if (h_r_cut.data[m_typpair_idx(i, j)] > Scalar(0.0))
+                    r_list_type[i]
+                        = std::max(r_list_type[i], sqrt(h_r_listsq.data[m_typpair_idx(i, j)]));
+                }
+            r_list_max = std::max(r_list_max, r_list_type[i]);
+            }
+        }
+
+    buildUnits();
+    buildUnitNlist(r_list_max);
+
+    // acquire the particle data and box dimension
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    // access the rlist data
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    // access the exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    // access the neighbor list data
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
+
+    // for each local particle
+    unsigned int nparticles = m_pdata->getN();
+
+    buildInParallel(
+        nparticles,
+        h_conditions.data,
+        [&](unsigned int begin, unsigned int end, unsigned int* conditions)
+        {
+            for (unsigned int i = begin; i < end; i++)
+                {
+                unsigned int cur_n_neigh = 0;
+
+                const Scalar3 my_pos
+                    = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+                const Scalar r_list_i = r_list_type[type_i];
+
+                const unsigned int Nmax_i = h_Nmax.data[type_i];
+                const size_t head_idx_i = h_head_list.data[i];
+
+                // the members of i's own unit are in the same body and never neighbors
+                const unsigned int unit_i = m_particle_unit[i];
+                for (unsigned int k = m_unit_nlist_start[unit_i];
+                     k < m_unit_nlist_start[unit_i + 1] && r_list_i > Scalar(0.0);
+                     k++)
+                    {
+                    const unsigned int unit_j = m_unit_nlist[k];
+
+                    // skip the units that are out of range of particle i
+                    const Scalar4 s_j = m_unit_sphere[unit_j];
+                    const Scalar3 dc = box.minImage(my_pos - make_scalar3(s_j.x, s_j.y, s_j.z));
+                    const Scalar r_unit = s_j.w + r_list_i;
+                    if (dot(dc, dc) > r_unit * r_unit)
+                        continue;
+
+                    for (unsigned int m = m_unit_start[unit_j]; m < m_unit_start[unit_j + 1]; m++)
+                        {
+                        const unsigned int j = m_unit_members[m];
+                        if (m_storage_mode == half && j < i)
+                            continue;
+
+                        const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+                        const unsigned int typpair = m_typpair_idx(type_i, type_j);
+                        if (h_r_cut.data[typpair] <= Scalar(0.0))
+                            continue;
+
+                        const Scalar4 pos_j = h_pos.data[j];
+                        const Scalar3 dx
+                            = box.minImage(my_pos - make_scalar3(pos_j.x, pos_j.y, pos_j.z));
+                        if (dot(dx, dx) > h_r_listsq.data[typpair])
+                            continue;
+
+                        // apply the explicit exclusions only to pairs within range
+                        if (m_exclusions_set
+                            && isExcluded(h_n_ex_idx.data, h_ex_list_idx.data, i, j))
+                            continue;
+
+                        if (cur_n_neigh < Nmax_i)
+                            h_nlist.data[head_idx_i + cur_n_neigh] = j;
+                        else
+                            conditions[type_i] = max(conditions[type_i], cur_n_neigh + 1);
+
+                        cur_n_neigh++;
+                        }
+                    }
+
+                // the row order follows the units, sort it so it does not depend on the body ids
+                if (cur_n_neigh <= Nmax_i)
+                    std::sort(h_nlist.data + head_idx_i, h_nlist.data + head_idx_i + cur_n_neigh);
+
+                h_n_neigh.data[i] = cur_n_neigh;
+                }
+        });
+    }
+
+namespace detail
+    {
+void export_NeighborListBody(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListBody, NeighborList, std::shared_ptr<NeighborListBody>>(
+        m,
+        "NeighborListBody")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property_readonly("num_units", &NeighborListBody::getNUnits);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,90 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+
+/*! \file NeighborListBody.h
+    \brief Declares the NeighborListBody class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#include <vector>
+
+#ifndef __NEIGHBORLISTBODY_H__
+#define __NEIGHBORLISTBODY_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list build on the CPU that searches body pairs before particle pairs
+/*! When particles in the same body are filtered (setFilterBody()), NeighborListBody groups the
+    local and ghost particles into units: all particles with the same body id form one unit and
+    every other particle is a unit by itself. Each unit is bounded by the sphere around the mean
+    of its members' positions that contains them all.
+
+    The build first lists the pairs of units whose spheres are closer than the largest r_list,
+    binning the unit centers in cells at least r_list + 2 R_max wide. The row of each particle i
+    is then filled from the members of the neighboring units of its own unit, skipping any unit
+    whose sphere is further than the largest r_list of i's type from i. The members of i's own
+    unit are never visited. For large rigid bodies, this removes the intra-body pairs and most of
+    the inter-body pairs from the search, which a particle-level build visits and then discards.
+
+    Without the body filter, every particle is a unit and the build is a cell list build over
+    single particles. The rows are sorted by index, so the list does not depend on the order of
+    the bodies.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListBody : public NeighborList
+    {
+    public:
+    //! Constructs the compute
+    NeighborListBody(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListBody();
+
+    //! Get the number of units in the last build
+    unsigned int getNUnits() const
+        {
+        return (unsigned int)m_unit_sphere.size();
+        }
+
+    protected:
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    private:
+    //! Group the local and ghost particles into units and compute their bounding spheres
+    void buildUnits();
+
+    //! List the pairs of units within range
+    /*! \param r_list_max Largest r_list of all type pairs
+     */
+    void buildUnitNlist(Scalar r_list_max);
+
+    std::vector<unsigned int> m_unit_start;    //!< Start of each unit in m_unit_members
+    std::vector<unsigned int> m_unit_members;  //!< Particle indices of all units
+    std::vector<unsigned int> m_particle_unit; //!< Unit of each particle
+    std::vector<Scalar4> m_unit_sphere;        //!< Bounding sphere of each unit (center, radius)
+
+    std::vector<unsigned int> m_unit_nlist_start; //!< Start of each unit in m_unit_nlist
+    std::vector<unsigned int> m_unit_nlist;       //!< Neighboring units of all units
+
+    std::vector<unsigned int> m_unit_bin;  //!< Bin of each unit
+    std::vector<unsigned int> m_bin_start; //!< Start of each bin in m_bin_units
+    std::vector<unsigned int> m_bin_units; //!< Units sorted by bin
+
+    std::vector<std::pair<unsigned int, unsigned int>> m_body_idx; //!< (body, index) for sorting
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __NEIGHBORLIST_CLUSTER_H__
+#define __NEIGHBORLIST_CLUSTER_H__
+
+#include "hoomd/HOOMDMath.h"
+
+#include <stdint.h>
+
+/*! \file NeighborListCluster.h
+    \brief Defines the layout of the cluster pair neighbor list
+
+    Cluster I holds the particles I * NLIST_CLUSTER_SIZE ... (I + 1) * NLIST_CLUSTER_SIZE - 1.
+    After a particle sort, consecutive particles are close in space, so the clusters are compact.
+    Each i cluster lists the j clusters that hold a neighbor of any of its particles. The mask of a
+    cluster pair has bit a * NLIST_CLUSTER_SIZE + b set when particle b of the j cluster is in the
+    neighbor list of particle a of the i cluster.
+
+    The list of cluster I starts at the head list entry of its first particle. It never holds more
+    entries than the neighbor lists of its particles, so it fits in the same storage.
+*/
+
+// need to declare these functions with __device__ qualifiers when building in nvcc
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Number of particles in a cluster
+const unsigned int NLIST_CLUSTER_SIZE = 8;
+
+//! Get the bit of a cluster pair mask
+/*! \param a Index of the particle in the i cluster
+    \param b Index of the particle in the j cluster
+    \returns The mask with only the bit of the pair (a, b) set
+*/
+HOSTDEVICE inline uint64_t clusterPairBit(unsigned int a, unsigned int b)
+    {
+    return uint64_t(1) << (a * NLIST_CLUSTER_SIZE + b);
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
+
+// undefine HOSTDEVICE so we don't interfere with other headers
+#undef HOSTDEVICE
+
+#endif // __NEIGHBORLIST_CLUSTER_H__
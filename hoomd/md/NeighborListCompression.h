@@ -0,0 +1,99 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __NEIGHBORLIST_COMPRESSION_H__
+#define __NEIGHBORLIST_COMPRESSION_H__
+
+#include "hoomd/HOOMDMath.h"
+
+#include <stdint.h>
+
+/*! \file NeighborListCompression.h
+    \brief Encodes and decodes the compressed neighbor offsets
+
+    The offset of neighbor j of particle i is stored as the 16-bit value j - i. Offsets that do not
+    fit are stored as NLIST_OFFSET_ESCAPE and the neighbor is read from the full 32-bit list.
+*/
+
+// need to declare these functions with __device__ qualifiers when building in nvcc
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Offset marking neighbors that must be read from the full neighbor list
+const int16_t NLIST_OFFSET_ESCAPE = -32768;
+
+//! Encode neighbor j of particle i
+/*! \param i Index of the particle owning the list
+    \param j Index of the neighbor
+    \returns j - i, or NLIST_OFFSET_ESCAPE when the offset does not fit
+*/
+HOSTDEVICE inline int16_t encodeNeighborOffset(unsigned int i, unsigned int j)
+    {
+    int64_t offset = int64_t(j) - int64_t(i);
+    if (offset > NLIST_OFFSET_ESCAPE && offset <= 32767)
+        {
+        return int16_t(offset);
+        }
+    return NLIST_OFFSET_ESCAPE;
+    }
+
+//! Decode an entry of the neighbor list
+/*! \param i Index of the particle owning the list
+    \param nlist Full neighbor list
+    \param nlist_offsets Compressed neighbor offsets (may be null)
+    \param k Index of the entry in both lists
+    \returns The index of the neighbor
+*/
+HOSTDEVICE inline unsigned int
+decodeNeighbor(unsigned int i, const unsigned int* nlist, const int16_t* nlist_offsets, size_t k)
+    {
+    if (nlist_offsets != nullptr)
+        {
+        int16_t offset = nlist_offsets[k];
+        if (offset != NLIST_OFFSET_ESCAPE)
+            {
+            return (unsigned int)(int(i) + offset);
+            }
+        }
+    return nlist[k];
+    }
+
+#ifdef __HIPCC__
+//! Decode an entry of the neighbor list through the read-only data cache
+/*! \param i Index of the particle owning the list
+    \param d_nlist Full neighbor list
+    \param d_nlist_offsets Compressed neighbor offsets (may be null)
+    \param k Index of the entry in both lists
+    \returns The index of the neighbor
+*/
+__device__ inline unsigned int loadNeighbor(unsigned int i,
+                                            const unsigned int* d_nlist,
+                                            const int16_t* d_nlist_offsets,
+                                            size_t k)
+    {
+    if (d_nlist_offsets != nullptr)
+        {
+        int16_t offset = __ldg(d_nlist_offsets + k);
+        if (offset != NLIST_OFFSET_ESCAPE)
+            {
+            return (unsigned int)(int(i) + offset);
+            }
+        }
+    return __ldg(d_nlist + k);
+    }
+#endif
+
+    } // end namespace md
+    } // end namespace hoomd
+
+// undefine HOSTDEVICE so we don't interfere with other headers
+#undef HOSTDEVICE
+
+#endif // __NEIGHBORLIST_COMPRESSION_H__
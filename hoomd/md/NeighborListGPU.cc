@@ -40,15 +40,11 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
     BoxDim box = m_pdata->getBox();
     ArrayHandle<Scalar4> d_last_pos(m_last_pos, access_location::device, access_mode::read);
 
-    // get current global nearest plane distance
-    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
-
-    // Find direction of maximum box length contraction (smallest eigenvalue of deformation tensor)
-    Scalar3 lambda = L_g / m_last_L;
-    Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
-    lambda_min = (lambda_min < lambda.z) ? lambda_min : lambda.z;
+    // the largest contraction of any pair distance since the last update
+    const Scalar lambda_min = getMinStretch();
 
     ArrayHandle<Scalar> d_rcut_max(m_rcut_max, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_r_buff_type(m_r_buff_type, access_location::device, access_mode::read);
 
         {
         ArrayHandle<unsigned int> d_flags(m_flags, access_location::device, access_mode::readwrite);
@@ -60,11 +56,12 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
                                                  d_pos.data,
                                                  m_pdata->getN(),
                                                  box,
+                                                 m_last_box,
+                                                 m_pdata->getGlobalBox(),
                                                  d_rcut_max.data,
-                                                 m_r_buff,
+                                                 d_r_buff_type.data,
                                                  m_pdata->getNTypes(),
                                                  lambda_min,
-                                                 lambda,
                                                  ++m_checkn);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -125,6 +122,106 @@ void NeighborListGPU::filterNlist()
     m_tuner_filter->end();
     }
 
+/*! \param tier Index of the cutoff tier
+
+    Calls gpu_nlist_partition_tier() to order the neighbors of one tier on the GPU
+*/
+void NeighborListGPU::partitionTier(unsigned int tier)
+    {
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::readwrite);
+    ArrayHandle<Scalar> d_r_tiersq(m_r_tiersq, access_location::device, access_mode::read);
+
+    // a null array reads as 0 neighbors in the tiers before the first
+    GPUArray<unsigned int> no_tier;
+    ArrayHandle<unsigned int> d_tier_begin(tier > 0 ? *m_tier_n_neigh[tier - 1] : no_tier,
+                                           access_location::device,
+                                           access_mode::read);
+    ArrayHandle<unsigned int> d_tier_end(*m_tier_n_neigh[tier],
+                                         access_location::device,
+                                         access_mode::overwrite);
+
+    m_tuner_tier->begin();
+    kernel::gpu_nlist_partition_tier(d_nlist.data,
+                                     d_tier_end.data,
+                                     d_tier_begin.data,
+                                     d_n_neigh.data,
+                                     d_head_list.data,
+                                     d_pos.data,
+                                     d_r_tiersq.data + tier * m_typpair_idx.getNumElements(),
+                                     m_pdata->getBox(),
+                                     m_typpair_idx,
+                                     m_pdata->getN(),
+                                     m_tuner_tier->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_tier->end();
+    }
+
+/*! Calls gpu_nlist_compress() to encode the neighbor list offsets on the GPU
+ */
+void NeighborListGPU::compressNlist()
+    {
+    if (m_nlist_offsets.getNumElements() != m_nlist.getNumElements())
+        {
+        GPUArray<int16_t> nlist_offsets(m_nlist.getNumElements(), m_exec_conf);
+        m_nlist_offsets.swap(nlist_offsets);
+        }
+
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+    ArrayHandle<int16_t> d_nlist_offsets(m_nlist_offsets,
+                                         access_location::device,
+                                         access_mode::overwrite);
+
+    m_tuner_compress->begin();
+    kernel::gpu_nlist_compress(d_nlist_offsets.data,
+                               d_n_neigh.data,
+                               d_nlist.data,
+                               d_head_list.data,
+                               m_pdata->getN(),
+                               m_tuner_compress->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_compress->end();
+    }
+
+/*! Calls gpu_nlist_build_cluster_pairs() to build the cluster pair list on the GPU
+ */
+void NeighborListGPU::buildClusterPairs()
+    {
+    allocateClusterPairs();
+
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_cluster_n_neigh(m_cluster_n_neigh,
+                                                access_location::device,
+                                                access_mode::overwrite);
+    ArrayHandle<unsigned int> d_cluster_nlist(m_cluster_nlist,
+                                              access_location::device,
+                                              access_mode::overwrite);
+    ArrayHandle<uint64_t> d_cluster_mask(m_cluster_mask,
+                                         access_location::device,
+                                         access_mode::overwrite);
+
+    m_tuner_cluster->begin();
+    kernel::gpu_nlist_build_cluster_pairs(d_cluster_n_neigh.data,
+                                          d_cluster_nlist.data,
+                                          d_cluster_mask.data,
+                                          d_n_neigh.data,
+                                          d_nlist.data,
+                                          d_head_list.data,
+                                          m_pdata->getN(),
+                                          m_tuner_cluster->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_cluster->end();
+    }
+
 //! Update the exclusion list on the GPU
 void NeighborListGPU::updateExListIdx()
     {
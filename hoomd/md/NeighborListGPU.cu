@@ -9,6 +9,8 @@
     \brief Defines GPU kernel code for neighbor list processing on the GPU
 */
 
+#include "NeighborListCluster.h"
+#include "NeighborListCompression.h"
 #include "NeighborListGPU.cuh"
 
 #pragma GCC diagnostic push
@@ -28,11 +30,12 @@ namespace kernel
     \param d_pos Current particle positions
     \param nwork Number of particles this GPU processes
     \param box Box dimensions
+    \param last_global_box Global box at the last update
+    \param global_box Current global box
     \param d_rcut_max The maximum rcut(i,j) that any particle of type i participates in
-    \param r_buff The buffer size that particles can move in
+    \param d_r_buff The buffer size that particles of each type can move in
     \param ntypes The number of particle types
     \param lambda_min Minimum contraction of deformation tensor
-    \param lambda Diagonal deformation tensor (for orthorhombic boundaries)
     \param checkn
 
     gpu_nlist_needs_update_check_new_kernel() executes one thread per particle. Every particle's
@@ -44,11 +47,12 @@ __global__ void gpu_nlist_needs_update_check_new_kernel(unsigned int* d_result,
                                                         const Scalar4* d_pos,
                                                         const unsigned int nwork,
                                                         const BoxDim box,
+                                                        const BoxDim last_global_box,
+                                                        const BoxDim global_box,
                                                         const Scalar* d_rcut_max,
-                                                        const Scalar r_buff,
+                                                        const Scalar* d_r_buff,
                                                         const unsigned int ntypes,
                                                         const Scalar lambda_min,
-                                                        const Scalar3 lambda,
                                                         const unsigned int checkn)
     {
     // each thread will compare vs it's old position to see if the list needs updating
@@ -62,11 +66,12 @@ __global__ void gpu_nlist_needs_update_check_new_kernel(unsigned int* d_result,
         Scalar4 last_postype = d_last_pos[idx];
         Scalar3 last_pos = make_scalar3(last_postype.x, last_postype.y, last_postype.z);
 
-        Scalar3 dx = cur_pos - lambda * last_pos;
+        // subtract the affine deformation of the box
+        Scalar3 dx = cur_pos - global_box.makeCoordinates(last_global_box.makeFraction(last_pos));
         dx = box.minImage(dx);
 
         const Scalar rmin = __ldg(d_rcut_max + cur_type);
-        const Scalar rmax = rmin + r_buff;
+        const Scalar rmax = rmin + __ldg(d_r_buff + cur_type);
         const Scalar delta_max = (rmax * lambda_min - rmin) / Scalar(2.0);
         Scalar maxshiftsq = (delta_max > 0) ? delta_max * delta_max : 0.0f;
 
@@ -84,11 +89,12 @@ hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                                             const Scalar4* d_pos,
                                             const unsigned int N,
                                             const BoxDim& box,
+                                            const BoxDim& last_global_box,
+                                            const BoxDim& global_box,
                                             const Scalar* d_rcut_max,
-                                            const Scalar r_buff,
+                                            const Scalar* d_r_buff,
                                             const unsigned int ntypes,
                                             const Scalar lambda_min,
-                                            const Scalar3 lambda,
                                             const unsigned int checkn)
     {
     unsigned int block_size = 128;
@@ -106,11 +112,12 @@ hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                        d_pos,
                        nwork,
                        box,
+                       last_global_box,
+                       global_box,
                        d_rcut_max,
-                       r_buff,
+                       d_r_buff,
                        ntypes,
                        lambda_min,
-                       lambda,
                        checkn);
 
     return hipSuccess;
@@ -255,6 +262,248 @@ hipError_t gpu_nlist_filter(unsigned int* d_n_neigh,
     return hipSuccess;
     }
 
+/*! \param d_nlist Neighbor list to reorder
+    \param d_tier_end End of the tier in each row to write
+    \param d_tier_begin End of the previous tier in each row (NULL for the first tier)
+    \param d_n_neigh Number of neighbors for each particle
+    \param d_head_list Indexes for reading \a d_nlist
+    \param d_pos Particle positions
+    \param d_r_tiersq Squared radius of the tier by type pair
+    \param box Simulation box
+    \param typpair_idx Indexer for type pairs
+    \param N Number of particles
+
+    One thread is run for each particle and swaps the neighbors within the tier to the front of the
+    part of its row that is not in a previous tier.
+*/
+__global__ void gpu_nlist_partition_tier_kernel(unsigned int* d_nlist,
+                                                unsigned int* d_tier_end,
+                                                const unsigned int* d_tier_begin,
+                                                const unsigned int* d_n_neigh,
+                                                const size_t* d_head_list,
+                                                const Scalar4* d_pos,
+                                                const Scalar* d_r_tiersq,
+                                                const BoxDim box,
+                                                const Index2D typpair_idx,
+                                                const unsigned int N)
+    {
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    const Scalar4 postype_i = d_pos[idx];
+    const Scalar3 pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+    const unsigned int type_i = __scalar_as_int(postype_i.w);
+    unsigned int* row = d_nlist + d_head_list[idx];
+
+    const unsigned int n_neigh = d_n_neigh[idx];
+    unsigned int end = (d_tier_begin != NULL) ? d_tier_begin[idx] : 0;
+    for (unsigned int cur_neigh_idx = end; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+        {
+        const unsigned int j = row[cur_neigh_idx];
+        const Scalar4 postype_j = d_pos[j];
+        const Scalar3 dx
+            = box.minImage(pos_i - make_scalar3(postype_j.x, postype_j.y, postype_j.z));
+        const unsigned int type_j = __scalar_as_int(postype_j.w);
+
+        if (dot(dx, dx) <= d_r_tiersq[typpair_idx(type_i, type_j)])
+            {
+            row[cur_neigh_idx] = row[end];
+            row[end] = j;
+            end++;
+            }
+        }
+
+    d_tier_end[idx] = end;
+    }
+
+hipError_t gpu_nlist_partition_tier(unsigned int* d_nlist,
+                                    unsigned int* d_tier_end,
+                                    const unsigned int* d_tier_begin,
+                                    const unsigned int* d_n_neigh,
+                                    const size_t* d_head_list,
+                                    const Scalar4* d_pos,
+                                    const Scalar* d_r_tiersq,
+                                    const BoxDim& box,
+                                    const Index2D& typpair_idx,
+                                    const unsigned int N,
+                                    const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_partition_tier_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    int n_blocks = N / run_block_size + 1;
+
+    hipLaunchKernelGGL((gpu_nlist_partition_tier_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_nlist,
+                       d_tier_end,
+                       d_tier_begin,
+                       d_n_neigh,
+                       d_head_list,
+                       d_pos,
+                       d_r_tiersq,
+                       box,
+                       typpair_idx,
+                       N);
+
+    return hipSuccess;
+    }
+
+/*! \param d_nlist_offsets Compressed neighbor offsets to write
+    \param d_n_neigh Number of neighbors for each particle
+    \param d_nlist Neighbor list to encode
+    \param d_head_list Indexes for reading \a d_nlist
+    \param N Number of particles
+
+    One thread is run for each particle and encodes all of its neighbors.
+*/
+__global__ void gpu_nlist_compress_kernel(int16_t* d_nlist_offsets,
+                                          const unsigned int* d_n_neigh,
+                                          const unsigned int* d_nlist,
+                                          const size_t* d_head_list,
+                                          const unsigned int N)
+    {
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    const unsigned int n_neigh = d_n_neigh[idx];
+    const size_t my_head = d_head_list[idx];
+    for (unsigned int cur_neigh_idx = 0; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+        {
+        d_nlist_offsets[my_head + cur_neigh_idx]
+            = encodeNeighborOffset(idx, d_nlist[my_head + cur_neigh_idx]);
+        }
+    }
+
+hipError_t gpu_nlist_compress(int16_t* d_nlist_offsets,
+                              const unsigned int* d_n_neigh,
+                              const unsigned int* d_nlist,
+                              const size_t* d_head_list,
+                              const unsigned int N,
+                              const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_compress_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    int n_blocks = N / run_block_size + 1;
+
+    hipLaunchKernelGGL((gpu_nlist_compress_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_nlist_offsets,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N);
+
+    return hipSuccess;
+    }
+
+/*! \param d_cluster_n_neigh Number of j clusters of each i cluster to write
+    \param d_cluster_nlist j clusters of each i cluster to write
+    \param d_cluster_mask Masks of the neighboring pairs to write
+    \param d_n_neigh Number of neighbors for each particle
+    \param d_nlist Neighbor list
+    \param d_head_list Indexes for reading \a d_nlist
+    \param N Number of particles
+
+    One thread is run for each i cluster. The thread walks the neighbor lists of the particles in
+    the cluster and searches its own output for the cluster of each neighbor. The search is linear,
+    but the list of a compact cluster is short and it only runs once per build.
+*/
+__global__ void gpu_nlist_build_cluster_pairs_kernel(unsigned int* d_cluster_n_neigh,
+                                                     unsigned int* d_cluster_nlist,
+                                                     uint64_t* d_cluster_mask,
+                                                     const unsigned int* d_n_neigh,
+                                                     const unsigned int* d_nlist,
+                                                     const size_t* d_head_list,
+                                                     const unsigned int N)
+    {
+    const unsigned int cluster_i = blockDim.x * blockIdx.x + threadIdx.x;
+    const unsigned int first = cluster_i * NLIST_CLUSTER_SIZE;
+
+    if (first >= N)
+        return;
+
+    const size_t cluster_head = d_head_list[first];
+    unsigned int n_cluster_neigh = 0;
+
+    for (unsigned int a = 0; a < NLIST_CLUSTER_SIZE && first + a < N; a++)
+        {
+        const unsigned int n_neigh = d_n_neigh[first + a];
+        const size_t my_head = d_head_list[first + a];
+        for (unsigned int cur_neigh_idx = 0; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+            {
+            const unsigned int j = d_nlist[my_head + cur_neigh_idx];
+            const unsigned int cluster_j = j / NLIST_CLUSTER_SIZE;
+
+            unsigned int entry = 0;
+            while (entry < n_cluster_neigh && d_cluster_nlist[cluster_head + entry] != cluster_j)
+                entry++;
+
+            if (entry == n_cluster_neigh)
+                {
+                d_cluster_nlist[cluster_head + entry] = cluster_j;
+                d_cluster_mask[cluster_head + entry] = 0;
+                n_cluster_neigh++;
+                }
+
+            d_cluster_mask[cluster_head + entry] |= clusterPairBit(a, j % NLIST_CLUSTER_SIZE);
+            }
+        }
+
+    d_cluster_n_neigh[cluster_i] = n_cluster_neigh;
+    }
+
+hipError_t gpu_nlist_build_cluster_pairs(unsigned int* d_cluster_n_neigh,
+                                         unsigned int* d_cluster_nlist,
+                                         uint64_t* d_cluster_mask,
+                                         const unsigned int* d_n_neigh,
+                                         const unsigned int* d_nlist,
+                                         const size_t* d_head_list,
+                                         const unsigned int N,
+                                         const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_build_cluster_pairs_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    unsigned int n_clusters = (N + NLIST_CLUSTER_SIZE - 1) / NLIST_CLUSTER_SIZE;
+    int n_blocks = n_clusters / run_block_size + 1;
+
+    hipLaunchKernelGGL((gpu_nlist_build_cluster_pairs_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_cluster_n_neigh,
+                       d_cluster_nlist,
+                       d_cluster_mask,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N);
+
+    return hipSuccess;
+    }
+
 //! GPU kernel to update the exclusions list
 __global__ void gpu_update_exclusion_list_kernel(const unsigned int* tags,
                                                  const unsigned int* rtags,
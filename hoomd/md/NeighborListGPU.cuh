@@ -26,11 +26,12 @@ hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                                             const Scalar4* d_pos,
                                             const unsigned int N,
                                             const BoxDim& box,
+                                            const BoxDim& last_global_box,
+                                            const BoxDim& global_box,
                                             const Scalar* d_rcut_max,
-                                            const Scalar r_buff,
+                                            const Scalar* d_r_buff,
                                             const unsigned int ntypes,
                                             const Scalar lambda_min,
-                                            const Scalar3 lambda,
                                             const unsigned int checkn);
 
 //! Kernel driver for gpu_nlist_filter_kernel()
@@ -43,6 +44,37 @@ hipError_t gpu_nlist_filter(unsigned int* d_n_neigh,
                             const unsigned int N,
                             const unsigned int block_size);
 
+//! Kernel driver for gpu_nlist_partition_tier_kernel()
+hipError_t gpu_nlist_partition_tier(unsigned int* d_nlist,
+                                    unsigned int* d_tier_end,
+                                    const unsigned int* d_tier_begin,
+                                    const unsigned int* d_n_neigh,
+                                    const size_t* d_head_list,
+                                    const Scalar4* d_pos,
+                                    const Scalar* d_r_tiersq,
+                                    const BoxDim& box,
+                                    const Index2D& typpair_idx,
+                                    const unsigned int N,
+                                    const unsigned int block_size);
+
+//! Kernel driver for gpu_nlist_compress_kernel()
+hipError_t gpu_nlist_compress(int16_t* d_nlist_offsets,
+                              const unsigned int* d_n_neigh,
+                              const unsigned int* d_nlist,
+                              const size_t* d_head_list,
+                              const unsigned int N,
+                              const unsigned int block_size);
+
+//! Kernel driver for gpu_nlist_build_cluster_pairs_kernel()
+hipError_t gpu_nlist_build_cluster_pairs(unsigned int* d_cluster_n_neigh,
+                                         unsigned int* d_cluster_nlist,
+                                         uint64_t* d_cluster_mask,
+                                         const unsigned int* d_n_neigh,
+                                         const unsigned int* d_nlist,
+                                         const size_t* d_head_list,
+                                         const unsigned int N,
+                                         const unsigned int block_size);
+
 //! Kernel driver to build head list on gpu
 hipError_t gpu_nlist_build_head_list(size_t* d_head_list,
                                      size_t* d_req_size_nlist,
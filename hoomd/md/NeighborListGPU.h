@@ -64,6 +64,24 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
                                               5,
                                               true));
         m_autotuners.push_back(m_tuner_filter);
+        m_tuner_compress.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                                m_exec_conf,
+                                                "nlist_compress",
+                                                5,
+                                                true));
+        m_autotuners.push_back(m_tuner_compress);
+        m_tuner_cluster.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                               m_exec_conf,
+                                               "nlist_cluster",
+                                               5,
+                                               true));
+        m_autotuners.push_back(m_tuner_cluster);
+        m_tuner_tier.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                            m_exec_conf,
+                                            "nlist_tier",
+                                            5,
+                                            true));
+        m_autotuners.push_back(m_tuner_tier);
         }
 
     //! Destructor
@@ -84,16 +102,25 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
     virtual bool distanceCheck(uint64_t timestep);
 
     //! GPU nlists set their last updated pos in the compute kernel, this call only resets the last
-    //! box length
+    //! box
     virtual void setLastUpdatedPos()
         {
-        m_last_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
+        m_last_box = m_pdata->getGlobalBox();
         m_last_L_local = m_pdata->getBox().getNearestPlaneDistance();
         }
 
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    //! Order one cutoff tier of the neighbor list on the GPU
+    virtual void partitionTier(unsigned int tier);
+
+    //! Encode the neighbor list offsets on the GPU
+    virtual void compressNlist();
+
+    //! Build the cluster pair list on the GPU
+    virtual void buildClusterPairs();
+
     //! Build the head list for neighbor list indexing on the GPU
     virtual void buildHeadList();
 
@@ -104,7 +131,10 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
         m_checkn; //!< Internal counter to assign when checking if the nlist needs an update
 
     private:
-    std::shared_ptr<Autotuner<1>> m_tuner_filter; //!< Autotuner for filter block size
+    std::shared_ptr<Autotuner<1>> m_tuner_filter;   //!< Autotuner for filter block size
+    std::shared_ptr<Autotuner<1>> m_tuner_compress; //!< Autotuner for compress block size
+    std::shared_ptr<Autotuner<1>> m_tuner_cluster;  //!< Autotuner for cluster pair block size
+    std::shared_ptr<Autotuner<1>> m_tuner_tier;     //!< Autotuner for cutoff tier block size
 
     GPUArray<unsigned int>
         m_alt_head_list; //!< Alternate array to hold the head list from prefix sum
@@ -0,0 +1,24 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListGPUAuto.cc
+    \brief Exports NeighborListAuto on the GPU
+*/
+
+#include "NeighborListAuto.h"
+#include "NeighborListGPU.h"
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+void export_NeighborListGPUAuto(pybind11::module& m)
+    {
+    export_NeighborListAuto<NeighborListGPU>(m, "NeighborListGPUAuto");
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -94,7 +94,7 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
     ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::overwrite);
     ArrayHandle<Scalar4> d_last_pos(m_last_pos, access_location::device, access_mode::overwrite);
 
-    ArrayHandle<Scalar> d_r_cut(m_r_cut, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_r_cut(m_r_cut_build, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_r_listsq(m_r_listsq, access_location::device, access_mode::read);
 
     m_exec_conf->setDevice();
@@ -148,6 +148,9 @@ void export_NeighborListGPUBinned(pybind11::module& m)
         .def_property("deterministic",
                       &NeighborListGPUBinned::getDeterministic,
                       &NeighborListGPUBinned::setDeterministic)
+        .def_property("sparse",
+                      &NeighborListGPUBinned::getSparse,
+                      &NeighborListGPUBinned::setSparse)
         .def("getDim",
              &NeighborListGPUBinned::getDim,
              pybind11::return_value_policy::reference_internal)
@@ -58,6 +58,18 @@ class PYBIND11_EXPORT NeighborListGPUBinned : public NeighborListGPU
         return m_cl->getSortCellList();
         }
 
+    /// Store only the occupied cells of the cell list (not supported on the GPU)
+    void setSparse(bool sparse)
+        {
+        m_cl->setSparse(sparse);
+        }
+
+    /// Get the sparse flag
+    bool getSparse() const
+        {
+        return m_cl->getSparse();
+        }
+
     /// Get the dimensions of the cell list
     const uint3& getDim() const
         {
@@ -224,7 +224,7 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
     // the maximum cutoff that any particle can participate in
     Scalar rmax = getMaxRCut() + m_r_buff;
 
-    ArrayHandle<Scalar> d_r_cut(m_r_cut, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_r_cut(m_r_cut_build, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_r_listsq(m_r_listsq, access_location::device, access_mode::read);
 
     if ((box.getPeriodic().x && nearest_plane_distance.x <= rmax * 2.0)
@@ -30,6 +30,8 @@ NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysde
         .connect<NeighborListGPUTree, &NeighborListGPUTree::slotBoxChanged>(this);
     m_pdata->getMaxParticleNumberChangeSignal()
         .connect<NeighborListGPUTree, &NeighborListGPUTree::slotMaxNumChanged>(this);
+    m_pdata->getParticleSortSignal()
+        .connect<NeighborListGPUTree, &NeighborListGPUTree::slotParticleSort>(this);
 
     m_mark_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                         m_exec_conf,
@@ -40,7 +42,14 @@ NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysde
     m_copy_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                         m_exec_conf,
                                         "nlist_tree_copy"));
-    m_autotuners.insert(m_autotuners.end(), {m_mark_tuner, m_count_tuner, m_copy_tuner});
+    m_refit_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                         m_exec_conf,
+                                         "nlist_tree_refit"));
+    m_cost_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                        m_exec_conf,
+                                        "nlist_tree_cost"));
+    m_autotuners.insert(m_autotuners.end(),
+                        {m_mark_tuner, m_count_tuner, m_copy_tuner, m_refit_tuner, m_cost_tuner});
     }
 
 /*!
@@ -53,6 +62,8 @@ NeighborListGPUTree::~NeighborListGPUTree()
         .disconnect<NeighborListGPUTree, &NeighborListGPUTree::slotBoxChanged>(this);
     m_pdata->getMaxParticleNumberChangeSignal()
         .disconnect<NeighborListGPUTree, &NeighborListGPUTree::slotMaxNumChanged>(this);
+    m_pdata->getParticleSortSignal()
+        .disconnect<NeighborListGPUTree, &NeighborListGPUTree::slotParticleSort>(this);
 
     // destroy all of the created streams
     for (auto stream = m_streams.begin(); stream != m_streams.end(); ++stream)
@@ -66,8 +77,8 @@ NeighborListGPUTree::~NeighborListGPUTree()
  *
  * First, memory is reallocated based on the number of particles and types.
  * The traversal images are also updated if the box has changed. One LBVH is then
- * built for each particle type using buildTree(), and these LBVHs are traversed in
- * traverseTree().
+ * built for each particle type using buildTree() (or refit to the current positions), and these
+ * LBVHs are traversed in traverseTree().
  */
 void NeighborListGPUTree::buildNlist(uint64_t timestep)
     {
@@ -92,6 +103,10 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
         GPUArray<unsigned int> traverse_order(m_pdata->getMaxN(), m_exec_conf);
         m_traverse_order.swap(traverse_order);
 
+        GPUArray<unsigned int> refit_locks(m_pdata->getMaxN(), m_exec_conf);
+        m_refit_locks.swap(refit_locks);
+        m_refit_valid = false;
+
         // all done with the particle data reallocation
         m_max_num_changed = false;
         }
@@ -107,6 +122,9 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
             GPUArray<unsigned int> type_last(m_pdata->getNTypes(), m_exec_conf);
             m_type_last.swap(type_last);
 
+            GPUArray<float> lbvh_cost(m_pdata->getNTypes(), m_exec_conf);
+            m_lbvh_cost.swap(lbvh_cost);
+
             m_lbvhs.resize(m_pdata->getNTypes());
             m_traversers.resize(m_pdata->getNTypes());
             m_streams.resize(m_pdata->getNTypes());
@@ -136,6 +154,7 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
 
         // all done with the type reallocation
         m_types_allocated = true;
+        m_refit_valid = false;
         }
 
     // update properties that depend on the box
@@ -143,6 +162,7 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
         {
         updateImageVectors();
         m_box_changed = false;
+        m_refit_valid = false;
         }
 
     // ensure build tuner is set
@@ -184,9 +204,14 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
  * I also note that the use of autotuners in neighbor should break concurrency, since these CUDA
  * timing events are placed in the default stream. This might be reconsidered in future if HOOMD
  * makes more use of CUDA streams anywhere.
+ *
+ * When refits are enabled, the LBVHs from the last full build are refit instead if possible.
  */
 void NeighborListGPUTree::buildTree()
     {
+    if (m_refit && m_refit_valid && refitTree())
+        return;
+
         // set the data by type
         {
         // also, check particles to filter out ghosts that lie outside the current box
@@ -412,8 +437,7 @@ void NeighborListGPUTree::buildTree()
         hipDeviceSynchronize();
         }
 
-        // put particles in primitive order for traversal and compress the lbvhs so that the data is
-        // ready for traversal
+        // put particles in primitive order for traversal
         {
         ArrayHandle<unsigned int> h_type_first(m_type_first,
                                                access_location::host,
@@ -443,20 +467,168 @@ void NeighborListGPUTree::buildTree()
                 m_copy_tuner->end();
                 }
             }
+        }
+
+    // record the quality of the new LBVHs for later refits
+    if (m_refit)
+        {
+        m_build_cost = computeTreeCost();
+        m_refit_N = m_pdata->getN();
+        m_refit_nghosts = m_pdata->getNGhosts();
+        m_refit_valid = true;
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            m_refit_valid = false;
+#endif
+        }
+
+    setupTraversers();
+    }
+
+/*!
+ * \returns True when the LBVHs were refit, false when a full build is needed.
+ *
+ * The type sort and primitive order from the last full build are reused, so the particles must
+ * not have been reordered since then. Each LBVH is refit in its own stream. The refit is rejected
+ * when the summed surface area of the internal nodes exceeds m_refit_max_cost times the area after
+ * the last full build.
+ */
+bool NeighborListGPUTree::refitTree()
+    {
+    if (m_pdata->getN() != m_refit_N || m_pdata->getNGhosts() != m_refit_nghosts)
+        return false;
+
+        {
+        ArrayHandle<unsigned int> h_type_first(m_type_first,
+                                               access_location::host,
+                                               access_mode::read);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                                   access_location::device,
+                                                   access_mode::read);
+        ArrayHandle<unsigned int> d_refit_locks(m_refit_locks,
+                                                access_location::device,
+                                                access_mode::overwrite);
+        ArrayHandle<float> d_lbvh_cost(m_lbvh_cost,
+                                       access_location::device,
+                                       access_mode::overwrite);
 
-        // loops are not fused to avoid streams or syncing in kernel loop above, but could be done
-        // if necessary
+        hipMemset(d_lbvh_cost.data, 0, sizeof(float) * m_pdata->getNTypes());
         hipDeviceSynchronize();
+        m_refit_tuner->begin();
+        const unsigned int block_size = m_refit_tuner->getParam()[0];
         for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
             {
             if (m_lbvhs[i]->getN() == 0)
                 continue;
-            m_traversers[i]->setup(d_sorted_indexes.data + h_type_first.data[i],
-                                   *(m_lbvhs[i]->get()),
-                                   m_streams[i]);
+
+            const unsigned int first = h_type_first.data[i];
+            m_lbvhs[i]->refit(d_pos.data,
+                              d_sorted_indexes.data + first,
+                              d_refit_locks.data + first,
+                              d_lbvh_cost.data + i,
+                              m_streams[i],
+                              block_size);
             }
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_refit_tuner->end();
         hipDeviceSynchronize();
         }
+
+    float cost = 0.0f;
+        {
+        ArrayHandle<float> h_lbvh_cost(m_lbvh_cost, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            cost += h_lbvh_cost.data[i];
+            }
+        }
+
+    if (cost > m_refit_max_cost * m_build_cost)
+        {
+        m_exec_conf->msg->notice(7) << "nlist.tree(): Refit area " << cost << " exceeds "
+                                    << m_refit_max_cost << " x " << m_build_cost << ", rebuilding"
+                                    << std::endl;
+        return false;
+        }
+
+        // the particle marking is skipped, so record the last positions here
+        {
+        ArrayHandle<Scalar4> d_last_pos(m_last_pos,
+                                        access_location::device,
+                                        access_mode::overwrite);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        hipMemcpy(d_last_pos.data,
+                  d_pos.data,
+                  sizeof(Scalar4) * m_pdata->getN(),
+                  hipMemcpyDeviceToDevice);
+        }
+
+    setupTraversers();
+    m_refits++;
+    return true;
+    }
+
+/*!
+ * \returns The summed surface area of the internal nodes of all LBVHs.
+ */
+float NeighborListGPUTree::computeTreeCost()
+    {
+        {
+        ArrayHandle<float> d_lbvh_cost(m_lbvh_cost,
+                                       access_location::device,
+                                       access_mode::overwrite);
+
+        hipMemset(d_lbvh_cost.data, 0, sizeof(float) * m_pdata->getNTypes());
+        hipDeviceSynchronize();
+        m_cost_tuner->begin();
+        const unsigned int block_size = m_cost_tuner->getParam()[0];
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            m_lbvhs[i]->computeCost(d_lbvh_cost.data + i, m_streams[i], block_size);
+            }
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_cost_tuner->end();
+        hipDeviceSynchronize();
+        }
+
+    ArrayHandle<float> h_lbvh_cost(m_lbvh_cost, access_location::host, access_mode::read);
+    float cost = 0.0f;
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        cost += h_lbvh_cost.data[i];
+        }
+    return cost;
+    }
+
+/*!
+ * The traversers compress the LBVHs, so they must be set up again after every build or refit.
+ */
+void NeighborListGPUTree::setupTraversers()
+    {
+    ArrayHandle<unsigned int> h_type_first(m_type_first, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                               access_location::device,
+                                               access_mode::read);
+
+    // loops are not fused with the builds to avoid streams or syncing in kernel loops, but could be
+    // done if necessary
+    hipDeviceSynchronize();
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        if (m_lbvhs[i]->getN() == 0)
+            continue;
+        m_traversers[i]->setup(d_sorted_indexes.data + h_type_first.data[i],
+                               *(m_lbvhs[i]->get()),
+                               m_streams[i]);
+        }
+    hipDeviceSynchronize();
     }
 
 /*!
@@ -496,7 +668,7 @@ void NeighborListGPUTree::traverseTree()
                                                access_mode::read);
     ArrayHandle<Scalar3> d_image_list(m_image_list, access_location::device, access_mode::read);
 
-    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_cut(m_r_cut_build, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
 
     // clear the neighbor counts
@@ -644,7 +816,9 @@ void export_NeighborListGPUTree(pybind11::module& m)
     pybind11::class_<NeighborListGPUTree, NeighborListGPU, std::shared_ptr<NeighborListGPUTree>>(
         m,
         "NeighborListGPUTree")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("refit", &NeighborListGPUTree::getRefit, &NeighborListGPUTree::setRefit)
+        .def("getNumRefits", &NeighborListGPUTree::getNumRefits);
     }
 
     } // end namespace detail
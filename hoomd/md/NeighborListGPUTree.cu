@@ -750,6 +750,101 @@ struct NeighborListOp
     unsigned int max_neigh;      //!< Maximum number of neighbors allocated
     };
 
+//! Surface area of a bounding box
+DEVICE float lbvh_box_area(const float3& lo, const float3& hi)
+    {
+    const float dx = hi.x - lo.x;
+    const float dy = hi.y - lo.y;
+    const float dz = hi.z - lo.z;
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+
+//! Load a bound written by another thread in the same kernel
+DEVICE float3 lbvh_load_bound(const float3* bound)
+    {
+    const volatile float* b = reinterpret_cast<const volatile float*>(bound);
+    return make_float3(b[0], b[1], b[2]);
+    }
+
+//! Kernel to refit the bounds of an LBVH
+/*!
+ * \param tree LBVH to refit.
+ * \param d_pos Particle positions.
+ * \param d_map Map of the nominal primitive index to the index in \a d_pos.
+ * \param d_locks Visit counters for the internal nodes (zeroed).
+ * \param d_cost Sum of the surface areas of the internal nodes (zeroed).
+ * \param N Number of primitives in the LBVH.
+ *
+ * Using one thread per leaf, the leaf bounds are set from the current particle positions. The
+ * leaves are stored after the N-1 internal nodes in the same order as the primitives. Each thread
+ * then walks toward the root. The first thread to visit an internal node stops, and the second
+ * thread merges the bounds of both children, which are complete by then. This is the same
+ * bottom-up pass that the LBVH build uses, so the hierarchy is kept and only the bounds change.
+ */
+__global__ void gpu_nlist_refit_lbvh_kernel(neighbor::LBVHData tree,
+                                            const Scalar4* d_pos,
+                                            const unsigned int* d_map,
+                                            unsigned int* d_locks,
+                                            float* d_cost,
+                                            const unsigned int N)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    int node = static_cast<int>(N - 1 + idx);
+    const Scalar4 postype = d_pos[d_map[tree.primitive[idx]]];
+    const Scalar3 p = make_scalar3(postype.x, postype.y, postype.z);
+    const neighbor::BoundingBox leaf(p, p);
+    tree.lo[node] = leaf.lo;
+    tree.hi[node] = leaf.hi;
+
+    // the root has no parent
+    node = tree.parent[node];
+    while (node >= 0)
+        {
+        // make the bounds of this child visible before signaling the parent
+        __threadfence();
+        if (atomicAdd(d_locks + node, 1) == 0)
+            return;
+
+        const int left = tree.left[node];
+        const int right = tree.right[node];
+        const float3 lo_left = lbvh_load_bound(tree.lo + left);
+        const float3 hi_left = lbvh_load_bound(tree.hi + left);
+        const float3 lo_right = lbvh_load_bound(tree.lo + right);
+        const float3 hi_right = lbvh_load_bound(tree.hi + right);
+
+        const float3 lo = make_float3(fminf(lo_left.x, lo_right.x),
+                                      fminf(lo_left.y, lo_right.y),
+                                      fminf(lo_left.z, lo_right.z));
+        const float3 hi = make_float3(fmaxf(hi_left.x, hi_right.x),
+                                      fmaxf(hi_left.y, hi_right.y),
+                                      fmaxf(hi_left.z, hi_right.z));
+        tree.lo[node] = lo;
+        tree.hi[node] = hi;
+        atomicAdd(d_cost, lbvh_box_area(lo, hi));
+
+        node = tree.parent[node];
+        }
+    }
+
+//! Kernel to sum the surface areas of the internal nodes of an LBVH
+/*!
+ * \param tree LBVH to measure.
+ * \param d_cost Sum of the surface areas of the internal nodes (zeroed).
+ * \param Ninternal Number of internal nodes in the LBVH.
+ */
+__global__ void
+gpu_nlist_lbvh_cost_kernel(neighbor::LBVHData tree, float* d_cost, const unsigned int Ninternal)
+    {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= Ninternal)
+        return;
+
+    atomicAdd(d_cost, lbvh_box_area(tree.lo[idx], tree.hi[idx]));
+    }
+
 //! Host function to convert a double to a float in round-down mode
 float double2float_rd(double x)
     {
@@ -833,6 +928,76 @@ void LBVHWrapper::build(const Scalar4* points,
     lbvh_->build(neighbor::LBVH::LaunchParameters(block_size, stream), insert, lof, hif);
     }
 
+/*!
+ * \param points Particle positions
+ * \param map Mapping of particles for insertion, which must be the same as for the last build
+ * \param d_locks Scratch counters for at least getN() nodes
+ * \param d_cost Sum of the surface areas of the internal nodes (accumulated)
+ * \param stream CUDA stream for execution
+ * \param block_size CUDA block size for execution
+ *
+ * The hierarchy (and so the order of the primitives) from the last build is kept, and only the
+ * node bounds are updated.
+ */
+void LBVHWrapper::refit(const Scalar4* points,
+                        const unsigned int* map,
+                        unsigned int* d_locks,
+                        float* d_cost,
+                        hipStream_t stream,
+                        unsigned int block_size)
+    {
+    const unsigned int N = lbvh_->getN();
+    if (N == 0)
+        return;
+
+    hipMemsetAsync(d_locks, 0, sizeof(unsigned int) * N, stream);
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_nlist_refit_lbvh_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    int run_block_size = min(block_size, max_block_size);
+    hipLaunchKernelGGL(gpu_nlist_refit_lbvh_kernel,
+                       dim3(N / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       stream,
+                       lbvh_->data(),
+                       points,
+                       map,
+                       d_locks,
+                       d_cost,
+                       N);
+    }
+
+/*!
+ * \param d_cost Sum of the surface areas of the internal nodes (accumulated)
+ * \param stream CUDA stream for execution
+ * \param block_size CUDA block size for execution
+ */
+void LBVHWrapper::computeCost(float* d_cost, hipStream_t stream, unsigned int block_size)
+    {
+    const unsigned int N = lbvh_->getN();
+    if (N <= 1)
+        return;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_nlist_lbvh_cost_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    int run_block_size = min(block_size, max_block_size);
+    hipLaunchKernelGGL(gpu_nlist_lbvh_cost_kernel,
+                       dim3((N - 1) / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       stream,
+                       lbvh_->data(),
+                       d_cost,
+                       N - 1);
+    }
+
 unsigned int LBVHWrapper::getN() const
     {
     return lbvh_->getN();
@@ -95,6 +95,17 @@ class LBVHWrapper
                hipStream_t stream,
                unsigned int block_size);
 
+    //! Refit the LBVH bounds to the current positions without changing the hierarchy
+    void refit(const Scalar4* points,
+               const unsigned int* map,
+               unsigned int* d_locks,
+               float* d_cost,
+               hipStream_t stream,
+               unsigned int block_size);
+
+    //! Sum the surface areas of the internal nodes of the LBVH
+    void computeCost(float* d_cost, hipStream_t stream, unsigned int block_size);
+
     //! Get the underlying LBVH
     neighbor::LBVH* get()
         {
@@ -36,6 +36,18 @@ namespace md
  * simulations, this sorting can also be used to efficiently filter out ghosts that lie outside the
  * neighbor search range (e.g., those participating in bonds).
  *
+ * With setRefit(), a rebuild keeps the hierarchy of each LBVH from the last full build and only
+ * updates the node bounds to the current positions (refitTree()). This skips the type sort, Morton
+ * code sort, and hierarchy generation. Refits degrade the tree as particles drift away from the
+ * positions it was built for, so the summed surface area of the internal nodes is measured after
+ * each build and refit. A full build is done instead when the refit area exceeds
+ * m_refit_max_cost times the area after the last full build. A full build is also needed whenever
+ * the particles are reordered or the box or the number of particles changes. Domain decomposed
+ * simulations always build fully, because the ghost particles change with every rebuild.
+ *
+ * As for NeighborListTree, a class that changes the types of particles \b must signal this with
+ * notifyParticleSort() when refits are enabled.
+ *
  * \ingroup computes
  */
 class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
@@ -47,6 +59,25 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     //! Destructor
     virtual ~NeighborListGPUTree();
 
+    //! Enable or disable refits
+    void setRefit(bool refit)
+        {
+        m_refit = refit;
+        m_refit_valid = false;
+        }
+
+    //! Test if refits are enabled
+    bool getRefit()
+        {
+        return m_refit;
+        }
+
+    //! Get the number of builds that were refits
+    uint64_t getNumRefits()
+        {
+        return m_refits;
+        }
+
     protected:
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
@@ -57,6 +88,8 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     std::shared_ptr<Autotuner<1>> m_copy_tuner;     //!< Tuner for the primitive-copy kernel
     std::shared_ptr<Autotuner<1>> m_build_tuner;    //!< Tuner for LBVH builds
     std::shared_ptr<Autotuner<1>> m_traverse_tuner; //!< Tuner for LBVH traversers
+    std::shared_ptr<Autotuner<1>> m_refit_tuner;    //!< Tuner for the LBVH refit kernel
+    std::shared_ptr<Autotuner<1>> m_cost_tuner;     //!< Tuner for the LBVH cost kernel
 
     GPUArray<unsigned int> m_types;          //!< Particle types (for sorting)
     GPUArray<unsigned int> m_sorted_types;   //!< Sorted particle types
@@ -77,9 +110,28 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     unsigned int m_n_images;                 //!< Number of translation vectors for traversal
     GPUArray<unsigned int> m_traverse_order; //!< Order to traverse primitives
 
+    GPUArray<unsigned int> m_refit_locks; //!< Node visit counters for refits
+    GPUArray<float> m_lbvh_cost;          //!< Summed internal node surface area per type
+    bool m_refit = false;                 //!< True when refits are enabled
+    bool m_refit_valid = false;           //!< True when the LBVHs can be refit
+    unsigned int m_refit_N = 0;           //!< Number of particles at the last full build
+    unsigned int m_refit_nghosts = 0;     //!< Number of ghosts at the last full build
+    float m_build_cost = 0.0f;            //!< Summed surface area after the last full build
+    float m_refit_max_cost = 1.5f;        //!< Largest refit area relative to m_build_cost
+    uint64_t m_refits = 0;                //!< Number of refits
+
     //! Build the LBVHs using the neighbor library
     void buildTree();
 
+    //! Refit the LBVHs from the last full build to the current positions
+    bool refitTree();
+
+    //! Sum the internal node surface areas of all LBVHs
+    float computeTreeCost();
+
+    //! Prepare the LBVH traversers for the current LBVHs
+    void setupTraversers();
+
     //! Traverse the LBVHs using the neighbor library
     void traverseTree();
 
@@ -124,6 +176,12 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
         m_max_num_changed = true;
         }
 
+    //! Notification of a particle sort
+    void slotParticleSort()
+        {
+        m_refit_valid = false;
+        }
+
     /// set to true when the type data has been allocated
     bool m_types_allocated;
 
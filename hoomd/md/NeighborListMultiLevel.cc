@@ -0,0 +1,373 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListMultiLevel.cc
+    \brief Defines NeighborListMultiLevel
+*/
+
+#include "NeighborListMultiLevel.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace
+    {
+//! Host pointers and geometry of the cell list of one level
+struct LevelCells
+    {
+    uint3 dim;                //!< Number of cells in each direction
+    Scalar3 ghost_width;      //!< Width of the ghost layer
+    Scalar3 width;            //!< Actual cell width in each direction
+    Index3D ci;               //!< Cell indexer
+    Index2D cli;              //!< Cell list indexer
+    const unsigned int* size; //!< Number of particles in each cell
+    const Scalar4* xyzf;      //!< Position and index of each entry
+    const uint2* type_body;   //!< Type and body of each entry
+    };
+
+//! The cells within n of cell b in one direction, each listed once
+/*! \returns The number of cells written to \a out, which must hold 2n+1 values
+ */
+unsigned int cellRange(int b, int n, unsigned int dim, bool is_periodic, unsigned int* out)
+    {
+    unsigned int count = 0;
+    if (2 * n + 1 >= int(dim))
+        {
+        for (unsigned int k = 0; k < dim; k++)
+            out[count++] = k;
+        return count;
+        }
+    for (int c = b - n; c <= b + n; c++)
+        {
+        int wrapped = c;
+        if (is_periodic)
+            wrapped = (c + int(dim)) % int(dim);
+        else if (c < 0 || c >= int(dim))
+            continue;
+        out[count++] = (unsigned int)wrapped;
+        }
+    return count;
+    }
+    } // end anonymous namespace
+
+NeighborListMultiLevel::NeighborListMultiLevel(std::shared_ptr<SystemDefinition> sysdef,
+                                               Scalar r_buff)
+    : NeighborList(sysdef, r_buff)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListMultiLevel" << endl;
+
+    m_exclusions_in_build = true;
+    }
+
+NeighborListMultiLevel::~NeighborListMultiLevel()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListMultiLevel" << endl;
+    }
+
+void NeighborListMultiLevel::updateLevels()
+    {
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+    const unsigned int n_types = m_pdata->getNTypes();
+
+    // r_list of a type pair, zero when the pair does not interact
+    auto r_list = [&](unsigned int a, unsigned int b)
+    {
+        const unsigned int typpair = m_typpair_idx(a, b);
+        if (h_r_cut.data[typpair] <= Scalar(0.0))
+            return Scalar(0.0);
+        return Scalar(sqrt(h_r_listsq.data[typpair]));
+    };
+
+    // the r_list that sorts each interacting type into a level
+    std::vector<std::pair<Scalar, unsigned int>> type_r_list;
+    for (unsigned int t = 0; t < n_types; t++)
+        {
+        Scalar r = r_list(t, t);
+        if (r <= Scalar(0.0))
+            {
+            for (unsigned int u = 0; u < n_types; u++)
+                {
+                const Scalar r_u = r_list(t, u);
+                if (r_u > Scalar(0.0) && (r <= Scalar(0.0) || r_u < r))
+                    r = r_u;
+                }
+            }
+        if (r > Scalar(0.0))
+            type_r_list.push_back(std::make_pair(r, t));
+        }
+    std::sort(type_r_list.begin(), type_r_list.end());
+
+    std::vector<unsigned int> type_level(n_types, NO_LEVEL);
+    unsigned int n_levels = 0;
+    Scalar level_r_min = Scalar(0.0);
+    for (const auto& r_t : type_r_list)
+        {
+        if (n_levels == 0 || r_t.first > m_level_ratio * level_r_min)
+            {
+            level_r_min = r_t.first;
+            n_levels++;
+            }
+        type_level[r_t.second] = n_levels - 1;
+        }
+
+    // each level is as wide as the largest r_list between two of its types
+    std::vector<Scalar> level_width(n_levels, Scalar(0.0));
+    for (const auto& r_t : type_r_list)
+        {
+        Scalar& width = level_width[type_level[r_t.second]];
+        width = std::max(width, r_t.first);
+        }
+    m_r_search.assign(size_t(n_levels) * n_types, Scalar(0.0));
+    for (unsigned int t = 0; t < n_types; t++)
+        {
+        for (unsigned int u = 0; u < n_types; u++)
+            {
+            const unsigned int level = type_level[u];
+            if (level == NO_LEVEL)
+                continue;
+
+            const Scalar r = r_list(t, u);
+            Scalar& r_search = m_r_search[size_t(level) * n_types + t];
+            r_search = std::max(r_search, r);
+            if (type_level[t] == level)
+                level_width[level] = std::max(level_width[level], r);
+            }
+        }
+
+    // reconstruct the cell lists only when the types move between levels
+    if (type_level != m_type_level)
+        {
+        m_type_level = type_level;
+        m_levels.clear();
+        m_level_width.assign(n_levels, Scalar(0.0));
+        for (unsigned int level = 0; level < n_levels; level++)
+            {
+            std::shared_ptr<CellList> cl = std::make_shared<CellList>(m_sysdef);
+            cl->setRadius(1);
+            cl->setComputeTypeBody(true);
+            cl->setFlagIndex();
+            cl->setComputeAdjList(false);
+
+            std::vector<bool> bin_types(n_types);
+            for (unsigned int t = 0; t < n_types; t++)
+                bin_types[t] = (type_level[t] == level);
+            cl->setBinTypes(bin_types);
+
+            m_levels.push_back(cl);
+            }
+        }
+
+    for (unsigned int level = 0; level < n_levels; level++)
+        {
+        if (level_width[level] != m_level_width[level])
+            {
+            m_levels[level]->setNominalWidth(level_width[level]);
+            m_level_width[level] = level_width[level];
+            }
+        }
+    }
+
+void NeighborListMultiLevel::buildNlist(uint64_t timestep)
+    {
+    updateLevels();
+
+    const unsigned int n_levels = (unsigned int)m_levels.size();
+    const unsigned int n_types = m_pdata->getNTypes();
+
+    // bin each level and hold its arrays for the duration of the build
+    std::vector<LevelCells> levels(n_levels);
+    std::vector<std::unique_ptr<ArrayHandle<unsigned int>>> h_cell_size(n_levels);
+    std::vector<std::unique_ptr<ArrayHandle<Scalar4>>> h_cell_xyzf(n_levels);
+    std::vector<std::unique_ptr<ArrayHandle<uint2>>> h_cell_type_body(n_levels);
+    for (unsigned int level = 0; level < n_levels; level++)
+        {
+        CellList& cl = *m_levels[level];
+        cl.compute(timestep);
+
+        h_cell_size[level].reset(new ArrayHandle<unsigned int>(cl.getCellSizeArray(),
+                                                               access_location::host,
+                                                               access_mode::read));
+        h_cell_xyzf[level].reset(
+            new ArrayHandle<Scalar4>(cl.getXYZFArray(), access_location::host, access_mode::read));
+        h_cell_type_body[level].reset(new ArrayHandle<uint2>(cl.getTypeBodyArray(),
+                                                             access_location::host,
+                                                             access_mode::read));
+
+        LevelCells& cells = levels[level];
+        cells.dim = cl.getDim();
+        cells.ghost_width = cl.getGhostWidth();
+        cells.width = cl.getCellWidth();
+        cells.ci = cl.getCellIndexer();
+        cells.cli = cl.getCellListIndexer();
+        cells.size = h_cell_size[level]->data;
+        cells.xyzf = h_cell_xyzf[level]->data;
+        cells.type_body = h_cell_type_body[level]->data;
+        }
+
+    // acquire the particle data and box dimension
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+    const uchar3 periodic = box.getPeriodic();
+    const bool is_2d = m_sysdef->getNDimensions() == 2;
+
+    // access the rlist data
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    // access the exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    // access the neighbor list data
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
+
+    // for each local particle
+    unsigned int nparticles = m_pdata->getN();
+
+    buildInParallel(
+        nparticles,
+        h_conditions.data,
+        [&](unsigned int begin, unsigned int end, unsigned int* conditions)
+        {
+            std::vector<unsigned int> range_x, range_y, range_z;
+            for (unsigned int i = begin; i < end; i++)
+                {
+                unsigned int cur_n_neigh = 0;
+
+                const Scalar3 my_pos
+                    = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+                const unsigned int body_i = h_body.data[i];
+
+                const unsigned int Nmax_i = h_Nmax.data[type_i];
+                const size_t head_idx_i = h_head_list.data[i];
+
+                for (unsigned int level = 0; level < n_levels; level++)
+                    {
+                    const Scalar r_search = m_r_search[size_t(level) * n_types + type_i];
+                    if (r_search <= Scalar(0.0))
+                        continue;
+
+                    const LevelCells& cells = levels[level];
+                    const uint3 dim = cells.dim;
+
+                    // find the bin the particle belongs in
+                    Scalar3 f = box.makeFraction(my_pos, cells.ghost_width);
+                    int ib = std::max(0, std::min((int)(f.x * dim.x), (int)dim.x - 1));
+                    int jb = std::max(0, std::min((int)(f.y * dim.y), (int)dim.y - 1));
+                    int kb = std::max(0, std::min((int)(f.z * dim.z), (int)dim.z - 1));
+
+                    // the search covers the cells within r_search of the particle's cell
+                    const int nx = (int)ceil(r_search / cells.width.x);
+                    const int ny = (int)ceil(r_search / cells.width.y);
+                    const int nz = is_2d ? 0 : (int)ceil(r_search / cells.width.z);
+                    range_x.resize(2 * nx + 1);
+                    range_y.resize(2 * ny + 1);
+                    range_z.resize(2 * nz + 1);
+                    const unsigned int n_x
+                        = cellRange(ib, nx, dim.x, periodic.x, range_x.data());
+                    const unsigned int n_y
+                        = cellRange(jb, ny, dim.y, periodic.y, range_y.data());
+                    const unsigned int n_z
+                        = cellRange(kb, nz, dim.z, periodic.z, range_z.data());
+
+                    for (unsigned int sz = 0; sz < n_z; sz++)
+                        for (unsigned int sy = 0; sy < n_y; sy++)
+                            for (unsigned int sx = 0; sx < n_x; sx++)
+                                {
+                                const unsigned int neigh_cell
+                                    = cells.ci(range_x[sx], range_y[sy], range_z[sz]);
+
+                                const unsigned int size = cells.size[neigh_cell];
+                                for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+                                    {
+                                    const unsigned int entry = cells.cli(cur_offset, neigh_cell);
+                                    const uint2 neigh_type_body = cells.type_body[entry];
+                                    const unsigned int type_j = neigh_type_body.x;
+                                    const unsigned int body_j = neigh_type_body.y;
+
+                                    // skip any particles belonging to the same body if requested
+                                    if (m_filter_body && body_i != NO_BODY && body_i == body_j)
+                                        continue;
+
+                                    // skip pairs that do not interact
+                                    const unsigned int typpair = m_typpair_idx(type_i, type_j);
+                                    if (h_r_cut.data[typpair] <= Scalar(0.0))
+                                        continue;
+
+                                    const Scalar4& neigh_xyzf = cells.xyzf[entry];
+                                    const unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
+
+                                    // a particle cannot neighbor itself
+                                    if (i == cur_neigh)
+                                        continue;
+
+                                    Scalar3 neigh_pos
+                                        = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
+                                    Scalar3 dx = box.minImage(my_pos - neigh_pos);
+                                    if (dot(dx, dx) > h_r_listsq.data[typpair])
+                                        continue;
+
+                                    // apply the explicit exclusions only to pairs within range
+                                    if (m_exclusions_set
+                                        && isExcluded(h_n_ex_idx.data,
+                                                      h_ex_list_idx.data,
+                                                      i,
+                                                      cur_neigh))
+                                        continue;
+
+                                    if (m_storage_mode == full || i < cur_neigh)
+                                        {
+                                        if (cur_n_neigh < Nmax_i)
+                                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                        else
+                                            conditions[type_i]
+                                                = max(conditions[type_i], cur_n_neigh + 1);
+
+                                        cur_n_neigh++;
+                                        }
+                                    }
+                                }
+                    }
+
+                h_n_neigh.data[i] = cur_n_neigh;
+                }
+        });
+    }
+
+namespace detail
+    {
+void export_NeighborListMultiLevel(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListMultiLevel,
+                     NeighborList,
+                     std::shared_ptr<NeighborListMultiLevel>>(m, "NeighborListMultiLevel")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("level_ratio",
+                      &NeighborListMultiLevel::getLevelRatio,
+                      &NeighborListMultiLevel::setLevelRatio)
+        .def_property_readonly("num_levels", &NeighborListMultiLevel::getNLevels);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,98 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+#include "hoomd/CellList.h"
+
+/*! \file NeighborListMultiLevel.h
+    \brief Declares the NeighborListMultiLevel class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#include <stdexcept>
+#include <vector>
+
+#ifndef __NEIGHBORLISTMULTILEVEL_H__
+#define __NEIGHBORLISTMULTILEVEL_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list build on the CPU with one cell list per cutoff class
+/*! NeighborListMultiLevel sorts the interacting particle types into levels by their self r_list
+    (the smallest r_list of any pair of the type when it does not interact with itself). In order
+    of increasing r_list, a type joins the current level while its r_list is at most level_ratio
+    times the smallest r_list in the level, and starts a new level otherwise. Each level bins only
+    the particles of its own types, in a cell list as wide as the largest r_list between two of its
+    types.
+
+    A particle of type i searches the cells of each level L within ceil(r / w_L) cells of its own,
+    where r is the largest r_list between i and the types of L and w_L is the cell width of L. The
+    small particles of a size-asymmetric mixture thus search their own small cells with the 27 cell
+    stencil instead of cells sized to the largest cutoff, and the wide searches for the large cross
+    cutoffs only visit the few large particles.
+
+    The levels are updated at each build, and the cell lists are only reconstructed when the
+    assignment of the types to the levels changes.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListMultiLevel : public NeighborList
+    {
+    public:
+    //! Constructs the compute
+    NeighborListMultiLevel(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListMultiLevel();
+
+    //! Set the largest ratio of the r_list of two types in the same level
+    void setLevelRatio(Scalar level_ratio)
+        {
+        if (level_ratio < Scalar(1.0))
+            {
+            throw std::invalid_argument("level_ratio must be at least 1.");
+            }
+        m_level_ratio = level_ratio;
+        forceUpdate();
+        }
+
+    //! Get the largest ratio of the r_list of two types in the same level
+    Scalar getLevelRatio() const
+        {
+        return m_level_ratio;
+        }
+
+    //! Get the number of levels in the last build
+    unsigned int getNLevels() const
+        {
+        return (unsigned int)m_levels.size();
+        }
+
+    protected:
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    private:
+    //! Assign the types to levels and size the cell list of each level
+    void updateLevels();
+
+    Scalar m_level_ratio = Scalar(2.0);             //!< Largest r_list ratio within a level
+    std::vector<std::shared_ptr<CellList>> m_levels; //!< Cell list of each level
+    std::vector<unsigned int> m_type_level;          //!< Level of each type, or NO_LEVEL
+    std::vector<Scalar> m_level_width;               //!< Cell width of each level
+    std::vector<Scalar> m_r_search;                  //!< Search radius of each (level, type)
+
+    static constexpr unsigned int NO_LEVEL = 0xffffffff; //!< Level of types that do not interact
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -36,6 +36,8 @@ NeighborListStencil::NeighborListStencil(std::shared_ptr<SystemDefinition> sysde
     m_cl->setComputeTypeBody(true);
     m_cl->setFlagIndex();
     m_cl->setComputeAdjList(false);
+
+    m_exclusions_in_build = true;
     }
 
 NeighborListStencil::~NeighborListStencil()
@@ -122,6 +124,7 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
 
     // access the rlist data
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
 
     // access the cell list data arrays
     ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
@@ -139,6 +142,12 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
                                           access_mode::read);
     const Index2D& stencil_idx = m_cls->getStencilIndexer();
 
+    // access the exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
     // access the neighbor list data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
@@ -155,151 +164,164 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
+    buildInParallel(
+        nparticles,
+        h_conditions.data,
+        [&](unsigned int begin, unsigned int end, unsigned int* conditions)
         {
-        unsigned int cur_n_neigh = 0;
-
-        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int body_i = h_body.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t head_idx_i = h_head_list.data[i];
-
-        // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
-        int ib = (unsigned int)(f.x * dim.x);
-        int jb = (unsigned int)(f.y * dim.y);
-        int kb = (unsigned int)(f.z * dim.z);
-
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)dim.z && periodic.z)
-            kb = 0;
-
-        // loop through all neighboring bins
-        unsigned int n_stencil = h_n_stencil.data[type_i];
-        for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
-            {
-            // compute the stenciled cell cartesian coordinates
-            Scalar4 stencil = h_stencil.data[stencil_idx(cur_stencil, type_i)];
-            int sib = ib + __scalar_as_int(stencil.x);
-            int sjb = jb + __scalar_as_int(stencil.y);
-            int skb = kb + __scalar_as_int(stencil.z);
-            Scalar cell_dist2 = stencil.w;
-            // wrap through the boundary
-            if (periodic.x)
-                {
-                if (sib >= (int)dim.x)
-                    sib -= dim.x;
-                else if (sib < 0)
-                    sib += dim.x;
-
-                // wrapping and the stencil construction should ensure this is in bounds
-                assert(sib >= 0 && sib < (int)dim.x);
-                }
-            else if (sib < 0 || sib >= (int)dim.x)
-                {
-                // in aperiodic systems the stencil could maybe extend out of the grid
-                continue;
-                }
-
-            if (periodic.y)
-                {
-                if (sjb >= (int)dim.y)
-                    sjb -= dim.y;
-                else if (sjb < 0)
-                    sjb += dim.y;
-
-                assert(sjb >= 0 && sjb < (int)dim.y);
-                }
-            else if (sjb < 0 || sjb >= (int)dim.y)
-                {
-                continue;
-                }
-
-            if (periodic.z)
-                {
-                if (skb >= (int)dim.z)
-                    skb -= dim.z;
-                else if (skb < 0)
-                    skb += dim.z;
-
-                assert(skb >= 0 && skb < (int)dim.z);
-                }
-            else if (skb < 0 || skb >= (int)dim.z)
-                {
-                continue;
-                }
-
-            unsigned int neigh_cell = ci(sib, sjb, skb);
-
-            // check against all the particles in that neighboring bin to see if it is a neighbor
-            unsigned int size = h_cell_size.data[neigh_cell];
-            for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+            for (int i = (int)begin; i < (int)end; i++)
                 {
-                // read in the particle type (diameter and body as well while we've got the Scalar4
-                // in)
-                const uint2& neigh_type_body = h_cell_type_body.data[cli(cur_offset, neigh_cell)];
-                const unsigned int type_j = neigh_type_body.x;
-                const unsigned int body_j = neigh_type_body.y;
-
-                // skip any particles belonging to the same body if requested
-                if (m_filter_body && body_i != NO_BODY && body_i == body_j)
-                    continue;
-
-                // read cutoff and skip if pair is inactive
-                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
-                if (r_cut <= Scalar(0.0))
-                    continue;
+                unsigned int cur_n_neigh = 0;
+
+                const Scalar3 my_pos
+                    = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+                const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+                const unsigned int body_i = h_body.data[i];
+
+                const unsigned int Nmax_i = h_Nmax.data[type_i];
+                const size_t head_idx_i = h_head_list.data[i];
+
+                // find the bin each particle belongs in
+                Scalar3 f = box.makeFraction(my_pos, ghost_width);
+                int ib = (unsigned int)(f.x * dim.x);
+                int jb = (unsigned int)(f.y * dim.y);
+                int kb = (unsigned int)(f.z * dim.z);
+
+                // need to handle the case where the particle is exactly at the box hi
+                if (ib == (int)dim.x && periodic.x)
+                    ib = 0;
+                if (jb == (int)dim.y && periodic.y)
+                    jb = 0;
+                if (kb == (int)dim.z && periodic.z)
+                    kb = 0;
+
+                // loop through all neighboring bins
+                unsigned int n_stencil = h_n_stencil.data[type_i];
+                for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
+                    {
+                    // compute the stenciled cell cartesian coordinates
+                    Scalar4 stencil = h_stencil.data[stencil_idx(cur_stencil, type_i)];
+                    int sib = ib + __scalar_as_int(stencil.x);
+                    int sjb = jb + __scalar_as_int(stencil.y);
+                    int skb = kb + __scalar_as_int(stencil.z);
+                    Scalar cell_dist2 = stencil.w;
+                    // wrap through the boundary
+                    if (periodic.x)
+                        {
+                        if (sib >= (int)dim.x)
+                            sib -= dim.x;
+                        else if (sib < 0)
+                            sib += dim.x;
 
-                // compute the rlist based on the particle type we're interacting with
-                Scalar r_list = r_cut + m_r_buff;
-                Scalar r_listsq = r_list * r_list;
+                        // wrapping and the stencil construction should ensure this is in bounds
+                        assert(sib >= 0 && sib < (int)dim.x);
+                        }
+                    else if (sib < 0 || sib >= (int)dim.x)
+                        {
+                        // in aperiodic systems the stencil could maybe extend out of the grid
+                        continue;
+                        }
 
-                // compare the check distance to the minimum cell distance, and pass without
-                // distance check if unnecessary
-                if (cell_dist2 > r_listsq)
-                    continue;
+                    if (periodic.y)
+                        {
+                        if (sjb >= (int)dim.y)
+                            sjb -= dim.y;
+                        else if (sjb < 0)
+                            sjb += dim.y;
 
-                // only load in the particle position and id if distance check is satisfied
-                const Scalar4& neigh_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
+                        assert(sjb >= 0 && sjb < (int)dim.y);
+                        }
+                    else if (sjb < 0 || sjb >= (int)dim.y)
+                        {
+                        continue;
+                        }
 
-                // a particle cannot neighbor itself
-                if (i == (int)cur_neigh)
-                    continue;
+                    if (periodic.z)
+                        {
+                        if (skb >= (int)dim.z)
+                            skb -= dim.z;
+                        else if (skb < 0)
+                            skb += dim.z;
 
-                Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
-                Scalar3 dx = my_pos - neigh_pos;
-                dx = box.minImage(dx);
+                        assert(skb >= 0 && skb < (int)dim.z);
+                        }
+                    else if (skb < 0 || skb >= (int)dim.z)
+                        {
+                        continue;
+                        }
 
-                Scalar dr_sq = dot(dx, dx);
+                    unsigned int neigh_cell = ci(sib, sjb, skb);
 
-                if (dr_sq <= r_listsq)
-                    {
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    // check against all the particles in that neighboring bin to see if it is a
+                    // neighbor
+                    unsigned int size = h_cell_size.data[neigh_cell];
+                    for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
                         {
-                        // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        // read in the particle type (diameter and body as well while we've got the
+                        // Scalar4 in)
+                        const uint2& neigh_type_body
+                            = h_cell_type_body.data[cli(cur_offset, neigh_cell)];
+                        const unsigned int type_j = neigh_type_body.x;
+                        const unsigned int body_j = neigh_type_body.y;
+
+                        // skip any particles belonging to the same body if requested
+                        if (m_filter_body && body_i != NO_BODY && body_i == body_j)
+                            continue;
+
+                        // read cutoff and skip if pair is inactive
+                        Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
+                        if (r_cut <= Scalar(0.0))
+                            continue;
+
+                        // read the rlist based on the particle type we're interacting with
+                        Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, type_j)];
+
+                        // compare the check distance to the minimum cell distance, and pass without
+                        // distance check if unnecessary
+                        if (cell_dist2 > r_listsq)
+                            continue;
+
+                        // only load in the particle position and id if distance check is satisfied
+                        const Scalar4& neigh_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
+                        unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
+
+                        // a particle cannot neighbor itself
+                        if (i == (int)cur_neigh)
+                            continue;
+
+                        Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
+                        Scalar3 dx = my_pos - neigh_pos;
+                        dx = box.minImage(dx);
+
+                        Scalar dr_sq = dot(dx, dx);
+
+                        // apply the explicit exclusions only to pairs within range
+                        if (dr_sq <= r_listsq && m_exclusions_set
+                            && isExcluded(h_n_ex_idx.data, h_ex_list_idx.data, i, cur_neigh))
+                            continue;
+
+                        if (dr_sq <= r_listsq)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            if (m_storage_mode == full || i < (int)cur_neigh)
+                                {
+                                // local neighbor
+                                if (cur_n_neigh < Nmax_i)
+                                    {
+                                    h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                    }
+                                else
+                                    conditions[type_i]
+                                        = max(conditions[type_i], cur_n_neigh + 1);
+
+                                ++cur_n_neigh;
+                                }
                             }
-                        else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
-
-                        ++cur_n_neigh;
                         }
                     }
-                }
-            }
 
-        h_n_neigh.data[i] = cur_n_neigh;
-        }
+                h_n_neigh.data[i] = cur_n_neigh;
+                }
+        });
     }
 
 namespace detail
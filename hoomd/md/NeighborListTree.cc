@@ -30,6 +30,8 @@ NeighborListTree::NeighborListTree(std::shared_ptr<SystemDefinition> sysdef, Sca
         .connect<NeighborListTree, &NeighborListTree::slotMaxNumChanged>(this);
     m_pdata->getParticleSortSignal()
         .connect<NeighborListTree, &NeighborListTree::slotRemapParticles>(this);
+
+    m_exclusions_in_build = true;
     }
 
 NeighborListTree::~NeighborListTree()
@@ -256,14 +258,20 @@ void NeighborListTree::buildTree()
         h_aabbs.data[my_aabb_idx] = hoomd::detail::AABB(my_pos, i);
         }
 
-    // call the tree build routine, one tree per type
-    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+    // call the tree build routine, one tree per type. The trees are independent.
+    m_exec_conf->getThreadPool().parallelFor(
+        m_pdata->getNTypes(),
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        if (m_num_per_type[i] > 0)
-            {
-            m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i], m_num_per_type[i]);
-            }
-        }
+            for (unsigned int i = begin; i < end; ++i)
+                {
+                if (m_num_per_type[i] > 0)
+                    {
+                    m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i],
+                                              m_num_per_type[i]);
+                    }
+                }
+        });
     }
 
 /*!
@@ -282,7 +290,13 @@ void NeighborListTree::traverseTree()
                                      access_location::host,
                                      access_mode::read);
 
-    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_cut(m_r_cut_build, access_location::host, access_mode::read);
+
+    // exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
 
     // neighborlist data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
@@ -294,102 +308,121 @@ void NeighborListTree::traverseTree()
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
 
     // Loop over all particles
-    for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+    buildInParallel(
+        m_pdata->getN(),
+        h_conditions.data,
+        [&](unsigned int begin, unsigned int end, unsigned int* conditions)
         {
-        // read in the current position and orientation
-        const Scalar4 postype_i = h_postype.data[i];
-        const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
-        const unsigned int type_i = __scalar_as_int(postype_i.w);
-        const unsigned int body_i = h_body.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t nlist_head_i = h_head_list.data[i];
-
-        unsigned int n_neigh_i = 0;
-        for (unsigned int cur_pair_type = 0; cur_pair_type < m_pdata->getNTypes();
-             ++cur_pair_type) // loop on pair types
-            {
-            // pass on empty types
-            if (!m_num_per_type[cur_pair_type])
-                continue;
-
-            // Check if this tree type should be excluded by r_cut(i,j) <= 0.0
-            Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_pair_type)];
-            if (r_cut <= Scalar(0.0))
-                continue;
+            for (unsigned int i = begin; i < end; ++i)
+                {
+                // read in the current position and orientation
+                const Scalar4 postype_i = h_postype.data[i];
+                const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+                const unsigned int type_i = __scalar_as_int(postype_i.w);
+                const unsigned int body_i = h_body.data[i];
+
+                const unsigned int Nmax_i = h_Nmax.data[type_i];
+                const size_t nlist_head_i = h_head_list.data[i];
+
+                unsigned int n_neigh_i = 0;
+                for (unsigned int cur_pair_type = 0; cur_pair_type < m_pdata->getNTypes();
+                     ++cur_pair_type) // loop on pair types
+                    {
+                    // pass on empty types
+                    if (!m_num_per_type[cur_pair_type])
+                        continue;
 
-            // Determine the minimum r_cut_i (with buffer) for this particle
-            Scalar r_cut_i = r_cut + m_r_buff;
-            Scalar r_cutsq_i = r_cut_i * r_cut_i;
-            Scalar r_list_i = r_cut_i;
+                    // Check if this tree type should be excluded by r_cut(i,j) <= 0.0
+                    Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_pair_type)];
+                    if (r_cut <= Scalar(0.0))
+                        continue;
 
-            hoomd::detail::AABBTree* cur_aabb_tree = &m_aabb_trees[cur_pair_type];
+                    // Determine the minimum r_cut_i (with buffer) for this particle
+                    Scalar r_cut_i = r_cut + m_r_buff;
+                    Scalar r_cutsq_i = r_cut_i * r_cut_i;
+                    Scalar r_list_i = r_cut_i;
 
-            for (unsigned int cur_image = 0; cur_image < m_n_images;
-                 ++cur_image) // for each image vector
-                {
-                // make an AABB for the image of this particle
-                vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
-                hoomd::detail::AABB aabb = hoomd::detail::AABB(pos_i_image, r_list_i);
+                    hoomd::detail::AABBTree* cur_aabb_tree = &m_aabb_trees[cur_pair_type];
 
-                // stackless traversal of the tree
-                for (unsigned int cur_node_idx = 0; cur_node_idx < cur_aabb_tree->getNumNodes();
-                     ++cur_node_idx)
-                    {
-                    if (aabb.overlaps(cur_aabb_tree->getNodeAABB(cur_node_idx)))
+                    for (unsigned int cur_image = 0; cur_image < m_n_images;
+                         ++cur_image) // for each image vector
                         {
-                        if (cur_aabb_tree->isNodeLeaf(cur_node_idx))
+                        // make an AABB for the image of this particle
+                        vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+                        hoomd::detail::AABB aabb = hoomd::detail::AABB(pos_i_image, r_list_i);
+
+                        // stackless traversal of the tree
+                        for (unsigned int cur_node_idx = 0;
+                             cur_node_idx < cur_aabb_tree->getNumNodes();
+                             ++cur_node_idx)
                             {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < cur_aabb_tree->getNodeNumParticles(cur_node_idx);
-                                 ++cur_p)
+                            if (aabb.overlaps(cur_aabb_tree->getNodeAABB(cur_node_idx)))
                                 {
-                                // neighbor j
-                                unsigned int j
-                                    = cur_aabb_tree->getNodeParticleTag(cur_node_idx, cur_p);
+                                if (cur_aabb_tree->isNodeLeaf(cur_node_idx))
+                                    {
+                                    for (unsigned int cur_p = 0;
+                                         cur_p < cur_aabb_tree->getNodeNumParticles(cur_node_idx);
+                                         ++cur_p)
+                                        {
+                                        // neighbor j
+                                        unsigned int j
+                                            = cur_aabb_tree->getNodeParticleTag(cur_node_idx,
+                                                                                cur_p);
 
-                                // skip self-interaction always
-                                bool excluded = (i == j);
+                                        // skip self-interaction always
+                                        bool excluded = (i == j);
 
-                                if (m_filter_body && body_i != NO_BODY)
-                                    excluded = excluded | (body_i == h_body.data[j]);
+                                        if (m_filter_body && body_i != NO_BODY)
+                                            excluded = excluded | (body_i == h_body.data[j]);
 
-                                if (!excluded)
-                                    {
-                                    // compute distance
-                                    Scalar4 postype_j = h_postype.data[j];
-                                    Scalar3 drij
-                                        = make_scalar3(postype_j.x, postype_j.y, postype_j.z)
-                                          - vec_to_scalar3(pos_i_image);
-                                    Scalar dr_sq = dot(drij, drij);
-
-                                    if (dr_sq <= r_cutsq_i)
-                                        {
-                                        if (m_storage_mode == full || i < j)
+                                        if (!excluded)
                                             {
-                                            if (n_neigh_i < Nmax_i)
-                                                h_nlist.data[nlist_head_i + n_neigh_i] = j;
-                                            else
-                                                h_conditions.data[type_i]
-                                                    = max(h_conditions.data[type_i], n_neigh_i + 1);
-
-                                            ++n_neigh_i;
+                                            // compute distance
+                                            Scalar4 postype_j = h_postype.data[j];
+                                            Scalar3 drij = make_scalar3(postype_j.x,
+                                                                        postype_j.y,
+                                                                        postype_j.z)
+                                                           - vec_to_scalar3(pos_i_image);
+                                            Scalar dr_sq = dot(drij, drij);
+
+                                            // apply the explicit exclusions only to pairs
+                                            // within range
+                                            if (dr_sq <= r_cutsq_i && m_exclusions_set
+                                                && isExcluded(h_n_ex_idx.data,
+                                                              h_ex_list_idx.data,
+                                                              i,
+                                                              j))
+                                                continue;
+
+                                            if (dr_sq <= r_cutsq_i)
+                                                {
+                                                if (m_storage_mode == full || i < j)
+                                                    {
+                                                    if (n_neigh_i < Nmax_i)
+                                                        h_nlist.data[nlist_head_i + n_neigh_i] = j;
+                                                    else
+                                                        conditions[type_i]
+                                                            = max(conditions[type_i],
+                                                                  n_neigh_i + 1);
+
+                                                    ++n_neigh_i;
+                                                    }
+                                                }
                                             }
                                         }
                                     }
                                 }
-                            }
-                        }
-                    else
-                        {
-                        // skip ahead
-                        cur_node_idx += cur_aabb_tree->getNodeSkip(cur_node_idx);
-                        }
-                    } // end stackless search
-                } // end loop over images
-            } // end loop over pair types
-        h_n_neigh.data[i] = n_neigh_i;
-        } // end loop over particles
+                            else
+                                {
+                                // skip ahead
+                                cur_node_idx += cur_aabb_tree->getNodeSkip(cur_node_idx);
+                                }
+                            } // end stackless search
+                        } // end loop over images
+                    } // end loop over pair types
+                h_n_neigh.data[i] = n_neigh_i;
+                } // end loop over particles
+        });
     }
 
 namespace detail
@@ -399,7 +432,8 @@ void export_NeighborListTree(pybind11::module& m)
     pybind11::class_<NeighborListTree, NeighborList, std::shared_ptr<NeighborListTree>>(
         m,
         "NeighborListTree")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("refit", &NeighborListTree::getRefit, &NeighborListTree::setRefit);
     }
 
     } // end namespace detail
@@ -49,6 +49,21 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
     //! Destructor
     virtual ~NeighborListTree();
 
+    //! Enable or disable refits
+    /*! The CPU trees are always rebuilt. The flag is kept so that scripts can set it for both
+        NeighborListTree and NeighborListGPUTree.
+    */
+    void setRefit(bool refit)
+        {
+        m_refit = refit;
+        }
+
+    //! Test if refits are enabled
+    bool getRefit()
+        {
+        return m_refit;
+        }
+
     protected:
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
@@ -75,6 +90,7 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
     bool m_box_changed;     //!< Flag if box size has changed
     bool m_max_num_changed; //!< Flag if the particle arrays need to be resized
     bool m_remap_particles; //!< Flag if the particles need to remapped (triggered by sort)
+    bool m_refit = false;   //!< Flag if refits are enabled (unused on the CPU)
 
     /// set to true when the type data has been allocated
     bool m_types_allocated;
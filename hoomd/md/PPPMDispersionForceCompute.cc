@@ -0,0 +1,221 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "PPPMDispersionForceCompute.h"
+
+/*! \file PPPMDispersionForceCompute.cc
+    \brief Defines the PPPMDispersionForceCompute class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef The system definition
+    \param nlist Neighbor list
+    \param group Group of particles to compute the interaction between
+ */
+PPPMDispersionForceCompute::PPPMDispersionForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                                       std::shared_ptr<NeighborList> nlist,
+                                                       std::shared_ptr<ParticleGroup> group)
+    : PPPMForceCompute(sysdef, nlist, group), m_coefficients(m_pdata->getNTypes(), Scalar(0.0))
+    {
+    GPUArray<Scalar> strengths(m_pdata->getN() + m_pdata->getNGhosts(), m_exec_conf);
+    m_strengths.swap(strengths);
+    }
+
+PPPMDispersionForceCompute::~PPPMDispersionForceCompute() { }
+
+/*! \param type_name Name of the particle type
+    \param coefficient Dispersion coefficient \f$ c_i \f$ of the type
+*/
+void PPPMDispersionForceCompute::setCoefficient(const std::string& type_name, Scalar coefficient)
+    {
+    unsigned int type = m_pdata->getTypeByName(type_name);
+    m_coefficients[type] = coefficient;
+    m_need_initialize = true;
+    }
+
+/*! \param type_name Name of the particle type
+    \returns The dispersion coefficient of the type
+*/
+Scalar PPPMDispersionForceCompute::getCoefficient(const std::string& type_name)
+    {
+    unsigned int type = m_pdata->getTypeByName(type_name);
+    return m_coefficients[type];
+    }
+
+void PPPMDispersionForceCompute::computeForces(uint64_t timestep)
+    {
+    updateStrengths();
+    PPPMForceCompute::computeForces(timestep);
+    }
+
+void PPPMDispersionForceCompute::updateStrengths()
+    {
+    unsigned int n_particles = m_pdata->getN() + m_pdata->getNGhosts();
+    if (m_strengths.getNumElements() < n_particles)
+        {
+        m_strengths.resize(n_particles);
+        }
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar> h_strengths(m_strengths, access_location::host, access_mode::overwrite);
+
+    for (unsigned int idx = 0; idx < n_particles; idx++)
+        {
+        unsigned int type = __scalar_as_int(h_postype.data[idx].w);
+        h_strengths.data[idx] = m_coefficients[type];
+        }
+    }
+
+void PPPMDispersionForceCompute::setupCoeffs()
+    {
+    ArrayHandle<Scalar> h_strengths(m_strengths, access_location::host, access_mode::read);
+
+    // m_q and m_q2 hold the sums of the coefficients and their squares
+    m_q = Scalar(0.0);
+    m_q2 = Scalar(0.0);
+
+    unsigned int group_size = m_group->getNumMembers();
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+
+        m_q += h_strengths.data[j];
+        m_q2 += h_strengths.data[j] * h_strengths.data[j];
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        // reduce sum
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &m_q,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &m_q2,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    // relative magnitude of the real space term that is neglected beyond the cutoff
+    Scalar x2 = m_kappa * m_kappa * m_rcut * m_rcut;
+    Scalar g = exp(-x2) * (Scalar(1.0) + x2 + Scalar(0.5) * x2 * x2);
+    m_exec_conf->msg->notice(2) << "dispersion.pppm: relative real space error at r_cut: " << g
+                                << std::endl;
+
+    // initialize coefficients for charge assignment
+    compute_rho_coeff();
+
+    // initialize coefficients for Green's function
+    compute_gf_denom();
+    }
+
+void PPPMDispersionForceCompute::computeVirial()
+    {
+    PPPMForceCompute::computeVirial();
+
+    if (m_exec_conf->getRank() == 0)
+        {
+        // the k = 0 term is inversely proportional to the volume
+        Scalar V = m_pdata->getGlobalBox().getVolume();
+        Scalar energy_k0 = -Scalar(M_PI * sqrt(M_PI)) * m_kappa * m_kappa * m_kappa * m_q * m_q
+                           / (Scalar(6.0) * V);
+        m_external_virial[0] += energy_k0;
+        m_external_virial[3] += energy_k0;
+        m_external_virial[5] += energy_k0;
+        }
+    }
+
+/*! \param ksq Squared magnitude of the wave vector
+
+    \returns The Fourier transform of \f$ -(1 - g(\beta r))/r^6 \f$
+*/
+Scalar PPPMDispersionForceCompute::evalReferencePotential(Scalar ksq)
+    {
+    Scalar beta = m_kappa;
+    Scalar b = sqrt(ksq) / (Scalar(2.0) * beta);
+    Scalar bsq = b * b;
+    Scalar F = (Scalar(1.0) - Scalar(2.0) * bsq) * exp(-bsq)
+               + Scalar(2.0 * sqrt(M_PI)) * bsq * b * erfc(b);
+    return -Scalar(M_PI * sqrt(M_PI) / 3.0) * beta * beta * beta * F;
+    }
+
+/*! \param ksq Squared magnitude of the wave vector
+
+    \returns 2 d ln(phi(k)) / d k^2, where phi(k) is given by evalReferencePotential()
+*/
+Scalar PPPMDispersionForceCompute::computeVirialFactor(Scalar ksq)
+    {
+    Scalar beta = m_kappa;
+    Scalar b = sqrt(ksq) / (Scalar(2.0) * beta);
+    Scalar bsq = b * b;
+    Scalar exp_val = exp(-bsq);
+    Scalar erfc_val = erfc(b);
+    Scalar F = (Scalar(1.0) - Scalar(2.0) * bsq) * exp_val
+               + Scalar(2.0 * sqrt(M_PI)) * bsq * b * erfc_val;
+    return Scalar(3.0) * (Scalar(sqrt(M_PI)) * b * erfc_val - exp_val)
+           / (Scalar(2.0) * beta * beta * F);
+    }
+
+/*! \param rsq Squared distance between the particles
+    \param pair_eng Output parameter to write the long-range pair energy between unit sources
+    \param force_divr Output parameter to write the force divided by r
+*/
+void PPPMDispersionForceCompute::evalLongRangePair(Scalar rsq,
+                                                   Scalar& pair_eng,
+                                                   Scalar& force_divr)
+    {
+    Scalar r2inv = Scalar(1.0) / rsq;
+    Scalar r6inv = r2inv * r2inv * r2inv;
+    Scalar x2 = m_kappa * m_kappa * rsq;
+    Scalar exp_val = exp(-x2);
+    Scalar one_minus_g = Scalar(1.0) - exp_val * (Scalar(1.0) + x2 + Scalar(0.5) * x2 * x2);
+
+    pair_eng = -one_minus_g * r6inv;
+    force_divr = r6inv * r2inv * (exp_val * x2 * x2 * x2 - Scalar(6.0) * one_minus_g);
+    }
+
+/*! \returns The self energy and the k = 0 term
+ */
+Scalar PPPMDispersionForceCompute::computeEnergyCorrection()
+    {
+    Scalar beta = m_kappa;
+    Scalar beta3 = beta * beta * beta;
+    Scalar V = m_pdata->getGlobalBox().getVolume();
+
+    // the long-range part approaches -c_i^2 beta^6 / 6 at r = 0
+    Scalar self_energy = -beta3 * beta3 / Scalar(12.0) * m_q2;
+
+    // the mesh sum excludes the DC bin, which is finite for dispersion
+    Scalar energy_k0 = -Scalar(M_PI * sqrt(M_PI)) * beta3 * m_q * m_q / (Scalar(6.0) * V);
+
+    return energy_k0 - self_energy;
+    }
+
+namespace detail
+    {
+void export_PPPMDispersionForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<PPPMDispersionForceCompute,
+                     PPPMForceCompute,
+                     std::shared_ptr<PPPMDispersionForceCompute>>(m, "PPPMDispersionForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            std::shared_ptr<ParticleGroup>>())
+        .def("setCoefficient", &PPPMDispersionForceCompute::setCoefficient)
+        .def("getCoefficient", &PPPMDispersionForceCompute::getCoefficient);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
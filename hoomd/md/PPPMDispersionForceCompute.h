@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PPPM_DISPERSION_FORCE_COMPUTE_H__
+#define __PPPM_DISPERSION_FORCE_COMPUTE_H__
+
+#include "PPPMForceCompute.h"
+
+#include <string>
+#include <vector>
+
+/*! \file PPPMDispersionForceCompute.h
+    \brief Declares a class for computing the reciprocal space part of Ewald summed dispersion
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Compute the long-ranged part of the dispersion interaction with the PPPM method
+/*! The dispersion interaction between particles i and j is \f$ -C_{6,ij} / r^6 \f$. The mesh
+    evaluates the long-range part
+    \f[ -c_i c_j \frac{1 - g(\beta r)}{r^6}, \quad g(x) = e^{-x^2} (1 + x^2 + x^4/2) \f]
+    between all pairs, which assumes the geometric mixing rule \f$ C_{6,ij} = c_i c_j \f$ for the
+    per-type coefficients \f$ c_i \f$. EvaluatorPairDispersionEwald removes the long-range part
+    within the real space cutoff.
+
+    The charge assignment, FFTs, ghost cell communication and force interpolation are those of
+    PPPMForceCompute with the per-type coefficients in place of the charges. The splitting parameter
+    \f$ \beta \f$ is stored as kappa.
+*/
+class PYBIND11_EXPORT PPPMDispersionForceCompute : public PPPMForceCompute
+    {
+    public:
+    //! Constructor
+    PPPMDispersionForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                               std::shared_ptr<NeighborList> nlist,
+                               std::shared_ptr<ParticleGroup> group);
+    virtual ~PPPMDispersionForceCompute();
+
+    //! Set the dispersion coefficient of a particle type
+    void setCoefficient(const std::string& type_name, Scalar coefficient);
+
+    //! Get the dispersion coefficient of a particle type
+    Scalar getCoefficient(const std::string& type_name);
+
+    void computeForces(uint64_t timestep);
+
+    protected:
+    std::vector<Scalar> m_coefficients; //!< Dispersion coefficient of each type
+    GPUArray<Scalar> m_strengths;       //!< Dispersion coefficient of each local and ghost particle
+
+    //! Fill m_strengths from the particle types
+    void updateStrengths();
+
+    //! Setup coefficients
+    virtual void setupCoeffs();
+
+    //! Helper function to compute the virial
+    virtual void computeVirial();
+
+    //! Get the per-particle dispersion coefficients
+    virtual const GPUArray<Scalar>& getSourceStrengths()
+        {
+        return m_strengths;
+        }
+
+    //! Get the dispersion coefficient of a particle in a snapshot
+    virtual Scalar getSnapshotStrength(const SnapshotParticleData<Scalar>& snap, unsigned int i)
+        {
+        return m_coefficients[snap.type[i]];
+        }
+
+    //! Evaluate the Fourier transform of the long-range interaction
+    virtual Scalar evalReferencePotential(Scalar ksq);
+
+    //! Compute the wave vector dependent factor of the reciprocal space virial
+    virtual Scalar computeVirialFactor(Scalar ksq);
+
+    //! Evaluate the long-range part of the interaction between two unit sources
+    virtual void evalLongRangePair(Scalar rsq, Scalar& pair_eng, Scalar& force_divr);
+
+    //! Compute the energy terms that the mesh sum omits
+    virtual Scalar computeEnergyCorrection();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PPPM_DISPERSION_FORCE_COMPUTE_H__
@@ -53,6 +53,12 @@ PPPMForceCompute::PPPMForceCompute(std::shared_ptr<SystemDefinition> sysdef,
     m_order = 0;
     m_alpha = Scalar(0.0);
 
+    m_fft_group = make_uint3(1, 1, 1);
+    m_fourier_dim = make_uint3(0, 0, 0);
+    m_fft_pdim = make_uint3(1, 1, 1);
+    m_fft_pidx = make_uint3(0, 0, 0);
+    m_n_fourier_cells = 0;
+
     m_pdata->getGlobalParticleNumberChangeSignal()
         .connect<PPPMForceCompute, &PPPMForceCompute::slotGlobalParticleNumberChange>(this);
     }
@@ -133,6 +139,43 @@ void PPPMForceCompute::setParams(unsigned int nx,
     m_params_set = true;
     }
 
+/*! \param gx Number of domains along the x direction that share one FFT rank
+    \param gy Number of domains along the y direction that share one FFT rank
+    \param gz Number of domains along the z direction that share one FFT rank
+
+    The first rank of every group of gx*gy*gz domains gathers the charge mesh of the group,
+    performs the distributed FFT together with the first ranks of the other groups, and scatters
+    the force mesh back to the group. Fewer and larger messages then take part in the all-to-all
+    communication of the FFT. The default group (1,1,1) performs the FFT on all ranks. Without
+    domain decomposition, the group has no effect.
+*/
+void PPPMForceCompute::setFFTGroup(unsigned int gx, unsigned int gy, unsigned int gz)
+    {
+    if (gx == 0 || gy == 0 || gz == 0)
+        {
+        throw std::invalid_argument("The FFT group must contain at least one domain per axis.");
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        const Index3D& didx = m_pdata->getDomainDecomposition()->getDomainIndexer();
+
+        if (didx.getW() % gx || didx.getH() % gy || didx.getD() % gz)
+            {
+            std::ostringstream s;
+            s << "The FFT group (" << gx << "," << gy << "," << gz << ") does not divide "
+              << "the processor grid (" << didx.getW() << "," << didx.getH() << ","
+              << didx.getD() << ")!";
+            throw std::invalid_argument(s.str());
+            }
+        }
+#endif
+
+    m_fft_group = make_uint3(gx, gy, gz);
+    m_need_initialize = true;
+    }
+
 PPPMForceCompute::~PPPMForceCompute()
     {
     m_pdata->getGlobalParticleNumberChangeSignal()
@@ -150,6 +193,7 @@ PPPMForceCompute::~PPPMForceCompute()
         dfft_destroy_plan(m_dfft_plan_forward);
         dfft_destroy_plan(m_dfft_plan_inverse);
         }
+    freeFFTGroups();
 #endif
     m_pdata->getBoxChangeSignal().disconnect<PPPMForceCompute, &PPPMForceCompute::setBoxChange>(
         this);
@@ -399,14 +443,43 @@ void PPPMForceCompute::setupMesh()
     m_n_cells = m_grid_dim.x * m_grid_dim.y * m_grid_dim.z;
     m_n_inner_cells = m_mesh_points.x * m_mesh_points.y * m_mesh_points.z;
 
+    // layout of the Fourier space mesh
+    m_fourier_dim = m_mesh_points;
+    m_fft_pdim = make_uint3(1, 1, 1);
+    m_fft_pidx = make_uint3(0, 0, 0);
+    m_n_fourier_cells = m_n_inner_cells;
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        // the first rank of every group holds the Fourier space mesh of the group
+        const Index3D& didx = m_pdata->getDomainDecomposition()->getDomainIndexer();
+        uint3 pos = m_pdata->getDomainDecomposition()->getGridPos();
+
+        m_fourier_dim = make_uint3(m_mesh_points.x * m_fft_group.x,
+                                   m_mesh_points.y * m_fft_group.y,
+                                   m_mesh_points.z * m_fft_group.z);
+        m_fft_pdim = make_uint3(didx.getW() / m_fft_group.x,
+                                didx.getH() / m_fft_group.y,
+                                didx.getD() / m_fft_group.z);
+        m_fft_pidx
+            = make_uint3(pos.x / m_fft_group.x, pos.y / m_fft_group.y, pos.z / m_fft_group.z);
+
+        bool fft_rank
+            = !(pos.x % m_fft_group.x) && !(pos.y % m_fft_group.y) && !(pos.z % m_fft_group.z);
+        m_n_fourier_cells
+            = fft_rank ? m_fourier_dim.x * m_fourier_dim.y * m_fourier_dim.z : 0;
+        }
+#endif
+
     // allocate memory for influence function and k values
-    GPUArray<Scalar> inf_f(m_n_inner_cells, m_exec_conf);
+    GPUArray<Scalar> inf_f(m_n_fourier_cells, m_exec_conf);
     m_inf_f.swap(inf_f);
 
-    GPUArray<Scalar3> k(m_n_inner_cells, m_exec_conf);
+    GPUArray<Scalar3> k(m_n_fourier_cells, m_exec_conf);
     m_k.swap(k);
 
-    GPUArray<Scalar> virial_mesh(6 * m_n_inner_cells, m_exec_conf);
+    GPUArray<Scalar> virial_mesh(6 * m_n_fourier_cells, m_exec_conf);
     m_virial_mesh.swap(virial_mesh);
 
     initializeFFT();
@@ -473,55 +546,104 @@ void PPPMForceCompute::initializeFFT()
                 m_n_ghost_cells,
                 false));
         // set up distributed FFTs
+        if (m_dfft_initialized)
+            {
+            dfft_destroy_plan(m_dfft_plan_forward);
+            dfft_destroy_plan(m_dfft_plan_inverse);
+            m_dfft_initialized = false;
+            }
+
         int gdim[3];
         int pdim[3];
-        Index3D decomp_idx = m_pdata->getDomainDecomposition()->getDomainIndexer();
-        pdim[0] = decomp_idx.getD();
-        pdim[1] = decomp_idx.getH();
-        pdim[2] = decomp_idx.getW();
-        gdim[0] = m_mesh_points.z * pdim[0];
-        gdim[1] = m_mesh_points.y * pdim[1];
-        gdim[2] = m_mesh_points.x * pdim[2];
+        pdim[0] = m_fft_pdim.z;
+        pdim[1] = m_fft_pdim.y;
+        pdim[2] = m_fft_pdim.x;
+        gdim[0] = m_fourier_dim.z * pdim[0];
+        gdim[1] = m_fourier_dim.y * pdim[1];
+        gdim[2] = m_fourier_dim.x * pdim[2];
         int embed[3];
         embed[0] = m_mesh_points.z + 2 * m_n_ghost_cells.z;
         embed[1] = m_mesh_points.y + 2 * m_n_ghost_cells.y;
         embed[2] = m_mesh_points.x + 2 * m_n_ghost_cells.x;
         m_ghost_offset
             = (m_n_ghost_cells.z * embed[1] + m_n_ghost_cells.y) * embed[2] + m_n_ghost_cells.x;
-        uint3 pcoord = m_pdata->getDomainDecomposition()->getGridPos();
         int pidx[3];
-        pidx[0] = pcoord.z;
-        pidx[1] = pcoord.y;
-        pidx[2] = pcoord.x;
+        pidx[0] = m_fft_pidx.z;
+        pidx[1] = m_fft_pidx.y;
+        pidx[2] = m_fft_pidx.x;
         int row_m = 0; /* both local grid and proc grid are row major, no transposition necessary */
-        ArrayHandle<unsigned int> h_cart_ranks(m_pdata->getDomainDecomposition()->getCartRanks(),
-                                               access_location::host,
-                                               access_mode::read);
-        dfft_create_plan(&m_dfft_plan_forward,
-                         3,
-                         gdim,
-                         embed,
-                         NULL,
-                         pdim,
-                         pidx,
-                         row_m,
-                         0,
-                         1,
-                         m_exec_conf->getMPICommunicator(),
-                         (int*)h_cart_ranks.data);
-        dfft_create_plan(&m_dfft_plan_inverse,
-                         3,
-                         gdim,
-                         NULL,
-                         embed,
-                         pdim,
-                         pidx,
-                         row_m,
-                         0,
-                         1,
-                         m_exec_conf->getMPICommunicator(),
-                         (int*)h_cart_ranks.data);
-        m_dfft_initialized = true;
+
+        if (isFFTGrouped())
+            {
+            setupFFTGroups();
+
+            // the FFT ranks gather the inner cells of their group into a mesh without ghost cells
+            if (m_fft_comm != MPI_COMM_NULL)
+                {
+                // ranks in m_fft_comm are ordered by the position of the group
+                std::vector<int> proc_map(m_fft_pdim.x * m_fft_pdim.y * m_fft_pdim.z);
+                for (unsigned int i = 0; i < proc_map.size(); ++i)
+                    proc_map[i] = i;
+
+                dfft_create_plan(&m_dfft_plan_forward,
+                                 3,
+                                 gdim,
+                                 NULL,
+                                 NULL,
+                                 pdim,
+                                 pidx,
+                                 row_m,
+                                 0,
+                                 1,
+                                 m_fft_comm,
+                                 proc_map.data());
+                dfft_create_plan(&m_dfft_plan_inverse,
+                                 3,
+                                 gdim,
+                                 NULL,
+                                 NULL,
+                                 pdim,
+                                 pidx,
+                                 row_m,
+                                 0,
+                                 1,
+                                 m_fft_comm,
+                                 proc_map.data());
+                m_dfft_initialized = true;
+                }
+            }
+        else
+            {
+            ArrayHandle<unsigned int> h_cart_ranks(
+                m_pdata->getDomainDecomposition()->getCartRanks(),
+                access_location::host,
+                access_mode::read);
+            dfft_create_plan(&m_dfft_plan_forward,
+                             3,
+                             gdim,
+                             embed,
+                             NULL,
+                             pdim,
+                             pidx,
+                             row_m,
+                             0,
+                             1,
+                             m_exec_conf->getMPICommunicator(),
+                             (int*)h_cart_ranks.data);
+            dfft_create_plan(&m_dfft_plan_inverse,
+                             3,
+                             gdim,
+                             NULL,
+                             embed,
+                             pdim,
+                             pidx,
+                             row_m,
+                             0,
+                             1,
+                             m_exec_conf->getMPICommunicator(),
+                             (int*)h_cart_ranks.data);
+            m_dfft_initialized = true;
+            }
         }
 #endif // ENABLE_MPI
 
@@ -553,16 +675,16 @@ void PPPMForceCompute::initializeFFT()
     GPUArray<kiss_fft_cpx> mesh(m_n_cells + m_ghost_offset, m_exec_conf);
     m_mesh.swap(mesh);
 
-    GPUArray<kiss_fft_cpx> fourier_mesh(m_n_inner_cells, m_exec_conf);
+    GPUArray<kiss_fft_cpx> fourier_mesh(m_n_fourier_cells, m_exec_conf);
     m_fourier_mesh.swap(fourier_mesh);
 
-    GPUArray<kiss_fft_cpx> fourier_mesh_G_x(m_n_inner_cells, m_exec_conf);
+    GPUArray<kiss_fft_cpx> fourier_mesh_G_x(m_n_fourier_cells, m_exec_conf);
     m_fourier_mesh_G_x.swap(fourier_mesh_G_x);
 
-    GPUArray<kiss_fft_cpx> fourier_mesh_G_y(m_n_inner_cells, m_exec_conf);
+    GPUArray<kiss_fft_cpx> fourier_mesh_G_y(m_n_fourier_cells, m_exec_conf);
     m_fourier_mesh_G_y.swap(fourier_mesh_G_y);
 
-    GPUArray<kiss_fft_cpx> fourier_mesh_G_z(m_n_inner_cells, m_exec_conf);
+    GPUArray<kiss_fft_cpx> fourier_mesh_G_z(m_n_fourier_cells, m_exec_conf);
     m_fourier_mesh_G_z.swap(fourier_mesh_G_z);
 
     // pad with offset
@@ -577,6 +699,149 @@ void PPPMForceCompute::initializeFFT()
     m_inv_fourier_mesh_z.swap(inv_fourier_mesh_z);
     }
 
+#ifdef ENABLE_MPI
+/*! Ranks are split by the position of their group in the grid of FFT ranks. Within a group, ranks
+    are ordered by their position in the group, so that the rank at the lowest grid position is
+    the FFT rank (rank 0). The FFT ranks are ordered by the position of their group, which
+    matches the processor map of dfft.
+*/
+void PPPMForceCompute::setupFFTGroups()
+    {
+    freeFFTGroups();
+
+    uint3 pos = m_pdata->getDomainDecomposition()->getGridPos();
+    Index3D fft_idx(m_fft_pdim.x, m_fft_pdim.y, m_fft_pdim.z);
+    Index3D group_idx(m_fft_group.x, m_fft_group.y, m_fft_group.z);
+
+    int color = fft_idx(m_fft_pidx.x, m_fft_pidx.y, m_fft_pidx.z);
+    int key = group_idx(pos.x % m_fft_group.x, pos.y % m_fft_group.y, pos.z % m_fft_group.z);
+
+    MPI_Comm_split(m_exec_conf->getMPICommunicator(), color, key, &m_fft_group_comm);
+    MPI_Comm_split(m_exec_conf->getMPICommunicator(),
+                   key == 0 ? 0 : MPI_UNDEFINED,
+                   color,
+                   &m_fft_comm);
+    }
+
+void PPPMForceCompute::freeFFTGroups()
+    {
+    if (m_fft_group_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_fft_group_comm);
+        }
+    if (m_fft_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_fft_comm);
+        }
+    }
+
+/*! \param mesh Local mesh (with ghost cells) of this rank
+    \param block Mesh of the group (without ghost cells), only written on the FFT rank
+
+    Every member sends the inner cells of its mesh to the FFT rank, which places them at the
+    position of the member's domain in the group.
+*/
+void PPPMForceCompute::gatherFFTGroup(const kiss_fft_cpx* mesh, kiss_fft_cpx* block)
+    {
+    m_fft_send_buf.resize(m_n_inner_cells);
+    for (unsigned int z = 0; z < m_mesh_points.z; ++z)
+        for (unsigned int y = 0; y < m_mesh_points.y; ++y)
+            for (unsigned int x = 0; x < m_mesh_points.x; ++x)
+                {
+                m_fft_send_buf[(z * m_mesh_points.y + y) * m_mesh_points.x + x]
+                    = mesh[m_ghost_offset + (z * m_grid_dim.y + y) * m_grid_dim.x + x];
+                }
+
+    Index3D group_idx(m_fft_group.x, m_fft_group.y, m_fft_group.z);
+    bool fft_rank = m_n_fourier_cells > 0;
+    if (fft_rank)
+        m_fft_recv_buf.resize(group_idx.getNumElements() * m_n_inner_cells);
+
+    MPI_Gather(m_fft_send_buf.data(),
+               int(m_n_inner_cells * sizeof(kiss_fft_cpx)),
+               MPI_BYTE,
+               m_fft_recv_buf.data(),
+               int(m_n_inner_cells * sizeof(kiss_fft_cpx)),
+               MPI_BYTE,
+               0,
+               m_fft_group_comm);
+
+    if (!fft_rank)
+        return;
+
+    for (unsigned int member = 0; member < group_idx.getNumElements(); ++member)
+        {
+        uint3 member_pos = group_idx.getTriple(member);
+        uint3 offset = make_uint3(member_pos.x * m_mesh_points.x,
+                                  member_pos.y * m_mesh_points.y,
+                                  member_pos.z * m_mesh_points.z);
+        const kiss_fft_cpx* recv = m_fft_recv_buf.data() + member * m_n_inner_cells;
+
+        for (unsigned int z = 0; z < m_mesh_points.z; ++z)
+            for (unsigned int y = 0; y < m_mesh_points.y; ++y)
+                for (unsigned int x = 0; x < m_mesh_points.x; ++x)
+                    {
+                    block[((offset.z + z) * m_fourier_dim.y + offset.y + y) * m_fourier_dim.x
+                          + offset.x + x]
+                        = recv[(z * m_mesh_points.y + y) * m_mesh_points.x + x];
+                    }
+        }
+    }
+
+/*! \param block Mesh of the group (without ghost cells), only read on the FFT rank
+    \param mesh Local mesh (with ghost cells) of this rank
+
+    The FFT rank sends every member the cells of its domain, which the member stores in the inner
+    cells of its mesh. The ghost cells are not written.
+*/
+void PPPMForceCompute::scatterFFTGroup(const kiss_fft_cpx* block, kiss_fft_cpx* mesh)
+    {
+    Index3D group_idx(m_fft_group.x, m_fft_group.y, m_fft_group.z);
+    bool fft_rank = m_n_fourier_cells > 0;
+    if (fft_rank)
+        {
+        m_fft_send_buf.resize(group_idx.getNumElements() * m_n_inner_cells);
+
+        for (unsigned int member = 0; member < group_idx.getNumElements(); ++member)
+            {
+            uint3 member_pos = group_idx.getTriple(member);
+            uint3 offset = make_uint3(member_pos.x * m_mesh_points.x,
+                                      member_pos.y * m_mesh_points.y,
+                                      member_pos.z * m_mesh_points.z);
+            kiss_fft_cpx* send = m_fft_send_buf.data() + member * m_n_inner_cells;
+
+            for (unsigned int z = 0; z < m_mesh_points.z; ++z)
+                for (unsigned int y = 0; y < m_mesh_points.y; ++y)
+                    for (unsigned int x = 0; x < m_mesh_points.x; ++x)
+                        {
+                        send[(z * m_mesh_points.y + y) * m_mesh_points.x + x]
+                            = block[((offset.z + z) * m_fourier_dim.y + offset.y + y)
+                                        * m_fourier_dim.x
+                                    + offset.x + x];
+                        }
+            }
+        }
+
+    m_fft_recv_buf.resize(m_n_inner_cells);
+    MPI_Scatter(m_fft_send_buf.data(),
+                int(m_n_inner_cells * sizeof(kiss_fft_cpx)),
+                MPI_BYTE,
+                m_fft_recv_buf.data(),
+                int(m_n_inner_cells * sizeof(kiss_fft_cpx)),
+                MPI_BYTE,
+                0,
+                m_fft_group_comm);
+
+    for (unsigned int z = 0; z < m_mesh_points.z; ++z)
+        for (unsigned int y = 0; y < m_mesh_points.y; ++y)
+            for (unsigned int x = 0; x < m_mesh_points.x; ++x)
+                {
+                mesh[m_ghost_offset + (z * m_grid_dim.y + y) * m_grid_dim.x + x]
+                    = m_fft_recv_buf[(z * m_mesh_points.y + y) * m_mesh_points.x + x];
+                }
+    }
+#endif
+
 //! CPU implementation of sinc(x)==sin(x)/x
 inline Scalar sinc(Scalar x)
     {
@@ -634,15 +899,6 @@ void PPPMForceCompute::computeInfluenceFunction()
 
 #ifdef ENABLE_MPI
     bool local_fft = m_kiss_fft_initialized;
-
-    uint3 pdim = make_uint3(0, 0, 0);
-    uint3 pidx = make_uint3(0, 0, 0);
-    if (m_pdata->getDomainDecomposition())
-        {
-        const Index3D& didx = m_pdata->getDomainDecomposition()->getDomainIndexer();
-        pidx = m_pdata->getDomainDecomposition()->getGridPos();
-        pdim = make_uint3(didx.getW(), didx.getH(), didx.getD());
-        }
 #endif
 
     Scalar3 kH = Scalar(2.0 * M_PI)
@@ -661,22 +917,22 @@ void PPPMForceCompute::computeInfluenceFunction()
     temp = floor(((m_kappa * L.z / (M_PI * m_global_dim.z)) * pow(-log(EPS_HOC), 0.25)));
     int nbz = (int)temp;
 
-    for (unsigned int cell_idx = 0; cell_idx < m_n_inner_cells; ++cell_idx)
+    for (unsigned int cell_idx = 0; cell_idx < m_n_fourier_cells; ++cell_idx)
         {
         uint3 wave_idx;
 #ifdef ENABLE_MPI
         if (!local_fft)
             {
             // local layout: row major
-            int ny = m_mesh_points.y;
-            int nx = m_mesh_points.x;
+            int ny = m_fourier_dim.y;
+            int nx = m_fourier_dim.x;
             int n_local = cell_idx / ny / nx;
             int m_local = (cell_idx - n_local * ny * nx) / nx;
             int l_local = cell_idx % nx;
             // cyclic distribution
-            wave_idx.x = l_local * pdim.x + pidx.x;
-            wave_idx.y = m_local * pdim.y + pidx.y;
-            wave_idx.z = n_local * pdim.z + pidx.z;
+            wave_idx.x = l_local * m_fft_pdim.x + m_fft_pidx.x;
+            wave_idx.y = m_local * m_fft_pdim.y + m_fft_pidx.y;
+            wave_idx.z = n_local * m_fft_pdim.z + m_fft_pidx.z;
             }
         else
 #endif
@@ -707,8 +963,6 @@ void PPPMForceCompute::computeInfluenceFunction()
         if (n.x != 0 || n.y != 0 || n.z != 0)
             {
             Scalar sum1(0.0);
-            Scalar numerator = Scalar(4.0 * M_PI) / dot(k, k);
-
             Scalar denominator = gf_denom(snx * snx, sny * sny, snz * snz);
 
             for (int ix = -nbx; ix <= nbx; ix++)
@@ -752,16 +1006,13 @@ void PPPMForceCompute::computeInfluenceFunction()
 
                         Scalar3 kn = knx + kny + knz;
                         Scalar dot1 = dot(kn, k);
-                        Scalar dot2 = dot(kn, kn) + m_alpha * m_alpha;
 
-                        Scalar arg_gauss = Scalar(0.25) * dot2 / m_kappa / m_kappa;
-                        Scalar gauss = exp(-arg_gauss);
-
-                        sum1 += (dot1 / dot2) * gauss * wx * wx * wy * wy * wz * wz;
+                        sum1 += dot1 * evalReferencePotential(dot(kn, kn)) * wx * wx * wy * wy
+                                * wz * wz;
                         }
                     }
                 }
-            h_inf_f.data[cell_idx] = numerator * sum1 / denominator;
+            h_inf_f.data[cell_idx] = sum1 / (dot(k, k) * denominator);
             }
         else // q=0
             {
@@ -773,13 +1024,47 @@ void PPPMForceCompute::computeInfluenceFunction()
     }
 
 //! Assignment of particles to mesh using variable order interpolation scheme
+void PPPMForceCompute::reserveChargedParticles()
+    {
+    unsigned int group_size = m_group->getNumMembers();
+    if (m_charged_idx.isNull() || m_charged_idx.getNumElements() < group_size)
+        {
+        GPUArray<unsigned int> charged_idx(std::max(group_size, 1u), m_exec_conf);
+        m_charged_idx.swap(charged_idx);
+        }
+    }
+
+/*! assignParticles() and interpolateForces() visit only the listed particles. Charges can change
+    through local snapshots without any notification, so the list is compacted at every compute.
+    The pass reads one charge per group member, while each charged particle costs order^3 mesh
+    updates in both assignParticles() and interpolateForces().
+*/
+void PPPMForceCompute::updateChargedParticles()
+    {
+    reserveChargedParticles();
+
+    ArrayHandle<Scalar> h_charge(getSourceStrengths(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_charged_idx(m_charged_idx,
+                                            access_location::host,
+                                            access_mode::overwrite);
+
+    m_n_charged = 0;
+    unsigned int group_size = m_group->getNumMembers();
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        {
+        unsigned int idx = m_group->getMemberIndex(group_idx);
+        if (h_charge.data[idx] != Scalar(0.0))
+            h_charged_idx.data[m_n_charged++] = idx;
+        }
+    }
+
 void PPPMForceCompute::assignParticles()
     {
     ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                    access_location::host,
                                    access_mode::read);
     ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(getSourceStrengths(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
 
@@ -790,11 +1075,14 @@ void PPPMForceCompute::assignParticles()
 
     Scalar V_cell = box.getVolume() / (Scalar)(m_mesh_points.x * m_mesh_points.y * m_mesh_points.z);
 
-    // loop over group
-    unsigned int group_size = m_group->getNumMembers();
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    ArrayHandle<unsigned int> h_charged_idx(m_charged_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    // loop over the charged group members
+    for (unsigned int charged_idx = 0; charged_idx < m_n_charged; charged_idx++)
         {
-        unsigned int idx = m_group->getMemberIndex(group_idx);
+        unsigned int idx = h_charged_idx.data[charged_idx];
 
         Scalar4 postype = h_postype.data[idx];
         Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
@@ -954,10 +1242,27 @@ void PPPMForceCompute::updateMeshes()
                                                  access_location::host,
                                                  access_mode::overwrite);
 
-        dfft_execute((cpx_t*)(h_mesh.data + m_ghost_offset),
-                     (cpx_t*)h_fourier_mesh.data,
-                     0,
-                     m_dfft_plan_forward);
+        if (isFFTGrouped())
+            {
+            // collect the mesh of the group on the FFT rank
+            m_fft_buf.resize(m_n_fourier_cells);
+            gatherFFTGroup(h_mesh.data, m_fft_buf.data());
+
+            if (m_n_fourier_cells)
+                {
+                dfft_execute((cpx_t*)m_fft_buf.data(),
+                             (cpx_t*)h_fourier_mesh.data,
+                             0,
+                             m_dfft_plan_forward);
+                }
+            }
+        else
+            {
+            dfft_execute((cpx_t*)(h_mesh.data + m_ghost_offset),
+                         (cpx_t*)h_fourier_mesh.data,
+                         0,
+                         m_dfft_plan_forward);
+            }
         }
 #endif
 
@@ -980,7 +1285,7 @@ void PPPMForceCompute::updateMeshes()
         unsigned int NNN = m_global_dim.x * m_global_dim.y * m_global_dim.z;
 
         // multiply with influence function and I*k
-        for (unsigned int k = 0; k < m_n_inner_cells; ++k)
+        for (unsigned int k = 0; k < m_n_fourier_cells; ++k)
             {
             kiss_fft_cpx f = h_fourier_mesh.data[k];
 
@@ -1050,18 +1355,42 @@ void PPPMForceCompute::updateMeshes()
                                                        access_location::host,
                                                        access_mode::overwrite);
 
-        dfft_execute((cpx_t*)h_fourier_mesh_G_x.data,
-                     (cpx_t*)(h_inv_fourier_mesh_x.data + m_ghost_offset),
-                     1,
-                     m_dfft_plan_inverse);
-        dfft_execute((cpx_t*)h_fourier_mesh_G_y.data,
-                     (cpx_t*)(h_inv_fourier_mesh_y.data + m_ghost_offset),
-                     1,
-                     m_dfft_plan_inverse);
-        dfft_execute((cpx_t*)h_fourier_mesh_G_z.data,
-                     (cpx_t*)(h_inv_fourier_mesh_z.data + m_ghost_offset),
-                     1,
-                     m_dfft_plan_inverse);
+        if (isFFTGrouped())
+            {
+            // transform on the FFT rank and return every member the cells of its domain
+            kiss_fft_cpx* fourier_mesh[3]
+                = {h_fourier_mesh_G_x.data, h_fourier_mesh_G_y.data, h_fourier_mesh_G_z.data};
+            kiss_fft_cpx* inv_fourier_mesh[3] = {h_inv_fourier_mesh_x.data,
+                                                 h_inv_fourier_mesh_y.data,
+                                                 h_inv_fourier_mesh_z.data};
+
+            for (unsigned int i = 0; i < 3; ++i)
+                {
+                if (m_n_fourier_cells)
+                    {
+                    dfft_execute((cpx_t*)fourier_mesh[i],
+                                 (cpx_t*)m_fft_buf.data(),
+                                 1,
+                                 m_dfft_plan_inverse);
+                    }
+                scatterFFTGroup(m_fft_buf.data(), inv_fourier_mesh[i]);
+                }
+            }
+        else
+            {
+            dfft_execute((cpx_t*)h_fourier_mesh_G_x.data,
+                         (cpx_t*)(h_inv_fourier_mesh_x.data + m_ghost_offset),
+                         1,
+                         m_dfft_plan_inverse);
+            dfft_execute((cpx_t*)h_fourier_mesh_G_y.data,
+                         (cpx_t*)(h_inv_fourier_mesh_y.data + m_ghost_offset),
+                         1,
+                         m_dfft_plan_inverse);
+            dfft_execute((cpx_t*)h_fourier_mesh_G_z.data,
+                         (cpx_t*)(h_inv_fourier_mesh_z.data + m_ghost_offset),
+                         1,
+                         m_dfft_plan_inverse);
+            }
         }
 #endif
 
@@ -1085,7 +1414,7 @@ void PPPMForceCompute::interpolateForces()
     ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                    access_location::host,
                                    access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(getSourceStrengths(), access_location::host, access_mode::read);
 
     // access inverse Fourier transform mesh
     ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_x(m_inv_fourier_mesh_x,
@@ -1108,11 +1437,14 @@ void PPPMForceCompute::interpolateForces()
 
     const BoxDim& box = m_pdata->getBox();
 
-    // loop over group
-    unsigned int group_size = m_group->getNumMembers();
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    ArrayHandle<unsigned int> h_charged_idx(m_charged_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    // loop over the charged group members
+    for (unsigned int charged_idx = 0; charged_idx < m_n_charged; charged_idx++)
         {
-        unsigned int idx = m_group->getMemberIndex(group_idx);
+        unsigned int idx = h_charged_idx.data[charged_idx];
         Scalar4 postype = h_postype.data[idx];
 
         Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
@@ -1264,12 +1596,11 @@ Scalar PPPMForceCompute::computePE()
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
-        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
+        exclude_dc = !m_fft_pidx.x && !m_fft_pidx.y && !m_fft_pidx.z;
         }
 #endif
 
-    for (unsigned int k = 0; k < m_n_inner_cells; ++k)
+    for (unsigned int k = 0; k < m_n_fourier_cells; ++k)
         {
         bool exclude = false;
         if (exclude_dc)
@@ -1290,14 +1621,8 @@ Scalar PPPMForceCompute::computePE()
 
     if (m_exec_conf->getRank() == 0)
         {
-        // subtract self-energy on rank 0 (see Frenkel and Smit, and Salin and Caillol)
-        sum -= m_q2
-               * (m_kappa / sqrt(Scalar(M_PI))
-                      * exp(-m_alpha * m_alpha / (Scalar(4.0) * m_kappa * m_kappa))
-                  - Scalar(0.5) * m_alpha * erfc(m_alpha / (Scalar(2.0) * m_kappa)));
-
-        // k = 0 term already accounted for by exclude_dc
-        // sum -= Scalar(0.5*M_PI)*m_q*m_q / (m_kappa*m_kappa* V);
+        // subtract self-energy on rank 0
+        sum += computeEnergyCorrection();
         }
 
     // apply rigid body correction
@@ -1369,6 +1694,8 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
         m_box_changed = false;
         }
 
+    updateChargedParticles();
+
     assignParticles();
 
     updateMeshes();
@@ -1413,12 +1740,11 @@ void PPPMForceCompute::computeVirial()
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
-        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
+        exclude_dc = !m_fft_pidx.x && !m_fft_pidx.y && !m_fft_pidx.z;
         }
 #endif
 
-    for (unsigned int kidx = 0; kidx < m_n_inner_cells; ++kidx)
+    for (unsigned int kidx = 0; kidx < m_n_fourier_cells; ++kidx)
         {
         bool exclude = false;
         if (exclude_dc)
@@ -1435,7 +1761,7 @@ void PPPMForceCompute::computeVirial()
 
             Scalar rhog = (fourier.r * fourier.r + fourier.i * fourier.i) * h_inf_f.data[kidx];
 
-            Scalar vterm = -Scalar(2.0) * (Scalar(1.0) / ksq + Scalar(0.25) / (m_kappa * m_kappa));
+            Scalar vterm = computeVirialFactor(ksq);
             virial[0] += rhog * (Scalar(1.0) + vterm * k.x * k.x); // xx
             virial[1] += rhog * (vterm * k.x * k.y);               // xy
             virial[2] += rhog * (vterm * k.x * k.z);               // xz
@@ -1476,6 +1802,46 @@ eval_pppm_real_space(Scalar alpha, Scalar kappa, Scalar rsq, Scalar& pair_eng, S
           / rsq;
     }
 
+/*! \param ksq Squared magnitude of the wave vector
+
+    \returns The Fourier transform of the screened long-range Coulomb interaction
+*/
+Scalar PPPMForceCompute::evalReferencePotential(Scalar ksq)
+    {
+    Scalar ksq_alpha = ksq + m_alpha * m_alpha;
+    return Scalar(4.0 * M_PI) * exp(-Scalar(0.25) * ksq_alpha / (m_kappa * m_kappa)) / ksq_alpha;
+    }
+
+/*! \param ksq Squared magnitude of the wave vector
+
+    \returns 2 d ln(phi(k)) / d k^2, where phi(k) is given by evalReferencePotential()
+*/
+Scalar PPPMForceCompute::computeVirialFactor(Scalar ksq)
+    {
+    return -Scalar(2.0) * (Scalar(1.0) / ksq + Scalar(0.25) / (m_kappa * m_kappa));
+    }
+
+/*! \param rsq Squared distance between the particles
+    \param pair_eng Output parameter to write the long-range pair energy between unit charges
+    \param force_divr Output parameter to write the force divided by r
+*/
+void PPPMForceCompute::evalLongRangePair(Scalar rsq, Scalar& pair_eng, Scalar& force_divr)
+    {
+    eval_pppm_real_space(m_alpha, m_kappa, rsq, pair_eng, force_divr);
+    }
+
+/*! \returns The energy to add to the mesh sum (see Frenkel and Smit, and Salin and Caillol)
+ */
+Scalar PPPMForceCompute::computeEnergyCorrection()
+    {
+    // k = 0 term already accounted for by exclude_dc
+    // sum -= Scalar(0.5*M_PI)*m_q*m_q / (m_kappa*m_kappa* V);
+    return -m_q2
+           * (m_kappa / sqrt(Scalar(M_PI))
+                  * exp(-m_alpha * m_alpha / (Scalar(4.0) * m_kappa * m_kappa))
+              - Scalar(0.5) * m_alpha * erfc(m_alpha / (Scalar(2.0) * m_kappa)));
+    }
+
 void PPPMForceCompute::computeBodyCorrection()
     {
     // do an N^2 search over particles in a body, subtracting the real-space long-range part from
@@ -1542,14 +1908,14 @@ void PPPMForceCompute::computeBodyCorrection()
                 unsigned int i = iti->second;
 
                 vec3<Scalar> posi(snap.pos[i]);
-                Scalar qi(snap.charge[i]);
+                Scalar qi = getSnapshotStrength(snap, i);
                 int3 img_i = snap.image[i];
 
                 for (auto itj = it; itj != body_end; ++itj)
                     {
                     unsigned int j = itj->second;
                     vec3<Scalar> posj(snap.pos[j]);
-                    Scalar qj(snap.charge[j]);
+                    Scalar qj = getSnapshotStrength(snap, j);
 
                     Scalar qiqj = qi * qj;
 
@@ -1566,7 +1932,7 @@ void PPPMForceCompute::computeBodyCorrection()
                         Scalar pair_eng(0.0);
 
                         // compute correction
-                        eval_pppm_real_space(m_alpha, m_kappa, rsq, pair_eng, force_divr);
+                        evalLongRangePair(rsq, pair_eng, force_divr);
 
                         // subtract long range self-energy
                         body_energy -= Scalar(0.5) * qiqj * pair_eng;
@@ -1613,7 +1979,7 @@ void PPPMForceCompute::fixExclusions()
     Index2D nex = m_nlist->getExListIndexer();
 
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(getSourceStrengths(), access_location::host, access_mode::read);
 
     for (unsigned int i = 0; i < group_size; i++)
         {
@@ -1655,7 +2021,7 @@ void PPPMForceCompute::fixExclusions()
             if (qiqj != Scalar(0.0))
                 {
                 // evaluate the long-range pair potential
-                eval_pppm_real_space(m_alpha, m_kappa, rsq, pair_eng, force_divr);
+                evalLongRangePair(rsq, pair_eng, force_divr);
 
                 // subtract long-range part of pair-interaction
                 force_divr = -qiqj * force_divr;
@@ -1751,6 +2117,10 @@ void export_PPPMForceCompute(pybind11::module& m)
         .def("setParams", &PPPMForceCompute::setParams)
         .def("getQSum", &PPPMForceCompute::getQSum)
         .def("getQ2Sum", &PPPMForceCompute::getQ2Sum)
+        .def("setFFTGroup", &PPPMForceCompute::setFFTGroup)
+        .def_property_readonly("fft_group", &PPPMForceCompute::getFFTGroup)
+        .def("setMixedPrecision", &PPPMForceCompute::setMixedPrecision)
+        .def_property_readonly("mixed_precision", &PPPMForceCompute::getMixedPrecision)
         .def_property_readonly("resolution", &PPPMForceCompute::getResolution)
         .def_property_readonly("order", &PPPMForceCompute::getOrder)
         .def_property_readonly("kappa", &PPPMForceCompute::getKappa)
@@ -17,6 +17,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <vector>
 
 namespace hoomd
     {
@@ -84,6 +85,33 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         return m_alpha;
         }
 
+    //! Set the number of domains along each axis that share one FFT rank
+    virtual void setFFTGroup(unsigned int gx, unsigned int gy, unsigned int gz);
+
+    /// Get the number of domains along each axis that share one FFT rank
+    pybind11::tuple getFFTGroup()
+        {
+        pybind11::list val;
+        val.append(m_fft_group.x);
+        val.append(m_fft_group.y);
+        val.append(m_fft_group.z);
+
+        return pybind11::tuple(val);
+        }
+
+    /// Set whether to evaluate the charge assignment, influence function and force interpolation
+    /// in single precision (GPU only)
+    void setMixedPrecision(bool mixed_precision)
+        {
+        m_mixed_precision = mixed_precision;
+        }
+
+    /// Get whether the mesh is evaluated in single precision
+    bool getMixedPrecision() const
+        {
+        return m_mixed_precision;
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     /*! \param timestep Current time step
@@ -138,6 +166,13 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
 
     GPUArray<Scalar> m_virial_mesh; //!< k-space mesh of virial tensor values
 
+    uint3 m_fft_group;              //!< Number of domains along every axis that share one FFT rank
+    bool m_mixed_precision = false; //!< True to evaluate the mesh in single precision on the GPU
+    uint3 m_fourier_dim;            //!< Dimensions of the local Fourier space mesh
+    uint3 m_fft_pdim;               //!< Dimensions of the grid of FFT ranks
+    uint3 m_fft_pidx;               //!< Position of this rank's group in the grid of FFT ranks
+    unsigned int m_n_fourier_cells; //!< Number of local Fourier space mesh points
+
     Scalar m_kappa; //!< Splitting parameter
     Scalar m_rcut;  //!< Cutoff for short-ranged interaction
     int m_order;    //!< Order of interpolation scheme
@@ -146,6 +181,9 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     Scalar m_q;  //!< Total system charge
     Scalar m_q2; //!< Sum of charge squared
 
+    GPUArray<unsigned int> m_charged_idx; //!< Indices of the group members with non-zero charge
+    unsigned int m_n_charged = 0;         //!< Number of group members with non-zero charge
+
     GPUArray<Scalar> m_rho_coeff; //!< Coefficients for computing the grid based charge density
     GPUArray<Scalar> m_gf_b;      //!< Green function coefficients
 
@@ -173,6 +211,12 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! Compute the optimal influence function
     virtual void computeInfluenceFunction();
 
+    //! List the group members with non-zero charge
+    virtual void updateChargedParticles();
+
+    //! Make room for all group members in the charged particle list
+    void reserveChargedParticles();
+
     //! Helper function to assign particle coordinates to mesh
     virtual void assignParticles();
 
@@ -197,6 +241,36 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! Compute rigid body correction
     virtual void computeBodyCorrection();
 
+    //! Get the per-particle source strengths (charges) to assign to the mesh
+    virtual const GPUArray<Scalar>& getSourceStrengths()
+        {
+        return m_pdata->getCharges();
+        }
+
+    //! Get the source strength (charge) of a particle in a snapshot
+    virtual Scalar getSnapshotStrength(const SnapshotParticleData<Scalar>& snap, unsigned int i)
+        {
+        return snap.charge[i];
+        }
+
+    //! Evaluate the Fourier transform of the long-range interaction
+    virtual Scalar evalReferencePotential(Scalar ksq);
+
+    //! Compute the wave vector dependent factor of the reciprocal space virial
+    virtual Scalar computeVirialFactor(Scalar ksq);
+
+    //! Evaluate the long-range part of the interaction between two unit sources
+    virtual void evalLongRangePair(Scalar rsq, Scalar& pair_eng, Scalar& force_divr);
+
+    //! Compute the energy terms that the mesh sum omits
+    virtual Scalar computeEnergyCorrection();
+
+    //! computes coefficients for assigning charges to grid points
+    void compute_rho_coeff();
+
+    //! computes auxiliary table for optimized influence function
+    void compute_gf_denom();
+
     private:
     kiss_fftnd_cfg m_kiss_fft = NULL;  //!< The FFT configuration
     kiss_fftnd_cfg m_kiss_ifft = NULL; //!< Inverse FFT configuration
@@ -208,6 +282,30 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         m_grid_comm_forward; //!< Communicator for charge mesh
     std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>
         m_grid_comm_reverse; //!< Communicator for inv fourier mesh
+
+    MPI_Comm m_fft_group_comm = MPI_COMM_NULL; //!< Ranks of one group (FFT rank first)
+    MPI_Comm m_fft_comm = MPI_COMM_NULL;       //!< FFT ranks (MPI_COMM_NULL on other ranks)
+    std::vector<kiss_fft_cpx> m_fft_buf;       //!< Mesh of the group on the FFT rank
+    std::vector<kiss_fft_cpx> m_fft_send_buf;  //!< Staging buffer for the group exchange
+    std::vector<kiss_fft_cpx> m_fft_recv_buf;  //!< Staging buffer for the group exchange
+
+    //! Test if a subset of the ranks performs the distributed FFT
+    bool isFFTGrouped() const
+        {
+        return m_fft_group.x * m_fft_group.y * m_fft_group.z > 1;
+        }
+
+    //! Set up the communicators of the FFT groups
+    void setupFFTGroups();
+
+    //! Free the communicators of the FFT groups
+    void freeFFTGroups();
+
+    //! Gather a mesh from the members of the group onto the FFT rank
+    void gatherFFTGroup(const kiss_fft_cpx* mesh, kiss_fft_cpx* block);
+
+    //! Scatter a mesh from the FFT rank to the members of the group
+    void scatterFFTGroup(const kiss_fft_cpx* block, kiss_fft_cpx* mesh);
 #endif
 
     bool m_kiss_fft_initialized; //!< True if a local KISS FFT has been set up
@@ -238,12 +336,6 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! root mean square error in force calculation
     Scalar rms(Scalar h, Scalar prd, Scalar natoms);
 
-    //! computes coefficients for assigning charges to grid points
-    void compute_rho_coeff();
-
-    //! computes auxiliary table for optimized influence function
-    void compute_gf_denom();
-
     //! computes coefficients for the Green's function
     Scalar gf_denom(Scalar x, Scalar y, Scalar z);
     };
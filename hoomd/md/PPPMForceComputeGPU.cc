@@ -17,8 +17,8 @@ namespace md
 PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
                                          std::shared_ptr<NeighborList> nlist,
                                          std::shared_ptr<ParticleGroup> group)
-    : PPPMForceCompute(sysdef, nlist, group), m_local_fft(true), m_sum(m_exec_conf),
-      m_block_size(256)
+    : PPPMForceCompute(sysdef, nlist, group), m_local_fft(true), m_inf_f_k_valid(false),
+      m_sum(m_exec_conf), m_block_size(256)
     {
     m_tuner_assign.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                           m_exec_conf,
@@ -63,6 +63,17 @@ PPPMForceComputeGPU::~PPPMForceComputeGPU()
 #endif
     }
 
+/*! The GPU implementation performs the distributed FFT on all ranks.
+ */
+void PPPMForceComputeGPU::setFFTGroup(unsigned int gx, unsigned int gy, unsigned int gz)
+    {
+    if (gx != 1 || gy != 1 || gz != 1)
+        {
+        throw std::invalid_argument("FFT groups are not supported on the GPU.");
+        }
+    PPPMForceCompute::setFFTGroup(gx, gy, gz);
+    }
+
 void PPPMForceComputeGPU::initializeFFT()
     {
     // free plans if they have already been initialized
@@ -231,6 +242,28 @@ void PPPMForceComputeGPU::initializeFFT()
     m_sum_virial.swap(sum_virial);
     }
 
+void PPPMForceComputeGPU::updateChargedParticles()
+    {
+    reserveChargedParticles();
+
+    ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_charged_idx(m_charged_idx,
+                                            access_location::device,
+                                            access_mode::overwrite);
+
+    m_exec_conf->setDevice();
+    m_n_charged = kernel::gpu_select_charged_particles(m_group->getNumMembers(),
+                                                       d_index_array.data,
+                                                       d_charge.data,
+                                                       d_charged_idx.data);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
 //! Assignment of particles to mesh using three-point scheme (triangular shaped cloud)
 /*! This is a second order accurate scheme with continuous value and continuous derivative
  */
@@ -245,11 +278,10 @@ void PPPMForceComputeGPU::assignParticles()
                                               access_mode::overwrite);
     ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
 
-    // access the group
-    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+    // access the charged group members
+    ArrayHandle<unsigned int> d_charged_idx(m_charged_idx,
                                             access_location::device,
                                             access_mode::read);
-    unsigned int group_size = m_group->getNumMembers();
 
     // access interpolation polynomial coefficients
     ArrayHandle<Scalar> d_rho_coeff(m_rho_coeff, access_location::device, access_mode::read);
@@ -262,8 +294,8 @@ void PPPMForceComputeGPU::assignParticles()
     kernel::gpu_assign_particles(m_mesh_points,
                                  m_n_ghost_cells,
                                  m_grid_dim,
-                                 group_size,
-                                 d_index_array.data,
+                                 m_n_charged,
+                                 d_charged_idx.data,
                                  d_postype.data,
                                  d_charge.data,
                                  d_mesh.data,
@@ -273,7 +305,8 @@ void PPPMForceComputeGPU::assignParticles()
                                  m_pdata->getBox(),
                                  block_size,
                                  d_rho_coeff.data,
-                                 m_exec_conf->dev_prop);
+                                 m_exec_conf->dev_prop,
+                                 m_mixed_precision);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -310,6 +343,9 @@ void PPPMForceComputeGPU::updateMeshes()
         else
             dfft_cuda_check_errors(&m_dfft_plan_forward, 0);
 
+        // keep the mesh on the device during the transposes when MPI is GPU-aware
+        dfft_cuda_gpu_aware_mpi(&m_dfft_plan_forward, m_exec_conf->isGPUAwareMPIEnabled() ? 1 : 0);
+
         dfft_cuda_execute(d_mesh.data + m_ghost_offset,
                           d_mesh.data + m_ghost_offset,
                           0,
@@ -325,6 +361,60 @@ void PPPMForceComputeGPU::updateMeshes()
         }
 #endif
 
+    if (m_mixed_precision && !m_inf_f_k_valid)
+        {
+        // convert the influence function to single precision once per update of m_inf_f
+        if (m_inf_f_k.getNumElements() != m_inf_f.getNumElements())
+            {
+            GPUArray<float4> inf_f_k(m_inf_f.getNumElements(), m_exec_conf);
+            m_inf_f_k.swap(inf_f_k);
+            }
+
+        ArrayHandle<Scalar> d_inf_f(m_inf_f, access_location::device, access_mode::read);
+        ArrayHandle<Scalar3> d_k(m_k, access_location::device, access_mode::read);
+        ArrayHandle<float4> d_inf_f_k(m_inf_f_k, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_pack_influence_function((unsigned int)m_inf_f.getNumElements(),
+                                            d_inf_f.data,
+                                            d_k.data,
+                                            d_inf_f_k.data);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_inf_f_k_valid = true;
+        }
+
+    if (m_mixed_precision)
+        {
+        ArrayHandle<hipfftComplex> d_mesh(m_mesh, access_location::device, access_mode::readwrite);
+        ArrayHandle<hipfftComplex> d_inv_fourier_mesh_x(m_inv_fourier_mesh_x,
+                                                        access_location::device,
+                                                        access_mode::overwrite);
+        ArrayHandle<hipfftComplex> d_inv_fourier_mesh_y(m_inv_fourier_mesh_y,
+                                                        access_location::device,
+                                                        access_mode::overwrite);
+        ArrayHandle<hipfftComplex> d_inv_fourier_mesh_z(m_inv_fourier_mesh_z,
+                                                        access_location::device,
+                                                        access_mode::overwrite);
+
+        ArrayHandle<float4> d_inf_f_k(m_inf_f_k, access_location::device, access_mode::read);
+
+        unsigned int block_size = m_tuner_update->getParam()[0];
+        m_tuner_update->begin();
+        kernel::gpu_update_meshes_mixed(m_n_inner_cells,
+                                        d_mesh.data + m_ghost_offset,
+                                        d_inv_fourier_mesh_x.data + m_ghost_offset,
+                                        d_inv_fourier_mesh_y.data + m_ghost_offset,
+                                        d_inv_fourier_mesh_z.data + m_ghost_offset,
+                                        d_inf_f_k.data,
+                                        m_global_dim.x * m_global_dim.y * m_global_dim.z,
+                                        block_size);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_update->end();
+        }
+    else
         {
         ArrayHandle<hipfftComplex> d_mesh(m_mesh, access_location::device, access_mode::readwrite);
         ArrayHandle<hipfftComplex> d_inv_fourier_mesh_x(m_inv_fourier_mesh_x,
@@ -423,6 +513,9 @@ void PPPMForceComputeGPU::updateMeshes()
         else
             dfft_cuda_check_errors(&m_dfft_plan_inverse, 0);
 
+        // keep the mesh on the device during the transposes when MPI is GPU-aware
+        dfft_cuda_gpu_aware_mpi(&m_dfft_plan_inverse, m_exec_conf->isGPUAwareMPIEnabled() ? 1 : 0);
+
         dfft_cuda_execute(d_inv_fourier_mesh_x.data + m_ghost_offset,
                           d_inv_fourier_mesh_x.data + m_ghost_offset,
                           1,
@@ -492,8 +585,8 @@ void PPPMForceComputeGPU::interpolateForces()
 
     ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
 
-    // access the group
-    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+    // access the charged group members
+    ArrayHandle<unsigned int> d_charged_idx(m_charged_idx,
                                             access_location::device,
                                             access_mode::read);
 
@@ -505,7 +598,7 @@ void PPPMForceComputeGPU::interpolateForces()
     unsigned int block_size = m_tuner_force->getParam()[0];
     m_tuner_force->begin();
     kernel::gpu_compute_forces(m_pdata->getN(),
-                               m_group->getNumMembers(),
+                               m_n_charged,
                                d_postype.data,
                                d_force.data,
                                d_inv_fourier_mesh_x.data,
@@ -516,11 +609,12 @@ void PPPMForceComputeGPU::interpolateForces()
                                d_charge.data,
                                m_pdata->getBox(),
                                m_order,
-                               d_index_array.data,
+                               d_charged_idx.data,
                                d_rho_coeff.data,
                                block_size,
                                m_local_fft,
-                               m_n_cells + m_ghost_offset);
+                               m_n_cells + m_ghost_offset,
+                               m_mixed_precision);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -697,6 +791,8 @@ void PPPMForceComputeGPU::computeInfluenceFunction()
         CHECK_CUDA_ERROR();
 
     m_tuner_influence->end();
+
+    m_inf_f_k_valid = false;
     }
 
 void PPPMForceComputeGPU::fixExclusions()
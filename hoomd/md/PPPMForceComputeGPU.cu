@@ -4,6 +4,9 @@
 #include "PPPMForceComputeGPU.cuh"
 #include "hoomd/TextureTools.h"
 
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+
 // __scalar2int_rd is __float2int_rd in single, __double2int_rd in double
 #if HOOMD_LONGREAL_SIZE == 32
 #define __scalar2int_rd __float2int_rd
@@ -121,6 +124,10 @@ __device__ int3 find_cell(const Scalar3& pos,
     return make_int3(ix, iy, iz);
     }
 
+//! Assign the charges of the particles to the mesh
+/*! \tparam Real Precision of the assignment weights
+ */
+template<class Real>
 __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
                                             const uint3 n_ghost_bins,
                                             unsigned int work_size,
@@ -133,7 +140,8 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
                                             BoxDim box,
                                             const Scalar* d_rho_coeff)
     {
-    extern __shared__ Scalar s_coeff[];
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Real* s_coeff = (Real*)s_data;
 
     // load in interpolation coefficients
     unsigned int ncoeffs = order * (2 * order + 1);
@@ -141,7 +149,7 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
         {
         if (cur_offset + threadIdx.x < ncoeffs)
             {
-            s_coeff[cur_offset + threadIdx.x] = d_rho_coeff[cur_offset + threadIdx.x];
+            s_coeff[cur_offset + threadIdx.x] = Real(d_rho_coeff[cur_offset + threadIdx.x]);
             }
         }
     __syncthreads();
@@ -185,11 +193,17 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
     int nlower = -(order - 1) / 2;
     int nupper = order / 2;
 
-    Scalar result;
+    // the distance to the cell center is small, evaluate the weights in the requested precision
+    const Real dr_x = Real(dr.x);
+    const Real dr_y = Real(dr.y);
+    const Real dr_z = Real(dr.z);
+    const Real inv_V_cell = Real(Scalar(1.0) / V_cell);
+
+    Real result;
 
     int mult_fact = 2 * order + 1;
 
-    Scalar x0 = qi;
+    Real x0 = Real(qi);
 
     bool ignore_x = false;
     bool ignore_y = false;
@@ -199,12 +213,12 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
     for (int l = nlower; l <= nupper; ++l)
         {
         // precalculate assignment factor
-        result = Scalar(0.0);
+        result = Real(0.0);
         for (int iorder = order - 1; iorder >= 0; iorder--)
             {
-            result = s_coeff[l - nlower + iorder * mult_fact] + result * dr.x;
+            result = s_coeff[l - nlower + iorder * mult_fact] + result * dr_x;
             }
-        Scalar y0 = x0 * result;
+        Real y0 = x0 * result;
 
         int neighi = i + l;
         if (neighi >= (int)bin_dim.x)
@@ -224,12 +238,12 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
 
         for (int m = nlower; m <= nupper; ++m)
             {
-            result = Scalar(0.0);
+            result = Real(0.0);
             for (int iorder = order - 1; iorder >= 0; iorder--)
                 {
-                result = s_coeff[m - nlower + iorder * mult_fact] + result * dr.y;
+                result = s_coeff[m - nlower + iorder * mult_fact] + result * dr_y;
                 }
-            Scalar z0 = y0 * result;
+            Real z0 = y0 * result;
 
             int neighj = j + m;
             if (neighj >= (int)bin_dim.y)
@@ -249,10 +263,10 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
 
             for (int n = nlower; n <= nupper; ++n)
                 {
-                result = Scalar(0.0);
+                result = Real(0.0);
                 for (int iorder = order - 1; iorder >= 0; iorder--)
                     {
-                    result = s_coeff[n - nlower + iorder * mult_fact] + result * dr.z;
+                    result = s_coeff[n - nlower + iorder * mult_fact] + result * dr_z;
                     }
 
                 int neighk = k + n;
@@ -279,7 +293,7 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
 
                     // compute fraction of particle density assigned to cell
                     // from particles in this bin
-                    myAtomicAdd(&d_mesh[cell_idx].x, z0 * result / V_cell);
+                    myAtomicAdd(&d_mesh[cell_idx].x, float(z0 * result * inv_V_cell));
                     }
 
                 ignore_z = false;
@@ -304,14 +318,18 @@ void gpu_assign_particles(const uint3 mesh_dim,
                           const BoxDim& box,
                           unsigned int block_size,
                           const Scalar* d_rho_coeff,
-                          const hipDeviceProp_t& dev_prop)
+                          const hipDeviceProp_t& dev_prop,
+                          bool mixed_precision)
     {
     hipMemsetAsync(d_mesh, 0, sizeof(hipfftComplex) * grid_dim.x * grid_dim.y * grid_dim.z);
     Scalar V_cell = box.getVolume() / (Scalar)(mesh_dim.x * mesh_dim.y * mesh_dim.z);
 
     unsigned int max_block_size;
     hipFuncAttributes attr;
-    hipFuncGetAttributes(&attr, (const void*)gpu_assign_particles_kernel);
+    if (mixed_precision)
+        hipFuncGetAttributes(&attr, (const void*)gpu_assign_particles_kernel<float>);
+    else
+        hipFuncGetAttributes(&attr, (const void*)gpu_assign_particles_kernel<Scalar>);
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(max_block_size, block_size);
@@ -323,24 +341,46 @@ void gpu_assign_particles(const uint3 mesh_dim,
 
     unsigned int nwork = group_size;
     unsigned int n_blocks = nwork / run_block_size + 1;
-    const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
+    const size_t n_coeffs = order * (2 * order + 1);
 
-    hipLaunchKernelGGL((gpu_assign_particles_kernel),
-                       dim3(n_blocks),
-                       dim3(run_block_size),
-                       shared_bytes,
-                       0,
-                       mesh_dim,
-                       n_ghost_bins,
-                       nwork,
-                       d_index_array,
-                       d_postype,
-                       d_charge,
-                       d_mesh,
-                       V_cell,
-                       order,
-                       box,
-                       d_rho_coeff);
+    if (mixed_precision)
+        {
+        hipLaunchKernelGGL((gpu_assign_particles_kernel<float>),
+                           dim3(n_blocks),
+                           dim3(run_block_size),
+                           n_coeffs * sizeof(float),
+                           0,
+                           mesh_dim,
+                           n_ghost_bins,
+                           nwork,
+                           d_index_array,
+                           d_postype,
+                           d_charge,
+                           d_mesh,
+                           V_cell,
+                           order,
+                           box,
+                           d_rho_coeff);
+        }
+    else
+        {
+        hipLaunchKernelGGL((gpu_assign_particles_kernel<Scalar>),
+                           dim3(n_blocks),
+                           dim3(run_block_size),
+                           n_coeffs * sizeof(Scalar),
+                           0,
+                           mesh_dim,
+                           n_ghost_bins,
+                           nwork,
+                           d_index_array,
+                           d_postype,
+                           d_charge,
+                           d_mesh,
+                           V_cell,
+                           order,
+                           box,
+                           d_rho_coeff);
+        }
     }
 
 __global__ void gpu_compute_mesh_virial_kernel(const unsigned int n_wave_vectors,
@@ -488,6 +528,118 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        NNN);
     }
 
+//! Pack the influence function and the wave vectors into one single precision array
+__global__ void gpu_pack_influence_function_kernel(const unsigned int n_wave_vectors,
+                                                   const Scalar* d_inf_f,
+                                                   const Scalar3* d_k,
+                                                   float4* d_inf_f_k)
+    {
+    unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    if (idx >= n_wave_vectors)
+        return;
+
+    Scalar3 k = d_k[idx];
+    d_inf_f_k[idx] = make_float4(float(k.x), float(k.y), float(k.z), float(d_inf_f[idx]));
+    }
+
+void gpu_pack_influence_function(const unsigned int n_wave_vectors,
+                                 const Scalar* d_inf_f,
+                                 const Scalar3* d_k,
+                                 float4* d_inf_f_k)
+    {
+    const unsigned int block_size = 256;
+
+    dim3 grid(n_wave_vectors / block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL((gpu_pack_influence_function_kernel),
+                       dim3(grid),
+                       dim3(block_size),
+                       0,
+                       0,
+                       n_wave_vectors,
+                       d_inf_f,
+                       d_k,
+                       d_inf_f_k);
+    }
+
+//! Multiply the Fourier mesh with the influence function in single precision
+/*! The wave vector and the influence function of each mesh point are read in a single float4
+    (k.x, k.y, k.z, inf_f).
+ */
+__global__ void gpu_update_meshes_mixed_kernel(const unsigned int n_wave_vectors,
+                                               hipfftComplex* d_fourier_mesh,
+                                               hipfftComplex* d_fourier_mesh_G_x,
+                                               hipfftComplex* d_fourier_mesh_G_y,
+                                               hipfftComplex* d_fourier_mesh_G_z,
+                                               const float4* d_inf_f_k,
+                                               float inv_NNN)
+    {
+    unsigned int k;
+
+    k = blockDim.x * blockIdx.x + threadIdx.x;
+
+    if (k >= n_wave_vectors)
+        return;
+
+    hipfftComplex f = d_fourier_mesh[k];
+
+    float4 inf_f_k = d_inf_f_k[k];
+    float scaled_inf_f = inf_f_k.w * inv_NNN;
+
+    hipfftComplex fourier_G_x;
+    fourier_G_x.x = f.y * inf_f_k.x * scaled_inf_f;
+    fourier_G_x.y = -f.x * inf_f_k.x * scaled_inf_f;
+
+    hipfftComplex fourier_G_y;
+    fourier_G_y.x = f.y * inf_f_k.y * scaled_inf_f;
+    fourier_G_y.y = -f.x * inf_f_k.y * scaled_inf_f;
+
+    hipfftComplex fourier_G_z;
+    fourier_G_z.x = f.y * inf_f_k.z * scaled_inf_f;
+    fourier_G_z.y = -f.x * inf_f_k.z * scaled_inf_f;
+
+    // store in global memory
+    d_fourier_mesh_G_x[k] = fourier_G_x;
+    d_fourier_mesh_G_y[k] = fourier_G_y;
+    d_fourier_mesh_G_z[k] = fourier_G_z;
+    }
+
+void gpu_update_meshes_mixed(const unsigned int n_wave_vectors,
+                             hipfftComplex* d_fourier_mesh,
+                             hipfftComplex* d_fourier_mesh_G_x,
+                             hipfftComplex* d_fourier_mesh_G_y,
+                             hipfftComplex* d_fourier_mesh_G_z,
+                             const float4* d_inf_f_k,
+                             unsigned int NNN,
+                             unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_update_meshes_mixed_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(max_block_size, block_size);
+    dim3 grid(n_wave_vectors / run_block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL((gpu_update_meshes_mixed_kernel),
+                       dim3(grid),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       n_wave_vectors,
+                       d_fourier_mesh,
+                       d_fourier_mesh_G_x,
+                       d_fourier_mesh_G_y,
+                       d_fourier_mesh_G_z,
+                       d_inf_f_k,
+                       float(1.0 / (double)NNN));
+    }
+
+//! Interpolate the forces on the particles from the force meshes
+/*! \tparam Real Precision of the interpolation weights and the force accumulation
+ */
+template<class Real>
 __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
                                           const Scalar4* d_postype,
                                           Scalar4* d_force,
@@ -502,7 +654,8 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
                                           const hipfftComplex* inv_fourier_mesh_z,
                                           const Scalar* d_rho_coeff)
     {
-    extern __shared__ Scalar s_coeff[];
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Real* s_coeff = (Real*)s_data;
 
     // load in interpolation coefficients
     unsigned int ncoeffs = order * (2 * order + 1);
@@ -510,7 +663,7 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
         {
         if (cur_offset + threadIdx.x < ncoeffs)
             {
-            s_coeff[cur_offset + threadIdx.x] = d_rho_coeff[cur_offset + threadIdx.x];
+            s_coeff[cur_offset + threadIdx.x] = Real(d_rho_coeff[cur_offset + threadIdx.x]);
             }
         }
     __syncthreads();
@@ -532,7 +685,7 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
 
     Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
     unsigned int type = __scalar_as_int(postype.w);
-    Scalar qi = d_charge[idx];
+    Real qi = Real(d_charge[idx]);
 
     Scalar3 dr = make_scalar3(0, 0, 0);
 
@@ -548,41 +701,47 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
         return;
         }
 
-    Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+    Real force_x = Real(0.0);
+    Real force_y = Real(0.0);
+    Real force_z = Real(0.0);
 
     int nlower = -(order - 1) / 2;
     int nupper = order / 2;
 
-    Scalar result;
+    const Real dr_x = Real(dr.x);
+    const Real dr_y = Real(dr.y);
+    const Real dr_z = Real(dr.z);
+
+    Real result;
     int mult_fact = 2 * order + 1;
 
     // back-interpolate forces from neighboring mesh points
     for (int l = nlower; l <= nupper; ++l)
         {
-        result = Scalar(0.0);
+        result = Real(0.0);
         for (int k = order - 1; k >= 0; k--)
             {
-            result = s_coeff[l - nlower + k * mult_fact] + result * dr.x;
+            result = s_coeff[l - nlower + k * mult_fact] + result * dr_x;
             }
-        Scalar x0 = result;
+        Real x0 = result;
 
         for (int m = nlower; m <= nupper; ++m)
             {
-            result = Scalar(0.0);
+            result = Real(0.0);
             for (int k = order - 1; k >= 0; k--)
                 {
-                result = s_coeff[m - nlower + k * mult_fact] + result * dr.y;
+                result = s_coeff[m - nlower + k * mult_fact] + result * dr_y;
                 }
-            Scalar y0 = x0 * result;
+            Real y0 = x0 * result;
 
             for (int n = nlower; n <= nupper; ++n)
                 {
-                result = Scalar(0.0);
+                result = Real(0.0);
                 for (int k = order - 1; k >= 0; k--)
                     {
-                    result = s_coeff[n - nlower + k * mult_fact] + result * dr.z;
+                    result = s_coeff[n - nlower + k * mult_fact] + result * dr_z;
                     }
-                Scalar z0 = y0 * result;
+                Real z0 = y0 * result;
 
                 int neighl = (int)cell_coord.x + l;
                 int neighm = (int)cell_coord.y + m;
@@ -619,14 +778,14 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
                 hipfftComplex inv_mesh_y = inv_fourier_mesh_y[cell_idx];
                 hipfftComplex inv_mesh_z = inv_fourier_mesh_z[cell_idx];
 
-                force.x += qi * z0 * inv_mesh_x.x;
-                force.y += qi * z0 * inv_mesh_y.x;
-                force.z += qi * z0 * inv_mesh_z.x;
+                force_x += qi * z0 * Real(inv_mesh_x.x);
+                force_y += qi * z0 * Real(inv_mesh_y.x);
+                force_z += qi * z0 * Real(inv_mesh_z.x);
                 }
             }
         } // end neighbor cells loop
 
-    d_force[idx] = make_scalar4(force.x, force.y, force.z, 0.0);
+    d_force[idx] = make_scalar4(Scalar(force_x), Scalar(force_y), Scalar(force_z), 0.0);
     }
 
 void gpu_compute_forces(const unsigned int N,
@@ -645,11 +804,15 @@ void gpu_compute_forces(const unsigned int N,
                         const Scalar* d_rho_coeff,
                         unsigned int block_size,
                         bool local_fft,
-                        unsigned int inv_mesh_elements)
+                        unsigned int inv_mesh_elements,
+                        bool mixed_precision)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
-    hipFuncGetAttributes(&attr, (const void*)gpu_compute_forces_kernel);
+    if (mixed_precision)
+        hipFuncGetAttributes(&attr, (const void*)gpu_compute_forces_kernel<float>);
+    else
+        hipFuncGetAttributes(&attr, (const void*)gpu_compute_forces_kernel<Scalar>);
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(max_block_size, block_size);
@@ -658,26 +821,50 @@ void gpu_compute_forces(const unsigned int N,
 
     unsigned int nwork = group_size;
     unsigned int n_blocks = nwork / run_block_size + 1;
-    const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
+    const size_t n_coeffs = order * (2 * order + 1);
 
-    hipLaunchKernelGGL((gpu_compute_forces_kernel),
-                       dim3(n_blocks),
-                       dim3(run_block_size),
-                       shared_bytes,
-                       0,
-                       nwork,
-                       d_postype,
-                       d_force,
-                       grid_dim,
-                       n_ghost_cells,
-                       d_charge,
-                       box,
-                       order,
-                       d_index_array,
-                       d_inv_fourier_mesh_x,
-                       d_inv_fourier_mesh_y,
-                       d_inv_fourier_mesh_z,
-                       d_rho_coeff);
+    if (mixed_precision)
+        {
+        hipLaunchKernelGGL((gpu_compute_forces_kernel<float>),
+                           dim3(n_blocks),
+                           dim3(run_block_size),
+                           n_coeffs * sizeof(float),
+                           0,
+                           nwork,
+                           d_postype,
+                           d_force,
+                           grid_dim,
+                           n_ghost_cells,
+                           d_charge,
+                           box,
+                           order,
+                           d_index_array,
+                           d_inv_fourier_mesh_x,
+                           d_inv_fourier_mesh_y,
+                           d_inv_fourier_mesh_z,
+                           d_rho_coeff);
+        }
+    else
+        {
+        hipLaunchKernelGGL((gpu_compute_forces_kernel<Scalar>),
+                           dim3(n_blocks),
+                           dim3(run_block_size),
+                           n_coeffs * sizeof(Scalar),
+                           0,
+                           nwork,
+                           d_postype,
+                           d_force,
+                           grid_dim,
+                           n_ghost_cells,
+                           d_charge,
+                           box,
+                           order,
+                           d_index_array,
+                           d_inv_fourier_mesh_x,
+                           d_inv_fourier_mesh_y,
+                           d_inv_fourier_mesh_z,
+                           d_rho_coeff);
+        }
     }
 
 __global__ void kernel_calculate_pe_partial(int n_wave_vectors,
@@ -1400,6 +1587,42 @@ hipError_t gpu_fix_exclusions(Scalar4* d_force,
     return hipSuccess;
     }
 
+//! Selects the particles with non-zero charge
+struct is_charged
+    {
+    __host__ __device__ is_charged(const Scalar* _d_charge) : d_charge(_d_charge) { }
+
+    __device__ bool operator()(const unsigned int& idx) const
+        {
+        return d_charge[idx] != Scalar(0.0);
+        }
+
+    const Scalar* d_charge;
+    };
+
+/*! \param group_size Number of group members
+    \param d_index_array Particle indices of the group members
+    \param d_charge Particle charges
+    \param d_charged_idx Output: particle indices of the charged group members
+
+    \returns The number of charged group members
+*/
+unsigned int gpu_select_charged_particles(unsigned int group_size,
+                                          const unsigned int* d_index_array,
+                                          const Scalar* d_charge,
+                                          unsigned int* d_charged_idx)
+    {
+    if (group_size == 0)
+        return 0;
+
+    unsigned int* last = thrust::copy_if(thrust::device,
+                                         d_index_array,
+                                         d_index_array + group_size,
+                                         d_charged_idx,
+                                         is_charged(d_charge));
+    return (unsigned int)(last - d_charged_idx);
+    }
+
     } // namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -36,7 +36,8 @@ void gpu_assign_particles(const uint3 mesh_dim,
                           const BoxDim& box,
                           unsigned int block_size,
                           const Scalar* d_rho_coeff,
-                          const hipDeviceProp_t& dev_prop);
+                          const hipDeviceProp_t& dev_prop,
+                          bool mixed_precision);
 
 void gpu_compute_mesh_virial(const unsigned int n_wave_vectors,
                              hipfftComplex* d_fourier_mesh,
@@ -56,6 +57,20 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        unsigned int NNN,
                        unsigned int block_size);
 
+void gpu_pack_influence_function(const unsigned int n_wave_vectors,
+                                 const Scalar* d_inf_f,
+                                 const Scalar3* d_k,
+                                 float4* d_inf_f_k);
+
+void gpu_update_meshes_mixed(const unsigned int n_wave_vectors,
+                             hipfftComplex* d_fourier_mesh,
+                             hipfftComplex* d_fourier_mesh_G_x,
+                             hipfftComplex* d_fourier_mesh_G_y,
+                             hipfftComplex* d_fourier_mesh_G_z,
+                             const float4* d_inf_f_k,
+                             unsigned int NNN,
+                             unsigned int block_size);
+
 void gpu_compute_forces(const unsigned int N,
                         const unsigned int group_size,
                         const Scalar4* d_postype,
@@ -72,7 +87,8 @@ void gpu_compute_forces(const unsigned int N,
                         const Scalar* d_rho_coeff,
                         unsigned int block_size,
                         bool local_fft,
-                        unsigned int inv_mesh_elements);
+                        unsigned int inv_mesh_elements,
+                        bool mixed_precision);
 
 void gpu_compute_pe(unsigned int n_wave_vectors,
                     Scalar* d_sum_partial,
@@ -122,6 +138,11 @@ hipError_t gpu_fix_exclusions(Scalar4* d_force,
 
 void gpu_initialize_coeff(Scalar* CPU_rho_coeff, int order);
 
+unsigned int gpu_select_charged_particles(unsigned int group_size,
+                                          const unsigned int* d_index_array,
+                                          const Scalar* d_charge,
+                                          unsigned int* d_charged_idx);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -42,6 +42,11 @@ namespace hoomd
 namespace md
     {
 /*! Order parameter evaluated using the particle mesh method
+
+    The meshes and the FFTs are single precision complex in all builds. With mixed precision
+    enabled, the charge assignment and force interpolation weights and the multiplication with the
+    influence function are also evaluated in single precision, while the particle positions, the
+    forces and the energy and virial sums remain in Scalar precision.
  */
 class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     {
@@ -52,10 +57,16 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
                         std::shared_ptr<ParticleGroup> group);
     virtual ~PPPMForceComputeGPU();
 
+    //! Set the number of domains along each axis that share one FFT rank
+    virtual void setFFTGroup(unsigned int gx, unsigned int gy, unsigned int gz);
+
     protected:
     //! Helper function to setup FFT and allocate the mesh arrays
     virtual void initializeFFT();
 
+    //! List the group members with non-zero charge
+    virtual void updateChargedParticles();
+
     //! Helper function to assign particle coordinates to mesh
     virtual void assignParticles();
 
@@ -128,6 +139,9 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     GPUArray<hipfftComplex> m_inv_fourier_mesh_y; //!< The inverse-fourier transformed force mesh
     GPUArray<hipfftComplex> m_inv_fourier_mesh_z; //!< The inverse-fourier transformed force mesh
 
+    GPUArray<float4> m_inf_f_k; //!< Single precision (k.x, k.y, k.z, inf_f) for mixed precision
+    bool m_inf_f_k_valid;       //!< True if m_inf_f_k matches the current influence function
+
     GPUFlags<Scalar> m_sum;                //!< Sum over fourier mesh values
     GPUArray<Scalar> m_sum_partial;        //!< Partial sums over fourier mesh values
     GPUArray<Scalar> m_sum_virial_partial; //!< Partial sums over virial mesh values
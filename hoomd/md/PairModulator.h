@@ -177,6 +177,15 @@ template<typename PairEvaluator, typename DirectionalEnvelope> class PairModulat
 
     HOSTDEVICE void setTags(unsigned int tagi, unsigned int tagj) { }
 
+    HOSTDEVICE static bool needsRotationMatrices()
+        {
+        return false;
+        }
+
+    HOSTDEVICE void setRotationMatrices(const rotmat3<Scalar>* roti, const rotmat3<Scalar>* rotj)
+        {
+        }
+
     HOSTDEVICE static bool constexpr implementsEnergyShift()
         {
         return true;
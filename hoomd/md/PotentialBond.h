@@ -196,6 +196,7 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
 
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
+    bool compute_energy = flags[pdata_flag::potential_energy];
 
     Scalar bond_virial[6];
     for (unsigned int i = 0; i < 6; i++)
@@ -287,7 +288,8 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
                 h_force.data[idx_b].x += force_divr * dx.x;
                 h_force.data[idx_b].y += force_divr * dx.y;
                 h_force.data[idx_b].z += force_divr * dx.z;
-                h_force.data[idx_b].w += bond_eng;
+                if (compute_energy)
+                    h_force.data[idx_b].w += bond_eng;
                 if (compute_virial)
                     for (unsigned int i = 0; i < 6; i++)
                         h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
@@ -298,7 +300,8 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
                 h_force.data[idx_a].x -= force_divr * dx.x;
                 h_force.data[idx_a].y -= force_divr * dx.y;
                 h_force.data[idx_a].z -= force_divr * dx.z;
-                h_force.data[idx_a].w += bond_eng;
+                if (compute_energy)
+                    h_force.data[idx_a].w += bond_eng;
                 if (compute_virial)
                     for (unsigned int i = 0; i < 6; i++)
                         h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
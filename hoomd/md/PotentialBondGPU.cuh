@@ -149,12 +149,13 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
     else
         q += 0; // Silence compiler warning.
 
-    // initialize the force to 0
-    Scalar4 force = make_scalar4(0, 0, 0, 0);
+    // initialize the force to 0, accumulate in AccumReal precision
+    AccumReal4 force
+        = make_accumreal4(AccumReal(0.0), AccumReal(0.0), AccumReal(0.0), AccumReal(0.0));
     // initialize the virial tensor to 0
-    Scalar virial[6];
+    AccumReal virial[6];
     for (unsigned int i = 0; i < 6; i++)
-        virial[i] = 0;
+        virial[i] = AccumReal(0.0);
 
     // loop over neighbors
     for (int bond_idx = 0; bond_idx < n_bonds; bond_idx++)
@@ -232,10 +233,10 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
         }
 
     // now that the force calculation is complete, write out the result (MEM TRANSFER: 20 bytes);
-    d_force[idx] = force;
+    d_force[idx] = make_scalar4(Scalar(force.x), Scalar(force.y), Scalar(force.z), Scalar(force.w));
 
     for (unsigned int i = 0; i < 6; i++)
-        d_virial[i * virial_pitch + idx] = virial[i];
+        d_virial[i * virial_pitch + idx] = Scalar(virial[i]);
     }
 
 //! Kernel driver that computes lj forces on the GPU for LJForceComputeGPU
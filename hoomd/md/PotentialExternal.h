@@ -6,6 +6,8 @@
 #include "hoomd/VectorMath.h"
 #include "hoomd/managed_allocator.h"
 #include "hoomd/md/EvaluatorExternalPeriodic.h"
+#include "hoomd/md/WallCellList.h"
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
 
@@ -67,6 +69,9 @@ template<class evaluator> class PotentialExternal : public ForceCompute
     GPUArray<param_type> m_params;       //!< Array of per-type parameters
     std::shared_ptr<field_type> m_field; /// evaluator dependent field parameters
 
+    /// Walls near each region of the box, used only by wall potentials
+    std::unique_ptr<WallCellList> m_wall_cells;
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
@@ -117,6 +122,9 @@ template<class evaluator> void PotentialExternal<evaluator>::computeForces(uint6
 
     unsigned int nparticles = m_pdata->getN();
 
+    PDataFlags flags = m_pdata->getFlags();
+    bool compute_energy = flags[pdata_flag::potential_energy];
+
     // Zero data for force calculation.
     memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
     memset((void*)h_torque.data, 0, sizeof(Scalar4) * m_torque.getNumElements());
@@ -127,6 +135,24 @@ template<class evaluator> void PotentialExternal<evaluator>::computeForces(uint6
     assert(h_torque.data);
     assert(h_virial.data);
 
+    // wall potentials evaluate only the walls near each particle
+    if constexpr (std::is_same<field_type, wall_type>::value)
+        {
+        Scalar r_range = 0;
+        bool cull_inactive = true;
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); i++)
+            {
+            r_range = std::max(r_range,
+                               std::max(fast::sqrt(h_params.data[i].rcutsq),
+                                        h_params.data[i].rextrap));
+            cull_inactive = cull_inactive && !(h_params.data[i].rextrap > 0.0);
+            }
+
+        if (!m_wall_cells)
+            m_wall_cells.reset(new WallCellList());
+        m_wall_cells->update(*m_field, box, r_range, cull_inactive);
+        }
+
     // for each of the particles
     for (unsigned int idx = 0; idx < nparticles; idx++)
         {
@@ -140,6 +166,15 @@ template<class evaluator> void PotentialExternal<evaluator>::computeForces(uint6
 
         evaluator eval(X, q, box, h_params.data[type], *m_field);
 
+        if constexpr (std::is_same<field_type, wall_type>::value)
+            {
+            unsigned int n_spheres, n_cylinders, n_planes;
+            const unsigned char* walls
+                = m_wall_cells->getWalls(X, n_spheres, n_cylinders, n_planes);
+            if (walls)
+                eval.setWallList(walls, n_spheres, n_cylinders, n_planes);
+            }
+
         if (evaluator::needsCharge())
             {
             Scalar qi = h_charge.data[idx];
@@ -151,7 +186,8 @@ template<class evaluator> void PotentialExternal<evaluator>::computeForces(uint6
         h_force.data[idx].x = F.x;
         h_force.data[idx].y = F.y;
         h_force.data[idx].z = F.z;
-        h_force.data[idx].w = energy;
+        if (compute_energy)
+            h_force.data[idx].w = energy;
         for (int k = 0; k < 6; k++)
             h_virial.data[k * m_virial_pitch + idx] = virial[k];
 
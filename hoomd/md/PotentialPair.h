@@ -4,16 +4,20 @@
 #ifndef __POTENTIAL_PAIR_H__
 #define __POTENTIAL_PAIR_H__
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <stdexcept>
+#include <vector>
 
 #include "NeighborList.h"
+#include "NeighborListCompression.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
+#include "hoomd/ParticleDataSoA.h"
 #include "hoomd/managed_allocator.h"
 #include "hoomd/md/EvaluatorPairLJ.h"
 
@@ -39,6 +43,87 @@ namespace hoomd
     {
 namespace md
     {
+namespace detail
+    {
+//! Compile-time options of the CPU pair force loop
+/*! \tparam _third_law Scatter the reaction to the neighbor (half neighbor list)
+    \tparam _compute_virial Accumulate the virial
+    \tparam _compute_energy Accumulate the potential energy
+    \tparam _shift_mode Energy shift mode (PotentialPair::energyShiftMode)
+*/
+template<bool _third_law, bool _compute_virial, bool _compute_energy, unsigned int _shift_mode>
+struct PairLoopOptions
+    {
+    static constexpr bool third_law = _third_law;
+    static constexpr bool compute_virial = _compute_virial;
+    static constexpr bool compute_energy = _compute_energy;
+    static constexpr unsigned int shift_mode = _shift_mode;
+    };
+
+//! Call \a f with the PairLoopOptions for the given shift mode
+template<bool third_law, bool compute_virial, bool compute_energy, class F>
+inline void dispatchPairLoopShiftMode(unsigned int shift_mode, F&& f)
+    {
+    switch (shift_mode)
+        {
+    case 0:
+        f(PairLoopOptions<third_law, compute_virial, compute_energy, 0>());
+        break;
+    case 1:
+        f(PairLoopOptions<third_law, compute_virial, compute_energy, 1>());
+        break;
+    case 2:
+        f(PairLoopOptions<third_law, compute_virial, compute_energy, 2>());
+        break;
+    default:
+        throw std::invalid_argument("Invalid energy shift mode.");
+        }
+    }
+
+//! Call \a f with the PairLoopOptions for the given energy flag and shift mode
+template<bool third_law, bool compute_virial, class F>
+inline void dispatchPairLoopEnergy(bool compute_energy, unsigned int shift_mode, F&& f)
+    {
+    if (compute_energy)
+        dispatchPairLoopShiftMode<third_law, compute_virial, true>(shift_mode, f);
+    else
+        dispatchPairLoopShiftMode<third_law, compute_virial, false>(shift_mode, f);
+    }
+
+//! Call \a f with the PairLoopOptions that match the runtime flags
+/*! \param third_law True with a half neighbor list
+    \param compute_virial True when the virial is needed
+    \param compute_energy True when the potential energy is needed
+    \param shift_mode Energy shift mode
+    \param f Callable that takes a PairLoopOptions instance
+
+    The branches on the flags are taken once here, so the loop in \a f is compiled separately for
+    each combination and carries no per-pair tests of the flags.
+*/
+template<class F>
+inline void dispatchPairLoop(bool third_law,
+                             bool compute_virial,
+                             bool compute_energy,
+                             unsigned int shift_mode,
+                             F&& f)
+    {
+    if (third_law)
+        {
+        if (compute_virial)
+            dispatchPairLoopEnergy<true, true>(compute_energy, shift_mode, f);
+        else
+            dispatchPairLoopEnergy<true, false>(compute_energy, shift_mode, f);
+        }
+    else
+        {
+        if (compute_virial)
+            dispatchPairLoopEnergy<false, true>(compute_energy, shift_mode, f);
+        else
+            dispatchPairLoopEnergy<false, false>(compute_energy, shift_mode, f);
+        }
+    }
+    } // end namespace detail
+
 //! Template class for computing pair potentials
 /*! <b>Overview:</b>
     PotentialPair computes standard pair potentials (and forces) between all particle pairs in the
@@ -241,6 +326,15 @@ template<class evaluator> class PotentialPair : public ForceCompute
     /// Keep track of number of each type of particle
     std::vector<unsigned int> m_num_particles_by_type;
 
+    /// Per-thread force accumulators used with half neighbor lists (threads 1..n-1)
+    std::vector<std::vector<Scalar4>> m_thread_force;
+
+    /// Per-thread virial accumulators used with half neighbor lists (threads 1..n-1)
+    std::vector<std::vector<Scalar>> m_thread_virial;
+
+    /// Number of neighbors processed together in the CPU force loop
+    static constexpr unsigned int pair_batch_width = 8;
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
@@ -249,6 +343,31 @@ template<class evaluator> class PotentialPair : public ForceCompute
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
+    /// Subsets of the local particles processed by computePairForces()
+    enum class PairComputeSet
+        {
+        all,      //!< All local particles
+        interior, //!< Particles in m_interior_particles, which interact with no ghosts
+        boundary  //!< Particles in m_boundary_particles
+        };
+
+    //! Compute the pair forces on a subset of the local particles
+    void computePairForces(uint64_t timestep, PairComputeSet set);
+
+#ifdef ENABLE_MPI
+    //! Compute the forces on interior particles while the ghost update is in flight
+    virtual bool computeInteriorForces(uint64_t timestep);
+
+    //! Compute the forces on the particles left out by computeInteriorForces()
+    virtual void computeBoundaryForces(uint64_t timestep);
+
+    /// Local particles farther than the ghost layer width from the domain boundaries
+    std::vector<unsigned int> m_interior_particles;
+
+    /// Local particles not in m_interior_particles
+    std::vector<unsigned int> m_boundary_particles;
+#endif
+
     //! Compute the long-range corrections to energy and pressure to account for truncating the pair
     //! potentials
     virtual void computeTailCorrection()
@@ -556,6 +675,88 @@ void PotentialPair<evaluator>::setROnPython(pybind11::tuple types, Scalar r_on)
     \param timestep specifies the current time step of the simulation
 */
 template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t timestep)
+    {
+    computePairForces(timestep, PairComputeSet::all);
+    }
+
+#ifdef ENABLE_MPI
+/*! \param timestep Current time step
+    \returns true when the interior forces were computed
+
+    Interior particles are farther than the maximum ghost layer width from every face of the local
+    domain along the decomposed dimensions. Pair forces on them involve only local particles, so
+    they can be computed before the ghost positions arrive. This is only possible when the
+    neighbor list does not need to be rebuilt at this timestep.
+
+    The split evaluates the pairs with computePairForces() and bypasses computeForces(). Subclasses
+    that override computeForces() must also override this method to return false.
+*/
+template<class evaluator>
+bool PotentialPair<evaluator>::computeInteriorForces(uint64_t timestep)
+    {
+    if (!m_comm || !m_nlist->isValidWithoutRebuild(timestep))
+        {
+        return false;
+        }
+
+    const BoxDim box = m_pdata->getBox();
+    const Scalar3 npd = box.getNearestPlaneDistance();
+    const Scalar r_ghost = m_comm->getGhostLayerMaxWidth();
+    const Index3D& di = m_pdata->getDomainDecomposition()->getDomainIndexer();
+
+    // fractional width of the boundary layer in each decomposed dimension
+    const Scalar3 margin = make_scalar3(di.getW() > 1 ? r_ghost / npd.x : Scalar(0.0),
+                                        di.getH() > 1 ? r_ghost / npd.y : Scalar(0.0),
+                                        di.getD() > 1 ? r_ghost / npd.z : Scalar(0.0));
+
+    m_interior_particles.clear();
+    m_boundary_particles.clear();
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            const Scalar3 f = box.makeFraction(
+                make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z));
+
+            if (f.x >= margin.x && f.x <= Scalar(1.0) - margin.x && f.y >= margin.y
+                && f.y <= Scalar(1.0) - margin.y && f.z >= margin.z
+                && f.z <= Scalar(1.0) - margin.z)
+                {
+                m_interior_particles.push_back(i);
+                }
+            else
+                {
+                m_boundary_particles.push_back(i);
+                }
+            }
+        }
+
+    computePairForces(timestep, PairComputeSet::interior);
+    return true;
+    }
+
+/*! \param timestep Current time step
+ */
+template<class evaluator>
+void PotentialPair<evaluator>::computeBoundaryForces(uint64_t timestep)
+    {
+    computePairForces(timestep, PairComputeSet::boundary);
+    }
+#endif
+
+/*! \param timestep Current time step
+    \param set Subset of the local particles to compute
+
+    The interior pass zeroes the output arrays and evaluates only pairs between local particles.
+    The boundary pass accumulates into the arrays left by the interior pass. With a half neighbor
+    list, each pair is evaluated in the pass that processes the particle owning the list entry.
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::computePairForces(uint64_t timestep, PairComputeSet set)
     {
         {
         // start by updating the neighborlist
@@ -566,20 +767,21 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
         bool third_law = m_nlist->getStorageMode() == NeighborList::half;
 
         // access the neighbor list, particle data, and system box
-        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
                                             access_location::host,
                                             access_mode::read);
         ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
                                           access_location::host,
                                           access_mode::read);
+        // null unless the neighbor list keeps compressed offsets
+        ArrayHandle<int16_t> h_nlist_offsets(m_nlist->getNListOffsets(),
+                                             access_location::host,
+                                             access_mode::read);
         //     Index2D nli = m_nlist->getNListIndexer();
         ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
                                         access_location::host,
                                         access_mode::read);
 
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
         ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
                                      access_location::host,
                                      access_mode::read);
@@ -594,99 +796,202 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
         PDataFlags flags = this->m_pdata->getFlags();
         bool compute_virial = flags[pdata_flag::pressure_tensor];
+        bool compute_energy = flags[pdata_flag::potential_energy];
 
         // need to start from a zero force, energy and virial
-        memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
-        memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        if (set != PairComputeSet::boundary)
+            {
+            memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+            memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+            }
+
+        const unsigned int N = m_pdata->getN();
 
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
+        // the particles to process: all local particles or one of the interior/boundary lists
+        const unsigned int* particles = nullptr;
+        unsigned int n_particles = N;
+#ifdef ENABLE_MPI
+        if (set == PairComputeSet::interior)
+            {
+            particles = m_interior_particles.data();
+            n_particles = (unsigned int)m_interior_particles.size();
+            }
+        else if (set == PairComputeSet::boundary)
             {
-            // access the particle's position and type (MEM TRANSFER: 4 scalars)
-            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            particles = m_boundary_particles.data();
+            n_particles = (unsigned int)m_boundary_particles.size();
+            }
+#endif
 
-            // sanity check
-            assert(typei < m_pdata->getNTypes());
+        // ghost particle data is not valid during the interior pass
+        const bool local_only = set == PairComputeSet::interior;
 
-            // access charge (if needed)
-            Scalar qi = Scalar(0.0);
-            if (evaluator::needsCharge())
-                qi = h_charge.data[i];
-
-            // initialize current particle force, potential energy, and virial to 0
-            Scalar3 fi = make_scalar3(0, 0, 0);
-            Scalar pei = 0.0;
-            Scalar virialxxi = 0.0;
-            Scalar virialxyi = 0.0;
-            Scalar virialxzi = 0.0;
-            Scalar virialyyi = 0.0;
-            Scalar virialyzi = 0.0;
-            Scalar virialzzi = 0.0;
-
-            // loop over all of the neighbors of this particle
-            const size_t myHead = h_head_list.data[i];
-            const unsigned int size = (unsigned int)h_n_neigh.data[i];
-            for (unsigned int k = 0; k < size; k++)
+        // read positions and types from the contiguous SoA mirror
+        ParticleDataSoA& soa = m_pdata->getSoA();
+        if (local_only)
+            soa.updateLocal(timestep);
+        else
+            soa.update(timestep);
+        const Scalar* h_x = soa.getX();
+        const Scalar* h_y = soa.getY();
+        const Scalar* h_z = soa.getZ();
+        const unsigned int* h_type = soa.getTypes();
+
+        // compute the forces on particles [begin, end), accumulating into the given arrays
+        /* Neighbors are processed in batches of pair_batch_width lanes. Each batch gathers the
+           separations into lane arrays, evaluates the pair force on each lane, and adds the result
+           to per-lane accumulators that are summed after the last batch. The gather and
+           accumulate loops run over all lanes with no cross-lane dependencies so that the compiler
+           can vectorize them. The gather only fills lanes with the neighbors of interacting type
+           pairs (r_cut > 0), so the pairs that a shared neighbor list holds for other consumers
+           cost one type lookup each. Lanes past the last gathered neighbor point at particle i
+           itself and carry a zero force.
+
+           The lambda is instantiated for each detail::PairLoopOptions, so the tests of the shift
+           mode, the virial and energy flags, and the neighbor list storage mode are resolved at
+           compile time. Without the energy flag, the compiler removes the energy math of
+           evaluators whose force does not depend on it.
+        */
+        auto compute_range_specialized = [&](auto options,
+                                             unsigned int begin,
+                                             unsigned int end,
+                                             Scalar4* force,
+                                             Scalar* virial,
+                                             size_t virial_pitch)
+            {
+            constexpr bool use_third_law = decltype(options)::third_law;
+            constexpr bool use_virial = decltype(options)::compute_virial;
+            constexpr bool use_energy = decltype(options)::compute_energy;
+            constexpr bool shift_all = decltype(options)::shift_mode == shift;
+            constexpr bool xplor_mode = decltype(options)::shift_mode == xplor;
+
+            // for each particle
+            for (unsigned int p = begin; p < end; p++)
                 {
-                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-                unsigned int j = h_nlist.data[myHead + k];
-                assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+                const unsigned int i = particles ? particles[p] : p;
 
-                // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-                Scalar3 dx = pi - pj;
+                // access the particle's position and type
+                const Scalar xi = h_x[i];
+                const Scalar yi = h_y[i];
+                const Scalar zi = h_z[i];
+                const unsigned int typei = h_type[i];
 
-                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-                assert(typej < m_pdata->getNTypes());
+                // sanity check
+                assert(typei < m_pdata->getNTypes());
 
                 // access charge (if needed)
-                Scalar qj = Scalar(0.0);
+                Scalar qi = Scalar(0.0);
                 if (evaluator::needsCharge())
-                    qj = h_charge.data[j];
-
-                // apply periodic boundary conditions
-                dx = box.minImage(dx);
+                    qi = h_charge.data[i];
+
+                // initialize the per-lane force, potential energy, and virial accumulators to 0
+                Scalar fxi[pair_batch_width] = {};
+                Scalar fyi[pair_batch_width] = {};
+                Scalar fzi[pair_batch_width] = {};
+                Scalar pei[pair_batch_width] = {};
+                Scalar virialxxi[pair_batch_width] = {};
+                Scalar virialxyi[pair_batch_width] = {};
+                Scalar virialxzi[pair_batch_width] = {};
+                Scalar virialyyi[pair_batch_width] = {};
+                Scalar virialyzi[pair_batch_width] = {};
+                Scalar virialzzi[pair_batch_width] = {};
+
+                // loop over all of the neighbors of this particle in batches
+                const size_t myHead = h_head_list.data[i];
+                const unsigned int size = (unsigned int)h_n_neigh.data[i];
+                unsigned int k = 0;
+                while (k < size)
+                    {
+                    unsigned int j_lane[pair_batch_width];
+                    Scalar dx_lane[pair_batch_width];
+                    Scalar dy_lane[pair_batch_width];
+                    Scalar dz_lane[pair_batch_width];
+                    Scalar rsq_lane[pair_batch_width];
+
+                    // gather the neighbors of interacting type pairs, masking the tail with
+                    // particle i
+                    unsigned int n_lanes = 0;
+                    for (; k < size && n_lanes < pair_batch_width; k++)
+                        {
+                        const unsigned int j
+                            = decodeNeighbor(i, h_nlist.data, h_nlist_offsets.data, myHead + k);
 
-                // calculate r_ij squared (FLOPS: 5)
-                Scalar rsq = dot(dx, dx);
+                        // interior particles have no ghost particles within the cutoff
+                        if (local_only && j >= N)
+                            continue;
 
-                // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                const param_type& param = m_params[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
-                Scalar ronsq = Scalar(0.0);
-                if (m_shift_mode == xplor)
-                    ronsq = h_ronsq.data[typpair_idx];
+                        assert(h_type[j] < m_pdata->getNTypes());
+                        if (h_rcutsq.data[m_typpair_idx(typei, h_type[j])] > Scalar(0.0))
+                            j_lane[n_lanes++] = j;
+                        }
 
-                // design specifies that energies are shifted if
-                // 1) shift mode is set to shift
-                // or 2) shift mode is explor and ron > rcut
-                bool energy_shift = false;
-                if (m_shift_mode == shift)
-                    energy_shift = true;
-                else if (m_shift_mode == xplor)
-                    {
-                    if (ronsq > rcutsq)
-                        energy_shift = true;
-                    }
+                    if (n_lanes == 0)
+                        break;
 
-                // compute the force and potential energy
-                Scalar force_divr = Scalar(0.0);
-                Scalar pair_eng = Scalar(0.0);
-                evaluator eval(rsq, rcutsq, param);
-                if (evaluator::needsCharge())
-                    eval.setCharge(qi, qj);
+                    for (unsigned int l = n_lanes; l < pair_batch_width; l++)
+                        {
+                        j_lane[l] = i;
+                        }
 
-                bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+                    // calculate dr_ji and r_ij squared, applying periodic boundary conditions
+                    for (unsigned int l = 0; l < pair_batch_width; l++)
+                        {
+                        const unsigned int j = j_lane[l];
+                        assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+                        Scalar3 dx
+                            = box.minImage(make_scalar3(xi - h_x[j], yi - h_y[j], zi - h_z[j]));
+                        dx_lane[l] = dx.x;
+                        dy_lane[l] = dx.y;
+                        dz_lane[l] = dx.z;
+                        rsq_lane[l] = dot(dx, dx);
+                        }
 
-                if (evaluated)
-                    {
-                    // modify the potential for xplor shifting
-                    if (m_shift_mode == xplor)
+                    // compute the force and potential energy on each active lane
+                    Scalar force_divr_lane[pair_batch_width] = {};
+                    Scalar pair_eng_lane[pair_batch_width] = {};
+                    bool evaluated_lane[pair_batch_width] = {};
+                    for (unsigned int l = 0; l < n_lanes; l++)
                         {
-                        if (rsq >= ronsq && rsq < rcutsq)
+                        const unsigned int j = j_lane[l];
+                        const Scalar rsq = rsq_lane[l];
+
+                        // access the type of the neighbor particle
+                        unsigned int typej = h_type[j];
+
+                        // access charge (if needed)
+                        Scalar qj = Scalar(0.0);
+                        if (evaluator::needsCharge())
+                            qj = h_charge.data[j];
+
+                        // get parameters for this type pair
+                        unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                        const param_type& param = m_params[typpair_idx];
+                        Scalar rcutsq = h_rcutsq.data[typpair_idx];
+                        Scalar ronsq = Scalar(0.0);
+                        if constexpr (xplor_mode)
+                            ronsq = h_ronsq.data[typpair_idx];
+
+                        // design specifies that energies are shifted if
+                        // 1) shift mode is set to shift
+                        // or 2) shift mode is explor and ron > rcut
+                        bool energy_shift = shift_all;
+                        if constexpr (xplor_mode)
+                            {
+                            if (ronsq > rcutsq)
+                                energy_shift = true;
+                            }
+
+                        Scalar force_divr = Scalar(0.0);
+                        Scalar pair_eng = Scalar(0.0);
+                        evaluator eval(rsq, rcutsq, param);
+                        if (evaluator::needsCharge())
+                            eval.setCharge(qi, qj);
+
+                        if (!eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift))
+                            continue;
+
+                        // modify the potential for xplor shifting
+                        if (xplor_mode && rsq >= ronsq && rsq < rcutsq)
                             {
                             // Implement XPLOR smoothing (FLOPS: 16)
                             Scalar old_pair_eng = pair_eng;
@@ -711,70 +1016,210 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
                             // + But this is verified correct via plotting
                             force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
                             }
+
+                        force_divr_lane[l] = force_divr;
+                        pair_eng_lane[l] = pair_eng;
+                        evaluated_lane[l] = true;
                         }
 
-                    Scalar force_div2r = force_divr * Scalar(0.5);
-                    // add the force, potential energy and virial to the particle i
-                    // (FLOPS: 8)
-                    fi += dx * force_divr;
-                    pei += pair_eng * Scalar(0.5);
-                    if (compute_virial)
+                    // add the force, potential energy and virial to the particle i accumulators
+                    // (masked lanes have zero force and energy)
+                    for (unsigned int l = 0; l < pair_batch_width; l++)
                         {
-                        virialxxi += force_div2r * dx.x * dx.x;
-                        virialxyi += force_div2r * dx.x * dx.y;
-                        virialxzi += force_div2r * dx.x * dx.z;
-                        virialyyi += force_div2r * dx.y * dx.y;
-                        virialyzi += force_div2r * dx.y * dx.z;
-                        virialzzi += force_div2r * dx.z * dx.z;
+                        const Scalar force_divr = force_divr_lane[l];
+                        fxi[l] += dx_lane[l] * force_divr;
+                        fyi[l] += dy_lane[l] * force_divr;
+                        fzi[l] += dz_lane[l] * force_divr;
+                        if constexpr (use_energy)
+                            pei[l] += pair_eng_lane[l] * Scalar(0.5);
                         }
 
-                    // add the force to particle j if we are using the third law (MEM TRANSFER: 10
-                    // scalars / FLOPS: 8) only add force to local particles
-                    if (third_law && j < m_pdata->getN())
+                    if constexpr (use_virial)
                         {
-                        unsigned int mem_idx = j;
-                        h_force.data[mem_idx].x -= dx.x * force_divr;
-                        h_force.data[mem_idx].y -= dx.y * force_divr;
-                        h_force.data[mem_idx].z -= dx.z * force_divr;
-                        h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
-                        if (compute_virial)
+                        for (unsigned int l = 0; l < pair_batch_width; l++)
+                            {
+                            const Scalar force_div2r = force_divr_lane[l] * Scalar(0.5);
+                            virialxxi[l] += force_div2r * dx_lane[l] * dx_lane[l];
+                            virialxyi[l] += force_div2r * dx_lane[l] * dy_lane[l];
+                            virialxzi[l] += force_div2r * dx_lane[l] * dz_lane[l];
+                            virialyyi[l] += force_div2r * dy_lane[l] * dy_lane[l];
+                            virialyzi[l] += force_div2r * dy_lane[l] * dz_lane[l];
+                            virialzzi[l] += force_div2r * dz_lane[l] * dz_lane[l];
+                            }
+                        }
+
+                    // add the force to particle j if we are using the third law
+                    // only add force to local particles
+                    if constexpr (use_third_law)
+                        {
+                        for (unsigned int l = 0; l < n_lanes; l++)
                             {
-                            h_virial.data[0 * m_virial_pitch + mem_idx]
-                                += force_div2r * dx.x * dx.x;
-                            h_virial.data[1 * m_virial_pitch + mem_idx]
-                                += force_div2r * dx.x * dx.y;
-                            h_virial.data[2 * m_virial_pitch + mem_idx]
-                                += force_div2r * dx.x * dx.z;
-                            h_virial.data[3 * m_virial_pitch + mem_idx]
-                                += force_div2r * dx.y * dx.y;
-                            h_virial.data[4 * m_virial_pitch + mem_idx]
-                                += force_div2r * dx.y * dx.z;
-                            h_virial.data[5 * m_virial_pitch + mem_idx]
-                                += force_div2r * dx.z * dx.z;
+                            const unsigned int mem_idx = j_lane[l];
+                            if (!evaluated_lane[l] || mem_idx >= N)
+                                continue;
+
+                            const Scalar force_divr = force_divr_lane[l];
+                            const Scalar force_div2r = force_divr * Scalar(0.5);
+                            force[mem_idx].x -= dx_lane[l] * force_divr;
+                            force[mem_idx].y -= dy_lane[l] * force_divr;
+                            force[mem_idx].z -= dz_lane[l] * force_divr;
+                            if constexpr (use_energy)
+                                force[mem_idx].w += pair_eng_lane[l] * Scalar(0.5);
+                            if constexpr (use_virial)
+                                {
+                                virial[0 * virial_pitch + mem_idx]
+                                    += force_div2r * dx_lane[l] * dx_lane[l];
+                                virial[1 * virial_pitch + mem_idx]
+                                    += force_div2r * dx_lane[l] * dy_lane[l];
+                                virial[2 * virial_pitch + mem_idx]
+                                    += force_div2r * dx_lane[l] * dz_lane[l];
+                                virial[3 * virial_pitch + mem_idx]
+                                    += force_div2r * dy_lane[l] * dy_lane[l];
+                                virial[4 * virial_pitch + mem_idx]
+                                    += force_div2r * dy_lane[l] * dz_lane[l];
+                                virial[5 * virial_pitch + mem_idx]
+                                    += force_div2r * dz_lane[l] * dz_lane[l];
+                                }
                             }
                         }
                     }
+
+                // finally, reduce the lanes and increment the force, potential energy and virial
+                // for particle i
+                Scalar3 fi = make_scalar3(0, 0, 0);
+                Scalar pei_total = Scalar(0.0);
+                for (unsigned int l = 0; l < pair_batch_width; l++)
+                    {
+                    fi.x += fxi[l];
+                    fi.y += fyi[l];
+                    fi.z += fzi[l];
+                    pei_total += pei[l];
+                    }
+
+                unsigned int mem_idx = i;
+                force[mem_idx].x += fi.x;
+                force[mem_idx].y += fi.y;
+                force[mem_idx].z += fi.z;
+                if constexpr (use_energy)
+                    force[mem_idx].w += pei_total;
+                if constexpr (use_virial)
+                    {
+                    Scalar virial_total[6] = {};
+                    for (unsigned int l = 0; l < pair_batch_width; l++)
+                        {
+                        virial_total[0] += virialxxi[l];
+                        virial_total[1] += virialxyi[l];
+                        virial_total[2] += virialxzi[l];
+                        virial_total[3] += virialyyi[l];
+                        virial_total[4] += virialyzi[l];
+                        virial_total[5] += virialzzi[l];
+                        }
+
+                    for (unsigned int v = 0; v < 6; v++)
+                        {
+                        virial[v * virial_pitch + mem_idx] += virial_total[v];
+                        }
+                    }
                 }
+            };
+
+        // select the specialized loop once for each range of particles
+        auto compute_range = [&](unsigned int begin,
+                                 unsigned int end,
+                                 Scalar4* force,
+                                 Scalar* virial,
+                                 size_t virial_pitch)
+            {
+            detail::dispatchPairLoop(
+                third_law,
+                compute_virial,
+                compute_energy,
+                m_shift_mode,
+                [&](auto options)
+                {
+                    compute_range_specialized(options, begin, end, force, virial, virial_pitch);
+                });
+            };
+
+        ThreadPool& pool = m_exec_conf->getThreadPool();
+        const unsigned int n_threads = pool.getNumThreads();
+
+        if (n_threads == 1)
+            {
+            compute_range(0, n_particles, h_force.data, h_virial.data, m_virial_pitch);
+            }
+        else if (!third_law)
+            {
+            // with a full neighbor list, each thread writes only to the particles it owns
+            pool.parallelFor(
+                n_particles,
+                [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+                { compute_range(begin, end, h_force.data, h_virial.data, m_virial_pitch); });
+            }
+        else
+            {
+            // with a half neighbor list, threads scatter forces to neighbors owned by other
+            // threads. Thread 0 accumulates directly into the output arrays and the other
+            // threads accumulate into private buffers that are summed afterwards.
+            m_thread_force.resize(n_threads - 1);
+            m_thread_virial.resize(n_threads - 1);
+
+            pool.parallelFor(
+                n_particles,
+                [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+                {
+                    if (thread_id == 0)
+                        {
+                        compute_range(begin, end, h_force.data, h_virial.data, m_virial_pitch);
+                        return;
+                        }
+
+                    std::vector<Scalar4>& thread_force = m_thread_force[thread_id - 1];
+                    std::vector<Scalar>& thread_virial = m_thread_virial[thread_id - 1];
+                    thread_force.assign(N, make_scalar4(0, 0, 0, 0));
+                    if (compute_virial)
+                        {
+                        thread_virial.assign(6 * size_t(N), Scalar(0.0));
+                        }
+                    compute_range(begin, end, thread_force.data(), thread_virial.data(), N);
+                });
 
-            // finally, increment the force, potential energy and virial for particle i
-            unsigned int mem_idx = i;
-            h_force.data[mem_idx].x += fi.x;
-            h_force.data[mem_idx].y += fi.y;
-            h_force.data[mem_idx].z += fi.z;
-            h_force.data[mem_idx].w += pei;
-            if (compute_virial)
+            // sum the per-thread buffers, in thread order for reproducibility
+            pool.parallelFor(
+                N,
+                [&](unsigned int thread_id, unsigned int begin, unsigned int end)
                 {
-                h_virial.data[0 * m_virial_pitch + mem_idx] += virialxxi;
-                h_virial.data[1 * m_virial_pitch + mem_idx] += virialxyi;
-                h_virial.data[2 * m_virial_pitch + mem_idx] += virialxzi;
-                h_virial.data[3 * m_virial_pitch + mem_idx] += virialyyi;
-                h_virial.data[4 * m_virial_pitch + mem_idx] += virialyzi;
-                h_virial.data[5 * m_virial_pitch + mem_idx] += virialzzi;
-                }
+                    for (unsigned int t = 0; t < n_threads - 1; t++)
+                        {
+                        const Scalar4* thread_force = m_thread_force[t].data();
+                        for (unsigned int i = begin; i < end; i++)
+                            {
+                            h_force.data[i].x += thread_force[i].x;
+                            h_force.data[i].y += thread_force[i].y;
+                            h_force.data[i].z += thread_force[i].z;
+                            h_force.data[i].w += thread_force[i].w;
+                            }
+
+                        if (compute_virial)
+                            {
+                            const Scalar* thread_virial = m_thread_virial[t].data();
+                            for (unsigned int k = 0; k < 6; k++)
+                                {
+                                for (unsigned int i = begin; i < end; i++)
+                                    {
+                                    h_virial.data[k * m_virial_pitch + i]
+                                        += thread_virial[k * size_t(N) + i];
+                                    }
+                                }
+                            }
+                        }
+                });
             }
         }
 
-    computeTailCorrection();
+    // the tail correction is applied once, after the last pass
+    if (set != PairComputeSet::interior)
+        computeTailCorrection();
     }
 
 #ifdef ENABLE_MPI
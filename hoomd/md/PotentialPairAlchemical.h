@@ -140,6 +140,14 @@ class PotentialPairAlchemical : public PotentialPair<evaluator>
     virtual inline void pkgFinalize(extra_pkg&);
 
     virtual void computeForces(uint64_t timestep);
+
+#ifdef ENABLE_MPI
+    //! An interior pass would skip the alchemical derivatives computed by computeForces()
+    virtual bool computeInteriorForces(uint64_t timestep)
+        {
+        return false;
+        }
+#endif
     };
 
 template<class evaluator, typename extra_pkg, typename alpha_particle_type>
@@ -151,7 +159,7 @@ PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::PotentialPai
     m_alchemy_index = Index2DUpperTriangular(m_pdata->getNTypes());
     m_alchemical_particles.resize(m_alchemy_index.getNumElements()
                                   * evaluator::num_alchemical_parameters);
-    m_alchemy_mask.resize(m_pdata->getNTypes());
+    m_alchemy_mask.resize(m_alchemy_index.getNumElements());
 
     m_exec_conf->msg->notice(5) << "Constructing PotentialPairAlchemical<" << evaluator::getName()
                                 << ">" << std::endl;
@@ -298,7 +306,7 @@ void PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::compute
         bool third_law = m_nlist->getStorageMode() == NeighborList::half;
 
         // access the neighbor list, particle data, and system box
-        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(m_r_cut_nlist),
                                             access_location::host,
                                             access_mode::read);
         ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
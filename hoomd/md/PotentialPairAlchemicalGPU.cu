@@ -0,0 +1,86 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "PotentialPairAlchemicalGPU.cuh"
+
+/*! \file PotentialPairAlchemicalGPU.cu
+    \brief Defines GPU kernel code for reducing the alchemical derivatives computed by
+   PotentialPairAlchemicalGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel that sums one row of per particle alchemical derivatives per block
+/*! \param d_sums Output sum of each row
+    \param d_derivatives Per particle derivatives, one row of N elements per slot
+    \param N Number of particles
+*/
+__global__ void gpu_sum_alchemical_derivatives_kernel(Scalar* d_sums,
+                                                      const Scalar* d_derivatives,
+                                                      const unsigned int N)
+    {
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar* sum_sdata = (Scalar*)&s_data[0];
+
+    const Scalar* row = d_derivatives + size_t(blockIdx.x) * N;
+
+    // each thread sums a strided subset of the row
+    Scalar sum = Scalar(0.0);
+    for (unsigned int i = threadIdx.x; i < N; i += blockDim.x)
+        sum += row[i];
+
+    sum_sdata[threadIdx.x] = sum;
+    __syncthreads();
+
+    // reduce the sum in parallel
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
+            sum_sdata[threadIdx.x] += sum_sdata[threadIdx.x + offs];
+        offs >>= 1;
+        __syncthreads();
+        }
+
+    // write out our partial sum
+    if (threadIdx.x == 0)
+        d_sums[blockIdx.x] = sum_sdata[0];
+    }
+
+/*! \param d_sums Output sum of each row (n_slots elements)
+    \param d_derivatives Per particle derivatives, one row of N elements per slot
+    \param N Number of particles
+    \param n_slots Number of rows
+    \param block_size Block size to execute (must be a power of two)
+*/
+hipError_t gpu_sum_alchemical_derivatives(Scalar* d_sums,
+                                          const Scalar* d_derivatives,
+                                          const unsigned int N,
+                                          const unsigned int n_slots,
+                                          const unsigned int block_size)
+    {
+    if (n_slots == 0)
+        return hipSuccess;
+
+    dim3 grid(n_slots, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_sum_alchemical_derivatives_kernel),
+                       grid,
+                       threads,
+                       block_size * sizeof(Scalar),
+                       0,
+                       d_sums,
+                       d_derivatives,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
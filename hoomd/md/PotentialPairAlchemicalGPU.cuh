@@ -0,0 +1,328 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+#include "hoomd/ParticleData.cuh"
+#include "hoomd/TextureTools.h"
+
+#include <assert.h>
+
+/*! \file PotentialPairAlchemicalGPU.cuh
+    \brief Defines templated GPU kernel code for calculating alchemical pair forces and their
+   derivatives with respect to the alchemical degrees of freedom.
+*/
+
+#ifndef __POTENTIAL_PAIR_ALCHEMICAL_GPU_CUH__
+#define __POTENTIAL_PAIR_ALCHEMICAL_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Wraps arguments to gpu_compute_alchemical_pair_forces
+struct alchemical_pair_args_t
+    {
+    //! Construct an alchemical_pair_args_t
+    alchemical_pair_args_t(Scalar4* _d_force,
+                           Scalar* _d_virial,
+                           const size_t _virial_pitch,
+                           const unsigned int _N,
+                           const Scalar4* _d_pos,
+                           const Scalar* _d_charge,
+                           const BoxDim& _box,
+                           const unsigned int* _d_n_neigh,
+                           const unsigned int* _d_nlist,
+                           const size_t* _d_head_list,
+                           const Scalar* _d_rcutsq,
+                           const Scalar* _d_ronsq,
+                           const unsigned int _ntypes,
+                           const Scalar* _d_alphas,
+                           const int* _d_slots,
+                           Scalar* _d_derivatives,
+                           const unsigned int _n_slots,
+                           const unsigned int _block_size,
+                           const unsigned int _shift_mode,
+                           const unsigned int _compute_virial)
+        : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), d_pos(_d_pos),
+          d_charge(_d_charge), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
+          d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_ronsq(_d_ronsq), ntypes(_ntypes),
+          d_alphas(_d_alphas), d_slots(_d_slots), d_derivatives(_d_derivatives),
+          n_slots(_n_slots), block_size(_block_size), shift_mode(_shift_mode),
+          compute_virial(_compute_virial) { };
+
+    Scalar4* d_force;              //!< Force to write out
+    Scalar* d_virial;              //!< Virial to write out
+    const size_t virial_pitch;     //!< The pitch of the 2D array of virial matrix elements
+    const unsigned int N;          //!< number of particles
+    const Scalar4* d_pos;          //!< particle positions
+    const Scalar* d_charge;        //!< particle charges
+    const BoxDim box;              //!< Simulation box in GPU format
+    const unsigned int* d_n_neigh; //!< Number of neighbors of each particle
+    const unsigned int* d_nlist;   //!< Device array listing the neighbors of each particle
+    const size_t* d_head_list;     //!< Head list indexes for accessing d_nlist
+    const Scalar* d_rcutsq;        //!< Device array listing r_cut squared per particle type pair
+    const Scalar* d_ronsq;         //!< Device array listing r_on squared per particle type pair
+    const unsigned int ntypes;     //!< Number of particle types in the simulation
+
+    //! Alchemical degree of freedom of each parameter (rows) and type pair (columns)
+    const Scalar* d_alphas;
+    //! Row of d_derivatives for each parameter and type pair, -1 when not computed this step
+    const int* d_slots;
+    Scalar* d_derivatives;         //!< Per particle dU/dalpha, one row of N elements per slot
+    const unsigned int n_slots;    //!< Number of rows in d_derivatives
+    const unsigned int block_size; //!< Block size to execute
+    const unsigned int shift_mode; //!< The potential energy shift mode
+    const unsigned int compute_virial; //!< Flag to indicate if virials should be computed
+    };
+
+#ifdef __HIPCC__
+
+//! Kernel for calculating alchemical pair forces
+/*! \param args Arguments to the kernel
+    \param d_params Parameters for the potential, stored per type pair
+
+    Each thread computes the force on one particle from its full neighbor list. The evaluator
+    parameters are scaled by the alchemical degrees of freedom of the type pair (looked up with an
+    upper triangular index, matching PotentialPairAlchemical) before evaluating the force. When the
+    derivatives of a degree of freedom are needed on this step, each thread also accumulates
+    -1/2 dU/dalpha of its pairs into its own element of the slot's row in d_derivatives. With a
+    full neighbor list, this gives the same per particle values as the CPU code.
+
+    \tparam evaluator EvaluatorPair class to evaluate V(r), -delta V(r)/r, and dV/dalpha.
+*/
+template<class evaluator>
+__global__ void
+gpu_compute_alchemical_pair_forces_kernel(const alchemical_pair_args_t args,
+                                          const typename evaluator::param_type* d_params)
+    {
+    // start by identifying which particle we are to handle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= args.N)
+        return;
+
+    const Index2D typpair_idx(args.ntypes);
+    const Index2DUpperTriangular alchemy_idx(args.ntypes);
+    const unsigned int n_alchemy = alchemy_idx.getNumElements();
+
+    // zero the alchemical derivatives of this particle
+    for (unsigned int s = 0; s < args.n_slots; s++)
+        args.d_derivatives[size_t(s) * args.N + idx] = Scalar(0.0);
+
+    // read in the position and type of our particle
+    Scalar4 postypei = __ldg(args.d_pos + idx);
+    Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+    unsigned int typei = __scalar_as_int(postypei.w);
+
+    Scalar qi = Scalar(0.0);
+    if (evaluator::needsCharge())
+        qi = __ldg(args.d_charge + idx);
+
+    // initialize the force, energy, and virial to 0
+    Scalar3 force = make_scalar3(Scalar(0.0), Scalar(0.0), Scalar(0.0));
+    Scalar energy = Scalar(0.0);
+    Scalar virialxx = Scalar(0.0);
+    Scalar virialxy = Scalar(0.0);
+    Scalar virialxz = Scalar(0.0);
+    Scalar virialyy = Scalar(0.0);
+    Scalar virialyz = Scalar(0.0);
+    Scalar virialzz = Scalar(0.0);
+
+    const size_t my_head = args.d_head_list[idx];
+    const unsigned int n_neigh = args.d_n_neigh[idx];
+
+    for (unsigned int k = 0; k < n_neigh; k++)
+        {
+        unsigned int j = __ldg(args.d_nlist + my_head + k);
+
+        // get the neighbor's position
+        Scalar4 postypej = __ldg(args.d_pos + j);
+        Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+        unsigned int typej = __scalar_as_int(postypej.w);
+
+        Scalar qj = Scalar(0.0);
+        if (evaluator::needsCharge())
+            qj = __ldg(args.d_charge + j);
+
+        // calculate dr (with periodic boundary conditions)
+        Scalar3 dx = posi - posj;
+        dx = args.box.minImage(dx);
+        Scalar rsq = dot(dx, dx);
+
+        // access the per type pair parameters
+        unsigned int cur_typpair = typpair_idx(typei, typej);
+        Scalar rcutsq = __ldg(args.d_rcutsq + cur_typpair);
+        Scalar ronsq = Scalar(0.0);
+        if (args.shift_mode == 2)
+            ronsq = __ldg(args.d_ronsq + cur_typpair);
+
+        // design specifies that energies are shifted if
+        // 1) shift mode is set to shift
+        // or 2) shift mode is explor and ron > rcut
+        bool energy_shift = false;
+        if (args.shift_mode == 1)
+            energy_shift = true;
+        else if (args.shift_mode == 2)
+            {
+            if (ronsq > rcutsq)
+                energy_shift = true;
+            }
+
+        evaluator eval(rsq, rcutsq, d_params[cur_typpair]);
+        if (evaluator::needsCharge())
+            eval.setCharge(qi, qj);
+
+        // look up the alchemical degrees of freedom of this type pair
+        unsigned int cur_alchemy = alchemy_idx(typei, typej);
+        Scalar alphas[evaluator::num_alchemical_parameters];
+        bool compute_derivatives = false;
+        for (unsigned int p = 0; p < evaluator::num_alchemical_parameters; p++)
+            {
+            alphas[p] = __ldg(args.d_alphas + p * n_alchemy + cur_alchemy);
+            if (__ldg(args.d_slots + p * n_alchemy + cur_alchemy) >= 0)
+                compute_derivatives = true;
+            }
+
+        // calculate alchemical derivatives if needed
+        if (compute_derivatives && rsq < rcutsq)
+            {
+            Scalar alchemical_derivatives[evaluator::num_alchemical_parameters];
+            eval.evalAlchemyDerivatives(alchemical_derivatives, alphas);
+            for (unsigned int p = 0; p < evaluator::num_alchemical_parameters; p++)
+                {
+                int slot = __ldg(args.d_slots + p * n_alchemy + cur_alchemy);
+                if (slot >= 0)
+                    {
+                    args.d_derivatives[size_t(slot) * args.N + idx]
+                        += alchemical_derivatives[p] * Scalar(-0.5);
+                    }
+                }
+            }
+
+        // update parameter values with current alphas (MUST! be performed after dAlpha
+        // calculations)
+        eval.updateAlchemyParams(alphas);
+
+        Scalar force_divr = Scalar(0.0);
+        Scalar pair_eng = Scalar(0.0);
+        bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+        if (evaluated)
+            {
+            // modify the potential for xplor shifting
+            if (args.shift_mode == 2 && rsq >= ronsq && rsq < rcutsq)
+                {
+                // Implement XPLOR smoothing
+                Scalar old_pair_eng = pair_eng;
+                Scalar old_force_divr = force_divr;
+
+                // calculate 1.0 / (xplor denominator)
+                Scalar xplor_denom_inv
+                    = Scalar(1.0) / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+
+                Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+                Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                           * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq) * xplor_denom_inv;
+                Scalar ds_dr_divr
+                    = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+
+                // make modifications to the old pair energy and force
+                pair_eng = old_pair_eng * s;
+                force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+                }
+
+            // add the force, potential energy and virial to the particle i
+            force += dx * force_divr;
+            energy += pair_eng * Scalar(0.5);
+            if (args.compute_virial)
+                {
+                Scalar force_div2r = force_divr * Scalar(0.5);
+                virialxx += force_div2r * dx.x * dx.x;
+                virialxy += force_div2r * dx.x * dx.y;
+                virialxz += force_div2r * dx.x * dx.z;
+                virialyy += force_div2r * dx.y * dx.y;
+                virialyz += force_div2r * dx.y * dx.z;
+                virialzz += force_div2r * dx.z * dx.z;
+                }
+            }
+        }
+
+    // now that the force calculation is complete, write out the result
+    args.d_force[idx] = make_scalar4(force.x, force.y, force.z, energy);
+
+    if (args.compute_virial)
+        {
+        args.d_virial[0 * args.virial_pitch + idx] = virialxx;
+        args.d_virial[1 * args.virial_pitch + idx] = virialxy;
+        args.d_virial[2 * args.virial_pitch + idx] = virialxz;
+        args.d_virial[3 * args.virial_pitch + idx] = virialyy;
+        args.d_virial[4 * args.virial_pitch + idx] = virialyz;
+        args.d_virial[5 * args.virial_pitch + idx] = virialzz;
+        }
+    }
+
+//! Kernel driver that computes alchemical pair forces on the GPU for PotentialPairAlchemicalGPU
+/*! \param args Other arguments to pass onto the kernel
+    \param d_params Parameters for the potential, stored per type pair
+
+    This is just a driver function for gpu_compute_alchemical_pair_forces_kernel(), see it for
+    details.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_alchemical_pair_forces(const alchemical_pair_args_t& args,
+                                   const typename evaluator::param_type* d_params)
+    {
+    assert(d_params);
+    assert(args.d_rcutsq);
+    assert(args.ntypes > 0);
+
+    // check that block_size is valid
+    assert(args.block_size != 0);
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr,
+                         reinterpret_cast<const void*>(
+                             &gpu_compute_alchemical_pair_forces_kernel<evaluator>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(args.block_size, max_block_size);
+
+    // setup the grid to run the kernel
+    dim3 grid(args.N / run_block_size + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_alchemical_pair_forces_kernel<evaluator>),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       args,
+                       d_params);
+
+    return hipSuccess;
+    }
+#else
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_alchemical_pair_forces(const alchemical_pair_args_t& args,
+                                   const typename evaluator::param_type* d_params);
+#endif
+
+//! Sum the per particle alchemical derivatives of each slot
+hipError_t gpu_sum_alchemical_derivatives(Scalar* d_sums,
+                                          const Scalar* d_derivatives,
+                                          const unsigned int N,
+                                          const unsigned int n_slots,
+                                          const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __POTENTIAL_PAIR_ALCHEMICAL_GPU_CUH__
@@ -0,0 +1,302 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __POTENTIAL_PAIR_ALCHEMICAL_GPU_H__
+#define __POTENTIAL_PAIR_ALCHEMICAL_GPU_H__
+
+#ifdef ENABLE_HIP
+
+#include <memory>
+
+#include "PotentialPairAlchemical.h"
+#include "PotentialPairAlchemicalGPU.cuh"
+#include "hoomd/Autotuner.h"
+
+/*! \file PotentialPairAlchemicalGPU.h
+    \brief Defines the template class for alchemical pair potentials on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Template class for computing alchemical pair potentials on the GPU
+/*! PotentialPairAlchemicalGPU computes the same forces and alchemical derivatives as
+    PotentialPairAlchemical. Each step, it uploads the current alpha of every type pair and
+    parameter along with the row of the derivative buffer to accumulate into for the degrees of
+    freedom that the alchemostat integrates on this step. The pair kernel scales the parameters and
+    accumulates the per particle derivatives, and a second kernel sums each row so that only the
+    net alchemical forces are copied back to the host.
+
+    \tparam evaluator EvaluatorPair class used to evaluate V(r), F(r)/r, and dV/dalpha
+
+    \sa export_PotentialPairAlchemicalGPU()
+*/
+template<class evaluator>
+class PotentialPairAlchemicalGPU : public PotentialPairAlchemical<evaluator>
+    {
+    public:
+    //! Construct the pair potential
+    PotentialPairAlchemicalGPU(std::shared_ptr<SystemDefinition> sysdef,
+                               std::shared_ptr<NeighborList> nlist);
+
+    //! Destructor
+    virtual ~PotentialPairAlchemicalGPU() { }
+
+    protected:
+    typedef AlchemicalPairParticle alpha_particle_type;
+
+    std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
+    GPUArray<Scalar> m_alphas;             //!< Alpha of each parameter and type pair
+    GPUArray<int> m_slots;                 //!< Derivative row of each parameter and type pair
+    GPUArray<Scalar> m_derivatives;        //!< Per particle alchemical derivatives of each slot
+    GPUArray<Scalar> m_derivative_sums;    //!< Sum of the derivatives of each slot
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+template<class evaluator>
+PotentialPairAlchemicalGPU<evaluator>::PotentialPairAlchemicalGPU(
+    std::shared_ptr<SystemDefinition> sysdef,
+    std::shared_ptr<NeighborList> nlist)
+    : PotentialPairAlchemical<evaluator>(sysdef, nlist)
+    {
+    // can't run on the GPU if there aren't any GPUs in the execution configuration
+    if (!this->m_exec_conf->isCUDAEnabled())
+        {
+        this->m_exec_conf->msg->error()
+            << "Creating a PotentialPairAlchemicalGPU with no GPU in the execution configuration"
+            << std::endl;
+        throw std::runtime_error("Error initializing PotentialPairAlchemicalGPU");
+        }
+
+    unsigned int n_alpha
+        = this->m_alchemy_index.getNumElements() * evaluator::num_alchemical_parameters;
+    GPUArray<Scalar> alphas(n_alpha, this->m_exec_conf);
+    m_alphas.swap(alphas);
+    GPUArray<int> slots(n_alpha, this->m_exec_conf);
+    m_slots.swap(slots);
+    GPUArray<Scalar> derivatives(1, this->m_exec_conf);
+    m_derivatives.swap(derivatives);
+    GPUArray<Scalar> derivative_sums(1, this->m_exec_conf);
+    m_derivative_sums.swap(derivative_sums);
+
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                   this->m_exec_conf,
+                                   "alchemical_pair_" + evaluator::getName()));
+    this->m_autotuners.push_back(m_tuner);
+    }
+
+template<class evaluator>
+void PotentialPairAlchemicalGPU<evaluator>::computeForces(uint64_t timestep)
+    {
+    const unsigned int n_alchemy = this->m_alchemy_index.getNumElements();
+    const unsigned int N = this->m_pdata->getN();
+
+    // Read the alphas into the type pair indexed array and assign a row of the derivative buffer
+    // to each alchemical particle that is integrated on this step
+    std::vector<std::shared_ptr<alpha_particle_type>> active_particles;
+        {
+        ArrayHandle<Scalar> h_alphas(m_alphas, access_location::host, access_mode::overwrite);
+        ArrayHandle<int> h_slots(m_slots, access_location::host, access_mode::overwrite);
+        for (unsigned int i = 0; i < n_alchemy; i++)
+            for (unsigned int j = 0; j < evaluator::num_alchemical_parameters; j++)
+                {
+                unsigned int idx = j * n_alchemy + i;
+                h_slots.data[idx] = -1;
+                if (this->m_alchemy_mask[i][j])
+                    {
+                    auto& particle = this->m_alchemical_particles[idx];
+                    h_alphas.data[idx] = particle->value;
+                    if (particle->m_nextTimestep == timestep)
+                        {
+                        h_slots.data[idx] = static_cast<int>(active_particles.size());
+                        active_particles.push_back(particle);
+                        }
+                    }
+                else
+                    {
+                    h_alphas.data[idx] = Scalar(1.0);
+                    }
+                }
+        }
+
+    const unsigned int n_slots = static_cast<unsigned int>(active_particles.size());
+    if (n_slots > 0)
+        {
+        this->m_exec_conf->msg->notice(10)
+            << "AlchemPotentialPair: Calculating alchemical forces" << std::endl;
+        }
+
+    // grow the derivative buffers as needed
+    if (m_derivatives.getNumElements() < size_t(n_slots) * N)
+        {
+        GPUArray<Scalar> derivatives(size_t(n_slots) * N, this->m_exec_conf);
+        m_derivatives.swap(derivatives);
+        }
+    if (m_derivative_sums.getNumElements() < n_slots)
+        {
+        GPUArray<Scalar> derivative_sums(n_slots, this->m_exec_conf);
+        m_derivative_sums.swap(derivative_sums);
+        }
+
+        {
+        this->m_nlist->compute(timestep);
+
+        // The GPU implementation CANNOT handle a half neighborlist, error out now
+        bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
+        if (third_law)
+            {
+            this->m_exec_conf->msg->error()
+                << "PotentialPairAlchemicalGPU cannot handle a half neighborlist" << std::endl;
+            throw std::runtime_error("Error computing forces in PotentialPairAlchemicalGPU");
+            }
+
+        // access the neighbor list
+        ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(this->m_r_cut_nlist),
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
+                                        access_location::device,
+                                        access_mode::read);
+
+        // access the particle data
+        ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                     access_location::device,
+                                     access_mode::read);
+
+        BoxDim box = this->m_pdata->getGlobalBox();
+
+        // access parameters
+        ArrayHandle<Scalar> d_ronsq(this->m_ronsq, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_rcutsq(this->m_rcutsq, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_alphas(m_alphas, access_location::device, access_mode::read);
+        ArrayHandle<int> d_slots(m_slots, access_location::device, access_mode::read);
+
+        ArrayHandle<Scalar4> d_force(this->m_force,
+                                     access_location::device,
+                                     access_mode::overwrite);
+        ArrayHandle<Scalar> d_virial(this->m_virial,
+                                     access_location::device,
+                                     access_mode::overwrite);
+        ArrayHandle<Scalar> d_derivatives(m_derivatives,
+                                          access_location::device,
+                                          access_mode::overwrite);
+
+        // access flags
+        PDataFlags flags = this->m_pdata->getFlags();
+
+        this->m_exec_conf->setDevice();
+
+        m_tuner->begin();
+        kernel::gpu_compute_alchemical_pair_forces<evaluator>(
+            kernel::alchemical_pair_args_t(d_force.data,
+                                           d_virial.data,
+                                           this->m_virial.getPitch(),
+                                           N,
+                                           d_pos.data,
+                                           d_charge.data,
+                                           box,
+                                           d_n_neigh.data,
+                                           d_nlist.data,
+                                           d_head_list.data,
+                                           d_rcutsq.data,
+                                           d_ronsq.data,
+                                           this->m_pdata->getNTypes(),
+                                           d_alphas.data,
+                                           d_slots.data,
+                                           d_derivatives.data,
+                                           n_slots,
+                                           m_tuner->getParam()[0],
+                                           this->m_shift_mode,
+                                           flags[pdata_flag::pressure_tensor]),
+            this->m_params.data());
+
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        m_tuner->end();
+        }
+
+    if (n_slots > 0)
+        {
+            {
+            ArrayHandle<Scalar> d_derivatives(m_derivatives,
+                                              access_location::device,
+                                              access_mode::read);
+            ArrayHandle<Scalar> d_derivative_sums(m_derivative_sums,
+                                                  access_location::device,
+                                                  access_mode::overwrite);
+
+            // reduce on the device so that only the net forces are copied to the host
+            // (the block size must be a power of two)
+            kernel::gpu_sum_alchemical_derivatives(d_derivative_sums.data,
+                                                   d_derivatives.data,
+                                                   N,
+                                                   n_slots,
+                                                   256);
+
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+
+            // keep the per particle alchemical forces of each alchemical particle for logging
+            for (unsigned int s = 0; s < n_slots; s++)
+                {
+                auto& particle = active_particles[s];
+                if (particle->m_alchemical_derivatives.getNumElements() != N)
+                    particle->resizeForces(N);
+
+                ArrayHandle<Scalar> d_particle_derivatives(particle->m_alchemical_derivatives,
+                                                           access_location::device,
+                                                           access_mode::overwrite);
+                hipMemcpy(d_particle_derivatives.data,
+                          d_derivatives.data + size_t(s) * N,
+                          sizeof(Scalar) * N,
+                          hipMemcpyDeviceToDevice);
+                }
+            }
+
+        ArrayHandle<Scalar> h_derivative_sums(m_derivative_sums,
+                                              access_location::host,
+                                              access_mode::read);
+        for (unsigned int s = 0; s < n_slots; s++)
+            active_particles[s]->setNetForce(timestep, h_derivative_sums.data[s]);
+        }
+
+    // energy and pressure corrections
+    this->computeTailCorrection();
+    }
+
+namespace detail
+    {
+//! Export this alchemical pair potential to python
+/*! \param name Name of the class in the exported python module
+    \tparam T Evaluator type to export.
+*/
+template<class T>
+void export_PotentialPairAlchemicalGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<PotentialPairAlchemicalGPU<T>,
+                     PotentialPairAlchemical<T>,
+                     std::shared_ptr<PotentialPairAlchemicalGPU<T>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+#endif // __POTENTIAL_PAIR_ALCHEMICAL_GPU_H__
@@ -69,6 +69,14 @@ template<class evaluator> class PotentialPairDPDThermo : public PotentialPair<ev
 
     //! Actually compute the forces (overwrites PotentialPair::computeForces())
     virtual void computeForces(uint64_t timestep);
+
+#ifdef ENABLE_MPI
+    //! An interior pass would skip the dissipative and random forces of computeForces()
+    virtual bool computeInteriorForces(uint64_t timestep)
+        {
+        return false;
+        }
+#endif
     };
 
 /*! \param sysdef System to compute forces on
@@ -109,7 +117,7 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
     bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
 
     // access the neighbor list, particle data, and system box
-    ArrayHandle<unsigned int> h_n_neigh(this->m_nlist->getNNeighArray(),
+    ArrayHandle<unsigned int> h_n_neigh(this->m_nlist->getNNeighArray(this->m_r_cut_nlist),
                                         access_location::host,
                                         access_mode::read);
     ArrayHandle<unsigned int> h_nlist(this->m_nlist->getNListArray(),
@@ -143,6 +151,9 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
 
     uint16_t seed = this->m_sysdef->getSeed();
 
+    // Special Potential Pair DPD Requirements
+    const Scalar currentTemp = m_T->operator()(timestep);
+
     // for each particle
     for (int i = 0; i < (int)this->m_pdata->getN(); i++)
         {
@@ -171,6 +182,20 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
             unsigned int j = h_nlist.data[head_i + k];
             assert(j < this->m_pdata->getN() + this->m_pdata->getNGhosts());
 
+            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+            assert(typej < this->m_pdata->getNTypes());
+
+            // get parameters for this type pair
+            unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
+            Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+            // skip the type pairs that do not interact before reading the rest of the neighbor
+            if (rcutsq <= Scalar(0.0))
+                continue;
+
+            const param_type& param = this->m_params[typpair_idx];
+
             // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
             Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
             Scalar3 dx = pi - pj;
@@ -179,10 +204,6 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
             Scalar3 vj = make_scalar3(h_vel.data[j].x, h_vel.data[j].y, h_vel.data[j].z);
             Scalar3 dv = vi - vj;
 
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < this->m_pdata->getNTypes());
-
             // apply periodic boundary conditions
             dx = box.minImage(dx);
 
@@ -192,11 +213,6 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
             // calculate the drag term r \dot v
             Scalar rdotv = dot(dx, dv);
 
-            // get parameters for this type pair
-            unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
-            const param_type& param = this->m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
             // design specifies that energies are shifted if
             // 1) shift mode is set to shift
             bool energy_shift = false;
@@ -209,9 +225,6 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
             Scalar pair_eng = Scalar(0.0);
             evaluator eval(rsq, rcutsq, param);
 
-            // Special Potential Pair DPD Requirements
-            const Scalar currentTemp = m_T->operator()(timestep);
-
             // set seed using global tags
             unsigned int tagi = h_tag.data[i];
             unsigned int tagj = h_tag.data[j];
@@ -240,7 +240,18 @@ __global__ void gpu_compute_dpd_forces_kernel(Scalar4* d_force,
                 Scalar4 postypej = __ldg(d_pos + cur_j);
                 Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
 
-                // get the neighbor's position (MEM TRANSFER: 16 bytes)
+                // access the per type pair parameters
+                unsigned int typpair
+                    = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
+                Scalar rcutsq = s_rcutsq[typpair];
+
+                // skip the type pairs that do not interact before reading the velocity and tag
+                if (rcutsq <= Scalar(0.0))
+                    continue;
+
+                typename evaluator::param_type& param = s_params[typpair];
+
+                // get the neighbor's velocity (MEM TRANSFER: 16 bytes)
                 Scalar4 velmassj = __ldg(d_vel + cur_j);
                 Scalar3 velj = make_scalar3(velmassj.x, velmassj.y, velmassj.z);
 
@@ -258,12 +269,6 @@ __global__ void gpu_compute_dpd_forces_kernel(Scalar4* d_force,
 
                 Scalar rdotv = dot(dx, dv);
 
-                // access the per type pair parameters
-                unsigned int typpair
-                    = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
-                Scalar rcutsq = s_rcutsq[typpair];
-                typename evaluator::param_type& param = s_params[typpair];
-
                 // design specifies that energies are shifted if
                 // 1) shift mode is set to shift
                 // or 2) shift mode is explor and ron > rcut
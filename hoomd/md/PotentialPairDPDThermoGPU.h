@@ -100,7 +100,7 @@ void PotentialPairDPDThermoGPU<evaluator>::computeForces(uint64_t timestep)
         }
 
     // access the neighbor list
-    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(this->m_r_cut_nlist),
                                         access_location::device,
                                         access_mode::read);
     ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
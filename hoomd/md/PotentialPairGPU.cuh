@@ -10,6 +10,9 @@
 #include "hoomd/ParticleData.cuh"
 #include "hoomd/TextureTools.h"
 
+#include "NeighborListCluster.h"
+#include "NeighborListCompression.h"
+
 #ifdef __HIPCC__
 #include "hoomd/WarpTools.cuh"
 #endif // __HIPCC__
@@ -61,13 +64,20 @@ struct pair_args_t
                 const unsigned int _shift_mode,
                 const unsigned int _compute_virial,
                 const unsigned int _threads_per_particle,
-                const hipDeviceProp_t& _devprop)
+                const hipDeviceProp_t& _devprop,
+                const int16_t* _d_nlist_offsets = nullptr,
+                const unsigned int* _d_cluster_n_neigh = nullptr,
+                const unsigned int* _d_cluster_nlist = nullptr,
+                const uint64_t* _d_cluster_mask = nullptr,
+                const bool _half = false)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), n_max(_n_max),
           d_pos(_d_pos), d_charge(_d_charge), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
           d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_ronsq(_d_ronsq),
           size_neigh_list(_size_neigh_list), ntypes(_ntypes), block_size(_block_size),
           shift_mode(_shift_mode), compute_virial(_compute_virial),
-          threads_per_particle(_threads_per_particle), devprop(_devprop) { };
+          threads_per_particle(_threads_per_particle), devprop(_devprop),
+          d_nlist_offsets(_d_nlist_offsets), d_cluster_n_neigh(_d_cluster_n_neigh),
+          d_cluster_nlist(_d_cluster_nlist), d_cluster_mask(_d_cluster_mask), half(_half) { };
 
     Scalar4* d_force;          //!< Force to write out
     Scalar* d_virial;          //!< Virial to write out
@@ -90,10 +100,105 @@ struct pair_args_t
     const unsigned int compute_virial;       //!< Flag to indicate if virials should be computed
     const unsigned int threads_per_particle; //!< Number of threads per particle (maximum: 1 warp)
     const hipDeviceProp_t& devprop;          //!< CUDA device properties
+    const int16_t* d_nlist_offsets;          //!< Compressed neighbor offsets (may be null)
+    const unsigned int* d_cluster_n_neigh;   //!< Number of j clusters (null without cluster pairs)
+    const unsigned int* d_cluster_nlist;     //!< j clusters of each i cluster
+    const uint64_t* d_cluster_mask;          //!< Masks of the neighboring pairs
+    const bool half;                         //!< Evaluate each local pair once
     };
 
 #ifdef __HIPCC__
 
+//! Atomically add a force and energy to a particle
+/*! \param d_force Force of the particle
+    \param force Force (x, y, z) and energy (w) to add
+*/
+__device__ inline void atomic_add_force(Scalar4* d_force, const Scalar4& force)
+    {
+    atomicAdd(&d_force->x, force.x);
+    atomicAdd(&d_force->y, force.y);
+    atomicAdd(&d_force->z, force.z);
+    atomicAdd(&d_force->w, force.w);
+    }
+
+//! Atomically add a virial to a particle
+/*! \param d_virial Virial of the particle, with elements \a virial_pitch apart
+    \param virial_pitch Pitch of the 2D virial array
+    \param virial Virial elements xx, xy, xz, yy, yz, and zz to add
+*/
+__device__ inline void
+atomic_add_virial(Scalar* d_virial, const size_t virial_pitch, const Scalar* virial)
+    {
+    for (unsigned int i = 0; i < 6; i++)
+        {
+        atomicAdd(d_virial + i * virial_pitch, virial[i]);
+        }
+    }
+
+//! Evaluate the force and energy of one pair
+/*! \param rsq Squared distance between the particles
+    \param rcutsq Squared cutoff radius of the pair
+    \param ronsq Squared XPLOR switching radius of the pair
+    \param param Parameters of the pair
+    \param qi Charge of particle i
+    \param qj Charge of particle j
+    \param force_divr Force divided by r (output, initialize to 0)
+    \param pair_eng Pair energy (output, initialize to 0)
+
+    Applies the energy shift and XPLOR smoothing selected by \a shift_mode.
+*/
+template<class evaluator, unsigned int shift_mode>
+__device__ inline void evaluate_pair_force(Scalar rsq,
+                                           Scalar rcutsq,
+                                           Scalar ronsq,
+                                           const typename evaluator::param_type& param,
+                                           Scalar qi,
+                                           Scalar qj,
+                                           Scalar& force_divr,
+                                           Scalar& pair_eng)
+    {
+    // design specifies that energies are shifted if
+    // 1) shift mode is set to shift
+    // or 2) shift mode is explor and ron > rcut
+    bool energy_shift = false;
+    if (shift_mode == 1)
+        energy_shift = true;
+    else if (shift_mode == 2)
+        {
+        if (ronsq > rcutsq)
+            energy_shift = true;
+        }
+
+    evaluator eval(rsq, rcutsq, param);
+    if (evaluator::needsCharge())
+        eval.setCharge(qi, qj);
+
+    eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+    if (shift_mode == 2)
+        {
+        if (rsq >= ronsq && rsq < rcutsq)
+            {
+            // Implement XPLOR smoothing
+            Scalar old_pair_eng = pair_eng;
+            Scalar old_force_divr = force_divr;
+
+            // calculate 1.0 / (xplor denominator)
+            Scalar xplor_denom_inv
+                = Scalar(1.0) / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+
+            Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+            Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                       * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq) * xplor_denom_inv;
+            Scalar ds_dr_divr = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+
+            // make modifications to the old pair energy and force
+            pair_eng = old_pair_eng * s;
+            force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+            }
+        }
+    }
+
 //! Kernel for calculating pair forces
 /*! This kernel is called to calculate the pair forces on all N particles. Actual evaluation of the
    potentials and forces for each pair is handled via the template class \a evaluator.
@@ -108,10 +213,12 @@ struct pair_args_t
     \param d_n_neigh Device memory array listing the number of neighbors for each particle
     \param d_nlist Device memory array containing the neighbor list contents
     \param d_head_list Indexes for reading \a d_nlist
+    \param d_nlist_offsets Compressed neighbor offsets, or null to read \a d_nlist only
     \param d_params Parameters for the potential, stored per type pair
     \param d_rcutsq rcut squared, stored per type pair
     \param d_ronsq ron squared, stored per type pair
     \param ntypes Number of types in the simulation
+    \param max_extra_bytes Maximum number of extra bytes of shared memory for the parameters
 
     \a d_params, \a d_rcutsq, and \a d_ronsq must be indexed with an Index2DUpperTriangular(typei,
    typej) to access the unique value for that type pair. These values are all cached into shared
@@ -124,16 +231,25 @@ struct pair_args_t
    shift_mode 0: No energy shifting is done. 1: V(r) is shifted to be 0 at rcut. 2: XPLOR switching
    is enabled (See PotentialPair for a discussion on what that entails) \tparam compute_virial When
    non-zero, the virial tensor is computed. When zero, the virial tensor is not computed. \tparam
+   half When true, evaluate each local pair once and scatter the reaction with atomics \tparam
+   orthorhombic When true, the box has no tilt and the minimum image skips the tilt terms \tparam
    tpp Number of threads to use per particle, must be power of 2 and smaller than warp size
 
     <b>Implementation details</b>
     Each block will calculate the forces on a block of particles.
     Each group of \a tpp threads will calculate the total force on one particle.
     The neighborlist is arranged in columns so that reads are fully coalesced when doing this.
+
+    In \a half mode, the full neighbor list is read, but of each pair of local particles only the
+    particle with the lower index evaluates the pair and atomically adds the reaction to the other.
+    Pairs with ghost particles are evaluated by the local particle only, as in full mode. The
+    force and virial arrays must be zeroed before the launch.
 */
 template<class evaluator,
          unsigned int shift_mode,
          unsigned int compute_virial,
+         bool half,
+         bool orthorhombic,
          int tpp,
          bool enable_shared_cache>
 __global__ void
@@ -147,6 +263,7 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                                       const unsigned int* d_n_neigh,
                                       const unsigned int* d_nlist,
                                       const size_t* d_head_list,
+                                      const int16_t* d_nlist_offsets,
                                       const typename evaluator::param_type* d_params,
                                       const Scalar* d_rcutsq,
                                       const Scalar* d_ronsq,
@@ -209,14 +326,15 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         active = false;
         }
 
-    // initialize the force to 0
-    Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
-    Scalar virialxx = Scalar(0.0);
-    Scalar virialxy = Scalar(0.0);
-    Scalar virialxz = Scalar(0.0);
-    Scalar virialyy = Scalar(0.0);
-    Scalar virialyz = Scalar(0.0);
-    Scalar virialzz = Scalar(0.0);
+    // initialize the force to 0, accumulate in AccumReal precision
+    AccumReal4 force
+        = make_accumreal4(AccumReal(0.0), AccumReal(0.0), AccumReal(0.0), AccumReal(0.0));
+    AccumReal virialxx = AccumReal(0.0);
+    AccumReal virialxy = AccumReal(0.0);
+    AccumReal virialxz = AccumReal(0.0);
+    AccumReal virialyy = AccumReal(0.0);
+    AccumReal virialyz = AccumReal(0.0);
+    AccumReal virialzz = AccumReal(0.0);
 
     if (active)
         {
@@ -235,7 +353,9 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         unsigned int cur_j = 0;
 
         unsigned int next_j(0);
-        next_j = threadIdx.x % tpp < n_neigh ? __ldg(d_nlist + my_head + threadIdx.x % tpp) : 0;
+        next_j = threadIdx.x % tpp < n_neigh
+                     ? loadNeighbor(idx, d_nlist, d_nlist_offsets, my_head + threadIdx.x % tpp)
+                     : 0;
 
         // loop over neighbors
         for (int neigh_idx = threadIdx.x % tpp; neigh_idx < n_neigh; neigh_idx += tpp)
@@ -245,25 +365,17 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                 cur_j = next_j;
                 if (neigh_idx + tpp < n_neigh)
                     {
-                    next_j = __ldg(d_nlist + my_head + neigh_idx + tpp);
+                    next_j = loadNeighbor(idx, d_nlist, d_nlist_offsets, my_head + neigh_idx + tpp);
                     }
+
+                // in half mode, the particle with the lower index evaluates each local pair
+                if (half && cur_j < idx)
+                    continue;
+
                 // get the neighbor's position
                 Scalar4 postypej = __ldg(d_pos + cur_j);
                 Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
 
-                Scalar qj = Scalar(0.0);
-                if (evaluator::needsCharge())
-                    qj = __ldg(d_charge + cur_j);
-
-                // calculate dr (with periodic boundary conditions)
-                Scalar3 dx = posi - posj;
-
-                // apply periodic boundary conditions
-                dx = box.minImage(dx);
-
-                // calculate r squared
-                Scalar rsq = dot(dx, dx);
-
                 // access the per type pair parameters
                 unsigned int typpair
                     = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
@@ -288,63 +400,54 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                         ronsq = d_ronsq[typpair];
                     }
 
-                // design specifies that energies are shifted if
-                // 1) shift mode is set to shift
-                // or 2) shift mode is explor and ron > rcut
-                bool energy_shift = false;
-                if (shift_mode == 1)
-                    energy_shift = true;
-                else if (shift_mode == 2)
-                    {
-                    if (ronsq > rcutsq)
-                        energy_shift = true;
-                    }
+                // skip the type pairs that do not interact before reading the rest of the neighbor
+                if (rcutsq <= Scalar(0.0))
+                    continue;
+
+                Scalar qj = Scalar(0.0);
+                if (evaluator::needsCharge())
+                    qj = __ldg(d_charge + cur_j);
+
+                // calculate dr (with periodic boundary conditions)
+                Scalar3 dx = posi - posj;
+
+                // apply periodic boundary conditions
+                dx = box.minImage<orthorhombic>(dx);
+
+                // calculate r squared
+                Scalar rsq = dot(dx, dx);
 
                 // evaluate the potential
                 Scalar force_divr = Scalar(0.0);
                 Scalar pair_eng = Scalar(0.0);
+                evaluate_pair_force<evaluator, shift_mode>(rsq,
+                                                           rcutsq,
+                                                           ronsq,
+                                                           *param,
+                                                           qi,
+                                                           qj,
+                                                           force_divr,
+                                                           pair_eng);
 
-                evaluator eval(rsq, rcutsq, *param);
-                if (evaluator::needsCharge())
-                    eval.setCharge(qi, qj);
-
-                eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
-
-                if (shift_mode == 2)
-                    {
-                    if (rsq >= ronsq && rsq < rcutsq)
-                        {
-                        // Implement XPLOR smoothing
-                        Scalar old_pair_eng = pair_eng;
-                        Scalar old_force_divr = force_divr;
-
-                        // calculate 1.0 / (xplor denominator)
-                        Scalar xplor_denom_inv
-                            = Scalar(1.0)
-                              / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
-
-                        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
-                        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
-                                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
-                                   * xplor_denom_inv;
-                        Scalar ds_dr_divr
-                            = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
-
-                        // make modifications to the old pair energy and force
-                        pair_eng = old_pair_eng * s;
-                        force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
-                        }
-                    }
                 // calculate the virial
                 if (compute_virial)
                     {
                     Scalar force_div2r = Scalar(0.5) * force_divr;
-                    virialxx += dx.x * dx.x * force_div2r;
-                    virialxy += dx.x * dx.y * force_div2r;
-                    virialxz += dx.x * dx.z * force_div2r;
-                    virialyy += dx.y * dx.y * force_div2r;
-                    virialyz += dx.y * dx.z * force_div2r;
-                    virialzz += dx.z * dx.z * force_div2r;
+                    Scalar pair_virial[6] = {dx.x * dx.x * force_div2r,
+                                             dx.x * dx.y * force_div2r,
+                                             dx.x * dx.z * force_div2r,
+                                             dx.y * dx.y * force_div2r,
+                                             dx.y * dx.z * force_div2r,
+                                             dx.z * dx.z * force_div2r};
+                    virialxx += pair_virial[0];
+                    virialxy += pair_virial[1];
+                    virialxz += pair_virial[2];
+                    virialyy += pair_virial[3];
+                    virialyz += pair_virial[4];
+                    virialzz += pair_virial[5];
+
+                    if (half && cur_j < N)
+                        atomic_add_virial(d_virial + cur_j, virial_pitch, pair_virial);
                     }
 
                 // add up the force vector components
@@ -353,15 +456,25 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                 force.z += dx.z * force_divr;
 
                 force.w += pair_eng;
+
+                // scatter the reaction to the local neighbor
+                if (half && cur_j < N)
+                    {
+                    atomic_add_force(d_force + cur_j,
+                                     make_scalar4(-dx.x * force_divr,
+                                                  -dx.y * force_divr,
+                                                  -dx.z * force_divr,
+                                                  Scalar(0.5) * pair_eng));
+                    }
                 }
             }
 
         // potential energy per particle must be halved
-        force.w *= Scalar(0.5);
+        force.w *= AccumReal(0.5);
         }
 
     // reduce force over threads in cta
-    hoomd::detail::WarpReduce<Scalar, tpp> reducer;
+    hoomd::detail::WarpReduce<AccumReal, tpp> reducer;
     force.x = reducer.Sum(force.x);
     force.y = reducer.Sum(force.y);
     force.z = reducer.Sum(force.z);
@@ -369,7 +482,16 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
 
     // now that the force calculation is complete, write out the result
     if (active && threadIdx.x % tpp == 0)
-        d_force[idx] = force;
+        {
+        Scalar4 total_force = make_scalar4(Scalar(force.x),
+                                           Scalar(force.y),
+                                           Scalar(force.z),
+                                           Scalar(force.w));
+        if (half)
+            atomic_add_force(d_force + idx, total_force);
+        else
+            d_force[idx] = total_force;
+        }
 
     if (compute_virial)
         {
@@ -381,16 +503,267 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         virialzz = reducer.Sum(virialzz);
 
         // if we are the first thread in the cta, write out virial to global mem
-        if (active && threadIdx.x % tpp == 0)
+        if (active && threadIdx.x % tpp == 0 && half)
+            {
+            Scalar virial[6] = {Scalar(virialxx),
+                                Scalar(virialxy),
+                                Scalar(virialxz),
+                                Scalar(virialyy),
+                                Scalar(virialyz),
+                                Scalar(virialzz)};
+            atomic_add_virial(d_virial + idx, virial_pitch, virial);
+            }
+        else if (active && threadIdx.x % tpp == 0)
+            {
+            d_virial[0 * virial_pitch + idx] = Scalar(virialxx);
+            d_virial[1 * virial_pitch + idx] = Scalar(virialxy);
+            d_virial[2 * virial_pitch + idx] = Scalar(virialxz);
+            d_virial[3 * virial_pitch + idx] = Scalar(virialyy);
+            d_virial[4 * virial_pitch + idx] = Scalar(virialyz);
+            d_virial[5 * virial_pitch + idx] = Scalar(virialzz);
+            }
+        }
+    }
+
+//! Kernel for calculating pair forces from the cluster pair list
+/*! \param d_force Device memory to write computed forces
+    \param d_virial Device memory to write computed virials
+    \param virial_pitch pitch of 2D virial array
+    \param N number of particles in system
+    \param d_pos particle positions
+    \param d_charge particle charges
+    \param box Box dimensions used to implement periodic boundary conditions
+    \param d_cluster_n_neigh Number of j clusters of each i cluster
+    \param d_cluster_nlist j clusters of each i cluster
+    \param d_cluster_mask Masks of the neighboring pairs in each cluster pair
+    \param d_head_list Indexes for reading the cluster pair list
+    \param d_params Parameters for the potential, stored per type pair
+    \param d_rcutsq rcut squared, stored per type pair
+    \param d_ronsq ron squared, stored per type pair
+    \param ntypes Number of types in the simulation
+    \param max_extra_bytes Maximum number of extra bytes of shared memory for the parameters
+
+    The template parameters and shared memory layout follow gpu_compute_pair_forces_shared_kernel().
+
+    <b>Implementation details</b>
+    Each thread computes the force on one particle, and the NLIST_CLUSTER_SIZE threads of an i
+    cluster form a fragment of a warp. The fragment walks the j clusters of the i cluster together,
+    so all of its threads run the same number of iterations and read the same j cluster entry and
+    j particle positions at the same time. The j cluster occupies consecutive entries of \a d_pos,
+    so each cluster pair loads one contiguous block of positions that serves the whole fragment.
+    Each thread evaluates the pairs set in its row of the cluster pair mask.
+*/
+template<class evaluator,
+         unsigned int shift_mode,
+         unsigned int compute_virial,
+         bool enable_shared_cache>
+__global__ void
+gpu_compute_pair_forces_cluster_kernel(Scalar4* d_force,
+                                       Scalar* d_virial,
+                                       const size_t virial_pitch,
+                                       const unsigned int N,
+                                       const Scalar4* d_pos,
+                                       const Scalar* d_charge,
+                                       const BoxDim box,
+                                       const unsigned int* d_cluster_n_neigh,
+                                       const unsigned int* d_cluster_nlist,
+                                       const uint64_t* d_cluster_mask,
+                                       const size_t* d_head_list,
+                                       const typename evaluator::param_type* d_params,
+                                       const Scalar* d_rcutsq,
+                                       const Scalar* d_ronsq,
+                                       const unsigned int ntypes,
+                                       unsigned int max_extra_bytes)
+    {
+    Index2D typpair_idx(ntypes);
+    const unsigned int num_typ_parameters = typpair_idx.getNumElements();
+
+    // shared arrays for per type pair parameters
+    HIP_DYNAMIC_SHARED(char, s_data)
+    typename evaluator::param_type* s_params = (typename evaluator::param_type*)(&s_data[0]);
+    Scalar* s_rcutsq
+        = (Scalar*)(&s_data[num_typ_parameters * sizeof(typename evaluator::param_type)]);
+    Scalar* s_ronsq
+        = (Scalar*)(&s_data[num_typ_parameters
+                            * (sizeof(typename evaluator::param_type) + sizeof(Scalar))]);
+    auto s_extra = reinterpret_cast<char*>(s_ronsq + num_typ_parameters);
+
+    if (enable_shared_cache)
+        {
+        // load in the per type pair parameters
+        for (unsigned int cur_offset = 0; cur_offset < num_typ_parameters; cur_offset += blockDim.x)
+            {
+            if (cur_offset + threadIdx.x < num_typ_parameters)
+                {
+                s_rcutsq[cur_offset + threadIdx.x] = d_rcutsq[cur_offset + threadIdx.x];
+                if (shift_mode == 2)
+                    s_ronsq[cur_offset + threadIdx.x] = d_ronsq[cur_offset + threadIdx.x];
+                }
+            }
+
+        unsigned int param_size
+            = num_typ_parameters * sizeof(typename evaluator::param_type) / sizeof(int);
+        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += blockDim.x)
+            {
+            if (cur_offset + threadIdx.x < param_size)
+                {
+                ((int*)s_params)[cur_offset + threadIdx.x]
+                    = ((int*)d_params)[cur_offset + threadIdx.x];
+                }
+            }
+
+        __syncthreads();
+
+        // initialize extra shared mem
+        unsigned int available_bytes = max_extra_bytes;
+        for (unsigned int cur_pair = 0; cur_pair < num_typ_parameters; ++cur_pair)
+            s_params[cur_pair].load_shared(s_extra, available_bytes);
+
+        __syncthreads();
+        }
+
+    // there are no further block level synchronizations, so inactive threads may quit now
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const unsigned int cluster_i = idx / NLIST_CLUSTER_SIZE;
+    const unsigned int a = idx % NLIST_CLUSTER_SIZE;
+
+    // initialize the force to 0, accumulate in AccumReal precision
+    AccumReal4 force
+        = make_accumreal4(AccumReal(0.0), AccumReal(0.0), AccumReal(0.0), AccumReal(0.0));
+    AccumReal virialxx = AccumReal(0.0);
+    AccumReal virialxy = AccumReal(0.0);
+    AccumReal virialxz = AccumReal(0.0);
+    AccumReal virialyy = AccumReal(0.0);
+    AccumReal virialyz = AccumReal(0.0);
+    AccumReal virialzz = AccumReal(0.0);
+
+    // read in the position of our particle.
+    Scalar4 postypei = __ldg(d_pos + idx);
+    Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+
+    Scalar qi = Scalar(0);
+    if (evaluator::needsCharge())
+        qi = __ldg(d_charge + idx);
+
+    const unsigned int n_cluster_neigh = d_cluster_n_neigh[cluster_i];
+    const size_t cluster_head = d_head_list[cluster_i * NLIST_CLUSTER_SIZE];
+    const unsigned int row_mask = (1u << NLIST_CLUSTER_SIZE) - 1;
+
+    // loop over the j clusters
+    for (unsigned int cur_cluster = 0; cur_cluster < n_cluster_neigh; cur_cluster++)
+        {
+        const unsigned int cluster_j = __ldg(d_cluster_nlist + cluster_head + cur_cluster);
+
+        // the row of the mask that holds the neighbors of this particle
+        const unsigned int row
+            = (unsigned int)(__ldg(d_cluster_mask + cluster_head + cur_cluster)
+                             >> (a * NLIST_CLUSTER_SIZE))
+              & row_mask;
+
+#pragma unroll
+        for (unsigned int b = 0; b < NLIST_CLUSTER_SIZE; b++)
             {
-            d_virial[0 * virial_pitch + idx] = virialxx;
-            d_virial[1 * virial_pitch + idx] = virialxy;
-            d_virial[2 * virial_pitch + idx] = virialxz;
-            d_virial[3 * virial_pitch + idx] = virialyy;
-            d_virial[4 * virial_pitch + idx] = virialyz;
-            d_virial[5 * virial_pitch + idx] = virialzz;
+            if (!(row & (1u << b)))
+                continue;
+
+            const unsigned int cur_j = cluster_j * NLIST_CLUSTER_SIZE + b;
+
+            // get the neighbor's position
+            Scalar4 postypej = __ldg(d_pos + cur_j);
+            Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+
+            // access the per type pair parameters
+            unsigned int typpair
+                = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
+            Scalar rcutsq;
+            const typename evaluator::param_type* param = nullptr;
+            Scalar ronsq = Scalar(0.0);
+
+            if (enable_shared_cache)
+                {
+                rcutsq = s_rcutsq[typpair];
+                param = s_params + typpair;
+
+                if (shift_mode == 2)
+                    ronsq = s_ronsq[typpair];
+                }
+            else
+                {
+                rcutsq = d_rcutsq[typpair];
+                param = d_params + typpair;
+
+                if (shift_mode == 2)
+                    ronsq = d_ronsq[typpair];
+                }
+
+            // skip the type pairs that do not interact before reading the rest of the neighbor
+            if (rcutsq <= Scalar(0.0))
+                continue;
+
+            Scalar qj = Scalar(0.0);
+            if (evaluator::needsCharge())
+                qj = __ldg(d_charge + cur_j);
+
+            // calculate dr (with periodic boundary conditions)
+            Scalar3 dx = posi - posj;
+
+            // apply periodic boundary conditions
+            dx = box.minImage(dx);
+
+            // calculate r squared
+            Scalar rsq = dot(dx, dx);
+
+            // evaluate the potential
+            Scalar force_divr = Scalar(0.0);
+            Scalar pair_eng = Scalar(0.0);
+            evaluate_pair_force<evaluator, shift_mode>(rsq,
+                                                       rcutsq,
+                                                       ronsq,
+                                                       *param,
+                                                       qi,
+                                                       qj,
+                                                       force_divr,
+                                                       pair_eng);
+
+            // calculate the virial
+            if (compute_virial)
+                {
+                Scalar force_div2r = Scalar(0.5) * force_divr;
+                virialxx += dx.x * dx.x * force_div2r;
+                virialxy += dx.x * dx.y * force_div2r;
+                virialxz += dx.x * dx.z * force_div2r;
+                virialyy += dx.y * dx.y * force_div2r;
+                virialyz += dx.y * dx.z * force_div2r;
+                virialzz += dx.z * dx.z * force_div2r;
+                }
+
+            // add up the force vector components
+            force.x += dx.x * force_divr;
+            force.y += dx.y * force_divr;
+            force.z += dx.z * force_divr;
+
+            force.w += pair_eng;
             }
         }
+
+    // potential energy per particle must be halved
+    force.w *= AccumReal(0.5);
+
+    d_force[idx]
+        = make_scalar4(Scalar(force.x), Scalar(force.y), Scalar(force.z), Scalar(force.w));
+
+    if (compute_virial)
+        {
+        d_virial[0 * virial_pitch + idx] = Scalar(virialxx);
+        d_virial[1 * virial_pitch + idx] = Scalar(virialxy);
+        d_virial[2 * virial_pitch + idx] = Scalar(virialxz);
+        d_virial[3 * virial_pitch + idx] = Scalar(virialyy);
+        d_virial[4 * virial_pitch + idx] = Scalar(virialyz);
+        d_virial[5 * virial_pitch + idx] = Scalar(virialzz);
+        }
     }
 
 template<typename T> int get_max_block_size(T func)
@@ -409,13 +782,19 @@ template<typename T> int get_max_block_size(T func)
  * \tparam shift_mode 0: No energy shifting is done. 1: V(r) is shifted to be 0 at rcut. 2: XPLOR
  * switching is enabled (See PotentialPair for a discussion on what that entails) \tparam
  * compute_virial When non-zero, the virial tensor is computed. When zero, the virial tensor is not
- * computed. \tparam tpp Number of threads to use per particle, must be power of 2 and smaller than
- * warp size
+ * computed. \tparam half Evaluate each local pair once (see gpu_compute_pair_forces_shared_kernel)
+ * \tparam orthorhombic The box has no tilt (see gpu_compute_pair_forces_shared_kernel)
+ * \tparam tpp Number of threads to use per particle, must be power of 2 and smaller than warp size
  *
  * Partial function template specialization is not allowed in C++, so instead we have to wrap this
  * with a struct that we are allowed to partially specialize.
  */
-template<class evaluator, unsigned int shift_mode, unsigned int compute_virial, int tpp>
+template<class evaluator,
+         unsigned int shift_mode,
+         unsigned int compute_virial,
+         bool half,
+         bool orthorhombic,
+         int tpp>
 struct PairForceComputeKernel
     {
     //! Launcher for the pair force kernel
@@ -444,6 +823,8 @@ struct PairForceComputeKernel
                 = get_max_block_size(gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                            shift_mode,
                                                                            compute_virial,
+                                                                           half,
+                                                                           orthorhombic,
                                                                            tpp,
                                                                            true>);
 
@@ -453,6 +834,8 @@ struct PairForceComputeKernel
                 reinterpret_cast<const void*>(&gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                                      shift_mode,
                                                                                      compute_virial,
+                                                                                     half,
+                                                                                     orthorhombic,
                                                                                      tpp,
                                                                                      true>));
 
@@ -483,6 +866,8 @@ struct PairForceComputeKernel
                 hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                           shift_mode,
                                                                           compute_virial,
+                                                                          half,
+                                                                          orthorhombic,
                                                                           tpp,
                                                                           true>),
                                    dim3(grid),
@@ -499,6 +884,7 @@ struct PairForceComputeKernel
                                    pair_args.d_n_neigh,
                                    pair_args.d_nlist,
                                    pair_args.d_head_list,
+                                   pair_args.d_nlist_offsets,
                                    d_params,
                                    pair_args.d_rcutsq,
                                    pair_args.d_ronsq,
@@ -510,6 +896,8 @@ struct PairForceComputeKernel
                 hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
                                                                           shift_mode,
                                                                           compute_virial,
+                                                                          half,
+                                                                          orthorhombic,
                                                                           tpp,
                                                                           false>),
                                    dim3(grid),
@@ -526,6 +914,7 @@ struct PairForceComputeKernel
                                    pair_args.d_n_neigh,
                                    pair_args.d_nlist,
                                    pair_args.d_head_list,
+                                   pair_args.d_nlist_offsets,
                                    d_params,
                                    pair_args.d_rcutsq,
                                    pair_args.d_ronsq,
@@ -535,17 +924,129 @@ struct PairForceComputeKernel
             }
         else
             {
-            PairForceComputeKernel<evaluator, shift_mode, compute_virial, tpp / 2>::launch(
-                pair_args,
-                N,
-                d_params);
+            PairForceComputeKernel<evaluator,
+                                   shift_mode,
+                                   compute_virial,
+                                   half,
+                                   orthorhombic,
+                                   tpp / 2>::launch(pair_args, N, d_params);
             }
         }
     };
 
-//! Template specialization to do nothing for the tpp = 0 case
+//! Cluster pair force compute kernel launcher
+/*!
+ * \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r
+ * \tparam shift_mode Energy shift mode, see PairForceComputeKernel
+ * \tparam compute_virial When non-zero, the virial tensor is computed
+ *
+ * \param pair_args Other arguments to pass onto the kernel
+ * \param d_params Parameters for the potential, stored per type pair
+ */
 template<class evaluator, unsigned int shift_mode, unsigned int compute_virial>
-struct PairForceComputeKernel<evaluator, shift_mode, compute_virial, 0>
+void launch_pair_forces_cluster(const pair_args_t& pair_args,
+                                const typename evaluator::param_type* d_params)
+    {
+    unsigned int block_size = pair_args.block_size;
+    bool enable_shared_cache = true;
+
+    Index2D typpair_idx(pair_args.ntypes);
+    size_t param_shared_bytes = (2 * sizeof(Scalar) + sizeof(typename evaluator::param_type))
+                                * typpair_idx.getNumElements();
+
+    unsigned int max_block_size;
+    max_block_size = get_max_block_size(
+        gpu_compute_pair_forces_cluster_kernel<evaluator, shift_mode, compute_virial, true>);
+
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(
+        &attr,
+        reinterpret_cast<const void*>(
+            &gpu_compute_pair_forces_cluster_kernel<evaluator, shift_mode, compute_virial, true>));
+
+    if (param_shared_bytes + attr.sharedSizeBytes > pair_args.devprop.sharedMemPerBlock)
+        {
+        param_shared_bytes = 0;
+        enable_shared_cache = false;
+        }
+
+    unsigned int max_extra_bytes = static_cast<unsigned int>(pair_args.devprop.sharedMemPerBlock
+                                                             - param_shared_bytes
+                                                             - attr.sharedSizeBytes);
+
+    // determine dynamically requested shared memory in nested managed arrays
+    char* ptr = nullptr;
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int i = 0; i < typpair_idx.getNumElements(); ++i)
+        {
+        d_params[i].allocate_shared(ptr, available_bytes);
+        }
+
+    unsigned int extra_shared_bytes = max_extra_bytes - available_bytes;
+
+    // the block size is a multiple of the warp size, so i clusters never span two blocks
+    block_size = block_size < max_block_size ? block_size : max_block_size;
+    dim3 grid(pair_args.N / block_size + 1, 1, 1);
+
+    if (enable_shared_cache)
+        {
+        hipLaunchKernelGGL(
+            (gpu_compute_pair_forces_cluster_kernel<evaluator, shift_mode, compute_virial, true>),
+            dim3(grid),
+            dim3(block_size),
+            param_shared_bytes + extra_shared_bytes,
+            0,
+            pair_args.d_force,
+            pair_args.d_virial,
+            pair_args.virial_pitch,
+            pair_args.N,
+            pair_args.d_pos,
+            pair_args.d_charge,
+            pair_args.box,
+            pair_args.d_cluster_n_neigh,
+            pair_args.d_cluster_nlist,
+            pair_args.d_cluster_mask,
+            pair_args.d_head_list,
+            d_params,
+            pair_args.d_rcutsq,
+            pair_args.d_ronsq,
+            pair_args.ntypes,
+            max_extra_bytes);
+        }
+    else
+        {
+        hipLaunchKernelGGL(
+            (gpu_compute_pair_forces_cluster_kernel<evaluator, shift_mode, compute_virial, false>),
+            dim3(grid),
+            dim3(block_size),
+            param_shared_bytes + extra_shared_bytes,
+            0,
+            pair_args.d_force,
+            pair_args.d_virial,
+            pair_args.virial_pitch,
+            pair_args.N,
+            pair_args.d_pos,
+            pair_args.d_charge,
+            pair_args.box,
+            pair_args.d_cluster_n_neigh,
+            pair_args.d_cluster_nlist,
+            pair_args.d_cluster_mask,
+            pair_args.d_head_list,
+            d_params,
+            pair_args.d_rcutsq,
+            pair_args.d_ronsq,
+            pair_args.ntypes,
+            max_extra_bytes);
+        }
+    }
+
+//! Template specialization to do nothing for the tpp = 0 case
+template<class evaluator,
+         unsigned int shift_mode,
+         unsigned int compute_virial,
+         bool half,
+         bool orthorhombic>
+struct PairForceComputeKernel<evaluator, shift_mode, compute_virial, half, orthorhombic, 0>
     {
     static void launch(const pair_args_t& pair_args,
                        unsigned int N,
@@ -555,6 +1056,63 @@ struct PairForceComputeKernel<evaluator, shift_mode, compute_virial, 0>
         }
     };
 
+//! Pair force compute kernel launcher for the box type
+/*!
+ * \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r
+ * \tparam shift_mode Energy shift mode, see PairForceComputeKernel
+ * \tparam compute_virial When non-zero, the virial tensor is computed
+ * \tparam half Evaluate each local pair once, see PairForceComputeKernel
+ *
+ * \param pair_args Other arguments to pass onto the kernel
+ * \param d_params Parameters for the potential, stored per type pair
+ *
+ * The orthorhombic kernel has no tilt factor arithmetic in the minimum image.
+ */
+template<class evaluator, unsigned int shift_mode, unsigned int compute_virial, bool half>
+void launch_pair_forces_box(const pair_args_t& pair_args,
+                            const typename evaluator::param_type* d_params)
+    {
+    if (pair_args.box.isOrthorhombic())
+        {
+        PairForceComputeKernel<evaluator,
+                               shift_mode,
+                               compute_virial,
+                               half,
+                               true,
+                               gpu_pair_force_max_tpp>::launch(pair_args, pair_args.N, d_params);
+        }
+    else
+        {
+        PairForceComputeKernel<evaluator,
+                               shift_mode,
+                               compute_virial,
+                               half,
+                               false,
+                               gpu_pair_force_max_tpp>::launch(pair_args, pair_args.N, d_params);
+        }
+    }
+
+//! Pair force compute kernel launcher for the neighbor list storage mode
+/*!
+ * \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r
+ * \tparam shift_mode Energy shift mode, see PairForceComputeKernel
+ * \tparam compute_virial When non-zero, the virial tensor is computed
+ *
+ * \param pair_args Other arguments to pass onto the kernel
+ * \param d_params Parameters for the potential, stored per type pair
+ *
+ * The full neighbor list kernel has no atomics or reaction terms compiled in.
+ */
+template<class evaluator, unsigned int shift_mode, unsigned int compute_virial>
+void launch_pair_forces(const pair_args_t& pair_args,
+                        const typename evaluator::param_type* d_params)
+    {
+    if (pair_args.half)
+        launch_pair_forces_box<evaluator, shift_mode, compute_virial, true>(pair_args, d_params);
+    else
+        launch_pair_forces_box<evaluator, shift_mode, compute_virial, false>(pair_args, d_params);
+    }
+
 //! Kernel driver that computes lj forces on the GPU for LJForceComputeGPU
 /*! \param pair_args Other arguments to pass onto the kernel
     \param d_params Parameters for the potential, stored per type pair
@@ -571,32 +1129,75 @@ gpu_compute_pair_forces(const pair_args_t& pair_args,
     assert(pair_args.d_ronsq);
     assert(pair_args.ntypes > 0);
 
+    // Launch the cluster pair kernel when the neighbor list provides cluster pairs
+    if (pair_args.d_cluster_n_neigh)
+        {
+        if (pair_args.compute_virial)
+            {
+            switch (pair_args.shift_mode)
+                {
+            case 0:
+                launch_pair_forces_cluster<evaluator, 0, 1>(pair_args, d_params);
+                break;
+            case 1:
+                launch_pair_forces_cluster<evaluator, 1, 1>(pair_args, d_params);
+                break;
+            case 2:
+                launch_pair_forces_cluster<evaluator, 2, 1>(pair_args, d_params);
+                break;
+            default:
+                break;
+                }
+            }
+        else
+            {
+            switch (pair_args.shift_mode)
+                {
+            case 0:
+                launch_pair_forces_cluster<evaluator, 0, 0>(pair_args, d_params);
+                break;
+            case 1:
+                launch_pair_forces_cluster<evaluator, 1, 0>(pair_args, d_params);
+                break;
+            case 2:
+                launch_pair_forces_cluster<evaluator, 2, 0>(pair_args, d_params);
+                break;
+            default:
+                break;
+                }
+            }
+        return hipSuccess;
+        }
+
+    // in half mode, the kernel accumulates into the force and virial arrays
+    if (pair_args.half)
+        {
+        hipMemsetAsync(pair_args.d_force, 0, sizeof(Scalar4) * pair_args.N);
+        if (pair_args.compute_virial)
+            {
+            for (unsigned int i = 0; i < 6; i++)
+                {
+                hipMemsetAsync(pair_args.d_virial + i * pair_args.virial_pitch,
+                               0,
+                               sizeof(Scalar) * pair_args.N);
+                }
+            }
+        }
+
     // Launch kernel
     if (pair_args.compute_virial)
         {
         switch (pair_args.shift_mode)
             {
         case 0:
-            {
-            PairForceComputeKernel<evaluator, 0, 1, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                    pair_args.N,
-                                                                                    d_params);
+            launch_pair_forces<evaluator, 0, 1>(pair_args, d_params);
             break;
-            }
         case 1:
-            {
-            PairForceComputeKernel<evaluator, 1, 1, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                    pair_args.N,
-                                                                                    d_params);
+            launch_pair_forces<evaluator, 1, 1>(pair_args, d_params);
             break;
-            }
         case 2:
-            {
-            PairForceComputeKernel<evaluator, 2, 1, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                    pair_args.N,
-                                                                                    d_params);
+            launch_pair_forces<evaluator, 2, 1>(pair_args, d_params);
             break;
-            }
         default:
             break;
             }
@@ -606,26 +1207,14 @@ gpu_compute_pair_forces(const pair_args_t& pair_args,
         switch (pair_args.shift_mode)
             {
         case 0:
-            {
-            PairForceComputeKernel<evaluator, 0, 0, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                    pair_args.N,
-                                                                                    d_params);
+            launch_pair_forces<evaluator, 0, 0>(pair_args, d_params);
             break;
-            }
         case 1:
-            {
-            PairForceComputeKernel<evaluator, 1, 0, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                    pair_args.N,
-                                                                                    d_params);
+            launch_pair_forces<evaluator, 1, 0>(pair_args, d_params);
             break;
-            }
         case 2:
-            {
-            PairForceComputeKernel<evaluator, 2, 0, gpu_pair_force_max_tpp>::launch(pair_args,
-                                                                                    pair_args.N,
-                                                                                    d_params);
+            launch_pair_forces<evaluator, 2, 0>(pair_args, d_params);
             break;
-            }
         default:
             break;
             }
@@ -39,6 +39,12 @@ namespace md
    function to call gpu_compute_pair_forces() instantiated with the same evaluator. (See
    PotentialPairLJGPU.cu and PotentialPairLJGPU.cuh for an example).
 
+    The autotuner also chooses between two ways to read the full neighbor list. In full mode, each
+    particle evaluates all of its pairs and writes its own force. In half mode, each pair of local
+    particles is evaluated once by the particle with the lower index, which scatters the reaction
+    force, energy, and virial to the other particle with atomic adds. Half mode is faster for
+    expensive evaluators and on devices with fast atomics.
+
     \tparam evaluator EvaluatorPair class used to evaluate V(r) and F(r)/r
 
     \sa export_PotentialPairGPU()
@@ -52,10 +58,19 @@ template<class evaluator> class PotentialPairGPU : public PotentialPair<evaluato
     virtual ~PotentialPairGPU() { }
 
     protected:
-    std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
+    /// Autotuner for block size, threads per particle, and half mode
+    std::shared_ptr<Autotuner<3>> m_tuner;
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
+
+#ifdef ENABLE_MPI
+    //! The GPU kernel has no interior pass, it computes all particles in one launch
+    virtual bool computeInteriorForces(uint64_t timestep)
+        {
+        return false;
+        }
+#endif
     };
 
 template<class evaluator>
@@ -73,11 +88,15 @@ PotentialPairGPU<evaluator>::PotentialPairGPU(std::shared_ptr<SystemDefinition>
         }
 
     // Initialize autotuner.
-    m_tuner.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
-                                    AutotunerBase::getTppListPow2(this->m_exec_conf)},
+    m_tuner.reset(new Autotuner<3>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                                    AutotunerBase::getTppListPow2(this->m_exec_conf),
+                                    {0, 1}},
                                    this->m_exec_conf,
                                    "pair_" + evaluator::getName()));
 
+    // Coordinate descent avoids sampling every combination in the 3 dimensional parameter space.
+    m_tuner->setSearch(Autotuner<3>::search_coordinate_descent);
+
     this->m_autotuners.push_back(m_tuner);
 
 #ifdef ENABLE_MPI
@@ -101,7 +120,7 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
             }
 
         // access the neighbor list
-        ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+        ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(this->m_r_cut_nlist),
                                             access_location::device,
                                             access_mode::read);
         ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
@@ -110,6 +129,20 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
         ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
                                         access_location::device,
                                         access_mode::read);
+        ArrayHandle<int16_t> d_nlist_offsets(this->m_nlist->getNListOffsets(),
+                                             access_location::device,
+                                             access_mode::read);
+
+        // the cluster pair arrays are null unless the neighbor list builds cluster pairs
+        ArrayHandle<unsigned int> d_cluster_n_neigh(this->m_nlist->getClusterNNeighArray(),
+                                                    access_location::device,
+                                                    access_mode::read);
+        ArrayHandle<unsigned int> d_cluster_nlist(this->m_nlist->getClusterNListArray(),
+                                                  access_location::device,
+                                                  access_mode::read);
+        ArrayHandle<uint64_t> d_cluster_mask(this->m_nlist->getClusterMaskArray(),
+                                             access_location::device,
+                                             access_mode::read);
 
         // access the particle data
         ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
@@ -140,6 +173,7 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
         auto param = m_tuner->getParam();
         unsigned int block_size = param[0];
         unsigned int threads_per_particle = param[1];
+        bool half = param[2];
 
         kernel::gpu_compute_pair_forces<evaluator>(
             kernel::pair_args_t(d_force.data,
@@ -161,7 +195,12 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
                                 this->m_shift_mode,
                                 flags[pdata_flag::pressure_tensor],
                                 threads_per_particle,
-                                this->m_exec_conf->dev_prop),
+                                this->m_exec_conf->dev_prop,
+                                d_nlist_offsets.data,
+                                d_cluster_n_neigh.data,
+                                d_cluster_nlist.data,
+                                d_cluster_mask.data,
+                                half),
             this->m_params.data());
 
         if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -8,6 +8,8 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
@@ -135,8 +137,27 @@ template<class evaluator> class PotentialTersoff : public ForceCompute
     // r_cut (not squared) given to the neighborlist
     std::shared_ptr<GPUArray<Scalar>> m_r_cut_nlist;
 
-    // scratch pad memory per type
-    std::vector<Scalar> m_phi_ab;
+    //! Cached quantities of one neighbor of the current particle
+    struct NeighborCache
+        {
+        Scalar3 dx;               //!< Minimum image separation r_i - r_j
+        Scalar rsq;               //!< Squared distance
+        unsigned int idx;         //!< Index of the neighbor
+        unsigned int type;        //!< Type of the neighbor
+        unsigned int typpair_idx; //!< Index of the (i, j) type pair
+        };
+
+    /// Per-thread neighbor caches of the current particle
+    std::vector<std::vector<NeighborCache>> m_thread_neigh_cache;
+
+    /// Per-thread scratch pad memory per type
+    std::vector<std::vector<Scalar>> m_thread_phi_ab;
+
+    /// Per-thread force accumulators (threads 1..n-1)
+    std::vector<std::vector<Scalar4>> m_thread_force;
+
+    /// Per-thread virial accumulators (threads 1..n-1)
+    std::vector<std::vector<Scalar>> m_thread_virial;
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
@@ -148,8 +169,7 @@ template<class evaluator> class PotentialTersoff : public ForceCompute
 template<class evaluator>
 PotentialTersoff<evaluator>::PotentialTersoff(std::shared_ptr<SystemDefinition> sysdef,
                                               std::shared_ptr<NeighborList> nlist)
-    : ForceCompute(sysdef), m_nlist(nlist), m_typpair_idx(m_pdata->getNTypes()),
-      m_phi_ab(m_pdata->getNTypes())
+    : ForceCompute(sysdef), m_nlist(nlist), m_typpair_idx(m_pdata->getNTypes())
     {
     this->m_exec_conf->msg->notice(5) << "Constructing PotentialTersoff" << std::endl;
 
@@ -271,66 +291,112 @@ template<class evaluator> Scalar PotentialTersoff<evaluator>::getRCut(pybind11::
 /*! \post The forces are computed for the given timestep. The neighborlist's compute method is
    called to ensure that it is up to date before proceeding.
 
+    The loop over particles runs in two stages. The first stage caches the minimum image separation,
+    squared distance, and type pair of every neighbor of particle i in a per-thread scratch list.
+    The second stage evaluates the pair and triplet terms from the cached values, so that the
+    O(n_neigh^2) triplet loops do not reload positions or apply the minimum image convention again.
+
+    Particles are split among the threads of the execution configuration's thread pool. Every
+    particle adds forces to its neighbors, so thread 0 accumulates into the output arrays and the
+    other threads accumulate into private buffers that are summed in thread order afterwards.
+
     \param timestep specifies the current time step of the simulation
 */
 template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64_t timestep)
     {
-    // *****  check if we need the structure of the Tersoff or the RevCross potential for evaluation
-    if (evaluator::flag_for_RevCross)
-        {
-        // ***** RevCross potential
-        // start by updating the neighborlist
-        m_nlist->compute(timestep);
+    // start by updating the neighborlist
+    m_nlist->compute(timestep);
 
-        // The three-body potentials can't handle a half neighbor list, so check now.
-        bool third_law = m_nlist->getStorageMode() == NeighborList::half;
-        if (third_law)
-            {
-            m_exec_conf->msg->error()
-                << std::endl
-                << "PotentialRevCross cannot handle a half neighborlist" << std::endl;
-            throw std::runtime_error("Error computing forces in PotentialRevCross");
-            }
+    // The three-body potentials can't handle a half neighbor list, so check now.
+    bool third_law = m_nlist->getStorageMode() == NeighborList::half;
+    if (third_law)
+        {
+        const std::string name
+            = evaluator::flag_for_RevCross ? "PotentialRevCross" : "PotentialTersoff";
+        m_exec_conf->msg->error()
+            << std::endl
+            << name << " cannot handle a half neighborlist" << std::endl;
+        throw std::runtime_error("Error computing forces in " + name);
+        }
 
-        // access the neighbor list, particle data, and system box
-        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
-                                            access_location::host,
-                                            access_mode::read);
-        ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
-                                          access_location::host,
-                                          access_mode::read);
-        ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+    // access the neighbor list, particle data, and system box
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
                                         access_location::host,
                                         access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
 
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
 
-        // force and virial arrays
-        ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    // force and virial arrays
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
 
-        PDataFlags flags = this->m_pdata->getFlags();
-        bool compute_virial = flags[pdata_flag::pressure_tensor];
+    PDataFlags flags = this->m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    const BoxDim box = m_pdata->getBox();
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+    ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
 
-        const BoxDim box = m_pdata->getBox();
-        ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
-        ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
+    const unsigned int N = m_pdata->getN() + m_pdata->getNGhosts();
 
-        // need to start from a zero force, energy
-        memset(h_force.data, 0, sizeof(Scalar4) * (m_pdata->getN() + m_pdata->getNGhosts()));
-        memset(h_virial.data, 0, sizeof(Scalar) * 6 * m_virial_pitch);
+    // need to start from a zero force, energy
+    memset(h_force.data, 0, sizeof(Scalar4) * N);
+    memset(h_virial.data, 0, sizeof(Scalar) * 6 * m_virial_pitch);
 
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
+    unsigned int ntypes = m_pdata->getNTypes();
+
+    // stage 1: cache the separation and type pair of every neighbor of particle i
+    auto cache_neighbors = [&](unsigned int i, std::vector<NeighborCache>& cache)
+        {
+        // access the particle's position and type (MEM TRANSFER: 4 scalars)
+        Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        const size_t head_i = h_head_list.data[i];
+        // sanity check
+        assert(typei < m_pdata->getNTypes());
+
+        const unsigned int size = (unsigned int)h_n_neigh.data[i];
+        cache.resize(size);
+        for (unsigned int j = 0; j < size; j++)
             {
-            // access the particle's position and type (MEM TRANSFER: 4 scalars)
-            Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-            const size_t head_i = h_head_list.data[i];
-            // sanity check
-            assert(typei < m_pdata->getNTypes());
+            // access the index of neighbor j (MEM TRANSFER: 1 scalar)
+            unsigned int jj = h_nlist.data[head_i + j];
+            assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
+
+            // access the position and type of particle j
+            Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
+            unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
+            assert(typej < m_pdata->getNTypes());
+
+            // calculate dr_ij and apply periodic boundary conditions
+            NeighborCache& neigh = cache[j];
+            neigh.dx = box.minImage(posi - posj);
+            neigh.rsq = dot(neigh.dx, neigh.dx);
+            neigh.idx = jj;
+            neigh.type = typej;
+            neigh.typpair_idx = m_typpair_idx(typei, typej);
+            }
+        };
+
+    // stage 2 for the RevCross potential
+    auto compute_revcross = [&](unsigned int thread_id,
+                                unsigned int begin,
+                                unsigned int end,
+                                Scalar4* force,
+                                Scalar* virial,
+                                size_t virial_pitch)
+        {
+        std::vector<NeighborCache>& cache = m_thread_neigh_cache[thread_id];
+
+        for (unsigned int i = begin; i < end; i++)
+            {
+            cache_neighbors(i, cache);
 
             // initialize current force and potential energy of particle i to 0
             Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
@@ -344,35 +410,20 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
             Scalar virializz(0.0);
 
             // loop over all of the neighbors of this particle
-            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            const unsigned int size = (unsigned int)cache.size();
             for (unsigned int j = 0; j < size; j++)
                 {
-                // access the index of neighbor j (MEM TRANSFER: 1 scalar)
-                unsigned int jj = h_nlist.data[head_i + j];
-                assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // access the position and type of particle j
-                Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-                unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-                assert(typej < m_pdata->getNTypes());
+                const NeighborCache& neigh_j = cache[j];
+                const Scalar3 dxij = neigh_j.dx;
+                const Scalar rij_sq = neigh_j.rsq;
 
                 // initialize the current force and potential energy of particle j to 0
                 Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
                 Scalar pej = 0.0;
 
-                // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 dxij = posi - posj;
-
-                // apply periodic boundary conditions
-                dxij = box.minImage(dxij);
-
-                // compute rij_sq (FLOPS: 5)
-                Scalar rij_sq = dot(dxij, dxij);
-
                 // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                const param_type& param = h_params.data[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
+                const param_type& param = h_params.data[neigh_j.typpair_idx];
+                Scalar rcutsq = h_rcutsq.data[neigh_j.typpair_idx];
 
                 // evaluate the base repulsive and attractive terms
                 Scalar invratio = 0.0;
@@ -386,7 +437,6 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                 // i, j and k could be different types)
                 if (evaluated)
                     {
-                    // printf("\nEvaluating the pair (i,j)=(%d, %d)  from inside HOOMD CPU",i,jj);
                     // evaluate the force and energy from the ij interaction
                     Scalar force_divr = Scalar(0.0);
                     Scalar potential_eng = Scalar(0.0);
@@ -422,28 +472,13 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                     for (unsigned int k = j + 1; k < size;
                          k++) // I want to account only a single time for each triplets
                         {
-                        // access the index of neighbor k
-                        unsigned int kk = h_nlist.data[head_i + k];
-                        assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
-
-                        // access the position and type of neighbor k
-                        Scalar3 posk
-                            = make_scalar3(h_pos.data[kk].x, h_pos.data[kk].y, h_pos.data[kk].z);
-                        unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                        assert(typek < m_pdata->getNTypes());
+                        const NeighborCache& neigh_k = cache[k];
+                        const Scalar3 dxik = neigh_k.dx;
+                        const Scalar rik_sq = neigh_k.rsq;
 
                         // access the type pair parameters for i and k
-                        typpair_idx = m_typpair_idx(typei, typek);
-                        param_type temp_param
-                            = h_params.data[typpair_idx]; // use this to control the species wich
-                                                          // have to interact
-
-                        // compute dr_ik
-                        Scalar3 dxik = posi - posk;
-                        // apply periodic boundary conditions
-                        dxik = box.minImage(dxik);
-                        // compute rik_sq
-                        Scalar rik_sq = dot(dxik, dxik);
+                        // use this to control the species wich have to interact
+                        const param_type& temp_param = h_params.data[neigh_k.typpair_idx];
 
                         // check if k interacts using a temporary evaluator to analyze i-k
                         // parameters
@@ -503,99 +538,59 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                                     }
 
                                 // increment the force for particle k
-                                unsigned int mem_idx = kk;
-                                h_force.data[mem_idx].x += fk.x;
-                                h_force.data[mem_idx].y += fk.y;
-                                h_force.data[mem_idx].z += fk.z;
+                                unsigned int mem_idx = neigh_k.idx;
+                                force[mem_idx].x += fk.x;
+                                force[mem_idx].y += fk.y;
+                                force[mem_idx].z += fk.z;
                                 }
                             }
                         }
                     }
 
                 // increment the force and potential energy for particle j
-                unsigned int mem_idx = jj;
-                h_force.data[mem_idx].x += fj.x;
-                h_force.data[mem_idx].y += fj.y;
-                h_force.data[mem_idx].z += fj.z;
-                h_force.data[mem_idx].w += pej;
+                unsigned int mem_idx = neigh_j.idx;
+                force[mem_idx].x += fj.x;
+                force[mem_idx].y += fj.y;
+                force[mem_idx].z += fj.z;
+                force[mem_idx].w += pej;
                 }
 
             // finally, increment the force and potential energy for particle i
             unsigned int mem_idx = i;
-            h_force.data[mem_idx].x += fi.x;
-            h_force.data[mem_idx].y += fi.y;
-            h_force.data[mem_idx].z += fi.z;
-            h_force.data[mem_idx].w += pei;
+            force[mem_idx].x += fi.x;
+            force[mem_idx].y += fi.y;
+            force[mem_idx].z += fi.z;
+            force[mem_idx].w += pei;
 
             // imcrement vir for i
             if (compute_virial)
                 {
-                h_virial.data[0 * m_virial_pitch + mem_idx] += virialixx;
-                h_virial.data[1 * m_virial_pitch + mem_idx] += virialixy;
-                h_virial.data[2 * m_virial_pitch + mem_idx] += virialixz;
-                h_virial.data[3 * m_virial_pitch + mem_idx] += virialiyy;
-                h_virial.data[4 * m_virial_pitch + mem_idx] += virialiyz;
-                h_virial.data[5 * m_virial_pitch + mem_idx] += virializz;
+                virial[0 * virial_pitch + mem_idx] += virialixx;
+                virial[1 * virial_pitch + mem_idx] += virialixy;
+                virial[2 * virial_pitch + mem_idx] += virialixz;
+                virial[3 * virial_pitch + mem_idx] += virialiyy;
+                virial[4 * virial_pitch + mem_idx] += virialiyz;
+                virial[5 * virial_pitch + mem_idx] += virializz;
                 }
             }
-        }
-    else
+        };
+
+    // stage 2 for the Tersoff and SquareDensity potentials
+    auto compute_tersoff = [&](unsigned int thread_id,
+                               unsigned int begin,
+                               unsigned int end,
+                               Scalar4* force,
+                               Scalar* virial,
+                               size_t virial_pitch)
         {
-        // ****** Tersoff or SquareDensity potential
-        // start by updating the neighborlist
-        m_nlist->compute(timestep);
-
-        // The three-body potentials can't handle a half neighbor list, so check now.
-        bool third_law = m_nlist->getStorageMode() == NeighborList::half;
-        if (third_law)
-            {
-            m_exec_conf->msg->error()
-                << std::endl
-                << "PotentialTersoff cannot handle a half neighborlist" << std::endl;
-            throw std::runtime_error("Error computing forces in PotentialTersoff");
-            }
+        std::vector<NeighborCache>& cache = m_thread_neigh_cache[thread_id];
+        std::vector<Scalar>& phi_ab = m_thread_phi_ab[thread_id];
+        phi_ab.resize(ntypes);
 
-        // access the neighbor list, particle data, and system box
-        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
-                                            access_location::host,
-                                            access_mode::read);
-        ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
-                                          access_location::host,
-                                          access_mode::read);
-        ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
-                                        access_location::host,
-                                        access_mode::read);
-
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::read);
-
-        // force and virial arrays
-        ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
-
-        PDataFlags flags = this->m_pdata->getFlags();
-        bool compute_virial = flags[pdata_flag::pressure_tensor];
-
-        const BoxDim box = m_pdata->getBox();
-        ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
-        ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
-
-        // need to start from a zero force, energy
-        memset(h_force.data, 0, sizeof(Scalar4) * (m_pdata->getN() + m_pdata->getNGhosts()));
-        memset(h_virial.data, 0, sizeof(Scalar) * 6 * m_virial_pitch);
-
-        unsigned int ntypes = m_pdata->getNTypes();
-
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
+        for (unsigned int i = begin; i < end; i++)
             {
-            // access the particle's position and type (MEM TRANSFER: 4 scalars)
-            Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
             unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-            const size_t head_i = h_head_list.data[i];
-            // sanity check
-            assert(typei < m_pdata->getNTypes());
+            cache_neighbors(i, cache);
 
             // initialize current force and potential energy of particle i to 0
             Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
@@ -611,42 +606,24 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
             // reset phi
             for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
                 {
-                m_phi_ab[typ_b] = Scalar(0.0);
+                phi_ab[typ_b] = Scalar(0.0);
                 }
 
             // all neighbors of this particle
-            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            const unsigned int size = (unsigned int)cache.size();
             if (evaluator::hasPerParticleEnergy())
                 {
                 for (unsigned int j = 0; j < size; j++)
                     {
-                    // access the index of neighbor j (MEM TRANSFER: 1 scalar)
-                    unsigned int jj = h_nlist.data[head_i + j];
-                    assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
-
-                    // access the position and type of particle j
-                    Scalar3 posj
-                        = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-                    unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-                    assert(typej < m_pdata->getNTypes());
-
-                    // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                    Scalar3 dxij = posi - posj;
-
-                    // apply periodic boundary conditions
-                    dxij = box.minImage(dxij);
-
-                    // compute rij_sq (FLOPS: 5)
-                    Scalar rij_sq = dot(dxij, dxij);
+                    const NeighborCache& neigh_j = cache[j];
 
                     // get parameters for this type pair
-                    unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                    const param_type& param = h_params.data[typpair_idx];
-                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
+                    const param_type& param = h_params.data[neigh_j.typpair_idx];
+                    Scalar rcutsq = h_rcutsq.data[neigh_j.typpair_idx];
 
                     // evaluate the scalar per-neighbor contribution
-                    evaluator eval(rij_sq, rcutsq, param);
-                    eval.evalPhi(m_phi_ab[typej]);
+                    evaluator eval(neigh_j.rsq, rcutsq, param);
+                    eval.evalPhi(phi_ab[neigh_j.type]);
                     }
 
                 // self-energy
@@ -657,7 +634,7 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                     Scalar rcutsq = h_rcutsq.data[typpair_idx];
                     evaluator eval(Scalar(0.0), rcutsq, param);
                     Scalar energy(0.0);
-                    eval.evalSelfEnergy(energy, m_phi_ab[typ_b]);
+                    eval.evalSelfEnergy(energy, phi_ab[typ_b]);
                     pei += energy;
                     }
                 }
@@ -665,32 +642,17 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
             // loop over all of the neighbors of this particle
             for (unsigned int j = 0; j < size; j++)
                 {
-                // access the index of neighbor j (MEM TRANSFER: 1 scalar)
-                unsigned int jj = h_nlist.data[head_i + j];
-                assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // access the position and type of particle j
-                Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-                unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-                assert(typej < m_pdata->getNTypes());
+                const NeighborCache& neigh_j = cache[j];
+                const Scalar3 dxij = neigh_j.dx;
+                const Scalar rij_sq = neigh_j.rsq;
 
                 // initialize the current force and potential energy of particle j to 0
                 Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
                 Scalar pej = 0.0;
 
-                // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 dxij = posi - posj;
-
-                // apply periodic boundary conditions
-                dxij = box.minImage(dxij);
-
-                // compute rij_sq (FLOPS: 5)
-                Scalar rij_sq = dot(dxij, dxij);
-
                 // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                const param_type& param = h_params.data[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
+                const param_type& param = h_params.data[neigh_j.typpair_idx];
+                Scalar rcutsq = h_rcutsq.data[neigh_j.typpair_idx];
 
                 // evaluate the base repulsive and attractive terms
                 Scalar fR = 0.0;
@@ -713,34 +675,18 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                         {
                         for (unsigned int k = 0; k < size; k++)
                             {
-                            // access the index of neighbor k
-                            unsigned int kk = h_nlist.data[head_i + k];
-                            assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
-
-                            // access the position and type of neighbor k
-                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
-                                                        h_pos.data[kk].y,
-                                                        h_pos.data[kk].z);
-                            unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                            assert(typek < m_pdata->getNTypes());
+                            const NeighborCache& neigh_k = cache[k];
 
                             // access the type pair parameters for i and k
-                            typpair_idx = m_typpair_idx(typei, typek);
-                            const param_type& temp_param = h_params.data[typpair_idx];
+                            const param_type& temp_param = h_params.data[neigh_k.typpair_idx];
 
                             evaluator temp_eval(rij_sq, rcutsq, temp_param);
                             bool temp_evaluated = temp_eval.areInteractive();
 
-                            if (kk != jj && temp_evaluated)
+                            if (neigh_k.idx != neigh_j.idx && temp_evaluated)
                                 {
-                                // compute drik
-                                Scalar3 dxik = posi - posk;
-
-                                // apply periodic boundary conditions
-                                dxik = box.minImage(dxik);
-
-                                // compute rik_sq
-                                Scalar rik_sq = dot(dxik, dxik);
+                                const Scalar3 dxik = neigh_k.dx;
+                                const Scalar rik_sq = neigh_k.rsq;
 
                                 // compute the bond angle (if needed)
                                 Scalar cos_th = Scalar(0.0);
@@ -761,7 +707,13 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                     Scalar force_divr = Scalar(0.0);
                     Scalar potential_eng = Scalar(0.0);
                     Scalar bij = Scalar(0.0);
-                    eval.evalForceij(fR, fA, chi, m_phi_ab[typej], bij, force_divr, potential_eng);
+                    eval.evalForceij(fR,
+                                     fA,
+                                     chi,
+                                     phi_ab[neigh_j.type],
+                                     bij,
+                                     force_divr,
+                                     potential_eng);
 
                     // add this force to particle i
                     fi += force_divr * dxij;
@@ -800,37 +752,21 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                         // evaluate the force from the ik interactions
                         for (unsigned int k = 0; k < size; k++)
                             {
-                            // access the index of neighbor k
-                            unsigned int kk = h_nlist.data[head_i + k];
-                            assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
-
-                            // access the position and type of neighbor k
-                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
-                                                        h_pos.data[kk].y,
-                                                        h_pos.data[kk].z);
-                            unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                            assert(typek < m_pdata->getNTypes());
+                            const NeighborCache& neigh_k = cache[k];
 
                             // access the type pair parameters for i and k
-                            typpair_idx = m_typpair_idx(typei, typek);
-                            const param_type& temp_param = h_params.data[typpair_idx];
+                            const param_type& temp_param = h_params.data[neigh_k.typpair_idx];
 
                             evaluator temp_eval(rij_sq, rcutsq, temp_param);
                             bool temp_evaluated = temp_eval.areInteractive();
 
-                            if (kk != jj && temp_evaluated)
+                            if (neigh_k.idx != neigh_j.idx && temp_evaluated)
                                 {
                                 // create variable for the force on k
                                 Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
 
-                                // compute dr_ik
-                                Scalar3 dxik = posi - posk;
-
-                                // apply periodic boundary conditions
-                                dxik = box.minImage(dxik);
-
-                                // compute rik_sq
-                                Scalar rik_sq = dot(dxik, dxik);
+                                const Scalar3 dxik = neigh_k.dx;
+                                const Scalar rik_sq = neigh_k.rsq;
 
                                 // compute the bond angle (if needed)
                                 Scalar cos_th = Scalar(0.0);
@@ -902,31 +838,31 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                                 fk.z += force_divr_ij.z * dxij.z + force_divr_ik.z * dxik.z;
 
                                 // increment the force for particle k
-                                unsigned int mem_idx = kk;
-                                h_force.data[mem_idx].x += fk.x;
-                                h_force.data[mem_idx].y += fk.y;
-                                h_force.data[mem_idx].z += fk.z;
+                                unsigned int mem_idx = neigh_k.idx;
+                                force[mem_idx].x += fk.x;
+                                force[mem_idx].y += fk.y;
+                                force[mem_idx].z += fk.z;
 
                                 if (compute_virial)
                                     {
                                     Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.z;
                                     Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.z;
-                                    h_virial.data[0 * m_virial_pitch + mem_idx]
+                                    virial[0 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.x * dxij.x
                                            + force_div2r_ik * dxik.x * dxik.x;
-                                    h_virial.data[1 * m_virial_pitch + mem_idx]
+                                    virial[1 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.x * dxij.y
                                            + force_div2r_ik * dxik.x * dxik.y;
-                                    h_virial.data[2 * m_virial_pitch + mem_idx]
+                                    virial[2 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.x * dxij.z
                                            + force_div2r_ik * dxik.x * dxik.z;
-                                    h_virial.data[3 * m_virial_pitch + mem_idx]
+                                    virial[3 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.y * dxij.y
                                            + force_div2r_ik * dxik.y * dxik.y;
-                                    h_virial.data[4 * m_virial_pitch + mem_idx]
+                                    virial[4 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.y * dxij.z
                                            + force_div2r_ik * dxik.y * dxik.z;
-                                    h_virial.data[5 * m_virial_pitch + mem_idx]
+                                    virial[5 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.z * dxij.z
                                            + force_div2r_ik * dxik.z * dxik.z;
                                     }
@@ -935,40 +871,121 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                         }
                     }
                 // increment the force and potential energy for particle j
-                unsigned int mem_idx = jj;
-                h_force.data[mem_idx].x += fj.x;
-                h_force.data[mem_idx].y += fj.y;
-                h_force.data[mem_idx].z += fj.z;
-                h_force.data[mem_idx].w += pej;
+                unsigned int mem_idx = neigh_j.idx;
+                force[mem_idx].x += fj.x;
+                force[mem_idx].y += fj.y;
+                force[mem_idx].z += fj.z;
+                force[mem_idx].w += pej;
 
                 if (compute_virial)
                     {
-                    h_virial.data[0 * m_virial_pitch + mem_idx] += virialj_xx;
-                    h_virial.data[1 * m_virial_pitch + mem_idx] += virialj_xy;
-                    h_virial.data[2 * m_virial_pitch + mem_idx] += virialj_xz;
-                    h_virial.data[3 * m_virial_pitch + mem_idx] += virialj_yy;
-                    h_virial.data[4 * m_virial_pitch + mem_idx] += virialj_yz;
-                    h_virial.data[5 * m_virial_pitch + mem_idx] += virialj_zz;
+                    virial[0 * virial_pitch + mem_idx] += virialj_xx;
+                    virial[1 * virial_pitch + mem_idx] += virialj_xy;
+                    virial[2 * virial_pitch + mem_idx] += virialj_xz;
+                    virial[3 * virial_pitch + mem_idx] += virialj_yy;
+                    virial[4 * virial_pitch + mem_idx] += virialj_yz;
+                    virial[5 * virial_pitch + mem_idx] += virialj_zz;
                     }
                 }
             // finally, increment the force and potential energy for particle i
             unsigned int mem_idx = i;
-            h_force.data[mem_idx].x += fi.x;
-            h_force.data[mem_idx].y += fi.y;
-            h_force.data[mem_idx].z += fi.z;
-            h_force.data[mem_idx].w += pei;
+            force[mem_idx].x += fi.x;
+            force[mem_idx].y += fi.y;
+            force[mem_idx].z += fi.z;
+            force[mem_idx].w += pei;
 
             if (compute_virial)
                 {
-                h_virial.data[0 * m_virial_pitch + mem_idx] += viriali_xx;
-                h_virial.data[1 * m_virial_pitch + mem_idx] += viriali_xy;
-                h_virial.data[2 * m_virial_pitch + mem_idx] += viriali_xz;
-                h_virial.data[3 * m_virial_pitch + mem_idx] += viriali_yy;
-                h_virial.data[4 * m_virial_pitch + mem_idx] += viriali_yz;
-                h_virial.data[5 * m_virial_pitch + mem_idx] += viriali_zz;
+                virial[0 * virial_pitch + mem_idx] += viriali_xx;
+                virial[1 * virial_pitch + mem_idx] += viriali_xy;
+                virial[2 * virial_pitch + mem_idx] += viriali_xz;
+                virial[3 * virial_pitch + mem_idx] += viriali_yy;
+                virial[4 * virial_pitch + mem_idx] += viriali_yz;
+                virial[5 * virial_pitch + mem_idx] += viriali_zz;
                 }
             }
+        };
+
+    // *****  check if we need the structure of the Tersoff or the RevCross potential for evaluation
+    auto compute_range = [&](unsigned int thread_id,
+                             unsigned int begin,
+                             unsigned int end,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch)
+        {
+        if (evaluator::flag_for_RevCross)
+            compute_revcross(thread_id, begin, end, force, virial, virial_pitch);
+        else
+            compute_tersoff(thread_id, begin, end, force, virial, virial_pitch);
+        };
+
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    const unsigned int n_threads = pool.getNumThreads();
+    m_thread_neigh_cache.resize(n_threads);
+    m_thread_phi_ab.resize(n_threads);
+
+    if (n_threads == 1)
+        {
+        compute_range(0, 0, m_pdata->getN(), h_force.data, h_virial.data, m_virial_pitch);
+        return;
         }
+
+    // threads add forces to neighbors owned by other threads. Thread 0 accumulates directly into
+    // the output arrays and the other threads accumulate into private buffers.
+    m_thread_force.resize(n_threads - 1);
+    m_thread_virial.resize(n_threads - 1);
+
+    pool.parallelFor(
+        m_pdata->getN(),
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+        {
+            if (thread_id == 0)
+                {
+                compute_range(0, begin, end, h_force.data, h_virial.data, m_virial_pitch);
+                return;
+                }
+
+            std::vector<Scalar4>& thread_force = m_thread_force[thread_id - 1];
+            std::vector<Scalar>& thread_virial = m_thread_virial[thread_id - 1];
+            thread_force.assign(N, make_scalar4(0, 0, 0, 0));
+            if (compute_virial)
+                {
+                thread_virial.assign(6 * size_t(N), Scalar(0.0));
+                }
+            compute_range(thread_id, begin, end, thread_force.data(), thread_virial.data(), N);
+        });
+
+    // sum the per-thread buffers, in thread order for reproducibility
+    pool.parallelFor(
+        N,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+        {
+            for (unsigned int t = 0; t < n_threads - 1; t++)
+                {
+                const Scalar4* thread_force = m_thread_force[t].data();
+                for (unsigned int i = begin; i < end; i++)
+                    {
+                    h_force.data[i].x += thread_force[i].x;
+                    h_force.data[i].y += thread_force[i].y;
+                    h_force.data[i].z += thread_force[i].z;
+                    h_force.data[i].w += thread_force[i].w;
+                    }
+
+                if (compute_virial)
+                    {
+                    const Scalar* thread_virial = m_thread_virial[t].data();
+                    for (unsigned int k = 0; k < 6; k++)
+                        {
+                        for (unsigned int i = begin; i < end; i++)
+                            {
+                            h_virial.data[k * m_virial_pitch + i]
+                                += thread_virial[k * size_t(N) + i];
+                            }
+                        }
+                    }
+                }
+        });
     }
 
 #ifdef ENABLE_MPI
@@ -0,0 +1,107 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file SteinhardtOrder.h
+    \brief Evaluate Steinhardt bond order parameters on the host or device
+*/
+
+#ifndef __STEINHARDT_ORDER_H__
+#define __STEINHARDT_ORDER_H__
+
+#include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Largest spherical harmonic degree supported by ComputeSteinhardt
+const unsigned int STEINHARDT_MAX_L = 12;
+
+//! Add the spherical harmonics of one bond to the bond order sums of a particle
+/*! \param dr Bond vector (must be nonzero)
+    \param l Spherical harmonic degree, at most STEINHARDT_MAX_L
+    \param qlm Sums for m = 0 ... l (l + 1 elements, real part in x and imaginary part in y)
+
+    Adds sqrt((l-m)!/(l+m)!) P_l^m(cos theta) e^{i m phi} to qlm[m] for each m. This is
+    Y_l^m(theta, phi) without the factor sqrt((2l+1)/(4 pi)), which cancels in
+    steinhardt_ql(). The associated Legendre functions are evaluated with recurrences of the
+    normalized functions to avoid the large factorials. Negative m are not stored: the sums for
+    -m are (-1)^m times the complex conjugate of the sums for m.
+*/
+HOSTDEVICE void steinhardt_accumulate(const Scalar3& dr, unsigned int l, Scalar2* qlm)
+    {
+    const Scalar r = fast::sqrt(dr.x * dr.x + dr.y * dr.y + dr.z * dr.z);
+    const Scalar rho = fast::sqrt(dr.x * dr.x + dr.y * dr.y);
+    const Scalar cos_theta = dr.z / r;
+    const Scalar sin_theta = rho / r;
+
+    // e^{i phi}, with phi = 0 for bonds along the z axis
+    Scalar cos_phi = Scalar(1.0);
+    Scalar sin_phi = Scalar(0.0);
+    if (rho > Scalar(0.0))
+        {
+        cos_phi = dr.x / rho;
+        sin_phi = dr.y / rho;
+        }
+
+    // normalized P_m^m and e^{i m phi}, advanced in m
+    Scalar p_mm = Scalar(1.0);
+    Scalar cos_m_phi = Scalar(1.0);
+    Scalar sin_m_phi = Scalar(0.0);
+    for (unsigned int m = 0; m <= l; m++)
+        {
+        if (m > 0)
+            {
+            p_mm *= -sin_theta * fast::sqrt(Scalar(2 * m - 1) / Scalar(2 * m));
+            Scalar c = cos_m_phi * cos_phi - sin_m_phi * sin_phi;
+            sin_m_phi = sin_m_phi * cos_phi + cos_m_phi * sin_phi;
+            cos_m_phi = c;
+            }
+
+        // raise the degree from P_m^m to P_l^m
+        Scalar p_prev = Scalar(0.0);
+        Scalar p = p_mm;
+        for (unsigned int k = m + 1; k <= l; k++)
+            {
+            Scalar p_next = (cos_theta * Scalar(2 * k - 1) * p
+                             - fast::sqrt(Scalar((k + m - 1) * (k - m - 1))) * p_prev)
+                            / fast::sqrt(Scalar((k - m) * (k + m)));
+            p_prev = p;
+            p = p_next;
+            }
+
+        qlm[m].x += p * cos_m_phi;
+        qlm[m].y += p * sin_m_phi;
+        }
+    }
+
+//! Compute the Steinhardt order parameter of a particle from its bond order sums
+/*! \param qlm Sums accumulated with steinhardt_accumulate()
+    \param l Spherical harmonic degree
+    \param n_bonds Number of bonds accumulated in \a qlm
+    \returns q_l = sqrt(4 pi / (2l+1) sum_{m=-l}^{l} |q_lm|^2)
+*/
+HOSTDEVICE Scalar steinhardt_ql(const Scalar2* qlm, unsigned int l, unsigned int n_bonds)
+    {
+    Scalar sum = qlm[0].x * qlm[0].x + qlm[0].y * qlm[0].y;
+    for (unsigned int m = 1; m <= l; m++)
+        {
+        sum += Scalar(2.0) * (qlm[m].x * qlm[m].x + qlm[m].y * qlm[m].y);
+        }
+    return fast::sqrt(sum) / Scalar(n_bonds);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#undef HOSTDEVICE
+#endif // __STEINHARDT_ORDER_H__
@@ -72,6 +72,44 @@ class Thermostat
     */
     virtual void advanceThermostat(uint64_t timestep, Scalar deltaT, bool aniso) { }
 
+    /** Test if the thermostat reads the kinetic energy at the end of the first half step.
+
+        Integration methods that find this true should sum the kinetic energy in the first half
+        step and pass it to setKineticEnergy().
+    */
+    virtual bool needsKineticEnergyStepOne()
+        {
+        return false;
+        }
+
+    /** Test if the thermostat reads the kinetic energy at the end of the second half step.
+
+        Integration methods that find this true should sum the kinetic energy in the second half
+        step and pass it to setKineticEnergy().
+    */
+    virtual bool needsKineticEnergyStepTwo()
+        {
+        return false;
+        }
+
+    /** Set the kinetic energy of the local members of the group.
+
+        @param translational Translational kinetic energy of the local members.
+        @param rotational Rotational kinetic energy of the local members (0 when the integration
+                          method does not integrate the rotational degrees of freedom).
+
+        Integration methods sum the kinetic energy in the same pass that updates the velocities and
+        call setKineticEnergy() after the update. The thermostat uses these sums in place of a
+        ComputeThermo pass until the velocities, angular momenta, orientations, moments of inertia,
+        or group members change.
+    */
+    void setKineticEnergy(Scalar translational, Scalar rotational)
+        {
+        m_kinetic_energy = {translational, rotational};
+        m_kinetic_energy_versions = getKineticEnergyVersions();
+        m_kinetic_energy_set = true;
+        }
+
     /// Get the temperature variant.
     std::shared_ptr<Variant> getT()
         {
@@ -98,6 +136,51 @@ class Thermostat
         }
 
     protected:
+    /** Get the kinetic energy of the group.
+
+        @param timestep Current simulation timestep.
+        @returns [translational kinetic energy, rotational kinetic energy]
+
+        Use the sums given to setKineticEnergy() when they are up to date on all ranks, otherwise
+        compute the kinetic energy with m_thermo.
+    */
+    std::array<Scalar, 2> getKineticEnergy(uint64_t timestep)
+        {
+        bool valid
+            = m_kinetic_energy_set && m_kinetic_energy_versions == getKineticEnergyVersions();
+        double sums[3] = {m_kinetic_energy[0], m_kinetic_energy[1], valid ? 0.0 : 1.0};
+
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            {
+            MPI_Allreduce(MPI_IN_PLACE,
+                          sums,
+                          3,
+                          MPI_DOUBLE,
+                          MPI_SUM,
+                          m_sysdef->getParticleData()->getExecConf()->getMPICommunicator());
+            }
+#endif
+
+        if (sums[2] == 0.0)
+            {
+            return {Scalar(sums[0]), Scalar(sums[1])};
+            }
+
+        m_thermo->compute(timestep);
+        return {m_thermo->getTranslationalKineticEnergy(), m_thermo->getRotationalKineticEnergy()};
+        }
+
+    /// Get the temperature that corresponds to a kinetic energy.
+    static Scalar getTemperature(Scalar kinetic_energy, double degrees_of_freedom)
+        {
+        if (degrees_of_freedom > 0)
+            {
+            return Scalar(2.0) / Scalar(degrees_of_freedom) * kinetic_energy;
+            }
+        return Scalar(0.0);
+        }
+
     /// The particle group to thermostat.
     std::shared_ptr<ParticleGroup> m_group;
 
@@ -109,6 +192,27 @@ class Thermostat
 
     /// The system definition.
     std::shared_ptr<SystemDefinition> m_sysdef;
+
+    private:
+    /// Get the versions of the arrays that the kinetic energy depends on.
+    std::array<uint64_t, 5> getKineticEnergyVersions()
+        {
+        auto pdata = m_sysdef->getParticleData();
+        return {pdata->getVelocities().getVersion(),
+                pdata->getAngularMomentumArray().getVersion(),
+                pdata->getOrientationArray().getVersion(),
+                pdata->getMomentsOfInertiaArray().getVersion(),
+                m_group->getIndexArray().getVersion()};
+        }
+
+    /// Kinetic energy of the local members given to setKineticEnergy().
+    std::array<Scalar, 2> m_kinetic_energy {};
+
+    /// Array versions when the kinetic energy was set.
+    std::array<uint64_t, 5> m_kinetic_energy_versions {};
+
+    /// True after the first call to setKineticEnergy().
+    bool m_kinetic_energy_set = false;
     };
 
 /** Implement the MTTK thermostat.
@@ -161,10 +265,10 @@ class MTTKThermostat : public Thermostat
 
     void advanceThermostat(uint64_t timestep, Scalar deltaT, bool aniso = true) override
         {
-        // compute the current thermodynamic properties
-        m_thermo->compute(timestep);
+        // get the current kinetic energy
+        const auto kinetic_energy = getKineticEnergy(timestep);
 
-        Scalar curr_T_trans = m_thermo->getTranslationalTemperature();
+        Scalar curr_T_trans = getTemperature(kinetic_energy[0], m_group->getTranslationalDOF());
         Scalar T = m_T->operator()(timestep);
 
         // update the state variables Xi and eta
@@ -179,7 +283,7 @@ class MTTKThermostat : public Thermostat
         if (aniso)
             {
             // update thermostat for rotational DOF
-            Scalar curr_ke_rot = m_thermo->getRotationalKineticEnergy();
+            Scalar curr_ke_rot = kinetic_energy[1];
             Scalar ndof_rot = m_group->getRotationalDOF();
 
             Scalar xi_prime_rot = m_state.xi_rot
@@ -193,6 +297,11 @@ class MTTKThermostat : public Thermostat
             }
         }
 
+    bool needsKineticEnergyStepOne() override
+        {
+        return true;
+        }
+
     /** Get the thermostat's contribution to the total Hamiltonian of the system.
 
         @param timestep Current simulation timestep.
@@ -361,12 +470,12 @@ class BussiThermostat : public Thermostat
             return {1.0, 1.0};
             }
 
-        m_thermo->compute(timestep);
+        const auto kinetic_energy = getKineticEnergy(timestep);
 
-        const auto translational_dof = m_thermo->getTranslationalDOF();
-        const auto rotational_dof = m_thermo->getRotationalDOF();
-        const auto translational_kinetic_energy = m_thermo->getTranslationalKineticEnergy();
-        const auto rotational_kinetic_energy = m_thermo->getRotationalKineticEnergy();
+        const auto translational_dof = m_group->getTranslationalDOF();
+        const auto rotational_dof = m_group->getRotationalDOF();
+        const auto translational_kinetic_energy = kinetic_energy[0];
+        const auto rotational_kinetic_energy = kinetic_energy[1];
         if ((translational_dof != 0 && translational_kinetic_energy == 0)
             || (rotational_dof != 0 && rotational_kinetic_energy == 0))
             {
@@ -390,6 +499,11 @@ class BussiThermostat : public Thermostat
             compute_rescale_factor(rotational_kinetic_energy, rotational_dof, deltaT, set_T, rng)};
         }
 
+    bool needsKineticEnergyStepTwo() override
+        {
+        return true;
+        }
+
     /// Get the thermostat time constant.
     Scalar getTau()
         {
@@ -466,14 +580,21 @@ class BerendsenThermostat : public Thermostat
         : Thermostat(T, group, thermo, sysdef), m_tau(tau)
         {
         }
-    std::array<Scalar, 2> getRescalingFactorsOne(uint64_t timestep, hoomd::Scalar deltaT) override
+    bool needsKineticEnergyStepTwo() override
         {
-        m_thermo->compute(timestep);
-        Scalar current_translation_T = m_thermo->getTranslationalTemperature();
-        Scalar current_rotational_T = m_thermo->getRotationalTemperature();
+        return true;
+        }
 
-        if ((m_thermo->getTranslationalDOF() != 0 && m_thermo->getTranslationalKineticEnergy() == 0)
-            || (m_thermo->getRotationalDOF() != 0 && m_thermo->getRotationalKineticEnergy() == 0))
+    std::array<Scalar, 2> getRescalingFactorsOne(uint64_t timestep, hoomd::Scalar deltaT) override
+        {
+        const auto kinetic_energy = getKineticEnergy(timestep);
+        const double translational_dof = m_group->getTranslationalDOF();
+        const double rotational_dof = m_group->getRotationalDOF();
+        Scalar current_translation_T = getTemperature(kinetic_energy[0], translational_dof);
+        Scalar current_rotational_T = getTemperature(kinetic_energy[1], rotational_dof);
+
+        if ((translational_dof != 0 && kinetic_energy[0] == 0)
+            || (rotational_dof != 0 && kinetic_energy[1] == 0))
             {
             throw std::runtime_error("Berendsen thermostat requires non-zero initial temperatures");
             }
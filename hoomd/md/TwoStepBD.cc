@@ -7,6 +7,9 @@
 
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
+
+#include <vector>
+
 using namespace hoomd;
 
 #ifdef ENABLE_MPI
@@ -84,6 +87,26 @@ void TwoStepBD::integrateStepOne(uint64_t timestep)
 
     uint16_t seed = m_sysdef->getSeed();
 
+    // the noise amplitudes only depend on the particle type, compute them once per step
+    // (the extra factor of 3 is because <rx^2> is 1/3 in the uniform -1,1 distribution it is not
+    // the dimensionality of the system)
+    const unsigned int n_types = (unsigned int)m_gamma.getNumElements();
+    std::vector<Scalar> coeff(n_types, Scalar(0.0));
+    std::vector<Scalar3> sigma_r(n_types, make_scalar3(0, 0, 0));
+    for (unsigned int type = 0; type < n_types; type++)
+        {
+        if (!m_noiseless_t)
+            coeff[type] = fast::sqrt(Scalar(3.0) * Scalar(2.0) * h_gamma.data[type] * currentTemp
+                                     / m_deltaT);
+
+        Scalar3 gamma_r = h_gamma_r.data[type];
+        if (m_aniso && !m_noiseless_r)
+            sigma_r[type]
+                = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * currentTemp / m_deltaT),
+                               fast::sqrt(Scalar(2.0) * gamma_r.y * currentTemp / m_deltaT),
+                               fast::sqrt(Scalar(2.0) * gamma_r.z * currentTemp / m_deltaT));
+        }
+
     // perform the first half step
     // r(t+deltaT) = r(t) + (Fc(t) + Fr)*deltaT/gamma
     // v(t+deltaT) = random distribution consistent with T
@@ -106,14 +129,10 @@ void TwoStepBD::integrateStepOne(uint64_t timestep)
         unsigned int type = __scalar_as_int(h_pos.data[j].w);
         gamma = h_gamma.data[type];
 
-        // compute the bd force (the extra factor of 3 is because <rx^2> is 1/3 in the uniform -1,1
-        // distribution it is not the dimensionality of the system
-        Scalar coeff = fast::sqrt(Scalar(3.0) * Scalar(2.0) * gamma * currentTemp / m_deltaT);
-        if (m_noiseless_t)
-            coeff = Scalar(0.0);
-        Scalar Fr_x = rx * coeff;
-        Scalar Fr_y = ry * coeff;
-        Scalar Fr_z = rz * coeff;
+        // compute the bd force
+        Scalar Fr_x = rx * coeff[type];
+        Scalar Fr_y = ry * coeff[type];
+        Scalar Fr_z = rz * coeff[type];
 
         if (D < 3)
             Fr_z = Scalar(0.0);
@@ -167,19 +186,12 @@ void TwoStepBD::integrateStepOne(uint64_t timestep)
                 y_zero = (I.y == 0);
                 z_zero = (I.z == 0);
 
-                Scalar3 sigma_r
-                    = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * currentTemp / m_deltaT),
-                                   fast::sqrt(Scalar(2.0) * gamma_r.y * currentTemp / m_deltaT),
-                                   fast::sqrt(Scalar(2.0) * gamma_r.z * currentTemp / m_deltaT));
-                if (m_noiseless_r)
-                    sigma_r = make_scalar3(0, 0, 0);
-
                 // original Gaussian random torque
                 // Gaussian random distribution is preferred in terms of preserving the exact math
                 vec3<Scalar> bf_torque;
-                bf_torque.x = NormalDistribution<Scalar>(sigma_r.x)(rng);
-                bf_torque.y = NormalDistribution<Scalar>(sigma_r.y)(rng);
-                bf_torque.z = NormalDistribution<Scalar>(sigma_r.z)(rng);
+                bf_torque.x = NormalDistribution<Scalar>(sigma_r[type_r].x)(rng);
+                bf_torque.y = NormalDistribution<Scalar>(sigma_r[type_r].y)(rng);
+                bf_torque.z = NormalDistribution<Scalar>(sigma_r[type_r].z)(rng);
 
                 if (x_zero)
                     {
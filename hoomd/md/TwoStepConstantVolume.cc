@@ -16,6 +16,15 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
     unsigned int group_size = m_group->getNumMembers();
 
+    // sum the kinetic energy for the thermostat while updating the velocities
+    const bool sum_kinetic_energy = m_thermostat && m_thermostat->needsKineticEnergyStepOne();
+    double ke_translational = 0.0;
+    double ke_rotational = 0.0;
+
+    // remove the momentum set by the integrator while updating the velocities
+    const bool remove_momentum = m_remove_momentum;
+    m_remove_momentum = false;
+
         // scope array handles for proper releasing before calling the thermo compute
         {
         ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
@@ -37,6 +46,11 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
             Scalar3 pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
             Scalar3 accel = h_accel.data[j];
 
+            if (remove_momentum)
+                {
+                v -= m_momentum_shift / h_vel.data[j].w;
+                }
+
             // update velocity and position
             v = v + Scalar(1.0 / 2.0) * accel * m_deltaT;
 
@@ -53,6 +67,11 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
                 }
             pos += m_deltaT * v;
 
+            if (sum_kinetic_energy)
+                {
+                ke_translational += (double)h_vel.data[j].w * (double)dot(v, v);
+                }
+
             // store updated variables
             h_vel.data[j].x = v.x;
             h_vel.data[j].y = v.y;
@@ -200,12 +219,23 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
             h_orientation.data[j] = quat_to_scalar4(q);
             h_angmom.data[j] = quat_to_scalar4(p);
+
+            if (sum_kinetic_energy)
+                {
+                ke_rotational += twiceRotationalKineticEnergy(q, p, I);
+                }
             }
         }
 
     // get temperature and advance thermostat
     if (m_thermostat)
         {
+        if (sum_kinetic_energy)
+            {
+            m_thermostat->setKineticEnergy(Scalar(0.5 * ke_translational),
+                                           Scalar(0.5 * ke_rotational));
+            }
+
         m_thermostat->advanceThermostat(timestep, m_deltaT, m_aniso);
         }
     }
@@ -228,6 +258,16 @@ void hoomd::md::TwoStepConstantVolume::integrateStepTwo(uint64_t timestep)
 
     ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::read);
 
+    // sum the kinetic energy for the thermostat while updating the velocities
+    const bool sum_kinetic_energy = m_thermostat && m_thermostat->needsKineticEnergyStepTwo();
+    double ke_translational = 0.0;
+    double ke_rotational = 0.0;
+
+    // sum the momentum for the integrator while updating the velocities
+    const bool sum_momentum = m_sum_momentum;
+    m_sum_momentum = false;
+    Scalar3 momentum = make_scalar3(0, 0, 0);
+
     // perform second half step of Nose-Hoover integration
 
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
@@ -258,7 +298,18 @@ void hoomd::md::TwoStepConstantVolume::integrateStepTwo(uint64_t timestep)
 
         // store acceleration
         h_accel.data[j] = accel;
+
+        if (sum_kinetic_energy)
+            {
+            ke_translational += (double)m * (double)dot(v, v);
+            }
+
+        if (sum_momentum)
+            {
+            momentum += m * v;
+            }
         }
+    m_momentum_sum = momentum;
 
     if (m_aniso)
         {
@@ -309,8 +360,18 @@ void hoomd::md::TwoStepConstantVolume::integrateStepTwo(uint64_t timestep)
             p += m_deltaT * q * t;
 
             h_angmom.data[j] = quat_to_scalar4(p);
+
+            if (sum_kinetic_energy)
+                {
+                ke_rotational += twiceRotationalKineticEnergy(q, p, I);
+                }
             }
         }
+
+    if (sum_kinetic_energy)
+        {
+        m_thermostat->setKineticEnergy(Scalar(0.5 * ke_translational), Scalar(0.5 * ke_rotational));
+        }
     }
 
 namespace hoomd::md::detail
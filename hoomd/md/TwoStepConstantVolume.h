@@ -8,6 +8,7 @@
 #include "IntegrationMethodTwoStep.h"
 #include "Thermostat.h"
 #include "hoomd/Variant.h"
+#include "hoomd/VectorMath.h"
 #include <pybind11/pybind11.h>
 namespace hoomd::md
     {
@@ -79,6 +80,12 @@ class PYBIND11_EXPORT TwoStepConstantVolume : public IntegrationMethodTwoStep
         return m_limit;
         }
 
+    /// The velocity updates remove the momentum on request.
+    virtual bool canRemoveMomentum() const
+        {
+        return true;
+        }
+
     /// Get needed pdata flags.
     virtual PDataFlags getRequestedPDataFlags()
         {
@@ -93,6 +100,35 @@ class PYBIND11_EXPORT TwoStepConstantVolume : public IntegrationMethodTwoStep
         }
 
     protected:
+    /** Get twice the rotational kinetic energy of a particle.
+
+        @param q Orientation.
+        @param p Angular momentum (conjugate quaternion).
+        @param I Principal moments of inertia.
+
+        Only the principal axes with non-zero moments of inertia contribute, as in ComputeThermo.
+    */
+    static double twiceRotationalKineticEnergy(const quat<Scalar>& q,
+                                               const quat<Scalar>& p,
+                                               const vec3<Scalar>& I)
+        {
+        quat<Scalar> s(Scalar(0.5) * conj(q) * p);
+        double result = 0.0;
+        if (I.x > 0)
+            {
+            result += s.v.x * s.v.x / I.x;
+            }
+        if (I.y > 0)
+            {
+            result += s.v.y * s.v.y / I.y;
+            }
+        if (I.z > 0)
+            {
+            result += s.v.z * s.v.z / I.z;
+            }
+        return result;
+        }
+
     /// Pack the limit values for use in the GPU kernel.
     auto getKernelLimitValues(uint64_t timestep)
         {
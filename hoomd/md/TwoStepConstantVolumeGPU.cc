@@ -15,7 +15,8 @@ namespace hoomd::md
 TwoStepConstantVolumeGPU::TwoStepConstantVolumeGPU(std::shared_ptr<SystemDefinition> sysdef,
                                                    std::shared_ptr<ParticleGroup> group,
                                                    std::shared_ptr<Thermostat> thermostat)
-    : TwoStepConstantVolume(sysdef, group, thermostat)
+    : TwoStepConstantVolume(sysdef, group, thermostat), m_partial_ke(m_exec_conf),
+      m_partial_ke_rot(m_exec_conf)
     {
     if (!m_exec_conf->isCUDAEnabled())
         {
@@ -54,6 +55,12 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
     const auto&& rescalingFactors = m_thermostat
                                         ? m_thermostat->getRescalingFactorsOne(timestep, m_deltaT)
                                         : std::array<Scalar, 2> {1., 1.};
+
+    // sum the kinetic energy for the thermostat while updating the velocities
+    const bool sum_kinetic_energy = m_thermostat && m_thermostat->needsKineticEnergyStepOne();
+    unsigned int n_partial = 0;
+    unsigned int n_partial_rot = 0;
+
         {
         // access all the needed data
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
@@ -78,6 +85,15 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
 
         m_exec_conf->setDevice();
 
+        // one partial sum of the kinetic energy per block
+        const unsigned int block_size = m_tuner_one->getParam()[0];
+        n_partial = group_size / block_size + 1;
+        if (sum_kinetic_energy && m_partial_ke.getNumElements() < n_partial)
+            m_partial_ke.resize(n_partial);
+        ArrayHandle<Scalar> d_partial_ke(m_partial_ke,
+                                         access_location::device,
+                                         access_mode::overwrite);
+
         // perform the update on the GPU
         m_tuner_one->begin();
         kernel::gpu_nvt_rescale_step_one(d_pos.data,
@@ -87,11 +103,12 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
                                          d_index_array.data,
                                          group_size,
                                          box,
-                                         m_tuner_one->getParam()[0],
+                                         block_size,
                                          rescalingFactors[0], // m_exp_thermo_fac,
                                          m_deltaT,
                                          limits.first,
-                                         limits.second);
+                                         limits.second,
+                                         sum_kinetic_energy ? d_partial_ke.data : nullptr);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -117,6 +134,14 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
                                                 access_location::device,
                                                 access_mode::read);
 
+        const unsigned int block_size = m_tuner_angular_one->getParam()[0];
+        n_partial_rot = group_size / block_size + 1;
+        if (sum_kinetic_energy && m_partial_ke_rot.getNumElements() < n_partial_rot)
+            m_partial_ke_rot.resize(n_partial_rot);
+        ArrayHandle<Scalar> d_partial_ke_rot(m_partial_ke_rot,
+                                             access_location::device,
+                                             access_mode::overwrite);
+
         m_tuner_angular_one->begin();
         kernel::gpu_nve_angular_step_one(d_orientation.data,
                                          d_angmom.data,
@@ -126,7 +151,8 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
                                          m_group->getNumMembers(),
                                          m_deltaT,
                                          rescalingFactors[1],
-                                         m_tuner_angular_one->getParam()[0]);
+                                         block_size,
+                                         sum_kinetic_energy ? d_partial_ke_rot.data : nullptr);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -136,6 +162,9 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
     // advance thermostat
     if (m_thermostat)
         {
+        if (sum_kinetic_energy)
+            setThermostatKineticEnergy(n_partial, n_partial_rot);
+
         m_thermostat->advanceThermostat(timestep, m_deltaT, m_aniso);
         }
     }
@@ -153,6 +182,11 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
                                         ? m_thermostat->getRescalingFactorsTwo(timestep, m_deltaT)
                                         : std::array<Scalar, 2> {1., 1.};
 
+    // sum the kinetic energy for the thermostat while updating the velocities
+    const bool sum_kinetic_energy = m_thermostat && m_thermostat->needsKineticEnergyStepTwo();
+    unsigned int n_partial = 0;
+    unsigned int n_partial_rot = 0;
+
         {
         ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
                                    access_location::device,
@@ -164,6 +198,15 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
 
         m_exec_conf->setDevice();
 
+        // one partial sum of the kinetic energy per block
+        const unsigned int block_size = m_tuner_two->getParam()[0];
+        n_partial = group_size / block_size + 1;
+        if (sum_kinetic_energy && m_partial_ke.getNumElements() < n_partial)
+            m_partial_ke.resize(n_partial);
+        ArrayHandle<Scalar> d_partial_ke(m_partial_ke,
+                                         access_location::device,
+                                         access_mode::overwrite);
+
         // perform the update on the GPU
         m_tuner_two->begin();
         kernel::gpu_nvt_rescale_step_two(d_vel.data,
@@ -171,9 +214,10 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
                                          d_index_array.data,
                                          group_size,
                                          d_net_force.data,
-                                         m_tuner_two->getParam()[0],
+                                         block_size,
                                          m_deltaT,
-                                         rescalingFactors[0]);
+                                         rescalingFactors[0],
+                                         sum_kinetic_energy ? d_partial_ke.data : nullptr);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -196,6 +240,14 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
                                        access_location::device,
                                        access_mode::read);
 
+        const unsigned int block_size = m_tuner_angular_two->getParam()[0];
+        n_partial_rot = group_size / block_size + 1;
+        if (sum_kinetic_energy && m_partial_ke_rot.getNumElements() < n_partial_rot)
+            m_partial_ke_rot.resize(n_partial_rot);
+        ArrayHandle<Scalar> d_partial_ke_rot(m_partial_ke_rot,
+                                             access_location::device,
+                                             access_mode::overwrite);
+
         m_tuner_angular_two->begin();
         kernel::gpu_nve_angular_step_two(d_orientation.data,
                                          d_angmom.data,
@@ -205,12 +257,53 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
                                          m_group->getNumMembers(),
                                          m_deltaT,
                                          rescalingFactors[1],
-                                         m_tuner_angular_two->getParam()[0]);
+                                         block_size,
+                                         sum_kinetic_energy ? d_partial_ke_rot.data : nullptr);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         m_tuner_angular_two->end();
         }
+
+    if (sum_kinetic_energy)
+        {
+        setThermostatKineticEnergy(n_partial, n_partial_rot);
+        }
+    }
+
+/** @param n_partial Number of partial sums of the translational kinetic energy.
+    @param n_partial_rot Number of partial sums of the rotational kinetic energy (0 when the
+           rotational degrees of freedom are not integrated).
+*/
+void TwoStepConstantVolumeGPU::setThermostatKineticEnergy(unsigned int n_partial,
+                                                          unsigned int n_partial_rot)
+    {
+    double ke_translational = 0.0;
+    double ke_rotational = 0.0;
+
+        {
+        ArrayHandle<Scalar> h_partial_ke(m_partial_ke,
+                                         access_location::host,
+                                         access_mode::read,
+                                         0,
+                                         n_partial);
+        for (unsigned int i = 0; i < n_partial; i++)
+            ke_translational += h_partial_ke.data[i];
+        }
+
+    if (n_partial_rot > 0)
+        {
+        ArrayHandle<Scalar> h_partial_ke_rot(m_partial_ke_rot,
+                                             access_location::host,
+                                             access_mode::read,
+                                             0,
+                                             n_partial_rot);
+        for (unsigned int i = 0; i < n_partial_rot; i++)
+            ke_rotational += h_partial_ke_rot.data[i];
+        }
+
+    // the kernels sum twice the kinetic energy
+    m_thermostat->setKineticEnergy(Scalar(0.5 * ke_translational), Scalar(0.5 * ke_rotational));
     }
     } // namespace hoomd::md
 
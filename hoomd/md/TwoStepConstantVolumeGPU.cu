@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "TwoStepConstantVolumeGPU.cuh"
+#include "TwoStepNVEGPU.cuh"
 #include "hip/hip_runtime.h"
 #include <assert.h>
 
@@ -25,8 +26,10 @@ namespace kernel
     \param box Box dimensions for periodic boundary condition handling
     \param rescale_factor Velocity rescaling factor from thermostat
     \param deltaT Amount of real time to step forward in one time step
+    \param d_partial_ke Twice the kinetic energy summed over each block (output, may be null)
 
-    Take the first half step forward in the NVT integration.
+    Take the first half step forward in the NVT integration. Each thread integrates every
+    (gridDim.x * blockDim.x)-th member.
 
     See gpu_nve_step_one_kernel() for some performance notes on how to handle the group data reads
    efficiently.
@@ -40,13 +43,16 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
                                                 BoxDim box,
                                                 Scalar rescale_factor,
                                                 Scalar deltaT,
-                                                bool limit = false,
-                                                Scalar maximum_displacement = Scalar(0.))
+                                                bool limit,
+                                                Scalar maximum_displacement,
+                                                Scalar* d_partial_ke)
     {
-    // determine which particle this thread works on
-    int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    extern __shared__ Scalar nvt_rescale_step_one_sdata[];
+    Scalar ke = Scalar(0.0);
 
-    if (group_idx < work_size)
+    // determine which particle this thread works on
+    for (unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x; group_idx < work_size;
+         group_idx += gridDim.x * blockDim.x)
         {
         unsigned int idx = d_group_members[group_idx];
 
@@ -83,7 +89,12 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
         d_pos[idx] = make_scalar4(pos.x, pos.y, pos.z, postype.w);
         d_vel[idx] = make_scalar4(vel.x, vel.y, vel.z, velmass.w);
         d_image[idx] = image;
+
+        ke += velmass.w * dot(vel, vel);
         }
+
+    if (d_partial_ke)
+        gpu_block_partial_sum(ke, nvt_rescale_step_one_sdata, d_partial_ke);
     }
 
 /*! \param d_pos array of particle positions
@@ -96,6 +107,10 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
     \param block_size Size of the block to run
     \param rescale_factor Thermostat rescaling factor
     \param deltaT Amount of real time to step forward in one time step
+    \param use_limit Limit the displacement of the particles
+    \param maximum_displacement Largest displacement in one step when \a use_limit is true
+    \param d_partial_ke Twice the kinetic energy summed over each block (output, may be null).
+           Holds group_size / block_size + 1 elements.
 */
 hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     Scalar4* d_vel,
@@ -108,7 +123,8 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     Scalar rescale_factor,
                                     Scalar deltaT,
                                     bool use_limit,
-                                    Scalar maximum_displacement)
+                                    Scalar maximum_displacement,
+                                    Scalar* d_partial_ke)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -119,15 +135,16 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
 
     unsigned int nwork = group_size;
 
-    // setup the grid to run the kernel
-    dim3 grid((nwork / run_block_size) + 1, 1, 1);
+    // setup the grid to run the kernel, one partial sum per block of the requested size
+    dim3 grid((nwork / block_size) + 1, 1, 1);
     dim3 threads(run_block_size, 1, 1);
+    size_t shared_bytes = d_partial_ke ? sizeof(Scalar) * run_block_size : 0;
 
     // run the kernel
     hipLaunchKernelGGL((gpu_nvt_rescale_step_one_kernel),
                        dim3(grid),
                        dim3(threads),
-                       0,
+                       shared_bytes,
                        0,
                        d_pos,
                        d_vel,
@@ -139,7 +156,8 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                        rescale_factor,
                        deltaT,
                        use_limit,
-                       maximum_displacement);
+                       maximum_displacement,
+                       d_partial_ke);
 
     return hipSuccess;
     }
@@ -151,6 +169,10 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
     \param work_size Number of members in the group for this GPU
     \param d_net_force Net force on each particle
     \param deltaT Amount of real time to step forward in one time step
+    \param rescale_factor Exponential velocity scaling factor
+    \param d_partial_ke Twice the kinetic energy summed over each block (output, may be null)
+
+    Each thread integrates every (gridDim.x * blockDim.x)-th member.
 */
 __global__ void gpu_nvt_rescale_step_two_kernel(Scalar4* d_vel,
                                                 Scalar3* d_accel,
@@ -158,12 +180,15 @@ __global__ void gpu_nvt_rescale_step_two_kernel(Scalar4* d_vel,
                                                 unsigned int work_size,
                                                 Scalar4* d_net_force,
                                                 Scalar deltaT,
-                                                Scalar rescale_factor)
+                                                Scalar rescale_factor,
+                                                Scalar* d_partial_ke)
     {
-    // determine which particle this thread works on
-    int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    extern __shared__ Scalar nvt_rescale_step_two_sdata[];
+    Scalar ke = Scalar(0.0);
 
-    if (group_idx < work_size)
+    // determine which particle this thread works on
+    for (unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x; group_idx < work_size;
+         group_idx += gridDim.x * blockDim.x)
         {
         unsigned int idx = d_group_members[group_idx];
 
@@ -188,7 +213,12 @@ __global__ void gpu_nvt_rescale_step_two_kernel(Scalar4* d_vel,
 
         // since we calculate the acceleration, we need to write it for the next step
         d_accel[idx] = accel;
+
+        ke += mass * dot(v, v);
         }
+
+    if (d_partial_ke)
+        gpu_block_partial_sum(ke, nvt_rescale_step_two_sdata, d_partial_ke);
     }
 
 /*! \param d_vel array of particle velocities
@@ -199,6 +229,8 @@ __global__ void gpu_nvt_rescale_step_two_kernel(Scalar4* d_vel,
     \param block_size Size of the block to execute on the device
     \param deltaT Amount of real time to step forward in one time step
     \param rescale_factor Exponential velocity scaling factor
+    \param d_partial_ke Twice the kinetic energy summed over each block (output, may be null).
+           Holds group_size / block_size + 1 elements.
 */
 hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     Scalar3* d_accel,
@@ -207,7 +239,8 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     Scalar4* d_net_force,
                                     unsigned int block_size,
                                     Scalar deltaT,
-                                    Scalar rescale_factor)
+                                    Scalar rescale_factor,
+                                    Scalar* d_partial_ke)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -218,15 +251,16 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
 
     unsigned int nwork = group_size;
 
-    // setup the grid to run the kernel
-    dim3 grid((nwork / run_block_size) + 1, 1, 1);
+    // setup the grid to run the kernel, one partial sum per block of the requested size
+    dim3 grid((nwork / block_size) + 1, 1, 1);
     dim3 threads(run_block_size, 1, 1);
+    size_t shared_bytes = d_partial_ke ? sizeof(Scalar) * run_block_size : 0;
 
     // run the kernel
     hipLaunchKernelGGL((gpu_nvt_rescale_step_two_kernel),
                        dim3(grid),
                        dim3(threads),
-                       0,
+                       shared_bytes,
                        0,
                        d_vel,
                        d_accel,
@@ -234,7 +268,8 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                        nwork,
                        d_net_force,
                        deltaT,
-                       rescale_factor);
+                       rescale_factor,
+                       d_partial_ke);
 
     return hipSuccess;
     }
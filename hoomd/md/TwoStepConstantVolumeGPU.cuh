@@ -25,7 +25,8 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     Scalar rescale_factor,
                                     Scalar deltaT,
                                     bool limit = false,
-                                    Scalar limit_displacement = Scalar(0.));
+                                    Scalar limit_displacement = Scalar(0.),
+                                    Scalar* d_partial_ke = nullptr);
 
 //! Kernel driver for the second part of the NVT update called by NVTUpdaterGPU
 hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
@@ -35,7 +36,8 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     Scalar4* d_net_force,
                                     unsigned int block_size,
                                     Scalar deltaT,
-                                    Scalar rescale_factor);
+                                    Scalar rescale_factor,
+                                    Scalar* d_partial_ke = nullptr);
 
     } // end namespace kernel
     } // end namespace md
@@ -25,6 +25,12 @@ class PYBIND11_EXPORT TwoStepConstantVolumeGPU : public TwoStepConstantVolume
 
     virtual void integrateStepTwo(uint64_t timestep);
 
+    /// The step kernels do not remove the momentum, ZeroMomentumUpdater does.
+    virtual bool canRemoveMomentum() const
+        {
+        return false;
+        }
+
     protected:
     /// Autotuner for block size (step one kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_one;
@@ -37,6 +43,15 @@ class PYBIND11_EXPORT TwoStepConstantVolumeGPU : public TwoStepConstantVolume
 
     /// Autotuner_angular for block size (angular step two kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_angular_two;
+
+    /// Twice the translational kinetic energy summed over each block of the step kernels.
+    GPUArray<Scalar> m_partial_ke;
+
+    /// Twice the rotational kinetic energy summed over each block of the angular step kernels.
+    GPUArray<Scalar> m_partial_ke_rot;
+
+    /// Sum the partial kinetic energies and pass them to the thermostat.
+    void setThermostatKineticEnergy(unsigned int n_partial, unsigned int n_partial_rot);
     };
     } // namespace hoomd::md
 #endif // HOOMD_TWOSTEPCONSTANTVOLUMEGPU_H
@@ -6,6 +6,8 @@
 #include "hoomd/RandomNumbers.h"
 #include "hoomd/VectorMath.h"
 
+#include <vector>
+
 #ifdef ENABLE_MPI
 #include "hoomd/HOOMDMPI.h"
 #endif
@@ -245,6 +247,23 @@ void TwoStepLangevin::integrateStepTwo(uint64_t timestep)
     // v(t+deltaT) = v(t+deltaT/2) + 1/2 * a(t+deltaT)*deltaT
     uint16_t seed = m_sysdef->getSeed();
 
+    // the noise amplitudes only depend on the particle type, compute them once per step
+    const unsigned int n_types = (unsigned int)m_gamma.getNumElements();
+    std::vector<Scalar> coeff(n_types, Scalar(0.0));
+    std::vector<Scalar3> sigma_r(n_types, make_scalar3(0.0, 0.0, 0.0));
+    for (unsigned int type = 0; type < n_types; type++)
+        {
+        if (!m_noiseless_t)
+            coeff[type] = fast::sqrt(Scalar(6.0) * h_gamma.data[type] * currentTemp / m_deltaT);
+
+        Scalar3 gamma_r = h_gamma_r.data[type];
+        if (m_aniso && !m_noiseless_r)
+            sigma_r[type]
+                = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * currentTemp / m_deltaT),
+                               fast::sqrt(Scalar(2.0) * gamma_r.y * currentTemp / m_deltaT),
+                               fast::sqrt(Scalar(2.0) * gamma_r.z * currentTemp / m_deltaT));
+        }
+
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
         unsigned int j = m_group->getMemberIndex(group_idx);
@@ -266,12 +285,9 @@ void TwoStepLangevin::integrateStepTwo(uint64_t timestep)
         gamma = h_gamma.data[type];
 
         // compute the bd force
-        Scalar coeff = fast::sqrt(Scalar(6.0) * gamma * currentTemp / m_deltaT);
-        if (m_noiseless_t)
-            coeff = Scalar(0.0);
-        Scalar bd_fx = rx * coeff - gamma * h_vel.data[j].x;
-        Scalar bd_fy = ry * coeff - gamma * h_vel.data[j].y;
-        Scalar bd_fz = rz * coeff - gamma * h_vel.data[j].z;
+        Scalar bd_fx = rx * coeff[type] - gamma * h_vel.data[j].x;
+        Scalar bd_fy = ry * coeff[type] - gamma * h_vel.data[j].y;
+        Scalar bd_fz = rz * coeff[type] - gamma * h_vel.data[j].z;
 
         if (D < 3)
             bd_fz = Scalar(0.0);
@@ -314,16 +330,9 @@ void TwoStepLangevin::integrateStepTwo(uint64_t timestep)
                 vec3<Scalar> bf_torque;
 
                 // original Gaussian random torque
-                Scalar3 sigma_r
-                    = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * currentTemp / m_deltaT),
-                                   fast::sqrt(Scalar(2.0) * gamma_r.y * currentTemp / m_deltaT),
-                                   fast::sqrt(Scalar(2.0) * gamma_r.z * currentTemp / m_deltaT));
-                if (m_noiseless_r)
-                    sigma_r = make_scalar3(0.0, 0.0, 0.0);
-
-                Scalar rand_x = hoomd::NormalDistribution<Scalar>(sigma_r.x)(rng);
-                Scalar rand_y = hoomd::NormalDistribution<Scalar>(sigma_r.y)(rng);
-                Scalar rand_z = hoomd::NormalDistribution<Scalar>(sigma_r.z)(rng);
+                Scalar rand_x = hoomd::NormalDistribution<Scalar>(sigma_r[type_r].x)(rng);
+                Scalar rand_y = hoomd::NormalDistribution<Scalar>(sigma_r[type_r].y)(rng);
+                Scalar rand_z = hoomd::NormalDistribution<Scalar>(sigma_r[type_r].z)(rng);
 
                 // check for degenerate moment of inertia
                 bool x_zero, y_zero, z_zero;
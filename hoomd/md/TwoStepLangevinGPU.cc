@@ -49,6 +49,20 @@ TwoStepLangevinGPU::TwoStepLangevinGPU(std::shared_ptr<SystemDefinition> sysdef,
                                                5,
                                                true));
     m_autotuners.insert(m_autotuners.end(), {m_tuner_one, m_tuner_angular_one});
+
+    // allocate the storage used when integrating several methods together
+    GPUVector<unsigned int> fused_index(m_exec_conf);
+    m_fused_index.swap(fused_index);
+    GPUVector<unsigned int> fused_method(m_exec_conf);
+    m_fused_method.swap(fused_method);
+    GPUVector<unsigned int> fused_offsets(m_exec_conf);
+    m_fused_offsets.swap(fused_offsets);
+    GPUVector<Scalar> fused_gamma(m_exec_conf);
+    m_fused_gamma.swap(fused_gamma);
+    GPUVector<Scalar3> fused_gamma_r(m_exec_conf);
+    m_fused_gamma_r.swap(fused_gamma_r);
+    GPUVector<Scalar> fused_T(m_exec_conf);
+    m_fused_T.swap(fused_T);
     }
 
 /*! \param timestep Current time step
@@ -257,6 +271,299 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
         }
     }
 
+/*! \param other Method to test
+
+    TwoStepLangevinGPU methods can be fused when neither tallies the reservoir energy (the tally is
+    a per-method sum) and both apply the same noise. The remaining parameters (gamma, gamma_r, and
+    T) are set per method in the fused kernels.
+*/
+bool TwoStepLangevinGPU::canFuseWith(const IntegrationMethodTwoStep& other) const
+    {
+    auto langevin = dynamic_cast<const TwoStepLangevinGPU*>(&other);
+    if (!langevin)
+        return false;
+
+    return !m_tally && !langevin->m_tally && m_noiseless_t == langevin->m_noiseless_t
+           && m_noiseless_r == langevin->m_noiseless_r;
+    }
+
+/*! \param methods Methods to fuse
+    \returns The total number of members
+    \post m_fused_index lists the members of all methods in order and m_fused_offsets holds the
+          offset of each method's members (with the total number of members as the last entry).
+*/
+unsigned int TwoStepLangevinGPU::buildFusedIndex(
+    const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods)
+    {
+    unsigned int n_members = 0;
+    m_fused_offsets.resize(methods.size() + 1);
+        {
+        ArrayHandle<unsigned int> h_offsets(m_fused_offsets,
+                                            access_location::host,
+                                            access_mode::overwrite);
+        for (unsigned int i = 0; i < methods.size(); i++)
+            {
+            h_offsets.data[i] = n_members;
+            n_members += methods[i]->getGroup()->getNumMembers();
+            }
+        h_offsets.data[methods.size()] = n_members;
+        }
+
+    m_fused_index.resize(n_members);
+    ArrayHandle<unsigned int> d_fused_index(m_fused_index,
+                                            access_location::device,
+                                            access_mode::overwrite);
+    unsigned int offset = 0;
+    for (auto& method : methods)
+        {
+        std::shared_ptr<ParticleGroup> group = method->getGroup();
+        unsigned int group_size = group->getNumMembers();
+        ArrayHandle<unsigned int> d_index_array(group->getIndexArray(),
+                                                access_location::device,
+                                                access_mode::read);
+        hipMemcpy(d_fused_index.data + offset,
+                  d_index_array.data,
+                  sizeof(unsigned int) * group_size,
+                  hipMemcpyDeviceToDevice);
+        offset += group_size;
+        }
+
+    return n_members;
+    }
+
+/*! \param timestep Current time step
+    \param methods Methods to integrate (this method first)
+
+    The first step does not depend on the Langevin parameters, so all the methods are integrated by
+    one launch of the NVE step one kernels over the concatenated group members.
+*/
+void TwoStepLangevinGPU::integrateStepOneFused(
+    uint64_t timestep,
+    const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods)
+    {
+    unsigned int n_members = buildFusedIndex(methods);
+
+    BoxDim box = m_pdata->getBox();
+    ArrayHandle<unsigned int> d_index_array(m_fused_index,
+                                            access_location::device,
+                                            access_mode::read);
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                 access_location::device,
+                                 access_mode::readwrite);
+    ArrayHandle<int3> d_image(m_pdata->getImages(),
+                              access_location::device,
+                              access_mode::readwrite);
+
+    m_exec_conf->setDevice();
+    m_tuner_one->begin();
+    kernel::gpu_nve_step_one(d_pos.data,
+                             d_vel.data,
+                             d_accel.data,
+                             d_image.data,
+                             d_index_array.data,
+                             n_members,
+                             box,
+                             m_deltaT,
+                             false,
+                             0,
+                             false,
+                             m_tuner_one->getParam()[0]);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_one->end();
+
+    if (m_aniso)
+        {
+        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::readwrite);
+        ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+        ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                       access_location::device,
+                                       access_mode::read);
+
+        m_tuner_angular_one->begin();
+        kernel::gpu_nve_angular_step_one(d_orientation.data,
+                                         d_angmom.data,
+                                         d_inertia.data,
+                                         d_net_torque.data,
+                                         d_index_array.data,
+                                         n_members,
+                                         m_deltaT,
+                                         1.0,
+                                         m_tuner_angular_one->getParam()[0]);
+        m_tuner_angular_one->end();
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    }
+
+/*! \param timestep Current time step
+    \param methods Methods to integrate (this method first)
+
+    The per-type gammas and the temperatures of all methods are gathered into one array each and
+    the kernels select the entries of each particle's method with m_fused_method. The random forces
+    are seeded by particle tag, so the fused update matches integrating each method separately.
+*/
+void TwoStepLangevinGPU::integrateStepTwoFused(
+    uint64_t timestep,
+    const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods)
+    {
+    // the group members may have changed since the first step
+    unsigned int n_members = buildFusedIndex(methods);
+    unsigned int n_methods = (unsigned int)methods.size();
+    unsigned int n_types = (unsigned int)m_gamma.getNumElements();
+
+    m_fused_method.resize(n_members);
+    m_fused_gamma.resize(n_types * n_methods);
+    m_fused_gamma_r.resize(n_types * n_methods);
+    m_fused_T.resize(n_methods);
+
+        {
+        ArrayHandle<unsigned int> d_method(m_fused_method,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<unsigned int> d_offsets(m_fused_offsets,
+                                            access_location::device,
+                                            access_mode::read);
+        kernel::gpu_langevin_fill_method(d_method.data, d_offsets.data, n_methods, n_members);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+        {
+        ArrayHandle<Scalar> d_fused_gamma(m_fused_gamma,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        ArrayHandle<Scalar3> d_fused_gamma_r(m_fused_gamma_r,
+                                             access_location::device,
+                                             access_mode::overwrite);
+        ArrayHandle<Scalar> h_fused_T(m_fused_T, access_location::host, access_mode::overwrite);
+
+        for (unsigned int i = 0; i < n_methods; i++)
+            {
+            auto method = std::static_pointer_cast<TwoStepLangevinGPU>(methods[i]);
+            ArrayHandle<Scalar> d_gamma(method->m_gamma,
+                                        access_location::device,
+                                        access_mode::read);
+            ArrayHandle<Scalar3> d_gamma_r(method->m_gamma_r,
+                                           access_location::device,
+                                           access_mode::read);
+            hipMemcpy(d_fused_gamma.data + i * n_types,
+                      d_gamma.data,
+                      sizeof(Scalar) * n_types,
+                      hipMemcpyDeviceToDevice);
+            hipMemcpy(d_fused_gamma_r.data + i * n_types,
+                      d_gamma_r.data,
+                      sizeof(Scalar3) * n_types,
+                      hipMemcpyDeviceToDevice);
+            h_fused_T.data[i] = method->m_T->operator()(timestep);
+            }
+        }
+
+    const unsigned int D = m_sysdef->getNDimensions();
+
+    ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<Scalar> d_gamma(m_fused_gamma, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_gamma_r(m_fused_gamma_r, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_index_array(m_fused_index,
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_method(m_fused_method, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_T(m_fused_T, access_location::device, access_mode::read);
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                 access_location::device,
+                                 access_mode::readwrite);
+    ArrayHandle<unsigned int> d_tag(m_pdata->getTags(), access_location::device, access_mode::read);
+
+    // fused methods do not tally, the partial sums are not used
+    kernel::langevin_step_two_args args(d_gamma.data,
+                                        n_types,
+                                        m_T->operator()(timestep),
+                                        timestep,
+                                        m_sysdef->getSeed(),
+                                        nullptr,
+                                        nullptr,
+                                        m_block_size,
+                                        n_members / m_block_size + 1,
+                                        m_noiseless_t,
+                                        m_noiseless_r,
+                                        false,
+                                        m_exec_conf->dev_prop,
+                                        d_method.data,
+                                        d_T.data,
+                                        n_methods);
+
+    kernel::gpu_langevin_step_two(d_pos.data,
+                                  d_vel.data,
+                                  d_accel.data,
+                                  d_tag.data,
+                                  d_index_array.data,
+                                  n_members,
+                                  d_net_force.data,
+                                  args,
+                                  m_deltaT,
+                                  D);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    if (m_aniso)
+        {
+        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::read);
+        ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
+                                      access_location::device,
+                                      access_mode::readwrite);
+        ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                       access_location::device,
+                                       access_mode::read);
+
+        gpu_langevin_angular_step_two(d_pos.data,
+                                      d_orientation.data,
+                                      d_angmom.data,
+                                      d_inertia.data,
+                                      d_net_torque.data,
+                                      d_index_array.data,
+                                      d_gamma_r.data,
+                                      d_tag.data,
+                                      n_members,
+                                      args,
+                                      m_deltaT,
+                                      D,
+                                      1.0);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    }
+
 namespace detail
     {
 void export_TwoStepLangevinGPU(pybind11::module& m)
@@ -40,6 +40,10 @@ namespace kernel
     \param D Dimensionality of the system
     \param tally Boolean indicating whether energy tally is performed or not
     \param d_partial_sum_bdenergy Placeholder for the partial sum
+    \param enable_shared_cache Set to true to cache d_gamma in shared memory
+    \param d_method Method of each group member, or NULL when integrating a single method
+    \param d_T Temperature of each method (used when d_method is not NULL)
+    \param n_methods Number of methods, d_gamma lists n_types gammas for each
 
     This kernel is implemented in a very similar manner to gpu_nve_step_two_kernel(), see it for
    design details.
@@ -65,17 +69,20 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
                                              unsigned int D,
                                              bool tally,
                                              Scalar* d_partial_sum_bdenergy,
-                                             bool enable_shared_cache)
+                                             bool enable_shared_cache,
+                                             const unsigned int* d_method,
+                                             const Scalar* d_T,
+                                             unsigned int n_methods)
     {
     HIP_DYNAMIC_SHARED(char, s_data)
     Scalar* s_gammas = (Scalar*)s_data;
 
     if (enable_shared_cache)
         {
-        // read in the gammas (1 dimensional array)
-        for (int cur_offset = 0; cur_offset < n_types; cur_offset += blockDim.x)
+        // read in the gammas of all methods (1 dimensional array)
+        for (int cur_offset = 0; cur_offset < n_types * n_methods; cur_offset += blockDim.x)
             {
-            if (cur_offset + threadIdx.x < n_types)
+            if (cur_offset + threadIdx.x < n_types * n_methods)
                 s_gammas[cur_offset + threadIdx.x] = d_gamma[cur_offset + threadIdx.x];
             }
         __syncthreads();
@@ -102,6 +109,15 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
         // read in the type of our particle. A texture read of only the fourth part of the
         // position Scalar4 (where type is stored) is used.
         unsigned int typ = __scalar_as_int(d_pos[idx].w);
+
+        // select the parameters of the method that integrates this particle
+        if (d_method)
+            {
+            unsigned int method = d_method[group_idx];
+            typ += method * n_types;
+            T = d_T[method];
+            }
+
         if (enable_shared_cache)
             {
             gamma = s_gammas[typ];
@@ -238,6 +254,9 @@ gpu_bdtally_reduce_partial_sum_kernel(Scalar* d_sum, Scalar* d_partial_sum, unsi
     \param d_noiseless_r If set true, there will be no rotational noise (random torque)
     \param deltaT integration time step size
     \param D dimensionality of the system
+    \param d_method Method of each group member, or NULL when integrating a single method
+    \param d_T Temperature of each method (used when d_method is not NULL)
+    \param n_methods Number of methods, d_gamma_r lists n_types gamma_rs for each
 */
 
 __global__ void gpu_langevin_angular_step_two_kernel(const Scalar4* d_pos,
@@ -257,17 +276,20 @@ __global__ void gpu_langevin_angular_step_two_kernel(const Scalar4* d_pos,
                                                      Scalar deltaT,
                                                      unsigned int D,
                                                      Scalar scale,
-                                                     bool enable_shared_cache)
+                                                     bool enable_shared_cache,
+                                                     const unsigned int* d_method,
+                                                     const Scalar* d_T,
+                                                     unsigned int n_methods)
     {
     HIP_DYNAMIC_SHARED(char, s_data)
     Scalar3* s_gammas_r = (Scalar3*)s_data;
 
     if (enable_shared_cache)
         {
-        // read in the gamma_r, stored in s_gammas_r[0: n_type] (Pythonic convention)
-        for (int cur_offset = 0; cur_offset < n_types; cur_offset += blockDim.x)
+        // read in the gamma_r, stored in s_gammas_r[0: n_type * n_methods] (Pythonic convention)
+        for (int cur_offset = 0; cur_offset < n_types * n_methods; cur_offset += blockDim.x)
             {
-            if (cur_offset + threadIdx.x < n_types)
+            if (cur_offset + threadIdx.x < n_types * n_methods)
                 s_gammas_r[cur_offset + threadIdx.x] = d_gamma_r[cur_offset + threadIdx.x];
             }
         __syncthreads();
@@ -284,6 +306,14 @@ __global__ void gpu_langevin_angular_step_two_kernel(const Scalar4* d_pos,
         // torque update with rotational drag and noise
         unsigned int type_r = __scalar_as_int(d_pos[idx].w);
 
+        // select the parameters of the method that integrates this particle
+        if (d_method)
+            {
+            unsigned int method = d_method[group_idx];
+            type_r += method * n_types;
+            T = d_T[method];
+            }
+
         Scalar3 gamma_r;
         if (enable_shared_cache)
             {
@@ -421,7 +451,7 @@ hipError_t gpu_langevin_angular_step_two(const Scalar4* d_pos,
     dim3 grid((group_size / block_size) + 1, 1, 1);
     dim3 threads(block_size, 1, 1);
 
-    auto shared_bytes = max((sizeof(Scalar3) * langevin_args.n_types),
+    auto shared_bytes = max((sizeof(Scalar3) * langevin_args.n_types * langevin_args.n_methods),
                             (langevin_args.block_size * sizeof(Scalar)));
 
     bool enable_shared_cache = true;
@@ -455,7 +485,10 @@ hipError_t gpu_langevin_angular_step_two(const Scalar4* d_pos,
                        deltaT,
                        D,
                        scale,
-                       enable_shared_cache);
+                       enable_shared_cache,
+                       langevin_args.d_method,
+                       langevin_args.d_T,
+                       langevin_args.n_methods);
 
     return hipSuccess;
     }
@@ -490,7 +523,7 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
     dim3 threads(langevin_args.block_size, 1, 1);
     dim3 threads1(256, 1, 1);
 
-    auto shared_bytes = max((sizeof(Scalar) * langevin_args.n_types),
+    auto shared_bytes = max((sizeof(Scalar) * langevin_args.n_types * langevin_args.n_methods),
                             (langevin_args.block_size * sizeof(Scalar)));
 
     bool enable_shared_cache = true;
@@ -524,7 +557,10 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
                        D,
                        langevin_args.tally,
                        langevin_args.d_partial_sum_bdenergy,
-                       enable_shared_cache);
+                       enable_shared_cache,
+                       langevin_args.d_method,
+                       langevin_args.d_T,
+                       langevin_args.n_methods);
 
     // run the summation kernel
     if (langevin_args.tally)
@@ -540,6 +576,65 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
     return hipSuccess;
     }
 
+//! Kernel function to set the method of each member of a run of fused methods
+/*! \param d_method Method of each member (output)
+    \param d_offsets Offset of the first member of each method in the run (n_methods + 1 entries)
+    \param n_methods Number of methods in the run
+    \param n_members Total number of members
+*/
+__global__ void gpu_langevin_fill_method_kernel(unsigned int* d_method,
+                                                const unsigned int* d_offsets,
+                                                unsigned int n_methods,
+                                                unsigned int n_members)
+    {
+    unsigned int member_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (member_idx < n_members)
+        {
+        // find the last method that starts at or before this member
+        unsigned int lo = 0;
+        unsigned int hi = n_methods;
+        while (hi - lo > 1)
+            {
+            unsigned int mid = (lo + hi) / 2;
+            if (d_offsets[mid] <= member_idx)
+                lo = mid;
+            else
+                hi = mid;
+            }
+        d_method[member_idx] = lo;
+        }
+    }
+
+/*! \param d_method Method of each member (output)
+    \param d_offsets Offset of the first member of each method in the run (n_methods + 1 entries)
+    \param n_methods Number of methods in the run
+    \param n_members Total number of members
+
+    This is just a driver for gpu_langevin_fill_method_kernel(), see it for details.
+*/
+hipError_t gpu_langevin_fill_method(unsigned int* d_method,
+                                    const unsigned int* d_offsets,
+                                    unsigned int n_methods,
+                                    unsigned int n_members)
+    {
+    unsigned int block_size = 256;
+    dim3 grid((n_members / block_size) + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_langevin_fill_method_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_method,
+                       d_offsets,
+                       n_methods,
+                       n_members);
+
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -33,11 +33,15 @@ struct langevin_step_two_args
                            bool _noiseless_t,
                            bool _noiseless_r,
                            bool _tally,
-                           const hipDeviceProp_t& _devprop)
+                           const hipDeviceProp_t& _devprop,
+                           const unsigned int* _d_method = nullptr,
+                           const Scalar* _d_T = nullptr,
+                           unsigned int _n_methods = 1)
         : d_gamma(_d_gamma), n_types(_n_types), T(_T), timestep(_timestep), seed(_seed),
           d_sum_bdenergy(_d_sum_bdenergy), d_partial_sum_bdenergy(_d_partial_sum_bdenergy),
           block_size(_block_size), num_blocks(_num_blocks), noiseless_t(_noiseless_t),
-          noiseless_r(_noiseless_r), tally(_tally), devprop(_devprop)
+          noiseless_r(_noiseless_r), tally(_tally), devprop(_devprop), d_method(_d_method),
+          d_T(_d_T), n_methods(_n_methods)
         {
         }
 
@@ -54,6 +58,11 @@ struct langevin_step_two_args
     bool noiseless_r; //!<  If set true, there will be no rotational noise (random torque)
     bool tally;       //!< Set to true is bd thermal reservoir energy tally is to be performed
     const hipDeviceProp_t& devprop; //!< Device properties.
+
+    /// Method of each group member when integrating several methods together (may be NULL)
+    const unsigned int* d_method;
+    const Scalar* d_T;      //!< Temperature of each method (used when d_method is not NULL)
+    unsigned int n_methods; //!< Number of methods, d_gamma holds n_types entries per method
     };
 
 //! Kernel driver for the second part of the Langevin update called by TwoStepLangevinGPU
@@ -84,6 +93,12 @@ hipError_t gpu_langevin_angular_step_two(const Scalar4* d_pos,
                                          unsigned int D,
                                          Scalar scale);
 
+//! Kernel driver to set the method of each member of a run of fused methods
+hipError_t gpu_langevin_fill_method(unsigned int* d_method,
+                                    const unsigned int* d_offsets,
+                                    unsigned int n_methods,
+                                    unsigned int n_members);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -36,6 +36,19 @@ class PYBIND11_EXPORT TwoStepLangevinGPU : public TwoStepLangevin
     //! Performs the second step of the integration
     virtual void integrateStepTwo(uint64_t timestep);
 
+    //! Test whether this method and \a other can be integrated together in fused kernels
+    virtual bool canFuseWith(const IntegrationMethodTwoStep& other) const;
+
+    //! Performs the first step of the integration for a run of fused methods
+    virtual void
+    integrateStepOneFused(uint64_t timestep,
+                          const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods);
+
+    //! Performs the second step of the integration for a run of fused methods
+    virtual void
+    integrateStepTwoFused(uint64_t timestep,
+                          const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods);
+
     protected:
     unsigned int m_block_size;       //!< block size for partial sum memory
     unsigned int m_num_blocks;       //!< number of memory blocks reserved for partial sum memory
@@ -47,6 +60,17 @@ class PYBIND11_EXPORT TwoStepLangevinGPU : public TwoStepLangevin
 
     /// Autotuner for block size (angular step one kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_angular_one;
+
+    GPUVector<unsigned int> m_fused_index;   //!< Concatenated group members of the fused methods
+    GPUVector<unsigned int> m_fused_method;  //!< Method of each entry in m_fused_index
+    GPUVector<unsigned int> m_fused_offsets; //!< Offset of each method in m_fused_index
+    GPUVector<Scalar> m_fused_gamma;         //!< Per-type gammas of the fused methods
+    GPUVector<Scalar3> m_fused_gamma_r;      //!< Per-type gamma_rs of the fused methods
+    GPUVector<Scalar> m_fused_T;             //!< Temperature of each fused method
+
+    //! Concatenate the group members of the fused methods into m_fused_index
+    unsigned int
+    buildFusedIndex(const std::vector<std::shared_ptr<IntegrationMethodTwoStep>>& methods);
     };
 
     } // end namespace md
@@ -178,6 +178,10 @@ hipError_t gpu_nve_step_one(Scalar4* d_pos,
     \param d_group_members Device array listing the indices of the members of the group to integrate
     \param group_size Number of members in the group
     \param deltaT timestep
+    \param d_partial_ke_rot Twice the rotational kinetic energy summed over each block (output, may
+           be null)
+
+    Each thread integrates every (gridDim.x * blockDim.x)-th member.
 */
 __global__ void gpu_nve_angular_step_one_kernel(Scalar4* d_orientation,
                                                 Scalar4* d_angmom,
@@ -186,12 +190,15 @@ __global__ void gpu_nve_angular_step_one_kernel(Scalar4* d_orientation,
                                                 const unsigned int* d_group_members,
                                                 const unsigned int nwork,
                                                 Scalar deltaT,
-                                                Scalar scale)
+                                                Scalar scale,
+                                                Scalar* d_partial_ke_rot)
     {
-    // determine which particle this thread works on (MEM TRANSFER: 4 bytes)
-    int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    extern __shared__ Scalar nve_angular_step_one_sdata[];
+    Scalar ke_rot = Scalar(0.0);
 
-    if (work_idx < nwork)
+    // determine which particle this thread works on (MEM TRANSFER: 4 bytes)
+    for (unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x; work_idx < nwork;
+         work_idx += gridDim.x * blockDim.x)
         {
         const unsigned int group_idx = work_idx;
         unsigned int idx = d_group_members[group_idx];
@@ -295,7 +302,13 @@ __global__ void gpu_nve_angular_step_one_kernel(Scalar4* d_orientation,
 
         d_orientation[idx] = quat_to_scalar4(q);
         d_angmom[idx] = quat_to_scalar4(p);
+
+        if (d_partial_ke_rot)
+            ke_rot += gpu_twice_rotational_kinetic_energy(q, p, I);
         }
+
+    if (d_partial_ke_rot)
+        gpu_block_partial_sum(ke_rot, nve_angular_step_one_sdata, d_partial_ke_rot);
     }
 
 /*! \param d_orientation array of particle orientations
@@ -305,6 +318,9 @@ __global__ void gpu_nve_angular_step_one_kernel(Scalar4* d_orientation,
     \param d_group_members Device array listing the indices of the members of the group to integrate
     \param group_size Number of members in the group
     \param deltaT timestep
+    \param block_size Size of the block to run
+    \param d_partial_ke_rot Twice the rotational kinetic energy summed over each block (output, may
+           be null). Holds group_size / block_size + 1 elements.
 */
 hipError_t gpu_nve_angular_step_one(Scalar4* d_orientation,
                                     Scalar4* d_angmom,
@@ -314,7 +330,8 @@ hipError_t gpu_nve_angular_step_one(Scalar4* d_orientation,
                                     const unsigned int group_size,
                                     Scalar deltaT,
                                     Scalar scale,
-                                    const unsigned int block_size)
+                                    const unsigned int block_size,
+                                    Scalar* d_partial_ke_rot)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -325,15 +342,16 @@ hipError_t gpu_nve_angular_step_one(Scalar4* d_orientation,
 
     unsigned int nwork = group_size;
 
-    // setup the grid to run the kernel
-    dim3 grid((nwork / run_block_size) + 1, 1, 1);
+    // setup the grid to run the kernel, one partial sum per block of the requested size
+    dim3 grid((nwork / block_size) + 1, 1, 1);
     dim3 threads(run_block_size, 1, 1);
+    size_t shared_bytes = d_partial_ke_rot ? sizeof(Scalar) * run_block_size : 0;
 
     // run the kernel
     hipLaunchKernelGGL((gpu_nve_angular_step_one_kernel),
                        dim3(grid),
                        dim3(threads),
-                       0,
+                       shared_bytes,
                        0,
                        d_orientation,
                        d_angmom,
@@ -342,7 +360,8 @@ hipError_t gpu_nve_angular_step_one(Scalar4* d_orientation,
                        d_group_members,
                        nwork,
                        deltaT,
-                       scale);
+                       scale,
+                       d_partial_ke_rot);
 
     return hipSuccess;
     }
@@ -486,6 +505,10 @@ hipError_t gpu_nve_step_two(Scalar4* d_vel,
     \param d_group_members Device array listing the indices of the members of the group to integrate
     \param group_size Number of members in the group
     \param deltaT timestep
+    \param d_partial_ke_rot Twice the rotational kinetic energy summed over each block (output, may
+           be null)
+
+    Each thread integrates every (gridDim.x * blockDim.x)-th member.
 */
 __global__ void gpu_nve_angular_step_two_kernel(const Scalar4* d_orientation,
                                                 Scalar4* d_angmom,
@@ -494,12 +517,15 @@ __global__ void gpu_nve_angular_step_two_kernel(const Scalar4* d_orientation,
                                                 unsigned int* d_group_members,
                                                 const unsigned int nwork,
                                                 Scalar deltaT,
-                                                Scalar scale)
+                                                Scalar scale,
+                                                Scalar* d_partial_ke_rot)
     {
-    // determine which particle this thread works on (MEM TRANSFER: 4 bytes)
-    int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    extern __shared__ Scalar nve_angular_step_two_sdata[];
+    Scalar ke_rot = Scalar(0.0);
 
-    if (work_idx < nwork)
+    // determine which particle this thread works on (MEM TRANSFER: 4 bytes)
+    for (unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x; work_idx < nwork;
+         work_idx += gridDim.x * blockDim.x)
         {
         const unsigned int group_idx = work_idx;
         unsigned int idx = d_group_members[group_idx];
@@ -534,7 +560,13 @@ __global__ void gpu_nve_angular_step_two_kernel(const Scalar4* d_orientation,
         p += deltaT * q * t;
 
         d_angmom[idx] = quat_to_scalar4(p);
+
+        if (d_partial_ke_rot)
+            ke_rot += gpu_twice_rotational_kinetic_energy(q, p, I);
         }
+
+    if (d_partial_ke_rot)
+        gpu_block_partial_sum(ke_rot, nve_angular_step_two_sdata, d_partial_ke_rot);
     }
 
 /*! \param d_orientation array of particle orientations
@@ -544,6 +576,9 @@ __global__ void gpu_nve_angular_step_two_kernel(const Scalar4* d_orientation,
     \param d_group_members Device array listing the indices of the members of the group to integrate
     \param group_size Number of members in the group
     \param deltaT timestep
+    \param block_size Size of the block to run
+    \param d_partial_ke_rot Twice the rotational kinetic energy summed over each block (output, may
+           be null). Holds group_size / block_size + 1 elements.
 */
 hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
                                     Scalar4* d_angmom,
@@ -553,7 +588,8 @@ hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
                                     const unsigned int group_size,
                                     Scalar deltaT,
                                     Scalar scale,
-                                    const unsigned int block_size)
+                                    const unsigned int block_size,
+                                    Scalar* d_partial_ke_rot)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -564,15 +600,16 @@ hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
 
     unsigned int nwork = group_size;
 
-    // setup the grid to run the kernel
-    dim3 grid((nwork / run_block_size) + 1, 1, 1);
+    // setup the grid to run the kernel, one partial sum per block of the requested size
+    dim3 grid((nwork / block_size) + 1, 1, 1);
     dim3 threads(run_block_size, 1, 1);
+    size_t shared_bytes = d_partial_ke_rot ? sizeof(Scalar) * run_block_size : 0;
 
     // run the kernel
     hipLaunchKernelGGL((gpu_nve_angular_step_two_kernel),
                        dim3(grid),
                        dim3(threads),
-                       0,
+                       shared_bytes,
                        0,
                        d_orientation,
                        d_angmom,
@@ -581,7 +618,8 @@ hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
                        d_group_members,
                        nwork,
                        deltaT,
-                       scale);
+                       scale,
+                       d_partial_ke_rot);
 
     return hipSuccess;
     }
@@ -7,6 +7,7 @@
 
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/ParticleData.cuh"
+#include "hoomd/VectorMath.h"
 
 #ifndef __TWO_STEP_NVE_GPU_CUH__
 #define __TWO_STEP_NVE_GPU_CUH__
@@ -17,6 +18,53 @@ namespace md
     {
 namespace kernel
     {
+#ifdef __HIPCC__
+//! Sum one value per thread over the block
+/*! \param value Value of this thread
+    \param sdata blockDim.x elements of shared memory
+    \param d_partial_sums Sum of each block (output)
+
+    All threads of the block must call this function. The block size need not be a power of 2.
+*/
+__device__ inline void gpu_block_partial_sum(Scalar value, Scalar* sdata, Scalar* d_partial_sums)
+    {
+    sdata[threadIdx.x] = value;
+    __syncthreads();
+
+    unsigned int offs = 1;
+    while (offs < blockDim.x)
+        offs <<= 1;
+
+    for (offs >>= 1; offs > 0; offs >>= 1)
+        {
+        if (threadIdx.x < offs && threadIdx.x + offs < blockDim.x)
+            sdata[threadIdx.x] += sdata[threadIdx.x + offs];
+        __syncthreads();
+        }
+
+    if (threadIdx.x == 0)
+        d_partial_sums[blockIdx.x] = sdata[0];
+    }
+
+//! Get twice the rotational kinetic energy of a particle
+/*! Only the principal axes with non-zero moments of inertia contribute, as in ComputeThermo.
+ */
+__device__ inline Scalar gpu_twice_rotational_kinetic_energy(const quat<Scalar>& q,
+                                                             const quat<Scalar>& p,
+                                                             const vec3<Scalar>& I)
+    {
+    quat<Scalar> s(Scalar(0.5) * conj(q) * p);
+    Scalar result = Scalar(0.0);
+    if (I.x > 0)
+        result += s.v.x * s.v.x / I.x;
+    if (I.y > 0)
+        result += s.v.y * s.v.y / I.y;
+    if (I.z > 0)
+        result += s.v.z * s.v.z / I.z;
+    return result;
+    }
+#endif
+
 //! Kernel driver for the first part of the NVE update called by TwoStepNVEGPU
 hipError_t gpu_nve_step_one(Scalar4* d_pos,
                             Scalar4* d_vel,
@@ -52,7 +100,8 @@ hipError_t gpu_nve_angular_step_one(Scalar4* d_orientation,
                                     const unsigned int group_size,
                                     Scalar deltaT,
                                     Scalar scale,
-                                    const unsigned int block_size);
+                                    const unsigned int block_size,
+                                    Scalar* d_partial_ke_rot = nullptr);
 
 //! Kernel driver for the second part of the angular NVE update (NO_SQUISH) by TwoStepNVEPU
 hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
@@ -63,7 +112,8 @@ hipError_t gpu_nve_angular_step_two(const Scalar4* d_orientation,
                                     const unsigned int group_size,
                                     Scalar deltaT,
                                     Scalar scale,
-                                    const unsigned int block_size);
+                                    const unsigned int block_size,
+                                    Scalar* d_partial_ke_rot = nullptr);
 
     } // end namespace kernel
     } // end namespace md
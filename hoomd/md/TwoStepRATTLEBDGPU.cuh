@@ -86,6 +86,7 @@ hipError_t gpu_include_rattle_force_bd(const Scalar4* d_pos,
                                        const unsigned int* d_group_members,
                                        const unsigned int group_size,
                                        const rattle_bd_step_one_args& rattle_bd_args,
+                                       unsigned int* d_not_converged,
                                        Manifold manifold,
                                        size_t net_virial_pitch,
                                        const Scalar deltaT,
@@ -435,6 +436,7 @@ __global__ void gpu_include_rattle_force_bd_kernel(const Scalar4* d_pos,
                                                    const uint16_t seed,
                                                    const Scalar T,
                                                    const Scalar tolerance,
+                                                   unsigned int* d_not_converged,
                                                    Manifold manifold,
                                                    size_t net_virial_pitch,
                                                    const Scalar deltaT,
@@ -573,6 +575,9 @@ __global__ void gpu_include_rattle_force_bd_kernel(const Scalar4* d_pos,
 
             } while (resid > tolerance && iteration < maxiteration);
 
+        if (resid > tolerance)
+            *d_not_converged = 1;
+
         net_force.x -= mu * normal.x;
         net_force.y -= mu * normal.y;
         net_force.z -= mu * normal.z;
@@ -602,6 +607,7 @@ hipError_t gpu_include_rattle_force_bd(const Scalar4* d_pos,
                                        const unsigned int* d_group_members,
                                        const unsigned int group_size,
                                        const rattle_bd_step_one_args& rattle_bd_args,
+                                       unsigned int* d_not_converged,
                                        Manifold manifold,
                                        size_t net_virial_pitch,
                                        const Scalar deltaT,
@@ -642,6 +648,7 @@ hipError_t gpu_include_rattle_force_bd(const Scalar4* d_pos,
                        rattle_bd_args.seed,
                        rattle_bd_args.T,
                        rattle_bd_args.tolerance,
+                       d_not_converged,
                        manifold,
                        net_virial_pitch,
                        deltaT,
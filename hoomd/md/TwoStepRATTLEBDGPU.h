@@ -11,6 +11,7 @@
 #endif
 
 #include "hoomd/Autotuner.h"
+#include "hoomd/GPUFlags.h"
 
 #include <pybind11/pybind11.h>
 
@@ -52,6 +53,12 @@ template<class Manifold> class PYBIND11_EXPORT TwoStepRATTLEBDGPU : public TwoSt
 
     protected:
     unsigned int m_block_size; //!< block size
+
+    /// Set on the device when a RATTLE iteration does not converge.
+    GPUFlags<unsigned int> m_not_converged;
+
+    /// Warn when a RATTLE iteration did not converge since the last check.
+    void checkConvergence();
     };
 
 /*! \param timestep Current time step
@@ -67,7 +74,8 @@ TwoStepRATTLEBDGPU<Manifold>::TwoStepRATTLEBDGPU(std::shared_ptr<SystemDefinitio
                                                  bool noiseless_t,
                                                  bool noiseless_r,
                                                  Scalar tolerance)
-    : TwoStepRATTLEBD<Manifold>(sysdef, group, manifold, T, noiseless_t, noiseless_r, tolerance)
+    : TwoStepRATTLEBD<Manifold>(sysdef, group, manifold, T, noiseless_t, noiseless_r, tolerance),
+      m_not_converged(this->m_exec_conf)
     {
     if (!this->m_exec_conf->isCUDAEnabled())
         {
@@ -77,10 +85,28 @@ TwoStepRATTLEBDGPU<Manifold>::TwoStepRATTLEBDGPU(std::shared_ptr<SystemDefinitio
         }
 
     m_block_size = 256;
+    m_not_converged.resetFlags(0);
+    }
+
+/*! The kernels iterate each particle to convergence on the device and raise the flag when an
+    iteration stops at maxiteration.
+*/
+template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::checkConvergence()
+    {
+    if (m_not_converged.readFlags())
+        {
+        this->m_exec_conf->msg->warning()
+            << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
+            << "It is recomended to change the initial configuration or lower the step size."
+            << std::endl;
+        m_not_converged.resetFlags(0);
+        }
     }
 
 template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::integrateStepOne(uint64_t timestep)
     {
+    checkConvergence();
+
     if (this->m_box_changed)
         {
         if (!this->m_manifold.fitsInsideBox(this->m_pdata->getGlobalBox()))
@@ -209,6 +235,7 @@ template<class Manifold> void TwoStepRATTLEBDGPU<Manifold>::includeRATTLEForce(u
                                                   d_index_array.data,
                                                   group_size,
                                                   args,
+                                                  m_not_converged.getDeviceFlags(),
                                                   this->m_manifold,
                                                   net_virial_pitch,
                                                   this->m_deltaT,
@@ -99,6 +99,7 @@ hipError_t gpu_rattle_langevin_step_two(const Scalar4* d_pos,
                                         unsigned int group_size,
                                         Scalar4* d_net_force,
                                         const rattle_langevin_step_two_args& rattle_langevin_args,
+                                        unsigned int* d_not_converged,
                                         Manifold manifold,
                                         Scalar deltaT,
                                         unsigned int D);
@@ -151,6 +152,7 @@ __global__ void gpu_rattle_langevin_step_two_kernel(const Scalar4* d_pos,
                                                     uint16_t seed,
                                                     Scalar T,
                                                     Scalar tolerance,
+                                                    unsigned int* d_not_converged,
                                                     bool noiseless_t,
                                                     Manifold manifold,
                                                     Scalar deltaT,
@@ -294,6 +296,9 @@ __global__ void gpu_rattle_langevin_step_two_kernel(const Scalar4* d_pos,
 
             } while (resid * mass > tolerance && iteration < maxiteration);
 
+        if (resid * mass > tolerance)
+            *d_not_converged = 1;
+
         vel.x += (Scalar(1.0) / Scalar(2.0)) * (accel.x - mu * minv * normal.x) * deltaT;
         vel.y += (Scalar(1.0) / Scalar(2.0)) * (accel.y - mu * minv * normal.y) * deltaT;
         vel.z += (Scalar(1.0) / Scalar(2.0)) * (accel.z - mu * minv * normal.z) * deltaT;
@@ -355,6 +360,7 @@ hipError_t gpu_rattle_langevin_step_two(const Scalar4* d_pos,
                                         unsigned int group_size,
                                         Scalar4* d_net_force,
                                         const rattle_langevin_step_two_args& rattle_langevin_args,
+                                        unsigned int* d_not_converged,
                                         Manifold manifold,
                                         Scalar deltaT,
                                         unsigned int D)
@@ -393,6 +399,7 @@ hipError_t gpu_rattle_langevin_step_two(const Scalar4* d_pos,
                        rattle_langevin_args.seed,
                        rattle_langevin_args.T,
                        rattle_langevin_args.tolerance,
+                       d_not_converged,
                        rattle_langevin_args.noiseless_t,
                        manifold,
                        deltaT,
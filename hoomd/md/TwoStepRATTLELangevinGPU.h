@@ -9,6 +9,7 @@
 #include "TwoStepRATTLENVEGPU.cuh"
 
 #include "hoomd/Autotuner.h"
+#include "hoomd/GPUFlags.h"
 
 #ifdef ENABLE_MPI
 #include "hoomd/HOOMDMPI.h"
@@ -65,6 +66,12 @@ class PYBIND11_EXPORT TwoStepRATTLELangevinGPU : public TwoStepRATTLELangevin<Ma
 
     /// Autotuner for block size (angular step one kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_angular_one;
+
+    /// Set on the device when a RATTLE iteration does not converge.
+    GPUFlags<unsigned int> m_not_converged;
+
+    /// Warn when a RATTLE iteration did not converge since the last check.
+    void checkConvergence();
     };
 
 /*! \param timestep Current time step
@@ -82,7 +89,8 @@ TwoStepRATTLELangevinGPU<Manifold>::TwoStepRATTLELangevinGPU(
     Manifold manifold,
     std::shared_ptr<Variant> T,
     Scalar tolerance)
-    : TwoStepRATTLELangevin<Manifold>(sysdef, group, manifold, T, tolerance)
+    : TwoStepRATTLELangevin<Manifold>(sysdef, group, manifold, T, tolerance),
+      m_not_converged(this->m_exec_conf)
     {
     if (!this->m_exec_conf->isCUDAEnabled())
         {
@@ -116,10 +124,29 @@ TwoStepRATTLELangevinGPU<Manifold>::TwoStepRATTLELangevinGPU(
                          true));
     this->m_autotuners.insert(this->m_autotuners.end(),
                               {m_tuner_one, m_tuner_force, m_tuner_angular_one});
+    m_not_converged.resetFlags(0);
+    }
+
+/*! The kernels iterate each particle to convergence on the device and raise the flag when an
+    iteration stops at maxiteration.
+*/
+template<class Manifold> void TwoStepRATTLELangevinGPU<Manifold>::checkConvergence()
+    {
+    if (m_not_converged.readFlags())
+        {
+        this->m_exec_conf->msg->warning()
+            << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
+            << "It is recomended to change the initial configuration or lower the step size."
+            << std::endl;
+        m_not_converged.resetFlags(0);
+        }
     }
+
 template<class Manifold>
 void TwoStepRATTLELangevinGPU<Manifold>::integrateStepOne(uint64_t timestep)
     {
+    checkConvergence();
+
     if (this->m_box_changed)
         {
         if (!this->m_manifold.fitsInsideBox(this->m_pdata->getGlobalBox()))
@@ -264,6 +291,7 @@ void TwoStepRATTLELangevinGPU<Manifold>::integrateStepTwo(uint64_t timestep)
                                                        group_size,
                                                        d_net_force.data,
                                                        args,
+                                                       m_not_converged.getDeviceFlags(),
                                                        this->m_manifold,
                                                        this->m_deltaT,
                                                        D);
@@ -364,6 +392,7 @@ void TwoStepRATTLELangevinGPU<Manifold>::includeRATTLEForce(uint64_t timestep)
                                                    net_virial_pitch,
                                                    this->m_manifold,
                                                    this->m_tolerance,
+                                                   m_not_converged.getDeviceFlags(),
                                                    this->m_deltaT,
                                                    false,
                                                    m_tuner_force->getParam()[0]);
@@ -63,6 +63,7 @@ hipError_t gpu_rattle_nve_step_two(Scalar4* d_pos,
                                    Scalar4* d_net_force,
                                    Manifold manifold,
                                    Scalar tolerance,
+                                   unsigned int* d_not_converged,
                                    Scalar deltaT,
                                    bool limit,
                                    Scalar limit_val,
@@ -90,6 +91,7 @@ hipError_t gpu_include_rattle_force_nve(const Scalar4* d_pos,
                                         size_t net_virial_pitch,
                                         Manifold manifold,
                                         Scalar tolerance,
+                                        unsigned int* d_not_converged,
                                         Scalar deltaT,
                                         bool zero_force,
                                         unsigned int block_size);
@@ -123,6 +125,7 @@ __global__ void gpu_rattle_nve_step_two_kernel(Scalar4* d_pos,
                                                Scalar4* d_net_force,
                                                Manifold manifold,
                                                Scalar tolerance,
+                                               unsigned int* d_not_converged,
                                                Scalar deltaT,
                                                bool limit,
                                                Scalar limit_val,
@@ -205,6 +208,9 @@ __global__ void gpu_rattle_nve_step_two_kernel(Scalar4* d_pos,
 
             } while (resid * mass > tolerance && iteration < maxiteration);
 
+        if (resid * mass > tolerance)
+            *d_not_converged = 1;
+
         vel.x += (Scalar(1.0) / Scalar(2.0)) * (accel.x - mu * inv_mass * normal.x) * deltaT;
         vel.y += (Scalar(1.0) / Scalar(2.0)) * (accel.y - mu * inv_mass * normal.y) * deltaT;
         vel.z += (Scalar(1.0) / Scalar(2.0)) * (accel.z - mu * inv_mass * normal.z) * deltaT;
@@ -248,6 +254,7 @@ hipError_t gpu_rattle_nve_step_two(Scalar4* d_pos,
                                    Scalar4* d_net_force,
                                    Manifold manifold,
                                    Scalar tolerance,
+                                   unsigned int* d_not_converged,
                                    Scalar deltaT,
                                    bool limit,
                                    Scalar limit_val,
@@ -281,6 +288,7 @@ hipError_t gpu_rattle_nve_step_two(Scalar4* d_pos,
                        d_net_force,
                        manifold,
                        tolerance,
+                       d_not_converged,
                        deltaT,
                        limit,
                        limit_val,
@@ -300,6 +308,7 @@ __global__ void gpu_include_rattle_force_nve_kernel(const Scalar4* d_pos,
                                                     size_t net_virial_pitch,
                                                     Manifold manifold,
                                                     Scalar tolerance,
+                                                    unsigned int* d_not_converged,
                                                     Scalar deltaT,
                                                     bool zero_force)
     {
@@ -377,6 +386,9 @@ __global__ void gpu_include_rattle_force_nve_kernel(const Scalar4* d_pos,
 
             } while (resid > tolerance && iteration < maxiteration);
 
+        if (resid > tolerance)
+            *d_not_converged = 1;
+
         accel = accel - lambda * normal;
 
         force = force - inv_mass * lambda * normal;
@@ -410,6 +422,7 @@ hipError_t gpu_include_rattle_force_nve(const Scalar4* d_pos,
                                         size_t net_virial_pitch,
                                         Manifold manifold,
                                         Scalar tolerance,
+                                        unsigned int* d_not_converged,
                                         Scalar deltaT,
                                         bool zero_force,
                                         unsigned int block_size)
@@ -443,6 +456,7 @@ hipError_t gpu_include_rattle_force_nve(const Scalar4* d_pos,
                        net_virial_pitch,
                        manifold,
                        tolerance,
+                       d_not_converged,
                        deltaT,
                        zero_force);
 
@@ -14,6 +14,7 @@
 #include "hoomd/md/TwoStepRATTLENVEGPU.cuh"
 
 #include "hoomd/Autotuner.h"
+#include "hoomd/GPUFlags.h"
 #include <utility>
 
 #ifdef ENABLE_MPI
@@ -85,6 +86,12 @@ class PYBIND11_EXPORT TwoStepRATTLENVEGPU : public TwoStepRATTLENVE<Manifold>
 
     /// Autotuner for block size (angular step two kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_angular_two;
+
+    /// Set on the device when a RATTLE iteration does not converge.
+    GPUFlags<unsigned int> m_not_converged;
+
+    /// Warn when a RATTLE iteration did not converge since the last check.
+    void checkConvergence();
     };
 
 /*! \file TwoStepRATTLENVEGPU.h
@@ -99,7 +106,8 @@ TwoStepRATTLENVEGPU<Manifold>::TwoStepRATTLENVEGPU(std::shared_ptr<SystemDefinit
                                                    std::shared_ptr<ParticleGroup> group,
                                                    Manifold manifold,
                                                    Scalar tolerance)
-    : TwoStepRATTLENVE<Manifold>(sysdef, group, manifold, tolerance)
+    : TwoStepRATTLENVE<Manifold>(sysdef, group, manifold, tolerance),
+      m_not_converged(this->m_exec_conf)
     {
     if (!this->m_exec_conf->isCUDAEnabled())
         {
@@ -132,13 +140,32 @@ TwoStepRATTLENVEGPU<Manifold>::TwoStepRATTLENVEGPU(std::shared_ptr<SystemDefinit
     this->m_autotuners.insert(
         this->m_autotuners.end(),
         {m_tuner_one, m_tuner_two, m_tuner_force, m_tuner_angular_one, m_tuner_angular_two});
+    m_not_converged.resetFlags(0);
+    }
+
+/*! The kernels iterate each particle to convergence on the device and raise the flag when an
+    iteration stops at maxiteration.
+*/
+template<class Manifold> void TwoStepRATTLENVEGPU<Manifold>::checkConvergence()
+    {
+    if (m_not_converged.readFlags())
+        {
+        this->m_exec_conf->msg->warning()
+            << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
+            << "It is recomended to change the initial configuration or lower the step size."
+            << std::endl;
+        m_not_converged.resetFlags(0);
+        }
     }
+
 /*! \param timestep Current time step
     \post Particle positions are moved forward to timestep+1 and velocities to timestep+1/2 per the
    velocity verlet method.
 */
 template<class Manifold> void TwoStepRATTLENVEGPU<Manifold>::integrateStepOne(uint64_t timestep)
     {
+    checkConvergence();
+
     // access all the needed data
     ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
                                access_location::device,
@@ -257,6 +284,7 @@ template<class Manifold> void TwoStepRATTLENVEGPU<Manifold>::integrateStepTwo(ui
                                               d_net_force.data,
                                               this->m_manifold,
                                               this->m_tolerance,
+                                              m_not_converged.getDeviceFlags(),
                                               this->m_deltaT,
                                               limit_params.first,
                                               limit_params.second,
@@ -340,6 +368,7 @@ template<class Manifold> void TwoStepRATTLENVEGPU<Manifold>::includeRATTLEForce(
                                                    net_virial_pitch,
                                                    this->m_manifold,
                                                    this->m_tolerance,
+                                                   m_not_converged.getDeviceFlags(),
                                                    this->m_deltaT,
                                                    this->m_zero_force,
                                                    m_tuner_force->getParam()[0]);
@@ -0,0 +1,178 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file WallCellList.h
+    \brief Declares the WallCellList class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "EvaluatorWalls.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Lists the walls that may interact with the particles in each cell of a grid over the box
+/*! A particle on the active side of a wall and at least r_range away from it has no interaction
+    with the wall. When the particles do not extrapolate the potential, neither does a particle on
+    the inactive side. The signed distance to a wall changes by at most the displacement, so
+    the distance from any point in a cell differs from the distance from the cell center by at
+    most the half diagonal of the cell. WallCellList drops the walls that fail this bound for a
+    whole cell from the cell's list. The lists keep the walls in their original order, so
+    EvaluatorWalls sums the same terms in the same order as it does without culling.
+
+    The lists of each cell store the indices of the spheres, then the cylinders, then the planes.
+*/
+class WallCellList
+    {
+    static_assert(MAX_N_SWALLS <= 256 && MAX_N_CWALLS <= 256 && MAX_N_PWALLS <= 256,
+                  "Wall indices must fit in unsigned char");
+
+    public:
+    //! Rebuild the lists when the walls, the box, or the interaction range changed
+    /*! \param field Walls
+        \param box Global simulation box
+        \param r_range Largest distance at which any particle type interacts with a wall
+        \param cull_inactive True when particles on the inactive side have no interaction
+    */
+    void update(const wall_type& field, const BoxDim& box, Scalar r_range, bool cull_inactive)
+        {
+        if (m_valid && box == m_box && r_range == m_r_range && cull_inactive == m_cull_inactive
+            && std::memcmp(static_cast<const void*>(&field),
+                           static_cast<const void*>(&m_field),
+                           sizeof(wall_type))
+                   == 0)
+            return;
+
+        std::memcpy(static_cast<void*>(&m_field),
+                    static_cast<const void*>(&field),
+                    sizeof(wall_type));
+        m_box = box;
+        m_r_range = r_range;
+        m_cull_inactive = cull_inactive;
+        m_valid = true;
+        build();
+        }
+
+    //! Get the walls of the cell that contains a position
+    /*! \param pos Position in the global box
+        \param n_spheres Set to the number of spheres in the list
+        \param n_cylinders Set to the number of cylinders in the list
+        \param n_planes Set to the number of planes in the list
+        \returns The wall indices, or nullptr when the position is outside of the grid
+    */
+    const unsigned char* getWalls(const Scalar3& pos,
+                                  unsigned int& n_spheres,
+                                  unsigned int& n_cylinders,
+                                  unsigned int& n_planes) const
+        {
+        const Scalar3 f = m_box.makeFraction(pos);
+        if (f.x < Scalar(0.0) || f.x >= Scalar(1.0) || f.y < Scalar(0.0) || f.y >= Scalar(1.0)
+            || f.z < Scalar(0.0) || f.z >= Scalar(1.0))
+            return nullptr;
+
+        const unsigned int i = std::min((unsigned int)(f.x * m_dim.x), m_dim.x - 1);
+        const unsigned int j = std::min((unsigned int)(f.y * m_dim.y), m_dim.y - 1);
+        const unsigned int k = std::min((unsigned int)(f.z * m_dim.z), m_dim.z - 1);
+        const unsigned int cell = (k * m_dim.y + j) * m_dim.x + i;
+
+        const uint3 count = m_count[cell];
+        n_spheres = count.x;
+        n_cylinders = count.y;
+        n_planes = count.z;
+        return m_walls.data() + m_offset[cell];
+        }
+
+    private:
+    //! Build the lists of all cells
+    void build()
+        {
+        // cells about r_range wide cull well, the cap bounds the memory and the build time
+        const unsigned int max_dim = 16;
+        const Scalar3 L = m_box.getNearestPlaneDistance();
+        auto dim = [&](Scalar width)
+        {
+            if (m_r_range <= Scalar(0.0))
+                return max_dim;
+            return std::max(1u, std::min(max_dim, (unsigned int)(width / m_r_range)));
+        };
+        m_dim = make_uint3(dim(L.x), dim(L.y), dim(L.z));
+
+        const vec3<Scalar> a(m_box.getLatticeVector(0) / Scalar(m_dim.x));
+        const vec3<Scalar> b(m_box.getLatticeVector(1) / Scalar(m_dim.y));
+        const vec3<Scalar> c(m_box.getLatticeVector(2) / Scalar(m_dim.z));
+        const Scalar diagonal_sq
+            = std::max(std::max(dot(a + b + c, a + b + c), dot(a + b - c, a + b - c)),
+                       std::max(dot(a - b + c, a - b + c), dot(b + c - a, b + c - a)));
+        // pad the bound to absorb the round-off in the distances
+        const Scalar half_diagonal
+            = Scalar(0.5) * sqrt(diagonal_sq) * Scalar(1.0001) + Scalar(1e-4) * m_r_range;
+
+        const unsigned int n_cells = m_dim.x * m_dim.y * m_dim.z;
+        m_count.resize(n_cells);
+        m_offset.resize(n_cells);
+        m_walls.clear();
+
+        auto keep = [&](Scalar d)
+        {
+            return d - half_diagonal < m_r_range && !(m_cull_inactive && d + half_diagonal < 0);
+        };
+
+        for (unsigned int k = 0; k < m_dim.z; k++)
+            for (unsigned int j = 0; j < m_dim.y; j++)
+                for (unsigned int i = 0; i < m_dim.x; i++)
+                    {
+                    const unsigned int cell = (k * m_dim.y + j) * m_dim.x + i;
+                    const vec3<Scalar> center(m_box.makeCoordinates(
+                        make_scalar3((Scalar(i) + Scalar(0.5)) / Scalar(m_dim.x),
+                                     (Scalar(j) + Scalar(0.5)) / Scalar(m_dim.y),
+                                     (Scalar(k) + Scalar(0.5)) / Scalar(m_dim.z))));
+
+                    m_offset[cell] = (unsigned int)m_walls.size();
+                    uint3 count = make_uint3(0, 0, 0);
+                    for (unsigned int w = 0; w < m_field.numSpheres; w++)
+                        if (keep(distWall(m_field.Spheres[w], center)))
+                            {
+                            m_walls.push_back((unsigned char)w);
+                            count.x++;
+                            }
+                    for (unsigned int w = 0; w < m_field.numCylinders; w++)
+                        if (keep(distWall(m_field.Cylinders[w], center)))
+                            {
+                            m_walls.push_back((unsigned char)w);
+                            count.y++;
+                            }
+                    for (unsigned int w = 0; w < m_field.numPlanes; w++)
+                        if (keep(distWall(m_field.Planes[w], center)))
+                            {
+                            m_walls.push_back((unsigned char)w);
+                            count.z++;
+                            }
+                    m_count[cell] = count;
+                    }
+        }
+
+    wall_type m_field;                  //!< Walls at the last build
+    BoxDim m_box;                       //!< Box at the last build
+    Scalar m_r_range = 0;               //!< Interaction range at the last build
+    bool m_cull_inactive = false;       //!< Inactive side culling at the last build
+    bool m_valid = false;               //!< True after the first build
+    uint3 m_dim;                        //!< Number of cells in each direction
+    std::vector<uint3> m_count;         //!< Number of spheres, cylinders, and planes in each cell
+    std::vector<unsigned int> m_offset; //!< Start of the list of each cell in m_walls
+    std::vector<unsigned char> m_walls; //!< Wall indices of all cells
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
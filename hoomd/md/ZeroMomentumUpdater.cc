@@ -30,6 +30,23 @@ ZeroMomentumUpdater::ZeroMomentumUpdater(std::shared_ptr<SystemDefinition> sysde
 ZeroMomentumUpdater::~ZeroMomentumUpdater()
     {
     m_exec_conf->msg->notice(5) << "Destroying ZeroMomentumUpdater" << endl;
+    setIntegrator(nullptr);
+    }
+
+/*! \param integrator Integrator that removes the momentum in its integration steps
+ */
+void ZeroMomentumUpdater::setIntegrator(std::shared_ptr<IntegratorTwoStep> integrator)
+    {
+    if (auto previous = m_integrator.lock())
+        {
+        previous->setSumMomentum(false);
+        }
+
+    m_integrator = integrator;
+    if (integrator)
+        {
+        integrator->setSumMomentum(true);
+        }
     }
 
 /*! Perform the needed calculations to zero the system's momentum
@@ -39,6 +56,15 @@ void ZeroMomentumUpdater::update(uint64_t timestep)
     {
     Updater::update(timestep);
 
+    // let the integrator remove the momentum in its next step when it can
+    if (auto integrator = m_integrator.lock())
+        {
+        if (integrator->requestMomentumRemoval(timestep))
+            {
+            return;
+            }
+        }
+
     // calculate the average momentum
     assert(m_pdata);
 
@@ -125,7 +151,8 @@ void export_ZeroMomentumUpdater(pybind11::module& m)
     pybind11::class_<ZeroMomentumUpdater, Updater, std::shared_ptr<ZeroMomentumUpdater>>(
         m,
         "ZeroMomentumUpdater")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
+        .def("setIntegrator", &ZeroMomentumUpdater::setIntegrator);
     }
     } // end namespace detail
     } // end namespace md
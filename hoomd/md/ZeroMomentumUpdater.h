@@ -9,6 +9,7 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include "IntegratorTwoStep.h"
 #include "hoomd/Updater.h"
 
 #include <memory>
@@ -26,6 +27,12 @@ namespace md
 /*! This simple updater just calculate the linear momentum of the system and subtracts it from every
    particle to zero it.
 
+    When given an integrator with setIntegrator(), the updater asks the integrator to remove the
+    momentum instead. The integrator sums the momentum while it updates the velocities in the
+    second step and subtracts it while it updates them in the next first step, which saves the two
+    passes over the particles. The updater falls back to its own passes on the steps where the
+    integrator cannot do this.
+
     \ingroup updaters
 */
 class PYBIND11_EXPORT ZeroMomentumUpdater : public Updater
@@ -37,6 +44,12 @@ class PYBIND11_EXPORT ZeroMomentumUpdater : public Updater
 
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
+
+    //! Set the integrator that removes the momentum (may be null)
+    void setIntegrator(std::shared_ptr<IntegratorTwoStep> integrator);
+
+    private:
+    std::weak_ptr<IntegratorTwoStep> m_integrator; //!< Integrator that removes the momentum
     };
 
     } // end namespace md
@@ -85,9 +85,6 @@ class NVT(Alchemostat):
 
         period (int): Timesteps between applications of the alchemostat.
 
-    Attention:
-        `hoomd.md.alchemy.methods.NVT` does not support execution on GPUs.
-
     Attention:
         `hoomd.md.alchemy.methods.NVT` does not support MPI parallel
         simulations.
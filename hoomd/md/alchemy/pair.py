@@ -283,9 +283,6 @@ class LJGauss(BaseLJGauss, _AlchemicalPairForce):
     Note:
         :math:`\alpha_i` not accessed are set to 1.
 
-    Attention:
-        `hoomd.md.alchemy.pair.LJGauss` does not support execution on GPUs.
-
     Attention:
         `hoomd.md.alchemy.pair.LJGauss` does not support MPI parallel
         simulations.
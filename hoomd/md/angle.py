@@ -217,7 +217,7 @@ class Table(Angle):
         super().__init__()
         param_dict = hoomd.data.parameterdicts.ParameterDict(width=int)
         param_dict["width"] = width
-        self._param_dict = param_dict
+        self._param_dict.update(param_dict)
 
         params = TypeParameter(
             "params",
@@ -0,0 +1,75 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/NeighborListStencil.h"
+#include "hoomd/md/NeighborListTree.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/md/NeighborListGPUBinned.h"
+#include "hoomd/md/NeighborListGPUStencil.h"
+#include "hoomd/md/NeighborListGPUTree.h"
+#endif
+
+#include "hoomd/benchmark/benchmark.h"
+
+/*! \file benchmark_neighborlist.cc
+    \brief Times full neighbor list builds
+*/
+
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::benchmark;
+
+//! Time a neighbor list build with a cutoff of 2.5 and a buffer of 0.4
+template<class NL> void benchmark_neighborlist(Runner& runner, const std::string& name)
+    {
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto nlist = std::make_shared<NL>(sysdef, Scalar(0.4));
+            auto r_cut
+                = std::make_shared<GPUArray<Scalar>>(nlist->getTypePairIndexer().getNumElements(),
+                                                     runner.getExecConf());
+                {
+                ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+                h_r_cut.data[0] = Scalar(2.5);
+                }
+            nlist->addRCutMatrix(r_cut);
+
+            uint64_t timestep = 0;
+            runner.run(
+                name,
+                N,
+                density,
+                [&]()
+                {
+                    nlist->forceUpdate();
+                    nlist->compute(timestep++);
+                },
+                {nlist});
+            }
+    }
+
+int main(int argc, char** argv)
+    {
+    Runner runner("neighborlist", argc, argv);
+    if (runner.getExecConf()->getNRanks() > 1)
+        throw std::runtime_error("benchmark_neighborlist runs on one rank");
+
+#ifdef ENABLE_HIP
+    if (runner.getExecConf()->isCUDAEnabled())
+        {
+        benchmark_neighborlist<NeighborListGPUBinned>(runner, "binned_gpu");
+        benchmark_neighborlist<NeighborListGPUStencil>(runner, "stencil_gpu");
+        benchmark_neighborlist<NeighborListGPUTree>(runner, "tree_gpu");
+        return 0;
+        }
+#endif
+
+    benchmark_neighborlist<NeighborListBinned>(runner, "binned");
+    benchmark_neighborlist<NeighborListStencil>(runner, "stencil");
+    benchmark_neighborlist<NeighborListTree>(runner, "tree");
+    return 0;
+    }
@@ -0,0 +1,126 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/md/EvaluatorPairExpandedLJ.h"
+#include "hoomd/md/EvaluatorPairGauss.h"
+#include "hoomd/md/EvaluatorPairLJ.h"
+#include "hoomd/md/EvaluatorPairMorse.h"
+#include "hoomd/md/EvaluatorPairYukawa.h"
+#include "hoomd/md/NeighborListTree.h"
+#include "hoomd/md/PotentialPair.h"
+
+#include "hoomd/benchmark/benchmark.h"
+
+/*! \file benchmark_pair.cc
+    \brief Times pair evaluators alone and in PotentialPair
+*/
+
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::benchmark;
+
+//! Cutoff radius of all pair potentials
+const Scalar r_cut = Scalar(2.5);
+
+//! Receives the evaluator results so that the compiler cannot remove the timed loop
+volatile Scalar sink = 0;
+
+//! Time an evaluator on N pair distances spread evenly over (0.8, r_cut)
+/*! This case measures the arithmetic of the evaluator without memory traffic. The density does
+    not apply and is reported as 0.
+*/
+template<class evaluator>
+void benchmark_evaluator(Runner& runner,
+                         const std::string& name,
+                         const typename evaluator::param_type& param)
+    {
+    for (unsigned int N : runner.getOptions().N)
+        {
+        std::vector<Scalar> rsq(N);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const Scalar r = Scalar(0.8) + (r_cut - Scalar(0.8)) * Scalar(i) / Scalar(N);
+            rsq[i] = r * r;
+            }
+
+        Scalar total = 0;
+        runner.run("evaluator_" + name,
+                   N,
+                   0,
+                   [&]()
+                   {
+                       for (unsigned int i = 0; i < N; i++)
+                           {
+                           evaluator eval(rsq[i], r_cut * r_cut, param);
+                           Scalar force_divr = 0;
+                           Scalar pair_eng = 0;
+                           eval.evalForceAndEnergy(force_divr, pair_eng, false);
+                           total += force_divr + pair_eng;
+                           }
+                   });
+        sink = total;
+        }
+    }
+
+//! Time PotentialPair::compute() with a neighbor list that is already current
+template<class evaluator>
+void benchmark_potential(Runner& runner,
+                         const std::string& name,
+                         const typename evaluator::param_type& param)
+    {
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto nlist = std::make_shared<NeighborListTree>(sysdef, Scalar(0.4));
+            auto potential = std::make_shared<PotentialPair<evaluator>>(sysdef, nlist);
+            potential->setParams(0, 0, param);
+            potential->setRcut(0, 0, r_cut);
+
+            uint64_t timestep = 0;
+            runner.run(
+                "potential_" + name,
+                N,
+                density,
+                [&]() { potential->compute(timestep++); },
+                {potential, nlist});
+            }
+    }
+
+//! Time one evaluator both ways
+template<class evaluator>
+void benchmark_pair(Runner& runner,
+                    const std::string& name,
+                    const typename evaluator::param_type& param)
+    {
+    benchmark_evaluator<evaluator>(runner, name, param);
+    benchmark_potential<evaluator>(runner, name, param);
+    }
+
+int main(int argc, char** argv)
+    {
+    Runner runner("pair", argc, argv);
+    if (runner.getExecConf()->getNRanks() > 1)
+        throw std::runtime_error("benchmark_pair runs on one rank");
+    if (runner.getExecConf()->isCUDAEnabled())
+        throw std::runtime_error("benchmark_pair runs on the CPU");
+
+    benchmark_pair<EvaluatorPairLJ>(runner,
+                                    "lj",
+                                    EvaluatorPairLJ::param_type(Scalar(1.0), Scalar(1.0)));
+    benchmark_pair<EvaluatorPairExpandedLJ>(
+        runner,
+        "expanded_lj",
+        EvaluatorPairExpandedLJ::param_type(Scalar(1.0), Scalar(1.0), Scalar(0.1)));
+    benchmark_pair<EvaluatorPairGauss>(runner,
+                                       "gauss",
+                                       EvaluatorPairGauss::param_type(Scalar(1.0), Scalar(1.0)));
+    benchmark_pair<EvaluatorPairYukawa>(runner,
+                                        "yukawa",
+                                        EvaluatorPairYukawa::param_type(Scalar(1.0), Scalar(1.0)));
+    benchmark_pair<EvaluatorPairMorse>(
+        runner,
+        "morse",
+        EvaluatorPairMorse::param_type(Scalar(1.0), Scalar(3.0), Scalar(1.0)));
+    return 0;
+    }
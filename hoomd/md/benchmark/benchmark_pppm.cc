@@ -0,0 +1,102 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/filter/ParticleFilterAll.h"
+#include "hoomd/md/NeighborListTree.h"
+#include "hoomd/md/PPPMForceCompute.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/md/PPPMForceComputeGPU.h"
+#endif
+
+#include "hoomd/benchmark/benchmark.h"
+
+/*! \file benchmark_pppm.cc
+    \brief Times the stages of the PPPM long range force
+*/
+
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::benchmark;
+
+//! Give the benchmark access to the individual PPPM stages
+template<class PPPM> class PPPMStages : public PPPM
+    {
+    public:
+    using PPPM::PPPM;
+    using PPPM::assignParticles;
+    using PPPM::interpolateForces;
+    using PPPM::updateMeshes;
+    };
+
+//! Time the charge assignment, mesh solve, force interpolation, and complete force computation
+/*! The mesh has about one point per particle and the assignment order is 5.
+ */
+template<class PPPM> void benchmark_pppm(Runner& runner, const std::string& suffix)
+    {
+    for (unsigned int N : runner.getOptions().N)
+        for (double density : runner.getOptions().density)
+            {
+            auto sysdef = makeSystem(N, density, runner.getExecConf());
+            auto pdata = sysdef->getParticleData();
+                {
+                ArrayHandle<Scalar> h_charge(pdata->getCharges(),
+                                             access_location::host,
+                                             access_mode::overwrite);
+                for (unsigned int i = 0; i < pdata->getN(); i++)
+                    h_charge.data[i] = i % 2 == 0 ? Scalar(1.0) : Scalar(-1.0);
+                }
+
+            auto nlist = std::make_shared<NeighborListTree>(sysdef, Scalar(0.4));
+            auto group
+                = std::make_shared<ParticleGroup>(sysdef, std::make_shared<ParticleFilterAll>());
+            auto pppm = std::make_shared<PPPMStages<PPPM>>(sysdef, nlist, group);
+
+            const unsigned int n_mesh = (unsigned int)std::ceil(std::cbrt(double(N)));
+            pppm->setParams(n_mesh, n_mesh, n_mesh, 5, Scalar(1.0), Scalar(2.5));
+
+            // compute once to set up the mesh, coefficients, and influence function
+            pppm->compute(0);
+
+            runner.run("assign_particles" + suffix,
+                       N,
+                       density,
+                       [&]() { pppm->assignParticles(); },
+                       {pppm});
+            runner.run("update_meshes" + suffix,
+                       N,
+                       density,
+                       [&]() { pppm->updateMeshes(); },
+                       {pppm});
+            runner.run("interpolate_forces" + suffix,
+                       N,
+                       density,
+                       [&]() { pppm->interpolateForces(); },
+                       {pppm});
+
+            uint64_t timestep = 1;
+            runner.run("compute" + suffix,
+                       N,
+                       density,
+                       [&]() { pppm->compute(timestep++); },
+                       {pppm});
+            }
+    }
+
+int main(int argc, char** argv)
+    {
+    Runner runner("pppm", argc, argv);
+    if (runner.getExecConf()->getNRanks() > 1)
+        throw std::runtime_error("benchmark_pppm runs on one rank");
+
+#ifdef ENABLE_HIP
+    if (runner.getExecConf()->isCUDAEnabled())
+        {
+        benchmark_pppm<PPPMForceComputeGPU>(runner, "_gpu");
+        return 0;
+        }
+#endif
+
+    benchmark_pppm<PPPMForceCompute>(runner, "");
+    return 0;
+    }
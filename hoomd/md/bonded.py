@@ -0,0 +1,313 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+r"""Fused bonded force classes apply the bond, angle, and dihedral forces of
+a molecular model in a single force compute.
+
+.. math::
+
+    U_\mathrm{bonded} = \sum_{(j,k) \in \mathrm{bonds}} U_{jk}(r)
+    + \sum_{(i,j,k) \in \mathrm{angles}} U_{ijk}(\theta)
+    + \sum_{(i,j,k,l) \in \mathrm{dihedrals}} U_{ijkl}(\phi)
+
+The bond potential :math:`U_{jk}(r)` is that of the named class in
+`hoomd.md.bond`. Each class uses the harmonic angle potential of
+`hoomd.md.angle.Harmonic` and the periodic dihedral potential of
+`hoomd.md.dihedral.Periodic`. See `hoomd.md.bond`, `hoomd.md.angle`, and
+`hoomd.md.dihedral` for the definitions of :math:`r`, :math:`\theta`, and
+:math:`\phi`.
+
+The forces in `hoomd.md.bond`, `hoomd.md.angle`, and `hoomd.md.dihedral` each
+compute and store their own per-particle force array. Fused bonded forces
+compute all three terms in one pass over the bonded groups of each particle and
+store one force array. This reduces the number of GPU kernel launches and the
+memory traffic per step, which is significant when there is little work per
+bonded group, such as in bead-spring polymer models.
+
+.. rubric:: Per-particle energies and virials
+
+Fused bonded forces assign 1/2 of the bond energy, 1/3 of the angle energy,
+and 1/4 of the dihedral energy to each of the particles in the group, and
+similarly for virials. The resulting per-particle energies and virials are the
+sums of those computed by the separate forces.
+
+Tip:
+    Set the angle (dihedral) parameter ``k`` to 0 for angle (dihedral) types
+    that do not interact.
+"""
+
+from hoomd.md import _md
+from hoomd.md.force import Force
+from hoomd.data.typeparam import TypeParameter
+from hoomd.data.parameterdicts import TypeParameterDict
+import hoomd
+
+
+class Bonded(Force):
+    r"""Base class fused bonded force.
+
+    `Bonded` is the base class for all fused bonded forces.
+
+    Warning:
+        This class should not be instantiated by users. The class can be used
+        for `isinstance` or `issubclass` checks.
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Bonded`:
+
+    .. py:attribute:: angle_params
+
+        The parameters of the harmonic angles for each angle type (see
+        `hoomd.md.angle.Harmonic`). The dictionary has the following keys:
+
+        * ``k`` (`float`, **required**) - potential constant :math:`k`
+          :math:`[\mathrm{energy} \cdot \mathrm{radians}^{-2}]`
+
+        * ``t0`` (`float`, **required**) - rest angle :math:`\theta_0`
+          :math:`[\mathrm{radians}]`
+
+        Type: `TypeParameter` [``angle type``, `dict`]
+
+    .. py:attribute:: dihedral_params
+
+        The parameters of the periodic dihedrals for each dihedral type (see
+        `hoomd.md.dihedral.Periodic`). The dictionary has the following keys:
+
+        * ``k`` (`float`, **required**) - potential constant :math:`k`
+          :math:`[\mathrm{energy}]`
+        * ``d`` (`float`, **required**) - sign factor :math:`d`
+        * ``n`` (`int`, **required**) - angle multiplicity factor :math:`n`
+        * ``phi0`` (`float`, **required**) - phase shift :math:`\phi_0`
+          :math:`[\mathrm{radians}]`
+
+        Type: `TypeParameter` [``dihedral type``, `dict`]
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Force._doc_inherited)
+    _doc_inherited = (
+        Force._doc_inherited
+        + """
+    ----------
+
+    **Members inherited from**
+    `Bonded <hoomd.md.bonded.Bonded>`:
+
+    .. py:attribute:: angle_params
+
+        The parameters of the harmonic angles for each angle type.
+        `Read more... <hoomd.md.bonded.Bonded.angle_params>`
+
+    .. py:attribute:: dihedral_params
+
+        The parameters of the periodic dihedrals for each dihedral type.
+        `Read more... <hoomd.md.bonded.Bonded.dihedral_params>`
+    """
+    )
+
+    # Module where the C++ class is defined. Reassign this when developing an
+    # external plugin.
+    _ext_module = _md
+
+    def __init__(self):
+        super().__init__()
+        angle_params = TypeParameter(
+            "angle_params",
+            "angle_types",
+            TypeParameterDict(k=float, t0=float, len_keys=1),
+        )
+        dihedral_params = TypeParameter(
+            "dihedral_params",
+            "dihedral_types",
+            TypeParameterDict(k=float, d=float, n=int, phi0=float, len_keys=1),
+        )
+        self._extend_typeparam([angle_params, dihedral_params])
+
+    def _attach_hook(self):
+        """Create the c++ mirror class."""
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_cls = getattr(self._ext_module, self._cpp_class_name)
+        else:
+            cpp_cls = getattr(self._ext_module, self._cpp_class_name + "GPU")
+
+        self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def)
+
+
+class Harmonic(Bonded):
+    r"""Harmonic bonds with harmonic angles and periodic dihedrals.
+
+    `Harmonic` computes forces, virials, and energies on all bonds, angles,
+    and dihedrals in the simulation state. The bond potential is that of
+    `hoomd.md.bond.Harmonic`:
+
+    .. math::
+
+        U(r) = \frac{1}{2} k \left( r - r_0 \right)^2
+
+    Example::
+
+        bonded = hoomd.md.bonded.Harmonic()
+        bonded.bond_params["A-A"] = dict(k=1000.0, r0=1.0)
+        bonded.angle_params["A-A-A"] = dict(k=10.0, t0=math.pi)
+        bonded.dihedral_params["A-A-A-A"] = dict(k=1.0, d=1, n=1, phi0=0)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Harmonic`:
+
+    Attributes:
+        bond_params (TypeParameter[``bond type``, dict]):
+            The parameters of the harmonic bonds for each bond type.
+            The dictionary has the following keys:
+
+            * ``k`` (`float`, **required**) - potential constant
+              :math:`[\mathrm{energy} \cdot \mathrm{length}^{-2}]`
+
+            * ``r0`` (`float`, **required**) - rest length
+              :math:`[\mathrm{length}]`
+    """
+
+    _cpp_class_name = "FusedBondedForceComputeHarmonic"
+    __doc__ = __doc__.replace("{inherited}", Bonded._doc_inherited)
+
+    def __init__(self):
+        super().__init__()
+        bond_params = TypeParameter(
+            "bond_params",
+            "bond_types",
+            TypeParameterDict(k=float, r0=float, len_keys=1),
+        )
+        self._add_typeparam(bond_params)
+
+
+class FENEWCA(Bonded):
+    r"""FENE and WCA bonds with harmonic angles and periodic dihedrals.
+
+    `FENEWCA` computes forces, virials, and energies on all bonds, angles,
+    and dihedrals in the simulation state. The bond potential is that of
+    `hoomd.md.bond.FENEWCA`:
+
+    .. math::
+
+        V(r) = - \frac{1}{2} k r_0^2 \ln \left( 1 - \left( \frac{r -
+               \Delta}{r_0} \right)^2 \right) + U_{\mathrm{WCA}}(r)
+
+    Example::
+
+        bonded = hoomd.md.bonded.FENEWCA()
+        bonded.bond_params["A-A"] = dict(
+            k=30.0, r0=1.5, epsilon=1.0, sigma=1.0, delta=0.0
+        )
+        bonded.angle_params["A-A-A"] = dict(k=1.5, t0=math.pi)
+        bonded.dihedral_params["A-A-A-A"] = dict(k=0.0, d=1, n=1, phi0=0)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `FENEWCA`:
+
+    Attributes:
+        bond_params (TypeParameter[``bond type``, dict]):
+            The parameters of the FENEWCA bonds for each bond type.
+            The dictionary has the following keys:
+
+            * ``k`` (`float`, **required**) - attractive force strength
+              :math:`k` :math:`[\mathrm{energy} \cdot \mathrm{length}^{-2}]`.
+
+            * ``r0`` (`float`, **required**) - size parameter
+              :math:`r_0` :math:`[\mathrm{length}]`.
+
+            * ``epsilon`` (`float`, **required**) - repulsive force strength
+              :math:`\varepsilon` :math:`[\mathrm{energy}]`.
+
+            * ``sigma`` (`float`, **required**) - repulsive force interaction
+              width :math:`\sigma` :math:`[\mathrm{length}]`.
+
+            * ``delta`` (`float`, **required**) - radial shift :math:`\Delta`
+              :math:`[\mathrm{length}]`.
+    """
+
+    _cpp_class_name = "FusedBondedForceComputeFENE"
+    __doc__ = __doc__.replace("{inherited}", Bonded._doc_inherited)
+
+    def __init__(self):
+        super().__init__()
+        bond_params = TypeParameter(
+            "bond_params",
+            "bond_types",
+            TypeParameterDict(
+                k=float, r0=float, epsilon=float, sigma=float, delta=float, len_keys=1
+            ),
+        )
+        self._add_typeparam(bond_params)
+
+
+class Tether(Bonded):
+    r"""Tether bonds with harmonic angles and periodic dihedrals.
+
+    `Tether` computes forces, virials, and energies on all bonds, angles,
+    and dihedrals in the simulation state. The bond potential is that of
+    `hoomd.md.bond.Tether`.
+
+    Example::
+
+        bonded = hoomd.md.bonded.Tether()
+        bonded.bond_params["A-A"] = dict(
+            k_b=10.0, l_min=0.9, l_c1=1.2, l_c0=1.8, l_max=2.1
+        )
+        bonded.angle_params["A-A-A"] = dict(k=0.0, t0=math.pi)
+        bonded.dihedral_params["A-A-A-A"] = dict(k=0.0, d=1, n=1, phi0=0)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Tether`:
+
+    Attributes:
+        bond_params (TypeParameter[``bond type``, dict]):
+            The parameters of the tether bonds for each bond type.
+            The dictionary has the following keys:
+
+            * ``k_b`` (`float`, **required**) - bond stiffness
+              :math:`[\mathrm{energy}]`
+
+            * ``l_min`` (`float`, **required**) - minimum bond length
+              :math:`[\mathrm{length}]`
+
+            * ``l_c1`` (`float`, **required**) - cutoff distance of repulsive
+              part :math:`[\mathrm{length}]`
+
+            * ``l_c0`` (`float`, **required**) - cutoff distance of attractive
+              part :math:`[\mathrm{length}]`
+
+            * ``l_max`` (`float`, **required**) - maximum bond length
+              :math:`[\mathrm{length}]`
+    """
+
+    _cpp_class_name = "FusedBondedForceComputeTether"
+    __doc__ = __doc__.replace("{inherited}", Bonded._doc_inherited)
+
+    def __init__(self):
+        super().__init__()
+        bond_params = TypeParameter(
+            "bond_params",
+            "bond_types",
+            TypeParameterDict(
+                k_b=float, l_min=float, l_c1=float, l_c0=float, l_max=float, len_keys=1
+            ),
+        )
+        self._add_typeparam(bond_params)
+
+
+__all__ = [
+    "FENEWCA",
+    "Bonded",
+    "Harmonic",
+    "Tether",
+]
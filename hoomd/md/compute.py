@@ -9,8 +9,10 @@ or by direct access via the Python API.
 from hoomd.md import _md
 from hoomd.operation import Compute
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes, positive_real
 from hoomd.logging import log
 import hoomd
+import numpy
 
 
 class ThermodynamicQuantities(Compute):
@@ -311,6 +313,129 @@ class ThermodynamicQuantities(Compute):
         return self._cpp_obj.volume
 
 
+class MultiGroupThermodynamicQuantities(Compute):
+    """Compute thermodynamic properties of many subsets of the system at once.
+
+    Args:
+        filters (list[hoomd.filter.filter_like]): Particle filters to compute
+            thermodynamic properties for (at most 64).
+
+    `MultiGroupThermodynamicQuantities` computes the properties that
+    `ThermodynamicQuantities` computes, plus the linear momentum, for every
+    subset in `filters`. It visits each particle once and adds its terms to
+    all subsets that select it, then sums the properties of all subsets across
+    MPI ranks in one reduction. Use it in place of many
+    `ThermodynamicQuantities` instances, for example to log the temperature
+    profile over slabs of the box. The subsets may overlap.
+
+    Each loggable quantity has one entry per filter, in the order of
+    `filters`. The sums follow the definitions in `ThermodynamicQuantities`.
+    They skip rigid body constituent particles and include the additional
+    energy and virial terms of the system in every subset.
+
+    Examples::
+
+        filters = [hoomd.filter.Tags(slab) for slab in slab_tags]
+        thermo = hoomd.md.compute.MultiGroupThermodynamicQuantities(filters)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `MultiGroupThermodynamicQuantities`:
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Compute._doc_inherited)
+
+    def __init__(self, filters):
+        super().__init__()
+        self._filters = list(filters)
+
+    @property
+    def filters(self):
+        """list[hoomd.filter.filter_like]: Particle filters to compute \
+        thermodynamic properties for (*read-only*)."""
+        return list(self._filters)
+
+    def _attach_hook(self):
+        groups = [
+            self._simulation.state._get_group(filter_) for filter_ in self._filters
+        ]
+        self._cpp_obj = _md.ComputeThermoGroups(
+            self._simulation.state._cpp_sys_def, groups
+        )
+
+    @log(category="sequence", requires_run=True)
+    def kinetic_temperature(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``float``: Instantaneous \
+        thermal energy :math:`kT_k` of each subset :math:`[\\mathrm{energy}]`.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.kinetic_temperature
+
+    @log(category="sequence", requires_run=True)
+    def pressure(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``float``: Instantaneous \
+        pressure :math:`P` of each subset :math:`[\\mathrm{pressure}]`.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.pressure
+
+    @log(category="array", requires_run=True)
+    def pressure_tensor(self):
+        """(*N_filters*, 6) `numpy.ndarray` of ``float``: Instantaneous \
+        pressure tensor of each subset :math:`[\\mathrm{pressure}]`.
+
+        The components are in the order of
+        `ThermodynamicQuantities.pressure_tensor`.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.pressure_tensor
+
+    @log(category="sequence", requires_run=True)
+    def kinetic_energy(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``float``: Total kinetic \
+        energy :math:`K` of each subset :math:`[\\mathrm{energy}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.kinetic_energy
+
+    @log(category="sequence", requires_run=True)
+    def translational_kinetic_energy(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``float``: Translational \
+        kinetic energy of each subset :math:`[\\mathrm{energy}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.translational_kinetic_energy
+
+    @log(category="sequence", requires_run=True)
+    def rotational_kinetic_energy(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``float``: Rotational \
+        kinetic energy of each subset :math:`[\\mathrm{energy}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.rotational_kinetic_energy
+
+    @log(category="sequence", requires_run=True)
+    def potential_energy(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``float``: Potential energy \
+        that each subset contributes to the system :math:`[\\mathrm{energy}]`.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.potential_energy
+
+    @log(category="array", requires_run=True)
+    def momentum(self):
+        """(*N_filters*, 3) `numpy.ndarray` of ``float``: Linear momentum \
+        :math:`\\sum_{i \\in \\mathrm{filter}} m_i \\vec{v}_i` of each subset \
+        :math:`[\\mathrm{mass} \\cdot \\mathrm{velocity}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.momentum
+
+    @log(category="sequence", requires_run=True)
+    def num_particles(self):
+        """(*N_filters*, ) `numpy.ndarray` of ``int``: Number of particles \
+        in each subset."""
+        return self._cpp_obj.num_particles
+
+
 class HarmonicAveragedThermodynamicQuantities(Compute):
     """Compute harmonic averaged thermodynamic properties of particles.
 
@@ -399,7 +524,229 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         return self._cpp_obj.pressure
 
 
+class RDF(Compute):
+    r"""Compute the radial distribution function from a neighbor list.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list that provides the
+            particle pairs.
+        r_max (float): Largest distance in the histogram
+            :math:`[\mathrm{length}]`.
+        bins (int): Number of bins in the histogram.
+
+    `RDF` computes the radial distribution function
+
+    .. math::
+
+        g(r) = \frac{V}{N^2} \sum_{i=1}^N \sum_{j \ne i}
+            \frac{\delta(r - |\vec{r}_{ij}|)}{4 \pi r^2}
+
+    in `bins` histogram bins of width :math:`r_\mathrm{max} / N_\mathrm{bins}`
+    (in 2D, :math:`4 \pi r^2` is :math:`2 \pi r` and :math:`V` is the area).
+    :math:`\vec{r}_{ij}` is the minimum image vector between particles
+    :math:`i` and :math:`j`.
+
+    `RDF` histograms the pairs in `nlist` in C++ (or on the GPU) without copying
+    the particle data to Python. Share the neighbor list with the pair
+    potentials to reuse the list they build each step. `RDF` extends the
+    neighbor list to include all pairs within `r_max`.
+
+    Note:
+        `RDF` computes :math:`g(r)` for the current configuration each time it
+        is logged. Average the logged values over many frames to reduce the
+        noise.
+
+    Attention:
+        Pairs excluded from `nlist` (see
+        `hoomd.md.nlist.NeighborList.exclusions`) are not counted.
+
+    Examples::
+
+        nl = hoomd.md.nlist.Cell(buffer=0.4)
+        rdf = hoomd.md.compute.RDF(nlist=nl, r_max=3.0, bins=150)
+        sim.operations.computes.append(rdf)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `RDF`:
+
+    Attributes:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list that provides the
+            particle pairs (*read-only*).
+
+        r_max (float): Largest distance in the histogram
+            :math:`[\mathrm{length}]` (*read-only*).
+
+        bins (int): Number of bins in the histogram (*read-only*).
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Compute._doc_inherited)
+
+    def __init__(self, nlist, r_max, bins=100):
+        super().__init__()
+        param_dict = ParameterDict(
+            nlist=hoomd.md.nlist.NeighborList,
+            r_max=OnlyTypes(float, preprocess=positive_real),
+            bins=OnlyTypes(int, preprocess=positive_real),
+        )
+        param_dict.update(dict(nlist=nlist, r_max=r_max, bins=bins))
+        self._param_dict.update(param_dict)
+
+    def _attach_hook(self):
+        self.nlist._attach(self._simulation)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_cls = _md.ComputeRDF
+            self.nlist._cpp_obj.setStorageMode(_md.NeighborList.storageMode.half)
+        else:
+            cpp_cls = _md.ComputeRDFGPU
+            self.nlist._cpp_obj.setStorageMode(_md.NeighborList.storageMode.full)
+        self._cpp_obj = cpp_cls(
+            self._simulation.state._cpp_sys_def,
+            self.nlist._cpp_obj,
+            self.r_max,
+            self.bins,
+        )
+
+    def _detach_hook(self):
+        self.nlist._detach()
+
+    @log(category="sequence", requires_run=True)
+    def rdf(self):
+        """(*bins*,) `numpy.ndarray` of `float`: :math:`g(r)` at the bin \
+        centers.
+
+        See Also:
+            `r` defines the bin center locations.
+
+        Attention:
+            In MPI parallel execution, the array is available on rank 0 only.
+            `rdf` is `None` on ranks >= 1.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.rdf
+
+    @log(category="sequence")
+    def r(self):
+        """(*bins*,) `numpy.ndarray` of `float`: The bin centers \
+        :math:`[\mathrm{length}]`."""
+        dr = self.r_max / self.bins
+        return numpy.arange(self.bins) * dr + dr / 2
+
+
+class SteinhardtOrder(Compute):
+    r"""Compute Steinhardt bond order parameters from a neighbor list.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list that provides the
+            bonds.
+        r_max (float): Largest bond length :math:`[\mathrm{length}]`.
+        l (list[int]): Spherical harmonic degrees to compute the order
+            parameter for. Defaults to ``[4, 6]``.
+
+    The bonds of particle :math:`i` are the minimum image vectors
+    :math:`\vec{r}_{ij}` to the :math:`N_b(i)` particles :math:`j` closer than
+    `r_max`. `SteinhardtOrder` computes the local bond order parameter
+
+    .. math::
+
+        q_l(i) = \sqrt{\frac{4 \pi}{2l + 1} \sum_{m=-l}^{l}
+            \left| \frac{1}{N_b(i)} \sum_{j} Y_l^m(\theta_{ij}, \phi_{ij})
+            \right|^2}
+
+    of each particle for every degree :math:`l` in `l`, where :math:`Y_l^m`
+    are the spherical harmonics and :math:`\theta_{ij}` and :math:`\phi_{ij}`
+    are the polar and azimuthal angles of :math:`\vec{r}_{ij}`.
+
+    `SteinhardtOrder` evaluates the bonds in `nlist` in C++ (or on the GPU)
+    without copying the particle data to Python. Share the neighbor list with
+    the pair potentials to reuse the list they build each step.
+    `SteinhardtOrder` extends the neighbor list to include all pairs within
+    `r_max`.
+
+    Note:
+        The degrees in `l` must be between 0 and 12.
+
+    Attention:
+        Pairs excluded from `nlist` (see
+        `hoomd.md.nlist.NeighborList.exclusions`) are not bonds.
+
+    Examples::
+
+        nl = hoomd.md.nlist.Cell(buffer=0.4)
+        steinhardt = hoomd.md.compute.SteinhardtOrder(nlist=nl, r_max=1.5)
+        sim.operations.computes.append(steinhardt)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `SteinhardtOrder`:
+
+    Attributes:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list that provides the
+            bonds (*read-only*).
+
+        r_max (float): Largest bond length :math:`[\mathrm{length}]`
+            (*read-only*).
+
+        l (list[int]): Spherical harmonic degrees to compute the order
+            parameter for (*read-only*).
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Compute._doc_inherited)
+
+    def __init__(self, nlist, r_max, l=(4, 6)):  # noqa: E741 - allow l
+        super().__init__()
+        param_dict = ParameterDict(
+            nlist=hoomd.md.nlist.NeighborList,
+            r_max=OnlyTypes(float, preprocess=positive_real),
+            l=[int],
+        )
+        param_dict.update(dict(nlist=nlist, r_max=r_max, l=list(l)))
+        self._param_dict.update(param_dict)
+
+    def _attach_hook(self):
+        self.nlist._attach(self._simulation)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_cls = _md.ComputeSteinhardt
+            self.nlist._cpp_obj.setStorageMode(_md.NeighborList.storageMode.half)
+        else:
+            cpp_cls = _md.ComputeSteinhardtGPU
+            self.nlist._cpp_obj.setStorageMode(_md.NeighborList.storageMode.full)
+        self._cpp_obj = cpp_cls(
+            self._simulation.state._cpp_sys_def,
+            self.nlist._cpp_obj,
+            self.r_max,
+            list(self.l),
+        )
+
+    def _detach_hook(self):
+        self.nlist._detach()
+
+    @log(category="sequence", requires_run=True)
+    def order(self):
+        """(*len(l)*,) `numpy.ndarray` of `float`: Mean :math:`q_l` for each \
+        degree in `l`.
+
+        The mean is taken over the particles with at least one bond. The values
+        are ``nan`` when no particle has bonds.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.order
+
+    @log(requires_run=True)
+    def coordination_number(self):
+        """float: Mean number of bonds per particle."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.coordination_number
+
+
 __all__ = [
     "HarmonicAveragedThermodynamicQuantities",
+    "MultiGroupThermodynamicQuantities",
+    "RDF",
+    "SteinhardtOrder",
     "ThermodynamicQuantities",
 ]
@@ -20,7 +20,7 @@ Warning:
 from hoomd.md import _md
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.data.typeparam import TypeParameter
-from hoomd.data.typeconverter import OnlyIf, to_type_converter
+from hoomd.data.typeconverter import OnlyFrom, OnlyIf, to_type_converter
 from hoomd.md.force import Force
 import hoomd
 
@@ -56,6 +56,12 @@ class Distance(Constraint):
 
     Args:
         tolerance (float): Relative tolerance for constraint violation warnings.
+        solver (str): Method used to solve for the Lagrange multipliers,
+            ``"direct"`` or ``"iterative"``.
+        solver_tolerance (float): Relative residual at which the iterative
+            solver stops.
+        max_iterations (int): Maximum number of iterations of the iterative
+            solver.
 
     `Distance` applies forces between particles that constrain the distances
     between particles to specific values. The algorithm implemented is described
@@ -86,6 +92,16 @@ class Distance(Constraint):
     equations to determine the force. The constraints are satisfied at :math:`t
     + 2 \\delta t`, so the scheme is self-correcting and avoids drifts.
 
+    With ``solver="direct"``, `Distance` factorizes the sparse matrix of the
+    linear system on every step. With ``solver="iterative"``, `Distance` solves
+    the system with the Jacobi preconditioned BiCGSTAB method, starting from
+    the Lagrange multipliers of the previous step. The iterative solver avoids
+    the factorization, which dominates the cost for large networks of
+    constraints, and runs entirely on the GPU on GPU devices. It stops when the
+    norm of the residual is less than ``solver_tolerance`` times the norm of the
+    right hand side, or after ``max_iterations`` iterations, and issues a
+    warning when it does not converge.
+
     Add an instance of `Distance` to the integrator constraints list
     `hoomd.md.Integrator.constraints` to apply the force during the simulation.
 
@@ -108,13 +124,36 @@ class Distance(Constraint):
 
     Attributes:
         tolerance (float): Relative tolerance for constraint violation warnings.
+
+        solver (str): Method used to solve for the Lagrange multipliers,
+            ``"direct"`` or ``"iterative"``.
+
+        solver_tolerance (float): Relative residual at which the iterative
+            solver stops.
+
+        max_iterations (int): Maximum number of iterations of the iterative
+            solver.
     """
 
     _cpp_class_name = "ForceDistanceConstraint"
     __doc__ = __doc__.replace("{inherited}", Constraint._doc_inherited)
 
-    def __init__(self, tolerance=1e-3):
-        self._param_dict.update(ParameterDict(tolerance=float(tolerance)))
+    def __init__(
+        self,
+        tolerance=1e-3,
+        solver="direct",
+        solver_tolerance=1e-8,
+        max_iterations=100,
+    ):
+        self._param_dict.update(
+            ParameterDict(
+                tolerance=float(tolerance),
+                solver=OnlyFrom(["direct", "iterative"]),
+                solver_tolerance=float(solver_tolerance),
+                max_iterations=int(max_iterations),
+            )
+        )
+        self.solver = solver
 
 
 class Rigid(Constraint):
@@ -75,6 +75,11 @@ class Force(Compute):
     ----------
 
     **Members defined in** `Force`:
+
+    Attributes:
+        period (int): Number of steps between applications of this force by
+            the integrator. See `hoomd.md.Integrator` for details on multiple
+            time steps. Defaults to 1.
     """
 
     __doc__ = __doc__.replace("{inherited}", Compute._doc_inherited)
@@ -122,6 +127,11 @@ class Force(Compute):
         Local force arrays on the GPU.
         `Read more... <hoomd.md.force.Force.gpu_local_force_arrays>`
 
+    .. py:attribute:: period
+
+        Number of steps between applications of this force by the integrator.
+        `Read more... <hoomd.md.force.Force.period>`
+
     .. py:attribute:: torques
 
         The torque :math:`\\vec{\\tau}_i` applied to each particle.
@@ -136,11 +146,19 @@ class Force(Compute):
 
     def __init__(self):
         self._in_context_manager = False
+        param_dict = ParameterDict(period=int)
+        param_dict["period"] = 1
+        self._param_dict.update(param_dict)
 
     @log(requires_run=True)
     def energy(self):
         """float: The potential energy :math:`U` of the system from this force \
         :math:`[\\mathrm{energy}]`.
+
+        Attention:
+            When `Simulation.always_compute_energy` is `False`, `Force` objects
+            only compute energies on steps where an operation needs them (such
+            as a triggered writer that logs data).
         """
         self._cpp_obj.compute(self._simulation.timestep)
         return self._cpp_obj.calcEnergySum()
@@ -365,6 +383,29 @@ class Custom(Force):
     Note:
         Access to the force buffers is constant (O(1)) time.
 
+    Pass ``asynchronous=True`` to call `set_forces` with the GPU stream that
+    HOOMD-blue launches its kernels on (``None`` on the CPU). Queue work on
+    that stream and return without synchronizing the device. HOOMD-blue runs
+    the kernels that use the forces after the queued work in stream order, so
+    the host does not wait for the custom force to complete.
+
+    .. code-block:: python
+
+        class MyAsynchronousForce(hoomd.md.force.Custom):
+            def __init__(self):
+                super().__init__(asynchronous=True)
+
+            def set_forces(self, timestep, stream):
+                with self.gpu_local_force_arrays as arrays:
+                    with cupy.cuda.ExternalStream(stream):
+                        arrays.force[:] = -5
+
+    Tip:
+        Pass ``stream`` to the ``__dlpack__`` method of the local force
+        arrays (for example with ``torch.from_dlpack``) to order the work of
+        other frameworks after HOOMD-blue's kernels without synchronizing the
+        device.
+
     {inherited}
 
     ----------
@@ -372,24 +413,42 @@ class Custom(Force):
     **Members defined in** `Custom`:
     """
 
-    def __init__(self, aniso=False):
+    def __init__(self, aniso=False, asynchronous=False):
         super().__init__()
         self._aniso = aniso
+        self._asynchronous = bool(asynchronous)
 
         self._state = None  # to be set on attaching
 
     def _attach_hook(self):
         self._state = self._simulation.state
         self._cpp_obj = _md.CustomForceCompute(
-            self._state._cpp_sys_def, self.set_forces, self._aniso
+            self._state._cpp_sys_def,
+            self.set_forces,
+            self._aniso,
+            self._asynchronous,
         )
 
+    @property
+    def asynchronous(self):
+        """bool: Whether `set_forces` receives the GPU stream.
+
+        Set ``asynchronous`` with the constructor argument.
+        """
+        if self._attached:
+            return self._cpp_obj.isAsynchronous()
+        return self._asynchronous
+
     @abstractmethod
     def set_forces(self, timestep):
         """Set the forces in the simulation loop.
 
         Args:
             timestep (int): The current timestep in the simulation.
+
+        When the force is ``asynchronous``, `set_forces` also receives the
+        GPU stream handle (`int`) that HOOMD-blue launches kernels on, or
+        ``None`` when running on the CPU.
         """
         pass
 
@@ -508,7 +567,9 @@ class Active(Force):
             sim.state._cpp_sys_def, sim.state._get_group(self.filter)
         )
 
-    def create_diffusion_updater(self, trigger, rotational_diffusion):
+    def create_diffusion_updater(
+        self, trigger, rotational_diffusion, fuse_with_force=False
+    ):
         """Create a rotational diffusion updater for this active force.
 
         Args:
@@ -516,13 +577,15 @@ class Active(Force):
                 rotational diffusion.
             rotational_diffusion (hoomd.variant.variant_like): The
                 rotational diffusion as a function of time or a constant.
+            fuse_with_force (bool): When `True`, apply the diffusion while the
+                active force sets the forces. Defaults to `False`.
 
         Returns:
             hoomd.md.update.ActiveRotationalDiffusion:
                 The rotational diffusion updater.
         """
         return hoomd.md.update.ActiveRotationalDiffusion(
-            trigger, self, rotational_diffusion
+            trigger, self, rotational_diffusion, fuse_with_force
         )
 
 
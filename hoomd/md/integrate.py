@@ -193,6 +193,23 @@ class Integrator(_DynamicIntegrator):
     special case, as it only integrates the degrees of freedom of each body's
     center of mass. See `hoomd.md.constrain.Rigid` for details.
 
+    .. rubric:: Multiple time steps
+
+    Set the `period <hoomd.md.force.Force.period>` of a force :math:`f` to
+    :math:`k_f > 1` to apply it less often, as in the impulse form of r-RESPA.
+    `Integrator` computes such a force only on steps that are multiples of
+    :math:`k_f` and multiplies its forces and torques by :math:`k_f` on those
+    steps (they are zero on the others). This applies slowly varying forces,
+    such as the reciprocal space force from
+    `hoomd.md.long_range.pppm.make_pppm_coulomb_forces`, as an impulse every
+    :math:`k_f` steps while fast forces like bonds apply every step.
+
+    Note:
+        The energies and virials of a force with :math:`k_f > 1` are included
+        in the net energy and virial only on steps that are multiples of
+        :math:`k_f`. Log thermodynamic quantities and use barostats on those
+        steps only.
+
     .. rubric:: Degrees of freedom
 
     `Integrator` always integrates the translational degrees of freedom.
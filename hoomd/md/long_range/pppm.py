@@ -9,7 +9,15 @@ import math
 import numpy
 
 
-def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
+def make_pppm_coulomb_forces(
+    nlist,
+    resolution,
+    order,
+    r_cut,
+    alpha=0,
+    fft_group=(1, 1, 1),
+    mixed_precision=False,
+):
     """Long range Coulomb interactions evaluated using the PPPM method.
 
     Args:
@@ -22,6 +30,11 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
           space terms :math:`\\mathrm{[length]}`.
         alpha (float): Debye screening parameter
           :math:`\\mathrm{[length^{-1}]}`.
+        fft_group (tuple[int, int, int]): Number of domains in the x, y, and z
+          directions that share one FFT rank
+          :math:`\\mathrm{[dimensionless]}`.
+        mixed_precision (bool): Evaluate the reciprocal space term in single
+          precision on the GPU.
 
     Evaluate the potential energy :math:`U_\\mathrm{coulomb}` and apply
     the corresponding forces to the particles in the simulation.
@@ -104,6 +117,30 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
         In MPI simulations with multiple ranks, the grid resolution must be a
         power of two in each dimension.
 
+    .. rubric:: FFT groups
+
+    In MPI simulations, every rank takes part in the all-to-all communication
+    of the distributed FFT by default. With many ranks, the FFT exchanges many
+    small messages. Set ``fft_group`` to perform the FFT on a subset of the
+    ranks: the first rank of every group of ``fft_group[0] * fft_group[1] *
+    fft_group[2]`` neighboring domains collects the charge density of the group,
+    performs the FFT with the first ranks of the other groups, and returns the
+    forces on the mesh to the group. ``fft_group`` must divide the domain
+    decomposition in each direction. The GPU implementation does not support
+    FFT groups. ``fft_group`` has no effect in simulations without domain
+    decomposition.
+
+    .. rubric:: Mixed precision
+
+    The charge density mesh and the FFTs are single precision in all builds.
+    With ``mixed_precision=True``, the GPU implementation also evaluates the
+    charge assignment, the multiplication with the influence function and the
+    force interpolation in single precision. The particle forces and the energy
+    and virial sums remain in the build's precision. The error of the
+    reciprocal space term is usually much larger than the single precision
+    rounding, and GPUs with low double precision throughput compute the term
+    much faster. The CPU implementation ignores ``mixed_precision``.
+
     Returns:
         ``real_space_force``, ``reciprocal_space_force``
 
@@ -135,6 +172,8 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
         r_cut=r_cut,
         alpha=0,
         pair_force=real_space_force,
+        fft_group=fft_group,
+        mixed_precision=mixed_precision,
     )
 
     return real_space_force, reciprocal_space_force
@@ -163,18 +202,38 @@ class Coulomb(Force):
           space terms :math:`\\mathrm{[length]}`.
         alpha (float): Debye screening parameter
           :math:`\\mathrm{[length^{-1}]}`.
+        fft_group (tuple[int, int, int]): Number of domains in the x, y, and z
+          directions that share one FFT rank
+          :math:`\\mathrm{[dimensionless]}`.
+        mixed_precision (bool): Evaluate the reciprocal space term in single
+          precision on the GPU.
     """
 
     __doc__ = __doc__.replace("{inherited}", Force._doc_inherited)
 
-    def __init__(self, nlist, resolution, order, r_cut, alpha, pair_force):
+    def __init__(
+        self,
+        nlist,
+        resolution,
+        order,
+        r_cut,
+        alpha,
+        pair_force,
+        fft_group=(1, 1, 1),
+        mixed_precision=False,
+    ):
         super().__init__()
         self._nlist = hoomd.data.typeconverter.OnlyTypes(hoomd.md.nlist.NeighborList)(
             nlist
         )
         self._param_dict.update(
             hoomd.data.parameterdicts.ParameterDict(
-                resolution=(int, int, int), order=int, r_cut=float, alpha=float
+                resolution=(int, int, int),
+                order=int,
+                r_cut=float,
+                alpha=float,
+                fft_group=(int, int, int),
+                mixed_precision=bool,
             )
         )
 
@@ -182,6 +241,8 @@ class Coulomb(Force):
         self.order = order
         self.r_cut = r_cut
         self.alpha = alpha
+        self.fft_group = fft_group
+        self.mixed_precision = mixed_precision
         self._pair_force = pair_force
 
     def _attach_hook(self):
@@ -195,58 +256,36 @@ class Coulomb(Force):
         # Access set parameters before attaching. These values are needed to
         # compute derived parameters before all paramters are given to the
         # _cpp_obj at the end.
-        Nx, Ny, Nz = self.resolution
+        resolution = self.resolution
         order = self.order
         rcut = self.r_cut
-        alpha = self.alpha
+        fft_group = self.fft_group
+        mixed_precision = self.mixed_precision
 
         group = self._simulation.state._get_group(hoomd.filter.All())
         self._cpp_obj = cls(
             self._simulation.state._cpp_sys_def, self.nlist._cpp_obj, group
         )
+        self._cpp_obj.setFFTGroup(*fft_group)
+        self._cpp_obj.setMixedPrecision(mixed_precision)
 
-        # compute the kappa parameter
-        q2 = self._cpp_obj.getQ2Sum()
-        N = self._simulation.state.N_particles
-        box = self._simulation.state.box
-        Lx = box.Lx
-        Ly = box.Ly
-        Lz = box.Lz
-
-        hx = Lx / Nx
-        hy = Ly / Ny
-        hz = Lz / Nz
-
-        gew1 = 0.0
-        kappa = gew1
-        f = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-        hmin = min(hx, hy, hz)
-        gew2 = 10.0 / hmin
-        kappa = gew2
-        fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+        self._set_parameters(resolution, order, rcut)
 
-        if f * fmid >= 0.0:
-            raise RuntimeError("Cannot compute PPPM Coloumb forces,\n" "f*fmid >= 0.0")
+    def _set_parameters(self, resolution, order, rcut):
+        """Apply new mesh parameters to both the real and reciprocal terms.
 
-        if f < 0.0:
-            dgew = gew2 - gew1
-            rtb = gew1
-        else:
-            dgew = gew1 - gew2
-            rtb = gew2
-
-        ncount = 0
-
-        # iteratively compute kappa to minimize the error
-        while math.fabs(dgew) > 0.00001 and fmid != 0.0:
-            dgew *= 0.5
-            kappa = rtb + dgew
-            fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-            if fmid <= 0.0:
-                rtb = kappa
-            ncount += 1
-            if ncount > 10000.0:
-                raise RuntimeError("Cannot compute PPPM\n" "kappa is not converging")
+        Compute kappa such that the real space and reciprocal space error
+        estimates are equal and set it on ``self._pair_force`` as well.
+        """
+        alpha = self.alpha
+        kappa = _compute_kappa(
+            resolution,
+            order,
+            rcut,
+            self._simulation.state.box,
+            self._simulation.state.N_particles,
+            self._cpp_obj.getQ2Sum(),
+        )
 
         # set parameters
         particle_types = self._simulation.state.particle_types
@@ -257,12 +296,15 @@ class Coulomb(Force):
         #                                                  alpha=alpha)
         # self._pair_force.r_cut[(particle_types, particle_types)] = rcut
 
-        # workaround
+        # workaround, keeping the other parameters set by the user
         for a in particle_types:
             for b in particle_types:
-                self._pair_force.params[(a, b)] = dict(kappa=kappa, alpha=alpha)
+                params = dict(self._pair_force.params[(a, b)])
+                params.update(kappa=kappa, alpha=alpha)
+                self._pair_force.params[(a, b)] = params
                 self._pair_force.r_cut[(a, b)] = rcut
 
+        Nx, Ny, Nz = resolution
         self._cpp_obj.setParams(Nx, Ny, Nz, order, kappa, rcut, alpha)
 
     @property
@@ -283,6 +325,270 @@ class Coulomb(Force):
             self._pair_force.nlist = value
 
 
+def make_pppm_dispersion_forces(nlist, resolution, order, r_cut, tolerance=1e-3):
+    """Long range Lennard-Jones dispersion evaluated using the PPPM method.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        resolution (tuple[int, int, int]): Number of grid points in the x, y,
+          and z directions :math:`\\mathrm{[dimensionless]}`.
+        order (int): Number of grid points in each direction to assign
+          dispersion coefficients to :math:`\\mathrm{[dimensionless]}`.
+        r_cut (float): Cutoff distance between the real space and reciprocal
+          space terms :math:`\\mathrm{[length]}`.
+        tolerance (float): Relative magnitude of the real space dispersion
+          term at ``r_cut`` :math:`\\mathrm{[dimensionless]}`.
+
+    Evaluate the Lennard-Jones potential energy without truncating the
+    dispersion term:
+
+    .. math::
+
+        U = \\frac{1}{2} \\sum_\\vec{n} \\sum_{i=0}^{N-1} \\sum_{j=0}^{N-1}
+          4 \\varepsilon_{ij} \\left[
+          \\left( \\frac{\\sigma_{ij}}{r} \\right)^{12} \\theta(r_\\mathrm{cut} - r)
+          - \\left( \\frac{\\sigma_{ij}}{r} \\right)^{6} \\right]
+
+    where the infinite sum includes all periodic images :math:`\\vec{n}` and
+    :math:`r` is the distance between particle :math:`i` and the image of
+    particle :math:`j`.
+
+    The method splits the dispersion term :math:`-C_{6,ij} / r^6` into a short
+    range part :math:`-C_{6,ij} g(\\beta r) / r^6` and a long range part, where
+    :math:`g(x) = e^{-x^2} (1 + x^2 + x^4 / 2)`. `md.pair.LJDispersionEwald`
+    computes the Lennard-Jones interactions within ``r_cut`` and removes the
+    long range part that `md.long_range.pppm.Dispersion` computes on the mesh.
+    The splitting parameter :math:`\\beta` is chosen such that
+    :math:`g(\\beta r_\\mathrm{cut})` is equal to ``tolerance``.
+
+    The mesh computes the long range part assuming the geometric mixing rule
+    :math:`C_{6,ij} = c_i c_j` with :math:`c_i = 2 \\sqrt{\\varepsilon_{ii}}
+    \\sigma_{ii}^3`. Pairs that do not follow the mixing rule have the exact
+    interaction within ``r_cut`` and the mixing rule interaction beyond it.
+
+    * `Isele-Holder, R. E. et. al. 2012`_ describes the method.
+
+    Set the ``lj`` parameters of ``real_space_force`` for every pair of
+    particle types before the first call to `Simulation.run`.
+
+    Returns:
+        ``real_space_force``, ``reciprocal_space_force``
+
+        Add both of these forces to the integrator.
+
+    Warning:
+        :py:func:`make_pppm_dispersion_forces` sets the ``dispersion_ewald``
+        parameters and ``r_cut`` of ``real_space_force``. Do not change these or
+        the parameters of ``reciprocal_space_force`` directly.
+
+    Note:
+        `md.long_range.pppm.Dispersion` runs on the CPU, including in
+        simulations on a GPU device.
+
+    Important:
+        In MPI simulations with multiple ranks, the grid resolution must be a
+        power of two in each dimension.
+
+    .. _Isele-Holder, R. E. et. al. 2012: https://doi.org/10.1063/1.4764089
+    """
+    real_space_force = hoomd.md.pair.LJDispersionEwald(nlist, default_r_cut=r_cut)
+
+    # solve g(x) = tolerance for x = beta * r_cut by bisection
+    x_low = 0.0
+    x_high = 100.0
+    while x_high - x_low > 1e-10 * x_high:
+        x = 0.5 * (x_low + x_high)
+        if _dispersion_g(x) > tolerance:
+            x_low = x
+        else:
+            x_high = x
+    beta = 0.5 * (x_low + x_high) / r_cut
+
+    reciprocal_space_force = Dispersion(
+        nlist=nlist,
+        resolution=resolution,
+        order=order,
+        r_cut=r_cut,
+        beta=beta,
+        pair_force=real_space_force,
+    )
+
+    return real_space_force, reciprocal_space_force
+
+
+class Dispersion(Force):
+    """Reciprocal space part of the PPPM Lennard-Jones dispersion forces.
+
+    Note:
+        Use :py:func:`make_pppm_dispersion_forces` to create a connected pair of
+        `md.pair.LJDispersionEwald` and `md.long_range.pppm.Dispersion`
+        instances that together implement the PPPM method for dispersion.
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Dispersion`:
+
+    Attributes:
+        resolution (tuple[int, int, int]): Number of grid points in the x, y,
+          and z directions :math:`\\mathrm{[dimensionless]}`.
+        order (int): Number of grid points in each direction to assign
+          dispersion coefficients to :math:`\\mathrm{[dimensionless]}`.
+        r_cut (float): Cutoff distance between the real space and reciprocal
+          space terms :math:`\\mathrm{[length]}`.
+        beta (float): Splitting parameter :math:`\\mathrm{[length^{-1}]}`.
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Force._doc_inherited)
+
+    def __init__(self, nlist, resolution, order, r_cut, beta, pair_force):
+        super().__init__()
+        self._nlist = hoomd.data.typeconverter.OnlyTypes(hoomd.md.nlist.NeighborList)(
+            nlist
+        )
+        self._param_dict.update(
+            hoomd.data.parameterdicts.ParameterDict(
+                resolution=(int, int, int), order=int, r_cut=float, beta=float
+            )
+        )
+
+        self.resolution = resolution
+        self.order = order
+        self.r_cut = r_cut
+        self.beta = beta
+        self._pair_force = pair_force
+
+    def _attach_hook(self):
+        self.nlist._attach(self._simulation)
+
+        Nx, Ny, Nz = self.resolution
+        order = self.order
+        rcut = self.r_cut
+        beta = self.beta
+
+        group = self._simulation.state._get_group(hoomd.filter.All())
+        self._cpp_obj = hoomd.md._md.PPPMDispersionForceCompute(
+            self._simulation.state._cpp_sys_def, self.nlist._cpp_obj, group
+        )
+
+        # per-type coefficients from the like pair parameters (geometric mixing)
+        particle_types = self._simulation.state.particle_types
+        coefficients = {}
+        for t in particle_types:
+            lj = self._pair_force.params[(t, t)]["lj"]
+            if lj["epsilon"] < 0:
+                raise ValueError(
+                    f"Cannot compute PPPM dispersion forces with epsilon < 0 "
+                    f"for the pair ({t}, {t})."
+                )
+            coefficients[t] = 2.0 * math.sqrt(lj["epsilon"]) * lj["sigma"] ** 3
+            self._cpp_obj.setCoefficient(t, coefficients[t])
+
+        for a in particle_types:
+            for b in particle_types:
+                lj = self._pair_force.params[(a, b)]["lj"]
+                self._pair_force.params[(a, b)] = dict(
+                    lj=dict(epsilon=lj["epsilon"], sigma=lj["sigma"]),
+                    dispersion_ewald=dict(
+                        c6=coefficients[a] * coefficients[b], beta=beta
+                    ),
+                )
+                self._pair_force.r_cut[(a, b)] = rcut
+
+        self._cpp_obj.setParams(Nx, Ny, Nz, order, beta, rcut, 0)
+
+    @property
+    def nlist(self):
+        """Neighbor list used to compute the real space term."""
+        return self._nlist
+
+    @nlist.setter
+    def nlist(self, value):
+        if self._attached:
+            raise RuntimeError("nlist cannot be set after scheduling.")
+        else:
+            self._nlist = hoomd.data.typeconverter.OnlyTypes(
+                hoomd.md.nlist.NeighborList
+            )(value)
+
+            # ensure that the pair force uses the same neighbor list
+            self._pair_force.nlist = value
+
+
+def _dispersion_g(x):
+    """Fraction of the dispersion interaction in the real space term."""
+    x2 = x * x
+    return math.exp(-x2) * (1.0 + x2 + 0.5 * x2 * x2)
+
+
+def _compute_kappa(resolution, order, rcut, box, N, q2):
+    """Find the kappa that balances the real and reciprocal space errors."""
+    Nx, Ny, Nz = resolution
+    Lx = box.Lx
+    Ly = box.Ly
+    Lz = box.Lz
+
+    hx = Lx / Nx
+    hy = Ly / Ny
+    hz = Lz / Nz
+
+    gew1 = 0.0
+    kappa = gew1
+    f = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+    hmin = min(hx, hy, hz)
+    gew2 = 10.0 / hmin
+    kappa = gew2
+    fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+
+    if f * fmid >= 0.0:
+        raise RuntimeError("Cannot compute PPPM Coloumb forces,\n" "f*fmid >= 0.0")
+
+    if f < 0.0:
+        dgew = gew2 - gew1
+        rtb = gew1
+    else:
+        dgew = gew1 - gew2
+        rtb = gew2
+
+    ncount = 0
+
+    # iteratively compute kappa to minimize the error
+    while math.fabs(dgew) > 0.00001 and fmid != 0.0:
+        dgew *= 0.5
+        kappa = rtb + dgew
+        fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+        if fmid <= 0.0:
+            rtb = kappa
+        ncount += 1
+        if ncount > 10000.0:
+            raise RuntimeError("Cannot compute PPPM\n" "kappa is not converging")
+
+    return kappa
+
+
+def _estimate_error(resolution, order, rcut, kappa, box, N, q2):
+    """Estimate the RMS force error of the method.
+
+    Returns the larger of the real space and reciprocal space estimates.
+    """
+    Nx, Ny, Nz = resolution
+    Lx = box.Lx
+    Ly = box.Ly
+    Lz = box.Lz
+    lprx = _rms(Lx / Nx, Lx, N, order, kappa, q2)
+    lpry = _rms(Ly / Ny, Ly, N, order, kappa, q2)
+    lprz = _rms(Lz / Nz, Lz, N, order, kappa, q2)
+    kspace_prec = math.sqrt(lprx * lprx + lpry * lpry + lprz * lprz) / math.sqrt(3.0)
+    real_prec = (
+        2.0
+        * q2
+        * math.exp(-kappa * kappa * rcut * rcut)
+        / math.sqrt(N * rcut * Lx * Ly * Lz)
+    )
+    return max(kspace_prec, real_prec)
+
+
 def _diffpr(hx, hy, hz, xprd, yprd, zprd, N, order, kappa, q2, rcut):
     """Part of the algorithm that computes the estimated error of the method."""
     lprx = _rms(hx, xprd, N, order, kappa, q2)
@@ -347,5 +653,7 @@ def _rms(h, prd, N, order, kappa, q2):
 
 __all__ = [
     "Coulomb",
+    "Dispersion",
     "make_pppm_coulomb_forces",
+    "make_pppm_dispersion_forces",
 ]
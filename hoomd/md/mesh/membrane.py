@@ -0,0 +1,147 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+r"""Combined membrane force classes apply the bending and conservation forces of
+a membrane model in a single force compute.
+
+.. math::
+
+    U_\mathrm{membrane} = U_\mathrm{Helfrich} + U_\mathrm{bending}
+    + U_\mathrm{area} + U_\mathrm{triangle\ area} + U_\mathrm{volume}
+
+Each term is that of the corresponding class in `hoomd.md.mesh.bending` and
+`hoomd.md.mesh.conservation`.
+
+See Also:
+   See the documentation in `hoomd.mesh.Mesh` for more information on the
+   initialization of the mesh object.
+
+.. invisible-code-block: python
+
+    mesh = hoomd.mesh.Mesh()
+    mesh.types = ["mesh"]
+    mesh.triangulation = dict(type_ids = [0,0,0,0],
+          triangles = [[0,1,2],[0,2,3],[0,1,3],[1,2,3]])
+"""
+
+from hoomd.md.mesh.potential import MeshPotential
+from hoomd.data.typeparam import TypeParameter
+from hoomd.data.parameterdicts import TypeParameterDict
+from hoomd.logging import log
+import hoomd
+
+
+class Membrane(MeshPotential):
+    r"""Combined membrane bending and conservation potential.
+
+    Args:
+        mesh (:py:mod:`hoomd.mesh.Mesh`): Mesh data structure.
+
+    `Membrane` computes the sum of the energies of
+    `hoomd.md.mesh.bending.Helfrich`, `hoomd.md.mesh.bending.BendingRigidity`,
+    `hoomd.md.mesh.conservation.Area`,
+    `hoomd.md.mesh.conservation.TriangleArea`, and
+    `hoomd.md.mesh.conservation.Volume` for each mesh type. Set the stiffness
+    of a term to 0 to omit it.
+
+    Separate mesh forces each loop over the triangles and bonds of the mesh,
+    recompute the same bond vectors and angles, and reduce the global area
+    and volume on their own. `Membrane` computes the geometry of each triangle
+    and bond once, reduces the global areas and volumes of all types
+    together, and then evaluates all selected terms in one pass over the
+    triangles and one pass over the bonds.
+
+    Attention:
+        `Membrane` runs only on the CPU. The Helfrich term is NOT implemented
+        for MPI parallel execution.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        membrane = hoomd.md.mesh.membrane.Membrane(mesh)
+        membrane.params["mesh"] = dict(
+            k_bending=10.0, k_area=100.0, A0=250.0, k_volume=100.0, V0=100.0
+        )
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Membrane`:
+
+    Attributes:
+        params (TypeParameter[dict]):
+            The parameters of the membrane energy for each mesh type.
+            The dictionary has the following keys:
+
+            * ``k_helfrich`` (`float`, **optional**) - Helfrich bending
+              stiffness :math:`[\mathrm{energy}]`. Defaults to 0.
+
+            * ``k_bending`` (`float`, **optional**) - bending rigidity
+              stiffness :math:`[\mathrm{energy}]`. Defaults to 0.
+
+            * ``k_area`` (`float`, **optional**) - global area conservation
+              coefficient :math:`[\mathrm{energy} \cdot
+              \mathrm{length}^{-2}]`. Defaults to 0.
+
+            * ``A0`` (`float`, **optional**) - target global surface area
+              :math:`[\mathrm{length}^2]`. Defaults to 0.
+
+            * ``k_triangle`` (`float`, **optional**) - triangle area
+              conservation coefficient :math:`[\mathrm{energy} \cdot
+              \mathrm{length}^{-2}]`. Defaults to 0.
+
+            * ``A0_triangle`` (`float`, **optional**) - target surface area
+              of a single triangle :math:`[\mathrm{length}^2]`. Defaults to 0.
+
+            * ``k_volume`` (`float`, **optional**) - volume conservation
+              coefficient :math:`[\mathrm{energy} \cdot
+              \mathrm{length}^{-3}]`. Defaults to 0.
+
+            * ``V0`` (`float`, **optional**) - target volume
+              :math:`[\mathrm{length}^3]`. Defaults to 0.
+    """
+
+    _cpp_class_name = "MembraneMeshForceCompute"
+    __doc__ = __doc__.replace("{inherited}", MeshPotential._doc_inherited)
+
+    def __init__(self, mesh):
+        params = TypeParameter(
+            "params",
+            "types",
+            TypeParameterDict(
+                k_helfrich=0.0,
+                k_bending=0.0,
+                k_area=0.0,
+                A0=0.0,
+                k_triangle=0.0,
+                A0_triangle=0.0,
+                k_volume=0.0,
+                V0=0.0,
+                len_keys=1,
+            ),
+        )
+        self._add_typeparam(params)
+
+        super().__init__(mesh)
+
+    def _attach_hook(self):
+        if not isinstance(self._simulation.device, hoomd.device.CPU):
+            raise NotImplementedError("Membrane is not implemented on the GPU")
+        super()._attach_hook()
+
+    @log(requires_run=True)
+    def area(self):
+        """Area of the mesh triangulation of each type."""
+        return self._cpp_obj.getArea()
+
+    @log(requires_run=True)
+    def volume(self):
+        """Volume of the mesh triangulation of each type."""
+        return self._cpp_obj.getVolume()
+
+
+__all__ = [
+    "Membrane",
+]
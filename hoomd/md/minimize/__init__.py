@@ -4,7 +4,10 @@
 """Energy minimizer for molecular dynamics."""
 
 from hoomd.md.minimize.fire import FIRE
+from hoomd.md.minimize.gradient import LBFGS, ConjugateGradient
 
 __all__ = [
     "FIRE",
+    "LBFGS",
+    "ConjugateGradient",
 ]
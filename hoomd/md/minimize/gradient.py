@@ -0,0 +1,356 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Gradient based energy minimizers."""
+
+import hoomd
+
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data import syncedlist
+from hoomd.data.typeconverter import OnlyTypes, positive_real
+from hoomd.logging import log
+from hoomd.md import _md
+from hoomd.md.integrate import _DynamicIntegrator
+
+
+class _GradientMinimizer(_DynamicIntegrator):
+    """Base class for the gradient based energy minimizers.
+
+    Note:
+        Use `LBFGS` or `ConjugateGradient`.
+    """
+
+    _cpp_class_name = "GradientEnergyMinimizer"
+    _conjugate_gradient = False
+
+    def __init__(
+        self,
+        max_step,
+        force_tol,
+        torque_tol,
+        energy_tol,
+        integrate_rotational_dof,
+        forces,
+        constraints,
+        methods,
+        rigid,
+        max_rotation,
+        min_steps_conv,
+        pressure,
+    ):
+        super().__init__(forces, constraints, methods, rigid)
+
+        pdict = ParameterDict(
+            max_step=OnlyTypes(float, preprocess=positive_real),
+            max_rotation=OnlyTypes(float, preprocess=positive_real),
+            integrate_rotational_dof=bool(integrate_rotational_dof),
+            force_tol=float(force_tol),
+            torque_tol=float(torque_tol),
+            energy_tol=float(energy_tol),
+            min_steps_conv=OnlyTypes(int, preprocess=positive_real),
+            pressure=OnlyTypes(float, allow_none=True),
+            _defaults={"max_rotation": 0.1, "min_steps_conv": 10, "pressure": None},
+        )
+
+        self._param_dict.update(pdict)
+
+        # set these values explicitly so they can be validated
+        self.max_step = max_step
+        self.max_rotation = max_rotation
+        self.min_steps_conv = min_steps_conv
+        self.pressure = pressure
+
+        # have to remove methods from old syncedlist so new syncedlist doesn't
+        # think members are attached to multiple syncedlists
+        self._methods.clear()
+
+        methods_list = syncedlist.SyncedList(
+            OnlyTypes(hoomd.md.methods.ConstantVolume),
+            syncedlist._PartialGetAttr("_cpp_obj"),
+            iterable=methods,
+        )
+        self._methods = methods_list
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cls = getattr(_md, self._cpp_class_name)
+        else:
+            cls = getattr(_md, self._cpp_class_name + "GPU")
+        self._cpp_obj = cls(
+            self._simulation.state._cpp_sys_def,
+            self.max_step,
+            self._conjugate_gradient,
+        )
+        super()._attach_hook()
+
+    @log(requires_run=True)
+    def energy(self):
+        """float: Get the energy after the last iteration of the minimizer.
+
+        The potential energy per particle, plus :math:`PV / N` when relaxing
+        the box :math:`[\\mathrm{energy}]`.
+        """
+        return self._cpp_obj.energy
+
+    @log(default=False)
+    def converged(self):
+        """bool: True when the minimizer has converged, else False."""
+        if not self._attached:
+            return False
+
+        return self._cpp_obj.converged
+
+    def reset(self):
+        """Reset the minimizer to its initial state."""
+        return self._cpp_obj.reset()
+
+
+_gradient_args = """
+    Args:
+        max_step (float): Largest distance any particle moves in one step
+            :math:`[\\mathrm{length}]`.
+        force_tol (float): Force convergence criteria
+            :math:`[\\mathrm{force}]`.
+        torque_tol (float): Torque convergence criteria
+            :math:`[\\mathrm{force} \\cdot \\mathrm{length}]`.
+        energy_tol (float): Energy convergence criteria
+            :math:`[\\mathrm{energy}]`.
+        integrate_rotational_dof (bool): When True, minimize over the
+            rotational degrees of freedom.
+        forces (Sequence[hoomd.md.force.Force]):
+            Sequence of forces applied to the particles in the system. All the
+            forces are summed together. The default value of ``None``
+            initializes an empty list.
+        constraints (Sequence[hoomd.md.constrain.Constraint]):
+            Sequence of constraint forces applied to the particles in the
+            system. The default value of ``None`` initializes an empty list.
+            Rigid body objects (i.e. `hoomd.md.constrain.Rigid`) are not
+            allowed in the list.
+        methods (Sequence[hoomd.md.methods.ConstantVolume]):
+            Sequence of `hoomd.md.methods.ConstantVolume` methods that select
+            the particles to minimize. The default value of ``None``
+            initializes an empty list.
+        rigid (hoomd.md.constrain.Rigid):
+            A rigid bodies object defining the rigid bodies in the simulation.
+        max_rotation (float): Largest angle any particle rotates by in one step
+            :math:`[\\mathrm{radians}]`.
+        min_steps_conv (int): A minimum number of attempts before convergence
+            criteria are considered.
+        pressure (float): Pressure to relax the box to, or ``None`` to keep the
+            box fixed :math:`[\\mathrm{pressure}]`.
+"""
+
+_gradient_description = """
+    The minimizer moves the particles selected by `methods` directly along a
+    search direction computed from the gradient of the potential energy, with
+    one force evaluation per step. The integration methods only select the
+    particles; they do not integrate the equations of motion. Other particles
+    are kept frozen but still interact with the particles being moved.
+
+    There is no line search. Each step moves along the search direction by at
+    most `max_step` and rotates particles by at most `max_rotation`. When a
+    step raises the energy, the minimizer undoes it, discards the search
+    history, and halves the step limit. The limit recovers by a factor of 1.1
+    on each step that lowers the energy. The search history is also discarded
+    when particles are reordered or migrate between MPI ranks.
+
+    When `pressure` is not ``None``, the minimizer also relaxes the box. It
+    minimizes the enthalpy :math:`U + PV` over the particle coordinates and
+    an upper triangular strain of the box (all six box degrees of freedom in
+    3D, :math:`L_x`, :math:`L_y`, and :math:`xy` in 2D). The strain is scaled by
+    the number of particles so that it has weight comparable to the particle
+    coordinates.
+
+    The method converges when the force and torque per degree of freedom are
+    below `force_tol` and `torque_tol` and the change in the energy per
+    particle from one step to the next is below `energy_tol`:
+
+    .. math::
+
+        \\frac{|F|}{\\sqrt{N_{dof}}} < \\mathrm{\\text{force_tol}}
+        \\;\\;, \\;\\ \\frac{|\\tau|}{\\sqrt{N_{dof}}} <
+        \\mathrm{\\text{torque_tol}} \\;\\;, and \\;\\ \\Delta \\frac{E}{N} <
+        \\mathrm{\\text{energy_tol}}
+
+    where :math:`N_{\\mathrm{dof}}` is the number of translational degrees of
+    freedom the minimization is acting over.
+"""
+
+_gradient_attributes = """
+    Attributes:
+        max_step (float): Largest distance any particle moves in one step
+            :math:`[\\mathrm{length}]`.
+        force_tol (float): Force convergence criteria
+            :math:`[\\mathrm{force}]`.
+        torque_tol (float): Torque convergence criteria
+            :math:`[\\mathrm{force} \\cdot \\mathrm{length}]`.
+        energy_tol (float): Energy convergence criteria
+            :math:`[\\mathrm{energy}]`.
+        integrate_rotational_dof (bool): When True, minimize over the
+            rotational degrees of freedom.
+        forces (Sequence[hoomd.md.force.Force]):
+            Sequence of forces applied to the particles in the system.
+        constraints (Sequence[hoomd.md.constrain.Constraint]):
+            Sequence of constraint forces applied to the particles in the
+            system.
+        methods (Sequence[hoomd.md.methods.ConstantVolume]):
+            Sequence of `hoomd.md.methods.ConstantVolume` methods that select
+            the particles to minimize.
+        rigid (hoomd.md.constrain.Rigid):
+            A rigid bodies object defining the rigid bodies in the simulation.
+        max_rotation (float): Largest angle any particle rotates by in one step
+            :math:`[\\mathrm{radians}]`.
+        min_steps_conv (int): A minimum number of attempts before convergence
+            criteria are considered.
+        pressure (float): Pressure to relax the box to, or ``None`` to keep the
+            box fixed :math:`[\\mathrm{pressure}]`.
+"""
+
+
+class LBFGS(_GradientMinimizer):
+    """Energy Minimizer (L-BFGS).
+
+    {args}
+        history_size (int): Number of previous steps used to approximate the
+            inverse Hessian.
+
+    `LBFGS` is a `hoomd.md.Integrator` that minimizes the potential energy
+    with the limited memory Broyden-Fletcher-Goldfarb-Shanno method
+    (`Nocedal, Math. Comp., 1980
+    <https://doi.org/10.1090/S0025-5718-1980-0572855-7>`_). The search
+    direction is computed with the two loop recursion over the last
+    `history_size` steps and the first step of each search is a steepest
+    descent step of length `max_step`.
+
+    {description}
+
+    Example::
+
+        lbfgs = md.minimize.LBFGS(
+            max_step=0.05, force_tol=1e-2, torque_tol=1e-2, energy_tol=1e-7
+        )
+        lbfgs.methods.append(md.methods.ConstantVolume(hoomd.filter.All()))
+        sim.operations.integrator = lbfgs
+        while not (lbfgs.converged):
+            sim.run(100)
+
+    Note:
+        To use `LBFGS`, set it as the simulation's integrator in place of the
+        typical `hoomd.md.Integrator`.
+
+    {attributes}
+        history_size (int): Number of previous steps used to approximate the
+            inverse Hessian.
+    """
+
+    __doc__ = __doc__.format(
+        args=_gradient_args.strip(),
+        description=_gradient_description.strip(),
+        attributes=_gradient_attributes.strip(),
+    )
+
+    def __init__(
+        self,
+        max_step,
+        force_tol,
+        torque_tol,
+        energy_tol,
+        integrate_rotational_dof=False,
+        forces=None,
+        constraints=None,
+        methods=None,
+        rigid=None,
+        max_rotation=0.1,
+        min_steps_conv=10,
+        pressure=None,
+        history_size=10,
+    ):
+        super().__init__(
+            max_step,
+            force_tol,
+            torque_tol,
+            energy_tol,
+            integrate_rotational_dof,
+            forces,
+            constraints,
+            methods,
+            rigid,
+            max_rotation,
+            min_steps_conv,
+            pressure,
+        )
+
+        pdict = ParameterDict(
+            history_size=OnlyTypes(int, preprocess=positive_real),
+            _defaults={"history_size": 10},
+        )
+        self._param_dict.update(pdict)
+        self.history_size = history_size
+
+
+class ConjugateGradient(_GradientMinimizer):
+    """Energy Minimizer (nonlinear conjugate gradient).
+
+    {args}
+    `ConjugateGradient` is a `hoomd.md.Integrator` that minimizes the
+    potential energy with the Polak-Ribière nonlinear conjugate gradient
+    method. It restarts with a steepest descent step when the Polak-Ribière
+    :math:`\\beta` is negative or the direction is not a descent direction.
+    The step length is the Newton step along the search direction using the
+    curvature measured over the previous step, limited by `max_step`.
+
+    {description}
+
+    Example::
+
+        cg = md.minimize.ConjugateGradient(
+            max_step=0.05, force_tol=1e-2, torque_tol=1e-2, energy_tol=1e-7
+        )
+        cg.methods.append(md.methods.ConstantVolume(hoomd.filter.All()))
+        sim.operations.integrator = cg
+        while not (cg.converged):
+            sim.run(100)
+
+    Note:
+        To use `ConjugateGradient`, set it as the simulation's integrator in
+        place of the typical `hoomd.md.Integrator`.
+
+    {attributes}
+    """
+
+    _conjugate_gradient = True
+    __doc__ = __doc__.format(
+        args=_gradient_args.strip(),
+        description=_gradient_description.strip(),
+        attributes=_gradient_attributes.strip(),
+    )
+
+    def __init__(
+        self,
+        max_step,
+        force_tol,
+        torque_tol,
+        energy_tol,
+        integrate_rotational_dof=False,
+        forces=None,
+        constraints=None,
+        methods=None,
+        rigid=None,
+        max_rotation=0.1,
+        min_steps_conv=10,
+        pressure=None,
+    ):
+        super().__init__(
+            max_step,
+            force_tol,
+            torque_tol,
+            energy_tol,
+            integrate_rotational_dof,
+            forces,
+            constraints,
+            methods,
+            rigid,
+            max_rotation,
+            min_steps_conv,
+            pressure,
+        )
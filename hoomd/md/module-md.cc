@@ -20,7 +20,10 @@ void export_ActiveForceConstraintComputePrimitive(pybind11::module& m);
 void export_ActiveForceConstraintComputeSphere(pybind11::module& m);
 void export_ActiveRotationalDiffusionUpdater(pybind11::module& m);
 void export_ComputeThermo(pybind11::module& m);
+void export_ComputeThermoGroups(pybind11::module& m);
 void export_ComputeThermoHMA(pybind11::module& m);
+void export_ComputeRDF(pybind11::module& m);
+void export_ComputeSteinhardt(pybind11::module& m);
 void export_ConstantForceCompute(pybind11::module& m);
 void export_HarmonicAngleForceCompute(pybind11::module& m);
 void export_CosineSqAngleForceCompute(pybind11::module& m);
@@ -33,39 +36,22 @@ void export_HarmonicImproperForceCompute(pybind11::module& m);
 void export_BondTablePotential(pybind11::module& m);
 void export_CustomForceCompute(pybind11::module& m);
 void export_NeighborList(pybind11::module& m);
+void export_NeighborListAuto(pybind11::module& m);
 void export_NeighborListBinned(pybind11::module& m);
+void export_NeighborListBody(pybind11::module& m);
+void export_NeighborListMultiLevel(pybind11::module& m);
 void export_NeighborListStencil(pybind11::module& m);
 void export_NeighborListTree(pybind11::module& m);
 void export_MolecularForceCompute(pybind11::module& m);
 void export_ForceDistanceConstraint(pybind11::module& m);
 void export_ForceComposite(pybind11::module& m);
 void export_PPPMForceCompute(pybind11::module& m);
+void export_PPPMDispersionForceCompute(pybind11::module& m);
 void export_wall_data(pybind11::module& m);
 void export_wall_field(pybind11::module& m);
 void export_LocalNeighborListDataHost(pybind11::module& m);
 
-void export_PotentialPairBuckingham(pybind11::module& m);
-void export_PotentialPairLJ(pybind11::module& m);
-void export_PotentialPairLJ1208(pybind11::module& m);
-void export_PotentialPairLJ0804(pybind11::module& m);
-void export_PotentialPairGauss(pybind11::module& m);
-void export_PotentialPairExpandedLJ(pybind11::module& m);
-void export_PotentialPairExpandedGaussian(pybind11::module& m);
-void export_PotentialPairExpandedMie(pybind11::module& m);
-void export_PotentialPairYukawa(pybind11::module& m);
-void export_PotentialPairEwald(pybind11::module& m);
-void export_PotentialPairMorse(pybind11::module& m);
-void export_PotentialPairMoliere(pybind11::module& m);
-void export_PotentialPairZBL(pybind11::module& m);
-void export_PotentialPairMie(pybind11::module& m);
-void export_PotentialPairReactionField(pybind11::module& m);
-void export_PotentialPairDLVO(pybind11::module& m);
-void export_PotentialPairFourier(pybind11::module& m);
-void export_PotentialPairOPP(pybind11::module& m);
-void export_PotentialPairTWF(pybind11::module& m);
 void export_PotentialPairLJGauss(pybind11::module& m);
-void export_PotentialPairForceShiftedLJ(pybind11::module& m);
-void export_PotentialPairTable(pybind11::module& m);
 
 void export_AnisoPotentialPairALJ2D(pybind11::module& m);
 void export_AnisoPotentialPairALJ3D(pybind11::module& m);
@@ -89,11 +75,17 @@ void export_PotentialMeshBondHarmonic(pybind11::module& m);
 void export_PotentialMeshBondFENE(pybind11::module& m);
 void export_PotentialMeshBondTether(pybind11::module& m);
 
+void export_FusedBondedForceComputeHarmonic(pybind11::module& m);
+void export_FusedBondedForceComputeFENE(pybind11::module& m);
+void export_FusedBondedForceComputeTether(pybind11::module& m);
+
 void export_BendingRigidityMeshForceCompute(pybind11::module& m);
 void export_HelfrichMeshForceCompute(pybind11::module& m);
 void export_VolumeConservationMeshForceCompute(pybind11::module& m);
 void export_AreaConservationMeshForceCompute(pybind11::module& m);
 void export_TriangleAreaConservationMeshForceCompute(pybind11::module& m);
+void export_MembraneMeshForceCompute(pybind11::module& m);
+void export_MeshBondFlipUpdater(pybind11::module& m);
 
 void export_PotentialSpecialPairLJ(pybind11::module& m);
 void export_PotentialSpecialPairCoulomb(pybind11::module& m);
@@ -132,6 +124,7 @@ void export_TwoStepBD(pybind11::module& m);
 void export_TwoStepConstantPressure(pybind11::module& m);
 void export_TwoStepNVTAlchemy(pybind11::module& m);
 void export_FIREEnergyMinimizer(pybind11::module& m);
+void export_GradientEnergyMinimizer(pybind11::module& m);
 void export_MuellerPlatheFlow(pybind11::module& m);
 void export_AlchemostatTwoStep(pybind11::module& m);
 void export_HalfStepHook(pybind11::module& m);
@@ -183,6 +176,8 @@ void export_ActiveForceConstraintComputeSphereGPU(pybind11::module& m);
 void export_ActiveForceComputeGPU(pybind11::module& m);
 void export_ComputeThermoGPU(pybind11::module& m);
 void export_ComputeThermoHMAGPU(pybind11::module& m);
+void export_ComputeRDFGPU(pybind11::module& m);
+void export_ComputeSteinhardtGPU(pybind11::module& m);
 void export_ConstantForceComputeGPU(pybind11::module& m);
 void export_HarmonicAngleForceComputeGPU(pybind11::module& m);
 void export_CosineSqAngleForceComputeGPU(pybind11::module& m);
@@ -193,6 +188,7 @@ void export_TableDihedralForceComputeGPU(pybind11::module& m);
 void export_HarmonicImproperForceComputeGPU(pybind11::module& m);
 void export_BondTablePotentialGPU(pybind11::module& m);
 void export_NeighborListGPU(pybind11::module& m);
+void export_NeighborListGPUAuto(pybind11::module& m);
 void export_NeighborListGPUBinned(pybind11::module& m);
 void export_NeighborListGPUStencil(pybind11::module& m);
 void export_NeighborListGPUTree(pybind11::module& m);
@@ -202,29 +198,9 @@ void export_PeriodicImproperForceComputeGPU(pybind11::module& m);
 void export_PPPMForceComputeGPU(pybind11::module& m);
 void export_LocalNeighborListDataGPU(pybind11::module& m);
 
-void export_PotentialPairBuckinghamGPU(pybind11::module& m);
-void export_PotentialPairLJGPU(pybind11::module& m);
-void export_PotentialPairLJ1208GPU(pybind11::module& m);
-void export_PotentialPairLJ0804GPU(pybind11::module& m);
-void export_PotentialPairGaussGPU(pybind11::module& m);
-void export_PotentialPairExpandedLJGPU(pybind11::module& m);
-void export_PotentialPairExpandedGaussianGPU(pybind11::module& m);
-void export_PotentialPairExpandedMieGPU(pybind11::module& m);
-void export_PotentialPairYukawaGPU(pybind11::module& m);
-void export_PotentialPairEwaldGPU(pybind11::module& m);
-void export_PotentialPairMorseGPU(pybind11::module& m);
-void export_PotentialPairMoliereGPU(pybind11::module& m);
-void export_PotentialPairZBLGPU(pybind11::module& m);
-void export_PotentialPairMieGPU(pybind11::module& m);
-void export_PotentialPairReactionFieldGPU(pybind11::module& m);
-void export_PotentialPairDLVOGPU(pybind11::module& m);
-void export_PotentialPairFourierGPU(pybind11::module& m);
-void export_PotentialPairOPPGPU(pybind11::module& m);
-void export_PotentialPairTWFGPU(pybind11::module& m);
 void export_PotentialPairLJGaussGPU(pybind11::module& m);
-void export_PotentialPairForceShiftedLJGPU(pybind11::module& m);
-void export_PotentialPairTableGPU(pybind11::module& m);
 void export_PotentialPairConservativeDPDGPU(pybind11::module& m);
+void export_PotentialPairAlchemicalLJGaussGPU(pybind11::module& m);
 
 void export_AnisoPotentialPairALJ2DGPU(pybind11::module& m);
 void export_AnisoPotentialPairALJ3DGPU(pybind11::module& m);
@@ -248,6 +224,10 @@ void export_PotentialMeshBondHarmonicGPU(pybind11::module& m);
 void export_PotentialMeshBondFENEGPU(pybind11::module& m);
 void export_PotentialMeshBondTetherGPU(pybind11::module& m);
 
+void export_FusedBondedForceComputeHarmonicGPU(pybind11::module& m);
+void export_FusedBondedForceComputeFENEGPU(pybind11::module& m);
+void export_FusedBondedForceComputeTetherGPU(pybind11::module& m);
+
 void export_BendingRigidityMeshForceComputeGPU(pybind11::module& m);
 void export_HelfrichMeshForceComputeGPU(pybind11::module& m);
 void export_VolumeConservationMeshForceComputeGPU(pybind11::module& m);
@@ -280,6 +260,7 @@ void export_TwoStepLangevinGPU(pybind11::module& m);
 void export_TwoStepBDGPU(pybind11::module& m);
 void export_TwoStepConstantPressureGPU(pybind11::module& m);
 void export_FIREEnergyMinimizerGPU(pybind11::module& m);
+void export_GradientEnergyMinimizerGPU(pybind11::module& m);
 void export_MuellerPlatheFlowGPU(pybind11::module& m);
 
 void export_TwoStepRATTLEBDGPUCylinder(pybind11::module& m);
@@ -330,7 +311,10 @@ PYBIND11_MODULE(_md, m)
     export_ActiveForceConstraintComputeSphere(m);
     export_ActiveRotationalDiffusionUpdater(m);
     export_ComputeThermo(m);
+    export_ComputeThermoGroups(m);
     export_ComputeThermoHMA(m);
+    export_ComputeRDF(m);
+    export_ComputeSteinhardt(m);
     export_ConstantForceCompute(m);
     export_HarmonicAngleForceCompute(m);
     export_CosineSqAngleForceCompute(m);
@@ -342,28 +326,9 @@ PYBIND11_MODULE(_md, m)
     export_HarmonicImproperForceCompute(m);
     export_BondTablePotential(m);
 
-    export_PotentialPairBuckingham(m);
-    export_PotentialPairLJ(m);
-    export_PotentialPairLJ1208(m);
-    export_PotentialPairLJ0804(m);
-    export_PotentialPairGauss(m);
-    export_PotentialPairExpandedLJ(m);
-    export_PotentialPairExpandedGaussian(m);
-    export_PotentialPairExpandedMie(m);
-    export_PotentialPairYukawa(m);
-    export_PotentialPairEwald(m);
-    export_PotentialPairMorse(m);
-    export_PotentialPairMoliere(m);
-    export_PotentialPairZBL(m);
-    export_PotentialPairMie(m);
-    export_PotentialPairReactionField(m);
-    export_PotentialPairDLVO(m);
-    export_PotentialPairFourier(m);
-    export_PotentialPairOPP(m);
-    export_PotentialPairTWF(m);
+    // PotentialPairAlchemicalLJGauss derives from PotentialPairLJGauss. The other pair potentials
+    // are in the _md_pair_<evaluator> modules, which Python imports on demand.
     export_PotentialPairLJGauss(m);
-    export_PotentialPairForceShiftedLJ(m);
-    export_PotentialPairTable(m);
 
     export_AlchemicalMDParticles(m);
 
@@ -397,24 +362,34 @@ PYBIND11_MODULE(_md, m)
     export_PotentialMeshBondFENE(m);
     export_PotentialMeshBondTether(m);
 
+    export_FusedBondedForceComputeHarmonic(m);
+    export_FusedBondedForceComputeFENE(m);
+    export_FusedBondedForceComputeTether(m);
+
     export_BendingRigidityMeshForceCompute(m);
     export_HelfrichMeshForceCompute(m);
     export_VolumeConservationMeshForceCompute(m);
     export_AreaConservationMeshForceCompute(m);
     export_TriangleAreaConservationMeshForceCompute(m);
+    export_MembraneMeshForceCompute(m);
+    export_MeshBondFlipUpdater(m);
 
     export_PotentialSpecialPairLJ(m);
     export_PotentialSpecialPairCoulomb(m);
 
     export_CustomForceCompute(m);
     export_NeighborList(m);
+    export_NeighborListAuto(m);
     export_NeighborListBinned(m);
+    export_NeighborListBody(m);
+    export_NeighborListMultiLevel(m);
     export_NeighborListStencil(m);
     export_NeighborListTree(m);
     export_MolecularForceCompute(m);
     export_ForceDistanceConstraint(m);
     export_ForceComposite(m);
     export_PPPMForceCompute(m);
+    export_PPPMDispersionForceCompute(m);
     export_LocalNeighborListDataHost(m);
 
     export_PotentialExternalPeriodic(m);
@@ -433,35 +408,16 @@ PYBIND11_MODULE(_md, m)
 
 #ifdef ENABLE_HIP
     export_NeighborListGPU(m);
+    export_NeighborListGPUAuto(m);
     export_NeighborListGPUBinned(m);
     export_NeighborListGPUStencil(m);
     export_NeighborListGPUTree(m);
     export_ForceCompositeGPU(m);
     export_LocalNeighborListDataGPU(m);
 
-    export_PotentialPairBuckinghamGPU(m);
-    export_PotentialPairLJGPU(m);
-    export_PotentialPairLJ1208GPU(m);
-    export_PotentialPairLJ0804GPU(m);
-    export_PotentialPairGaussGPU(m);
-    export_PotentialPairExpandedLJGPU(m);
-    export_PotentialPairExpandedGaussianGPU(m);
-    export_PotentialPairExpandedMieGPU(m);
-    export_PotentialPairYukawaGPU(m);
-    export_PotentialPairEwaldGPU(m);
-    export_PotentialPairMorseGPU(m);
-    export_PotentialPairMoliereGPU(m);
-    export_PotentialPairZBLGPU(m);
-    export_PotentialPairMieGPU(m);
-    export_PotentialPairReactionFieldGPU(m);
-    export_PotentialPairDLVOGPU(m);
-    export_PotentialPairFourierGPU(m);
-    export_PotentialPairOPPGPU(m);
-    export_PotentialPairTWFGPU(m);
     export_PotentialPairLJGaussGPU(m);
-    export_PotentialPairForceShiftedLJGPU(m);
-    export_PotentialPairTableGPU(m);
     export_PotentialPairConservativeDPDGPU(m);
+    export_PotentialPairAlchemicalLJGaussGPU(m);
 
     export_PotentialTersoffGPU(m);
     export_PotentialSquareDensityGPU(m);
@@ -493,6 +449,10 @@ PYBIND11_MODULE(_md, m)
     export_PotentialMeshBondFENEGPU(m);
     export_PotentialMeshBondTetherGPU(m);
 
+    export_FusedBondedForceComputeHarmonicGPU(m);
+    export_FusedBondedForceComputeFENEGPU(m);
+    export_FusedBondedForceComputeTetherGPU(m);
+
     export_BendingRigidityMeshForceComputeGPU(m);
     export_HelfrichMeshForceComputeGPU(m);
     export_VolumeConservationMeshForceComputeGPU(m);
@@ -512,6 +472,8 @@ PYBIND11_MODULE(_md, m)
     export_ForceDistanceConstraintGPU(m);
     export_ComputeThermoGPU(m);
     export_ComputeThermoHMAGPU(m);
+    export_ComputeRDFGPU(m);
+    export_ComputeSteinhardtGPU(m);
     export_PeriodicImproperForceComputeGPU(m);
     export_PPPMForceComputeGPU(m);
     export_ActiveForceComputeGPU(m);
@@ -550,6 +512,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepBD(m);
     export_TwoStepConstantPressure(m);
     export_FIREEnergyMinimizer(m);
+    export_GradientEnergyMinimizer(m);
     export_MuellerPlatheFlow(m);
     export_AlchemostatTwoStep(m);
     export_TwoStepNVTAlchemy(m);
@@ -586,6 +549,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepBDGPU(m);
     export_TwoStepConstantPressureGPU(m);
     export_FIREEnergyMinimizerGPU(m);
+    export_GradientEnergyMinimizerGPU(m);
     export_MuellerPlatheFlowGPU(m);
 
     export_TwoStepRATTLEBDGPUCylinder(m);
@@ -4,13 +4,21 @@
 r"""Pair forces (`hoomd.md.pair`) use neighbor list data structures to find
 neighboring particle pairs (those within a distance of :math:`r_\mathrm{cut}`)
 efficiently. HOOMD-blue provides a several types of neighbor list construction
-algorithms that you can select from: `Cell`, `Tree`, and `Stencil`.
+algorithms that you can select from: `Cell`, `Tree`, and `Stencil`, or let
+`Auto` select the fastest.
 
 Multiple pair force objects can share a single neighbor list, or use independent
 neighbor list objects. When neighbor lists are shared, they find neighbors
 within the the maximum :math:`r_{\mathrm{cut},i,j}` over the associated pair
 potentials.
 
+When pair forces with different cutoffs share a neighbor list, the neighbor
+list orders the neighbors of each particle so that those within range of the
+pair force with the smallest cutoff come first, followed by those within range
+of the next pair force, and so on. Each pair force then reads only the part of
+the list it needs, so a short ranged potential that shares a neighbor list with
+a long ranged one does not need to evaluate every pair of the long ranged list.
+
 .. rubric:: Buffer distance
 
 Set the `NeighborList.buffer` distance to amortize the cost of the neighbor list
@@ -34,6 +42,16 @@ Note:
     `NeighborList.buffer` between the two extremes that provides the best
     performance.
 
+Set `NeighborList.auto_buffer` to `True` to let the neighbor list search for
+that value while the simulation runs. `NeighborList.buffer` then sets the
+largest allowed buffer. The neighbor list measures how far the particles of each
+type move between builds, how long builds take, and how long the steps between
+builds take. At each build, it selects a buffer width for each particle type
+that minimizes the predicted time per step. Pairs of particles of types *i* and
+*j* use the mean of the two type buffers. Faster types get larger buffers, so
+the neighbor list does not include needless pairs of slow particles.
+`NeighborList.type_buffer` reports the selected widths.
+
 .. rubric:: Base distance cutoff
 
 The `NeighborList.r_cut` attribute can be used to set the base cutoff distance
@@ -100,8 +118,21 @@ class NeighborList(Compute):
     **Members defined in** `NeighborList`:
 
     Attributes:
+        auto_buffer (bool): Tune the buffer width of each particle type at
+            every build, up to `buffer`. Defaults to `False`.
         buffer (float): Buffer width :math:`[\mathrm{length}]`.
         check_dist (bool): Flag to enable / disable distance checking.
+        cluster_pairs (bool): Also group the particles into clusters of 8
+            consecutive indices and list the neighboring cluster pairs. On the
+            GPU, `hoomd.md.pair.Pair` then computes the forces one cluster pair
+            at a time, which balances the work of the threads in dense fluids.
+            Clusters are compact only when the particles are sorted (see
+            `hoomd.tune.ParticleSorter`). Defaults to `False`.
+        compress_indices (bool): Also store each neighbor as a 16-bit offset
+            from the index of its particle, which pair forces read in place of
+            the full index when it fits. Reduces the memory traffic of pair
+            force computations after particles are sorted, at the cost of 2
+            additional bytes per neighbor. Defaults to `False`.
         exclusions (tuple[str]): Defines which particles to exclude from the
             neighbor list, as described in `hoomd.md.nlist`.
         mesh (Mesh): Associated mesh data structure.
@@ -128,6 +159,11 @@ class NeighborList(Compute):
     **Members inherited from**
     `NeighborList <hoomd.md.nlist.NeighborList>`:
 
+    .. py:attribute:: auto_buffer
+
+        Tune the buffer width of each particle type.
+        `Read more... <hoomd.md.nlist.NeighborList.auto_buffer>`
+
     .. py:attribute:: buffer
 
         Buffer width.
@@ -138,6 +174,16 @@ class NeighborList(Compute):
         Flag to enable / disable distance checking.
         `Read more... <hoomd.md.nlist.NeighborList.check_dist>`
 
+    .. py:attribute:: cluster_pairs
+
+        Also list the neighboring cluster pairs.
+        `Read more... <hoomd.md.nlist.NeighborList.cluster_pairs>`
+
+    .. py:attribute:: compress_indices
+
+        Also store each neighbor as a 16-bit offset.
+        `Read more... <hoomd.md.nlist.NeighborList.compress_indices>`
+
     .. py:attribute:: exclusions
 
         Defines which particles to exclude from the neighbor list.
@@ -188,6 +234,11 @@ class NeighborList(Compute):
         The shortest period between neighbor list rebuilds.
         `Read more... <hoomd.md.nlist.NeighborList.shortest_rebuild>`
 
+    .. py:property:: type_buffer
+
+        Buffer width of each particle type.
+        `Read more... <hoomd.md.nlist.NeighborList.type_buffer>`
+
     """
     )
 
@@ -222,6 +273,9 @@ class NeighborList(Compute):
             buffer=float(buffer),
             rebuild_check_delay=int(rebuild_check_delay),
             check_dist=bool(check_dist),
+            auto_buffer=False,
+            compress_indices=False,
+            cluster_pairs=False,
         )
         params["exclusions"] = exclusions
         self._param_dict.update(params)
@@ -412,6 +466,18 @@ class NeighborList(Compute):
         """
         return self._cpp_obj.num_builds
 
+    @property
+    def type_buffer(self):
+        r"""dict[str, float]: Buffer width of each particle type.
+
+        :math:`[\mathrm{length}]`
+
+        Each type uses the full `buffer` unless `auto_buffer` is `True`.
+        """
+        if not self._attached:
+            raise hoomd.error.DataAccessError("type_buffer")
+        return self._cpp_obj.getTypeBuffer()
+
 
 class Cell(NeighborList):
     r"""Neighbor list computed via a cell list.
@@ -429,6 +495,9 @@ class Cell(NeighborList):
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
         default_r_cut
+        incremental (bool): When `True`, update only the neighbors of
+            particles that moved far enough to trigger a rebuild.
+        sparse (bool): When `True`, store only the cells that hold particles.
 
     `Cell` finds neighboring particles using a fixed width cell list, allowing
     for *O(kN)* construction of the neighbor list where *k* is the number of
@@ -453,6 +522,30 @@ class Cell(NeighborList):
         number of cells in the system. In these cases, consider using `Stencil`
         or `Tree`, which can use less memory.
 
+    Set `incremental` to `True` when only a few particles move fast enough to
+    trigger rebuilds, such as a hot region next to a glassy bulk. When a
+    distance check finds that fewer than 10% of the particles (counted since the
+    last full build) moved half of the buffer, `Cell` rebuilds the neighbors of
+    those particles and adds them to the neighbors of the particles around them
+    instead of rebuilding the whole list. The neighbors of the other particles
+    are kept, so the lists grow until the next full build.
+
+    Note:
+        Incremental builds are only performed on the CPU with a single MPI
+        rank. Otherwise, `Cell` always rebuilds the whole list.
+
+    Set `sparse` to `True` for dilute systems and boxes that are mostly empty.
+    The sparse cell list stores the particles of the occupied cells one after
+    another and finds each cell with a binary search, so its memory scales with
+    the number of particles instead of the number of cells times
+    `allocated_particles_per_cell`. Building the sparse cell list sorts the
+    particles by cell, and each neighbor search looks up its cells, so dense
+    systems build faster with the default cell list. `Cell` does not perform
+    incremental builds when `sparse` is `True`.
+
+    Note:
+        Sparse cell lists are only supported on the CPU.
+
     Examples::
 
         cell = nlist.Cell()
@@ -466,6 +559,9 @@ class Cell(NeighborList):
     Attributes:
         deterministic (bool): When `True`, sort neighbors to help provide
             deterministic simulation runs.
+        incremental (bool): When `True`, update only the neighbors of
+            particles that moved far enough to trigger a rebuild.
+        sparse (bool): When `True`, store only the cells that hold particles.
     """
 
     __doc__ = __doc__.replace("{inherited}", NeighborList._doc_inherited)
@@ -479,17 +575,27 @@ class Cell(NeighborList):
         deterministic=False,
         mesh=None,
         default_r_cut=0.0,
+        incremental=False,
+        sparse=False,
     ):
         super().__init__(
             buffer, exclusions, rebuild_check_delay, check_dist, mesh, default_r_cut
         )
 
-        self._param_dict.update(ParameterDict(deterministic=bool(deterministic)))
+        self._param_dict.update(
+            ParameterDict(
+                deterministic=bool(deterministic),
+                incremental=bool(incremental),
+                sparse=bool(sparse),
+            )
+        )
 
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.CPU):
             nlist_cls = _md.NeighborListBinned
         else:
+            if self.sparse:
+                raise RuntimeError("Sparse cell lists are not supported on the GPU.")
             nlist_cls = _md.NeighborListGPUBinned
         self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def, self.buffer)
         super()._attach_hook()
@@ -628,6 +734,8 @@ class Tree(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
+        refit (bool): When `True`, refit the trees to the current positions
+            instead of building them again when possible.
 
     `Tree` creates a neighbor list using a bounding volume hierarchy (BVH) tree
     traversal in :math:`O(N \\log N)` time. A BVH tree of axis-aligned bounding
@@ -657,12 +765,33 @@ class Tree(NeighborList):
         improved algorithm that is currently implemented. Cite both if you
         utilize this neighbor list style in your work.
 
+    Set `refit` to `True` when particles move little between rebuilds, such as
+    in dense colloidal suspensions. A refit keeps the hierarchy of each tree and
+    only updates the bounding boxes of its nodes, which skips most of the build
+    cost. `Tree` builds the trees again when the total surface area of the
+    nodes grows to 1.5 times its value after the last full build, when the
+    particles are sorted, and when the box changes.
+
+    Note:
+        Refits are only performed on the GPU with a single MPI rank. Otherwise,
+        `Tree` always builds the trees again.
+
     Examples::
 
         nl_t = nlist.Tree(check_dist=False)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Tree`:
+
+    Attributes:
+        refit (bool): When `True`, refit the trees to the current positions
+            instead of building them again when possible.
     """
 
-    __doc__ += NeighborList._doc_inherited
+    __doc__ = __doc__.replace("{inherited}", NeighborList._doc_inherited)
 
     def __init__(
         self,
@@ -672,11 +801,14 @@ class Tree(NeighborList):
         check_dist=True,
         mesh=None,
         default_r_cut=0.0,
+        refit=False,
     ):
         super().__init__(
             buffer, exclusions, rebuild_check_delay, check_dist, mesh, default_r_cut
         )
 
+        self._param_dict.update(ParameterDict(refit=bool(refit)))
+
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.CPU):
             nlist_cls = _md.NeighborListTree
@@ -686,8 +818,258 @@ class Tree(NeighborList):
         super()._attach_hook()
 
 
+class Body(NeighborList):
+    """Neighbor list that searches pairs of rigid bodies first.
+
+    Args:
+        buffer (float): Buffer width :math:`[\\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exclude from the
+            neighbor list, see more details in `NeighborList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        check_dist (bool): Flag to enable / disable distance checking.
+        mesh (Mesh): When a mesh object is passed, the neighbor list uses the
+            mesh to determine the bond exclusions in addition to all other
+            set exclusions.
+        default_r_cut
+
+    When ``"body"`` is in `exclusions`, `Body` treats all particles in the same
+    body as one unit and every other particle as a unit by itself. Each unit is
+    bounded by a sphere around the mean position of its particles. `Body` first
+    finds the pairs of units whose spheres are within the largest
+    :math:`r_\\mathrm{cut} + r_\\mathrm{buffer}` of each other using a cell
+    list of the unit centers. It then checks the pairs of particles in those
+    unit pairs, skipping the units that are out of range of each particle.
+    `Body` never visits the pairs of particles in the same body, which `Cell`,
+    `Stencil`, and `Tree` find and then discard. Use `Body` for systems of large
+    rigid bodies, such as patchy particles with hundreds of constituent
+    particles each.
+
+    Without the ``"body"`` exclusion, every particle is a unit and `Body`
+    builds the list like a cell list that is sized to the largest unit, so use
+    `Cell` instead.
+
+    Note:
+        `Body` is only available on the CPU.
+
+    Examples::
+
+        nl_b = nlist.Body(buffer=0.4, exclusions=("body",))
+
+    {inherited}
+    """
+
+    __doc__ = __doc__.replace("{inherited}", NeighborList._doc_inherited)
+
+    def __init__(
+        self,
+        buffer,
+        exclusions=("bond",),
+        rebuild_check_delay=1,
+        check_dist=True,
+        mesh=None,
+        default_r_cut=0.0,
+    ):
+        super().__init__(
+            buffer, exclusions, rebuild_check_delay, check_dist, mesh, default_r_cut
+        )
+
+    def _attach_hook(self):
+        if not isinstance(self._simulation.device, hoomd.device.CPU):
+            raise NotImplementedError("Body is not implemented on the GPU")
+        self._cpp_obj = _md.NeighborListBody(
+            self._simulation.state._cpp_sys_def, self.buffer
+        )
+        super()._attach_hook()
+
+
+class MultiLevel(NeighborList):
+    r"""Neighbor list computed with one cell list per cutoff class.
+
+    Args:
+        buffer (float): Buffer width :math:`[\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exclude from the
+            neighbor list, see more details in `NeighborList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        check_dist (bool): Flag to enable / disable distance checking.
+        mesh (Mesh): When a mesh object is passed, the neighbor list uses the
+            mesh to determine the bond exclusions in addition to all other
+            set exclusions.
+        default_r_cut
+        level_ratio (float): Largest ratio between the :math:`r_\mathrm{list}`
+            of two types in the same level.
+
+    `MultiLevel` sorts the particle types into levels by their
+    :math:`r_\mathrm{list} = r_\mathrm{cut} + r_\mathrm{buffer}` with
+    themselves. In order of increasing :math:`r_\mathrm{list}`, a type joins
+    the current level while its :math:`r_\mathrm{list}` is at most
+    `level_ratio` times the smallest one in the level, and starts a new level
+    otherwise. Each level bins the particles of its types in a separate cell
+    list with cells as wide as the largest :math:`r_\mathrm{list}` between two
+    of its types. Each particle then searches the cells of every level within
+    its largest :math:`r_\mathrm{list}` with the types of that level.
+
+    Use `MultiLevel` for strongly size-asymmetric mixtures, such as colloids in
+    a solvent of small particles. `Cell` sizes every cell to the largest cutoff,
+    so the solvent particles search far more candidates than they need.
+    `MultiLevel` searches the solvent in small cells, and only the searches that
+    involve colloids cover large distances.
+
+    Note:
+        `MultiLevel` is only available on the CPU.
+
+    Examples::
+
+        nl_m = nlist.MultiLevel(buffer=0.4)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `MultiLevel`:
+
+    Attributes:
+        level_ratio (float): Largest ratio between the
+            :math:`r_\mathrm{list}` of two types in the same level.
+    """
+
+    __doc__ = __doc__.replace("{inherited}", NeighborList._doc_inherited)
+
+    def __init__(
+        self,
+        buffer,
+        exclusions=("bond",),
+        rebuild_check_delay=1,
+        check_dist=True,
+        mesh=None,
+        default_r_cut=0.0,
+        level_ratio=2.0,
+    ):
+        super().__init__(
+            buffer, exclusions, rebuild_check_delay, check_dist, mesh, default_r_cut
+        )
+
+        self._param_dict.update(ParameterDict(level_ratio=float(level_ratio)))
+
+    def _attach_hook(self):
+        if not isinstance(self._simulation.device, hoomd.device.CPU):
+            raise NotImplementedError("MultiLevel is not implemented on the GPU")
+        self._cpp_obj = _md.NeighborListMultiLevel(
+            self._simulation.state._cpp_sys_def, self.buffer
+        )
+        super()._attach_hook()
+
+    @log(requires_run=True, default=False)
+    def num_levels(self):
+        """int: Number of levels in the last build."""
+        return self._cpp_obj.num_levels
+
+
+class Auto(NeighborList):
+    """Neighbor list that selects the fastest build algorithm.
+
+    Args:
+        buffer (float): Buffer width :math:`[\\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exclude from the
+            neighbor list, see more details in `NeighborList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        check_dist (bool): Flag to enable / disable distance checking.
+        mesh (Mesh): When a mesh object is passed, the neighbor list uses the
+            mesh to determine the bond exclusions in addition to all other
+            set exclusions.
+        default_r_cut
+        selection_period (int): Number of time steps between selections. Set
+            to 0 to select only once.
+
+    The fastest of `Cell`, `Stencil`, and `Tree` depends on the size
+    dispersity, the density, and the hardware. `Auto` measures the build time
+    of each on the simulation it is attached to and uses the fastest. The pair
+    forces that use `Auto` are not affected when it changes the algorithm.
+
+    A selection times three builds of each algorithm, in turn. These are the
+    regular builds of the neighbor list, so the only cost of a selection is
+    the extra time spent in the slower algorithms. `Auto` selects at its first
+    builds and again at the first build `selection_period` time steps after the
+    last selection, so it follows changes to the system such as compression.
+    `Stencil` uses cells as wide as the smallest cutoff plus the buffer.
+
+    Note:
+        In MPI parallel simulations, each rank selects the algorithm that is
+        fastest on its domain. `algorithm` reports the selection on rank 0.
+
+    Examples::
+
+        nl_a = nlist.Auto(buffer=0.4)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Auto`:
+
+    Attributes:
+        selection_period (int): Number of time steps between selections. Set
+            to 0 to select only once.
+    """
+
+    __doc__ = __doc__.replace("{inherited}", NeighborList._doc_inherited)
+
+    _algorithms = ("Cell", "Stencil", "Tree")
+
+    def __init__(
+        self,
+        buffer,
+        exclusions=("bond",),
+        rebuild_check_delay=1,
+        check_dist=True,
+        mesh=None,
+        default_r_cut=0.0,
+        selection_period=10000,
+    ):
+        super().__init__(
+            buffer, exclusions, rebuild_check_delay, check_dist, mesh, default_r_cut
+        )
+
+        self._param_dict.update(ParameterDict(selection_period=int(selection_period)))
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            nlist_cls = _md.NeighborListAuto
+            candidate_cls = (
+                _md.NeighborListBinned,
+                _md.NeighborListStencil,
+                _md.NeighborListTree,
+            )
+        else:
+            nlist_cls = _md.NeighborListGPUAuto
+            candidate_cls = (
+                _md.NeighborListGPUBinned,
+                _md.NeighborListGPUStencil,
+                _md.NeighborListGPUTree,
+            )
+        sys_def = self._simulation.state._cpp_sys_def
+        candidates = [cls(sys_def, self.buffer) for cls in candidate_cls]
+        self._cpp_obj = nlist_cls(sys_def, self.buffer, candidates)
+        super()._attach_hook()
+
+    @log(requires_run=True, category="string")
+    def algorithm(self):
+        """str: Name of the selected build algorithm.
+
+        One of ``"Cell"``, ``"Stencil"``, or ``"Tree"``. While a selection is
+        in progress, `algorithm` is the previous selection (``"Cell"`` during
+        the first selection).
+        """
+        return self._algorithms[self._cpp_obj.selected]
+
+
 __all__ = [
+    "Auto",
+    "Body",
     "Cell",
+    "MultiLevel",
     "NeighborList",
     "Stencil",
     "Tree",
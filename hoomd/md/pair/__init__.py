@@ -158,6 +158,8 @@ from .pair import (
     Table,
     TWF,
     LJGauss,
+    LJYukawa,
+    LJDispersionEwald,
 )
 
 __all__ = [
@@ -167,6 +169,7 @@ __all__ = [
     "LJ",
     "LJ0804",
     "LJ1208",
+    "LJDispersionEwald",
     "OPP",
     "TWF",
     "ZBL",
@@ -180,6 +183,7 @@ __all__ = [
     "Fourier",
     "Gaussian",
     "LJGauss",
+    "LJYukawa",
     "Mie",
     "Moliere",
     "Morse",
@@ -9,6 +9,7 @@ import warnings
 import hoomd
 from hoomd.md import _md
 from hoomd.md import force
+from hoomd.util import _LazyModule
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.data.typeparam import TypeParameter
 import numpy as np
@@ -256,6 +257,7 @@ class LJ(Pair):
         Type: `bool`
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_lj")
     _cpp_class_name = "PotentialPairLJ"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -320,6 +322,7 @@ class Gaussian(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_gauss")
     _cpp_class_name = "PotentialPairGauss"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -380,6 +383,7 @@ class ExpandedGaussian(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_expandedgaussian")
     _cpp_class_name = "PotentialPairExpandedGaussian"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -445,6 +449,7 @@ class ExpandedLJ(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_expandedlj")
     _cpp_class_name = "PotentialPairExpandedLJ"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -503,6 +508,7 @@ class Yukawa(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_yukawa")
     _cpp_class_name = "PotentialPairYukawa"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -516,6 +522,171 @@ class Yukawa(Pair):
         self._add_typeparam(params)
 
 
+class LJYukawa(Pair):
+    r"""Sum of the Lennard-Jones and Yukawa pair forces.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting/smoothing mode.
+
+    `LJYukawa` computes the sum of the `LJ` and `Yukawa` pair forces on every
+    particle in the simulation state:
+
+    .. math::
+
+        U(r) = 4 \varepsilon_\mathrm{LJ} \left[ \left(
+               \frac{\sigma}{r} \right)^{12} - \left( \frac{\sigma}{r}
+               \right)^{6} \right] + \varepsilon_\mathrm{Yukawa}
+               \frac{ \exp \left( -\kappa r \right) }{r}
+
+    `LJYukawa` evaluates both terms in one pass over the neighbor list and
+    computes the same forces as separate `LJ` and `Yukawa` instances with the
+    same cutoffs, shift modes, and neighbor list. Both terms share `r_cut`,
+    `r_on`, and `mode`.
+
+    Example::
+
+        nl = nlist.Cell()
+        lj_yukawa = pair.LJYukawa(default_r_cut=3.0, nlist=nl)
+        lj_yukawa.params[("A", "A")] = dict(
+            lj=dict(epsilon=1.0, sigma=1.0),
+            yukawa=dict(epsilon=1.0, kappa=1.0),
+        )
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `LJYukawa`:
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``lj`` (`dict`, **required**) - parameters of the Lennard-Jones
+          term:
+
+          * ``epsilon`` (`float`, **required**) - energy parameter
+            :math:`\varepsilon_\mathrm{LJ}` :math:`[\mathrm{energy}]`
+          * ``sigma`` (`float`, **required**) - particle size
+            :math:`\sigma` :math:`[\mathrm{length}]`
+
+        * ``yukawa`` (`dict`, **required**) - parameters of the Yukawa term:
+
+          * ``epsilon`` (`float`, **required**) - energy parameter
+            :math:`\varepsilon_\mathrm{Yukawa}`
+            :math:`[\mathrm{energy}] [\mathrm{length}]`
+          * ``kappa`` (`float`, **required**) - scaling parameter
+            :math:`\kappa` :math:`[\mathrm{length}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+    """
+
+    _ext_module = _LazyModule("hoomd.md._md_pair_ljyukawa")
+    _cpp_class_name = "PotentialPairLJYukawa"
+    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
+
+    def __init__(self, nlist, default_r_cut=None, default_r_on=0.0, mode="none"):
+        super().__init__(nlist, default_r_cut, default_r_on, mode)
+        params = TypeParameter(
+            "params",
+            "particle_types",
+            TypeParameterDict(
+                {
+                    "lj": {"epsilon": float, "sigma": float},
+                    "yukawa": {"epsilon": float, "kappa": float},
+                },
+                len_keys=2,
+            ),
+        )
+        self._add_typeparam(params)
+
+
+class LJDispersionEwald(Pair):
+    r"""Real space part of the Lennard-Jones pair force with PPPM dispersion.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting mode.
+
+    `LJDispersionEwald` computes the `LJ` pair force plus the real space
+    correction for the long range dispersion force that
+    `md.long_range.pppm.Dispersion` computes on the mesh:
+
+    .. math::
+
+        U(r) = 4 \varepsilon \left[ \left( \frac{\sigma}{r} \right)^{12} -
+               \left( \frac{\sigma}{r} \right)^{6} \right]
+               + C_6 \frac{1 - g(\beta r)}{r^6}
+
+    where :math:`g(x) = e^{-x^2} \left(1 + x^2 + x^4 / 2 \right)`.
+
+    Call `md.long_range.pppm.make_pppm_dispersion_forces` to create an instance
+    of `LJDispersionEwald` and `md.long_range.pppm.Dispersion` that together
+    implement the PPPM method for Lennard-Jones dispersion. Set the ``lj``
+    parameters and `md.long_range.pppm.Dispersion` sets the
+    ``dispersion_ewald`` parameters.
+
+    Example::
+
+        lj_dispersion.params[("A", "A")] = dict(lj=dict(epsilon=1.0, sigma=1.0))
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `LJDispersionEwald`:
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``lj`` (`dict`, **required**) - parameters of the Lennard-Jones
+          term:
+
+          * ``epsilon`` (`float`, **required**) - energy parameter
+            :math:`\varepsilon` :math:`[\mathrm{energy}]`
+          * ``sigma`` (`float`, **required**) - particle size
+            :math:`\sigma` :math:`[\mathrm{length}]`
+
+        * ``dispersion_ewald`` (`dict`) - parameters of the real space
+          correction:
+
+          * ``c6`` (`float`, **optional**, defaults to 0) - dispersion
+            coefficient computed on the mesh :math:`C_6`
+            :math:`[\mathrm{energy}] [\mathrm{length}]^6`
+          * ``beta`` (`float`, **optional**, defaults to 0) - splitting
+            parameter :math:`\beta` :math:`[\mathrm{length}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+    """
+
+    _ext_module = _LazyModule("hoomd.md._md_pair_ljdispersionewald")
+    _cpp_class_name = "PotentialPairLJDispersionEwald"
+    __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
+    _accepted_modes = ("none", "shift")
+
+    def __init__(self, nlist, default_r_cut=None, mode="none"):
+        super().__init__(nlist, default_r_cut, 0.0, mode)
+        params = TypeParameter(
+            "params",
+            "particle_types",
+            TypeParameterDict(
+                {
+                    "lj": {"epsilon": float, "sigma": float},
+                    "dispersion_ewald": {"c6": 0.0, "beta": 0.0},
+                },
+                len_keys=2,
+            ),
+        )
+        self._add_typeparam(params)
+
+
 class Ewald(Pair):
     r"""Ewald pair force.
 
@@ -560,11 +731,18 @@ class Ewald(Pair):
           :math:`\kappa` :math:`[\mathrm{length}^{-1}]`
         * ``alpha`` (`float`, **required**) - Debye screening length
           :math:`\alpha` :math:`[\mathrm{length}^{-1}]`
+        * ``approximate_erfc`` (`bool`, **optional**) - Evaluate
+          :math:`\mathrm{erfc}` with a polynomial approximation that has an
+          absolute error below :math:`1.5 \cdot 10^{-7}` (*default*:
+          ``False``). The error of the energy is then below :math:`1.5 \cdot
+          10^{-7} q_i q_j e^{\alpha r} / r`, which is usually much smaller than the
+          truncation error of the real space term at ``r_cut``.
 
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_ewald")
     _cpp_class_name = "PotentialPairEwald"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
     _accepted_modes = ("none",)
@@ -576,7 +754,9 @@ class Ewald(Pair):
         params = TypeParameter(
             "params",
             "particle_types",
-            TypeParameterDict(kappa=float, alpha=0.0, len_keys=2),
+            TypeParameterDict(
+                kappa=float, alpha=0.0, approximate_erfc=False, len_keys=2
+            ),
         )
 
         self._add_typeparam(params)
@@ -622,11 +802,20 @@ class Table(Pair):
 
     Provide :math:`F_\\mathrm{table}(r)` and :math:`U_\\mathrm{table}(r)` on
     evenly spaced grid points points between :math:`r_{\\mathrm{min}}` and
-    :math:`r_{\\mathrm{cut}}`. `Table` linearly interpolates values when
+    :math:`r_{\\mathrm{cut}}`. `Table` interpolates values when
     :math:`r` lies between grid points and between the last grid point and
     :math:`r=r_{\\mathrm{cut}}`.  The force must be commensurate with
     the potential: :math:`F = -\\frac{\\partial U}{\\partial r}`.
 
+    With ``interpolation="linear"``, `Table` linearly interpolates
+    :math:`U_\\mathrm{table}` and :math:`F_\\mathrm{table}` separately. With
+    ``interpolation="cubic"``, `Table` interpolates :math:`U` with the cubic
+    Hermite spline that matches both :math:`U_\\mathrm{table}` and
+    :math:`F_\\mathrm{table}` at the grid points and computes :math:`F` from
+    the derivative of the spline. Cubic interpolation reaches the same accuracy
+    with far fewer grid points and the force is consistent with the
+    interpolated energy.
+
     `Table` does not support energy shifting or smoothing modes.
 
     Note:
@@ -668,8 +857,12 @@ class Table(Pair):
           * ``F`` ((*N*,) `numpy.ndarray` of `float`, **required**) -
             the tabulated force values :math:`[\\mathrm{force}]`. Must have the
             same length as ``U``.
+
+          * ``interpolation`` (`str`, **optional**) - the interpolation
+            method: ``"linear"`` or ``"cubic"``. Defaults to ``"linear"``.
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_table")
     _cpp_class_name = "PotentialPairTable"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
     _accepted_modes = ("none",)
@@ -685,6 +878,7 @@ class Table(Pair):
                 r_min=float,
                 U=hoomd.data.typeconverter.NDArrayValidator(np.float64),
                 F=hoomd.data.typeconverter.NDArrayValidator(np.float64),
+                interpolation="linear",
                 len_keys=2,
             ),
         )
@@ -736,6 +930,7 @@ class Morse(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_morse")
     _cpp_class_name = "PotentialPairMorse"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1067,6 +1262,7 @@ class ForceShiftedLJ(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_forceshiftedlj")
     _cpp_class_name = "PotentialPairForceShiftedLJ"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
     _accepted_modes = ("none",)
@@ -1152,6 +1348,7 @@ class Moliere(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_moliere")
     _cpp_class_name = "PotentialPairMoliere"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1231,6 +1428,7 @@ class ZBL(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_zbl")
     _cpp_class_name = "PotentialPairZBL"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
     _accepted_modes = ("none",)
@@ -1294,6 +1492,7 @@ class Mie(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_mie")
     _cpp_class_name = "PotentialPairMie"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1373,6 +1572,7 @@ class ExpandedMie(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_expandedmie")
     _cpp_class_name = "PotentialPairExpandedMie"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1457,6 +1657,7 @@ class ReactionField(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_reactionfield")
     _cpp_class_name = "PotentialPairReactionField"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1537,6 +1738,7 @@ class DLVO(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_dlvo")
     _cpp_class_name = "PotentialPairDLVO"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
     _accepted_modes = ("none", "shift")
@@ -1603,6 +1805,7 @@ class Buckingham(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_buckingham")
     _cpp_class_name = "PotentialPairBuckingham"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1661,6 +1864,7 @@ class LJ1208(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_lj1208")
     _cpp_class_name = "PotentialPairLJ1208"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1720,6 +1924,7 @@ class LJ0804(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_lj0804")
     _cpp_class_name = "PotentialPairLJ0804"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1785,6 +1990,7 @@ class Fourier(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_fourier")
     _cpp_class_name = "PotentialPairFourier"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
     _accepted_modes = ("none", "xplor")
@@ -1867,6 +2073,7 @@ class OPP(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_opp")
     _cpp_class_name = "PotentialPairOPP"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -1943,6 +2150,7 @@ class TWF(Pair):
         `dict`]
     """
 
+    _ext_module = _LazyModule("hoomd.md._md_pair_twf")
     _cpp_class_name = "PotentialPairTWF"
     __doc__ = __doc__.replace("{inherited}", Pair._doc_inherited)
 
@@ -140,6 +140,25 @@ def test_update(active_force, local_simulation_factory):
         assert not np.allclose(old_orientations, new_orientations)
 
 
+def test_fused_update(active_force, local_simulation_factory):
+    active_force.active_force.default = (1.0, 0.0, 0.0)
+    active_force.active_torque.default = (0.0, 0.0, 0.0)
+    orientations = []
+    for fuse_with_force in (False, True):
+        rd_updater = active_force.create_diffusion_updater(
+            1, 0.1, fuse_with_force=fuse_with_force
+        )
+        assert rd_updater.fuse_with_force == fuse_with_force
+        sim = local_simulation_factory(active_force, rd_updater)
+        sim.run(10)
+        snapshot = sim.state.get_snapshot()
+        if sim.device.communicator.rank == 0:
+            orientations.append(snapshot.particles.orientation)
+        sim.operations.integrator.forces.remove(active_force)
+
+    if len(orientations) == 2:
+        np.testing.assert_allclose(orientations[0], orientations[1], atol=1e-6)
+
 def test_pickling(active_force, local_simulation_factory):
     # don't add the rd_updater since operation_pickling_check will deal with
     # that.
@@ -1,6 +1,8 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import math
+
 import hoomd
 from hoomd.conftest import pickling_check
 import hoomd.md.alchemy
@@ -67,7 +69,6 @@ def test_before_attaching(
     "alchemostat_cls, extra_property_1st_value, extra_property_2nd_value",
     get_alchemostat(),
 )
-@pytest.mark.cpu
 @pytest.mark.serial
 def test_after_attaching(
     simulation_factory,
@@ -107,7 +108,6 @@ def test_after_attaching(
     sim.run(10)
 
 
-@pytest.mark.cpu
 @pytest.mark.serial
 @pytest.mark.parametrize("alchemical_potential", [hoomd.md.alchemy.pair.LJGauss])
 def test_pickling_potential(
@@ -127,3 +127,24 @@ def test_pickling_potential(
     sim.operations.integrator = integrator
     sim.run(0)
     pickling_check(ljg)
+
+
+@pytest.mark.serial
+def test_net_alchemical_force(simulation_factory, two_particle_snapshot_factory):
+    """Test the alchemical force on epsilon against the analytic derivative."""
+    sim = simulation_factory(two_particle_snapshot_factory(dimensions=3, d=1))
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ljg = hoomd.md.alchemy.pair.LJGauss(nlist, default_r_cut=3.0)
+    ljg.params[("A", "A")] = dict(epsilon=1.5, sigma=0.5, r0=1.2)
+    epsilon_dof = ljg.epsilon[("A", "A")]
+    alchemostat = hoomd.md.alchemy.methods.NVT(
+        period=10, alchemical_dof=[epsilon_dof], alchemical_kT=1.0
+    )
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[ljg], methods=[alchemostat])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    # dU/dalpha = -epsilon exp(-(r - r0)^2 / (2 sigma^2)), split evenly between the two
+    # particles and averaged
+    expected = 0.5 * 1.5 * math.exp(-((1.0 - 1.2) ** 2) / (2 * 0.5**2))
+    assert epsilon_dof.net_alchemical_force == pytest.approx(expected, rel=1e-5)
@@ -0,0 +1,247 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd import md
+from hoomd.conftest import expected_loggable_params
+from hoomd.conftest import (
+    logging_check,
+    pickling_check,
+    autotuned_kernel_parameter_check,
+)
+import pytest
+import numpy
+
+import itertools
+
+# Test parameters include the fused class, the separate bond class, and the
+# bond, angle, and dihedral params.
+bonded_test_parameters = [
+    (
+        hoomd.md.bonded.Harmonic,
+        hoomd.md.bond.Harmonic,
+        dict(k=30.0, r0=1.6),
+        dict(k=3.0, t0=numpy.pi / 2),
+        dict(k=1.5, d=1, n=2, phi0=numpy.pi / 3),
+    ),
+    (
+        hoomd.md.bonded.FENEWCA,
+        hoomd.md.bond.FENEWCA,
+        dict(k=30.0, r0=1.6, epsilon=0.9, sigma=1.1, delta=-0.5),
+        dict(k=10.0, t0=numpy.pi / 4),
+        dict(k=3.0, d=-1, n=1, phi0=0),
+    ),
+    (
+        hoomd.md.bonded.Tether,
+        hoomd.md.bond.Tether,
+        dict(k_b=5.0, l_min=0.7, l_c1=0.9, l_c0=1.1, l_max=1.3),
+        dict(k=5.0, t0=numpy.pi / 6),
+        dict(k=0.0, d=1, n=1, phi0=0),
+    ),
+]
+
+
+@pytest.fixture(scope="session")
+def chain_snapshot_factory(device):
+    def make_snapshot(L=20):
+        snapshot = hoomd.Snapshot(device.communicator)
+        if snapshot.communicator.rank == 0:
+            snapshot.configuration.box = [L, L, L, 0, 0, 0]
+            snapshot.particles.N = 4
+            snapshot.particles.types = ["A"]
+            # a bent and twisted chain, shifted slightly in z so MPI tests pass
+            snapshot.particles.position[:] = [
+                [-0.4, 0.8, 0.3],
+                [0.0, 0.0, 0.1],
+                [1.0, 0.1, 0.1],
+                [1.3, 0.7, -0.6],
+            ]
+
+            snapshot.bonds.N = 3
+            snapshot.bonds.types = ["A-A"]
+            snapshot.bonds.group[:] = [[0, 1], [1, 2], [2, 3]]
+
+            snapshot.angles.N = 2
+            snapshot.angles.types = ["A-A-A"]
+            snapshot.angles.group[:] = [[0, 1, 2], [1, 2, 3]]
+
+            snapshot.dihedrals.N = 1
+            snapshot.dihedrals.types = ["A-A-A-A"]
+            snapshot.dihedrals.group[0] = (0, 1, 2, 3)
+
+        return snapshot
+
+    return make_snapshot
+
+
+def _make_fused(fused_cls, bond_params, angle_params, dihedral_params):
+    potential = fused_cls()
+    potential.bond_params["A-A"] = bond_params
+    potential.angle_params["A-A-A"] = angle_params
+    potential.dihedral_params["A-A-A-A"] = dihedral_params
+    return potential
+
+
+@pytest.mark.parametrize(
+    "fused_cls, bond_cls, bond_params, angle_params, dihedral_params",
+    bonded_test_parameters,
+)
+def test_before_attaching(
+    fused_cls, bond_cls, bond_params, angle_params, dihedral_params
+):
+    potential = _make_fused(fused_cls, bond_params, angle_params, dihedral_params)
+    for key in bond_params:
+        assert potential.bond_params["A-A"][key] == pytest.approx(bond_params[key])
+    for key in angle_params:
+        assert potential.angle_params["A-A-A"][key] == pytest.approx(
+            angle_params[key]
+        )
+    for key in dihedral_params:
+        assert potential.dihedral_params["A-A-A-A"][key] == pytest.approx(
+            dihedral_params[key]
+        )
+
+
+@pytest.mark.parametrize(
+    "fused_cls, bond_cls, bond_params, angle_params, dihedral_params",
+    bonded_test_parameters,
+)
+def test_after_attaching(
+    chain_snapshot_factory,
+    simulation_factory,
+    fused_cls,
+    bond_cls,
+    bond_params,
+    angle_params,
+    dihedral_params,
+):
+    sim = simulation_factory(chain_snapshot_factory(L=5))
+    potential = _make_fused(fused_cls, bond_params, angle_params, dihedral_params)
+
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[potential])
+
+    sim.run(0)
+    for key in bond_params:
+        assert potential.bond_params["A-A"][key] == pytest.approx(bond_params[key])
+    for key in angle_params:
+        assert potential.angle_params["A-A-A"][key] == pytest.approx(
+            angle_params[key]
+        )
+    for key in dihedral_params:
+        assert potential.dihedral_params["A-A-A-A"][key] == pytest.approx(
+            dihedral_params[key]
+        )
+
+
+@pytest.mark.parametrize(
+    "fused_cls, bond_cls, bond_params, angle_params, dihedral_params",
+    bonded_test_parameters,
+)
+def test_matches_separate_forces(
+    chain_snapshot_factory,
+    simulation_factory,
+    fused_cls,
+    bond_cls,
+    bond_params,
+    angle_params,
+    dihedral_params,
+):
+    """Test that the fused force is the sum of the separate forces."""
+    sim = simulation_factory(chain_snapshot_factory())
+    fused = _make_fused(fused_cls, bond_params, angle_params, dihedral_params)
+
+    bond = bond_cls()
+    bond.params["A-A"] = bond_params
+    angle = hoomd.md.angle.Harmonic()
+    angle.params["A-A-A"] = angle_params
+    dihedral = hoomd.md.dihedral.Periodic()
+    dihedral.params["A-A-A-A"] = dihedral_params
+
+    separate = [bond, angle, dihedral]
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.005, forces=[fused, *separate]
+    )
+
+    sim.run(0)
+
+    fused_energies = fused.energies
+    fused_forces = fused.forces
+    fused_virials = fused.virials
+    separate_energies = [f.energies for f in separate]
+    separate_forces = [f.forces for f in separate]
+    separate_virials = [f.virials for f in separate]
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(
+            fused_energies, sum(separate_energies), rtol=1e-5, atol=1e-5
+        )
+        numpy.testing.assert_allclose(
+            fused_forces, sum(separate_forces), rtol=1e-5, atol=1e-5
+        )
+        numpy.testing.assert_allclose(
+            fused_virials, sum(separate_virials), rtol=1e-5, atol=1e-5
+        )
+
+
+@pytest.mark.parametrize(
+    "fused_cls, bond_cls, bond_params, angle_params, dihedral_params",
+    bonded_test_parameters,
+)
+def test_kernel_parameters(
+    chain_snapshot_factory,
+    simulation_factory,
+    fused_cls,
+    bond_cls,
+    bond_params,
+    angle_params,
+    dihedral_params,
+):
+    sim = simulation_factory(chain_snapshot_factory())
+    potential = _make_fused(fused_cls, bond_params, angle_params, dihedral_params)
+
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[potential])
+
+    sim.run(0)
+
+    autotuned_kernel_parameter_check(instance=potential, activate=lambda: sim.run(1))
+
+
+# Test Logging
+@pytest.mark.parametrize(
+    "cls, expected_namespace, expected_loggables",
+    zip(
+        (
+            md.bonded.Bonded,
+            md.bonded.Harmonic,
+            md.bonded.FENEWCA,
+            md.bonded.Tether,
+        ),
+        itertools.repeat(("md", "bonded")),
+        itertools.repeat(expected_loggable_params),
+    ),
+)
+def test_logging(cls, expected_namespace, expected_loggables):
+    logging_check(cls, expected_namespace, expected_loggables)
+
+
+# Pickle Testing
+@pytest.mark.parametrize(
+    "fused_cls, bond_cls, bond_params, angle_params, dihedral_params",
+    bonded_test_parameters,
+)
+def test_pickling(
+    simulation_factory,
+    chain_snapshot_factory,
+    fused_cls,
+    bond_cls,
+    bond_params,
+    angle_params,
+    dihedral_params,
+):
+    sim = simulation_factory(chain_snapshot_factory())
+    potential = _make_fused(fused_cls, bond_params, angle_params, dihedral_params)
+
+    pickling_check(potential)
+    integrator = hoomd.md.Integrator(0.05, forces=[potential])
+    sim.operations.integrator = integrator
+    sim.run(0)
+    pickling_check(potential)
@@ -3,6 +3,7 @@
 
 import hoomd
 from hoomd.conftest import pickling_check, autotuned_kernel_parameter_check
+from hoomd.error import TypeConversionError
 import numpy
 import pytest
 
@@ -91,6 +92,19 @@ def test_attach_detach(simulation_factory, polymer_snapshot_factory):
     d.tolerance = 1e-3
     assert d.tolerance == 1e-3
 
+    assert d.solver == "direct"
+    assert d.solver_tolerance == 1e-8
+    assert d.max_iterations == 100
+    d.solver = "iterative"
+    d.solver_tolerance = 1e-10
+    d.max_iterations = 50
+    assert d.solver == "iterative"
+    assert d.solver_tolerance == 1e-10
+    assert d.max_iterations == 50
+
+    with pytest.raises(TypeConversionError):
+        d.solver = "cg"
+
     # attached
     sim = simulation_factory(polymer_snapshot_factory())
     integrator = hoomd.md.Integrator(dt=0.005)
@@ -104,6 +118,13 @@ def test_attach_detach(simulation_factory, polymer_snapshot_factory):
     d.tolerance = 1e-5
     assert d.tolerance == 1e-5
 
+    assert d.solver == "iterative"
+    assert d.solver_tolerance == 1e-10
+    assert d.max_iterations == 50
+    d.solver = "direct"
+    assert d.solver == "direct"
+    sim.run(1)
+
 
 def test_pickling(simulation_factory, polymer_snapshot_factory):
     """Test that md.constrain.Distance can be pickled and unpickled."""
@@ -122,9 +143,10 @@ def test_pickling(simulation_factory, polymer_snapshot_factory):
     pickling_check(d)
 
 
-def test_basic_simulation(simulation_factory, polymer_snapshot_factory):
+@pytest.mark.parametrize("solver", ["direct", "iterative"])
+def test_basic_simulation(simulation_factory, polymer_snapshot_factory, solver):
     """Ensure that distances are constrained in a basic simulation."""
-    d = hoomd.md.constrain.Distance()
+    d = hoomd.md.constrain.Distance(solver=solver)
 
     sim = simulation_factory(polymer_snapshot_factory())
     integrator = hoomd.md.Integrator(dt=0.005)
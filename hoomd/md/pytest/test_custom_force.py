@@ -102,6 +102,7 @@ def test_simulation(
         sim = force_simulation_factory(custom_force, snap)
         _skip_if_gpu_device_and_no_cupy(sim)
         sim.run(1)
+        assert not custom_force.asynchronous
 
         forces = custom_force.forces
         energies = custom_force.energies
@@ -496,3 +497,41 @@ def test_force_zeroing(force_simulation_factory, two_particle_snapshot_factory):
             assert np.allclose(forces, timestep)
             assert np.allclose(torques, timestep)
             assert np.allclose(virials, timestep)
+
+
+def test_asynchronous(force_simulation_factory, lattice_snapshot_factory):
+    class AsynchronousForce(md.force.Custom):
+        def __init__(self):
+            super().__init__(aniso=True, asynchronous=True)
+            self.streams = []
+
+        def set_forces(self, timestep, stream):
+            self.streams.append(stream)
+            if stream is None:
+                with self.cpu_local_force_arrays as arrays:
+                    arrays.force[:] = -5
+                    arrays.torque[:] = 23
+            else:
+                with self.gpu_local_force_arrays as arrays:
+                    with cupy.cuda.ExternalStream(stream):
+                        arrays.force[:] = -5
+                        arrays.torque[:] = 23
+
+    custom_force = AsynchronousForce()
+    assert custom_force.asynchronous
+    sim = force_simulation_factory(custom_force, lattice_snapshot_factory())
+    _skip_if_gpu_device_and_no_cupy(sim)
+    sim.run(2)
+    assert custom_force.asynchronous
+
+    assert len(custom_force.streams) > 0
+    if isinstance(sim.device, hoomd.device.GPU):
+        assert all(isinstance(s, int) for s in custom_force.streams)
+    else:
+        assert all(s is None for s in custom_force.streams)
+
+    forces = custom_force.forces
+    torques = custom_force.torques
+    if sim.device.communicator.rank == 0:
+        npt.assert_allclose(forces, -5)
+        npt.assert_allclose(torques, 23)
@@ -3,6 +3,7 @@
 
 import hoomd
 import numpy
+import pytest
 
 
 def test_per_particle_virial(simulation_factory, lattice_snapshot_factory):
@@ -43,3 +44,33 @@ def test_per_particle_virial(simulation_factory, lattice_snapshot_factory):
 
 
 # TODO: test compute thermo once it is implemented
+
+
+def test_potential_energy_flag(simulation_factory, lattice_snapshot_factory):
+    cell = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=cell)
+    lj.params[("A", "A")] = dict(sigma=1.0, epsilon=1.0)
+    lj.r_cut[("A", "A")] = 2.5
+
+    a = 2 ** (1.0 / 6.0)
+    sim = simulation_factory(lattice_snapshot_factory(n=10, a=a, r=a * 0.01))
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005)
+    sim.operations.integrator.forces.append(lj)
+    sim.run(0)
+
+    assert sim.always_compute_energy
+    energy = lj.energy
+    forces = lj.forces
+    assert energy != 0.0
+
+    # the forces skip the energy when no operation requests it
+    sim.always_compute_energy = False
+    assert not sim.always_compute_energy
+    sim.run(0)
+    assert lj.energy == 0.0
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(lj.forces, forces)
+
+    # the energy is computed again after setting the flag
+    sim.always_compute_energy = True
+    assert lj.energy == pytest.approx(energy)
@@ -435,6 +435,119 @@ def test_write_gsd_log(create_md_sim, tmp_path):
                 assert e == kinetic_energy_list[s]
 
 
+def test_write_gsd_asynchronous(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    logger = hoomd.logging.Logger()
+    logger.add(thermo, quantities=["kinetic_energy"])
+
+    gsd_writer = hoomd.write.GSD(
+        filename=filename,
+        trigger=hoomd.trigger.Periodic(1),
+        mode="wb",
+        dynamic=["property", "momentum"],
+        logger=logger,
+    )
+    gsd_writer.asynchronous = True
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.asynchronous
+
+    positions = []
+    kinetic_energy_list = []
+    for _ in range(8):
+        sim.run(1)
+        kinetic_energy_list.append(thermo.kinetic_energy)
+        snapshot = sim.state.get_snapshot()
+        if sim.device.communicator.rank == 0:
+            positions.append(np.array(snapshot.particles.position))
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode="r") as traj:
+            assert len(traj) == 8
+            for s in range(8):
+                assert traj[s].configuration.step == sim.timestep - 7 + s
+                np.testing.assert_allclose(
+                    traj[s].particles.position, positions[s], rtol=1e-6, atol=1e-5
+                )
+                e = traj[s].log["md/compute/ThermodynamicQuantities/kinetic_energy"]
+                assert e == kinetic_energy_list[s]
+
+
+def test_write_gsd_parallel_io(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(
+        filename=filename,
+        trigger=hoomd.trigger.Periodic(1),
+        mode="wb",
+        dynamic=["property", "momentum"],
+    )
+    gsd_writer.parallel_io = True
+    sim.operations.writers.append(gsd_writer)
+
+    snapshots = []
+    for _ in range(3):
+        sim.run(1)
+        snapshots.append(sim.state.get_snapshot())
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode="r") as traj:
+            assert len(traj) == 3
+            for frame, snapshot in zip(traj, snapshots):
+                np.testing.assert_allclose(
+                    frame.particles.position,
+                    snapshot.particles.position,
+                    rtol=1e-6,
+                    atol=1e-5,
+                )
+                np.testing.assert_allclose(
+                    frame.particles.velocity,
+                    snapshot.particles.velocity,
+                    rtol=1e-6,
+                    atol=1e-5,
+                )
+                np.testing.assert_array_equal(
+                    frame.particles.typeid, snapshot.particles.typeid
+                )
+
+
+def test_write_gsd_position_quantization(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+    bits = 10
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(
+        filename=filename, trigger=hoomd.trigger.Periodic(1), mode="wb"
+    )
+    gsd_writer.position_quantization_bits = bits
+    sim.operations.writers.append(gsd_writer)
+    sim.run(1)
+    gsd_writer.flush()
+
+    snapshot = sim.state.get_snapshot()
+    if sim.device.communicator.rank == 0:
+        box = snapshot.configuration.box
+        with gsd.hoomd.open(name=filename, mode="r") as traj:
+            position = traj[0].particles.position
+            tolerance = max(box[0:3]) / 2 ** (bits + 1) * 1.01
+            np.testing.assert_allclose(
+                position, snapshot.particles.position, atol=tolerance
+            )
+
+            # quantized fractional coordinates lie on the grid
+            fraction = (position[:, 0] + box[0] / 2) / box[0] * 2**bits
+            np.testing.assert_allclose(fraction, np.round(fraction), atol=1e-2)
+
+
 dynamic_fields = [
     "particles/position",
     "particles/orientation",
@@ -577,3 +690,85 @@ def test_write_gsd_no_dynamic(simulation_factory, hoomd_snapshot, tmp_path):
             assert not f.chunk_exists(frame=1, name="configuration/box")
             assert not f.chunk_exists(frame=1, name="particles/N")
             assert not f.chunk_exists(frame=1, name="particles/position")
+
+
+def test_write_gsd_staged(create_md_sim, tmp_path):
+    """Ensure that staged checkpoints drain to the requested file."""
+    filename = tmp_path / "checkpoint.gsd"
+    staging_directory = tmp_path / "stage"
+    staging_directory.mkdir(exist_ok=True)
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(
+        filename=filename,
+        trigger=hoomd.trigger.Periodic(1),
+        mode="wb",
+        truncate=True,
+        staging_directory=str(staging_directory),
+    )
+    sim.operations.writers.append(gsd_writer)
+
+    sim.run(3)
+    gsd_writer.flush()
+    assert gsd_writer.filename == str(filename)
+    assert gsd_writer.staging_directory == str(staging_directory)
+
+    if sim.device.communicator.rank == 0:
+        partition = sim.device.communicator.partition
+        staged_filename = staging_directory / f"checkpoint.{partition}.gsd"
+        for name in (filename, staged_filename):
+            with gsd.hoomd.open(name=name, mode="r") as traj:
+                assert len(traj) == 1
+                assert traj[0].configuration.step == sim.timestep
+
+
+def test_write_gsd_staged_requires_truncate(create_md_sim, tmp_path):
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(
+        filename=tmp_path / "trajectory.gsd",
+        trigger=hoomd.trigger.Periodic(1),
+        mode="wb",
+        staging_directory=str(tmp_path),
+    )
+    sim.operations.writers.append(gsd_writer)
+
+    with pytest.raises(ValueError):
+        sim.run(0)
+
+
+def test_write_gsd_type_shapes(simulation_factory, hoomd_snapshot, tmp_path):
+    """Ensure that GSD writes type shapes only when they change."""
+    filename = tmp_path / "test_type_shapes.gsd"
+
+    sim = simulation_factory(hoomd_snapshot)
+    mc = hoomd.hpmc.integrate.Sphere()
+    mc.shape["t1"] = dict(diameter=1.0)
+    mc.shape["t2"] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    logger = hoomd.logging.Logger()
+    logger.add(mc, quantities=["type_shapes"])
+    gsd_writer = hoomd.write.GSD(
+        filename=filename,
+        trigger=hoomd.trigger.Periodic(1),
+        mode="wb",
+        logger=logger,
+    )
+    sim.operations.writers.append(gsd_writer)
+
+    sim.run(2)
+    mc.shape["t1"] = dict(diameter=0.5)
+    sim.run(1)
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.fl.open(name=filename, mode="r") as f:
+            assert f.nframes == 3
+            assert f.chunk_exists(frame=0, name="particles/type_shapes")
+            assert not f.chunk_exists(frame=1, name="particles/type_shapes")
+            assert f.chunk_exists(frame=2, name="particles/type_shapes")
+
+        with gsd.hoomd.open(name=filename, mode="r") as traj:
+            assert traj[1].particles.type_shapes[0]["diameter"] == 1.0
+            assert traj[2].particles.type_shapes[0]["diameter"] == 0.5
@@ -146,6 +146,33 @@ def test_linear_momentum(simulation_factory, lattice_snapshot_factory):
         numpy.testing.assert_allclose(linear_momentum, reference)
 
 
+@pytest.mark.parametrize("period", [1, 2, 5])
+def test_force_period(simulation_factory, two_particle_snapshot_factory, period):
+    constant = md.force.Constant(filter=hoomd.filter.All())
+    constant.constant_force["A"] = (0.5, -0.25, 1.0)
+    assert constant.period == 1
+    constant.period = period
+
+    sim = simulation_factory(two_particle_snapshot_factory(d=8))
+    integrator = hoomd.md.Integrator(
+        dt=0.005,
+        methods=[md.methods.ConstantVolume(hoomd.filter.All())],
+        forces=[constant],
+    )
+    sim.operations.integrator = integrator
+    sim.run(10)
+    assert constant.period == period
+
+    # a constant force applied as an impulse every period steps gives the same
+    # velocity as applying it every step
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        reference = 10 * 0.005 * numpy.array([0.5, -0.25, 1.0])
+        numpy.testing.assert_allclose(
+            snapshot.particles.velocity, [reference, reference], atol=1e-6
+        )
+
+
 def test_pickling(make_simulation, integrator_elements):
     sim = make_simulation()
     integrator = hoomd.md.Integrator(0.005, **integrator_elements)
@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import numpy as np
 import pytest
 
 
@@ -41,3 +42,79 @@ def test_combined_kernel_parameters(simulation_factory, lattice_snapshot_factory
 
     # langevin should remained tuned:
     assert langevin.is_tuning_complete
+
+
+@pytest.mark.gpu
+def test_pair_half_mode(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(particle_types=["A"], n=7, a=1.7, r=0.1)
+    sim = simulation_factory(snap)
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0)
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[lj])
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    # the third kernel parameter selects between full and half mode
+    block_size, threads_per_particle, _ = lj.kernel_parameters["pair_lj"]
+    results = []
+    for half in (0, 1):
+        lj.kernel_parameters = {"pair_lj": (block_size, threads_per_particle, half)}
+        sim.run(1)
+        results.append((lj.energy, lj.forces, lj.virials))
+
+    np.testing.assert_allclose(results[0][0], results[1][0], rtol=1e-6)
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(results[0][1], results[1][1], rtol=1e-6, atol=1e-9)
+        np.testing.assert_allclose(results[0][2], results[1][2], rtol=1e-6, atol=1e-9)
+
+
+@pytest.mark.gpu
+@pytest.mark.serial
+def test_kernel_parameter_cache(
+    device, simulation_factory, lattice_snapshot_factory, tmp_path
+):
+    filename = tmp_path / "autotuner_cache.txt"
+    device.autotuner_cache = str(filename)
+    assert device.autotuner_cache == str(filename)
+
+    def make_lj(sim):
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0)
+        nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = hoomd.md.Integrator(
+            dt=0.001, methods=[nve], forces=[lj]
+        )
+        return lj
+
+    try:
+        snap = lattice_snapshot_factory(particle_types=["A"], n=7, a=1.7, r=0.01)
+        sim = simulation_factory(snap)
+        lj = make_lj(sim)
+
+        sim.run(0)
+        while not lj.is_tuning_complete:
+            sim.run(1000)
+
+            # Prevent infinite loops:
+            if sim.timestep > 100_000:
+                raise RuntimeError("Tuning is not completing as expected.")
+
+        assert filename.exists()
+
+        # A new simulation of the same size uses the cached parameters.
+        sim = simulation_factory(snap)
+        cached_lj = make_lj(sim)
+        sim.run(0)
+        assert cached_lj.is_tuning_complete
+        assert cached_lj.kernel_parameters == lj.kernel_parameters
+
+        # Requesting a new scan ignores the cache.
+        cached_lj.tune_kernel_parameters()
+        assert not cached_lj.is_tuning_complete
+    finally:
+        device.autotuner_cache = None
+
+    assert device.autotuner_cache is None
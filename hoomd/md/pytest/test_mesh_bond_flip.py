@@ -0,0 +1,63 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy as np
+import pytest
+
+# An octahedron with the pole 4 pulled down towards the equator over the edge
+# between the vertices 0 and 1, which then violates the Delaunay condition.
+_positions = [
+    [1, 0, 0],
+    [0, 1, 0],
+    [-1, 0, 0],
+    [0, -1, 0],
+    [0.4, 0.4, 0.05],
+    [0, 0, -1],
+]
+_triangles = [
+    [4, 0, 1],
+    [4, 1, 2],
+    [4, 2, 3],
+    [4, 3, 0],
+    [5, 1, 0],
+    [5, 2, 1],
+    [5, 3, 2],
+    [5, 0, 3],
+]
+
+
+@pytest.mark.serial
+def test_mesh_bond_flip(simulation_factory, device):
+    snap = hoomd.Snapshot(device.communicator)
+    if snap.communicator.rank == 0:
+        snap.configuration.box = [10, 10, 10, 0, 0, 0]
+        snap.particles.N = len(_positions)
+        snap.particles.types = ["A"]
+        snap.particles.position[:] = _positions
+    sim = simulation_factory(snap)
+
+    mesh = hoomd.mesh.Mesh()
+    mesh.triangulation = dict(type_ids=[0] * len(_triangles), triangles=_triangles)
+
+    mesh_bond_flip = hoomd.md.update.MeshBondFlip(
+        trigger=hoomd.trigger.Periodic(1), mesh=mesh
+    )
+    sim.operations.updaters.append(mesh_bond_flip)
+    sim.run(1)
+
+    assert mesh_bond_flip.num_flips >= 1
+
+    bonds = {tuple(sorted(bond)) for bond in mesh.bonds}
+    assert len(bonds) == 12
+    assert (4, 5) in bonds
+    assert (0, 1) not in bonds
+
+    # the mesh remains closed and consistently oriented
+    triangles = np.asarray(mesh.triangles)
+    assert len(triangles) == len(_triangles)
+    directed_edges = [
+        (triangle[k], triangle[(k + 1) % 3]) for triangle in triangles for k in range(3)
+    ]
+    assert len(set(directed_edges)) == len(directed_edges)
+    assert {tuple(sorted(edge)) for edge in directed_edges} == bonds
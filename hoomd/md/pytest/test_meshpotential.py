@@ -662,3 +662,66 @@ def test_helfrich_mpi_error(simulation_factory, tetrahedron_snapshot_factory):
     if sim.device.communicator.num_ranks > 1:
         with pytest.raises(NotImplementedError):
             sim.run(0)
+
+
+def test_membrane_matches_separate_forces(
+    simulation_factory, tetrahedron_snapshot_factory
+):
+    """Test that the membrane force is the sum of the separate mesh forces."""
+    sim = simulation_factory(tetrahedron_snapshot_factory(d=0.969, L=5))
+    if not isinstance(sim.device, hoomd.device.CPU):
+        pytest.skip("Membrane is not implemented on the GPU")
+
+    mesh = hoomd.mesh.Mesh()
+    mesh.types = ["mesh", "patch"]
+    type_ids = [0, 0, 1, 0]
+    triangles = [[2, 1, 0], [0, 1, 3], [2, 0, 3], [1, 2, 3]]
+    mesh.triangulation = dict(type_ids=type_ids, triangles=triangles)
+
+    k_helfrich = 0.0 if sim.device.communicator.num_ranks > 1 else 20.0
+    membrane = hoomd.md.mesh.membrane.Membrane(mesh)
+    membrane.params.default = dict(
+        k_helfrich=k_helfrich,
+        k_bending=10.0,
+        k_area=20.0,
+        A0=1.0,
+        k_triangle=5.0,
+        A0_triangle=0.4,
+        k_volume=50.0,
+        V0=0.1,
+    )
+
+    bending = hoomd.md.mesh.bending.BendingRigidity(mesh)
+    bending.params.default = dict(k=10.0)
+    area = hoomd.md.mesh.conservation.Area(mesh)
+    area.params.default = dict(k=20.0, A0=1.0)
+    triangle_area = hoomd.md.mesh.conservation.TriangleArea(mesh)
+    triangle_area.params.default = dict(k=5.0, A0=0.4)
+    volume = hoomd.md.mesh.conservation.Volume(mesh)
+    volume.params.default = dict(k=50.0, V0=0.1)
+
+    separate = [bending, area, triangle_area, volume]
+    if k_helfrich != 0:
+        helfrich = hoomd.md.mesh.bending.Helfrich(mesh)
+        helfrich.params.default = dict(k=k_helfrich)
+        separate.append(helfrich)
+
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[membrane, *separate])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+
+    np.testing.assert_allclose(membrane.area, area.area, rtol=1e-5)
+    np.testing.assert_allclose(membrane.volume, volume.volume, rtol=1e-5)
+
+    membrane_energies = membrane.energies
+    membrane_forces = membrane.forces
+    separate_energies = [f.energies for f in separate]
+    separate_forces = [f.forces for f in separate]
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(
+            membrane_energies, sum(separate_energies), rtol=1e-5, atol=1e-5
+        )
+        np.testing.assert_allclose(
+            membrane_forces, sum(separate_forces), rtol=1e-5, atol=1e-5
+        )
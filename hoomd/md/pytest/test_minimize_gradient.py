@@ -0,0 +1,240 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import numpy as np
+import pytest
+
+import hoomd
+from hoomd.logging import LoggerCategories
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd import md
+
+_minimizers = [md.minimize.LBFGS, md.minimize.ConjugateGradient]
+
+
+def _assert_correct_params(minimizer, param_dict):
+    """Make sure the parameters in the dictionary match with the minimizer."""
+    for param in param_dict:
+        assert getattr(minimizer, param) == param_dict[param]
+
+
+def _make_random_params(minimizer):
+    """Get random values for the minimizer parameters."""
+    params = {
+        "max_step": 0.01 + np.random.rand(),
+        "max_rotation": 0.01 + np.random.rand(),
+        "integrate_rotational_dof": False,
+        "force_tol": np.random.rand(),
+        "torque_tol": np.random.rand(),
+        "energy_tol": np.random.rand(),
+        "min_steps_conv": np.random.randint(1, 15),
+    }
+    if isinstance(minimizer, md.minimize.LBFGS):
+        params["history_size"] = np.random.randint(1, 20)
+    return params
+
+
+def _set_and_check_new_params(minimizer):
+    """Set params to random values, then assert they are correct."""
+    new_params = _make_random_params(minimizer)
+    for param in new_params:
+        setattr(minimizer, param, new_params[param])
+
+    _assert_correct_params(minimizer, new_params)
+    return new_params
+
+
+def _assert_error_if_nonpositive(minimizer):
+    """Make sure error is raised if properties set to nonpositive values."""
+    negative_value = -np.random.randint(0, 26)
+    with pytest.raises(ValueError):
+        minimizer.max_step = negative_value
+
+    with pytest.raises(ValueError):
+        minimizer.min_steps_conv = negative_value
+
+    if isinstance(minimizer, md.minimize.LBFGS):
+        with pytest.raises(ValueError):
+            minimizer.history_size = negative_value
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_constructor_validation(cls):
+    """Make sure constructor validates arguments."""
+    with pytest.raises(ValueError):
+        cls(
+            max_step=0.01,
+            force_tol=1e-1,
+            torque_tol=1e-1,
+            energy_tol=1e-5,
+            min_steps_conv=-5,
+        )
+    with pytest.raises(ValueError):
+        cls(max_step=0, force_tol=1e-1, torque_tol=1e-1, energy_tol=1e-5)
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_get_set_params(cls, simulation_factory, two_particle_snapshot_factory):
+    """Assert we can get/set params when not attached and when attached."""
+    minimizer = cls(max_step=0.01, force_tol=1e-1, torque_tol=1e-1, energy_tol=1e-5)
+    default_params = {
+        "max_step": 0.01,
+        "max_rotation": 0.1,
+        "integrate_rotational_dof": False,
+        "force_tol": 0.1,
+        "torque_tol": 0.1,
+        "energy_tol": 1e-5,
+        "min_steps_conv": 10,
+        "pressure": None,
+    }
+    if cls is md.minimize.LBFGS:
+        default_params["history_size"] = 10
+    _assert_correct_params(minimizer, default_params)
+
+    new_params = _set_and_check_new_params(minimizer)
+
+    _assert_error_if_nonpositive(minimizer)
+
+    # attach to simulation
+    snap = two_particle_snapshot_factory(d=2.34)
+    sim = simulation_factory(snap)
+    sim.operations.integrator = minimizer
+    sim.run(0)
+
+    # make sure the params are still right after attaching
+    _assert_correct_params(minimizer, new_params)
+
+    _set_and_check_new_params(minimizer)
+
+    _assert_error_if_nonpositive(minimizer)
+
+    minimizer.pressure = 1.0
+    assert minimizer.pressure == 1.0
+    minimizer.pressure = None
+    assert minimizer.pressure is None
+
+
+def _run_minimization(sim, minimizer):
+    """Run the minimizer to convergence and return the number of steps."""
+    steps_to_converge = 0
+    while not minimizer.converged:
+        sim.run(1)
+        steps_to_converge += 1
+        assert steps_to_converge < 10000
+
+    return steps_to_converge
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_run_minimization(cls, lattice_snapshot_factory, simulation_factory):
+    """Run a short minimization simulation."""
+    snap = lattice_snapshot_factory(a=1.5, n=8)
+    sim = simulation_factory(snap)
+
+    lj = md.pair.LJ(default_r_cut=2.5, nlist=md.nlist.Cell(buffer=0.4))
+    lj.params[("A", "A")] = dict(sigma=1.0, epsilon=1.0)
+    nve = md.methods.ConstantVolume(hoomd.filter.All())
+
+    minimizer = cls(
+        max_step=0.05,
+        force_tol=1e-1,
+        torque_tol=1e-1,
+        energy_tol=1e-5,
+        methods=[nve],
+        forces=[lj],
+        min_steps_conv=3,
+    )
+
+    thermo = md.compute.ThermodynamicQuantities(hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+    sim.operations.integrator = minimizer
+    assert not minimizer.converged
+
+    sim.run(0)
+    initial_energy = thermo.potential_energy
+
+    steps_to_converge = _run_minimization(sim, minimizer)
+
+    assert initial_energy >= minimizer.energy * snap.particles.N
+    assert steps_to_converge >= minimizer.min_steps_conv
+
+    minimizer.reset()
+    assert not minimizer.converged
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_run_box_relaxation(cls, lattice_snapshot_factory, simulation_factory):
+    """Relax the box of a compressed crystal at zero pressure."""
+    snap = lattice_snapshot_factory(a=1.0, n=5)
+    sim = simulation_factory(snap)
+    initial_volume = sim.state.box.volume
+
+    lj = md.pair.LJ(default_r_cut=2.5, nlist=md.nlist.Cell(buffer=0.4))
+    lj.params[("A", "A")] = dict(sigma=1.0, epsilon=1.0)
+    nve = md.methods.ConstantVolume(hoomd.filter.All())
+
+    minimizer = cls(
+        max_step=0.02,
+        force_tol=1e-2,
+        torque_tol=1e-2,
+        energy_tol=1e-6,
+        methods=[nve],
+        forces=[lj],
+        pressure=0.0,
+    )
+
+    sim.operations.integrator = minimizer
+    sim.run(0)
+    _run_minimization(sim, minimizer)
+
+    # the compressed crystal expands
+    assert sim.state.box.volume > initial_volume
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_pickling(cls, lattice_snapshot_factory, simulation_factory):
+    """Assert the minimizer can be pickled when attached/unattached."""
+    snap = lattice_snapshot_factory(a=1.5, n=5)
+    sim = simulation_factory(snap)
+
+    nve = md.methods.ConstantVolume(hoomd.filter.All())
+
+    minimizer = cls(
+        max_step=0.05, force_tol=1e-1, torque_tol=1e-1, energy_tol=1e-5, methods=[nve]
+    )
+
+    operation_pickling_check(minimizer, sim)
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_validate_methods(cls, lattice_snapshot_factory, simulation_factory):
+    """Make sure only ConstantVolume methods can be attached."""
+    snap = lattice_snapshot_factory(a=1.5, n=5)
+
+    nve = md.methods.ConstantVolume(hoomd.filter.All())
+    nph = md.methods.ConstantPressure(hoomd.filter.All(), S=1, tauS=1, couple="none")
+    brownian = md.methods.Brownian(hoomd.filter.All(), kT=1)
+
+    methods = [(nve, False), (nph, True), (brownian, True)]
+    for method, should_error in methods:
+        sim = simulation_factory(snap)
+        minimizer = cls(max_step=0.05, force_tol=1e-1, torque_tol=1e-1, energy_tol=1e-5)
+        sim.operations.integrator = minimizer
+        if should_error:
+            with pytest.raises(ValueError):
+                minimizer.methods.append(method)
+        else:
+            minimizer.methods.append(method)
+        sim.run(0)
+
+
+@pytest.mark.parametrize("cls", _minimizers)
+def test_logging(cls):
+    logging_check(
+        cls,
+        ("md", "minimize", "gradient"),
+        {
+            "converged": {"category": LoggerCategories.scalar, "default": False},
+            "energy": {"category": LoggerCategories.scalar, "default": True},
+        },
+    )
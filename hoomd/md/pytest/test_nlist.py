@@ -10,7 +10,7 @@ import json
 import random
 import collections
 from pathlib import Path
-from hoomd.md.nlist import Cell, Stencil, Tree
+from hoomd.md.nlist import Auto, Body, Cell, MultiLevel, Stencil, Tree
 from hoomd.conftest import (
     logging_check,
     pickling_check,
@@ -38,6 +38,7 @@ def _nlist_params():
     nlists.append((Cell, {}))
     nlists.append((Tree, {}))
     nlists.append((Stencil, dict(cell_width=0.5)))
+    nlists.append((Auto, {}))
     return nlists
 
 
@@ -63,6 +64,9 @@ def test_common_params(nlist_params):
         "exclusions": ("bond",),
         "rebuild_check_delay": 1,
         "check_dist": True,
+        "auto_buffer": False,
+        "compress_indices": False,
+        "cluster_pairs": False,
     }
     _assert_nlist_params(nlist, default_params_dict)
     new_params_dict = {
@@ -83,6 +87,9 @@ def test_common_params(nlist_params):
         ),
         "rebuild_check_delay": np.random.randint(8),
         "check_dist": False,
+        "auto_buffer": True,
+        "compress_indices": True,
+        "cluster_pairs": True,
     }
     for param in new_params_dict.keys():
         setattr(nlist, param, new_params_dict[param])
@@ -91,9 +98,20 @@ def test_common_params(nlist_params):
 
 def test_cell_specific_params():
     nlist = Cell(buffer=0.4)
-    _assert_nlist_params(nlist, dict(deterministic=False))
+    _assert_nlist_params(
+        nlist, dict(deterministic=False, incremental=False, sparse=False)
+    )
     nlist.deterministic = True
-    _assert_nlist_params(nlist, dict(deterministic=True))
+    nlist.incremental = True
+    nlist.sparse = True
+    _assert_nlist_params(nlist, dict(deterministic=True, incremental=True, sparse=True))
+
+
+def test_tree_specific_params():
+    nlist = Tree(buffer=0.4)
+    _assert_nlist_params(nlist, dict(refit=False))
+    nlist.refit = True
+    _assert_nlist_params(nlist, dict(refit=True))
 
 
 def test_stencil_specific_params():
@@ -106,6 +124,50 @@ def test_stencil_specific_params():
     _assert_nlist_params(nlist, dict(deterministic=True, cell_width=x))
 
 
+def test_auto_specific_params():
+    nlist = Auto(buffer=0.4)
+    _assert_nlist_params(nlist, dict(selection_period=10000))
+    nlist.selection_period = 0
+    _assert_nlist_params(nlist, dict(selection_period=0))
+
+
+def test_auto_selection(simulation_factory, lattice_snapshot_factory):
+    nlist = Auto(buffer=0.4, check_dist=False, selection_period=20)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params.default = dict(epsilon=1, sigma=1)
+
+    # reference energy computed with a list that is rebuilt every step
+    nlist_reference = hoomd.md.nlist.Tree(buffer=0.0)
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1)
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+    snapshot = lattice_snapshot_factory(n=10, a=1.2, particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[::2] = 1
+    sim = simulation_factory(snapshot)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+
+    # every trial build must find the same pairs
+    for _ in range(12):
+        sim.run(1)
+        np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+    # 3 trials of each of the 3 algorithms
+    assert not nlist._cpp_obj.selecting
+    assert nlist.algorithm in ("Cell", "Stencil", "Tree")
+    assert all(np.isfinite(nlist._cpp_obj.trial_times))
+
+    # the selection restarts after selection_period steps
+    sim.run(20)
+    assert nlist._cpp_obj.selecting
+    np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+
 def test_simple_simulation(nlist_params, simulation_factory, lattice_snapshot_factory):
     nlist_cls, required_args = nlist_params
     nlist = nlist_cls(**required_args, buffer=0.4)
@@ -127,6 +189,398 @@ def test_simple_simulation(nlist_params, simulation_factory, lattice_snapshot_fa
     autotuned_kernel_parameter_check(instance=nlist, activate=lambda: sim.run(1))
 
 
+def test_auto_buffer(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    nlist.auto_buffer = True
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params[("A", "A")] = dict(epsilon=1, sigma=1)
+    lj.params[("A", "B")] = dict(epsilon=1, sigma=1)
+    lj.params[("B", "B")] = dict(epsilon=1, sigma=1)
+
+    # reference energy computed with a list that is rebuilt every step
+    nlist_reference = hoomd.md.nlist.Tree(buffer=0.0)
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1)
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+    snapshot = lattice_snapshot_factory(n=10, a=1.2, particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[::2] = 1
+    sim = simulation_factory(snapshot)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+
+    sim.run(200)
+
+    assert nlist.auto_buffer
+    type_buffer = nlist.type_buffer
+    assert set(type_buffer.keys()) == {"A", "B"}
+    for r_buff in type_buffer.values():
+        assert 0 < r_buff <= 0.4
+
+    # the tuned buffers must not drop any interacting pairs
+    np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+
+def test_affine_box_resize(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.5)
+    lj.params.default = dict(epsilon=1, sigma=1)
+
+    # reference energy computed with a list that is rebuilt every step
+    nlist_reference = hoomd.md.nlist.Tree(buffer=0.0)
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.5)
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+
+    # without integration methods, the particles only move with the box
+    integrator = hoomd.md.Integrator(0.005, forces=[lj])
+
+    sim = simulation_factory(lattice_snapshot_factory(n=10, a=1.2))
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+
+    initial_box = sim.state.box
+    final_box = hoomd.Box(
+        Lx=initial_box.Lx * 0.99,
+        Ly=initial_box.Ly * 0.99,
+        Lz=initial_box.Lz * 0.99,
+        xy=0.1,
+    )
+    box_resize = hoomd.update.BoxResize(
+        trigger=hoomd.trigger.Periodic(1),
+        box=hoomd.variant.box.Interpolate(
+            initial_box, final_box, hoomd.variant.Ramp(0, 1, 0, 100)
+        ),
+    )
+    sim.operations.updaters.append(box_resize)
+    sim.run(100)
+
+    # the affine compression and shear fit in the buffer
+    assert nlist.num_builds < 5
+    np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+
+def test_compress_indices(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    nlist.compress_indices = True
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params[("A", "A")] = dict(epsilon=1, sigma=1)
+
+    # reference forces computed from the full neighbor indices
+    nlist_reference = nlist_cls(**required_args, buffer=0.4)
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1)
+    lj_reference.params[("A", "A")] = dict(epsilon=1, sigma=1)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+    sim = simulation_factory(lattice_snapshot_factory(n=10, a=1.2, r=0.1))
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+    sim.run(100)
+
+    assert nlist.compress_indices
+    np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-6)
+    forces = lj.forces
+    forces_reference = lj_reference.forces
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(forces, forces_reference, rtol=1e-6, atol=1e-9)
+
+
+def test_cluster_pairs(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    nlist.cluster_pairs = True
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1, mode="xplor")
+    lj.params.default = dict(epsilon=1, sigma=1)
+    lj.r_on.default = 0.9
+
+    # reference forces computed from the per particle neighbor list
+    nlist_reference = nlist_cls(**required_args, buffer=0.4)
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1, mode="xplor")
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+    lj_reference.r_on.default = 0.9
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+    snapshot = lattice_snapshot_factory(n=10, a=1.2, r=0.1, particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[::3] = 1
+    sim = simulation_factory(snapshot)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+    sim.always_compute_pressure = True
+    sim.run(100)
+
+    assert nlist.cluster_pairs
+    np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-6)
+    forces = lj.forces
+    forces_reference = lj_reference.forces
+    virials = lj.virials
+    virials_reference = lj_reference.virials
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(forces, forces_reference, rtol=1e-6, atol=1e-9)
+        np.testing.assert_allclose(virials, virials_reference, rtol=1e-6, atol=1e-9)
+
+
+def test_cutoff_tiers(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.12)
+    lj.params.default = dict(epsilon=1, sigma=1)
+    yukawa = hoomd.md.pair.Yukawa(nlist, default_r_cut=3.0)
+    yukawa.params.default = dict(epsilon=1, kappa=1)
+
+    # reference forces computed from a separate neighbor list for each potential
+    lj_reference = hoomd.md.pair.LJ(
+        nlist_cls(**required_args, buffer=0.4), default_r_cut=1.12
+    )
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+    yukawa_reference = hoomd.md.pair.Yukawa(
+        nlist_cls(**required_args, buffer=0.4), default_r_cut=3.0
+    )
+    yukawa_reference.params.default = dict(epsilon=1, kappa=1)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.extend([lj, yukawa])
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+    sim = simulation_factory(lattice_snapshot_factory(n=10, a=1.2, r=0.1))
+    sim.operations.integrator = integrator
+    sim.operations.computes.extend([lj_reference, yukawa_reference])
+    sim.run(100)
+
+    for force, force_reference in ((lj, lj_reference), (yukawa, yukawa_reference)):
+        np.testing.assert_allclose(force.energy, force_reference.energy, rtol=1e-6)
+        forces = force.forces
+        forces_reference = force_reference.forces
+        if sim.device.communicator.rank == 0:
+            np.testing.assert_allclose(
+                forces, forces_reference, rtol=1e-6, atol=1e-9
+            )
+
+
+def test_exclusions(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    r_cut = 1.5
+
+    # a chain of bonded particles through the lattice
+    snapshot = lattice_snapshot_factory(n=5, a=1.0)
+    if snapshot.communicator.rank == 0:
+        n_particles = snapshot.particles.N
+        snapshot.bonds.types = ["b"]
+        snapshot.bonds.N = n_particles - 1
+        snapshot.bonds.group[:] = [[i, i + 1] for i in range(n_particles - 1)]
+    sim = simulation_factory(snapshot)
+
+    nlist = nlist_cls(
+        **{**required_args, "exclusions": ("bond", "1-3")},
+        buffer=0.0,
+        default_r_cut=r_cut,
+    )
+    sim.operations.computes.append(nlist)
+    sim.run(0)
+
+    if sim.device.communicator.rank == 0:
+        # all pairs within r_cut, less the bonds and the 1-3 pairs of the chain
+        position = snapshot.particles.position
+        L = snapshot.configuration.box[0]
+        truth_set = set()
+        for i in range(n_particles):
+            dr = position[i + 1 :] - position[i]
+            dr -= L * np.round(dr / L)
+            neighbors = np.nonzero(np.sum(dr * dr, axis=1) <= r_cut**2)[0] + i + 1
+            truth_set.update(frozenset((i, int(j))) for j in neighbors if j - i > 2)
+    else:
+        truth_set = None
+
+    _check_pair_set(sim, nlist, truth_set)
+
+
+def test_incremental(simulation_factory, lattice_snapshot_factory, device):
+    nlist = Cell(buffer=0.4, exclusions=(), incremental=True)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params.default = dict(epsilon=1, sigma=1)
+
+    # reference energy computed with a list that is rebuilt every step
+    nlist_reference = hoomd.md.nlist.Tree(buffer=0.0, exclusions=())
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1)
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+
+    # only the B particles are hot, so they trigger every rebuild
+    snapshot = lattice_snapshot_factory(n=10, a=1.2, particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[:20] = 1
+    sim = simulation_factory(snapshot)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.Type(["A"]), kT=0.1)
+    )
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.Type(["B"]), kT=3.0)
+    )
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+
+    for _ in range(10):
+        sim.run(20)
+        np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+    if isinstance(device, hoomd.device.CPU) and device.communicator.num_ranks == 1:
+        assert nlist._cpp_obj.getNumIncrementalUpdates() > 0
+
+
+@pytest.mark.cpu
+def test_sparse(simulation_factory, lattice_snapshot_factory):
+    nlist = Cell(buffer=0.4, exclusions=(), sparse=True)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params.default = dict(epsilon=1, sigma=1)
+
+    nlist_reference = Cell(buffer=0.4, exclusions=())
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1)
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+
+    # a small cluster of particles in a mostly empty box
+    snapshot = lattice_snapshot_factory(n=5, a=1.2)
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = [30, 30, 30, 0, 0, 0]
+    sim = simulation_factory(snapshot)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1.0))
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+
+    for _ in range(5):
+        sim.run(20)
+        np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+
+def test_refit(simulation_factory, lattice_snapshot_factory, device):
+    nlist = Tree(buffer=0.4, exclusions=(), refit=True)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params.default = dict(epsilon=1, sigma=1)
+
+    # reference energy computed with trees that are built every step
+    nlist_reference = Tree(buffer=0.0, exclusions=())
+    lj_reference = hoomd.md.pair.LJ(nlist_reference, default_r_cut=1.1)
+    lj_reference.params.default = dict(epsilon=1, sigma=1)
+
+    snapshot = lattice_snapshot_factory(n=10, a=1.2, particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[::2] = 1
+    sim = simulation_factory(snapshot)
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1.0))
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(lj_reference)
+
+    for _ in range(10):
+        sim.run(20)
+        np.testing.assert_allclose(lj.energy, lj_reference.energy, rtol=1e-5)
+
+    if isinstance(device, hoomd.device.GPU) and device.communicator.num_ranks == 1:
+        assert nlist._cpp_obj.getNumRefits() > 0
+
+
+@pytest.mark.cpu
+def test_cpu_threads(
+    nlist_params, simulation_factory, lattice_snapshot_factory, num_cpu_threads
+):
+    """Test that threaded builds find the same pairs as serial builds."""
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4, default_r_cut=1.1)
+    sim = simulation_factory(lattice_snapshot_factory(n=8, a=1.2, r=0.1))
+    sim.operations.computes.append(nlist)
+    sim.run(0)
+
+    pair_lists = []
+    for _ in num_cpu_threads():
+        nlist._cpp_obj.forceUpdate()
+        pairs = nlist.local_pair_list
+        pair_lists.append(set(frozenset(pair) for pair in pairs.tolist()))
+
+    assert len(pair_lists[0]) > 0
+    assert pair_lists[0] == pair_lists[1]
+
+
+@pytest.mark.cpu
+def test_body(simulation_factory, lattice_snapshot_factory):
+    """Test that Body finds the same pairs as Tree when bodies are excluded."""
+    snapshot = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+    if snapshot.communicator.rank == 0:
+        # bodies of 4 particles along one lattice row, some particles are free
+        tags = np.arange(snapshot.particles.N)
+        snapshot.particles.body[:] = (tags // 4) * 4
+        snapshot.particles.body[tags % 12 == 11] = -1
+    sim = simulation_factory(snapshot)
+
+    nlist = Body(buffer=0.4, exclusions=("body",), default_r_cut=1.5)
+    nlist_reference = Tree(buffer=0.4, exclusions=("body",), default_r_cut=1.5)
+    sim.operations.computes.append(nlist)
+    sim.operations.computes.append(nlist_reference)
+    sim.run(0)
+
+    pairs = set(frozenset(pair) for pair in nlist.local_pair_list.tolist())
+    pairs_reference = set(
+        frozenset(pair) for pair in nlist_reference.local_pair_list.tolist()
+    )
+    assert len(pairs_reference) > 0
+    assert pairs == pairs_reference
+
+
+@pytest.mark.cpu
+def test_multi_level(simulation_factory, lattice_snapshot_factory):
+    """Test that MultiLevel finds the same pairs as Tree for asymmetric cutoffs."""
+    snapshot = lattice_snapshot_factory(
+        n=10, a=1.0, r=0.1, particle_types=["A", "B", "C"]
+    )
+    if snapshot.communicator.rank == 0:
+        # a few large B particles among the small A particles, C does not interact
+        snapshot.particles.typeid[::37] = 1
+        snapshot.particles.typeid[5::53] = 2
+    sim = simulation_factory(snapshot)
+
+    r_cut = {
+        ("A", "A"): 1.0,
+        ("A", "B"): 2.5,
+        ("B", "B"): 4.0,
+        ("A", "C"): 0.0,
+        ("B", "C"): 0.0,
+        ("C", "C"): 0.0,
+    }
+    nlist = MultiLevel(buffer=0.4, exclusions=())
+    nlist_reference = Tree(buffer=0.4, exclusions=())
+    for pair, value in r_cut.items():
+        nlist.r_cut[pair] = value
+        nlist_reference.r_cut[pair] = value
+    sim.operations.computes.append(nlist)
+    sim.operations.computes.append(nlist_reference)
+    sim.run(0)
+
+    assert nlist.num_levels == 2
+    pairs = set(frozenset(pair) for pair in nlist.local_pair_list.tolist())
+    pairs_reference = set(
+        frozenset(pair) for pair in nlist_reference.local_pair_list.tolist()
+    )
+    assert len(pairs_reference) > 0
+    assert pairs == pairs_reference
+
+
 def test_auto_detach_simulation(simulation_factory, two_particle_snapshot_factory):
     nlist = Cell(buffer=0.4)
     lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
@@ -212,6 +666,15 @@ def test_logging():
         },
     )
 
+    logging_check(
+        hoomd.md.nlist.Auto,
+        ("md", "nlist"),
+        {
+            **base_loggables,
+            "algorithm": {"category": LoggerCategories.string, "default": True},
+        },
+    )
+
 
 _path = Path(__file__).parent / "true_pair_list.json"
 TRUE_PAIR_LIST = set([frozenset(pair) for pair in json.load(_path.open())])
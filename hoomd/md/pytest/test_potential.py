@@ -445,6 +445,28 @@ def _valid_params(particle_types=["A", "B"]):
         paramtuple(md.pair.Yukawa, dict(zip(combos, yukawa_valid_param_dicts)), {})
     )
 
+    lj_yukawa_valid_param_dicts = [
+        {"lj": lj, "yukawa": yukawa}
+        for lj, yukawa in zip(lj_valid_param_dicts, yukawa_valid_param_dicts)
+    ]
+    valid_params_list.append(
+        paramtuple(
+            md.pair.LJYukawa, dict(zip(combos, lj_yukawa_valid_param_dicts)), {}
+        )
+    )
+
+    lj_dispersion_ewald_valid_param_dicts = [
+        {"lj": lj, "dispersion_ewald": {"c6": 4 * lj["epsilon"], "beta": 1.5}}
+        for lj in lj_valid_param_dicts
+    ]
+    valid_params_list.append(
+        paramtuple(
+            md.pair.LJDispersionEwald,
+            dict(zip(combos, lj_dispersion_ewald_valid_param_dicts)),
+            {},
+        )
+    )
+
     ewald_arg_dict = {"alpha": [0.025, 0.05, 0.075], "kappa": [0.5, 1.0, 1.5]}
     ewald_valid_param_dicts = _make_valid_param_dicts(ewald_arg_dict)
     valid_params_list.append(
@@ -1366,6 +1388,173 @@ def test_forces_multiple_lists(simulation_factory, two_particle_snapshot_factory
     assert lj._use_count == 0
 
 
+@pytest.mark.parametrize("mode", ["none", "shift", "xplor"])
+def test_lj_yukawa(simulation_factory, lattice_snapshot_factory, mode):
+    """Test that LJYukawa computes the sum of separate LJ and Yukawa forces."""
+    snap = lattice_snapshot_factory(particle_types=["A", "B"], n=5, a=1.2, r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+    sim = simulation_factory(snap)
+
+    nlist = md.nlist.Cell(buffer=0.4)
+    lj_params = {
+        ("A", "A"): dict(epsilon=1.0, sigma=1.0),
+        ("A", "B"): dict(epsilon=0.5, sigma=1.1),
+        ("B", "B"): dict(epsilon=1.5, sigma=0.9),
+    }
+    yukawa_params = {
+        ("A", "A"): dict(epsilon=2.0, kappa=1.0),
+        ("A", "B"): dict(epsilon=-1.0, kappa=0.5),
+        ("B", "B"): dict(epsilon=0.5, kappa=2.0),
+    }
+
+    lj = md.pair.LJ(nlist, default_r_cut=2.5, default_r_on=2.0, mode=mode)
+    yukawa = md.pair.Yukawa(nlist, default_r_cut=2.5, default_r_on=2.0, mode=mode)
+    lj_yukawa = md.pair.LJYukawa(
+        nlist, default_r_cut=2.5, default_r_on=2.0, mode=mode
+    )
+    for pair in lj_params:
+        lj.params[pair] = lj_params[pair]
+        yukawa.params[pair] = yukawa_params[pair]
+        lj_yukawa.params[pair] = dict(lj=lj_params[pair], yukawa=yukawa_params[pair])
+
+    integrator = md.Integrator(dt=0.005, forces=[lj_yukawa])
+    sim.operations.integrator = integrator
+    sim.operations.computes.extend([lj, yukawa])
+    sim.run(0)
+
+    forces = lj_yukawa.forces
+    forces_lj = lj.forces
+    forces_yukawa = yukawa.forces
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(
+            forces, forces_lj + forces_yukawa, rtol=1e-5, atol=1e-6
+        )
+        np.testing.assert_allclose(
+            lj_yukawa.energies, lj.energies + yukawa.energies, rtol=1e-5, atol=1e-6
+        )
+        np.testing.assert_allclose(
+            lj_yukawa.virials, lj.virials + yukawa.virials, rtol=1e-5, atol=1e-6
+        )
+
+
+def test_table_cubic(simulation_factory, two_particle_snapshot_factory):
+    """Test that cubic tables are more accurate than linear tables."""
+    sim = simulation_factory(two_particle_snapshot_factory(d=1.0))
+
+    r_min = 0.9
+    r_cut = 2.5
+    r = np.linspace(r_min, r_cut, 16, endpoint=False)
+
+    def lj(r):
+        return 4 * (r**-12 - r**-6) - 4 * (r_cut**-12 - r_cut**-6)
+
+    def lj_force(r):
+        return 24 * (2 * r**-13 - r**-7)
+
+    nlist = md.nlist.Cell(buffer=0.4)
+    tables = {}
+    for interpolation in ("linear", "cubic"):
+        tables[interpolation] = md.pair.Table(nlist, default_r_cut=r_cut)
+        tables[interpolation].params[("A", "A")] = dict(
+            r_min=r_min, U=lj(r), F=lj_force(r), interpolation=interpolation
+        )
+    integrator = md.Integrator(dt=0.005, forces=[tables["linear"]])
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(tables["cubic"])
+
+    assert tables["cubic"].params[("A", "A")]["interpolation"] == "cubic"
+
+    errors = {"linear": [], "cubic": []}
+    for distance in (0.97, 1.13, 1.31, 1.62, 2.05, 2.45):
+        set_distance(sim, distance)
+        for interpolation, table in tables.items():
+            energy = table.energy
+            forces = table.forces
+            if sim.device.communicator.rank == 0:
+                errors[interpolation].append(
+                    (
+                        abs(energy - lj(distance)),
+                        abs(forces[1][2] - lj_force(distance)),
+                    )
+                )
+
+    if sim.device.communicator.rank == 0:
+        linear = np.max(errors["linear"], axis=0)
+        cubic = np.max(errors["cubic"], axis=0)
+        assert np.all(cubic < linear / 4)
+
+    # the cubic force is the derivative of the cubic energy
+    delta = 1e-3
+    energies = []
+    for distance in (1.5 - delta, 1.5 + delta):
+        set_distance(sim, distance)
+        energies.append(tables["cubic"].energy)
+    set_distance(sim, 1.5)
+    forces = tables["cubic"].forces
+    if sim.device.communicator.rank == 0:
+        numerical_force = -(energies[1] - energies[0]) / (2 * delta)
+        assert forces[1][2] == pytest.approx(numerical_force, rel=1e-3)
+
+
+@pytest.mark.cpu
+@pytest.mark.parametrize("storage_mode", ["half", "full"])
+def test_cpu_threads(
+    simulation_factory, lattice_snapshot_factory, device, num_cpu_threads, storage_mode
+):
+    """Test that threaded CPU pair forces match the serial computation."""
+    snap = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+    sim = simulation_factory(snap)
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist)
+    lj.r_cut[("A", "A")] = 2.5
+    lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 1.0}
+    sim.operations.computes.append(lj)
+    sim.always_compute_pressure = True
+    sim.run(0)
+    nlist._cpp_obj.setStorageMode(
+        getattr(hoomd.md._md.NeighborList.storageMode, storage_mode)
+    )
+
+    results = []
+    for num_threads in num_cpu_threads():
+        assert device.num_cpu_threads == num_threads
+        # advance the timestep without moving particles to recompute the forces
+        sim.run(1)
+        results.append((lj.forces, lj.energies, lj.virials, lj.energy))
+
+    if sim.device.communicator.rank == 0:
+        for serial, threaded in zip(results[0], results[1]):
+            np.testing.assert_allclose(serial, threaded, rtol=1e-6, atol=1e-9)
+
+
+@pytest.mark.cpu
+def test_cpu_threads_few_particles(
+    simulation_factory, two_particle_snapshot_factory, num_cpu_threads
+):
+    """Test threaded half neighbor list forces with more threads than particles."""
+    sim = simulation_factory(two_particle_snapshot_factory(dimensions=3, d=1.1))
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist)
+    lj.r_cut[("A", "A")] = 2.5
+    lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 1.0}
+    sim.operations.computes.append(lj)
+    sim.always_compute_pressure = True
+    sim.run(0)
+    nlist._cpp_obj.setStorageMode(hoomd.md._md.NeighborList.storageMode.half)
+
+    results = []
+    # repeat the threaded step so that stale per-thread buffers would be summed
+    for _ in num_cpu_threads((1, 4, 4)):
+        sim.run(1)
+        results.append((lj.forces, lj.energies, lj.virials, lj.energy))
+
+    if sim.device.communicator.rank == 0:
+        for threaded in results[1:]:
+            for serial, value in zip(results[0], threaded):
+                np.testing.assert_allclose(serial, value, rtol=1e-6, atol=1e-9)
+
+
 @pytest.mark.parametrize(
     "forces_and_energies",
     _forces_and_energies(),
@@ -50,6 +50,8 @@ def test_attach_detach(simulation_factory, two_charged_particle_snapshot_factory
     assert coulomb.order == 6
     assert coulomb.r_cut == 3.0
     assert coulomb.alpha == 0
+    assert coulomb.fft_group == (1, 1, 1)
+    assert not coulomb.mixed_precision
 
     nlist2 = hoomd.md.nlist.Tree(buffer=0.4)
     coulomb.nlist = nlist2
@@ -68,6 +70,9 @@ def test_attach_detach(simulation_factory, two_charged_particle_snapshot_factory
     coulomb.alpha = 1.5
     assert coulomb.alpha == 1.5
 
+    coulomb.mixed_precision = True
+    assert coulomb.mixed_precision
+
     # attached
     sim = simulation_factory(two_charged_particle_snapshot_factory())
     integrator = hoomd.md.Integrator(dt=0.005)
@@ -85,6 +90,8 @@ def test_attach_detach(simulation_factory, two_charged_particle_snapshot_factory
     assert coulomb.order == 4
     assert coulomb.r_cut == 2.5
     assert coulomb.alpha == 1.5
+    assert coulomb.fft_group == (1, 1, 1)
+    assert coulomb.mixed_precision
 
     assert ewald.params[("A", "A")]["alpha"] == 1.5
 
@@ -96,6 +103,10 @@ def test_attach_detach(simulation_factory, two_charged_particle_snapshot_factory
         coulomb.r_cut = 4.5
     with pytest.raises(AttributeError):
         coulomb.alpha = 3.0
+    with pytest.raises(AttributeError):
+        coulomb.fft_group = (2, 1, 1)
+    with pytest.raises(AttributeError):
+        coulomb.mixed_precision = False
 
 
 def test_kernel_parameters(simulation_factory, two_charged_particle_snapshot_factory):
@@ -163,3 +174,91 @@ def test_pppm_energy(simulation_factory, two_charged_particle_snapshot_factory):
     # The reference energy is from a LAMMPS simulation. The tolerance is large
     # as the PPPM parameters do not directly map between the two codes
     numpy.testing.assert_allclose(energy, -1.0021254, rtol=1e-2)
+
+
+def test_pppm_neutral_particles(simulation_factory, device):
+    """Test that neutral particles do not change the PPPM energy."""
+    snapshot = hoomd.Snapshot(device.communicator)
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = [20, 20, 20, 0, 0, 0]
+        snapshot.particles.N = 4
+        snapshot.particles.types = ["A"]
+        snapshot.particles.position[:] = [
+            [-0.5, 0, 0],
+            [0.5, 0, 0],
+            [0, 5, 5],
+            [0, -5, -5],
+        ]
+        snapshot.particles.charge[:] = [-1, 1, 0, 0]
+    sim = simulation_factory(snapshot)
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0
+    )
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([ewald, coulomb])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    numpy.testing.assert_allclose(ewald.energy + coulomb.energy, -1.0021254, rtol=1e-2)
+    forces = coulomb.forces
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_array_equal(forces[2:], 0)
+
+    # charging a neutral particle adds it to the mesh
+    energy = ewald.energy + coulomb.energy
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.charge[2] = 1
+    sim.state.set_snapshot(snapshot)
+    sim.run(0)
+    forces = coulomb.forces
+    if sim.device.communicator.rank == 0:
+        assert numpy.any(forces[2] != 0)
+    assert ewald.energy + coulomb.energy != pytest.approx(energy)
+
+
+def test_mixed_precision(simulation_factory, two_charged_particle_snapshot_factory):
+    """Test that the mixed precision mesh matches the reference energy."""
+    sim = simulation_factory(two_charged_particle_snapshot_factory())
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist,
+        resolution=(64, 64, 64),
+        order=6,
+        r_cut=3.0,
+        alpha=0,
+        mixed_precision=True,
+    )
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([ewald, coulomb])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    numpy.testing.assert_allclose(ewald.energy + coulomb.energy, -1.0021254, rtol=1e-2)
+
+
+def test_approximate_erfc(simulation_factory, two_charged_particle_snapshot_factory):
+    """Test that the polynomial erfc matches the exact real space term."""
+    energies = []
+    for approximate_erfc in (False, True):
+        sim = simulation_factory(two_charged_particle_snapshot_factory())
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+            nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0
+        )
+        ewald.params[("A", "A")] = dict(
+            kappa=0, alpha=0, approximate_erfc=approximate_erfc
+        )
+        integrator = hoomd.md.Integrator(dt=0.005)
+        integrator.forces.extend([ewald, coulomb])
+        sim.operations.integrator = integrator
+        sim.run(0)
+
+        assert ewald.params[("A", "A")]["approximate_erfc"] == approximate_erfc
+        energies.append(ewald.energy)
+
+    numpy.testing.assert_allclose(energies[1], energies[0], rtol=0, atol=1e-6)
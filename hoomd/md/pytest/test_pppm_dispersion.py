@@ -0,0 +1,96 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import pickling_check
+import pytest
+import numpy
+
+
+def test_attach_detach(simulation_factory, two_particle_snapshot_factory):
+    """Ensure that md.long_range.pppm.Dispersion can be attached."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj, dispersion = hoomd.md.long_range.pppm.make_pppm_dispersion_forces(
+        nlist=nlist, resolution=(32, 32, 32), order=5, r_cut=3.0
+    )
+
+    assert lj.nlist is nlist
+    assert dispersion.nlist is nlist
+    assert dispersion.resolution == (32, 32, 32)
+    assert dispersion.order == 5
+    assert dispersion.r_cut == 3.0
+
+    # beta splits the dispersion term at the requested tolerance
+    x = dispersion.beta * 3.0
+    g = numpy.exp(-(x**2)) * (1 + x**2 + x**4 / 2)
+    assert g == pytest.approx(1e-3)
+
+    lj.params[("A", "A")] = dict(lj=dict(epsilon=1.0, sigma=1.0))
+
+    sim = simulation_factory(two_particle_snapshot_factory(d=1.5, L=20))
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([lj, dispersion])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+
+    assert lj._attached
+    assert dispersion._attached
+    assert lj.r_cut[("A", "A")] == 3.0
+    assert lj.params[("A", "A")]["dispersion_ewald"]["c6"] == pytest.approx(4.0)
+    assert lj.params[("A", "A")]["dispersion_ewald"]["beta"] == dispersion.beta
+
+    with pytest.raises(AttributeError):
+        dispersion.resolution = (16, 16, 16)
+
+    sim.operations.integrator.forces.remove(dispersion)
+    assert not dispersion._attached
+
+
+def test_pickling(simulation_factory, two_particle_snapshot_factory):
+    """Test that md.long_range.pppm.Dispersion can be pickled and unpickled."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj, dispersion = hoomd.md.long_range.pppm.make_pppm_dispersion_forces(
+        nlist=nlist, resolution=(32, 32, 32), order=5, r_cut=3.0
+    )
+    lj.params[("A", "A")] = dict(lj=dict(epsilon=1.0, sigma=1.0))
+    pickling_check(dispersion)
+
+    sim = simulation_factory(two_particle_snapshot_factory(d=1.5, L=20))
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([lj, dispersion])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+    pickling_check(dispersion)
+
+
+@pytest.mark.parametrize("d", [1.2, 2.0, 4.5])
+def test_pair_energy(simulation_factory, two_particle_snapshot_factory, d):
+    """Compare the PPPM dispersion against LJ with a long cutoff."""
+    sim = simulation_factory(two_particle_snapshot_factory(d=d, L=20))
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj_ewald, dispersion = hoomd.md.long_range.pppm.make_pppm_dispersion_forces(
+        nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=4.0
+    )
+    lj_ewald.params[("A", "A")] = dict(lj=dict(epsilon=1.0, sigma=1.0))
+
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=9.5)
+    lj.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0)
+
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.extend([lj_ewald, dispersion])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+    energy = lj_ewald.energy + dispersion.energy
+    forces = lj_ewald.forces + dispersion.forces
+
+    integrator.forces.clear()
+    integrator.forces.append(lj)
+    sim.run(0)
+
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(energy, lj.energy, rtol=1e-3, atol=1e-5)
+        numpy.testing.assert_allclose(forces, lj.forces, rtol=1e-2, atol=1e-4)
@@ -0,0 +1,112 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import pytest
+
+import hoomd
+from hoomd import md
+from hoomd.conftest import operation_pickling_check
+
+
+@pytest.fixture
+def forces():
+    nlist = md.nlist.Cell(buffer=0.4)
+    return md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(16, 16, 16), order=4, r_cut=2.5, alpha=0
+    )
+
+
+@pytest.fixture
+def simulation(simulation_factory, lattice_snapshot_factory, forces):
+    snap = lattice_snapshot_factory(n=6, a=2.0, r=0.1)  # 216 particles
+    if snap.communicator.rank == 0:
+        snap.particles.charge[::2] = 1.0
+        snap.particles.charge[1::2] = -1.0
+    sim = simulation_factory(snap)
+    integrator = md.Integrator(
+        dt=0.001,
+        methods=[md.methods.ConstantVolume(hoomd.filter.All())],
+        forces=list(forces),
+    )
+    sim.operations.integrator = integrator
+    return sim
+
+
+@pytest.fixture
+def pppm_tuner(forces):
+    return md.tune.PPPMParameters(
+        trigger=2,
+        coulomb=forces[1],
+        target_error=1e-3,
+        orders=[4, 6],
+        r_cuts=[2.0, 2.5],
+    )
+
+
+class TestPPPMParameters:
+    def test_invalid_construction(self, forces):
+        with pytest.raises(ValueError):
+            md.tune.PPPMParameters(trigger=2, coulomb=forces[1], target_error=-1.0)
+
+        with pytest.raises(TypeError):
+            md.tune.PPPMParameters(trigger=2, coulomb=forces[1])
+
+    def test_valid_construction(self, forces):
+        attrs = {
+            "trigger": 5,
+            "coulomb": forces[1],
+            "target_error": 1e-4,
+            "orders": [5],
+            "r_cuts": [3.0],
+            "maximum_resolution": 128,
+            "maximum_box_change": 0.2,
+        }
+        tuner = md.tune.PPPMParameters(**attrs)
+        for attr, value in attrs.items():
+            tuner_attr = getattr(tuner, attr)
+            if attr == "trigger":
+                assert tuner_attr.period == value
+            else:
+                assert tuner_attr is value or tuner_attr == value
+
+        tuner = md.tune.PPPMParameters(trigger=5, coulomb=forces[1], target_error=1e-4)
+        assert tuner.r_cuts == [2.5]
+
+    def test_candidates(self, pppm_tuner, simulation):
+        simulation.operations.tuners.append(pppm_tuner)
+        simulation.run(1)
+        assert len(pppm_tuner.candidates) == 4
+        for candidate in pppm_tuner.candidates:
+            assert candidate["error"] <= pppm_tuner.target_error
+            assert candidate["order"] in pppm_tuner.orders
+            assert candidate["r_cut"] in pppm_tuner.r_cuts
+            for n in candidate["resolution"]:
+                assert n <= pppm_tuner.maximum_resolution
+
+    def test_act(self, pppm_tuner, forces, simulation):
+        ewald, coulomb = forces
+        simulation.operations.tuners.append(pppm_tuner)
+        simulation.run(20)
+        assert pppm_tuner.tuned
+        best = pppm_tuner.best_parameters
+        assert coulomb.resolution == best["resolution"]
+        assert coulomb.order == best["order"]
+        assert coulomb.r_cut == best["r_cut"]
+        assert ewald.r_cut[("A", "A")] == best["r_cut"]
+        kappa = coulomb._cpp_obj.kappa
+        assert ewald.params[("A", "A")]["kappa"] == pytest.approx(kappa)
+        assert pppm_tuner.max_tps > 0
+
+    def test_retune_on_box_change(self, pppm_tuner, simulation):
+        simulation.operations.tuners.append(pppm_tuner)
+        simulation.run(20)
+        assert pppm_tuner.tuned
+
+        box = simulation.state.box
+        box.volume = 1.5 * box.volume
+        simulation.state.set_box(box)
+        simulation.run(2)
+        assert not pppm_tuner.tuned
+
+    def test_pickling(self, pppm_tuner, simulation):
+        operation_pickling_check(pppm_tuner, simulation)
@@ -0,0 +1,104 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy
+from hoomd.logging import LoggerCategories
+from hoomd.error import DataAccessError
+from hoomd.conftest import logging_check
+import pytest
+
+
+def test_rdf_before_attaching():
+    nl = hoomd.md.nlist.Cell(buffer=0.4)
+    rdf = hoomd.md.compute.RDF(nlist=nl, r_max=2.0, bins=20)
+    assert rdf.nlist is nl
+    assert rdf.r_max == 2.0
+    assert rdf.bins == 20
+    numpy.testing.assert_allclose(rdf.r, numpy.arange(20) * 0.1 + 0.05)
+    with pytest.raises(DataAccessError):
+        rdf.rdf
+
+
+def test_rdf_simple_cubic(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=6))
+    nl = hoomd.md.nlist.Cell(buffer=0.4)
+    # bins [0, 0.65) and [0.65, 1.3): the 6 nearest neighbors are in the second
+    rdf = hoomd.md.compute.RDF(nlist=nl, r_max=1.3, bins=2)
+    sim.operations.computes.append(rdf)
+    sim.run(0)
+
+    g = rdf.rdf
+    if sim.device.communicator.rank == 0:
+        shell = 4.0 / 3.0 * numpy.pi * (1.3**3 - 0.65**3)
+        numpy.testing.assert_allclose(g, [0.0, 6.0 / shell], rtol=1e-5)
+    else:
+        assert g is None
+
+
+def test_steinhardt_before_attaching():
+    nl = hoomd.md.nlist.Cell(buffer=0.4)
+    steinhardt = hoomd.md.compute.SteinhardtOrder(nlist=nl, r_max=1.2)
+    assert steinhardt.nlist is nl
+    assert steinhardt.r_max == 1.2
+    assert list(steinhardt.l) == [4, 6]
+    with pytest.raises(DataAccessError):
+        steinhardt.order
+    with pytest.raises(DataAccessError):
+        steinhardt.coordination_number
+
+
+def test_steinhardt_simple_cubic(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=6))
+    nl = hoomd.md.nlist.Cell(buffer=0.4)
+    steinhardt = hoomd.md.compute.SteinhardtOrder(nlist=nl, r_max=1.2, l=[4, 6])
+    sim.operations.computes.append(steinhardt)
+    sim.run(0)
+
+    numpy.testing.assert_allclose(steinhardt.order, [0.763763, 0.353553], rtol=1e-4)
+    assert steinhardt.coordination_number == pytest.approx(6.0)
+
+
+def test_shared_nlist(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=6, r=0.01))
+    nl = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nl, default_r_cut=2.5)
+    lj.params[("A", "A")] = dict(epsilon=1, sigma=1)
+    integrator = hoomd.md.Integrator(
+        dt=0.001,
+        methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())],
+        forces=[lj],
+    )
+    sim.operations.integrator = integrator
+    steinhardt = hoomd.md.compute.SteinhardtOrder(nlist=nl, r_max=1.2)
+    sim.operations.computes.append(steinhardt)
+    sim.run(10)
+
+    assert steinhardt.coordination_number == pytest.approx(6.0)
+    order = steinhardt.order
+    assert order[0] == pytest.approx(0.763763, rel=0.05)
+
+    sim.operations.computes.remove(steinhardt)
+    sim.run(1)
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.RDF,
+        ("md", "compute"),
+        {
+            "rdf": {"category": LoggerCategories.sequence, "default": True},
+            "r": {"category": LoggerCategories.sequence, "default": True},
+        },
+    )
+    logging_check(
+        hoomd.md.compute.SteinhardtOrder,
+        ("md", "compute"),
+        {
+            "order": {"category": LoggerCategories.sequence, "default": True},
+            "coordination_number": {
+                "category": LoggerCategories.scalar,
+                "default": True,
+            },
+        },
+    )
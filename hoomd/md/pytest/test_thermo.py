@@ -214,6 +214,44 @@ def test_system_rotational_dof(simulation_factory, device):
     assert thermo.rotational_degrees_of_freedom == 0
 
 
+def test_multi_group(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(n=4, particle_types=["A", "B"])
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+        rng = np.random.default_rng(8)
+        snap.particles.velocity[:] = rng.normal(size=(snap.particles.N, 3))
+    sim = simulation_factory(snap)
+    sim.always_compute_pressure = True
+
+    filters = [hoomd.filter.Type(["A"]), hoomd.filter.Type(["B"]), hoomd.filter.All()]
+    thermos = [hoomd.md.compute.ThermodynamicQuantities(f) for f in filters]
+    multi = hoomd.md.compute.MultiGroupThermodynamicQuantities(filters)
+    sim.operations.computes.extend(thermos + [multi])
+
+    integrator = hoomd.md.Integrator(dt=0.0001)
+    integrator.methods.append(hoomd.md.methods.ConstantVolume(hoomd.filter.All()))
+    sim.operations.integrator = integrator
+    sim.run(1)
+
+    for quantity in (
+        "kinetic_temperature",
+        "pressure",
+        "pressure_tensor",
+        "kinetic_energy",
+        "potential_energy",
+        "num_particles",
+    ):
+        expected = [getattr(thermo, quantity) for thermo in thermos]
+        np.testing.assert_allclose(getattr(multi, quantity), expected, rtol=1e-5)
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        momentum = snap.particles.mass[:, np.newaxis] * snap.particles.velocity
+        np.testing.assert_allclose(
+            multi.momentum[2], momentum.sum(axis=0), rtol=1e-5, atol=1e-5
+        )
+
+
 def test_pickling(simulation_factory, two_particle_snapshot_factory):
     filter_ = hoomd.filter.All()
     thermo = hoomd.md.compute.ThermodynamicQuantities(filter_)
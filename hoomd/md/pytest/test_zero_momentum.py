@@ -55,3 +55,36 @@ def test_momentum_is_zero(simulation_factory, two_particle_snapshot_factory):
         for i in range(3):
             pi = sum([m * v[i] for m, v in zip(masses, velocities)])
             np.testing.assert_allclose(pi, 0, atol=1e-5)
+
+
+def test_fuse_with_integrator(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(n=4, a=2.0)
+    if snap.communicator.rank == 0:
+        rng = np.random.default_rng(5)
+        snap.particles.velocity[:] = rng.normal(size=(snap.particles.N, 3))
+        snap.particles.mass[:] = rng.uniform(0.5, 2.0, size=snap.particles.N)
+
+    positions = []
+    for fuse in (False, True):
+        sim = simulation_factory(snap)
+        nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = hoomd.md.Integrator(0.005, methods=[nve])
+
+        zm = hoomd.md.update.ZeroMomentum(
+            hoomd.trigger.Periodic(3), fuse_with_integrator=fuse
+        )
+        assert zm.fuse_with_integrator == fuse
+        sim.operations.add(zm)
+        sim.run(10)
+
+        snap_end = sim.state.get_snapshot()
+        if snap_end.communicator.rank == 0:
+            momentum = np.sum(
+                snap_end.particles.mass[:, np.newaxis] * snap_end.particles.velocity,
+                axis=0,
+            )
+            np.testing.assert_allclose(momentum, 0, atol=1e-5)
+            positions.append(snap_end.particles.position.copy())
+
+    if snap.communicator.rank == 0:
+        np.testing.assert_allclose(positions[0], positions[1], rtol=1e-5, atol=1e-5)
@@ -3631,6 +3631,158 @@ void test_communicator_ghosts_per_type(communicator_creator comm_creator,
         }
     }
 
+//! Ghost layer subscriber for pairs of two particle types
+struct two_type_pair_ghost_layer
+    {
+    //! Constructor
+    /*!
+     * \param r_AA Cutoff between A particles
+     * \param r_AB Cutoff between A and B particles
+     * \param r_BB Cutoff between B particles
+     */
+    two_type_pair_ghost_layer(Scalar r_AA, Scalar r_AB, Scalar r_BB)
+        : m_r_AA(r_AA), m_r_AB(r_AB), m_r_BB(r_BB)
+        {
+        }
+
+    //! Get the ghost width layer by type pair
+    /*!
+     * \param type_i First type index
+     * \param type_j Second type index
+     * \returns cutoff radius of the pair
+     */
+    Scalar get(unsigned int type_i, unsigned int type_j)
+        {
+        if (type_i != type_j)
+            return m_r_AB;
+        return (type_i) ? m_r_BB : m_r_AA;
+        }
+    Scalar m_r_AA; //!< Cutoff between A particles
+    Scalar m_r_AB; //!< Cutoff between A and B particles
+    Scalar m_r_BB; //!< Cutoff between B particles
+    };
+
+//! Test that ghost layers only cover the types present across each face
+void test_communicator_ghosts_per_pair(communicator_creator comm_creator,
+                                       std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // this test needs to be run on eight processors
+    int size;
+    MPI_Comm_size(exec_conf->getHOOMDWorldMPICommunicator(), &size);
+    UP_ASSERT_EQUAL(size, 8);
+
+    // create a system with five particles
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(5,   // number of particles
+                                                                  BoxDim(2.0), // box dimensions
+                                                                  2, // number of particle types
+                                                                  0, // number of bond types
+                                                                  0, // number of angle types
+                                                                  0, // number of dihedral types
+                                                                  0, // number of dihedral types
+                                                                  exec_conf));
+
+    std::shared_ptr<ParticleData> pdata(sysdef->getParticleData());
+
+    // 0: B, rank 0, outside all ghost layers
+    pdata->setPosition(0, make_scalar3(-0.5, -0.5, -0.5), false);
+    pdata->setType(0, 1);
+
+    // 1: A, rank 0, within the A-B cutoff of +x, but only A is present across +x
+    pdata->setPosition(1, make_scalar3(-0.2, -0.5, -0.5), false);
+    pdata->setType(1, 0);
+
+    // 2: A, rank 1, within the A-B cutoff of -x, B is present across -x
+    pdata->setPosition(2, make_scalar3(0.2, -0.5, -0.5), false);
+    pdata->setType(2, 0);
+
+    // 3: A, rank 7, within the A-B cutoff of -z, B is present across -z
+    pdata->setPosition(3, make_scalar3(0.5, 0.5, 0.2), false);
+    pdata->setType(3, 0);
+
+    // 4: A, rank 2, within the A-B cutoff of +z, but only A is present across +z
+    pdata->setPosition(4, make_scalar3(-0.5, 0.5, -0.2), false);
+    pdata->setType(4, 0);
+
+    // distribute particle data on processors
+    SnapshotParticleData<Scalar> snap(5);
+    pdata->takeSnapshot(snap);
+
+    // initialize a 2x2x2 domain decomposition on processor with rank 0
+    std::shared_ptr<DomainDecomposition> decomposition(
+        new DomainDecomposition(exec_conf, pdata->getBox().getL()));
+    std::shared_ptr<hoomd::Communicator> comm = comm_creator(sysdef, decomposition);
+
+    pdata->setDomainDecomposition(decomposition);
+
+    pdata->initializeFromSnapshot(snap);
+
+    // width of ghost layer
+    two_type_pair_ghost_layer g(Scalar(0.1), Scalar(0.3), Scalar(0.1));
+    comm->getGhostLayerPairWidthRequestSignal()
+        .connect<two_type_pair_ghost_layer, &two_type_pair_ghost_layer::get>(g);
+
+    // set ghost exchange flags for position
+    CommFlags flags(0);
+    flags[comm_flag::position] = 1;
+    flags[comm_flag::tag] = 1;
+    comm->setFlags(flags);
+
+    // exchange ghosts
+    comm->exchangeGhosts();
+
+        // the widths per type cover all pairs
+        {
+        ArrayHandle<Scalar> h_r_ghost(comm->getGhostLayerWidth(),
+                                      access_location::host,
+                                      access_mode::read);
+        CHECK_CLOSE(h_r_ghost.data[0], 0.3, tol);
+        CHECK_CLOSE(h_r_ghost.data[1], 0.3, tol);
+        }
+
+    if (exec_conf->getRank() == 0)
+        {
+        // only A is present across +x (direction 0)
+        ArrayHandle<Scalar> h_r_ghost_dir(comm->getGhostLayerWidthByDirection(),
+                                          access_location::host,
+                                          access_mode::read);
+        CHECK_CLOSE(h_r_ghost_dir.data[0 * 2 + 0], 0.1, tol);
+        CHECK_CLOSE(h_r_ghost_dir.data[0 * 2 + 1], 0.3, tol);
+        }
+
+        // check ghost atom numbers and positions
+        {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_global_rtag(pdata->getRTags(),
+                                                access_location::host,
+                                                access_mode::read);
+        unsigned int rtag;
+        switch (exec_conf->getRank())
+            {
+        case 0:
+            UP_ASSERT_EQUAL(pdata->getNGhosts(), 1);
+
+            rtag = h_global_rtag.data[2];
+            UP_ASSERT(rtag >= pdata->getN() && rtag < pdata->getN() + pdata->getNGhosts());
+            CHECK_CLOSE(h_pos.data[rtag].x, 0.2, tol);
+            CHECK_CLOSE(h_pos.data[rtag].y, -0.5, tol);
+            CHECK_CLOSE(h_pos.data[rtag].z, -0.5, tol);
+            break;
+        case 3:
+            UP_ASSERT_EQUAL(pdata->getNGhosts(), 1);
+
+            rtag = h_global_rtag.data[3];
+            UP_ASSERT(rtag >= pdata->getN() && rtag < pdata->getN() + pdata->getNGhosts());
+            CHECK_CLOSE(h_pos.data[rtag].x, 0.5, tol);
+            CHECK_CLOSE(h_pos.data[rtag].y, 0.5, tol);
+            CHECK_CLOSE(h_pos.data[rtag].z, 0.2, tol);
+            break;
+        default:
+            UP_ASSERT_EQUAL(pdata->getNGhosts(), 0);
+            break;
+            }
+        }
+    }
+
 //! Communicator creator for unit tests
 std::shared_ptr<hoomd::Communicator>
 base_class_communicator_creator(std::shared_ptr<SystemDefinition> sysdef,
@@ -3898,6 +4050,16 @@ UP_TEST(communicator_ghost_layer_per_type_test)
     test_communicator_ghosts_per_type(communicator_creator_base, exec_conf_cpu, BoxDim(2.0));
     }
 
+UP_TEST(communicator_ghost_layer_per_pair_test)
+    {
+    if (!exec_conf_cpu)
+        exec_conf_cpu = std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU));
+
+    communicator_creator communicator_creator_base = bind(base_class_communicator_creator, _1, _2);
+    test_communicator_ghosts_per_pair(communicator_creator_base, exec_conf_cpu);
+    }
+
 UP_SUITE_END();
 
 #ifdef ENABLE_HIP
@@ -4152,6 +4314,16 @@ UP_TEST(communicator_ghost_layer_per_type_test_GPU)
     test_communicator_ghosts_per_type(communicator_creator_base, exec_conf_gpu, BoxDim(2.0));
     }
 
+UP_TEST(communicator_ghost_layer_per_pair_test_GPU)
+    {
+    if (!exec_conf_gpu)
+        exec_conf_gpu = std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU));
+
+    communicator_creator communicator_creator_gpu = bind(gpu_communicator_creator, _1, _2);
+    test_communicator_ghosts_per_pair(communicator_creator_gpu, exec_conf_gpu);
+    }
+
 UP_TEST(communicator_compare_test)
     {
     if (!exec_conf_cpu)
@@ -12,6 +12,7 @@
 #include "hoomd/Initializers.h"
 #include "hoomd/md/NeighborList.h"
 #include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/NeighborListBody.h"
 #include "hoomd/md/NeighborListStencil.h"
 #include "hoomd/md/NeighborListTree.h"
 
@@ -1142,6 +1143,97 @@ void neighborlist_comparison_test(std::shared_ptr<ExecutionConfiguration> exec_c
         }
     }
 
+//! Test that two implementations of NeighborList filter the same bodies
+/*! The particles are grouped into bodies by the cell of a 4x4x4 grid they are in, so the bodies
+    are compact and some of them are out of range of each other.
+*/
+template<class NLA, class NLB>
+void neighborlist_body_comparison_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // construct the particle system
+    RandomInitializer init(1000, Scalar(0.016778), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap = init.getSnapshot();
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_body(pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::readwrite);
+
+        const BoxDim& box = pdata->getBox();
+        for (unsigned int i = 0; i < pdata->getN(); i++)
+            {
+            Scalar4 pos = h_pos.data[i];
+            Scalar3 f = box.makeFraction(make_scalar3(pos.x, pos.y, pos.z));
+            unsigned int ib = std::min((unsigned int)(f.x * 4), 3u);
+            unsigned int jb = std::min((unsigned int)(f.y * 4), 3u);
+            unsigned int kb = std::min((unsigned int)(f.z * 4), 3u);
+
+            // leave some particles free
+            if (i % 7 == 0)
+                h_body.data[i] = NO_BODY;
+            else
+                h_body.data[i] = (kb * 4 + jb) * 4 + ib;
+            }
+        }
+
+    std::shared_ptr<NeighborList> nlist1(new NLA(sysdef, Scalar(0.4)));
+    auto r_cut = std::make_shared<GPUArray<Scalar>>(nlist1->getTypePairIndexer().getNumElements(),
+                                                    exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = 3.0;
+        }
+    nlist1->addRCutMatrix(r_cut);
+    nlist1->setFilterBody(true);
+    nlist1->setStorageMode(NeighborList::half);
+
+    std::shared_ptr<NeighborList> nlist2(new NLB(sysdef, Scalar(0.4)));
+    nlist2->addRCutMatrix(r_cut);
+    nlist2->setFilterBody(true);
+    nlist2->setStorageMode(NeighborList::half);
+
+    nlist1->compute(0);
+    nlist2->compute(0);
+
+    ArrayHandle<unsigned int> h_n_neigh1(nlist1->getNNeighArray(),
+                                         access_location::host,
+                                         access_mode::read);
+    ArrayHandle<unsigned int> h_nlist1(nlist1->getNListArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<size_t> h_head_list1(nlist1->getHeadList(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh2(nlist2->getNNeighArray(),
+                                         access_location::host,
+                                         access_mode::read);
+    ArrayHandle<unsigned int> h_nlist2(nlist2->getNListArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<size_t> h_head_list2(nlist2->getHeadList(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    // both lists must hold exactly the same neighbors
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        CHECK_EQUAL_UINT(h_n_neigh1.data[i], h_n_neigh2.data[i]);
+
+        std::vector<unsigned int> ref_list(h_nlist1.data + h_head_list1.data[i],
+                                           h_nlist1.data + h_head_list1.data[i]
+                                               + h_n_neigh1.data[i]);
+        std::vector<unsigned int> test_list(h_nlist2.data + h_head_list2.data[i],
+                                            h_nlist2.data + h_head_list2.data[i]
+                                                + h_n_neigh2.data[i]);
+        std::sort(ref_list.begin(), ref_list.end());
+        std::sort(test_list.begin(), test_list.end());
+        UP_ASSERT(ref_list == test_list);
+        }
+    }
+
 //! Test that a NeighborList can successfully exclude a ridiculously large number of particles
 template<class NL>
 void neighborlist_large_ex_tests(std::shared_ptr<ExecutionConfiguration> exec_conf)
@@ -1561,6 +1653,72 @@ UP_TEST(NeighborListBinned_2d)
         new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+////////////////////
+// BODY CPU
+////////////////////
+//! basic test case for body class
+UP_TEST(NeighborListBody_basic)
+    {
+    neighborlist_basic_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! exclusion test case for body class
+UP_TEST(NeighborListBody_exclusion)
+    {
+    neighborlist_exclusion_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! large exclusion test case for body class
+UP_TEST(NeighborListBody_large_ex)
+    {
+    neighborlist_large_ex_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! body filter test case for body class
+UP_TEST(NeighborListBody_body_filter)
+    {
+    neighborlist_body_filter_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! particle asymmetry test case for body class
+UP_TEST(NeighborListBody_particle_asymm)
+    {
+    neighborlist_particle_asymm_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! cutoff exclusion test case for body class
+UP_TEST(NeighborListBody_cutoff_exclude)
+    {
+    neighborlist_cutoff_exclude_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! type test case for body class
+UP_TEST(NeighborListBody_type)
+    {
+    neighborlist_type_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! 2d tests for body class
+UP_TEST(NeighborListBody_2d)
+    {
+    neighborlist_2d_tests<NeighborListBody>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! comparison test case for body class
+UP_TEST(NeighborListBody_comparison)
+    {
+    neighborlist_comparison_test<NeighborListBinned, NeighborListBody>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! body comparison test case for body class
+UP_TEST(NeighborListBody_body_comparison)
+    {
+    neighborlist_body_comparison_test<NeighborListBinned, NeighborListBody>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 ////////////////////
 // STENCIL CPU
 ////////////////////
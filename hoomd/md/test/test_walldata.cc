@@ -8,10 +8,13 @@
 
 HOOMD_UP_MAIN();
 
+#include "hoomd/md/WallCellList.h"
 #include "hoomd/md/WallData.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
+#include <random>
 #include <vector>
 
 using namespace hoomd;
@@ -275,3 +278,69 @@ UP_TEST(plane_wall_math)
     MY_CHECK_SMALL(vx.z, tol_small);
     MY_CHECK_SMALL(dx, tol_small);
     }
+
+//! Check that the wall cell lists keep every wall that can interact with a particle
+void check_wall_cell_list(const wall_type& field,
+                          const BoxDim& box,
+                          Scalar r_range,
+                          bool cull_inactive)
+    {
+    WallCellList cells;
+    cells.update(field, box, r_range, cull_inactive);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<Scalar> uniform(0.001, 0.999);
+    unsigned int n_culled = 0;
+    for (unsigned int n = 0; n < 1000; n++)
+        {
+        const Scalar3 x
+            = box.makeCoordinates(make_scalar3(uniform(rng), uniform(rng), uniform(rng)));
+        unsigned int n_spheres, n_cylinders, n_planes;
+        const unsigned char* walls = cells.getWalls(x, n_spheres, n_cylinders, n_planes);
+        UP_ASSERT(walls != nullptr);
+
+        auto check = [&](const auto& wall_array,
+                         unsigned int n_walls,
+                         const unsigned char* list,
+                         unsigned int n_list)
+        {
+            UP_ASSERT(std::is_sorted(list, list + n_list));
+            for (unsigned int w = 0; w < n_walls; w++)
+                {
+                if (std::find(list, list + n_list, w) != list + n_list)
+                    continue;
+                const Scalar d = distWall(wall_array[w], vec3<Scalar>(x));
+                UP_ASSERT(d >= r_range || (cull_inactive && d < 0));
+                n_culled++;
+                }
+        };
+        check(field.Spheres, field.numSpheres, walls, n_spheres);
+        check(field.Cylinders, field.numCylinders, walls + n_spheres, n_cylinders);
+        check(field.Planes, field.numPlanes, walls + n_spheres + n_cylinders, n_planes);
+        }
+    UP_ASSERT(n_culled > 0);
+    }
+
+UP_TEST(wall_cell_list)
+    {
+    wall_type field;
+    field.Spheres[field.numSpheres++] = SphereWall(4.0, make_scalar3(0.0, 0.0, 0.0), true);
+    field.Spheres[field.numSpheres++] = SphereWall(1.5, make_scalar3(2.0, -3.0, 1.0), false);
+    field.Cylinders[field.numCylinders++]
+        = CylinderWall(3.0, make_scalar3(1.0, 0.0, 0.0), make_scalar3(0.2, 0.1, 1.0), true);
+    field.Planes[field.numPlanes++]
+        = PlaneWall(make_scalar3(0.0, 0.0, -4.0), make_scalar3(0.0, 0.0, 1.0));
+    field.Planes[field.numPlanes++]
+        = PlaneWall(make_scalar3(0.0, 4.0, 0.0), make_scalar3(0.1, -1.0, 0.0));
+    field.Planes[field.numPlanes++]
+        = PlaneWall(make_scalar3(-2.0, 0.0, 0.0), make_scalar3(1.0, 1.0, 1.0));
+
+    BoxDim box(10.0);
+    check_wall_cell_list(field, box, 1.5, true);
+    check_wall_cell_list(field, box, 1.5, false);
+
+    BoxDim triclinic(10.0, 12.0, 9.0);
+    triclinic.setTiltFactors(0.3, -0.2, 0.5);
+    check_wall_cell_list(field, triclinic, 0.8, true);
+    check_wall_cell_list(field, triclinic, 2.5, false);
+    }
@@ -4,7 +4,9 @@
 """Tuners for the MD subpackage."""
 
 from .nlist_buffer import NeighborListBuffer
+from .pppm_parameters import PPPMParameters
 
 __all__ = [
     "NeighborListBuffer",
+    "PPPMParameters",
 ]
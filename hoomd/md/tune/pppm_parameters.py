@@ -0,0 +1,306 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Provide a tuner for the parameters of `hoomd.md.long_range.pppm.Coulomb`."""
+
+import copy
+import math
+
+import hoomd.custom
+import hoomd.data
+from hoomd.data.typeconverter import OnlyTypes, SetOnce
+import hoomd.logging
+import hoomd.tune
+import hoomd.trigger
+from hoomd.md.long_range import pppm
+from hoomd.md.tune.nlist_buffer import _IntervalTPS
+from hoomd.custom.custom_action import _InternalAction
+
+
+def _fft_sizes(maximum_resolution, powers_of_two):
+    """List the mesh sizes that FFT libraries transform efficiently."""
+    if powers_of_two:
+        factors = (2,)
+    else:
+        factors = (2, 3, 5)
+
+    sizes = {1}
+    for factor in factors:
+        for size in list(sizes):
+            size *= factor
+            while size <= maximum_resolution:
+                sizes.add(size)
+                size *= factor
+    return sorted(size for size in sizes if size >= 4)
+
+
+class _PPPMParametersInternal(_InternalAction):
+    _skip_for_equality = {"_simulation", "_interval_tps"}
+
+    def __init__(
+        self,
+        coulomb: pppm.Coulomb,
+        target_error: float,
+        orders: "list[int]" = (4, 5, 6),
+        r_cuts: "list[float] | None" = None,
+        maximum_resolution: int = 256,
+        maximum_box_change: float = 0.1,
+    ):
+        if r_cuts is None:
+            r_cuts = [coulomb.r_cut]
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            coulomb=SetOnce(pppm.Coulomb),
+            target_error=OnlyTypes(float, postprocess=self._positive_post),
+            orders=[int],
+            r_cuts=[float],
+            maximum_resolution=int,
+            maximum_box_change=OnlyTypes(float, postprocess=self._positive_post),
+        )
+        param_dict.update(
+            {
+                "coulomb": coulomb,
+                "target_error": target_error,
+                "orders": list(orders),
+                "r_cuts": list(r_cuts),
+                "maximum_resolution": maximum_resolution,
+                "maximum_box_change": maximum_box_change,
+            }
+        )
+        self._param_dict.update(param_dict)
+
+        self._simulation = None
+        self._interval_tps = None
+        self._candidates = []
+        self._index = -1
+        self._tuned = False
+        self._tuned_volume = None
+
+        # Setup default log values
+        self._last_tps = 0.0
+        self._max_tps = 0.0
+        self._best_parameters = None
+
+    def _positive_post(self, value: float):
+        if value <= 0:
+            raise ValueError("Value must be positive.")
+        return value
+
+    def act(self, timestep: int):
+        tps = self._interval_tps()
+
+        if self._tuned:
+            volume = self._simulation.state.box.volume
+            if abs(volume / self._tuned_volume - 1.0) <= self.maximum_box_change:
+                return
+            self.reset()
+
+        if self._index < 0:
+            self._candidates = self._make_candidates()
+            if len(self._candidates) == 0:
+                raise RuntimeError(
+                    "No PPPM parameters reach the target error. Increase "
+                    "maximum_resolution or add larger values to r_cuts."
+                )
+            self._max_tps = 0.0
+            self._index = 0
+            self._apply(self._candidates[self._index])
+            return
+
+        # The simulation has not run with the current candidate since the last
+        # call (or a new run started): time it again.
+        if tps is None:
+            return
+
+        self._last_tps = tps
+        if tps > self._max_tps:
+            self._max_tps = tps
+            self._best_parameters = self._candidates[self._index]
+
+        self._index += 1
+        if self._index < len(self._candidates):
+            self._apply(self._candidates[self._index])
+        else:
+            self._apply(self._best_parameters)
+            self._tuned = True
+            self._tuned_volume = self._simulation.state.box.volume
+
+    def _make_candidates(self):
+        """Find the coarsest mesh that meets the target error.
+
+        Evaluate each combination of ``orders`` and ``r_cuts``.
+        """
+        state = self._simulation.state
+        box = state.box
+        N = state.N_particles
+        q2 = self.coulomb._cpp_obj.getQ2Sum()
+        lengths = (box.Lx, box.Ly, box.Lz)
+
+        # Distributed FFTs require power of two meshes.
+        powers_of_two = self._simulation.device.communicator.num_ranks > 1
+        sizes = _fft_sizes(self.maximum_resolution, powers_of_two)
+
+        candidates = []
+        for r_cut in self.r_cuts:
+            for order in self.orders:
+                for size in sizes:
+                    # choose the same mesh spacing in all directions
+                    spacing = max(lengths) / size
+                    resolution = tuple(
+                        next(
+                            (n for n in sizes if n >= math.ceil(L / spacing)),
+                            sizes[-1],
+                        )
+                        for L in lengths
+                    )
+                    try:
+                        kappa = pppm._compute_kappa(
+                            resolution, order, r_cut, box, N, q2
+                        )
+                    except RuntimeError:
+                        continue
+                    error = pppm._estimate_error(
+                        resolution, order, r_cut, kappa, box, N, q2
+                    )
+                    if error <= self.target_error:
+                        candidates.append(
+                            {
+                                "resolution": resolution,
+                                "order": order,
+                                "r_cut": r_cut,
+                                "error": error,
+                            }
+                        )
+                        break
+        return candidates
+
+    def _apply(self, parameters):
+        self.coulomb._set_parameters(
+            parameters["resolution"], parameters["order"], parameters["r_cut"]
+        )
+
+    def attach(self, simulation):
+        self._simulation = simulation
+        self._interval_tps = _IntervalTPS(simulation)
+
+    def detach(self):
+        self._simulation = None
+        self._interval_tps = None
+
+    @property
+    def tuned(self):
+        """bool: Whether the PPPM parameters are considered tuned.
+
+        The tuner is considered tuned after it has timed every candidate and
+        applied the fastest one. It starts tuning again when the box volume
+        changes by more than ``maximum_box_change``.
+        """
+        return self._tuned
+
+    @hoomd.logging.log
+    def max_tps(self):
+        """float: The maximum recorded TPS during tuning."""
+        return self._max_tps
+
+    @hoomd.logging.log
+    def last_tps(self):
+        """float: The last TPS computed for the tuner."""
+        return self._last_tps
+
+    @property
+    def best_parameters(self):
+        """dict: The parameters corresponding to ``max_tps`` during tuning.
+
+        The dictionary has the keys ``resolution``, ``order``, ``r_cut``, and
+        ``error`` (the estimated RMS force error). ``None`` before the first
+        candidate is timed.
+        """
+        return self._best_parameters
+
+    @property
+    def candidates(self):
+        """list[dict]: The parameters timed in the current tuning round.
+
+        Each candidate uses the coarsest mesh that meets ``target_error`` with
+        one combination of ``orders`` and ``r_cuts``.
+        """
+        return self._candidates
+
+    def reset(self):
+        """Reset tuning.
+
+        Find the candidate parameters again for the current box and time them.
+
+        Note:
+            The tuner resets itself when the box volume changes by more than
+            ``maximum_box_change``. Call `reset` to re-tune when other
+            simulation conditions change.
+        """
+        self._tuned = False
+        self._index = -1
+
+    def __getstate__(self):
+        state = copy.copy(self.__dict__)
+        for attr in self._skip_for_equality:
+            state.pop(attr, None)
+        return state
+
+
+class PPPMParameters(hoomd.tune.custom_tuner._InternalCustomTuner):
+    """Choose the fastest PPPM parameters that meet a target force error.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): ``Trigger`` to determine when to
+            run the tuner.
+        coulomb (hoomd.md.long_range.pppm.Coulomb): Reciprocal space force to
+            tune.
+        target_error (float): The largest acceptable estimated RMS force error
+            :math:`\\mathrm{[force]}`.
+        orders (`list` [`int`], optional): Assignment orders to consider
+            (defaults to ``[4, 5, 6]``).
+        r_cuts (`list` [`float`], optional): Real space cutoffs to consider
+            :math:`\\mathrm{[length]}` (defaults to ``[coulomb.r_cut]``).
+        maximum_resolution (`int`, optional): The largest number of grid points
+            to allow in any direction (defaults to 256).
+        maximum_box_change (`float`, optional): The relative change in box
+            volume that triggers tuning again (defaults to 0.1).
+
+    `PPPMParameters` balances the cost of the real space (`md.pair.Ewald`) and
+    reciprocal space (`md.long_range.pppm.Coulomb`) terms of the PPPM method.
+    For each combination of ``orders`` and ``r_cuts``, it finds the coarsest
+    mesh where the estimated RMS force error is less than ``target_error``.
+    Then, it applies each of these candidates in turn, measures the TPS over
+    one trigger period, and keeps the fastest. The tuner sets the resolution,
+    order and cutoff of ``coulomb`` and the :math:`\\kappa` and cutoff of the
+    paired `md.pair.Ewald` force together.
+
+    The mesh uses the same spacing in each direction and a number of grid
+    points that factors into 2, 3, and 5 (powers of two in MPI simulations).
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): ``Trigger`` to determine when to run
+            the tuner.
+        coulomb (hoomd.md.long_range.pppm.Coulomb): Reciprocal space force to
+            tune.
+        target_error (float): The largest acceptable estimated RMS force error
+            :math:`\\mathrm{[force]}`.
+        orders (list[int]): Assignment orders to consider.
+        r_cuts (list[float]): Real space cutoffs to consider
+            :math:`\\mathrm{[length]}`.
+        maximum_resolution (int): The largest number of grid points to allow in
+            any direction.
+        maximum_box_change (float): The relative change in box volume that
+            triggers tuning again.
+
+    Tip:
+        Use a trigger period of at least a few hundred steps. The first steps
+        after each change recompute the influence function and neighbor list.
+
+    Warning:
+        When using with a `hoomd.device.GPU` device, kernel launch parameter
+        autotuning can prevent convergence. Run the simulation for 25,000 steps
+        before adding the tuner to allow the autotuning to converge first
+        results in better TPS optimization.
+    """
+
+    _internal_class = _PPPMParametersInternal
+    _wrap_methods = ("tuned", "best_parameters", "candidates", "reset")
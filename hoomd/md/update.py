@@ -1,7 +1,13 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
-"""MD updaters."""
+"""MD updaters.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    mesh = hoomd.mesh.Mesh()
+"""
 
 from hoomd.md import _md
 import hoomd
@@ -18,6 +24,8 @@ class ZeroMomentum(Updater):
     Args:
         trigger (hoomd.trigger.trigger_like): Select the timesteps to zero
             momentum.
+        fuse_with_integrator (bool): Remove the momentum in the integration
+            steps of the `hoomd.md.Integrator` (defaults to ``False``).
 
     `ZeroMomentum` computes the center of mass linear momentum of the system:
 
@@ -39,18 +47,37 @@ class ZeroMomentum(Updater):
     Note:
         `ZeroMomentum` executes on the CPU even when using a GPU device.
 
+    When ``fuse_with_integrator`` is ``True``, the integrator sums the momentum
+    while it updates the velocities at the end of the previous step and
+    removes it while it updates the velocities at the start of the selected
+    step. This saves the two separate passes over the particles. The
+    integrator removes the momentum only from the particles selected by its
+    integration methods. `ZeroMomentum` falls back to the separate passes
+    when any integration method cannot remove the momentum in its steps, such
+    as `hoomd.md.methods.ConstantVolume` on the GPU or
+    `hoomd.md.methods.Langevin`.
+
     Examples::
 
         zero_momentum = hoomd.md.update.ZeroMomentum(
             hoomd.trigger.Periodic(100)
         )
+
+    Attributes:
+        fuse_with_integrator (bool): Remove the momentum in the integration
+            steps of the `hoomd.md.Integrator` (*read only*).
     """
 
     __doc__ += Updater._doc_inherited
 
-    def __init__(self, trigger):
+    def __init__(self, trigger, fuse_with_integrator=False):
         # initialize base class
         super().__init__(trigger)
+        self._fuse_with_integrator = bool(fuse_with_integrator)
+
+    @property
+    def fuse_with_integrator(self):  # noqa: D102 - documented in Attributes above
+        return self._fuse_with_integrator
 
     def _attach_hook(self):
         # create the c++ mirror class
@@ -58,6 +85,13 @@ class ZeroMomentum(Updater):
             self._simulation.state._cpp_sys_def, self.trigger
         )
 
+        integrator = self._simulation.operations.integrator
+        if self._fuse_with_integrator and isinstance(integrator, hoomd.md.Integrator):
+            self._cpp_obj.setIntegrator(integrator._cpp_obj)
+
+    def _detach_hook(self):
+        self._cpp_obj.setIntegrator(None)
+
 
 class ReversePerturbationFlow(Updater):
     """Reverse Perturbation method to establish shear flow.
@@ -265,6 +299,8 @@ class ActiveRotationalDiffusion(Updater):
             `hoomd.md.force.Active`.
         rotational_diffusion (hoomd.variant.variant_like): The rotational
             diffusion as a function of time.
+        fuse_with_force (bool): When `True`, apply the diffusion while the
+            active force sets the forces. Defaults to `False`.
 
     `ActiveRotationalDiffusion` works directly with `hoomd.md.force.Active` or
     `hoomd.md.force.ActiveOnManifold` to apply rotational diffusion to the
@@ -283,6 +319,13 @@ class ActiveRotationalDiffusion(Updater):
     When used with `hoomd.md.force.ActiveOnManifold`, rotational diffusion is
     performed in the tangent plane of the manifold.
 
+    Set ``fuse_with_force`` to `True` to save one pass over the particles each
+    step. The active force then rotates the orientations with the random numbers
+    drawn for this timestep at the time it computes the forces of the step. This
+    produces the same trajectory unless the integration method also rotates the
+    orientations of the active particles (e.g. `hoomd.md.methods.Brownian` with
+    rotational degrees of freedom).
+
     Tip:
         Use `hoomd.md.force.Active.create_diffusion_updater` to construct
         a `ActiveRotationalDiffusion` instance.
@@ -298,15 +341,20 @@ class ActiveRotationalDiffusion(Updater):
             the updater. This is not settable after construction.
         rotational_diffusion (hoomd.variant.Variant): The rotational diffusion
             as a function of time.
+        fuse_with_force (bool): When `True`, apply the diffusion while the
+            active force sets the forces.
     """
 
     __doc__ = __doc__.replace("{inherited}", Updater._doc_inherited)
 
-    def __init__(self, trigger, active_force, rotational_diffusion):
+    def __init__(
+        self, trigger, active_force, rotational_diffusion, fuse_with_force=False
+    ):
         super().__init__(trigger)
         param_dict = ParameterDict(
             rotational_diffusion=hoomd.variant.Variant,
             active_force=hoomd.md.force.Active,
+            fuse_with_force=bool(fuse_with_force),
         )
         param_dict["rotational_diffusion"] = rotational_diffusion
         param_dict["active_force"] = active_force
@@ -346,8 +394,92 @@ class ActiveRotationalDiffusion(Updater):
         super()._setattr_param(attr, value)
 
 
+class MeshBondFlip(Updater):
+    r"""Flip the mesh bonds that violate the Delaunay condition.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to flip
+            bonds.
+        mesh (hoomd.mesh.Mesh): Mesh to flip the bonds of.
+
+    `MeshBondFlip` changes the triangulation of a fluid membrane as its
+    vertices move. A mesh bond between the vertices :math:`a` and :math:`b` is
+    the shared edge of the triangles :math:`(a, b, c)` and :math:`(b, a, d)`.
+    When the interior angles of the triangles at :math:`c` and :math:`d` sum
+    to more than :math:`\pi`, `MeshBondFlip` replaces the bond with the bond
+    between :math:`c` and :math:`d` and the triangles with :math:`(a, d, c)`
+    and :math:`(d, b, c)`. The flipped triangles keep their orientation.
+
+    Each update sweeps over all mesh bonds once. `MeshBondFlip` does not flip
+    bonds on the boundary of the mesh, bonds between triangles of different
+    types, bonds whose flip would duplicate an existing bond, or bonds whose
+    vertices would be left with fewer than 3 neighbors.
+
+    `MeshBondFlip` modifies the mesh bonds and triangles in place, so the mesh
+    potentials see the new triangulation on the next step without rebuilding
+    the mesh.
+
+    Note:
+        `MeshBondFlip` executes on the CPU even when using a GPU device.
+
+    Important:
+        `MeshBondFlip` does not support MPI domain decomposition.
+
+    Warning:
+        Neighbor lists add the ``'meshbond'`` exclusions when they attach and
+        do not update them after bonds flip.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        mesh_bond_flip = hoomd.md.update.MeshBondFlip(
+            trigger=hoomd.trigger.Periodic(100), mesh=mesh
+        )
+        simulation.operations.updaters.append(mesh_bond_flip)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `MeshBondFlip`:
+
+    Attributes:
+        mesh (hoomd.mesh.Mesh): Mesh to flip the bonds of (*read only*).
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Updater._doc_inherited)
+
+    def __init__(self, trigger, mesh):
+        super().__init__(trigger)
+        self._mesh = OnlyTypes(hoomd.mesh.Mesh)(mesh)
+
+    @property
+    def mesh(self):  # noqa: D102 - documented in Attributes above
+        return self._mesh
+
+    def _attach_hook(self):
+        if self._mesh._attached and self._simulation != self._mesh._simulation:
+            raise SimulationDefinitionError(
+                "Mesh for MeshBondFlip object belongs to another simulation."
+            )
+        self._mesh._attach(self._simulation)
+        self._cpp_obj = _md.MeshBondFlipUpdater(
+            self._simulation.state._cpp_sys_def, self.trigger, self._mesh._cpp_obj
+        )
+
+    def _detach_hook(self):
+        self._mesh._detach()
+
+    @log(requires_run=True)
+    def num_flips(self):
+        """int: Number of bonds flipped in the last update."""
+        return self._cpp_obj.num_flips
+
+
 __all__ = [
     "ActiveRotationalDiffusion",
+    "MeshBondFlip",
     "ReversePerturbationFlow",
     "ZeroMomentum",
 ]
@@ -20,19 +20,25 @@
 #include "Initializers.h"
 #include "Integrator.h"
 #include "LoadBalancer.h"
+#include "LocalDataPrefetcher.h"
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "Messenger.h"
+#include "MultipleTauCorrelator.h"
 #include "ParticleData.h"
 #include "ParticleFilterUpdater.h"
+#include "Profiler.h"
 #include "PythonAnalyzer.h"
 #include "PythonLocalDataAccess.h"
 #include "PythonTuner.h"
 #include "PythonUpdater.h"
+#include "ReplicaExchangeUpdater.h"
 #include "SFCPackTuner.h"
+#include "SharedMemoryWriter.h"
 #include "SnapshotSystemData.h"
 #include "System.h"
 #include "SystemDefinition.h"
+#include "TableWriter.h"
 #include "Trigger.h"
 #include "Tuner.h"
 #include "Updater.h"
@@ -63,6 +69,7 @@ void export_ParticleDataSnapshot(pybind11::module& pybind11);
 #include "BoxResizeUpdaterGPU.h"
 #include "CellListGPU.h"
 #include "LoadBalancerGPU.h"
+#include "MultipleTauCorrelatorGPU.h"
 #include "SFCPackTunerGPU.h"
 #include <hip/hip_runtime.h>
 #endif
@@ -229,6 +236,7 @@ PYBIND11_MODULE(_hoomd, m)
     // utils
     export_hoomd_math_functions(m);
     export_ClockSource(m);
+    export_Profiler(m);
 
     // data structures
     export_HOOMDHostBuffer(m);
@@ -287,6 +295,7 @@ PYBIND11_MODULE(_hoomd, m)
 
     // initializers
     export_GSDReader(m);
+    export_DistributedInitializers(m);
 
     // computes
     export_Autotuned(m);
@@ -311,6 +320,13 @@ PYBIND11_MODULE(_hoomd, m)
     export_DCDDumpWriter(m);
     export_GSDDumpWriter(m);
     export_GSDDequeWriter(m);
+    export_TableWriter(m);
+    export_SharedMemoryWriter(m);
+    export_LocalDataPrefetcher(m);
+    export_MultipleTauCorrelator(m);
+#ifdef ENABLE_HIP
+    export_MultipleTauCorrelatorGPU(m);
+#endif
 
     // updaters
     export_Updater(m);
@@ -318,6 +334,7 @@ PYBIND11_MODULE(_hoomd, m)
     export_Integrator(m);
     export_BoxResizeUpdater(m);
     export_UpdaterRemoveDrift(m);
+    export_ReplicaExchangeUpdater(m);
 #ifdef ENABLE_HIP
     export_BoxResizeUpdaterGPU(m);
 #endif
@@ -12,6 +12,37 @@
 
 namespace hoomd
     {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Draw a random velocity for a particle
+/*!
+ * \param timestep Current timestep
+ * \param seed Simulation seed
+ * \param tag Particle tag
+ * \param mass Particle mass
+ * \param T Temperature
+ * \returns Velocity drawn from the Maxwell-Boltzmann distribution at \a T
+ */
+inline Scalar3 drawRandomVelocity(uint64_t timestep,
+                                  uint16_t seed,
+                                  unsigned int tag,
+                                  Scalar mass,
+                                  Scalar T)
+    {
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, timestep, seed),
+        hoomd::Counter(tag));
+    hoomd::NormalDistribution<Scalar> gen(fast::sqrt(T / mass), 0.0);
+    Scalar3 vel;
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+    return vel;
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+
 mpcd::ATCollisionMethod::ATCollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
                                            uint64_t cur_timestep,
                                            uint64_t period,
@@ -52,6 +83,13 @@ bool mpcd::ATCollisionMethod::isAutotuningComplete()
  */
 void mpcd::ATCollisionMethod::rule(uint64_t timestep)
     {
+    if (useFused())
+        {
+        m_cl->compute(timestep);
+        collideFused(timestep);
+        return;
+        }
+
     m_thermo->compute(timestep);
 
     // compute the cell average of the random velocities
@@ -106,44 +144,44 @@ void mpcd::ATCollisionMethod::drawVelocities(uint64_t timestep)
 
     // random velocities are drawn for each particle and stored into the "alternate" arrays
     const Scalar T = (*m_T)(timestep);
-    for (unsigned int idx = 0; idx < N_tot; ++idx)
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    pool.parallelFor(
+        N_tot,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        unsigned int pidx;
-        unsigned int tag;
-        Scalar mass;
-        if (idx < N_mpcd)
-            {
-            pidx = idx;
-            mass = m_mpcd_pdata->getMass();
-            tag = h_tag.data[idx];
-            }
-        else
-            {
-            pidx = h_embed_idx->data[idx - N_mpcd];
-            mass = h_vel_embed->data[pidx].w;
-            tag = h_tag_embed->data[pidx];
-            }
+            for (unsigned int idx = begin; idx < end; ++idx)
+                {
+                unsigned int pidx;
+                unsigned int tag;
+                Scalar mass;
+                if (idx < N_mpcd)
+                    {
+                    pidx = idx;
+                    mass = m_mpcd_pdata->getMass();
+                    tag = h_tag.data[idx];
+                    }
+                else
+                    {
+                    pidx = h_embed_idx->data[idx - N_mpcd];
+                    mass = h_vel_embed->data[pidx].w;
+                    tag = h_tag_embed->data[pidx];
+                    }
 
-        // draw random velocities from normal distribution
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::ATCollisionMethod, timestep, seed),
-            hoomd::Counter(tag));
-        hoomd::NormalDistribution<Scalar> gen(fast::sqrt(T / mass), 0.0);
-        Scalar3 vel;
-        gen(vel.x, vel.y, rng);
-        vel.z = gen(rng);
-
-        // save out velocities
-        if (idx < N_mpcd)
-            {
-            h_alt_vel.data[pidx]
-                = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
-            }
-        else
-            {
-            h_alt_vel_embed->data[pidx] = make_scalar4(vel.x, vel.y, vel.z, mass);
-            }
-        }
+                // draw random velocities from normal distribution
+                const Scalar3 vel = mpcd::detail::drawRandomVelocity(timestep, seed, tag, mass, T);
+
+                // save out velocities
+                if (idx < N_mpcd)
+                    {
+                    h_alt_vel.data[pidx]
+                        = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+                    }
+                else
+                    {
+                    h_alt_vel_embed->data[pidx] = make_scalar4(vel.x, vel.y, vel.z, mass);
+                    }
+                }
+        });
     }
 
 void mpcd::ATCollisionMethod::applyVelocities()
@@ -187,42 +225,178 @@ void mpcd::ATCollisionMethod::applyVelocities()
                                     access_location::host,
                                     access_mode::read);
 
-    for (unsigned int idx = 0; idx < N_tot; ++idx)
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    pool.parallelFor(
+        N_tot,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        unsigned int cell, pidx;
-        Scalar4 vel_rand;
-        if (idx < N_mpcd)
-            {
-            pidx = idx;
-            const Scalar4 vel_cell = h_vel.data[idx];
-            cell = __scalar_as_int(vel_cell.w);
-            vel_rand = h_vel_alt.data[idx];
-            }
-        else
-            {
-            pidx = h_embed_idx->data[idx - N_mpcd];
-            cell = h_embed_cell_ids->data[idx - N_mpcd];
-            vel_rand = h_vel_alt_embed->data[pidx];
-            }
+            for (unsigned int idx = begin; idx < end; ++idx)
+                {
+                unsigned int cell, pidx;
+                Scalar4 vel_rand;
+                if (idx < N_mpcd)
+                    {
+                    pidx = idx;
+                    const Scalar4 vel_cell = h_vel.data[idx];
+                    cell = __scalar_as_int(vel_cell.w);
+                    vel_rand = h_vel_alt.data[idx];
+                    }
+                else
+                    {
+                    pidx = h_embed_idx->data[idx - N_mpcd];
+                    cell = h_embed_cell_ids->data[idx - N_mpcd];
+                    vel_rand = h_vel_alt_embed->data[pidx];
+                    }
 
-        // load cell data
-        const double4 v_c = h_cell_vel.data[cell];
-        const double4 vrand_c = h_rand_vel.data[cell];
+                // load cell data
+                const double4 v_c = h_cell_vel.data[cell];
+                const double4 vrand_c = h_rand_vel.data[cell];
 
-        // compute new velocity using the cell + the random draw
-        const Scalar3 vnew = make_scalar3(v_c.x - vrand_c.x + vel_rand.x,
-                                          v_c.y - vrand_c.y + vel_rand.y,
-                                          v_c.z - vrand_c.z + vel_rand.z);
+                // compute new velocity using the cell + the random draw
+                const Scalar3 vnew = make_scalar3(v_c.x - vrand_c.x + vel_rand.x,
+                                                  v_c.y - vrand_c.y + vel_rand.y,
+                                                  v_c.z - vrand_c.z + vel_rand.z);
 
-        if (idx < N_mpcd)
-            {
-            h_vel.data[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, __int_as_scalar(cell));
-            }
-        else
-            {
-            h_vel_embed->data[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, vel_rand.w);
-            }
+                if (idx < N_mpcd)
+                    {
+                    h_vel.data[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, __int_as_scalar(cell));
+                    }
+                else
+                    {
+                    h_vel_embed->data[pidx] = make_scalar4(vnew.x, vnew.y, vnew.z, vel_rand.w);
+                    }
+                }
+        });
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * The center-of-mass velocity of each cell and of the random velocities drawn for its particles
+ * are computed, and then applied to the particles in that cell, in one pass over the cell list.
+ * This replaces the two CellThermoCompute passes, drawVelocities(), and applyVelocities(), and
+ * gives the same result without storing the random velocities in the alternate arrays.
+ */
+void mpcd::ATCollisionMethod::collideFused(uint64_t timestep)
+    {
+    // cell list
+    const Index3D& ci = m_cl->getCellIndexer();
+    const Index2D& cli = m_cl->getCellListIndexer();
+    ArrayHandle<unsigned int> h_cell_list(m_cl->getCellList(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> h_cell_np(m_cl->getCellSizeArray(),
+                                        access_location::host,
+                                        access_mode::read);
+
+    // mpcd particle data
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    const Scalar mpcd_mass = m_mpcd_pdata->getMass();
+
+    // embedded particle data
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_idx;
+    std::unique_ptr<ArrayHandle<Scalar4>> h_vel_embed;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_tag_embed;
+    if (m_embed_group)
+        {
+        h_embed_idx.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                        access_location::host,
+                                                        access_mode::read));
+        h_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                   access_location::host,
+                                                   access_mode::readwrite));
+        h_tag_embed.reset(new ArrayHandle<unsigned int>(m_pdata->getTags(),
+                                                        access_location::host,
+                                                        access_mode::read));
         }
+
+    const uint16_t seed = m_sysdef->getSeed();
+    const Scalar T = (*m_T)(timestep);
+
+    // cells do not share particles, so they can be collided independently by the threads
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    pool.parallelFor(
+        ci.getNumElements(),
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+        {
+            // random velocities of the particles in the current cell
+            std::vector<Scalar3> rand_vel(m_cl->getNmax());
+
+            for (unsigned int cell = begin; cell < end; ++cell)
+                {
+                const unsigned int np = h_cell_np.data[cell];
+
+                // sum the momentum of the cell and of the random velocities
+                double4 momentum = make_double4(0.0, 0.0, 0.0, 0.0);
+                double3 rand_momentum = make_double3(0.0, 0.0, 0.0);
+                for (unsigned int offset = 0; offset < np; ++offset)
+                    {
+                    const unsigned int cur_p = h_cell_list.data[cli(offset, cell)];
+                    Scalar4 vel_i;
+                    Scalar mass_i;
+                    unsigned int tag_i;
+                    if (cur_p < N_mpcd)
+                        {
+                        vel_i = h_vel.data[cur_p];
+                        mass_i = mpcd_mass;
+                        tag_i = h_tag.data[cur_p];
+                        }
+                    else
+                        {
+                        const unsigned int pidx = h_embed_idx->data[cur_p - N_mpcd];
+                        vel_i = h_vel_embed->data[pidx];
+                        mass_i = vel_i.w;
+                        tag_i = h_tag_embed->data[pidx];
+                        }
+
+                    const Scalar3 vrand
+                        = mpcd::detail::drawRandomVelocity(timestep, seed, tag_i, mass_i, T);
+                    rand_vel[offset] = vrand;
+
+                    const double mass = mass_i;
+                    momentum.x += mass * vel_i.x;
+                    momentum.y += mass * vel_i.y;
+                    momentum.z += mass * vel_i.z;
+                    momentum.w += mass;
+                    rand_momentum.x += mass * vrand.x;
+                    rand_momentum.y += mass * vrand.y;
+                    rand_momentum.z += mass * vrand.z;
+                    }
+
+                // average velocity is only defined when there is some mass in the cell
+                double3 v_c = make_double3(0.0, 0.0, 0.0);
+                double3 vrand_c = make_double3(0.0, 0.0, 0.0);
+                if (momentum.w > 0.)
+                    {
+                    v_c = make_double3(momentum.x / momentum.w,
+                                       momentum.y / momentum.w,
+                                       momentum.z / momentum.w);
+                    vrand_c = make_double3(rand_momentum.x / momentum.w,
+                                           rand_momentum.y / momentum.w,
+                                           rand_momentum.z / momentum.w);
+                    }
+
+                // apply the random velocities
+                for (unsigned int offset = 0; offset < np; ++offset)
+                    {
+                    const unsigned int cur_p = h_cell_list.data[cli(offset, cell)];
+                    Scalar4& vel_i = (cur_p < N_mpcd)
+                                         ? h_vel.data[cur_p]
+                                         : h_vel_embed->data[h_embed_idx->data[cur_p - N_mpcd]];
+                    const Scalar3 vrand = rand_vel[offset];
+                    vel_i = make_scalar4(v_c.x - vrand_c.x + vrand.x,
+                                         v_c.y - vrand_c.y + vrand.y,
+                                         v_c.z - vrand_c.z + vrand.z,
+                                         vel_i.w);
+                    }
+                }
+        });
     }
 
 void mpcd::ATCollisionMethod::setCellList(std::shared_ptr<mpcd::CellList> cl)
@@ -69,6 +69,9 @@ class PYBIND11_EXPORT ATCollisionMethod : public mpcd::CollisionMethod
     //! Apply the random velocities to particles in each cell
     virtual void applyVelocities();
 
+    //! Compute the cell properties and apply the random velocities in one pass
+    void collideFused(uint64_t timestep);
+
     //! Attach callback signals
     void attachCallbacks();
 
@@ -15,6 +15,7 @@
 
 #include "StreamingMethod.h"
 #include <pybind11/pybind11.h>
+#include <vector>
 
 namespace hoomd
     {
@@ -37,7 +38,13 @@ namespace mpcd
  *  1. detectCollision(): Determines when and where a collision occurs. If one does, this method
  * moves the particle back, reflects its velocity, and gives the time still remaining to integrate.
  *  2. isOutside(): Determines whether a particles lies outside the Geometry.
+ *  3. isInsideBox(): Determines whether an axis-aligned box lies completely inside the Geometry.
  *
+ * The last method is used to skip collision detection for particles that are far from any
+ * boundary. The coverage box is divided into bins with the size of the MPCD cells, and a bin is
+ * marked as interior if it and all of its neighbors lie inside the Geometry. A particle in an
+ * interior bin that moves less than one bin width in each direction cannot reach a boundary, so it
+ * is streamed ballistically without calling detectCollision().
  */
 template<class Geometry, class Force>
 class PYBIND11_EXPORT BounceBackStreamingMethod : public mpcd::StreamingMethod
@@ -58,7 +65,9 @@ class PYBIND11_EXPORT BounceBackStreamingMethod : public mpcd::StreamingMethod
                               int phase,
                               std::shared_ptr<Geometry> geom,
                               std::shared_ptr<Force> force)
-        : mpcd::StreamingMethod(sysdef, cur_timestep, period, phase), m_geom(geom), m_force(force)
+        : mpcd::StreamingMethod(sysdef, cur_timestep, period, phase), m_geom(geom), m_force(force),
+          m_bin_geom(nullptr), m_bin_lo(make_scalar3(0, 0, 0)), m_bin_hi(make_scalar3(0, 0, 0)),
+          m_bin_dim(make_uint3(0, 0, 0))
         {
         }
 
@@ -95,6 +104,15 @@ class PYBIND11_EXPORT BounceBackStreamingMethod : public mpcd::StreamingMethod
     protected:
     std::shared_ptr<Geometry> m_geom; //!< Streaming geometry
     std::shared_ptr<Force> m_force;   //!< Solvent force
+
+    const Geometry* m_bin_geom;           //!< Geometry the bins were classified for
+    Scalar3 m_bin_lo;                     //!< Lower corner of the binned box
+    Scalar3 m_bin_hi;                     //!< Upper corner of the binned box
+    uint3 m_bin_dim;                      //!< Number of bins in each direction
+    std::vector<unsigned char> m_interior; //!< Flag for bins far from any boundary
+
+    //! Classify the bins that are far from any boundary
+    void classifyBins(const BoxDim& box, const uint3& dim);
     };
 
 /*!
@@ -112,6 +130,11 @@ void BounceBackStreamingMethod<Geometry, Force>::stream(uint64_t timestep)
         }
 
     const BoxDim box = m_cl->getCoverageBox();
+    const uint3 dim = m_cl->getDim();
+    classifyBins(box, dim);
+    const Scalar3 lo = box.getLo();
+    const Scalar3 L = box.getL();
+    const Scalar3 width = make_scalar3(L.x / dim.x, L.y / dim.y, L.z / dim.z);
 
     ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
                                access_location::host,
@@ -124,41 +147,109 @@ void BounceBackStreamingMethod<Geometry, Force>::stream(uint64_t timestep)
     // default construct a force if one is not set
     const Force force = (m_force) ? *m_force : Force();
 
-    for (unsigned int cur_p = 0; cur_p < m_mpcd_pdata->getN(); ++cur_p)
+    // particles stream independently, so split them over the threads
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+
+    pool.parallelFor(
+        m_mpcd_pdata->getN(),
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        const Scalar4 postype = h_pos.data[cur_p];
-        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-        const unsigned int type = __scalar_as_int(postype.w);
-
-        const Scalar4 vel_cell = h_vel.data[cur_p];
-        Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
-        // estimate next velocity based on current acceleration
-        vel += Scalar(0.5) * m_mpcd_dt * force.evaluate(pos) / mass;
-
-        // propagate the particle to its new position ballistically
-        Scalar dt_remain = m_mpcd_dt;
-        bool collide = true;
-        do
-            {
-            pos += dt_remain * vel;
-            collide = m_geom->detectCollision(pos, vel, dt_remain);
-            } while (dt_remain > 0 && collide);
-        // finalize velocity update
-        vel += Scalar(0.5) * m_mpcd_dt * force.evaluate(pos) / mass;
-
-        // wrap and update the position
-        int3 image = make_int3(0, 0, 0);
-        box.wrap(pos, image);
-
-        h_pos.data[cur_p] = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(type));
-        h_vel.data[cur_p]
-            = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
-        }
+            for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
+                {
+                const Scalar4 postype = h_pos.data[cur_p];
+                Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+                const unsigned int type = __scalar_as_int(postype.w);
+
+                const Scalar4 vel_cell = h_vel.data[cur_p];
+                Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+                // estimate next velocity based on current acceleration
+                vel += Scalar(0.5) * m_mpcd_dt * force.evaluate(pos) / mass;
+
+                // propagate the particle to its new position ballistically, skipping collision
+                // detection when it is too far from a boundary to reach one
+                const Scalar3 dr = m_mpcd_dt * vel;
+                const int3 bin = make_int3(int(slow::floor((pos.x - lo.x) / width.x)),
+                                           int(slow::floor((pos.y - lo.y) / width.y)),
+                                           int(slow::floor((pos.z - lo.z) / width.z)));
+                if (bin.x >= 0 && bin.x < int(m_bin_dim.x) && bin.y >= 0 && bin.y < int(m_bin_dim.y)
+                    && bin.z >= 0 && bin.z < int(m_bin_dim.z)
+                    && m_interior[(bin.z * m_bin_dim.y + bin.y) * m_bin_dim.x + bin.x]
+                    && fabs(dr.x) <= width.x && fabs(dr.y) <= width.y && fabs(dr.z) <= width.z)
+                    {
+                    pos += dr;
+                    }
+                else
+                    {
+                    Scalar dt_remain = m_mpcd_dt;
+                    bool collide = true;
+                    do
+                        {
+                        pos += dt_remain * vel;
+                        collide = m_geom->detectCollision(pos, vel, dt_remain);
+                        } while (dt_remain > 0 && collide);
+                    }
+                // finalize velocity update
+                vel += Scalar(0.5) * m_mpcd_dt * force.evaluate(pos) / mass;
+
+                // wrap and update the position
+                int3 image = make_int3(0, 0, 0);
+                box.wrap(pos, image);
+
+                h_pos.data[cur_p] = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(type));
+                h_vel.data[cur_p]
+                    = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+                }
+        });
 
     // particles have moved, so the cell cache is no longer valid
     m_mpcd_pdata->invalidateCellCache();
     }
 
+/*!
+ * \param box Box covered by the cell list
+ * \param dim Number of cells in each direction
+ *
+ * The bins match the cells of the cell list. A bin is interior if the box spanned by it and its
+ * neighbors lies completely inside the geometry. The classification is cached until the box, the
+ * cell dimensions, or the geometry change.
+ */
+template<class Geometry, class Force>
+void BounceBackStreamingMethod<Geometry, Force>::classifyBins(const BoxDim& box, const uint3& dim)
+    {
+    const Scalar3 lo = box.getLo();
+    const Scalar3 hi = box.getHi();
+    if (m_bin_geom == m_geom.get() && m_bin_dim.x == dim.x && m_bin_dim.y == dim.y
+        && m_bin_dim.z == dim.z && m_bin_lo.x == lo.x && m_bin_lo.y == lo.y && m_bin_lo.z == lo.z
+        && m_bin_hi.x == hi.x && m_bin_hi.y == hi.y && m_bin_hi.z == hi.z)
+        {
+        return;
+        }
+    m_bin_geom = m_geom.get();
+    m_bin_lo = lo;
+    m_bin_hi = hi;
+    m_bin_dim = dim;
+
+    const Scalar3 L = box.getL();
+    const Scalar3 width = make_scalar3(L.x / dim.x, L.y / dim.y, L.z / dim.z);
+    m_interior.resize(dim.x * dim.y * dim.z);
+    for (unsigned int k = 0; k < dim.z; ++k)
+        {
+        for (unsigned int j = 0; j < dim.y; ++j)
+            {
+            for (unsigned int i = 0; i < dim.x; ++i)
+                {
+                const Scalar3 bin_lo = make_scalar3(lo.x + (Scalar(i) - Scalar(1)) * width.x,
+                                                    lo.y + (Scalar(j) - Scalar(1)) * width.y,
+                                                    lo.z + (Scalar(k) - Scalar(1)) * width.z);
+                const Scalar3 bin_hi = make_scalar3(lo.x + (Scalar(i) + Scalar(2)) * width.x,
+                                                    lo.y + (Scalar(j) + Scalar(2)) * width.y,
+                                                    lo.z + (Scalar(k) + Scalar(2)) * width.z);
+                m_interior[(k * dim.y + j) * dim.x + i] = m_geom->isInsideBox(bin_lo, bin_hi);
+                }
+            }
+        }
+    }
+
 /*!
  * Checks each MPCD particle position to determine if it lies within the geometry. If any particle
  * is out of bounds, an error is raised.
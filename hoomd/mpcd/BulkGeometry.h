@@ -62,6 +62,17 @@ class __attribute__((visibility("default"))) BulkGeometry
         return false;
         }
 
+    //! Check if an axis-aligned box lies completely inside the geometry
+    /*!
+     * \param lo Lower corner of the box
+     * \param hi Upper corner of the box
+     * \returns True if no point in the box is out of bounds, and false if any point may be
+     */
+    HOSTDEVICE bool isInsideBox(const Scalar3& lo, const Scalar3& hi) const
+        {
+        return true;
+        }
+
 #ifndef __HIPCC__
     //! Get the unique name of this geometry
     static std::string getName()
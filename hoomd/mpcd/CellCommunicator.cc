@@ -37,6 +37,7 @@ mpcd::CellCommunicator::CellCommunicator(std::shared_ptr<SystemDefinition> sysde
                                               m_exec_conf,
                                               "mpcd_cell_comm_unpack_" + std::to_string(m_id)));
         m_autotuners.insert(m_autotuners.end(), {m_tuner_pack, m_tuner_unpack});
+        hipStreamCreate(&m_stream);
         }
 #endif // ENABLE_HIP
 
@@ -49,6 +50,12 @@ mpcd::CellCommunicator::~CellCommunicator()
     m_exec_conf->msg->notice(5) << "Destroying MPCD CellCommunicator" << std::endl;
     m_cl->getSizeChangeSignal()
         .disconnect<mpcd::CellCommunicator, &mpcd::CellCommunicator::slotInit>(this);
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        hipStreamDestroy(m_stream);
+        }
+#endif // ENABLE_HIP
     }
 
 namespace mpcd
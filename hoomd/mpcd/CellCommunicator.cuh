@@ -28,7 +28,8 @@ pack_cell_buffer(typename PackOpT::element* d_send_buf,
                  const unsigned int* d_send_idx,
                  const PackOpT op,
                  const unsigned int num_send,
-                 unsigned int block_size);
+                 unsigned int block_size,
+                 cudaStream_t stream);
 
 //! Kernel driver to unpack cell communication buffer
 template<typename T, class PackOpT>
@@ -41,7 +42,8 @@ unpack_cell_buffer(T* d_props,
                    const typename PackOpT::element* d_recv_buf,
                    const PackOpT op,
                    const unsigned int num_cells,
-                   const unsigned int block_size);
+                   const unsigned int block_size,
+                   cudaStream_t stream);
 
 #ifdef __HIPCC__
 
@@ -136,6 +138,7 @@ __global__ void unpack_cell_buffer(T* d_props,
  * \param op Pack operator
  * \param num_send Number of cells to pack
  * \param block_size Number of threads per block
+ * \param stream Stream to launch the kernel on
  *
  * \tparam T Type of data to pack (inferred)
  * \tparam PackOpT Pack operator type
@@ -150,7 +153,8 @@ cudaError_t pack_cell_buffer(typename PackOpT::element* d_send_buf,
                              const unsigned int* d_send_idx,
                              const PackOpT op,
                              const unsigned int num_send,
-                             unsigned int block_size)
+                             unsigned int block_size,
+                             cudaStream_t stream)
     {
     // determine runtime block size
     unsigned int max_block_size;
@@ -161,11 +165,11 @@ cudaError_t pack_cell_buffer(typename PackOpT::element* d_send_buf,
     const unsigned int run_block_size = min(block_size, max_block_size);
 
     dim3 grid(num_send / run_block_size + 1);
-    mpcd::gpu::kernel::pack_cell_buffer<<<grid, run_block_size>>>(d_send_buf,
-                                                                  d_props,
-                                                                  d_send_idx,
-                                                                  op,
-                                                                  num_send);
+    mpcd::gpu::kernel::pack_cell_buffer<<<grid, run_block_size, 0, stream>>>(d_send_buf,
+                                                                             d_props,
+                                                                             d_send_idx,
+                                                                             op,
+                                                                             num_send);
 
     return cudaSuccess;
     }
@@ -179,6 +183,8 @@ cudaError_t pack_cell_buffer(typename PackOpT::element* d_send_buf,
  * \param d_recv_buf Received buffer from neighbor ranks
  * \param op Packing operator
  * \param num_cells Number of cells to unpack
+ * \param block_size Number of threads per block
+ * \param stream Stream to launch the kernel on
  *
  * \tparam T Data type to unpack (inferred)
  * \tparam PackOpT Pack operation type (inferred)
@@ -196,7 +202,8 @@ cudaError_t unpack_cell_buffer(T* d_props,
                                const typename PackOpT::element* d_recv_buf,
                                const PackOpT op,
                                const unsigned int num_cells,
-                               const unsigned int block_size)
+                               const unsigned int block_size,
+                               cudaStream_t stream)
     {
     // determine runtime block size
     unsigned int max_block_size;
@@ -207,14 +214,14 @@ cudaError_t unpack_cell_buffer(T* d_props,
     const unsigned int run_block_size = min(block_size, max_block_size);
 
     dim3 grid(num_cells / run_block_size + 1);
-    mpcd::gpu::kernel::unpack_cell_buffer<<<grid, run_block_size>>>(d_props,
-                                                                    d_cells,
-                                                                    d_recv,
-                                                                    d_recv_begin,
-                                                                    d_recv_end,
-                                                                    d_recv_buf,
-                                                                    op,
-                                                                    num_cells);
+    mpcd::gpu::kernel::unpack_cell_buffer<<<grid, run_block_size, 0, stream>>>(d_props,
+                                                                               d_cells,
+                                                                               d_recv,
+                                                                               d_recv_begin,
+                                                                               d_recv_end,
+                                                                               d_recv_buf,
+                                                                               op,
+                                                                               num_cells);
 
     return cudaSuccess;
     }
@@ -137,6 +137,7 @@ class PYBIND11_EXPORT CellCommunicator : public Autotuned
 #ifdef ENABLE_HIP
     std::shared_ptr<Autotuner<1>> m_tuner_pack;   //!< Tuner for pack kernel
     std::shared_ptr<Autotuner<1>> m_tuner_unpack; //!< Tuner for unpack kernel
+    hipStream_t m_stream;                         //!< Stream for pack and unpack kernels
 
     //! Packs the property buffer on the GPU
     template<typename T, class PackOpT>
@@ -160,6 +161,9 @@ class PYBIND11_EXPORT CellCommunicator : public Autotuned
  * The data in \a props is packed into the send buffers, and nonblocking MPI
  * send / receive operations are initiated. If communication is already occurring,
  * the method returns immediately and no action is taken.
+ *
+ * On the GPU, the buffers are passed directly to MPI when GPU-aware MPI is enabled.
+ * Otherwise, they are staged through host memory.
  */
 template<typename T, class PackOpT>
 void mpcd::CellCommunicator::begin(const GPUArray<T>& props, const PackOpT op)
@@ -203,12 +207,22 @@ void mpcd::CellCommunicator::begin(const GPUArray<T>& props, const PackOpT op)
         // make the MPI calls
         {
         // determine whether to use CPU or GPU CUDA buffers
-        access_location::Enum mpi_loc;
+        access_location::Enum mpi_loc = access_location::host;
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled() && m_exec_conf->isGPUAwareMPIEnabled())
             {
-            mpi_loc = access_location::host;
+            mpi_loc = access_location::device;
             }
+#endif // ENABLE_HIP
 
         ArrayHandle<unsigned char> h_send_buf(m_send_buf, mpi_loc, access_mode::read);
+#ifdef ENABLE_HIP
+        // the packing kernel must complete before MPI reads the device buffer
+        if (mpi_loc == access_location::device)
+            {
+            hipStreamSynchronize(m_stream);
+            }
+#endif // ENABLE_HIP
         ArrayHandle<unsigned char> h_recv_buf(m_recv_buf, mpi_loc, access_mode::overwrite);
         typename PackOpT::element* send_buf
             = reinterpret_cast<typename PackOpT::element*>(h_send_buf.data);
@@ -361,6 +375,9 @@ void mpcd::CellCommunicator::unpackBuffer(const GPUArray<T>& props, const PackOp
  * a reduction or transformation of the data to be sent. See mpcd::detail::CellEnergyPackOp
  * for an example.
  *
+ * The kernel runs on a separate stream, which is created as a blocking stream so that it is
+ * ordered with respect to the kernels that compute \a props.
+ *
  * \post Communicated cells in \a props are packed into \a m_send_buf.
  */
 template<typename T, class PackOpT>
@@ -380,7 +397,8 @@ void mpcd::CellCommunicator::packBufferGPU(const GPUArray<T>& props, const PackO
                                 d_send_idx.data,
                                 op,
                                 (unsigned int)m_send_idx.getNumElements(),
-                                m_tuner_pack->getParam()[0]);
+                                m_tuner_pack->getParam()[0],
+                                m_stream);
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     m_tuner_pack->end();
@@ -423,7 +441,8 @@ void mpcd::CellCommunicator::unpackBufferGPU(const GPUArray<T>& props, const Pac
                                   recv_buf,
                                   op,
                                   m_num_cells,
-                                  m_tuner_unpack->getParam()[0]);
+                                  m_tuner_unpack->getParam()[0],
+                                  m_stream);
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     m_tuner_unpack->end();
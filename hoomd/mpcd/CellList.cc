@@ -21,7 +21,7 @@ mpcd::CellList::CellList(std::shared_ptr<SystemDefinition> sysdef, Scalar cell_s
     : Compute(sysdef), m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_cell_np_max(4),
       m_cell_np(m_exec_conf), m_cell_list(m_exec_conf), m_embed_cell_ids(m_exec_conf),
       m_conditions(m_exec_conf), m_needs_compute_dim(true), m_particles_sorted(false),
-      m_virtual_change(false)
+      m_virtual_change(false), m_can_update(false), m_update_N(0), m_update_Nembed(0)
     {
     assert(m_mpcd_pdata);
     m_exec_conf->msg->notice(5) << "Constructing MPCD CellList" << std::endl;
@@ -32,6 +32,7 @@ mpcd::CellList::CellList(std::shared_ptr<SystemDefinition> sysdef, Scalar cell_s
 
     m_enable_grid_shift = shift;
     m_grid_shift = make_scalar3(0.0, 0.0, 0.0);
+    m_update_grid_shift = m_grid_shift;
 
     resetConditions();
 
@@ -54,7 +55,7 @@ mpcd::CellList::CellList(std::shared_ptr<SystemDefinition> sysdef,
     : Compute(sysdef), m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_cell_np_max(4),
       m_cell_np(m_exec_conf), m_cell_list(m_exec_conf), m_embed_cell_ids(m_exec_conf),
       m_conditions(m_exec_conf), m_needs_compute_dim(true), m_particles_sorted(false),
-      m_virtual_change(false)
+      m_virtual_change(false), m_can_update(false), m_update_N(0), m_update_Nembed(0)
     {
     assert(m_mpcd_pdata);
     m_exec_conf->msg->notice(5) << "Constructing MPCD CellList" << std::endl;
@@ -65,6 +66,7 @@ mpcd::CellList::CellList(std::shared_ptr<SystemDefinition> sysdef,
 
     m_enable_grid_shift = shift;
     m_grid_shift = make_scalar3(0.0, 0.0, 0.0);
+    m_update_grid_shift = m_grid_shift;
 
     resetConditions();
 
@@ -99,8 +101,10 @@ void mpcd::CellList::compute(uint64_t timestep)
         {
         m_virtual_change = false;
         m_force_compute = true;
+        m_can_update = false;
         }
 
+    // the embedded particles are binned again, but the last cell list can still be updated
     if (m_particles_sorted)
         {
         m_particles_sorted = false;
@@ -111,6 +115,7 @@ void mpcd::CellList::compute(uint64_t timestep)
         {
         computeDimensions();
         m_force_compute = true;
+        m_can_update = false;
         }
 
     if (peekCompute(timestep))
@@ -169,6 +174,7 @@ void mpcd::CellList::reallocate()
                                 << std::endl;
     m_cell_list_indexer = Index2D(m_cell_np_max, m_cell_indexer.getNumElements());
     m_cell_list.resize(m_cell_list_indexer.getNumElements());
+    m_can_update = false;
     }
 
 void mpcd::CellList::computeDimensions()
@@ -349,6 +355,10 @@ bool mpcd::CellList::isCommunicating(mpcd::detail::face dir)
  */
 void mpcd::CellList::buildCellList()
     {
+    // particles move little between collisions, so try to reuse the last cell list first
+    if (m_can_update && updateCellList())
+        return;
+
     const BoxDim& box = m_pdata->getBox();
     const uchar3 periodic = box.getPeriodic();
 
@@ -388,22 +398,12 @@ void mpcd::CellList::buildCellList()
         N_tot += m_embed_group->getNumMembers();
         }
 
-    // total effective number of cells in the global box, optionally padded by
-    // extra cells in MPI simulations
-    uint3 n_global_cells = m_global_cell_dim;
-#ifdef ENABLE_MPI
-    if (isCommunicating(mpcd::detail::face::east))
-        n_global_cells.x += 2 * m_num_extra;
-    if (isCommunicating(mpcd::detail::face::north))
-        n_global_cells.y += 2 * m_num_extra;
-    if (isCommunicating(mpcd::detail::face::up))
-        n_global_cells.z += 2 * m_num_extra;
-#endif // ENABLE_MPI
-
+    const uint3 n_global_cells = getPaddedGlobalDim();
     const BoxDim& global_box = m_pdata->getGlobalBox();
 
-    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
-        {
+    // find the cell of a particle and stash it with the particle, or return NO_CELL on error
+    auto find_bin = [&](unsigned int cur_p, uint3& conditions)
+    {
         Scalar4 postype_i;
         if (cur_p < N_mpcd)
             {
@@ -418,103 +418,372 @@ void mpcd::CellList::buildCellList()
         if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
             {
             conditions.y = cur_p + 1;
-            continue;
+            return mpcd::detail::NO_CELL;
             }
 
         // bin particle
-        const Scalar3 fractional_pos_i = global_box.makeFraction(pos_i) - m_grid_shift;
-        int3 global_bin = make_int3((int)std::floor(fractional_pos_i.x * m_global_cell_dim.x),
-                                    (int)std::floor(fractional_pos_i.y * m_global_cell_dim.y),
-                                    (int)std::floor(fractional_pos_i.z * m_global_cell_dim.z));
-
-        // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
-        // this is done using periodic from the "local" box, since this will be periodic
-        // only when there is one rank along the dimension
-        if (periodic.x)
+        const int3 bin = binParticle(pos_i, global_box, n_global_cells, periodic);
+
+        // validate and make sure no particles blew out of the box
+        if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x) || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
+            || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
             {
-            if (global_bin.x == (int)n_global_cells.x)
-                global_bin.x = 0;
-            else if (global_bin.x == -1)
-                global_bin.x = n_global_cells.x - 1;
+            conditions.z = cur_p + 1;
+            return mpcd::detail::NO_CELL;
             }
-        if (periodic.y)
+
+        const unsigned int bin_idx = m_cell_indexer(bin.x, bin.y, bin.z);
+
+        // stash the current particle bin into the velocity array
+        if (cur_p < N_mpcd)
             {
-            if (global_bin.y == (int)n_global_cells.y)
-                global_bin.y = 0;
-            else if (global_bin.y == -1)
-                global_bin.y = n_global_cells.y - 1;
+            h_vel.data[cur_p].w = __int_as_scalar(bin_idx);
             }
-        if (periodic.z)
+        else
             {
-            if (global_bin.z == (int)n_global_cells.z)
-                global_bin.z = 0;
-            else if (global_bin.z == -1)
-                global_bin.z = n_global_cells.z - 1;
+            h_embed_cell_ids->data[cur_p - N_mpcd] = bin_idx;
             }
+        return bin_idx;
+    };
 
-        // compute the local cell
-        int3 bin = make_int3(global_bin.x - m_origin_idx.x,
-                             global_bin.y - m_origin_idx.y,
-                             global_bin.z - m_origin_idx.z);
-        // these checks guard against round-off errors with domain decomposition
-        if (!periodic.x)
+    // store particle cur_p in slot offset of its bin
+    auto store
+        = [&](unsigned int cur_p, unsigned int bin_idx, unsigned int offset, uint3& conditions)
+    {
+        if (offset < m_cell_np_max)
             {
-            if (bin.x == -1)
-                bin.x = 0;
-            else if (bin.x == (int)m_cell_dim.x)
-                bin.x = m_cell_dim.x - 1;
+            h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
             }
-        if (!periodic.y)
+        else
             {
-            if (bin.y == -1)
-                bin.y = 0;
-            else if (bin.y == (int)m_cell_dim.y)
-                bin.y = m_cell_dim.y - 1;
+            // overflow
+            conditions.x = std::max(conditions.x, offset + 1);
             }
-        if (!periodic.z)
+    };
+
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    const unsigned int n_threads = pool.getNumThreads();
+    const unsigned int n_cells = m_cell_indexer.getNumElements();
+
+    if (n_threads == 1)
+        {
+        for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
             {
-            if (bin.z == -1)
-                bin.z = 0;
-            else if (bin.z == (int)m_cell_dim.z)
-                bin.z = m_cell_dim.z - 1;
-            }
+            const unsigned int bin_idx = find_bin(cur_p, conditions);
+            if (bin_idx == mpcd::detail::NO_CELL)
+                continue;
 
-        // validate and make sure no particles blew out of the box
-        if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x) || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
-            || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
+            store(cur_p, bin_idx, h_cell_np.data[bin_idx], conditions);
+
+            // increment the counter always
+            ++h_cell_np.data[bin_idx];
+            }
+        }
+    else
+        {
+        m_particle_bin.resize(N_tot);
+        m_thread_cell_np.resize(size_t(n_threads) * n_cells);
+        std::vector<uint3> thread_conditions(n_threads, make_uint3(0, 0, 0));
+
+        // count the particles each thread adds to each cell
+        pool.parallelFor(
+            N_tot,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
             {
-            conditions.z = cur_p + 1;
-            continue;
+                unsigned int* cell_np = m_thread_cell_np.data() + size_t(thread_id) * n_cells;
+                memset(cell_np, 0, sizeof(unsigned int) * n_cells);
+                for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
+                    {
+                    const unsigned int bin_idx = find_bin(cur_p, thread_conditions[thread_id]);
+                    m_particle_bin[cur_p] = bin_idx;
+                    if (bin_idx != mpcd::detail::NO_CELL)
+                        ++cell_np[bin_idx];
+                    }
+            });
+
+        // replace the counts with each thread's first slot in the cell
+        pool.parallelFor(
+            n_cells,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+            {
+                for (unsigned int cell = begin; cell < end; ++cell)
+                    {
+                    unsigned int offset = 0;
+                    for (unsigned int t = 0; t < n_threads; ++t)
+                        {
+                        unsigned int& count = m_thread_cell_np[size_t(t) * n_cells + cell];
+                        const unsigned int thread_count = count;
+                        count = offset;
+                        offset += thread_count;
+                        }
+                    h_cell_np.data[cell] = offset;
+                    }
+            });
+
+        pool.parallelFor(
+            N_tot,
+            [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+            {
+                unsigned int* offset = m_thread_cell_np.data() + size_t(thread_id) * n_cells;
+                for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
+                    {
+                    const unsigned int bin_idx = m_particle_bin[cur_p];
+                    if (bin_idx != mpcd::detail::NO_CELL)
+                        store(cur_p, bin_idx, offset[bin_idx]++, thread_conditions[thread_id]);
+                    }
+            });
+
+        // the serial loop keeps the largest overflow and the last particle index in error
+        for (const uint3& c : thread_conditions)
+            {
+            conditions.x = std::max(conditions.x, c.x);
+            conditions.y = std::max(conditions.y, c.y);
+            conditions.z = std::max(conditions.z, c.z);
             }
+        }
 
-        unsigned int bin_idx = m_cell_indexer(bin.x, bin.y, bin.z);
-        unsigned int offset = h_cell_np.data[bin_idx];
-        if (offset < m_cell_np_max)
+    // write out the conditions
+    m_conditions.resetFlags(conditions);
+
+    // a complete cell list can be updated at the next compute
+    m_can_update = (conditions.x == 0 && conditions.y == 0 && conditions.z == 0
+                    && m_mpcd_pdata->getNVirtual() == 0);
+    m_update_grid_shift = m_grid_shift;
+    m_update_N = N_mpcd;
+    m_update_Nembed = N_tot - N_mpcd;
+    }
+
+/*!
+ * \returns True if the cell list was updated, false if it must be built from scratch
+ *
+ * The cells of all particles are compared to the cells cached by the last build. Only the
+ * particles that changed cells are removed from their old cell and appended to their new one, so
+ * the cost of writing the cell list scales with the number of particles that crossed cell
+ * boundaries. The order of particles within a cell is not preserved.
+ *
+ * The cell list entries and cached cells of the embedded particles belong to their position in the
+ * group index list rather than to a particle, so a sort of the embedded particles only moves the
+ * entries of the positions that now hold a particle in another cell.
+ *
+ * The update is skipped when the cached cells may be stale (the particles were reordered without
+ * a mapping, the number of particles changed, or virtual particles are present) and when the grid
+ * shift changed, since most particles will then change cells. It is also abandoned if too many
+ * particles moved, or if any particle is invalid or overflows its new cell, so that
+ * buildCellList() can report or handle those conditions.
+ */
+bool mpcd::CellList::updateCellList()
+    {
+    const unsigned int N_mpcd = m_mpcd_pdata->getN();
+    const unsigned int N_embed = (m_embed_group) ? m_embed_group->getNumMembers() : 0;
+    if (!m_mpcd_pdata->checkCellCache() || m_mpcd_pdata->getNVirtual() > 0 || N_mpcd != m_update_N
+        || N_embed != m_update_Nembed || m_grid_shift.x != m_update_grid_shift.x
+        || m_grid_shift.y != m_update_grid_shift.y || m_grid_shift.z != m_update_grid_shift.z)
+        {
+        return false;
+        }
+
+    // building from scratch is cheaper once a large fraction of particles needs to move
+    const unsigned int N_tot = N_mpcd + N_embed;
+    const unsigned int max_moved = N_tot / 4;
+    m_moved.clear();
+
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_cell_ids;
+    if (m_embed_group)
+        {
+        h_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_embed_cell_ids,
+                                                             access_location::host,
+                                                             access_mode::readwrite));
+        }
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        std::unique_ptr<ArrayHandle<Scalar4>> h_pos_embed;
+        std::unique_ptr<ArrayHandle<unsigned int>> h_embed_member_idx;
+        if (m_embed_group)
             {
-            h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
+            h_pos_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getPositions(),
+                                                       access_location::host,
+                                                       access_mode::read));
+            h_embed_member_idx.reset(
+                new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                              access_location::host,
+                                              access_mode::read));
             }
-        else
+
+        const uchar3 periodic = m_pdata->getBox().getPeriodic();
+        const uint3 n_global_cells = getPaddedGlobalDim();
+        const BoxDim& global_box = m_pdata->getGlobalBox();
+
+        for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
             {
-            // overflow
-            conditions.x = std::max(conditions.x, offset + 1);
+            Scalar4 postype_i;
+            unsigned int old_bin;
+            if (cur_p < N_mpcd)
+                {
+                postype_i = h_pos.data[cur_p];
+                old_bin = __scalar_as_int(h_vel.data[cur_p].w);
+                }
+            else
+                {
+                postype_i = h_pos_embed->data[h_embed_member_idx->data[cur_p - N_mpcd]];
+                old_bin = h_embed_cell_ids->data[cur_p - N_mpcd];
+                }
+            const Scalar3 pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+            if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
+                return false;
+
+            const int3 bin = binParticle(pos_i, global_box, n_global_cells, periodic);
+            if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x)
+                || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
+                || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
+                return false;
+
+            const unsigned int bin_idx = m_cell_indexer(bin.x, bin.y, bin.z);
+            if (bin_idx != old_bin)
+                {
+                if (m_moved.size() >= max_moved)
+                    return false;
+                m_moved.push_back(make_uint3(cur_p, old_bin, bin_idx));
+                }
             }
+        }
 
-        // stash the current particle bin into the velocity array
-        if (cur_p < N_mpcd)
+    ArrayHandle<unsigned int> h_cell_list(m_cell_list,
+                                          access_location::host,
+                                          access_mode::readwrite);
+    ArrayHandle<unsigned int> h_cell_np(m_cell_np, access_location::host, access_mode::readwrite);
+
+    // take the moved particles out of their old cells, filling the hole with the last particle
+    for (const uint3& move : m_moved)
+        {
+        const unsigned int np = h_cell_np.data[move.y];
+        unsigned int offset = 0;
+        while (offset < np && h_cell_list.data[m_cell_list_indexer(offset, move.y)] != move.x)
+            ++offset;
+        if (offset == np)
+            return false;
+
+        h_cell_list.data[m_cell_list_indexer(offset, move.y)]
+            = h_cell_list.data[m_cell_list_indexer(np - 1, move.y)];
+        h_cell_np.data[move.y] = np - 1;
+        }
+
+    // then append them to their new cells
+    for (const uint3& move : m_moved)
+        {
+        const unsigned int offset = h_cell_np.data[move.z];
+        if (offset >= m_cell_np_max)
+            return false;
+
+        h_cell_list.data[m_cell_list_indexer(offset, move.z)] = move.x;
+        h_cell_np.data[move.z] = offset + 1;
+        if (move.x < N_mpcd)
             {
-            h_vel.data[cur_p].w = __int_as_scalar(bin_idx);
+            h_vel.data[move.x].w = __int_as_scalar(move.z);
             }
         else
             {
-            h_embed_cell_ids->data[cur_p - N_mpcd] = bin_idx;
+            h_embed_cell_ids->data[move.x - N_mpcd] = move.z;
             }
+        }
 
-        // increment the counter always
-        ++h_cell_np.data[bin_idx];
+    m_conditions.resetFlags(make_uint3(0, 0, 0));
+    return true;
+    }
+
+/*!
+ * \param pos Particle position
+ * \param global_box Global simulation box
+ * \param n_global_cells Number of cells in the padded global box
+ * \param periodic Periodic flags of the local box
+ * \returns Local cell of the particle, which may be out of range if the particle left the box
+ */
+int3 mpcd::CellList::binParticle(const Scalar3& pos,
+                                 const BoxDim& global_box,
+                                 const uint3& n_global_cells,
+                                 const uchar3& periodic) const
+    {
+    const Scalar3 fractional_pos = global_box.makeFraction(pos) - m_grid_shift;
+    int3 global_bin = make_int3((int)std::floor(fractional_pos.x * m_global_cell_dim.x),
+                                (int)std::floor(fractional_pos.y * m_global_cell_dim.y),
+                                (int)std::floor(fractional_pos.z * m_global_cell_dim.z));
+
+    // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
+    // this is done using periodic from the "local" box, since this will be periodic
+    // only when there is one rank along the dimension
+    if (periodic.x)
+        {
+        if (global_bin.x == (int)n_global_cells.x)
+            global_bin.x = 0;
+        else if (global_bin.x == -1)
+            global_bin.x = n_global_cells.x - 1;
+        }
+    if (periodic.y)
+        {
+        if (global_bin.y == (int)n_global_cells.y)
+            global_bin.y = 0;
+        else if (global_bin.y == -1)
+            global_bin.y = n_global_cells.y - 1;
+        }
+    if (periodic.z)
+        {
+        if (global_bin.z == (int)n_global_cells.z)
+            global_bin.z = 0;
+        else if (global_bin.z == -1)
+            global_bin.z = n_global_cells.z - 1;
         }
 
-    // write out the conditions
-    m_conditions.resetFlags(conditions);
+    // compute the local cell
+    int3 bin = make_int3(global_bin.x - m_origin_idx.x,
+                         global_bin.y - m_origin_idx.y,
+                         global_bin.z - m_origin_idx.z);
+    // these checks guard against round-off errors with domain decomposition
+    if (!periodic.x)
+        {
+        if (bin.x == -1)
+            bin.x = 0;
+        else if (bin.x == (int)m_cell_dim.x)
+            bin.x = m_cell_dim.x - 1;
+        }
+    if (!periodic.y)
+        {
+        if (bin.y == -1)
+            bin.y = 0;
+        else if (bin.y == (int)m_cell_dim.y)
+            bin.y = m_cell_dim.y - 1;
+        }
+    if (!periodic.z)
+        {
+        if (bin.z == -1)
+            bin.z = 0;
+        else if (bin.z == (int)m_cell_dim.z)
+            bin.z = m_cell_dim.z - 1;
+        }
+
+    return bin;
+    }
+
+/*!
+ * \returns Total effective number of cells in the global box, optionally padded by extra cells in
+ *          MPI simulations
+ */
+uint3 mpcd::CellList::getPaddedGlobalDim()
+    {
+    uint3 n_global_cells = m_global_cell_dim;
+#ifdef ENABLE_MPI
+    if (isCommunicating(mpcd::detail::face::east))
+        n_global_cells.x += 2 * m_num_extra;
+    if (isCommunicating(mpcd::detail::face::north))
+        n_global_cells.y += 2 * m_num_extra;
+    if (isCommunicating(mpcd::detail::face::up))
+        n_global_cells.z += 2 * m_num_extra;
+#endif // ENABLE_MPI
+    return n_global_cells;
     }
 
 /*!
@@ -526,8 +795,9 @@ void mpcd::CellList::sort(uint64_t timestep,
                           const GPUArray<unsigned int>& order,
                           const GPUArray<unsigned int>& rorder)
     {
-    // no need to do any sorting if we can still be called at the current timestep
-    if (peekCompute(timestep))
+    // no need to do any sorting if we can still be called at the current timestep, unless the
+    // sorted cell list is going to be updated rather than rebuilt
+    if (peekCompute(timestep) && !m_can_update)
         return;
 
     // if mapping is not valid, signal that we need to force a recompute next time
@@ -536,6 +806,7 @@ void mpcd::CellList::sort(uint64_t timestep,
     if (rorder.isNull())
         {
         m_force_compute = true;
+        m_can_update = false;
         return;
         }
 
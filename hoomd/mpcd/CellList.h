@@ -24,6 +24,7 @@
 #include <pybind11/pybind11.h>
 
 #include <array>
+#include <vector>
 
 namespace hoomd
     {
@@ -224,6 +225,7 @@ class PYBIND11_EXPORT CellList : public Compute
             {
             m_embed_group = embed_group;
             m_force_compute = true;
+            m_can_update = false;
             }
         }
 
@@ -286,6 +288,18 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Builds the cell list and handles cell list memory
     virtual void buildCellList();
 
+    //! Updates the previous cell list by moving only the particles that changed cells
+    bool updateCellList();
+
+    //! Compute the local cell that a position lies in
+    int3 binParticle(const Scalar3& pos,
+                     const BoxDim& global_box,
+                     const uint3& n_global_cells,
+                     const uchar3& periodic) const;
+
+    //! Get the number of cells in the global box, padded by any extra communication cells
+    uint3 getPaddedGlobalDim();
+
     //! Callback to sort cell list when particle data is sorted
     virtual void sort(uint64_t timestep,
                       const GPUArray<unsigned int>& order,
@@ -310,7 +324,9 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Slot for particle sorting
     void slotSorted()
         {
-        m_particles_sorted = true;
+        // the order of the MD particles only matters to the embedded particles
+        if (m_embed_group)
+            m_particles_sorted = true;
         }
 
     bool m_virtual_change; //!< True if the number of virtual particles has changed
@@ -323,6 +339,15 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Update global simulation box and check that cell list is compatible with it
     void updateGlobalBox();
 
+    bool m_can_update;            //!< True if the last cell list can be updated in place
+    Scalar3 m_update_grid_shift;  //!< Grid shift of the last cell list
+    unsigned int m_update_N;      //!< Number of MPCD particles in the last cell list
+    unsigned int m_update_Nembed; //!< Number of embedded particles in the last cell list
+    std::vector<uint3> m_moved;   //!< Particles that changed cells (index, old cell, new cell)
+
+    std::vector<unsigned int> m_particle_bin;   //!< Cell of each particle (threaded binning)
+    std::vector<unsigned int> m_thread_cell_np; //!< Per thread cell counts (threaded binning)
+
 #ifdef ENABLE_MPI
     std::shared_ptr<DomainDecomposition> m_decomposition;
 #endif // ENABLE_MPI
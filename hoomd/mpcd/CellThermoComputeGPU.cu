@@ -768,7 +768,8 @@ pack_cell_buffer(typename mpcd::detail::CellVelocityPackOp::element* d_send_buf,
                  const unsigned int* d_send_idx,
                  const mpcd::detail::CellVelocityPackOp op,
                  const unsigned int num_send,
-                 unsigned int block_size);
+                 unsigned int block_size,
+                 cudaStream_t stream);
 
 //! Explicit template instantiation of pack for cell energy
 template cudaError_t __attribute__((visibility("default")))
@@ -777,7 +778,8 @@ pack_cell_buffer(typename mpcd::detail::CellEnergyPackOp::element* d_send_buf,
                  const unsigned int* d_send_idx,
                  const mpcd::detail::CellEnergyPackOp op,
                  const unsigned int num_send,
-                 unsigned int block_size);
+                 unsigned int block_size,
+                 cudaStream_t stream);
 
 //! Explicit template instantiation of unpack for cell velocity
 template cudaError_t __attribute__((visibility("default")))
@@ -789,7 +791,8 @@ unpack_cell_buffer(double4* d_props,
                    const typename mpcd::detail::CellVelocityPackOp::element* d_recv_buf,
                    const mpcd::detail::CellVelocityPackOp op,
                    const unsigned int num_cells,
-                   const unsigned int block_size);
+                   const unsigned int block_size,
+                   cudaStream_t stream);
 
 //! Explicit template instantiation of unpack for cell energy
 template cudaError_t __attribute__((visibility("default")))
@@ -801,7 +804,8 @@ unpack_cell_buffer(double3* d_props,
                    const typename mpcd::detail::CellEnergyPackOp::element* d_recv_buf,
                    const mpcd::detail::CellEnergyPackOp op,
                    const unsigned int num_cells,
-                   const unsigned int block_size);
+                   const unsigned int block_size,
+                   cudaStream_t stream);
 
     } // end namespace gpu
     } // end namespace mpcd
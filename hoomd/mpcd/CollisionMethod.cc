@@ -23,7 +23,7 @@ mpcd::CollisionMethod::CollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
                                        int phase)
     : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()),
       m_mpcd_pdata(sysdef->getMPCDParticleData()), m_exec_conf(m_pdata->getExecConf()),
-      m_period(period)
+      m_period(period), m_fused(false)
     {
     // setup next timestep for collision
     m_next_timestep = cur_timestep;
@@ -127,6 +127,25 @@ bool mpcd::CollisionMethod::shouldCollide(uint64_t timestep)
         }
     }
 
+/*!
+ * \returns True if the fused collision was requested and can be used
+ *
+ * The fused collision computes the cell properties in the same pass over the cell list that
+ * applies the collision rule. It is only implemented on the CPU, and it is not used when cells are
+ * shared with other ranks because the properties of those cells are only complete after
+ * communication.
+ */
+bool mpcd::CollisionMethod::useFused() const
+    {
+    if (!m_fused || m_exec_conf->isCUDAEnabled())
+        return false;
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        return false;
+#endif // ENABLE_MPI
+    return true;
+    }
+
 namespace mpcd
     {
 namespace detail
@@ -148,6 +167,7 @@ void export_CollisionMethod(pybind11::module& m)
                                                   : std::shared_ptr<hoomd::ParticleFilter>();
                                })
         .def("setEmbeddedGroup", &mpcd::CollisionMethod::setEmbeddedGroup)
+        .def_property("fused", &mpcd::CollisionMethod::getFused, &mpcd::CollisionMethod::setFused)
         .def_property_readonly("period", &mpcd::CollisionMethod::getPeriod);
     }
     } // namespace detail
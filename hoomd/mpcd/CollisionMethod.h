@@ -91,6 +91,21 @@ class PYBIND11_EXPORT CollisionMethod : public Autotuned
             }
         }
 
+    //! Get whether the cell properties and collision are computed in one pass
+    bool getFused() const
+        {
+        return m_fused;
+        }
+
+    //! Set whether the cell properties and collision are computed in one pass
+    /*!
+     * \param fused If true, use the fused collision when it is supported
+     */
+    void setFused(bool fused)
+        {
+        m_fused = fused;
+        }
+
     protected:
     std::shared_ptr<SystemDefinition> m_sysdef;                //!< HOOMD system definition
     std::shared_ptr<hoomd::ParticleData> m_pdata;              //!< HOOMD particle data
@@ -102,10 +117,14 @@ class PYBIND11_EXPORT CollisionMethod : public Autotuned
 
     uint64_t m_period;        //!< Number of timesteps between collisions
     uint64_t m_next_timestep; //!< Timestep next collision should be performed
+    bool m_fused;             //!< If true, compute cell properties and collide in one pass
 
     //! Check if a collision should occur and advance the timestep counter
     virtual bool shouldCollide(uint64_t timestep);
 
+    //! Check if the fused collision should be used
+    bool useFused() const;
+
     //! Call the collision rule
     virtual void rule(uint64_t timestep) { }
     };
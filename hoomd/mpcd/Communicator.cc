@@ -299,50 +299,24 @@ void mpcd::Communicator::migrateParticles(uint64_t timestep)
                 }
             }
 
-        // communicate size of the message that will contain the particle data
-        unsigned int n_recv_left, n_recv_right;
-        if (left_neigh != right_neigh)
-            {
-            m_reqs.resize(4);
-            MPI_Isend(&n_send_right, 1, MPI_UNSIGNED, right_neigh, 0, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(&n_recv_right, 1, MPI_UNSIGNED, right_neigh, 0, m_mpi_comm, &m_reqs[1]);
-            MPI_Isend(&n_send_left, 1, MPI_UNSIGNED, left_neigh, 0, m_mpi_comm, &m_reqs[2]);
-            MPI_Irecv(&n_recv_left, 1, MPI_UNSIGNED, left_neigh, 0, m_mpi_comm, &m_reqs[3]);
-            MPI_Waitall(4, m_reqs.data(), MPI_STATUSES_IGNORE);
-            }
-        else
-            {
-            // send right, receive left (same thing, really) only if neighbors match
-            n_recv_right = 0;
-            m_reqs.resize(2);
-            MPI_Isend(&n_send_right, 1, MPI_UNSIGNED, right_neigh, 0, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(&n_recv_left, 1, MPI_UNSIGNED, left_neigh, 0, m_mpi_comm, &m_reqs[1]);
-            MPI_Waitall(2, m_reqs.data(), MPI_STATUSES_IGNORE);
-            }
-
         // exchange particle data
-        m_recvbuf.resize(n_recv + n_recv_left + n_recv_right);
             {
+            // send particle data, which is always done (even if empty) so that the receiving rank
+            // can size its buffer by probing for the message instead of exchanging sizes first
             ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
                                                                access_location::host,
                                                                access_mode::read);
-            ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
-                                                               access_location::host,
-                                                               access_mode::overwrite);
+            const MPI_Datatype mpi_pdata_element = m_mpcd_pdata->getElementMPIDatatype();
             m_reqs.resize(4);
             int nreq = 0;
-            const MPI_Datatype mpi_pdata_element = m_mpcd_pdata->getElementMPIDatatype();
-            if (n_send_right != 0)
-                {
-                MPI_Isend(h_sendbuf.data + n_keep,
-                          n_send_right,
-                          mpi_pdata_element,
-                          right_neigh,
-                          1,
-                          m_mpi_comm,
-                          &m_reqs[nreq++]);
-                }
-            if (n_send_left != 0)
+            MPI_Isend(h_sendbuf.data + n_keep,
+                      n_send_right,
+                      mpi_pdata_element,
+                      right_neigh,
+                      1,
+                      m_mpi_comm,
+                      &m_reqs[nreq++]);
+            if (left_neigh != right_neigh)
                 {
                 MPI_Isend(h_sendbuf.data + n_keep + n_send_right,
                           n_send_left,
@@ -352,18 +326,34 @@ void mpcd::Communicator::migrateParticles(uint64_t timestep)
                           m_mpi_comm,
                           &m_reqs[nreq++]);
                 }
-            if (n_recv_right != 0)
+
+            // probe the size of the incoming messages
+            int n_recv_left = 0, n_recv_right = 0;
+            MPI_Status status;
+            if (left_neigh != right_neigh)
                 {
-                MPI_Irecv(h_recvbuf.data + n_recv,
-                          n_recv_right,
-                          mpi_pdata_element,
-                          right_neigh,
-                          1,
-                          m_mpi_comm,
-                          &m_reqs[nreq++]);
+                MPI_Probe(right_neigh, 1, m_mpi_comm, &status);
+                MPI_Get_count(&status, mpi_pdata_element, &n_recv_right);
                 }
-            if (n_recv_left != 0)
+            MPI_Probe(left_neigh, 1, m_mpi_comm, &status);
+            MPI_Get_count(&status, mpi_pdata_element, &n_recv_left);
+
+            // receive particle data
+            m_recvbuf.resize(n_recv + n_recv_left + n_recv_right);
                 {
+                ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
+                                                                   access_location::host,
+                                                                   access_mode::overwrite);
+                if (left_neigh != right_neigh)
+                    {
+                    MPI_Irecv(h_recvbuf.data + n_recv,
+                              n_recv_right,
+                              mpi_pdata_element,
+                              right_neigh,
+                              1,
+                              m_mpi_comm,
+                              &m_reqs[nreq++]);
+                    }
                 MPI_Irecv(h_recvbuf.data + n_recv + n_recv_right,
                           n_recv_left,
                           mpi_pdata_element,
@@ -371,8 +361,8 @@ void mpcd::Communicator::migrateParticles(uint64_t timestep)
                           1,
                           m_mpi_comm,
                           &m_reqs[nreq++]);
+                MPI_Waitall(nreq, m_reqs.data(), MPI_STATUSES_IGNORE);
                 }
-            MPI_Waitall(nreq, m_reqs.data(), MPI_STATUSES_IGNORE);
             }
 
             // now we pass through and unpack the particles, either by holding onto them in the
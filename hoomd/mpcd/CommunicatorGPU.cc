@@ -239,101 +239,76 @@ void mpcd::CommunicatorGPU::migrateParticles(uint64_t timestep)
                 }
             }
 
-        // communicate total number of particles being sent and received from neighbor ranks
+        // exchange particle data with neighbor ranks
         unsigned int n_recv_tot = 0;
             {
-            // loop over neighbors
             ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
                                                          access_location::host,
                                                          access_mode::read);
+            ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
+                                                               access_location::host,
+                                                               access_mode::read);
+
+            // send to every neighbor in this stage, even if empty, so that the receiving rank can
+            // size its buffer by probing for the message instead of exchanging sizes first
             unsigned int nreq = 0;
             m_reqs.resize(2 * m_n_unique_neigh);
+            const MPI_Datatype mpi_pdata_element = m_mpcd_pdata->getElementMPIDatatype();
+            unsigned int sendidx = 0;
             for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ++ineigh)
                 {
                 if (m_stages[ineigh] != (int)stage)
                     {
                     // skip neighbor if not participating in this communication stage
                     m_n_send_ptls[ineigh] = 0;
-                    m_n_recv_ptls[ineigh] = 0;
                     continue;
                     }
 
-                // rank of neighbor processor
-                unsigned int neighbor = h_unique_neighbors.data[ineigh];
-
-                MPI_Isend(&m_n_send_ptls[ineigh],
-                          1,
-                          MPI_UNSIGNED,
-                          neighbor,
-                          0,
-                          m_mpi_comm,
-                          &m_reqs[nreq++]);
-                MPI_Irecv(&m_n_recv_ptls[ineigh],
+                MPI_Isend(h_sendbuf.data + sendidx,
+                          m_n_send_ptls[ineigh],
+                          mpi_pdata_element,
+                          h_unique_neighbors.data[ineigh],
                           1,
-                          MPI_UNSIGNED,
-                          neighbor,
-                          0,
                           m_mpi_comm,
                           &m_reqs[nreq++]);
-                } // end neighbor loop
-            MPI_Waitall(nreq, m_reqs.data(), MPI_STATUSES_IGNORE);
 
-            // sum up receive counts
+                // increment the send index by the amount just transferred
+                sendidx += m_n_send_ptls[ineigh];
+                }
+
+            // probe the size of the incoming messages and sum up receive counts
             for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ++ineigh)
                 {
                 m_offsets[ineigh] = n_recv_tot;
-                n_recv_tot += m_n_recv_ptls[ineigh];
+                m_n_recv_ptls[ineigh] = 0;
+                if (m_stages[ineigh] != (int)stage)
+                    continue;
+
+                MPI_Status status;
+                int count;
+                MPI_Probe(h_unique_neighbors.data[ineigh], 1, m_mpi_comm, &status);
+                MPI_Get_count(&status, mpi_pdata_element, &count);
+                m_n_recv_ptls[ineigh] = count;
+                n_recv_tot += count;
                 }
-            }
 
-        // Resize particles from neighbor ranks
-        m_recvbuf.resize(n_recv_tot);
-            {
-            ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
-                                                         access_location::host,
-                                                         access_mode::read);
-            ArrayHandle<mpcd::detail::pdata_element> h_sendbuf(m_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
+            // Resize particles from neighbor ranks
+            m_recvbuf.resize(n_recv_tot);
             ArrayHandle<mpcd::detail::pdata_element> h_recvbuf(m_recvbuf,
                                                                access_location::host,
                                                                access_mode::overwrite);
-
-            // loop over neighbors
-            unsigned int nreq = 0;
-            m_reqs.resize(2 * m_n_unique_neigh);
-            const MPI_Datatype mpi_pdata_element = m_mpcd_pdata->getElementMPIDatatype();
-            unsigned int sendidx = 0;
             for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ++ineigh)
                 {
-                // rank of neighbor processor
-                unsigned int neighbor = h_unique_neighbors.data[ineigh];
-
-                // exchange particle data
-                if (m_n_send_ptls[ineigh])
-                    {
-                    MPI_Isend(h_sendbuf.data + sendidx,
-                              m_n_send_ptls[ineigh],
-                              mpi_pdata_element,
-                              neighbor,
-                              1,
-                              m_mpi_comm,
-                              &m_reqs[nreq++]);
-
-                    // increment the send index by the amount just transferred
-                    sendidx += m_n_send_ptls[ineigh];
-                    }
+                if (m_stages[ineigh] != (int)stage)
+                    continue;
 
-                if (m_n_recv_ptls[ineigh])
-                    {
-                    MPI_Irecv(h_recvbuf.data + m_offsets[ineigh],
-                              m_n_recv_ptls[ineigh],
-                              mpi_pdata_element,
-                              neighbor,
-                              1,
-                              m_mpi_comm,
-                              &m_reqs[nreq++]);
-                    }
+                MPI_Irecv(h_recvbuf.data + m_offsets[ineigh],
+                          m_n_recv_ptls[ineigh],
+                          mpi_pdata_element,
+                          h_unique_neighbors.data[ineigh],
+                          1,
+                          m_mpi_comm,
+                          &m_reqs[nreq++]);
                 }
 
             MPI_Waitall(nreq, m_reqs.data(), MPI_STATUSES_IGNORE);
@@ -121,6 +121,26 @@ class __attribute__((visibility("default"))) ConcentricCylindersGeometry
         return (rsq > m_R1_sq || rsq < m_R0_sq);
         }
 
+    //! Check if an axis-aligned box lies completely inside the geometry
+    /*!
+     * \param lo Lower corner of the box
+     * \param hi Upper corner of the box
+     * \returns True if no point in the box is out of bounds, and false if any point may be
+     */
+    HOSTDEVICE bool isInsideBox(const Scalar3& lo, const Scalar3& hi) const
+        {
+        // the farthest point from the axis must be inside the outer cylinder
+        const Scalar far_x = fmax(fabs(lo.x), fabs(hi.x));
+        const Scalar far_y = fmax(fabs(lo.y), fabs(hi.y));
+        if (far_x * far_x + far_y * far_y > m_R1_sq)
+            return false;
+
+        // the nearest point to the axis must be outside the inner cylinder
+        const Scalar near_x = (lo.x > Scalar(0)) ? lo.x : ((hi.x < Scalar(0)) ? -hi.x : Scalar(0));
+        const Scalar near_y = (lo.y > Scalar(0)) ? lo.y : ((hi.y < Scalar(0)) ? -hi.y : Scalar(0));
+        return near_x * near_x + near_y * near_y >= m_R0_sq;
+        }
+
     //! Add a contribution to random virtual particle velocity.
     /*!
      * \param vel Velocity of virtual particle
@@ -270,6 +270,19 @@ class __attribute__((visibility("default"))) CosineChannelGeometry
         return (a > m_H || a < -m_H);
         }
 
+    //! Check if an axis-aligned box lies completely inside the geometry
+    /*!
+     * \param lo Lower corner of the box
+     * \param hi Upper corner of the box
+     * \returns True if no point in the box is out of bounds, and false if any point may be
+     */
+    HOSTDEVICE bool isInsideBox(const Scalar3& lo, const Scalar3& hi) const
+        {
+        // conservatively, the walls can be anywhere within the amplitude of the cosine
+        const Scalar A = fabs(m_amplitude);
+        return (lo.y - A >= -m_H && hi.y + A <= m_H);
+        }
+
     //! Add a contribution to random virtual particle velocity.
     /*!
      * \param vel Velocity of virtual particle
@@ -281,6 +281,18 @@ class __attribute__((visibility("default"))) CosineExpansionContractionGeometry
         return (pos.y > a || pos.y < -a);
         }
 
+    //! Check if an axis-aligned box lies completely inside the geometry
+    /*!
+     * \param lo Lower corner of the box
+     * \param hi Upper corner of the box
+     * \returns True if no point in the box is out of bounds, and false if any point may be
+     */
+    HOSTDEVICE bool isInsideBox(const Scalar3& lo, const Scalar3& hi) const
+        {
+        // conservatively, the channel is at least as wide as its narrowest point
+        return (lo.y >= -m_H_narrow && hi.y <= m_H_narrow);
+        }
+
     //! Validate that the simulation box is large enough for the geometry
     /*!
      * \param box Global simulation box
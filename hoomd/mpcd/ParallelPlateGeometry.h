@@ -134,6 +134,17 @@ class __attribute__((visibility("default"))) ParallelPlateGeometry
         return (pos.y > m_H || pos.y < -m_H);
         }
 
+    //! Check if an axis-aligned box lies completely inside the geometry
+    /*!
+     * \param lo Lower corner of the box
+     * \param hi Upper corner of the box
+     * \returns True if no point in the box is out of bounds, and false if any point may be
+     */
+    HOSTDEVICE bool isInsideBox(const Scalar3& lo, const Scalar3& hi) const
+        {
+        return (lo.y >= -m_H && hi.y <= m_H);
+        }
+
     //! Add a contribution to random virtual particle velocity.
     /*!
      * \param vel Velocity of virtual particle
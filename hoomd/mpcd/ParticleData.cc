@@ -694,20 +694,20 @@ void mpcd::ParticleData::allocate(unsigned int N_max)
         }
 #endif // ENABLE_MPI
 
-    // Allocate the alternate data
-    GPUArray<Scalar4> pos_alt(N_max, m_exec_conf);
+    // Release the alternate data, which is allocated again when it is first used
+    GPUArray<Scalar4> pos_alt;
     m_pos_alt.swap(pos_alt);
 
-    GPUArray<Scalar4> vel_alt(N_max, m_exec_conf);
+    GPUArray<Scalar4> vel_alt;
     m_vel_alt.swap(vel_alt);
 
-    GPUArray<unsigned int> tag_alt(N_max, m_exec_conf);
+    GPUArray<unsigned int> tag_alt;
     m_tag_alt.swap(tag_alt);
 
 #ifdef ENABLE_MPI
     if (m_decomposition)
         {
-        GPUArray<unsigned int> comm_flags_alt(N_max, m_exec_conf);
+        GPUArray<unsigned int> comm_flags_alt;
         m_comm_flags_alt.swap(comm_flags_alt);
 
         GPUArray<unsigned int> remove_ids(N_max, m_exec_conf);
@@ -747,14 +747,18 @@ void mpcd::ParticleData::reallocate(unsigned int N_max)
         }
 #endif // ENABLE_MPI
 
-    // Reallocate the alternate data
-    m_pos_alt.resize(N_max);
-    m_vel_alt.resize(N_max);
-    m_tag_alt.resize(N_max);
+    // Reallocate the alternate data that is in use
+    if (!m_pos_alt.isNull())
+        m_pos_alt.resize(N_max);
+    if (!m_vel_alt.isNull())
+        m_vel_alt.resize(N_max);
+    if (!m_tag_alt.isNull())
+        m_tag_alt.resize(N_max);
 #ifdef ENABLE_MPI
     if (m_decomposition)
         {
-        m_comm_flags_alt.resize(N_max);
+        if (!m_comm_flags_alt.isNull())
+            m_comm_flags_alt.resize(N_max);
         m_remove_ids.resize(N_max);
 
 #ifdef ENABLE_HIP
@@ -216,36 +216,42 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     //! Get alternate array of MPCD particle positions
     const GPUArray<Scalar4>& getAltPositions() const
         {
+        allocateAlternate(m_pos_alt);
         return m_pos_alt;
         }
 
     //! Swap out alternate MPCD particle position array
     void swapPositions()
         {
+        allocateAlternate(m_pos_alt);
         m_pos.swap(m_pos_alt);
         }
 
     //! Get alternate array of MPCD particle velocities
     const GPUArray<Scalar4>& getAltVelocities() const
         {
+        allocateAlternate(m_vel_alt);
         return m_vel_alt;
         }
 
     //! Swap out alternate MPCD particle velocity array
     void swapVelocities()
         {
+        allocateAlternate(m_vel_alt);
         m_vel.swap(m_vel_alt);
         }
 
     //! Get alternate array of MPCD particle tags
     const GPUArray<unsigned int>& getAltTags() const
         {
+        allocateAlternate(m_tag_alt);
         return m_tag_alt;
         }
 
     //! Swap out alternate MPCD particle tags
     void swapTags()
         {
+        allocateAlternate(m_tag_alt);
         m_tag.swap(m_tag_alt);
         }
     //@}
@@ -394,12 +400,14 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     //! Get the alternate MPCD particle communication flags
     const GPUArray<unsigned int>& getAltCommFlags() const
         {
+        allocateAlternate(m_comm_flags_alt);
         return m_comm_flags_alt;
         }
 
     //! Swap out alternate MPCD communication flags
     void swapCommFlags()
         {
+        allocateAlternate(m_comm_flags_alt);
         m_comm_flags.swap(m_comm_flags_alt);
         }
 
@@ -425,11 +433,12 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     MPI_Datatype m_mpi_pdata_element;    //!< MPI datatype for pdata_element
 #endif                                   // ENABLE_MPI
 
-    GPUArray<Scalar4> m_pos_alt;      //!< Alternate position array
-    GPUArray<Scalar4> m_vel_alt;      //!< Alternate velocity array
-    GPUArray<unsigned int> m_tag_alt; //!< Alternate tag array
+    // the alternate arrays are only allocated when they are first used
+    mutable GPUArray<Scalar4> m_pos_alt;      //!< Alternate position array
+    mutable GPUArray<Scalar4> m_vel_alt;      //!< Alternate velocity array
+    mutable GPUArray<unsigned int> m_tag_alt; //!< Alternate tag array
 #ifdef ENABLE_MPI
-    GPUArray<unsigned int> m_comm_flags_alt; //!< Alternate communication flags
+    mutable GPUArray<unsigned int> m_comm_flags_alt; //!< Alternate communication flags
     GPUArray<unsigned int> m_remove_ids;     //!< Partitioned indexes of particles to keep
 #ifdef ENABLE_HIP
     GPUArray<unsigned char> m_remove_flags; //!< Temporary flag to mark keeping particle
@@ -460,6 +469,16 @@ class PYBIND11_EXPORT ParticleData : public Autotuned
     //! Reallocate data arrays
     void reallocate(unsigned int N_max);
 
+    //! Allocate an alternate array the first time it is used
+    template<class T> void allocateAlternate(GPUArray<T>& alt) const
+        {
+        if (alt.isNull())
+            {
+            GPUArray<T> tmp(m_N_max, m_exec_conf);
+            alt.swap(tmp);
+            }
+        }
+
     const static float resize_factor; //!< Amortized growth factor the data arrays
     //! Resize the data
     void resize(unsigned int N);
@@ -31,6 +31,10 @@ namespace mpcd
  * lie outside the confinement defined by template geometry.
  * A merit of this method comes from the fact that it works on any geometry that is being used.
  * However, this method degrades in performance as simulation box size increases in size.
+ *
+ * When positions are cached, the accepted positions are kept after they are drawn and only the
+ * velocities are redrawn at later fills. The positions are drawn again when the box, density,
+ * type, or geometry changes.
  */
 template<class Geometry>
 class PYBIND11_EXPORT RejectionVirtualParticleFiller : public mpcd::VirtualParticleFiller
@@ -43,7 +47,8 @@ class PYBIND11_EXPORT RejectionVirtualParticleFiller : public mpcd::VirtualParti
                                    std::shared_ptr<Variant> T,
                                    std::shared_ptr<const Geometry> geom)
         : mpcd::VirtualParticleFiller(sysdef, type, density, T), m_geom(geom),
-          m_tmp_pos(m_exec_conf), m_tmp_vel(m_exec_conf)
+          m_tmp_pos(m_exec_conf), m_tmp_vel(m_exec_conf), m_cache_valid(false), m_num_cached(0),
+          m_cache_density(0), m_cache_type(0)
         {
         m_exec_conf->msg->notice(5)
             << "Constructing MPCD RejectionVirtualParticleFiller : " + Geometry::getName()
@@ -76,6 +81,58 @@ class PYBIND11_EXPORT RejectionVirtualParticleFiller : public mpcd::VirtualParti
     std::shared_ptr<const Geometry> m_geom;
     GPUArray<Scalar4> m_tmp_pos;
     GPUArray<Scalar4> m_tmp_vel;
+
+    bool m_cache_valid;                           //!< Flag if the drawn positions can be reused
+    unsigned int m_num_cached;                    //!< Number of positions that were accepted
+    Scalar3 m_cache_lo;                           //!< Lower corner of the box for the positions
+    Scalar3 m_cache_hi;                           //!< Upper corner of the box for the positions
+    Scalar m_cache_density;                       //!< Density for the positions
+    unsigned int m_cache_type;                    //!< Type for the positions
+    std::shared_ptr<const Geometry> m_cache_geom; //!< Geometry for the positions
+
+    //! Check if the positions drawn at the last fill can be reused
+    /*!
+     * \param box Local simulation box
+     * \returns True if the cached positions can be reused on all ranks
+     *
+     * All ranks must agree because the tags are assigned collectively.
+     */
+    bool canUseCache(const BoxDim& box) const
+        {
+        if (!m_cache_positions)
+            return false;
+
+        const Scalar3 lo = box.getLo();
+        const Scalar3 hi = box.getHi();
+        int valid = m_cache_valid && m_cache_geom == m_geom && m_cache_density == m_density
+                    && m_cache_type == m_type && lo.x == m_cache_lo.x && lo.y == m_cache_lo.y
+                    && lo.z == m_cache_lo.z && hi.x == m_cache_hi.x && hi.y == m_cache_hi.y
+                    && hi.z == m_cache_hi.z;
+#ifdef ENABLE_MPI
+        if (m_exec_conf->getNRanks() > 1)
+            {
+            MPI_Allreduce(MPI_IN_PLACE,
+                          &valid,
+                          1,
+                          MPI_INT,
+                          MPI_LAND,
+                          m_exec_conf->getMPICommunicator());
+            }
+#endif // ENABLE_MPI
+        return valid;
+        }
+
+    //! Save the conditions the positions were drawn for
+    void saveCache(const BoxDim& box, unsigned int num_selected)
+        {
+        m_cache_valid = m_cache_positions;
+        m_num_cached = num_selected;
+        m_cache_lo = box.getLo();
+        m_cache_hi = box.getHi();
+        m_cache_density = m_density;
+        m_cache_type = m_type;
+        m_cache_geom = m_geom;
+        }
     };
 
 template<class Geometry> void RejectionVirtualParticleFiller<Geometry>::fill(uint64_t timestep)
@@ -93,54 +150,87 @@ template<class Geometry> void RejectionVirtualParticleFiller<Geometry>::fill(uin
     const unsigned int num_virtual_max
         = static_cast<unsigned int>(std::round(m_density * box.getVolume()));
 
-    // Step 1: Create temporary GPUArrays to draw Particles locally using the worst case estimate
-    // for number of particles.
-    if (num_virtual_max > m_tmp_pos.getNumElements())
-        {
-        GPUArray<Scalar4> tmp_pos(num_virtual_max, m_exec_conf);
-        GPUArray<Scalar4> tmp_vel(num_virtual_max, m_exec_conf);
-        m_tmp_pos.swap(tmp_pos);
-        m_tmp_vel.swap(tmp_vel);
-        }
-
-    // Step 2: Draw the particles and assign velocities simultaneously by using temporary memory.
-    // Only keep the ones that are outside the geometry.
-    unsigned int num_selected = 0;
-    unsigned int first_tag = computeFirstTag(num_virtual_max);
-    uint16_t seed = m_sysdef->getSeed();
     const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
-    ArrayHandle<Scalar4> h_tmp_pos(m_tmp_pos, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar4> h_tmp_vel(m_tmp_vel, access_location::host, access_mode::overwrite);
-    for (unsigned int i = 0; i < num_virtual_max; ++i)
+    uint16_t seed = m_sysdef->getSeed();
+    unsigned int num_selected = 0;
+    unsigned int first_tag = 0;
+    if (canUseCache(box))
         {
-        const unsigned int tag = first_tag + i;
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::VirtualParticleFiller, timestep, seed),
-            hoomd::Counter(tag, m_filler_id));
-
-        Scalar3 particle = make_scalar3(hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng),
-                                        hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng),
-                                        hoomd::UniformDistribution<Scalar>(lo.z, hi.z)(rng));
-
-        if (m_geom->isOutside(particle))
+        // Reuse the accepted positions from the last fill and only redraw the velocities
+        num_selected = m_num_cached;
+        first_tag = computeFirstTag(num_selected);
+        ArrayHandle<Scalar4> h_tmp_pos(m_tmp_pos, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_tmp_vel(m_tmp_vel, access_location::host, access_mode::overwrite);
+        for (unsigned int i = 0; i < num_selected; ++i)
             {
-            h_tmp_pos.data[num_selected]
-                = make_scalar4(particle.x, particle.y, particle.z, __int_as_scalar(m_type));
+            const unsigned int tag = first_tag + i;
+            hoomd::RandomGenerator rng(
+                hoomd::Seed(hoomd::RNGIdentifier::VirtualParticleFiller, timestep, seed),
+                hoomd::Counter(tag, m_filler_id));
 
+            const Scalar4 postype = h_tmp_pos.data[i];
+            const Scalar3 particle = make_scalar3(postype.x, postype.y, postype.z);
             hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
             Scalar3 vel;
             gen(vel.x, vel.y, rng);
             vel.z = gen(rng);
             m_geom->addToVirtualParticleVelocity(vel, particle);
-            h_tmp_vel.data[num_selected]
+            h_tmp_vel.data[i]
                 = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
-            ++num_selected;
             }
         }
+    else
+        {
+        // Step 1: Create temporary GPUArrays to draw Particles locally using the worst case
+        // estimate for number of particles.
+        if (num_virtual_max > m_tmp_pos.getNumElements())
+            {
+            GPUArray<Scalar4> tmp_pos(num_virtual_max, m_exec_conf);
+            GPUArray<Scalar4> tmp_vel(num_virtual_max, m_exec_conf);
+            m_tmp_pos.swap(tmp_pos);
+            m_tmp_vel.swap(tmp_vel);
+            }
+
+        // Step 2: Draw the particles and assign velocities simultaneously by using temporary
+        // memory. Only keep the ones that are outside the geometry.
+        first_tag = computeFirstTag(num_virtual_max);
+        ArrayHandle<Scalar4> h_tmp_pos(m_tmp_pos, access_location::host, access_mode::overwrite);
+        ArrayHandle<Scalar4> h_tmp_vel(m_tmp_vel, access_location::host, access_mode::overwrite);
+        for (unsigned int i = 0; i < num_virtual_max; ++i)
+            {
+            const unsigned int tag = first_tag + i;
+            hoomd::RandomGenerator rng(
+                hoomd::Seed(hoomd::RNGIdentifier::VirtualParticleFiller, timestep, seed),
+                hoomd::Counter(tag, m_filler_id));
+
+            Scalar3 particle = make_scalar3(hoomd::UniformDistribution<Scalar>(lo.x, hi.x)(rng),
+                                            hoomd::UniformDistribution<Scalar>(lo.y, hi.y)(rng),
+                                            hoomd::UniformDistribution<Scalar>(lo.z, hi.z)(rng));
+
+            if (m_geom->isOutside(particle))
+                {
+                h_tmp_pos.data[num_selected]
+                    = make_scalar4(particle.x, particle.y, particle.z, __int_as_scalar(m_type));
+
+                hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+                Scalar3 vel;
+                gen(vel.x, vel.y, rng);
+                vel.z = gen(rng);
+                m_geom->addToVirtualParticleVelocity(vel, particle);
+                h_tmp_vel.data[num_selected]
+                    = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+                ++num_selected;
+                }
+            }
+        saveCache(box, num_selected);
+
+        // recompute tags based on actual number selected
+        first_tag = computeFirstTag(num_selected);
+        }
 
-    // Step 3: Allocate memory for the new virtual particles, and copy. Also recompute tags based
-    // on actual number selected
-    first_tag = computeFirstTag(num_selected);
+    // Step 3: Allocate memory for the new virtual particles, and copy.
+    ArrayHandle<Scalar4> h_tmp_pos(m_tmp_pos, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_tmp_vel(m_tmp_vel, access_location::host, access_mode::read);
     const unsigned int first_idx = m_mpcd_pdata->addVirtualParticles(num_selected);
     ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
                                access_location::host,
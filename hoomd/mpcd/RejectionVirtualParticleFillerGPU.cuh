@@ -69,6 +69,20 @@ template<class Geometry>
 cudaError_t __attribute__((visibility("default")))
 draw_virtual_particles(const draw_virtual_particles_args_t& args, const Geometry& geom);
 
+template<class Geometry>
+cudaError_t __attribute__((visibility("default")))
+draw_cached_virtual_velocities(Scalar4* d_tmp_vel,
+                               const Scalar4* d_tmp_pos,
+                               const unsigned int* d_keep_indices,
+                               const unsigned int first_tag,
+                               const Scalar vel_factor,
+                               const unsigned int n_virtual,
+                               const uint64_t timestep,
+                               const unsigned int seed,
+                               const unsigned int filler_id,
+                               const unsigned int block_size,
+                               const Geometry& geom);
+
 cudaError_t __attribute__((visibility("default")))
 compact_virtual_particle_indices(void* d_tmp,
                                  size_t& tmp_bytes,
@@ -158,6 +172,60 @@ __global__ void draw_virtual_particles(Scalar4* d_tmp_pos,
     d_tmp_vel[idx] = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
     }
 
+//! Kernel to redraw the velocities of cached virtual particles
+/*!
+ * \param d_tmp_vel Temporary velocities (output)
+ * \param d_tmp_pos Temporary positions
+ * \param d_keep_indices Indexes of the kept particles in the temporary arrays
+ * \param first_tag First tag (rng argument)
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature
+ * \param n_virtual Number of kept particles
+ * \param timestep Current timestep
+ * \param seed User seed for RNG
+ * \param filler_id Identifier for the filler (rng argument)
+ * \param geom Confined geometry
+ *
+ * \tparam Geometry type of the confined geometry \a geom
+ *
+ * \b implementation
+ * We assign one thread per kept particle. The particle is given the same tag that
+ * copy_virtual_particles() will assign, so the draw is the same as on the CPU.
+ */
+template<class Geometry>
+__global__ void draw_cached_virtual_velocities(Scalar4* d_tmp_vel,
+                                               const Scalar4* d_tmp_pos,
+                                               const unsigned int* d_keep_indices,
+                                               const unsigned int first_tag,
+                                               const Scalar vel_factor,
+                                               const unsigned int n_virtual,
+                                               const uint64_t timestep,
+                                               const unsigned int seed,
+                                               const unsigned int filler_id,
+                                               const Geometry geom)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n_virtual)
+        return;
+
+    const unsigned int tag = first_tag + idx;
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::VirtualParticleFiller, timestep, seed),
+        hoomd::Counter(tag, filler_id));
+
+    const unsigned int pidx = d_keep_indices[idx];
+    const Scalar4 postype = d_tmp_pos[pidx];
+    const Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+
+    hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+    Scalar3 vel;
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+    geom.addToVirtualParticleVelocity(vel, pos);
+    d_tmp_vel[pidx] = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+    }
+
     } // end namespace kernel
 
 /*!
@@ -196,6 +264,59 @@ cudaError_t draw_virtual_particles(const draw_virtual_particles_args_t& args, co
     return cudaSuccess;
     }
 
+/*!
+ * \param d_tmp_vel Temporary velocities (output)
+ * \param d_tmp_pos Temporary positions
+ * \param d_keep_indices Indexes of the kept particles in the temporary arrays
+ * \param first_tag First tag (rng argument)
+ * \param vel_factor Scale factor for velocities
+ * \param n_virtual Number of kept particles
+ * \param timestep Current timestep
+ * \param seed User seed for RNG
+ * \param filler_id Identifier for the filler (rng argument)
+ * \param block_size Number of threads per block
+ * \param geom Confined geometry
+ *
+ * \tparam Geometry type of the confined geometry \a geom
+ *
+ * \sa mpcd::gpu::kernel::draw_cached_virtual_velocities
+ */
+template<class Geometry>
+cudaError_t draw_cached_virtual_velocities(Scalar4* d_tmp_vel,
+                                           const Scalar4* d_tmp_pos,
+                                           const unsigned int* d_keep_indices,
+                                           const unsigned int first_tag,
+                                           const Scalar vel_factor,
+                                           const unsigned int n_virtual,
+                                           const uint64_t timestep,
+                                           const unsigned int seed,
+                                           const unsigned int filler_id,
+                                           const unsigned int block_size,
+                                           const Geometry& geom)
+    {
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(
+        &attr,
+        (const void*)mpcd::gpu::kernel::draw_cached_virtual_velocities<Geometry>);
+    const unsigned int max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(n_virtual / run_block_size + 1);
+    mpcd::gpu::kernel::draw_cached_virtual_velocities<Geometry>
+        <<<grid, run_block_size>>>(d_tmp_vel,
+                                   d_tmp_pos,
+                                   d_keep_indices,
+                                   first_tag,
+                                   vel_factor,
+                                   n_virtual,
+                                   timestep,
+                                   seed,
+                                   filler_id,
+                                   geom);
+
+    return cudaSuccess;
+    }
+
 #endif // __HIPCC__
 
     } // end namespace gpu
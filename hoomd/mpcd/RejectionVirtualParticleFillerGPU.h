@@ -49,7 +49,10 @@ class PYBIND11_EXPORT RejectionVirtualParticleFillerGPU
         m_tuner2.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                         this->m_exec_conf,
                                         "mpcd_rejection_filler_tag_particles"));
-        this->m_autotuners.insert(this->m_autotuners.end(), {m_tuner1, m_tuner2});
+        m_tuner3.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                        this->m_exec_conf,
+                                        "mpcd_rejection_filler_draw_cached_velocities"));
+        this->m_autotuners.insert(this->m_autotuners.end(), {m_tuner1, m_tuner2, m_tuner3});
         }
 
     protected:
@@ -62,6 +65,7 @@ class PYBIND11_EXPORT RejectionVirtualParticleFillerGPU
     GPUFlags<unsigned int> m_num_keep;      // Number of particles to keep
     std::shared_ptr<Autotuner<1>> m_tuner1; //!< Autotuner for drawing particles
     std::shared_ptr<Autotuner<1>> m_tuner2; //!< Autotuner for particle tagging
+    std::shared_ptr<Autotuner<1>> m_tuner3; //!< Autotuner for drawing cached velocities
     };
 
 template<class Geometry> void RejectionVirtualParticleFillerGPU<Geometry>::fill(uint64_t timestep)
@@ -79,80 +83,121 @@ template<class Geometry> void RejectionVirtualParticleFillerGPU<Geometry>::fill(
     const unsigned int num_virtual_max
         = static_cast<unsigned int>(std::round(this->m_density * box.getVolume()));
 
-    // Step 1
-    if (num_virtual_max > this->m_tmp_pos.getNumElements())
+    const Scalar vel_factor = fast::sqrt((*this->m_T)(timestep) / this->m_mpcd_pdata->getMass());
+    unsigned int num_selected = 0;
+    unsigned int first_tag = 0;
+    if (this->canUseCache(box))
         {
-        GPUArray<Scalar4> tmp_pos(num_virtual_max, this->m_exec_conf);
-        this->m_tmp_pos.swap(tmp_pos);
-        GPUArray<Scalar4> tmp_vel(num_virtual_max, this->m_exec_conf);
-        this->m_tmp_vel.swap(tmp_vel);
-        GPUArray<bool> keep_particles(num_virtual_max, this->m_exec_conf);
-        m_keep_particles.swap(keep_particles);
-        GPUArray<unsigned int> keep_indices(num_virtual_max, this->m_exec_conf);
-        m_keep_indices.swap(keep_indices);
+        // Reuse the kept positions from the last fill and only redraw the velocities
+        num_selected = this->m_num_cached;
+        first_tag = this->computeFirstTag(num_selected);
+        ArrayHandle<Scalar4> d_tmp_pos(this->m_tmp_pos,
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> d_tmp_vel(this->m_tmp_vel,
+                                       access_location::device,
+                                       access_mode::readwrite);
+        ArrayHandle<unsigned int> d_keep_indices(m_keep_indices,
+                                                 access_location::device,
+                                                 access_mode::read);
+        m_tuner3->begin();
+        mpcd::gpu::draw_cached_virtual_velocities<Geometry>(d_tmp_vel.data,
+                                                            d_tmp_pos.data,
+                                                            d_keep_indices.data,
+                                                            first_tag,
+                                                            vel_factor,
+                                                            num_selected,
+                                                            timestep,
+                                                            this->m_sysdef->getSeed(),
+                                                            this->m_filler_id,
+                                                            m_tuner3->getParam()[0],
+                                                            *(this->m_geom));
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner3->end();
         }
-
-    // Step 2
-    unsigned int first_tag = this->computeFirstTag(num_virtual_max);
-    const Scalar vel_factor = fast::sqrt((*this->m_T)(timestep) / this->m_mpcd_pdata->getMass());
-    ArrayHandle<Scalar4> d_tmp_pos(this->m_tmp_pos,
-                                   access_location::device,
-                                   access_mode::overwrite);
-    ArrayHandle<Scalar4> d_tmp_vel(this->m_tmp_vel,
-                                   access_location::device,
-                                   access_mode::overwrite);
-    ArrayHandle<bool> d_keep_particles(m_keep_particles,
+    else
+        {
+        // Step 1
+        if (num_virtual_max > this->m_tmp_pos.getNumElements())
+            {
+            GPUArray<Scalar4> tmp_pos(num_virtual_max, this->m_exec_conf);
+            this->m_tmp_pos.swap(tmp_pos);
+            GPUArray<Scalar4> tmp_vel(num_virtual_max, this->m_exec_conf);
+            this->m_tmp_vel.swap(tmp_vel);
+            GPUArray<bool> keep_particles(num_virtual_max, this->m_exec_conf);
+            m_keep_particles.swap(keep_particles);
+            GPUArray<unsigned int> keep_indices(num_virtual_max, this->m_exec_conf);
+            m_keep_indices.swap(keep_indices);
+            }
+
+        // Step 2
+        first_tag = this->computeFirstTag(num_virtual_max);
+        ArrayHandle<Scalar4> d_tmp_pos(this->m_tmp_pos,
                                        access_location::device,
                                        access_mode::overwrite);
-    ArrayHandle<unsigned int> d_keep_indices(m_keep_indices,
-                                             access_location::device,
-                                             access_mode::overwrite);
-    mpcd::gpu::draw_virtual_particles_args_t args(d_tmp_pos.data,
-                                                  d_tmp_vel.data,
-                                                  d_keep_particles.data,
-                                                  lo,
-                                                  hi,
-                                                  first_tag,
-                                                  vel_factor,
-                                                  this->m_type,
-                                                  num_virtual_max,
-                                                  timestep,
-                                                  this->m_sysdef->getSeed(),
-                                                  this->m_filler_id,
-                                                  m_tuner1->getParam()[0]);
-    m_tuner1->begin();
-    mpcd::gpu::draw_virtual_particles<Geometry>(args, *(this->m_geom));
-    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
-        CHECK_CUDA_ERROR();
-    m_tuner1->end();
-        {
-        // on GPU, we need to compact the selected particles down with CUB
-        // size storage
-        void* d_tmp_storage = NULL;
-        size_t tmp_storage_bytes = 0;
-        mpcd::gpu::compact_virtual_particle_indices(d_tmp_storage,
-                                                    tmp_storage_bytes,
-                                                    d_keep_particles.data,
-                                                    num_virtual_max,
-                                                    d_keep_indices.data,
-                                                    m_num_keep.getDeviceFlags());
-        ScopedAllocation<unsigned char> d_tmp_alloc(this->m_exec_conf->getCachedAllocator(),
-                                                    (tmp_storage_bytes > 0) ? tmp_storage_bytes
-                                                                            : 1);
-        d_tmp_storage = (void*)d_tmp_alloc();
-
-        // run selection
-        mpcd::gpu::compact_virtual_particle_indices(d_tmp_storage,
-                                                    tmp_storage_bytes,
-                                                    d_keep_particles.data,
-                                                    num_virtual_max,
-                                                    d_keep_indices.data,
-                                                    m_num_keep.getDeviceFlags());
+        ArrayHandle<Scalar4> d_tmp_vel(this->m_tmp_vel,
+                                       access_location::device,
+                                       access_mode::overwrite);
+        ArrayHandle<bool> d_keep_particles(m_keep_particles,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<unsigned int> d_keep_indices(m_keep_indices,
+                                                 access_location::device,
+                                                 access_mode::overwrite);
+        mpcd::gpu::draw_virtual_particles_args_t args(d_tmp_pos.data,
+                                                      d_tmp_vel.data,
+                                                      d_keep_particles.data,
+                                                      lo,
+                                                      hi,
+                                                      first_tag,
+                                                      vel_factor,
+                                                      this->m_type,
+                                                      num_virtual_max,
+                                                      timestep,
+                                                      this->m_sysdef->getSeed(),
+                                                      this->m_filler_id,
+                                                      m_tuner1->getParam()[0]);
+        m_tuner1->begin();
+        mpcd::gpu::draw_virtual_particles<Geometry>(args, *(this->m_geom));
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner1->end();
+            {
+            // on GPU, we need to compact the selected particles down with CUB
+            // size storage
+            void* d_tmp_storage = NULL;
+            size_t tmp_storage_bytes = 0;
+            mpcd::gpu::compact_virtual_particle_indices(d_tmp_storage,
+                                                        tmp_storage_bytes,
+                                                        d_keep_particles.data,
+                                                        num_virtual_max,
+                                                        d_keep_indices.data,
+                                                        m_num_keep.getDeviceFlags());
+            ScopedAllocation<unsigned char> d_tmp_alloc(this->m_exec_conf->getCachedAllocator(),
+                                                        (tmp_storage_bytes > 0) ? tmp_storage_bytes
+                                                                                : 1);
+            d_tmp_storage = (void*)d_tmp_alloc();
+
+            // run selection
+            mpcd::gpu::compact_virtual_particle_indices(d_tmp_storage,
+                                                        tmp_storage_bytes,
+                                                        d_keep_particles.data,
+                                                        num_virtual_max,
+                                                        d_keep_indices.data,
+                                                        m_num_keep.getDeviceFlags());
+            }
+        num_selected = m_num_keep.readFlags();
+        this->saveCache(box, num_selected);
+        first_tag = this->computeFirstTag(num_selected);
         }
-    const unsigned int num_selected = m_num_keep.readFlags();
 
     // Step 3
-    first_tag = this->computeFirstTag(num_selected);
+    ArrayHandle<Scalar4> d_tmp_pos(this->m_tmp_pos, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_tmp_vel(this->m_tmp_vel, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_keep_indices(m_keep_indices,
+                                             access_location::device,
+                                             access_mode::read);
     const unsigned int first_idx = this->m_mpcd_pdata->addVirtualParticles(num_selected);
     ArrayHandle<Scalar4> d_pos(this->m_mpcd_pdata->getPositions(),
                                access_location::device,
@@ -12,13 +12,52 @@
 
 namespace hoomd
     {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Rotate a velocity about an axis
+/*!
+ * \param vel Velocity relative to the cell center of mass
+ * \param rot_vec Unit vector of the rotation axis
+ * \param cos_a Cosine of the rotation angle
+ * \param one_minus_cos_a One minus the cosine of the rotation angle
+ * \param sin_a Sine of the rotation angle
+ * \returns The rotated velocity
+ */
+inline double3 rotateVelocity(const double3& vel,
+                              const double3& rot_vec,
+                              const double cos_a,
+                              const double one_minus_cos_a,
+                              const double sin_a)
+    {
+    // TODO: should we optimize out the matrix construction for the CPU?
+    //       Or, consider using vectorization and/or Eigen?
+    double3 new_vel;
+    new_vel.x = (cos_a + rot_vec.x * rot_vec.x * one_minus_cos_a) * vel.x;
+    new_vel.x += (rot_vec.x * rot_vec.y * one_minus_cos_a - sin_a * rot_vec.z) * vel.y;
+    new_vel.x += (rot_vec.x * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.y) * vel.z;
+
+    new_vel.y = (cos_a + rot_vec.y * rot_vec.y * one_minus_cos_a) * vel.y;
+    new_vel.y += (rot_vec.x * rot_vec.y * one_minus_cos_a + sin_a * rot_vec.z) * vel.x;
+    new_vel.y += (rot_vec.y * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.x) * vel.z;
+
+    new_vel.z = (cos_a + rot_vec.z * rot_vec.z * one_minus_cos_a) * vel.z;
+    new_vel.z += (rot_vec.x * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.y) * vel.x;
+    new_vel.z += (rot_vec.y * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.x) * vel.y;
+
+    return new_vel;
+    }
+    } // end namespace detail
+    } // end namespace mpcd
+
 mpcd::SRDCollisionMethod::SRDCollisionMethod(std::shared_ptr<SystemDefinition> sysdef,
                                              unsigned int cur_timestep,
                                              unsigned int period,
                                              int phase,
                                              Scalar angle)
     : mpcd::CollisionMethod(sysdef, cur_timestep, period, phase), m_rotvec(m_exec_conf),
-      m_angle(angle), m_factors(m_exec_conf)
+      m_angle(angle), m_factors(m_exec_conf), m_draw_pending(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD SRD collision method" << std::endl;
     }
@@ -46,7 +85,7 @@ bool mpcd::SRDCollisionMethod::isAutotuningComplete()
 
 void mpcd::SRDCollisionMethod::rule(uint64_t timestep)
     {
-    m_thermo->compute(timestep);
+    const bool fused = useFused();
 
     // resize the rotation vectors and rescale factors
     m_rotvec.resize(m_cl->getNCells());
@@ -55,11 +94,48 @@ void mpcd::SRDCollisionMethod::rule(uint64_t timestep)
         m_factors.resize(m_cl->getNCells());
         }
 
-    // draw rotation vectors for each cell
-    drawRotationVectors(timestep);
+    if (fused)
+        {
+        m_cl->compute(timestep);
+        }
+    else
+        {
+        m_draw_pending = true;
+        m_thermo->compute(timestep);
+        }
 
-    // apply collision rule
-    rotate(timestep);
+    if (fused)
+        {
+        collideFused(timestep);
+        }
+    else
+        {
+        // draw rotation vectors for each cell, unless this happened during the thermo compute
+        if (m_draw_pending)
+            {
+            drawRotationVectors(timestep);
+            m_draw_pending = false;
+            }
+
+        // apply collision rule
+        rotate(timestep);
+        }
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * This callback is executed by the cell thermo compute while the outer cell properties are
+ * communicated. The rotation vectors do not depend on the cell properties unless the
+ * thermostat is used, so they can be drawn in the meantime.
+ */
+void mpcd::SRDCollisionMethod::drawRotationVectorsOverlapped(uint64_t timestep)
+    {
+    if (m_draw_pending && !m_T)
+        {
+        drawRotationVectors(timestep);
+        m_draw_pending = false;
+        }
     }
 
 void mpcd::SRDCollisionMethod::drawRotationVectors(uint64_t timestep)
@@ -84,53 +160,82 @@ void mpcd::SRDCollisionMethod::drawRotationVectors(uint64_t timestep)
         T_set = (*m_T)(timestep);
         }
 
-    uint16_t seed = m_sysdef->getSeed();
-
-    for (unsigned int k = 0; k < ci.getD(); ++k)
+    // each cell has its own random number stream, so the cells can be split over the threads
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    pool.parallelFor(
+        ci.getNumElements(),
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        for (unsigned int j = 0; j < ci.getH(); ++j)
-            {
-            for (unsigned int i = 0; i < ci.getW(); ++i)
+            for (unsigned int idx = begin; idx < end; ++idx)
                 {
-                const int3 global_cell = m_cl->getGlobalCell(make_int3(i, j, k));
+                const uint3 cell = ci.getTriple(idx);
+                const int3 global_cell = m_cl->getGlobalCell(make_int3(cell.x, cell.y, cell.z));
                 const unsigned int global_idx
                     = global_ci(global_cell.x, global_cell.y, global_cell.z);
-                const unsigned int idx = ci(i, j, k);
 
-                // Initialize the PRNG using the current cell index, timestep, and seed for the hash
-                hoomd::RandomGenerator rng(
-                    hoomd::Seed(hoomd::RNGIdentifier::SRDCollisionMethod, timestep, seed),
-                    hoomd::Counter(global_idx));
-
-                // draw rotation vector off the surface of the sphere
                 double3 rotvec;
-                hoomd::SpherePointGenerator<double> sphgen;
-                sphgen(rng, rotvec);
+                double factor;
+                drawCellRotation(timestep,
+                                 global_idx,
+                                 (use_thermostat) ? h_cell_energy->data[idx]
+                                                  : make_double3(0, 0, 0),
+                                 T_set,
+                                 rotvec,
+                                 factor);
                 h_rotvec.data[idx] = rotvec;
-
                 if (use_thermostat)
                     {
-                    const double3 cell_energy = h_cell_energy->data[idx];
-                    const unsigned int np = __double_as_int(cell_energy.z);
-                    double factor = 1.0;
-                    if (np > 1)
-                        {
-                        // the total number of degrees of freedom in the cell divided by 2
-                        const double alpha = m_sysdef->getNDimensions() * (np - 1) / (double)2.;
-
-                        // draw a random kinetic energy for the cell at the set temperature
-                        hoomd::GammaDistribution<double> gamma_gen(alpha, T_set);
-                        const double rand_ke = gamma_gen(rng);
-
-                        // generate the scale factor from the current temperature
-                        // (don't use the kinetic energy of this cell, since this
-                        // is total not relative to COM)
-                        const double cur_ke = alpha * cell_energy.y;
-                        factor = (cur_ke > 0.) ? fast::sqrt(rand_ke / cur_ke) : 1.;
-                        }
                     h_factors->data[idx] = factor;
                     }
                 }
+        });
+    }
+
+/*!
+ * \param timestep Current timestep
+ * \param global_idx Global index of the cell
+ * \param cell_energy Kinetic energy, temperature, and number of particles in the cell
+ * \param T_set Temperature of the thermostat
+ * \param rotvec Rotation vector of the cell (output)
+ * \param factor Thermostat rescale factor of the cell (output)
+ *
+ * \a cell_energy and \a T_set are only used if the thermostat is enabled. Otherwise, \a factor is
+ * set to 1.
+ */
+void mpcd::SRDCollisionMethod::drawCellRotation(uint64_t timestep,
+                                                unsigned int global_idx,
+                                                const double3& cell_energy,
+                                                Scalar T_set,
+                                                double3& rotvec,
+                                                double& factor)
+    {
+    // Initialize the PRNG using the current cell index, timestep, and seed for the hash
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::SRDCollisionMethod, timestep, m_sysdef->getSeed()),
+        hoomd::Counter(global_idx));
+
+    // draw rotation vector off the surface of the sphere
+    hoomd::SpherePointGenerator<double> sphgen;
+    sphgen(rng, rotvec);
+
+    factor = 1.0;
+    if (m_T)
+        {
+        const unsigned int np = __double_as_int(cell_energy.z);
+        if (np > 1)
+            {
+            // the total number of degrees of freedom in the cell divided by 2
+            const double alpha = m_sysdef->getNDimensions() * (np - 1) / (double)2.;
+
+            // draw a random kinetic energy for the cell at the set temperature
+            hoomd::GammaDistribution<double> gamma_gen(alpha, T_set);
+            const double rand_ke = gamma_gen(rng);
+
+            // generate the scale factor from the current temperature
+            // (don't use the kinetic energy of this cell, since this
+            // is total not relative to COM)
+            const double cur_ke = alpha * cell_energy.y;
+            factor = (cur_ke > 0.) ? fast::sqrt(rand_ke / cur_ke) : 1.;
             }
         }
     }
@@ -182,78 +287,233 @@ void mpcd::SRDCollisionMethod::rotate(uint64_t timestep)
             new ArrayHandle<double>(m_factors, access_location::host, access_mode::read));
         }
 
-    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    pool.parallelFor(
+        N_tot,
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
         {
-        double3 vel;
-        unsigned int cell;
-        // these properties are needed for the embedded particles only
-        unsigned int idx(0);
-        double mass(0);
-        if (cur_p < N_mpcd)
-            {
-            const Scalar4 vel_cell = h_vel.data[cur_p];
-            vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
-            cell = __scalar_as_int(vel_cell.w);
-            }
-        else
-            {
-            idx = h_embed_group->data[cur_p - N_mpcd];
+            for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
+                {
+                double3 vel;
+                unsigned int cell;
+                // these properties are needed for the embedded particles only
+                unsigned int idx(0);
+                double mass(0);
+                if (cur_p < N_mpcd)
+                    {
+                    const Scalar4 vel_cell = h_vel.data[cur_p];
+                    vel = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
+                    cell = __scalar_as_int(vel_cell.w);
+                    }
+                else
+                    {
+                    idx = h_embed_group->data[cur_p - N_mpcd];
 
-            const Scalar4 vel_mass = h_vel_embed->data[idx];
-            vel = make_double3(vel_mass.x, vel_mass.y, vel_mass.z);
-            mass = vel_mass.w;
-            cell = h_embed_cell_ids->data[cur_p - N_mpcd];
-            }
+                    const Scalar4 vel_mass = h_vel_embed->data[idx];
+                    vel = make_double3(vel_mass.x, vel_mass.y, vel_mass.z);
+                    mass = vel_mass.w;
+                    cell = h_embed_cell_ids->data[cur_p - N_mpcd];
+                    }
 
-        // subtract average velocity
-        const double4 avg_vel = h_cell_vel.data[cell];
-        vel.x -= avg_vel.x;
-        vel.y -= avg_vel.y;
-        vel.z -= avg_vel.z;
-
-        // get rotation vector
-        double3 rot_vec = h_rotvec.data[cell];
-
-        // perform the rotation in double precision
-        // TODO: should we optimize out the matrix construction for the CPU?
-        //       Or, consider using vectorization and/or Eigen?
-        double3 new_vel;
-        new_vel.x = (cos_a + rot_vec.x * rot_vec.x * one_minus_cos_a) * vel.x;
-        new_vel.x += (rot_vec.x * rot_vec.y * one_minus_cos_a - sin_a * rot_vec.z) * vel.y;
-        new_vel.x += (rot_vec.x * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.y) * vel.z;
-
-        new_vel.y = (cos_a + rot_vec.y * rot_vec.y * one_minus_cos_a) * vel.y;
-        new_vel.y += (rot_vec.x * rot_vec.y * one_minus_cos_a + sin_a * rot_vec.z) * vel.x;
-        new_vel.y += (rot_vec.y * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.x) * vel.z;
-
-        new_vel.z = (cos_a + rot_vec.z * rot_vec.z * one_minus_cos_a) * vel.z;
-        new_vel.z += (rot_vec.x * rot_vec.z * one_minus_cos_a - sin_a * rot_vec.y) * vel.x;
-        new_vel.z += (rot_vec.y * rot_vec.z * one_minus_cos_a + sin_a * rot_vec.x) * vel.y;
-
-        // rescale the temperature if thermostatting is enabled
-        if (use_thermostat)
-            {
-            double factor = h_factors->data[cell];
-            new_vel.x *= factor;
-            new_vel.y *= factor;
-            new_vel.z *= factor;
-            }
+                // subtract average velocity
+                const double4 avg_vel = h_cell_vel.data[cell];
+                vel.x -= avg_vel.x;
+                vel.y -= avg_vel.y;
+                vel.z -= avg_vel.z;
 
-        new_vel.x += avg_vel.x;
-        new_vel.y += avg_vel.y;
-        new_vel.z += avg_vel.z;
+                // get rotation vector
+                double3 rot_vec = h_rotvec.data[cell];
 
-        // set the new velocity
-        if (cur_p < N_mpcd)
-            {
-            h_vel.data[cur_p]
-                = make_scalar4(new_vel.x, new_vel.y, new_vel.z, __int_as_scalar(cell));
-            }
-        else
-            {
-            h_vel_embed->data[idx] = make_scalar4(new_vel.x, new_vel.y, new_vel.z, mass);
-            }
+                // perform the rotation in double precision
+                double3 new_vel
+                    = mpcd::detail::rotateVelocity(vel, rot_vec, cos_a, one_minus_cos_a, sin_a);
+
+                // rescale the temperature if thermostatting is enabled
+                if (use_thermostat)
+                    {
+                    double factor = h_factors->data[cell];
+                    new_vel.x *= factor;
+                    new_vel.y *= factor;
+                    new_vel.z *= factor;
+                    }
+
+                new_vel.x += avg_vel.x;
+                new_vel.y += avg_vel.y;
+                new_vel.z += avg_vel.z;
+
+                // set the new velocity
+                if (cur_p < N_mpcd)
+                    {
+                    h_vel.data[cur_p]
+                        = make_scalar4(new_vel.x, new_vel.y, new_vel.z, __int_as_scalar(cell));
+                    }
+                else
+                    {
+                    h_vel_embed->data[idx] = make_scalar4(new_vel.x, new_vel.y, new_vel.z, mass);
+                    }
+                }
+        });
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * The cell center-of-mass velocity (and temperature, if the thermostat is enabled) is computed from
+ * the particles in each cell, and then the particles in that cell are immediately rotated while
+ * their velocities are still cached. This replaces the separate passes of the
+ * CellThermoCompute, drawRotationVectors(), and rotate(), and gives the same result.
+ */
+void mpcd::SRDCollisionMethod::collideFused(uint64_t timestep)
+    {
+    // cell list
+    const Index3D& ci = m_cl->getCellIndexer();
+    const Index3D& global_ci = m_cl->getGlobalCellIndexer();
+    const Index2D& cli = m_cl->getCellListIndexer();
+    ArrayHandle<unsigned int> h_cell_list(m_cl->getCellList(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> h_cell_np(m_cl->getCellSizeArray(),
+                                        access_location::host,
+                                        access_mode::read);
+
+    // MPCD particle data
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    const double mpcd_mass = m_mpcd_pdata->getMass();
+
+    // embedded particle data
+    std::unique_ptr<ArrayHandle<Scalar4>> h_vel_embed;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_group;
+    if (m_embed_group)
+        {
+        h_embed_group.reset(new ArrayHandle<unsigned int>(m_embed_group->getIndexArray(),
+                                                          access_location::host,
+                                                          access_mode::read));
+        h_vel_embed.reset(new ArrayHandle<Scalar4>(m_pdata->getVelocities(),
+                                                   access_location::host,
+                                                   access_mode::readwrite));
+        }
+
+    // rotation vectors and optional scale factors
+    ArrayHandle<double3> h_rotvec(m_rotvec, access_location::host, access_mode::overwrite);
+    const bool use_thermostat = (m_T) ? true : false;
+    std::unique_ptr<ArrayHandle<double>> h_factors;
+    Scalar T_set(1.0);
+    if (use_thermostat)
+        {
+        h_factors.reset(
+            new ArrayHandle<double>(m_factors, access_location::host, access_mode::overwrite));
+        T_set = (*m_T)(timestep);
         }
+
+    const double angle_rad = m_angle * M_PI / 180.0;
+    const double cos_a = slow::cos(angle_rad);
+    const double one_minus_cos_a = 1.0 - cos_a;
+    const double sin_a = slow::sin(angle_rad);
+    const unsigned int ndim = m_sysdef->getNDimensions();
+
+    // cells do not share particles, so they can be collided independently by the threads
+    ThreadPool& pool = m_exec_conf->getThreadPool();
+    pool.parallelFor(
+        ci.getNumElements(),
+        [&](unsigned int thread_id, unsigned int begin, unsigned int end)
+        {
+            for (unsigned int idx = begin; idx < end; ++idx)
+                {
+                const unsigned int np = h_cell_np.data[idx];
+
+                // sum the momentum, mass, and kinetic energy of the cell
+                double4 momentum = make_double4(0.0, 0.0, 0.0, 0.0);
+                double ke(0.0);
+                for (unsigned int offset = 0; offset < np; ++offset)
+                    {
+                    const unsigned int cur_p = h_cell_list.data[cli(offset, idx)];
+                    Scalar4 vel_i;
+                    double mass_i;
+                    if (cur_p < N_mpcd)
+                        {
+                        vel_i = h_vel.data[cur_p];
+                        mass_i = mpcd_mass;
+                        }
+                    else
+                        {
+                        vel_i = h_vel_embed->data[h_embed_group->data[cur_p - N_mpcd]];
+                        mass_i = vel_i.w;
+                        }
+
+                    momentum.x += mass_i * vel_i.x;
+                    momentum.y += mass_i * vel_i.y;
+                    momentum.z += mass_i * vel_i.z;
+                    momentum.w += mass_i;
+                    if (use_thermostat)
+                        {
+                        ke += 0.5 * mass_i
+                              * (double(vel_i.x) * vel_i.x + double(vel_i.y) * vel_i.y
+                                 + double(vel_i.z) * vel_i.z);
+                        }
+                    }
+
+                const double mass = momentum.w;
+                double3 avg_vel = make_double3(0.0, 0.0, 0.0);
+                if (mass > 0.)
+                    {
+                    avg_vel.x = momentum.x / mass;
+                    avg_vel.y = momentum.y / mass;
+                    avg_vel.z = momentum.z / mass;
+                    }
+
+                double3 cell_energy = make_double3(0.0, 0.0, __int_as_double(np));
+                if (use_thermostat && np > 1)
+                    {
+                    const double ke_cm = 0.5 * mass
+                                         * (avg_vel.x * avg_vel.x + avg_vel.y * avg_vel.y
+                                            + avg_vel.z * avg_vel.z);
+                    cell_energy.y = 2. * (ke - ke_cm) / (ndim * (np - 1));
+                    }
+
+                // draw the rotation vector of the cell
+                const uint3 cell = ci.getTriple(idx);
+                const int3 global_cell = m_cl->getGlobalCell(make_int3(cell.x, cell.y, cell.z));
+                double3 rot_vec;
+                double factor;
+                drawCellRotation(timestep,
+                                 global_ci(global_cell.x, global_cell.y, global_cell.z),
+                                 cell_energy,
+                                 T_set,
+                                 rot_vec,
+                                 factor);
+                h_rotvec.data[idx] = rot_vec;
+                if (use_thermostat)
+                    {
+                    h_factors->data[idx] = factor;
+                    }
+
+                // rotate the velocities of the particles in the cell
+                for (unsigned int offset = 0; offset < np; ++offset)
+                    {
+                    const unsigned int cur_p = h_cell_list.data[cli(offset, idx)];
+                    Scalar4& vel_i
+                        = (cur_p < N_mpcd) ? h_vel.data[cur_p]
+                                           : h_vel_embed->data[h_embed_group->data[cur_p - N_mpcd]];
+                    const double3 vel = make_double3(vel_i.x - avg_vel.x,
+                                                     vel_i.y - avg_vel.y,
+                                                     vel_i.z - avg_vel.z);
+
+                    double3 new_vel = mpcd::detail::rotateVelocity(vel,
+                                                                   rot_vec,
+                                                                   cos_a,
+                                                                   one_minus_cos_a,
+                                                                   sin_a);
+                    new_vel.x = factor * new_vel.x + avg_vel.x;
+                    new_vel.y = factor * new_vel.y + avg_vel.y;
+                    new_vel.z = factor * new_vel.z + avg_vel.z;
+
+                    vel_i = make_scalar4(new_vel.x, new_vel.y, new_vel.z, vel_i.w);
+                    }
+                }
+        });
     }
 
 void mpcd::SRDCollisionMethod::setCellList(std::shared_ptr<mpcd::CellList> cl)
@@ -280,6 +540,9 @@ void mpcd::SRDCollisionMethod::attachCallbacks()
     m_thermo->getFlagsSignal()
         .connect<mpcd::SRDCollisionMethod, &mpcd::SRDCollisionMethod::getRequestedThermoFlags>(
             this);
+    m_thermo->getCallbackSignal()
+        .connect<mpcd::SRDCollisionMethod,
+                 &mpcd::SRDCollisionMethod::drawRotationVectorsOverlapped>(this);
     }
 
 void mpcd::SRDCollisionMethod::detachCallbacks()
@@ -289,6 +552,9 @@ void mpcd::SRDCollisionMethod::detachCallbacks()
         m_thermo->getFlagsSignal()
             .disconnect<mpcd::SRDCollisionMethod,
                         &mpcd::SRDCollisionMethod::getRequestedThermoFlags>(this);
+        m_thermo->getCallbackSignal()
+            .disconnect<mpcd::SRDCollisionMethod,
+                        &mpcd::SRDCollisionMethod::drawRotationVectorsOverlapped>(this);
         }
     }
 
@@ -99,6 +99,7 @@ class PYBIND11_EXPORT SRDCollisionMethod : public mpcd::CollisionMethod
 
     std::shared_ptr<Variant> m_T; //!< Temperature for thermostat
     GPUVector<double> m_factors;  //!< Cell-level rescale factors
+    bool m_draw_pending;          //!< Flag if rotation vectors still need to be drawn
 
     //! Implementation of the collision rule
     void rule(uint64_t timestep) override;
@@ -106,9 +107,23 @@ class PYBIND11_EXPORT SRDCollisionMethod : public mpcd::CollisionMethod
     //! Randomly draw cell rotation vectors
     virtual void drawRotationVectors(uint64_t timestep);
 
+    //! Draw cell rotation vectors while cell properties are communicated
+    void drawRotationVectorsOverlapped(uint64_t timestep);
+
     //! Apply rotation matrix to velocities
     virtual void rotate(uint64_t timestep);
 
+    //! Compute the cell properties and rotate the velocities in one pass
+    void collideFused(uint64_t timestep);
+
+    //! Draw the rotation vector and thermostat rescale factor for a cell
+    void drawCellRotation(uint64_t timestep,
+                          unsigned int global_idx,
+                          const double3& cell_energy,
+                          Scalar T_set,
+                          double3& rotvec,
+                          double& factor);
+
     //! Attach callback signals
     void attachCallbacks();
 
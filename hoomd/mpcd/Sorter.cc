@@ -15,7 +15,7 @@ namespace hoomd
  */
 mpcd::Sorter::Sorter(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<Trigger> trigger)
     : Tuner(sysdef, trigger), m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_order(m_exec_conf),
-      m_rorder(m_exec_conf)
+      m_rorder(m_exec_conf), m_min_disorder(0), m_num_unordered(0), m_num_checked(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD Sorter" << std::endl;
     }
@@ -25,10 +25,47 @@ mpcd::Sorter::~Sorter()
     m_exec_conf->msg->notice(5) << "Destroying MPCD Sorter" << std::endl;
     }
 
+/*!
+ * \param min_disorder Fraction of particles out of cell order needed to sort
+ */
+void mpcd::Sorter::setMinDisorder(Scalar min_disorder)
+    {
+    if (min_disorder < Scalar(0) || min_disorder > Scalar(1))
+        {
+        throw std::domain_error("MPCD sorter min_disorder must be between 0 and 1");
+        }
+    m_min_disorder = min_disorder;
+    }
+
+/*!
+ * \returns Fraction of all MPCD particles that were out of cell order at the last update
+ */
+Scalar mpcd::Sorter::getDisorder()
+    {
+    unsigned long long counts[2] = {m_num_unordered, m_num_checked};
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      counts,
+                      2,
+                      MPI_UNSIGNED_LONG_LONG,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+    return (counts[1] > 0) ? Scalar(counts[0]) / Scalar(counts[1]) : Scalar(0);
+    }
+
 /*!
  * \param timestep Current simulation timestep
  *
  * This method is just a driver for the computeOrder() and applyOrder() methods.
+ *
+ * When a minimum disorder is set, the cell list is computed first and the sort is skipped
+ * if fewer than that fraction of the particles on this rank are out of cell order. The cell
+ * list is reused by the collision at the same timestep, so the check costs one pass over
+ * the particles.
  */
 void mpcd::Sorter::update(uint64_t timestep)
     {
@@ -37,6 +74,15 @@ void mpcd::Sorter::update(uint64_t timestep)
         throw std::runtime_error("Cell list has not been set");
         }
 
+    if (m_min_disorder > Scalar(0))
+        {
+        measureDisorder(timestep);
+        if (Scalar(m_num_unordered) < m_min_disorder * Scalar(m_num_checked))
+            {
+            return;
+            }
+        }
+
     // resize the sorted order vector to the current number of particles
     m_order.resize(m_mpcd_pdata->getN());
     m_rorder.resize(m_mpcd_pdata->getN());
@@ -49,6 +95,31 @@ void mpcd::Sorter::update(uint64_t timestep)
     m_mpcd_pdata->notifySort(timestep, m_order, m_rorder);
     }
 
+/*!
+ * \param timestep Current timestep
+ *
+ * The cell list stores the cell of each particle in the last element of its velocity. A
+ * particle is out of order when its cell comes before the cell of the particle preceding it
+ * in memory, which is never the case right after a sort.
+ */
+void mpcd::Sorter::measureDisorder(uint64_t timestep)
+    {
+    m_cl->compute(timestep);
+
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::read);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN();
+    unsigned int num_unordered = 0;
+    for (unsigned int idx = 1; idx < N_mpcd; ++idx)
+        {
+        if (__scalar_as_int(h_vel.data[idx].w) < __scalar_as_int(h_vel.data[idx - 1].w))
+            ++num_unordered;
+        }
+    m_num_unordered = num_unordered;
+    m_num_checked = N_mpcd;
+    }
+
 /*!
  * \param timestep Current timestep
  *
@@ -161,7 +232,9 @@ namespace detail
 void export_Sorter(pybind11::module& m)
     {
     pybind11::class_<mpcd::Sorter, Tuner, std::shared_ptr<mpcd::Sorter>>(m, "Sorter")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
+        .def_property("min_disorder", &mpcd::Sorter::getMinDisorder, &mpcd::Sorter::setMinDisorder)
+        .def_property_readonly("disorder", &mpcd::Sorter::getDisorder);
     }
     } // namespace detail
     } // namespace mpcd
@@ -60,6 +60,18 @@ class PYBIND11_EXPORT Sorter : public Tuner
             }
         }
 
+    //! Get the fraction of particles out of cell order needed to sort
+    Scalar getMinDisorder() const
+        {
+        return m_min_disorder;
+        }
+
+    //! Set the fraction of particles out of cell order needed to sort
+    void setMinDisorder(Scalar min_disorder);
+
+    //! Get the fraction of particles that were out of cell order at the last update
+    Scalar getDisorder();
+
     protected:
     std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata; //!< MPCD particle data
     std::shared_ptr<mpcd::CellList> m_cl;             //!< MPCD cell list
@@ -67,6 +79,13 @@ class PYBIND11_EXPORT Sorter : public Tuner
     GPUVector<unsigned int> m_order;  //!< Maps new sorted index onto old particle indexes
     GPUVector<unsigned int> m_rorder; //!< Maps old particle indexes onto new sorted indexes
 
+    Scalar m_min_disorder;        //!< Fraction of particles out of order needed to sort
+    unsigned int m_num_unordered; //!< Number of particles out of order at the last update
+    unsigned int m_num_checked;   //!< Number of particles checked at the last update
+
+    //! Count the particles that are out of cell order
+    virtual void measureDisorder(uint64_t timestep);
+
     //! Compute the sorting order at the current timestep
     virtual void computeOrder(uint64_t timestep);
 
@@ -104,6 +104,21 @@ class __attribute__((visibility("default"))) SphereGeometry
         return dot(pos, pos) > m_R2;
         }
 
+    //! Check if an axis-aligned box lies completely inside the geometry
+    /*!
+     * \param lo Lower corner of the box
+     * \param hi Upper corner of the box
+     * \returns True if no point in the box is out of bounds, and false if any point may be
+     */
+    HOSTDEVICE bool isInsideBox(const Scalar3& lo, const Scalar3& hi) const
+        {
+        // the corner farthest from the center must be inside
+        const Scalar3 r_far = make_scalar3(fmax(fabs(lo.x), fabs(hi.x)),
+                                           fmax(fabs(lo.y), fabs(hi.y)),
+                                           fmax(fabs(lo.z), fabs(hi.z)));
+        return dot(r_far, r_far) <= m_R2;
+        }
+
     //! Add a contribution to random virtual particle velocity.
     /*!
      * \param vel Velocity of virtual particle
@@ -17,7 +17,8 @@ mpcd::VirtualParticleFiller::VirtualParticleFiller(std::shared_ptr<SystemDefinit
                                                    Scalar density,
                                                    std::shared_ptr<Variant> T)
     : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
-      m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_density(density), m_T(T)
+      m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_density(density), m_T(T),
+      m_cache_positions(false)
     {
     setType(type);
 
@@ -101,7 +102,10 @@ void export_VirtualParticleFiller(pybind11::module& m)
                       &mpcd::VirtualParticleFiller::setType)
         .def_property("kT",
                       &mpcd::VirtualParticleFiller::getTemperature,
-                      &mpcd::VirtualParticleFiller::setTemperature);
+                      &mpcd::VirtualParticleFiller::setTemperature)
+        .def_property("cache_positions",
+                      &mpcd::VirtualParticleFiller::getCachePositions,
+                      &mpcd::VirtualParticleFiller::setCachePositions);
     }
     } // namespace detail
     } // namespace mpcd
@@ -78,6 +78,22 @@ class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
         m_cl = cl;
         }
 
+    //! Get the flag to reuse drawn virtual particle positions
+    bool getCachePositions() const
+        {
+        return m_cache_positions;
+        }
+
+    //! Set the flag to reuse drawn virtual particle positions
+    /*!
+     * \param cache_positions If true, fillers that can reuse the positions they drew at the
+     *                        last fill only redraw the velocities.
+     */
+    void setCachePositions(bool cache_positions)
+        {
+        m_cache_positions = cache_positions;
+        }
+
     protected:
     std::shared_ptr<SystemDefinition> m_sysdef;                //!< HOOMD system definition
     std::shared_ptr<hoomd::ParticleData> m_pdata;              //!< HOOMD particle data
@@ -89,6 +105,7 @@ class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
     unsigned int m_type;          //!< Fill type
     std::shared_ptr<Variant> m_T; //!< Temperature for filled particles
     unsigned int m_filler_id;     //!< Unique ID of this filler
+    bool m_cache_positions;       //!< If true, reuse drawn positions when possible
 
     unsigned int computeFirstTag(unsigned int N_fill) const;
 
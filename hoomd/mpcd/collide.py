@@ -128,6 +128,14 @@ class CollisionMethod(Operation):
                 will not be correctly transferred to the body. Support for this
                 is planned in future.
 
+        fused (bool): When True, compute the cell properties and apply the
+            collision in a single pass over the cell list (*default*:
+            ``False``).
+
+            The fused collision gives the same result with less memory
+            traffic. It is only implemented on the CPU, and it is ignored on
+            the GPU and in simulations with more than one MPI rank.
+
         period (int): Number of integration steps between collisions
             (*read only*).
 
@@ -153,6 +161,11 @@ class CollisionMethod(Operation):
         HOOMD particles to include in collision.
         `Read more... <hoomd.mpcd.collide.CollisionMethod.embedded_particles>`
 
+    .. py:attribute:: fused
+
+        Compute the cell properties and collide in a single pass.
+        `Read more... <hoomd.mpcd.collide.CollisionMethod.fused>`
+
     .. py:attribute:: period
 
         Number of integration steps between collisions.
@@ -166,6 +179,7 @@ class CollisionMethod(Operation):
         param_dict = ParameterDict(
             period=int(period),
             embedded_particles=OnlyTypes(hoomd.filter.ParticleFilter, allow_none=True),
+            fused=False,
         )
         param_dict["embedded_particles"] = embedded_particles
         self._param_dict.update(param_dict)
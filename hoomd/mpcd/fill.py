@@ -129,11 +129,25 @@ class GeometryFiller(VirtualParticleFiller):
         density (float): Particle number density.
         kT (hoomd.variant.variant_like): Temperature of particles.
         geometry (hoomd.mpcd.geometry.Geometry): Surface to fill around.
+        cache_positions (bool): If True, reuse the virtual particle positions
+            between fills when possible.
 
     Virtual particles are inserted in cells whose volume is sliced by the
     specified `geometry`. The algorithm for doing the filling depends on the
     specific `geometry`.
 
+    Geometries without a specialized filler (e.g.,
+    :class:`~hoomd.mpcd.geometry.Sphere`) draw positions uniformly in the box
+    and reject the ones inside the `geometry`. When `cache_positions` is True,
+    these fillers keep the accepted positions and only draw new velocities at
+    later fills, which skips the rejection sampling. The positions are drawn
+    again whenever the box, `density`, `type`, or `geometry` changes. The
+    virtual particles then do not move between fills, but the random grid
+    shift still bins them differently into the collision cells. Fillers for
+    :class:`~hoomd.mpcd.geometry.ParallelPlates` and
+    :class:`~hoomd.mpcd.geometry.PlanarPore` only fill the sliced cells and
+    ignore `cache_positions`.
+
     .. rubric:: Limitations:
 
     This filler **does not** currently support triclinic boxes for any
@@ -160,6 +174,15 @@ class GeometryFiller(VirtualParticleFiller):
     **Members defined in** `GeometryFiller`:
 
     Attributes:
+        cache_positions (bool): If True, reuse the virtual particle positions
+            between fills when possible.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filler.cache_positions = True
+
         geometry (hoomd.mpcd.geometry.Geometry): Surface to fill around
             (*read only*).
     """
@@ -167,11 +190,12 @@ class GeometryFiller(VirtualParticleFiller):
     __doc__ = __doc__.replace("{inherited}", VirtualParticleFiller._doc_inherited)
     _cpp_class_map = {}
 
-    def __init__(self, type, density, kT, geometry):
+    def __init__(self, type, density, kT, geometry, cache_positions=False):
         super().__init__(type, density, kT)
 
         param_dict = ParameterDict(
             geometry=Geometry,
+            cache_positions=bool(cache_positions),
         )
         param_dict["geometry"] = geometry
         self._param_dict.update(param_dict)
@@ -1,6 +1,7 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import numpy as np
 import pytest
 
 import hoomd
@@ -130,3 +131,73 @@ class TestCollisionMethod:
             period=1, embedded_particles=hoomd.filter.All(), **init_args
         )
         sim.run(1)
+
+    def test_fused(self, small_snap, simulation_factory, cls, init_args):
+        if small_snap.communicator.rank == 0:
+            rng = np.random.default_rng(42)
+            small_snap.configuration.box = [4, 4, 4, 0, 0, 0]
+            small_snap.particles.velocity[:] = [0.5, -0.25, 0.1]
+            small_snap.mpcd.N = 200
+            small_snap.mpcd.position[:] = rng.uniform(-2, 2, (200, 3))
+            small_snap.mpcd.velocity[:] = rng.normal(0, 1, (200, 3))
+        if "kT" not in init_args:
+            init_args["kT"] = 1.5
+
+        # the fused collision gives the same velocities as the split one
+        velocities = []
+        for fused in (False, True):
+            sim = simulation_factory(small_snap)
+            cm = cls(period=1, embedded_particles=hoomd.filter.All(), **init_args)
+            cm.fused = fused
+            sim.operations.integrator = hoomd.mpcd.Integrator(
+                dt=0.02, collision_method=cm
+            )
+            sim.run(1)
+            assert cm.fused == fused
+
+            snap = sim.state.get_snapshot()
+            if snap.communicator.rank == 0:
+                velocities.append(
+                    np.concatenate([snap.mpcd.velocity, snap.particles.velocity])
+                )
+
+        if small_snap.communicator.rank == 0:
+            np.testing.assert_allclose(
+                velocities[1], velocities[0], rtol=1e-5, atol=1e-6
+            )
+
+    @pytest.mark.cpu
+    @pytest.mark.serial
+    def test_threads(
+        self, small_snap, simulation_factory, num_cpu_threads, cls, init_args
+    ):
+        if small_snap.communicator.rank == 0:
+            rng = np.random.default_rng(7)
+            small_snap.configuration.box = [6, 6, 6, 0, 0, 0]
+            small_snap.mpcd.N = 1000
+            small_snap.mpcd.position[:] = rng.uniform(-3, 3, (1000, 3))
+            small_snap.mpcd.velocity[:] = rng.normal(0, 1, (1000, 3))
+        if "kT" not in init_args:
+            init_args["kT"] = 1.5
+
+        # streaming, binning, and collisions do not depend on the number of threads
+        for fused in (False, True):
+            snapshots = []
+            for _ in num_cpu_threads():
+                sim = simulation_factory(small_snap)
+                cm = cls(period=1, **init_args)
+                cm.fused = fused
+                sim.operations.integrator = hoomd.mpcd.Integrator(
+                    dt=0.02,
+                    collision_method=cm,
+                    streaming_method=hoomd.mpcd.stream.Bulk(period=1),
+                )
+                sim.run(5)
+                snapshots.append(sim.state.get_snapshot())
+
+            np.testing.assert_array_equal(
+                snapshots[1].mpcd.position, snapshots[0].mpcd.position
+            )
+            np.testing.assert_array_equal(
+                snapshots[1].mpcd.velocity, snapshots[0].mpcd.velocity
+            )
@@ -89,6 +89,27 @@ class TestGeometryFiller:
         sim.operations.integrator = ig
         sim.run(1)
 
+    def test_cache_positions(self, simulation_factory, snap, cls, init_args):
+        filler = hoomd.mpcd.fill.GeometryFiller(
+            type="A", density=5.0, kT=1.0, geometry=cls(**init_args)
+        )
+        assert not filler.cache_positions
+        filler.cache_positions = True
+        assert filler.cache_positions
+
+        sim = simulation_factory(snap)
+        ig = hoomd.mpcd.Integrator(dt=0.1, virtual_particle_fillers=[filler])
+        ig.collision_method = hoomd.mpcd.collide.StochasticRotationDynamics(
+            period=1, angle=130
+        )
+        sim.operations.integrator = ig
+        sim.run(2)
+        assert filler.cache_positions
+
+        # changing the density draws new positions
+        filler.density = 3.0
+        sim.run(1)
+
     def test_pickling(self, simulation_factory, snap, cls, init_args):
         geom = cls(**init_args)
         filler = hoomd.mpcd.fill.GeometryFiller(
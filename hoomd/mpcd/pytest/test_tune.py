@@ -35,6 +35,28 @@ class TestParticleSorter:
         sim.run(0)
         assert sorter.trigger is trigger
 
+    def test_min_disorder(self, simulation_factory, snap):
+        sim = simulation_factory(snap)
+
+        sorter = hoomd.mpcd.tune.ParticleSorter(trigger=1)
+        assert sorter.min_disorder == 0.0
+        sorter.min_disorder = 0.5
+        assert sorter.min_disorder == 0.5
+
+        ig = hoomd.mpcd.Integrator(dt=0.02, mpcd_particle_sorter=sorter)
+        sim.operations.integrator = ig
+        sim.run(0)
+        assert sorter.min_disorder == 0.5
+
+        # a single particle is always in order
+        sim.run(2)
+        assert sorter.disorder == 0.0
+
+        sorter.min_disorder = 0.1
+        assert sorter.min_disorder == 0.1
+        with pytest.raises(ValueError):
+            sorter.min_disorder = 2.0
+
     def test_pickling(self, simulation_factory, snap):
         sorter = hoomd.mpcd.tune.ParticleSorter(trigger=5)
         pickling_check(sorter)
@@ -271,6 +271,114 @@ void celllist_small_test(std::shared_ptr<ExecutionConfiguration> exec_conf,
     UP_ASSERT_EXCEPTION(std::runtime_error, [&] { cl->compute(4); });
     }
 
+//! Test that the cell list is updated correctly when only a few particles change cells
+template<class CL> void celllist_update_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    auto box = std::make_shared<BoxDim>(2.0);
+
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = box;
+    snap->particle_data.type_mapping.push_back("A");
+    // place each particle in a different cell, doubling the first cell
+    snap->mpcd_data.resize(9);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.5, -0.5, -0.5);
+    snap->mpcd_data.position[1] = vec3<Scalar>(0.5, -0.5, -0.5);
+    snap->mpcd_data.position[2] = vec3<Scalar>(-0.5, 0.5, -0.5);
+    snap->mpcd_data.position[3] = vec3<Scalar>(0.5, 0.5, -0.5);
+    snap->mpcd_data.position[4] = vec3<Scalar>(-0.5, -0.5, 0.5);
+    snap->mpcd_data.position[5] = vec3<Scalar>(0.5, -0.5, 0.5);
+    snap->mpcd_data.position[6] = vec3<Scalar>(-0.5, 0.5, 0.5);
+    snap->mpcd_data.position[7] = vec3<Scalar>(0.5, 0.5, 0.5);
+    snap->mpcd_data.position[8] = vec3<Scalar>(-0.5, -0.5, -0.5);
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    std::shared_ptr<mpcd::ParticleData> pdata_9 = sysdef->getMPCDParticleData();
+
+    std::shared_ptr<mpcd::CellList> cl(new CL(sysdef, make_uint3(2, 2, 2), false));
+    cl->compute(0);
+
+        // move one particle into the first cell, and move another within its cell
+        {
+        ArrayHandle<Scalar4> h_pos(pdata_9->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        h_pos.data[1] = make_scalar4(-0.5, -0.6, -0.4, __int_as_scalar(0));
+        h_pos.data[7] = make_scalar4(0.6, 0.6, 0.6, __int_as_scalar(0));
+        }
+    cl->compute(1);
+        {
+        ArrayHandle<unsigned int> h_cell_np(cl->getCellSizeArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_cell_list(cl->getCellList(),
+                                              access_location::host,
+                                              access_mode::read);
+
+        Index3D ci = cl->getCellIndexer();
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(0, 0, 0)], 3);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(1, 0, 0)], 0);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(0, 1, 0)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(1, 1, 0)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(0, 0, 1)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(1, 0, 1)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(0, 1, 1)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(1, 1, 1)], 1);
+
+        Index2D cli = cl->getCellListIndexer();
+        std::vector<unsigned int> pids(3, 0);
+        for (unsigned int i = 0; i < 3; ++i)
+            {
+            pids[i] = h_cell_list.data[cli(i, ci(0, 0, 0))];
+            }
+        sort(pids.begin(), pids.end());
+        unsigned int check_pids[] = {0, 1, 8};
+        UP_ASSERT_EQUAL(pids, check_pids);
+        CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(1, 1, 1))], 7);
+
+        ArrayHandle<Scalar4> h_vel(pdata_9->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[1].w), ci(0, 0, 0));
+        CHECK_EQUAL_UINT(__scalar_as_int(h_vel.data[7].w), ci(1, 1, 1));
+        }
+
+        // move the particle back out, and move a second one into a cell that is already occupied
+        {
+        ArrayHandle<Scalar4> h_pos(pdata_9->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        h_pos.data[1] = make_scalar4(0.5, -0.5, -0.5, __int_as_scalar(0));
+        h_pos.data[0] = make_scalar4(0.5, 0.5, 0.5, __int_as_scalar(0));
+        }
+    cl->compute(2);
+        {
+        ArrayHandle<unsigned int> h_cell_np(cl->getCellSizeArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_cell_list(cl->getCellList(),
+                                              access_location::host,
+                                              access_mode::read);
+
+        Index3D ci = cl->getCellIndexer();
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(0, 0, 0)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(1, 0, 0)], 1);
+        CHECK_EQUAL_UINT(h_cell_np.data[ci(1, 1, 1)], 2);
+
+        Index2D cli = cl->getCellListIndexer();
+        CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(0, 0, 0))], 8);
+        CHECK_EQUAL_UINT(h_cell_list.data[cli(0, ci(1, 0, 0))], 1);
+        std::vector<unsigned int> pids(2, 0);
+        for (unsigned int i = 0; i < 2; ++i)
+            {
+            pids[i] = h_cell_list.data[cli(i, ci(1, 1, 1))];
+            }
+        sort(pids.begin(), pids.end());
+        unsigned int check_pids[] = {0, 7};
+        UP_ASSERT_EQUAL(pids, check_pids);
+        }
+    }
+
 //! Test that particles can be grid shifted correctly
 template<class CL>
 void celllist_grid_shift_test(std::shared_ptr<ExecutionConfiguration> exec_conf,
@@ -716,6 +824,13 @@ UP_TEST(mpcd_cell_list_small_test_triclinic)
         make_scalar3(0.5, -0.75, 1.0));
     }
 
+//! update test case for MPCD CellList class
+UP_TEST(mpcd_cell_list_update_test)
+    {
+    celllist_update_test<mpcd::CellList>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
+    }
+
 //! grid shift test case for MPCD CellList class
 UP_TEST(mpcd_cell_list_grid_shift_test)
     {
@@ -825,6 +940,13 @@ UP_TEST(mpcd_cell_list_gpu_small_test_triclinic)
         make_scalar3(0.5, -0.75, 1.0));
     }
 
+//! update test case for MPCD CellListGPU class
+UP_TEST(mpcd_cell_list_gpu_update_test)
+    {
+    celllist_update_test<mpcd::CellListGPU>(
+        std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::GPU));
+    }
+
 //! grid shift test case for MPCD CellListGPU class
 UP_TEST(mpcd_cell_list_gpu_grid_shift_test)
     {
@@ -11,6 +11,8 @@ their correctness.
 """
 
 import hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.logging import log
 from hoomd.mpcd import _mpcd
 from hoomd.operation import TriggeredOperation
 
@@ -21,6 +23,8 @@ class ParticleSorter(TriggeredOperation):
     Args:
         trigger (hoomd.trigger.trigger_like): Select the time steps on which to
             sort.
+        min_disorder (float): Fraction of particles that must be out of cell
+            order for a sort to be performed.
 
     This tuner sorts the MPCD particles into cell order. To perform the sort,
     the cell list is first computed with the current particle order. Particles
@@ -42,18 +46,50 @@ class ParticleSorter(TriggeredOperation):
     Essentially all MPCD systems benefit from sorting, so it is recommended
     to use one for all simulations!
 
+    When `min_disorder` is greater than zero, the sorter checks how many
+    particles are out of cell order on each time step selected by `trigger`
+    and skips the sort when fewer than that fraction are. This lets a short
+    `trigger` period adapt to how quickly the particles actually mix: the
+    sort runs often when particles move between cells quickly and rarely
+    when they do not. The check is made independently on each MPI rank.
+
     .. rubric:: Example:
 
     .. code-block:: python
 
         sorter = hoomd.mpcd.tune.ParticleSorter(trigger=20)
         simulation.operations.integrator.mpcd_particle_sorter = sorter
+
+    .. rubric:: Example: Sort only when particles are out of order
+
+    .. code-block:: python
+
+        sorter = hoomd.mpcd.tune.ParticleSorter(trigger=5, min_disorder=0.1)
+        simulation.operations.integrator.mpcd_particle_sorter = sorter
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `ParticleSorter`:
+
+    Attributes:
+        min_disorder (float): Fraction of particles that must be out of cell
+            order for a sort to be performed.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                sorter.min_disorder = 0.2
     """
 
-    __doc__ += TriggeredOperation._doc_inherited
+    __doc__ = __doc__.replace("{inherited}", TriggeredOperation._doc_inherited)
 
-    def __init__(self, trigger):
+    def __init__(self, trigger, min_disorder=0.0):
         super().__init__(trigger)
+        param_dict = ParameterDict(min_disorder=float(min_disorder))
+        self._param_dict.update(param_dict)
 
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.GPU):
@@ -62,6 +98,16 @@ class ParticleSorter(TriggeredOperation):
             class_ = _mpcd.Sorter
         self._cpp_obj = class_(self._simulation.state._cpp_sys_def, self.trigger)
 
+    @log(requires_run=True)
+    def disorder(self):
+        """float: Fraction of particles out of cell order at the last check.
+
+        The fraction is measured on each time step selected by `trigger`,
+        before any sort on that step. It is only measured when `min_disorder`
+        is greater than zero.
+        """
+        return self._cpp_obj.disorder
+
 
 __all__ = [
     "ParticleSorter",
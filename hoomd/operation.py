@@ -23,7 +23,7 @@ import itertools
 import weakref
 
 import hoomd
-from hoomd.logging import Loggable
+from hoomd.logging import Loggable, log
 from hoomd.data.parameterdicts import ParameterDict
 
 
@@ -315,19 +315,28 @@ class _HOOMDBaseObject(_HOOMDGetSetAttrBase, _DependencyRelation, metaclass=Logg
                 )
             return
         self._simulation = simulation
-        try:
-            self._attach_hook()
-        except hoomd.error.SimulationDefinitionError as err:
-            self._use_count -= 1
-            raise err
-        try:
-            self._apply_param_dict()
-            self._apply_typeparam_dict(self._cpp_obj, self._simulation)
-        except Exception as err:
-            raise type(err)(
-                f"Error applying parameters for object of type {type(self)}."
-            ) from err
-        self._post_attach_hook()
+
+        # account internal arrays allocated while attaching to this object
+        device = simulation.device
+        self._memory_tag = device._cpp_exec_conf.addMemoryTag(
+            type(self).__name__
+        )
+        with device._memory_scope(self._memory_tag):
+            try:
+                self._attach_hook()
+            except hoomd.error.SimulationDefinitionError as err:
+                self._use_count -= 1
+                raise err
+            if hasattr(self._cpp_obj, "setMemoryTag"):
+                self._cpp_obj.setMemoryTag(self._memory_tag)
+            try:
+                self._apply_param_dict()
+                self._apply_typeparam_dict(self._cpp_obj, self._simulation)
+            except Exception as err:
+                raise type(err)(
+                    f"Error applying parameters for object of type {type(self)}."
+                ) from err
+            self._post_attach_hook()
 
     @property
     def _attached(self):
@@ -546,6 +555,102 @@ class Operation(AutotunedObject):
 
     __doc__ += AutotunedObject._doc_inherited
 
+    @log(default=False, requires_run=True)
+    def profile_walltime(self):
+        """float: Total wall clock time spent in this operation (s).
+
+        Available when `hoomd.Simulation.profiling` is enabled. The time
+        accumulates over all calls to `hoomd.Simulation.run` while profiling is
+        enabled. For `hoomd.md.force.Force` objects, this is the time spent
+        computing forces. For neighbor lists, this is the time spent building
+        the list.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=["profile_walltime"])
+        """
+        return self._cpp_obj.getProfileTimer().total_time
+
+    @log(default=False, requires_run=True)
+    def profile_last_walltime(self):
+        """float: Wall clock time spent in the most recent call (s).
+
+        Available when `hoomd.Simulation.profiling` is enabled.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=["profile_last_walltime"])
+        """
+        return self._cpp_obj.getProfileTimer().last_time
+
+    @log(default=False, requires_run=True)
+    def profile_num_calls(self):
+        """int: Number of calls measured by `profile_walltime`.
+
+        Available when `hoomd.Simulation.profiling` is enabled.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=["profile_num_calls"])
+        """
+        return self._cpp_obj.getProfileTimer().num_calls
+
+    @log(category="object", default=False, requires_run=True)
+    def profile_kernel_time(self):
+        """dict[str, float]: Total GPU time spent in each autotuned kernel (s).
+
+        Available on the GPU when `hoomd.Simulation.profiling` is enabled. The
+        keys are the names of the kernels in `kernel_parameters`. GPU events
+        time each kernel launch, so the times exclude the host overhead and
+        the time the kernels wait in the queue.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=["profile_kernel_time"])
+        """
+        return self._cpp_obj.getKernelTimes()
+
+
+    @log(default=False, requires_run=True)
+    def memory_host_bytes(self):
+        """int: Host memory held by this operation's internal arrays (bytes).
+
+        Counts the memory on this MPI rank. Memory that the operation's arrays
+        allocate while other operations execute remains accounted to the
+        operation.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=["memory_host_bytes"])
+        """
+        exec_conf = self._simulation.device._cpp_exec_conf
+        return exec_conf.getMemoryBytes(self._memory_tag)[0]
+
+    @log(default=False, requires_run=True)
+    def memory_device_bytes(self):
+        """int: Device memory held by this operation's internal arrays (bytes).
+
+        Counts the memory on this MPI rank. Always 0 on the CPU.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=["memory_device_bytes"])
+        """
+        exec_conf = self._simulation.device._cpp_exec_conf
+        return exec_conf.getMemoryBytes(self._memory_tag)[1]
+
 
 class TriggeredOperation(Operation):
     """Operations that execute on timesteps determined by a trigger.
@@ -105,3 +105,107 @@ def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
 
     # the load balance should move the split place down toward the particles
     assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
+
+
+def test_weights(simulation_factory, two_particle_snapshot_factory):
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(1))
+    assert balance.md_particle_weight == 1.0
+    assert balance.mpcd_particle_weight == 0.0
+    assert balance.volume_weight == 0.0
+
+    balance.mpcd_particle_weight = 0.25
+    balance.volume_weight = 2.0
+    with pytest.raises(ValueError):
+        balance.md_particle_weight = -1.0
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.tuners.append(balance)
+    sim.run(0)
+    assert balance.md_particle_weight == 1.0
+    assert balance.mpcd_particle_weight == 0.25
+    assert balance.volume_weight == 2.0
+
+    balance.md_particle_weight = 0.5
+    assert balance.md_particle_weight == 0.5
+
+
+def test_balance_volume_weight(device, simulation_factory, lattice_snapshot_factory):
+    """Test that a dominant volume cost keeps the domains uniform."""
+    if device.communicator.num_ranks != 2:
+        pytest.skip("Test supports only 2 ranks")
+
+    snapshot = lattice_snapshot_factory()
+
+    # place all particles in the lower MPI domain, as in test_balance_action
+    box = list(snapshot.configuration.box)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[:, 2] -= box[2] / 2
+    box[2] *= 2
+    snapshot.configuration.box = box
+    sim = simulation_factory(snapshot, domain_decomposition=(1, 1, 2))
+
+    balance = hoomd.tune.LoadBalancer(
+        trigger=hoomd.trigger.Periodic(1), volume_weight=1e6
+    )
+    sim.operations.tuners.append(balance)
+    sim.run(1)
+
+    # the domains have equal volume, so the cost is balanced already
+    assert sim.state.domain_decomposition_split_fractions == ([], [], [0.5])
+
+
+def test_timing(simulation_factory, two_particle_snapshot_factory):
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(1))
+    assert not balance.timing
+    assert balance.damping == 0.5
+
+    balance.timing = True
+    balance.damping = 0.75
+    with pytest.raises(ValueError):
+        balance.damping = 1.0
+    with pytest.raises(ValueError):
+        balance.damping = -0.5
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.tuners.append(balance)
+    sim.run(0)
+    assert balance.timing
+    assert balance.damping == 0.75
+
+    balance.damping = 0.0
+    assert balance.damping == 0.0
+
+
+@pytest.mark.skipif(not hoomd.version.md_built, reason="BUILD_MD=on required")
+def test_balance_timing(device, simulation_factory, lattice_snapshot_factory):
+    """Test that balancing by the measured time runs with profiling enabled."""
+    if device.communicator.num_ranks != 2:
+        pytest.skip("Test supports only 2 ranks")
+
+    snapshot = lattice_snapshot_factory(a=1.2, n=6)
+
+    # place all particles in the lower MPI domain, as in test_balance_action
+    box = list(snapshot.configuration.box)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[:, 2] -= box[2] / 2
+    box[2] *= 2
+    snapshot.configuration.box = box
+    sim = simulation_factory(snapshot, domain_decomposition=(1, 1, 2))
+    sim.profiling = True
+
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    lj.params[("A", "A")] = dict(sigma=1.0, epsilon=1.0)
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.001,
+        methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())],
+        forces=[lj],
+    )
+
+    balance = hoomd.tune.LoadBalancer(
+        trigger=hoomd.trigger.Periodic(5), timing=True, damping=0.25
+    )
+    sim.operations.tuners.append(balance)
+    sim.run(20)
+
+    # the load balance should move the split place down toward the particles
+    assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
@@ -0,0 +1,92 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import json
+
+import pytest
+
+import hoomd
+import hoomd.benchmark
+from hoomd.benchmark.__main__ import main
+
+_workloads = [
+    (hoomd.benchmark.LJLiquid, hoomd.version.md_built),
+    (hoomd.benchmark.KremerGrestMelt, hoomd.version.md_built),
+    (hoomd.benchmark.PPPMElectrolyte, hoomd.version.md_built),
+    (hoomd.benchmark.RigidDumbbells, hoomd.version.md_built),
+    (hoomd.benchmark.HardSpheres, hoomd.version.hpmc_built),
+    (hoomd.benchmark.HardCubes, hoomd.version.hpmc_built),
+    (hoomd.benchmark.MPCDSolvent, hoomd.version.mpcd_built),
+]
+
+
+@pytest.mark.parametrize(
+    "cls",
+    [
+        pytest.param(
+            cls, marks=pytest.mark.skipif(not built, reason="Component not built.")
+        )
+        for cls, built in _workloads
+    ],
+    ids=[cls.name for cls, built in _workloads],
+)
+def test_run(device, cls):
+    result = hoomd.benchmark.run(
+        cls(),
+        device,
+        N=1000,
+        warmup_steps=10,
+        max_tuning_steps=0,
+        benchmark_steps=10,
+        repeat=2,
+        profile_steps=10,
+    )
+
+    assert result["workload"] == cls.name
+    assert result["N"] == 1000
+    assert result["benchmark_steps"] == 10
+    assert len(result["tps_samples"]) == 2
+    assert result["tps"] > 0
+    assert len(result["breakdown"]) > 0
+    for entry in result["breakdown"].values():
+        assert entry["walltime"] >= 0
+        assert 0 <= entry["fraction"]
+    assert result["metadata"]["num_ranks"] == device.communicator.num_ranks
+    assert result["metadata"]["hoomd_version"] == hoomd.version.version
+
+    if issubclass(cls, (hoomd.benchmark.HardSpheres, hoomd.benchmark.HardCubes)):
+        assert result["sweeps_per_second"] == pytest.approx(4 * result["tps"])
+    else:
+        assert result["sweeps_per_second"] is None
+
+    # results must serialize to JSON
+    json.dumps(result)
+
+
+def test_kremer_grest_chain_length(device):
+    with pytest.raises(ValueError):
+        hoomd.benchmark.KremerGrestMelt().make_simulation(device, N=1001, seed=1)
+
+
+@pytest.mark.serial
+@pytest.mark.skipif(not hoomd.version.md_built, reason="MD component not built.")
+def test_main(tmp_path):
+    output = tmp_path / "results.json"
+    main(
+        [
+            "--workloads=lj_liquid",
+            "--N=1000",
+            "--warmup-steps=10",
+            "--max-tuning-steps=0",
+            "--benchmark-steps=10",
+            "--repeat=1",
+            "--profile-steps=0",
+            f"--output={output}",
+        ]
+    )
+
+    lines = output.read_text().splitlines()
+    assert len(lines) == 1
+    result = json.loads(lines[0])
+    assert result["workload"] == "lj_liquid"
+    assert result["breakdown"] == {}
@@ -0,0 +1,79 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import numpy
+import numpy.testing
+import pytest
+
+import hoomd
+import hoomd.write
+
+
+def test_invalid_arguments():
+    with pytest.raises(ValueError):
+        hoomd.write.MultipleTauCorrelator(trigger=hoomd.trigger.Before(10))
+    with pytest.raises(ValueError):
+        hoomd.write.MultipleTauCorrelator(trigger=1, points=15, averaging=2)
+    with pytest.raises(ValueError):
+        hoomd.write.MultipleTauCorrelator(trigger=1, quantities=("rdf",))
+
+
+def test_attributes(simulation_factory, two_particle_snapshot_factory):
+    correlator = hoomd.write.MultipleTauCorrelator(
+        trigger=hoomd.trigger.Periodic(10),
+        points=4,
+        averaging=2,
+        levels=3,
+        quantities=("msd",),
+    )
+    assert correlator.points == 4
+    assert correlator.averaging == 2
+    assert correlator.levels == 3
+    assert correlator.quantities == ("msd",)
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.writers.append(correlator)
+    sim.run(0)
+
+    assert correlator.points == 4
+    assert correlator.averaging == 2
+    assert correlator.levels == 3
+    numpy.testing.assert_array_equal(
+        correlator.lag_steps, numpy.array([0, 1, 2, 3, 4, 6, 8, 12]) * 10
+    )
+    assert correlator.num_samples == 0
+    if sim.device.communicator.rank == 0:
+        assert numpy.all(numpy.isnan(correlator.msd))
+    assert correlator.vacf is None
+
+
+@pytest.mark.skipif(not hoomd.version.md_built, reason="BUILD_MD=on required")
+def test_constant_velocity(simulation_factory, two_particle_snapshot_factory):
+    snapshot = two_particle_snapshot_factory()
+    velocity = numpy.array([5.0, 1.0, 0.0])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.velocity[:] = [velocity, -velocity]
+
+    sim = simulation_factory(snapshot)
+    dt = 0.005
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=dt, methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())]
+    )
+
+    correlator = hoomd.write.MultipleTauCorrelator(
+        trigger=hoomd.trigger.Periodic(1), points=4, averaging=2, levels=4
+    )
+    sim.operations.writers.append(correlator)
+    sim.run(40)
+
+    assert correlator.num_samples == 40
+    lag_steps = correlator.lag_steps
+    msd = correlator.msd
+    vacf = correlator.vacf
+    if sim.device.communicator.rank == 0:
+        v_sq = numpy.dot(velocity, velocity)
+        numpy.testing.assert_allclose(msd, v_sq * (lag_steps * dt) ** 2, rtol=1e-5)
+        numpy.testing.assert_allclose(vacf, v_sq, rtol=1e-5)
+
+    correlator.reset()
+    assert correlator.num_samples == 0
@@ -2,6 +2,8 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import numpy
+import numpy.testing
 import pytest
 from hoomd import conftest
 
@@ -21,6 +23,17 @@ class WriteTimestep(hoomd.custom.Action):
         return 42
 
 
+class WriteBatch(hoomd.custom.Action):
+    def __init__(self):
+        self.batches = []
+
+    def act(self, timestep):
+        pass
+
+    def act_batch(self, frames):
+        self.batches.append(frames)
+
+
 class TestCustomWriter:
     """Serves as tests for the CustomWriter and custom.Action classes.
 
@@ -96,3 +109,41 @@ class TestCustomWriter:
         sim.operations += writer
         sim.run(10)
         assert writer.timesteps_run == [2, 4, 6, 8, 10]
+
+    def test_act_batch(self, simulation_factory, two_particle_snapshot_factory):
+        snapshot = two_particle_snapshot_factory()
+        sim = simulation_factory(snapshot)
+        writer = hoomd.write.CustomWriter(
+            1, WriteBatch(), batch_size=3, batch_quantities=("position", "typeid")
+        )
+        assert writer.batch_size == 3
+        assert writer.batch_quantities == ["position", "typeid"]
+        sim.operations += writer
+        sim.run(7)
+        assert len(writer.batches) == 2
+        timesteps = [frame["timestep"] for batch in writer.batches for frame in batch]
+        assert timesteps == [1, 2, 3, 4, 5, 6]
+
+        frame = writer.batches[0][0]
+        n_local = len(frame["tag"])
+        assert frame["position"].shape == (n_local, 3)
+        assert frame["typeid"].shape == (n_local,)
+        assert "velocity" not in frame
+        if sim.device.communicator.num_ranks == 1:
+            numpy.testing.assert_allclose(
+                frame["position"][numpy.argsort(frame["tag"])],
+                snapshot.particles.position,
+                rtol=1e-6,
+            )
+
+        writer.flush()
+        assert len(writer.batches) == 3
+        assert [frame["timestep"] for frame in writer.batches[2]] == [7]
+
+    def test_act_batch_requires_method(
+        self, simulation_factory, two_particle_snapshot_factory
+    ):
+        sim = simulation_factory(two_particle_snapshot_factory())
+        sim.operations += hoomd.write.CustomWriter(1, WriteTimestep(), batch_size=2)
+        with pytest.raises(ValueError):
+            sim.run(0)
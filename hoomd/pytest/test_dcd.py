@@ -63,3 +63,29 @@ def test_mutability_error(simulation_factory, two_particle_snapshot_factory, tmp
 
     with pytest.raises(MutabilityError):
         dcd_dump.overwrite = True
+
+
+def test_asynchronous(simulation_factory, two_particle_snapshot_factory, tmp_path):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sync_filename = tmp_path / "sync.dcd"
+    async_filename = tmp_path / "async.dcd"
+    sync_dump = hoomd.write.DCD(
+        filename=sync_filename, trigger=hoomd.trigger.Periodic(1), unwrap_full=True
+    )
+    async_dump = hoomd.write.DCD(
+        filename=async_filename, trigger=hoomd.trigger.Periodic(1), unwrap_full=True
+    )
+    async_dump.asynchronous = True
+    sim.operations.writers.extend([sync_dump, async_dump])
+    sim.run(10)
+
+    assert async_dump.asynchronous
+    async_dump.flush()
+
+    if sim.device.communicator.rank == 0:
+        # skip the header, which includes the creation time
+        header_size = 276
+        sync_data = sync_filename.read_bytes()
+        async_data = async_filename.read_bytes()
+        assert len(sync_data) == len(async_data)
+        assert sync_data[header_size:] == async_data[header_size:]
@@ -37,6 +37,45 @@ def test_common_properties(device, tmp_path):
     )
 
 
+def test_memory_pool(device, simulation_factory, lattice_snapshot_factory):
+    limit = device.memory_pool_limit
+    assert limit > 0
+
+    sim = simulation_factory(lattice_snapshot_factory(n=10))
+    del sim
+
+    statistics = device.memory_pool_statistics
+    assert set(statistics.keys()) == {
+        "host_hits",
+        "host_misses",
+        "host_cached_bytes",
+        "device_hits",
+        "device_misses",
+        "device_cached_bytes",
+    }
+    assert statistics["host_misses"] > 0
+
+    device.memory_pool_limit = 0
+    assert device.memory_pool_limit == 0
+    assert device.memory_pool_statistics["host_cached_bytes"] == 0
+
+
+def test_autotuner_retune_threshold(device):
+    assert device.autotuner_retune_threshold == 0
+
+    device.autotuner_retune_threshold = 0.5
+    assert device.autotuner_retune_threshold == pytest.approx(0.5)
+
+    with pytest.raises(ValueError):
+        device.autotuner_retune_threshold = -1
+
+    device.autotuner_retune_threshold = 0
+    assert device.memory_pool_statistics["device_cached_bytes"] == 0
+
+    device.memory_pool_limit = limit
+    assert device.memory_pool_limit == limit
+
+
 @pytest.mark.gpu
 def test_gpu_specific_properties(device):
     # assert the defaults are right
@@ -46,6 +85,11 @@ def test_gpu_specific_properties(device):
     device.gpu_error_checking = False
     assert not device.gpu_error_checking
 
+    # GPU-aware MPI can always be disabled
+    assert type(device.gpu_aware_mpi) is bool
+    device.gpu_aware_mpi = False
+    assert not device.gpu_aware_mpi
+
     # make sure we can give a GPU id
     hoomd.device.GPU(gpu_id=0)
 
@@ -82,6 +126,64 @@ def test_query_hardware_info(device):
     _assert_list_str(devices)
 
 
+def test_compress_ghost_updates(device, simulation_factory, lattice_snapshot_factory):
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("Ghost update compression is implemented on the CPU")
+
+    assert not device.compress_ghost_updates
+
+    def run(compress):
+        device.compress_ghost_updates = compress
+        sim = simulation_factory(lattice_snapshot_factory(a=1.2, n=6))
+        sim.state.thermalize_particle_momenta(hoomd.filter.All(), kT=1.0)
+        lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+        lj.params[("A", "A")] = dict(sigma=1.0, epsilon=1.0)
+        sim.operations.integrator = hoomd.md.Integrator(
+            dt=0.005,
+            methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())],
+            forces=[lj],
+        )
+        sim.run(20)
+        return lj.energy
+
+    energy = run(False)
+    energy_compressed = run(True)
+    assert device.compress_ghost_updates
+    device.compress_ghost_updates = False
+
+    # quantized ghost positions perturb the trajectory only slightly
+    assert energy_compressed == pytest.approx(energy, rel=1e-3)
+
+
+def test_sort_ghosts(device, simulation_factory, lattice_snapshot_factory):
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("Ghost sorting is implemented on the CPU")
+
+    assert not device.sort_ghosts
+
+    def run(sort):
+        device.sort_ghosts = sort
+        sim = simulation_factory(lattice_snapshot_factory(a=1.2, n=6))
+        sim.state.thermalize_particle_momenta(hoomd.filter.All(), kT=1.0)
+        lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+        lj.params[("A", "A")] = dict(sigma=1.0, epsilon=1.0)
+        sim.operations.integrator = hoomd.md.Integrator(
+            dt=0.005,
+            methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())],
+            forces=[lj],
+        )
+        sim.run(20)
+        return lj.energy
+
+    energy = run(False)
+    energy_sorted = run(True)
+    assert device.sort_ghosts
+    device.sort_ghosts = False
+
+    # the ghost order only changes the order of the force sums
+    assert energy_sorted == pytest.approx(energy, rel=1e-4)
+
+
 def test_cpu_build_specifics():
     if hoomd.version.gpu_enabled:
         pytest.skip("Don't run CPU-build specific tests when GPU is available")
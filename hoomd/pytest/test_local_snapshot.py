@@ -5,7 +5,7 @@
 
 from copy import deepcopy
 import hoomd
-from hoomd.data.array import HOOMDGPUArray
+from hoomd.data.array import HOOMDArrayError, HOOMDGPUArray
 import numpy as np
 import pytest
 
@@ -552,6 +552,26 @@ class TestLocalSnapshots:
                 tags = getattr(snapshot_section, tag_name)
                 property_check(hoomd_buffer, property_dict, tags)
 
+    def test_dlpack(self, base_simulation):
+        if not hasattr(np, "from_dlpack"):
+            pytest.skip("NumPy does not support DLPack.")
+        sim = base_simulation()
+        with sim.state.cpu_local_snapshot as data:
+            position = data.particles.position
+            assert position.__dlpack_device__() == (1, 0)
+            arr = np.from_dlpack(position)
+            np.testing.assert_array_equal(arr, position)
+            assert np.shares_memory(arr, position._coerce_to_ndarray())
+
+        with pytest.raises(HOOMDArrayError):
+            position.__dlpack__()
+
+        if isinstance(sim.device, hoomd.device.GPU) and CUPY_IMPORTED:
+            with sim.state.gpu_local_snapshot as data:
+                position = data.particles.position
+                arr = cupy.from_dlpack(position)
+                assert arr.data.ptr == position.__cuda_array_interface__["data"][0]
+
     def test_run_failure(self, base_simulation):
         sim = base_simulation()
         for lcl_snapshot_attr in self.get_snapshot_attr(sim):
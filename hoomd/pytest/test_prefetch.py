@@ -0,0 +1,54 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import numpy
+import numpy.testing
+import pytest
+
+import hoomd
+import hoomd.write
+
+
+def test_invalid_arguments():
+    with pytest.raises(ValueError):
+        hoomd.write.Prefetch(trigger=1, quantities=())
+    with pytest.raises(ValueError):
+        hoomd.write.Prefetch(trigger=1, quantities=("charge",))
+
+
+def test_read(simulation_factory, two_particle_snapshot_factory):
+    snapshot = two_particle_snapshot_factory(particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[:] = [1, 0]
+        snapshot.particles.mass[:] = [2, 3]
+        snapshot.particles.velocity[:] = [[1, 2, 3], [-4, -5, -6]]
+
+    sim = simulation_factory(snapshot)
+    prefetch = hoomd.write.Prefetch(
+        trigger=hoomd.trigger.Periodic(2),
+        quantities=("position", "typeid", "velocity", "mass", "tag"),
+    )
+    assert prefetch.quantities == ("position", "typeid", "velocity", "mass", "tag")
+    assert prefetch.read() is None
+    assert not prefetch.ready
+
+    sim.operations.writers.append(prefetch)
+    sim.run(3)
+
+    frame = prefetch.read()
+    assert prefetch.ready
+    assert frame["timestep"] == 2
+    assert "orientation" not in frame
+
+    # compare in tag order, the particles may be sorted after the frame
+    order = numpy.argsort(frame["tag"])
+    with sim.state.cpu_local_snapshot as local_snapshot:
+        particles = local_snapshot.particles
+        local_order = numpy.argsort(particles.tag)
+        numpy.testing.assert_array_equal(
+            frame["tag"][order], particles.tag[local_order]
+        )
+        for quantity in ("position", "typeid", "velocity", "mass"):
+            numpy.testing.assert_allclose(
+                frame[quantity][order], getattr(particles, quantity)[local_order]
+            )
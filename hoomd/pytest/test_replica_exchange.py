@@ -0,0 +1,72 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Test hoomd.update.ReplicaExchange."""
+
+import hoomd
+import pytest
+
+
+def test_valid_construction():
+    """Test that ReplicaExchange stores its arguments."""
+    kT = hoomd.variant.Constant(1.0)
+
+    def observable():
+        return 0.0
+
+    replica_exchange = hoomd.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(10),
+        parameter=kT,
+        values=[1.5],
+        observable=observable,
+        inverse=True,
+    )
+
+    assert replica_exchange.parameter is kT
+    assert replica_exchange.values == [1.5]
+    assert replica_exchange.observable is observable
+    assert replica_exchange.inverse
+
+
+def test_attach(simulation_factory, two_particle_snapshot_factory):
+    """Test that ReplicaExchange sets the parameter to the rung of the partition."""
+    sim = simulation_factory(two_particle_snapshot_factory())
+    n_partitions = sim.device.communicator.num_partitions
+    values = [1.0 + 0.5 * i for i in range(n_partitions)]
+    kT = hoomd.variant.Constant(0.1)
+
+    replica_exchange = hoomd.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(1),
+        parameter=kT,
+        values=values,
+        observable=lambda: 0.0,
+    )
+    sim.operations.updaters.append(replica_exchange)
+    sim.run(0)
+
+    partition = sim.device.communicator.partition
+    assert replica_exchange.rung == partition
+    assert kT.value == values[partition]
+
+    sim.run(10)
+    assert kT.value == values[replica_exchange.rung]
+    acceptance = replica_exchange.acceptance
+    assert len(acceptance) == n_partitions - 1
+    for accepted, attempted in acceptance:
+        assert 0 <= accepted <= attempted
+
+
+def test_values_per_partition(simulation_factory, two_particle_snapshot_factory):
+    """Test that ReplicaExchange needs one value per partition."""
+    sim = simulation_factory(two_particle_snapshot_factory())
+    n_partitions = sim.device.communicator.num_partitions
+
+    replica_exchange = hoomd.update.ReplicaExchange(
+        trigger=hoomd.trigger.Periodic(1),
+        parameter=hoomd.variant.Constant(1.0),
+        values=[1.0] * (n_partitions + 1),
+        observable=lambda: 0.0,
+    )
+    sim.operations.updaters.append(replica_exchange)
+    with pytest.raises(ValueError):
+        sim.run(0)
@@ -0,0 +1,80 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import os
+
+import numpy
+import numpy.testing
+import pytest
+
+import hoomd
+import hoomd.write
+
+
+@pytest.fixture
+def shm_name(request):
+    return f"hoomd-test-{os.getpid()}-{request.node.name}"
+
+
+def test_invalid_arguments():
+    with pytest.raises(ValueError):
+        hoomd.write.SharedMemory(trigger=1, name="hoomd-test", quantities=())
+    with pytest.raises(ValueError):
+        hoomd.write.SharedMemory(trigger=1, name="hoomd-test", quantities=("mass",))
+
+
+def test_attach(simulation_factory, two_particle_snapshot_factory, shm_name):
+    writer = hoomd.write.SharedMemory(trigger=1, name=shm_name, slots=3)
+    assert writer.name == shm_name
+    assert writer.slots == 3
+    assert writer.quantities == ("position", "orientation", "typeid", "image")
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.writers.append(writer)
+    sim.run(0)
+    assert writer.name == shm_name
+    assert writer.slots == 3
+
+    sim.operations.writers.remove(writer)
+
+
+def test_read(simulation_factory, two_particle_snapshot_factory, shm_name):
+    snapshot = two_particle_snapshot_factory(particle_types=["A", "B"])
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[:] = [1, 0]
+        snapshot.particles.velocity[:] = [[1, 2, 3], [-4, -5, -6]]
+        snapshot.particles.orientation[:] = [[0, 1, 0, 0], [1, 0, 0, 0]]
+
+    sim = simulation_factory(snapshot)
+    writer = hoomd.write.SharedMemory(
+        trigger=hoomd.trigger.Periodic(1),
+        name=shm_name,
+        quantities=("position", "orientation", "typeid", "velocity"),
+        slots=2,
+    )
+    sim.operations.writers.append(writer)
+    sim.run(3)
+
+    if sim.device.communicator.rank == 0:
+        reader = hoomd.write.SharedMemoryReader(shm_name)
+        assert reader.quantities == ("position", "orientation", "typeid", "velocity")
+        assert reader.num_frames == 3
+
+        frame = reader.read()
+        assert frame["timestep"] == sim.timestep
+        numpy.testing.assert_allclose(frame["box"], [20, 20, 20, 0, 0, 0])
+        numpy.testing.assert_allclose(
+            frame["position"], snapshot.particles.position, rtol=1e-6
+        )
+        numpy.testing.assert_array_equal(
+            frame["orientation"], snapshot.particles.orientation
+        )
+        numpy.testing.assert_array_equal(frame["typeid"], [1, 0])
+        numpy.testing.assert_allclose(frame["velocity"], snapshot.particles.velocity)
+        assert "image" not in frame
+        reader.close()
+
+    sim.operations.writers.remove(writer)
+    if sim.device.communicator.rank == 0:
+        with pytest.raises(FileNotFoundError):
+            hoomd.write.SharedMemoryReader(shm_name)
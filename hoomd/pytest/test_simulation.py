@@ -122,6 +122,17 @@ def test_allows_compute_pressure(simulation_factory, lattice_snapshot_factory):
     assert sim.always_compute_pressure is True
 
 
+def test_always_compute_energy(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory()
+    assert sim.always_compute_energy
+    with pytest.raises(RuntimeError):
+        sim.always_compute_energy = False
+    sim.create_state_from_snapshot(lattice_snapshot_factory())
+    assert sim.always_compute_energy is True
+    sim.always_compute_energy = False
+    assert sim.always_compute_energy is False
+
+
 def test_run(simulation_factory, lattice_snapshot_factory):
     sim = simulation_factory()
     with pytest.raises(RuntimeError):
@@ -247,6 +258,86 @@ def test_state_from_gsd(
         assert_equivalent_snapshots(snap, sim.state.get_snapshot())
 
 
+@skip_gsd
+def test_state_from_gsd_distributed(
+    device, simulation_factory, lattice_snapshot_factory, tmp_path
+):
+    d = tmp_path / "sub"
+    d.mkdir()
+    filename = d / "temporary_test_file.gsd"
+
+    sim = simulation_factory(
+        lattice_snapshot_factory(n=10, particle_types=["A", "B"])
+    )
+    snap = update_positions(sim.state.get_snapshot())
+    set_types(snap, random_inds(10), ["A", "B"], "B")
+
+    if device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode="w") as f:
+            f.append(make_gsd_frame(snap))
+
+    sim = simulation_factory()
+    sim.create_state_from_gsd(filename, distributed=True)
+    assert sim.state.N_particles == 1000
+
+    assert_equivalent_snapshots(snap, sim.state.get_snapshot())
+
+
+def test_state_from_lattice(simulation_factory):
+    sim = simulation_factory()
+    sim.create_state_from_lattice(
+        box=[8, 8, 8, 0, 0, 0],
+        n=(4, 4, 4),
+        basis=[(0, 0, 0), (0.5, 0.5, 0.5)],
+        basis_types=["A", "B"],
+        basis_masses=[1.0, 2.0],
+    )
+    assert sim.state.N_particles == 128
+    assert sim.state.particle_types == ["A", "B"]
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        # the second basis site is the body center of each cell
+        typeid = snap.particles.typeid
+        np.testing.assert_array_equal(typeid, np.arange(128) % 2)
+        np.testing.assert_allclose(snap.particles.mass, 1.0 + typeid)
+        np.testing.assert_allclose(snap.particles.position[0], [-4, -4, -4])
+        np.testing.assert_allclose(snap.particles.position[1], [-3, -3, -3])
+        np.testing.assert_allclose(snap.particles.position[2], [-2, -4, -4])
+
+
+def test_state_random(simulation_factory):
+    sim = simulation_factory()
+    sim.seed = 7
+    sim.create_state_random(
+        box=[10, 10, 10, 0, 0, 0],
+        N=500,
+        types=["A", "B"],
+        type_fractions=[0.25, 0.75],
+        type_masses=[1.0, 3.0],
+        min_distance=0.9,
+    )
+    assert sim.state.N_particles == 500
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        position = snap.particles.position
+        delta = position[:, np.newaxis, :] - position[np.newaxis, :, :]
+        delta -= 10 * np.round(delta / 10)
+        distance = np.linalg.norm(delta, axis=-1)
+        np.fill_diagonal(distance, np.inf)
+        assert np.min(distance) >= 0.9 - 1e-6
+
+        typeid = snap.particles.typeid
+        assert 0 < np.count_nonzero(typeid == 0) < np.count_nonzero(typeid == 1)
+        np.testing.assert_allclose(snap.particles.mass, 1.0 + 2.0 * typeid)
+
+    with pytest.raises(RuntimeError):
+        simulation_factory().create_state_random(
+            box=[5, 5, 5, 0, 0, 0], N=500, min_distance=0.9
+        )
+
+
 @skip_gsd
 def test_state_from_gsd_box_dims(
     device, simulation_factory, lattice_snapshot_factory, tmp_path
@@ -509,5 +600,49 @@ def test_logging():
             "timestep": {"category": LoggerCategories.scalar, "default": True},
             "tps": {"category": LoggerCategories.scalar, "default": True},
             "walltime": {"category": LoggerCategories.scalar, "default": True},
+            "communication_walltime": {
+                "category": LoggerCategories.sequence,
+                "default": False,
+            },
         },
     )
+
+
+def test_profiling(device, two_particle_snapshot_factory):
+    sim = hoomd.Simulation(device=device)
+    assert not sim.profiling
+    sim.profiling = True
+    assert sim.profiling
+
+    sim.create_state_from_snapshot(two_particle_snapshot_factory())
+    writer = hoomd.write.CustomWriter(
+        action=ListWriter(sim, "timestep"), trigger=hoomd.trigger.Periodic(2)
+    )
+    sim.operations.writers.append(writer)
+
+    sim.run(10)
+    assert writer.profile_num_calls == 5
+    assert writer.profile_walltime >= writer.profile_last_walltime >= 0
+    assert writer.profile_kernel_time == {}
+    assert len(sim.communication_walltime) == 3
+
+    # measurements stop accumulating when profiling is disabled
+    sim.profiling = False
+    sim.run(10)
+    assert writer.profile_num_calls == 5
+
+
+def test_memory_usage(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=10))
+    usage = sim.memory_usage
+    assert usage["State"][0] > 0
+
+    writer = hoomd.write.CustomWriter(
+        action=ListWriter(sim, "timestep"), trigger=hoomd.trigger.Periodic(1)
+    )
+    sim.operations.writers.append(writer)
+    sim.run(1)
+    assert writer.memory_host_bytes >= 0
+    assert writer.memory_device_bytes >= 0
+    if isinstance(sim.device, hoomd.device.CPU):
+        assert sim.memory_usage["State"][1] == 0
@@ -599,3 +599,43 @@ def test_invalid_bond_typeids(
         group.N = 0
 
     simulation_factory(snap)
+
+
+def test_adopt_particle_arrays(simulation_factory):
+    """Test that snapshots read adopted arrays without copying them."""
+    snap = Snapshot()
+    if snap.communicator.rank == 0:
+        snap.configuration.box = [10, 10, 10, 0, 0, 0]
+        snap.particles.types = ["A", "B"]
+
+        position = numpy.array(
+            [[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1]], dtype=numpy.float64
+        )
+        typeid = numpy.array([0, 1, 1, 0], dtype=numpy.uint32)
+        snap.particles.adopt("position", position)
+        snap.particles.adopt("typeid", typeid)
+
+        assert snap.particles.N == 4
+        assert snap.particles.position is position
+        numpy.testing.assert_array_equal(snap.particles.mass, 1.0)
+
+        # writes through the snapshot modify the adopted array
+        snap.particles.position[3] = [0, 0, -1]
+        assert position[3, 2] == -1
+
+        with pytest.raises(ValueError):
+            snap.particles.adopt("mass", numpy.ones(4, dtype=numpy.int32))
+        with pytest.raises(ValueError):
+            snap.particles.adopt("mass", numpy.ones(5))
+
+    sim = simulation_factory(snap)
+    new_snap = sim.state.get_snapshot()
+    if new_snap.communicator.rank == 0:
+        numpy.testing.assert_allclose(new_snap.particles.position, position)
+        numpy.testing.assert_array_equal(new_snap.particles.typeid, typeid)
+
+    # resizing copies the adopted arrays into the snapshot
+    if snap.communicator.rank == 0:
+        snap.particles.N = 5
+        assert snap.particles.position is not position
+        numpy.testing.assert_allclose(snap.particles.position[:4], position)
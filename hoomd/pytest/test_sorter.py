@@ -3,8 +3,10 @@
 
 """Test ParticleSorter."""
 
-from hoomd.conftest import operation_pickling_check
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd.logging import LoggerCategories
 import hoomd
+import pytest
 
 
 def test_attributes():
@@ -14,6 +16,16 @@ def test_attributes():
 
     assert sorter.trigger is trigger
     assert sorter.grid == 32
+    assert not sorter.high_resolution
+    assert sorter.max_disorder is None
+
+    sorter.high_resolution = True
+    sorter.max_disorder = 0.1
+    assert sorter.high_resolution
+    assert sorter.max_disorder == 0.1
+
+    with pytest.raises(ValueError):
+        sorter.max_disorder = -1.0
 
 
 def test_attributes_attached(simulation_factory, two_particle_snapshot_factory):
@@ -28,6 +40,39 @@ def test_attributes_attached(simulation_factory, two_particle_snapshot_factory):
     assert sorter.trigger is trigger
     assert sorter.grid == 32
 
+    sorter.high_resolution = True
+    sorter.max_disorder = 0.1
+    assert sorter.high_resolution
+    assert sorter.max_disorder == 0.1
+    sorter.max_disorder = None
+    assert sorter.max_disorder is None
+
+
+@pytest.mark.parametrize("high_resolution", [False, True])
+def test_disorder(high_resolution, simulation_factory, lattice_snapshot_factory):
+    """Test that sorting leaves the particles in order."""
+    snap = lattice_snapshot_factory(n=10, a=1.5)
+    sim = simulation_factory(snap)
+    sorter = sim.operations.tuners[0]
+    sorter.trigger = hoomd.trigger.Periodic(1)
+    sorter.high_resolution = high_resolution
+    sim.run(1)
+
+    assert sorter.disorder == 0.0
+
+    # without dynamics the particles stay in order and the sorter skips the sort
+    sorter.max_disorder = 0.5
+    sim.run(1)
+    assert sorter.disorder == 0.0
+
+
+def test_logging():
+    logging_check(
+        hoomd.tune.ParticleSorter,
+        ("tune", "sorter"),
+        {"disorder": {"category": LoggerCategories.scalar, "default": True}},
+    )
+
 
 def test_default_sorter(simulation_factory, two_particle_snapshot_factory):
     """Test that the default Simulation includes a ParticleSorter."""
@@ -172,6 +172,82 @@ def test_modify_snapshot(simulation_factory, snap):
     assert_snapshots_equal(snap, snap2)
 
 
+def test_checkpoint(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(a=1.5, n=5)
+    sim = simulation_factory(snap)
+    sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(), kT=1.5)
+
+    snap_before = sim.state.get_snapshot()
+    checkpoint = sim.state.take_checkpoint()
+
+    nve = hoomd.md.methods.ConstantVolume(hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, methods=[nve])
+    sim.run(10)
+
+    # moved particles are reset to the checkpoint
+    sim.state.restore_checkpoint(checkpoint)
+    snap_after = sim.state.get_snapshot()
+    if snap_before.communicator.rank == 0:
+        numpy.testing.assert_array_equal(
+            snap_after.particles.position, snap_before.particles.position
+        )
+        numpy.testing.assert_array_equal(
+            snap_after.particles.velocity, snap_before.particles.velocity
+        )
+        numpy.testing.assert_array_equal(
+            snap_after.particles.image, snap_before.particles.image
+        )
+
+    # checkpoints can be reused
+    sim.run(10)
+    assert sim.state.take_checkpoint(checkpoint) is checkpoint
+    sim.run(10)
+    sim.state.restore_checkpoint(checkpoint)
+    sim.run(10)
+
+
+@pytest.mark.skipif(not hoomd.version.md_built, reason="BUILD_MD=on required")
+def test_checkpoint_bonds(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(a=1.5, n=6)
+    if snap.communicator.rank == 0:
+        snap.bonds.types = ["A-A"]
+        snap.bonds.N = snap.particles.N // 2
+        snap.bonds.group[:] = numpy.arange(snap.particles.N).reshape((-1, 2))
+    sim = simulation_factory(snap)
+    sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(), kT=1.5)
+
+    harmonic = hoomd.md.bond.Harmonic()
+    harmonic.params["A-A"] = dict(k=10, r0=1.0)
+    nve = hoomd.md.methods.ConstantVolume(hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.005, methods=[nve], forces=[harmonic]
+    )
+    sim.run(0)
+    energy_before = harmonic.energy
+    snap_before = sim.state.get_snapshot()
+
+    checkpoint = sim.state.take_checkpoint()
+    assert checkpoint.valid
+    assert checkpoint.N <= sim.state.N_particles
+    sim.run(50)
+
+    # the bonds on each rank are restored with the particles they connect
+    sim.state.restore_checkpoint(checkpoint)
+    sim.run(0)
+    assert harmonic.energy == pytest.approx(energy_before)
+
+    snap_after = sim.state.get_snapshot()
+    if snap_before.communicator.rank == 0:
+        numpy.testing.assert_array_equal(
+            snap_after.particles.position, snap_before.particles.position
+        )
+        numpy.testing.assert_array_equal(
+            snap_after.bonds.group, snap_before.bonds.group
+        )
+
+    sim.run(10)
+
+
 def test_thermalize_particle_velocity(simulation_factory, lattice_snapshot_factory):
     snap = lattice_snapshot_factory()
     sim = simulation_factory(snap)
@@ -280,6 +356,22 @@ def test_replicate(simulation_factory, lattice_snapshot_factory):
     assert_snapshots_equal(initial_snapshot, new_snapshot)
 
 
+def test_keep_reorder_buffers(simulation_factory, lattice_snapshot_factory):
+    snapshot = lattice_snapshot_factory()
+    sim = simulation_factory(snapshot)
+    assert sim.state.keep_reorder_buffers
+
+    sim.state.keep_reorder_buffers = False
+    assert not sim.state.keep_reorder_buffers
+    sim.run(10)
+    assert_snapshots_equal(snapshot, sim.state.get_snapshot())
+
+    sim.state.keep_reorder_buffers = True
+    assert sim.state.keep_reorder_buffers
+    sim.run(10)
+    assert_snapshots_equal(snapshot, sim.state.get_snapshot())
+
+
 def test_domain_decomposition(device, simulation_factory, lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
 
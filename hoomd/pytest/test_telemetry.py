@@ -0,0 +1,49 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import pytest
+
+import hoomd
+import hoomd.write
+
+
+def _read_metrics(filename):
+    samples = {}
+    with open(filename) as f:
+        for line in f:
+            if line.startswith("#"):
+                continue
+            key, value = line.rsplit(" ", 1)
+            samples[key] = float(value)
+    return samples
+
+
+def test_attributes(tmp_path):
+    telemetry = hoomd.write.Telemetry(trigger=10, filename=str(tmp_path / "a.prom"))
+    assert telemetry.filename == str(tmp_path / "a.prom")
+    assert telemetry.trigger == hoomd.trigger.Periodic(10)
+    with pytest.raises(ValueError):
+        telemetry.filename = "b.prom"
+
+
+def test_write(simulation_factory, two_particle_snapshot_factory, tmp_path):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    filename = tmp_path / "metrics_{rank}.prom"
+    telemetry = hoomd.write.Telemetry(trigger=5, filename=str(filename))
+    sim.operations.writers.append(telemetry)
+    sim.run(10)
+
+    rank = sim.device.communicator.rank
+    samples = _read_metrics(str(filename).replace("{rank}", str(rank)))
+    assert 5 <= samples[f'hoomd_timestep{{rank="{rank}"}}'] <= 10
+    assert samples[f'hoomd_eta_seconds{{rank="{rank}"}}'] >= 0
+    assert samples[f'hoomd_tps{{rank="{rank}"}}'] > 0
+    assert f'hoomd_autotuning_complete{{rank="{rank}"}}' in samples
+    key = f'hoomd_memory_host_bytes{{rank="{rank}",owner="State"}}'
+    assert samples[key] > 0
+    n_local = sum(
+        value
+        for key, value in samples.items()
+        if key.startswith("hoomd_local_particles")
+    )
+    assert n_local <= 2
@@ -0,0 +1,96 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+from math import isclose
+import pytest
+
+import hoomd
+import hoomd.write
+
+
+class Identity:
+    def __init__(self, x):
+        self.x = x
+
+    def __call__(self):
+        return self.x
+
+
+@pytest.fixture
+def logger():
+    logger = hoomd.logging.Logger(categories=["scalar", "string"])
+    logger[("dummy", "loggable", "int")] = (Identity(42000000), "scalar")
+    logger[("dummy", "loggable", "float")] = (Identity(3.1415), "scalar")
+    logger[("dummy", "loggable", "small_float")] = (Identity(0.0000001), "scalar")
+    logger[("dummy", "loggable", "string")] = (Identity("foobarbaz"), "string")
+    return logger
+
+
+def test_invalid_logger(tmp_path):
+    logger = hoomd.logging.Logger(categories=["scalar", "particle"])
+    with pytest.raises(ValueError):
+        hoomd.write.TextLog(trigger=1, filename=tmp_path / "log.txt", logger=logger)
+
+
+def test_attributes(
+    simulation_factory, two_particle_snapshot_factory, logger, tmp_path
+):
+    filename = str(tmp_path / "log.txt")
+    text_log = hoomd.write.TextLog(
+        trigger=hoomd.trigger.Periodic(10),
+        filename=filename,
+        logger=logger,
+        delimiter=",",
+        precision=6,
+        flush_period=5,
+    )
+    assert text_log.filename == filename
+    assert text_log.logger is logger
+    assert text_log.delimiter == ","
+    assert text_log.precision == 6
+    assert text_log.flush_period == 5
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.writers.append(text_log)
+    sim.run(0)
+
+    assert text_log.filename == filename
+    assert text_log.delimiter == ","
+    assert text_log.precision == 6
+    assert text_log.flush_period == 5
+
+    text_log.flush_period = 20
+    assert text_log.flush_period == 20
+
+
+def test_write(simulation_factory, two_particle_snapshot_factory, logger, tmp_path):
+    filename = tmp_path / "log.txt"
+    sim = simulation_factory(two_particle_snapshot_factory())
+    logger.add(sim, quantities=["timestep"])
+    text_log = hoomd.write.TextLog(
+        trigger=hoomd.trigger.Periodic(2),
+        filename=filename,
+        logger=logger,
+        flush_period=3,
+    )
+    sim.operations.writers.append(text_log)
+    sim.run(10)
+    text_log.flush()
+
+    if sim.device.communicator.rank != 0:
+        return
+
+    with open(filename) as f:
+        lines = f.read().splitlines()
+
+    header = lines[0].split(" ")
+    assert header == [".".join(namespace) for namespace in logger]
+    assert len(lines) == 6
+
+    for row, timestep in zip(lines[1:], range(2, 12, 2)):
+        values = dict(zip(header, row.split(" ")))
+        assert int(values["dummy.loggable.int"]) == 42000000
+        assert isclose(float(values["dummy.loggable.float"]), 3.1415)
+        assert isclose(float(values["dummy.loggable.small_float"]), 0.0000001)
+        assert values["dummy.loggable.string"] == "foobarbaz"
+        assert int(values["Simulation.timestep"]) == timestep
@@ -141,6 +141,24 @@ def test_eval(trigger, eval_func):
         assert trigger(i) == eval_func(i)
 
 
+@pytest.mark.parametrize(
+    "trigger, eval_func", zip(triggers(), _eval_funcs), ids=_test_name
+)
+def test_next_activation(trigger, eval_func):
+    # The trigger must be inactive on [t, next_activation(t)) and active on
+    # [t, next_deactivation(t)).
+    starts = itertools.chain(
+        range(0, 1000, 7), range(10000000000, 10000001000, 7)
+    )
+    for t in starts:
+        next_on = trigger._next_activation(t)
+        for i in range(t, min(next_on, t + 1000)):
+            assert not eval_func(i)
+        next_off = trigger._next_deactivation(t)
+        for i in range(t, min(next_off, t + 1000)):
+            assert eval_func(i)
+
+
 @pytest.mark.parametrize("trigger", triggers(), ids=_test_name)
 def test_pickling(trigger):
     pkled_trigger = pickle.loads(pickle.dumps(trigger))
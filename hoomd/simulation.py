@@ -20,6 +20,8 @@
 
 import inspect
 
+import numpy
+
 import hoomd._hoomd as _hoomd
 from hoomd.logging import log, Loggable
 from hoomd.state import State
@@ -63,6 +65,7 @@ class Simulation(metaclass=Loggable):
         self._operations._simulation = self
         self._timestep = None
         self._seed = None
+        self._profiling = False
         if seed is not None:
             self.seed = seed
 
@@ -157,6 +160,9 @@ class Simulation(metaclass=Loggable):
         if self._seed is not None:
             self._state._cpp_sys_def.setSeed(self._seed)
 
+        self._state._cpp_sys_def.setProfilingEnabled(self._profiling)
+        self.device._cpp_exec_conf.setKernelTiming(self._profiling)
+
         self._init_communicator()
 
     def _init_communicator(self):
@@ -192,7 +198,11 @@ class Simulation(metaclass=Loggable):
             )
 
     def create_state_from_gsd(
-        self, filename, frame=-1, domain_decomposition=(None, None, None)
+        self,
+        filename,
+        frame=-1,
+        domain_decomposition=(None, None, None),
+        distributed=False,
     ):
         """Create the simulation state from a GSD file.
 
@@ -210,9 +220,19 @@ class Simulation(metaclass=Loggable):
                 to include in each domain. The sum of each list of floats must
                 be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
 
+            distributed (bool): When `True` in MPI simulations, every rank reads
+                its own slice of the per-particle data from the file and sends
+                the particles directly to the ranks that own them.
+
         When `timestep` is `None` before calling, `create_state_from_gsd`
         sets `timestep` to the value in the selected GSD frame in the file.
 
+        Note:
+            By default, the root rank reads the entire frame and distributes
+            it. Set ``distributed=True`` to initialize large systems without
+            storing all of the particle data on the root rank. The root rank
+            still reads the topology (bonds, angles, ...) and broadcasts it.
+
         Note:
             Set any or all of the ``domain_decomposition`` tuple elements to
             `None` and `create_state_from_gsd` will select a value that
@@ -220,7 +240,10 @@ class Simulation(metaclass=Loggable):
             ``(2,None,None)``). The domains are spaced evenly along each
             automatically selected direction. The default value of ``(None,
             None, None)`` will automatically select the number of domains in all
-            directions.
+            directions. When all directions are selected automatically and
+            every node runs the same number of ranks, the domains of each node
+            are grouped into a block and the surfaces between nodes are
+            weighted more heavily.
 
         .. rubric:: Example:
 
@@ -231,16 +254,32 @@ class Simulation(metaclass=Loggable):
         if self._state is not None:
             raise RuntimeError("Cannot initialize more than once\n")
         filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
+        # distributed reads only pay off when there is more than one rank
+        distributed = distributed and self.device.communicator.num_ranks > 1
         # Grab snapshot and timestep
         reader = _hoomd.GSDReader(
-            self.device._cpp_exec_conf, filename, abs(frame), frame < 0
+            self.device._cpp_exec_conf,
+            filename,
+            abs(frame),
+            frame < 0,
+            distributed,
         )
         snapshot = Snapshot._from_cpp_snapshot(
             reader.getSnapshot(), self.device.communicator
         )
 
         step = reader.getTimeStep() if self.timestep is None else self.timestep
-        self._state = State(self, snapshot, domain_decomposition)
+        if distributed:
+            local_particle_data = (
+                reader.getLocalParticleData(),
+                reader.getTagOffset(),
+                reader.getNGlobal(),
+            )
+        else:
+            local_particle_data = None
+        self._state = State(
+            self, snapshot, domain_decomposition, local_particle_data
+        )
 
         reader.clearSnapshot()
 
@@ -274,7 +313,10 @@ class Simulation(metaclass=Loggable):
             ``(2,None,None)``). The domains are spaced evenly along each
             automatically selected direction. The default value of ``(None,
             None, None)`` will automatically select the number of domains in all
-            directions.
+            directions. When all directions are selected automatically and
+            every node runs the same number of ranks, the domains of each node
+            are grouped into a block and the surfaces between nodes are
+            weighted more heavily.
 
         See Also:
             `State.get_snapshot`
@@ -310,6 +352,199 @@ class Simulation(metaclass=Loggable):
 
         self._init_system(step)
 
+    def create_state_from_lattice(
+        self,
+        box,
+        n,
+        basis=((0, 0, 0),),
+        basis_types=("A",),
+        basis_masses=None,
+        domain_decomposition=(None, None, None),
+    ):
+        """Create the simulation state from a lattice without a snapshot.
+
+        Args:
+            box (hoomd.box.box_like): Simulation box.
+
+            n (tuple[int, int, int]): Number of unit cells along each box
+                vector. Set ``n[2]`` to 1 in 2D boxes.
+
+            basis (list[tuple[float, float, float]]): Position of each
+                particle in the unit cell as fractions of the cell in
+                :math:`[0, 1)`.
+
+            basis_types (list[str]): Type name of each basis particle.
+
+            basis_masses (list[float]): Mass of each basis particle. Defaults
+                to 1.0 for every basis particle.
+
+            domain_decomposition (tuple): Choose how to distribute the state
+                across MPI ranks with domain decomposition. See
+                `create_state_from_snapshot`.
+
+        The unit cells span the box, so the box vectors divided by ``n`` are
+        the lattice vectors. Every MPI rank generates a contiguous range of
+        particle tags and sends the particles directly to the ranks that own
+        them, so no rank stores the whole system. The particle types are the
+        unique names in ``basis_types`` in order of appearance.
+
+        When `timestep` is `None` before calling, `create_state_from_lattice`
+        sets `timestep` to 0.
+
+        .. rubric:: Example:
+
+        .. invisible-code-block: python
+
+            simulation = hoomd.Simulation(device=hoomd.device.CPU(), seed=1)
+
+        .. code-block:: python
+
+            simulation.create_state_from_lattice(
+                box=[20, 20, 20, 0, 0, 0],
+                n=(10, 10, 10),
+                basis=[(0, 0, 0), (0.5, 0.5, 0.5)],
+                basis_types=["A", "B"],
+            )
+        """
+        box = hoomd.Box.from_box(box)
+        basis_types = list(basis_types)
+        if len(basis) != len(basis_types):
+            raise ValueError("basis and basis_types must have the same length")
+        if basis_masses is None:
+            basis_masses = [1.0] * len(basis_types)
+
+        type_names = list(dict.fromkeys(basis_types))
+        initializer = _hoomd.DistributedLatticeInitializer(
+            box._cpp_obj,
+            *[int(n_i) for n_i in n],
+            [float(x) for position in basis for x in position],
+            [type_names.index(name) for name in basis_types],
+            [float(mass) for mass in basis_masses],
+            type_names,
+        )
+        self._create_state_from_initializer(
+            initializer, box, type_names, domain_decomposition
+        )
+
+    def create_state_random(
+        self,
+        box,
+        N,
+        types=("A",),
+        type_fractions=None,
+        type_masses=None,
+        min_distance=1.0,
+        domain_decomposition=(None, None, None),
+    ):
+        """Create the simulation state with random non-overlapping particles.
+
+        Args:
+            box (hoomd.box.box_like): Simulation box.
+
+            N (int): Number of particles.
+
+            types (list[str]): Particle type names.
+
+            type_fractions (list[float]): Fraction of the particles of each
+                type. Defaults to equal fractions.
+
+            type_masses (list[float]): Mass of each type. Defaults to 1.0.
+
+            min_distance (float): Minimum distance between particles
+                :math:`[\\mathrm{length}]`.
+
+            domain_decomposition (tuple): Choose how to distribute the state
+                across MPI ranks with domain decomposition. See
+                `create_state_from_snapshot`.
+
+        `create_state_random` divides the box into the fewest cells of the same
+        shape that hold ``N`` particles, with at most one particle in each cell.
+        Each particle is displaced from the center of its cell by a random
+        amount small enough that particles stay at least ``min_distance``
+        apart. The positions and types only depend on the particle tag and
+        `seed`, so every MPI rank generates a contiguous range of tags and
+        sends the particles directly to the ranks that own them, and no rank
+        stores the whole system.
+
+        Note:
+            The configuration is random within the cells, but not an
+            equilibrium fluid. Equilibrate it before sampling.
+
+        When `timestep` is `None` before calling, `create_state_random` sets
+        `timestep` to 0.
+
+        .. rubric:: Example:
+
+        .. invisible-code-block: python
+
+            simulation = hoomd.Simulation(device=hoomd.device.CPU(), seed=1)
+
+        .. code-block:: python
+
+            simulation.create_state_random(
+                box=[20, 20, 20, 0, 0, 0], N=4000, min_distance=0.9
+            )
+        """
+        box = hoomd.Box.from_box(box)
+        types = list(types)
+        if type_fractions is None:
+            type_fractions = [1.0] * len(types)
+        if type_masses is None:
+            type_masses = [1.0] * len(types)
+
+        self._warn_if_seed_unset()
+        initializer = _hoomd.DistributedRandomInitializer(
+            box._cpp_obj,
+            int(N),
+            float(min_distance),
+            [float(fraction) for fraction in type_fractions],
+            [float(mass) for mass in type_masses],
+            types,
+            0 if self.seed is None else self.seed,
+        )
+        self._create_state_from_initializer(
+            initializer, box, types, domain_decomposition
+        )
+
+    def _create_state_from_initializer(
+        self, initializer, box, type_names, domain_decomposition
+    ):
+        """Create the state from slices generated by a C++ initializer."""
+        if self._state is not None:
+            raise RuntimeError("Cannot initialize more than once\n")
+
+        communicator = self.device.communicator
+        if communicator.num_ranks > 1:
+            # the root rank only provides the box and types
+            snapshot = Snapshot(communicator)
+            if communicator.rank == 0:
+                snapshot.configuration.box = box
+                snapshot.particles.types = type_names
+
+            n_global = initializer.getNGlobal()
+            first = n_global * communicator.rank // communicator.num_ranks
+            last = n_global * (communicator.rank + 1) // communicator.num_ranks
+            local_particle_data = (
+                initializer.getSlice(first, last - first),
+                first,
+                n_global,
+            )
+        else:
+            snapshot = Snapshot._from_cpp_snapshot(
+                initializer.getSnapshot(), communicator
+            )
+            local_particle_data = None
+
+        self._state = State(
+            self, snapshot, domain_decomposition, local_particle_data
+        )
+
+        step = 0
+        if self.timestep is not None:
+            step = self.timestep
+
+        self._init_system(step)
+
     @property
     def state(self):
         """hoomd.State: The current simulation state."""
@@ -407,6 +642,103 @@ class Simulation(metaclass=Loggable):
         else:
             return self._cpp_sys.walltime
 
+    @property
+    def memory_usage(self):
+        """dict[str, tuple[int, int]]: Memory held by internal arrays (bytes).
+
+        Maps the name of each owner to a tuple of the host and device memory,
+        in bytes, held on this MPI rank by the owner's internal arrays. Owners
+        are ``"State"`` (particle and bonded group data), the class names of
+        the attached operations (operations of the same class are combined),
+        and ``"other"``. Use the ``memory_host_bytes`` and
+        ``memory_device_bytes`` loggable quantities of each
+        `hoomd.operation.Operation` to log the memory of individual
+        operations.
+
+        Note:
+            `memory_usage` includes the memory held by internal particle,
+            bond, and operation arrays. Temporary device scratch buffers, HPMC
+            shape parameters, and memory allocated by external libraries are
+            not included.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            total_device_bytes = sum(
+                device_bytes
+                for host_bytes, device_bytes in simulation.memory_usage.values()
+            )
+        """
+        return self.device._cpp_exec_conf.getMemoryUsage()
+
+    @property
+    def profiling(self):
+        """bool: Measure the wall clock time spent in each operation.
+
+        When `profiling` is `True`, `Simulation` measures the time spent in
+        every operation it executes, the time each `hoomd.md.force.Force`
+        spends computing forces, the time each neighbor list spends building,
+        and the time spent in MPI communication. Access the results through the
+        ``profile_walltime``, ``profile_last_walltime``, and
+        ``profile_num_calls`` loggable quantities of each
+        `hoomd.operation.Operation` and `communication_walltime`. The
+        measurements accumulate over all calls to `run` while `profiling` is
+        enabled.
+
+        Times are inclusive: the time reported for an integrator includes the
+        time its forces take to compute.
+
+        On the GPU, `profiling` also times every autotuned kernel launch with
+        GPU events. Access the results through the ``profile_kernel_time``
+        loggable quantity of each `hoomd.operation.Operation`.
+
+        Note:
+            On the GPU, profiling synchronizes the device before and after each
+            measured region, which reduces performance.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.profiling = True
+        """
+        return self._profiling
+
+    @profiling.setter
+    def profiling(self, value):
+        self._profiling = bool(value)
+        if self._state is not None:
+            self._state._cpp_sys_def.setProfilingEnabled(self._profiling)
+            self.device._cpp_exec_conf.setKernelTiming(self._profiling)
+
+    @log(category="sequence", default=False)
+    def communication_walltime(self):
+        """(3, ) `numpy.ndarray` of ``numpy.float64``: Communication time (s).
+
+        The elements are the total wall clock time spent migrating particles,
+        exchanging ghost particles, and updating ghost particle positions.
+        All elements are 0 when `profiling` is disabled or the simulation is not
+        domain decomposed.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=["communication_walltime"])
+        """
+        communicator = getattr(self, "_system_communicator", None)
+        if communicator is None:
+            return numpy.zeros(3)
+
+        return numpy.array(
+            [
+                communicator.getMigrateProfileTimer().total_time,
+                communicator.getGhostExchangeProfileTimer().total_time,
+                communicator.getGhostUpdateProfileTimer().total_time,
+            ]
+        )
+
     @log
     def final_timestep(self):
         """float: `run` will end at this timestep.
@@ -482,6 +814,40 @@ class Simulation(metaclass=Loggable):
             if value:
                 self._state._cpp_sys_def.getParticleData().setPressureFlag()
 
+    @property
+    def always_compute_energy(self):
+        """bool: Always compute the potential energy (defaults to ``True``).
+
+        Set `always_compute_energy` to False to compute the potential energy
+        only on timesteps where it is needed (when a writer that logs data is
+        triggered, when a custom action requests
+        ``Action.Flags.POTENTIAL_ENERGY``, or when using an energy minimizer).
+        On other timesteps, the forces skip the energy computation and the
+        per-particle energies, the total energy, and the thermodynamic potential
+        energy are not valid.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.always_compute_energy = False
+        """
+        if not hasattr(self, "_cpp_sys"):
+            return True
+        else:
+            return self._cpp_sys.getEnergyFlag()
+
+    @always_compute_energy.setter
+    def always_compute_energy(self, value):
+        if not hasattr(self, "_cpp_sys"):
+            raise RuntimeError("Cannot set flag without state")
+        else:
+            self._cpp_sys.setEnergyFlag(value)
+
+            # if the flag is true, also set it in the particle data
+            if value:
+                self._state._cpp_sys_def.getParticleData().setEnergyFlag()
+
     def run(self, steps, write_at_start=False):
         """Advance the simulation a number of steps.
 
@@ -172,6 +172,13 @@ class Snapshot:
         Note:
             Set ``N`` to change the size of the arrays.
 
+        Call ``particles.adopt(name, array)`` to use an existing C-contiguous
+        array (such as a `numpy.memmap`) as the ``position``, ``velocity``,
+        ``typeid``, ``mass``, ``charge``, ``diameter``, or ``image`` field
+        without copying it. The array must have the dtype and shape of the
+        field. Adopting a field of an empty snapshot sets ``N``. Changing
+        ``N``, replicating, or wrapping the snapshot copies the adopted arrays.
+
         .. rubric:: Example:
 
         .. code-block:: python
@@ -71,7 +71,7 @@ def _create_domain_decomposition(device, box, domain_decomposition):
     else:
         grid = [v if v is not None else 0 for v in domain_decomposition]
         result = _hoomd.DomainDecomposition(
-            device._cpp_exec_conf, box.getL(), *grid, False
+            device._cpp_exec_conf, box.getL(), *grid, True
         )
 
     return result
@@ -251,21 +251,47 @@ class State:
     .. _Kamberaj 2005: https://dx.doi.org/10.1063/1.1906216
     """
 
-    def __init__(self, simulation, snapshot, domain_decomposition):
+    def __init__(
+        self,
+        simulation,
+        snapshot,
+        domain_decomposition,
+        local_particle_data=None,
+    ):
         self._simulation = simulation
         snapshot._broadcast_box()
         decomposition = _create_domain_decomposition(
             simulation.device, snapshot._cpp_obj._global_box, domain_decomposition
         )
 
-        if decomposition is not None:
-            self._cpp_sys_def = _hoomd.SystemDefinition(
-                snapshot._cpp_obj, simulation.device._cpp_exec_conf, decomposition
-            )
-        else:
-            self._cpp_sys_def = _hoomd.SystemDefinition(
-                snapshot._cpp_obj, simulation.device._cpp_exec_conf
-            )
+        # account the particle and bonded group data to the state
+        self._memory_tag = simulation.device._cpp_exec_conf.addMemoryTag(
+            "State"
+        )
+        with simulation.device._memory_scope(self._memory_tag):
+            if local_particle_data is not None and decomposition is not None:
+                # particle data was read in slices by all ranks
+                cpp_local_particle_data, tag_offset, n_global = (
+                    local_particle_data
+                )
+                self._cpp_sys_def = _hoomd.SystemDefinition(
+                    snapshot._cpp_obj,
+                    cpp_local_particle_data,
+                    tag_offset,
+                    n_global,
+                    simulation.device._cpp_exec_conf,
+                    decomposition,
+                )
+            elif decomposition is not None:
+                self._cpp_sys_def = _hoomd.SystemDefinition(
+                    snapshot._cpp_obj,
+                    simulation.device._cpp_exec_conf,
+                    decomposition,
+                )
+            else:
+                self._cpp_sys_def = _hoomd.SystemDefinition(
+                    snapshot._cpp_obj, simulation.device._cpp_exec_conf
+                )
 
         # Necessary for local snapshot API. This is used to ensure two local
         # snapshots are not contexted at once.
@@ -367,6 +393,79 @@ class State:
         self._cpp_sys_def.initializeFromSnapshot(snapshot._cpp_obj)
         self.update_group_dof()
 
+    def take_checkpoint(self, checkpoint=None):
+        """Copy the local particle and topology data for a fast rollback.
+
+        `take_checkpoint` copies the particles on each MPI rank into device
+        memory (or host memory on the CPU) without gathering them on the root
+        rank. The cost is proportional to the number of local particles, while
+        `get_snapshot` communicates and sorts the whole system by tag.
+        `restore_checkpoint` resets the particles to the copy. Use these
+        methods in place of `get_snapshot` and `set_snapshot` to quickly roll
+        back rejected moves in replica exchange, umbrella sampling, and other
+        adaptive sampling loops.
+
+        Args:
+            checkpoint: A checkpoint returned by a previous call to
+                `take_checkpoint`. When given, its memory is reused. Pass
+                ``None`` to allocate a new checkpoint. Keep a list of
+                checkpoints to implement a ring of previous states.
+
+        Returns:
+            The checkpoint holding the current particle data.
+
+        A checkpoint stores the particle positions, types, velocities,
+        masses, accelerations, charges, diameters, images, body ids,
+        orientations, angular momenta, moments of inertia, and the box, as well
+        as the bonds, angles, dihedrals, impropers, constraints, and special
+        pairs stored on each rank. It does not store the timestep or the state
+        of integration methods (such as thermostat variables). The forces are
+        recomputed when the next `Simulation.run` starts.
+
+        Note:
+            Checkpoints are only valid in the simulation that took them. In
+            MPI simulations, all ranks must restore the same checkpoint.
+
+        See Also:
+            `restore_checkpoint`
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            checkpoint = simulation.state.take_checkpoint()
+        """
+        if checkpoint is None:
+            checkpoint = _hoomd.SystemDefinitionCheckpoint()
+        self._cpp_sys_def.takeCheckpoint(checkpoint)
+        return checkpoint
+
+    def restore_checkpoint(self, checkpoint):
+        """Restore the local particle data from a checkpoint.
+
+        Args:
+            checkpoint: A checkpoint returned by `take_checkpoint`.
+
+        Warning:
+            Particles, bonds, angles, dihedrals, impropers, constraints, and
+            special pairs must not be added or removed between
+            `take_checkpoint` and `restore_checkpoint`. In MPI simulations, the
+            domain decomposition must not change in between.
+
+        See Also:
+            `take_checkpoint`
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.state.restore_checkpoint(checkpoint)
+        """
+        if self._in_context_manager:
+            raise RuntimeError("Cannot restore a checkpoint inside local snapshot.")
+
+        self._cpp_sys_def.restoreCheckpoint(checkpoint)
+
     @property
     def particle_types(self):
         """list[str]: List of all particle types in the simulation state.
@@ -857,6 +956,31 @@ class State:
             ]
         )
 
+    @property
+    def keep_reorder_buffers(self):
+        """bool: Keep a second copy of the per-particle arrays allocated.
+
+        HOOMD-blue reorders the local particles when it sorts them and when
+        particles migrate between MPI ranks. The reordered data is written to a
+        second set of arrays that is then swapped with the current one. When
+        `keep_reorder_buffers` is `False`, the second set is freed between
+        reorders, which reduces the steady state memory use at the cost of an
+        allocation each time the particles are reordered.
+
+        Defaults to `True`.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.state.keep_reorder_buffers = False
+        """
+        return self._cpp_sys_def.getParticleData().getAltArraysResident()
+
+    @keep_reorder_buffers.setter
+    def keep_reorder_buffers(self, value):
+        self._cpp_sys_def.getParticleData().setAltArraysResident(bool(value))
+
     @property
     def _simulation(self):
         sim = self._simulation_
@@ -89,6 +89,17 @@ UP_TEST(GPUArray_basic_tests)
         for (int i = 0; i < (int)array_c.getNumElements(); i++)
             UP_ASSERT_EQUAL(h_handle.data[i], i);
         }
+
+    // basic check 6: device-only arrays allocate host memory when the device is not used
+    GPUArray<int> scratch(100, exec_conf, array_storage::device_only);
+    UP_ASSERT(!scratch.isDeviceOnly());
+
+        {
+        ArrayHandle<int> h_handle(scratch, access_location::host, access_mode::readwrite, 10, 10);
+        UP_ASSERT(h_handle.data != NULL);
+        for (int i = 10; i < 20; i++)
+            h_handle.data[i] = i;
+        }
     }
 
 #ifdef ENABLE_HIP
@@ -207,6 +218,129 @@ UP_TEST(GPUArray_transfer_tests)
         }
     }
 
+//! test case for testing transfers of ranges of elements
+UP_TEST(GPUArray_range_transfer_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    UP_ASSERT(exec_conf->isCUDAEnabled());
+
+    GPUArray<int> gpu_array(100, exec_conf);
+
+        {
+        ArrayHandle<int> d_handle(gpu_array, access_location::device, access_mode::readwrite);
+        gpu_fill_test_pattern(d_handle.data, gpu_array.getNumElements());
+        hipError_t err_sync = hipPeekAtLastError();
+        exec_conf->handleHIPError(err_sync, __FILE__, __LINE__);
+        }
+
+        // read a range in the middle and then the first half on the host
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read, 10, 10);
+        for (int i = 10; i < 20; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i);
+        }
+
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read, 0, 50);
+        for (int i = 0; i < 50; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i);
+        }
+
+        // the rest is copied on the next full access
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read);
+        for (int i = 0; i < (int)gpu_array.getNumElements(); i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i);
+        }
+
+        // write a few elements on the host and update all of them on the device
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::readwrite, 0, 10);
+        for (int i = 0; i < 10; i++)
+            h_handle.data[i] = -i;
+        }
+
+        {
+        ArrayHandle<int> d_handle(gpu_array, access_location::device, access_mode::readwrite);
+        gpu_add_one(d_handle.data, gpu_array.getNumElements());
+        hipError_t err_sync = hipPeekAtLastError();
+        exec_conf->handleHIPError(err_sync, __FILE__, __LINE__);
+        }
+
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read);
+        for (int i = 0; i < 10; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], -i + 1);
+        for (int i = 10; i < (int)gpu_array.getNumElements(); i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i + 1);
+        }
+
+        // write outside of the range of a handle on the device, only the range is copied back
+        {
+        ArrayHandle<int> d_handle(gpu_array,
+                                  access_location::device,
+                                  access_mode::readwrite,
+                                  0,
+                                  10);
+        gpu_add_one(d_handle.data, gpu_array.getNumElements());
+        hipError_t err_sync = hipPeekAtLastError();
+        exec_conf->handleHIPError(err_sync, __FILE__, __LINE__);
+        }
+
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read);
+        for (int i = 0; i < 10; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], -i + 2);
+        for (int i = 10; i < (int)gpu_array.getNumElements(); i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i + 1);
+        }
+    }
+
+//! test case for testing arrays without host memory
+UP_TEST(GPUArray_device_only_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    GPUArray<int> gpu_array(100, exec_conf, array_storage::device_only);
+    UP_ASSERT(gpu_array.isDeviceOnly());
+    UP_ASSERT(!gpu_array.isNull());
+
+        {
+        ArrayHandle<int> d_handle(gpu_array, access_location::device, access_mode::readwrite);
+        UP_ASSERT(d_handle.data != NULL);
+        gpu_fill_test_pattern(d_handle.data, gpu_array.getNumElements());
+        hipError_t err_sync = hipPeekAtLastError();
+        exec_conf->handleHIPError(err_sync, __FILE__, __LINE__);
+        }
+
+    UP_ASSERT_EXCEPTION(std::runtime_error,
+                        [&] { ArrayHandle<int> h_handle(gpu_array, access_location::host); });
+
+    // copies and resized arrays keep the data on the device
+    GPUArray<int> array_b(gpu_array);
+    UP_ASSERT(array_b.isDeviceOnly());
+    array_b.resize(200);
+    UP_ASSERT_EQUAL((int)array_b.getNumElements(), 200);
+
+    GPUArray<int> host_array(200, exec_conf);
+        {
+        ArrayHandle<int> d_handle(array_b, access_location::device, access_mode::read);
+        ArrayHandle<int> d_host_array(host_array,
+                                      access_location::device,
+                                      access_mode::overwrite);
+        hipMemcpy(d_host_array.data, d_handle.data, sizeof(int) * 200, hipMemcpyDeviceToDevice);
+        }
+
+        {
+        ArrayHandle<int> h_handle(host_array, access_location::host, access_mode::read);
+        for (int i = 0; i < 100; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i);
+        for (int i = 100; i < 200; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], 0);
+        }
+    }
+
 //! Tests operations on NULL GPUArrays
 UP_TEST(GPUArray_null_tests)
     {
@@ -242,6 +376,44 @@ UP_TEST(GPUArray_null_tests)
     UP_ASSERT_EQUAL(a.getNumElements(), (unsigned)1000);
     }
 
+//! Tests that the version changes exactly when the data may change
+UP_TEST(GPUArray_version_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    GPUArray<int> a(100, exec_conf);
+    GPUArray<int> b(100, exec_conf);
+
+    uint64_t version = a.getVersion();
+        {
+        ArrayHandle<int> h_handle(a, access_location::host, access_mode::read);
+        }
+    UP_ASSERT_EQUAL(a.getVersion(), version);
+
+        {
+        ArrayHandle<int> h_handle(a, access_location::host, access_mode::readwrite);
+        }
+    UP_ASSERT(a.getVersion() > version);
+    version = a.getVersion();
+
+        {
+        ArrayHandle<int> h_handle(a, access_location::host, access_mode::overwrite, 10, 1);
+        }
+    UP_ASSERT(a.getVersion() > version);
+
+    // both arrays change in a swap, even when their versions were equal
+    a.swap(b);
+    uint64_t version_a = a.getVersion();
+    uint64_t version_b = b.getVersion();
+    UP_ASSERT(version_a > version);
+    UP_ASSERT(version_b > version);
+
+    // assignment changes the data
+    a = b;
+    UP_ASSERT(a.getVersion() > version_a);
+    UP_ASSERT_EQUAL(b.getVersion(), version_b);
+    }
+
 //! Tests resize methods
 UP_TEST(GPUArray_resize_tests)
     {
@@ -347,6 +519,95 @@ UP_TEST(GPUArray_resize_tests)
         }
     }
 
+//! Tests that freed GPUArray memory is recycled by the memory pool
+UP_TEST(GPUArray_pool_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    MemoryPool& pool = exec_conf->getMemoryPool();
+    pool.resetStatistics();
+
+        {
+        GPUArray<unsigned int> a(1000, exec_conf);
+        ArrayHandle<unsigned int> h_handle(a, access_location::host, access_mode::overwrite);
+        for (unsigned int i = 0; i < 1000; i++)
+            h_handle.data[i] = i + 1;
+        }
+
+    MemoryPool::Statistics stats = pool.getStatistics();
+    UP_ASSERT_EQUAL(stats.host_misses, (uint64_t)1);
+    UP_ASSERT_EQUAL(stats.host_hits, (uint64_t)0);
+    UP_ASSERT(stats.host_cached_bytes >= 1000 * sizeof(unsigned int));
+
+    // a request in the same size class reuses the freed block
+    GPUArray<unsigned int> b(990, exec_conf);
+    stats = pool.getStatistics();
+    UP_ASSERT_EQUAL(stats.host_misses, (uint64_t)1);
+    UP_ASSERT_EQUAL(stats.host_hits, (uint64_t)1);
+    UP_ASSERT_EQUAL(stats.host_cached_bytes, (size_t)0);
+
+        {
+        // recycled memory is cleared
+        ArrayHandle<unsigned int> h_handle(b, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < 990; i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], (unsigned int)0);
+        }
+
+    // growing the array returns the old block to the pool
+    b.resize(4000);
+    stats = pool.getStatistics();
+    UP_ASSERT_EQUAL(stats.host_misses, (uint64_t)2);
+    UP_ASSERT(stats.host_cached_bytes >= 990 * sizeof(unsigned int));
+
+    // shrinking the limit releases the cache
+    pool.setMaxCachedBytes(0);
+    stats = pool.getStatistics();
+    UP_ASSERT_EQUAL(stats.host_cached_bytes, (size_t)0);
+
+    // with a limit of 0, freed blocks are not cached
+    b.resize(10);
+    stats = pool.getStatistics();
+    UP_ASSERT_EQUAL(stats.host_cached_bytes, (size_t)0);
+    }
+
+//! Tests that GPUArray memory is accounted to the owner that allocates it
+UP_TEST(GPUArray_memory_tracker_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    MemoryTracker& tracker = exec_conf->getMemoryTracker();
+    unsigned int tag = tracker.addTag("owner");
+
+    GPUVector<unsigned int> a(exec_conf);
+        {
+        MemoryTracker::Scope scope(tracker, tag);
+        a.resize(100);
+        }
+    UP_ASSERT(tracker.getBytes(tag, MemoryTracker::host) >= 100 * sizeof(unsigned int));
+
+    // resizing outside the scope keeps the owner
+    a.resize(1000);
+    UP_ASSERT(tracker.getBytes(tag, MemoryTracker::host) >= 1000 * sizeof(unsigned int));
+    UP_ASSERT_EQUAL(tracker.getBytes(0, MemoryTracker::host), (size_t)0);
+
+    // swapped allocations keep their owner
+    GPUVector<unsigned int> b(10, exec_conf);
+    UP_ASSERT_EQUAL(tracker.getBytes(0, MemoryTracker::host), 10 * sizeof(unsigned int));
+    size_t owner_bytes = tracker.getBytes(tag, MemoryTracker::host);
+    a.swap(b);
+    UP_ASSERT_EQUAL(tracker.getBytes(tag, MemoryTracker::host), owner_bytes);
+
+    // freeing the memory releases the account
+    a = GPUVector<unsigned int>();
+    b = GPUVector<unsigned int>();
+    UP_ASSERT_EQUAL(tracker.getBytes(tag, MemoryTracker::host), (size_t)0);
+    UP_ASSERT_EQUAL(tracker.getBytes(0, MemoryTracker::host), (size_t)0);
+
+    std::map<std::string, std::pair<size_t, size_t>> usage = tracker.getUsage();
+    UP_ASSERT(usage.count("owner") == 1);
+    UP_ASSERT(usage.count("other") == 1);
+    }
+
 //! Tests GPUVector
 UP_TEST(GPUVector_basic_tests)
     {
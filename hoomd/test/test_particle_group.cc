@@ -261,6 +261,57 @@ UP_TEST(ParticleGroup_sort_test)
         }
     }
 
+//! Checks that a small ParticleGroup updates its index list incrementally after resorts
+UP_TEST(ParticleGroup_sort_small_test)
+    {
+    std::shared_ptr<SystemDefinition> sysdef = create_sysdef();
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    std::shared_ptr<ParticleFilter> selector(
+        new ParticleFilterTags(std::vector<unsigned int>({2, 7})));
+    ParticleGroup tags27(sysdef, selector);
+    CHECK_EQUAL_UINT(tags27.getNumMembers(), 2);
+    CHECK_EQUAL_UINT(tags27.getMemberIndex(0), 2);
+    CHECK_EQUAL_UINT(tags27.getMemberIndex(1), 7);
+
+    // resort the particles twice to check that the old indices are cleared
+    for (unsigned int shift = 1; shift <= 2; shift++)
+        {
+            {
+            ArrayHandle<unsigned int> h_tag(pdata->getTags(),
+                                            access_location::host,
+                                            access_mode::readwrite);
+            ArrayHandle<unsigned int> h_rtag(pdata->getRTags(),
+                                             access_location::host,
+                                             access_mode::readwrite);
+
+            // rotate the particle order by shift positions
+            for (unsigned int i = 0; i < pdata->getN(); i++)
+                {
+                unsigned int tag = (i + shift) % pdata->getN();
+                h_tag.data[i] = tag;
+                h_rtag.data[tag] = i;
+                }
+            }
+
+        pdata->notifyParticleSort();
+
+        // indices are in sorted order
+        CHECK_EQUAL_UINT(tags27.getNumMembers(), 2);
+        CHECK_EQUAL_UINT(tags27.getMemberIndex(0), 2 - shift);
+        CHECK_EQUAL_UINT(tags27.getMemberIndex(1), 7 - shift);
+
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < pdata->getN(); i++)
+            {
+            if (h_tag.data[i] == 2 || h_tag.data[i] == 7)
+                UP_ASSERT(tags27.isMember(i));
+            else
+                UP_ASSERT(!tags27.isMember(i));
+            }
+        }
+    }
+
 //! Checks that ParticleGroup can initialize by particle type
 UP_TEST(ParticleGroup_type_test)
     {
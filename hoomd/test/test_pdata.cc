@@ -13,7 +13,9 @@
 
 #include "hoomd/Initializers.h"
 #include "hoomd/ParticleData.h"
+#include "hoomd/ParticleDataSoA.h"
 #include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
 
 #include "upp11_config.h"
 
@@ -615,6 +617,191 @@ UP_TEST(ParticleData_test)
         }
     }
 
+//! Checks that removed tags are reused smallest first and that the reverse lookup table shrinks
+UP_TEST(ParticleData_tag_recycling_test)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    ParticleData pdata(6, box, 1, exec_conf);
+    UP_ASSERT_EQUAL(pdata.getRTags().size(), 6);
+
+    pdata.removeParticle(1);
+    pdata.removeParticle(3);
+    UP_ASSERT_EQUAL(pdata.getRTags().size(), 6);
+
+    // the smallest free tag is reused first
+    UP_ASSERT_EQUAL(pdata.addParticle(0), 1);
+    UP_ASSERT_EQUAL(pdata.addParticle(0), 3);
+    UP_ASSERT_EQUAL(pdata.addParticle(0), 6);
+
+    // removing the maximum tags shrinks the table and forgets the free tags above the maximum
+    pdata.removeParticle(4);
+    pdata.removeParticle(5);
+    UP_ASSERT_EQUAL(pdata.getRTags().size(), 7);
+    pdata.removeParticle(6);
+    UP_ASSERT_EQUAL(pdata.getRTags().size(), 4);
+    UP_ASSERT_EQUAL(pdata.getMaximumTag(), 3);
+    UP_ASSERT_EQUAL(pdata.getNGlobal(), 4);
+
+    UP_ASSERT_EQUAL(pdata.addParticle(0), 4);
+    UP_ASSERT_EQUAL(pdata.getRTags().size(), 5);
+    ArrayHandle<unsigned int> h_tag(pdata.getTags(), access_location::host, access_mode::read);
+    for (unsigned int tag = 0; tag < 5; tag++)
+        {
+        UP_ASSERT(pdata.isTagActive(tag));
+        UP_ASSERT_EQUAL(h_tag.data[pdata.getRTag(tag)], tag);
+        }
+    }
+
+//! Checks that the ParticleDataSoA mirror tracks the particle data
+UP_TEST(ParticleDataSoA_test)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    const unsigned int N = 10;
+    ParticleData pdata(N, box, 2, exec_conf);
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::overwrite);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            h_pos.data[i] = make_scalar4(Scalar(i),
+                                         Scalar(-1.0 * i),
+                                         Scalar(0.5 * i),
+                                         __int_as_scalar(i % 2));
+            }
+        }
+
+    ParticleDataSoA& soa = pdata.getSoA();
+    soa.update(0);
+    UP_ASSERT_EQUAL(soa.getSize(), N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        UP_ASSERT_EQUAL(soa.getX()[i], Scalar(i));
+        UP_ASSERT_EQUAL(soa.getY()[i], Scalar(-1.0 * i));
+        UP_ASSERT_EQUAL(soa.getZ()[i], Scalar(0.5 * i));
+        UP_ASSERT_EQUAL(soa.getTypes()[i], i % 2);
+        }
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        h_pos.data[0].x = Scalar(4.0);
+        }
+
+    // host writes to the positions refresh the mirror within a timestep
+    soa.update(0);
+    UP_ASSERT_EQUAL(soa.getX()[0], Scalar(4.0));
+
+    // reads do not
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(), access_location::host, access_mode::read);
+        }
+    soa.update(0);
+    UP_ASSERT_EQUAL(soa.getX()[0], Scalar(4.0));
+    soa.update(1);
+    UP_ASSERT_EQUAL(soa.getX()[0], Scalar(4.0));
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        h_pos.data[0].x = Scalar(3.0);
+        }
+    pdata.notifyParticleSort();
+    soa.update(1);
+    UP_ASSERT_EQUAL(soa.getX()[0], Scalar(3.0));
+    }
+
+//! Reads the GPU table of a bonded group data as (n_groups, members, positions) per particle
+template<class GroupData>
+std::vector<std::vector<unsigned int>> read_gpu_table(GroupData& gdata, unsigned int N)
+    {
+    const GPUVector<typename GroupData::members_t>& table = gdata.getGPUTable();
+    const GPUArray<unsigned int>& pos_table = gdata.getGPUPosTable();
+    const Index2D& indexer = gdata.getGPUTableIndexer();
+    ArrayHandle<typename GroupData::members_t> h_table(table,
+                                                       access_location::host,
+                                                       access_mode::read);
+    ArrayHandle<unsigned int> h_pos_table(pos_table, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_groups(gdata.getNGroupsArray(),
+                                         access_location::host,
+                                         access_mode::read);
+
+    std::vector<std::vector<unsigned int>> rows(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        rows[i].push_back(h_n_groups.data[i]);
+        for (unsigned int k = 0; k < h_n_groups.data[i]; k++)
+            {
+            for (unsigned int j = 0; j < GroupData::size; j++)
+                rows[i].push_back(h_table.data[indexer(i, k)].idx[j]);
+            rows[i].push_back(h_pos_table.data[indexer(i, k)]);
+            }
+        }
+    return rows;
+    }
+
+//! Checks that the GPU tables remapped with a sort order match rebuilt tables
+UP_TEST(BondedGroupData_sort_remap_test)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    const unsigned int N = 8;
+    auto sysdef = std::make_shared<SystemDefinition>(N,
+                                                     std::make_shared<BoxDim>(10.0),
+                                                     1,
+                                                     2,
+                                                     1,
+                                                     0,
+                                                     0,
+                                                     exec_conf);
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+    std::shared_ptr<BondData> bdata = sysdef->getBondData();
+    std::shared_ptr<AngleData> adata = sysdef->getAngleData();
+
+    // a linear chain
+    for (unsigned int i = 0; i < N - 1; i++)
+        bdata->addBondedGroup(Bond(i % 2, i, i + 1));
+    for (unsigned int i = 0; i < N - 2; i++)
+        adata->addBondedGroup(Angle(0, i, i + 1, i + 2));
+
+    // build the tables before the sort
+    read_gpu_table(*bdata, N);
+    read_gpu_table(*adata, N);
+
+    const std::vector<unsigned int> order = {3, 7, 0, 5, 1, 6, 2, 4};
+        {
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::readwrite);
+        ArrayHandle<unsigned int> h_rtag(pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::readwrite);
+        std::vector<unsigned int> old_tag(h_tag.data, h_tag.data + N);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            h_tag.data[i] = old_tag[order[i]];
+            h_rtag.data[h_tag.data[i]] = i;
+            }
+        }
+    pdata->notifyParticleSort(order.data());
+    UP_ASSERT(pdata->getSortOrder() == nullptr);
+
+    std::vector<std::vector<unsigned int>> bonds_remapped = read_gpu_table(*bdata, N);
+    std::vector<std::vector<unsigned int>> angles_remapped = read_gpu_table(*adata, N);
+
+    bdata->setDirty();
+    adata->setDirty();
+    UP_ASSERT(read_gpu_table(*bdata, N) == bonds_remapped);
+    UP_ASSERT(read_gpu_table(*adata, N) == angles_remapped);
+    }
+
 //! Tests the RandomParticleInitializer class
 UP_TEST(Random_test)
     {
@@ -4,11 +4,21 @@
 """Define LoadBalancer."""
 
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes, nonnegative_real
+from hoomd.error import TypeConversionError
 from hoomd.operation import Tuner
 from hoomd import _hoomd
 import hoomd
 
 
+def _damping(number):
+    """Ensure that the damping is in [0, 1)."""
+    float_number = nonnegative_real(number)
+    if float_number >= 1:
+        raise TypeConversionError("Expected a number less than one.")
+    return float_number
+
+
 class LoadBalancer(Tuner):
     r"""Adjusts the boundaries of the domain decomposition.
 
@@ -21,18 +31,57 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        md_particle_weight (float): Cost of an MD particle.
+        mpcd_particle_weight (float): Cost of an MPCD particle.
+        volume_weight (float): Cost per unit volume of a domain
+            :math:`[\mathrm{length}^{-D}]`.
+        timing (bool): Scale the cost of each rank by its measured time when
+            `True`.
+        damping (float): Weight of the previous cost factor when averaging it
+            with a new measurement.
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
-    the particle load close to evenly between them. The load imbalance is
-    defined as the number of particles owned by a rank divided by the average
-    number of particles per rank if the particles had a uniform distribution:
+    the load close to evenly between them. The load imbalance is defined as
+    the cost of a rank divided by the average cost per rank:
+
+    .. math::
+
+        I = \frac{C_i}{C / P}
+
+    where :math:`C_i` is the cost of rank :math:`i`, :math:`C` is the total
+    cost, and :math:`P` is the number of ranks. The cost of a rank is
+
+    .. math::
+
+        C_i = w_\mathrm{MD} N_i + w_\mathrm{MPCD} N_{\mathrm{MPCD},i}
+              + w_V V_i
+
+    where :math:`N_i` and :math:`N_{\mathrm{MPCD},i}` are the numbers of MD
+    and MPCD particles owned by the rank, :math:`V_i` is the volume (area in
+    2D) of its domain, and the weights are `md_particle_weight`,
+    `mpcd_particle_weight`, and `volume_weight`. By default, only the MD
+    particles are counted. Set `mpcd_particle_weight` to balance simulations
+    where the MPCD solvent dominates the cost. Work that scales with the
+    domain size, such as the MPCD collision cells, is modeled with
+    `volume_weight`: the cost per cell divided by the cell volume. Only the
+    ratios of the weights matter. Estimate them from the time per step of
+    short test runs, for example with and without the MPCD solvent.
+
+    When `timing` is `True` and `hoomd.Simulation.profiling` is enabled, the
+    cost of each rank is also scaled by a factor :math:`f_i` measured from the
+    time the rank spends in the integrator, excluding the time spent
+    communicating with other ranks (which includes waiting for them):
 
     .. math::
 
-        I = \frac{N_i}{N / P}
+        f_i \leftarrow d f_i + (1 - d) \frac{t_i / C_i}{\langle t / C \rangle}
 
-    where :math:`N_i` is the number of particles on rank :math:`i`, :math:`N` is
-    the total number of particles, and :math:`P` is the number of ranks.
+    where :math:`t_i` is the busy time of rank :math:`i` since the previous
+    balancing step, the average is over the ranks, and :math:`d` is `damping`.
+    Timing captures costs that the particle counts do not model, such as the
+    larger number of pair neighbors in the dense phase of a phase separating
+    system. Increase `damping` to reduce oscillations caused by noisy
+    measurements. The cost is not scaled when profiling is disabled.
 
     In order to adjust the load imbalance, `LoadBalancer` scales by the inverse
     of the imbalance factor. To reduce oscillations and communication overhead,
@@ -87,20 +136,57 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        md_particle_weight (float): Cost of an MD particle.
+        mpcd_particle_weight (float): Cost of an MPCD particle.
+        volume_weight (float): Cost per unit volume of a domain
+            :math:`[\mathrm{length}^{-D}]`.
+        timing (bool): Scale the cost of each rank by its measured time when
+            `True`.
+        damping (float): Weight of the previous cost factor when averaging it
+            with a new measurement.
     """
 
     __doc__ = __doc__.replace("{inherited}", Tuner._doc_inherited)
 
     def __init__(
-        self, trigger, x=True, y=True, z=True, tolerance=1.02, max_iterations=1
+        self,
+        trigger,
+        x=True,
+        y=True,
+        z=True,
+        tolerance=1.02,
+        max_iterations=1,
+        md_particle_weight=1.0,
+        mpcd_particle_weight=0.0,
+        volume_weight=0.0,
+        timing=False,
+        damping=0.5,
     ):
         super().__init__(trigger)
 
         defaults = dict(
-            x=x, y=y, z=z, tolerance=tolerance, max_iterations=max_iterations
+            x=x,
+            y=y,
+            z=z,
+            tolerance=tolerance,
+            max_iterations=max_iterations,
+            md_particle_weight=md_particle_weight,
+            mpcd_particle_weight=mpcd_particle_weight,
+            volume_weight=volume_weight,
+            timing=timing,
+            damping=damping,
         )
         load_balancer_params = ParameterDict(
-            x=bool, y=bool, z=bool, max_iterations=int, tolerance=float
+            x=bool,
+            y=bool,
+            z=bool,
+            max_iterations=int,
+            tolerance=float,
+            md_particle_weight=OnlyTypes(float, preprocess=nonnegative_real),
+            mpcd_particle_weight=OnlyTypes(float, preprocess=nonnegative_real),
+            volume_weight=OnlyTypes(float, preprocess=nonnegative_real),
+            timing=bool,
+            damping=OnlyTypes(float, preprocess=_damping),
         )
         self._param_dict.update(load_balancer_params)
         self._param_dict.update(defaults)
@@ -112,3 +198,4 @@ class LoadBalancer(Tuner):
             cpp_cls = getattr(_hoomd, "LoadBalancer")
 
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def, self.trigger)
+        self._cpp_obj.setSystem(self._simulation._cpp_sys)
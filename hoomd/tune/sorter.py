@@ -4,7 +4,8 @@
 """Define the ParticleSorter class."""
 
 from hoomd.data.parameterdicts import ParameterDict
-from hoomd.data.typeconverter import OnlyTypes
+from hoomd.data.typeconverter import OnlyTypes, positive_real
+from hoomd.logging import log
 from hoomd.operation import Tuner
 from hoomd import _hoomd
 import hoomd
@@ -22,11 +23,23 @@ class ParticleSorter(Tuner):
             value of `None` sets ``grid=4096`` in 2D simulations and
             ``grid=256`` in 3D simulations.
 
+        high_resolution (bool): When True, compute the position of each
+            particle along the Hilbert curve directly on a grid of ``1024**3``
+            cells in 3D and ``65536**2`` cells in 2D. Defaults to False.
+
+        max_disorder (float): Sort only when `disorder` is at least this value.
+            The default value of `None` sorts on every triggered timestep.
+
     `ParticleSorter` improves simulation performance by sorting the particles in
     memory along a space-filling curve. This takes particles that are close in
     space and places them close in memory, leading to a higher rate of
     cache hits when computing pair potentials.
 
+    Set `max_disorder` to sort only when the particles have lost their order
+    in memory. With a frequent trigger (such as ``hoomd.trigger.Periodic(20)``),
+    `ParticleSorter` then measures `disorder` often and sorts as often as the
+    dynamics of the system require.
+
     Note:
         New `hoomd.Operations` instances include a `ParticleSorter`
         constructed with default parameters.
@@ -42,12 +55,20 @@ class ParticleSorter(Tuner):
             `grid` rounds up to the nearest power of 2 when set. Larger values
             of `grid` provide more accurate space-filling curves, but consume
             more memory (``grid**D * 4`` bytes, where *D* is the dimensionality
-            of the system).
+            of the system). `grid` is not used when `high_resolution` is True.
+        high_resolution (bool): When True, compute the position of each
+            particle along the Hilbert curve directly on a fine grid. This
+            needs no memory for the traversal order and also orders 2D systems
+            along a Hilbert curve.
+        max_disorder (float): Sort only when `disorder` is at least this value,
+            or on every triggered timestep when `None`.
     """
 
     __doc__ = __doc__.replace("{inherited}", Tuner._doc_inherited)
 
-    def __init__(self, trigger=200, grid=None):
+    def __init__(
+        self, trigger=200, grid=None, high_resolution=False, max_disorder=None
+    ):
         super().__init__(trigger)
         sorter_params = ParameterDict(
             grid=OnlyTypes(
@@ -55,10 +76,25 @@ class ParticleSorter(Tuner):
                 postprocess=ParticleSorter._to_power_of_two,
                 preprocess=ParticleSorter._natural_number,
                 allow_none=True,
-            )
+            ),
+            high_resolution=bool(high_resolution),
+            max_disorder=OnlyTypes(float, preprocess=positive_real, allow_none=True),
         )
         self._param_dict.update(sorter_params)
         self.grid = grid
+        self.max_disorder = max_disorder
+
+    @log(requires_run=True)
+    def disorder(self):
+        """float: Fraction of consecutive particles that are out of order.
+
+        Particles are out of order when the one later in memory comes earlier
+        along the space-filling curve.
+
+        `disorder` is 0 immediately after a sort and approaches 1/2 as the
+        particles mix.
+        """
+        return self._cpp_obj.disorder
 
     @staticmethod
     def _to_power_of_two(value):
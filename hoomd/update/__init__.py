@@ -15,5 +15,12 @@ from hoomd.update.box_resize import BoxResize
 from hoomd.update.remove_drift import RemoveDrift
 from hoomd.update.custom_updater import CustomUpdater
 from hoomd.update.particle_filter import FilterUpdater
+from hoomd.update.replica_exchange import ReplicaExchange
 
-__all__ = ["BoxResize", "CustomUpdater", "FilterUpdater", "RemoveDrift"]
+__all__ = [
+    "BoxResize",
+    "CustomUpdater",
+    "FilterUpdater",
+    "RemoveDrift",
+    "ReplicaExchange",
+]
@@ -0,0 +1,141 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement ReplicaExchange.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    kT = hoomd.variant.Constant(1.0)
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+"""
+
+from hoomd.operation import Updater
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes
+from hoomd.logging import log
+from hoomd.variant import Constant
+from hoomd import _hoomd
+
+
+class ReplicaExchange(Updater):
+    r"""Exchange state parameters between replicas in MPI partitions.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to attempt
+            exchanges.
+        parameter (hoomd.variant.Constant): The state parameter of the replica
+            in this partition.
+        values (list[float]): The ladder of parameter values, one per
+            partition.
+        observable (`callable`): Returns the observable :math:`A` of the
+            replica in this partition.
+        inverse (bool): When `True`, the reduced energy couples to the inverse
+            of the parameter.
+
+    Run one replica in each partition of the MPI world (see
+    `hoomd.communicator.Communicator`). The replicas share a ladder of values
+    :math:`\lambda_k` for one state parameter, such as the temperature, the
+    pressure, or an alchemical coupling. Pass the same `hoomd.variant.Constant`
+    to `ReplicaExchange` and to the operations that read the parameter.
+    `ReplicaExchange` sets its value to the rung of the ladder held by the
+    partition, starting with ``values[partition]``.
+
+    The reduced energy of a replica at rung :math:`k` is
+    :math:`u_k = c(\lambda_k) A`, where :math:`c(\lambda) = \lambda`, or
+    :math:`c(\lambda) = 1 / \lambda` when `inverse` is `True`. On each
+    triggered timestep, `ReplicaExchange` attempts to exchange the rungs
+    :math:`(k, k+1)` for even :math:`k` on even attempts and odd :math:`k` on
+    odd attempts. It accepts the exchange of the rungs held by replicas
+    :math:`a` and :math:`b` with probability:
+
+    .. math::
+
+        p = \min\left(1, e^{-(c(\lambda_{k+1}) - c(\lambda_k))(A_a - A_b)}
+            \right)
+
+    For example, use ``inverse=True`` with temperatures and the potential
+    energy for parallel tempering, or the pressures with :math:`V / kT` for a
+    pressure ladder at constant temperature.
+
+    Only the parameter values move between partitions: each exchange is one
+    small message over all ranks, independent of the number of particles.
+
+    Important:
+        All partitions must use the same `trigger`, and `observable` must
+        return the same value on all ranks in a partition.
+
+    Note:
+        Exchanges do not rescale the velocities. Thermostats re-equilibrate
+        the kinetic energy after an exchange of temperatures.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        n_partitions = simulation.device.communicator.num_partitions
+        replica_exchange = hoomd.update.ReplicaExchange(
+            trigger=hoomd.trigger.Periodic(1000),
+            parameter=kT,
+            values=[1.0 + 0.1 * i for i in range(n_partitions)],
+            observable=lambda: thermo.potential_energy,
+            inverse=True,
+        )
+        simulation.operations.updaters.append(replica_exchange)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `ReplicaExchange`:
+
+    Attributes:
+        parameter (hoomd.variant.Constant): The state parameter of the replica
+            in this partition.
+
+        values (list[float]): The ladder of parameter values, one per
+            partition.
+
+        inverse (bool): When `True`, the reduced energy couples to the inverse
+            of the parameter.
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Updater._doc_inherited)
+
+    def __init__(self, trigger, parameter, values, observable, inverse=False):
+        super().__init__(trigger)
+        self._param_dict.update(
+            ParameterDict(
+                parameter=OnlyTypes(Constant), values=[float], inverse=bool(inverse)
+            )
+        )
+        self.parameter = parameter
+        self.values = values
+        self._observable = observable
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.ReplicaExchangeUpdater(
+            self._simulation.state._cpp_sys_def,
+            self.trigger,
+            self.parameter,
+            self._observable,
+        )
+
+    @property
+    def observable(self):
+        """`callable`: Returns the observable of the replica (*read only*)."""
+        return self._observable
+
+    @log(requires_run=True)
+    def rung(self):
+        """int: The rung of the ladder held by this partition."""
+        return self._cpp_obj.rung
+
+    @log(category="sequence", requires_run=True)
+    def acceptance(self):
+        """list[tuple[int, int]]: Accepted and attempted exchanges.
+
+        Element :math:`k` counts the exchanges between the rungs :math:`k` and
+        :math:`k+1`.
+        """
+        return list(zip(self._cpp_obj.accepted, self._cpp_obj.attempted))
@@ -4,6 +4,7 @@
 """Utilities."""
 
 import hoomd
+import importlib
 import io
 from collections.abc import Iterable, Mapping, MutableMapping
 
@@ -255,6 +256,25 @@ class _SafeNamespaceDict(_NamespaceDict):
             super().__setitem__(namespace, value)
 
 
+class _LazyModule:
+    """Import a module on first attribute access.
+
+    Shape and evaluator specific classes are compiled into separate extension
+    modules. Operations refer to these modules through `_LazyModule` so that
+    importing `hoomd.md` or `hoomd.hpmc` does not load every template
+    instantiation.
+    """
+
+    def __init__(self, name):
+        self._name = name
+        self._module = None
+
+    def __getattr__(self, attr):
+        if self._module is None:
+            self._module = importlib.import_module(self._name)
+        return getattr(self._module, attr)
+
+
 def make_example_simulation(
     device=None, dimensions=3, particle_types=["A"], mpcd_types=None
 ):
@@ -12,6 +12,16 @@ results to output files or streams:
 * Use `HDF5Log` to store logged data in HDF5 resizable datasets.
 * Use `Table` to display the status of the simulation periodically to standard
   out.
+* Use `TextLog` to write scalar logged quantities to a delimited text file with
+  low overhead.
+* Use `MultipleTauCorrelator` to accumulate the mean squared displacement and
+  velocity autocorrelation while the simulation runs.
+* `SharedMemory` publishes frames to shared memory for in-situ visualization
+  and analysis by other processes on the same node, which read them with
+  `SharedMemoryReader`.
+* `Prefetch` copies local particle data to host memory in the background for
+  scripts that read it periodically.
+* `Telemetry` publishes performance metrics for monitoring tools.
 * Implement custom output formats with `CustomWriter`.
 
 Writers do not modify the system state.
@@ -32,6 +42,11 @@ from hoomd.write.gsd_burst import Burst
 from hoomd.write.dcd import DCD
 from hoomd.write.table import Table
 from hoomd.write.hdf5 import HDF5Log
+from hoomd.write.text_log import TextLog
+from hoomd.write.correlator import MultipleTauCorrelator
+from hoomd.write.shared_memory import SharedMemory, SharedMemoryReader
+from hoomd.write.prefetch import Prefetch
+from hoomd.write.telemetry import Telemetry
 
 __all__ = [
     "DCD",
@@ -39,5 +54,11 @@ __all__ = [
     "Burst",
     "CustomWriter",
     "HDF5Log",
+    "MultipleTauCorrelator",
+    "Prefetch",
+    "SharedMemory",
+    "SharedMemoryReader",
     "Table",
+    "Telemetry",
+    "TextLog",
 ]
@@ -0,0 +1,261 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement MultipleTauCorrelator.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+"""
+
+import hoomd
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes, positive_real
+from hoomd.filter import ParticleFilter, All
+from hoomd.logging import log
+from hoomd.operation import Writer
+from hoomd.trigger import Periodic
+
+
+class MultipleTauCorrelator(Writer):
+    r"""Accumulate time correlation functions with a multiple-tau correlator.
+
+    Args:
+        trigger (hoomd.trigger.Periodic): Select the timesteps to sample.
+        filter (hoomd.filter.filter_like): Particles to correlate.
+        points (int): Number of values stored in each level. Must be a
+            multiple of *averaging*. Defaults to 16.
+        averaging (int): Number of values averaged when passing values to
+            the next level. Defaults to 2.
+        levels (int): Number of levels. Defaults to 16.
+        quantities (tuple[str]): Correlation functions to accumulate. Any of
+            ``'msd'`` and ``'vacf'``. Defaults to ``('msd', 'vacf')``.
+
+    `MultipleTauCorrelator` accumulates the mean squared displacement
+
+    .. math::
+
+        \mathrm{MSD}(\tau) = \frac{1}{N} \sum_{i=1}^N
+        \langle |\vec{r}_i(t_0 + \tau) - \vec{r}_i(t_0)|^2 \rangle_{t_0}
+
+    and the velocity autocorrelation function
+
+    .. math::
+
+        \mathrm{VACF}(\tau) = \frac{1}{N} \sum_{i=1}^N
+        \langle \vec{v}_i(t_0 + \tau) \cdot \vec{v}_i(t_0) \rangle_{t_0}
+
+    of the particles selected by *filter* while the simulation runs, averaging
+    over all time origins :math:`t_0` sampled by *trigger*. :math:`\vec{r}_i`
+    is the unwrapped position of particle :math:`i`.
+
+    The correlator has *levels* levels of *points* values each. Level 0 stores
+    the latest samples and every *averaging* values inserted into one level
+    add one value to the next, so level :math:`k` resolves lags of
+    :math:`j \cdot \mathrm{averaging}^k` samples. The lags reach
+    :math:`\mathrm{points} \cdot \mathrm{averaging}^{\mathrm{levels} - 1}`
+    samples while storing only ``points * levels`` values per particle and
+    quantity, and the cost per sample is independent of the longest lag. The
+    velocity autocorrelation uses velocities averaged over the lag resolution
+    at higher levels. The mean squared displacement is exact at every lag.
+
+    The histories stay in memory (on the GPU, in device memory) and move with
+    the particles between MPI ranks. `MultipleTauCorrelator` logs the
+    correlation functions reduced over all particles so there is no need to
+    write per-particle trajectories to compute them. It resets when the number
+    of particles or selected particles changes.
+
+    Note:
+        `msd` and `vacf` are only available on MPI rank 0. They are `None` on
+        other ranks.
+
+    Important:
+        *trigger* must be a `hoomd.trigger.Periodic` trigger, as the lags
+        assume evenly spaced samples.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        correlator = hoomd.write.MultipleTauCorrelator(
+            trigger=hoomd.trigger.Periodic(10), filter=hoomd.filter.All()
+        )
+        simulation.operations.writers.append(correlator)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `MultipleTauCorrelator`:
+
+    Attributes:
+        filter (hoomd.filter.filter_like): Particles to correlate
+            (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filter_ = correlator.filter
+
+        points (int): Number of values stored in each level (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                points = correlator.points
+
+        averaging (int): Number of values averaged when passing values to
+            the next level (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                averaging = correlator.averaging
+
+        levels (int): Number of levels (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                levels = correlator.levels
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
+
+    def __init__(
+        self,
+        trigger,
+        filter=All(),
+        points=16,
+        averaging=2,
+        levels=16,
+        quantities=("msd", "vacf"),
+    ):
+        super().__init__(trigger)
+
+        if not isinstance(self.trigger, Periodic):
+            raise ValueError("MultipleTauCorrelator requires a Periodic trigger.")
+
+        quantities = tuple(quantities)
+        if len(quantities) == 0 or not set(quantities) <= {"msd", "vacf"}:
+            raise ValueError("quantities must include one or both of 'msd' and 'vacf'.")
+        self._quantities = quantities
+
+        if points % averaging != 0:
+            raise ValueError("points must be a multiple of averaging.")
+
+        self._param_dict.update(
+            ParameterDict(
+                filter=ParticleFilter,
+                points=OnlyTypes(int, preprocess=positive_real),
+                averaging=OnlyTypes(int, preprocess=positive_real),
+                levels=OnlyTypes(int, preprocess=positive_real),
+            )
+        )
+        self.filter = filter
+        self.points = points
+        self.averaging = averaging
+        self.levels = levels
+
+    def _attach_hook(self):
+        group = self._simulation.state._get_group(self.filter)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _hoomd.MultipleTauCorrelator
+        else:
+            cpp_class = _hoomd.MultipleTauCorrelatorGPU
+
+        self._cpp_obj = cpp_class(
+            self._simulation.state._cpp_sys_def,
+            self.trigger,
+            group,
+            self.points,
+            self.averaging,
+            self.levels,
+            "msd" in self._quantities,
+            "vacf" in self._quantities,
+        )
+
+    @property
+    def quantities(self):
+        """tuple[str]: Correlation functions to accumulate (*read-only*).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            quantities = correlator.quantities
+        """
+        return self._quantities
+
+    @log(category="sequence", requires_run=True)
+    def lag_steps(self):
+        """(*N_lags*, ) `numpy.ndarray` of ``numpy.uint64``: Lags in timesteps.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            lag_steps = correlator.lag_steps
+        """
+        return self._cpp_obj.lags * self.trigger.period
+
+    @log(category="sequence", requires_run=True)
+    def msd(self):
+        r"""(*N_lags*, ) `numpy.ndarray` of ``numpy.float64``: Mean squared \
+        displacement at each lag :math:`[\mathrm{length}^2]`.
+
+        `numpy.nan` at lags that have not been sampled yet. `None` when
+        *quantities* does not include ``'msd'``.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            msd = correlator.msd
+        """
+        return self._cpp_obj.msd
+
+    @log(category="sequence", requires_run=True)
+    def vacf(self):
+        r"""(*N_lags*, ) `numpy.ndarray` of ``numpy.float64``: Velocity \
+        autocorrelation at each lag :math:`[\mathrm{velocity}^2]`.
+
+        `numpy.nan` at lags that have not been sampled yet. `None` when
+        *quantities* does not include ``'vacf'``.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            vacf = correlator.vacf
+        """
+        return self._cpp_obj.vacf
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples since the last reset.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            num_samples = correlator.num_samples
+        """
+        return self._cpp_obj.num_samples
+
+    def reset(self):
+        """Discard all samples.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            correlator.reset()
+        """
+        if self._attached:
+            self._cpp_obj.reset()
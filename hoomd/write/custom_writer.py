@@ -15,8 +15,12 @@
 
 from hoomd.custom import Action, CustomOperation
 from hoomd.custom.custom_operation import _InternalCustomOperation
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes
 from hoomd.operation import Writer
 
+_batch_quantities = ("position", "typeid", "velocity", "image", "orientation")
+
 
 class _WriterProperty:
     @property
@@ -38,6 +42,13 @@ class CustomWriter(CustomOperation, _WriterProperty, Writer):
         action (hoomd.custom.Action): The action to call.
         trigger (hoomd.trigger.trigger_like): Select the timesteps to call the
           action.
+        batch_size (int): Number of frames to pass to the action's
+          ``act_batch`` method in each call. Set to 0 to call ``act`` on every
+          triggered timestep. Defaults to 0.
+        batch_quantities (tuple[str]): Per-particle quantities to store in each
+          frame of a batch. Any of ``'position'``, ``'typeid'``,
+          ``'velocity'``, ``'image'``, and ``'orientation'``. Defaults to
+          ``('position',)``.
 
     `CustomWriter` is a `hoomd.operation.Writer` that wraps a user-defined
     `hoomd.custom.Action` object so the action can be added to a
@@ -46,6 +57,22 @@ class CustomWriter(CustomOperation, _WriterProperty, Writer):
     Writers may read the system state and generate output files or print to
     output streams. Writers should not modify the system state.
 
+    `hoomd.Simulation.run` releases the Python global interpreter lock while
+    C++ code advances the simulation and acquires it only to call Python.
+    Other Python threads continue to run during `hoomd.Simulation.run`. They
+    must not access or modify the simulation.
+
+    When *batch_size* is greater than 0, `CustomWriter` does not call Python on
+    the triggered timesteps. Instead, it copies *batch_quantities* of the
+    particles local to each rank and calls ``action.act_batch(frames)`` once it
+    has stored *batch_size* frames. *frames* is a `list` of `dict` with the
+    keys ``'timestep'``, ``'tag'``, and one `numpy.ndarray` per quantity, in
+    the order the particles are stored on the rank (use ``'tag'`` to identify
+    them). Use batches when the action only needs these quantities and can
+    process them late, as calling Python on every timestep stalls the
+    simulation. `CustomWriter` delivers the remaining frames when it is
+    removed from the simulation or when `flush` is called.
+
     .. rubric:: Example:
 
     .. code-block:: python
@@ -56,6 +83,13 @@ class CustomWriter(CustomOperation, _WriterProperty, Writer):
             )
             simulation.operations.writers.append(custom_writer)
 
+    Attributes:
+        batch_size (int): Number of frames to pass to ``act_batch`` in each
+          call. 0 calls ``act`` on every triggered timestep.
+
+        batch_quantities (list[str]): Per-particle quantities to store in each
+          frame of a batch.
+
     See Also:
         The base class `hoomd.custom.CustomOperation`.
 
@@ -68,6 +102,34 @@ class CustomWriter(CustomOperation, _WriterProperty, Writer):
     _cpp_class_name = "PythonAnalyzer"
     __doc__ += CustomOperation._doc_inherited
 
+    def __init__(self, trigger, action, batch_size=0, batch_quantities=("position",)):
+        super().__init__(trigger, action)
+        self._param_dict.update(
+            ParameterDict(batch_size=OnlyTypes(int), batch_quantities=[str])
+        )
+        self.batch_size = batch_size
+        self.batch_quantities = list(batch_quantities)
+
+    def _attach_hook(self):
+        if not set(self.batch_quantities) <= set(_batch_quantities):
+            raise ValueError(
+                f"batch_quantities must be a subset of {_batch_quantities}."
+            )
+        if self.batch_size > 0 and not callable(
+            getattr(self._action, "act_batch", None)
+        ):
+            raise ValueError("batch_size > 0 requires an action with act_batch.")
+        super()._attach_hook()
+
+    def flush(self):
+        """Pass the stored frames to ``act_batch``.
+
+        Does nothing when no frames are stored or `CustomWriter` is not
+        attached.
+        """
+        if self._attached:
+            self._cpp_obj.flush()
+
 
 class _InternalCustomWriter(_InternalCustomOperation, Writer):
     _cpp_list_name = "analyzers"
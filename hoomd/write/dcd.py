@@ -45,6 +45,9 @@ class DCD(Writer):
     length units, and is limited to simulations where the number of particles
     is fixed.
 
+    In MPI simulations, `DCD` gathers only the written coordinates of the
+    selected particles on the root rank.
+
     Warning:
         When you use `DCD` to append to an existing DCD file:
 
@@ -129,6 +132,19 @@ class DCD(Writer):
             .. code-block:: python
 
                 dcd.angle_z = True
+
+        asynchronous (bool): When `True`, write frames to the file on a
+            background thread so that the simulation does not wait for the
+            file system. `DCD` stages each frame before it continues the
+            simulation and holds at most two frames in memory waiting to be
+            written. `flush()` waits for all pending frames. Defaults to
+            `False`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                dcd.asynchronous = True
     """
 
     __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
@@ -153,6 +169,7 @@ class DCD(Writer):
                 unwrap_full=bool(unwrap_full),
                 unwrap_rigid=bool(unwrap_rigid),
                 angle_z=bool(angle_z),
+                asynchronous=False,
             )
         )
         self.filter = filter
@@ -167,3 +184,15 @@ class DCD(Writer):
             group,
             self.overwrite,
         )
+
+    def flush(self):
+        """Wait until all pending frames are written to the file.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            dcd.flush()
+        """
+        if self._attached:
+            self._cpp_obj.flush()
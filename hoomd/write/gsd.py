@@ -13,7 +13,7 @@ from collections.abc import Mapping, Collection
 from hoomd.trigger import Periodic
 from hoomd import _hoomd
 from hoomd.util import _dict_flatten
-from hoomd.data.typeconverter import OnlyFrom, RequiredArg
+from hoomd.data.typeconverter import OnlyFrom, OnlyTypes, RequiredArg
 from hoomd.filter import ParticleFilter, All
 from hoomd.data.parameterdicts import ParameterDict
 from hoomd.logging import Logger, LoggerCategories
@@ -71,6 +71,8 @@ class GSD(Writer):
             all frames. Defaults to ``['property']``.
         logger (hoomd.logging.Logger): Provide log quantities to write. Defaults
             to `None`.
+        staging_directory (str): Directory on fast local storage that stages
+            the file when `truncate` is `True`. Defaults to `None`.
 
     `GSD` writes the simulation trajectory to the specified file in the GSD
     format. `GSD` can store all particle, bond, angle, dihedral, improper,
@@ -100,6 +102,8 @@ class GSD(Writer):
     default for all particles, these fields will not take up any space in the
     file, except on frame 1+ when the field is also non-default in frame 0.
     `GSD` writes all non-default fields to frame 0 in the file.
+    Similarly, `GSD` writes the logged ``type_shapes`` on frame 1+ only when
+    they differ from the shapes in frame 0.
 
     To further reduce file sizes, `GSD` allows the user to select which specific
     fields will be considered for writing to frame 1+ in the `dynamic` list.
@@ -161,6 +165,21 @@ class GSD(Writer):
         writes only the selected particles in ascending tag order and does
         **not** write out **topology**.
 
+    .. rubric:: Staged checkpoints
+
+    Checkpoints written with ``truncate=True`` to a parallel file system
+    pause the simulation for the duration of each write. Set
+    `staging_directory` to a directory on node-local storage (such as an NVMe
+    drive or a RAM disk) to write the file there instead. After each frame,
+    `GSD` copies the staged file to `filename` on a background thread: it
+    writes the copy to ``filename + '.tmp'`` and renames it, so `filename`
+    always holds the most recent complete checkpoint that reached the parallel
+    file system. The staged file may hold a newer checkpoint. Restart from
+    whichever file holds the later ``configuration/step``. `flush()` waits for
+    the copy to complete. The name of the staged file includes the partition
+    index (for example, ``checkpoint.0.gsd`` stages ``checkpoint.gsd`` on
+    partition 0), so partitions that share a node stage separate files.
+
     Tip:
         All logged data fields must be present in the first frame in the gsd
         file to provide the default value. To achieve this, set the `logger`
@@ -222,6 +241,15 @@ class GSD(Writer):
 
                 truncate = gsd.truncate
 
+        staging_directory (str): Directory on fast local storage that stages
+            the file (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                staging_directory = gsd.staging_directory
+
         dynamic (list[str]): Field names and/or field categores to save in
             all frames.
 
@@ -261,6 +289,47 @@ class GSD(Writer):
             .. code-block:: python
 
                 gsd.maximum_write_buffer_size = 128 * 1024**2
+
+        asynchronous (bool): When `True`, write frames to the file on a
+            background thread so that the simulation does not wait for the
+            file system. `GSD` copies each frame before it continues the
+            simulation and holds at most two frames in memory waiting to be
+            written. `flush()` waits for all pending frames. Defaults to
+            `False`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.asynchronous = True
+
+        position_quantization_bits (int): When non-zero, round each particle
+            position to a grid of ``2**position_quantization_bits`` points
+            along each box vector before writing. Quantization is lossy: the
+            maximum error is half a grid spacing, ``L / 2**(bits + 1)``. The
+            quantized values have many zero mantissa bits, so the trajectory
+            compresses much better with file system compression or tools such
+            as ``zstd``. The file is a standard GSD file. Must be between 0 and
+            24. Defaults to 0 (full precision).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.position_quantization_bits = 16
+
+        parallel_io (bool): When `True` in MPI simulations, every rank writes
+            the per-particle data of its own particles directly to the file
+            with collective MPI-IO. No rank gathers the whole frame into
+            memory. The file format is unchanged. Parallel I/O requires a file
+            system that supports MPI-IO from all ranks, and `GSD` writes such
+            frames synchronously. Defaults to `False`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.parallel_io = True
     """
 
     __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
@@ -274,6 +343,7 @@ class GSD(Writer):
         truncate=False,
         dynamic=None,
         logger=None,
+        staging_directory=None,
     ):
         super().__init__(trigger)
 
@@ -308,10 +378,16 @@ class GSD(Writer):
                 filter=ParticleFilter,
                 mode=str(mode),
                 truncate=bool(truncate),
+                staging_directory=OnlyTypes(str, allow_none=True),
                 dynamic=[dynamic_validation],
                 write_diameter=False,
                 maximum_write_buffer_size=64 * 1024 * 1024,
-                _defaults=dict(filter=filter, dynamic=dynamic),
+                asynchronous=False,
+                position_quantization_bits=0,
+                parallel_io=False,
+                _defaults=dict(
+                    filter=filter, dynamic=dynamic, staging_directory=staging_directory
+                ),
             )
         )
 
@@ -325,6 +401,7 @@ class GSD(Writer):
             self._simulation.state._get_group(self.filter),
             self.mode,
             self.truncate,
+            "" if self.staging_directory is None else str(self.staging_directory),
         )
 
         self._cpp_obj.log_writer = self.logger
@@ -359,6 +436,7 @@ class GSD(Writer):
             state._get_group(filter),
             mode,
             False,
+            "",
         )
 
         if logger is not None:
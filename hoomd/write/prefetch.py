@@ -0,0 +1,129 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement Prefetch.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+"""
+
+from hoomd import _hoomd
+from hoomd.operation import Writer
+
+_quantities = (
+    "position",
+    "typeid",
+    "velocity",
+    "mass",
+    "orientation",
+    "image",
+    "tag",
+    "net_force",
+)
+
+
+class Prefetch(Writer):
+    """Copy local particle data to host memory without stalling the simulation.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to copy.
+        quantities (tuple[str]): Per-particle quantities to copy. Any of
+            ``'position'``, ``'typeid'``, ``'velocity'``, ``'mass'``,
+            ``'orientation'``, ``'image'``, ``'tag'``, and ``'net_force'``.
+            Defaults to ``('position', 'tag')``.
+
+    On each triggered timestep, `Prefetch` starts a copy of the selected
+    quantities of the local particles to host memory. On the GPU, the copy runs
+    asynchronously after the kernels of the step, so the simulation continues
+    while the data transfers. Call `read` later, for example in a
+    `CustomWriter` or between calls to `hoomd.Simulation.run`, to get the last
+    frame. Reading `hoomd.State.cpu_local_snapshot` on the GPU, in contrast,
+    waits for a copy of the whole arrays at the moment it is accessed.
+
+    The frame holds the particles local to the rank in their current order,
+    like `hoomd.State.cpu_local_snapshot`. Include ``'tag'`` to identify the
+    particles. ``'position'``, ``'velocity'``, and ``'net_force'`` have
+    shape ``(N, 3)``, ``'orientation'`` has shape ``(N, 4)``, and
+    ``'image'`` has shape ``(N, 3)``.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        prefetch = hoomd.write.Prefetch(trigger=hoomd.trigger.Periodic(100))
+        simulation.operations.writers.append(prefetch)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Prefetch`:
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
+
+    def __init__(self, trigger, quantities=("position", "tag")):
+        super().__init__(trigger)
+
+        quantities = tuple(quantities)
+        if len(quantities) == 0 or not set(quantities) <= set(_quantities):
+            raise ValueError(
+                f"quantities must be a non-empty subset of {_quantities}."
+            )
+        self._quantities = quantities
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.LocalDataPrefetcher(
+            self._simulation.state._cpp_sys_def,
+            self.trigger,
+            list(self._quantities),
+        )
+
+    @property
+    def quantities(self):
+        """tuple[str]: Per-particle quantities to copy (*read-only*).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            quantities = prefetch.quantities
+        """
+        return self._quantities
+
+    @property
+    def ready(self):
+        """bool: True when `read` returns without waiting for the copy.
+
+        `False` before the first frame.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            ready = prefetch.ready
+        """
+        if not self._attached:
+            return False
+        return self._cpp_obj.ready
+
+    def read(self):
+        """Get the last frame.
+
+        Waits for the copy of the frame to complete.
+
+        Returns:
+            dict: The ``'timestep'`` (`int`) of the frame and one
+            `numpy.ndarray` per quantity with one row per local particle.
+            `None` before the first frame.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            frame = prefetch.read()
+        """
+        if not self._attached:
+            return None
+        return self._cpp_obj.read()
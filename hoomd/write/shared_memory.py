@@ -0,0 +1,311 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement SharedMemory and SharedMemoryReader.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+"""
+
+import sys
+from multiprocessing import shared_memory
+
+import numpy
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes
+from hoomd.filter import ParticleFilter, All
+from hoomd.operation import Writer
+
+_quantity_dtypes = {
+    "position": (numpy.float32, 3),
+    "orientation": (numpy.float32, 4),
+    "typeid": (numpy.uint32, 1),
+    "image": (numpy.int32, 3),
+    "velocity": (numpy.float32, 3),
+}
+
+_header_bytes = 128
+_slot_header_bytes = 128
+_layout_version = 1
+
+
+class SharedMemory(Writer):
+    """Publish frames to shared memory for in-situ visualization and analysis.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to publish.
+        name (str): Name of the shared memory object.
+        filter (hoomd.filter.filter_like): Select the particles to publish.
+            Defaults to `hoomd.filter.All`.
+        quantities (tuple[str]): Per-particle quantities to publish. Any of
+            ``'position'``, ``'orientation'``, ``'typeid'``, ``'image'``, and
+            ``'velocity'``. Defaults to
+            ``('position', 'orientation', 'typeid', 'image')``.
+        slots (int): Number of frames kept in the ring. Defaults to 4.
+
+    `SharedMemory` copies the box and the selected per-particle quantities of
+    the particles in *filter*, sorted by tag, into a ring of *slots* frames in a
+    POSIX shared memory object. Other processes on the same node read the
+    latest frame with `SharedMemoryReader` while the simulation runs, without
+    writing trajectories to the file system. The simulation never waits for
+    readers: when a reader falls behind, `SharedMemory` overwrites the frames
+    it has not read.
+
+    Positions are wrapped into the box and stored in single precision.
+    Orientations are stored as ``(s, x, y, z)``.
+
+    `SharedMemory` creates the shared memory object on the first frame and
+    removes it when the writer is removed from the simulation or destroyed. An
+    existing object with the same name is replaced. The first frame sets the
+    capacity of the ring: `SharedMemory` raises an error when *filter* later
+    selects more particles.
+
+    In MPI simulations, `SharedMemory` gathers the published quantities on the
+    root rank, which owns the shared memory object. Readers must run on the
+    same node as the root rank.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        shared_memory = hoomd.write.SharedMemory(
+            trigger=hoomd.trigger.Periodic(1000), name="hoomd-viz"
+        )
+        simulation.operations.writers.append(shared_memory)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `SharedMemory`:
+
+    Attributes:
+        name (str): Name of the shared memory object (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                name = shared_memory.name
+
+        filter (hoomd.filter.filter_like): Select the particles to publish
+            (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filter_ = shared_memory.filter
+
+        slots (int): Number of frames kept in the ring (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                slots = shared_memory.slots
+    """
+
+    __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
+
+    def __init__(
+        self,
+        trigger,
+        name,
+        filter=All(),
+        quantities=("position", "orientation", "typeid", "image"),
+        slots=4,
+    ):
+        super().__init__(trigger)
+
+        quantities = tuple(quantities)
+        if len(quantities) == 0 or not set(quantities) <= set(_quantity_dtypes):
+            raise ValueError(
+                "quantities must be a non-empty subset of "
+                f"{tuple(_quantity_dtypes)}."
+            )
+        self._quantities = quantities
+
+        self._param_dict.update(
+            ParameterDict(
+                name=str,
+                filter=ParticleFilter,
+                slots=OnlyTypes(int),
+            )
+        )
+        self.name = name
+        self.filter = filter
+        self.slots = slots
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.SharedMemoryWriter(
+            self._simulation.state._cpp_sys_def,
+            self.trigger,
+            self.name,
+            self._simulation.state._get_group(self.filter),
+            list(self._quantities),
+            self.slots,
+        )
+
+    @property
+    def quantities(self):
+        """tuple[str]: Per-particle quantities to publish (*read-only*).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            quantities = shared_memory.quantities
+        """
+        return self._quantities
+
+
+class SharedMemoryReader:
+    """Read frames published by `SharedMemory`.
+
+    Args:
+        name (str): Name of the shared memory object.
+
+    `SharedMemoryReader` maps the shared memory object that a `SharedMemory`
+    writer publishes and copies out the latest complete frame on demand. It
+    does not require an active simulation or MPI and is intended for
+    visualization and analysis processes that follow a running simulation on
+    the same node.
+
+    Opening the reader raises `FileNotFoundError` until the writer publishes
+    its first frame.
+
+    .. rubric:: Example:
+
+    .. skip: next
+
+    .. code-block:: python
+
+        reader = hoomd.write.SharedMemoryReader(name="hoomd-viz")
+        frame = reader.read()
+        if frame is not None:
+            position = frame["position"]
+        reader.close()
+    """
+
+    def __init__(self, name):
+        if sys.version_info >= (3, 13):
+            self._shm = shared_memory.SharedMemory(name=name, track=False)
+        else:
+            self._shm = shared_memory.SharedMemory(name=name)
+            # The writer owns the object. Prevent the resource tracker from
+            # removing it when this process exits.
+            from multiprocessing import resource_tracker
+
+            resource_tracker.unregister(self._shm._name, "shared_memory")
+
+        buf = self._shm.buf
+        if bytes(buf[0:8]) != b"HOOMDSHM":
+            self._shm.close()
+            raise RuntimeError(f"{name} is not a HOOMD-blue shared memory ring.")
+
+        version, n_slots = numpy.frombuffer(buf, numpy.uint32, 2, 8)
+        if version != _layout_version:
+            self._shm.close()
+            raise RuntimeError(f"Unsupported shared memory layout version {version}.")
+
+        slot_bytes, capacity = numpy.frombuffer(buf, numpy.uint64, 2, 16)
+        (mask,) = numpy.frombuffer(buf, numpy.uint32, 1, 40)
+
+        self._n_slots = int(n_slots)
+        self._slot_bytes = int(slot_bytes)
+        self._capacity = int(capacity)
+        self._quantities = tuple(
+            q for i, q in enumerate(_quantity_dtypes) if int(mask) & (1 << i)
+        )
+
+    @property
+    def quantities(self):
+        """tuple[str]: Per-particle quantities in each frame.
+
+        .. rubric:: Example:
+
+        .. skip: next
+
+        .. code-block:: python
+
+            quantities = reader.quantities
+        """
+        return self._quantities
+
+    @property
+    def num_frames(self):
+        """int: Number of frames published so far.
+
+        .. rubric:: Example:
+
+        .. skip: next
+
+        .. code-block:: python
+
+            num_frames = reader.num_frames
+        """
+        return int(numpy.frombuffer(self._shm.buf, numpy.uint64, 1, 32)[0])
+
+    def read(self):
+        """Copy the latest complete frame.
+
+        Returns:
+            dict: The ``'timestep'`` (`int`), ``'box'`` (`list` [`float`] in
+            the `hoomd.box.box_like` order ``[Lx, Ly, Lz, xy, xz, yz]``), and one
+            `numpy.ndarray` per quantity with *N* rows. `None` when no frame has
+            been published.
+
+        .. rubric:: Example:
+
+        .. skip: next
+
+        .. code-block:: python
+
+            frame = reader.read()
+        """
+        buf = self._shm.buf
+        while True:
+            num_frames = self.num_frames
+            if num_frames == 0:
+                return None
+
+            slot = (num_frames - 1) % self._n_slots
+            offset = _header_bytes + slot * self._slot_bytes
+            sequence = numpy.frombuffer(buf, numpy.uint64, 1, offset)
+            start = int(sequence[0])
+            if start % 2 == 1:
+                continue
+
+            timestep, N = numpy.frombuffer(buf, numpy.uint64, 2, offset + 8).tolist()
+            box = numpy.frombuffer(buf, numpy.float64, 6, offset + 24).tolist()
+            frame = dict(timestep=timestep, box=box)
+
+            field_offset = offset + _slot_header_bytes
+            for quantity in self._quantities:
+                dtype, width = _quantity_dtypes[quantity]
+                if N <= self._capacity:
+                    values = numpy.frombuffer(buf, dtype, N * width, field_offset)
+                    values = values.reshape((N, width)) if width > 1 else values
+                    frame[quantity] = values.copy()
+                field_offset += self._capacity * width * 4
+
+            # Retry when the writer changed the slot while it was copied.
+            if int(sequence[0]) == start and N <= self._capacity:
+                return frame
+
+    def close(self):
+        """Unmap the shared memory object.
+
+        .. rubric:: Example:
+
+        .. skip: next
+
+        .. code-block:: python
+
+            reader.close()
+        """
+        self._shm.close()
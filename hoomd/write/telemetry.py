@@ -0,0 +1,249 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement Telemetry.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    telemetry_filename = tmp_path / "hoomd.prom"
+"""
+
+import os
+
+from hoomd.write.custom_writer import _InternalCustomWriter
+from hoomd.custom.custom_action import _InternalAction
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.operation import Writer
+
+
+class _TelemetryInternal(_InternalAction):
+    """Collect the performance metrics and write them to the metrics file."""
+
+    _skip_for_equality = {"_simulation"}
+
+    def __init__(self, filename):
+        self._param_dict = ParameterDict(filename=str(filename))
+        self._simulation = None
+
+    def _setattr_param(self, attr, value):
+        """Makes self._param_dict attributes read only."""
+        raise ValueError("Attribute {} is read-only.".format(attr))
+
+    def attach(self, simulation):
+        self._simulation = simulation
+
+    def detach(self):
+        self._simulation = None
+
+    def _collect(self):
+        """Return a list of (name, help, type, [(labels, value), ...])."""
+        sim = self._simulation
+        metrics = []
+
+        def add(name, help, type, samples):
+            metrics.append((name, help, type, samples))
+
+        steps_left = max(sim.final_timestep - sim.timestep, 0)
+        tps = sim.tps
+        add(
+            "hoomd_timestep",
+            "Current simulation time step.",
+            "gauge",
+            [({}, sim.timestep)],
+        )
+        add(
+            "hoomd_tps",
+            "Average time steps per second in the current run.",
+            "gauge",
+            [({}, tps)],
+        )
+        add(
+            "hoomd_eta_seconds",
+            "Estimated wall clock time until the current run completes.",
+            "gauge",
+            [({}, steps_left / tps if tps > 0 else float("nan"))],
+        )
+        add(
+            "hoomd_walltime_seconds",
+            "Wall clock time elapsed in the current run.",
+            "gauge",
+            [({}, sim.walltime)],
+        )
+        add(
+            "hoomd_local_particles",
+            "Number of particles owned by this rank.",
+            "gauge",
+            [({}, sim.state._cpp_sys_def.getParticleData().getN())],
+        )
+
+        comm = sim.communication_walltime
+        add(
+            "hoomd_communication_seconds_total",
+            "Wall clock time spent in domain decomposition communication.",
+            "counter",
+            [
+                ({"phase": phase}, comm[i])
+                for i, phase in enumerate(("migrate", "ghost_exchange", "ghost_update"))
+            ],
+        )
+
+        nlists = []
+        integrator = sim.operations.integrator
+        for force in getattr(integrator, "forces", ()):
+            nlist = getattr(force, "nlist", None)
+            if hasattr(nlist, "num_builds") and not any(nlist is n for n in nlists):
+                nlists.append(nlist)
+        if nlists:
+            add(
+                "hoomd_neighbor_list_builds_total",
+                "Neighbor list builds in the current run.",
+                "counter",
+                [
+                    ({"nlist": f"{i}_{type(n).__name__}"}, n.num_builds)
+                    for i, n in enumerate(nlists)
+                ],
+            )
+
+        tuning = all(op.is_tuning_complete for op in sim.operations)
+        add(
+            "hoomd_autotuning_complete",
+            "1 when all kernel autotuners on this rank have completed tuning.",
+            "gauge",
+            [({}, int(tuning))],
+        )
+
+        host = []
+        device = []
+        for owner, (host_bytes, device_bytes) in sim.memory_usage.items():
+            host.append(({"owner": owner}, host_bytes))
+            device.append(({"owner": owner}, device_bytes))
+        add(
+            "hoomd_memory_host_bytes",
+            "Host memory held by internal arrays on this rank.",
+            "gauge",
+            host,
+        )
+        add(
+            "hoomd_memory_device_bytes",
+            "Device memory held by internal arrays on this rank.",
+            "gauge",
+            device,
+        )
+        return metrics
+
+    def _format(self, metrics, rank):
+        lines = []
+        for name, help, type, samples in metrics:
+            lines.append(f"# HELP {name} {help}")
+            lines.append(f"# TYPE {name} {type}")
+            for labels, value in samples:
+                labels = {"rank": str(rank), **labels}
+                label_str = ",".join(f'{k}="{v}"' for k, v in labels.items())
+                lines.append(f"{name}{{{label_str}}} {float(value)!r}")
+        return "\n".join(lines) + "\n"
+
+    def act(self, timestep=None):
+        """Write the metrics file."""
+        # All metrics are local to the rank, so the ranks need not agree.
+        rank = self._simulation.device.communicator.rank
+        per_rank = "{rank}" in self.filename
+        if not per_rank and rank != 0:
+            return
+
+        metrics = self._collect()
+        filename = self.filename.replace("{rank}", str(rank))
+        tmp_filename = filename + ".tmp"
+        with open(tmp_filename, "w") as f:
+            f.write(self._format(metrics, rank))
+        os.replace(tmp_filename, filename)
+
+
+class Telemetry(_InternalCustomWriter):
+    """Publish live performance metrics for monitoring tools.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to update
+            the metrics.
+        filename (str): Name of the metrics file. Replace ``{rank}`` in the
+            name with the MPI rank to write one file per rank.
+
+    `Telemetry` writes performance metrics of the running simulation in the
+    `Prometheus text exposition format
+    <https://prometheus.io/docs/instrumenting/exposition_formats/>`_. Point the
+    textfile collector of the Prometheus node exporter (or any tool that reads
+    the format) at the file to monitor long runs from a dashboard. `Telemetry`
+    replaces the file atomically, so readers never observe a partial update.
+
+    The metrics are:
+
+    * ``hoomd_timestep`` - The current time step.
+    * ``hoomd_tps`` - `hoomd.Simulation.tps`.
+    * ``hoomd_eta_seconds`` - The estimated wall clock time until the current
+      `hoomd.Simulation.run` completes.
+    * ``hoomd_walltime_seconds`` - `hoomd.Simulation.walltime`.
+    * ``hoomd_local_particles`` - The number of particles owned by the rank.
+    * ``hoomd_communication_seconds_total`` -
+      `hoomd.Simulation.communication_walltime` by ``phase``. Available when
+      `hoomd.Simulation.profiling` is enabled.
+    * ``hoomd_neighbor_list_builds_total`` -
+      `hoomd.md.nlist.NeighborList.num_builds` of each neighbor list used by
+      the integrator's forces.
+    * ``hoomd_autotuning_complete`` - 1 when all operations on the rank have
+      completed tuning, 0 otherwise.
+    * ``hoomd_memory_host_bytes`` and ``hoomd_memory_device_bytes`` -
+      `hoomd.Simulation.memory_usage` by ``owner``.
+
+    Every sample has a ``rank`` label. Write one file per rank to compare the
+    particle counts and communication times across ranks and find load
+    imbalance in domain decomposition simulations. Otherwise, only rank 0
+    writes the file.
+
+    The cost of `Telemetry` is small and independent of the number of
+    particles, but it runs in Python. Choose a trigger period that updates the
+    metrics every few seconds.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        telemetry = hoomd.write.Telemetry(
+            trigger=hoomd.trigger.Periodic(10_000),
+            filename=telemetry_filename,
+        )
+        simulation.operations.writers.append(telemetry)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `Telemetry`:
+
+    Attributes:
+        filename (str): Name of the metrics file (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = telemetry.filename
+    """
+
+    _internal_class = _TelemetryInternal
+    __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
+
+    def write(self):
+        """Write the metrics file now.
+
+        .. invisible-code-block: python
+
+            simulation.operations.writers.append(telemetry)
+            simulation.run(0)
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            telemetry.write()
+        """
+        self._action.act()
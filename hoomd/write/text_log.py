@@ -0,0 +1,170 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement TextLog.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    text_log_filename = tmp_path / 'log.txt'
+"""
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes, positive_real
+from hoomd.logging import LoggerCategories, Logger
+from hoomd.operation import Writer
+
+
+class TextLog(Writer):
+    """Write logged scalar and string quantities to a delimited text file.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to write.
+        filename (str): File name to write.
+        logger (hoomd.logging.Logger): The logger to query for output.
+            `TextLog` supports only ``'scalar'`` and ``'string'`` logger
+            categories.
+        delimiter (str): String to place between columns. Defaults to
+            ``' '``.
+        precision (int): Number of significant digits for floating point
+            values. Defaults to 10.
+        flush_period (int): Number of rows to buffer in memory before writing
+            them to the file. Defaults to 1.
+
+    `TextLog` writes one header line with the names of the logged quantities
+    followed by one row of values on each triggered timestep. Unlike `Table`,
+    `TextLog` is implemented in C++: it collects the values from the logger
+    entries directly and formats and buffers the rows without any Python code,
+    so it adds little overhead when logging frequently. Increase `flush_period`
+    to write the file less often.
+
+    `TextLog` overwrites *filename*. The columns are fixed when the simulation
+    attaches the writer. Quantities added to or removed from the logger after
+    that are not written, and quantities whose objects are deleted are written
+    as ``nan``.
+
+    Note:
+        Call `flush` to write buffered rows to the file before reading the file
+        in the same process.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        logger = hoomd.logging.Logger(categories=["scalar", "string"])
+        logger.add(simulation, quantities=["timestep", "tps"])
+        text_log = hoomd.write.TextLog(
+            trigger=hoomd.trigger.Periodic(100),
+            filename=text_log_filename,
+            logger=logger,
+            flush_period=100,
+        )
+        simulation.operations.writers.append(text_log)
+
+    {inherited}
+
+    ----------
+
+    **Members defined in** `TextLog`:
+
+    Attributes:
+        filename (str): File name to write (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = text_log.filename
+
+        logger (hoomd.logging.Logger): The logger to query for output
+            (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                logger = text_log.logger
+
+        delimiter (str): String to place between columns (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                delimiter = text_log.delimiter
+
+        precision (int): Number of significant digits for floating point
+            values (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                precision = text_log.precision
+
+        flush_period (int): Number of rows to buffer in memory before writing
+            them to the file.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                text_log.flush_period = 1000
+    """
+
+    _accepted_categories = LoggerCategories.any(
+        [LoggerCategories.scalar, LoggerCategories.string]
+    )
+
+    __doc__ = __doc__.replace("{inherited}", Writer._doc_inherited)
+
+    def __init__(
+        self, trigger, filename, logger, delimiter=" ", precision=10, flush_period=1
+    ):
+        super().__init__(trigger)
+
+        if logger.categories & ~self._accepted_categories != LoggerCategories.NONE:
+            raise ValueError(
+                "TextLog may only have scalar or string categories set. "
+                "Use hoomd.write.GSD or hoomd.write.HDF5Log for other "
+                "categories."
+            )
+
+        self._param_dict.update(
+            ParameterDict(
+                filename=str(filename),
+                logger=Logger,
+                delimiter=str(delimiter),
+                precision=OnlyTypes(int, preprocess=positive_real),
+                flush_period=OnlyTypes(int, preprocess=positive_real),
+            )
+        )
+        self.logger = logger
+        self.precision = precision
+        self.flush_period = flush_period
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.TableWriter(
+            self._simulation.state._cpp_sys_def,
+            self.trigger,
+            self.filename,
+            self.delimiter,
+            self.precision,
+            self.flush_period,
+        )
+
+        for namespace, entry in self.logger.items():
+            self._cpp_obj.addColumn(".".join(namespace), entry)
+
+    def flush(self):
+        """Write buffered rows to the file.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            text_log.flush()
+        """
+        if self._attached:
+            self._cpp_obj.flush()